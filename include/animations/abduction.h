@@ -1,1430 +0,0 @@
-// abduction.h - Auto-generated from abduction.json
-#ifndef ANIMATION_ABDUCTION_H
-#define ANIMATION_ABDUCTION_H
-
-#include "animation_types.h"
-
-// Frame Durations for abduction (in 100ms units)
-static const uint8_t PROGMEM abductionDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for abduction
-static const uint16_t PROGMEM abductionFrames[] = {
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0xd698, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0xfffd, 0xfffd, 0xd698, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0xfdb6, 0xfffd, 0x630e, 0xfffd, 0xfffd, 0x2126,
-  0x2126, 0x2126, 0x2126, 0x2126, 0xfffd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0xfdb6, 0xfffd, 0xfffd, 0xfffd, 0xd698, 0xd698,
-  0x2126, 0x2126, 0x2126, 0x2126, 0xfffd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0xfffd, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0x2126, 0xfffd, 0xfffd, 0xfffd, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xfffd, 0x4d3f, 0xfffd, 0x5149,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0xfffd, 0xfffd,
-  0x7bf1, 0xfdb6, 0xfdb6, 0xfffd, 0xfffd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x3d0e, 0x3d0e, 0x3d0e, 0x3d0e, 0x3d0e, 0x3d0e, 0xfffd, 0x7bf1,
-  0x3d0e, 0x3d0e, 0x3d0e, 0x7bf1, 0xfffd, 0x3d0e, 0x3d0e, 0x3d0e,
-  0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0xfffd, 0x7bf1,
-  0x8eeb, 0x8eeb, 0x8eeb, 0x7bf1, 0xfffd, 0x8eeb, 0x8eeb, 0x8eeb,
-  0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0x8eeb, 0x4209, 0x7bf1,
-  0x8eeb, 0x8eeb, 0x8eeb, 0x7bf1, 0x4209, 0x8eeb, 0x8eeb, 0x8eeb,
-  0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee,
-  0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee, 0xcfee,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x553e, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x5d5f, 0x657e, 0xb639, 0x5d5f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x553e, 0x657e, 0xd71c, 0xef9c, 0xce99, 0x54dc,
-  0x44dd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d1f, 0x4cdd, 0x4d1f,
-  0x4d1f, 0x5d3e, 0xe5b8, 0xe73b, 0x8c72, 0xf79b, 0xe73a, 0x424b,
-  0x2168, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d1d, 0x5aaf, 0x4cdd,
-  0x4d1f, 0x5d3e, 0xe5b8, 0xef7c, 0xe75c, 0xf7bc, 0xded9, 0xbdd5,
-  0x4209, 0x3187, 0x2106, 0x4229, 0xdf3b, 0x7dde, 0xc6bc, 0x5d5f,
-  0x4d1f, 0x4d3f, 0x5d3e, 0x5d5f, 0x659f, 0xe77d, 0xffdc, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f, 0x657f, 0xefbd, 0xfffd,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x659f, 0x4d1f, 0x4d1f,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x451d, 0x555d, 0xefbd, 0xef5b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x555d, 0x451d, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x452e, 0x5570, 0xe77b, 0x8c93,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x8ecc, 0xdef9, 0x8452,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x970b, 0x8eab, 0x636c, 0x8450,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf4d, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x553e, 0x4d1f, 0x553e, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xb639, 0x553e, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cdd, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x553e, 0xce99, 0xef9c, 0xceb9, 0x655e, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x5d1d, 0x628f, 0x4cdd, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x657e, 0xdf3b, 0xffdc, 0xef7b, 0xdf3b, 0x4a6b,
-  0x2168, 0x2168, 0x2168, 0x31ea, 0xdf1b, 0xe75b, 0x5d5e, 0x4d1f,
-  0x4d1f, 0x5d5f, 0xcefc, 0x8c72, 0xe73a, 0x8c72, 0xef7b, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xef7b, 0xe79d, 0x5d5f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x657e, 0xe71b, 0xff9c, 0xef3a, 0xded9, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xefbd, 0x659f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x553f, 0xe5b8, 0xedb7, 0xedf8, 0xf79c, 0xfffd,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x5d5f, 0x4d1f, 0x4d3f,
-  0x4d1d, 0x4d1e, 0x4d1d, 0x551d, 0x551d, 0x655d, 0xefbd, 0xef5b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d5d, 0x451d, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452f, 0x3d2e, 0x5570, 0xe77b, 0x8c93,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x8ecc, 0xdef9, 0x8452,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x970b, 0x8eab, 0x636c, 0x8450,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf4d, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x553e, 0x4d1f, 0x553e, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xb63a, 0x653d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xef7c, 0xded9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x5d5f, 0x4d3f,
-  0x4d1f, 0x555f, 0xd73d, 0xef7b, 0xffdc, 0xef5b, 0xd6b8, 0xded9,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xe77d, 0xd73d, 0x5d1d,
-  0x4d1f, 0x4d3f, 0x5d3e, 0x94f5, 0xef5b, 0x9d14, 0xce57, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x6d9f, 0x5d1d, 0x522e,
-  0x4d1d, 0x451d, 0x553d, 0xe71b, 0xff9c, 0xef5b, 0xd6b9, 0xe73a,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x555d, 0x44fd, 0x4cdc,
-  0x452e, 0x452e, 0x552f, 0xe5d5, 0xf5d6, 0xf616, 0xf75b, 0x8c93,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x96ac, 0x96ac, 0x9ecd, 0xdef9, 0x8452,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8eab, 0x636c, 0x8450,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf4d, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d1d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x555f, 0xdf5d, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xce99, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75be, 0xc6bc, 0x5d5f,
-  0x4d1d, 0x4d1d, 0x555d, 0xd73c, 0xef7b, 0xffdc, 0xef7b, 0xef7b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d1c, 0x5a8e, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x554f, 0x94f4, 0xef5b, 0xa515, 0xbe16,
-  0x552e, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x44cd, 0x452e,
-  0x86ab, 0x86ab, 0x86ab, 0x8eac, 0xef5a, 0xffbc, 0xef1a, 0x8c72,
-  0x866c, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x9eec, 0xf615, 0xfdf6, 0xedd5, 0x8c91,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7ad, 0xcfae, 0xcf8e, 0xcf8e, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d1d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x555f, 0xdf5d, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xce99, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75be, 0xc6bc, 0x5d5f,
-  0x4d1d, 0x4d1d, 0x555d, 0xd73c, 0xef7b, 0xffdc, 0xef7b, 0xef7b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d1c, 0x5a8e, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x554f, 0x94f4, 0xef5b, 0xa515, 0xbe16,
-  0x552e, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x44cd, 0x452e,
-  0x86ab, 0x86ab, 0x86ab, 0x8eac, 0xef5a, 0xffbc, 0xef1a, 0x8c72,
-  0x866c, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x9eec, 0xf615, 0xfdf6, 0xedd5, 0x8c91,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7ad, 0xcfae, 0xcf8e, 0xcf8e, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x4d3f, 0x54fd, 0x3a4b,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d7e, 0xbe59, 0xded9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x657e, 0x4cdd,
-  0x4d1f, 0x4d1f, 0x555f, 0xd73d, 0xef7b, 0xffdc, 0xef7b, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75df, 0xc6bc, 0x626e,
-  0x4d1d, 0x4d1d, 0x4d1e, 0x5d3c, 0x94f5, 0xef5b, 0xa514, 0xbdf6,
-  0x8c93, 0xe595, 0xedf6, 0xf77b, 0xef9d, 0x5d5d, 0x553d, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x4d50, 0xe73a, 0xffbc, 0xef3b, 0x8472,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x3d0e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x8e8c, 0xedf5, 0xf5d6, 0xdd14, 0x7bd0,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x9eec, 0x964b, 0x2983, 0x2163,
-  0x8e6a, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf2c, 0xbf2c,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d1d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x555f, 0xdf5d, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xce99, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75be, 0xc6bc, 0x5d5f,
-  0x4d1d, 0x4d1d, 0x555d, 0xd73c, 0xef7b, 0xffdc, 0xef7b, 0xef7b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d1c, 0x5a8e, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x554f, 0x94f4, 0xef5b, 0xa515, 0xbe16,
-  0x552e, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x44cd, 0x452e,
-  0x86ab, 0x86ab, 0x86ab, 0x8eac, 0xef5a, 0xffbc, 0xef1a, 0x8c72,
-  0x866c, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x9eec, 0xf615, 0xfdf6, 0xedd5, 0x8c91,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7ad, 0xcfae, 0xcf8e, 0xcf8e, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d1d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x555f, 0xdf5d, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xce99, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75be, 0xc6bc, 0x5d5f,
-  0x4d1d, 0x4d1d, 0x555d, 0xd73c, 0xef7b, 0xffdc, 0xef7b, 0xef7b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d1c, 0x5a8e, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x554f, 0x94f4, 0xef5b, 0xa515, 0xbe16,
-  0x552e, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x44cd, 0x452e,
-  0x86ab, 0x86ab, 0x86ab, 0x8eac, 0xef5a, 0xffbc, 0xef1a, 0x8c72,
-  0x866c, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x9eec, 0xf615, 0xfdf6, 0xedd5, 0x8c91,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7ad, 0xcfae, 0xcf8e, 0xcf8e, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x4d3f, 0x54fd, 0x3a4b,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d7e, 0xbe59, 0xded9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x657e, 0x4cdd,
-  0x4d1f, 0x4d1f, 0x555f, 0xd73d, 0xef7b, 0xffdc, 0xef7b, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75df, 0xc6bc, 0x626e,
-  0x4d1d, 0x4d1d, 0x4d1e, 0x5d3c, 0x94f5, 0xef5b, 0xa514, 0xbdf6,
-  0x8c93, 0xe595, 0xedf6, 0xf77b, 0xef9d, 0x5d5d, 0x553d, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x4d50, 0xe73a, 0xffbc, 0xef1a, 0x8472,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x3d0e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x8e8c, 0xedf5, 0xf5d6, 0xe555, 0x7bd0,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x9ecc, 0x968c, 0x5aea, 0x2984,
-  0x8e6a, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf4d, 0xbf2c,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x4d3f, 0x54fd, 0x3a4b,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d7e, 0xbe59, 0xded9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x657e, 0x4cdd,
-  0x4d1f, 0x4d1f, 0x555f, 0xd73d, 0xef7b, 0xffdc, 0xef7b, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75df, 0xc6bc, 0x626e,
-  0x4d1d, 0x4d1d, 0x4d1e, 0x5d3c, 0x94f5, 0xef5b, 0xa514, 0xbdf6,
-  0x8c93, 0xe595, 0xedf6, 0xf77b, 0xef9d, 0x5d5d, 0x553d, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x4d50, 0xe73a, 0xffbc, 0xef1a, 0x8472,
-  0x4cee, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x3d0e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x8e8c, 0xedf5, 0xf5d6, 0xe555, 0x7bd0,
-  0x866b, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x9ecc, 0x968c, 0x5aea, 0x2984,
-  0x8e6a, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xbf4d, 0xbf2c,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x5cbf, 0xd1be, 0xf63f, 0xf67f, 0xf5bf,
-  0xe1be, 0xf63f, 0xf5ff, 0xe15e, 0xd13e, 0x5cdf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf63e, 0xf65f, 0xeddf,
-  0xe23e, 0xf63e, 0xf5ff, 0xe13e, 0xd13e, 0x5cdf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x5cbf, 0xd1be, 0xf63e, 0xf67f, 0xf69e,
-  0xf67e, 0xf6be, 0xf5ff, 0xe1be, 0xd13e, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54df, 0xc9fe, 0xe61e, 0xe6be, 0xe69e,
-  0xe6be, 0xe69e, 0xe69e, 0xe5be, 0xc9fe, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x54df, 0x5d3f, 0x5d5f, 0x5d3f,
-  0x5d3f, 0x5d3f, 0x5d5f, 0x5d5f, 0x54df, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x44dd,
-  0x4cdd, 0x4cdd, 0x4cdd, 0x4cdd, 0x555f, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d1d, 0x3a4c,
-  0x2968, 0x2168, 0x2168, 0x39e9, 0xd6fb, 0x5d7f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553e, 0x555f, 0xdf5d, 0xdef9,
-  0x4229, 0x3187, 0x2106, 0x4229, 0xe73b, 0x6dbf, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553e, 0xb639, 0x6d9d, 0xce99, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xd75d, 0x659f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x657e, 0xce99, 0xef7c, 0xded9, 0xf7bc,
-  0xf7bc, 0xffbc, 0xf75b, 0xfffd, 0xefbd, 0x75be, 0xc6bc, 0x5d5f,
-  0x4d1d, 0x4d1d, 0x555d, 0xd73c, 0xef7b, 0xffdc, 0xef7b, 0xef7b,
-  0x94b3, 0xe575, 0xedf6, 0xf77b, 0xefbd, 0x5d1c, 0x5a8e, 0x4cdc,
-  0x452e, 0x452e, 0x452e, 0x554f, 0x94f4, 0xef5b, 0xa515, 0xbe16,
-  0x552e, 0x4d2e, 0x550e, 0x8c93, 0xe77b, 0x5570, 0x44cd, 0x452e,
-  0x86ab, 0x86ab, 0x86ab, 0x8eac, 0xef5a, 0xffbc, 0xef1a, 0x8c72,
-  0x866c, 0x86ab, 0x866b, 0x8452, 0xdef9, 0x8ecc, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x9eec, 0xf615, 0xfdf6, 0xedd5, 0x8c91,
-  0x96ac, 0x970b, 0x96ac, 0x8450, 0x636c, 0x8e8b, 0x970b, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7ad, 0xcfae, 0xcf8e, 0xcf8e, 0xc78e,
-  0xc7ad, 0xc7cd, 0xc7ad, 0xc78e, 0xbf4d, 0xc7ad, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x5cbf, 0xd1be, 0xf5df, 0xff3f, 0xf67f,
-  0xff1f, 0xf67f, 0xff1f, 0xf5df, 0xd1be, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf5df, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf5df, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf5df, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf5df, 0xff1f, 0xf67f,
-  0xf71f, 0xf67f, 0xff3f, 0xf5ff, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xf5df, 0xff3f, 0xf5ff,
-  0xf67f, 0xf5ff, 0xfe9f, 0xf57f, 0xd17e, 0x647f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54df, 0xd19e, 0xf57f, 0xf63f, 0xd1bc,
-  0xd15c, 0xd15c, 0xd17c, 0xd15c, 0xe15e, 0xc99e, 0x54df, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x649f, 0xd19d, 0xe13e, 0xd1dc, 0x51ab,
-  0x3108, 0x3108, 0x3108, 0x4189, 0xee3b, 0xd9be, 0x54bf, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x54df, 0xc1fd, 0xd539, 0xda3d, 0xd5b9, 0xded9,
-  0x4249, 0x31a7, 0x2126, 0x4249, 0xeefb, 0xda7e, 0x647f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x5cdf, 0xd23d, 0xde59, 0xf75c, 0xded9, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xf67d, 0xca9e, 0x5c7d,
-  0x4d1f, 0x4d1f, 0x5d3f, 0xe6bd, 0xef7b, 0xffdc, 0xef7b, 0xf7bc,
-  0xf7bc, 0xffbc, 0xef5a, 0xfffd, 0xff5d, 0xe27e, 0xedbb, 0x626e,
-  0x4d1d, 0x4d1d, 0x54de, 0xc9fd, 0xa495, 0xef5b, 0xa514, 0xbdf7,
-  0x9c54, 0xed37, 0xfd98, 0xf77b, 0xff5d, 0xe17e, 0xc1fc, 0x549c,
-  0x452e, 0x452e, 0x4cd0, 0xd19c, 0xf6db, 0xffbc, 0xef3a, 0x9433,
-  0xc95c, 0xe19d, 0xd97c, 0x9454, 0xf71c, 0xd1dd, 0x5c70, 0x454f,
-  0x86ab, 0x86ab, 0x8e2c, 0xd21a, 0xfcf8, 0xfd57, 0xdd14, 0x8351,
-  0xd17d, 0xf5bf, 0xd17d, 0x8bd3, 0xde7a, 0xd9dc, 0x8e2d, 0x86cb,
-  0x96eb, 0x96eb, 0x96eb, 0x9e2e, 0xda3b, 0xd1ba, 0x3124, 0x2904,
-  0xca1a, 0xf67d, 0xda5c, 0x83f1, 0x6b0d, 0xca19, 0x9e6d, 0x970b,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xcf4f, 0xcf2f, 0xbf0c, 0xbf2c,
-  0xcf4e, 0xcfaf, 0xcf4f, 0xc76e, 0xbf4d, 0xcf4e, 0xc7ad, 0xc7cd,
-  0x4d3f, 0x5d5f, 0x4d3f, 0x5cbf, 0xe1ba, 0xfe9f, 0xf67f, 0xff1f,
-  0xf67f, 0xff1f, 0xf67f, 0xfe9f, 0xe1da, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x5d5f, 0xc69f, 0x555f, 0x54be, 0xe1ba, 0xfe9e, 0xf67f, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x555f, 0x4d3f,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x5cbe, 0xe1ba, 0xfe9e, 0xf67f, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1ba, 0x64de, 0xc69f, 0x5d5f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x54be, 0xe1ba, 0xfe9e, 0xf67f, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x555f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x64fe, 0xe1ba, 0xfe9e, 0xee7e, 0xf71f,
-  0xf67f, 0xf71f, 0xf69f, 0xfebe, 0xe1da, 0x54be, 0x4d3f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x64ff, 0xe5de, 0xf27b, 0xf6be, 0xd699, 0xf69e,
-  0xf5ff, 0xfe9f, 0xf5ff, 0xfe1e, 0xe19a, 0x647e, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x649e, 0xd9da, 0xf23a, 0xee9b, 0xf7bc, 0xd658, 0xd9b8,
-  0xe158, 0xe178, 0xe158, 0xe178, 0xf159, 0xd97a, 0x54bf, 0x4d3f,
-  0x5cbe, 0xd9da, 0xfd17, 0xeefa, 0x8c92, 0xef9b, 0xef3a, 0x520a,
-  0x3107, 0x3107, 0x3107, 0x4189, 0xee5a, 0xea5a, 0x64fe, 0x4cfd,
-  0x5cbe, 0xd9da, 0xfcf7, 0xff3b, 0xf6fb, 0xf7bc, 0xded9, 0xbdd5,
-  0x4229, 0x31a7, 0x2126, 0x4229, 0xef7b, 0xff7d, 0xe69b, 0x624e,
-  0x4d1f, 0x649e, 0xd9da, 0xe1ba, 0xea3a, 0xfedc, 0xf7bc, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xfefc, 0xda9a, 0x5c7d,
-  0x4d1f, 0x4d3f, 0x54df, 0x54bf, 0x645e, 0xe23a, 0xff5c, 0xfffd,
-  0xf7bc, 0xffbc, 0xef5b, 0xfffd, 0xff5c, 0xea3a, 0x647e, 0x4d3f,
-  0x4d1d, 0x4d1e, 0x453e, 0x453e, 0x54bd, 0xe1ba, 0xff3c, 0xef5b,
-  0x9c54, 0xf516, 0xfd97, 0xf77b, 0xff5c, 0xe1ba, 0x54bd, 0x453e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x54cf, 0xe1d9, 0xf71c, 0x9c74,
-  0xd958, 0xf19a, 0xe978, 0x9c53, 0xf71c, 0xe1d9, 0x54af, 0x454e,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x8e2c, 0xe9d9, 0xde59, 0x8391,
-  0xe179, 0xfdbe, 0xe979, 0x8bd2, 0xe67a, 0xe9d9, 0x8e0c, 0x86cb,
-  0x96eb, 0x96eb, 0x96eb, 0x970b, 0x9e8c, 0xd9f6, 0x3145, 0x2904,
-  0xda17, 0xf67d, 0xe258, 0x83f1, 0x6b0d, 0xda16, 0x9e6c, 0x970b,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xcf4e, 0xbf0c, 0xbf2c,
-  0xcf4e, 0xcfaf, 0xcf4e, 0xc76e, 0xbf4d, 0xcf4e, 0xc7ad, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x5d5f, 0x5cdf, 0xd1be, 0xf5df, 0xff3f, 0xf67f,
-  0xff1f, 0xf67f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5f, 0xc69f, 0x64ff, 0xd19e, 0xf5df, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x5cbf, 0x5d5f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x555f, 0x5cbf, 0xd19e, 0xf5df, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd19e, 0x64df, 0xc69f, 0x5d5f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54df, 0xd1fd, 0xf5be, 0xff1f, 0xf65f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x5cbf, 0x555f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x64de, 0xed58, 0xfdf8, 0xff1e, 0xf67f,
-  0xf71f, 0xf67f, 0xff3f, 0xf5ff, 0xd1be, 0x54bf, 0x4d3f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x54bf, 0xca1e, 0xff3c, 0xffbc, 0xef5c, 0xf67e,
-  0xf71f, 0xf5ff, 0xfe9f, 0xf57f, 0xd17e, 0x647f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x54bf, 0xd1be, 0xfebd, 0xf79b, 0x8c51, 0xbdb6,
-  0xc5b7, 0xd1bc, 0xd15c, 0xd15c, 0xe15e, 0xc99e, 0x54df, 0x4d3f,
-  0x4d1f, 0x5d5f, 0x5cdf, 0xd13e, 0xe25d, 0xff7d, 0xe73a, 0x528b,
-  0x3167, 0x3108, 0x3108, 0x4189, 0xee3b, 0xd9be, 0x645f, 0x4d3f,
-  0x5d5f, 0xc69f, 0x64ff, 0xd19e, 0xf61d, 0xff5d, 0xffdc, 0xdef9,
-  0x4229, 0x31a7, 0x2126, 0x4249, 0xeefb, 0xe23e, 0xca1e, 0x549d,
-  0x4d1f, 0x555f, 0x5cdf, 0xc19e, 0xd1be, 0xd9dd, 0xde59, 0xffdc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xfefd, 0xee3b, 0x71ee,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x54df, 0x645f, 0xd1be, 0xf71c, 0xfffc,
-  0xf7bc, 0xffbc, 0xef5a, 0xfffd, 0xff5d, 0xe21e, 0xd1be, 0xc95d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x453d, 0x54bd, 0xd1de, 0xff3d, 0xef5b,
-  0x9c54, 0xed16, 0xfd98, 0xf77b, 0xff5c, 0xd1be, 0x5c5d, 0x54de,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x4cd0, 0xd1dd, 0xf71c, 0x9474,
-  0xc95c, 0xe19d, 0xd97c, 0x9454, 0xf71c, 0xd1dd, 0x4cd0, 0x3d4e,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x8e2c, 0xd9dc, 0xde5a, 0x8391,
-  0xd17d, 0xf5bf, 0xd17d, 0x8bd3, 0xde7a, 0xd9dc, 0x8e0d, 0x86cb,
-  0x96eb, 0x96eb, 0x96eb, 0x970b, 0x9e8d, 0xc9f9, 0x3145, 0x2904,
-  0xca1a, 0xf67d, 0xda5c, 0x83f1, 0x6b0d, 0xca19, 0x9e6d, 0x970b,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xcf4e, 0xbf0c, 0xbf2c,
-  0xcf4e, 0xcfaf, 0xcf4f, 0xc76e, 0xbf4d, 0xcf4e, 0xc7ad, 0xc7cd,
-  0x4d3f, 0x5d5f, 0x4d3f, 0x5cbf, 0xe1ba, 0xfe9f, 0xf67f, 0xff1f,
-  0xf67f, 0xff1f, 0xf67f, 0xfe9f, 0xe1da, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x5d5f, 0xc69f, 0x555f, 0x54be, 0xe1ba, 0xfe9f, 0xf67f, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x555f, 0x4d3f,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x54be, 0xe1ba, 0xfe7e, 0xf65e, 0xf6de,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1ba, 0x64de, 0xc69f, 0x5d5f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x64ff, 0xe1ba, 0xfd77, 0xfdf7, 0xfdf8,
-  0xf65e, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x555f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x555f, 0xd63e, 0xf1da, 0xfefb, 0xef5a, 0xff7c,
-  0xf67f, 0xf71f, 0xf69f, 0xfebe, 0xe1da, 0x54be, 0x4d3f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x749e, 0xea7b, 0xeeba, 0x52cb, 0xe73b,
-  0xfebf, 0xfe9f, 0xf5ff, 0xfe1e, 0xe19a, 0x647e, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x54de, 0xca3b, 0xfe7c, 0xef5b, 0x52ab, 0xe75a,
-  0xeedb, 0xe1d8, 0xe158, 0xe178, 0xf159, 0xd97a, 0x54bf, 0x4d3f,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x647e, 0xda7b, 0xfedc, 0xef7b, 0xef5b,
-  0x4229, 0x3107, 0x3107, 0x4189, 0xee5a, 0xea5a, 0x64fe, 0x4cfd,
-  0x5d5f, 0xc69f, 0x5d5f, 0x453f, 0x647e, 0xe23a, 0xff7d, 0xef7b,
-  0x422a, 0x31a7, 0x2126, 0x4229, 0xef7b, 0xff7d, 0xe69b, 0x624e,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x4d3f, 0x54be, 0xe1ba, 0xff3c, 0xfffc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xfefc, 0xda9a, 0x6cbd,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe1da, 0xff3c, 0xfffd,
-  0xf7bc, 0xffbc, 0xef5b, 0xfffd, 0xff5c, 0xe23a, 0x749e, 0xd6df,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x453d, 0x54bd, 0xe1da, 0xff3c, 0xef5b,
-  0x9c54, 0xf516, 0xfd97, 0xf77b, 0xff5c, 0xe1ba, 0x54bd, 0x555e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x54cf, 0xe1d9, 0xf71c, 0x9c74,
-  0xd958, 0xf19a, 0xe978, 0x9c53, 0xf71c, 0xe1d9, 0x54af, 0x3d2e,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x8e2c, 0xe9d9, 0xde59, 0x8391,
-  0xe179, 0xfdbe, 0xe979, 0x8bd2, 0xe67a, 0xe9d9, 0x8e0c, 0x86cb,
-  0x96eb, 0x96eb, 0x96eb, 0x970b, 0x9e8c, 0xd9f6, 0x3145, 0x2904,
-  0xda17, 0xf67d, 0xe258, 0x83f1, 0x6b0d, 0xda16, 0x9e6c, 0x970b,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7ad, 0xcf4e, 0xbf0c, 0xbf2c,
-  0xcf4e, 0xcfaf, 0xcf4e, 0xc76e, 0xbf4d, 0xcf4e, 0xc7ad, 0xc7cd,
-  0x4d1f, 0x5d5f, 0xcedf, 0x64ff, 0xd19e, 0xf5be, 0xfefe, 0xf65e,
-  0xff1f, 0xf67f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x555f, 0x5cbf, 0xd19d, 0xfd58, 0xfe17, 0xfdf8,
-  0xfefe, 0xf67f, 0xff1f, 0xf5df, 0xd1be, 0x5cbf, 0x5d5f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfefc, 0xef5a, 0xff9c,
-  0xff3f, 0xf67f, 0xff3f, 0xf5ff, 0xd19e, 0x64ff, 0xc69f, 0x5d5f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x647f, 0xda5e, 0xeebb, 0x52ab, 0xef5b,
-  0xff5f, 0xf5ff, 0xfe9f, 0xf57f, 0xd17e, 0x647f, 0x5d5f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x54df, 0xc23e, 0xfe7d, 0xef5b, 0x52ab, 0xe75a,
-  0xeefb, 0xd1dc, 0xd15c, 0xd15c, 0xe15e, 0xc97e, 0x54bf, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x5c7f, 0xca7e, 0xf6dd, 0xef7b, 0xef5b,
-  0x4229, 0x3108, 0x3108, 0x4189, 0xee5b, 0xda5e, 0x651f, 0x4d5f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x5d5f, 0x647f, 0xd23e, 0xff7d, 0xef7b,
-  0x422a, 0x31a7, 0x2126, 0x4229, 0xef7b, 0xff7d, 0xdedd, 0x5cfd,
-  0x4d1f, 0x4d1f, 0x5d5f, 0xc6bf, 0x64ff, 0xd1be, 0xff3d, 0xfffc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xf6fd, 0xca3c, 0x61ce,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x555f, 0x5cbf, 0xd1de, 0xff3d, 0xfffc,
-  0xf7bc, 0xffbc, 0xef5a, 0xfffd, 0xff5d, 0xda3e, 0x645f, 0x4cdd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1de, 0xff3d, 0xef5b,
-  0x9c54, 0xed16, 0xfd98, 0xf77b, 0xff5c, 0xd1be, 0x54df, 0x5d7f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1de, 0xf71c, 0x9474,
-  0xc95c, 0xe19d, 0xd97c, 0x9454, 0xf71c, 0xd1de, 0x64df, 0xcedf,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d3d, 0x54be, 0xd1be, 0xde59, 0x7bb1,
-  0xd17d, 0xecff, 0xd17d, 0x8bf3, 0xe69a, 0xd1be, 0x54be, 0x555e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x54f0, 0xb9b9, 0x3086, 0x2845,
-  0xd15c, 0xf55f, 0xd99d, 0x8b33, 0x6a4e, 0xc1ba, 0x54d0, 0x3d2e,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x95ed, 0xb998, 0xb8fa,
-  0xc99c, 0xdd5d, 0xd1bc, 0xc97b, 0xc1d9, 0x95ed, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x966d, 0x5d0f,
-  0x54ef, 0x554f, 0x5d0e, 0x964d, 0x9e8d, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xbfad,
-  0xbfad, 0xbf8d, 0xbfad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x54df, 0xda1b, 0xfedc, 0xef7b, 0x5acb, 0xe75a,
-  0xeefb, 0xe178, 0xe0d8, 0xe0f8, 0xf15a, 0xe13a, 0x5cbf, 0x4d5f,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x647e, 0xda7b, 0xfedc, 0xef5b, 0xef5b,
-  0x422a, 0x3108, 0x3108, 0x41a9, 0xee3a, 0xea5a, 0x64fe, 0x4cfd,
-  0x5d5f, 0xc69f, 0x5d5f, 0x453f, 0x647e, 0xe23a, 0xff7d, 0xef7b,
-  0x422a, 0x31a7, 0x2126, 0x4229, 0xef7b, 0xff7d, 0xe69b, 0x624e,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x4d3f, 0x54be, 0xe1ba, 0xff3c, 0xfffc,
-  0xef7b, 0xdef9, 0x52ab, 0xded9, 0xffdd, 0xfefc, 0xda9a, 0x5c7d,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1da, 0xff3c, 0xfffd,
-  0xf7bc, 0xffbc, 0xef5b, 0xfffd, 0xff5c, 0xea3a, 0x647e, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1da, 0xff3c, 0xef5b,
-  0x9c54, 0xf516, 0xfd97, 0xf77b, 0xff5c, 0xe1ba, 0x5cbe, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1da, 0xf71c, 0x9c74,
-  0xd958, 0xf19a, 0xe978, 0x9c53, 0xf71b, 0xe1da, 0x5cbe, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1da, 0xde59, 0x8391,
-  0xe179, 0xfdbe, 0xe999, 0x8bf2, 0xe69a, 0xe1da, 0x5cbe, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cdf, 0xd138, 0x3085, 0x2844,
-  0xe1d8, 0xfe5e, 0xe9b9, 0x8b32, 0x6a6d, 0xc999, 0x5cdf, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cde, 0xe15a, 0xe117, 0xd998,
-  0xf59e, 0xfebf, 0xf1da, 0xe979, 0xd959, 0x647e, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe19a, 0xf57e, 0xfedf,
-  0xf67f, 0xf71f, 0xf61f, 0xfe3e, 0xe9bb, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x553d, 0xc69d, 0x555d, 0x451e, 0x54bd, 0xd1f9, 0xf57e, 0xfe9f,
-  0xf5df, 0xfe7f, 0xf5ff, 0xfe3e, 0xd9f9, 0x54bd, 0x453e, 0x4d1e,
-  0x452e, 0x554e, 0x452e, 0x452e, 0x452e, 0x546f, 0xd1d8, 0xe1b9,
-  0xe1b9, 0xe1b9, 0xe199, 0xd1f8, 0x546f, 0x452e, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x868b, 0x454d, 0x4cce, 0x4c8e,
-  0x4c8e, 0x4c8e, 0x4c8e, 0x4cce, 0x454d, 0x7e8b, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8ecb, 0x86ab, 0x4d6d,
-  0x454d, 0x454d, 0x4d6d, 0x86ab, 0x8ecb, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc78d,
-  0xbf8d, 0xbf8d, 0xc78d, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x5d5f, 0x5cbf, 0xd1de, 0xff3d, 0xfffd,
-  0xfffd, 0xef7b, 0x5acc, 0xef5b, 0xfffd, 0xfedd, 0xd1be, 0x5cbf,
-  0x4d1f, 0x4d1f, 0x5d5f, 0xc69f, 0x64df, 0xd1de, 0xff3d, 0xfffc,
-  0xf79c, 0xffbc, 0xef5a, 0xfffc, 0xff5d, 0xe1fe, 0xc19e, 0x5cdf,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x555f, 0x5cbf, 0xd1de, 0xff3d, 0xef5b,
-  0x9c54, 0xed16, 0xfd98, 0xf77b, 0xff5c, 0xd1be, 0x647f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1de, 0xf71c, 0x9474,
-  0xc95c, 0xe19d, 0xd97c, 0x9454, 0xf71c, 0xd1de, 0x54bf, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1de, 0xde59, 0x7bb1,
-  0xd17d, 0xecff, 0xd17d, 0x8bf3, 0xe69a, 0xd1de, 0x5cbf, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cdf, 0xc13c, 0x3086, 0x2845,
-  0xd1dc, 0xf57f, 0xd99d, 0x8332, 0x6a6e, 0xb99c, 0x54df, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cdf, 0xd15e, 0xc91b, 0xd1bc,
-  0xf65f, 0xf5ff, 0xe1de, 0xd97d, 0xc13c, 0x647f, 0x5d5f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe1f, 0xf61f,
-  0xf71f, 0xf65f, 0xf6bf, 0xf57f, 0xd19e, 0x64ff, 0xc69f, 0x5d5f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf69f,
-  0xf71f, 0xf65f, 0xff3f, 0xf5ff, 0xd1be, 0x5cbf, 0x555f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf69f,
-  0xf71f, 0xf67f, 0xff3f, 0xf5ff, 0xd19e, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d3d, 0x54bd, 0xc9fd, 0xf61f, 0xf5ff,
-  0xf67f, 0xf5df, 0xfe9f, 0xf57f, 0xc9fd, 0x54bd, 0x4d3d, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x452e, 0x5470, 0xc1fb, 0xd19d,
-  0xd1bd, 0xd1bd, 0xd1bd, 0xc1dc, 0x5470, 0x452e, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x868b, 0x454d, 0x4cce, 0x448f,
-  0x448f, 0x448f, 0x448f, 0x4cce, 0x454d, 0x7e8b, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8ecb, 0x86ab, 0x4d6d,
-  0x454d, 0x454d, 0x4d6d, 0x86ab, 0x8ecb, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc78d,
-  0xbf8d, 0xbf8d, 0xc78d, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe1da, 0xde59, 0x83b1,
-  0xe199, 0xfe3e, 0xe999, 0x8bf2, 0xe69a, 0xe1da, 0x5cbf, 0x5d7f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cdf, 0xd138, 0x38a5, 0x2865,
-  0xe1d8, 0xfe5e, 0xea1a, 0x8b32, 0x726e, 0xd959, 0x6cff, 0xcedf,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde, 0xe15a, 0xe117, 0xd998,
-  0xf59e, 0xf71f, 0xf59e, 0xe9fa, 0xe0f8, 0xd97a, 0x5cde, 0x5d5f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe19a, 0xf57e, 0xfebf,
-  0xf67f, 0xf71f, 0xf67f, 0xfe3e, 0xe9ba, 0x647e, 0x4d3f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf73f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x555f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x5d5f, 0xc6bf, 0x64fe, 0xe19a, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x555f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe19a, 0xf5de, 0xf73f,
-  0xf67f, 0xf71f, 0xf69f, 0xfe9e, 0xe9ba, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x453e, 0x54bd, 0xd1f9, 0xf55e, 0xfe9f,
-  0xf5df, 0xfe7f, 0xf5ff, 0xfe1e, 0xd9f9, 0x54bd, 0x453e, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x452e, 0x546f, 0xd1d8, 0xe1b9,
-  0xe1b9, 0xe1b9, 0xe199, 0xd1f8, 0x546f, 0x452e, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x868b, 0x454d, 0x4cce, 0x4c8e,
-  0x4c8e, 0x4c8e, 0x4c8e, 0x4cce, 0x454d, 0x7e8b, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8ecb, 0x86ab, 0x4d6d,
-  0x454d, 0x454d, 0x4d6d, 0x86ab, 0x8ecb, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc78d,
-  0xbf8d, 0xbf8d, 0xc78d, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xff1f, 0xf67f, 0xff1f, 0xf5df, 0xd1be, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf67f,
-  0xf71f, 0xf65f, 0xff1f, 0xf5df, 0xd1be, 0x54bf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54bf, 0xd1be, 0xfe9f, 0xf69f,
-  0xf71f, 0xf67f, 0xff3f, 0xf5ff, 0xd19e, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d3d, 0x54bd, 0xc9fd, 0xf61f, 0xf5ff,
-  0xf67f, 0xf5df, 0xfe9f, 0xf57f, 0xc9fd, 0x54bd, 0x4d3d, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x452e, 0x5470, 0xc1fb, 0xd19d,
-  0xd1bd, 0xd1bd, 0xd1bd, 0xc1dc, 0x5470, 0x452e, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x868b, 0x454d, 0x4cce, 0x448f,
-  0x448f, 0x448f, 0x448f, 0x4cce, 0x454d, 0x7e8b, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8ecb, 0x86ab, 0x4d6d,
-  0x454d, 0x454d, 0x4d6d, 0x86ab, 0x8ecb, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc78d,
-  0xbf8d, 0xbf8d, 0xc78d, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe1ba, 0xf5df, 0xff3f,
-  0xf67f, 0xff1f, 0xf67f, 0xfe9f, 0xe1da, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe, 0xe1ba, 0xf5de, 0xf71f,
-  0xf65f, 0xf71f, 0xf67f, 0xfe9e, 0xe1da, 0x5cbe, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbf, 0xe19a, 0xf5de, 0xf73f,
-  0xf67f, 0xf71f, 0xf69f, 0xfe9e, 0xe9ba, 0x5cbf, 0x4d3f, 0x4d3f,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x453e, 0x54bd, 0xd1f9, 0xf55e, 0xfe9f,
-  0xf5df, 0xfe7f, 0xf5ff, 0xfe1e, 0xd9f9, 0x54bd, 0x453e, 0x4d1e,
-  0x452e, 0x452e, 0x452e, 0x452e, 0x452e, 0x546f, 0xd1d8, 0xe1b9,
-  0xe1b9, 0xe1b9, 0xe199, 0xd1f8, 0x546f, 0x452e, 0x452e, 0x452f,
-  0x86ab, 0x86ab, 0x86ab, 0x86ab, 0x868b, 0x454d, 0x4cce, 0x4c8e,
-  0x4c8e, 0x4c8e, 0x4c8e, 0x4cce, 0x454d, 0x7e8b, 0x86ab, 0x86ab,
-  0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x96eb, 0x8ecb, 0x86ab, 0x4d6d,
-  0x454d, 0x454d, 0x4d6d, 0x86ab, 0x8ecb, 0x96eb, 0x96eb, 0x96eb,
-  0xc7ad, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc78d,
-  0xbf8d, 0xbf8d, 0xc78d, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd, 0xc7cd,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xbdb9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdb7c, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe,
-  0xd9da, 0x5cbe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd1fa, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xab77, 0x54fe, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xc39a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd99, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdbbc, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9db, 0x5cde, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd35b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa376, 0x54fe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cdf,
-  0xd1da, 0x5cdf, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb7a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xbd79, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x64de,
-  0xd21a, 0x64de, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd37b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa3b7, 0x54fe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd37b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d3d, 0x5cdd,
-  0xca19, 0x5cdd, 0x4d3d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cae, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd99, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdb7c, 0x64fe, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe,
-  0xd9da, 0x5cbe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd1fa, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa376, 0x54fe, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd35b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9db, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb9a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xbdb9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdbbc, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9db, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd35b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa376, 0x54fe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd1fa, 0x5cde, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cdf,
-  0xd9db, 0x5cdf, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb7a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd79, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x64de,
-  0xd21a, 0x64de, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd37b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa3b7, 0x54fe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd37b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d3d, 0x5cdd,
-  0xca19, 0x5cdd, 0x4d3d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cae, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xbdb9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdb7c, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd1da, 0x5cbe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x54fe,
-  0xa376, 0x54fe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cfe,
-  0xd35b, 0x5cfe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9db, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb9a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd99, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xd3bb, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x54fe,
-  0xa376, 0x54fe, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd1fa, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cdf,
-  0xd9db, 0x5cdf, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb7a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5b8, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x5d1e,
-  0xa3d6, 0x5d1e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xd37b, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d3d, 0x5cdd,
-  0xca19, 0x5cdd, 0x4d3d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cae, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd99, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdb7c, 0x64fe, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cbe,
-  0xd9da, 0x5cbe, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x5cfd,
-  0xcb9a, 0x5cfd, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x4cef, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xbdb9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x651e,
-  0xdbbc, 0x651e, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xdb3c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xd9da, 0x5cde, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cff,
-  0xdb5c, 0x5cff, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5cde,
-  0xca1b, 0x5cde, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f,
-  0x54df, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c73, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xbd79, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x64de,
-  0xda1a, 0x64de, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5cff,
-  0xcb5c, 0x5cff, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f,
-  0x551f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73,
-  0x9cd5, 0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x551d, 0xadba, 0xb5b9,
-  0xb5d9, 0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xb5b9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5,
-  0x8c53, 0x9cd5, 0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9,
-  0xadb9, 0xb5d9, 0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d3f, 0x553f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x551d, 0xadba, 0xb5b9, 0xb5d9,
-  0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d1e, 0x7434, 0x9cd5, 0x8c73, 0x9cd5,
-  0x8c73, 0x9cd5, 0x7434, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x551d, 0xadba, 0xb5b9, 0xb5d9,
-  0xb5b9, 0xadba, 0x5d1d, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x553f, 0x553f, 0x553f,
-  0x553f, 0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d3f, 0x553f, 0x553f, 0x553f, 0x553f,
-  0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9, 0xb5b9, 0xb5d9,
-  0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x551e, 0x84b6, 0x8c53, 0x9cd5, 0x8c53, 0x9cd5,
-  0x8c53, 0x84b6, 0x551e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d1f, 0x5d3e, 0xadb9, 0xb5d9, 0xadb9, 0xb5d9,
-  0xadb9, 0x5d3e, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x553f, 0x553f, 0x553f, 0x553f,
-  0x553f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x5d5c, 0x5d5f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x553f, 0x657d, 0xcf49, 0xc6fc,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x555f, 0x555f, 0x5d7f, 0xb6bf, 0xbede, 0xcf1c, 0xcf1e,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x555f, 0x555f,
-  0x5d7f, 0xb6bf, 0xbedf, 0xbedf, 0xc6ff, 0xcf1f, 0xc6ff, 0xbedf,
-  0x4d1f, 0x4d3f, 0x555f, 0x555f, 0x555f, 0x5d7f, 0xb6bf, 0xbedf,
-  0xbedf, 0xc6ff, 0xc71f, 0xcf1f, 0xc6ff, 0xbedf, 0xb6bf, 0x5d7f,
-  0x4d1f, 0x553f, 0xae9f, 0xbedf, 0xbedf, 0xbedf, 0xc6ff, 0xcf1f,
-  0xcf1f, 0xc6ff, 0xbedf, 0xbedf, 0xb6bf, 0x5d7f, 0x553f, 0x4d1f,
-  0x4d1f, 0x5d5c, 0x5d7f, 0xb6bf, 0xcf1f, 0xc6ff, 0xbedf, 0xbedf,
-  0xbedf, 0xb6bf, 0x5d5f, 0x553f, 0x555f, 0x4d1f, 0x4d1f, 0x4d3f,
-  0x5d5c, 0xbee9, 0x555c, 0x5d5f, 0xb6bf, 0xb6bf, 0x5d5f, 0x553f,
-  0x555f, 0x555f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x555f, 0x555f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d1f, 0x5d5c, 0xbf09, 0x7dbb,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x553f, 0x6d7e, 0x6d7d, 0x7dbb, 0xb69e,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f,
-  0x553f, 0x6d7e, 0x6d7e, 0x6d7e, 0xb69e, 0xb6be, 0x6d7e, 0x6d7e,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x553f, 0x655e, 0x6d7e,
-  0x759e, 0xb69e, 0xb6be, 0x6d7d, 0x6d7d, 0x6d7e, 0x655e, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x655e, 0x655d, 0x655d, 0x655d, 0x6d7d, 0xb69e,
-  0xb6be, 0x759e, 0x6d7e, 0x655d, 0x655e, 0x4d3f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x553e, 0x655e, 0x6d7d, 0x657d, 0x655d, 0x6d7e,
-  0x6d7e, 0x655e, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x655e, 0x655e, 0x553f, 0x4d1f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced,
-  0x4d1f, 0x4d3f, 0x5d7c, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d7c, 0x4d3f,
-  0x4d1f, 0x5d5d, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbee9, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x555d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5c, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x5d5c, 0xbf09, 0x5d5c, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x5d5d, 0x4d3f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4d1f,
-  0x4d1f, 0x4d1f, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x5d5c, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x5d5d, 0xbf09, 0x5d5c,
-  0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x555d, 0x4d3f,
-  0x4d1f, 0x4d3f, 0x4d1e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe,
-  0x4cfe, 0x4cdc, 0x3bb1, 0x4cdc, 0x4d1f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d1f, 0x4cfe, 0x4cdc, 0x3bb0,
-  0x3baf, 0x3baf, 0x3b8d, 0x3bd0, 0x4cfc, 0x4d1d, 0x4d1d, 0x4d1d,
-  0x4d1d, 0x4d1d, 0x4d1d, 0x4d1d, 0x4cfc, 0x3bd0, 0x3bae, 0x3b8d,
-  0x3ccd, 0x3ccd, 0x3ced, 0x3ced, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f,
-  0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3d0f, 0x3ced, 0x3ccd, 0x3ced
-};
-
-const Animation abductionAnimation = {
-  .name = "Abduction",
-  .frameCount = 44,
-  .width = 16,
-  .height = 16,
-  .frameDurations = abductionDurations,
-  .animationFrames = abductionFrames
-};
-#endif // ANIMATION_ABDUCTION_H
@@ -1,214 +0,0 @@
-// amongus.h - Auto-generated from amongus.json
-#ifndef ANIMATION_AMONGUS_H
-#define ANIMATION_AMONGUS_H
-
-#include "animation_types.h"
-
-// Frame Durations for amongus (in 100ms units)
-static const uint8_t PROGMEM amongusDurations[] = { 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for amongus
-static const uint16_t PROGMEM amongusFrames[] = {
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1249, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1249, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x0000, 0x7904, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0x7904, 0x0000, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x0000, 0x0000, 0x0000, 0x7904, 0xf80a, 0x7904,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x0000, 0x7904, 0xf80a, 0x0000, 0x7904, 0xf80a, 0x0000,
-  0x4bfb, 0x4bfb, 0x45be, 0x45be, 0xf79d, 0xf79d, 0x0000, 0x1bcf,
-  0x1bcf, 0x0000, 0xf80a, 0xf80a, 0x0000, 0x7904, 0xf80a, 0x0000,
-  0x4bfb, 0x4bfb, 0x4bfb, 0x4bfb, 0x4bfb, 0x4bfb, 0x0000, 0x1bcf,
-  0x1bcf, 0x0000, 0x7904, 0x7904, 0x0000, 0x7904, 0xf80a, 0x7904,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x0000, 0x7904, 0x7904, 0x0000, 0x7904, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0xf80a, 0x0000, 0x1bcf, 0x1bcf,
-  0x1249, 0x0000, 0x7904, 0x7904, 0x0000, 0x7904, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0xf80a, 0x0000, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x0000, 0x7904, 0x7904, 0x0000, 0x7904, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0xf80a, 0x0000, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x0000, 0x7904, 0x7904, 0x0000, 0x7904, 0x7904, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0x7904, 0x0000, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x0000, 0x0000, 0x0000, 0x0000, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x7904, 0x0000, 0x0000, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x0000, 0x7904,
-  0x7904, 0x7904, 0x0000, 0x7904, 0x0000, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x07f5, 0x07f5, 0x1bcf, 0x1bcf, 0x1bcf, 0x0000, 0x7904,
-  0x7904, 0x7904, 0x0000, 0x0000, 0x1bcf, 0x1bcf, 0x07f5, 0x07f5,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1b6d,
-  0x1b6d, 0x1b6d, 0x1b6d, 0x1bcf, 0x1bcf, 0x1bae, 0x128a, 0x1bae,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b4d, 0x08a2, 0x1842, 0x1842,
-  0x1842, 0x1842, 0x10a2, 0x1b2c, 0x23cf, 0x1bae, 0x128a, 0x1bae,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b2c, 0x10a2, 0x70a4, 0xd028, 0xd008,
-  0xd008, 0xc807, 0x60a3, 0x0881, 0x132c, 0x1bae, 0x128a, 0x1bae,
-  0x1bcf, 0x1b8e, 0x132c, 0x08a2, 0x70c4, 0xe049, 0x78c5, 0x2063,
-  0x1863, 0x1863, 0x1082, 0x10a2, 0x1904, 0x1b2c, 0x128a, 0x1bae,
-  0x1b2c, 0x08a2, 0x1041, 0x0800, 0x78e4, 0xd809, 0x2043, 0x3b77,
-  0x3cfb, 0x353b, 0x455b, 0xc6bb, 0xbe38, 0x10e3, 0x1228, 0x1bae,
-  0x0861, 0x78a4, 0xc808, 0x1801, 0x70e4, 0xd808, 0x1843, 0x43b9,
-  0x4c5c, 0x457e, 0x459e, 0x55de, 0x4d5b, 0x0882, 0x1228, 0x1bae,
-  0x1000, 0xd028, 0xe009, 0x1801, 0x70e4, 0xd808, 0x2043, 0x3b56,
-  0x4399, 0x43b9, 0x43b9, 0x43b9, 0x3b77, 0x08a3, 0x1228, 0x1bae,
-  0x0800, 0x78e4, 0x78e4, 0x1020, 0x78e4, 0xe829, 0x78c5, 0x2043,
-  0x1843, 0x1842, 0x1843, 0x1842, 0x0883, 0x1b0c, 0x128a, 0x1bae,
-  0x0800, 0x6903, 0x6903, 0x1020, 0x70e4, 0xf02a, 0xf00a, 0xe009,
-  0xe009, 0xe009, 0xe809, 0xd008, 0x1041, 0x1b6d, 0x128a, 0x1bae,
-  0x0800, 0x6904, 0x6904, 0x1020, 0x70e4, 0xf02a, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xe809, 0x1042, 0x132c, 0x128a, 0x1b8e,
-  0x0800, 0x6904, 0x60e3, 0x0820, 0x70e4, 0xe829, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xd809, 0x1021, 0x1249, 0x1269, 0x128a,
-  0x0861, 0x58e3, 0x1841, 0x1020, 0x60e3, 0x88e5, 0xe029, 0xf02a,
-  0xf02a, 0xf02a, 0xe829, 0x70c4, 0x1061, 0x1b0c, 0x1bae, 0x1bae,
-  0x132c, 0x1061, 0x60e3, 0x60e3, 0x2041, 0x6904, 0x8104, 0x78e4,
-  0x70e4, 0x78e4, 0x68c4, 0x2041, 0x58c3, 0x10a2, 0x1b4d, 0x1bcf,
-  0x2bcf, 0x08a2, 0x60e3, 0x7904, 0x7104, 0x7904, 0x60e3, 0x1061,
-  0x0861, 0x0861, 0x1061, 0x58c3, 0x7904, 0x60e3, 0x08a2, 0x1b6d,
-  0xb678, 0x2b8d, 0x10a2, 0x60e3, 0x7104, 0x60e3, 0x10a2, 0x1b2c,
-  0x1b8e, 0x1b8e, 0x1b2c, 0x10c3, 0x60e3, 0x60e3, 0x08a2, 0x1b6d,
-  0x3410, 0x23cf, 0x1b2c, 0x0861, 0x0800, 0x0841, 0x1b2c, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b2c, 0x0841, 0x0841, 0x1b2c, 0x1bcf,
-  0x1b8e, 0x128a, 0x1bae, 0x23cf, 0x1b2c, 0x0861, 0x1001, 0x1801,
-  0x1801, 0x1801, 0x0841, 0x1b2c, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1b8e, 0x128a, 0x1bae, 0x1b4d, 0x10a2, 0x70c4, 0xd028, 0xd008,
-  0xd008, 0xc808, 0x60a3, 0x0882, 0x132c, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bae, 0x1269, 0x130c, 0x08a2, 0x70c4, 0xe049, 0x78c5, 0x2063,
-  0x1863, 0x1863, 0x1082, 0x10a2, 0x1904, 0x1b4d, 0x1bcf, 0x1bcf,
-  0x1b2c, 0x0882, 0x1041, 0x0800, 0x78e4, 0xd809, 0x2043, 0x3b77,
-  0x3cfb, 0x353b, 0x455b, 0xc6bb, 0xbe38, 0x1104, 0x1b6d, 0x1bcf,
-  0x0861, 0x78c4, 0xc808, 0x1801, 0x70e4, 0xd808, 0x1843, 0x43b9,
-  0x4c5c, 0x457e, 0x459e, 0x55de, 0x4d5b, 0x08a3, 0x1b6d, 0x1bcf,
-  0x1000, 0xd028, 0xe009, 0x1801, 0x70e4, 0xd808, 0x2043, 0x3b56,
-  0x4399, 0x43b9, 0x43b9, 0x43b9, 0x3b77, 0x08c4, 0x1b6d, 0x1bcf,
-  0x0800, 0x78e4, 0x78e4, 0x1020, 0x78e4, 0xe829, 0x78c5, 0x2043,
-  0x1843, 0x1842, 0x1843, 0x1842, 0x0883, 0x1b2d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6903, 0x6903, 0x1020, 0x70e4, 0xf02a, 0xf00a, 0xe009,
-  0xe009, 0xe009, 0xe809, 0xd008, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x6904, 0x1020, 0x70e4, 0xf02a, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xe809, 0x1042, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x60e3, 0x0820, 0x70e4, 0xe829, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xd809, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0861, 0x58e3, 0x1841, 0x1020, 0x60e3, 0x88e5, 0xe029, 0xf02a,
-  0xf02a, 0xf02a, 0xe829, 0x70c4, 0x1061, 0x1b2c, 0x1bcf, 0x1bcf,
-  0x1b0c, 0x1061, 0x60e3, 0x60e3, 0x2041, 0x6904, 0x8104, 0x78e4,
-  0x70e4, 0x78e4, 0x68c4, 0x2041, 0x58c3, 0x10a2, 0x1b2c, 0x1bcf,
-  0x1269, 0x0882, 0x60e3, 0x7904, 0x7104, 0x7904, 0x60e3, 0x1061,
-  0x0861, 0x0861, 0x1061, 0x58c3, 0x7904, 0x60e3, 0x08a2, 0x1b6d,
-  0x1bae, 0x1b2c, 0x10a2, 0x60e3, 0x7104, 0x60e3, 0x10a2, 0x1b2c,
-  0x1b8e, 0x1b8e, 0x1b2c, 0x10a2, 0x60e3, 0x60e3, 0x10a2, 0x2bce,
-  0x1bcf, 0x1bcf, 0x1b4d, 0x08a2, 0x0861, 0x08a2, 0x1b2c, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b4d, 0x08a2, 0x0882, 0x2b8d, 0xb678,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x23cf, 0x3410,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bae,
-  0x128a, 0x1bae, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b8e, 0x1b4d,
-  0x1249, 0x1b4d, 0x1b6d, 0x1b6d, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b4c, 0x08a2, 0x1842,
-  0x1821, 0x1842, 0x1842, 0x1082, 0x1b2c, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1b6d, 0x1b8d, 0x1b2c, 0x10a2, 0x70a4, 0xd028,
-  0xd008, 0xd008, 0xc807, 0x60a3, 0x0881, 0x132c, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1b4d, 0x08a2, 0x1041, 0x0841, 0x70c4, 0xe049, 0x78c5,
-  0x2063, 0x1843, 0x1863, 0x1082, 0x10a2, 0x1904, 0x1b4d, 0x1bcf,
-  0x1b6d, 0x08a2, 0x78a4, 0xc808, 0x1801, 0x78e4, 0xd809, 0x2043,
-  0x3b57, 0x43da, 0x3cfb, 0x453b, 0xc69b, 0xc618, 0x1104, 0x1b4d,
-  0x1b6d, 0x1042, 0xd828, 0xe009, 0x1801, 0x70e4, 0xd808, 0x2043,
-  0x3b57, 0x43b9, 0x43d9, 0x43d9, 0x53f9, 0x4b97, 0x08e4, 0x1b6d,
-  0x1b6d, 0x0861, 0x78e4, 0x78e4, 0x1020, 0x78e4, 0xe829, 0x78c5,
-  0x2043, 0x1843, 0x1842, 0x1843, 0x1042, 0x0083, 0x1b2d, 0x1bcf,
-  0x1b6d, 0x0861, 0x68e3, 0x6903, 0x1020, 0x70e4, 0xf02a, 0xf00a,
-  0xe009, 0xe009, 0xe009, 0xe809, 0xd008, 0x1041, 0x1b6d, 0x1bcf,
-  0x1b6d, 0x0861, 0x68e3, 0x6904, 0x1020, 0x70e4, 0xf02a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0xe809, 0x1042, 0x1b6d, 0x1bcf,
-  0x1b6d, 0x0861, 0x70e3, 0x7104, 0x1020, 0x70e4, 0xe829, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xf80a, 0xd809, 0x1041, 0x1b4d, 0x1bae,
-  0x1b6d, 0x08a2, 0x60e3, 0x60e3, 0x1020, 0x60e3, 0x88e5, 0xe029,
-  0xf00a, 0xf00a, 0xf00a, 0xd809, 0x70c4, 0x0882, 0x1249, 0x128a,
-  0x1bcf, 0x1b4d, 0x08a2, 0x0861, 0x0041, 0x1061, 0x60e3, 0x8104,
-  0x8104, 0x8104, 0x70e4, 0x2021, 0x0841, 0x1b2c, 0x1bae, 0x1bae,
-  0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1b8e, 0x2b6d, 0x1061, 0x6903,
-  0x7924, 0x6904, 0x1840, 0x50a2, 0x08a2, 0x1b8e, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x2c10, 0xa5f6, 0x18e3, 0x60c3,
-  0x6904, 0x60e3, 0x0800, 0x08a2, 0x1b4d, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x23cf, 0x2c10, 0x1b4d, 0x0861,
-  0x0800, 0x0800, 0x0041, 0x1b2c, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1b8e, 0x128a, 0x1bae, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1b6d,
-  0x1b6d, 0x1b6d, 0x1b6d, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1b8e, 0x128a, 0x1bae, 0x23cf, 0x1b4d, 0x08a2, 0x1842, 0x1842,
-  0x1842, 0x1842, 0x10a2, 0x1b2c, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1b8e, 0x128a, 0x1bae, 0x1b4d, 0x10a2, 0x70a4, 0xd028, 0xd008,
-  0xd008, 0xc807, 0x60a3, 0x0881, 0x132c, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bae, 0x1269, 0x130c, 0x08a2, 0x70c4, 0xe049, 0x78c5, 0x2063,
-  0x1863, 0x1863, 0x1082, 0x10a2, 0x1904, 0x1b4d, 0x1bcf, 0x1bcf,
-  0x1b2c, 0x0882, 0x1041, 0x0800, 0x78e4, 0xd809, 0x2043, 0x3b77,
-  0x3cfb, 0x353b, 0x455b, 0xc6bb, 0xbe38, 0x1104, 0x1b6d, 0x1bcf,
-  0x0861, 0x78c4, 0xc808, 0x1801, 0x70e4, 0xd808, 0x1843, 0x43b9,
-  0x4c5c, 0x457e, 0x459e, 0x55de, 0x4d5b, 0x08a3, 0x1b6d, 0x1bcf,
-  0x1000, 0xd028, 0xe009, 0x1801, 0x70e4, 0xd808, 0x2043, 0x3b56,
-  0x4399, 0x43b9, 0x43b9, 0x43b9, 0x3b77, 0x08c4, 0x1b6d, 0x1bcf,
-  0x0800, 0x78e4, 0x78e4, 0x1020, 0x78e4, 0xe829, 0x78c5, 0x2043,
-  0x1843, 0x1842, 0x1843, 0x1842, 0x0883, 0x1b2d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6903, 0x6903, 0x1020, 0x70e4, 0xf02a, 0xf00a, 0xe009,
-  0xe009, 0xe009, 0xe809, 0xd008, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x6904, 0x1020, 0x70e4, 0xf02a, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xe809, 0x1042, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x60e3, 0x0820, 0x70e4, 0xe829, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xd809, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0861, 0x58e3, 0x1841, 0x1020, 0x60e3, 0x88e5, 0xe829, 0xf02a,
-  0xf02a, 0xf00a, 0xe829, 0x80c4, 0x1061, 0x1b2c, 0x1bcf, 0x1bcf,
-  0x1b2c, 0x1061, 0x60e3, 0x60e3, 0x2041, 0x60e3, 0x78e4, 0x70e4,
-  0x78e4, 0x8104, 0x8104, 0x7904, 0x60e3, 0x10a2, 0x1b2c, 0x1bcf,
-  0x1b8e, 0x08a2, 0x60e3, 0x7924, 0x68e3, 0x1841, 0x0800, 0x0861,
-  0x1061, 0x60e3, 0x68e3, 0x68e3, 0x7904, 0x60e3, 0x08a2, 0x1b6d,
-  0x1bcf, 0x1b4d, 0x10c3, 0x60e3, 0x6904, 0x58c3, 0x08a2, 0x1b2c,
-  0x1b4d, 0x08a2, 0x0861, 0x1082, 0x60e3, 0x60e3, 0x08a2, 0x1b6d,
-  0x1bcf, 0x1bcf, 0x1b2c, 0x0861, 0x0800, 0x0841, 0x1b2c, 0x1bcf,
-  0x1bcf, 0x1b6d, 0x1b6d, 0x1b2c, 0x0841, 0x0841, 0x1b2c, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf, 0x1b2c, 0x0861, 0x1001, 0x1801,
-  0x1801, 0x1801, 0x0841, 0x1b2c, 0x1bcf, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b2c, 0x10a2, 0x70c4, 0xd028, 0xd008,
-  0xd008, 0xc808, 0x60a3, 0x0882, 0x132c, 0x1bcf, 0x1bcf, 0x1bcf,
-  0x1bcf, 0x1b8e, 0x132c, 0x08a2, 0x70c4, 0xe049, 0x78c5, 0x2063,
-  0x1863, 0x1863, 0x1082, 0x10a2, 0x1904, 0x1b4d, 0x1bcf, 0x1bcf,
-  0x1b2c, 0x08a2, 0x1041, 0x0800, 0x78e4, 0xd809, 0x2043, 0x3b77,
-  0x3cfb, 0x353b, 0x455b, 0xc6bb, 0xbe38, 0x1104, 0x1b6d, 0x1bcf,
-  0x0861, 0x78a4, 0xc808, 0x1801, 0x70e4, 0xd808, 0x1843, 0x43b9,
-  0x4c5c, 0x457e, 0x459e, 0x55de, 0x4d5b, 0x08a3, 0x1b6d, 0x1bcf,
-  0x1000, 0xd028, 0xe009, 0x1801, 0x70e4, 0xd808, 0x2043, 0x3b56,
-  0x4399, 0x43b9, 0x43b9, 0x43b9, 0x3b77, 0x08c4, 0x1b6d, 0x1bcf,
-  0x0800, 0x78e4, 0x78e4, 0x1020, 0x78e4, 0xe829, 0x78c5, 0x2043,
-  0x1843, 0x1842, 0x1843, 0x1842, 0x0883, 0x1b2d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6903, 0x6903, 0x1020, 0x70e4, 0xf02a, 0xf00a, 0xe009,
-  0xe009, 0xe009, 0xe809, 0xd008, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x6904, 0x1020, 0x70e4, 0xf02a, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xe809, 0x1042, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0800, 0x6904, 0x60e3, 0x0820, 0x70e4, 0xe829, 0xf80a, 0xf80a,
-  0xf80a, 0xf80a, 0xf80a, 0xd809, 0x1041, 0x1b6d, 0x1bcf, 0x1bcf,
-  0x0861, 0x58e3, 0x1841, 0x1020, 0x60e3, 0x88e5, 0xe829, 0xf02a,
-  0xf02a, 0xf00a, 0xe829, 0x80c4, 0x1061, 0x1b2c, 0x1bcf, 0x1bcf,
-  0x1b2c, 0x1061, 0x60e3, 0x60e3, 0x2041, 0x60e3, 0x78e4, 0x70e4,
-  0x78e4, 0x8104, 0x8104, 0x7904, 0x60e3, 0x10a2, 0x1b2c, 0x1bcf,
-  0x1b8e, 0x08a2, 0x60e3, 0x7924, 0x68e3, 0x1841, 0x0800, 0x0041,
-  0x0861, 0x60e3, 0x68e3, 0x68e3, 0x7904, 0x60e3, 0x08a2, 0x1b6d,
-  0x1bcf, 0x1b4d, 0x10a2, 0x60e3, 0x70e3, 0x58c3, 0x0882, 0x2b8d,
-  0x2b8e, 0x08a2, 0x0861, 0x1061, 0x60e3, 0x60e3, 0x08a2, 0x1b6d,
-  0x1bcf, 0x1bcf, 0x1b4d, 0x08a2, 0x0861, 0x08a2, 0x2b6d, 0xbe78,
-  0xbe78, 0x2bae, 0x1b6d, 0x1b2c, 0x08a2, 0x08a2, 0x1b4d, 0x1bcf,
-  0x1bcf, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1b6d, 0x23cf, 0x3410,
-  0x3410, 0x23cf, 0x1bcf, 0x1bcf, 0x1b6d, 0x1b6d, 0x1bcf, 0x1bcf
-};
-
-const Animation amongusAnimation = {
-  .name = "Amongus",
-  .frameCount = 6,
-  .width = 16,
-  .height = 16,
-  .frameDurations = amongusDurations,
-  .animationFrames = amongusFrames
-};
-#endif // ANIMATION_AMONGUS_H
@@ -1,406 +0,0 @@
-// barbers.h - Auto-generated from barbers.json
-#ifndef ANIMATION_BARBERS_H
-#define ANIMATION_BARBERS_H
-
-#include "animation_types.h"
-
-// Frame Durations for barbers (in 100ms units)
-static const uint8_t PROGMEM barbersDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for barbers
-static const uint16_t PROGMEM barbersFrames[] = {
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0x28e6, 0xb537, 0xb537, 0xa948, 0xe927,
-  0xe927, 0xa948, 0xa948, 0xb537, 0x28e6, 0x28e6, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xb537, 0xe927, 0xe927, 0xfb6f,
-  0xfb6f, 0xe927, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xa948, 0xe927, 0xe927, 0xfb6f,
-  0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xa948, 0xe927, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf75c, 0x3ad6, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xa948, 0xf75c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x345b, 0x3ad6, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff,
-  0x363e, 0x345b, 0x345b, 0x3ad6, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0x345b, 0x363e,
-  0x363e, 0x345b, 0x345b, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0xb537, 0x345b, 0x345b, 0x363e,
-  0x363e, 0x345b, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0x3ad6, 0x345b, 0x345b, 0x363e,
-  0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0xccdf, 0x28e6, 0x3ad6, 0x345b, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf75c, 0xa948, 0x28e6, 0xccdf, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0x28e6, 0x3ad6, 0xf75c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xe927, 0xa948, 0x28e6, 0x28e6, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf,
-  0xccdf, 0xccdf, 0x28e6, 0xb537, 0xf75c, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xf75c, 0xb537, 0x28e6, 0xccdf, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffdf, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xeefb, 0xf75d, 0xf75d, 0xff5d,
-  0xff3d, 0xf75d, 0xf79e, 0xeefb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xac73, 0xb20b, 0xb9a9, 0xe1ca,
-  0xea2b, 0xba8d, 0xbd56, 0xad16, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3928, 0xa168, 0xd927, 0xe1a9, 0xf3b0,
-  0xfefc, 0xf75d, 0xeefb, 0x9cb5, 0x3969, 0xb41b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xa4b4, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3149, 0x4b14, 0xdebb, 0xffdf, 0xffdf,
-  0xff9e, 0xfedb, 0xe20a, 0xa107, 0x3927, 0xac3b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xa4f6, 0xf73b, 0xffff, 0xff9e,
-  0xf452, 0xea4b, 0xe1a9, 0xa9aa, 0x3947, 0x4189, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xffde, 0xffdf, 0xffdf,
-  0xff7e, 0xff5d, 0xff5d, 0xeeba, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xef1b, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xffff, 0xffff, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffdf, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9c94, 0xeeba, 0xf75d, 0xf73d, 0xff3d,
-  0xf79e, 0xf79e, 0xf79e, 0xeefb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3947, 0xa1aa, 0xb1aa, 0xba2b, 0xe28c,
-  0xbd57, 0xbd98, 0xbd97, 0xa4d5, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3927, 0xa107, 0xe20a, 0xf6db, 0xff5d,
-  0xf79e, 0xf7be, 0xd69b, 0x4b14, 0x3148, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefdf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xa4b4, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb41b, 0x3969, 0x9cb5, 0xf71b, 0xff5d, 0xff3c,
-  0xf3d0, 0xe9a9, 0xe127, 0xa169, 0x3928, 0xac3b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xad36, 0xeeba, 0xeacd, 0xf3f0,
-  0xf38f, 0xe9c9, 0xe20a, 0xac73, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xffbe, 0xff5d, 0xff7d,
-  0xff9e, 0xff5d, 0xff5d, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xef1b, 0xffdf, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef3b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffdf, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9c94, 0xee9a, 0xf73d, 0xf79e, 0xffdf,
-  0xffdf, 0xf79e, 0xf79e, 0xe6db, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3927, 0xa1a9, 0xb26c, 0xbd77, 0xef3c,
-  0xf73b, 0xc5d8, 0xa537, 0x4b35, 0x3148, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3927, 0xa1ca, 0xee58, 0xf7be, 0xffdf,
-  0xefbe, 0xd71e, 0x4c7a, 0x3294, 0x3148, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xa4b4, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3949, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xac1b, 0x3989, 0xa4f5, 0xee18, 0xea2b, 0xf36f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x3989, 0xac1b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xacd4, 0xe26c, 0xe9c9, 0xf38f,
-  0xf38f, 0xea4b, 0xee58, 0xad36, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xff5d, 0xff5d, 0xff9e,
-  0xff7e, 0xff7d, 0xffde, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xef1b, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffdf, 0xef3b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9c94, 0xee9a, 0xf79e, 0xf79e, 0xffdf,
-  0xffdf, 0xf7be, 0xef9e, 0xe6db, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3947, 0xa22b, 0xbd36, 0xc5d8, 0xf73b,
-  0xe71b, 0xa578, 0x4c7b, 0x4315, 0x3148, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3968, 0xa494, 0xeedb, 0xe75e, 0xdf9e,
-  0x561d, 0x3c7b, 0x341a, 0x3ad5, 0x3148, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xa4b4, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3949, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3989, 0xa432, 0xe1ca, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xa4f5, 0x3989, 0xac1b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4189, 0x3947, 0xa9ea, 0xe1a9, 0xe9ca, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73c, 0xad36, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9c94, 0xee9a, 0xff5d, 0xff5d, 0xff9e,
-  0xffff, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf73b, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xef3b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xeefb, 0xf79e, 0xf7be, 0xffdf,
-  0xefbf, 0xef9f, 0xef9e, 0xdedb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xacf5, 0xbd97, 0xb578, 0xd6fb,
-  0x563d, 0x3c9b, 0x445b, 0x4b35, 0x3168, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3989, 0xa4f5, 0xce7a, 0x4c9b, 0x45fd,
-  0x35fd, 0x2c5b, 0x447b, 0x8c95, 0x4189, 0xb41b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xa4b4, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3949, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3928, 0xa148, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xef1b, 0x9cb5, 0x3968, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4189, 0x3947, 0xa989, 0xe22b, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xe6fc, 0x5b75, 0x3148, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9c94, 0xeeba, 0xff5d, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffbe, 0xe6db, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf73b, 0xffff, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xeefb, 0xf79e, 0xef7e, 0xef9f,
-  0xef9f, 0xef7e, 0xef7e, 0xeefb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xad15, 0xa537, 0x4b97, 0x449b,
-  0x449b, 0x4357, 0x5bb7, 0xa4d5, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x4189, 0x8c95, 0x445a, 0x2c1b, 0x35bd,
-  0x3ddd, 0x4cbb, 0xd67a, 0xa4f5, 0x3989, 0xb41b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xefbe, 0xf73b, 0xa4b4, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffff, 0xffff, 0xee59, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3949, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3927, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xd6bb, 0x4314, 0x3148, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4189, 0x3927, 0xaa0b, 0xee79, 0xffff, 0xffff,
-  0xffff, 0xef9f, 0x5cfb, 0x4315, 0x3168, 0x4189, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9c94, 0xeeba, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xef9e, 0xe6db, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf73b, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xeefb, 0xef7e, 0xef7e, 0xef9f,
-  0xef7e, 0xef7e, 0xf79e, 0xeefb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0x9cb5, 0x4b77, 0x4357, 0x449b,
-  0x54bb, 0x5bd7, 0xb557, 0xad16, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3949, 0x3ad4, 0x33fa, 0x3c7b, 0x561d,
-  0xdf7f, 0xef7e, 0xeefb, 0xa4b4, 0x3968, 0xb41b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x3294, 0x4c9b, 0xdf5e, 0xefdf,
-  0xffff, 0xffff, 0xee79, 0xa1ca, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3949, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefb, 0xe20a, 0xa107, 0x4128, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3927, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x3294, 0x3148, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xacd5, 0xf73c, 0xffdf, 0xefbf,
-  0x665e, 0x4cfc, 0x447b, 0x4315, 0x3168, 0x4189, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xffde, 0xffdf, 0xffdf,
-  0xefbf, 0xef9f, 0xef9e, 0xe6db, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xef1b, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xffdf, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xe6bb, 0xef9e, 0xef9f, 0xefbf,
-  0xffdf, 0xf79e, 0xf79e, 0xeefb, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3148, 0x4315, 0x445b, 0x4cfc, 0x665d,
-  0xe71c, 0xc5b8, 0xbd98, 0xacb4, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3149, 0x3294, 0x4c9b, 0xdf5e, 0xefbf,
-  0xffdf, 0xf7be, 0xee38, 0xa1ca, 0x3927, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x3969, 0x4b14, 0xdebb, 0xffff, 0xffff,
-  0xff9e, 0xfefc, 0xe22b, 0xa107, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf71b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb41b, 0x3968, 0xa4b4, 0xef1b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad4, 0x3148, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xb536, 0xe6fb, 0x651c, 0x563e,
-  0x461d, 0x3c9b, 0x4c9b, 0x9cd6, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xffbe, 0xef9f, 0xefbf,
-  0xefbf, 0xef9f, 0xef9e, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xef1b, 0xffdf, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffdf, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xe6bb, 0xef7e, 0xf79e, 0xffdf,
-  0xffdf, 0xf79e, 0xf79e, 0xeeba, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3148, 0x42f5, 0x5bb7, 0xb598, 0xf73b,
-  0xef3c, 0xbdd8, 0xbcd5, 0xa1ea, 0x3927, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3149, 0x42f4, 0xd69b, 0xf7be, 0xffdf,
-  0xff7d, 0xf6bb, 0xe1ea, 0xa107, 0x3927, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9cd5, 0xf73b, 0xff7d, 0xff3d,
-  0xf3f0, 0xe9c9, 0xe127, 0xa169, 0x4148, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe927, 0xe1ea, 0xa433, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xac1b, 0x3989, 0xa4f5, 0xd69b, 0x4cdb, 0x3e1d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xac1b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xa4f6, 0x5cdb, 0x449b, 0x461d,
-  0x461d, 0x54db, 0xd6bb, 0xb536, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9cb4, 0xeefb, 0xef9e, 0xef9f, 0xefbf,
-  0xefbf, 0xef9f, 0xffde, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf71b, 0xffdf, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffdf, 0xef3b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffdf, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xe6bb, 0xf79e, 0xf79e, 0xffdf,
-  0xffdf, 0xf7be, 0xf75d, 0xeeba, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0x3148, 0x5355, 0xb557, 0xbdd8, 0xef3b,
-  0xeeda, 0xbcf5, 0xb1eb, 0xa189, 0x3947, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3969, 0x9cb5, 0xeefb, 0xf73c, 0xff3c,
-  0xf3d0, 0xe189, 0xd907, 0xa168, 0x3928, 0xb43b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xee38, 0xea4b, 0xf38f,
-  0xf32e, 0xe947, 0xe1ea, 0xa433, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe927, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb41b, 0x4188, 0x8c75, 0x447b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xacf5, 0x3989, 0xac1b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4189, 0x3168, 0x4b35, 0x445b, 0x449b, 0x563e,
-  0xdf9f, 0xef9e, 0xf73b, 0xad36, 0x3988, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9c94, 0xe6bb, 0xef9e, 0xef9f, 0xefbf,
-  0xffdf, 0xffff, 0xffde, 0xeefb, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf73b, 0xffdf, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef3b, 0xacf5, 0x4189, 0xbc5d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x49ca, 0xad15, 0xf73c, 0xffdf, 0xffff,
-  0xffff, 0xffdf, 0xf73c, 0xad36, 0x49ea, 0xb41b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x49cb, 0x9cb4, 0xeefb, 0xffde, 0xffff, 0xffdf,
-  0xffff, 0xffff, 0xffdf, 0xeefb, 0x9cb4, 0x49cb, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3968, 0x9cb4, 0xeefb, 0xf79e, 0xf7be, 0xffdf,
-  0xff5d, 0xf75d, 0xf75d, 0xee9a, 0x9cb4, 0x3968, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4169, 0x3988, 0xacf5, 0xbd97, 0xbd56, 0xee59,
-  0xea4b, 0xb9aa, 0xb1aa, 0xa1ea, 0x3947, 0x4189, 0xbc7d, 0xccdf,
-  0xccbf, 0xccbf, 0xb43b, 0x3989, 0xa4f5, 0xe618, 0xe20a, 0xf36f,
-  0xf30d, 0xe127, 0xe1ca, 0xa432, 0x3989, 0xb41b, 0xccbf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa433, 0xe1ea, 0xe947, 0xf32e,
-  0xf38f, 0xea4b, 0xee38, 0xad15, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa168, 0xe127, 0xe9c9, 0xf3f0,
-  0xff3d, 0xff7d, 0xf73b, 0x9cd5, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4148, 0xa107, 0xe20a, 0xfefb, 0xff9e,
-  0xffff, 0xffff, 0xdebb, 0x4b14, 0x3149, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4128, 0xa1ca, 0xee59, 0xffff, 0xffff,
-  0xefbf, 0xdf5e, 0x4c9b, 0x32b4, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4b4, 0xf71b, 0xef9e, 0xdf9f,
-  0x563e, 0x3c9b, 0x341b, 0x3ad5, 0x3969, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xd69b, 0x54db, 0x461d,
-  0x35fd, 0x2c5b, 0x4c7b, 0x9495, 0x4189, 0xbc5d, 0xccdf, 0xccbf,
-  0xccbf, 0xccdf, 0xbc7d, 0x4189, 0x9495, 0x4c7b, 0x2c5b, 0x35fd,
-  0x461d, 0x54db, 0xd69b, 0xad15, 0x4189, 0xbc7d, 0xccdf, 0xccbf,
-  0xccbf, 0xccbf, 0xb43b, 0x3948, 0x3ad4, 0x341b, 0x3c9b, 0x563e,
-  0xdf9f, 0xef9e, 0xef1b, 0xa494, 0x3968, 0xac1b, 0xccbf, 0xccbf,
-  0xccdf, 0xbc7d, 0x4189, 0x3148, 0x4315, 0x54bb, 0xdf5e, 0xefbf,
-  0xffdf, 0xffff, 0xf6da, 0xaa6c, 0x3927, 0x4169, 0xbc7d, 0xccdf,
-  0xccdf, 0xbc7d, 0x3989, 0x9c94, 0xe6bb, 0xef9e, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffbe, 0xeeba, 0x9cb4, 0x3989, 0xbc5d, 0xccdf,
-  0xccdf, 0xbc7d, 0x4189, 0xa4f5, 0xf73b, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xf73b, 0xacf5, 0x4189, 0xbc5d, 0xccdf
-};
-
-const Animation barbersAnimation = {
-  .name = "Barbers",
-  .frameCount = 12,
-  .width = 16,
-  .height = 16,
-  .frameDurations = barbersDurations,
-  .animationFrames = barbersFrames
-};
-#endif // ANIMATION_BARBERS_H
@@ -1,1366 +0,0 @@
-// beer.h - Auto-generated from beer.json
-#ifndef ANIMATION_BEER_H
-#define ANIMATION_BEER_H
-
-#include "animation_types.h"
-
-// Frame Durations for beer (in 100ms units)
-static const uint8_t PROGMEM beerDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for beer
-static const uint16_t PROGMEM beerFrames[] = {
-  0x0000, 0x0000, 0xffff, 0xef7d, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xa4f5, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xa4f5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xa4f5, 0xe62c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xa4f5, 0xa4f5, 0xa4f5, 0xa4f5, 0xa4f5, 0x0000,
-  0x0000, 0xa4f5, 0xddca, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xeeb2, 0xa4f5, 0xbdd8, 0xbdd8, 0xbdd8, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xddca, 0xe62c, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xe62c, 0xa4f5, 0xa4f5, 0xa4f5, 0xa4f5, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xddca, 0xddca, 0xe62c, 0xffff, 0xffff, 0xffff,
-  0xe62c, 0xddca, 0xa4f5, 0x0000, 0x0000, 0xa4f5, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xddcb, 0xddca, 0xddca, 0xe62c, 0xffff, 0xe62c,
-  0xddca, 0xddca, 0xa4f5, 0x0000, 0x0000, 0xa4f5, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xddca, 0xddca, 0xddca, 0xddca, 0xffff, 0xddca,
-  0xddca, 0xddca, 0xa4f5, 0x0000, 0x0000, 0xa4f5, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xcd6a, 0xcd6a, 0xddca, 0xddca, 0xddca, 0xddca,
-  0xcd6a, 0xcd6a, 0xa4f5, 0x0000, 0x0000, 0xa4f5, 0xbdd8, 0xa4f5,
-  0x0000, 0xa4f5, 0xc52a, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xc52a, 0xc52a, 0xa4f5, 0xa4f5, 0xa4f5, 0xa4f5, 0xad35, 0xa4f5,
-  0x0000, 0xa4f5, 0xc5b0, 0xaca9, 0xc52a, 0xc52a, 0xc52a, 0xc52a,
-  0xc5b0, 0xaca9, 0xa4f5, 0xad35, 0xad35, 0xad35, 0xa4f5, 0x0000,
-  0x0000, 0x9452, 0xa4f5, 0xa4f5, 0xaca9, 0xaca9, 0xaca9, 0xaca9,
-  0xa4f5, 0xa4f5, 0x9452, 0xa4f5, 0xa4f5, 0xa4f5, 0x0000, 0x0000,
-  0x0000, 0x83d0, 0x9452, 0x9452, 0xa4f5, 0xa4f5, 0xa4f5, 0xa4f5,
-  0x9452, 0x9452, 0x83d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x83d0, 0x83d0, 0x83d0, 0x9452, 0x9452, 0x9452, 0x9452,
-  0x83d0, 0x83d0, 0x83d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x83d0, 0x83d0, 0x83d0, 0x83d0, 0x83d0, 0x83d0,
-  0x83d0, 0x83d0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe62e, 0xf77a, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xdded, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd58a, 0xddcc, 0xef39, 0xddcc,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xcdaf, 0xc52a, 0xcd6a, 0xcd6a, 0xcd8c, 0xcd6b,
-  0xcdae, 0xbd0b, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xaccb, 0xacaa, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffbd, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd4a, 0xcd8c, 0xef39, 0xcd8c,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xc54b, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xef5c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddca, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde10, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xddab,
-  0xde0e, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd5aa, 0xd5aa, 0xd58a, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd8c, 0xd5ac, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd0a, 0xcdd0, 0xef19, 0xc54b,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xb4cb, 0xacab,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4b3, 0xa4b3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffbd, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xef3a, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe62d, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde30, 0xddaa, 0xddaa, 0xe64e, 0xf77b, 0xe64f,
-  0xe62e, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5cc, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xd5ef, 0xcd6a, 0xcd4a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd2a, 0xc54b, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xac8a, 0xb4eb, 0xe6f9, 0xb4ec,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa515, 0xa4b3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef7d,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ac, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xffbc, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xde30, 0xddca, 0xe62e, 0xf79c, 0xffff, 0xffbd,
-  0xeeb2, 0xd5ac, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xddaa, 0xe62e, 0xf77b, 0xe64e,
-  0xddca, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddab, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5ab, 0xde0f, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6b, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xb4ea, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xacf4, 0xe6fb, 0xa4f4,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x9452, 0x9493, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xdded, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xde30, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xde2f, 0xddcc, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xac89, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xad14, 0xa4b3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c32, 0x9c93, 0xdedb, 0x9493,
-  0x7bd0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x83d0, 0x8c11, 0x83d0,
-  0x7bd0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe650, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9472, 0xde51, 0xf79c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ac, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xffbd, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xeeb2, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddaa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4b3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x9452, 0x9c93, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bb0, 0x8c31, 0xdefb, 0x8c31,
-  0x7bd0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xdefb, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79e, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9472, 0xe6b3, 0xffde, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xddcd, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd4a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd0a, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4d3, 0xbd4f, 0xacaa, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0xa4d4, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c32, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xef7d, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xef7e,
-  0xffbd, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xff9c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6b, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xcd8e, 0xbd2a, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b3, 0xacab, 0xacaa, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xef5d, 0xa4f4, 0x18c3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xef7e,
-  0xf79c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xc52a, 0xd5ee, 0xcd6b, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd2b, 0xa4d3, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd0a, 0xbd09, 0xc52a, 0xbd09,
-  0xacca, 0xbd4f, 0xa4f4, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xbd4e, 0xacab,
-  0xa4b2, 0xa4d4, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d4, 0x9cb3,
-  0x9452, 0x8c52, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xe73c, 0xf79e, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa4f5, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xe71b, 0xa4f5, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xde2f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffdf, 0xef3b,
-  0xe62e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe62e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xde0f, 0xd5aa, 0xd58a, 0xd5aa,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6b, 0xcd6a, 0xcd6b, 0xcd6a,
-  0xc52a, 0xc58f, 0xa4f4, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd2a, 0xcdae, 0xbd0a,
-  0xaca9, 0xacab, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xacaa, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe62e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddca, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xde0f, 0xddab, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xd5f0, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd4a, 0xcd6b, 0xd5ef, 0xcd6b,
-  0xbd09, 0xbd0b, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd2a, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffbd, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xde2e, 0xe64e, 0xf77a, 0xe64e,
-  0xddaa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcc, 0xd5aa,
-  0xd5aa, 0xde10, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd58a, 0xd5aa, 0xde0e, 0xd5aa,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0b, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6b, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xaccb, 0xbd4e, 0xbd0a, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4d3, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffdf, 0xef7d, 0xffdf,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xffde, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xffbd, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0d, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddca, 0xee92, 0xffbd, 0xffdf, 0xf79c,
-  0xe64e, 0xd5cc, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddca, 0xde10, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddab, 0xe650, 0xddab,
-  0xd5aa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd8a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xcdae, 0xcd6b, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9471, 0xe62f, 0xef5c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5cc, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe62f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xde0e, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xde30, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9471, 0xcd6c, 0xd5ee, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0b, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xd5ee, 0xef3a, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe62d, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xffbc, 0xe62f, 0xa4f3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xde2f, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9471, 0xd5ac, 0xde0e, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xef7d, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe62e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xffbd, 0xe693, 0xa4f4, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddca, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xde2e, 0xddca, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xc52a, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xbd4e, 0xacab,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d4, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xef7d, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ac, 0xe62e, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6b, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd2a, 0xcd8e, 0xbd0a,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xacaa, 0xacaa, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xee92, 0xffbd, 0xffdf, 0xef7d, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffdf, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xbd09, 0xcd6a, 0xcd6b, 0xd5ef, 0xcd6b,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9472, 0xbd6f, 0xacca, 0xbd09, 0xbd09, 0xbd2a, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d4, 0xa4b3, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xef7e, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe62e, 0xf77a, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcc, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd58a, 0xd5aa, 0xde0e, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xcdaf, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6b, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xaccb, 0xacaa, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xf79e, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffdf, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddaa, 0xe62e, 0xef1a, 0xe62e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xd5aa, 0xddab, 0xde30, 0xddab,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xd5f0, 0xcd6a, 0xd58a, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xc52a, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd0a,
-  0xbd4e, 0xacab, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4d3, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xef7d, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde10, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd8a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6b,
-  0xcdae, 0xbd0b, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xef7d, 0xffdf, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9451, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ab, 0xe64e, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xddaa, 0xe64e, 0xf79c, 0xffff, 0xf79c,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde30, 0xddaa, 0xddaa, 0xe64e, 0xf77b, 0xe64e,
-  0xddaa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd58a, 0xd5aa,
-  0xd5ee, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xc52a, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xef7d, 0xf79e, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xde0e, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xde0f, 0xde0d, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xde0d, 0xd5ab, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcc,
-  0xde0e, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd58a,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf79e, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xef7d, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xe672, 0xf79c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xff9c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xe671, 0xd5ab, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcb,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd58a,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd4a, 0xcd6a, 0xcd6a, 0xcd4a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd0a, 0xbd09, 0xbd09, 0xbd0a,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4d3, 0xbd4f, 0xacaa, 0xacaa, 0xbd4f,
-  0xa4d3, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0xa4d4, 0xa4d3, 0xa4d3, 0xa4d4,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c32, 0x8c52, 0x8c52, 0x8c32,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xef9e, 0xf77c, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xde0d, 0xd5ab, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcb,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd58a,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6b, 0xcd6a, 0xcd6a, 0xcd6b,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xcd8e, 0xbd2a, 0xbd2a, 0xcd8e,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b3, 0xacab, 0xacaa, 0xacaa, 0xacab,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xe73c, 0xf79e, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffdf,
-  0xef3a, 0xd5ee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xdded, 0xd58b, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcb,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xc52a, 0xd5ee, 0xcd6b, 0xcd6a, 0xd5ee,
-  0xc52a, 0xbd2b, 0xa4d3, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd0a, 0xbd09, 0xbd09, 0xbd0a,
-  0xacca, 0xbd4f, 0xa4f4, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0xa4d4, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x8c52, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcc, 0xddcc, 0xddcc,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xde0e, 0xd5aa, 0xd5aa, 0xde0e,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6b, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xc52a, 0xc58f, 0xa4f4, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xacaa, 0xacab, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xde0d, 0xf79c, 0xffbd, 0xf79c,
-  0xde0d, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xde0e, 0xddcc, 0xddec, 0xe650,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5ab, 0xd5aa, 0xd5aa, 0xd5aa,
-  0xcd6a, 0xd5f0, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0b, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd4a,
-  0xbd09, 0xbd0b, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xaccb, 0xbd4e, 0xbd0a, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4d3, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef7d,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7be, 0xef7d, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xe671, 0xf79c, 0xffbd, 0xf79c,
-  0xde0d, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcb,
-  0xd5aa, 0xde0f, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd8a, 0xd5aa, 0xd5aa, 0xd5aa, 0xd58a,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xcdae, 0xcd6b, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xacaa, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xffdf, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0xe6fc, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xe73c, 0x20e4, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9cd4, 0xf7bf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad36, 0x9493, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf77d, 0xef7e, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad15, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf77c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffff, 0xffff,
-  0xf79c, 0xde0e, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffbd, 0xf79c,
-  0xde0d, 0xde0f, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xddcb, 0xddcc, 0xddcb,
-  0xd5aa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9471, 0xcd6c, 0xd5ee, 0xd5ab, 0xd58a, 0xd5aa, 0xd58a,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0b, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xad35, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xd5ee, 0xef3a, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79d, 0xad15, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd58b, 0xddec, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xf79c, 0xe672, 0x9c92, 0x10a2, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf79c,
-  0xde0d, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9471, 0xd5ac, 0xde0e, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xde0d, 0xf79c, 0xffff, 0xffdf, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xde0e, 0xde0d, 0xf79c, 0xffff, 0xf79c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd4a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9472, 0xbd6f, 0xacca, 0xbd09, 0xbd09, 0xbd09, 0xbd0a,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d4, 0xa4b3, 0xacaa, 0xaca9, 0xacaa, 0xbd4f,
-  0xa4d3, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0xa4d4,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c32,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xe671, 0xf79c, 0xffdf, 0xffdf, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf79c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd58a,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xcdaf, 0xc52a, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6b,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xaccb, 0xacaa, 0xbd09, 0xbd09, 0xbd2a, 0xcd8e,
-  0xacca, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xacaa, 0xacab,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffdf, 0xef7d, 0xffdf, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xef7d,
-  0xffdf, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf79c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xd5f0, 0xcd6a, 0xd58a, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd2b, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xd5ee,
-  0xc52a, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd0a,
-  0xacaa, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xd58b, 0xdded, 0xf79c, 0xffff, 0xffdf, 0xef7e,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf77c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde10, 0xd5aa, 0xd58a, 0xdded, 0xf77a, 0xde0e,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6c, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcc, 0xde0f,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd2b, 0xa4d3, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xacca, 0xbd4f, 0xa4f4, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0xa4d4, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x8c52, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xef7d, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xddee, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffdf, 0xffdf,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xde10, 0xd5aa, 0xdded, 0xf79c, 0xffdf, 0xef3b,
-  0xdded, 0xd5ab, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xd5aa, 0xdded, 0xf77b, 0xe672,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd4a,
-  0xc52a, 0xc5af, 0xa4f4, 0x9473, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xacaa, 0xacab, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7bf, 0xffff, 0xffdf, 0xef7d, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9471, 0xde0e, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xde0f, 0xde0d, 0xf79c, 0xffff, 0xffdf, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5cc, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf79c,
-  0xdded, 0xd58b, 0x9c72, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xd5f0, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0b, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf7be, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf79e, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xef7d, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xad35, 0xb597, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xe672, 0xf79c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xa515, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xdded, 0xf79c, 0xffff, 0xffdf, 0xffff,
-  0xf79c, 0xddee, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xdded, 0xf79c, 0xffff, 0xf79c,
-  0xde0d, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xde10, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6c, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4f4, 0xf7bf, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9c93, 0xf79d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7be, 0xa515, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9472, 0xe672, 0xf79c, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf77d, 0xad15, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xef7d, 0xffdf, 0xffdf,
-  0xff9c, 0xe62f, 0xa4d3, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe64e, 0xffbd, 0xffff, 0xffbe,
-  0xe64e, 0xd5ab, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddcb, 0xf79c, 0xffff, 0xf79c,
-  0xddec, 0xde0f, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xdded, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ac, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xef5d, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef5d, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xce59, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xce79, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0xa4d4, 0xf79e, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf7bf, 0xa515, 0x18a3, 0x0861, 0x0861, 0x0841, 0x0000,
-  0x0861, 0x9472, 0xe6b3, 0xffde, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xf77d, 0xa4f5, 0x9473, 0x9c93, 0x9c93, 0x8c31, 0x18c3,
-  0x0861, 0x9471, 0xddcd, 0xf79c, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xe64f, 0xacf4, 0xbd97, 0xbdb7, 0xbdb7, 0xb597, 0x9c93,
-  0x0861, 0x9472, 0xd5ab, 0xe64e, 0xf79c, 0xffdf, 0xffdf, 0xffdf,
-  0xffbc, 0xe671, 0xa4f4, 0x9473, 0x9493, 0xa4f5, 0xb597, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xddaa, 0xe62e, 0xef5c, 0xffdf, 0xffde,
-  0xe64e, 0xd5cc, 0x9c92, 0x10a3, 0x10a2, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ac, 0xd5aa, 0xddcb, 0xf77c, 0xffff, 0xf79c,
-  0xddcb, 0xd58b, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbd97, 0xa4f5,
-  0x0861, 0x9472, 0xd5ab, 0xd5aa, 0xd5aa, 0xde0d, 0xf77a, 0xdded,
-  0xd5aa, 0xd5ab, 0x9c92, 0x0841, 0x0841, 0x9493, 0xbdb7, 0xa4f5,
-  0x0861, 0x9472, 0xcd6b, 0xcd6a, 0xd5aa, 0xd5aa, 0xddcb, 0xd5aa,
-  0xcd6a, 0xcd6b, 0x9c92, 0x10a3, 0x10a2, 0x9c93, 0xb597, 0xa4f5,
-  0x0861, 0x9471, 0xbd0a, 0xbd09, 0xcd6a, 0xcd6a, 0xcd6a, 0xcd6a,
-  0xbd09, 0xbd0a, 0xa4d3, 0x9493, 0x9493, 0xa4d4, 0xad35, 0x9493,
-  0x0861, 0x9451, 0xacab, 0xaca9, 0xbd09, 0xbd09, 0xbd09, 0xbd09,
-  0xaca9, 0xacaa, 0xa4d3, 0xad35, 0xad35, 0xad35, 0x8c31, 0x18c3,
-  0x0841, 0x83f0, 0xa4d3, 0xa4b2, 0xacaa, 0xaca9, 0xaca9, 0xacaa,
-  0xa4b2, 0x9cb3, 0x9452, 0x9473, 0x9493, 0x8c31, 0x10a2, 0x0000,
-  0x0841, 0x738f, 0x9452, 0x9452, 0x9cb3, 0xa4d3, 0xa4d3, 0x9cb3,
-  0x9452, 0x9452, 0x7b8f, 0x10a2, 0x0861, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x6b2d, 0x7bd0, 0x83d0, 0x8c52, 0x8c52, 0x8c52, 0x8c52,
-  0x83d0, 0x7bd0, 0x6b2d, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x736e, 0x83d0, 0x7bd0, 0x7bd0, 0x7bd0, 0x7bd0,
-  0x83d0, 0x738f, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation beerAnimation = {
-  .name = "Beer",
-  .frameCount = 42,
-  .width = 16,
-  .height = 16,
-  .frameDurations = beerDurations,
-  .animationFrames = beerFrames
-};
-#endif // ANIMATION_BEER_H
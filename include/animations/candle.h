@@ -1,182 +0,0 @@
-// candle.h - Auto-generated from candle.json
-#ifndef ANIMATION_CANDLE_H
-#define ANIMATION_CANDLE_H
-
-#include "animation_types.h"
-
-// Frame Durations for candle (in 100ms units)
-static const uint8_t PROGMEM candleDurations[] = { 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for candle
-static const uint16_t PROGMEM candleFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0,
-  0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0,
-  0xfd40, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xfd40,
-  0xfd40, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xfd40,
-  0xfd40, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xfd40, 0x555c,
-  0xfd40, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xfd40, 0x555c,
-  0xfd40, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0, 0x0000,
-  0xfd40, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0x0000,
-  0xffe0, 0xbc2a, 0xbc2a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xdccd, 0xbc2a, 0xdccd, 0xbc2a, 0x0000,
-  0xbc2a, 0xdccd, 0xbc2a, 0xdccd, 0xdccd, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xdccd, 0xdccd, 0xdccd, 0xdccd, 0xdccd, 0xbc2a,
-  0xdccd, 0xdccd, 0xdccd, 0xdccd, 0xf637, 0xf637, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xd490, 0xf637, 0xf637, 0xdccd, 0xdccd, 0xdccd,
-  0xdccd, 0xdccd, 0xf637, 0xf637, 0xf637, 0xf637, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x91a3, 0xd490, 0xf637, 0xd490, 0xd490, 0xd490,
-  0xf637, 0xf637, 0xf637, 0xc9c2, 0xd490, 0xf637, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x91a3, 0xc9c2, 0xd490, 0xd490, 0xc9c2, 0xd490,
-  0xd490, 0xf637, 0xc9c2, 0xc9c2, 0xc9c2, 0x91a3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x91a3, 0x91a3, 0xd490, 0xc9c2, 0xc9c2, 0xc9c2,
-  0xd490, 0xd490, 0xc9c2, 0xc9c2, 0x91a3, 0x91a3, 0x91a3, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xd6a0, 0x2940,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xe720, 0xdec0,
-  0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xe720, 0xffe0,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef40, 0xffa0,
-  0xef40, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd6a0, 0xff80, 0xfdc0,
-  0xffa0, 0xd6c0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xeee0, 0xfda0, 0xed62,
-  0xff80, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xd680, 0xfda0, 0xed22, 0x7d56,
-  0xeda2, 0xef00, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xef20, 0xfd80, 0xed22, 0x6cd6,
-  0xed62, 0xef00, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0880, 0xd660, 0xfdc0, 0xe4c0, 0x2921,
-  0xe540, 0xeee1, 0x20e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1061, 0x3160, 0xeec1, 0xe4e0, 0x20e0,
-  0xde61, 0xccc9, 0xa389, 0x18a1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a1, 0xb3ea, 0xb3ea, 0xd4eb, 0xb3e9, 0x28e2,
-  0xb409, 0xd4ac, 0xc42b, 0xc46c, 0xbc2c, 0x20c2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0xb40b, 0xdcee, 0xd4cd, 0xd4ad, 0xcc8c, 0xb3ea,
-  0xcc8c, 0xd4ad, 0xd4cd, 0xdd0e, 0xee16, 0xcd53, 0x1061, 0x0000,
-  0x0000, 0x1041, 0xbc2e, 0xedf5, 0xedf5, 0xd4ce, 0xd4ad, 0xd4cd,
-  0xd4cd, 0xdcee, 0xedf5, 0xedb5, 0xee17, 0xddd5, 0x1081, 0x0000,
-  0x0000, 0x0820, 0x89e4, 0xd46f, 0xe5d5, 0xd4b0, 0xcc4e, 0xd4b0,
-  0xe5d5, 0xee16, 0xed94, 0xcaa6, 0xd44e, 0xd533, 0x1061, 0x0000,
-  0x0000, 0x0820, 0x8183, 0xba24, 0xd46f, 0xcc2d, 0xca65, 0xcc0d,
-  0xd4d1, 0xe594, 0xca65, 0xc1c2, 0xc203, 0x89e4, 0x1040, 0x0000,
-  0x0000, 0x0820, 0x8183, 0x99e4, 0xcc0d, 0xca44, 0xc1c2, 0xc224,
-  0xcc4e, 0xd46f, 0xc203, 0xc1c2, 0x91a3, 0x89a3, 0x7963, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2940, 0xd6a0, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd6a0, 0xef40, 0x2120,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef20, 0xffe0, 0xdec0,
-  0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xd660, 0xfdc0, 0xff60, 0xffc0,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xfd80, 0xed42, 0xfda0,
-  0xef20, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xf582, 0x7536, 0xe564,
-  0xff60, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xd660, 0xf5a2, 0x6d38, 0x6d58,
-  0xf5a2, 0xef00, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef00, 0xe5a4, 0x64d6,
-  0xed62, 0xef00, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd6a0, 0xef00, 0x2961,
-  0xe520, 0xeee1, 0x20e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x1060, 0x3181, 0xce41, 0x2120,
-  0xde61, 0xccc9, 0xa389, 0x18a1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a1, 0xb3ea, 0xb3ea, 0xc44b, 0xb409, 0x28e2,
-  0xb409, 0xd4ac, 0xc42b, 0xc46c, 0xbc2c, 0x20c2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0xb40b, 0xdcee, 0xd4ed, 0xd4cd, 0xcc8c, 0xb3ea,
-  0xcc8c, 0xd4ad, 0xd4cd, 0xdd0e, 0xee16, 0xcd53, 0x1061, 0x0000,
-  0x0000, 0x1041, 0xbc2e, 0xedf5, 0xedf5, 0xd4ce, 0xd4ad, 0xd4cd,
-  0xd4cd, 0xdcee, 0xedf5, 0xedb5, 0xee17, 0xddd5, 0x1081, 0x0000,
-  0x0000, 0x0820, 0x89e4, 0xd46f, 0xe5d5, 0xd4b0, 0xcc4e, 0xd4b0,
-  0xe5d5, 0xee16, 0xed94, 0xcaa6, 0xd44e, 0xd533, 0x1061, 0x0000,
-  0x0000, 0x0820, 0x8183, 0xba24, 0xd46f, 0xcc2d, 0xca65, 0xcc0d,
-  0xd4d1, 0xe594, 0xca65, 0xc1c2, 0xc203, 0x89e4, 0x1040, 0x0000,
-  0x0000, 0x0820, 0x8183, 0x99e4, 0xcc0d, 0xca44, 0xc1c2, 0xc224,
-  0xcc4e, 0xd46f, 0xc203, 0xc1c2, 0x91a3, 0x89a3, 0x7963, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2940,
-  0xd6a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0,
-  0xef40, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd6a0, 0xffe0,
-  0xffa0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef40, 0xff80,
-  0xfde0, 0xef20, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xd6a0, 0xffa0, 0xfd80,
-  0xfd60, 0xffa0, 0xdec0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xef40, 0xff80, 0xed42,
-  0xfd60, 0xffa0, 0xdec0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xf5a2, 0x7d36,
-  0xed82, 0xef00, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xeda2, 0x6cd6,
-  0xed62, 0xef00, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0880, 0xd6a0, 0xe700, 0x2961,
-  0xe520, 0xeee1, 0x20e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x1060, 0x3181, 0xce41, 0x2120,
-  0xde61, 0xccc9, 0xa389, 0x18a1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a1, 0xb3ea, 0xb3ea, 0xc44b, 0xb409, 0x28e2,
-  0xb409, 0xd4ac, 0xc42b, 0xc46c, 0xbc2c, 0x20c2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0xb40b, 0xdcee, 0xd4ed, 0xd4cd, 0xcc8c, 0xb3ea,
-  0xcc8c, 0xd4ad, 0xd4cd, 0xdd0e, 0xee16, 0xcd53, 0x1061, 0x0000,
-  0x0000, 0x1041, 0xbc2e, 0xedf5, 0xedf5, 0xd4ce, 0xd4ad, 0xd4cd,
-  0xd4cd, 0xdcee, 0xedf5, 0xedb5, 0xee17, 0xddd5, 0x1081, 0x0000,
-  0x0000, 0x0820, 0x89e4, 0xd46f, 0xe5d5, 0xd4b0, 0xcc4e, 0xd4b0,
-  0xe5d5, 0xee16, 0xed94, 0xcaa6, 0xd44e, 0xd533, 0x1061, 0x0000,
-  0x0000, 0x0820, 0x8183, 0xba24, 0xd46f, 0xcc2d, 0xca65, 0xcc0d,
-  0xd4d1, 0xe594, 0xca65, 0xc1c2, 0xc203, 0x89e4, 0x1040, 0x0000,
-  0x0000, 0x0820, 0x8183, 0x99e4, 0xcc0d, 0xca44, 0xc1c2, 0xc224,
-  0xcc4e, 0xd46f, 0xc203, 0xc1c2, 0x91a3, 0x89a3, 0x7963, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120,
-  0xc620, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0,
-  0xffa0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd6a0, 0xff80,
-  0xfde0, 0xef20, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef20, 0xfda0,
-  0xfd60, 0xff60, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xd6a0, 0xff80, 0xfd60,
-  0xf521, 0xfda0, 0xef00, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xfda0, 0xe544,
-  0x7536, 0xe584, 0xe700, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef00, 0xf561, 0x64d6,
-  0x553c, 0x7d96, 0xdf02, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xef00, 0xed40, 0x1924,
-  0x54d8, 0xe585, 0xe6c0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x20e0, 0xef01, 0xef00, 0x10e2,
-  0x64b5, 0xf582, 0xbc27, 0x18a1, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a1, 0xb3ea, 0xb3ea, 0xdd2b, 0xe6c2, 0x3141,
-  0xdce2, 0xf702, 0xc46a, 0xc44c, 0xbc2c, 0x20c2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0xb40b, 0xdcee, 0xd4cd, 0xd4cd, 0xd4cb, 0xb3ea,
-  0xd4ab, 0xd4ec, 0xd4cd, 0xdd0e, 0xee16, 0xcd53, 0x1061, 0x0000,
-  0x0000, 0x1041, 0xbc2e, 0xedf5, 0xedf5, 0xd4ce, 0xd4ad, 0xd4ad,
-  0xd4cd, 0xdcee, 0xedf5, 0xedd5, 0xee17, 0xddd5, 0x1081, 0x0000,
-  0x0000, 0x0820, 0x89e4, 0xd46f, 0xe5d5, 0xd4b0, 0xcc4e, 0xd4b0,
-  0xe5d5, 0xee16, 0xed94, 0xcaa6, 0xd44e, 0xd533, 0x1061, 0x0000,
-  0x0000, 0x0820, 0x8183, 0xba24, 0xd46f, 0xcc2d, 0xca65, 0xcc0d,
-  0xd4d1, 0xe594, 0xca65, 0xc1c2, 0xc203, 0x89e4, 0x1040, 0x0000,
-  0x0000, 0x0820, 0x8183, 0x99e4, 0xcc0d, 0xca44, 0xc1c2, 0xc224,
-  0xcc4e, 0xd46f, 0xc203, 0xc1c2, 0x91a3, 0x89a3, 0x7963, 0x0820
-};
-
-const Animation candleAnimation = {
-  .name = "Candle",
-  .frameCount = 5,
-  .width = 16,
-  .height = 16,
-  .frameDurations = candleDurations,
-  .animationFrames = candleFrames
-};
-#endif // ANIMATION_CANDLE_H
@@ -1,1462 +0,0 @@
-// cat.h - Auto-generated from cat.json
-#ifndef ANIMATION_CAT_H
-#define ANIMATION_CAT_H
-
-#include "animation_types.h"
-
-// Frame Durations for cat (in 100ms units)
-static const uint8_t PROGMEM catDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for cat
-static const uint16_t PROGMEM catFrames[] = {
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xfe52, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xfe30, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x5531, 0xffff, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffff, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xe73c, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffbe, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xfd34, 0xfd75, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xeefb, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2105, 0x2105, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0041, 0x0842, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x9c92, 0x18c4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0862, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xdedb, 0x3187, 0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xdf1c, 0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xefbe, 0x8615, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xf79d, 0xfd75, 0xfd75, 0xf79e, 0xdefb, 0x1904, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xef5d, 0xeefb, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xdedb, 0x4208, 0x18e4, 0x2105, 0x18e4, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2966, 0x8c51, 0x2125, 0x0041, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x2145, 0x9451, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x2946, 0x9cb2, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18e4, 0x0862, 0x0842, 0x0862, 0x18c3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0042, 0x18e4, 0xc638, 0x31a7, 0x18c4, 0x3144, 0xc4ee,
-  0x18c3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18c3, 0x18c3, 0x3186, 0xe75d, 0xdf3c, 0xe71b, 0xedf1, 0xdd8f,
-  0x2945, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xe5b0, 0xe5d0, 0xef3c, 0xef9e, 0x85f5, 0xf77d, 0xf75c, 0x85d3,
-  0xce9a, 0x2104, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xfe72, 0xff9d, 0xffff, 0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xf79d,
-  0xdefb, 0x1904, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffde, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xef1c, 0xef1c, 0xdedb,
-  0x2986, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xe75d, 0xffdf, 0xffff, 0xffdf, 0xd6bb, 0x3187, 0x1904, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x4229, 0xef5d, 0xef5d, 0xb575, 0x39a7, 0x0842, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xe71b, 0xd6ba, 0x2966, 0x2125, 0x8c51, 0x2945, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xedf0, 0x3186, 0x0842, 0x0842, 0x2946, 0x9cb2, 0x18e4, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862, 0x0842,
-  0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7, 0x18c4,
-  0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0842, 0x0842, 0x0842, 0x2966, 0xef5d, 0xdf3c, 0xe71b,
-  0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18c3, 0x18c3, 0x18c3, 0x2945, 0xdedb, 0xefbe, 0x8615, 0xf77d,
-  0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862, 0x0862,
-  0xe5b0, 0xe5b0, 0xe5b0, 0xedd1, 0xffde, 0xffff, 0xef7d, 0xfd55,
-  0xfd75, 0xf79e, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862, 0x0862,
-  0xfe51, 0xfe31, 0xfe72, 0xffbd, 0xffdf, 0xffdf, 0xffdf, 0xff9e,
-  0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffde, 0xffde, 0xffde, 0xffff, 0xffff, 0xffdf, 0xffff, 0xdefb,
-  0x3187, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffdf, 0xef5d, 0xef5d, 0xef5d, 0xf7be, 0xffff, 0xdedb, 0x2966,
-  0x0842, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xad34, 0x39e8, 0x18e4, 0x2966, 0xc5f7, 0xdedb, 0x41e7, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x39c7, 0x8c30, 0x10a3, 0x10a3, 0x9cb2, 0x4a28, 0xb44b, 0x18c3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xd6ba, 0x3186, 0x0862, 0x0862, 0x2945, 0x9cb2, 0x3165, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4,
-  0x0862, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638,
-  0x31a7, 0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862,
-  0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842, 0x2966, 0xef5d,
-  0xdf3c, 0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x2945, 0xdedb, 0xefbe,
-  0x85f5, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862,
-  0xef3c, 0xe5d1, 0xe5b0, 0xe5b0, 0xe5b0, 0xedf1, 0xffde, 0xffff,
-  0xef7d, 0xfd75, 0xfd75, 0xf79e, 0xdefb, 0x1904, 0x0842, 0x0862,
-  0xffff, 0xffbd, 0xfe72, 0xfe31, 0xfe72, 0xffbd, 0xffdf, 0xffdf,
-  0xffff, 0xef1c, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffff, 0xffbe, 0xffde, 0xffde, 0xffff, 0xffff, 0xffff,
-  0xdedb, 0x3187, 0x1904, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffdf, 0xef7d, 0xf7be, 0xef5d, 0xef5d, 0xf7be, 0xef5d, 0xdedb,
-  0x4208, 0x0842, 0x0842, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xef5d, 0x4208, 0xa4d3, 0x39c7, 0x2966, 0xb555, 0x2966, 0x2966,
-  0xb5b6, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xd6ba, 0x2966, 0x2125, 0x8c30, 0x2125, 0x9c92, 0x2125, 0x0842,
-  0x3165, 0xb46c, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x31a7, 0xc618, 0x2104, 0x18c3, 0x0862, 0x2945, 0x9cb2, 0x18e4,
-  0x0842, 0x20e3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0042, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xb48d, 0x39a5, 0xd52e, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4ee, 0x41a6, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4cd, 0x41a5, 0xedaf, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xc4ee, 0xff9c, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x3165, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x85f5,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ce, 0x18e3, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e4, 0xd54f, 0x18c3, 0x18a3, 0xedd0, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ac, 0x3144, 0x2986, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x2924, 0xd54e, 0xef3c, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e3, 0x0862, 0x0042, 0x18c3, 0xedcf, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x3144, 0x18c3, 0x3186, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3165, 0xd50d, 0xedaf, 0xef3b, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x3187,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xef5d,
-  0xe71c, 0xedf1, 0xedcf, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xffbe, 0xff7d, 0xef3c, 0xdedb, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffff, 0xff9e,
-  0xfd55, 0xfd55, 0xffbe, 0xdefb, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0842, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffdf,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18e3, 0x18c3, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3144, 0xc4ee, 0xd52d, 0x2924, 0xd54e, 0xfe51, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x41c6, 0xc4cd, 0x41e7, 0xedb0, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0x0862, 0x2925, 0xc638, 0xffbd, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x31a7, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4,
-  0x0862, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0042, 0x18e4, 0xc638,
-  0x31a7, 0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x18c3, 0x3165, 0xef5d,
-  0xdf3c, 0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x2924, 0xd54f, 0xedb0, 0xedf1, 0xef7d,
-  0x8615, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862,
-  0x0842, 0x0842, 0x18c3, 0xd54e, 0xfe51, 0xfe72, 0xffbd, 0xffdf,
-  0xef7d, 0xfd55, 0xfd75, 0xf79e, 0xdefb, 0x1904, 0x0842, 0x0862,
-  0x18e3, 0x0842, 0x18e4, 0xef3c, 0xffde, 0xffbe, 0xffff, 0xffff,
-  0xffdf, 0xff9e, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x3144, 0x2965, 0xe73d, 0xef7d, 0xffdf, 0xef5d, 0xef5d,
-  0xffff, 0xef5d, 0x3187, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3144, 0xc4ac, 0xd56f, 0xe71b, 0x52ab, 0xc659, 0x4208, 0x2966,
-  0xdedb, 0xef5d, 0x2965, 0x0841, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x3186, 0xef5d, 0xd6bb, 0x4209, 0xbe18, 0x18e4,
-  0x2966, 0xef3c, 0xdd6f, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18e4, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef5d, 0xdeba, 0x2945,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffff, 0xffbd, 0xfe72, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18e4, 0xd6bb, 0xffff, 0xffbe, 0xfe52, 0xfe31, 0xfe51,
-  0xdd90, 0x2945, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x18a3, 0x18e4, 0xef5d, 0xffff, 0xffbe, 0xfe30, 0xfe31, 0xfe52,
-  0xffbd, 0xdedb, 0x2966, 0x2924, 0xc4ee, 0x18c3, 0x0842, 0x0862,
-  0xd52d, 0x4208, 0xe73d, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9d,
-  0xffdf, 0xefbe, 0xef3c, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedcf, 0xdeba, 0xffdf, 0xffff, 0xffff, 0xffbe, 0xffde, 0xffff,
-  0xefbe, 0x85f4, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x18c3, 0x3186, 0xdedb, 0xffdf, 0xef5d, 0xffdf, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0842, 0x3186, 0xc638, 0x52ab, 0xc638, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xef1c, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x3187, 0xc618, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18e4, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef5d, 0xdeba, 0x2945,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffff, 0xffbd, 0xfe72, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18e4, 0xd6bb, 0xffff, 0xffbe, 0xfe52, 0xfe31, 0xfe51,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x18a3, 0x2104, 0xef5d, 0xffff, 0xffbe, 0xfe30, 0xfe31, 0xfe31,
-  0xfe72, 0xdeba, 0x2966, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0xd52e, 0x3165, 0xe73d, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9c,
-  0xffbe, 0xffff, 0xd6bb, 0x41c6, 0xc4cd, 0x18c3, 0x0842, 0x0862,
-  0xedaf, 0x4208, 0xd6db, 0xffdf, 0xffff, 0xffbe, 0xffbe, 0xffdf,
-  0xffdf, 0xefbe, 0xffde, 0xee11, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedd0, 0xc617, 0x3a08, 0xe73c, 0xef7d, 0xffdf, 0xffff, 0xffff,
-  0xefbe, 0x85f4, 0xef7d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x18e4, 0x2105, 0xd6ba, 0x4229, 0xe73c, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0041, 0x2104, 0xc618, 0x4209, 0xc618, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xef1c, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18e4, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef5d, 0xd69a, 0x2945,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffff, 0xffbd, 0xfe72, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c4, 0xd6bb, 0xffff, 0xffbe, 0xfe52, 0xfe31, 0xfe31,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x3165, 0xef5d, 0xffff, 0xffbe, 0xfe30, 0xfe11, 0xfe31,
-  0xfe72, 0xdeba, 0x2966, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x2924, 0xc4ef, 0xffbe, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9c,
-  0xffbe, 0xffff, 0xd6bb, 0x41c6, 0xc4cd, 0x18c3, 0x0842, 0x0862,
-  0xdd4d, 0x5a69, 0xef5d, 0xffff, 0xffff, 0xffbe, 0xffbe, 0xffdf,
-  0xffdf, 0xefbe, 0xffde, 0xee11, 0xdd8e, 0x2945, 0x0862, 0x0862,
-  0xedcf, 0xd699, 0xef5d, 0xffdf, 0xef7d, 0xffdf, 0xffff, 0xffff,
-  0xefbe, 0x85d4, 0xef7d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x2104, 0x31a7, 0xdedb, 0x4229, 0xe73c, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0021, 0x18e4, 0xc618, 0x4209, 0xc618, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xeefc, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18e4, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef5d, 0xdeba, 0x2945,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffff, 0xffbd, 0xfe72, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18e4, 0xd6bb, 0xffff, 0xffbe, 0xfe52, 0xfe31, 0xfe51,
-  0xdd90, 0x2945, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x18a3, 0x18e4, 0xef5d, 0xffff, 0xffbe, 0xfe30, 0xfe31, 0xfe52,
-  0xffbd, 0xdedb, 0x2966, 0x2924, 0xc4ee, 0x18c3, 0x0842, 0x0862,
-  0xd52d, 0x4208, 0xe73d, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9d,
-  0xffdf, 0xefbe, 0xef3c, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedcf, 0xdeba, 0xffdf, 0xffff, 0xffff, 0xffbe, 0xffde, 0xffff,
-  0xefbe, 0x85f4, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x18c3, 0x3186, 0xdedb, 0xffdf, 0xef5d, 0xffdf, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0842, 0x3186, 0xc638, 0x52ab, 0xc638, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xef1c, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x3187, 0xc618, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18c3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef3b, 0xd54f, 0x2924,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffde, 0xfe72, 0xfe51, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18e4, 0xd6bb, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe51,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x18a3, 0x2104, 0xef5d, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe31,
-  0xfe72, 0xdeba, 0x2966, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0xd52e, 0x3165, 0xe73d, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9c,
-  0xffbe, 0xffff, 0xd6bb, 0x41c6, 0xc4cd, 0x18c3, 0x0842, 0x0862,
-  0xedaf, 0x4208, 0xd6db, 0xffdf, 0xffff, 0xffbe, 0xffbe, 0xffdf,
-  0xffdf, 0xefbe, 0xffde, 0xee11, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedd0, 0xc617, 0x3a08, 0xe73c, 0xef7d, 0xffdf, 0xffff, 0xffff,
-  0xefbe, 0x85f4, 0xef7d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x18e4, 0x2105, 0xd6ba, 0x4229, 0xe73c, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0041, 0x2104, 0xc618, 0x4209, 0xc618, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xef1c, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18c3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6bb, 0xef3b, 0xd54f, 0x2924,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffde, 0xfe72, 0xfe51, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c4, 0xd6bb, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe51,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x3165, 0xef5d, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe31,
-  0xfe72, 0xdeba, 0x2966, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x2924, 0xc50f, 0xffbe, 0xffff, 0xffbe, 0xfe52, 0xfe51, 0xff9c,
-  0xffbe, 0xffff, 0xd6bb, 0x41c6, 0xc4cd, 0x18c3, 0x0842, 0x0862,
-  0xdd4d, 0x5a69, 0xef5d, 0xffff, 0xffff, 0xffbe, 0xffbe, 0xffdf,
-  0xffdf, 0xefbe, 0xffde, 0xee11, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedcf, 0xd699, 0xef5d, 0xffdf, 0xef7d, 0xffdf, 0xffff, 0xffff,
-  0xefbe, 0x85f4, 0xef7d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x2104, 0x31a7, 0xdedb, 0x4229, 0xe73c, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd75, 0xfd75, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0021, 0x18e4, 0xc618, 0x4209, 0xc618, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xeefc, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x3186, 0xef5d,
-  0xffbe, 0xfd14, 0xfd14, 0xffbe, 0xffff, 0xdedb, 0x18e4, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18c4, 0xd6ba, 0xffdf,
-  0xffdf, 0xff9e, 0xff9e, 0xffff, 0xef7d, 0x31a7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x2945, 0xef3c, 0xffff,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xdedb, 0x18e4, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c3, 0xd54f, 0xfe52, 0xffbe,
-  0xffdf, 0xffdf, 0xffff, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x2924, 0xedd0, 0xfe52, 0xffbe,
-  0xffdf, 0xffff, 0xdedb, 0x2966, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18c3, 0xd54f, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5c, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2924, 0xedf1, 0xffbd, 0xffdf, 0xffdf,
-  0xffbe, 0xd590, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2945, 0xd570, 0xff9d, 0xffdf, 0xffdf, 0xffff,
-  0xef5d, 0x3165, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18c4, 0xd6ba, 0xffde, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xce79, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18c3, 0x3187, 0xef5d, 0xffff, 0xffff, 0xffdf, 0xffff, 0xef5d,
-  0x2986, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xd54e, 0xd699, 0xf7df, 0xef7d, 0xef5d, 0xffdf, 0xef7d, 0xce79,
-  0x18c4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0x4208, 0xce7a, 0xce59, 0x4208, 0xe73c, 0xe71c, 0x2966,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2966, 0xa555, 0x2966, 0x10c3, 0x18c4, 0xdedb, 0xce79, 0x18c4,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xbdd7, 0x2986, 0x0842, 0x0842, 0x2966, 0xbdd7, 0x2966, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x1904, 0x0862, 0x0842, 0x18e4, 0xad55, 0x2966, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x1904, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x2944, 0xedd0, 0xfe51, 0xfe31, 0xffbe, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xef7d, 0xd6ba, 0x2104,
-  0x0842, 0x2924, 0xd54f, 0xfe31, 0xfe30, 0xfe52, 0xffbe, 0xffdf,
-  0xffff, 0xffff, 0xef5d, 0xef5d, 0xdedb, 0x31a7, 0x18e4, 0x0862,
-  0x2965, 0xd54e, 0xfe72, 0xff9d, 0xffbe, 0xffbe, 0xffdf, 0xffff,
-  0xef7d, 0xdedb, 0x3186, 0x18e4, 0x18e4, 0x0862, 0x0842, 0x0862,
-  0xef5d, 0xffbe, 0xffbe, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xdedb,
-  0x3186, 0x18e4, 0x0862, 0x0842, 0x0842, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xdedb, 0x2966,
-  0x0842, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffdf, 0xffff, 0xffdf, 0xffdf, 0xce7a, 0x2966, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffdf, 0xef5d, 0xef7d, 0xdefb, 0x2966, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xce79, 0x39e8, 0xdefb, 0xef5d, 0x18e4, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xce79, 0x2966, 0x18e4, 0xe73c, 0xdefb, 0x18e4, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0842, 0x18e4, 0xdedb, 0x31a7, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x3186, 0xc639, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x1904, 0xce59, 0x3187, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x2105, 0xce59, 0x1904, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2104, 0xe73c, 0xffff, 0xffff, 0xffbe, 0xfe52, 0xfe30, 0xfe30,
-  0xfe0f, 0xfe52, 0xffbe, 0xefbe, 0xffde, 0xfe72, 0xdd8e, 0x3165,
-  0x2104, 0xe73c, 0xffff, 0xffdf, 0xffdf, 0xff9d, 0xfe52, 0xfe30,
-  0xfe52, 0xff9d, 0xefbe, 0x85f5, 0xef7d, 0xf75c, 0x85b3, 0xdefb,
-  0x2104, 0xe73c, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffde, 0xffbe,
-  0xffbe, 0xffdf, 0xffdf, 0xef7d, 0xfd55, 0xfd75, 0xef9d, 0xffff,
-  0x18e4, 0xe71c, 0xef5d, 0xe73d, 0xf7be, 0xffdf, 0xef7d, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffdf, 0xff9e, 0xe6fc, 0xe71c, 0xbdd6,
-  0x3187, 0xc618, 0x3187, 0x39c8, 0xd6ba, 0xc618, 0x39e8, 0xd6ba,
-  0xef5d, 0xef5d, 0xef5d, 0xffff, 0xef7e, 0x4249, 0x3187, 0x3165,
-  0xc618, 0xce79, 0x2946, 0xc5f7, 0xd6ba, 0x2966, 0x0842, 0x18e4,
-  0x2104, 0x18e4, 0x3186, 0xdedb, 0xef5d, 0xd6ba, 0xd679, 0xd52e,
-  0x2104, 0x18e4, 0x2105, 0xce39, 0x3187, 0x0842, 0x0862, 0x0842,
-  0x0842, 0x0842, 0x0862, 0x18e4, 0x2104, 0x2125, 0x2105, 0x20e3,
-  0x0842, 0x0842, 0x0862, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3187, 0xe73d, 0xffff, 0xffff, 0xffdf, 0xffbd, 0xedd0, 0x3144,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xe73d, 0xffdf, 0xffdf, 0xffdf, 0xffbe, 0xfe73, 0xfe10, 0xd54f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xff9c, 0xfe31, 0xfe31,
-  0xdd6f, 0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0xffff, 0xffdf, 0xffff, 0xffff, 0xffdf, 0xffbe, 0xfe52, 0xfe30,
-  0xfe51, 0xd54e, 0x2945, 0x0842, 0x0842, 0x0862, 0x18c3, 0x0862,
-  0xffff, 0xffdf, 0xef5d, 0xe73d, 0xffdf, 0xffff, 0xffbe, 0xffbe,
-  0xff9d, 0xe71b, 0xd6ba, 0x3187, 0x18c4, 0x3144, 0xc4ee, 0x20e3,
-  0xffde, 0xc638, 0x2966, 0x39c7, 0xc618, 0xef5d, 0xffff, 0xffff,
-  0xffdf, 0xe71c, 0xffde, 0xdf1c, 0xe71b, 0xedf1, 0xdd8e, 0x3165,
-  0xd69a, 0x2945, 0x18c4, 0xb575, 0x2945, 0x2966, 0xdedb, 0xffff,
-  0xffdf, 0xffdf, 0xefbe, 0x85f5, 0xf77d, 0xf75c, 0x85b3, 0xdf3c,
-  0xd6ba, 0x2966, 0x18e4, 0xc639, 0x3186, 0x0841, 0x2966, 0xdedb,
-  0xffff, 0xffff, 0xffdf, 0xef7d, 0xfd55, 0xfd55, 0xef7d, 0xef7d,
-  0x3187, 0xb5b6, 0x18e4, 0x2966, 0xb5b7, 0x1904, 0x0021, 0x2966,
-  0xdedb, 0xffdf, 0xffdf, 0xffff, 0xffbe, 0xff9e, 0xdedb, 0x3187,
-  0x0862, 0x1904, 0x0862, 0x0862, 0x1904, 0x0862, 0x0862, 0x0842,
-  0x2966, 0xef5d, 0xffdf, 0xef5d, 0xef7d, 0xef5d, 0x3186, 0x0842,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0842,
-  0x18c4, 0xdedb, 0xef5d, 0x2986, 0x3187, 0xd6ba, 0x2104, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x3187, 0xdedb, 0x18e4, 0x18e4, 0xd6bb, 0x2105, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e4, 0xc639, 0x3186, 0x18e4, 0xc639, 0x3166, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xb5b7, 0x1904, 0x2945, 0xb46c, 0x20e3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x1904, 0x0862, 0x0862, 0x18c3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18c3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6ba, 0xef1b, 0xd54e, 0x2924,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffde, 0xfe93, 0xfe30, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e4, 0xd6ba, 0xffff, 0xffdf, 0xff9c, 0xfe30, 0xfe31,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0042, 0x18e4, 0xef5d, 0xffff, 0xffdf, 0xffbe, 0xfe52, 0xfe30,
-  0xfe72, 0xdeba, 0x2966, 0x2924, 0xc4ee, 0x18c3, 0x0842, 0x0862,
-  0x18c3, 0x3187, 0xef5d, 0xffff, 0xffdf, 0xffdf, 0xffbe, 0xffbd,
-  0xffbe, 0xefbe, 0xe73c, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xd54e, 0xd699, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xefbe, 0x85f4, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x3186, 0xd6bb, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xef7d, 0xf555, 0xfd55, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0842, 0x3186, 0xef5d, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xff9e, 0xff9e, 0xef5d, 0x3187, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x1904, 0x18c3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2966, 0xd6ba, 0xef1b, 0xd54e, 0x2924,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xdedb, 0xffde, 0xfe72, 0xfe30, 0xdd6f,
-  0x2924, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c4, 0xd6ba, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe51,
-  0xdd6f, 0x2945, 0x0842, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x3165, 0xef5d, 0xffff, 0xffbe, 0xfe31, 0xfe31, 0xfe31,
-  0xfe72, 0xdeba, 0x2966, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x2924, 0xc50f, 0xffbe, 0xffdf, 0xffbe, 0xfe52, 0xfe51, 0xff9c,
-  0xffbe, 0xffff, 0xd6ba, 0x41c6, 0xc4cd, 0x18c3, 0x0842, 0x0862,
-  0xdd4d, 0x5a69, 0xef5d, 0xffff, 0xffff, 0xffbe, 0xffbe, 0xffdf,
-  0xffdf, 0xefbe, 0xffbe, 0xee11, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0xedcf, 0xd699, 0xe73d, 0xf7be, 0xef5d, 0xffdf, 0xffff, 0xffdf,
-  0xef9e, 0x85f4, 0xef5d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x20e3, 0x2104, 0x31a7, 0xd6ba, 0x4229, 0xe73c, 0xef5d, 0xffdf,
-  0xffdf, 0xef7d, 0xfd55, 0xfd55, 0xef7d, 0xd6db, 0x18e4, 0x0842,
-  0x0842, 0x0021, 0x18e4, 0xc618, 0x4209, 0xc618, 0x528b, 0xd6ba,
-  0xffdf, 0xffdf, 0xe6fb, 0xef1c, 0xef5d, 0x41e7, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x4229, 0xbdf8, 0x4229,
-  0xef5d, 0xef7d, 0x3187, 0x2987, 0xef3c, 0xd54f, 0x18c3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4,
-  0x0862, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0042, 0x18e4, 0xc638,
-  0x31a7, 0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x18c3, 0x3165, 0xef5d,
-  0xdf3c, 0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x2924, 0xd54f, 0xedb0, 0xedf1, 0xef7d,
-  0x8615, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862,
-  0x0842, 0x0842, 0x18c3, 0xd54f, 0xfe51, 0xfe72, 0xffbd, 0xffdf,
-  0xef7d, 0xfd55, 0xfd75, 0xf79e, 0xdefb, 0x1904, 0x0842, 0x0862,
-  0x18e3, 0x0842, 0x18c3, 0xedf1, 0xffbd, 0xffbe, 0xffff, 0xffff,
-  0xffdf, 0xff9e, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x3144, 0x2986, 0xe71b, 0xef7d, 0xffdf, 0xef5d, 0xef5d,
-  0xffff, 0xef5d, 0x3187, 0x18e4, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3144, 0xc4cd, 0xd6ba, 0xe73d, 0x52ab, 0xc659, 0x4208, 0x2966,
-  0xdedb, 0xef5d, 0x2965, 0x0841, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x31a7, 0xef5d, 0xd6ba, 0x4209, 0xbe18, 0x18e4,
-  0x2966, 0xef3c, 0xdd6f, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x18c3, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c3, 0xb46c, 0x2924, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x3144, 0xd52d, 0xedd0, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18c3, 0xedd0, 0xfe51, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18e4, 0xd699, 0xffbe, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x85f5,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0042, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xb48d, 0x39a5, 0xd52e, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4cc, 0x41a5, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4cd, 0x41c6, 0xedb0, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2945, 0xc638, 0xffbd, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x31a7, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x85f5,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ce, 0x18e3, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e4, 0xd54f, 0x18c3, 0x18a3, 0xedd0, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ac, 0x3144, 0x2986, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x2924, 0xd54e, 0xef3c, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e3, 0x0862, 0x0042, 0x18c3, 0xedcf, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x3144, 0x18c3, 0x3186, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3165, 0xd50d, 0xedaf, 0xef3b, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xe71c, 0xe73c,
-  0xe71b, 0xedf1, 0xe58f, 0x2924, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd69a, 0xbdd7, 0xbdf7,
-  0xff9d, 0xff7c, 0xbdb6, 0x9cd3, 0x18c4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6bb, 0xf7be, 0xf77d,
-  0xfd55, 0xfd55, 0xf79e, 0xd6ba, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0842, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x3186, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18e3, 0x18c3, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3144, 0xc4ee, 0xd52d, 0x2924, 0xd52e, 0xfe31, 0xfe51, 0xffbe,
-  0xffff, 0xe73d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x41c6, 0xc4cd, 0x41e6, 0xedb0, 0xfe52, 0xff9c, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0x0862, 0x2925, 0xc638, 0xffbd, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xd6bb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x3187, 0xef5d, 0xffff, 0xffdf, 0xffff,
-  0xe75d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x18c3, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c3, 0xb48d, 0x2944, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x3144, 0xd54f, 0xedd0, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18c3, 0xedd0, 0xfe51, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18e4, 0xd699, 0xffbe, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18c3, 0x2924, 0xd52f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18c3, 0xd52d, 0xedd0, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x20e3, 0xedd0, 0xfe51, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18e4, 0xd699, 0xffbe, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x85f5,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0042, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xb48d, 0x39a5, 0xd52e, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4cc, 0x41a5, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4cd, 0x41c6, 0xedb0, 0xfe52, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2945, 0xc638, 0xffbd, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x31a7, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x85f5,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ce, 0x18e3, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e4, 0xd54f, 0x18c3, 0x18a3, 0xedd0, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0xc4ac, 0x3144, 0x2986, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x2924, 0xd54e, 0xef3c, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xdf3c,
-  0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xf7be, 0x8615,
-  0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xdedb, 0xffdf, 0xef7d,
-  0xfd55, 0xfd55, 0xf79d, 0xdefb, 0x1904, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x2986, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x18c3, 0xd54f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e3, 0x0862, 0x0042, 0x18c3, 0xedcf, 0xfe72, 0xff9d, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x3144, 0x18c3, 0x3186, 0xef3c, 0xffde, 0xffdf, 0xffdf,
-  0xffdf, 0xdedb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3165, 0xd50d, 0xedaf, 0xef3b, 0xffdf, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862,
-  0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7,
-  0x18c4, 0x3144, 0xc4ee, 0x18e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xe71c, 0xe73c,
-  0xe71b, 0xedf1, 0xe58f, 0x2924, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd69a, 0xbdd7, 0xbdf7,
-  0xff9d, 0xff5c, 0xbdb6, 0x9cd3, 0x18c4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6bb, 0xf7be, 0xf77d,
-  0xfd55, 0xfd55, 0xf79e, 0xd6ba, 0x18e4, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x0842, 0x0862, 0x0842, 0x39c7, 0xef3c, 0xffff,
-  0xff9e, 0xff9e, 0xdedb, 0x3186, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x18c3, 0x18c3, 0x0862, 0x2924, 0xd54f, 0xfe52, 0xffbe,
-  0xffff, 0xef5d, 0x3186, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3144, 0xc4cd, 0xd52d, 0x2924, 0xd52f, 0xfe31, 0xfe52, 0xffbe,
-  0xffff, 0xe73d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0xc4ee, 0x41c5, 0xc4cd, 0x41e6, 0xedb0, 0xfe52, 0xff9c, 0xffdf,
-  0xffff, 0xef5d, 0x18e4, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x20e3, 0x0862, 0x2925, 0xc638, 0xffbd, 0xffbe, 0xffdf, 0xffdf,
-  0xffdf, 0xd6bb, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0842, 0x3187, 0xef5d, 0xffff, 0xffdf, 0xffff,
-  0xe75d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0862, 0x0842, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4,
-  0xc638, 0x31a7, 0x18c4, 0x3144, 0xc4ee, 0x18c3, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0842, 0x2966,
-  0xef5d, 0xdf3c, 0xe71b, 0xedf1, 0xdd8f, 0x2945, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18a3, 0x2945, 0xdedb,
-  0xefbe, 0x8615, 0xf77d, 0xf75c, 0x85d3, 0xce9a, 0x2104, 0x0842,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x2924, 0xd54f, 0xedf1, 0xffde,
-  0xffff, 0xef7d, 0xfd75, 0xfd75, 0xf79d, 0xdefb, 0x1904, 0x0842,
-  0x0862, 0x0862, 0x18a3, 0x18c3, 0xd54f, 0xfe72, 0xffbd, 0xffdf,
-  0xffdf, 0xffdf, 0xef1c, 0xef1c, 0xdedb, 0x2986, 0x0862, 0x0862,
-  0x0842, 0x20e3, 0xc4ee, 0x3144, 0xe5d0, 0xffbd, 0xffdf, 0xffdf,
-  0xffff, 0xef7d, 0x3187, 0x18e4, 0x18e4, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4ee, 0x41e7, 0xe71b, 0xffff, 0xffdf, 0xffdf,
-  0xffdf, 0xdebb, 0x2945, 0x0841, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xd54f, 0xffde, 0xffff, 0xffff, 0xffff,
-  0xef5d, 0x4208, 0xc4ac, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862,
-  0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x18e4, 0x0862, 0x0842, 0x0862, 0x18c3, 0x0862,
-  0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e4, 0xc638, 0x31a7, 0x18c4, 0x3144, 0xc4ce, 0x20e3,
-  0x3144, 0xb48d, 0x18e3, 0x0842, 0x0842, 0x0842, 0x0842, 0x0842,
-  0x0842, 0x2966, 0xef5d, 0xdf3c, 0xe71b, 0xedf1, 0xdd8e, 0x3165,
-  0xdd6f, 0x3144, 0x0842, 0x0842, 0x18c3, 0x18c3, 0x18c3, 0x18c3,
-  0x2945, 0xdedb, 0xefbe, 0x85f5, 0xf77d, 0xf75c, 0x85b3, 0xdf3c,
-  0xdd4e, 0x3144, 0x18e4, 0x2945, 0xd54e, 0xedd0, 0xe5b0, 0xe5b0,
-  0xedd1, 0xffde, 0xffff, 0xef9d, 0xfd75, 0xfd75, 0xef7d, 0xef7d,
-  0x2924, 0xc4cd, 0xd6ba, 0xef5d, 0xff9d, 0xfe72, 0xfe31, 0xfe72,
-  0xffbd, 0xffdf, 0xffdf, 0xef5d, 0xeefc, 0xef1c, 0xdebb, 0x3187,
-  0x0862, 0x18c3, 0x31a7, 0xef5d, 0xffff, 0xffbe, 0xffde, 0xffbe,
-  0xef7d, 0xffdf, 0xef5d, 0x3a08, 0x18e4, 0x2105, 0x18e4, 0x0862,
-  0x0862, 0x0042, 0x18c3, 0xbdd6, 0xffdf, 0xffff, 0xef5d, 0xd6bb,
-  0x4209, 0xe71c, 0xc5d7, 0x9cb2, 0x2124, 0x0842, 0x0842, 0x0862,
-  0x0862, 0x0842, 0x18c3, 0xad34, 0xf79e, 0xdedb, 0x4208, 0x18c4,
-  0x18e4, 0xc638, 0x39e8, 0x2945, 0xac4e, 0x18c3, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x2946, 0xad34, 0x4209, 0xc618, 0x18e4,
-  0x0842, 0x3187, 0xc618, 0x2104, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x2924, 0xb48d, 0x18e3, 0x0842, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x20e3, 0xc4ee, 0x3165, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862, 0x0842, 0x0842,
-  0x0862, 0x0842, 0x20e3, 0xd52d, 0x20e3, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18e4, 0xc638, 0x31a7, 0x18e4, 0x18c3,
-  0x0862, 0x0842, 0x20e3, 0xd54e, 0x20e3, 0x0042, 0x0842, 0x0842,
-  0x0842, 0x0842, 0x0842, 0x2966, 0xef5d, 0xdf3c, 0xe71b, 0xe5f1,
-  0x0862, 0x0842, 0x2104, 0xc618, 0x31a7, 0x18e4, 0x18c3, 0x18c3,
-  0x18c3, 0x18c3, 0x2945, 0xdedb, 0xefbe, 0x8df5, 0xf77d, 0xff9d,
-  0x0862, 0x0862, 0x0862, 0x2966, 0xc659, 0xe73c, 0xe5d1, 0xe5b0,
-  0xe5b0, 0xe5b0, 0xedf1, 0xffde, 0xffff, 0xef7d, 0xfd75, 0xfd35,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x3187, 0xef7d, 0xffbd, 0xfe72,
-  0xfe31, 0xfe72, 0xffbd, 0xffdf, 0xffff, 0xffff, 0xef1c, 0xeefc,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xe71c, 0xffff, 0xffbe,
-  0xffde, 0xffde, 0xffdf, 0xffff, 0xffdf, 0xdedb, 0x3187, 0x1904,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c4, 0xbdb6, 0xef5d, 0xffdf,
-  0xef5d, 0xef5d, 0xffdf, 0xef5d, 0xb575, 0x39a7, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xad13, 0x39e8, 0xce59,
-  0x4209, 0x31a7, 0xdedb, 0x3186, 0x2125, 0x9451, 0x2945, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c4, 0x9cb2, 0x2125, 0x2966,
-  0xad76, 0x3186, 0xc618, 0x3186, 0x0842, 0x2945, 0xa44d, 0x18e3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2945, 0x9cb2, 0x18e4,
-  0x18e4, 0x0862, 0x3187, 0xc638, 0x2104, 0x0842, 0x18e3, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18c3, 0xb48d, 0x2944, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x3145, 0xc4ee, 0x20e3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c3, 0xd52d, 0x20e3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x20e3, 0xd52e, 0x20e3, 0x0042,
-  0x0842, 0x0842, 0x0842, 0x0042, 0x18e4, 0xc638, 0x31a7, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xdeba, 0x31a7, 0x18c3,
-  0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x3186, 0xef5d, 0xdf3c, 0xe75d,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6db, 0xef3c, 0xe5d1,
-  0xe5b0, 0xe5b0, 0xe5b0, 0xe5d0, 0xef3c, 0xef9e, 0x8df5, 0xef7d,
-  0x0000, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef7d, 0xffbd,
-  0xfe72, 0xfe31, 0xfe72, 0xffbd, 0xffff, 0xffdf, 0xef9d, 0xfdb5,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x2925, 0xe73c, 0xffff,
-  0xffde, 0xffbe, 0xffde, 0xffdf, 0xffff, 0xffff, 0xef5d, 0xef1c,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c4, 0xad13, 0xc5d6, 0xe73c,
-  0xef5d, 0xffdf, 0xef5d, 0xffdf, 0xef7d, 0xdedb, 0x39e8, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xad14, 0x2946, 0x18e4,
-  0x3187, 0xce59, 0x52ab, 0xc638, 0x3186, 0x2945, 0x8c51, 0x2925,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xad13, 0x18e4, 0x0041,
-  0x0842, 0x2966, 0xce59, 0x4209, 0x0842, 0x0842, 0x2945, 0x9cb2,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xad14, 0x18e4, 0x0842,
-  0x0842, 0x18e4, 0xef5d, 0xd6db, 0x18e4, 0x0842, 0x0862, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c3, 0xb48d, 0x3144, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x3144, 0xbcad, 0x2944,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x3144, 0xc4cc,
-  0x20e3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x20e3, 0xd54e,
-  0x20e3, 0x0042, 0x0842, 0x0842, 0x0842, 0x0042, 0x18e4, 0xd69a,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xdeba,
-  0x31a7, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x3186, 0xef5d,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6bb,
-  0xef3c, 0xe5d0, 0xe5b0, 0xe5b0, 0xe5b0, 0xe5d0, 0xef3b, 0xffdf,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x3186,
-  0xef7d, 0xffbd, 0xfe72, 0xfe31, 0xfe72, 0xffbd, 0xffff, 0xffdf,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18c4,
-  0xd6bb, 0xffff, 0xffbe, 0xffbd, 0xffde, 0xffdf, 0xffdf, 0xffdf,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2966, 0xe73c, 0xffff, 0xffdf, 0xef5d, 0xffdf, 0xffff, 0xffdf,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x2125, 0xb555, 0xef5d, 0xe73d, 0x528b, 0xef5d, 0xef3c, 0xc5d6,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18c4,
-  0x8c51, 0x2125, 0x2966, 0xe73c, 0xef5d, 0xd6ba, 0x2966, 0x18c3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18e4, 0x0842, 0x18e4, 0xef5d, 0xf79e, 0x3187, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x18c3, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18c3,
-  0xb48d, 0x2944, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x3145, 0xc4ee, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x20c3, 0xd52d, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x20e3, 0xd54e, 0x20e3, 0x0042, 0x0842, 0x0842, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x2105, 0xdeba, 0x31a7, 0x18c3, 0x18c3, 0x18c3, 0x18c3, 0x18c3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x18e4, 0xd6bb, 0xef3c, 0xe5d0, 0xe5b0, 0xe5b0, 0xe5b0, 0xe5b0,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x3186, 0xef7d, 0xffbd, 0xfe72, 0xfe31, 0xfe72, 0xffbd,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18c4, 0xd6bb, 0xffdf, 0xffbe, 0xffde, 0xffde, 0xffff,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xef5d, 0xffdf, 0xe75d, 0xe75d, 0xef5d,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x18e4, 0xe73c, 0xb596, 0x39c7, 0x2104, 0x2104,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0842, 0x2104, 0xc638, 0x4a6a, 0x8c30, 0x10c3, 0x0041,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x3186, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2924, 0xb48d, 0x18e3, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x18e3, 0xc4ee, 0x3165, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x20e3, 0xd52d, 0x20e3, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x20e3, 0xd54e, 0x20e3, 0x0042, 0x0842, 0x0842, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0842, 0x2104, 0xc618, 0x31a7, 0x18e4, 0x18c3, 0x18c3, 0x18e3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x2966, 0xce59, 0xe73c, 0xe5d1, 0xe5b0, 0xe5b0,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x3187, 0xef7d, 0xffbd, 0xfe72, 0xfe51,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18e4, 0xe73c, 0xffff, 0xffbe, 0xffde,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18e4, 0xe73c, 0xef7d, 0xf7be, 0xef5d,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2105, 0xd6bb, 0x4208, 0xa4d3, 0x39e8,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x2104, 0xc638, 0x3186, 0x2125, 0x9c92,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x3187, 0xc638, 0x2104, 0x18c4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0842, 0x18c3, 0xb48d, 0x2944, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x3145, 0xc4ee, 0x20e3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x20c3, 0xd52d, 0x20e3, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x20e3, 0xd54e, 0x20e3, 0x0042,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xdeba, 0x31a7, 0x18c3,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6bb, 0xef3c, 0xe5d1,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x2966, 0xef5d, 0xffde,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x2966, 0xef5d, 0xffff,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18e4, 0xd6ba, 0xef5d, 0xef5d,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xdedb, 0x31a7, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xd6ba, 0x2104, 0x0021,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x2105, 0xd6ba, 0x2125, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18c3, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0842, 0x18c3, 0xb48d, 0x3144, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x3144, 0xb48d, 0x3144,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x3144, 0xd52d,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x18e3, 0xedaf,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x2104, 0xef1b,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842, 0x1904, 0xd6ba,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x18e4,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0842,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation catAnimation = {
-  .name = "Cat",
-  .frameCount = 45,
-  .width = 16,
-  .height = 16,
-  .frameDurations = catDurations,
-  .animationFrames = catFrames
-};
-#endif // ANIMATION_CAT_H
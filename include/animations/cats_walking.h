@@ -1,1814 +0,0 @@
-// cats_walking.h - Auto-generated from cats_walking.json
-#ifndef ANIMATION_CATS_WALKING_H
-#define ANIMATION_CATS_WALKING_H
-
-#include "animation_types.h"
-
-// Frame Durations for cats_walking (in 100ms units)
-static const uint8_t PROGMEM cats_walkingDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for cats_walking
-static const uint16_t PROGMEM cats_walkingFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x58c2, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x89c4, 0xdc68, 0x58c2,
-  0x0000, 0x0000, 0x58c2, 0x58c2, 0x58c2, 0x58c2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x89c4, 0xfd8d, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x58c2, 0xfd8d, 0x58c2, 0xfd8d, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x89c4, 0xdc68, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x58c2, 0x58c2, 0xc365, 0xb2ce, 0xfd8d, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x89c4, 0xfd8d, 0x58c2, 0x0000,
-  0x0000, 0x58c2, 0xc365, 0xdc68, 0xdc68, 0xb2ce, 0xdc68, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x58c2, 0xfd8d, 0x58c2, 0x0000,
-  0x0000, 0x58c2, 0xdc68, 0x01a9, 0x9fe0, 0xdc68, 0xfd8d, 0x89c4,
-  0x58c2, 0x58c2, 0x58c2, 0x58c2, 0x89c4, 0xdc68, 0x58c2, 0x0000,
-  0x58c2, 0xb2ce, 0xdc68, 0x01a9, 0xe7e9, 0xfd8d, 0xc365, 0xdc68,
-  0xc365, 0xfd8d, 0xc365, 0xdc68, 0x89c4, 0xc365, 0x89c4, 0x0000,
-  0x31c7, 0xe75d, 0xe75d, 0xdc68, 0xdc68, 0xfd8d, 0xdc68, 0xfd8d,
-  0xdc68, 0xfd8d, 0xdc68, 0xfd8d, 0xc365, 0xdc68, 0x58c2, 0x0000,
-  0x0000, 0x31c7, 0xc65a, 0xe75d, 0xe75d, 0xc365, 0x89c4, 0xfd8d,
-  0xdc68, 0xfd8d, 0xdc68, 0xfd8d, 0xfd8d, 0xfd8d, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x31c7, 0x31c7, 0xc65a, 0x89c4, 0xfd8d, 0xdc68,
-  0x89c4, 0xc65a, 0xc65a, 0xdc68, 0xfd8d, 0x58c2, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x58c2, 0xdc68, 0x58c2, 0xfd8d, 0x58c2,
-  0x31c7, 0x31c7, 0x31c7, 0x58c2, 0xfd8d, 0x58c2, 0xc365, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x58c2, 0x89c4, 0x58c2, 0xfd8d, 0x58c2,
-  0x0000, 0x0000, 0x58c2, 0xfd8d, 0xdc68, 0x58c2, 0x89c4, 0x58c2,
-  0x0000, 0x0000, 0x58c2, 0x89c4, 0x58c2, 0x58c2, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x58c2, 0x58c2, 0x58c2, 0x58c2, 0x89c4, 0x58c2,
-  0x0000, 0x0000, 0x58c2, 0x58c2, 0x58c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x58c2, 0x58c2, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x7183, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x81c4, 0xcbc7, 0x5102, 0x0000,
-  0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x8a04, 0xe4cb, 0x6123, 0x0000,
-  0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000,
-  0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb, 0x5923, 0x0000,
-  0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6122,
-  0x0800, 0x0000, 0x0000, 0x0800, 0x6143, 0xdccb, 0x5923, 0x0000,
-  0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224,
-  0x5902, 0x5903, 0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000,
-  0x5103, 0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf58c, 0xcbc7, 0xd428,
-  0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x79a3, 0x0820,
-  0x39e7, 0xc618, 0xdeba, 0xd4ab, 0xdcea, 0xed0c, 0xdc89, 0xed2c,
-  0xdc88, 0xed4c, 0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6102, 0x0000,
-  0x0041, 0x3a28, 0xadb7, 0xd6ba, 0xd679, 0xa2a7, 0xe4eb, 0xdc68,
-  0xc386, 0xdc89, 0xdc68, 0xf56d, 0xf54c, 0xe4eb, 0x5903, 0x0000,
-  0x0000, 0x0020, 0x31a7, 0x4a6a, 0xad55, 0x9246, 0xd428, 0xbb45,
-  0x9246, 0xb534, 0xcc08, 0xed2c, 0xc3a7, 0xbb46, 0x5902, 0x0800,
-  0x0000, 0x0000, 0x0020, 0x48c2, 0x81c5, 0x79c4, 0xdcab, 0x6963,
-  0x3166, 0x3a07, 0xc3e8, 0xe50c, 0x7163, 0x81a3, 0x8183, 0x58e2,
-  0x0000, 0x0000, 0x0000, 0x1020, 0x6123, 0xd46a, 0xcc08, 0x50e2,
-  0x0020, 0x0820, 0x71c4, 0xdccb, 0x6123, 0x50c2, 0x60e2, 0x89a3,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0x7983, 0x6943, 0x50e2, 0x0820,
-  0x0000, 0x50e2, 0xcc4a, 0xcc08, 0x5902, 0x1000, 0x48c2, 0x81a3,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0x60e2, 0x50a2, 0x0800, 0x0000,
-  0x0000, 0x50c2, 0x6923, 0x6102, 0x50c2, 0x0000, 0x0820, 0x50c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x7983, 0x79a3, 0x1020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xcbe7, 0x5902, 0x0000, 0x0000,
-  0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xe4cb, 0x6123, 0x0000, 0x0000,
-  0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000, 0x0000,
-  0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000,
-  0x58e2, 0xb305, 0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800,
-  0x0000, 0x0000, 0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000,
-  0x6943, 0xbbc7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902,
-  0x5903, 0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000,
-  0xb32e, 0xc42a, 0x3288, 0xcee9, 0xf58c, 0xcbe7, 0xd428, 0xc386,
-  0xe4cb, 0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000,
-  0xd67a, 0xdeba, 0xccab, 0xdca9, 0xf54c, 0xdc68, 0xe4eb, 0xdc68,
-  0xf54c, 0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6122, 0x0000, 0x0000,
-  0x4269, 0xadb7, 0xd658, 0xdcaa, 0xed2c, 0xc366, 0xa2a6, 0xc3c8,
-  0xed6d, 0xdc89, 0xed4c, 0xf56d, 0xe4cb, 0x5903, 0x0800, 0x0000,
-  0x0021, 0x31a7, 0x5268, 0xd448, 0xdc28, 0x9245, 0xad35, 0xb5b7,
-  0xb596, 0xbb87, 0xdc88, 0xed0c, 0x9225, 0x60e2, 0x48a2, 0x0000,
-  0x0000, 0x0820, 0x79c4, 0xd428, 0xb325, 0x6123, 0x4208, 0x3a08,
-  0x31c7, 0x5943, 0xc3c7, 0xc386, 0x6922, 0x8183, 0x50c2, 0x0000,
-  0x0000, 0x0000, 0x6123, 0xdccb, 0x6963, 0x60e2, 0x79a3, 0x50e2,
-  0x0800, 0x1020, 0x71c4, 0xdcab, 0x6943, 0x8183, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x5903, 0xcc6b, 0x6123, 0x7983, 0x81a3, 0x48c2,
-  0x0800, 0x50e2, 0xcc4a, 0xcbe8, 0x6123, 0x7983, 0x48c2, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0x5903, 0x1020, 0x50c2, 0x58c2, 0x0820,
-  0x0000, 0x50c2, 0x6923, 0x6102, 0x58c2, 0x50c2, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x7183, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x81c4, 0xcbc7, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x5903, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x8a04, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x6123, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x6102, 0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0xbb46, 0xbbe7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0xc408, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903,
-  0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000,
-  0xcc4a, 0x3288, 0xcee9, 0xf58c, 0xcbe7, 0xd428, 0xc386, 0xe4cb,
-  0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000, 0x0000,
-  0xdeba, 0xccab, 0xdca9, 0xf54c, 0xdc48, 0xed2b, 0xe488, 0xf54c,
-  0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6122, 0x0000, 0x0000, 0x0000,
-  0xb619, 0xd658, 0xdcca, 0xe4eb, 0xa285, 0xd469, 0xdcca, 0xed6e,
-  0xdc89, 0xf54c, 0xf56d, 0xe4cb, 0x5903, 0x0000, 0x0000, 0x0000,
-  0x31e8, 0x5269, 0xdcec, 0xc386, 0x8a25, 0xad55, 0xb5d7, 0xb596,
-  0xb3a7, 0xd428, 0xed2c, 0x9a65, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x79a4, 0xdc48, 0xb325, 0x6123, 0x41e8, 0x3a08, 0x3a08,
-  0x41c6, 0x6963, 0xcbe7, 0xbb46, 0x58e2, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x6984, 0xd46a, 0x6143, 0x50c2, 0x7983, 0x5902, 0x58e2,
-  0x79a4, 0x8183, 0x79e4, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x5923, 0xc40a, 0x6963, 0x0800, 0x0800, 0x50c2, 0x7983, 0x58e2,
-  0x50c2, 0x6123, 0xcc6a, 0xcc08, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x58e2, 0x6123, 0x50c2, 0x0000, 0x0000, 0x0820, 0x58c2, 0x50c2,
-  0x1020, 0x50c2, 0x6923, 0x6102, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x8204, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000,
-  0x5923, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x81c4, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0xcc6a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x89e4, 0xd428, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbbe7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000,
-  0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1a68, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2,
-  0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2248, 0xcec9, 0xf58c, 0xcbe7, 0xd428, 0xc386, 0xe4cb, 0xc386,
-  0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000, 0x0000, 0x0862,
-  0xcc8a, 0xdcc9, 0xf56d, 0xed2c, 0xf54c, 0xdc89, 0xf54c, 0xe489,
-  0xed2b, 0xcbc7, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000, 0x0862,
-  0xd678, 0xf58e, 0xed4c, 0xcbc7, 0xed4d, 0xdccb, 0xed6e, 0xdc88,
-  0xe4a9, 0xf54c, 0xd448, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5269, 0xe50c, 0xdc48, 0x9245, 0xb575, 0xb5d7, 0xb596, 0xbba7,
-  0xed0b, 0xfdae, 0xed2c, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x5903, 0xd428, 0xbb25, 0x6123, 0x39e7, 0x31e8, 0x39c7, 0x6143,
-  0xbb66, 0xe50c, 0xe50c, 0xcc08, 0x50e2, 0x0000, 0x0000, 0x0000,
-  0x71a4, 0xdcab, 0x7163, 0x7963, 0x50c2, 0x0020, 0x0000, 0x50c2,
-  0x81a3, 0x6923, 0x71a4, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0xdcab, 0xcbe8, 0x6102, 0x50c2, 0x48a2, 0x0000, 0x0000, 0x48a2,
-  0x50c2, 0x50a2, 0x89c4, 0xd46b, 0x5903, 0x0000, 0x0000, 0x0000,
-  0x6943, 0x6102, 0x50c2, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0x58e2, 0x6103, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x8204, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x81c4, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x6963, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x89e4, 0xd428, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbb26, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd468, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x6143, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0862,
-  0xaf42, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x5902,
-  0x58e2, 0x9204, 0xcc07, 0x6122, 0x0000, 0x0000, 0x0000, 0x0863,
-  0xdf49, 0xed8c, 0xcbc7, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7,
-  0x9a44, 0xcbe7, 0xbb45, 0x7983, 0x0800, 0x0000, 0x0862, 0x18c4,
-  0xdcea, 0xed4c, 0xdc89, 0xed2c, 0xe488, 0xf54c, 0xe489, 0xed2b,
-  0xcbc7, 0xd428, 0x6143, 0x1020, 0x0000, 0x0000, 0x1063, 0x2928,
-  0xde99, 0xc3e8, 0xed2c, 0xdc69, 0xdcaa, 0xed6e, 0xdc88, 0xdc89,
-  0xf54d, 0xe50c, 0x5903, 0x0000, 0x0000, 0x0000, 0x0000, 0x1063,
-  0xb576, 0x71c5, 0xdccb, 0x9aa6, 0xb575, 0xb5b6, 0xbb87, 0xdc48,
-  0xf56d, 0xed4d, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x81e5, 0x6943, 0xdccb, 0x8a05, 0x39e7, 0x31c7, 0x6123, 0xbb25,
-  0xd448, 0xe50c, 0xcc08, 0x50e2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x58c2, 0x7184, 0xdccb, 0x6143, 0x0000, 0x0820, 0x58e2, 0x89c4,
-  0x6102, 0x6963, 0xd46b, 0x6984, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x6123, 0xcc4a, 0xcc08, 0x50e2, 0x0800, 0x48a2, 0x8183, 0x81a3,
-  0x50c2, 0x1000, 0x6963, 0xcc2a, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x58c2, 0x6923, 0x5902, 0x0820, 0x0000, 0x50c2, 0x60e2, 0x58e2,
-  0x50c2, 0x0800, 0x50a2, 0x6923, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1040, 0x8204, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x81c4, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000, 0x0862,
-  0xdcac, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x89e4, 0xd428, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862,
-  0xbb4e, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0xbb0d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x6143, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0862, 0x18a5,
-  0xdc69, 0xe4eb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x5902, 0x58e2,
-  0x9204, 0xcc07, 0x6122, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149,
-  0xed4c, 0xcbe7, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9a44,
-  0xcbe7, 0xbb45, 0x7983, 0x0800, 0x0000, 0x0862, 0x20e5, 0x4a2d,
-  0xed4c, 0xdc89, 0xed4c, 0xdc89, 0xf54c, 0xe489, 0xed2c, 0xcbc7,
-  0xd428, 0x6143, 0x1020, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d,
-  0xcbc7, 0xed4c, 0xed4c, 0xcba7, 0xed4d, 0xdcca, 0xed4c, 0xf56d,
-  0xe50c, 0x5903, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149,
-  0xbb66, 0xed4c, 0xdc48, 0x9245, 0xb576, 0xb596, 0xbba8, 0xd448,
-  0xe50c, 0x5923, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x6963, 0xe4ec, 0xbb46, 0x5902, 0x31c7, 0x3a08, 0x41c6, 0x6963,
-  0xcc08, 0x6102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x71a4, 0xdcab, 0x6943, 0x0800, 0x0820, 0x50e2, 0x7984, 0x6943,
-  0xd44a, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdcab, 0xcbe8, 0x50e2, 0x0800, 0x48a2, 0x8183, 0x81a3, 0x50e2,
-  0x5903, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6943, 0x5902, 0x0820, 0x0000, 0x50c2, 0x60e2, 0x50c2, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x8204,
-  0xbb67, 0x5102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x81c4, 0xdc8b,
-  0x6963, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083,
-  0x5902, 0x0820, 0x0000, 0x0000, 0x0000, 0x0800, 0x89e4, 0xd428,
-  0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39cb,
-  0xdcab, 0x5903, 0x0000, 0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb,
-  0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5,
-  0xd449, 0x6123, 0x0800, 0x0000, 0x0000, 0x0800, 0x6123, 0xdcab,
-  0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb,
-  0xe4eb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x58e2, 0x6923, 0xc3c7,
-  0x6122, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x48c2,
-  0xcba6, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9224, 0xbb45,
-  0x81a3, 0x0820, 0x0000, 0x0000, 0x0862, 0x18e5, 0x4a0c, 0x48e2,
-  0xdc89, 0xed4c, 0xdc89, 0xf54c, 0xe489, 0xed2c, 0xcbc7, 0xcc08,
-  0x6122, 0x0000, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d,
-  0xf56d, 0xed4d, 0xc3a7, 0xed4d, 0xdcca, 0xed4c, 0xf56d, 0xe50c,
-  0x5923, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x316a,
-  0xd448, 0xed0c, 0xa2a6, 0xb575, 0xb596, 0xbba8, 0xd448, 0xe50c,
-  0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1063, 0x1083,
-  0x6143, 0xcbe7, 0xcc08, 0x6985, 0x41e8, 0x41a6, 0x79e4, 0xdccb,
-  0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084,
-  0x0800, 0x6963, 0xdccb, 0x6943, 0x7983, 0x6143, 0xd46a, 0xcc08,
-  0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x0000, 0x5903, 0xd46b, 0x6943, 0x8183, 0x58e2, 0x5923, 0x5902,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x0800, 0x50c2, 0x6123, 0x58c2, 0x58e2, 0x50c2, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x50e2,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x8204, 0xbb67,
-  0x5102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x81c4, 0xdc8b, 0x6963,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x89e4, 0xd428, 0x5902,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x1084,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0800, 0x6143, 0xdccb, 0x6123,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x528c,
-  0x89c4, 0x6102, 0x5903, 0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x5142, 0xe641,
-  0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x81a3,
-  0x0820, 0x0000, 0x0000, 0x0862, 0x18e5, 0x41ec, 0x5943, 0xdd48,
-  0xf54c, 0xe489, 0xf54c, 0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6122,
-  0x0000, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x526d,
-  0xf54c, 0xdc69, 0xed6d, 0xdcca, 0xf56d, 0xf56d, 0xdccb, 0x5903,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x316a, 0x318a,
-  0xcbe7, 0x9286, 0xb576, 0xb5b6, 0xd46a, 0xe50c, 0x7184, 0x58e2,
-  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18a4, 0x41ec,
-  0x6103, 0x3186, 0x31e8, 0x39e8, 0x79e5, 0xdccb, 0x6963, 0xa2a4,
-  0x50e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4, 0x318a,
-  0x48a2, 0x0820, 0x0000, 0x5903, 0xd46a, 0xcc08, 0x6923, 0x89c3,
-  0x58e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a4, 0x41ec,
-  0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x6102, 0x58e2, 0x8183,
-  0x50c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39cb, 0x18c4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x50a2, 0x58c2, 0x50c2,
-  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x7183, 0x1020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x81c4, 0xcbc7, 0x5902, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x8a04, 0xe4cb, 0x6123, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x18c5, 0x39eb,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x18e5,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x6143, 0xdccb, 0x6123, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x20e5,
-  0x58e2, 0x5903, 0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x5942, 0xd5c2, 0x4a09,
-  0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820,
-  0x0000, 0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x5a8d,
-  0xdc68, 0xed4c, 0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6122, 0x0000,
-  0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x526d, 0x39ab,
-  0xc386, 0xdc89, 0xdc68, 0xf56d, 0xf54c, 0xe4eb, 0x5903, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x318a, 0x4a2e, 0x4a2d,
-  0x8a46, 0xb534, 0xcc08, 0xed2c, 0xc3a7, 0xbb46, 0x6102, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x420c, 0x398a,
-  0x3186, 0x4207, 0xc3e8, 0xe50c, 0x7163, 0x81a3, 0x81a3, 0x50c2,
-  0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3169, 0x2107,
-  0x0020, 0x0820, 0x71c4, 0xdccb, 0x6123, 0x50c2, 0x60e2, 0x8183,
-  0x50c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a4, 0x41ec, 0x10a4,
-  0x0000, 0x50e2, 0xcc4a, 0xcc08, 0x5902, 0x1000, 0x48c2, 0x8183,
-  0x58c2, 0x0000, 0x0000, 0x0000, 0x1083, 0x39cb, 0x3169, 0x1083,
-  0x0800, 0x50c2, 0x6923, 0x6102, 0x50c2, 0x0000, 0x0820, 0x58c2,
-  0x50c2, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084, 0x1083, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x7983, 0x79a3, 0x1020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xcbe7, 0x5902, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xe4cb, 0x6123, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x18a4,
-  0x0000, 0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x20e6, 0x41ec,
-  0x0000, 0x0000, 0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x316a,
-  0x5923, 0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9, 0x314a,
-  0xe4ec, 0xc386, 0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000,
-  0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128,
-  0xf56d, 0xe489, 0xed2c, 0xcbc7, 0xd408, 0x6122, 0x0000, 0x0000,
-  0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x524d, 0x398a, 0x316a,
-  0xed8e, 0xdc89, 0xed4c, 0xf56d, 0xe4cb, 0x5903, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x1083, 0x3149, 0x316a, 0x316a, 0x2128, 0x422d,
-  0xb596, 0xbba7, 0xdc88, 0xed0c, 0x9225, 0x60e2, 0x48a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x1084, 0x2928, 0x18a5, 0x4a2d,
-  0x39c7, 0x5943, 0xc3c7, 0xc386, 0x6922, 0x8183, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1063, 0x10a4, 0x1084, 0x4a2d,
-  0x0000, 0x1020, 0x71c4, 0xdcab, 0x6943, 0x8183, 0x58c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x10a4, 0x1063, 0x18c5, 0x420d,
-  0x0000, 0x50e2, 0xcc4a, 0xcbe8, 0x6123, 0x7983, 0x50c2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x0862, 0x1083, 0x39cb, 0x316a,
-  0x0800, 0x50c2, 0x6923, 0x6102, 0x58c2, 0x50c2, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x7183, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x81c4, 0xcbc7, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x8a04, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x89e4, 0xd408, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000,
-  0x0000, 0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083,
-  0x0000, 0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1084,
-  0x58e2, 0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5,
-  0xbb66, 0xcbe7, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000, 0x0000,
-  0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128, 0x3169,
-  0xdc88, 0xed2c, 0xcbc7, 0xd408, 0x6122, 0x0000, 0x0000, 0x0000,
-  0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x526d, 0x318a, 0x318a, 0x4a2d,
-  0xdc68, 0xf54c, 0xf56d, 0xe4cb, 0x5903, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x3149, 0x316a, 0x316a, 0x2128, 0x4a2d, 0x4a4e,
-  0xb366, 0xd448, 0xed2c, 0x9a65, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1063, 0x1084, 0x2107, 0x2127, 0x4a2d, 0x398a,
-  0x41c6, 0x6963, 0xcbe7, 0xbb46, 0x58e2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0863, 0x10a4, 0x10a4, 0x10a4, 0x420d, 0x2128,
-  0x81a4, 0x8183, 0x79e4, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x10a4, 0x1063, 0x0863, 0x18c5, 0x41ec, 0x10a4,
-  0x50c2, 0x6123, 0xcc6a, 0xcc08, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x0862, 0x0000, 0x1083, 0x39cb, 0x3169, 0x1083,
-  0x0800, 0x50c2, 0x6923, 0x6102, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x8204, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x79c4, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x89e4, 0xd428, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000,
-  0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000,
-  0x0800, 0x6143, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000,
-  0x5902, 0x89e4, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083,
-  0xcc08, 0x9a44, 0xbb45, 0x81a3, 0x0820, 0x0000, 0x0000, 0x0862,
-  0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128, 0x316a, 0x4a0d,
-  0xed2c, 0xcbc7, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000, 0x1063,
-  0x3149, 0x4a2d, 0x4a2d, 0x526d, 0x318a, 0x318a, 0x4a2d, 0x4a2e,
-  0xe4a9, 0xed4c, 0xd448, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x3149, 0x316a, 0x316a, 0x2128, 0x420d, 0x4a2e, 0x2148,
-  0xed4c, 0xf58d, 0xed2c, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x1083, 0x2107, 0x2107, 0x316a, 0x420d, 0x18e6,
-  0xc3a6, 0xe4ec, 0xe50c, 0xcc08, 0x50e2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0863, 0x10a5, 0x0863, 0x1083, 0x3149, 0x316a,
-  0x89c4, 0x6923, 0x71a4, 0xdccb, 0x6123, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x10a4, 0x0863, 0x0000, 0x0000, 0x10a4, 0x422d,
-  0x50c2, 0x50a2, 0x89c4, 0xd46b, 0x5903, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x10a4, 0x1063, 0x0000, 0x0000, 0x0000, 0x1083, 0x420c,
-  0x0000, 0x0820, 0x58e2, 0x6103, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x8204, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x79c4, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x89e4, 0xd428, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x81e4, 0xe4cb, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000, 0x0000,
-  0x0800, 0x6143, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000,
-  0x58e2, 0x9204, 0xcc07, 0x6122, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x3148, 0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083,
-  0x9204, 0xcbe7, 0xbb45, 0x7983, 0x0800, 0x0000, 0x0862, 0x18e5,
-  0x41ec, 0x5942, 0xd508, 0x526d, 0x2128, 0x316a, 0x420d, 0x4a2d,
-  0xc386, 0xd428, 0x6143, 0x1020, 0x0000, 0x0000, 0x1063, 0x3149,
-  0x4a2d, 0x4a2d, 0x526d, 0x318a, 0x3169, 0x4a2d, 0x4a4e, 0x4a4e,
-  0xf56d, 0xe50c, 0x5903, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x3149, 0x316a, 0x316a, 0x2107, 0x2107, 0x420d, 0x398a, 0x422d,
-  0xf58d, 0xed2d, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x1084, 0x2107, 0x18e6, 0x41ec, 0x3169, 0x18c5, 0x2107,
-  0xd448, 0xe50c, 0xcc08, 0x50e2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x2928, 0x18a4, 0x420c, 0x10a4, 0x0862, 0x0863,
-  0x6102, 0x6963, 0xd46b, 0x6984, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1063, 0x10a5, 0x10a4, 0x39eb, 0x1083, 0x0000, 0x0000,
-  0x48a2, 0x1020, 0x6963, 0xcc2a, 0x5902, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x10a4, 0x1063, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x50a2, 0x0800, 0x50a2, 0x6923, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x50e2, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1040, 0x81e4, 0xbb67, 0x5102, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x8a04, 0xdc8b, 0x6963, 0x0800, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9204, 0xd408, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9204, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x6963, 0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0862, 0x18c5,
-  0x41eb, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x9224, 0xcbe7, 0x6122, 0x0000, 0x0000, 0x0000, 0x1083, 0x3148,
-  0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083, 0x1083,
-  0xd427, 0xbb45, 0x7983, 0x0800, 0x0000, 0x0862, 0x18e5, 0x41ec,
-  0x5942, 0xd508, 0x526d, 0x2928, 0x316a, 0x4a0d, 0x4a2d, 0x4a2d,
-  0xd428, 0x6143, 0x1020, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d,
-  0x4a2d, 0x524d, 0x398a, 0x422d, 0x4a2d, 0x4a2e, 0x4a4e, 0x4a4e,
-  0xe50c, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149,
-  0x316a, 0x3149, 0x18e6, 0x420d, 0x318a, 0x2128, 0x316a, 0x316a,
-  0xe50c, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1063,
-  0x1084, 0x18e6, 0x18c5, 0x316a, 0x2107, 0x18c5, 0x2107, 0x2128,
-  0xd448, 0x6122, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x10a4, 0x18c5, 0x41ec, 0x10a4, 0x0862, 0x1083, 0x2928,
-  0xdcab, 0x6123, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x39cb, 0x3169, 0x1063, 0x0000, 0x0020, 0x10a4,
-  0x5903, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x10a4, 0x1084, 0x1063, 0x0000, 0x0000, 0x1083, 0x39cb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5902, 0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbb87, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5902, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083,
-  0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39ab,
-  0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5,
-  0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb,
-  0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x5942,
-  0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1063,
-  0x7983, 0x0820, 0x0000, 0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942,
-  0xd508, 0x5a8d, 0x2949, 0x316a, 0x4a0d, 0x4a2d, 0x420d, 0x318a,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d,
-  0x526d, 0x4a4e, 0x422d, 0x420d, 0x4a2e, 0x4a4e, 0x4a4e, 0x4a4e,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x316a,
-  0x318a, 0x420d, 0x2128, 0x18e6, 0x2948, 0x420d, 0x39ab, 0x4a2d,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x3149, 0x3169, 0x18c5, 0x18e6, 0x2949, 0x3169, 0x2107, 0x316a,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4,
-  0x3169, 0x2107, 0x1083, 0x1083, 0x1083, 0x1063, 0x1083, 0x2948,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084,
-  0x41ec, 0x10a4, 0x1063, 0x10a4, 0x0863, 0x0000, 0x0020, 0x10a4,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x39cb, 0x1084, 0x10a4, 0x10a4, 0x0862, 0x0000, 0x1083, 0x39cb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x1083, 0x0020, 0x0863, 0x0863, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5,
-  0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5,
-  0x2106, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b,
-  0x2106, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2,
-  0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1083, 0x18a5,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508,
-  0x5a8d, 0x2949, 0x316a, 0x420d, 0x4a2d, 0x420d, 0x318a, 0x316a,
-  0x0000, 0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x526d,
-  0x4a4e, 0x420d, 0x4a2d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x316a, 0x398b,
-  0x420d, 0x2107, 0x316a, 0x4a2d, 0x4a2d, 0x398a, 0x4a2d, 0x4a4e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18a4, 0x41ec,
-  0x2128, 0x10a5, 0x2107, 0x3169, 0x3169, 0x2107, 0x316a, 0x4a2d,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a4, 0x316a,
-  0x2107, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1084, 0x2949,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a4, 0x39cb,
-  0x1084, 0x0862, 0x10a4, 0x1063, 0x1063, 0x10a4, 0x10a4, 0x18a4,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39cb, 0x10a4,
-  0x0000, 0x0000, 0x0863, 0x10a4, 0x1063, 0x0863, 0x1084, 0x39cb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x0862, 0x0000, 0x0863, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18a5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x420d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb,
-  0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x4a2d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106,
-  0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x4a2d,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106,
-  0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x420d,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9,
-  0x2949, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1063, 0x18c5, 0x3169,
-  0x0000, 0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d,
-  0x2949, 0x316a, 0x420d, 0x4a2d, 0x420d, 0x318a, 0x3169, 0x2128,
-  0x0000, 0x0000, 0x1063, 0x3149, 0x4a2d, 0x4a2d, 0x526d, 0x39ab,
-  0x420d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2d, 0x4a2d, 0x318a,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x3149, 0x318a, 0x4a2e, 0x420d,
-  0x2948, 0x4a2d, 0x4a4e, 0x4a2d, 0x318a, 0x39ab, 0x4a2e, 0x4a4e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x420c, 0x318a,
-  0x18c5, 0x3149, 0x316a, 0x3169, 0x2128, 0x420d, 0x4a4e, 0x4a4e,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x316a, 0x2107,
-  0x1083, 0x1083, 0x1063, 0x1063, 0x1083, 0x2128, 0x420d, 0x4a2d,
-  0x48a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a4, 0x41ec, 0x10a4,
-  0x1084, 0x0863, 0x0000, 0x0000, 0x0863, 0x10a5, 0x10a4, 0x1084,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x1083, 0x39cb, 0x3169, 0x1083,
-  0x0863, 0x0862, 0x0000, 0x0000, 0x0862, 0x0863, 0x0863, 0x1084,
-  0x50c2, 0x0800, 0x0000, 0x0000, 0x0863, 0x1084, 0x1083, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18a5,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x420d,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x4a2d,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x4a2d,
-  0x0000, 0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x420d,
-  0x0000, 0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9, 0x2949,
-  0x18c5, 0x1083, 0x1083, 0x1083, 0x1063, 0x1063, 0x18c5, 0x3169,
-  0x0000, 0x0862, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128,
-  0x316a, 0x4a0d, 0x4a2d, 0x420d, 0x318a, 0x3169, 0x3149, 0x2107,
-  0x0000, 0x0863, 0x3149, 0x4a2d, 0x4a2d, 0x524d, 0x398a, 0x318a,
-  0x4a0d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x4a2d, 0x316a, 0x1084,
-  0x0000, 0x0000, 0x1083, 0x3149, 0x316a, 0x316a, 0x2128, 0x420d,
-  0x318a, 0x318a, 0x4a0d, 0x318a, 0x398a, 0x4a4e, 0x420d, 0x1084,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x1084, 0x2928, 0x18a5, 0x420c,
-  0x18e6, 0x2107, 0x3149, 0x2107, 0x316a, 0x4a2e, 0x4a2d, 0x18a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1063, 0x10a4, 0x1084, 0x420c,
-  0x18c5, 0x0863, 0x1063, 0x1083, 0x2107, 0x316a, 0x420c, 0x318a,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x10a4, 0x1063, 0x18c5, 0x41ec,
-  0x1084, 0x0000, 0x0000, 0x1063, 0x10a5, 0x1083, 0x18a4, 0x41ec,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x0862, 0x1083, 0x39cb, 0x3169,
-  0x0863, 0x0000, 0x0862, 0x10a4, 0x10a4, 0x0862, 0x0000, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x1083,
-  0x0000, 0x0000, 0x0862, 0x1063, 0x1063, 0x0862, 0x0000, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x41ec,
-  0x0000, 0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec, 0x18c5,
-  0x0000, 0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x1084,
-  0x0000, 0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x10a4,
-  0x0000, 0x0862, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x41ec, 0x10a4,
-  0x0000, 0x1083, 0x3148, 0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5,
-  0x1083, 0x1083, 0x1083, 0x1063, 0x1063, 0x18c5, 0x2949, 0x1084,
-  0x0863, 0x18e5, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128, 0x316a,
-  0x4a0d, 0x4a2d, 0x420d, 0x318a, 0x3169, 0x3149, 0x2107, 0x10a4,
-  0x1063, 0x2949, 0x4a2d, 0x4a2d, 0x526d, 0x318a, 0x318a, 0x4a2d,
-  0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x318a, 0x1083, 0x0000,
-  0x0000, 0x1083, 0x3149, 0x316a, 0x316a, 0x2128, 0x4a2d, 0x4a2d,
-  0x2949, 0x420d, 0x39ab, 0x4a2d, 0x4a4e, 0x420d, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x1063, 0x1084, 0x2107, 0x2127, 0x4a2d, 0x316a,
-  0x18c6, 0x2949, 0x2107, 0x2107, 0x316a, 0x420d, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0863, 0x10a4, 0x10a4, 0x10a4, 0x420d, 0x2107,
-  0x1063, 0x1063, 0x1063, 0x1083, 0x1084, 0x3169, 0x1083, 0x0000,
-  0x0000, 0x0862, 0x10a4, 0x1063, 0x0863, 0x18c5, 0x41ec, 0x10a4,
-  0x0000, 0x0000, 0x1063, 0x10a4, 0x1084, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0862, 0x0862, 0x0000, 0x1083, 0x39cb, 0x3169, 0x0863,
-  0x0000, 0x0862, 0x10a4, 0x10a4, 0x0863, 0x1083, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0863, 0x10a4, 0x1083, 0x0000,
-  0x0000, 0x0862, 0x1083, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0862, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec, 0x18a4, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x39ab, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000,
-  0x0863, 0x18c5, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x41ec, 0x1083, 0x0000, 0x0000,
-  0x1083, 0x3128, 0x5942, 0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083,
-  0x1083, 0x1083, 0x1063, 0x1084, 0x2949, 0x1083, 0x0000, 0x0000,
-  0x20e6, 0x41ec, 0x5942, 0xd508, 0x526d, 0x2128, 0x316a, 0x4a0d,
-  0x4a2d, 0x420d, 0x318a, 0x3169, 0x2107, 0x10a4, 0x0000, 0x0000,
-  0x3169, 0x4a2d, 0x4a2d, 0x526d, 0x318a, 0x318a, 0x4a2d, 0x4a4e,
-  0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x316a, 0x1083, 0x0000, 0x0000,
-  0x1084, 0x3149, 0x316a, 0x316a, 0x2128, 0x420d, 0x4a2e, 0x2948,
-  0x420d, 0x398b, 0x4a2d, 0x4a4e, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x1083, 0x2107, 0x2107, 0x316a, 0x420d, 0x18e6,
-  0x2107, 0x2107, 0x2107, 0x316a, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0863, 0x10a5, 0x0863, 0x1083, 0x3149, 0x3169,
-  0x1084, 0x1083, 0x1063, 0x18c5, 0x41ec, 0x1084, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x10a4, 0x0863, 0x0000, 0x0000, 0x10a4, 0x41ec,
-  0x10a4, 0x1084, 0x1084, 0x39cb, 0x3169, 0x1063, 0x0000, 0x0000,
-  0x0863, 0x10a4, 0x1063, 0x0000, 0x0000, 0x0000, 0x1083, 0x39cb,
-  0x10a4, 0x1084, 0x1063, 0x1083, 0x1063, 0x0862, 0x0000, 0x0000,
-  0x0863, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0863, 0x1083,
-  0x1063, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x0862, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x39cb, 0x1083, 0x0000, 0x0000,
-  0x0863, 0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a5, 0x41ec, 0x18a4, 0x0000, 0x0000, 0x0000,
-  0x1084, 0x39aa, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x1063, 0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x18c6, 0x41eb, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1084, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x3149, 0x5142, 0xd5e2, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083,
-  0x1083, 0x1063, 0x18c5, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x4a0d, 0x5943, 0xd508, 0x526d, 0x2128, 0x316a, 0x420d, 0x4a2d,
-  0x420d, 0x318a, 0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0000,
-  0x4a2e, 0x4a2d, 0x526d, 0x318a, 0x3169, 0x4a2d, 0x4a4e, 0x4a4e,
-  0x4a4e, 0x4a4e, 0x4a2d, 0x316a, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x3169, 0x316a, 0x316a, 0x2107, 0x2107, 0x420d, 0x398a, 0x420d,
-  0x39aa, 0x4a2d, 0x4a4e, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x1063, 0x1084, 0x2107, 0x18e6, 0x41ec, 0x3169, 0x18c5, 0x2107,
-  0x2107, 0x316a, 0x420d, 0x18c5, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1063, 0x2928, 0x18a4, 0x420c, 0x10a4, 0x0862, 0x0863,
-  0x1063, 0x18c5, 0x41ec, 0x10a4, 0x18e6, 0x0863, 0x0000, 0x0000,
-  0x0000, 0x0863, 0x10a5, 0x10a4, 0x39eb, 0x1083, 0x0000, 0x0000,
-  0x1083, 0x39cb, 0x3169, 0x1083, 0x10a5, 0x1063, 0x0000, 0x0000,
-  0x0863, 0x10a4, 0x1063, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x1083, 0x1083, 0x1063, 0x10a4, 0x0862, 0x0000, 0x0000,
-  0x0863, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0862, 0x1063, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18a5, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39cb, 0x18a5, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x18c5, 0x2106, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a0c, 0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1084, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5941, 0xd5c2, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083, 0x1083,
-  0x1063, 0x18c5, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x5921, 0xd509, 0x526d, 0x2928, 0x316a, 0x4a0d, 0x4a2d, 0x420d,
-  0x318a, 0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x2968,
-  0x4a2d, 0x524d, 0x398a, 0x422d, 0x4a2d, 0x4a2e, 0x4a4e, 0x4a4e,
-  0x4a4e, 0x4a2e, 0x316a, 0x1083, 0x0000, 0x0000, 0x0020, 0x2968,
-  0x316a, 0x3149, 0x18e6, 0x420d, 0x318a, 0x2128, 0x316a, 0x318a,
-  0x4a2e, 0x4a4e, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x1084, 0x18e6, 0x18c5, 0x316a, 0x2107, 0x18c5, 0x18e7, 0x2928,
-  0x420d, 0x2128, 0x2107, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x10a4, 0x18c5, 0x41ec, 0x10a4, 0x0862, 0x1083, 0x2949,
-  0x420d, 0x10a4, 0x10a4, 0x10a4, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x39cb, 0x3169, 0x1063, 0x0000, 0x0000, 0x18c5,
-  0x41ec, 0x10a4, 0x0862, 0x1083, 0x10a4, 0x0862, 0x0000, 0x0000,
-  0x0863, 0x10a4, 0x1084, 0x1063, 0x0000, 0x0000, 0x1083, 0x39cb,
-  0x3169, 0x1063, 0x0000, 0x0862, 0x10a4, 0x0863, 0x0000, 0x0000,
-  0x0863, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x1083, 0x0862, 0x0000, 0x0000, 0x0863, 0x0862, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1084, 0x10a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0863, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1084, 0x39cb, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x20e6, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x526b, 0x2106, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1084, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x2968,
-  0xe642, 0x41e9, 0x2949, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1063,
-  0x18c5, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0841, 0x39a9,
-  0xdd89, 0x5a6d, 0x2949, 0x316a, 0x4a0d, 0x4a2d, 0x420d, 0x318a,
-  0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x3989, 0xa2ef,
-  0x526d, 0x4a4e, 0x422d, 0x420d, 0x4a2e, 0x4a4e, 0x4a4e, 0x4a4e,
-  0x4a2d, 0x316a, 0x1083, 0x0000, 0x0000, 0x0000, 0x39ca, 0xb597,
-  0x318a, 0x420d, 0x2128, 0x18e6, 0x2948, 0x420d, 0x398b, 0x4a2d,
-  0x4a4e, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca,
-  0x316a, 0x3169, 0x18c5, 0x18e6, 0x2949, 0x3169, 0x2107, 0x318a,
-  0x420d, 0x18e6, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x316a, 0x2107, 0x1083, 0x1083, 0x1083, 0x1063, 0x1083, 0x2948,
-  0x2928, 0x1083, 0x10a4, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x420d, 0x10a4, 0x1063, 0x10a4, 0x0863, 0x0000, 0x0000, 0x18c5,
-  0x41ec, 0x10a4, 0x10a4, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x41ec, 0x1084, 0x10a4, 0x10a4, 0x0862, 0x0000, 0x1083, 0x39cb,
-  0x3169, 0x1083, 0x10a4, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x0020, 0x0863, 0x0863, 0x0000, 0x0000, 0x0863, 0x1084,
-  0x1083, 0x0863, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5,
-  0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x2968,
-  0x41ec, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5,
-  0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3189,
-  0x2106, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5,
-  0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x31aa,
-  0x18c5, 0x3169, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6bd2,
-  0x316a, 0x3149, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1063, 0x18c5,
-  0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x420b, 0xbe19,
-  0x4a2d, 0x2949, 0x316a, 0x420d, 0x4a2d, 0x420d, 0x318a, 0x316a,
-  0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x3189, 0xa350, 0xe71c,
-  0x4a4e, 0x420d, 0x4a2d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2d,
-  0x316a, 0x1083, 0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d,
-  0x420d, 0x2107, 0x316a, 0x4a2d, 0x4a2d, 0x398a, 0x4a2d, 0x4a4e,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f8,
-  0x2127, 0x10a5, 0x2107, 0x3169, 0x3169, 0x2107, 0x316a, 0x420d,
-  0x18e6, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x39ea,
-  0x18e6, 0x1083, 0x1083, 0x1083, 0x1083, 0x1083, 0x1084, 0x2949,
-  0x2107, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x31aa,
-  0x0863, 0x0863, 0x10a4, 0x1063, 0x1063, 0x10a4, 0x10a4, 0x18c5,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6371,
-  0x0000, 0x0000, 0x0863, 0x10a4, 0x1063, 0x0863, 0x1084, 0x39cb,
-  0x3169, 0x1063, 0x0000, 0x0000, 0x0000, 0x0020, 0x2968, 0x31ca,
-  0x0000, 0x0000, 0x0000, 0x0863, 0x0862, 0x0000, 0x0863, 0x1084,
-  0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5,
-  0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec,
-  0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420d,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xbe19,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420c,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x52ad,
-  0x316a, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x41ec,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xbe39,
-  0x3149, 0x18c5, 0x1083, 0x1083, 0x1083, 0x1063, 0x18c5, 0x3149,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x228c,
-  0x2128, 0x316a, 0x420d, 0x4a2d, 0x420d, 0x318a, 0x316a, 0x2107,
-  0x10a4, 0x0000, 0x0000, 0x0020, 0x3189, 0xab70, 0xce9a, 0x22ac,
-  0x420d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2d, 0x4a2d, 0x316a,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c,
-  0x2928, 0x4a2d, 0x4a4e, 0x4a2d, 0x318a, 0x39ab, 0x4a4e, 0x422d,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc67a,
-  0x18c5, 0x3149, 0x316a, 0x3169, 0x2128, 0x420d, 0x4a4e, 0x4a2d,
-  0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x39c9, 0x420b,
-  0x1083, 0x1083, 0x1063, 0x1063, 0x1083, 0x2128, 0x420d, 0x4a0d,
-  0x3169, 0x1063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x31aa,
-  0x10a4, 0x0863, 0x0000, 0x0000, 0x0863, 0x10a5, 0x1084, 0x18c5,
-  0x41ec, 0x1084, 0x0000, 0x0000, 0x0000, 0x0821, 0x39ca, 0x6371,
-  0x0863, 0x0862, 0x0000, 0x0000, 0x0862, 0x0863, 0x0862, 0x18c5,
-  0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6350, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0863,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb, 0x31aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5,
-  0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec,
-  0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x3189,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420d,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x4a4c,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420c,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x5ace, 0x73f3,
-  0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x41ec,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xbe59, 0xd73a,
-  0x18a5, 0x1084, 0x1083, 0x1083, 0x1063, 0x1063, 0x18c5, 0x3149,
-  0x1083, 0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f43,
-  0x318a, 0x420d, 0x4a2d, 0x420d, 0x318a, 0x3169, 0x3149, 0x2107,
-  0x1084, 0x0000, 0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2a,
-  0x4a2d, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x4a2d, 0x318a, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c, 0xe75c,
-  0x316a, 0x318a, 0x4a0d, 0x318a, 0x398a, 0x4a4e, 0x422d, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc67a, 0xc69b,
-  0x18c5, 0x2107, 0x3149, 0x2107, 0x316a, 0x4a2e, 0x4a2d, 0x10a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x31c9, 0x4a6c, 0xa577,
-  0x10a4, 0x1063, 0x1063, 0x1083, 0x2107, 0x316a, 0x420d, 0x3169,
-  0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x39ea, 0xb5f9,
-  0x0863, 0x0000, 0x0000, 0x1063, 0x10a5, 0x1083, 0x18a4, 0x39cb,
-  0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x39eb, 0x73d2,
-  0x0862, 0x0000, 0x0862, 0x10a4, 0x10a4, 0x0862, 0x0000, 0x10a4,
-  0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6330, 0x3a0b,
-  0x0000, 0x0000, 0x0862, 0x1063, 0x1063, 0x0862, 0x0000, 0x0862,
-  0x10a4, 0x0863, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb, 0x31aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x39cb,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec, 0x18a4,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420d, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xc619,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd3, 0xb350,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1084, 0x41ec, 0x1083,
-  0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbb70,
-  0x1083, 0x1083, 0x1083, 0x1063, 0x1063, 0x18c5, 0x3149, 0x1083,
-  0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f25, 0xe73a,
-  0x4a2d, 0x4a2d, 0x420d, 0x318a, 0x3169, 0x3149, 0x2107, 0x1084,
-  0x0000, 0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xef9c,
-  0x4a2e, 0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x318a, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xdf1c, 0xe73b, 0xc69b,
-  0x2148, 0x420d, 0x39ab, 0x4a2d, 0x4a4e, 0x420d, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc67a, 0xc65a, 0x8454,
-  0x18c5, 0x2949, 0x2107, 0x2107, 0x316a, 0x420d, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x31c9, 0x4a6c, 0x9516, 0x73d2,
-  0x0863, 0x1063, 0x1063, 0x1083, 0x1084, 0x3169, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x3189, 0x6b91, 0x528d,
-  0x0000, 0x0000, 0x1063, 0x10a4, 0x1084, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x4a4c, 0xbe19,
-  0x0000, 0x0862, 0x10a4, 0x10a4, 0x0863, 0x1083, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3189, 0x6330, 0x4a4c,
-  0x0000, 0x0862, 0x1083, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb, 0x31aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec, 0x18a4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdb8, 0x528c,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xd69b,
-  0x0000, 0x0000, 0x0000, 0x1083, 0x41ec, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xce7a,
-  0x1083, 0x1083, 0x1063, 0x1084, 0x2949, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf1a, 0xc69b,
-  0x4a2d, 0x4a0d, 0x318a, 0x3169, 0x2107, 0x10a4, 0x0000, 0x0000,
-  0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9,
-  0x4a4e, 0x4a4e, 0x4a4e, 0x4a2e, 0x316a, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c, 0xe75c, 0xe75d, 0xdf3d,
-  0x4a2d, 0x398a, 0x4a2d, 0x4a4e, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x422b, 0xb5f9, 0xc65a, 0xcebb, 0xdf1c, 0xadd8,
-  0x2107, 0x2107, 0x2107, 0x316a, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x31c9, 0x52ad, 0xbe5a, 0xc67a, 0x7c13,
-  0x1063, 0x1083, 0x1063, 0x18c5, 0x41ec, 0x1084, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x6371, 0xc67a, 0x9d36, 0x420b,
-  0x1063, 0x10a4, 0x1084, 0x39cb, 0x3169, 0x1063, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x424b, 0xce9a, 0x4a8d, 0x39ca,
-  0x1063, 0x10a4, 0x1063, 0x1083, 0x1063, 0x0862, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x420a, 0xbe18, 0x422b, 0x6350,
-  0x0863, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x31a9, 0x39ea, 0x0862, 0x31aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1083, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18c5, 0x39cb, 0x1083, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18a5, 0x41ec, 0x18a4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdb8, 0x528c,
-  0x0000, 0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xd69b,
-  0x0000, 0x0000, 0x0000, 0x1084, 0x41ec, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xce7a,
-  0x1083, 0x1083, 0x1063, 0x18c5, 0x3149, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf1a, 0xc69b,
-  0x4a2d, 0x4a0d, 0x318a, 0x316a, 0x2107, 0x10a4, 0x0000, 0x0000,
-  0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9,
-  0x4a4e, 0x4a4e, 0x4a4e, 0x4a2d, 0x316a, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c, 0xe75c, 0xe75d, 0xdefc,
-  0x4a2d, 0x398a, 0x4a2d, 0x4a4e, 0x41ec, 0x1083, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x422b, 0xb5f9, 0xc65a, 0xcebb, 0xd6fc, 0x8495,
-  0x2107, 0x2107, 0x316a, 0x420d, 0x18c5, 0x0863, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x31c9, 0x52ad, 0xd6bb, 0xadb8, 0x73d3,
-  0x0863, 0x1063, 0x18c5, 0x41ec, 0x10a4, 0x18e6, 0x0863, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x6370, 0xc67a, 0x9d16, 0x422c,
-  0x0000, 0x1083, 0x39cb, 0x3169, 0x1083, 0x10a5, 0x1063, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x52ad, 0xbe39, 0x4a4b, 0x3189,
-  0x0000, 0x0862, 0x1083, 0x1083, 0x1063, 0x10a4, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b8, 0x4a6c, 0x0021, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x1063, 0x0863, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x31a9, 0x422c, 0x3189, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18a5, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0041,
-  0x0000, 0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xc619, 0x420b,
-  0x0000, 0x0000, 0x1084, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xbdf9, 0x4a6c,
-  0x1083, 0x1063, 0x18c5, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xbe5a, 0x7c34,
-  0x420d, 0x318a, 0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0020,
-  0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a,
-  0x4a2e, 0x4a4e, 0x4a2e, 0x316a, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x39c9, 0xb5b8, 0xe75d, 0xdf1c, 0xe75c, 0xcedb, 0xdf1c, 0xe75d,
-  0x318a, 0x4a2e, 0x4a4e, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x422b, 0xb5f9, 0xc67a, 0xe75d, 0xdf1c, 0xb5d9, 0xe73d,
-  0x2948, 0x420d, 0x2128, 0x2107, 0x1083, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x31a9, 0x4a8d, 0xd6db, 0xc67a, 0x7c34, 0xb619,
-  0x3169, 0x420d, 0x10a4, 0x10a4, 0x10a4, 0x0863, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xbe5a, 0x9d36, 0x424c, 0x420b,
-  0x18c5, 0x41ec, 0x10a4, 0x0862, 0x1083, 0x10a4, 0x0862, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x528c, 0xce7a, 0x52ad, 0x5b30, 0x39cb,
-  0x41ec, 0x3169, 0x1063, 0x0000, 0x0862, 0x10a4, 0x0863, 0x0000,
-  0x0000, 0x0000, 0x39ca, 0xbe19, 0xb5f8, 0x420b, 0x31a9, 0x3189,
-  0x10a4, 0x1083, 0x0862, 0x0000, 0x0000, 0x0863, 0x0862, 0x0000,
-  0x0000, 0x0020, 0x31a9, 0x422c, 0x420b, 0x3189, 0x0821, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1084, 0x10a5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000,
-  0x0000, 0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000,
-  0x0000, 0x1084, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021,
-  0x1083, 0x18c5, 0x3149, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b,
-  0x316a, 0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x3189,
-  0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc,
-  0x4a4e, 0x4a2d, 0x316a, 0x1083, 0x0000, 0x0000, 0x0000, 0x39c9,
-  0xb5b8, 0xe75d, 0xdf1c, 0xe73b, 0xcebb, 0xce9b, 0xe75d, 0xe77d,
-  0x4a2e, 0x4a4e, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x422b, 0xb5f9, 0xc67a, 0xc69b, 0xa598, 0xdf1c, 0xc69b, 0xce9b,
-  0x398a, 0x420c, 0x18e6, 0x1063, 0x0862, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x31a9, 0x4a6c, 0xadb7, 0x5ace, 0xce9b, 0x8495, 0x9d36,
-  0x3149, 0x2128, 0x1083, 0x10a4, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0842, 0x39ea, 0x6b91, 0x4a4c, 0xce9b, 0x73f2, 0x39eb,
-  0x18c5, 0x39cb, 0x10a4, 0x10a4, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x31a9, 0x6350, 0x39eb, 0x52ad, 0xce9a, 0x424b, 0x0021,
-  0x41ec, 0x3169, 0x1083, 0x10a4, 0x0862, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x2968, 0x31aa, 0x420b, 0xbe19, 0xb5f8, 0x31c9, 0x0000,
-  0x10a4, 0x1083, 0x0863, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0021, 0x3189, 0x422c, 0x39ea, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c5, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c6, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x18c6, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000,
-  0x18c5, 0x420c, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000,
-  0x10a4, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x3189,
-  0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000,
-  0x18c5, 0x2949, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a0b,
-  0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420b,
-  0x316a, 0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x3189, 0xab70,
-  0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc,
-  0x4a2d, 0x316a, 0x1083, 0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8,
-  0xe75d, 0xdf1c, 0xe73b, 0xce9b, 0xce9b, 0xe75d, 0xe75d, 0xef7e,
-  0x4a4e, 0x41ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x422b,
-  0xb5f8, 0xc67a, 0xc67b, 0xb5d9, 0xdf3d, 0xdf3d, 0xb5d9, 0xe73d,
-  0x4a0d, 0x20e6, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x39ea, 0x4a8d, 0x9d36, 0xa577, 0xdf3c, 0xc67a, 0x7c54, 0xb619,
-  0x3169, 0x2107, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821,
-  0x39ca, 0x6371, 0x6b92, 0x4a8d, 0xd6db, 0x9d36, 0x3a0b, 0x39ca,
-  0x18c5, 0x39ec, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x31a9,
-  0x6350, 0x39eb, 0x39ca, 0x52ad, 0xce9a, 0x4a6c, 0x0021, 0x0021,
-  0x41ec, 0x3169, 0x1063, 0x0000, 0x0000, 0x0000, 0x0020, 0x2968,
-  0x3189, 0x0842, 0x39ea, 0xbe19, 0xb5f8, 0x31a9, 0x0021, 0x2968,
-  0x10a4, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x3189, 0x424c, 0x39ea, 0x0841, 0x0020, 0x3189,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18e6, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x420d, 0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2968,
-  0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a2d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x39ea,
-  0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x4a2d, 0x1084, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca,
-  0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x3189, 0x73f3,
-  0xc65a, 0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000,
-  0x3169, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8,
-  0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b,
-  0x2107, 0x10a4, 0x0000, 0x0000, 0x0020, 0x3189, 0xab70, 0xce9b,
-  0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc,
-  0x3169, 0x1083, 0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d,
-  0xdf1c, 0xe73b, 0xce9b, 0xce9b, 0xe75d, 0xe75d, 0xef7d, 0xe77d,
-  0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9,
-  0xc67a, 0xc67b, 0xadd9, 0xdf3d, 0xe73d, 0xadd8, 0xdf1c, 0xcebb,
-  0x4a2d, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x31a9,
-  0x4a4c, 0x9d36, 0x9d57, 0xbe5a, 0xdf1c, 0x8495, 0x9d36, 0x9d57,
-  0x420d, 0x3169, 0x1063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x39ea, 0x6b91, 0x39eb, 0x422b, 0xb5f9, 0xbe19, 0x4a4c, 0x420b,
-  0x18c5, 0x41ec, 0x1084, 0x0000, 0x0000, 0x0000, 0x0821, 0x39ca,
-  0x6350, 0x31ca, 0x0021, 0x0021, 0x4a6c, 0xce9a, 0x4a6c, 0x6371,
-  0x18c5, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6350,
-  0x39ea, 0x0021, 0x0000, 0x0000, 0x39ea, 0xbe19, 0x4a4c, 0x6371,
-  0x1063, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb,
-  0x3189, 0x0000, 0x0000, 0x0020, 0x3189, 0x420b, 0x39ca, 0x39eb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18e6, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x420d, 0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b,
-  0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a2d, 0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7,
-  0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a2d, 0x1084, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce,
-  0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x420d, 0x1083, 0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a,
-  0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x3169, 0x1083, 0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b,
-  0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b, 0x39ea,
-  0x2107, 0x1084, 0x0000, 0x0020, 0x3189, 0xab70, 0xce9b, 0x330c,
-  0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xd6fc, 0xc67a,
-  0x0863, 0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xdf1c,
-  0xe73b, 0xce9b, 0xbe5a, 0xe75d, 0xe77d, 0xef7d, 0xe77d, 0xe77d,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc67a,
-  0xc67b, 0xa577, 0x8cb5, 0xdf1c, 0xcebb, 0xdf1c, 0xcebb, 0xe75d,
-  0x1063, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x31c9, 0x4a6c,
-  0x9d36, 0x7c54, 0xd6bb, 0xbe39, 0x7c34, 0x9d36, 0xa577, 0xbe19,
-  0x3149, 0x0863, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x39ea,
-  0xa597, 0x52ce, 0xce9a, 0x528d, 0x31a9, 0x39ca, 0x420b, 0x528d,
-  0x41ec, 0x18a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0821, 0x39eb,
-  0x6b91, 0x4a6c, 0xbe19, 0x39ea, 0x0021, 0x0021, 0x39ea, 0xbe19,
-  0x18c4, 0x39cb, 0x1083, 0x0000, 0x0000, 0x0000, 0x31a9, 0x6350,
-  0x39eb, 0x31a9, 0x39c9, 0x0841, 0x0000, 0x0000, 0x2968, 0x420b,
-  0x0863, 0x1084, 0x0863, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb,
-  0x3189, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1083, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x39eb, 0x1083, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x426c,
-  0x1083, 0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9,
-  0x39ea, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4a8d,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad,
-  0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0841, 0x4a8d,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2,
-  0xb391, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a6d,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9,
-  0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000, 0x0841, 0x31ca,
-  0x0863, 0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45,
-  0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b, 0x422b, 0x6bd2,
-  0x1084, 0x0000, 0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b,
-  0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc65a, 0xc67a,
-  0x0000, 0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xdf1c, 0xe73b,
-  0xc69b, 0xdf3d, 0xe75d, 0xe75d, 0xe75d, 0xe77d, 0xe75d, 0xe77d,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc67a, 0xbe5a,
-  0x8c95, 0xdefc, 0xcebb, 0xadb8, 0xc69a, 0xcebb, 0xe75d, 0xe75d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x31c9, 0x4a6c, 0x9516,
-  0x7413, 0xc65a, 0x9d57, 0x7413, 0x9d36, 0xb5d9, 0xdf1c, 0xad98,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x3189, 0x6371,
-  0x5b0e, 0xce7a, 0x4a6d, 0x31a9, 0x422b, 0xb5d8, 0xd6db, 0x4a6d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x424c,
-  0xc639, 0xb5f9, 0x39c9, 0x0021, 0x0842, 0x5aee, 0xce9a, 0x424c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3189, 0x6350,
-  0x4a4c, 0x39c9, 0x0841, 0x0000, 0x39c9, 0xbe19, 0xb5f8, 0x422b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3189, 0x39eb,
-  0x3189, 0x0021, 0x0000, 0x0020, 0x31a9, 0x422c, 0x420b, 0x39ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a6c, 0x5aef,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5aef, 0xd6bb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5aef, 0xdf1c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8,
-  0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xdf1c,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391,
-  0xce39, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xdf1c,
-  0x0000, 0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1,
-  0xbe19, 0x422b, 0x0021, 0x0000, 0x0000, 0x0021, 0x424c, 0xd6dc,
-  0x0000, 0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a,
-  0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b, 0x420b, 0x73f3, 0xc65a,
-  0x0000, 0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe77b,
-  0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xadd8,
-  0x0000, 0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c, 0xe75c, 0xe75d,
-  0xdf1c, 0xdf1c, 0xe75d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xcebb,
-  0x0000, 0x0000, 0x0021, 0x422b, 0xb5f9, 0xc65a, 0xcebb, 0xdf3c,
-  0xad98, 0x8495, 0xadd8, 0xdf3d, 0xcebb, 0xe75d, 0xe75d, 0xdf1d,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x31c9, 0x52ad, 0xbe5a, 0xc67a,
-  0x7c33, 0x94f6, 0xb619, 0xbe39, 0xa577, 0xcebb, 0xd6dc, 0x8454,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x6371, 0xc67a, 0x9d36,
-  0x420b, 0x422b, 0x420b, 0x39ea, 0x422b, 0xadd8, 0xa597, 0x422c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x424b, 0xce9a, 0x4a6d,
-  0x3a0b, 0x6371, 0x31aa, 0x0021, 0x0842, 0x5acd, 0xc65a, 0x424c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x420a, 0xbe18, 0x422b,
-  0x6351, 0x6b92, 0x3189, 0x0021, 0x39c9, 0xbe19, 0xb5f8, 0x422b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x31a9, 0x39ea, 0x0862,
-  0x31ca, 0x39ca, 0x0841, 0x0020, 0x31a9, 0x422c, 0x420b, 0x39ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x4a6c, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc639, 0x422b,
-  0x0000, 0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xce9b, 0x4a4c,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xce9a, 0x4a4c,
-  0x0000, 0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xce39,
-  0x39ea, 0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9a, 0x4a4c,
-  0x0000, 0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xbe19,
-  0x422b, 0x0021, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x4a4c,
-  0x0000, 0x0021, 0x4a0b, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a,
-  0x73f3, 0x422b, 0x420a, 0x420b, 0x420b, 0x7413, 0xb5f9, 0x424c,
-  0x0020, 0x3189, 0xab70, 0xce9b, 0x330c, 0xcf2b, 0xe77b, 0xb5f9,
-  0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xa577, 0x52ef,
-  0x0000, 0x39c9, 0xb5b8, 0xe75d, 0xd71c, 0xe75c, 0xe75d, 0xdefc,
-  0xe75d, 0xef7d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xbe3a, 0x422c,
-  0x0000, 0x0021, 0x422b, 0xb5f9, 0xc65a, 0xcebb, 0xd6fc, 0x8cb5,
-  0xc67a, 0xe75d, 0xe75d, 0xcebb, 0xe75d, 0xef7d, 0xce9b, 0x422b,
-  0x0000, 0x0000, 0x0021, 0x31c9, 0x52ad, 0xd6bb, 0xadb8, 0x73f3,
-  0x9d36, 0xbe39, 0xbe39, 0xa577, 0xbe39, 0xdf1c, 0x8454, 0x39eb,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x6370, 0xc67a, 0x9d16, 0x422c,
-  0x420b, 0x420b, 0x420b, 0x422c, 0x4a8d, 0xb5d8, 0x9d57, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x52ad, 0xbe39, 0x4a4b, 0x31a9,
-  0x6330, 0x3a0b, 0x39ca, 0x6351, 0x6371, 0x630f, 0xc65a, 0x4a4c,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xb5b8, 0x4a6c, 0x0021, 0x0021,
-  0x31ca, 0x6350, 0x39ea, 0x31a9, 0x422c, 0xbe19, 0xb5f8, 0x422b,
-  0x0000, 0x0000, 0x0020, 0x31a9, 0x422c, 0x3189, 0x0000, 0x0000,
-  0x0841, 0x39ca, 0x3189, 0x0862, 0x3189, 0x422c, 0x420b, 0x39ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x31a9,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5d8, 0x420b,
-  0x0000, 0x0000, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a6c, 0x0841,
-  0x0000, 0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420a, 0x0000,
-  0x0000, 0x0841, 0x39ca, 0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000,
-  0x0000, 0x3189, 0x73f3, 0xc65a, 0xd6d9, 0xbbd1, 0xbe19, 0x422b,
-  0x0021, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000,
-  0x0821, 0x420b, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3,
-  0x422b, 0x420a, 0x420b, 0x420b, 0x7413, 0xb619, 0x420b, 0x0000,
-  0x39a9, 0xa350, 0xce9b, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a,
-  0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xa598, 0x52ad, 0x0021,
-  0x39ea, 0xb5b7, 0xe75d, 0xdf1c, 0xe75c, 0xcedb, 0xdf1c, 0xe75d,
-  0xef7d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xbe5a, 0x3a0b, 0x0000,
-  0x0841, 0x422b, 0xb5f9, 0xc67a, 0xe75d, 0xdf1c, 0xb5d9, 0xe73d,
-  0xe77d, 0xe75d, 0xcebb, 0xcedb, 0xe77d, 0xd6fc, 0x39ea, 0x0000,
-  0x0000, 0x0021, 0x31a9, 0x4a8d, 0xd6db, 0xc67a, 0x7c33, 0xb619,
-  0xbe5a, 0xbe39, 0xa597, 0xdf1c, 0xef7e, 0xdf1c, 0x4a6c, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x39ea, 0xbe5a, 0x9d36, 0x424c, 0x3a0b,
-  0x39ea, 0x39ea, 0x422c, 0xa557, 0xd6db, 0xd6fc, 0xb5f8, 0x3a0b,
-  0x0000, 0x0000, 0x0021, 0x528c, 0xce7a, 0x52ad, 0x5b30, 0x31aa,
-  0x0021, 0x0021, 0x31ca, 0x6b91, 0x424c, 0x52ce, 0xce9a, 0x4a4c,
-  0x0000, 0x0000, 0x39ca, 0xbe19, 0xb5f8, 0x420b, 0x31aa, 0x2968,
-  0x0000, 0x0000, 0x2968, 0x31a9, 0x3189, 0x6b91, 0xbe39, 0x420b,
-  0x0000, 0x0020, 0x31a9, 0x422c, 0x420b, 0x3189, 0x0821, 0x0020,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x39ca, 0x39ea, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x31a9,
-  0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5d8, 0x420b,
-  0x0020, 0x2968, 0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a6c, 0x0841,
-  0x0000, 0x39ea, 0xb5b7, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420a, 0x0000,
-  0x0841, 0x31ca, 0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000,
-  0x31aa, 0x73f2, 0xc65a, 0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000,
-  0x4a2c, 0xadb8, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b,
-  0x420a, 0x420b, 0x39ea, 0x420b, 0x7413, 0xbe19, 0x420b, 0x0000,
-  0xb390, 0xce7a, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc,
-  0xdefc, 0xdefc, 0xc65a, 0xbe5a, 0xbe5a, 0x9d36, 0x4a6d, 0x0021,
-  0xbe19, 0xe73d, 0xdf1c, 0xe73b, 0xcebb, 0xce9b, 0xe73d, 0xe77d,
-  0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xc67a, 0x422b, 0x0841, 0x0000,
-  0x4a4c, 0xb5d8, 0xc67a, 0xc69b, 0xa598, 0xdf1c, 0xc69b, 0xcebb,
-  0xe73d, 0xcebb, 0xcebb, 0xe77d, 0xd6fc, 0x39ea, 0x0000, 0x0000,
-  0x0841, 0x31a9, 0x4a6c, 0xadb7, 0x5ace, 0xce9b, 0x8495, 0x9d57,
-  0xbe19, 0xa577, 0xc67a, 0xe77d, 0xdf1c, 0x4a6c, 0x0021, 0x0000,
-  0x0000, 0x0841, 0x39ea, 0x6b91, 0x4a4c, 0xce9b, 0x73f3, 0x39ea,
-  0x39ca, 0x422c, 0x9d36, 0xbe5a, 0xd6fc, 0xbe19, 0x31c9, 0x0000,
-  0x0020, 0x3189, 0x6350, 0x39eb, 0x52ad, 0xce9a, 0x424c, 0x0021,
-  0x0841, 0x39ea, 0x6bb2, 0x422c, 0x4a6c, 0xc639, 0x4a8c, 0x0841,
-  0x0020, 0x2968, 0x31aa, 0x420b, 0xbe19, 0xb5f8, 0x31c9, 0x0021,
-  0x3189, 0x6371, 0x6b91, 0x31a9, 0x0841, 0x4a4c, 0xb5b7, 0x420b,
-  0x0000, 0x0020, 0x0021, 0x3189, 0x422c, 0x39ea, 0x0841, 0x0020,
-  0x3189, 0x39eb, 0x39eb, 0x3189, 0x0841, 0x3189, 0x422b, 0x39ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x2968, 0x0020,
-  0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea, 0x0000,
-  0x31a9, 0x420a, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a8c, 0x0021, 0x0000,
-  0x422b, 0xad97, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000, 0x0000,
-  0x39eb, 0x52ce, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000,
-  0x7c13, 0xbe59, 0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000, 0x0000,
-  0xb619, 0x2b0b, 0x9f45, 0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420a,
-  0x420b, 0x39ea, 0x420b, 0x7413, 0xbe19, 0x420b, 0x0000, 0x0000,
-  0xd6dc, 0x330c, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc,
-  0xdefc, 0xc65a, 0xbe5a, 0xbe5a, 0x9d36, 0x4a8d, 0x0021, 0x0000,
-  0xe75d, 0xd71c, 0xe73b, 0xce9b, 0xce9b, 0xe75d, 0xe75d, 0xef7d,
-  0xe77d, 0xe77d, 0xe77d, 0xc67a, 0x422b, 0x0841, 0x0000, 0x0000,
-  0xbe39, 0xc65a, 0xc67b, 0xb5d9, 0xdf3d, 0xdf3d, 0xb5d9, 0xdf1c,
-  0xcebb, 0xe73d, 0xef7d, 0xd6fc, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x3a0b, 0x4a8d, 0x9d36, 0xa577, 0xdf3c, 0xc67a, 0x7c54, 0xb5f9,
-  0xa577, 0xa557, 0xc65a, 0xd6db, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x3a0b, 0x6371, 0x6b92, 0x4a8d, 0xd6db, 0x9d36, 0x3a0b, 0x39ca,
-  0x39eb, 0x420b, 0x4a8d, 0xb619, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x6371, 0x39eb, 0x39ca, 0x52ad, 0xce9a, 0x4a6c, 0x0021, 0x0841,
-  0x39ea, 0x6351, 0x4a4c, 0xbe19, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0842, 0x39ea, 0xbe19, 0xb5f8, 0x31a9, 0x0021, 0x3189,
-  0x6371, 0x6b91, 0x39ca, 0x39ea, 0x2968, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3189, 0x424c, 0x39ea, 0x0841, 0x0020, 0x3189,
-  0x39eb, 0x31ca, 0x0841, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x39ea, 0x3189, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x420b, 0x31a9, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x52ce, 0xc65a, 0x4a8c, 0x0021, 0x0000, 0x0000, 0x0000,
-  0xbdf8, 0x52ad, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5ace, 0x7bd2, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc69a, 0xd6b9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000,
-  0x0021, 0x420b, 0xce7a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1a89, 0x9f25, 0xdf3a, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b,
-  0x39ea, 0x4a6c, 0xb5d8, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x228a, 0xcf2b, 0xe75b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc,
-  0xc65a, 0xbe5a, 0xa597, 0x52ad, 0x0021, 0x0000, 0x0000, 0x48c2,
-  0xd6fc, 0xe73b, 0xce9b, 0xce9b, 0xe75d, 0xe75d, 0xef7d, 0xe77d,
-  0xe77d, 0xe75d, 0xbe5a, 0x420b, 0x0000, 0x0000, 0x0020, 0x2965,
-  0xc65a, 0xc67b, 0xadd9, 0xdf3d, 0xe73d, 0xadd8, 0xdf1c, 0xcebb,
-  0xe73d, 0xef7d, 0xd6fc, 0x420b, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x4a4c, 0x9d36, 0x9d57, 0xbe5a, 0xdf1c, 0x8495, 0x9d36, 0x9d57,
-  0xa577, 0xbe5a, 0xd6dc, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3a0b, 0x6391, 0x39eb, 0x422b, 0xb5f9, 0xbe19, 0x4a6c, 0x420b,
-  0x39eb, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6371, 0x31ca, 0x0021, 0x0021, 0x4a6c, 0xce9a, 0x4a6c, 0x5b30,
-  0x422c, 0xbe19, 0xb619, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x31ca, 0x0841, 0x0000, 0x0000, 0x39ea, 0xbe19, 0x4a6c, 0x6351,
-  0x39eb, 0x39ea, 0x39ea, 0x2968, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0020, 0x0000, 0x0020, 0x3189, 0x420b, 0x39ca, 0x39ca,
-  0x3189, 0x0021, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x39ea, 0x3189, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x5b0f, 0xb5f8, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x39ea, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x52ce, 0xc65a, 0x4a8c, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a4c, 0xbdd8, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x5b0f, 0xd6bb, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7bf3, 0xb391, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd6d9, 0xbbd1, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000, 0x0021,
-  0x424c, 0xce7a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a1,
-  0xafc5, 0xdf1a, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b, 0x420b,
-  0x7413, 0xb619, 0x420b, 0x0000, 0x0000, 0x0000, 0x0820, 0x58c2,
-  0xdfab, 0xdf5b, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc67a,
-  0xc67a, 0xa598, 0x52ad, 0x0021, 0x0000, 0x0000, 0x5103, 0xaaee,
-  0xe75c, 0xce9b, 0xbe5a, 0xe75d, 0xe77d, 0xef7d, 0xe77d, 0xe75d,
-  0xe75d, 0xc65a, 0x420b, 0x0000, 0x0000, 0x0000, 0x39c7, 0xc618,
-  0xc67b, 0xa577, 0x8cb5, 0xdf1c, 0xcebb, 0xdf1c, 0xcebb, 0xe75d,
-  0xef7d, 0xce9a, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0841, 0x31e7,
-  0xa577, 0x7c54, 0xd6bb, 0xbe39, 0x7c34, 0x9d36, 0xa557, 0xbe3a,
-  0xd6dc, 0x52ad, 0x39ca, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xadd8, 0x52ce, 0xce9a, 0x528d, 0x31a9, 0x39ca, 0x39eb, 0x5b0e,
-  0xce7a, 0x4a6c, 0x8474, 0x39ca, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x6bb2, 0x4a4c, 0xbe19, 0x39ea, 0x0021, 0x0021, 0x39ea, 0xbe19,
-  0xb5f8, 0x424c, 0x6bb2, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x39ca, 0x31a9, 0x39c9, 0x0841, 0x0000, 0x0000, 0x2968, 0x420b,
-  0x420b, 0x39eb, 0x6351, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0021,
-  0x3189, 0x39ca, 0x31aa, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x4a8c, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x52ce,
-  0xc65a, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x39ea, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f,
-  0xd6bb, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2,
-  0xce39, 0x4a4b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f,
-  0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50a2,
-  0xbb91, 0xce39, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0020, 0x5aee,
-  0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2,
-  0xb370, 0xbe19, 0x422b, 0x0021, 0x0000, 0x0000, 0x0021, 0x424c,
-  0xce7a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x50e2, 0xb305,
-  0xe71c, 0xc65a, 0x73f3, 0x422b, 0x420a, 0x420b, 0x420b, 0x7413,
-  0xb619, 0x420b, 0x0000, 0x0000, 0x0000, 0x0800, 0x6123, 0xd407,
-  0xe73d, 0xb5f9, 0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a,
-  0xa598, 0x52ad, 0x0021, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xdc8a,
-  0xc67a, 0xdf3c, 0xe75d, 0xe75d, 0xe75d, 0xe77d, 0xe75d, 0xe75d,
-  0xbe5a, 0x420b, 0x0000, 0x0000, 0x0000, 0x39c7, 0xc618, 0xdefb,
-  0x8474, 0xdefc, 0xcebb, 0xadb8, 0xc69a, 0xcebb, 0xe75d, 0xe75d,
-  0xd6db, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0041, 0x4249, 0xadb7,
-  0x73f3, 0xc65a, 0x9d57, 0x7413, 0x9d36, 0xb5d9, 0xdf1c, 0xad98,
-  0x9d57, 0x420b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0020, 0x31c7,
-  0x5aee, 0xce7a, 0x4a6d, 0x31a9, 0x422b, 0xb5d8, 0xd6dc, 0x528d,
-  0x6b92, 0x6371, 0x31ca, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xce7a, 0xb5f9, 0x39c9, 0x0021, 0x0842, 0x5aee, 0xce9a, 0x422b,
-  0x31a9, 0x420b, 0x6371, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x422c, 0x39c9, 0x0841, 0x0000, 0x39c9, 0xbe19, 0xb5f8, 0x39ea,
-  0x0841, 0x3189, 0x6371, 0x39ca, 0x0020, 0x0000, 0x0000, 0x48a2,
-  0x3189, 0x0021, 0x0000, 0x0020, 0x31a9, 0x422c, 0x420b, 0x3189,
-  0x0020, 0x0841, 0x31ca, 0x3189, 0x0020, 0x0000, 0x0800, 0x50c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x4a6c, 0x52ad,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xc65a,
-  0x39ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x6123,
-  0x39ea, 0x0841, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xce9b,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xd46b,
-  0xce7a, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5902, 0x7183,
-  0xc65a, 0x422b, 0x0021, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xbbc7,
-  0xbe5a, 0x7413, 0x422b, 0x420a, 0x420b, 0x420b, 0x7413, 0xb619,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2229,
-  0xadd8, 0xc67a, 0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xa598,
-  0x52ad, 0x0021, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x2229,
-  0xdf1c, 0xdf1c, 0xe75d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xbe5a,
-  0x420b, 0x0000, 0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xccac,
-  0xa577, 0x8495, 0xadd8, 0xdf3d, 0xcebb, 0xe75d, 0xef7d, 0xd6bb,
-  0x39ea, 0x0021, 0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a,
-  0x73f3, 0x94f6, 0xb619, 0xbe39, 0xa577, 0xcebb, 0xdefc, 0x7c13,
-  0x3a0b, 0x2968, 0x0020, 0x0000, 0x0000, 0x0020, 0x31c7, 0x4228,
-  0x39ea, 0x422b, 0x420b, 0x39ea, 0x422b, 0xadd8, 0xad98, 0x4a4c,
-  0x6371, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x48a2,
-  0x420b, 0x6371, 0x31aa, 0x0021, 0x0842, 0x5acd, 0xc67a, 0x4a6c,
-  0x6b91, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000, 0x0820, 0x6123,
-  0x6b91, 0x6b91, 0x3189, 0x0021, 0x39c9, 0xbe19, 0xb5f8, 0x424c,
-  0x6351, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0000, 0x5902, 0xcc6b,
-  0x39eb, 0x31ca, 0x0841, 0x0020, 0x31a9, 0x422c, 0x420b, 0x39ca,
-  0x31aa, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x6923,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x4a8c, 0x0862,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x5923, 0x50c2,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xce9b, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x7163,
-  0x2968, 0x0020, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x79a4, 0xb325,
-  0x31aa, 0x0021, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xd487,
-  0x6bd2, 0x422b, 0x420a, 0x420b, 0x420b, 0x7413, 0xb619, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9702,
-  0xc69a, 0xd6fc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xa598, 0x52ad,
-  0x0021, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xc6e8,
-  0xe75d, 0xef7d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xbe5a, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcca,
-  0xcebb, 0xe75d, 0xe75d, 0xcebb, 0xe75d, 0xef7d, 0xcebb, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xdedb,
-  0x9d57, 0xbe39, 0xbe39, 0xa577, 0xbe39, 0xdf1c, 0x8454, 0x31ca,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0020, 0x31a7, 0x4a6a, 0xb5b7,
-  0x422c, 0x420b, 0x420b, 0x422c, 0x4a8d, 0xb5d8, 0xa557, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x89e5,
-  0x6371, 0x39eb, 0x39ca, 0x6351, 0x6371, 0x630f, 0xce7a, 0x420b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x7983, 0x60e2,
-  0x39ea, 0x5b30, 0x39ea, 0x31a9, 0x422c, 0xbe19, 0xb5f8, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x50c2, 0x58c2,
-  0x0841, 0x31ca, 0x3189, 0x0862, 0x3189, 0x422c, 0x420b, 0x3189,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x50c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x3189,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a8c, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5923,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xd48b,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb0e,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xb30d,
-  0x420b, 0x420b, 0x420b, 0x420b, 0x7413, 0xb619, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8,
-  0xdefc, 0xdefc, 0xdefc, 0xc67a, 0xc67a, 0xa598, 0x52ad, 0x0021,
-  0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf5ac,
-  0xef7d, 0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xbe5a, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xf54c,
-  0xe75d, 0xe75d, 0xcebb, 0xcedb, 0xe77d, 0xd6fc, 0x39ea, 0x0000,
-  0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99, 0xcbe8,
-  0xbe5a, 0xbe39, 0xa597, 0xdf1c, 0xef7e, 0xdf1c, 0x4a6c, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x31c7, 0x4a8a, 0xb575, 0xbb87,
-  0x39ea, 0x39ea, 0x422c, 0xa557, 0xd6db, 0xd6fc, 0xb5f9, 0x39ca,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x50e2, 0x79a4, 0x89e5, 0x6102,
-  0x0000, 0x0021, 0x31ca, 0x6b91, 0x424c, 0x52ce, 0xce9b, 0x422b,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0x8183, 0x58e2, 0x58e2, 0x6123,
-  0x0000, 0x0000, 0x2968, 0x31a9, 0x3189, 0x6b91, 0xc639, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x48a2, 0x48c2, 0x1020, 0x5903, 0xd46b,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0841, 0x39ca, 0x420b, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x6923,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x3189,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a8c, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5102, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc2b, 0x6984,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xe4ec,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xdc8a,
-  0x420b, 0x420b, 0x39ea, 0x420b, 0x7413, 0xbe19, 0x420b, 0x0000,
-  0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xed0c,
-  0xdefc, 0xdefc, 0xc65a, 0xbe5a, 0xbe5a, 0x9d36, 0x4a8d, 0x0021,
-  0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf58c, 0xcbc7,
-  0xef7d, 0xe77d, 0xe75d, 0xe75d, 0xc67a, 0x422b, 0x0841, 0x0000,
-  0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xed2c, 0xdc89,
-  0xe75d, 0xcebb, 0xcebb, 0xe77d, 0xd6fc, 0x39ea, 0x0000, 0x0000,
-  0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99, 0xcc08, 0xed2c,
-  0xbe39, 0xa577, 0xc67a, 0xe77d, 0xdf1c, 0x4a6c, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x31a7, 0x4a6a, 0xb575, 0xbb87, 0xd407,
-  0x39ea, 0x422c, 0x9d36, 0xbe5a, 0xd6fc, 0xbe19, 0x39c9, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x81e5, 0x5902, 0x5902,
-  0x0842, 0x39ea, 0x6bb2, 0x422c, 0x4a6c, 0xc639, 0x528c, 0x0841,
-  0x0000, 0x0000, 0x0820, 0x50c2, 0x8183, 0x50c2, 0x0800, 0x0000,
-  0x31aa, 0x6351, 0x6b91, 0x31a9, 0x0841, 0x4a4c, 0xb5b8, 0x39ea,
-  0x0000, 0x0000, 0x50c2, 0x8183, 0x58e2, 0x0820, 0x0000, 0x0000,
-  0x39ca, 0x39eb, 0x39eb, 0x3189, 0x0841, 0x3189, 0x422c, 0x31a9,
-  0x0020, 0x0000, 0x50c2, 0x60e2, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39ea, 0x3189, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x52ce, 0xc65a, 0x4a8c, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800,
-  0x0000, 0x0000, 0x0020, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000,
-  0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xd48b, 0x6123,
-  0x0000, 0x0000, 0x0021, 0x424c, 0xce7a, 0x420b, 0x0000, 0x0000,
-  0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6923,
-  0x420b, 0x39ea, 0x420b, 0x7413, 0xbe19, 0x420b, 0x0000, 0x0000,
-  0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9a25,
-  0xd6fc, 0xc65a, 0xbe5a, 0xbe5a, 0x9d36, 0x4a8d, 0x0021, 0x0000,
-  0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xcec8, 0xf58c, 0xcbe7, 0xd448,
-  0xe77d, 0xe77d, 0xe77d, 0xc67a, 0x422b, 0x0841, 0x0000, 0x0000,
-  0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xed2c, 0xd448, 0xf54c,
-  0xcebb, 0xe73d, 0xef7d, 0xd6fc, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99, 0xc387, 0xa2a5, 0xed2c,
-  0x9d57, 0xa577, 0xc65a, 0xd6db, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x31a7, 0x4a6a, 0xb576, 0x9a86, 0xe4cb, 0xd448,
-  0x39eb, 0x420b, 0x4a8d, 0xb619, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x5902, 0xbba8, 0x71a4, 0xdccb, 0x7183,
-  0x3a0b, 0x6351, 0x4a4c, 0xbe19, 0x420b, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x58e2, 0x81a3, 0x6943, 0xcc6b, 0x6123,
-  0x6b91, 0x6b91, 0x39ca, 0x39ea, 0x2968, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0x7983, 0x58e2, 0x50c2, 0x50e2, 0x0820,
-  0x39eb, 0x31ca, 0x0841, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0x60e2, 0x50c2, 0x0820, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x39ea, 0x3189, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0862, 0x5b0f, 0xb5f8, 0x39ea, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x52ad, 0xc65a, 0x4a8c, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000,
-  0x0021, 0x5b0f, 0xd6bb, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000,
-  0x0021, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5102, 0x0000,
-  0x0021, 0x420b, 0xce7a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800,
-  0x39ea, 0x4a6c, 0xb5d8, 0x420b, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902,
-  0xbe5a, 0xbe5a, 0xa597, 0x52ad, 0x0021, 0x0000, 0x0000, 0x50e3,
-  0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf58c, 0xcbc7, 0xd428, 0xc366,
-  0xe77d, 0xe75d, 0xbe5a, 0x420b, 0x0000, 0x0000, 0x0000, 0x39c7,
-  0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xed0c, 0xdc89, 0xed2c, 0xdc68,
-  0xe75d, 0xe77d, 0xd6fc, 0x420b, 0x0000, 0x0000, 0x0000, 0x0041,
-  0x3a29, 0xadb7, 0xd6ba, 0xd679, 0xa2a7, 0xe4eb, 0xdc68, 0xc366,
-  0xa577, 0xbe5a, 0xd6dc, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x31a7, 0x4a6a, 0xad55, 0x9246, 0xd428, 0xbb46, 0x8a04,
-  0x39eb, 0x5aee, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x48c2, 0x81c5, 0x79c4, 0xdcab, 0x6963, 0x3165,
-  0x420b, 0xbe19, 0xb619, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0x6123, 0xd46a, 0xcc08, 0x50e2, 0x0820,
-  0x39ca, 0x420a, 0x39ea, 0x2968, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0x7983, 0x6943, 0x50e2, 0x0820, 0x0000,
-  0x3189, 0x0021, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x50c2, 0x60e2, 0x50a2, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x39ea, 0x3189, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0862, 0x5b0e, 0xb5f8, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5b0f, 0xc65a, 0x4a8c, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x6350, 0xce9b, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000,
-  0x6330, 0xce9a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000,
-  0x4a6d, 0xce7a, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2,
-  0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000,
-  0x7c34, 0xb5f9, 0x420b, 0x0000, 0x0000, 0x0000, 0x0800, 0x6123,
-  0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5923,
-  0xc67a, 0xa598, 0x52ad, 0x0021, 0x0000, 0x0000, 0x50e3, 0xab0d,
-  0xcc4a, 0x3288, 0xcee9, 0xf58c, 0xcbe7, 0xd428, 0xc386, 0xe50c,
-  0xe75d, 0xc65a, 0x420b, 0x0000, 0x0000, 0x0000, 0x39c7, 0xc619,
-  0xdeba, 0xccab, 0xdca9, 0xf54c, 0xdc68, 0xe4eb, 0xdc68, 0xf56d,
-  0xe77d, 0xce9a, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0041, 0x3a29,
-  0xadb7, 0xd658, 0xdcaa, 0xed2c, 0xc366, 0xa2a6, 0xc3c8, 0xed8e,
-  0xdefc, 0x52ad, 0x39ca, 0x0841, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x31c7, 0x5268, 0xd448, 0xdc28, 0x9245, 0xad35, 0xb5b7, 0xb5d7,
-  0xd6db, 0x4a6d, 0x8474, 0x39ca, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x79c4, 0xd428, 0xb325, 0x6123, 0x4208, 0x3a08, 0x31e8,
-  0xb5d8, 0x4a4c, 0x6bb2, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x6123, 0xdccb, 0x6963, 0x60e2, 0x79a3, 0x50e2, 0x0820,
-  0x3a0b, 0x39eb, 0x6351, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x5903, 0xcc6b, 0x6123, 0x7983, 0x81a3, 0x48a2, 0x0000,
-  0x31aa, 0x31aa, 0x31aa, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x50c2, 0x5903, 0x1020, 0x50c2, 0x58c2, 0x0820, 0x0000,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x52ad, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xce9b, 0x39ea, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdefc, 0x422b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2,
-  0x6123, 0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdefc, 0x422b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5903,
-  0xc40a, 0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000,
-  0xdefc, 0x422b, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2,
-  0x79a3, 0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000,
-  0xd6dc, 0x420b, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0xb325,
-  0xc3e7, 0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000,
-  0xbe39, 0x420b, 0x0000, 0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7,
-  0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2,
-  0xa577, 0x52ae, 0x0021, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a,
-  0x3288, 0xcee9, 0xf58c, 0xcbe7, 0xd428, 0xc386, 0xe4cb, 0xc386,
-  0xbe39, 0x420b, 0x0000, 0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba,
-  0xccab, 0xdca9, 0xf54c, 0xdc48, 0xed2b, 0xe488, 0xf54c, 0xdc88,
-  0xd6bb, 0x420b, 0x0000, 0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7,
-  0xd658, 0xdcca, 0xe4eb, 0xa285, 0xd469, 0xdcca, 0xed6d, 0xdc88,
-  0x9d57, 0x422b, 0x0021, 0x0000, 0x0000, 0x0000, 0x0020, 0x31c7,
-  0x5269, 0xdcec, 0xc386, 0x8a25, 0xad55, 0xb5d7, 0xb596, 0xb387,
-  0x73d2, 0x6371, 0x31ca, 0x0841, 0x0000, 0x0000, 0x0000, 0x0820,
-  0x79a4, 0xdc48, 0xb325, 0x6123, 0x41e8, 0x3a08, 0x3a08, 0x41e7,
-  0x31aa, 0x420b, 0x6371, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0800,
-  0x7184, 0xd46a, 0x6143, 0x50c2, 0x7983, 0x5902, 0x58e2, 0x79a4,
-  0x0021, 0x3189, 0x6371, 0x39ca, 0x0020, 0x0000, 0x0000, 0x5902,
-  0xc42a, 0x6963, 0x0800, 0x0800, 0x50c2, 0x7983, 0x58e2, 0x50c2,
-  0x0000, 0x0841, 0x31ca, 0x3189, 0x0020, 0x0000, 0x0000, 0x50c2,
-  0x6923, 0x50c2, 0x0000, 0x0000, 0x0820, 0x58c2, 0x50c2, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2968, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x6123,
-  0x50c2, 0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xc40a,
-  0x79a4, 0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0021, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3,
-  0xb306, 0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3189, 0x0021, 0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7,
-  0xcc68, 0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x31a9, 0x0021, 0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8,
-  0x9ec2, 0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x5902,
-  0x4a6d, 0x0041, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288,
-  0xcee9, 0xf58c, 0xcbe7, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xd428,
-  0x31a9, 0x0020, 0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab,
-  0xdcc9, 0xf56d, 0xed2c, 0xf54c, 0xdc89, 0xf54c, 0xdc89, 0xed4c,
-  0x3189, 0x0841, 0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd678,
-  0xf58e, 0xed4c, 0xcbc7, 0xed4d, 0xdccb, 0xed6e, 0xdc89, 0xe489,
-  0x39eb, 0x2968, 0x0020, 0x0000, 0x0000, 0x0020, 0x31c7, 0x4a69,
-  0xe50c, 0xdc48, 0x9245, 0xb575, 0xb5d7, 0xb596, 0xbba7, 0xed0b,
-  0x6b92, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x5102,
-  0xd428, 0xbb25, 0x6123, 0x39e7, 0x31e8, 0x39c7, 0x6143, 0xbb46,
-  0x6bd3, 0x39ca, 0x0020, 0x0000, 0x0000, 0x0000, 0x0800, 0x6984,
-  0xdcab, 0x7163, 0x7963, 0x50c2, 0x0020, 0x0000, 0x50c2, 0x89a3,
-  0x6b91, 0x31a9, 0x0020, 0x0000, 0x0000, 0x0000, 0x5102, 0xd46a,
-  0xcc08, 0x6102, 0x50c2, 0x48a2, 0x0000, 0x0000, 0x48a2, 0x50c2,
-  0x31ca, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x6923,
-  0x6102, 0x50c2, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2,
-  0x5902, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4,
-  0xcc4b, 0x6163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306,
-  0xbb4d, 0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68,
-  0xbb2d, 0xd429, 0x6122, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2,
-  0xdcc8, 0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x5902, 0x50c2,
-  0x0000, 0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xcec9,
-  0xf58c, 0xcbc7, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9204,
-  0x0000, 0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea,
-  0xed4c, 0xdc89, 0xed2c, 0xe488, 0xf54c, 0xe489, 0xed0b, 0xc3a7,
-  0x0000, 0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99,
-  0xc3c8, 0xed2c, 0xdc69, 0xdcaa, 0xed6e, 0xdc88, 0xdc89, 0xf54c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x31a7, 0x4a6a, 0xad35,
-  0x71c5, 0xdccb, 0x9aa6, 0xb575, 0xb5b6, 0xbb87, 0xdc48, 0xf56d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x81c5,
-  0x6943, 0xdccb, 0x8a05, 0x39e7, 0x31c7, 0x6123, 0xbb45, 0xd428,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x8183, 0x60e2,
-  0x7184, 0xdccb, 0x6143, 0x0000, 0x0820, 0x58e2, 0x89c4, 0x6922,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x50c2, 0x6103,
-  0xd46a, 0xcc08, 0x50e2, 0x0800, 0x48a2, 0x8183, 0x8183, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x50c2,
-  0x6943, 0x5902, 0x0820, 0x0000, 0x50c2, 0x60e2, 0x58e2, 0x58c2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x7183,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b,
-  0x6163, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x81a3,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d,
-  0xdc8b, 0x5902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x7983,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d,
-  0xd429, 0x6122, 0x0800, 0x0000, 0x0000, 0x0000, 0x0820, 0x58e2,
-  0x0000, 0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8,
-  0xe4cb, 0x9224, 0x5902, 0x5903, 0x58e2, 0x5902, 0x58e2, 0x89c4,
-  0x0000, 0x0000, 0x50e3, 0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf58c,
-  0xcbc7, 0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9a44, 0xcbe7,
-  0x0000, 0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xed2c,
-  0xdc89, 0xed4c, 0xdc89, 0xf54c, 0xe489, 0xed2c, 0xcbc7, 0xdc68,
-  0x0000, 0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99, 0xcc08,
-  0xed4c, 0xed4c, 0xcba7, 0xed4d, 0xdcca, 0xed4c, 0xf54c, 0xf56d,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x31c7, 0x4a8a, 0xb575, 0xbba7,
-  0xed2c, 0xdc48, 0x9245, 0xb576, 0xb596, 0xbba8, 0xd428, 0xf54c,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x50e2, 0x79a4, 0x81e5, 0x6963,
-  0xe50c, 0xbb46, 0x5902, 0x31c7, 0x3a08, 0x41c6, 0x6963, 0xd448,
-  0x0000, 0x0000, 0x0000, 0x50c2, 0x8183, 0x58e2, 0x58c2, 0x7184,
-  0xdccb, 0x6943, 0x0800, 0x0820, 0x50e2, 0x7984, 0x6943, 0xdcab,
-  0x0000, 0x0000, 0x0000, 0x48a2, 0x48c2, 0x1020, 0x5903, 0xd46a,
-  0xcbe8, 0x50e2, 0x0800, 0x48a2, 0x8183, 0x81a3, 0x50c2, 0x5903,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x50c2, 0x6943,
-  0x5902, 0x0820, 0x0000, 0x50c2, 0x60e2, 0x50c2, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0x5102,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x81e4, 0xc3a7,
-  0x0000, 0x0000, 0x0000, 0x48a2, 0x6123, 0x50c2, 0x5902, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x81c4, 0xdc8b, 0x7183,
-  0x0000, 0x0000, 0x0000, 0x5903, 0xc40a, 0x79a4, 0xcc4b, 0x6163,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0800, 0x89e4, 0xd408, 0x6123,
-  0x0000, 0x0000, 0x0820, 0x58e2, 0x79a3, 0xb306, 0xbb4d, 0xdc8b,
-  0x5902, 0x0000, 0x0000, 0x0000, 0x0800, 0x81e4, 0xdcab, 0x6943,
-  0x0000, 0x0000, 0x50c2, 0xb325, 0xc3e7, 0xcc68, 0xbb2d, 0xd429,
-  0x6122, 0x0800, 0x0000, 0x0000, 0x0800, 0x6123, 0xdcab, 0x6943,
-  0x0000, 0x0800, 0x6123, 0xc3c7, 0x2aa8, 0x9ec2, 0xdcc8, 0xe4cb,
-  0x9224, 0x5902, 0x5903, 0x58e2, 0x58e2, 0x6923, 0xc3c7, 0x6943,
-  0x0000, 0x48e3, 0xab0d, 0xcc4a, 0x3288, 0xcec9, 0xf58c, 0xcbc7,
-  0xd428, 0xc386, 0xe4cb, 0xc386, 0xcbe7, 0x9224, 0xbb25, 0x89c4,
-  0x0000, 0x39c7, 0xc619, 0xdeba, 0xd4ab, 0xdcea, 0xed2c, 0xdc89,
-  0xed4c, 0xdc89, 0xf54c, 0xe489, 0xed2c, 0xcbc7, 0xcc07, 0x6923,
-  0x0000, 0x0041, 0x3a29, 0xadb7, 0xd69a, 0xde99, 0xcc08, 0xed2c,
-  0xf54d, 0xc3a7, 0xed4d, 0xdcca, 0xed4c, 0xf56d, 0xe50c, 0x6123,
-  0x0000, 0x0000, 0x0020, 0x31a7, 0x4a6a, 0xb575, 0xbb87, 0xd428,
-  0xed0c, 0xa2a6, 0xb575, 0xb596, 0xbba8, 0xd448, 0xe50c, 0x6943,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x58e2, 0x81e5, 0x5902, 0x6123,
-  0xcbe7, 0xcc08, 0x6985, 0x41e8, 0x41a6, 0x79e4, 0xdcab, 0x6943,
-  0x0000, 0x0000, 0x0820, 0x50c2, 0x8183, 0x50c2, 0x0800, 0x0800,
-  0x6963, 0xdccb, 0x6943, 0x7983, 0x6143, 0xd46a, 0xcbe8, 0x6122,
-  0x0000, 0x0000, 0x50c2, 0x8183, 0x58e2, 0x0820, 0x0000, 0x0000,
-  0x5903, 0xd46b, 0x6943, 0x8183, 0x58e2, 0x5923, 0x5902, 0x50c2,
-  0x0000, 0x0000, 0x50c2, 0x60e2, 0x50c2, 0x0000, 0x0000, 0x0000,
-  0x50c2, 0x6123, 0x58c2, 0x58e2, 0x50c2, 0x0800, 0x0000, 0x0000
-};
-
-const Animation cats_walkingAnimation = {
-  .name = "Cats Walking",
-  .frameCount = 56,
-  .width = 16,
-  .height = 16,
-  .frameDurations = cats_walkingDurations,
-  .animationFrames = cats_walkingFrames
-};
-#endif // ANIMATION_CATS_WALKING_H
@@ -1,822 +0,0 @@
-// charlie_chaplin.h - Auto-generated from charlie_chaplin.json
-#ifndef ANIMATION_CHARLIE_CHAPLIN_H
-#define ANIMATION_CHARLIE_CHAPLIN_H
-
-#include "animation_types.h"
-
-// Frame Durations for charlie_chaplin (in 100ms units)
-static const uint8_t PROGMEM charlie_chaplinDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for charlie_chaplin
-static const uint16_t PROGMEM charlie_chaplinFrames[] = {
-  0x5a86, 0x62c7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x62c7, 0x5a86, 0x5a66,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5a86,
-  0x62c7, 0x0000, 0x0000, 0x0000, 0xfd0d, 0xfd0d, 0xfd0d, 0xfd0d,
-  0xfd0d, 0xfd0d, 0xfd0d, 0x0000, 0x0000, 0x0000, 0x62c7, 0x62a6,
-  0x6b07, 0x7328, 0x28c2, 0xbbeb, 0x4163, 0x4163, 0xfd0d, 0xfd0d,
-  0xfd0d, 0x4163, 0x4163, 0xbbeb, 0x28c2, 0x7328, 0x6b07, 0x62c7,
-  0x6b28, 0x7348, 0x28c2, 0xfd0d, 0xbbeb, 0xbbeb, 0x4163, 0xbbeb,
-  0x4163, 0xbbeb, 0xbbeb, 0xfd0d, 0x28c2, 0x7348, 0x6b28, 0x62c7,
-  0x6b28, 0x7369, 0x28c2, 0xfd0d, 0xbbeb, 0x4163, 0xbbeb, 0xbbeb,
-  0xbbeb, 0x4163, 0xbbeb, 0xfd0d, 0x4163, 0x7369, 0x6b28, 0x6ae7,
-  0x7328, 0x7369, 0xbbeb, 0xfd0d, 0xfd0d, 0xbbeb, 0xbbeb, 0xfd0d,
-  0xbbeb, 0xbbeb, 0xfd0d, 0xfd0d, 0xbbeb, 0x7369, 0x7328, 0x6b07,
-  0x7328, 0x7b69, 0xbbeb, 0xfd0d, 0xfd0d, 0xfd0d, 0xbbeb, 0xfd0d,
-  0xbbeb, 0xfd0d, 0xfd0d, 0xfd0d, 0xbbeb, 0x7b69, 0x7328, 0x6b07,
-  0x7328, 0x7369, 0x7b89, 0xfd0d, 0xfd0d, 0x4163, 0xfd0d, 0xfd0d,
-  0xfd0d, 0x4163, 0xfd0d, 0xfd0d, 0x7b89, 0x7369, 0x7328, 0x6b07,
-  0x6b28, 0x7369, 0x7b89, 0xbbeb, 0xfd0d, 0xbbeb, 0x4163, 0x4163,
-  0x4163, 0xbbeb, 0xfd0d, 0xbbeb, 0x7b89, 0x7369, 0x6b28, 0x6ae7,
-  0x6b28, 0x7348, 0x8c51, 0xbbeb, 0xfd0d, 0xfd0d, 0xbbeb, 0xbbeb,
-  0xbbeb, 0xfd0d, 0xfd0d, 0xbbeb, 0x8c51, 0x7348, 0x6b28, 0x62c7,
-  0x6b07, 0x9cd3, 0x8c51, 0xe73c, 0xfd0d, 0xfd0d, 0xfd0d, 0xbbeb,
-  0xfd0d, 0xfd0d, 0xfd0d, 0xe73c, 0x8c51, 0x9cd3, 0x6b07, 0x62c7,
-  0x8c51, 0x9cd3, 0x8c51, 0x8c51, 0xe73c, 0xfd0d, 0xfd0d, 0xfd0d,
-  0xfd0d, 0xfd0d, 0xe73c, 0x8c51, 0x8c51, 0x9cd3, 0x9cd3, 0x8c51,
-  0x9cd3, 0x9cd3, 0x9cd3, 0x8c51, 0xe73c, 0xe73c, 0xfd0d, 0xfd0d,
-  0xfd0d, 0xe73c, 0xe73c, 0x8c51, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3,
-  0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xe73c, 0x4926, 0x4926, 0x4926,
-  0x4926, 0x4926, 0xe73c, 0x9cd3, 0x8820, 0x8820, 0x9cd3, 0x9cd3,
-  0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0x9cd3, 0xe73c, 0x4a49, 0x4926,
-  0x4a49, 0xe73c, 0x9cd3, 0x9cd3, 0x4a49, 0x9cd3, 0x9cd3, 0x9cd3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xecac, 0xecac,
-  0xecac, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x6a25, 0xe48c, 0xfd0d,
-  0xe48c, 0x6a25, 0x6205, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xbbca, 0x9b49, 0x6a25, 0xab8a,
-  0x6a25, 0x9b49, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xab69, 0xc3eb,
-  0xab89, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbea, 0xc3eb, 0xeccc,
-  0xc3eb, 0xbbea, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xecac, 0xecac,
-  0xecac, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x6a25, 0xe48c, 0xfd0d,
-  0xe48c, 0x6a25, 0x6205, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xbbca, 0x9b49, 0x6a25, 0xab8a,
-  0x6a25, 0x9b49, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xab69, 0xc3eb,
-  0xab89, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbea, 0xc3eb, 0xeccc,
-  0xc3eb, 0xbbea, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xfced, 0xc44d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xec8c, 0xe4ad, 0xcdf6, 0x8430, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfd0d,
-  0xeccc, 0x59e6, 0x4184, 0x3144, 0x41a5, 0x8c92, 0x94b2, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xcdf7, 0xc618, 0x3964, 0x83ae, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x72ac, 0xc618, 0x4144, 0x78a2, 0x8925, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0x9cd3, 0x3123, 0x4a08, 0x8c30, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xc3eb, 0xecac, 0x6205, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xeccc,
-  0xbbeb, 0xab89, 0xdc6c, 0xe48c, 0xab89, 0x7b48, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xbbea, 0x4143, 0x4163, 0x3922, 0x4163, 0x7328, 0x7328, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x6205, 0xcbea, 0x3943, 0x6b08, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xbbca, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x4164, 0x83ef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd70, 0xd658, 0x3985, 0x8410, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xd69a, 0x4185, 0x8bef, 0x9471, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x728b, 0xc5f8, 0x3944, 0x7882, 0x8925, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0x9cd3, 0x3123, 0x4a08, 0x8c30, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xd44b, 0xc3ea, 0x1061, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x4963, 0x4163, 0x28c1, 0x28e2, 0x62c7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xa349, 0x3102, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab8a, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x4164, 0x83ef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd70, 0xd658, 0x3985, 0x7bef, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xd679, 0x51e6, 0x9470, 0x9cd2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xecee, 0xeccc, 0xf4ed, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfd0d, 0xfd0d, 0xf4ed, 0x9cd2, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xd44b, 0xc3ea, 0x1061, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x4963, 0x4163, 0x28c1, 0x28e2, 0x62c7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xa349, 0x3102, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab8a, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x4164, 0x83ef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd70, 0xd658, 0x3985, 0x7bef, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xd679, 0x51e6, 0x9470, 0x9cd2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xecee, 0xeccc, 0xf4ed, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfd0d, 0xfd0d, 0xf4ed, 0x9cd2, 0x94d3,
-  0x0840, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1061, 0x5245,
-  0x5a86, 0x5266, 0x0020, 0x0840, 0xd42b, 0xecac, 0xe48c, 0xe48c,
-  0xdc4b, 0x4163, 0x3102, 0x28c2, 0x3923, 0x5a66, 0x5a86, 0x5a86,
-  0x62e7, 0x62c7, 0x0840, 0x1881, 0xdc6b, 0xeccc, 0xeccc, 0xfd0d,
-  0xecac, 0xdc6b, 0xcc0a, 0x4163, 0xc3ea, 0x7b28, 0x62c7, 0x62a6,
-  0x6b07, 0x62e7, 0x3923, 0x9b49, 0x6205, 0x59c4, 0x6a25, 0xdc6b,
-  0x6a25, 0x61e5, 0x59c4, 0x28e2, 0x3943, 0x6ae7, 0x6ae7, 0x62c7,
-  0x6b28, 0x6ae7, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xab69, 0xa369, 0x30e2, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab89, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x3964, 0x7bef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde37, 0x49c6, 0x8c0f, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde17, 0xf54f, 0xecac, 0xecee, 0xa4d2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xeccd, 0xfd0d, 0xfd0d, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfced, 0xfced, 0xf4ed, 0x9cd2, 0x94d3,
-  0x0840, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1061, 0x5245,
-  0x5a86, 0x5266, 0x0020, 0x0840, 0xd42b, 0xecac, 0xe48c, 0xe48c,
-  0xdc4b, 0x4163, 0x3102, 0x28c2, 0x3923, 0x5a66, 0x5a86, 0x5a86,
-  0x62e7, 0x62c7, 0x0840, 0x1881, 0xdc6b, 0xeccc, 0xeccc, 0xfd0d,
-  0xecac, 0xdc6b, 0xcc0a, 0x4163, 0xc3ea, 0x7b28, 0x62c7, 0x62a6,
-  0x6b07, 0x62e7, 0x3923, 0x9b49, 0x6205, 0x59c4, 0x6a25, 0xdc6b,
-  0x6a25, 0x61e5, 0x59c4, 0x28e2, 0x3943, 0x6ae7, 0x6ae7, 0x62c7,
-  0x6b28, 0x6ae7, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xab69, 0xa369, 0x30e2, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab89, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x3964, 0x7bef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde37, 0x49c6, 0x8c0f, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde17, 0xf54f, 0xecac, 0xecee, 0xa4d2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xeccd, 0xfd0d, 0xfd0d, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfced, 0xfced, 0xf4ed, 0x9cd2, 0x94d3,
-  0x0840, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1061, 0x5245,
-  0x5a86, 0x5266, 0x0020, 0x0840, 0xd42b, 0xecac, 0xe48c, 0xe48c,
-  0xdc4b, 0x4163, 0x3102, 0x28c2, 0x3923, 0x5a66, 0x5a86, 0x5a86,
-  0x62e7, 0x62c7, 0x0840, 0x1881, 0xdc6b, 0xeccc, 0xeccc, 0xfd0d,
-  0xecac, 0xdc6b, 0xcc0a, 0x4163, 0xc3ea, 0x7b28, 0x62c7, 0x62a6,
-  0x6b07, 0x62e7, 0x3923, 0x9b49, 0x6205, 0x59c4, 0x6a25, 0xdc6b,
-  0x6a25, 0x61e5, 0x59c4, 0x28e2, 0x3943, 0x6ae7, 0x6ae7, 0x62c7,
-  0x6b28, 0x6ae7, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xab69, 0xa369, 0x30e2, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab89, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x3964, 0x7bef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde37, 0x49c6, 0x8c0f, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde17, 0xf54f, 0xecac, 0xecee, 0xa4d2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xeccd, 0xfd0d, 0xfd0d, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfced, 0xfced, 0xf4ed, 0x9cd2, 0x94d3,
-  0x0840, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1061, 0x5245,
-  0x5a86, 0x5266, 0x0020, 0x0840, 0xd42b, 0xecac, 0xe48c, 0xe48c,
-  0xdc4b, 0x4163, 0x3102, 0x28c2, 0x3923, 0x5a66, 0x5a86, 0x5a86,
-  0x62e7, 0x62c7, 0x0840, 0x1881, 0xdc6b, 0xeccc, 0xeccc, 0xfd0d,
-  0xecac, 0xdc6b, 0xcc0a, 0x4163, 0xc3ea, 0x7b28, 0x62c7, 0x62a6,
-  0x6b07, 0x62e7, 0x3923, 0x9b49, 0x6205, 0x59c4, 0x6a25, 0xdc6b,
-  0x6a25, 0x61e5, 0x59c4, 0x28e2, 0x3943, 0x6ae7, 0x6ae7, 0x62c7,
-  0x6b28, 0x6ae7, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xab69, 0xa369, 0x30e2, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab89, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x3964, 0x7bef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde37, 0x49c6, 0x8c0f, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde17, 0xf54f, 0xecac, 0xecee, 0xa4d2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xeccd, 0xfd0d, 0xfd0d, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfced, 0xfced, 0xf4ed, 0x9cd2, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xd44b, 0xc3ea, 0x1061, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x4963, 0x4163, 0x28c1, 0x28e2, 0x62c7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xa349, 0x3102, 0x28e2, 0x6b08, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xab8a, 0x3923, 0x4984, 0x7328, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbeb, 0xdc6c, 0x4163, 0xa369, 0x7b69, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe4ac, 0xec8c, 0x4163, 0xa389, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7266, 0xdc4b, 0x4163, 0x7348, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x4164, 0x83ef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd70, 0xd658, 0x3985, 0x7bef, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xd679, 0x51e6, 0x9470, 0x9cd2, 0x94d3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x726a, 0xecee, 0xeccc, 0xf4ed, 0xecee, 0x9cd2, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xce17, 0xfd2e, 0xfd0d, 0xfd0d, 0xf4ed, 0x9cd2, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a25, 0xc3eb, 0xecac, 0x6205, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xeccc,
-  0xbbeb, 0xab89, 0xdc6c, 0xe48c, 0xab89, 0x7b48, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xbbea, 0x4143, 0x4163, 0x3922, 0x4163, 0x7328, 0x7328, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x6205, 0xcbea, 0x3943, 0x6b08, 0x7369, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xbbca, 0xe48c, 0x4163, 0x7349, 0x7349, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xec8c, 0x4164, 0x7bce, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfd0d, 0xe4cd, 0x4164, 0x83ef, 0x9491, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd70, 0xd658, 0x3985, 0x8410, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xd69a, 0x4185, 0x8bef, 0x9471, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x728b, 0xc5f8, 0x3944, 0x7882, 0x8925, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0x9cd3, 0x3123, 0x4a08, 0x8c30, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4ed, 0xfced, 0xc44d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xec8c, 0xe4ad, 0xcdf6, 0x8430, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfd0d,
-  0xeccc, 0x59e6, 0x4184, 0x3144, 0x41a5, 0x8c92, 0x94b2, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xcdf7, 0xc618, 0x3964, 0x83ae, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x72ac, 0xc618, 0x4144, 0x78a2, 0x8925, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0x9cd3, 0x3123, 0x4a08, 0x8c30, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3,
-  0x5246, 0x5246, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5246, 0x5266, 0x5a66,
-  0x0861, 0x0820, 0x0000, 0x0000, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0020, 0x10a1, 0x5266,
-  0x5266, 0x0861, 0x0000, 0x1881, 0xc3ea, 0xdc4b, 0xdc4b, 0xe48c,
-  0xdc4b, 0xdc4b, 0xc3ea, 0x1881, 0x0000, 0x0861, 0x5266, 0x62a6,
-  0x6b07, 0x62a7, 0x3123, 0xa349, 0x6a05, 0x59e5, 0x6a25, 0xe46c,
-  0x6a25, 0x59e4, 0x6a05, 0xa349, 0x3123, 0x62a7, 0x6b07, 0x62c7,
-  0x6b28, 0x6b07, 0x3943, 0xe46c, 0xb3ca, 0xa369, 0xb3aa, 0xbbeb,
-  0xb3aa, 0xa369, 0xb3ca, 0xe46c, 0x4163, 0x6b07, 0x6b08, 0x62e7,
-  0x6b28, 0x6b08, 0x4984, 0xe48c, 0xc3eb, 0x6a05, 0xb3aa, 0xc40b,
-  0xb3aa, 0x6a05, 0xbbea, 0xecac, 0x61e5, 0x6b28, 0x6b08, 0x6ae7,
-  0x6b28, 0x7b49, 0xb3aa, 0xf4ed, 0xf4cd, 0xbbca, 0xbbeb, 0xecac,
-  0xc3eb, 0xbbca, 0xf4cd, 0xf4ed, 0xb3ca, 0x7b49, 0x6b28, 0x6ae7,
-  0x6b28, 0x7b69, 0xbbeb, 0xf4ed, 0xfd0d, 0xe48c, 0xcc2b, 0xf4ed,
-  0xcc2b, 0xe48c, 0xfd0d, 0xf4ed, 0xbbeb, 0x7b69, 0x6b28, 0x6ae7,
-  0x7328, 0x7349, 0x8ba9, 0xeccd, 0xecac, 0x7246, 0xdc4b, 0xecac,
-  0xdc4b, 0x7246, 0xecac, 0xeccd, 0x8ba9, 0x7349, 0x6b28, 0x6ae7,
-  0x6b08, 0x7348, 0x838a, 0xc3eb, 0xf4cd, 0xb3aa, 0x6205, 0x59c4,
-  0x6205, 0xb3aa, 0xf4cd, 0xc40b, 0x838a, 0x7348, 0x6b08, 0x6ae7,
-  0x6b08, 0x7369, 0x8c2f, 0xbc2d, 0xf4ed, 0xf4cd, 0xbbca, 0xab8a,
-  0xbbca, 0xf4cd, 0xf4ed, 0xc42d, 0x8c2f, 0x736a, 0x6b07, 0x62c7,
-  0x6b29, 0x8c71, 0x9492, 0xd658, 0xf54f, 0xfced, 0xf4cd, 0xcc2b,
-  0xf4cd, 0xfced, 0xf54f, 0xd658, 0x9492, 0x8c71, 0x7329, 0x62e7,
-  0x8c30, 0x94b2, 0x8c51, 0x94b2, 0xde99, 0xfd6f, 0xfd0d, 0xfced,
-  0xfd0d, 0xfd6f, 0xde99, 0x94b2, 0x8c71, 0x94d3, 0x9492, 0x8c30,
-  0x94b3, 0x94d3, 0x94b2, 0x9492, 0xdedb, 0xde58, 0xeccd, 0xecac,
-  0xeccd, 0xde58, 0xdedb, 0x9492, 0x9451, 0x9451, 0x94b3, 0x94b3,
-  0x94d3, 0x94d3, 0x94b3, 0x9cf3, 0xce59, 0x728b, 0x5987, 0x5987,
-  0x5987, 0x6a8b, 0xce59, 0x9cb2, 0x80e4, 0x8924, 0x9471, 0x94d3,
-  0x94d3, 0x94d3, 0x94b3, 0x94d3, 0xa514, 0xc618, 0x526a, 0x4126,
-  0x526a, 0xc618, 0xa534, 0x8c92, 0x5a69, 0x8c10, 0x94b3, 0x94d3
-};
-
-const Animation charlie_chaplinAnimation = {
-  .name = "Charlie Chaplin",
-  .frameCount = 25,
-  .width = 16,
-  .height = 16,
-  .frameDurations = charlie_chaplinDurations,
-  .animationFrames = charlie_chaplinFrames
-};
-#endif // ANIMATION_CHARLIE_CHAPLIN_H
@@ -1,534 +0,0 @@
-// chip.h - Auto-generated from chip.json
-#ifndef ANIMATION_CHIP_H
-#define ANIMATION_CHIP_H
-
-#include "animation_types.h"
-
-// Frame Durations for chip (in 100ms units)
-static const uint8_t PROGMEM chipDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for chip
-static const uint16_t PROGMEM chipFrames[] = {
-  0x0420, 0x0420, 0x0420, 0x0420, 0x01a0, 0x0420, 0x0420, 0x01a0,
-  0x0420, 0x01a0, 0x01a0, 0x01a0, 0x0420, 0x0420, 0x01a0, 0x0420,
-  0x0420, 0x0420, 0x0420, 0x0420, 0x01a0, 0x01a0, 0x0420, 0x01a0,
-  0x0420, 0x01a0, 0x0420, 0x0420, 0x0420, 0x0420, 0x01a0, 0x0420,
-  0x01a0, 0x01a0, 0x01a0, 0x0420, 0x0420, 0x01a0, 0x0420, 0x01a0,
-  0x0420, 0x01a0, 0x0420, 0x01a0, 0x01a0, 0x01a0, 0x01a0, 0x0420,
-  0x0420, 0x0420, 0x01a0, 0x0420, 0x0420, 0xc659, 0x0420, 0xc659,
-  0x0420, 0xc659, 0x0420, 0xc659, 0x0420, 0x0420, 0x0420, 0x0420,
-  0x0420, 0x0420, 0x01a0, 0xc659, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x18e4, 0x0420, 0x01a0, 0x01a0, 0x01a0,
-  0x01a0, 0x0420, 0x0420, 0x0420, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x8431, 0x01a0, 0x0420, 0x0420,
-  0x01a0, 0x01a0, 0x01a0, 0xc659, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x0420, 0x0420, 0x0420, 0x01a0,
-  0x0420, 0x0420, 0x0420, 0x0420, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x8431, 0x01a0, 0x01a0, 0x01a0,
-  0x01a0, 0x01a0, 0x01a0, 0xc659, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x0420, 0x0420, 0x0420, 0x0420,
-  0x0420, 0x0420, 0x0420, 0x0420, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x8431, 0x01a0, 0x01a0, 0x01a0,
-  0x0420, 0x01a0, 0x01a0, 0xc659, 0x4208, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e4, 0x0420, 0x0420, 0x0420, 0x0420,
-  0x0420, 0x01a0, 0x0420, 0x0420, 0x18e4, 0x18e4, 0x18e4, 0x18e4,
-  0x18e4, 0x18e4, 0x18e4, 0x18e4, 0x8431, 0x01a0, 0x01a0, 0x0420,
-  0x01a0, 0x01a0, 0x0420, 0x0420, 0x8431, 0x0420, 0x8431, 0x0420,
-  0x8431, 0x0420, 0x8431, 0x0420, 0x0420, 0x0420, 0x01a0, 0x0420,
-  0x0420, 0x0420, 0x0420, 0x01a0, 0x01a0, 0x0420, 0x01a0, 0x0420,
-  0x01a0, 0x0420, 0x01a0, 0x0420, 0x0420, 0x0420, 0x01a0, 0x0420,
-  0x0420, 0x01a0, 0x01a0, 0x01a0, 0x0420, 0x0420, 0x01a0, 0x0420,
-  0x01a0, 0x0420, 0x01a0, 0x01a0, 0x01a0, 0x0420, 0x01a0, 0x01a0,
-  0x0420, 0x01a0, 0x0420, 0x0420, 0x0420, 0x01a0, 0x01a0, 0x0420,
-  0x01a0, 0x0420, 0x0420, 0x0420, 0x01a0, 0x0420, 0x0420, 0x0420,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x05e0, 0x05e0, 0x05e0, 0x0dc1, 0x552a, 0x15c2, 0x0dc1, 0x554a,
-  0x15a2, 0x5d2b, 0x5d0b, 0x552a, 0x05c0, 0x0dc1, 0x550a, 0x0c21,
-  0x0dc1, 0x0e01, 0x0e00, 0x0e20, 0x666b, 0x5e4b, 0x1622, 0x5e2b,
-  0x1622, 0x5e4b, 0x1602, 0x0de1, 0x0de1, 0x1602, 0x662c, 0x0c41,
-  0x552a, 0x662c, 0x55aa, 0x0782, 0x1783, 0x5e0b, 0x1743, 0x5e0b,
-  0x1743, 0x5e0b, 0x1743, 0x5dcb, 0x558b, 0x55aa, 0x5e2b, 0x0c41,
-  0x0dc1, 0x15e2, 0x558b, 0x1772, 0x17d4, 0xb7bc, 0x2fd5, 0xb7bc,
-  0x2fd5, 0xb7bc, 0x2fd5, 0xb7bc, 0x1fb3, 0x1763, 0x1602, 0x0c41,
-  0x05c0, 0x05e0, 0x4da9, 0x4dee, 0x0fbd, 0x17bf, 0x07bf, 0x17bf,
-  0x07bf, 0x17bf, 0x07bf, 0x17fe, 0x1fb6, 0x55cb, 0x5e2b, 0x54ea,
-  0x550a, 0x1602, 0x1743, 0x1fb4, 0x07be, 0x05bf, 0x057f, 0x057f,
-  0x057f, 0x057f, 0x059f, 0x17bf, 0xb7bc, 0x5dcb, 0x0dc1, 0x1462,
-  0x5d2b, 0x5e4b, 0x5e0b, 0xb7bc, 0x17bf, 0x057f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x057f, 0x07be, 0x2fd6, 0x1743, 0x1602, 0x54ea,
-  0x15a2, 0x1622, 0x1743, 0x2fd5, 0x07be, 0x057f, 0x053f, 0x055f,
-  0x055f, 0x053f, 0x057f, 0x17bf, 0xb7bc, 0x5e0b, 0x5e4b, 0x5d2b,
-  0x552a, 0x5e4b, 0x5e0b, 0xb7bb, 0x17bf, 0x057f, 0x053f, 0x055f,
-  0x055f, 0x053f, 0x057f, 0x07be, 0x2fd6, 0x1743, 0x1622, 0x15a2,
-  0x0dc1, 0x1622, 0x1743, 0x2fd5, 0x07be, 0x057f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x057f, 0x17bf, 0xb7bc, 0x5e0b, 0x5e4b, 0x554a,
-  0x0de1, 0x5e4b, 0x5e0b, 0xb7bc, 0x17bf, 0x05bf, 0x057f, 0x057f,
-  0x057f, 0x057f, 0x05bf, 0x07bf, 0x2fd6, 0x1743, 0x1622, 0x0dc1,
-  0x15c2, 0x668c, 0x1783, 0x17d4, 0x17df, 0x07bf, 0x17bf, 0x07be,
-  0x17bf, 0x07be, 0x17bf, 0x17df, 0xb7bc, 0x5e0b, 0x5e4b, 0x0de1,
-  0x552a, 0x5e6b, 0x07c2, 0x1fb3, 0xb7bc, 0x2fd5, 0xb7bb, 0x2fd5,
-  0xb7bb, 0x2fd5, 0xb7bc, 0x17d5, 0x17d2, 0x1783, 0x668b, 0x0de1,
-  0x0dc1, 0x1642, 0x1762, 0x55cc, 0x5dcb, 0x1743, 0x5e0b, 0x1743,
-  0x5e0b, 0x1743, 0x5e0b, 0x1784, 0x07c2, 0x0fa1, 0x668c, 0x15c2,
-  0x0de1, 0x5e4b, 0x668c, 0x664b, 0x0de1, 0x1601, 0x5e4b, 0x1622,
-  0x5e2b, 0x1622, 0x5e4b, 0x668c, 0x5e6b, 0x1622, 0x5e4b, 0x554a,
-  0x0dc1, 0x552a, 0x15c2, 0x0de1, 0x0dc1, 0x550a, 0x5d2b, 0x15a2,
-  0x552a, 0x0dc1, 0x0de1, 0x15c2, 0x552a, 0x0dc1, 0x0de1, 0x0dc1,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03c0, 0x03c0, 0x0282, 0x03c0, 0x0282,
-  0x03c0, 0x0282, 0x03c0, 0x0282, 0x0200, 0x0200, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x0402, 0x0443, 0x0676, 0x0465, 0x0656,
-  0x0465, 0x0656, 0x0465, 0x0656, 0x0402, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0282, 0x0656, 0x32a9, 0x3a49, 0x3207, 0x3249,
-  0x3207, 0x3249, 0x3207, 0x19c6, 0x0400, 0x0220, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x0465, 0x3a07, 0x0821, 0x0020, 0x0000,
-  0x0020, 0x0000, 0x0821, 0x1943, 0x0640, 0x0280, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0282, 0x0676, 0x3249, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1923, 0x0460, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03c0, 0x0485, 0x3227, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1963, 0x0640, 0x0280, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0282, 0x0676, 0x3249, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1923, 0x0460, 0x03c0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03c0, 0x0485, 0x3227, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1963, 0x0640, 0x0280, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0282, 0x0676, 0x3229, 0x0820, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1923, 0x0460, 0x03c0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x0422, 0x19c3, 0x1923, 0x1963, 0x1923,
-  0x1963, 0x1923, 0x1963, 0x19c3, 0x0640, 0x0280, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0420, 0x0640, 0x0460, 0x0640, 0x0460,
-  0x0640, 0x0460, 0x0640, 0x0420, 0x0440, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03a0, 0x0200, 0x0280, 0x03c0, 0x0280, 0x03c0,
-  0x0280, 0x03c0, 0x0280, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03c0, 0x0200,
-  0x03a0, 0x01c0, 0x01c0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0281, 0x03c0, 0x0281,
-  0x03a0, 0x0281, 0x03a0, 0x0421, 0x03e0, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x01e0, 0x03c0, 0x0441, 0x16b0, 0x04a3, 0x16b0,
-  0x04a3, 0x16b0, 0x04c3, 0x16d0, 0x0282, 0x01e0, 0x0220, 0x03e0,
-  0x03e0, 0x03a0, 0x0282, 0x1402, 0x1422, 0x8db3, 0x2445, 0x8db3,
-  0x2445, 0x8db3, 0x2445, 0x8d93, 0x0c02, 0x0380, 0x03a0, 0x03c0,
-  0x03e0, 0x0441, 0x16b0, 0x8db3, 0x4a69, 0x4228, 0x3a07, 0x4228,
-  0x3a07, 0x4228, 0x39e7, 0x29a5, 0x0ba2, 0x0281, 0x0200, 0x0200,
-  0x01e0, 0x03a0, 0x04c3, 0x2445, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5c2d, 0x0e8f, 0x0421, 0x03a0,
-  0x01c0, 0x0261, 0x16b0, 0x8db3, 0x4228, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1be3, 0x04a3, 0x03c0, 0x0200,
-  0x03a0, 0x03a0, 0x04a3, 0x2445, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2104, 0x5c2d, 0x0e8f, 0x0281, 0x01c0,
-  0x0200, 0x0281, 0x16b0, 0x8db3, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1be3, 0x04a3, 0x03a0, 0x03a0,
-  0x03c0, 0x03c0, 0x04a3, 0x2445, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2104, 0x5c2d, 0x0e8f, 0x0281, 0x0200,
-  0x03e0, 0x0281, 0x16b0, 0x8dd3, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1be3, 0x04a3, 0x03c0, 0x03c0,
-  0x0380, 0x0200, 0x0421, 0x1402, 0x2964, 0x1903, 0x2104, 0x1923,
-  0x2104, 0x1923, 0x2104, 0x2144, 0x5c2d, 0x0e8f, 0x0281, 0x03c0,
-  0x0200, 0x0200, 0x03c0, 0x0be1, 0x5c2d, 0x1be3, 0x5c2d, 0x1be3,
-  0x5c2d, 0x1be3, 0x5c2d, 0x0be2, 0x0c21, 0x0421, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x0380, 0x0261, 0x0e8f, 0x04a3, 0x0e8f, 0x04a3,
-  0x0e8f, 0x04a3, 0x0e8f, 0x0421, 0x03c0, 0x03c0, 0x0200, 0x0380,
-  0x03e0, 0x0220, 0x0200, 0x0200, 0x0421, 0x03c0, 0x0261, 0x03a0,
-  0x0281, 0x03c0, 0x0281, 0x0200, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x01c0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x0420, 0x03c0, 0x0200, 0x0421, 0x03e0, 0x0281,
-  0x03c0, 0x0261, 0x01e0, 0x0200, 0x03e0, 0x03e0, 0x0200, 0x03c0,
-  0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x0281, 0x06ae, 0x04a3, 0x06ae,
-  0x04a3, 0x06ae, 0x0421, 0x0420, 0x0461, 0x03a0, 0x0200, 0x03c0,
-  0x0200, 0x0200, 0x0261, 0x03c0, 0x0440, 0x0f23, 0x04c0, 0x0f23,
-  0x04c0, 0x0f23, 0x04c0, 0x0f23, 0x06ef, 0x0261, 0x0200, 0x03e0,
-  0x03c0, 0x0421, 0x06cf, 0x1483, 0x1422, 0x8db2, 0x2444, 0x8db1,
-  0x2444, 0x8db1, 0x2444, 0x8db2, 0x0c83, 0x0421, 0x03a0, 0x03c0,
-  0x03c0, 0x0440, 0x0f23, 0x8dd2, 0x4a69, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x2985, 0x0c23, 0x06ee, 0x0281, 0x0200,
-  0x0200, 0x0421, 0x04a0, 0x2444, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5c2c, 0x0f02, 0x0420, 0x03a0,
-  0x0241, 0x06ae, 0x0f23, 0x8db1, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1be3, 0x04a0, 0x0441, 0x0200,
-  0x03c0, 0x04a3, 0x04c0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2104, 0x5c2b, 0x0f02, 0x06ce, 0x0261,
-  0x0281, 0x06ae, 0x0f23, 0x8db1, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1be3, 0x04c0, 0x04a3, 0x03c0,
-  0x03e0, 0x04a3, 0x04c0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2104, 0x5c2b, 0x0f02, 0x06ae, 0x0281,
-  0x0441, 0x06ce, 0x0f23, 0x8db2, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13e3, 0x04c0, 0x04a3, 0x03e0,
-  0x03a0, 0x0281, 0x0420, 0x1402, 0x2965, 0x1903, 0x2104, 0x1923,
-  0x2104, 0x1923, 0x2104, 0x2144, 0x5c2b, 0x0f02, 0x06ce, 0x0441,
-  0x0200, 0x0200, 0x03e0, 0x0c62, 0x5c2c, 0x1be3, 0x5c2b, 0x1be3,
-  0x5c2b, 0x1be3, 0x5c2b, 0x0be1, 0x0c21, 0x0420, 0x0281, 0x03e0,
-  0x03c0, 0x03a0, 0x0401, 0x06cf, 0x0f02, 0x04a0, 0x0f02, 0x04c0,
-  0x0f02, 0x04c0, 0x0f02, 0x0440, 0x03c0, 0x03c0, 0x01e0, 0x0380,
-  0x03e0, 0x0200, 0x0200, 0x0281, 0x0420, 0x0421, 0x06ae, 0x04a3,
-  0x06ae, 0x04a3, 0x06ce, 0x0281, 0x0200, 0x03a0, 0x0220, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x03c0, 0x03c0, 0x0200, 0x0241, 0x03c0,
-  0x0281, 0x03e0, 0x0441, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0420, 0x0400, 0x0400, 0x03e0, 0x0281, 0x0420, 0x0461, 0x074f,
-  0x04c3, 0x070f, 0x0261, 0x01e0, 0x03e0, 0x03c0, 0x0200, 0x03c0,
-  0x03c0, 0x03e0, 0x0441, 0x0441, 0x06ce, 0x06e1, 0x04a0, 0x06c1,
-  0x04a0, 0x06e1, 0x0420, 0x03c0, 0x0460, 0x0421, 0x0200, 0x03c0,
-  0x01e0, 0x0281, 0x06ce, 0x0461, 0x0461, 0x0c82, 0x0420, 0x0c81,
-  0x0420, 0x0c81, 0x0420, 0x0c82, 0x0701, 0x06ce, 0x0261, 0x03c0,
-  0x03c0, 0x0420, 0x0701, 0x1482, 0x1402, 0x8d52, 0x2444, 0x8d52,
-  0x2444, 0x8d52, 0x2444, 0x8d51, 0x0c82, 0x04a1, 0x0441, 0x03e0,
-  0x03c0, 0x0400, 0x0c81, 0x8d72, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x2985, 0x0c01, 0x0701, 0x06ce, 0x0281,
-  0x0282, 0x0420, 0x0420, 0x2444, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bec, 0x0c61, 0x0441, 0x03a0,
-  0x070f, 0x06e1, 0x0c81, 0x8d52, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x0400, 0x0420, 0x02a1,
-  0x04c3, 0x04a0, 0x0420, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0c41, 0x06e1, 0x070f,
-  0x072f, 0x06e1, 0x0c81, 0x8d52, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x0420, 0x04a0, 0x04c3,
-  0x0461, 0x04a0, 0x0420, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0c41, 0x06e1, 0x074f,
-  0x0460, 0x06e1, 0x0c82, 0x8d52, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x0420, 0x04a0, 0x0461,
-  0x0421, 0x06ce, 0x0461, 0x13e2, 0x2985, 0x1903, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2104, 0x2164, 0x5bcc, 0x0c61, 0x06e1, 0x0460,
-  0x0200, 0x0261, 0x0400, 0x0c40, 0x5beb, 0x1bc3, 0x5bcb, 0x1bc3,
-  0x5bcb, 0x1bc3, 0x5bcc, 0x0bc1, 0x0c01, 0x0461, 0x06ce, 0x0461,
-  0x03c0, 0x0380, 0x0420, 0x0701, 0x0c61, 0x0400, 0x0c61, 0x0420,
-  0x0c41, 0x0420, 0x0c61, 0x0461, 0x03e0, 0x03e0, 0x0261, 0x03a0,
-  0x03e0, 0x0200, 0x0281, 0x06ce, 0x0441, 0x0420, 0x06e1, 0x04a0,
-  0x06e1, 0x04a0, 0x06e1, 0x06ce, 0x0281, 0x03a0, 0x0200, 0x0200,
-  0x03c0, 0x0200, 0x03a0, 0x0441, 0x03c0, 0x0281, 0x070f, 0x04c3,
-  0x072f, 0x0461, 0x0460, 0x0421, 0x0200, 0x03c0, 0x03e0, 0x03c0,
-  0x0400, 0x0400, 0x03e0, 0x0461, 0x0750, 0x0461, 0x0440, 0x06e0,
-  0x04a0, 0x0741, 0x0730, 0x0281, 0x03c0, 0x03c0, 0x0200, 0x03c0,
-  0x03e0, 0x0461, 0x0440, 0x0460, 0x06e1, 0x0420, 0x0400, 0x0420,
-  0x0400, 0x0420, 0x0441, 0x03a0, 0x0400, 0x0420, 0x0281, 0x03e0,
-  0x0261, 0x06ce, 0x0701, 0x0440, 0x0420, 0x0aa2, 0x03c0, 0x0a82,
-  0x03c0, 0x0a81, 0x03a0, 0x1282, 0x0420, 0x0701, 0x06ce, 0x0441,
-  0x03e0, 0x0441, 0x0420, 0x1422, 0x1402, 0x8d32, 0x2424, 0x8d32,
-  0x2424, 0x8d32, 0x2424, 0x8d31, 0x0c22, 0x0460, 0x04a1, 0x0462,
-  0x03c0, 0x03c0, 0x0a81, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0bc1, 0x0420, 0x06e1, 0x074f,
-  0x0280, 0x03e0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a61, 0x0420, 0x04a3,
-  0x06c0, 0x0420, 0x0a81, 0x8d31, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x0441, 0x074f,
-  0x04a0, 0x0400, 0x03c0, 0x2424, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bab, 0x0a61, 0x0420, 0x0741,
-  0x06e0, 0x0420, 0x0a81, 0x8d31, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x0400, 0x04a0,
-  0x0460, 0x0400, 0x03c0, 0x2424, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bab, 0x0a61, 0x0420, 0x06e0,
-  0x0400, 0x0420, 0x0aa1, 0x8d32, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x0400, 0x0460,
-  0x0420, 0x06e1, 0x0440, 0x13e2, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bac, 0x0a61, 0x0420, 0x0400,
-  0x0281, 0x06ce, 0x0461, 0x0be0, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0be1, 0x0420, 0x0701, 0x0460,
-  0x03e0, 0x0421, 0x0461, 0x0420, 0x0a61, 0x03a0, 0x0a61, 0x03a0,
-  0x0a61, 0x03a0, 0x0a61, 0x0440, 0x0461, 0x0461, 0x06ce, 0x0421,
-  0x03c0, 0x0261, 0x06ce, 0x0701, 0x0420, 0x0441, 0x0420, 0x0400,
-  0x0420, 0x0400, 0x0420, 0x06e1, 0x06ce, 0x0421, 0x0261, 0x0200,
-  0x03c0, 0x0200, 0x0421, 0x0460, 0x0461, 0x0750, 0x0741, 0x04a0,
-  0x06e0, 0x0460, 0x0400, 0x0420, 0x0281, 0x03e0, 0x03c0, 0x03c0,
-  0x0400, 0x0400, 0x0400, 0x0460, 0x06e0, 0x0420, 0x0440, 0x06c0,
-  0x0440, 0x0420, 0x0741, 0x0750, 0x0461, 0x03e0, 0x0281, 0x03e0,
-  0x0461, 0x0460, 0x0420, 0x0420, 0x0420, 0x0240, 0x03a0, 0x0280,
-  0x03a0, 0x0220, 0x0420, 0x0421, 0x03c0, 0x0441, 0x06ce, 0x0461,
-  0x0750, 0x0701, 0x0420, 0x0400, 0x03e0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03a0, 0x1261, 0x0220, 0x0420, 0x0701, 0x0460,
-  0x0461, 0x0420, 0x0220, 0x1402, 0x1402, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03e0, 0x0440, 0x0460,
-  0x0460, 0x03c0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0220, 0x0400, 0x06e0,
-  0x06e0, 0x0420, 0x03a0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03e0, 0x04a0,
-  0x0420, 0x0240, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x0420, 0x06e0,
-  0x03e0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0240, 0x0420,
-  0x03e0, 0x0240, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03e0,
-  0x0400, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0240, 0x03e0,
-  0x03c0, 0x0220, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x0400,
-  0x0461, 0x0420, 0x03e0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bac, 0x0a41, 0x0220, 0x03e0,
-  0x0750, 0x0701, 0x0440, 0x0bc1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03e0, 0x0420, 0x0400,
-  0x0461, 0x04c1, 0x0440, 0x0220, 0x0a41, 0x03a0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03e0, 0x0440, 0x0460, 0x0701, 0x0440,
-  0x0441, 0x06ae, 0x06e1, 0x0420, 0x03e0, 0x0420, 0x0240, 0x03a0,
-  0x0240, 0x03a0, 0x0220, 0x0420, 0x06e1, 0x04a1, 0x06ae, 0x02a1,
-  0x03e0, 0x0281, 0x0420, 0x0400, 0x0460, 0x06e0, 0x0420, 0x03e0,
-  0x03e0, 0x0400, 0x03c0, 0x0461, 0x0750, 0x0462, 0x0441, 0x03e0,
-  0x0400, 0x0400, 0x0400, 0x0400, 0x03c0, 0x03e0, 0x03c0, 0x0200,
-  0x03a0, 0x0200, 0x0420, 0x0700, 0x0460, 0x0461, 0x074f, 0x0482,
-  0x0460, 0x0400, 0x03e0, 0x03e0, 0x0220, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03c0, 0x0420, 0x03c0, 0x0420, 0x06e1, 0x0460,
-  0x06e0, 0x0420, 0x0220, 0x03c0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0240, 0x0420, 0x0420,
-  0x0460, 0x03e0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03c0, 0x0400,
-  0x0400, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0220, 0x03e0,
-  0x03c0, 0x03c0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x0400,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03c0, 0x03c0,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03c0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0420, 0x0240, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x06e0, 0x0420, 0x0400, 0x0bc1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0220, 0x03c0,
-  0x0460, 0x0460, 0x03e0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x0400, 0x0400, 0x0440, 0x0461,
-  0x0460, 0x06e1, 0x0420, 0x0220, 0x03a0, 0x03c0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0220, 0x0420, 0x0440, 0x06e1, 0x074f,
-  0x0462, 0x072f, 0x0461, 0x03c0, 0x0400, 0x03c0, 0x0200, 0x03a0,
-  0x0200, 0x03c0, 0x03c0, 0x0420, 0x06e0, 0x0460, 0x0440, 0x0461,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x0200, 0x03e0, 0x0400, 0x0460, 0x06e0, 0x0460,
-  0x0400, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03c0, 0x03c0, 0x03e0, 0x0420, 0x0400,
-  0x03e0, 0x0220, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0240, 0x03e0,
-  0x0400, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x03c0, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x03c0, 0x0240, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x0400, 0x03e0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03e0, 0x0240, 0x0420,
-  0x0420, 0x0420, 0x0240, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0240, 0x03c0, 0x0420, 0x06e0,
-  0x0460, 0x06e0, 0x0420, 0x03c0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03c0, 0x03c0, 0x0400, 0x0420, 0x0460,
-  0x0400, 0x0400, 0x0420, 0x03e0, 0x0200, 0x03a0, 0x03e0, 0x0200,
-  0x03a0, 0x01e0, 0x01c0, 0x0200, 0x03e0, 0x0420, 0x03e0, 0x0400,
-  0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x0200, 0x03a0, 0x0200,
-  0x03a0, 0x0200, 0x03a0, 0x03a0, 0x03c0, 0x03a0, 0x0220, 0x03c0,
-  0x0200, 0x0200, 0x0200, 0x03e0, 0x03c0, 0x0a62, 0x03a0, 0x0a62,
-  0x03a0, 0x0a62, 0x03c0, 0x1262, 0x0200, 0x0200, 0x0200, 0x03e0,
-  0x03e0, 0x03a0, 0x0200, 0x13e2, 0x1422, 0x8d52, 0x2424, 0x8d32,
-  0x2424, 0x8d52, 0x2424, 0x8d31, 0x0c02, 0x03a0, 0x03a0, 0x03c0,
-  0x03e0, 0x03e0, 0x0a61, 0x8d32, 0x4a89, 0x4228, 0x3a07, 0x4229,
-  0x3a07, 0x4229, 0x39e7, 0x29a5, 0x0ba1, 0x0200, 0x0200, 0x0200,
-  0x0200, 0x03a0, 0x03c0, 0x2424, 0x3a07, 0x0821, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x2104, 0x5bac, 0x0a41, 0x03a0, 0x03a0,
-  0x01e0, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03c0, 0x03a0, 0x0200,
-  0x03a0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x01e0,
-  0x0200, 0x0200, 0x0a61, 0x8d51, 0x4229, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x1bc3, 0x03a0, 0x03a0, 0x03a0,
-  0x03c0, 0x03a0, 0x03a0, 0x2444, 0x3a07, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0x5bcb, 0x0a41, 0x0200, 0x0200,
-  0x03e0, 0x0200, 0x0a61, 0x8d52, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1903, 0x13c3, 0x03a0, 0x03a0, 0x03c0,
-  0x0380, 0x0200, 0x03a0, 0x1402, 0x2985, 0x1923, 0x2124, 0x1923,
-  0x2124, 0x1923, 0x2124, 0x2164, 0x5bcc, 0x0a41, 0x0200, 0x03e0,
-  0x0200, 0x0200, 0x03e0, 0x0be1, 0x5bab, 0x1bc3, 0x5bab, 0x1bc3,
-  0x5bab, 0x1bc3, 0x5bac, 0x0bc1, 0x0c01, 0x03a0, 0x0200, 0x03c0,
-  0x03c0, 0x03a0, 0x03a0, 0x0200, 0x0a41, 0x03c0, 0x0a41, 0x03a0,
-  0x0a41, 0x03a0, 0x0a41, 0x03a0, 0x03e0, 0x03c0, 0x0200, 0x03c0,
-  0x03e0, 0x0240, 0x0200, 0x0200, 0x03a0, 0x03a0, 0x0200, 0x03a0,
-  0x0200, 0x03a0, 0x0200, 0x0200, 0x0200, 0x03a0, 0x0240, 0x03c0,
-  0x0400, 0x03c0, 0x03c0, 0x03e0, 0x03e0, 0x0200, 0x01e0, 0x03a0,
-  0x0200, 0x03c0, 0x03e0, 0x03a0, 0x0200, 0x03c0, 0x03e0, 0x0400
-};
-
-const Animation chipAnimation = {
-  .name = "Chip",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = chipDurations,
-  .animationFrames = chipFrames
-};
-#endif // ANIMATION_CHIP_H
@@ -1,534 +0,0 @@
-// christmas_tree.h - Auto-generated from christmas_tree.json
-#ifndef ANIMATION_CHRISTMAS_TREE_H
-#define ANIMATION_CHRISTMAS_TREE_H
-
-#include "animation_types.h"
-
-// Frame Durations for christmas_tree (in 100ms units)
-static const uint8_t PROGMEM christmas_treeDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for christmas_tree
-static const uint16_t PROGMEM christmas_treeFrames[] = {
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xffe0,
-  0xffe0, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xffe0,
-  0xffe0, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf, 0x0220,
-  0x0220, 0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0220, 0xd6ba,
-  0x0440, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0220, 0x0440, 0x0220,
-  0xd6ba, 0xd6ba, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0220, 0x0440,
-  0x0220, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x02bf, 0x0220, 0x0220, 0x0440,
-  0x0440, 0x0440, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0220, 0x0440, 0x0440, 0x0220,
-  0xd6ba, 0xd6ba, 0xd6ba, 0x0220, 0x02bf, 0x02bf, 0xe77f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0220, 0x0440, 0x0440,
-  0x0220, 0x0220, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0xe77f, 0x02bf, 0x0220, 0x0220, 0xd6ba, 0x0440,
-  0x0440, 0x0440, 0x0440, 0x0220, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xffff, 0x02bf, 0x02bf, 0x0220, 0x0440, 0x0440, 0x0220, 0xd6ba,
-  0x0440, 0x0440, 0x0440, 0x0440, 0x0220, 0xe77f, 0x02bf, 0xffff,
-  0xffff, 0xffff, 0x02bf, 0x02bf, 0x0220, 0x0220, 0x0220, 0x0220,
-  0x0220, 0x0220, 0x0220, 0x0220, 0x02bf, 0x02bf, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x2080, 0x6980,
-  0x6980, 0x2080, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x131f, 0x02bf, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x12ff, 0xa5ff, 0x12ff, 0x0afd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x12ff, 0x9dff, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x131f, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x131f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0x9dfa, 0x2306, 0x9552,
-  0x2444, 0x12a6, 0x029a, 0x12ff, 0xa5ff, 0x131f, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x12c7, 0x03a0, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x12ff, 0x131f, 0x9dff, 0x131f,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x0278, 0x0262, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x029f, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x131f, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x12ff, 0xa5fd, 0x12c7, 0x03a0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x0298, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x029f, 0x12ff, 0xae3f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x02bf, 0x237f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x235b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xae5f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x131f, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x12ff, 0xa5ff, 0x131f, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x12ff, 0x131f, 0xae5f,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x12c7, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x029f,
-  0x12ff, 0x02bf, 0x029f, 0x12ff, 0xa5d8, 0x12e2, 0x1422, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0xc6bf, 0x12ff, 0x029f, 0x029a, 0x12a4, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xef7f, 0x2b7f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0xbe9f, 0x131f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029f, 0x0afd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xae5f, 0x131f, 0x029f, 0x029f, 0x12ff, 0xa5ff, 0x12fb, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x12fa, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x02bf, 0x12ff, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x029f, 0x12ff, 0x9dff, 0x131f,
-  0xae5f, 0x131f, 0x029f, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x12ff, 0x02bf,
-  0x131f, 0x02bf, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x12ff, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xef7f, 0xc6bf, 0x0afd, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xef9f, 0x2b9f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xe77f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x131f, 0x02bf, 0x02bf, 0x029f, 0x131f, 0xae5f, 0x12ff,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x131f, 0x9dff, 0x131f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x235a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x9dff, 0x131f, 0x029f, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x02bf, 0x131f,
-  0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x029f, 0x029f, 0x12ff, 0xae5f,
-  0x131f, 0x9dff, 0x131f, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x1288, 0x12fc, 0x02bf, 0x02bf, 0x131f,
-  0x029f, 0x12ff, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x12f8, 0xa5ff, 0x131f, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x029f, 0x029a, 0x0264, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x12fa, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x2b7f, 0x12dd, 0x0266, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xef9f, 0xc6df, 0x237a, 0x1ac5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffff, 0xffdf, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x12ff,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x12ff, 0xb65d,
-  0x237d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x029f, 0x2b7a, 0xef84,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0xae5f, 0x131f, 0x12ff, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x029f, 0x029f, 0x02bf,
-  0x12ff, 0x131f, 0xa5ff, 0x131f, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x131f, 0x02bf, 0x029f,
-  0x12ff, 0x02bf, 0x12ff, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x12fa, 0xa5ff, 0x12ff, 0x12ff,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x12dd, 0x2b7f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x237f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x029f, 0x131f, 0xae5f, 0x131f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0x02bf, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x12ff, 0xa5ff, 0x12ff, 0x0afd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x131f, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x02bf, 0x131f, 0x02bf, 0x027d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x12ff, 0x9dff, 0x131f, 0x12ff, 0x0298, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x12ff, 0x131f, 0xa5fa, 0x12c4, 0x0a82, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x12ff, 0x131f,
-  0xd71f, 0x237f, 0x029d, 0x0aa6, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x0add, 0xc6bf, 0xef9f,
-  0xffff, 0xdf3f, 0x2b7f, 0x12fa, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b9f, 0xef7f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xe77f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x131f, 0x02bf, 0x029f,
-  0x12ff, 0xae5f, 0x131f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0x9dff, 0x12ff, 0x12fd,
-  0x131d, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x12ff, 0x2b7a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x12fd, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x235b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x131f, 0x0298, 0x0262, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x12ff, 0xa5fa, 0x12c4, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029d, 0x12c7, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x12ff, 0x12ff, 0xa5ff, 0x12fa, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x2b7f, 0x12dd, 0x0266, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x237f, 0x131a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x131f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x131d,
-  0x12fd, 0x12ff, 0x9dff, 0x131f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xc6da, 0xef84,
-  0xdf04, 0x2b7a, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x12fd, 0xd707, 0xffe0,
-  0xffe0, 0xcec6, 0x235d, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x237b, 0xd702,
-  0xd702, 0x33da, 0xa5ff, 0x131f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xa5ff, 0x12fb, 0x22e4,
-  0x12c1, 0x029a, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12fa, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x131f, 0xae3f, 0x131f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x02bf, 0x131f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x131d, 0x0aff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x027a, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x22e8, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x2304, 0xa5f8, 0x131f, 0x029f, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x12e4, 0x029a, 0x029f, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x12dd, 0x2b7f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ac5, 0x237a, 0xc6df, 0xef9f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xffdf, 0xffff, 0xffff,
-  0x029f, 0x02bf, 0x131f, 0x02bf, 0x02bf, 0x029f, 0x131f, 0xae3f,
-  0x12ff, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x12ff, 0x9dff, 0x131f, 0x029f, 0x029f, 0x02bf, 0x235d,
-  0x131d, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x237a, 0xd704,
-  0xdf24, 0x237a, 0x029f, 0x02bf, 0x131f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x0afd, 0x0aff, 0xa5ff, 0x131f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x237a, 0x029f, 0x02bf, 0x0aff, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x02bf, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x131f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x027c, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x131f, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x12e4, 0xa5fa, 0x12ff, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03c0, 0x0aa6, 0x029d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x12fa, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x131f, 0xae5f, 0x131f,
-  0x12ff, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x131f, 0xbe9f,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x12ff, 0x237d,
-  0xb65d, 0x12ff, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x235a, 0xdf24,
-  0xef84, 0x2b7a, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6a6, 0x12fd, 0x029f, 0x02bf, 0x131f, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x237b, 0xd702,
-  0xdf02, 0x3bda, 0x02bf, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x2301, 0x9dda, 0x12ff, 0x029f, 0x02bf, 0x0aff, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x2306, 0x029a, 0x02bf, 0x02bf, 0x12ff, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5b4, 0xa594, 0x0a88, 0x029c, 0x12ff, 0xa5ff, 0x131f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x12ff, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x029f, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x131f, 0x02bf, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0aa6, 0x9ddd, 0x3bdf, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x3bdf, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xe77f, 0xffdf, 0xffff,
-  0x131f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x12ff,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xae3f, 0x131f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xb65d,
-  0x237d, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x2b7a, 0xef64,
-  0xef84, 0xc6da, 0x131f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x12ff, 0x9dff, 0x235d, 0xc6a7, 0xffe0,
-  0xffe0, 0xd706, 0x131d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x237b, 0xd702,
-  0xdf02, 0x235a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x131f, 0x02bf, 0x029f, 0x12ff, 0x9dff, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x1c24, 0x2306, 0xa5fa, 0x131f, 0x029f, 0x02bf, 0x0aff, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5b4, 0xa5b4, 0x22e8, 0x029c, 0x02bf, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0278, 0x02bf, 0x029f, 0x12ff, 0x9dff, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x02bf, 0x12ff, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x9dff, 0x131f, 0x029f, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x2b7a, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x235d, 0xc6c7, 0xffe0,
-  0xffe0, 0xdf06, 0xb65d, 0x12ff, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xa5ff, 0x33db, 0xd6e2,
-  0xdf02, 0x2b7a, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x12ff, 0x029b, 0x22e4,
-  0x12c1, 0x027a, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x131f, 0x02bf, 0x029f, 0x12ff, 0xae5f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x22e8, 0x9dfc, 0x131f, 0x029f, 0x02bf, 0x12ff,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x02bf, 0x029f, 0x12ff, 0xae5f,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x02bf, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x02bf, 0x02bf, 0x029f, 0x029f,
-  0x131f, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x0284, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0xbe9f, 0x131f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x131f, 0xae5f, 0x131f, 0x029f, 0x02bf, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x02bf, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x2b7a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xc6c6, 0x131d, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf, 0x33db, 0xd702,
-  0xdf02, 0x235a, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12ff, 0xa5fb, 0x3344,
-  0x12a1, 0x027a, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x029a, 0x2306, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0xae5f, 0x131f, 0x029f, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x131f, 0x02bf, 0x029f, 0x02bf,
-  0x12ff, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0278, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x02bf,
-  0x12ff, 0x02bf, 0x029f, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12a6, 0x029a, 0x12ff, 0x02bf, 0x029f, 0x02bf,
-  0xae5f, 0x131f, 0x029f, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x22e8, 0x029c, 0x02bf, 0x02bf, 0x02bf,
-  0x12ff, 0x02bf, 0x02bf, 0x02bf, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x2304, 0xa5f8, 0x131f, 0x029f, 0x029f, 0x029f,
-  0x12ff, 0x029f, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x12e4, 0x029a, 0x02bf, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03a0, 0x0246, 0x027d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x1b1a, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff,
-  0x02bf, 0x131f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x131f, 0x02bf, 0x02bf, 0x02bf,
-  0x131f, 0x9dff, 0x131f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x131d,
-  0x131d, 0x029f, 0x029f, 0x12ff, 0x9dff, 0x131f, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x029f, 0x029f, 0x029f, 0x237a, 0xdf24,
-  0xdf24, 0x237a, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x131f, 0x029f, 0x12fd, 0xc6a7, 0xffe0,
-  0xffe0, 0xcec6, 0x235d, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x12ff, 0xa5ff, 0x131f, 0x029f, 0x237b, 0xd702,
-  0xd702, 0x33da, 0xa5ff, 0x131f, 0x12ff, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x029b, 0x22e4,
-  0x12c1, 0x029a, 0x12ff, 0x131f, 0xa5ff, 0x131f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029a, 0x12a6, 0x9572,
-  0x2444, 0x12a6, 0x029a, 0x02bf, 0x12ff, 0x02bf, 0x029f, 0x02bf,
-  0x02bf, 0x12ff, 0x02bf, 0x02bf, 0x029d, 0x0267, 0x0380, 0x1b03,
-  0xa5d4, 0xa594, 0x0a88, 0x029c, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x9dff, 0x131f, 0x029f, 0x02bf, 0x0278, 0x0282, 0x03c0,
-  0x0ac1, 0x0aa3, 0x0298, 0x02bf, 0x02bf, 0x131f, 0x02bf, 0x02bf,
-  0x02bf, 0x0aff, 0x02bf, 0x02bf, 0x029a, 0x0264, 0x0260, 0x03e0,
-  0x1442, 0x1422, 0x12c6, 0x029a, 0x12ff, 0xa5ff, 0x131f, 0x029f,
-  0x02bf, 0x12ff, 0x02bf, 0x029d, 0x0267, 0x03c0, 0x03e0, 0x0ae1,
-  0xa5b4, 0xb616, 0xa594, 0x0a88, 0x029c, 0x12ff, 0x02bf, 0x02bf,
-  0x12ff, 0x9dff, 0x131f, 0x029f, 0x0278, 0x0282, 0x1442, 0x03e0,
-  0x12c2, 0x12a2, 0x12a4, 0x0298, 0x131f, 0x029f, 0x029f, 0x029f,
-  0x131f, 0x12ff, 0x02bf, 0x029a, 0x0244, 0x12a2, 0x9592, 0x24a4,
-  0x0400, 0x0400, 0x03e0, 0x12e4, 0xa5fa, 0x12ff, 0x029f, 0x131f,
-  0xd71f, 0x237f, 0x027d, 0x0246, 0x03a0, 0x03a0, 0x1ae4, 0x9592,
-  0x1442, 0x0400, 0x0400, 0x03c0, 0x0aa6, 0x029d, 0x237f, 0xd71f,
-  0xffff, 0xdf3f, 0x2b7f, 0x1b1a, 0x1ae5, 0x12c2, 0x0200, 0x1a62,
-  0x0a40, 0x0240, 0x12c2, 0x1ae5, 0x12fa, 0x2b7f, 0xdf3f, 0xffff,
-  0xffdf, 0xffdf, 0xef7f, 0xe77f, 0xe77d, 0xd6da, 0x3942, 0x5960,
-  0x5960, 0x3942, 0xd6da, 0xe77d, 0xe77f, 0xef7f, 0xffdf, 0xffff
-};
-
-const Animation christmas_treeAnimation = {
-  .name = "Christmas Tree",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = christmas_treeDurations,
-  .animationFrames = christmas_treeFrames
-};
-#endif // ANIMATION_CHRISTMAS_TREE_H
@@ -1,726 +0,0 @@
-// coffee.h - Auto-generated from coffee.json
-#ifndef ANIMATION_COFFEE_H
-#define ANIMATION_COFFEE_H
-
-#include "animation_types.h"
-
-// Frame Durations for coffee (in 100ms units)
-static const uint8_t PROGMEM coffeeDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for coffee
-static const uint16_t PROGMEM coffeeFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x0000,
-  0x0000, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x0000,
-  0x0000, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x0000,
-  0x0000, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x0000,
-  0x0000, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x0000,
-  0x0000, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0xbdb4, 0xffff,
-  0xffff, 0xbdb4, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0x59e0, 0x7aa2, 0x59e0,
-  0x4160, 0x6242, 0x3120, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0x59e0, 0x4160,
-  0x4160, 0x3120, 0xb596, 0xb596, 0x6b6d, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x0000, 0xb596, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x0000, 0xb596, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x0000, 0xb596, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x0000, 0xb596, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x6b6d, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0xffff, 0xffff, 0xc618,
-  0xc618, 0xc618, 0xb596, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x6b6d, 0x6b6d, 0x6b6d,
-  0x6b6d, 0x6b6d, 0x6b6d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x10a2, 0x3164,
-  0x18c3, 0x10a2, 0x2902, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0x9cd2, 0xde97,
-  0xd699, 0x9cd2, 0x732a, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a42,
-  0x5a02, 0x6243, 0x5224, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c1, 0x0020, 0x0000,
-  0x18c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020,
-  0x0000, 0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1,
-  0x0000, 0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x3984,
-  0x18c3, 0x1082, 0x2922, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xa4f1, 0xdeb9,
-  0xd6b9, 0xa4f1, 0x62ea, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72c3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c1, 0x0020, 0x0000,
-  0x18c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0020,
-  0x0020, 0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1,
-  0x0000, 0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1,
-  0x0000, 0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xd6b9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xdeb9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000, 0x0000,
-  0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2922, 0x1082, 0x18c3,
-  0x3984, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x732a, 0xa4d2, 0xd699,
-  0xde77, 0x9cd2, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72c3, 0x6a62,
-  0x5a02, 0x6243, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c1, 0x0000,
-  0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000, 0x0000,
-  0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000, 0x0000,
-  0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x1082, 0x18c3,
-  0x3984, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x62ea, 0xa4f1, 0xdeb9,
-  0xdeb9, 0xa4f1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72c5, 0x72c3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c1, 0x0000,
-  0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xdeb9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c1, 0x0000,
-  0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x3984, 0x18c3,
-  0x1082, 0x2922, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0x9cd2, 0xde97, 0xd699,
-  0x9cd2, 0x734a, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0x9471, 0x72c5, 0x6241, 0x7ac3, 0x5a02,
-  0x49c1, 0x62a5, 0x9471, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1, 0x49a1,
-  0x49c3, 0xa4f2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6, 0xb595,
-  0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638, 0xc5f8,
-  0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618, 0xbdf7,
-  0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618, 0xbdf7,
-  0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618, 0xc5f7,
-  0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7, 0xb5b6,
-  0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e, 0x738e,
-  0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18a1, 0x0000,
-  0x0020, 0x18a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000, 0x0020,
-  0x20c1, 0x0000, 0x0020, 0x0020, 0x3120, 0x3120, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x18a1, 0x0020, 0x0820, 0x20e1,
-  0x0820, 0x0020, 0x3100, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0882, 0x18c2, 0x3164, 0x0840, 0x4140, 0x5a01,
-  0x4181, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0x5aca, 0x9cd2, 0xde97, 0xd678, 0x51e2, 0x59e0, 0x41a2,
-  0x9470, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9cd2, 0x72c5, 0x6242, 0x7ac3, 0x5202, 0x4160, 0x49c1, 0x49e3,
-  0x9cb2, 0x10c3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb5b6, 0xdeda, 0x72c4, 0x51c1, 0x49c1, 0x4181, 0x49c3, 0x9cd2,
-  0xad55, 0x6b6d, 0x52aa, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb5b6, 0xf7be, 0xef5c, 0xbdb6, 0xb595, 0xb595, 0xa534, 0xad75,
-  0xb575, 0x9cf3, 0x2124, 0x8430, 0x1082, 0x0000, 0x0000, 0x0000,
-  0xb596, 0xf7be, 0xffdf, 0xc638, 0xc5f8, 0xc5f7, 0xb596, 0xad75,
-  0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000, 0x0000,
-  0xb596, 0xf7be, 0xf7be, 0xc618, 0xbdf7, 0xbdf7, 0xad75, 0xad75,
-  0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000, 0x0000,
-  0xb5b6, 0xf7be, 0xf7be, 0xc618, 0xbdf7, 0xbdf7, 0xad75, 0xad75,
-  0xb596, 0xa514, 0x2124, 0x8430, 0x0861, 0x0000, 0x0000, 0x0000,
-  0xb596, 0xf7be, 0xffdf, 0xc618, 0xc5f7, 0xbdf7, 0xb575, 0xad75,
-  0xad75, 0x9cf3, 0x5acb, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x738e, 0xe71c, 0xef5d, 0xbdd7, 0xb5b6, 0xb5b6, 0xad55, 0xad55,
-  0x9cd3, 0x18c3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x6b6d, 0x7bcf, 0x738e, 0x738e, 0x738e, 0x738e, 0x738e,
-  0x6b4d, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20c1, 0x0000, 0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20c1, 0x0020, 0x0000, 0x0020, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x20e1, 0x0820, 0x0000, 0x3120, 0x3120, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x20e1, 0x0840, 0x3100, 0x0020, 0x0020, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x49c1, 0x5a23, 0x0820, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb552, 0x9cd2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbdb4, 0xa514, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xad55, 0x6b6d, 0x52aa, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xb575, 0x9cf3, 0x2124, 0x8430, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xb596, 0xa514, 0x2124, 0x8430, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad75, 0xad75, 0x9cf3, 0x5acb, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xad55, 0x9cd3, 0x18c3, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x738e, 0x6b4d, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x5acb, 0x632c, 0x630c,
-  0x630c, 0x632c, 0x5acb, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1061, 0x5224, 0x18e3,
-  0x18e3, 0x5224, 0x1061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x630b, 0xb530, 0xd699,
-  0xd699, 0xb530, 0x6b2c, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x8c71, 0x736c, 0x8b65, 0x6a83,
-  0x5a22, 0x8b45, 0xa4f2, 0x94b2, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0862, 0x9cd2, 0x72e5, 0x7ae2, 0x4980,
-  0x4160, 0x6a62, 0x6265, 0xa513, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xe6fa, 0x6285, 0x49c2,
-  0x49c2, 0x5a23, 0xa4f2, 0xa4f3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7df, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9471, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9471, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdd7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xb5b6,
-  0xad75, 0xb575, 0xb575, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef7d, 0xb575,
-  0xad34, 0xad55, 0xad55, 0x94b2, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x632c, 0x6b6d, 0x6b4d,
-  0x632c, 0x6b4d, 0x630c, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020,
-  0x0841, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3100, 0x0000, 0x0020, 0x3122, 0x0020,
-  0x0020, 0x3122, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x3142, 0x0020,
-  0x0020, 0x3142, 0x0020, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3120, 0x0840, 0x3142, 0x0000,
-  0x0020, 0x3142, 0x0020, 0x0000, 0x0820, 0x3100, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x3120, 0x0820, 0x2921, 0x0020,
-  0x0000, 0x2921, 0x0820, 0x0020, 0x3100, 0x0820, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18a2, 0x41c4,
-  0x18c3, 0x18a2, 0x3963, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0x9cd2, 0xde76,
-  0xd699, 0xa4f2, 0x7b6a, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x8c71, 0x72e5, 0x8304, 0x6a62,
-  0x5a02, 0x6a83, 0x5224, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c5, 0x51c1,
-  0x49a1, 0x49e3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c1, 0x0020, 0x0000,
-  0x18c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020,
-  0x0000, 0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1,
-  0x0000, 0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x3984,
-  0x18c3, 0x1082, 0x2922, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xa4f1, 0xdeb9,
-  0xd6b9, 0xa4f1, 0x62ea, 0x1082, 0x0000, 0x3100, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3100, 0x1081, 0x8c71, 0x72e5, 0x72c3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3100, 0x1081, 0xa534, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c1, 0x0020, 0x0000,
-  0x18c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0020,
-  0x0020, 0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1,
-  0x0000, 0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1,
-  0x0000, 0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xd6b9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xdeb9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000,
-  0x0000, 0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0020, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0000, 0x0000,
-  0x18a1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2922, 0x1082, 0x18c3,
-  0x3984, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x732a, 0xa4d2, 0xd699,
-  0xde77, 0x9cd2, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72c3, 0x6a62,
-  0x5a02, 0x6243, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c1, 0x0000,
-  0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000, 0x0000,
-  0x20e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e1, 0x0000, 0x0000,
-  0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2902, 0x1082, 0x18c3,
-  0x3984, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x62ea, 0xa4f1, 0xdeb9,
-  0xdeb9, 0xa4f1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72c5, 0x72c3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x18c1, 0x0000,
-  0x0020, 0x18c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c1, 0x0020, 0x0000,
-  0x20c1, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x20c1, 0x0000,
-  0x0000, 0x20c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x3143, 0x18c3,
-  0x18c3, 0x3143, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x5aca, 0xacf1, 0xdeb9,
-  0xd6b9, 0xacf1, 0x5aca, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0x9471, 0x72e5, 0x72a3, 0x6a62,
-  0x5a02, 0x6242, 0x5204, 0x8c51, 0x10a3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xad54, 0xe6fa, 0x72c4, 0x51c1,
-  0x49a1, 0x49c3, 0x9cd2, 0xad55, 0x5aeb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xffdf, 0xef5c, 0xbdb6,
-  0xb595, 0xb595, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xffdf, 0xc638,
-  0xc5f8, 0xc5f7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x18e3, 0x9492, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa534, 0xf7be, 0xf7be, 0xc618,
-  0xbdf7, 0xbdf7, 0xb596, 0x9cf3, 0x2124, 0x8430, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0861, 0xa514, 0xffdf, 0xffdf, 0xc618,
-  0xc5f7, 0xbdf7, 0xb596, 0xad55, 0x5acb, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x6b4d, 0xe73c, 0xef5d, 0xbdd7,
-  0xb5b6, 0xb5b6, 0xad55, 0x9492, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x6b6d, 0x7bcf, 0x738e,
-  0x738e, 0x73ae, 0x6b4d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation coffeeAnimation = {
-  .name = "Coffee",
-  .frameCount = 22,
-  .width = 16,
-  .height = 16,
-  .frameDurations = coffeeDurations,
-  .animationFrames = coffeeFrames
-};
-#endif // ANIMATION_COFFEE_H
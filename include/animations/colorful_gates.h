@@ -1,342 +0,0 @@
-// colorful_gates.h - Auto-generated from colorful_gates.json
-#ifndef ANIMATION_COLORFUL_GATES_H
-#define ANIMATION_COLORFUL_GATES_H
-
-#include "animation_types.h"
-
-// Frame Durations for colorful_gates (in 100ms units)
-static const uint8_t PROGMEM colorful_gatesDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for colorful_gates
-static const uint16_t PROGMEM colorful_gatesFrames[] = {
-  0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x41cf,
-  0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x2126, 0x2126, 0x2126, 0x2126,
-  0x41cf, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5,
-  0x4ad5, 0x4ad5, 0x4ad5, 0x41cf, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4ad5, 0x41cf, 0x5149, 0x5149, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x67fc, 0x67fc, 0x67fc, 0x67fc,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0x920a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x5149, 0x5149,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0x920a,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0x67fc, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0x4d3f, 0x4d3f, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0x4ad5, 0x4ad5, 0x4ad5, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x67fc, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0x41cf, 0x41cf, 0x41cf, 0x41cf, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4d3f, 0x4d3f, 0x3908, 0x5149, 0x920a, 0xe34a,
-  0xe34a, 0xe34a, 0xe34a, 0xe34a, 0xe34a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x4ad5, 0x4ad5, 0x4ad5, 0x3908, 0x5149, 0x920a, 0x920a,
-  0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0x5149, 0x3908,
-  0x41cf, 0x41cf, 0x41cf, 0x41cf, 0x3908, 0x5149, 0x5149, 0x5149,
-  0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x3908,
-  0x3148, 0x3148, 0x3148, 0x3148, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x4ad5, 0x4b16, 0x4af6, 0x4af6, 0x4af6, 0x4af6, 0x4af6, 0x4af6,
-  0x4af6, 0x4af6, 0x4b16, 0x4ab4, 0x4149, 0x3908, 0x3908, 0x4108,
-  0x4af5, 0x4cbd, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e,
-  0x4d3e, 0x4d3e, 0x4cdd, 0x4af4, 0x516a, 0x5949, 0x5949, 0x5149,
-  0x4af6, 0x4d1e, 0x677c, 0x6fbc, 0x77dc, 0x77dc, 0x77dc, 0x77dc,
-  0x6fbc, 0x679c, 0x4d3e, 0x52f5, 0x8a0b, 0x920a, 0x89ea, 0x5949,
-  0x4af6, 0x4d1e, 0x6fbc, 0xe7fc, 0xe77b, 0xe75b, 0xe75b, 0xe77b,
-  0xe7dc, 0x6fbc, 0x4d3e, 0x5315, 0xd34b, 0xdb0a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe77b, 0x724c, 0x61ca, 0x61ca, 0x724c,
-  0xe77b, 0x77bc, 0x4d3e, 0x5335, 0xed0d, 0xe36a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ca, 0x81c9, 0x91e9, 0x9a6b,
-  0xe77b, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ea, 0x920a, 0xd30a, 0xe3ac,
-  0xef9b, 0x6fbc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd6e,
-  0xf7bb, 0x6fbc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd8e,
-  0xe7db, 0x6fbc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xed8e,
-  0x7f9b, 0x679c, 0x4d3e, 0x5b35, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af5, 0x4d1e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xed4e,
-  0x5d3c, 0x4d1e, 0x44bd, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af6, 0x4d1e, 0x6fdc, 0xd77b, 0x69ea, 0x91e9, 0xdb4a, 0xed2e,
-  0x6374, 0x5335, 0x5335, 0x6354, 0xed2e, 0xdb6a, 0x920a, 0x5949,
-  0x4af6, 0x4d1e, 0x679c, 0x6f3a, 0x59ca, 0x91e9, 0xdb4a, 0xf52d,
-  0xed2d, 0xed2d, 0xed2e, 0xed2e, 0xfd2d, 0xdb4a, 0x920a, 0x5949,
-  0x4af5, 0x4cdd, 0x4d3e, 0x4cdc, 0x59ab, 0x920a, 0xd30a, 0xdb4a,
-  0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xd30a, 0x920a, 0x5949,
-  0x4ab4, 0x4af5, 0x4af5, 0x4ab4, 0x596a, 0x89ea, 0x920a, 0x920a,
-  0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0x89ea, 0x5949,
-  0x41ef, 0x41ef, 0x41ef, 0x49ce, 0x5149, 0x5949, 0x5949, 0x5949,
-  0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x5149,
-  0x4d3f, 0x4d5f, 0x4d7f, 0x4d7f, 0x4d7f, 0x4d7f, 0x4d7f, 0x4d7f,
-  0x4d7f, 0x4d7f, 0x4d7f, 0x4cdd, 0x59ab, 0x5949, 0x5949, 0x5949,
-  0x4d5f, 0x677c, 0x6fbc, 0x779c, 0x779c, 0x779c, 0x779c, 0x779c,
-  0x779c, 0x6fbc, 0x677c, 0x551d, 0x8a4b, 0x9209, 0x920a, 0x8a0a,
-  0x4d5f, 0x6fbc, 0xe7fc, 0xe7fc, 0xe7fc, 0xe7fc, 0xe7fc, 0xe7fc,
-  0xe7fc, 0xe7fc, 0x6fbc, 0x553d, 0xd36c, 0xdb4a, 0xd30a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x87dc, 0x777a, 0x775a, 0x775a, 0x777a,
-  0x7fdc, 0xe7fc, 0x6fbc, 0x5d5d, 0xed2e, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x8aec, 0x928b, 0x926b, 0x8aec,
-  0x777a, 0xe7fc, 0x6fbc, 0x5d3d, 0xd3cc, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xd2ea, 0xdb2a, 0xd3ac,
-  0x7f7a, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb2a, 0xfd2d, 0xed6e,
-  0x7fba, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xfd2d, 0xdc0c,
-  0x7f7a, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xfd2d, 0xd3cc,
-  0x8f7a, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe3cc,
-  0xe77b, 0xe7fc, 0x6fbc, 0x5d3d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xfd2d, 0xdbcc,
-  0x775b, 0x6fbc, 0x5f7c, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6f9c, 0xe7fc, 0x877a, 0x928b, 0xdb4a, 0xfd2d, 0xd38c,
-  0x64fb, 0x553d, 0x5d3d, 0x64dc, 0xd38c, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x6fbc, 0xe7fc, 0xdf7b, 0x9a8b, 0xdb4a, 0xf54d, 0xe3ab,
-  0xd38c, 0xd38c, 0xd38c, 0xd38c, 0xe3ab, 0xfd4d, 0xdb4a, 0x9a2a,
-  0x4d5f, 0x677c, 0x6fbc, 0x773b, 0x928b, 0xdb2a, 0xfd2d, 0xfd4d,
-  0xfd2d, 0xfd2d, 0xfd2d, 0xfd2d, 0xfd4d, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x4cfe, 0x4d1e, 0x4d3e, 0x54dc, 0x926b, 0xd30a, 0xdb4a, 0xdb4a,
-  0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xd30a, 0x9a2a,
-  0x4af5, 0x4af6, 0x4af6, 0x4af5, 0x8a2b, 0x9a0a, 0x9a2a, 0x9a2a,
-  0x9a2a, 0x9a2a, 0x9a2a, 0x9a2a, 0x9a2a, 0x9a2a, 0x9a2a, 0x920a,
-  0x67dc, 0x77fc, 0x77fc, 0x77fc, 0x77fc, 0x77fc, 0x77fc, 0x77fc,
-  0x77fc, 0x77fc, 0x77fc, 0x6f7a, 0x928b, 0x9a0a, 0x9a2a, 0x9a2a,
-  0x77db, 0xe7dc, 0xe7dc, 0xe7fc, 0xe7fc, 0xe7fc, 0xe7fc, 0xe7fc,
-  0xe7fc, 0xe7dc, 0xe7fc, 0x7f7a, 0xcbac, 0xdb4a, 0xdb4a, 0xdb2a,
-  0x77db, 0xe7dc, 0x7fdc, 0x6fbc, 0x6fbc, 0x6fbc, 0x6fbc, 0x6fbc,
-  0x6fbc, 0x7fdc, 0xe7fc, 0x7fba, 0xed6e, 0xfd2d, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x4d9e, 0x553d, 0x553d, 0x553d, 0x551d,
-  0x4d7e, 0x6fbc, 0xe7fc, 0x7f7a, 0xd3ac, 0xe38b, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xcb6d, 0xd38c, 0xdb8c, 0xcbae,
-  0x553d, 0x6fbc, 0xe7fc, 0x777a, 0x92ab, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x5d3d, 0xd38c, 0xfd2c, 0xfd2c, 0xed2e,
-  0x5d5d, 0x6f9c, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xe3aa, 0xd36c,
-  0x5d3d, 0x6fbc, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x9a4b,
-  0x551d, 0x6fbc, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x924b,
-  0x555d, 0x6fbc, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0x928b,
-  0x773a, 0x7ffc, 0xe7fc, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x553d, 0xd38c, 0xfd2d, 0xdb4a, 0xa28b,
-  0xdf7b, 0xe7fd, 0xe7fd, 0x777a, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0x6fbc, 0x555d, 0xd38c, 0xfd2d, 0xdb4a, 0x928b,
-  0x76f9, 0x777a, 0x777a, 0x6ef9, 0x928b, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7dc, 0x7ffc, 0x775a, 0xdbcc, 0xfd2d, 0xdb4a, 0x9a2a,
-  0x928b, 0x928b, 0x928b, 0x928b, 0x9a2a, 0xdb4a, 0xf52d, 0xe36a,
-  0x77db, 0xe7fc, 0xe7fc, 0xe79b, 0xe3cc, 0xf52d, 0xe3ab, 0xdb4a,
-  0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xdb4a, 0xe3ab, 0xf52d, 0xe36a,
-  0x679c, 0x6f9c, 0x6fbc, 0x773a, 0xdbcc, 0xf50d, 0xf52d, 0xf52d,
-  0xf52d, 0xf52d, 0xf52d, 0xf52d, 0xf52d, 0xf52d, 0xf52d, 0xe36a,
-  0x4d5e, 0x4d5f, 0x4d5f, 0x553d, 0xd36c, 0xe36a, 0xe36a, 0xe36a,
-  0xe36a, 0xe36a, 0xe36a, 0xe36a, 0xe36a, 0xe36a, 0xe36a, 0xe34a,
-  0xffdd, 0xf7fc, 0xeffc, 0xeffc, 0xeffc, 0xeffc, 0xeffc, 0xeffc,
-  0xeffc, 0xeffc, 0xeffd, 0xff9b, 0xe3cc, 0xe36a, 0xe36a, 0xe36b,
-  0xefdc, 0x7fdc, 0x6fbc, 0x6fbc, 0x6fbc, 0x6fbc, 0x6fbc, 0x6fbc,
-  0x6fbc, 0x6fbc, 0x7fdc, 0xefbb, 0xfd6e, 0xf52d, 0xf52d, 0xfd4d,
-  0xeffc, 0x6fbc, 0x4d9e, 0x4d1e, 0x4d1e, 0x4d1e, 0x4d1e, 0x4d1e,
-  0x4d1e, 0x4d7e, 0x6fbc, 0xef9b, 0xe3ac, 0xdb4a, 0xe3ab, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x4b16, 0x5b35, 0x5b35, 0x5b35, 0x5b35,
-  0x4b16, 0x4d1e, 0x6fbc, 0xe77b, 0x9a8b, 0x9a09, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xdd0e, 0xed2d, 0xed2d, 0xdcee,
-  0x5315, 0x4d1e, 0x77bc, 0xe75b, 0x69eb, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5b35, 0xed2e, 0xebaa, 0xe34a, 0xd34b,
-  0x5315, 0x4d3e, 0x77bc, 0xe75b, 0x69ca, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x9a2a, 0x8a0a,
-  0x52f4, 0x4d3e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x596a,
-  0x4ad4, 0x4d3e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x596a,
-  0x4af5, 0x4d3e, 0x77bc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x920a, 0x59ab,
-  0x4cdc, 0x4d9f, 0x6fbc, 0xe75b, 0x69ea, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d3e, 0x5335, 0xed2e, 0xdb6a, 0x91e9, 0x59ca,
-  0x6f3b, 0x77dc, 0x87fc, 0xe77b, 0x69eb, 0x91e9, 0xdb4a, 0xfd6d,
-  0xeffc, 0x77bc, 0x4d1e, 0x5356, 0xed2e, 0xdb6a, 0x91ea, 0x61ca,
-  0xd6d9, 0xe77b, 0xe75b, 0xded9, 0x61ca, 0x91ea, 0xdb4a, 0xfd6d,
-  0xeffc, 0x6fbc, 0x4d9e, 0x5d3d, 0xed6e, 0xdb4a, 0x920a, 0x5969,
-  0x61ca, 0x69ca, 0x69ca, 0x61ca, 0x5969, 0x920a, 0xdb4a, 0xfd6d,
-  0xf7dc, 0x7fdc, 0x6fbc, 0x7f9b, 0xed8e, 0xdb4a, 0x9a2a, 0x920a,
-  0x91e9, 0x91e9, 0x91e9, 0x91e9, 0x920a, 0x9a2a, 0xdb4a, 0xfd6d,
-  0xefdc, 0xe7dc, 0xe7fc, 0xe7bb, 0xf58e, 0xe38b, 0xdb4a, 0xdb6a,
-  0xdb6a, 0xdb6a, 0xdb6a, 0xdb6a, 0xdb6a, 0xdb4a, 0xe3ab, 0xfd6d,
-  0x77db, 0x77db, 0x77dc, 0x7fba, 0xedae, 0xfd4d, 0xfd4d, 0xfd6d,
-  0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd6d, 0xfd4d, 0xfd6d, 0xfd8d,
-  0x67dc, 0x67bc, 0x67bc, 0x67bc, 0x67bc, 0x67bc, 0x67bc, 0x67bc,
-  0x67bc, 0x67bc, 0x67bc, 0x77ba, 0xed8e, 0xfd4d, 0xfd6d, 0xfd6d,
-  0x679c, 0x559e, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e, 0x4d3e,
-  0x4d3e, 0x4d3e, 0x4d9e, 0x6f5a, 0xd3cc, 0xdb4a, 0xdb4a, 0xe36b,
-  0x67bc, 0x4d3e, 0x4b16, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5, 0x4ad5,
-  0x4ad5, 0x4b16, 0x4d3e, 0x673a, 0x928b, 0x91ea, 0x9a2a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4af5, 0x49ef, 0x51ee, 0x520e, 0x520e, 0x51ee,
-  0x49ef, 0x4ad5, 0x4d3e, 0x673a, 0x59ea, 0x5949, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x51ee, 0xc2eb, 0xcb0a, 0xd30a, 0xc2eb,
-  0x51ee, 0x4ad5, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520e, 0xcb0a, 0xa24a, 0x920a, 0x920a,
-  0x49ee, 0x4ad5, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520e, 0xcb0a, 0x920a, 0x5949, 0x5149,
-  0x49ce, 0x4af5, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520e, 0xcb0a, 0x9a0a, 0x5949, 0x4129,
-  0x41ce, 0x4af5, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520e, 0xcb0a, 0x9a2a, 0x5949, 0x3929,
-  0x41ce, 0x4af5, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520e, 0xcb0a, 0x9a2a, 0x5149, 0x4129,
-  0x4ab4, 0x4b16, 0x4d3e, 0x5f3a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x51ee, 0xcb0a, 0x9a2a, 0x5149, 0x416a,
-  0x4cfc, 0x4d5e, 0x55bf, 0x673a, 0x41aa, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4ad5, 0x520f, 0xcb0a, 0x9a0a, 0x5129, 0x418a,
-  0x5e99, 0x673a, 0x673a, 0x5ed9, 0x418a, 0x5129, 0x920a, 0xdb2a,
-  0x67bc, 0x4d3e, 0x4b16, 0x52f4, 0xcb2b, 0x9a0a, 0x5949, 0x4129,
-  0x418a, 0x41aa, 0x41aa, 0x418a, 0x4129, 0x5149, 0x920a, 0xdb2a,
-  0x679c, 0x4d9e, 0x4d3e, 0x5d1c, 0xcb4c, 0x920a, 0x5949, 0x5949,
-  0x5129, 0x5129, 0x5129, 0x5129, 0x5949, 0x5949, 0x920a, 0xdb2a,
-  0x77dc, 0x77bc, 0x77bc, 0x7f5b, 0xd38c, 0xa22a, 0x920a, 0x920a,
-  0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0x920a, 0xa24a, 0xdb2a,
-  0xefdc, 0xefdc, 0xeffd, 0xef9b, 0xdb8c, 0xdb0a, 0xdb2a, 0xdb2a,
-  0xdb2a, 0xdb2a, 0xdb2a, 0xdb2a, 0xdb2a, 0xdb2a, 0xdb2a, 0xdb4a,
-  0x4d1f, 0x4cfe, 0x4cfe, 0x4cfe, 0x4cfe, 0x4cfe, 0x4cfe, 0x4cfe,
-  0x4cfe, 0x4cfe, 0x4cfe, 0x54fd, 0xcb4c, 0xdb2a, 0xdb2a, 0xdb2a,
-  0x4cfe, 0x4b36, 0x4af5, 0x4af5, 0x4af5, 0x4af5, 0x4af5, 0x4af5,
-  0x4af5, 0x4af5, 0x4b36, 0x54bc, 0x926c, 0x9209, 0x920a, 0x9a2a,
-  0x4cfe, 0x4af5, 0x41ef, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce,
-  0x41ce, 0x41ef, 0x4af5, 0x4cbc, 0x51ab, 0x5149, 0x5969, 0x89ea,
-  0x4cfe, 0x4af5, 0x41ce, 0x3149, 0x3969, 0x3969, 0x3969, 0x3969,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x396a, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3949, 0x81e9, 0x89ea, 0x89ea, 0x81c9,
-  0x3949, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x89ea, 0x6169, 0x5949, 0x5149,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3908, 0x3908,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3908, 0x2927,
-  0x3148, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3908, 0x2927,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3908, 0x2947,
-  0x41ce, 0x41ef, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3908, 0x2948,
-  0x42d4, 0x4af5, 0x4b57, 0x4cbd, 0x2989, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ce, 0x3969, 0x81ea, 0x5949, 0x3908, 0x2968,
-  0x445a, 0x4cbc, 0x4cbc, 0x449b, 0x2988, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4af5, 0x41ef, 0x49ce, 0x89ea, 0x5949, 0x3908, 0x2927,
-  0x2988, 0x2989, 0x2988, 0x2968, 0x2927, 0x3908, 0x5949, 0x8a0a,
-  0x4cfe, 0x4b36, 0x4af5, 0x52d4, 0x8a0b, 0x5949, 0x4108, 0x3908,
-  0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x4108, 0x5949, 0x8a0a,
-  0x4d5e, 0x4d3e, 0x4d5e, 0x54fc, 0x8a4b, 0x6169, 0x5949, 0x5949,
-  0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x6169, 0x8a0a,
-  0x679c, 0x67bc, 0x67bc, 0x673a, 0x8a8b, 0x89ea, 0x8a0a, 0x8a0a,
-  0x8a0a, 0x8a0a, 0x8a0a, 0x8a0a, 0x8a0a, 0x8a0a, 0x8a0a, 0x920a,
-  0x4ad5, 0x4ab4, 0x4ab4, 0x4ab4, 0x4ab4, 0x4ab4, 0x4ab4, 0x4ab4,
-  0x4ab4, 0x4ab4, 0x4ad4, 0x4ab4, 0x8a0b, 0x91ea, 0x8a0a, 0x8a0a,
-  0x4ad4, 0x420f, 0x41ce, 0x41ee, 0x41ee, 0x41ee, 0x41ee, 0x41ee,
-  0x41ee, 0x41ce, 0x420f, 0x4ab3, 0x596a, 0x5949, 0x5949, 0x5949,
-  0x4ab4, 0x41ce, 0x3149, 0x3149, 0x3169, 0x3169, 0x3169, 0x3169,
-  0x3149, 0x3149, 0x41ce, 0x4a93, 0x3949, 0x3908, 0x4108, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41ad, 0x41cd, 0x41cd, 0x41cd, 0x41cd,
-  0x41ad, 0x3149, 0x41ee, 0x4a93, 0x2948, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x516a, 0x5149, 0x5149, 0x514a,
-  0x41cd, 0x3169, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x4108, 0x3908, 0x3929,
-  0x41ad, 0x3169, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x2947,
-  0x41ad, 0x3169, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3928,
-  0x41ad, 0x3169, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3929,
-  0x41ad, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3928,
-  0x3149, 0x3149, 0x41ce, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3929,
-  0x41ce, 0x41ef, 0x4210, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x41ad, 0x5149, 0x3928, 0x2926, 0x3929,
-  0x4a72, 0x4ab3, 0x4ab3, 0x4a93, 0x3929, 0x2926, 0x3928, 0x5149,
-  0x4ab4, 0x41ee, 0x3149, 0x3949, 0x5149, 0x3928, 0x2927, 0x3928,
-  0x3949, 0x3949, 0x3949, 0x3929, 0x3928, 0x2927, 0x3928, 0x5149,
-  0x4ab4, 0x41ef, 0x41ce, 0x41ce, 0x5149, 0x3928, 0x2927, 0x2927,
-  0x2926, 0x2926, 0x2926, 0x2926, 0x2927, 0x2927, 0x3928, 0x5149,
-  0x4b15, 0x4af5, 0x4af5, 0x4ad4, 0x516a, 0x4108, 0x3928, 0x3928,
-  0x3928, 0x3928, 0x3928, 0x3928, 0x3928, 0x3928, 0x4128, 0x5149,
-  0x4cfe, 0x4cfe, 0x4cfe, 0x4cbc, 0x518b, 0x5128, 0x5149, 0x5149,
-  0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x5149,
-  0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce,
-  0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x5149, 0x5149, 0x5149, 0x5149,
-  0x41ce, 0x3169, 0x3169, 0x3149, 0x3149, 0x3149, 0x3149, 0x3149,
-  0x3149, 0x3169, 0x3169, 0x41ad, 0x3929, 0x3928, 0x3928, 0x4108,
-  0x41ce, 0x3149, 0x41ad, 0x41ee, 0x41ee, 0x41ee, 0x41ee, 0x41ee,
-  0x41ee, 0x41cd, 0x3169, 0x41cd, 0x2947, 0x2926, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ce, 0x4ab4, 0x4ab3, 0x4a93, 0x4a93, 0x4ab3,
-  0x4ab4, 0x41ee, 0x3169, 0x41ad, 0x3929, 0x3908, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4ab3, 0x396a, 0x3929, 0x3929, 0x396a,
-  0x4ab3, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3929, 0x2926, 0x2926, 0x2948,
-  0x4a93, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3908, 0x3949,
-  0x4a93, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3908, 0x516a,
-  0x4ab3, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3908, 0x516a,
-  0x4a93, 0x41ee, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x41ce, 0x41ad, 0x3149, 0x41cd, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4ab3, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x3149, 0x3169, 0x3169, 0x41ce, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ee, 0x4a93, 0x3949, 0x2926, 0x3928, 0x5149,
-  0x41ad, 0x41cd, 0x41ce, 0x49ae, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3149, 0x41ad, 0x41ce, 0x3929, 0x2927, 0x3928, 0x5149,
-  0x5149, 0x5149, 0x5149, 0x5149, 0x5149, 0x3928, 0x2927, 0x3908,
-  0x41ce, 0x3169, 0x3149, 0x3149, 0x3928, 0x2927, 0x3908, 0x3928,
-  0x3928, 0x3928, 0x3928, 0x3928, 0x3928, 0x3908, 0x2927, 0x3908,
-  0x41ef, 0x41ee, 0x41ef, 0x41ce, 0x3929, 0x2927, 0x2927, 0x2927,
-  0x2927, 0x2927, 0x2927, 0x2927, 0x2927, 0x2927, 0x2927, 0x3908,
-  0x4ab4, 0x4ab4, 0x4ad4, 0x4a93, 0x3949, 0x3908, 0x3908, 0x3908,
-  0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x3148, 0x3149, 0x3149, 0x3149, 0x3149, 0x3149, 0x3149, 0x3149,
-  0x3149, 0x3149, 0x3149, 0x3148, 0x3908, 0x3908, 0x3908, 0x3908,
-  0x3149, 0x41ad, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce, 0x41ce,
-  0x41ce, 0x41ce, 0x41cd, 0x3149, 0x2927, 0x2927, 0x2927, 0x2927,
-  0x3149, 0x41ce, 0x4ab4, 0x4af5, 0x4af5, 0x4af5, 0x4af5, 0x4af5,
-  0x4af5, 0x4ab4, 0x41ee, 0x3149, 0x3928, 0x3928, 0x3908, 0x2927,
-  0x3149, 0x41ce, 0x4af5, 0x4cdd, 0x4cbc, 0x4cbc, 0x4cbc, 0x4cbc,
-  0x4cdd, 0x4af5, 0x41ce, 0x3149, 0x5149, 0x5149, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x29ea, 0x2968, 0x2968, 0x29ca,
-  0x4cbc, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2988, 0x3907, 0x3908, 0x396a,
-  0x4cbc, 0x4af5, 0x41ce, 0x3969, 0x89ea, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5129, 0x59ab,
-  0x4cbc, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x822b,
-  0x54bd, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a2b,
-  0x549c, 0x4af5, 0x41ce, 0x3969, 0x81e9, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x8a0b,
-  0x52d4, 0x4ab4, 0x41ee, 0x3969, 0x81e9, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4cbc, 0x2989, 0x3908, 0x5949, 0x89ea,
-  0x49ce, 0x41ce, 0x41ad, 0x3969, 0x81ea, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4af5, 0x4c7c, 0x2989, 0x3908, 0x5949, 0x89ea,
-  0x4169, 0x3969, 0x3969, 0x4169, 0x89ea, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ce, 0x4ab4, 0x4ad4, 0x2948, 0x3908, 0x5949, 0x89ea,
-  0x89ea, 0x81e9, 0x81ea, 0x89ea, 0x89ea, 0x5949, 0x3928, 0x2926,
-  0x3149, 0x41ad, 0x41ce, 0x41ce, 0x2947, 0x3908, 0x5149, 0x5949,
-  0x5949, 0x5949, 0x5949, 0x5949, 0x5949, 0x5149, 0x3928, 0x2926,
-  0x3149, 0x3169, 0x3169, 0x3149, 0x2927, 0x3908, 0x3928, 0x3908,
-  0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x3928, 0x3908, 0x2927,
-  0x41ce, 0x41ce, 0x41ce, 0x41ad, 0x2947, 0x2926, 0x2926, 0x2926,
-  0x2926, 0x2926, 0x2926, 0x2926, 0x2926, 0x2926, 0x2926, 0x2126
-};
-
-const Animation colorful_gatesAnimation = {
-  .name = "Colorful Gates",
-  .frameCount = 10,
-  .width = 16,
-  .height = 16,
-  .frameDurations = colorful_gatesDurations,
-  .animationFrames = colorful_gatesFrames
-};
-#endif // ANIMATION_COLORFUL_GATES_H
@@ -1,1942 +0,0 @@
-// countdown.h - Auto-generated from countdown.json
-#ifndef ANIMATION_COUNTDOWN_H
-#define ANIMATION_COUNTDOWN_H
-
-#include "animation_types.h"
-
-// Frame Durations for countdown (in 100ms units)
-static const uint8_t PROGMEM countdownDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for countdown
-static const uint16_t PROGMEM countdownFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ff, 0x12ff,
-  0x12ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01ff, 0x01ff, 0x01ff, 0x0000, 0x0000, 0x0000, 0x12ff, 0x0000,
-  0x12ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x01ff, 0x0000, 0x0000, 0x0000, 0x12ff, 0x12ff,
-  0x12ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x01ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01ff, 0x01ff, 0x01ff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x0000, 0x01ff, 0x01ff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8edf, 0x8edf, 0x8edf,
-  0x8edf, 0x8edf, 0x8edf, 0x01ff, 0x01ff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x081f, 0xffff, 0xffff, 0x0000,
-  0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x8edf, 0x8edf,
-  0x8edf, 0x8edf, 0x8edf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xffff, 0xffff, 0x081f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x01ff, 0x01ff, 0x0000, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x01ff, 0x01ff, 0x0000, 0x8edf, 0x8edf,
-  0x8edf, 0x8edf, 0x0000, 0x0000, 0x0000, 0x01ff, 0x01ff, 0x01ff,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01ff, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ff,
-  0x12ff, 0x12ff, 0x0000, 0x0000, 0x0000, 0x01ff, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ff,
-  0x0000, 0x12ff, 0x0000, 0x0000, 0x0000, 0x01ff, 0x01ff, 0x01ff,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x12ff,
-  0x12ff, 0x12ff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01bd, 0x01bc, 0x0022, 0x0000, 0x0042, 0x0a9b, 0x0085, 0x0085,
-  0x0a9b, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0045, 0x019a, 0x0023, 0x0000, 0x0022, 0x127a, 0x0a9a, 0x0a9a,
-  0x127a, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x019a, 0x0023, 0x0000, 0x0000, 0x0022, 0x0022, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x0000,
-  0x0045, 0x019a, 0x0023, 0x0000, 0x0000, 0x0000, 0x1081, 0x10a2,
-  0x10a2, 0x1082, 0x0022, 0x019a, 0x019a, 0x019a, 0x0022, 0x0000,
-  0x019a, 0x019a, 0x0022, 0x0000, 0x0000, 0x2104, 0xdeba, 0xef7d,
-  0xef7d, 0xdeba, 0x2147, 0x019b, 0x00aa, 0x019b, 0x0023, 0x0000,
-  0x0022, 0x0022, 0x0000, 0x0002, 0x1084, 0xce9b, 0xf7df, 0xe75d,
-  0xe75d, 0xf7df, 0xcedd, 0x123c, 0x019a, 0x019a, 0x0022, 0x0000,
-  0x0000, 0x0000, 0x0002, 0x081a, 0x109d, 0x969f, 0x969d, 0x31a6,
-  0x29a6, 0x969d, 0x969d, 0x08a4, 0x0022, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0002, 0x081a, 0x189d, 0xce9d, 0xf7df, 0xef5d,
-  0xef5d, 0xf7df, 0xdf3d, 0x10a4, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0002, 0x2104, 0xd69a, 0xef5d,
-  0xe75d, 0xf7df, 0xdf3f, 0x18bd, 0x081b, 0x0002, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x2124, 0x2945,
-  0x31a7, 0x969d, 0x969f, 0x189d, 0x081a, 0x0002, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x019a, 0x019a, 0x017a, 0x10a4, 0xd69a, 0xef5d,
-  0xef5d, 0xf7df, 0xce9b, 0x1084, 0x0002, 0x0000, 0x0022, 0x0023,
-  0x0000, 0x0022, 0x019b, 0x00aa, 0x019a, 0x10a5, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2124, 0x0000, 0x0000, 0x0022, 0x019a, 0x019a,
-  0x0000, 0x0022, 0x019a, 0x019a, 0x019a, 0x0022, 0x1082, 0x1082,
-  0x1082, 0x1081, 0x0000, 0x0000, 0x0000, 0x0022, 0x019a, 0x0045,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x0000, 0x0022,
-  0x0022, 0x0022, 0x0022, 0x0000, 0x0000, 0x0022, 0x019a, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0a7a,
-  0x0a9a, 0x0a9a, 0x127a, 0x0022, 0x0000, 0x0022, 0x019a, 0x0045,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x129b,
-  0x0085, 0x0085, 0x129b, 0x0043, 0x0000, 0x0022, 0x01bc, 0x01dd,
-  0x081c, 0x0003, 0x0000, 0x0022, 0x019a, 0x01bc, 0x01bc, 0x019a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x081c, 0x0003, 0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0042, 0x0022, 0x0000, 0x0000,
-  0x081c, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0a7a, 0x129a, 0x0a7a, 0x0022, 0x0000,
-  0x081d, 0x0003, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x0882,
-  0x0882, 0x0862, 0x0022, 0x0a9b, 0x010a, 0x129b, 0x0043, 0x0000,
-  0x081a, 0x0002, 0x0000, 0x0000, 0x0000, 0x1904, 0x85da, 0x8e7d,
-  0x8e7d, 0x85da, 0x1946, 0x127a, 0x129a, 0x127a, 0x0022, 0x0000,
-  0x0002, 0x0000, 0x0022, 0x0022, 0x1082, 0xd6ba, 0xf7df, 0xdf3d,
-  0xdf3d, 0xf7df, 0xdedb, 0x10c4, 0x0042, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01bb, 0x019b, 0x10c4, 0xe75d, 0xe75d, 0x29a6,
-  0x2986, 0xe75d, 0xe75d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01bb, 0x019a, 0x08a4, 0x7dda, 0x9eff, 0x8e5d,
-  0x8e5d, 0x9eff, 0x965c, 0x0882, 0x0022, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0000, 0x18e4, 0xce7a, 0xdf3d,
-  0xdf3d, 0xf7df, 0xdf3c, 0x10c4, 0x019a, 0x01bb, 0x0022, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1904, 0x1925,
-  0x29a7, 0xe75d, 0xe75d, 0x10c4, 0x019a, 0x01bb, 0x0022, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0042, 0x0022, 0x0882, 0x7dda, 0x8e5d,
-  0x8e5d, 0x9eff, 0x7dda, 0x0882, 0x0022, 0x0022, 0x0000, 0x0002,
-  0x0000, 0x0022, 0x0a7a, 0x129a, 0x0a7a, 0x10c4, 0xce9a, 0xe75d,
-  0xe75d, 0xce9a, 0x1904, 0x0000, 0x0000, 0x0000, 0x0002, 0x081a,
-  0x0000, 0x0042, 0x129b, 0x010a, 0x129b, 0x0043, 0x1082, 0x10a2,
-  0x10a2, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x081d,
-  0x0000, 0x0022, 0x127a, 0x129a, 0x127a, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x081c,
-  0x0000, 0x0000, 0x0022, 0x0042, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0023, 0x0023, 0x0022, 0x0000, 0x0000, 0x0002, 0x081c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x019a, 0x01bc, 0x01bc, 0x019a, 0x0022, 0x0000, 0x0002, 0x081c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x12bc, 0x12dd, 0x12dd, 0x12bc, 0x0042,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0042, 0x0a7a, 0x0064, 0x0064, 0x0a7a, 0x0043,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0042, 0x0a9a, 0x0065, 0x0064, 0x0a7a, 0x0043,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x1082, 0x10a2,
-  0x10a2, 0x1082, 0x0022, 0x0a7a, 0x0a9a, 0x0a9a, 0x0a7a, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x211a, 0xce9d, 0xe75d,
-  0xe75d, 0xceba, 0x1904, 0x0042, 0x0042, 0x0042, 0x0022, 0x0000,
-  0x0000, 0x0022, 0x0022, 0x0022, 0x0882, 0x85dd, 0x9eff, 0x8e5d,
-  0x8e5d, 0x9eff, 0x85da, 0x0882, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0199, 0x019a, 0x017a, 0x10c4, 0xe75d, 0xe77d, 0x29a6,
-  0x2986, 0xe75d, 0xe75d, 0x10a2, 0x0022, 0x0022, 0x0022, 0x0000,
-  0x0023, 0x019a, 0x00aa, 0x019a, 0x10a5, 0xd6ba, 0xf7df, 0xe73d,
-  0xdf3d, 0xf7df, 0xdf3c, 0x10c4, 0x0179, 0x019a, 0x019a, 0x0022,
-  0x0022, 0x0199, 0x019a, 0x019a, 0x0022, 0x18e3, 0x7dba, 0x8e5d,
-  0x8e5d, 0x9eff, 0x965c, 0x08a5, 0x019a, 0x00aa, 0x019a, 0x0023,
-  0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x0000, 0x1904, 0x2125,
-  0x29a7, 0xe75d, 0xe75d, 0x10c4, 0x0179, 0x019a, 0x0199, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xce9a, 0xe73d,
-  0xe73d, 0xf7df, 0xd6ba, 0x1082, 0x0022, 0x0022, 0x0022, 0x0000,
-  0x0000, 0x0022, 0x0043, 0x0043, 0x0022, 0x0882, 0x7dda, 0x8e7d,
-  0x8e7d, 0x7dda, 0x1904, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0a7a, 0x0a9a, 0x0a9a, 0x127a, 0x0042, 0x0862, 0x0882,
-  0x0882, 0x0862, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0043, 0x0a7a, 0x0064, 0x0064, 0x0a9a, 0x0043, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0043, 0x0a7a, 0x0065, 0x0064, 0x0a7a, 0x0043, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0042, 0x12bc, 0x12dd, 0x12dd, 0x12bc, 0x0042, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019a, 0x0022, 0x0022, 0x019a, 0x0023,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019b, 0x0045, 0x0045, 0x019a, 0x0023,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0002, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019a, 0x019a, 0x019a, 0x019a, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x019a, 0x121b, 0x10c4,
-  0x10a2, 0x1082, 0x0000, 0x0022, 0x0022, 0x0022, 0x0022, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x229d, 0xdf1f, 0xef7d,
-  0xef7d, 0xdeda, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xcebc, 0xf7df, 0xe75d,
-  0xe75d, 0xf7df, 0xceba, 0x1082, 0x0000, 0x0022, 0x0042, 0x0042,
-  0x0042, 0x0042, 0x0022, 0x0000, 0x0882, 0x969d, 0x969d, 0x31a6,
-  0x29a6, 0x969d, 0x969d, 0x0882, 0x0021, 0x0a7a, 0x0a9a, 0x12bc,
-  0x12bc, 0x0a9a, 0x0a7a, 0x0022, 0x1081, 0xce9b, 0xf7df, 0xef5d,
-  0xef5d, 0xf7df, 0xdf3c, 0x1082, 0x0022, 0x129b, 0x010a, 0x12dd,
-  0x12dd, 0x010a, 0x129b, 0x0042, 0x0000, 0x216f, 0xd69b, 0xef5c,
-  0xe75d, 0xf7df, 0xdf3c, 0x1082, 0x0021, 0x127a, 0x0a9a, 0x12bc,
-  0x12bc, 0x0a9a, 0x127a, 0x0022, 0x0000, 0x0001, 0x2124, 0x2945,
-  0x31a7, 0x969d, 0x967d, 0x0882, 0x0000, 0x0022, 0x0042, 0x0022,
-  0x0022, 0x0042, 0x0022, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d,
-  0xef5d, 0xf7df, 0xcedd, 0x10a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6dd, 0x22bf, 0x019b, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0023, 0x0023, 0x0022, 0x0000, 0x1082, 0x10a2,
-  0x10a2, 0x10a4, 0x019b, 0x019b, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x019a, 0x019a, 0x019a, 0x019a, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0023, 0x019a, 0x0045, 0x0045, 0x019b, 0x0023, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0023, 0x019a, 0x0022, 0x0022, 0x019a, 0x0023, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019b, 0x0066, 0x0023, 0x0045, 0x01dd,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019a, 0x019a, 0x019a, 0x019a, 0x01bc,
-  0x0000, 0x0000, 0x0022, 0x019a, 0x019a, 0x019a, 0x0002, 0x0000,
-  0x0002, 0x0002, 0x0000, 0x0022, 0x0022, 0x0022, 0x0022, 0x0022,
-  0x0000, 0x0000, 0x0022, 0x019b, 0x00aa, 0x019b, 0x08a5, 0x0884,
-  0x109b, 0x109b, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x019a, 0x019a, 0x1a9e, 0x85fd, 0x8e7d,
-  0x8e7f, 0x85dd, 0x1904, 0x0000, 0x0000, 0x0000, 0x0022, 0x0043,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x10a5, 0xd6dd, 0xf7df, 0xdf3d,
-  0xdf3c, 0xf7df, 0xdeda, 0x1082, 0x0000, 0x0022, 0x127a, 0x0a9a,
-  0x0043, 0x0022, 0x0000, 0x0000, 0x1082, 0xe75d, 0xe75d, 0x29a6,
-  0x2986, 0xe75d, 0xe75d, 0x10a2, 0x0000, 0x0042, 0x0a7a, 0x0085,
-  0x0a9a, 0x127a, 0x0022, 0x0000, 0x0882, 0x7ddb, 0x9eff, 0x8e5d,
-  0x8e5d, 0x9eff, 0x965c, 0x0882, 0x0000, 0x0042, 0x0a7a, 0x0085,
-  0x0085, 0x0a7a, 0x0043, 0x0000, 0x0001, 0x194f, 0xce9b, 0xdf3c,
-  0xdf3d, 0xf7df, 0xdf3c, 0x10a2, 0x0000, 0x0022, 0x127a, 0x0a9a,
-  0x0085, 0x0a7a, 0x0043, 0x0000, 0x0000, 0x0001, 0x1904, 0x1925,
-  0x29a7, 0xe75d, 0xe75d, 0x10a2, 0x0000, 0x0000, 0x0022, 0x0042,
-  0x0a9a, 0x127a, 0x0022, 0x0000, 0x0000, 0x0882, 0x7dda, 0x8e5c,
-  0x8e5d, 0x9eff, 0x7dfd, 0x08a5, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0042, 0x0022, 0x0000, 0x0000, 0x0000, 0x1082, 0xce9d, 0xe75f,
-  0xe75d, 0xcebd, 0x1a9e, 0x019a, 0x019a, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0002, 0x189a, 0x18bb,
-  0x10a4, 0x10a4, 0x019b, 0x00aa, 0x019b, 0x0023, 0x0000, 0x0000,
-  0x0022, 0x0023, 0x0023, 0x0023, 0x0022, 0x0000, 0x0002, 0x0002,
-  0x0000, 0x0001, 0x019a, 0x019a, 0x019a, 0x0022, 0x0000, 0x0000,
-  0x01bc, 0x019a, 0x019a, 0x019a, 0x019a, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x01dd, 0x0045, 0x0023, 0x0045, 0x019b, 0x0023, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210,
-  0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210, 0xe210,
-  0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc, 0xd9ec, 0xd9ec, 0xd9ec, 0xd9ec,
-  0xd9ec, 0xd9ec, 0xd9ec, 0xd9ec, 0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8, 0xc9a8, 0xc188, 0xc188,
-  0xc188, 0xc188, 0xc9a8, 0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xea69, 0xca29, 0x28e7, 0x3149, 0x3148,
-  0x3127, 0x2926, 0x28e7, 0xca29, 0xea69, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xeb0a, 0x3107, 0x29aa, 0xd6bb, 0xee91,
-  0xdd81, 0xc500, 0x2966, 0x3108, 0xeb0a, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xe422, 0x3167, 0xde11, 0xffdd, 0xee71,
-  0xdd61, 0xedc0, 0xcd01, 0x3166, 0xe423, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd541, 0x3187, 0xd611, 0xef5c, 0x422b,
-  0x41c5, 0xdd60, 0xcd01, 0x3186, 0xd541, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6e7, 0xae47, 0x2127, 0x420b, 0xef5c, 0xee91,
-  0xdd81, 0xdd60, 0x39c6, 0x1927, 0xae47, 0xbee7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x770a, 0x6e69, 0x29a8, 0xd5f1, 0xffbd, 0xe671,
-  0xdd61, 0xe5c0, 0xc4e1, 0x2987, 0x6649, 0x770a, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x2e31, 0x21a9, 0xee92, 0xef7c, 0x422b,
-  0x41c5, 0xdd80, 0xdd80, 0x2187, 0x2e31, 0x36d2, 0x36d2, 0x36d2,
-  0x2678, 0x2678, 0x2678, 0x25f7, 0x2189, 0xd5f1, 0xffdd, 0xee71,
-  0xdd81, 0xedc0, 0xcd00, 0x2188, 0x25f7, 0x2698, 0x2678, 0x2678,
-  0x3539, 0x3559, 0x3559, 0x2cf8, 0x114a, 0x3189, 0xd6ba, 0xee90,
-  0xdd81, 0xcd00, 0x2966, 0x114a, 0x2cf8, 0x3559, 0x3559, 0x3559,
-  0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3b97, 0x192a, 0x296a, 0x2969,
-  0x2948, 0x2148, 0x192a, 0x3b97, 0x3c19, 0x3c19, 0x3c19, 0x3c19,
-  0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5af7, 0x5ad6, 0x5ad7,
-  0x5ad7, 0x5ad7, 0x5af7, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x6338,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34,
-  0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34, 0xaa34,
-  0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233,
-  0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233, 0xb233,
-  0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10,
-  0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10,
-  0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc, 0xd9ec, 0xc9cc, 0xc9ac, 0xc9ac,
-  0xc9ac, 0xc9ac, 0xc9cc, 0xd9ec, 0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8, 0xb988, 0x28e8, 0x3148, 0x3169,
-  0x3148, 0x3127, 0x28c7, 0xb988, 0xd9c8, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xda49, 0x28e7, 0x2967, 0xd611, 0xef5c,
-  0xee90, 0xcd22, 0x2966, 0x28e7, 0xda49, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xe30a, 0x3147, 0xcd22, 0xfef1, 0xef3b,
-  0xe670, 0xede1, 0xcd00, 0x3147, 0xe30a, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xe443, 0x3166, 0xcd22, 0xee6f, 0x422c,
-  0x41e8, 0xdd60, 0xcd01, 0x3166, 0xe423, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd561, 0x2126, 0x39c7, 0xee72, 0xef5b,
-  0xee70, 0xdd81, 0x39c5, 0x2127, 0xd561, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6e7, 0xa647, 0x2986, 0xc502, 0xfed1, 0xef3b,
-  0xe670, 0xedc1, 0xc4e1, 0x2987, 0xa647, 0xbee7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x770a, 0x6e69, 0x29a6, 0xdd81, 0xee6f, 0x422c,
-  0x41e8, 0xdd80, 0xdd80, 0x29a7, 0x6649, 0x770a, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x2e51, 0x2187, 0xcd02, 0xfef1, 0xef3c,
-  0xee70, 0xede1, 0xcce0, 0x2187, 0x2e31, 0x36d2, 0x36d2, 0x36d2,
-  0x2678, 0x2678, 0x2678, 0x2617, 0x116a, 0x3167, 0xd5f1, 0xef3b,
-  0xee70, 0xcd02, 0x2946, 0x116a, 0x25f7, 0x2698, 0x2678, 0x2678,
-  0x3539, 0x3559, 0x3559, 0x3559, 0x2c96, 0x114a, 0x2169, 0x218a,
-  0x2169, 0x2148, 0x114a, 0x2c96, 0x3559, 0x3559, 0x3559, 0x3559,
-  0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3bd8, 0x3bb8, 0x3bb7,
-  0x3bb8, 0x3bb8, 0x3bd8, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19,
-  0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338,
-  0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338, 0x6338,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257,
-  0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257, 0x8257,
-  0xb233, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234,
-  0xb234, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234,
-  0xda10, 0xda10, 0xda10, 0xda10, 0xda10, 0xc9f0, 0xc9f0, 0xc9ef,
-  0xc9cf, 0xc9ef, 0xc9f0, 0xda10, 0xda10, 0xda10, 0xda10, 0xda10,
-  0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc, 0xc1ac, 0x28e8, 0x3127, 0x3149,
-  0x316a, 0x3149, 0x28e8, 0xb9ac, 0xd9cc, 0xd9cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xc9a8, 0x28e7, 0x2966, 0xcd02, 0xee90,
-  0xef5c, 0xd611, 0x2987, 0x28c7, 0xc9a8, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xd249, 0x3127, 0xcd00, 0xede1, 0xe670,
-  0xef3b, 0xfef1, 0xcd22, 0x3126, 0xd249, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xe30a, 0x3147, 0xc501, 0xdd80, 0x4208,
-  0x422c, 0xee6f, 0xcd22, 0x3147, 0xe30a, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xec43, 0x2107, 0x39a5, 0xdd61, 0xee90,
-  0xef5b, 0xee92, 0x39c7, 0x2106, 0xe443, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd541, 0x3186, 0xc4e1, 0xedc1, 0xe670,
-  0xef3b, 0xfed1, 0xc502, 0x3166, 0xd541, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6e7, 0xa647, 0x31a6, 0xdd60, 0xdd80, 0x41e8,
-  0x422c, 0xee6f, 0xdd82, 0x3186, 0xa627, 0xbee7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x770a, 0x6e69, 0x2987, 0xc4e0, 0xede1, 0xee70,
-  0xef3c, 0xfef1, 0xcd02, 0x2966, 0x6649, 0x770a, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x2e51, 0x1189, 0x2946, 0xcd02, 0xee70,
-  0xef3b, 0xde11, 0x3167, 0x1189, 0x2e51, 0x36d2, 0x36d2, 0x36d2,
-  0x2678, 0x2678, 0x2678, 0x2678, 0x25b6, 0x116a, 0x2168, 0x2189,
-  0x21aa, 0x2189, 0x116a, 0x2596, 0x2678, 0x2678, 0x2678, 0x2678,
-  0x3539, 0x3559, 0x3559, 0x3559, 0x3559, 0x34d8, 0x2cd8, 0x2cb7,
-  0x2cb7, 0x2cb7, 0x34d8, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559,
-  0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419,
-  0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419, 0x4419,
-  0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38,
-  0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b58,
-  0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318,
-  0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6318, 0x6338,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0xb233, 0xb234, 0xb234, 0xb234, 0xb234, 0xa213, 0x9a13, 0x9a13,
-  0x99f3, 0x99f2, 0xa213, 0xb234, 0xb234, 0xb234, 0xb234, 0xb234,
-  0xda10, 0xda10, 0xda10, 0xda10, 0xc1cf, 0x28e9, 0x2927, 0x3148,
-  0x3149, 0x294a, 0x28e9, 0xc1cf, 0xda10, 0xda10, 0xda10, 0xda10,
-  0xd9cc, 0xd9cc, 0xd9cc, 0xc9cc, 0x28e8, 0x2966, 0xc500, 0xdd81,
-  0xee90, 0xdeda, 0x31aa, 0x28c8, 0xc9cc, 0xd9cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xc9a8, 0x2927, 0xcd01, 0xedc0, 0xdd61,
-  0xe671, 0xffdd, 0xde31, 0x3128, 0xc1a8, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xd249, 0x3127, 0xc501, 0xdd60, 0x41c5,
-  0x422b, 0xef5c, 0xde31, 0x3148, 0xd229, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xeb0a, 0x20e7, 0x39c6, 0xdd60, 0xdd81,
-  0xee91, 0xef5c, 0x420b, 0x20e7, 0xe30a, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xe443, 0x3166, 0xc4e1, 0xe5c0, 0xdd61,
-  0xe671, 0xffbd, 0xd611, 0x3167, 0xe423, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd541, 0x3186, 0xdd60, 0xdd80, 0x41c5,
-  0x422a, 0xef5c, 0xeeb2, 0x3187, 0xd541, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6e7, 0xa647, 0x2986, 0xc4e1, 0xedc0, 0xdd81,
-  0xee71, 0xffdd, 0xd611, 0x3188, 0xa626, 0xbee7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x770a, 0x6e89, 0x19a8, 0x2946, 0xc4e0, 0xdd61,
-  0xee70, 0xdeba, 0x318a, 0x1988, 0x6e69, 0x770a, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x2ed2, 0x2df1, 0x1189, 0x2168, 0x2188,
-  0x21a9, 0x21aa, 0x1189, 0x2df1, 0x2ed2, 0x36d2, 0x36d2, 0x36d2,
-  0x2678, 0x2678, 0x2678, 0x2678, 0x2e78, 0x2617, 0x25f7, 0x25f7,
-  0x25f7, 0x25f7, 0x25f7, 0x2e78, 0x2678, 0x2678, 0x2678, 0x2678,
-  0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3559, 0x3559, 0x3559,
-  0x3559, 0x3559, 0x3559, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539,
-  0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19,
-  0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c39,
-  0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9,
-  0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9, 0x43f9,
-  0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x6338, 0x6338, 0x6338,
-  0x6338, 0x6338, 0x6338, 0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x5b38,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x8277, 0x7a56, 0x7236, 0x7236,
-  0x7236, 0x7236, 0x7a56, 0x8277, 0x8277, 0x8277, 0x8277, 0x8277,
-  0xb233, 0xb234, 0xb234, 0xb234, 0x99f2, 0x20e9, 0x2928, 0x2948,
-  0x2948, 0x2949, 0x20e9, 0x91f2, 0xb234, 0xb234, 0xb234, 0xb234,
-  0xda10, 0xda10, 0xe210, 0xc9ef, 0x28e9, 0x2966, 0xc500, 0xdd60,
-  0xdd81, 0xd5ef, 0x31a9, 0x28e9, 0xc9ef, 0xe210, 0xda10, 0xda10,
-  0xd9cc, 0xd9cc, 0xe1cc, 0xc9ac, 0x3127, 0xcd01, 0xedc0, 0xdd60,
-  0xdd61, 0xfef1, 0xdedb, 0x3149, 0xc9ab, 0xe1cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xc9a8, 0x3127, 0xc501, 0xdd60, 0x41c5,
-  0x41e7, 0xee92, 0xdeda, 0x3149, 0xc188, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xda49, 0x20e7, 0x39c6, 0xdd60, 0xdd60,
-  0xdd82, 0xee70, 0x422b, 0x20e8, 0xda49, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xe30a, 0x3147, 0xc4e1, 0xedc0, 0xdd60,
-  0xdd61, 0xfed1, 0xd6ba, 0x3169, 0xe309, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xe423, 0x3166, 0xdd60, 0xdd80, 0x41c5,
-  0x41e7, 0xeeb2, 0xef7d, 0x31a9, 0xe422, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd541, 0x3166, 0xc4e1, 0xedc0, 0xdd60,
-  0xdd81, 0xfef1, 0xd6bb, 0x3188, 0xd541, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6e7, 0xae67, 0x21a7, 0x2946, 0xc4e1, 0xdd60,
-  0xdd81, 0xd5cf, 0x3189, 0x2187, 0xae47, 0xbee7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x76e9, 0x76ea, 0x6609, 0x19a8, 0x2187, 0x21a7,
-  0x21a7, 0x2188, 0x1988, 0x6609, 0x76ea, 0x76e9, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x2e51, 0x2631, 0x2632,
-  0x2631, 0x2631, 0x2e51, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2,
-  0x2678, 0x2678, 0x2678, 0x2678, 0x2e78, 0x2e78, 0x2e78, 0x2e78,
-  0x2e78, 0x2e78, 0x2e78, 0x2e78, 0x2678, 0x2678, 0x2678, 0x2678,
-  0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559,
-  0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559, 0x3559,
-  0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539,
-  0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539, 0x3539,
-  0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x4419, 0x4419, 0x4419,
-  0x4419, 0x4419, 0x4419, 0x3c19, 0x3c19, 0x3c19, 0x3c19, 0x3c19,
-  0x5b38, 0x5b38, 0x5b38, 0x5b38, 0x6338, 0x5317, 0x52f7, 0x52f7,
-  0x52f7, 0x52f7, 0x5317, 0x6338, 0x5b38, 0x5b38, 0x5b38, 0x6338,
-  0x8277, 0x8277, 0x8277, 0x8277, 0x7235, 0x18e9, 0x2148, 0x2948,
-  0x2948, 0x2148, 0x18e9, 0x7235, 0x8277, 0x8277, 0x8277, 0x8277,
-  0xb233, 0xb234, 0xb234, 0xa213, 0x20e9, 0x2966, 0xcd00, 0xdd80,
-  0xdd60, 0xcd01, 0x3187, 0x20e9, 0xa213, 0xb234, 0xb234, 0xb234,
-  0xda10, 0xda10, 0xe210, 0xc9ef, 0x3127, 0xcd00, 0xedc0, 0xdd60,
-  0xdd60, 0xede1, 0xddee, 0x3149, 0xc9cf, 0xe210, 0xda10, 0xda10,
-  0xd9cc, 0xd9cc, 0xe1cc, 0xc9ac, 0x3127, 0xc501, 0xdd60, 0x41c5,
-  0x41c5, 0xdd82, 0xd5ee, 0x3148, 0xc9ab, 0xe1cc, 0xd9cc, 0xd9cc,
-  0xd9c8, 0xd9c8, 0xd9c8, 0xc9a8, 0x20c7, 0x39c6, 0xdd60, 0xdd60,
-  0xdd60, 0xdd60, 0x41e8, 0x20c7, 0xc9a8, 0xd9c8, 0xd9c8, 0xd9c8,
-  0xea69, 0xea69, 0xea69, 0xd249, 0x3127, 0xc4e1, 0xedc0, 0xdd60,
-  0xdd60, 0xede1, 0xd5ce, 0x3148, 0xd229, 0xea69, 0xea69, 0xea69,
-  0xfb4a, 0xfb4a, 0xfb4a, 0xe30a, 0x3147, 0xdd80, 0xdd80, 0x41c5,
-  0x41c5, 0xdd82, 0xee6f, 0x3968, 0xe30a, 0xfb4a, 0xfb4a, 0xfb4a,
-  0xfc82, 0xfc82, 0xfca2, 0xe423, 0x3146, 0xc4e1, 0xedc0, 0xdd60,
-  0xdd60, 0xede1, 0xd5ce, 0x3168, 0xe423, 0xfca2, 0xfc82, 0xfc82,
-  0xe5c0, 0xe5c0, 0xedc0, 0xd561, 0x2987, 0x2946, 0xc4e1, 0xdd60,
-  0xdd60, 0xc4e1, 0x2967, 0x2987, 0xd561, 0xede0, 0xe5c0, 0xe5c0,
-  0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7, 0x9e07, 0x21a7, 0x2987, 0x29a7,
-  0x29a7, 0x2987, 0x2187, 0x9e07, 0xb6c7, 0xb6c7, 0xb6c7, 0xb6c7,
-  0x76e9, 0x76ea, 0x76e9, 0x76e9, 0x76e9, 0x6689, 0x6669, 0x6669,
-  0x6669, 0x6669, 0x6689, 0x76e9, 0x76e9, 0x76e9, 0x76e9, 0x76ea,
-  0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2,
-  0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2, 0x36d2,
-  0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698,
-  0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698, 0x2698,
-  0x8fd3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3,
-  0x7f13, 0x42f6, 0x42b6, 0x4316, 0x7ef3, 0x8ff3, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x8fd3, 0x8793, 0x8f93, 0x8f93, 0x87b2, 0x7f32,
-  0x4355, 0x8cdb, 0xdf3e, 0xb65d, 0x53b6, 0x7f13, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x8753, 0x7476, 0x63b4, 0x5bb3, 0x2c0d, 0x23ec,
-  0x29ed, 0x9d9a, 0xbe7c, 0xdf3d, 0xb63d, 0x5374, 0x86f2, 0x8ff3,
-  0x8ff3, 0x8793, 0x7476, 0xa5bb, 0x296a, 0x296a, 0x218a, 0x2189,
-  0x2969, 0x31cb, 0x29aa, 0x31cb, 0xe6d9, 0xd449, 0x8247, 0x86d1,
-  0x8ff3, 0x8793, 0x7416, 0xa5bb, 0x31ab, 0xd6bb, 0xef5d, 0xef5d,
-  0xef7d, 0xef5d, 0xd6bb, 0x3169, 0xd427, 0xfe2e, 0xdc07, 0x7986,
-  0x8792, 0x7f32, 0x5b72, 0x7c38, 0x29ab, 0xe75d, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xdf5d, 0x3189, 0xd3c4, 0xeca6, 0xedae, 0x7167,
-  0x34af, 0x3cef, 0x7692, 0x42b1, 0x1949, 0x6eb9, 0x76d9, 0x29aa,
-  0x322c, 0x7f5b, 0x7f5b, 0x2989, 0xc385, 0xd3c5, 0xa249, 0x418c,
-  0xae5c, 0xa63b, 0x3c70, 0x3274, 0x192a, 0x1949, 0x1929, 0x19aa,
-  0x66b9, 0x77dc, 0x66b9, 0x1949, 0x3a0c, 0x31cc, 0x498c, 0xc1ef,
-  0x8cda, 0x84ba, 0x42f6, 0x8cba, 0x8499, 0x3a54, 0x1929, 0x6698,
-  0x77dc, 0x66b9, 0x19aa, 0x21c9, 0x6e91, 0x33ac, 0x898c, 0xa18d,
-  0x238d, 0x3ab5, 0x8cba, 0xef7e, 0xbebe, 0x8479, 0x198a, 0x2e37,
-  0x2e38, 0x198a, 0x1949, 0x7671, 0x8f93, 0x7ef2, 0x33ac, 0x2b4b,
-  0x76f2, 0x42f5, 0x94fb, 0xf7bf, 0xc6de, 0x84b9, 0x198a, 0x2e37,
-  0x2e38, 0x1949, 0x6374, 0x7c76, 0x7436, 0x6c35, 0x7f52, 0x8792,
-  0x8773, 0x42f5, 0x949a, 0xef5e, 0xc65c, 0x8c58, 0x216a, 0x5e78,
-  0x5e78, 0x21aa, 0xa5ba, 0xdefd, 0xaddb, 0x5312, 0x7f32, 0x8ff3,
-  0x8752, 0x3a2e, 0xa1ef, 0xf4d8, 0xe2b2, 0xa1ad, 0x20e8, 0x21c9,
-  0x21c9, 0x1908, 0x5271, 0x5ab2, 0x52d3, 0x4ab1, 0x348e, 0x8792,
-  0x8752, 0x3a0d, 0xa9ad, 0xf498, 0xe251, 0xa94c, 0x39cc, 0x7ed1,
-  0x76f1, 0x2b8c, 0x898c, 0x91ad, 0x7c38, 0x7478, 0x2c0d, 0x7f72,
-  0x8772, 0x428d, 0x99ae, 0xec57, 0xda30, 0x996d, 0x428d, 0x8772,
-  0x8ff3, 0x7f32, 0x33cc, 0x2b6c, 0x2bad, 0x340d, 0x7f32, 0x8fd3,
-  0x8fd3, 0x7ef2, 0x420d, 0xa98d, 0xa96d, 0x41ed, 0x7ef2, 0x8fd3,
-  0x8fd3, 0x8fd3, 0x7f92, 0x7f72, 0x7f72, 0x7f72, 0x8fd3, 0x8ff3,
-  0x8752, 0x3aae, 0x29ed, 0x3a8d, 0x8772, 0x8ff3, 0x87b2, 0x87b2,
-  0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8752, 0x8752, 0x8752, 0x8ff3, 0x8772, 0x556f, 0x556f,
-  0x7f72, 0x8773, 0x8773, 0x8773, 0x8752, 0x8752, 0x8752, 0x8ff3,
-  0x8fd3, 0x8ff3, 0x8ff3, 0x8ff3, 0x7f11, 0x444d, 0x82ed, 0x8b0d,
-  0x448e, 0x32b3, 0x3274, 0x3a93, 0x7188, 0x7146, 0x79e7, 0x86d1,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x7f12, 0x21c9, 0x2169, 0x316a, 0x316a,
-  0x298a, 0x216a, 0x214a, 0x20e8, 0xa208, 0xb228, 0xaa08, 0x7987,
-  0x8fd3, 0x8ff3, 0x8f93, 0x63f4, 0x294a, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd6bb, 0x31a9, 0xddcf, 0xf670, 0xedef, 0xb208,
-  0x8792, 0x8ff3, 0x8f93, 0x5b73, 0x296a, 0xe77d, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xdf5d, 0x3189, 0xd3c6, 0xec46, 0xdc06, 0xaa08,
-  0x4d90, 0x7f72, 0x8793, 0x4b10, 0x1929, 0x6e99, 0x76d9, 0x29aa,
-  0x322c, 0x7f5b, 0x7f5b, 0x2169, 0x99a7, 0xa9e7, 0x99e8, 0x49cc,
-  0x8597, 0x5591, 0x7f72, 0x7ef2, 0x21e9, 0x21c9, 0x1929, 0x19aa,
-  0x66b9, 0x77dc, 0x66b9, 0x1949, 0x31ec, 0x3a0c, 0x39ec, 0xab30,
-  0xaeba, 0x8597, 0x4d90, 0x87b2, 0x7ef2, 0x6e30, 0x2189, 0x5e78,
-  0x77bc, 0x66b9, 0x19aa, 0x21c9, 0x7ef1, 0x7f32, 0x448e, 0x934e,
-  0x8598, 0x7d77, 0x4d90, 0x76d3, 0x4b96, 0x42f5, 0x196a, 0x3658,
-  0x3658, 0x198a, 0x1929, 0x7671, 0x8793, 0x8ff3, 0x7f72, 0x44ce,
-  0x3cae, 0x450f, 0x76b2, 0x53b6, 0xb63d, 0xd6bc, 0x29cb, 0x671a,
-  0x671a, 0x196a, 0x6b74, 0x7c56, 0x7c96, 0x8753, 0x8fd3, 0x87b2,
-  0x87b2, 0x7eb1, 0x5355, 0xb63d, 0xefbf, 0xbe7c, 0x21aa, 0x2596,
-  0x2596, 0x218a, 0xd6bc, 0xef7e, 0xdefd, 0x7455, 0x8793, 0x8ff3,
-  0x86d1, 0x8209, 0xd291, 0xeefd, 0xc6de, 0xb63c, 0x2149, 0x1989,
-  0x19a9, 0x218a, 0x8cb9, 0xb65d, 0x8cda, 0x5332, 0x7f32, 0x8ff3,
-  0x7967, 0xd250, 0xf437, 0xe2d3, 0xa4ba, 0xa5bb, 0x42ce, 0x7eb1,
-  0x8752, 0x7ef2, 0x5352, 0x4ab1, 0x52f3, 0x7d17, 0x4d90, 0x87b2,
-  0x7128, 0xe416, 0xe292, 0xe210, 0xba30, 0x4aef, 0x7f12, 0x8ff3,
-  0x8ff3, 0x8ff3, 0x7f32, 0x44cf, 0x7d36, 0x7d77, 0x4d90, 0x87b2,
-  0x398c, 0xa9ce, 0xe210, 0xd1f0, 0x4a0d, 0x7ed1, 0x8ff3, 0x8fd3,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x7f52, 0x3cae, 0x3cae, 0x7f72, 0x8ff3,
-  0x8752, 0x3aae, 0x320d, 0x322d, 0x322d, 0x320d, 0x3a8d, 0x8772,
-  0x8ff3, 0x8ff3, 0x87b2, 0x3cee, 0x3cee, 0x87b2, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8752, 0x8752, 0x8752, 0x8772, 0x8772, 0x8772, 0x87b2,
-  0x87b2, 0x8ff3, 0x8ff3, 0x8792, 0x7f11, 0x8731, 0x8752, 0x8ff3,
-  0x8fd3, 0x8ff3, 0x8ff3, 0x8ff3, 0x8772, 0x7f51, 0x7f11, 0x450e,
-  0x450e, 0x76f1, 0x7f32, 0x86d1, 0x7a27, 0x79a7, 0x7a08, 0x86d1,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x7f12, 0x21c9, 0x29aa, 0x29ca, 0x29aa,
-  0x29aa, 0x29ca, 0x29ca, 0x2988, 0xd407, 0xedae, 0xaa28, 0x7167,
-  0x8fd3, 0x8ff3, 0x8f93, 0x63f4, 0x294a, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd6bb, 0x31a9, 0xe5cd, 0xeca6, 0xd3c5, 0x398b,
-  0x87b2, 0x8ff3, 0x8f93, 0x6394, 0x296a, 0xe77d, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xdf5d, 0x3189, 0xcc07, 0xec25, 0xcbc6, 0x320c,
-  0x4d6f, 0x7f72, 0x8f93, 0x6394, 0x214a, 0x6eb9, 0x76d9, 0x29aa,
-  0x322c, 0x7f5b, 0x7f5b, 0x21ab, 0x9476, 0xc3c7, 0x426b, 0x446e,
-  0x934e, 0x556f, 0x7f52, 0x4ab1, 0x18e9, 0x1949, 0x1929, 0x19aa,
-  0x66b9, 0x77dc, 0x6699, 0x21aa, 0x9539, 0x4ace, 0x446e, 0xb3d0,
-  0x9b4f, 0x4d2f, 0x7f52, 0x5331, 0x4290, 0x424f, 0x1949, 0x6eb9,
-  0x7fdc, 0x6eb9, 0x198a, 0x10c8, 0x3aae, 0x76d2, 0x4d4f, 0xbbf1,
-  0x8557, 0x44ce, 0x8792, 0x8793, 0x8793, 0x7ef1, 0x21ca, 0x6f1a,
-  0x6f3a, 0x21ca, 0x1928, 0x326c, 0x7f12, 0x87b2, 0x44ce, 0xa679,
-  0x7d77, 0x446e, 0x7f11, 0x8f72, 0x8773, 0x7ed2, 0x19a9, 0x2e38,
-  0x2e38, 0x1989, 0x7651, 0x8712, 0x8f93, 0x8792, 0x4d0f, 0x9e98,
-  0x440d, 0x69ea, 0x71ea, 0x720b, 0x42d5, 0x3ab4, 0x1129, 0x2595,
-  0x2596, 0x1969, 0x6bf5, 0x7456, 0x7476, 0x8753, 0x7f52, 0x4d0f,
-  0x71ca, 0xa9cd, 0xb1ad, 0xa9ee, 0x94ba, 0x84b9, 0x29ab, 0x196a,
-  0x1149, 0x216a, 0xadfb, 0xbe7d, 0xb63c, 0x7476, 0x8773, 0x87b2,
-  0xb1ad, 0xec57, 0xf498, 0xf4d8, 0xf75e, 0xef9f, 0xdf1d, 0x8499,
-  0x3a34, 0x6355, 0xb65d, 0xc6de, 0xb65d, 0x7416, 0x8773, 0x8ff3,
-  0xa98d, 0xda30, 0xe231, 0xda92, 0xc65c, 0xbebd, 0xbe9d, 0x8499,
-  0x3a6f, 0x5312, 0x8cda, 0xae1c, 0x8cb9, 0x5332, 0x8772, 0x8ff3,
-  0x398c, 0xa16d, 0xb16c, 0xb1ae, 0x94ba, 0x951b, 0x8cba, 0x3a8f,
-  0x7ef1, 0x8712, 0x4af2, 0x4a92, 0x4a91, 0x3c4e, 0x8792, 0x8ff3,
-  0x8ff3, 0x8772, 0x42ef, 0xa5db, 0xc6de, 0xc6fe, 0xdf1e, 0x4b15,
-  0x8773, 0x8f93, 0x5331, 0x4ad1, 0x5351, 0x8773, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x7ef2, 0x4b30, 0xadfb, 0xb63c, 0x8cb9, 0x42cf,
-  0x7f32, 0x87b2, 0x8773, 0x86d1, 0x86d1, 0x8fd3, 0x8fd3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x7ef2, 0x3a4e, 0x29ad, 0x320d, 0x6e10,
-  0x450e, 0x452e, 0x7690, 0x69e7, 0x79e7, 0x86d1, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x8772, 0x1968, 0x2129, 0x2169, 0x29ca,
-  0x29aa, 0x29aa, 0x29aa, 0x20c7, 0x99a7, 0x79e7, 0x86d1, 0x8fd3,
-  0x8fd3, 0x8ff3, 0x8ff3, 0x7ef2, 0x29ca, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd6bb, 0x3189, 0xcb65, 0xa9c7, 0x79e8, 0x8752,
-  0x87b2, 0x87b2, 0x8753, 0x6c14, 0x298a, 0xe77d, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xdf5d, 0x3189, 0xcb84, 0xb1e7, 0x7967, 0x8f51,
-  0x4d2f, 0x4d0f, 0x7456, 0xa5ba, 0x21aa, 0x6e99, 0x76d9, 0x29aa,
-  0x2a2b, 0x7f5b, 0x775b, 0x29a9, 0xcbc7, 0xaa28, 0x7187, 0x8711,
-  0xa32e, 0x9b2e, 0x73b5, 0xa5fb, 0x298b, 0x1929, 0x1929, 0x29aa,
-  0x76b9, 0x87dc, 0x6699, 0x21aa, 0xadd9, 0x8c99, 0x3a0d, 0x44ef,
-  0xc370, 0x9b0e, 0x5b12, 0x8499, 0x7c38, 0x4270, 0x2149, 0xc6bb,
-  0xe7de, 0xcedb, 0x29aa, 0x29aa, 0xb63c, 0x8cda, 0x322e, 0x7d57,
-  0x932e, 0x548e, 0x7ef2, 0x5372, 0x5372, 0x7e71, 0x21c9, 0x3638,
-  0x3e58, 0x218a, 0x2129, 0xce9b, 0xbe9d, 0x8479, 0x4290, 0xa659,
-  0x44ae, 0x7d55, 0x8712, 0x86f1, 0x8793, 0x8752, 0x19c9, 0x2617,
-  0x2637, 0x1129, 0x320d, 0x8cb9, 0x8499, 0x3a8f, 0x74f6, 0x8598,
-  0x8690, 0x79e9, 0x7988, 0x7a08, 0x8ef1, 0x8752, 0x19a9, 0x2576,
-  0x2576, 0x19a9, 0x7671, 0x3a8e, 0x3a0d, 0x446e, 0x3c8e, 0x3cae,
-  0x7167, 0xa9ac, 0xec16, 0xd230, 0x8209, 0x7e51, 0x21e9, 0x19a9,
-  0x19a9, 0x21e9, 0x7ed2, 0x4ccf, 0x8b0e, 0x932e, 0x446d, 0x7f52,
-  0x396c, 0xc9ef, 0xea92, 0xf437, 0xd292, 0x5355, 0x7692, 0x8751,
-  0x8731, 0x7ed2, 0x7455, 0x6bf6, 0x73b5, 0x932f, 0x4cce, 0x87b2,
-  0x3a2d, 0xc20f, 0xe1f0, 0xdaf3, 0xeefd, 0xb63d, 0x53d6, 0x7f13,
-  0x8f93, 0x6c55, 0x8cba, 0xae1c, 0x8cda, 0x6bd5, 0x8732, 0x8ff3,
-  0x7ed2, 0x4a2d, 0xca10, 0x9c99, 0xc6dd, 0xefbf, 0xae1c, 0x4b76,
-  0x7ef3, 0x5312, 0x8cba, 0x951b, 0x8cba, 0x5312, 0x8772, 0x8ff3,
-  0x8752, 0x3a6e, 0x8cda, 0xf79f, 0xc6be, 0x8cba, 0x3a4e, 0x8772,
-  0x8793, 0x5331, 0x4ad1, 0x4ad1, 0x4ad1, 0x5331, 0x8772, 0x8ff3,
-  0x8752, 0x324e, 0x8cda, 0xf79f, 0xc6de, 0x8cba, 0x3a4e, 0x8772,
-  0x8ff3, 0x8773, 0x8773, 0x8773, 0x8752, 0x8772, 0x8fd3, 0x8ff3,
-  0x8752, 0x3ace, 0x8479, 0xe75e, 0xb63c, 0x7c58, 0x320d, 0x76b1,
-  0x7f31, 0x7f31, 0x7f31, 0x8752, 0x8fd3, 0x8ff3, 0x8fd3, 0x8ff3,
-  0x8fd3, 0x7ef2, 0x42ef, 0x7c37, 0x298a, 0x298a, 0x296a, 0x29ca,
-  0x29ca, 0x29ca, 0x29aa, 0x21c9, 0x8772, 0x8ff3, 0x8fd3, 0x8ff3,
-  0x8fd3, 0x8ff3, 0x7f12, 0x3a8d, 0x2129, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd69b, 0x29aa, 0x7eb1, 0x8ff3, 0x8fd3, 0x8ff3,
-  0x8fd3, 0x8fd3, 0x8ff3, 0x7671, 0x29ca, 0xe75d, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xdf5d, 0x2949, 0x71e7, 0x86d0, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8ff3, 0x8753, 0x6c34, 0x216a, 0x6e99, 0x76d9, 0x29aa,
-  0x3a2c, 0x8f5b, 0x875b, 0x2989, 0xc386, 0x8289, 0x86d1, 0x8ff3,
-  0x87b2, 0x7f52, 0x7476, 0xa5bb, 0x29ab, 0x21aa, 0x1129, 0x21aa,
-  0xcedb, 0xe7df, 0xcebb, 0x31aa, 0xdedb, 0xbe1a, 0x7aab, 0x86d1,
-  0x4d2f, 0x4d0f, 0x6bd5, 0xb65d, 0xb67c, 0xa599, 0x218a, 0x6698,
-  0x7fdc, 0x76b9, 0x298a, 0x298a, 0xbe7c, 0xefbf, 0xbdfa, 0x79c8,
-  0xbb90, 0xb370, 0x52d1, 0x84da, 0xb63d, 0x8499, 0x198a, 0x2e37,
-  0x2e58, 0x19aa, 0x2169, 0x9d79, 0xbebd, 0xcf1e, 0xe6fd, 0x7168,
-  0xa32e, 0x9b4e, 0x444e, 0x4ab1, 0x5291, 0x4ab1, 0x1969, 0x2637,
-  0x2617, 0x19a9, 0x7650, 0x4b50, 0xa5db, 0xb63c, 0x8c99, 0x31ed,
-  0x446d, 0x44ce, 0x7e70, 0x71eb, 0x71eb, 0x75f0, 0x19a9, 0x2576,
-  0x2576, 0x19a9, 0x8752, 0x7f12, 0x42ef, 0x3a6e, 0x3a8e, 0x342d,
-  0x8792, 0x7ed1, 0x7a6b, 0xa9ad, 0xa98c, 0x71eb, 0x20e8, 0x19a9,
-  0x19a9, 0x21e9, 0x7f31, 0x87b2, 0x7f32, 0x7f12, 0x8752, 0x87b2,
-  0x8f72, 0x7a8b, 0xa9ad, 0xec57, 0xda30, 0xa94c, 0x71ea, 0x7ed1,
-  0x8752, 0x7ed2, 0x4d4f, 0x452f, 0x452f, 0x4d70, 0x8792, 0x8ff3,
-  0x8752, 0x720b, 0xb1ad, 0xf498, 0xe251, 0xa96c, 0x7a0b, 0x8f72,
-  0x8fb3, 0x6c35, 0x6bf6, 0x7416, 0x6bf6, 0x5bb4, 0x4d4f, 0x87b2,
-  0x8752, 0x722b, 0xa9ad, 0xf498, 0xe251, 0xa96c, 0x720a, 0x8f72,
-  0x8772, 0x5312, 0xb61c, 0xef7e, 0xb63c, 0x4ad2, 0x3c6e, 0x8792,
-  0x7ef3, 0x5376, 0xbe9d, 0xf75e, 0xdab2, 0xe1f0, 0xc1ef, 0x428e,
-  0x7ef2, 0x5372, 0x8499, 0xae1c, 0x8499, 0x42d1, 0x4d4f, 0x87b2,
-  0x4316, 0xb63c, 0xef9f, 0xc6bd, 0xa4da, 0xc230, 0x528e, 0x7f12,
-  0x8ff3, 0x8733, 0x5372, 0x5332, 0x4b11, 0x448e, 0x7f72, 0x8ff3,
-  0x4295, 0xdf1e, 0xcefe, 0xbebd, 0xa5ba, 0x422d, 0x6e30, 0x7f51,
-  0x7f31, 0x7f31, 0x7ed1, 0x7ed1, 0x8752, 0x8792, 0x8fd3, 0x8ff3,
-  0x3a4f, 0x8499, 0xb63c, 0xa5da, 0x29aa, 0x2149, 0x29ea, 0x29ea,
-  0x29ca, 0x29ea, 0x29ca, 0x21e9, 0x8752, 0x8ff3, 0x8fd3, 0x8ff3,
-  0x7ef2, 0x3ace, 0x3a6e, 0x324d, 0x2149, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd69b, 0x29ca, 0x7f31, 0x8ff3, 0x8ff3, 0x8ff3,
-  0x8fd3, 0x8772, 0x8752, 0x76b1, 0x29ca, 0xef5d, 0xffff, 0xef7d,
-  0xef5d, 0xffff, 0xef5d, 0x29ca, 0x76b2, 0x8773, 0x8773, 0x8ff3,
-  0x8fd3, 0x8ff3, 0x8ff3, 0x8751, 0x29c9, 0xd6bb, 0xdedc, 0x31aa,
-  0x3a2c, 0xe77d, 0xe77d, 0x298a, 0x3a94, 0x42d6, 0x4355, 0x7ef3,
-  0x87b2, 0x8fd3, 0x8ff3, 0x8712, 0x29ca, 0x31aa, 0x2149, 0x21aa,
-  0x6eb9, 0x87dc, 0x76b9, 0x218a, 0x8479, 0x94fb, 0x8cba, 0x4b16,
-  0x4d6f, 0x7f72, 0x8793, 0x7476, 0xb63b, 0xce9b, 0x29aa, 0x5e78,
-  0x77dc, 0x66b9, 0x19aa, 0x3169, 0xdf1d, 0xf7bf, 0xe75e, 0x94fb,
-  0x934e, 0x5d2f, 0x7f12, 0x6bf6, 0xbe9d, 0xb65c, 0x21aa, 0x2e37,
-  0x2e58, 0x19aa, 0x28e6, 0xc3a7, 0xc67b, 0xc6de, 0xbe9d, 0x8cda,
-  0xc350, 0x9b6e, 0x4cef, 0x5352, 0xadfb, 0x8499, 0x198a, 0x2617,
-  0x2638, 0x1928, 0x8987, 0xaa29, 0x8c78, 0x8cba, 0x8479, 0x3a2f,
-  0x9b0e, 0x932e, 0x4d4f, 0x7ef2, 0x5b92, 0x4ad1, 0x1949, 0x2596,
-  0x2596, 0x1129, 0x31ab, 0x31ec, 0x3a4e, 0x3a4e, 0x3a8e, 0x342d,
-  0x446d, 0x44ce, 0x7f72, 0x8ff3, 0x8712, 0x7e51, 0x2168, 0x19a9,
-  0x19a9, 0x1968, 0x3c8f, 0x452f, 0x76f1, 0x8752, 0x8752, 0x8792,
-  0x8792, 0x87b2, 0x8ff3, 0x86f1, 0x7a8b, 0x7a2b, 0x71ea, 0x7e50,
-  0x7ef1, 0x3c6d, 0x7d57, 0x7d77, 0x4d70, 0x7f92, 0x8ff3, 0x8ff3,
-  0x8ff3, 0x8ff3, 0x86f2, 0x828c, 0xd250, 0xec16, 0xb1cd, 0x728b,
-  0x8732, 0x44af, 0x7416, 0x7c17, 0x6c35, 0x4d50, 0x7f72, 0x8ff3,
-  0x8ff3, 0x8773, 0x4b14, 0xca31, 0xf477, 0xea92, 0xc9ef, 0x420d,
-  0x7ef2, 0x7455, 0xe71d, 0xf79e, 0xe73e, 0x6c15, 0x4d70, 0x87b2,
-  0x1001, 0x880b, 0xf156, 0xfe3d, 0xe8b4, 0x704c, 0x043d, 0x1d3f,
-  0x1d3f, 0x045d, 0x704c, 0xe893, 0xfe1d, 0xf156, 0x880b, 0x1001,
-  0x884c, 0xe134, 0xfd9c, 0xe935, 0x800a, 0x1022, 0x22d2, 0xc71f,
-  0xc73f, 0x22d3, 0x1022, 0x800a, 0xe935, 0xfd9c, 0xe134, 0x884c,
-  0xecbe, 0xfe3d, 0xe935, 0x800a, 0x0801, 0x1060, 0xb484, 0x24db,
-  0x24db, 0xb4a4, 0x1060, 0x0801, 0x780a, 0xe935, 0xfe3d, 0xecbe,
-  0xff7f, 0xdcbe, 0x784b, 0x0801, 0x0000, 0x10a6, 0x3186, 0x2189,
-  0x2149, 0x3186, 0x10c6, 0x1080, 0x1001, 0x782b, 0xdc9e, 0xff9f,
-  0xd79f, 0x24fc, 0x0884, 0x1060, 0x10a6, 0x3166, 0xd562, 0xee4e,
-  0xec84, 0xd521, 0x3186, 0xb420, 0x20e0, 0x0864, 0x24fc, 0xd79f,
-  0x14fb, 0x0674, 0x2312, 0xb463, 0x3166, 0xd403, 0xfe21, 0xee2e,
-  0xec84, 0xd521, 0x2106, 0x20e0, 0xb462, 0x2312, 0x0674, 0x14fc,
-  0x0063, 0x2311, 0xb65c, 0x22f3, 0x2128, 0xec63, 0xedc1, 0x4208,
-  0x3147, 0x3186, 0x10a6, 0x0022, 0x22f2, 0xb67c, 0x2312, 0x0063,
-  0x28e0, 0xb462, 0x22f2, 0x1414, 0x2148, 0xec43, 0xfe21, 0xee2e,
-  0xec84, 0xdd41, 0x3187, 0x10e8, 0x1413, 0x22f2, 0xb462, 0x28e0,
-  0xc480, 0x20e0, 0x2024, 0xa870, 0x30e8, 0xe443, 0xfe21, 0xee2e,
-  0xec84, 0xfe21, 0xde0e, 0x3129, 0xa870, 0x2024, 0x20e0, 0xc480,
-  0x1060, 0x2003, 0xb00e, 0x3005, 0x20e6, 0xec63, 0xedc1, 0x4208,
-  0x41a6, 0xede2, 0xf68f, 0x2128, 0x3004, 0xb00e, 0x2003, 0x1060,
-  0x2003, 0xb00e, 0x4806, 0xb810, 0x30e8, 0xd403, 0xfe21, 0xee2e,
-  0xec84, 0xfe21, 0xd5ee, 0x3129, 0xb810, 0x4806, 0xb00e, 0x2803,
-  0xc010, 0x3026, 0xb80f, 0xa830, 0x1888, 0x3146, 0xd562, 0xee4e,
-  0xec84, 0xdd41, 0x3187, 0x1889, 0xa830, 0xb80f, 0x3026, 0xc010,
-  0x1023, 0x016e, 0x1066, 0x0970, 0x086f, 0x08c9, 0x2108, 0x2108,
-  0x20e8, 0x2107, 0x10a9, 0x086f, 0x0970, 0x1066, 0x016e, 0x1023,
-  0x0001, 0x0043, 0x016e, 0x0065, 0x01d2, 0x01b3, 0x082e, 0x082f,
-  0x0830, 0x082e, 0x01b3, 0x01d2, 0x0065, 0x016e, 0x0043, 0x0001,
-  0x080c, 0x0002, 0x0022, 0x088f, 0x01b3, 0x084e, 0x0025, 0x0191,
-  0x0191, 0x0025, 0x084e, 0x01b3, 0x088f, 0x0022, 0x0002, 0x080c,
-  0x0002, 0x080c, 0x0063, 0x03ba, 0x0890, 0x0003, 0x080c, 0x0022,
-  0x0022, 0x080c, 0x0003, 0x0890, 0x03ba, 0x0063, 0x080c, 0x0003,
-  0xff5f, 0xf41e, 0xd052, 0x0801, 0x1820, 0xd260, 0xfdc2, 0xe79d,
-  0xe79d, 0xfde2, 0xd260, 0x1820, 0x0801, 0xd052, 0xf41e, 0xffbf,
-  0xf3fd, 0xd0b3, 0x2003, 0x1820, 0xba20, 0xfd40, 0xdd62, 0x253d,
-  0x253d, 0xd562, 0xfd40, 0xba20, 0x1820, 0x2003, 0xd0f3, 0xfe9d,
-  0xd0b4, 0x2003, 0x1820, 0xc220, 0xfd60, 0xdd00, 0x2122, 0x041b,
-  0x041b, 0x2122, 0xdd00, 0xfd60, 0xc220, 0x1820, 0x2002, 0xd0f4,
-  0x141c, 0x08c4, 0xba20, 0xfd60, 0xdd21, 0x3166, 0x1907, 0x2149,
-  0x2168, 0x1907, 0x3166, 0xdd20, 0xfd60, 0xc220, 0x08c4, 0x141c,
-  0x04df, 0x24db, 0xeda4, 0xdd20, 0x3166, 0x2988, 0xddcf, 0xec84,
-  0xedc1, 0xde0f, 0x1908, 0x18c0, 0xdd00, 0xeda4, 0x24db, 0x04ff,
-  0x253d, 0xdf9f, 0xdf5a, 0x2104, 0x18e6, 0xdd82, 0xfeaf, 0xec84,
-  0xeda2, 0xd5ef, 0x2128, 0x1001, 0x2103, 0xdf5a, 0xdf9f, 0x2d3d,
-  0xede4, 0xdf39, 0x2714, 0x0292, 0x2127, 0xede2, 0xee6f, 0x41c7,
-  0x3186, 0x31a8, 0x20a8, 0xb051, 0x1292, 0x1f14, 0xdf39, 0xee05,
-  0xd4e0, 0x2123, 0x1292, 0x05f1, 0x21a7, 0xedc2, 0xfeaf, 0xec84,
-  0xedc2, 0xd5ee, 0x3168, 0x2129, 0x05f0, 0x1292, 0x2123, 0xd4e0,
-  0x1060, 0x2003, 0xb030, 0x20a3, 0x2126, 0xedc2, 0xfeaf, 0xec84,
-  0xeda2, 0xfeaf, 0xdc25, 0x1906, 0x20a3, 0xb030, 0x2003, 0x1060,
-  0x2003, 0xa80e, 0x4842, 0xa960, 0x3126, 0xede2, 0xee6f, 0x41c8,
-  0x41e7, 0xee4f, 0xec85, 0x3106, 0xa960, 0x4042, 0xb00e, 0x2803,
-  0xc00f, 0x4043, 0xb9a0, 0xc1a1, 0x3126, 0xd582, 0xfeaf, 0xe4c8,
-  0xedc2, 0xfeaf, 0xd425, 0x3106, 0xc1a1, 0xb9a0, 0x4043, 0xc00f,
-  0x2043, 0xa980, 0xc1c2, 0x7869, 0x1888, 0x3187, 0xddcf, 0xeca4,
-  0xedc2, 0xddee, 0x3168, 0x1888, 0x7889, 0xc1c2, 0xa980, 0x2043,
-  0x018f, 0x1084, 0x11cf, 0x09d3, 0x086f, 0x08ea, 0x2127, 0x20e8,
-  0x2107, 0x2127, 0x08ea, 0x086f, 0x09d3, 0x11cf, 0x1084, 0x018f,
-  0x0043, 0x016e, 0x0065, 0x01b1, 0x0235, 0x0399, 0x0043, 0x080d,
-  0x080d, 0x0043, 0x0399, 0x0235, 0x01b1, 0x0065, 0x016e, 0x0043,
-  0x0001, 0x0022, 0x080b, 0x0065, 0x01b1, 0x0890, 0x0002, 0x0001,
-  0x0001, 0x0002, 0x0890, 0x01b1, 0x0065, 0x080b, 0x0022, 0x0001,
-  0x080d, 0x0001, 0x0022, 0x018f, 0x0044, 0x080e, 0x080e, 0x0000,
-  0x0000, 0x080d, 0x080e, 0x0044, 0x018f, 0x0022, 0x0001, 0x080d,
-  0xe813, 0x7009, 0x2820, 0xcaa5, 0xff38, 0xd585, 0x14bb, 0x04df,
-  0x04df, 0x14bb, 0xd585, 0xff38, 0xd2c5, 0x2820, 0x7009, 0xe813,
-  0x7009, 0x3021, 0xba64, 0xfed6, 0xdd64, 0x2101, 0x0254, 0x14ff,
-  0x151f, 0x0254, 0x2101, 0xd544, 0xfed6, 0xba84, 0x3021, 0x7009,
-  0x1063, 0xba64, 0xfed6, 0xdd64, 0x20c0, 0x0001, 0x0a12, 0xc6bd,
-  0xc6bc, 0x1232, 0x0001, 0x20c0, 0xd564, 0xfef6, 0xba84, 0x1063,
-  0x2cfd, 0xef1b, 0xdd44, 0x20c0, 0x0001, 0x0886, 0x2128, 0x39a8,
-  0x39ca, 0x2128, 0x10a6, 0x0000, 0x20c0, 0xdd44, 0xef1b, 0x2d1d,
-  0xd79f, 0xd77c, 0x1944, 0x0000, 0x0886, 0x3168, 0xdc03, 0xedc2,
-  0xee4e, 0xdc25, 0x20e6, 0x1002, 0x0000, 0x1944, 0xd77c, 0xefbd,
-  0x14fb, 0x16f5, 0x1499, 0x1044, 0x2107, 0xddcf, 0xfcc4, 0xeda2,
-  0xee2e, 0xd405, 0x30e8, 0xb00f, 0x2845, 0x149a, 0x2713, 0xd5c3,
-  0x0063, 0x0a91, 0xd63d, 0xc153, 0x3129, 0xee4f, 0xec85, 0x41c6,
-  0x31a8, 0x3147, 0x10a7, 0x2024, 0xc952, 0xde3d, 0x12b1, 0x1081,
-  0x0000, 0x2824, 0xc932, 0x2590, 0x21c9, 0xee0f, 0xfce4, 0xedc2,
-  0xee4e, 0xdc25, 0x3146, 0x0927, 0x2590, 0xc932, 0x2824, 0x0000,
-  0x2803, 0xb00e, 0x2002, 0x1101, 0x2148, 0xee30, 0xfce4, 0xeda2,
-  0xee2e, 0xfcc4, 0xdd41, 0x2126, 0x1101, 0x2002, 0xb00e, 0x2803,
-  0xc010, 0x2003, 0x20e0, 0xbc20, 0x39a8, 0xee50, 0xec85, 0x41c6,
-  0x41c8, 0xec63, 0xedc0, 0x3986, 0xbc01, 0x20e0, 0x2003, 0xc010,
-  0x1001, 0x20e0, 0xcc21, 0x90e9, 0x2928, 0xd5cf, 0xfcc4, 0xedc2,
-  0xee2e, 0xfcc4, 0xd541, 0x2907, 0x90e9, 0xcc21, 0x20e0, 0x1001,
-  0x1060, 0xbc20, 0x910a, 0x980e, 0x1889, 0x3147, 0xd403, 0xedc2,
-  0xee4e, 0xdc25, 0x3146, 0x1888, 0x980e, 0x910a, 0xbc20, 0x1080,
-  0x0021, 0x1081, 0x0970, 0x1851, 0x100f, 0x10ea, 0x2108, 0x2148,
-  0x2149, 0x2108, 0x10ea, 0x100f, 0x1851, 0x0970, 0x1081, 0x0021,
-  0x018f, 0x0002, 0x0042, 0x0170, 0x08f3, 0x0379, 0x088f, 0x0191,
-  0x0191, 0x088f, 0x0379, 0x08f3, 0x0170, 0x0042, 0x0002, 0x018f,
-  0x0023, 0x080b, 0x0002, 0x00a5, 0x0377, 0x00a6, 0x0001, 0x0021,
-  0x0021, 0x0001, 0x00a6, 0x0377, 0x00a5, 0x0002, 0x080b, 0x0023,
-  0x0000, 0x0002, 0x082e, 0x0190, 0x0085, 0x080c, 0x0001, 0x0000,
-  0x0000, 0x0001, 0x080c, 0x0085, 0x0190, 0x082e, 0x0002, 0x0000,
-  0x2020, 0xca40, 0xfde5, 0xff98, 0xfd62, 0xba42, 0x0c7c, 0x1d3f,
-  0x1d3f, 0x0c7c, 0xba22, 0xfd62, 0xff98, 0xfde5, 0xca40, 0x2020,
-  0xca62, 0xf584, 0xff56, 0xfda4, 0xc220, 0x2061, 0x2254, 0xc71f,
-  0xc71f, 0x2274, 0x1861, 0xc220, 0xfda4, 0xff56, 0xf584, 0xca82,
-  0xff7d, 0xffbb, 0xfda4, 0xc220, 0x1820, 0x1001, 0xb072, 0x247c,
-  0x247d, 0xb092, 0x1001, 0x1020, 0xba20, 0xfda4, 0xffba, 0xff9d,
-  0xffff, 0xef3d, 0xba42, 0x1820, 0x0001, 0x1086, 0x3108, 0x216a,
-  0x2149, 0x3108, 0x10a6, 0x1002, 0x1820, 0xba42, 0xef3d, 0xffff,
-  0xd79f, 0x253c, 0x0883, 0x1001, 0x1086, 0x3166, 0xd582, 0xee4e,
-  0xec84, 0xd540, 0x3128, 0xb00f, 0x2002, 0x0883, 0x253c, 0xd79f,
-  0x14fb, 0x0694, 0x22b3, 0xb052, 0x30e8, 0xd403, 0xfe21, 0xee2e,
-  0xec84, 0xd521, 0x2106, 0x2003, 0xb051, 0x22b3, 0x0694, 0x14fc,
-  0x0063, 0x2293, 0xb65d, 0x2274, 0x2108, 0xec63, 0xedc1, 0x4208,
-  0x3147, 0x3186, 0x10a6, 0x0022, 0x2274, 0xb65d, 0x2293, 0x0063,
-  0x2803, 0xb031, 0x2274, 0x1492, 0x2168, 0xec43, 0xfe21, 0xee2e,
-  0xec84, 0xdd41, 0x3187, 0x1108, 0x1491, 0x2274, 0xb031, 0x2803,
-  0xc010, 0x2003, 0x2101, 0xac81, 0x3166, 0xe443, 0xfe21, 0xee2e,
-  0xec84, 0xfe21, 0xddef, 0x31a8, 0xac81, 0x2101, 0x2003, 0xc010,
-  0x1001, 0x20e0, 0xb420, 0x30c1, 0x20e6, 0xec63, 0xedc1, 0x4208,
-  0x41a6, 0xede2, 0xf68f, 0x2128, 0x30c1, 0xb420, 0x20e0, 0x1001,
-  0x20e0, 0xb420, 0x48e3, 0xb810, 0x30e8, 0xd403, 0xfe21, 0xee2e,
-  0xec84, 0xfe21, 0xd5ee, 0x3129, 0xb810, 0x48e3, 0xb420, 0x2900,
-  0xc480, 0x3102, 0xb810, 0xa830, 0x1888, 0x3146, 0xd562, 0xee4e,
-  0xec84, 0xdd41, 0x3187, 0x1889, 0xa830, 0xb810, 0x3103, 0xc480,
-  0x10a1, 0x016e, 0x1066, 0x0970, 0x086f, 0x08c9, 0x2108, 0x2108,
-  0x20e8, 0x2107, 0x10a9, 0x086f, 0x0970, 0x1066, 0x016e, 0x10a1,
-  0x0001, 0x0043, 0x016e, 0x0065, 0x01d2, 0x01b3, 0x082e, 0x082f,
-  0x0830, 0x082e, 0x01b3, 0x01d2, 0x0065, 0x016e, 0x0043, 0x0001,
-  0x080c, 0x0002, 0x0022, 0x088f, 0x01b3, 0x084e, 0x0025, 0x0191,
-  0x0191, 0x0025, 0x084e, 0x01b3, 0x088f, 0x0022, 0x0002, 0x080c,
-  0x0002, 0x080c, 0x0063, 0x03ba, 0x0890, 0x0003, 0x080c, 0x0022,
-  0x0022, 0x080c, 0x0003, 0x0890, 0x03ba, 0x0063, 0x080c, 0x0003,
-  0xfe45, 0xff78, 0xd522, 0x1060, 0x0000, 0x2003, 0xe894, 0xef1f,
-  0xef3f, 0xe8b4, 0x2803, 0x0000, 0x1060, 0xd522, 0xff78, 0xfe45,
-  0xff77, 0xdd64, 0x20e0, 0x0000, 0x2002, 0xd811, 0xd874, 0x24de,
-  0x24de, 0xd074, 0xd811, 0x2003, 0x0000, 0x20c0, 0xd544, 0xff77,
-  0xd564, 0x20e0, 0x0000, 0x2002, 0xd812, 0xd812, 0x2045, 0x041b,
-  0x043b, 0x2045, 0xd812, 0xd812, 0x2003, 0x0000, 0x20c0, 0xd564,
-  0x147a, 0x00a4, 0x2002, 0xd812, 0xd813, 0x3089, 0x1927, 0x2149,
-  0x2168, 0x1927, 0x30a9, 0xd812, 0xd812, 0x2002, 0x00a4, 0x147a,
-  0x04ff, 0x247c, 0xd8b4, 0xd812, 0x3089, 0x2987, 0xddcf, 0xec84,
-  0xe561, 0xde0f, 0x1927, 0x1803, 0xd811, 0xd8b4, 0x247c, 0x04ff,
-  0x2cbe, 0xd6ff, 0xd45b, 0x2065, 0x18e6, 0xcd22, 0xfeaf, 0xec84,
-  0xdd62, 0xd5ef, 0x2127, 0x1060, 0x2064, 0xd45b, 0xdeff, 0x2cde,
-  0xe8b6, 0xd43b, 0x1e94, 0x02b1, 0x2127, 0xdd82, 0xee6f, 0x41c7,
-  0x3166, 0x3188, 0x2127, 0xb462, 0x1331, 0x1e94, 0xcc3b, 0xe8b6,
-  0xd011, 0x2045, 0x1310, 0x05f0, 0x21a7, 0xdd62, 0xfeaf, 0xec84,
-  0xdd62, 0xd5ce, 0x3168, 0x2187, 0x0610, 0x1310, 0x2065, 0xd011,
-  0x1001, 0x20c0, 0xb441, 0x2103, 0x2106, 0xdd62, 0xfeaf, 0xe464,
-  0xdd62, 0xfeaf, 0xdc25, 0x18e6, 0x1903, 0xb441, 0x20e0, 0x1001,
-  0x20e0, 0xb420, 0x40e2, 0x900c, 0x3107, 0xdd82, 0xee6f, 0x41a7,
-  0x41e7, 0xee4f, 0xec85, 0x30e7, 0x900c, 0x40c2, 0xb420, 0x2900,
-  0xc480, 0x40e2, 0xa00d, 0xa80f, 0x2907, 0xc522, 0xfeaf, 0xec84,
-  0xdd62, 0xfeaf, 0xd425, 0x30e7, 0xa80e, 0xa00d, 0x40e2, 0xc480,
-  0x20a2, 0x900c, 0xa830, 0x782c, 0x1888, 0x2967, 0xddcf, 0xec84,
-  0xdd62, 0xddee, 0x3168, 0x1888, 0x702c, 0xa830, 0x900c, 0x20a2,
-  0x018f, 0x0865, 0x0990, 0x09d3, 0x086f, 0x10ea, 0x2127, 0x20e8,
-  0x2107, 0x2127, 0x08ea, 0x086f, 0x09d3, 0x0991, 0x0865, 0x018f,
-  0x0043, 0x016e, 0x0065, 0x01b1, 0x0235, 0x0399, 0x0043, 0x080d,
-  0x080d, 0x0043, 0x0399, 0x0235, 0x01b1, 0x0065, 0x016e, 0x0043,
-  0x0001, 0x0022, 0x080b, 0x0065, 0x01b1, 0x0890, 0x0002, 0x0001,
-  0x0001, 0x0002, 0x0890, 0x01b1, 0x0065, 0x080b, 0x0022, 0x0001,
-  0x080d, 0x0001, 0x0022, 0x018f, 0x0044, 0x080e, 0x080e, 0x0000,
-  0x0000, 0x080d, 0x080e, 0x0044, 0x018f, 0x0022, 0x0001, 0x080d,
-  0xfd40, 0xb9e0, 0x2001, 0x80ad, 0xeb5c, 0xd0b4, 0x143d, 0x04df,
-  0x04df, 0x143d, 0xd0b4, 0xeb5c, 0x88cd, 0x2001, 0xb9e0, 0xfd40,
-  0xb9e0, 0x3041, 0x78ac, 0xe33b, 0xd0b3, 0x2024, 0x0254, 0x151f,
-  0x151f, 0x0254, 0x2024, 0xd0b3, 0xe33b, 0x78ac, 0x3041, 0xb9e0,
-  0x1063, 0x78ac, 0xe33b, 0xd8b3, 0x2002, 0x0021, 0x0a12, 0xc6bd,
-  0xc6bc, 0x1232, 0x0021, 0x2002, 0xd8b3, 0xe33b, 0x78ac, 0x1063,
-  0x24bd, 0xdc1d, 0xd8d4, 0x2002, 0x0000, 0x0886, 0x2128, 0x39a8,
-  0x39ca, 0x2128, 0x10a6, 0x0000, 0x2002, 0xd8d4, 0xdc1d, 0x2cdd,
-  0xd79f, 0xd75e, 0x2254, 0x0001, 0x0886, 0x3168, 0xdc03, 0xdd62,
-  0xee2e, 0xdc25, 0x20e6, 0x1060, 0x0001, 0x2254, 0xd73e, 0xd79f,
-  0x14fb, 0x1715, 0x14db, 0x10c3, 0x2107, 0xddcf, 0xfcc4, 0xdd62,
-  0xee2e, 0xd405, 0x3146, 0xb420, 0x2922, 0x14bb, 0x1715, 0x14fb,
-  0x0063, 0x0a72, 0xd71a, 0xc564, 0x31a7, 0xee30, 0xec85, 0x41c6,
-  0x31a8, 0x3147, 0x10a7, 0x20e1, 0xcd63, 0xdf1a, 0x0a92, 0x0063,
-  0x0000, 0x28e1, 0xcd63, 0x268d, 0x21c9, 0xee0f, 0xfcc4, 0xdd62,
-  0xee2e, 0xdc25, 0x3126, 0x0927, 0x268d, 0xcd63, 0x28e1, 0x0000,
-  0x28e0, 0xb420, 0x20e0, 0x1083, 0x2128, 0xee30, 0xfcc4, 0xdd62,
-  0xe62e, 0xfcc4, 0xcce1, 0x2126, 0x1083, 0x20e0, 0xb420, 0x2900,
-  0xc480, 0x20e0, 0x2003, 0xb80f, 0x3929, 0xee4f, 0xec85, 0x41a6,
-  0x41c8, 0xec63, 0xdd60, 0x3107, 0xb810, 0x2003, 0x20e0, 0xc480,
-  0x1060, 0x2003, 0xc810, 0x900c, 0x2928, 0xd5cf, 0xfcc4, 0xdd62,
-  0xee2e, 0xfcc4, 0xcce1, 0x2907, 0x900c, 0xc810, 0x2003, 0x1060,
-  0x1001, 0xb80f, 0x902d, 0x980e, 0x18a8, 0x3147, 0xd403, 0xdd62,
-  0xee2e, 0xdc25, 0x3146, 0x1888, 0x980e, 0x902d, 0xb80f, 0x1001,
-  0x0021, 0x1022, 0x0970, 0x1851, 0x100f, 0x10ea, 0x2108, 0x2128,
-  0x2149, 0x2108, 0x10ea, 0x100f, 0x1851, 0x0970, 0x1023, 0x0021,
-  0x018f, 0x0022, 0x0042, 0x0170, 0x08f3, 0x0379, 0x088f, 0x0191,
-  0x0191, 0x088f, 0x0379, 0x08f3, 0x0170, 0x0042, 0x0022, 0x018f,
-  0x0023, 0x080b, 0x0002, 0x00a5, 0x0377, 0x00a6, 0x0001, 0x0021,
-  0x0021, 0x0001, 0x00a6, 0x0377, 0x00a5, 0x0002, 0x080b, 0x0023,
-  0x0000, 0x0002, 0x082e, 0x0190, 0x0085, 0x080c, 0x0001, 0x0000,
-  0x0000, 0x0001, 0x080c, 0x0085, 0x0190, 0x082e, 0x0002, 0x0000,
-  0xfb75, 0xeb33, 0x1041, 0x0000, 0x0000, 0x0882, 0xbe7c, 0xe73d,
-  0x39e7, 0xe73d, 0xbe7c, 0x0882, 0x0000, 0x1021, 0x1041, 0x1021,
-  0xfb96, 0xe313, 0x2083, 0x1021, 0x0000, 0x1082, 0xe71c, 0xffde,
-  0xef3a, 0xffde, 0xe73c, 0x1082, 0x0800, 0xb9d0, 0xe2f3, 0xc9f1,
-  0xfcf9, 0xe2b4, 0xe2f3, 0xb9d0, 0x0801, 0x0862, 0xadb8, 0xe651,
-  0xdda5, 0xe651, 0xadd9, 0x0882, 0x0821, 0xd2d2, 0xfb75, 0xfb76,
-  0xff3e, 0xf4b9, 0xfb96, 0xeb14, 0x20e8, 0x2128, 0x31ab, 0x31ca,
-  0x31a8, 0x31ca, 0x31aa, 0x10a6, 0x0000, 0x30c4, 0xeb54, 0xfcd9,
-  0xfcf9, 0xe2b4, 0xe2f3, 0xb9d0, 0x314a, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef7e, 0xdedc, 0x2128, 0x1021, 0xd2d2, 0xfb75, 0xfb76,
-  0xfb96, 0xeb14, 0x2083, 0x0821, 0x2128, 0xef5d, 0xffff, 0xef5d,
-  0xef5d, 0xef5d, 0xdedc, 0x2128, 0x0801, 0xb9d0, 0xe2f3, 0xc9f1,
-  0xeb34, 0xd2f2, 0x0821, 0x0000, 0x2128, 0xef5d, 0xef7e, 0x420c,
-  0x298a, 0x31cb, 0x2129, 0x10a7, 0x0000, 0x0821, 0x1041, 0x1021,
-  0x1041, 0x1041, 0x0000, 0x0821, 0x2148, 0xef7d, 0xf77f, 0xac1c,
-  0xac1c, 0xce3b, 0x31aa, 0x10a6, 0x1060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xa9aa, 0x3169, 0xce7b, 0xac5b, 0xa3bb,
-  0xa3db, 0xbcbd, 0xce3b, 0x31a8, 0xc4c0, 0x28e0, 0x1060, 0x1060,
-  0x0000, 0x1021, 0x2882, 0xd28c, 0x2908, 0x296a, 0x294b, 0x292a,
-  0x316c, 0xabdc, 0xac1c, 0x3188, 0xe5a1, 0xeca3, 0xed80, 0xec82,
-  0x1041, 0xd2ac, 0xeaed, 0xca6b, 0x2929, 0x937a, 0xa3db, 0xa3db,
-  0xa3db, 0xb41d, 0x937a, 0x296a, 0xe670, 0xfecf, 0xfe41, 0xeda0,
-  0x1041, 0xd2ac, 0xfb4d, 0xd4a3, 0x2948, 0x937a, 0xa3dc, 0xa3dc,
-  0xabdc, 0x9b9a, 0x212a, 0x3189, 0xef1b, 0xff32, 0xedc1, 0x3980,
-  0x0000, 0x2062, 0xd24c, 0xeb2c, 0x3928, 0x2929, 0x3129, 0x18e8,
-  0x18e8, 0x18e8, 0x20e6, 0xdc44, 0xfed0, 0xfecf, 0xfe41, 0xeda0,
-  0x0000, 0x1021, 0xe2cd, 0xfb2e, 0xdacd, 0xeaed, 0xd2ac, 0x1041,
-  0x0000, 0x0000, 0x1080, 0xedc0, 0xfe41, 0xec83, 0xe560, 0xec82,
-  0x0000, 0x0820, 0xb9ea, 0xd28c, 0x30a3, 0xd28c, 0xc20b, 0x1020,
-  0x0000, 0x0000, 0x1060, 0xd540, 0xd540, 0x20c0, 0x1060, 0x1040,
-  0x0000, 0x0000, 0x1021, 0x1021, 0x0000, 0x1021, 0x1021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x1041, 0x1021, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021, 0x1041, 0x0000,
-  0xe313, 0xb9d0, 0x1021, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xdedb,
-  0x2124, 0x10a2, 0x1082, 0x0000, 0x0821, 0xb9d0, 0xd2d2, 0x2083,
-  0xfb76, 0xe2f3, 0x1021, 0x0000, 0x0000, 0x1082, 0xd6bb, 0xe73d,
-  0xadd9, 0xce7a, 0x9557, 0x0862, 0x0821, 0xe2f3, 0xfb75, 0xeb54,
-  0xfb75, 0xd232, 0x2062, 0x0000, 0x10a6, 0x2149, 0x31cb, 0x31cb,
-  0x31cb, 0x39eb, 0x31cb, 0x10a6, 0x2063, 0xd211, 0xfbb6, 0xfd3a,
-  0xf498, 0xfb76, 0xdaf2, 0x1042, 0x1928, 0xdedb, 0xef5d, 0xef5d,
-  0xef5d, 0xef5d, 0xd6db, 0x316a, 0xd2f2, 0xfb75, 0xfcd9, 0xff5e,
-  0xda53, 0xeb14, 0xd2f2, 0x1022, 0x1928, 0xef5d, 0xffff, 0xef5d,
-  0xe75d, 0xef5d, 0xd6db, 0x316a, 0xd2f2, 0xeb13, 0xe294, 0xfcf9,
-  0xe2f3, 0x2883, 0x1041, 0x0000, 0x2128, 0xef5d, 0xef3e, 0x420c,
-  0x31cb, 0x31cb, 0x2129, 0x10a7, 0x1041, 0x2063, 0xe2f3, 0xfb96,
-  0xb9af, 0x1021, 0x0000, 0x0000, 0x2128, 0xe6dd, 0xbcbe, 0xac1c,
-  0xe6dd, 0xdedb, 0x31aa, 0x08a6, 0x0000, 0x0800, 0xb9d0, 0xe313,
-  0x0801, 0x0000, 0x0000, 0x1041, 0x18e8, 0x9bb9, 0xa3bb, 0xa3bb,
-  0xb45c, 0xf77f, 0xd69c, 0x2128, 0x1040, 0x0000, 0x0821, 0x1041,
-  0x0820, 0x1041, 0x2062, 0xc26b, 0x28e8, 0x212a, 0x294b, 0x292a,
-  0x316c, 0xac3c, 0xac3c, 0x3169, 0xc3a2, 0x1040, 0x0000, 0x0000,
-  0xd22c, 0xe2cd, 0xd24c, 0xe30c, 0x3129, 0x939a, 0xa3db, 0xa3db,
-  0xa3db, 0xb41d, 0x937a, 0x3148, 0xd500, 0x2900, 0x1060, 0x0000,
-  0xe2cd, 0xfb2e, 0xfb8c, 0xdd03, 0x2968, 0x937a, 0xa3dc, 0xa3dc,
-  0xabdc, 0x939a, 0x210a, 0x3189, 0xe4a4, 0xedc0, 0xd540, 0x1080,
-  0x38a3, 0xe30c, 0xf564, 0xe62c, 0x3168, 0x3109, 0x3129, 0x18e8,
-  0x18e8, 0x2928, 0x31aa, 0xdeba, 0xfed0, 0xfe21, 0xd540, 0x1080,
-  0xe2cd, 0xfb2e, 0xfb8c, 0xed24, 0xd28b, 0xd28c, 0xa9ca, 0x0801,
-  0x0840, 0xd423, 0xee4e, 0xff11, 0xfecf, 0xeca3, 0x20c0, 0x0000,
-  0xca2b, 0xdaac, 0xd22c, 0xfb4d, 0xeaed, 0x2882, 0x1021, 0x0000,
-  0x1060, 0xed80, 0xfe41, 0xe5c1, 0xfe41, 0xe580, 0x1060, 0x0000,
-  0x1021, 0x1041, 0x2062, 0xeaed, 0xeaed, 0x1021, 0x0000, 0x0000,
-  0x1040, 0xec62, 0xeda0, 0x3960, 0xeda0, 0xec82, 0x1040, 0x0000,
-  0x1020, 0xb9ea, 0xe2cd, 0xb9ea, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1060, 0xd540, 0xd540, 0x1060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0x1041, 0x1021, 0x0000, 0x1082, 0x10a2, 0x1082,
-  0x0000, 0x0000, 0x1080, 0x1080, 0x0000, 0x1041, 0x1041, 0x0000,
-  0x1041, 0x0821, 0x0000, 0x0000, 0x0862, 0x9537, 0xce9a, 0x9537,
-  0x0862, 0x0000, 0x0000, 0x0000, 0x0821, 0xd2f2, 0xdaf2, 0x2063,
-  0xe313, 0xc1d0, 0x1021, 0x1082, 0x10c7, 0x31cb, 0x39eb, 0x31cb,
-  0x2149, 0x2149, 0x2128, 0x10a6, 0x2083, 0xeb13, 0xfb75, 0xd1f1,
-  0xfb75, 0xd2b1, 0x20e4, 0xc618, 0x39eb, 0xd69b, 0xef5d, 0xef5d,
-  0xef7d, 0xef7e, 0xdedc, 0x316a, 0xd2d2, 0xe2b4, 0xfcd9, 0xfbb6,
-  0xeb34, 0x30a4, 0x10a2, 0xc618, 0x39eb, 0xef5d, 0xffff, 0xef5d,
-  0xe75d, 0xef5d, 0xd6db, 0x316a, 0xeb34, 0xfcb9, 0xfefd, 0xfd3a,
-  0xfb75, 0xd2d2, 0x1041, 0x1082, 0x2148, 0xe71d, 0xef3e, 0x426c,
-  0x31cb, 0x31cb, 0x2129, 0x20e8, 0xd2d2, 0xe2b4, 0xfcd9, 0xfbb6,
-  0xe313, 0xb9d0, 0x1021, 0x0000, 0x18e8, 0xac1c, 0xbcbe, 0xdedd,
-  0xef5d, 0xdedb, 0x296a, 0x0886, 0x2083, 0xeb13, 0xfb75, 0xc9f1,
-  0x1021, 0x0801, 0x0000, 0x0000, 0x18e8, 0x9379, 0xa3bb, 0xac5b,
-  0xe71d, 0xf77f, 0xa3fa, 0x18c8, 0x0821, 0xd2f2, 0xd2f2, 0x2063,
-  0x0820, 0x1020, 0x0000, 0x1041, 0x10a7, 0x292a, 0x294b, 0x292a,
-  0x39ac, 0xac3c, 0xabfc, 0x18e8, 0x0000, 0x1041, 0x1041, 0x0000,
-  0xd22c, 0xd28c, 0x38a3, 0xc26b, 0x3129, 0x939a, 0xa3db, 0xa3db,
-  0xa3db, 0xb41d, 0x9b9a, 0x18e8, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xfb0e, 0xfb2e, 0xeb2c, 0xeaed, 0x2929, 0x937a, 0xabdc, 0xa3dc,
-  0xa3dc, 0x937a, 0x212a, 0x20e6, 0x1080, 0x1040, 0x0000, 0x0000,
-  0xe26d, 0xf38c, 0xf564, 0xeb6b, 0x3908, 0x2909, 0x18e8, 0x18e8,
-  0x3168, 0x2969, 0x3189, 0xdc45, 0xeda0, 0xd402, 0x1040, 0x1021,
-  0xfb4d, 0xed24, 0xf68c, 0xed24, 0xeb2d, 0xdaad, 0x1041, 0x18e0,
-  0xd561, 0xee90, 0xef1b, 0xfe8f, 0xfe61, 0xed80, 0x28c1, 0xd2ac,
-  0xe2cd, 0xe2eb, 0xed24, 0xe2ea, 0xeacd, 0xd28c, 0x20a1, 0xd520,
-  0xfe41, 0xfecf, 0xfed0, 0xfd25, 0xe580, 0xcc02, 0x2081, 0xd28c,
-  0x2882, 0xe2cd, 0xfb6d, 0xe2cd, 0x2862, 0x1041, 0x1040, 0xec62,
-  0xfe00, 0xfce4, 0xfe21, 0xeda0, 0x28e0, 0x1040, 0x0000, 0x1041,
-  0xfb2e, 0xfb0e, 0xd22b, 0xe2cd, 0xb9ea, 0x1020, 0x0000, 0x1080,
-  0xeda0, 0xfe60, 0xeda0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xeaed, 0xd2ac, 0x2062, 0x1041, 0x1021, 0x0000, 0x0000, 0x1040,
-  0xd402, 0xed80, 0xd402, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1041, 0x1021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1040, 0x1060, 0x1040, 0x0000, 0x1021, 0x1041, 0x1021, 0x0000,
-  0x0000, 0x0000, 0x0882, 0x10a2, 0x10a6, 0x2128, 0x2149, 0x2148,
-  0x2128, 0x2129, 0x1928, 0x20c7, 0xb9d0, 0xeaf3, 0xb9d0, 0x0821,
-  0x1041, 0x0882, 0xadfa, 0xd6bb, 0x31cb, 0xd6bb, 0xef7d, 0xef7d,
-  0xef7d, 0xef7e, 0xdedc, 0x316a, 0xe2f3, 0xfb96, 0xe2f3, 0x2883,
-  0xd2d2, 0x20c4, 0xd6ba, 0xef5d, 0x39eb, 0xef5d, 0xffff, 0xef5d,
-  0xe75d, 0xef5d, 0xd6db, 0x314a, 0xca52, 0xfcd9, 0xe2b4, 0xe313,
-  0xd2f2, 0x1041, 0x31a6, 0xd6bb, 0x39eb, 0xe6fd, 0xef7e, 0x424c,
-  0x31cb, 0x31cb, 0x2129, 0x2109, 0xe498, 0xff1e, 0xfcd9, 0xfb75,
-  0x1041, 0x1082, 0xd6ba, 0xef7d, 0x318b, 0xac3b, 0xf75f, 0xef5d,
-  0xef5d, 0xd67b, 0x294a, 0x20c8, 0xeb75, 0xfd1a, 0xfb96, 0xe233,
-  0x0000, 0x0862, 0xadf9, 0xd6bb, 0x298a, 0x9359, 0xac5b, 0xe71d,
-  0xe73d, 0xbcbd, 0x939a, 0x312a, 0xe334, 0xeb54, 0xfb75, 0xfb35,
-  0x0000, 0x0000, 0x0862, 0x10a2, 0x10c7, 0x292a, 0x292b, 0x298a,
-  0x39ac, 0xabdc, 0xa3dc, 0x312a, 0xc2b0, 0x38c4, 0xd2d1, 0xd211,
-  0x1041, 0x1021, 0x0000, 0x0000, 0x18e8, 0x9b9a, 0xa3db, 0xa3bb,
-  0xa3db, 0xb41d, 0x9b9a, 0x18e8, 0x1021, 0x0000, 0x1021, 0x1021,
-  0xeaed, 0xdaac, 0x2062, 0x1021, 0x18e8, 0x9b9a, 0xabdc, 0xa3db,
-  0xa3db, 0x937a, 0x212a, 0x1906, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xfb0e, 0xfb2d, 0xd24c, 0xd2ac, 0x3928, 0x18e8, 0x18e8, 0x2949,
-  0x316a, 0x2969, 0x31a7, 0xc4c1, 0x1060, 0x0000, 0x1021, 0x1041,
-  0xe2ea, 0xed24, 0xfb8c, 0xfb2e, 0xc26b, 0x0821, 0x20a0, 0xd424,
-  0xee50, 0xe692, 0xee70, 0xeca3, 0x20c0, 0x0820, 0xc20a, 0xeaed,
-  0xe543, 0xf68c, 0xf544, 0xeb2c, 0x38a3, 0x1060, 0xd540, 0xfe21,
-  0xfed0, 0xff9b, 0xfed0, 0xfe21, 0xd540, 0x20a1, 0xe2ad, 0xfb2e,
-  0xdaca, 0xed63, 0xf3ac, 0xfb2e, 0xca8c, 0x20a1, 0xe5c0, 0xfe20,
-  0xfd05, 0xfe90, 0xfd05, 0xfe20, 0xe5c0, 0x20a1, 0xca0b, 0xfb0e,
-  0xed62, 0xfb4d, 0xd22c, 0x1021, 0x0840, 0xd3e2, 0xed80, 0xfce4,
-  0xfeaf, 0xfecf, 0xfe61, 0xeda0, 0x1080, 0x0801, 0xd22b, 0xfb2e,
-  0xe32c, 0xfb2e, 0xe2cd, 0x1021, 0x0000, 0x1060, 0x28e0, 0xeda0,
-  0xfe41, 0xec83, 0xed80, 0xd402, 0x1040, 0x1021, 0xe2cd, 0xfb2e,
-  0x2062, 0xd28c, 0xc1ea, 0x0800, 0x0000, 0x0000, 0x0840, 0xd540,
-  0xd540, 0x20a0, 0x1060, 0x1040, 0x0000, 0x0800, 0xb9ea, 0xe2cd,
-  0x0000, 0x1041, 0x18a3, 0x10a3, 0x10a6, 0x2128, 0x2149, 0x31a9,
-  0x31a9, 0x2148, 0x1928, 0x10a6, 0x1042, 0x1041, 0x1021, 0x1041,
-  0x0000, 0x0861, 0xadf9, 0xd6bb, 0x31cb, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef7e, 0xdedc, 0x316a, 0xd2d2, 0xdaf2, 0x0821, 0x0000,
-  0x0000, 0x0882, 0xe73d, 0xef5d, 0x31eb, 0xe75d, 0xffff, 0xef5d,
-  0xe75d, 0xef5d, 0xd6db, 0x318a, 0xeb34, 0xeb14, 0x2083, 0x1021,
-  0x0000, 0x2104, 0xc67a, 0xe671, 0x39ca, 0xe75d, 0xef7e, 0x424c,
-  0x31cb, 0x318b, 0x1928, 0x2129, 0xe498, 0xe2b4, 0xe2f3, 0xca11,
-  0x10a2, 0xd6bb, 0xffdd, 0xd586, 0x31a8, 0xe6fd, 0xffff, 0xef5d,
-  0xdedd, 0x9bda, 0x20ea, 0x2149, 0xe6bc, 0xfcd9, 0xfb76, 0xfb35,
-  0x1082, 0xd6ba, 0xef5d, 0xbe39, 0x296a, 0x9bf9, 0xe71d, 0xe71d,
-  0xb45c, 0xb41d, 0x9b9a, 0x314a, 0xe497, 0xe2b4, 0xe2f3, 0xc9f1,
-  0x0000, 0x1082, 0x2145, 0xce9b, 0x296a, 0x210a, 0x318b, 0x298a,
-  0x316c, 0xabdc, 0xa3dc, 0x312a, 0xeb54, 0xeb14, 0x2083, 0x1021,
-  0x0000, 0x0000, 0x0862, 0x9557, 0x298b, 0x9379, 0xa3db, 0xa3bb,
-  0xa3db, 0xb41d, 0x939a, 0x292a, 0xd2f2, 0xd2f2, 0x0821, 0x0000,
-  0x1041, 0x1021, 0x0000, 0x0862, 0x18e8, 0x9b9a, 0xabdc, 0xa3bc,
-  0xa3dc, 0x939a, 0x212a, 0x0886, 0x1042, 0x1041, 0x0000, 0x1020,
-  0xeacd, 0xc20b, 0x0800, 0x0000, 0x1086, 0x18c8, 0x18e8, 0x2968,
-  0x3168, 0x3148, 0x2106, 0x1061, 0x0000, 0x0000, 0x0820, 0xb9ea,
-  0xfb6d, 0xeacd, 0x2862, 0x1041, 0x0000, 0x1040, 0x20e0, 0xd520,
-  0xeda1, 0xe484, 0xed81, 0xdc22, 0x1040, 0x1021, 0x2882, 0xe2cd,
-  0xed63, 0xe2ea, 0xeaed, 0xd2ac, 0x2081, 0xd402, 0xed80, 0xfd25,
-  0xfed0, 0xfecf, 0xfe41, 0xd520, 0x20a1, 0xd28c, 0xeaed, 0xe2ab,
-  0xf6ae, 0xed63, 0xfb6d, 0xe2cd, 0x28c1, 0xe580, 0xfe61, 0xfeb0,
-  0xff9c, 0xff11, 0xedc1, 0x20e0, 0x1021, 0xeaed, 0xfb6d, 0xed42,
-  0xed42, 0xfb6d, 0xe2cd, 0x20a1, 0xd520, 0xfe21, 0xfef1, 0xffbd,
-  0xfef2, 0xfe21, 0xd540, 0x1060, 0x2062, 0xe30c, 0xf583, 0xfece,
-  0xe28b, 0xe2cd, 0xb9eb, 0x1020, 0x20c0, 0xeca3, 0xfecf, 0xff11,
-  0xfecf, 0xeca3, 0x20c0, 0x1020, 0xd28c, 0xfb2e, 0xfb8c, 0xed63,
-  0xe2cd, 0x2882, 0x1020, 0x0000, 0x1060, 0xd500, 0xe5c1, 0xe5a1,
-  0xe5c1, 0xd520, 0x0840, 0x0801, 0xc20b, 0xe2cd, 0xd22c, 0xfb4d,
-  0xd2ac, 0x1021, 0x0000, 0x0000, 0x10a6, 0x31a8, 0x31a8, 0x31a8,
-  0x31a8, 0x31a8, 0x2148, 0x10a6, 0x0821, 0x1020, 0x2062, 0xd2ac,
-  0x1021, 0x0000, 0x1082, 0x1082, 0x2128, 0xd6bb, 0xef5d, 0xef5d,
-  0xef5d, 0xef7e, 0xdefc, 0x2149, 0x1021, 0x0801, 0x0000, 0x1021,
-  0x0000, 0x0861, 0xd6ba, 0xd6db, 0x31cb, 0xe75d, 0xffff, 0xef5d,
-  0xef5d, 0xef7d, 0xd6db, 0x316a, 0xd2d2, 0xc1d0, 0x1021, 0x0000,
-  0x0882, 0x2124, 0xef5d, 0xef3b, 0x31cb, 0xe73d, 0xef7e, 0x426c,
-  0x298a, 0x318b, 0x1928, 0x20e8, 0xeb34, 0xe2f3, 0x1021, 0x0000,
-  0xbe5b, 0xe71d, 0xced9, 0xd586, 0x31a8, 0xef5d, 0xffff, 0xdedd,
-  0xac1c, 0x937a, 0x210a, 0x20e8, 0xeb54, 0xd232, 0x2063, 0x0000,
-  0xf7df, 0xffdd, 0xe627, 0xe60c, 0x31a9, 0xd6bb, 0xe71d, 0xac5b,
-  0xa3db, 0xb41d, 0x9b9a, 0x294a, 0xe437, 0xfb96, 0xd2f2, 0x1041,
-  0xbe5b, 0xdf1c, 0xced9, 0xd5a6, 0x2127, 0x296a, 0x318b, 0x292a,
-  0x316c, 0xabfc, 0xabfc, 0x290a, 0xca32, 0xeb34, 0xd2f2, 0x1041,
-  0x0882, 0x2124, 0xef5d, 0xef5b, 0x318a, 0x9379, 0xa3db, 0xa3db,
-  0xa3db, 0xb41d, 0x939a, 0x312a, 0xd2b2, 0x2883, 0x1041, 0x0000,
-  0x0000, 0x0861, 0xd6ba, 0xd6db, 0x298b, 0x937a, 0xa3dc, 0xa3bc,
-  0xa3dc, 0x9b9a, 0x212a, 0x20c7, 0xa98f, 0x1021, 0x0000, 0x0000,
-  0x1041, 0x0000, 0x1082, 0x10a2, 0x10a6, 0x18e8, 0x3148, 0x3168,
-  0x3149, 0x18e8, 0x0886, 0x0001, 0x0801, 0x0000, 0x0000, 0x1021,
-  0xd2ac, 0x1021, 0x0000, 0x0000, 0x0000, 0x0840, 0xd402, 0xeda0,
-  0xd422, 0x1040, 0x0000, 0x0000, 0x0820, 0x1041, 0x2062, 0xd2ac,
-  0xe2ed, 0x2882, 0x1021, 0x0000, 0x1080, 0x2900, 0xed80, 0xfe61,
-  0xeda0, 0x2900, 0x1080, 0x1020, 0xc20a, 0xe2cd, 0xd24c, 0xfb4d,
-  0xda4c, 0xe2cd, 0xb9ca, 0x2080, 0xd540, 0xeda0, 0xfce4, 0xfe6e,
-  0xfce4, 0xeda0, 0xd540, 0x20a1, 0xe2cd, 0xfb2e, 0xfb4d, 0xed42,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0820, 0x71c5, 0x5965,
-  0x5965, 0x79e6, 0x39a6, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x1041, 0x71e6,
-  0x71c5, 0x1061, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0820, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x3903,
-  0x51a6, 0x51a6, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3903, 0x6228,
-  0xe6fb, 0xe6fb, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3903, 0x6228, 0xe71c,
-  0xffff, 0xef7d, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4103, 0x6248, 0xe6fb, 0xef7d,
-  0xffff, 0xef5d, 0x59e7, 0x528a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x51a6, 0xe6d9, 0xef5b, 0x7b0a,
-  0xef3b, 0xf73b, 0x6206, 0x4965, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xe508, 0xf548, 0xe4c6,
-  0xed48, 0xf548, 0xdc86, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdc06,
-  0xe426, 0xe426, 0xd3c6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5144, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5164,
-  0xd3a6, 0xd3a6, 0x5185, 0x5a8a, 0x5acb, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3903,
-  0x4944, 0x4944, 0x4965, 0x5acb, 0x5acb, 0x3186, 0x0000, 0x0000,
-  0x0820, 0x0820, 0x0820, 0x0820, 0x1040, 0x1060, 0x1060, 0x1880,
-  0x1880, 0x1881, 0x41c6, 0x630b, 0x62eb, 0x39a6, 0x1041, 0x0820,
-  0x81e6, 0x8206, 0x79e6, 0x8206, 0xc366, 0xcba6, 0xd465, 0xd485,
-  0xd485, 0xd466, 0xd48b, 0xdcef, 0xac2f, 0x9b2b, 0x8206, 0x81e6,
-  0x5165, 0x5165, 0x5165, 0x5965, 0x9267, 0x9a67, 0x9a87, 0x9a87,
-  0x9a87, 0x9aa7, 0xab8c, 0xbc4f, 0x93ae, 0x72aa, 0x5165, 0x5164,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x4103,
-  0x51a6, 0x51a6, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3903, 0x6228,
-  0xe6fb, 0xe6fb, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3904, 0x6248, 0xe71c,
-  0xffff, 0xef7d, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4103, 0x6206, 0xe6b9, 0xef7d,
-  0xffbd, 0xef3b, 0x59e7, 0x528a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x5164, 0xdc86, 0xe508, 0x7a87,
-  0xe508, 0xe508, 0x61c5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xdc06, 0xec26, 0xdbe6,
-  0xe426, 0xe426, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5164, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5164,
-  0xd3a6, 0xd3a6, 0x5185, 0x5a8a, 0x5acb, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3903,
-  0x4944, 0x4944, 0x4965, 0x5acb, 0x5acb, 0x3186, 0x0000, 0x0000,
-  0x0820, 0x1040, 0x0820, 0x0820, 0x0820, 0x1040, 0x1060, 0x1880,
-  0x1880, 0x1881, 0x41c6, 0x62eb, 0x62eb, 0x39a6, 0x1061, 0x0820,
-  0x8226, 0xbb46, 0x8226, 0x79e6, 0x8206, 0xc366, 0xcba6, 0xd465,
-  0xd465, 0xcba6, 0xcc4b, 0xac2f, 0xac0f, 0x9b4b, 0xbb46, 0x8226,
-  0x5165, 0x5985, 0x5165, 0x5165, 0x5165, 0x6185, 0x9267, 0x9a87,
-  0x9a87, 0x9a87, 0x82ca, 0x8bae, 0x8bae, 0x72aa, 0x59a5, 0x5164,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x4103,
-  0x51a6, 0x51a6, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3904, 0x6248,
-  0xe71c, 0xe6fb, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3903, 0x6206, 0xe6d9,
-  0xffbd, 0xef3b, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4104, 0x61c5, 0xd486, 0xe528,
-  0xf548, 0xe4e7, 0x59a5, 0x528a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x5164, 0xd3a6, 0xdc06, 0x7a25,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xdbe6, 0xec26, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5164, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x0820, 0x0000, 0x0820, 0x5164,
-  0xd3a6, 0xd3a6, 0x5185, 0x5aaa, 0x62eb, 0x31a6, 0x0020, 0x0000,
-  0x0000, 0x0820, 0x4944, 0x8226, 0x4924, 0x0020, 0x0000, 0x4104,
-  0x5144, 0x4944, 0x5185, 0x8b8d, 0xac2f, 0x6a89, 0x0841, 0x0000,
-  0x1040, 0x4924, 0x9246, 0xd3a7, 0x9a66, 0x4924, 0x0840, 0x0820,
-  0x0820, 0x1061, 0x6a69, 0xbc4f, 0xdd0f, 0xa36b, 0x4944, 0x1040,
-  0x81e6, 0x8206, 0x8a27, 0x9266, 0xc386, 0x9267, 0x8a26, 0x5164,
-  0x5164, 0x8a26, 0xa36b, 0xd4ef, 0xbc4f, 0xa34b, 0x8a27, 0x81e6,
-  0x5165, 0x5165, 0x5145, 0x5144, 0x5985, 0x9247, 0xdbc7, 0xdbe6,
-  0xdbe6, 0xdbe7, 0xab6b, 0x93ce, 0x8bae, 0x72aa, 0x5165, 0x5144,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x4104,
-  0x51a6, 0x51a6, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3903, 0x6206,
-  0xe6d9, 0xe6d9, 0x59e7, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3904, 0x61c5, 0xdc86,
-  0xf568, 0xe508, 0x59a5, 0x5aab, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4104, 0x61a5, 0xcba6, 0xdc06,
-  0xe426, 0xdbe6, 0x5985, 0x5a8a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x5164, 0xd3a6, 0xdbe6, 0x7a05,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xdbe6, 0xec26, 0xdbe6,
-  0xe406, 0xe426, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5164, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x4124, 0x5164,
-  0xcba6, 0xd3a6, 0x5185, 0x5a8a, 0x5acb, 0x3186, 0x0000, 0x0000,
-  0x4944, 0x1041, 0x0000, 0x0000, 0x0000, 0x0000, 0x3904, 0x5144,
-  0x61a5, 0x4944, 0x4965, 0x5acb, 0x5acb, 0x3186, 0x1061, 0x4944,
-  0xd3a6, 0x8a46, 0x1041, 0x0820, 0x1040, 0x1060, 0x20a1, 0x9266,
-  0xc366, 0x28e1, 0x41c6, 0x630b, 0x62eb, 0x41c7, 0x8a46, 0xd3a6,
-  0x9a66, 0xc366, 0x8226, 0x8a26, 0xc386, 0xd465, 0xd465, 0xdbc6,
-  0xdbe6, 0xd486, 0xdd2b, 0xdd0f, 0xb42f, 0x9b4b, 0xc387, 0x9a66,
-  0x5144, 0x5964, 0x5965, 0x8a27, 0x9a67, 0x9a87, 0x9a87, 0x9a67,
-  0x9a67, 0x9aa7, 0xab8b, 0xbc6f, 0xb42f, 0x7aca, 0x5985, 0x5144,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x4104,
-  0x5164, 0x5164, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3904, 0x61c5,
-  0xdc86, 0xdc86, 0x59a5, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3904, 0x61a5, 0xd3a6,
-  0xec46, 0xdbe6, 0x59a5, 0x5aab, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4104, 0x61a5, 0xcba6, 0xdbe6,
-  0xe406, 0xdbc6, 0x5985, 0x5a8a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x5164, 0xd3a6, 0xdbe6, 0x7a05,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xdbe6, 0xec26, 0xdbe6,
-  0xe406, 0xe426, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5164, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x5164,
-  0xd3a6, 0xd3a6, 0x5185, 0x5a8a, 0x5acb, 0x3186, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x3903,
-  0x4944, 0x4944, 0x4965, 0x5acb, 0x5acb, 0x39a6, 0x0820, 0x0000,
-  0x1040, 0x4944, 0x8206, 0x5164, 0x1860, 0x1060, 0x1060, 0x1860,
-  0x1860, 0x1881, 0x41e6, 0x6b0b, 0x93ae, 0x9b2b, 0x4944, 0x1040,
-  0x81e6, 0x8206, 0x9247, 0xc386, 0xcba6, 0xd445, 0xcba6, 0xcb86,
-  0xcb86, 0xcba6, 0xdd0b, 0xdd2f, 0xdd0f, 0xa36b, 0x8a27, 0x81e6,
-  0x5165, 0x5165, 0x5164, 0x5985, 0x61a5, 0x9267, 0x9a67, 0x9a67,
-  0x9a67, 0x9a87, 0xab8b, 0x9bce, 0x93ae, 0x72aa, 0x5165, 0x5144,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x39e7, 0x3186, 0x2104, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3186, 0x5acb, 0x632c, 0x4a69, 0x31a6, 0x39e7,
-  0x3186, 0x2104, 0x18e3, 0x1082, 0x0000, 0x0000, 0x0820, 0x4104,
-  0x5164, 0x5164, 0x4965, 0x5acb, 0x632c, 0x4a49, 0x2124, 0x3186,
-  0x2965, 0x2104, 0x1082, 0x0000, 0x0000, 0x0820, 0x3904, 0x61a5,
-  0xd3c6, 0xd3a6, 0x5985, 0x5aaa, 0x5acb, 0x4208, 0x2124, 0x2965,
-  0x2104, 0x18e3, 0x1082, 0x0000, 0x0820, 0x3904, 0x61a5, 0xd3a6,
-  0xec26, 0xdbe6, 0x59a5, 0x5aab, 0x5acb, 0x4208, 0x2104, 0x2104,
-  0x18e3, 0x1082, 0x0000, 0x0000, 0x4104, 0x61a5, 0xcba6, 0xdbe6,
-  0xe406, 0xdbc6, 0x5985, 0x5a8a, 0x5acb, 0x31a6, 0x10a2, 0x18e3,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x5164, 0xd3a6, 0xdbe6, 0x7a05,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xdbe6, 0xec26, 0xdbe6,
-  0xe406, 0xe426, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x5164, 0xcba6, 0xdbe6, 0xdbe6,
-  0xe406, 0xe406, 0xd3a6, 0x59a5, 0x52aa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4104, 0x5164, 0x5164, 0x61a5,
-  0xdbe6, 0xdbe6, 0x61a5, 0x4985, 0x5aaa, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x4104, 0x5164,
-  0xcba6, 0xcba6, 0x5185, 0x5a8a, 0x5acb, 0x3186, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x4124, 0x5164,
-  0x5985, 0x5164, 0x4965, 0x5acb, 0x5acb, 0x3186, 0x0000, 0x0000,
-  0x0820, 0x0820, 0x0820, 0x0820, 0x1880, 0x4944, 0x5985, 0x8a26,
-  0x8206, 0x59a5, 0x72a9, 0x6b2b, 0x62eb, 0x39a6, 0x1041, 0x0820,
-  0x81e6, 0x8206, 0x79e6, 0x8226, 0xc425, 0xd3c6, 0xcb86, 0x9267,
-  0x9247, 0xcba7, 0xdc8b, 0xdd6e, 0xac2f, 0x9b2b, 0x8206, 0x81e6,
-  0x5165, 0x5165, 0x5165, 0x5165, 0x61a5, 0x9267, 0x9a67, 0x9247,
-  0x9247, 0x9a87, 0xab6b, 0x9bce, 0x8bae, 0x72aa, 0x5165, 0x5164,
-  0x10a7, 0x10a7, 0x18c7, 0x61a8, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x10a7, 0x08a7, 0x2106, 0xc3e1, 0x2106, 0x08a7,
-  0x10a7, 0x08a7, 0x2907, 0xcc22, 0x2927, 0x10a7, 0x10a7, 0x10a7,
-  0x18c7, 0x4948, 0x18c7, 0x10a7, 0x10c7, 0x2107, 0x10c7, 0x10a7,
-  0x18c7, 0x2907, 0x7269, 0xee8c, 0x7289, 0x10a7, 0x0886, 0x0886,
-  0x0886, 0x10a6, 0x10a7, 0x10a7, 0x10a7, 0x08a7, 0x10a7, 0x10a7,
-  0x61a8, 0xcc22, 0xe66c, 0xffba, 0xce0b, 0x1081, 0x10a3, 0x18a3,
-  0x18a3, 0x10a3, 0x0001, 0x1086, 0x10a7, 0x20e7, 0x59c9, 0x20e7,
-  0x18c7, 0x2907, 0x7269, 0xe64b, 0x2121, 0x1103, 0xceba, 0xdf5d,
-  0xdf5d, 0xceba, 0x1904, 0x0000, 0x10a7, 0x59c9, 0xcdab, 0x61e9,
-  0x10a7, 0x08a7, 0x2907, 0xcc01, 0x18e2, 0x7698, 0x97fd, 0x7f3a,
-  0x7f3a, 0x8fdd, 0x76b8, 0x08a2, 0x0886, 0x20e8, 0x59c9, 0x20e7,
-  0x10a7, 0x10a7, 0x18c7, 0x5167, 0x18a3, 0xceda, 0xceda, 0x1904,
-  0x2986, 0xdf5d, 0xceda, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0000, 0x1061, 0x1061, 0x1082,
-  0xdedb, 0xef7d, 0x31a6, 0x0020, 0x10a6, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a6, 0x0000, 0x1082, 0x1082, 0x1082,
-  0xd6ba, 0xffdf, 0xd6ba, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x10a2, 0xdedb, 0xdedb, 0x2124,
-  0x31a6, 0xef7d, 0xef7d, 0x10a3, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x10a7, 0x0886, 0x1082, 0xdeda, 0xffff, 0xef7d,
-  0xef5d, 0xffff, 0xd6ba, 0x1082, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10c7, 0x4948, 0x18c7, 0x10a7, 0x0001, 0x18e4, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2124, 0x10a2, 0x2106, 0x18c7, 0x10a7, 0x10a7,
-  0x2106, 0x18c7, 0x10a7, 0x10a7, 0x18a6, 0x10a1, 0x18a3, 0x10a3,
-  0x10a3, 0x1082, 0x1082, 0xd656, 0xd464, 0x5987, 0x10c7, 0x10a7,
-  0xc3e1, 0x2107, 0x08a7, 0x10a7, 0x59c9, 0xcd8a, 0x59a8, 0x1086,
-  0x0886, 0x0886, 0x2106, 0xd444, 0x3966, 0x10c7, 0x10a7, 0x10a7,
-  0x2107, 0x10c7, 0x10a7, 0x10a7, 0x20e7, 0x59c9, 0x20e8, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5987, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x08a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x18c7, 0x5168, 0x18c7, 0x10a7,
-  0x10a7, 0x08a7, 0x18c7, 0x5168, 0x18c7, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10c7, 0x10a7, 0x18c7, 0x10c7, 0x10a7,
-  0x10c7, 0x2107, 0x10c7, 0x10c7, 0x18c7, 0x4948, 0x18c7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5987, 0x18c7, 0x08a6, 0x0886, 0x0886,
-  0x18e5, 0xb381, 0x2106, 0x08a7, 0x10a7, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x3966, 0xcc44, 0x2106, 0x0001, 0x10a2, 0x10a3,
-  0x18c3, 0x20e2, 0x0020, 0x0886, 0x10a7, 0x10a7, 0x08a7, 0x10a7,
-  0x10c7, 0x5988, 0xd464, 0xeeb6, 0x10a2, 0x2104, 0xdeba, 0xef7d,
-  0xef7d, 0xd6ba, 0x2104, 0x0020, 0x10a7, 0x10c7, 0x2107, 0x10c7,
-  0x10a7, 0x10c7, 0x3966, 0xcc23, 0x2102, 0xceba, 0xf7ff, 0xef5d,
-  0xe75d, 0xf7ff, 0xceda, 0x10a2, 0x0886, 0x2107, 0xb3a2, 0x2107,
-  0x10a7, 0x10a7, 0x18c7, 0x5967, 0x10a2, 0x76b8, 0x76b8, 0x1904,
-  0x29a6, 0x873b, 0x76b8, 0x08a2, 0x0886, 0x10c7, 0x2107, 0x10c7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0000, 0x0061, 0x0061, 0x0882,
-  0xd6db, 0xe77d, 0x29a6, 0x0020, 0x10a6, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a6, 0x0000, 0x1082, 0x1082, 0x1082,
-  0xd6ba, 0xffdf, 0xd6ba, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x10a2, 0xdedb, 0xdedb, 0x2124,
-  0x31a6, 0xef7d, 0xef7d, 0x10a3, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x1082, 0xdeda, 0xffff, 0xef7d,
-  0xef5d, 0xffff, 0xd6ba, 0x1082, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10c7, 0x2107, 0x10c7, 0x10a7, 0x0001, 0x1904, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2104, 0x1081, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x2106, 0xb3a2, 0x2107, 0x08a7, 0x0886, 0x1040, 0x1082, 0x10a3,
-  0x18c3, 0x2902, 0x2121, 0xce0b, 0x7269, 0x2927, 0x18c7, 0x10a7,
-  0x18c7, 0x2107, 0x10c7, 0x18c7, 0x3966, 0xcc22, 0x3145, 0x10a6,
-  0x5167, 0xcc01, 0xe64b, 0xffba, 0xee8c, 0xcc42, 0x5988, 0x10c7,
-  0x5148, 0x10a7, 0x10a7, 0x5988, 0xcc42, 0xfea8, 0xcc42, 0x5988,
-  0x18c8, 0x2907, 0x7269, 0xe66c, 0x7269, 0x2907, 0x18c7, 0x10a7,
-  0x18c7, 0x10a7, 0x10a7, 0x18c7, 0x3966, 0xdc82, 0x3986, 0x18c7,
-  0x10a7, 0x0887, 0x2907, 0xd461, 0x2927, 0x0887, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x18c7, 0x5168, 0x18c7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5168, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x18c7, 0x10c7, 0x10a7,
-  0x10c7, 0x18c7, 0x10c7, 0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0886,
-  0x10a6, 0x4927, 0x10c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x1086, 0x0001, 0x10a2, 0x10a3,
-  0x10a3, 0x18a3, 0x0001, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x20e8, 0x59c8, 0x0821, 0x2104, 0xd6ba, 0xef7d,
-  0xef7d, 0xd6ba, 0x2104, 0x0020, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x59c9, 0xc58a, 0x2123, 0xd6bb, 0xffff, 0xef5d,
-  0xef5d, 0xffff, 0xdedb, 0x10a2, 0x0886, 0x20e8, 0x59c9, 0x20e7,
-  0x10a7, 0x10a7, 0x20e8, 0x59a8, 0x18c3, 0xd6da, 0xdedb, 0x2124,
-  0x2986, 0xdf5d, 0xd6db, 0x10a2, 0x1086, 0x59c9, 0xcdab, 0x61e9,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0000, 0x0861, 0x0861, 0x0881,
-  0x76b8, 0x875b, 0x29a6, 0x0020, 0x10a6, 0x20e8, 0x59c9, 0x20e7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a6, 0x0000, 0x1082, 0x1082, 0x0882,
-  0xceba, 0xefdf, 0xd6ba, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x10a2, 0xdedb, 0xdedb, 0x2124,
-  0x31a6, 0xef7d, 0xef7d, 0x10a3, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x1082, 0xdeda, 0xffff, 0xef7d,
-  0xef5d, 0xffff, 0xd6ba, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0001, 0x2104, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2104, 0x0021, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x10a7, 0x10a7, 0x0886, 0x0001, 0x1082, 0x10a3,
-  0x10a3, 0x1082, 0x0001, 0x5967, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x18c7, 0x4948, 0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0886,
-  0x0886, 0x10a6, 0x3165, 0xd442, 0x3966, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x10a7, 0x10a7, 0x20e7, 0x61e9, 0x20e8, 0x10a7,
-  0x10c7, 0x5988, 0xcc42, 0xfea8, 0xcc42, 0x5988, 0x10c7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x61e9, 0xde0b, 0x61e9, 0x10a7,
-  0x10a7, 0x18c7, 0x3966, 0xdc82, 0x3986, 0x18c7, 0x10a7, 0x10a7,
-  0x5169, 0x18c7, 0x10a7, 0x08a7, 0x2106, 0xc3e1, 0x2106, 0x08a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5168, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x10c7, 0x2107, 0x10c7, 0x10a7,
-  0x10a7, 0x10a7, 0x10c7, 0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x08a7, 0x0886, 0x0886,
-  0x0886, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10c7, 0x1086, 0x0001, 0x10a2, 0x10a3,
-  0x10a3, 0x10a2, 0x0001, 0x0886, 0x18c7, 0x4948, 0x18c7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5987, 0x0821, 0x2104, 0xd6ba, 0xef7d,
-  0xef7d, 0xd6ba, 0x2104, 0x0020, 0x10a7, 0x18c7, 0x10c7, 0x10a7,
-  0x10a7, 0x18c7, 0x3966, 0xcc23, 0x2902, 0xd6bb, 0xffff, 0xef5d,
-  0xef5d, 0xffff, 0xdedb, 0x10a2, 0x0886, 0x10c7, 0x5987, 0x18c7,
-  0x10c7, 0x5988, 0xd464, 0xe695, 0x2124, 0xd6ba, 0xdedb, 0x2124,
-  0x31a6, 0xef5d, 0xdedb, 0x10a2, 0x10a6, 0x3966, 0xcc44, 0x3986,
-  0x10a7, 0x10c7, 0x3966, 0xcc43, 0x1880, 0x0861, 0x0861, 0x0882,
-  0xceba, 0xe77d, 0x29a6, 0x0020, 0x5987, 0xd444, 0xfef5, 0xdca3,
-  0x10a7, 0x10a7, 0x18c7, 0x5987, 0x0820, 0x1082, 0x1082, 0x0081,
-  0x6e98, 0x8fdd, 0x6e98, 0x08a2, 0x10a6, 0x3966, 0xcc44, 0x3986,
-  0x10a7, 0x10a7, 0x10a7, 0x1086, 0x10a2, 0xdedb, 0xdedb, 0x2124,
-  0x2986, 0xe77d, 0xe77d, 0x10a3, 0x0886, 0x18c7, 0x5988, 0x18c7,
-  0x10a7, 0x10a7, 0x10a7, 0x0886, 0x1082, 0xdeda, 0xffff, 0xef7d,
-  0xef5d, 0xffff, 0xdeba, 0x10a2, 0x0886, 0x10a7, 0x10c7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0001, 0x2104, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2104, 0x0000, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0001, 0x1082, 0x10a3,
-  0x10a3, 0x1082, 0x0001, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0886,
-  0x0886, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x20e7, 0x59c9, 0x20e7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x61e9, 0xde0b, 0x61e9, 0x10a7, 0x10a7, 0x10a7,
-  0x2926, 0x10c7, 0x10a7, 0x10a7, 0x20e7, 0x61e9, 0x20e7, 0x10a7,
-  0x10c7, 0x61a8, 0xdc83, 0xff57, 0xdca4, 0x61a8, 0x10c7, 0x10a7,
-  0xc3e1, 0x2107, 0x08a7, 0x10a7, 0x59c9, 0xcdab, 0x59e9, 0x10a7,
-  0x10a7, 0x10c7, 0x3966, 0xd444, 0x3966, 0x10c7, 0x10a7, 0x10a7,
-  0x2107, 0x10c7, 0x10a7, 0x10a7, 0x20e7, 0x59c8, 0x18c6, 0x0886,
-  0x0886, 0x0886, 0x10a7, 0x5988, 0x18c7, 0x08a7, 0x10a7, 0x10a7,
-  0x08a7, 0x10a7, 0x10a7, 0x10c7, 0x0886, 0x0001, 0x10a2, 0x10a3,
-  0x10a3, 0x10a2, 0x0001, 0x10a6, 0x10c7, 0x2107, 0x10c7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5987, 0x0821, 0x2104, 0xd6ba, 0xef7d,
-  0xef7d, 0xd6ba, 0x2104, 0x0001, 0x20e6, 0xb3a2, 0x2107, 0x10a7,
-  0x10a7, 0x08a7, 0x2907, 0xcc01, 0x2902, 0xd6bb, 0xffff, 0xef5d,
-  0xef5d, 0xffff, 0xdedb, 0x10a2, 0x0886, 0x2107, 0x10c7, 0x10a7,
-  0x18c7, 0x2907, 0x7289, 0xde2b, 0x2943, 0xd6ba, 0xdedb, 0x2124,
-  0x31a6, 0xef5d, 0xdedb, 0x10a2, 0x0886, 0x08a7, 0x10a7, 0x10a7,
-  0x61a8, 0xcc22, 0xee8c, 0xe739, 0x10a2, 0x1061, 0x1061, 0x1082,
-  0xdedb, 0xef7d, 0x31a6, 0x0020, 0x10a6, 0x20e8, 0x59c9, 0x20e7,
-  0x18c7, 0x2907, 0x7269, 0xde4b, 0x10a1, 0x0081, 0x0081, 0x0882,
-  0xd6ba, 0xefde, 0xceba, 0x10a2, 0x1086, 0x59c9, 0xcdab, 0x61e9,
-  0x10a7, 0x08a7, 0x2907, 0xcc01, 0x2102, 0x76b8, 0x76b8, 0x1924,
-  0x29a6, 0x875b, 0x877b, 0x08a3, 0x0886, 0x20e8, 0x59c9, 0x20e7,
-  0x10a7, 0x10a7, 0x18c7, 0x5167, 0x18a2, 0xceba, 0xf7ff, 0xef7d,
-  0xef5d, 0xf7ff, 0xceba, 0x10a2, 0x0886, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0001, 0x2104, 0xd6ba, 0xef5d,
-  0xef5d, 0xd6ba, 0x2104, 0x0000, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0001, 0x1082, 0x10a3,
-  0x10a3, 0x1082, 0x0001, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x0886,
-  0x0886, 0x0886, 0x10a7, 0x10c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x59a8, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x18c7, 0x5168, 0x18c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x08a7, 0x2106, 0xcc02, 0x2106, 0x08a7, 0x10a7, 0x10a7,
-  0x2106, 0xc3e1, 0x2106, 0x08a7, 0x18c7, 0x61a8, 0x18c7, 0x10a7,
-  0x18c7, 0x2927, 0x7a89, 0xeead, 0x7aa9, 0x2927, 0x18c7, 0x10a7,
-  0x18c7, 0x2107, 0x10c7, 0x10c7, 0x3966, 0xd442, 0x3966, 0x18c7,
-  0x5988, 0xcc22, 0xe66c, 0xf7b9, 0xe66c, 0xcc22, 0x5988, 0x10c7,
-  0x5168, 0x10a7, 0x10a7, 0x5988, 0xcc42, 0xe648, 0xcc21, 0x5967,
-  0x18a6, 0x20e6, 0x7248, 0xee8c, 0x7269, 0x2907, 0x18c7, 0x10a7,
-  0x18c7, 0x10a7, 0x10a7, 0x18c7, 0x20e5, 0x1081, 0x2902, 0x18c3,
-  0x10a3, 0x1083, 0x1860, 0xc401, 0x2907, 0x0887, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x08a7, 0x0001, 0x2104, 0xd6ba, 0xef5d,
-  0xef7d, 0xd6ba, 0x2124, 0x1040, 0x10a6, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x1086, 0x1082, 0xdedb, 0xffff, 0xef5d,
-  0xef5d, 0xffff, 0xdedb, 0x1082, 0x10a6, 0x4948, 0x18c7, 0x10a7,
-  0x10a7, 0x10a7, 0x18c7, 0x5166, 0x18a3, 0xd6da, 0xdedb, 0x2124,
-  0x31a6, 0xef5d, 0xdedb, 0x10a2, 0x0886, 0x18c7, 0x10a7, 0x10a7,
-  0x10a7, 0x18c7, 0x3966, 0xcc43, 0x1880, 0x0861, 0x0861, 0x1082,
-  0xdedb, 0xef7d, 0x31a6, 0x0020, 0x10a6, 0x10a7, 0x08a7, 0x10a7,
-  0x10c7, 0x5988, 0xd464, 0xeeb6, 0x10a2, 0x1082, 0x1082, 0x1082,
-  0xd6ba, 0xffdf, 0xd6ba, 0x10a2, 0x0886, 0x10c7, 0x2107, 0x10c7,
-  0x10a7, 0x10c7, 0x3966, 0xcc23, 0x2102, 0xceba, 0xcedb, 0x1924,
-  0x2186, 0xe77d, 0xe77d, 0x10a3, 0x0886, 0x2107, 0xb3a2, 0x2107,
-  0x10a7, 0x10a7, 0x18c7, 0x5967, 0x10a2, 0x76b8, 0x97fd, 0x7f5a,
-  0x7f3a, 0x8fdd, 0x7698, 0x08a2, 0x0886, 0x10c7, 0x2107, 0x10c7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0001, 0x1103, 0xceba, 0xdf5d,
-  0xdf5d, 0xceba, 0x1104, 0x0000, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x1086, 0x0001, 0x1082, 0x10a3,
-  0x18c3, 0x10a2, 0x0001, 0x0886, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x0886, 0x10a6,
-  0x4927, 0x10a6, 0x10a6, 0x10c7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10c7,
-  0x18c7, 0x10a7, 0x18c7, 0x59a8, 0x18c7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7, 0x10a7,
-  0x10a7, 0x08a7, 0x2106, 0xcc02, 0x2106, 0x08a7, 0x10a7, 0x10a7,
-  0x3dab, 0x356b, 0x1b89, 0x1aa7, 0x2308, 0x2308, 0x2308, 0x1aa7,
-  0x22c7, 0x2308, 0x2308, 0x22e8, 0x22c7, 0x356b, 0x3dcb, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x22e8, 0x5ecf, 0x6750, 0x5f10, 0x244b,
-  0x356b, 0x6730, 0x6751, 0x5ecf, 0x2328, 0x350a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e6f, 0x2b28, 0x3d6b, 0x3d8b, 0x3d8c, 0x5eaf,
-  0x3d6b, 0x3d6b, 0x3d8b, 0x3dab, 0x22e7, 0x22a7, 0x2b28, 0x2b48,
-  0x6730, 0x6730, 0x3dab, 0x2328, 0x1b49, 0x1148, 0x1968, 0x19a8,
-  0x1988, 0x1968, 0x1168, 0x34aa, 0x22c7, 0x2b28, 0x66f0, 0x6751,
-  0x3dcb, 0x3dcb, 0x3dab, 0x350a, 0x1148, 0x1148, 0x34aa, 0x350a,
-  0x350a, 0x34aa, 0x1168, 0x1127, 0x2b28, 0x5ecf, 0x460c, 0x3dcb,
-  0x3d8b, 0x3d8b, 0x3dab, 0x352b, 0x1968, 0x2caa, 0x1c0a, 0x1baa,
-  0x1b8a, 0x1c0a, 0x2c8a, 0x1988, 0x5e8f, 0x460c, 0x356b, 0x3d8b,
-  0x3d8b, 0x3dab, 0x3dab, 0x350a, 0x1148, 0x1349, 0x1349, 0x1107,
-  0x1168, 0x138a, 0x1b8a, 0x1168, 0x3d6b, 0x358b, 0x244a, 0x356b,
-  0x3dab, 0x3dab, 0x356b, 0x1b89, 0x1127, 0x10e7, 0x10c7, 0x1968,
-  0x2caa, 0x1bea, 0x1329, 0x1148, 0x350a, 0x3dab, 0x358b, 0x3dab,
-  0x358b, 0x354b, 0x1bca, 0x2328, 0x12e9, 0x10c7, 0x1968, 0x2caa,
-  0x1c0a, 0x1329, 0x1107, 0x10e7, 0x1b89, 0x354a, 0x358b, 0x358b,
-  0x1baa, 0x1b89, 0x2348, 0x564f, 0x1988, 0x1168, 0x2caa, 0x1c0a,
-  0x136a, 0x1188, 0x1107, 0x10e7, 0x1aa7, 0x2328, 0x1ba9, 0x1bca,
-  0x1a87, 0x2307, 0x350a, 0x1bca, 0x1148, 0x2caa, 0x1c0a, 0x13aa,
-  0x1bca, 0x350a, 0x34ca, 0x1168, 0x34ca, 0x350a, 0x1ac7, 0x1a87,
-  0x2307, 0x34ea, 0x1c0a, 0x1349, 0x1127, 0x1b49, 0x136a, 0x136a,
-  0x136a, 0x1b8a, 0x1b49, 0x1128, 0x1b8a, 0x1baa, 0x1aa7, 0x22c7,
-  0x352a, 0x1bea, 0x138a, 0x136a, 0x1127, 0x1127, 0x1107, 0x1107,
-  0x1128, 0x1128, 0x1148, 0x1127, 0x1349, 0x1aa7, 0x2307, 0x350a,
-  0x1bca, 0x1389, 0x1ae8, 0x1b69, 0x1a87, 0x1b29, 0x1a67, 0x1a67,
-  0x1329, 0x1b89, 0x2caa, 0x22c7, 0x1a87, 0x22e7, 0x34ca, 0x1bea,
-  0x1a87, 0x1aa7, 0x1b49, 0x1aa7, 0x1a87, 0x1aa7, 0x1a87, 0x1a87,
-  0x1aa7, 0x1aa7, 0x22e7, 0x1b69, 0x1aa7, 0x1b49, 0x22e7, 0x1aa7,
-  0x1a87, 0x1a87, 0x1aa7, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1a87,
-  0x1a87, 0x1a87, 0x1a87, 0x1aa7, 0x1a87, 0x1aa7, 0x1a87, 0x1a87,
-  0x3dab, 0x3dab, 0x358b, 0x354a, 0x1b89, 0x1a87, 0x1a67, 0x22c7,
-  0x350a, 0x354a, 0x354a, 0x350a, 0x2307, 0x354a, 0x3dab, 0x3dab,
-  0x3dab, 0x356b, 0x1bc9, 0x22e7, 0x2308, 0x2308, 0x2308, 0x1ac7,
-  0x2307, 0x2b48, 0x2b48, 0x2b28, 0x22c7, 0x356a, 0x3dab, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x22e7, 0x5eef, 0x66f0, 0x5e6f, 0x1baa,
-  0x34ca, 0x5e8f, 0x66f0, 0x5ed0, 0x2328, 0x350a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e6f, 0x2b28, 0x34ca, 0x19a8, 0x21c9, 0x19a8,
-  0x19c8, 0x21c9, 0x19a8, 0x34ea, 0x22e7, 0x22a7, 0x2b28, 0x2b48,
-  0x6730, 0x6730, 0x3dcb, 0x22e7, 0x1127, 0x19a8, 0x5e90, 0x6730,
-  0x6730, 0x5e90, 0x19a9, 0x1127, 0x1a47, 0x2b48, 0x66f0, 0x6751,
-  0x3dcb, 0x3dcb, 0x3dab, 0x34ea, 0x1988, 0x5e6f, 0x460c, 0x3d8b,
-  0x3d6b, 0x460c, 0x5e8f, 0x1948, 0x2b08, 0x5ecf, 0x460c, 0x3dcb,
-  0x3d8b, 0x3d8b, 0x3dab, 0x352b, 0x1968, 0x350b, 0x34ea, 0x1147,
-  0x19e8, 0x356b, 0x3d8b, 0x19a8, 0x5e8f, 0x460c, 0x356b, 0x3d8b,
-  0x3dab, 0x3dab, 0x3dab, 0x352a, 0x1147, 0x1107, 0x10e7, 0x21a9,
-  0x5e6f, 0x3deb, 0x34ca, 0x1968, 0x3d6b, 0x358b, 0x244a, 0x358b,
-  0x3dab, 0x358b, 0x354b, 0x1bc9, 0x1a27, 0x10a7, 0x19a9, 0x5e8f,
-  0x460c, 0x34ca, 0x1147, 0x1107, 0x350a, 0x3dab, 0x354b, 0x3dab,
-  0x354b, 0x1bea, 0x1ba9, 0x1ac7, 0x1107, 0x21a9, 0x5e8f, 0x460c,
-  0x354a, 0x1a09, 0x1928, 0x10e7, 0x1b89, 0x350a, 0x1c0a, 0x354b,
-  0x1ba9, 0x1aa7, 0x2307, 0x2c8a, 0x19a8, 0x5e6f, 0x460c, 0x3dab,
-  0x3dcb, 0x6710, 0x5eb0, 0x1968, 0x1aa7, 0x2307, 0x1ac7, 0x1ba9,
-  0x1a87, 0x2307, 0x34ea, 0x1baa, 0x1148, 0x34eb, 0x354b, 0x352a,
-  0x352a, 0x3d6b, 0x350b, 0x1968, 0x34ca, 0x350a, 0x22c7, 0x1a87,
-  0x2307, 0x34ea, 0x1c0a, 0x1349, 0x1128, 0x1147, 0x1147, 0x1988,
-  0x1988, 0x1988, 0x1127, 0x1107, 0x1b8a, 0x1ba9, 0x1aa7, 0x22c7,
-  0x350a, 0x1bea, 0x1369, 0x1ac7, 0x1349, 0x1329, 0x1aa7, 0x34aa,
-  0x350a, 0x34ca, 0x1aa7, 0x1a67, 0x1a87, 0x1a87, 0x22e7, 0x34ea,
-  0x22c7, 0x1aa7, 0x1aa7, 0x1a87, 0x1aa7, 0x1aa7, 0x1a87, 0x22c7,
-  0x22c7, 0x22e7, 0x1b69, 0x1ac7, 0x1a87, 0x1aa7, 0x1b49, 0x22e7,
-  0x1a87, 0x1aa7, 0x1b69, 0x1aa7, 0x1a87, 0x1a87, 0x1a87, 0x1a87,
-  0x1a87, 0x1a87, 0x1ac7, 0x1b69, 0x1ac7, 0x1b69, 0x1ac7, 0x1a87,
-  0x3d8b, 0x3dcb, 0x6750, 0x3deb, 0x354b, 0x1ba9, 0x22c7, 0x352a,
-  0x3dab, 0x3dab, 0x3dec, 0x6710, 0x2b69, 0x6710, 0x3deb, 0x3dab,
-  0x3d8b, 0x3dab, 0x3dab, 0x354a, 0x1bc9, 0x1ac7, 0x1a87, 0x2307,
-  0x352a, 0x356b, 0x356b, 0x352a, 0x2307, 0x3d8b, 0x3dab, 0x3dab,
-  0x3dab, 0x354b, 0x1ba9, 0x22e7, 0x2308, 0x1a67, 0x1a46, 0x1a46,
-  0x1a87, 0x1a87, 0x22a7, 0x2328, 0x22e7, 0x356a, 0x3dab, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x22e8, 0x560e, 0x1968, 0x2149, 0x2969,
-  0x2969, 0x2149, 0x1948, 0x55ee, 0x2328, 0x350a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e8f, 0x22e8, 0x1948, 0x31ab, 0xceda, 0xe77c,
-  0xe77c, 0xd6db, 0x31cb, 0x1948, 0x1a67, 0x22c7, 0x2b28, 0x2b48,
-  0x6730, 0x6730, 0x3dcb, 0x1ac7, 0x2149, 0xc6da, 0x8ff4, 0x7772,
-  0x7752, 0x87f4, 0xc6da, 0x2149, 0x1a26, 0x2b48, 0x66f0, 0x6751,
-  0x3dcb, 0x3dcb, 0x3dab, 0x34ea, 0x1988, 0x6ed1, 0x66f0, 0x19a8,
-  0x2a2a, 0x6f71, 0x7772, 0x1968, 0x2b08, 0x5ecf, 0x460c, 0x3dcb,
-  0x3d8b, 0x3d8b, 0x3dab, 0x354b, 0x1147, 0x1128, 0x1127, 0x31ab,
-  0xc6da, 0x7ff3, 0x5eb0, 0x21c9, 0x5e8f, 0x460c, 0x356b, 0x3dab,
-  0x3dab, 0x358b, 0x3dab, 0x354a, 0x1a67, 0x08a7, 0x318a, 0xceda,
-  0x87f4, 0x5ed0, 0x1988, 0x1107, 0x354b, 0x358b, 0x244a, 0x354b,
-  0x354b, 0x1c2a, 0x352a, 0x1ba9, 0x1107, 0x31ab, 0xceda, 0x87f4,
-  0x6f71, 0x324b, 0x2129, 0x10e7, 0x1b89, 0x356b, 0x352b, 0x1bea,
-  0x1bca, 0x1b89, 0x22c7, 0x1aa7, 0x2169, 0xc6da, 0x8ff4, 0x6ff2,
-  0x7ff3, 0xd77b, 0xd6db, 0x2169, 0x1a67, 0x1ba9, 0x1bca, 0x13aa,
-  0x1369, 0x1aa7, 0x2307, 0x2c8a, 0x1988, 0x6eb1, 0x6f51, 0x6731,
-  0x6f51, 0x7772, 0x6ed1, 0x1948, 0x1a87, 0x22e7, 0x1ac7, 0x1b89,
-  0x1aa7, 0x2307, 0x34ea, 0x1baa, 0x1128, 0x1948, 0x1968, 0x1968,
-  0x1968, 0x1968, 0x1948, 0x1988, 0x34ea, 0x350a, 0x22c7, 0x1a87,
-  0x22e7, 0x34ca, 0x1bc9, 0x1ac7, 0x1b29, 0x1a67, 0x1a47, 0x1a67,
-  0x1a67, 0x1a67, 0x1a87, 0x34aa, 0x1bca, 0x22e7, 0x1a87, 0x1aa7,
-  0x1b69, 0x22e7, 0x1aa7, 0x1a87, 0x1aa7, 0x1a87, 0x1aa7, 0x1b69,
-  0x1b89, 0x1b69, 0x1ac7, 0x22c7, 0x1aa7, 0x1a87, 0x1aa7, 0x1b69,
-  0x1aa7, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1aa7,
-  0x1aa7, 0x1ac7, 0x1b69, 0x1aa7, 0x1a87, 0x1aa7, 0x1b69, 0x1ac7,
-  0x3dab, 0x358b, 0x244b, 0x358b, 0x3dab, 0x354a, 0x2307, 0x356a,
-  0x3dab, 0x3dcb, 0x6730, 0x2b69, 0x1a87, 0x2b69, 0x6730, 0x3dec,
-  0x3d8b, 0x3dcb, 0x5f10, 0x3dcb, 0x354b, 0x1bc9, 0x22e7, 0x352a,
-  0x3dab, 0x3dab, 0x460c, 0x5eaf, 0x2b48, 0x5eaf, 0x45ec, 0x3dab,
-  0x3dab, 0x3dab, 0x3dab, 0x354a, 0x1bc9, 0x1a87, 0x1a46, 0x1aa7,
-  0x34ea, 0x352a, 0x354b, 0x3d4b, 0x2307, 0x3d8b, 0x3dab, 0x3dab,
-  0x3dab, 0x354b, 0x1ba9, 0x22c7, 0x1a47, 0x10e7, 0x2149, 0x2969,
-  0x29aa, 0x2989, 0x1127, 0x1a67, 0x22c7, 0x356a, 0x3dab, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x1a67, 0x10e7, 0x31aa, 0xceda, 0xe77c,
-  0xe77c, 0xcedb, 0x31ab, 0x10e7, 0x22a7, 0x352a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e8f, 0x22a7, 0x2149, 0xc6da, 0x8ff4, 0x7772,
-  0x7752, 0x87f4, 0xc6da, 0x2149, 0x1a46, 0x22c7, 0x2b28, 0x2b48,
-  0x6730, 0x6730, 0x3dcb, 0x22c7, 0x1948, 0x6ed1, 0x66f0, 0x19a8,
-  0x2a2a, 0x6f71, 0x7772, 0x1968, 0x1a26, 0x2b48, 0x66f0, 0x6751,
-  0x3dcb, 0x3dcb, 0x3dab, 0x350a, 0x1147, 0x1128, 0x1127, 0x31ab,
-  0xc6da, 0x7ff3, 0x5ed0, 0x1968, 0x2b28, 0x5ecf, 0x460c, 0x3dcb,
-  0x3d8b, 0x3dab, 0x3dab, 0x354a, 0x1a67, 0x08a7, 0x318a, 0xceda,
-  0x87f4, 0x5ed0, 0x1988, 0x1928, 0x5e6f, 0x460c, 0x356b, 0x3dab,
-  0x356b, 0x356b, 0x356b, 0x1ba9, 0x1107, 0x31ab, 0xceda, 0x87f4,
-  0x6f71, 0x324b, 0x2129, 0x1107, 0x1bea, 0x352b, 0x1c2a, 0x354b,
-  0x1bca, 0x1bca, 0x1ba9, 0x1a67, 0x2149, 0xc6da, 0x8ff4, 0x6ff2,
-  0x7ff3, 0xd77b, 0xd6db, 0x2169, 0x1329, 0x1bca, 0x13aa, 0x1bca,
-  0x13aa, 0x1369, 0x1aa7, 0x1a87, 0x1968, 0x6eb1, 0x6f51, 0x6731,
-  0x6f31, 0x7772, 0x6ed1, 0x1968, 0x1a67, 0x1369, 0x138a, 0x13aa,
-  0x1b89, 0x1aa7, 0x2307, 0x34aa, 0x1147, 0x1948, 0x1968, 0x1968,
-  0x1988, 0x1968, 0x1948, 0x1107, 0x22a7, 0x22e7, 0x1ac7, 0x1b89,
-  0x1a87, 0x22e7, 0x34ca, 0x1bca, 0x1a87, 0x1a47, 0x1a47, 0x1a67,
-  0x1309, 0x1a67, 0x1a47, 0x1aa7, 0x34ea, 0x34ea, 0x22c7, 0x1a87,
-  0x1aa7, 0x1b49, 0x22e7, 0x1aa7, 0x1a87, 0x1a87, 0x1a87, 0x1a87,
-  0x1ac7, 0x1aa7, 0x1aa7, 0x1b69, 0x22e7, 0x22c7, 0x1a87, 0x1aa7,
-  0x1b89, 0x1ac7, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1aa7,
-  0x1b89, 0x1b89, 0x1aa7, 0x1aa7, 0x1a87, 0x1a87, 0x1aa7, 0x1b69,
-  0x6771, 0x3dcb, 0x356b, 0x3d8b, 0x3dab, 0x356a, 0x2328, 0x6730,
-  0x6fb1, 0x6751, 0x2b69, 0x1b89, 0x350a, 0x1b89, 0x2b69, 0x6750,
-  0x3dcb, 0x358b, 0x246b, 0x356b, 0x3dab, 0x354a, 0x2307, 0x3d8b,
-  0x3deb, 0x460c, 0x5ecf, 0x2b69, 0x22c7, 0x2b69, 0x5ecf, 0x460c,
-  0x358b, 0x3dcb, 0x5f10, 0x3dcb, 0x354b, 0x1b89, 0x1a87, 0x34ca,
-  0x352a, 0x352a, 0x3dac, 0x5eaf, 0x2b48, 0x5eaf, 0x460c, 0x3dab,
-  0x3dab, 0x3dab, 0x3dab, 0x354a, 0x1b89, 0x1107, 0x1968, 0x19a8,
-  0x19a8, 0x1988, 0x1168, 0x34ca, 0x2307, 0x3d8b, 0x3dab, 0x3dab,
-  0x3dab, 0x354b, 0x1ba9, 0x1aa7, 0x1107, 0x19a9, 0x5eb0, 0x6731,
-  0x6730, 0x5e90, 0x21a9, 0x1107, 0x22a7, 0x356a, 0x3dab, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x1a47, 0x1948, 0x5e8f, 0x460c, 0x3d8b,
-  0x3d6b, 0x460c, 0x5e8f, 0x1948, 0x1a87, 0x352a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e8f, 0x22c8, 0x1127, 0x350b, 0x34ea, 0x1147,
-  0x19e8, 0x356b, 0x3d8b, 0x1147, 0x1a47, 0x22c7, 0x2b28, 0x2b48,
-  0x6730, 0x6730, 0x3dcb, 0x22e7, 0x1107, 0x1107, 0x10e7, 0x21a9,
-  0x5e6f, 0x3deb, 0x34ca, 0x1127, 0x1a47, 0x2b48, 0x66f0, 0x6751,
-  0x3dab, 0x3dcb, 0x3dab, 0x350a, 0x1a67, 0x10a7, 0x19a9, 0x5e8f,
-  0x460c, 0x34ca, 0x1147, 0x10c7, 0x2308, 0x5eaf, 0x460c, 0x3deb,
-  0x1bea, 0x354b, 0x356b, 0x1bca, 0x1107, 0x21a9, 0x5e8f, 0x460c,
-  0x354a, 0x1a09, 0x1928, 0x1127, 0x2cca, 0x244b, 0x352a, 0x356b,
-  0x13aa, 0x1bca, 0x1bca, 0x1349, 0x1968, 0x5e8f, 0x460c, 0x3dab,
-  0x3dcb, 0x6710, 0x5eb0, 0x1988, 0x138a, 0x138a, 0x1b08, 0x1bca,
-  0x13aa, 0x13aa, 0x1389, 0x1a67, 0x1127, 0x350b, 0x354b, 0x352a,
-  0x352a, 0x3d6b, 0x3d0b, 0x1148, 0x1349, 0x13aa, 0x138a, 0x13aa,
-  0x138a, 0x1b89, 0x1ac7, 0x22a7, 0x1107, 0x1127, 0x1147, 0x1148,
-  0x1148, 0x1147, 0x1148, 0x1107, 0x1a87, 0x1b89, 0x13aa, 0x13aa,
-  0x1aa7, 0x1a87, 0x22e7, 0x34aa, 0x22a7, 0x1a47, 0x1a67, 0x1329,
-  0x1329, 0x1a87, 0x1b29, 0x1a87, 0x1aa7, 0x1aa7, 0x1ac7, 0x1b89,
-  0x1a87, 0x1aa7, 0x1b49, 0x22e7, 0x1a87, 0x1a87, 0x1a87, 0x1aa7,
-  0x1aa7, 0x1a87, 0x1aa7, 0x1ac7, 0x1b69, 0x1b69, 0x1aa7, 0x1aa7,
-  0x1aa7, 0x1b69, 0x1ac7, 0x1a87, 0x1a87, 0x1a87, 0x1a87, 0x1a87,
-  0x1a87, 0x1a87, 0x1aa7, 0x1b69, 0x1ac7, 0x1aa7, 0x1a87, 0x1a87,
-  0x2b89, 0x6710, 0x3deb, 0x3dab, 0x3dab, 0x356b, 0x22e7, 0x22e8,
-  0x2308, 0x22e8, 0x22e8, 0x5ef0, 0x3dec, 0x354a, 0x22c7, 0x22e8,
-  0x6710, 0x45ec, 0x356b, 0x3d8b, 0x3dab, 0x356a, 0x2328, 0x5ecf,
-  0x6750, 0x66f0, 0x2b69, 0x23ea, 0x352a, 0x1ba9, 0x2b69, 0x5ecf,
-  0x3dcb, 0x358b, 0x246b, 0x358b, 0x3dab, 0x350a, 0x22c7, 0x350b,
-  0x3d6b, 0x3d8c, 0x5e6f, 0x2b69, 0x22c7, 0x2b69, 0x5ecf, 0x460c,
-  0x358b, 0x3dcb, 0x5f10, 0x3dcb, 0x34ea, 0x1168, 0x1127, 0x1968,
-  0x1988, 0x1168, 0x21c9, 0x560f, 0x2b48, 0x5eaf, 0x460c, 0x3dab,
-  0x3dab, 0x3dab, 0x3dab, 0x350a, 0x1968, 0x1148, 0x34aa, 0x352a,
-  0x350a, 0x34aa, 0x1168, 0x1948, 0x22a7, 0x3d8b, 0x3dab, 0x3dab,
-  0x3dab, 0x354b, 0x1ba9, 0x1aa7, 0x1127, 0x2caa, 0x1c0a, 0x1baa,
-  0x1b8a, 0x1c0a, 0x2caa, 0x1127, 0x1a87, 0x356a, 0x3dab, 0x3dab,
-  0x352a, 0x1bc9, 0x2308, 0x1a67, 0x1107, 0x1b6a, 0x1349, 0x1107,
-  0x1168, 0x138a, 0x1baa, 0x1107, 0x2287, 0x352a, 0x354a, 0x354a,
-  0x2328, 0x2b69, 0x5e8f, 0x22c8, 0x1107, 0x10e7, 0x10c7, 0x1968,
-  0x2caa, 0x1bea, 0x1329, 0x1107, 0x1a67, 0x22c7, 0x2b28, 0x2b48,
-  0x6750, 0x6730, 0x3d8b, 0x2328, 0x12e9, 0x10c7, 0x1968, 0x2caa,
-  0x1c0a, 0x1329, 0x1107, 0x10c7, 0x1a47, 0x2328, 0x5eb0, 0x6751,
-  0x3dab, 0x3d8b, 0x1c0a, 0x2cca, 0x1148, 0x1968, 0x2caa, 0x1c0a,
-  0x136a, 0x1188, 0x1107, 0x10e7, 0x22c7, 0x34ea, 0x244b, 0x3d8b,
-  0x1bca, 0x1bca, 0x13aa, 0x1b8a, 0x1148, 0x2caa, 0x1c0a, 0x13aa,
-  0x1bca, 0x350a, 0x34ca, 0x1968, 0x2caa, 0x1bea, 0x1389, 0x1bca,
-  0x13aa, 0x13aa, 0x13aa, 0x1349, 0x1127, 0x1b49, 0x136a, 0x1349,
-  0x136a, 0x1b8a, 0x1b49, 0x1128, 0x1b8a, 0x13aa, 0x1ae8, 0x138a,
-  0x13aa, 0x138a, 0x1b89, 0x1a87, 0x1107, 0x1128, 0x1127, 0x1148,
-  0x1128, 0x1128, 0x1107, 0x1107, 0x1349, 0x13aa, 0x138a, 0x138a,
-  0x1b89, 0x1ac7, 0x1aa7, 0x1aa7, 0x1a87, 0x1329, 0x22a7, 0x2c8a,
-  0x1b89, 0x1329, 0x1a67, 0x1a67, 0x1aa7, 0x1b89, 0x1b89, 0x1ac7,
-  0x1aa7, 0x1a87, 0x1aa7, 0x1b49, 0x1aa7, 0x1aa7, 0x1a87, 0x22c7,
-  0x1aa7, 0x1aa7, 0x1a87, 0x1a87, 0x1aa7, 0x1aa7, 0x1aa7, 0x1a87,
-  0x1a87, 0x1aa7, 0x1b69, 0x1ac7, 0x1a87, 0x1a87, 0x1a87, 0x1a87,
-  0x1a87, 0x1a87, 0x1a87, 0x1aa7, 0x1b89, 0x1b89, 0x1aa7, 0x1a87,
-  0x5ad1, 0x5ad0, 0x420d, 0x5ad1, 0x5ad1, 0x62f1, 0x8393, 0x4a2d,
-  0x41ec, 0x420d, 0x6311, 0x93f5, 0x93f5, 0x6311, 0x420d, 0x41ed,
-  0x5ab0, 0x52b0, 0x39cc, 0x528f, 0x5ad1, 0x62f1, 0x8393, 0x528f,
-  0x5ab0, 0x7b93, 0xa4b6, 0xc5db, 0xcddb, 0xa4d6, 0x7b93, 0x5ad0,
-  0x420d, 0x39cc, 0x0841, 0x0842, 0x5ab0, 0x8394, 0x5a90, 0x1084,
-  0x39ab, 0x5ab1, 0x6311, 0x6b32, 0x8bd4, 0x6b12, 0x5ad0, 0x39ec,
-  0x5ab1, 0x528f, 0x0842, 0x0842, 0x62d0, 0x7b53, 0x492d, 0x494c,
-  0x498d, 0x414d, 0x5290, 0x5ad0, 0x7b53, 0x5ab0, 0x31ab, 0x0841,
-  0x5ad1, 0x5ad1, 0x5ad0, 0x6310, 0x9454, 0x496d, 0x59cf, 0xe6fc,
-  0xe6dc, 0x498e, 0x41cd, 0x420d, 0x4a2e, 0x41ec, 0x0862, 0x0000,
-  0x62d1, 0x6311, 0x9cb5, 0x9cb5, 0x62f1, 0x518e, 0xe6fc, 0xffff,
-  0xef7e, 0x51ae, 0x526f, 0x7b93, 0x9c75, 0x5ab0, 0x3169, 0x0020,
-  0x8393, 0x7b93, 0x5ad0, 0x6311, 0x5290, 0x518e, 0xe6dc, 0xffff,
-  0xef5d, 0x518e, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x62f2, 0x5ab0, 0x18c4, 0x4a6e, 0x39cc, 0x390c, 0x59ef, 0xef7e,
-  0xef7e, 0x51ae, 0x5270, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x528f, 0x526f, 0x39cb, 0x41ec, 0x18a4, 0x316b, 0x496d, 0xef5e,
-  0xef7e, 0x496d, 0x41ac, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x0021, 0x0863, 0x420c, 0x7b73, 0x7332, 0x412c, 0x59ef, 0xef7e,
-  0xf77e, 0x59ef, 0x412c, 0x7b73, 0x9cb5, 0x5ab0, 0x2969, 0x0000,
-  0x0021, 0x318a, 0x7b52, 0x6311, 0x62d1, 0x518e, 0xe6fc, 0xffff,
-  0xffff, 0xe6fc, 0x51ae, 0x6af2, 0x8bf4, 0x4a2d, 0x1083, 0x0841,
-  0x41ec, 0x4a2d, 0x62f1, 0x62f1, 0x7b32, 0x51ae, 0xdedc, 0xef5e,
-  0xef5e, 0xdedc, 0x59cf, 0xc59a, 0xd63c, 0xa4f6, 0x7b72, 0x5ab0,
-  0x7b72, 0x9474, 0x8393, 0x62f1, 0x5ad1, 0x494d, 0x496d, 0x496d,
-  0x518e, 0x496d, 0x518e, 0xc5bb, 0xce1c, 0xad16, 0x83b3, 0x5ad1,
-  0x1062, 0x420c, 0x4a0d, 0x5ab0, 0x5290, 0x5290, 0x39ab, 0x0842,
-  0x316a, 0x39cc, 0x5ab0, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39cb,
-  0x0021, 0x4a6e, 0x39cc, 0x318a, 0x0863, 0x31aa, 0x318a, 0x0020,
-  0x0821, 0x39cc, 0x62f1, 0x83b4, 0x83b4, 0x62f1, 0x39cc, 0x0841,
-  0x0841, 0x4a4e, 0x0862, 0x0020, 0x0000, 0x0020, 0x0021, 0x0000,
-  0x0021, 0x528f, 0x83b4, 0xacf6, 0xacf6, 0x83b4, 0x528f, 0x0021,
-  0x5ad1, 0x5ad0, 0x41ed, 0x5ab0, 0x5ad1, 0x62f1, 0x8393, 0x420d,
-  0x39cc, 0x420d, 0x5ad1, 0x8393, 0x83b4, 0x5ad1, 0x420d, 0x39cc,
-  0x5ab0, 0x5ab0, 0x420d, 0x5ab0, 0x5ad1, 0x62f1, 0x8393, 0x5ab0,
-  0x39cc, 0x528f, 0x5ad1, 0x62f1, 0x8394, 0x62f1, 0x5290, 0x39cb,
-  0x41ed, 0x39cc, 0x526f, 0x5ad1, 0x62f1, 0x8393, 0x62f1, 0x526f,
-  0x1084, 0x39cc, 0x5ab0, 0x5ad1, 0x7b73, 0x5ab0, 0x31ab, 0x0841,
-  0x528f, 0x0842, 0x0842, 0x528f, 0x6312, 0x8353, 0x59b1, 0x6212,
-  0x61d1, 0x5990, 0x41ed, 0x420d, 0x4a2e, 0x41ec, 0x0862, 0x0000,
-  0x528f, 0x0862, 0x1082, 0x62f0, 0x7b73, 0x61d1, 0x7253, 0xe6fd,
-  0xe6fd, 0x6212, 0x5a90, 0x7b93, 0x9c75, 0x5ab0, 0x3169, 0x0020,
-  0x6312, 0x6311, 0x9474, 0x9cb5, 0x62d1, 0x61f2, 0xe6fd, 0xffff,
-  0xf77e, 0x6212, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0xc5ba, 0x9c94, 0x6b32, 0x62f1, 0x41ed, 0x61f1, 0xe6fd, 0xffff,
-  0xef5e, 0x6a12, 0x5a90, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x62f1, 0x20e5, 0x4a4e, 0x5ab0, 0x5290, 0x5990, 0x7253, 0xf77e,
-  0xf77e, 0x6212, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x526f, 0x318a, 0x1083, 0x41ec, 0x4a2d, 0x41ad, 0x61d1, 0xf75e,
-  0xf77e, 0x6212, 0x5a70, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x0842, 0x39ab, 0x41ec, 0x7b72, 0x9454, 0x59d1, 0x7253, 0xf77e,
-  0xf77e, 0x7273, 0x59b1, 0x62f2, 0x83b3, 0x420d, 0x0862, 0x0000,
-  0x0000, 0x39cb, 0x7b53, 0x6311, 0x62f1, 0x6a12, 0xe6fd, 0xffff,
-  0xffff, 0xe6fd, 0x6a12, 0x8bb4, 0xa4f6, 0x6311, 0x39ab, 0x0862,
-  0x0841, 0x39ab, 0x5ad1, 0x62f1, 0x7b53, 0x6a12, 0xe6fd, 0xf77e,
-  0xf77e, 0xe6fd, 0x7253, 0xcddb, 0xd65c, 0xad16, 0x83b3, 0x5ab0,
-  0x41ec, 0x4a2d, 0x5ad1, 0x5ad1, 0x62d1, 0x59b1, 0x61f2, 0x6212,
-  0x6212, 0x61f1, 0x61f2, 0xc5bb, 0xce1b, 0xacf6, 0x8393, 0x5ad1,
-  0x7b72, 0x9474, 0x7b72, 0x5ad1, 0x5ab0, 0x526f, 0x39ac, 0x39ac,
-  0x398b, 0x39cc, 0x5ab0, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39cb,
-  0x1082, 0x39eb, 0x1083, 0x39cb, 0x31ab, 0x0842, 0x0841, 0x2969,
-  0x0862, 0x39cc, 0x62f1, 0x83b4, 0x83b4, 0x62f1, 0x39cc, 0x0841,
-  0x0021, 0x4a2d, 0x0862, 0x318a, 0x0842, 0x0000, 0x0000, 0x0020,
-  0x0021, 0x528f, 0x83b4, 0xacf6, 0xacf6, 0x83b4, 0x528f, 0x0021,
-  0x5ad1, 0x5ad1, 0x39cc, 0x0842, 0x0862, 0x5ab0, 0x8393, 0x420d,
-  0x39ec, 0x420d, 0x6311, 0x8bf4, 0x8bf5, 0x6311, 0x420d, 0x41ec,
-  0x5ad1, 0x5ab0, 0x420d, 0x526f, 0x528f, 0x62f1, 0x8393, 0x5ad1,
-  0x5ad0, 0x8393, 0xa4f6, 0xd61b, 0xd61c, 0xa4f6, 0x8393, 0x5ad1,
-  0x39cb, 0x420d, 0x5ab0, 0x5ad1, 0x62f1, 0x8393, 0x62f2, 0x5ab1,
-  0x62d1, 0x8bb4, 0xad37, 0xde5c, 0xde5c, 0xb537, 0x8bd4, 0x62f1,
-  0x0842, 0x526f, 0x5ad1, 0x5ad1, 0x62f1, 0x8374, 0x8276, 0x8ad7,
-  0x8ad7, 0x82b7, 0xad17, 0xd65c, 0xde5c, 0xad37, 0x8bb4, 0x62f1,
-  0x0862, 0x528f, 0x62f1, 0x62f1, 0x8374, 0x8297, 0x9338, 0xef1e,
-  0xef1e, 0x8af7, 0xacf7, 0xd65c, 0xde5c, 0xad37, 0x8bb4, 0x62f1,
-  0x5ad0, 0x6311, 0x8393, 0x8393, 0x62d1, 0x82d7, 0xef1e, 0xffff,
-  0xf77e, 0x9317, 0xacf7, 0xde5c, 0xde5c, 0xb537, 0x8bd4, 0x62f1,
-  0xa4d5, 0x9cb5, 0x6311, 0x5ab0, 0x41ed, 0x82b7, 0xef1e, 0xffff,
-  0xf77e, 0x8af7, 0xa4d6, 0xce1b, 0xd61c, 0xacf6, 0x83b3, 0x5ad1,
-  0x420c, 0x5ad0, 0x5ad0, 0x39ec, 0x41cd, 0x7235, 0x9338, 0xf77e,
-  0xf77e, 0x8ad7, 0x62d2, 0x6b32, 0x8bd4, 0x6b12, 0x5ab0, 0x39cc,
-  0x0841, 0x39cc, 0x5290, 0x4a2d, 0x41ed, 0x49ee, 0x82b7, 0xf77e,
-  0xf77e, 0x8ad7, 0x5a91, 0x5ad0, 0x7b53, 0x5ab0, 0x31ab, 0x0841,
-  0x0020, 0x39ab, 0x4a4e, 0x9474, 0x8393, 0x7a56, 0x9338, 0xf77e,
-  0xf79e, 0x9338, 0x7a56, 0x4a0e, 0x4a2d, 0x39cc, 0x0862, 0x0000,
-  0x0020, 0x39aa, 0x7b52, 0x6311, 0x62f2, 0x8ad7, 0xef1e, 0xffff,
-  0xffff, 0xef3e, 0x8ad7, 0x8bb4, 0xa4b5, 0x6311, 0x39ab, 0x0862,
-  0x0000, 0x0863, 0x5ab0, 0x62f1, 0x7b53, 0x8ad7, 0xef1e, 0xf77f,
-  0xf77f, 0xef1e, 0x9318, 0xcddc, 0xd65c, 0xad16, 0x83b3, 0x5ab0,
-  0x0000, 0x318a, 0x52b0, 0x5ad1, 0x62d2, 0x7a76, 0x82b7, 0x82d7,
-  0x82d7, 0x82b7, 0x82b7, 0xcddb, 0xce1b, 0xacf6, 0x8393, 0x5ad1,
-  0x1082, 0x420c, 0x4a2e, 0x5ab0, 0x5ab1, 0x5ab1, 0x39ac, 0x39ac,
-  0x39ac, 0x41cd, 0x5ab1, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39cb,
-  0x7331, 0x9454, 0x7331, 0x39cc, 0x39ec, 0x31aa, 0x0841, 0x0020,
-  0x0841, 0x39cc, 0x62f1, 0x83b4, 0x83b4, 0x62f1, 0x39cc, 0x0841,
-  0x1083, 0x39cb, 0x1062, 0x0842, 0x318a, 0x0842, 0x0000, 0x0000,
-  0x0021, 0x528f, 0x83b4, 0xacf6, 0xacf6, 0x83b4, 0x528f, 0x0021,
-  0x5ad1, 0x5ad0, 0x41ed, 0x526f, 0x528f, 0x62f1, 0x8373, 0x39cc,
-  0x39ec, 0x420d, 0x6311, 0x8bf4, 0x8bf5, 0x6311, 0x420d, 0x41ec,
-  0x5ab0, 0x5ab0, 0x39cc, 0x0842, 0x0862, 0x5ad0, 0x7b52, 0x18c5,
-  0x528f, 0x8393, 0xa4f6, 0xd61b, 0xd61c, 0xa4f6, 0x8393, 0x5ad1,
-  0x41ed, 0x420d, 0x526f, 0x0862, 0x0862, 0x7b52, 0x62f2, 0x5290,
-  0x62b1, 0x8bb4, 0xad37, 0xde5c, 0xde5c, 0xb537, 0x8bd4, 0x62f1,
-  0x5ab0, 0x5ab0, 0x5ad1, 0x5290, 0x5ad0, 0x8374, 0x8276, 0x8ad7,
-  0x8ad7, 0x82b7, 0xad17, 0xd65c, 0xde5c, 0xad37, 0x8bb4, 0x62f1,
-  0x5ad1, 0x5ad1, 0x62f1, 0x6311, 0x8374, 0x8297, 0x9338, 0xef1e,
-  0xef1e, 0x8af7, 0xacf7, 0xd65c, 0xde5c, 0xad37, 0x8bb4, 0x62f1,
-  0x62f1, 0x62f1, 0x8393, 0x7b73, 0x62d2, 0x8ad7, 0xef1e, 0xffff,
-  0xf77e, 0x92f7, 0xacf7, 0xd65c, 0xde5c, 0xad37, 0x8bb4, 0x62f1,
-  0x7b52, 0x8373, 0x62f1, 0x420d, 0x526f, 0x8ad7, 0xef1e, 0xffff,
-  0xf77e, 0x92f7, 0xacf7, 0xde5c, 0xde5c, 0xb537, 0x8bd4, 0x62f1,
-  0x1083, 0x5ab0, 0x5ad1, 0x39ab, 0x1084, 0x7214, 0x9338, 0xf77e,
-  0xf77e, 0x8af7, 0xa4d6, 0xce1b, 0xd61c, 0xacf6, 0x83b3, 0x5ad1,
-  0x0021, 0x4a4e, 0x5ab0, 0x420d, 0x39cc, 0x49ce, 0x82b7, 0xf77e,
-  0xf77e, 0x8ad7, 0x62d2, 0x6b32, 0x8bd4, 0x6b12, 0x5ab0, 0x39cc,
-  0x0021, 0x1063, 0x420d, 0x7b73, 0x8373, 0x7a76, 0x9338, 0xf77e,
-  0xf79e, 0x9338, 0x7a56, 0x5ab1, 0x7b53, 0x5ab0, 0x31ab, 0x0841,
-  0x318a, 0x39cb, 0x7b52, 0x6311, 0x62f2, 0x8ad7, 0xef1e, 0xffff,
-  0xffff, 0xef3e, 0x82b7, 0x4a0e, 0x4a2d, 0x39cc, 0x0862, 0x0000,
-  0x0841, 0x318a, 0x5ad1, 0x62f1, 0x7b53, 0x8ad7, 0xef1e, 0xf77f,
-  0xf77e, 0xef1e, 0x8ad7, 0x8bb4, 0xa4b5, 0x6311, 0x39ab, 0x0862,
-  0x0841, 0x18c4, 0x5ab0, 0x5af1, 0x62d2, 0x7a76, 0x82b7, 0x8296,
-  0x8ad7, 0x8ad7, 0x8af7, 0xd5fc, 0xd65c, 0xad16, 0x83b3, 0x5ab0,
-  0x7331, 0x9453, 0x8393, 0x5ad1, 0x5ab1, 0x5ab1, 0x39ac, 0x1063,
-  0x5270, 0x8373, 0xa4b6, 0xcdfb, 0xce1b, 0xacf6, 0x8393, 0x5ad1,
-  0x1082, 0x420c, 0x39cc, 0x39cb, 0x39cb, 0x39ec, 0x318a, 0x0841,
-  0x318a, 0x420d, 0x62f1, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39ab,
-  0x0021, 0x4a2d, 0x0862, 0x0021, 0x0842, 0x318a, 0x0842, 0x0000,
-  0x0841, 0x39ab, 0x5ad1, 0x8393, 0x8393, 0x5ad1, 0x39ab, 0x0841,
-  0x5ad1, 0x5ad0, 0x420d, 0x5ad1, 0x5ad1, 0x62f1, 0x8393, 0x4a2d,
-  0x41ec, 0x420d, 0x6311, 0x93f5, 0x93f5, 0x6311, 0x420d, 0x41ed,
-  0x5ab0, 0x52b0, 0x39cc, 0x528f, 0x5ad1, 0x62f1, 0x7b93, 0x528f,
-  0x5ab0, 0x7b93, 0xa4b6, 0xc5db, 0xcddb, 0xa4d6, 0x7b93, 0x5ad0,
-  0x420d, 0x39cc, 0x0841, 0x0842, 0x5ab0, 0x8394, 0x5ab0, 0x1084,
-  0x39ac, 0x62d1, 0x6311, 0x6b32, 0x8bd4, 0x6b12, 0x5ad0, 0x39ec,
-  0x5ab1, 0x528f, 0x0842, 0x0842, 0x62d0, 0x8353, 0x59b1, 0x61d1,
-  0x61f1, 0x59b1, 0x5a90, 0x5ad0, 0x7b53, 0x5ab0, 0x31ab, 0x0841,
-  0x5ad1, 0x5ad1, 0x5ad0, 0x6310, 0x9455, 0x61f1, 0x7253, 0xe6fd,
-  0xe6fd, 0x61f2, 0x41ed, 0x420d, 0x4a2e, 0x41ec, 0x0862, 0x0000,
-  0x62d1, 0x6311, 0x9cb5, 0x9cb5, 0x62f1, 0x61f2, 0xe6fd, 0xffff,
-  0xf77e, 0x6a12, 0x5a90, 0x7b93, 0x9c75, 0x5ab0, 0x3169, 0x0020,
-  0x8393, 0x7b93, 0x5ad0, 0x6311, 0x5a90, 0x6212, 0xe6fd, 0xffff,
-  0xef5e, 0x6212, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x62f2, 0x5ab0, 0x18c4, 0x4a6e, 0x39cc, 0x5170, 0x7253, 0xf77e,
-  0xf77e, 0x6a12, 0x5a90, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x528f, 0x526f, 0x39cb, 0x41ec, 0x18a4, 0x398c, 0x61d1, 0xf75e,
-  0xf77e, 0x61f1, 0x41cd, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x0021, 0x0863, 0x420c, 0x7b73, 0x7b32, 0x5990, 0x7273, 0xf77e,
-  0xf77e, 0x7273, 0x5991, 0x8373, 0x9c95, 0x5ab0, 0x2969, 0x0000,
-  0x0021, 0x318a, 0x7b52, 0x6311, 0x62d1, 0x6a12, 0xe6fd, 0xffff,
-  0xffff, 0xe6fd, 0x6a12, 0x6b12, 0x8bd4, 0x4a2d, 0x1083, 0x0841,
-  0x41ec, 0x4a2d, 0x62f1, 0x62f1, 0x7b53, 0x6a12, 0xe6fd, 0xf77e,
-  0xf77e, 0xe6fd, 0x7253, 0xc5bb, 0xd63c, 0xa4f6, 0x7b72, 0x5ab0,
-  0x7b72, 0x9474, 0x8393, 0x62f1, 0x62d1, 0x59b1, 0x61f1, 0x61f1,
-  0x6212, 0x61f1, 0x61f2, 0xc5bb, 0xce1b, 0xad16, 0x83b3, 0x5ad1,
-  0x1062, 0x420c, 0x4a0d, 0x5ab0, 0x5290, 0x5a90, 0x39ac, 0x0842,
-  0x316a, 0x41cd, 0x5ab0, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39cb,
-  0x0021, 0x4a6e, 0x39cc, 0x318a, 0x0863, 0x31aa, 0x318a, 0x0020,
-  0x0821, 0x39cc, 0x62f1, 0x83b4, 0x83b4, 0x62f1, 0x39cc, 0x0841,
-  0x0841, 0x4a4e, 0x0862, 0x0020, 0x0000, 0x0020, 0x0021, 0x0000,
-  0x0021, 0x528f, 0x83b4, 0xacf6, 0xacf6, 0x83b4, 0x528f, 0x0021,
-  0x5ad1, 0x5ad0, 0x41ed, 0x5ab0, 0x5ad1, 0x62f1, 0x8393, 0x420d,
-  0x39cc, 0x420d, 0x5ad1, 0x8393, 0x83b4, 0x5ad1, 0x420d, 0x39cc,
-  0x5ab0, 0x5ab0, 0x420d, 0x5ab0, 0x5ad1, 0x62f1, 0x8393, 0x5ab0,
-  0x39cc, 0x5290, 0x5ad1, 0x62f1, 0x8394, 0x62f1, 0x5290, 0x39cb,
-  0x41ed, 0x39cc, 0x526f, 0x5ad1, 0x62f1, 0x8393, 0x62d1, 0x524f,
-  0x1063, 0x39ac, 0x5ab0, 0x5ad1, 0x7b73, 0x5ab0, 0x31ab, 0x0841,
-  0x528f, 0x0842, 0x0842, 0x528f, 0x6311, 0x7b53, 0x494d, 0x518e,
-  0x496d, 0x410c, 0x41ed, 0x420d, 0x4a2e, 0x41ec, 0x0862, 0x0000,
-  0x528f, 0x0862, 0x1082, 0x62f0, 0x7b73, 0x494d, 0x59ef, 0xe6fc,
-  0xe6fc, 0x518e, 0x5270, 0x7b93, 0x9c75, 0x5ab0, 0x3169, 0x0020,
-  0x6312, 0x6311, 0x9474, 0x9cb5, 0x5ab0, 0x518e, 0xe6fc, 0xffff,
-  0xef7e, 0x518e, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0xc5ba, 0x9c94, 0x6b32, 0x62f1, 0x41ed, 0x496d, 0xe6dc, 0xffff,
-  0xef5d, 0x51ae, 0x5270, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x62f1, 0x20e5, 0x4a4e, 0x5ab0, 0x5270, 0x410c, 0x59ef, 0xef7e,
-  0xef7e, 0x518e, 0x41ed, 0x6311, 0x8bd4, 0x420d, 0x0862, 0x0000,
-  0x526f, 0x318a, 0x1083, 0x41ec, 0x4a2d, 0x398c, 0x494d, 0xef5e,
-  0xef7e, 0x518e, 0x5270, 0x8393, 0x9cb5, 0x5ad0, 0x3169, 0x0020,
-  0x0842, 0x39ab, 0x41ec, 0x7b73, 0x9454, 0x494d, 0x59ef, 0xef7e,
-  0xf77e, 0x59ef, 0x412d, 0x62d1, 0x83d4, 0x420d, 0x0862, 0x0000,
-  0x0000, 0x39cb, 0x7b53, 0x6311, 0x62d1, 0x518e, 0xe6fc, 0xffff,
-  0xffff, 0xe6fc, 0x51ae, 0x83b4, 0xa4f6, 0x6311, 0x39ab, 0x0862,
-  0x0841, 0x39ab, 0x5ad1, 0x62f1, 0x7332, 0x51ae, 0xdedc, 0xef5e,
-  0xef5e, 0xdedc, 0x59cf, 0xcdbb, 0xd65c, 0xad16, 0x83b3, 0x5ab0,
-  0x41ec, 0x4a2d, 0x5ad1, 0x5af1, 0x5ad1, 0x494d, 0x498e, 0x518e,
-  0x518e, 0x496d, 0x518e, 0xc5bb, 0xce1c, 0xacf6, 0x8393, 0x5ad1,
-  0x7b72, 0x9474, 0x7b72, 0x5ad1, 0x5ab0, 0x526f, 0x398b, 0x39ac,
-  0x318b, 0x39ac, 0x5ab0, 0x6b32, 0x6b32, 0x62f1, 0x420d, 0x39cb,
-  0x1082, 0x39eb, 0x1083, 0x39cb, 0x31ab, 0x0842, 0x0841, 0x2969,
-  0x0862, 0x39cc, 0x62f1, 0x83b4, 0x83b4, 0x62f1, 0x39cc, 0x0841,
-  0x0021, 0x4a2d, 0x0862, 0x318a, 0x0842, 0x0000, 0x0000, 0x0020,
-  0x0021, 0x528f, 0x83b4, 0xacf6, 0xacf6, 0x83b4, 0x528f, 0x0021,
-  0x8800, 0xc800, 0xb800, 0x8800, 0xc800, 0xb800, 0x8800, 0xc800,
-  0xc800, 0x8800, 0xb800, 0xd000, 0x9000, 0xb800, 0xc800, 0x8800,
-  0x8800, 0xc800, 0xb800, 0x9000, 0xc800, 0xb800, 0x9000, 0xc800,
-  0xc800, 0x9000, 0xb800, 0xd000, 0x9000, 0xb800, 0xc800, 0x8800,
-  0xa800, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xa800, 0xd000,
-  0xd000, 0xa800, 0xc000, 0xd800, 0xb000, 0xb800, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb8a2, 0xd0a2,
-  0xd0a2, 0xb8a2, 0xc000, 0xd800, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc924, 0xf6ba, 0xff7d,
-  0xff7d, 0xf6ba, 0xc924, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd082, 0xf6ba, 0xffff, 0xff5d,
-  0xff5d, 0xffff, 0xf6ba, 0xd082, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd0a2, 0xff5d, 0xff7d, 0xd924,
-  0xd904, 0xff5d, 0xff7d, 0xd0a2, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd0a2, 0xff5d, 0xff5d, 0xd061,
-  0xd061, 0xff5d, 0xff5d, 0xd0a2, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd0a2, 0xff5d, 0xff5d, 0xd061,
-  0xd061, 0xff5d, 0xff5d, 0xd0a2, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd0a2, 0xff5d, 0xff7d, 0xd924,
-  0xd904, 0xff5d, 0xff7d, 0xd0a2, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xd082, 0xf6ba, 0xffff, 0xff7d,
-  0xff7d, 0xffff, 0xf6ba, 0xd082, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc904, 0xf6ba, 0xff5d,
-  0xff5d, 0xf6ba, 0xc904, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb882, 0xd0a2,
-  0xd0a2, 0xb882, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb000, 0xd000,
-  0xd000, 0xb000, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb000, 0xd000,
-  0xd000, 0xb000, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb000, 0xd000,
-  0xd000, 0xb000, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0x8800, 0xc800, 0xb800, 0x8800, 0xc800, 0xb800, 0x8800, 0xc800,
-  0xc800, 0x8800, 0xb800, 0xc800, 0x8800, 0xb800, 0xc800, 0x8800,
-  0x8800, 0xc800, 0xb800, 0x9000, 0xc800, 0xb800, 0x9000, 0xc800,
-  0xc800, 0x9000, 0xb800, 0xc800, 0x9000, 0xb800, 0xc800, 0x8800,
-  0xa800, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xa800, 0xd000,
-  0xd000, 0xb000, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc000, 0xb8a2, 0xd0a2,
-  0xd0a2, 0xb8a2, 0xc000, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc800, 0xc924, 0xf6ba, 0xff7d,
-  0xff7d, 0xf6ba, 0xc924, 0xd000, 0xb000, 0xc000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xb800, 0xb000, 0xd082, 0xf6ba, 0xffff, 0xf75d,
-  0xf75d, 0xffff, 0xf6ba, 0xd882, 0xb000, 0xb800, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xb000, 0xc800, 0xd8a2, 0xff5d, 0xf77d, 0xb924,
-  0xb904, 0xf75d, 0xff7d, 0xd8a2, 0xd000, 0xb000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xb000, 0xd000, 0xd8a2, 0xff5d, 0xf75d, 0xb082,
-  0xb061, 0xf75d, 0xff5d, 0xd8a2, 0xd800, 0xb000, 0xc800, 0xb000,
-  0xc000, 0xc800, 0xb000, 0xd000, 0xd8a2, 0xff5d, 0xf75d, 0x8061,
-  0x8061, 0xf75d, 0xff5d, 0xd8a2, 0xd800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xd000, 0xd0a2, 0xff5d, 0xef7d, 0x2924,
-  0x2904, 0xef5d, 0xff7d, 0xd0a2, 0xd000, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc082, 0xf6ba, 0xffff, 0xef7d,
-  0xef7d, 0xffff, 0xf6ba, 0xc082, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb904, 0xf6ba, 0xef5d,
-  0xef5d, 0xf6ba, 0xb924, 0xc000, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb000, 0xc082, 0x20a2,
-  0x20a2, 0xc082, 0xb000, 0xc000, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb000, 0xc000, 0x0800,
-  0x0800, 0xb800, 0xb000, 0xc000, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb000, 0xc000, 0x0800,
-  0x0800, 0xb800, 0xb000, 0xc000, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb000, 0xc000, 0x0800,
-  0x0800, 0xb800, 0xb000, 0xc000, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0x9000, 0xc800, 0xc800, 0x9000, 0xc800, 0xb000,
-  0xb000, 0xc800, 0x9000, 0xc800, 0xd800, 0x9000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0x9000, 0xc800, 0xc800, 0x9000, 0xc800, 0xa820,
-  0xa820, 0xc800, 0x9000, 0xc800, 0xd000, 0x9000, 0xc800, 0xc000,
-  0xd000, 0xc800, 0xb000, 0xc800, 0xc000, 0xb000, 0xc000, 0x4145,
-  0x4145, 0xc000, 0xb000, 0xc000, 0xd000, 0xb000, 0xc800, 0xd000,
-  0xd000, 0xc000, 0xb000, 0xc800, 0xb800, 0xb800, 0xc8a2, 0x4a08,
-  0x4a08, 0xc8a2, 0xb800, 0xb800, 0xd000, 0xb000, 0xc000, 0xd000,
-  0xd000, 0xb000, 0xb800, 0xc800, 0xb000, 0xd124, 0xf6ba, 0xef7d,
-  0xef7d, 0xf6ba, 0xd124, 0xb000, 0xc800, 0xb800, 0xb000, 0xd000,
-  0xd000, 0xb000, 0xc000, 0xd000, 0xb882, 0xf6ba, 0xffff, 0xef7d,
-  0xef7d, 0xffff, 0xf6ba, 0xb8a2, 0xc800, 0xc000, 0xb000, 0xd000,
-  0xc800, 0xb000, 0xd000, 0xc800, 0xb0a2, 0xf75d, 0xef9e, 0x4a69,
-  0x4a69, 0xef7d, 0xf77d, 0xb8a2, 0xc800, 0xd000, 0xb000, 0xd000,
-  0xb800, 0xb000, 0xd000, 0xc000, 0xb8a2, 0xf75d, 0xef7d, 0x39e7,
-  0x39e7, 0xef7d, 0xf75d, 0xb8a2, 0xc000, 0xd000, 0xb000, 0xb800,
-  0xb000, 0xc000, 0xd000, 0xc000, 0xd082, 0xff5d, 0xef7d, 0x39e7,
-  0x39e7, 0xef7d, 0xff5d, 0xd0a2, 0xc000, 0xd000, 0xc000, 0xb000,
-  0xb000, 0xd000, 0xd000, 0xc000, 0xc8c3, 0xff5d, 0xef9e, 0x528a,
-  0x4a69, 0xef7d, 0xff7d, 0xc8c3, 0xc000, 0xd000, 0xd000, 0xb000,
-  0xc000, 0xd000, 0xc000, 0xc000, 0x59c7, 0xdefb, 0xffff, 0xef7d,
-  0xef7d, 0xffff, 0xdefb, 0x59c7, 0xc000, 0xc000, 0xd000, 0xc000,
-  0xd000, 0xd000, 0xc000, 0xc020, 0x3965, 0x4a69, 0xdefb, 0xef7d,
-  0xef7d, 0xdefb, 0x4a69, 0x3965, 0xc020, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0xb000, 0xc020, 0x4945, 0x3186, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x3186, 0x4945, 0xc020, 0xb000, 0xc000, 0xd000,
-  0xd000, 0xc000, 0xb000, 0xc800, 0xa041, 0x3965, 0x2986, 0x3186,
-  0x3186, 0x2986, 0x3965, 0xa041, 0xc800, 0xb000, 0xb800, 0xd000,
-  0xd000, 0xc000, 0xb000, 0xc800, 0xa820, 0x3965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3965, 0xa820, 0xd000, 0xb000, 0xb800, 0xd000,
-  0xd000, 0xc000, 0xb000, 0xc800, 0xa820, 0x3965, 0x3186, 0x3186,
-  0x3186, 0x3186, 0x3965, 0xa820, 0xd000, 0xb000, 0xb800, 0xd000,
-  0x8800, 0xc800, 0xb800, 0x8800, 0xc800, 0xb041, 0x838e, 0x7bef,
-  0x7bef, 0x838e, 0xa841, 0xc800, 0x8800, 0xb800, 0xc800, 0x8800,
-  0x8800, 0xc800, 0xb800, 0x9000, 0xc800, 0xb041, 0x838e, 0x7bef,
-  0x7bef, 0x838e, 0xa841, 0xc800, 0x9000, 0xb800, 0xd000, 0x9000,
-  0xa800, 0xc800, 0xc000, 0xb000, 0xc800, 0xa8a2, 0x7b8e, 0x7bef,
-  0x7bef, 0x7b8e, 0xa8a2, 0xc800, 0xb000, 0xc000, 0xd800, 0xb000,
-  0xb000, 0xc800, 0xc000, 0xb000, 0xc841, 0x834d, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x834d, 0xc841, 0xb000, 0xc000, 0xd000, 0xb000,
-  0xb000, 0xc800, 0xb800, 0xb000, 0xc041, 0x9430, 0xe75d, 0xf79e,
-  0xf79e, 0xef5d, 0x9430, 0xc041, 0xb000, 0xb800, 0xd000, 0xb000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xb882, 0xeefb, 0xffff, 0xf79e,
-  0xf79e, 0xffff, 0xeefb, 0xb8a2, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xc000, 0xc800, 0xb000, 0xc800, 0xb0e3, 0xf75d, 0xf7be, 0x8c71,
-  0x8c71, 0xf7be, 0xf75d, 0xb0e3, 0xc800, 0xb000, 0xc800, 0xc000,
-  0xd000, 0xc000, 0xb000, 0xc020, 0x93ae, 0xf79e, 0xf79e, 0x8430,
-  0x8410, 0xf79e, 0xf79e, 0x93ae, 0xc020, 0xb000, 0xc000, 0xd000,
-  0xd000, 0xc000, 0xc800, 0xa882, 0x8bef, 0xf7be, 0xf79e, 0x8430,
-  0x8410, 0xf79e, 0xf7be, 0x8c10, 0xa882, 0xc800, 0xc000, 0xd000,
-  0xd000, 0xc000, 0xa882, 0x834d, 0x8430, 0xf79e, 0xf7be, 0x8c71,
-  0x8c71, 0xf79e, 0xf7be, 0x8451, 0x834d, 0xa882, 0xc000, 0xd000,
-  0xc000, 0xc841, 0x834d, 0x7bef, 0x8430, 0xef5d, 0xffff, 0xf7be,
-  0xf79e, 0xffff, 0xef5d, 0x8430, 0x7bef, 0x834d, 0xc841, 0xc000,
-  0xc000, 0xc841, 0x83ae, 0x7bef, 0x7bef, 0x8c71, 0xe73c, 0xf79e,
-  0xf79e, 0xef5d, 0x8c71, 0x7bef, 0x7bef, 0x83ae, 0xc841, 0xc000,
-  0xb000, 0xc841, 0x838e, 0x7bef, 0x7bef, 0x7bef, 0x8430, 0x8430,
-  0x8430, 0x8430, 0x7bef, 0x7bef, 0x7bef, 0x838e, 0xc841, 0xb000,
-  0xb000, 0xc841, 0x838e, 0x7bef, 0x7bef, 0x7bef, 0x7bcf, 0x7bcf,
-  0x7bcf, 0x7bcf, 0x7bef, 0x7bef, 0x7bef, 0x838e, 0xc841, 0xb000,
-  0xb000, 0xc841, 0x838e, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef,
-  0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x838e, 0xc841, 0xb000,
-  0xb000, 0xc841, 0x838e, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef,
-  0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x7bef, 0x838e, 0xc841, 0xb000,
-  0xb800, 0x9000, 0xc800, 0xb082, 0xc5d7, 0xce79, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce79, 0xc5d7, 0xb082, 0xc800, 0x9000, 0xb800,
-  0xb800, 0x9000, 0xc800, 0xb061, 0xc5d7, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xc5d7, 0xb082, 0xc800, 0x9000, 0xb800,
-  0xb800, 0xb000, 0xc800, 0xb0e3, 0xc5d7, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xc5d7, 0xb104, 0xc800, 0xb000, 0xb800,
-  0xb800, 0xb000, 0xd061, 0xcd75, 0xce59, 0xce59, 0xce79, 0xce79,
-  0xce79, 0xce79, 0xce59, 0xce59, 0xcd75, 0xd082, 0xb000, 0xb800,
-  0xb800, 0xb000, 0xc882, 0xcdd7, 0xce59, 0xce79, 0xf7be, 0xffdf,
-  0xffdf, 0xf7be, 0xce79, 0xce59, 0xcdd7, 0xc882, 0xb000, 0xb800,
-  0xb000, 0xc800, 0xb061, 0xc5b6, 0xce79, 0xf7be, 0xffdf, 0xffdf,
-  0xf7be, 0xffdf, 0xf7be, 0xce79, 0xc5d7, 0xb082, 0xc800, 0xb000,
-  0xb000, 0xc800, 0xb0e3, 0xc5d7, 0xce79, 0xf7be, 0xffdf, 0xd69a,
-  0xce79, 0xf7be, 0xffdf, 0xce79, 0xc5d7, 0xb104, 0xc800, 0xb000,
-  0xb000, 0xc861, 0xcd55, 0xce59, 0xce79, 0xf7be, 0xffdf, 0xce79,
-  0xce59, 0xf7be, 0xffdf, 0xce79, 0xc659, 0xcd75, 0xc861, 0xb000,
-  0xc800, 0xb8e3, 0xc5f7, 0xce59, 0xce79, 0xf7be, 0xffdf, 0xce79,
-  0xce59, 0xf7be, 0xffdf, 0xce79, 0xce59, 0xc5f7, 0xb8e3, 0xc800,
-  0xb104, 0xc555, 0xce59, 0xce59, 0xce79, 0xf7be, 0xffdf, 0xd69a,
-  0xce79, 0xf7be, 0xffdf, 0xce79, 0xce59, 0xce59, 0xc555, 0xb104,
-  0xc5d7, 0xce59, 0xce59, 0xce59, 0xce79, 0xf79e, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xf79e, 0xce79, 0xce59, 0xce59, 0xce59, 0xc5f7,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce79, 0xf79e, 0xf7be,
-  0xf7be, 0xf79e, 0xce79, 0xce59, 0xce59, 0xce59, 0xce59, 0xce79,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce79, 0xce79,
-  0xce79, 0xce79, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59, 0xce59,
-  0xd000, 0xb8a2, 0xf73c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xf75d, 0xb8a2, 0xd000,
-  0xd000, 0xb882, 0xf73c, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf73c, 0xb882, 0xd000,
-  0xd000, 0xb924, 0xf75d, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf75d, 0xb924, 0xd000,
-  0xd082, 0xf69a, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf6ba, 0xd8a2,
-  0xd0a2, 0xf73c, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf73c, 0xd0a2,
-  0xb082, 0xf71c, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf73c, 0xb8a2,
-  0xb945, 0xf73c, 0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xf73c, 0xb945,
-  0xf75d, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xf75d,
-  0xffff, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf
-};
-
-const Animation countdownAnimation = {
-  .name = "Countdown",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = countdownDurations,
-  .animationFrames = countdownFrames
-};
-#endif // ANIMATION_COUNTDOWN_H
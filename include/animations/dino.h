@@ -1,822 +0,0 @@
-// dino.h - Auto-generated from dino.json
-#ifndef ANIMATION_DINO_H
-#define ANIMATION_DINO_H
-
-#include "animation_types.h"
-
-// Frame Durations for dino (in 100ms units)
-static const uint8_t PROGMEM dinoDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for dino
-static const uint16_t PROGMEM dinoFrames[] = {
-  0x9fbf, 0xc79f, 0xffff, 0xffff, 0xffff, 0xffff, 0xc79f, 0x9fbf,
-  0x9fbf, 0x9fbf, 0x49c3, 0x49c3, 0x49c3, 0x49c3, 0xffff, 0xffff,
-  0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0xc79f, 0xffff,
-  0xffff, 0x49c3, 0x1587, 0x18e3, 0x2f2c, 0x2f2c, 0x49c3, 0x9fbf,
-  0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf,
-  0x9fbf, 0x49c3, 0x1587, 0x2f2c, 0x2f2c, 0x2f2c, 0x49c3, 0x9fbf,
-  0xffff, 0xffff, 0xc79f, 0x9fbf, 0x9fbf, 0x7a25, 0xab48, 0x9fbf,
-  0x9fbf, 0x49c3, 0x1587, 0x2f2c, 0x49c3, 0x49c3, 0xc79f, 0xffff,
-  0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x7a25, 0xab48, 0xc3eb, 0xc46d,
-  0x9fbf, 0x49c3, 0x1587, 0x2f2c, 0x49c3, 0x9fbf, 0x9fbf, 0x9fbf,
-  0x9fbf, 0x9fbf, 0x9fbf, 0x9fbf, 0x7a25, 0xab48, 0xab48, 0xc46d,
-  0x9fbf, 0x49c3, 0x1587, 0x2f2c, 0x49c3, 0x9fbf, 0x9fbf, 0x9fbf,
-  0x9fbf, 0x9fbf, 0x9fbf, 0x7a25, 0x7a25, 0x9aa6, 0xab48, 0xc46d,
-  0xc46d, 0x49c3, 0x1587, 0x2f2c, 0x49c3, 0x9fbf, 0x9fbf, 0x7a25,
-  0x9fbf, 0x9fbf, 0x7a25, 0x7a25, 0x9aa6, 0xab48, 0xab48, 0xc3eb,
-  0x49c3, 0x49c3, 0x1587, 0x2f2c, 0x49c3, 0x9fbf, 0x7a25, 0x7a25,
-  0x9fbf, 0xab48, 0x7a25, 0x9aa6, 0x9aa6, 0x49c3, 0x49c3, 0x49c3,
-  0x1587, 0x1587, 0x1587, 0x2f2c, 0x49c3, 0x9fbf, 0x7a25, 0x9aa6,
-  0x9fbf, 0x7a25, 0x49c3, 0x49c3, 0x49c3, 0x1587, 0x1587, 0x1587,
-  0x1587, 0x1587, 0x1587, 0x2f2c, 0x49c3, 0xc3eb, 0x7a25, 0x9aa6,
-  0x7a25, 0x49c3, 0x2f2c, 0x2f2c, 0x2f2c, 0x1587, 0x1587, 0x1587,
-  0xddb1, 0xfeb5, 0xfeb5, 0xfeb5, 0x49c3, 0x7a25, 0x7a25, 0x9aa6,
-  0x7a25, 0x7a25, 0x49c3, 0x49c3, 0x1587, 0x1587, 0x1587, 0x49c3,
-  0xddb1, 0xddb1, 0xddb1, 0x49c3, 0x49c3, 0x7a25, 0x9aa6, 0xab48,
-  0x7a25, 0x9aa6, 0x9aa6, 0xab48, 0x49c3, 0x1587, 0x2f2c, 0x2f2c,
-  0x49c3, 0x2f2c, 0x2f2c, 0x49c3, 0x9aa6, 0x7a25, 0x9aa6, 0xab48,
-  0x7a25, 0x9aa6, 0xab48, 0xab48, 0x92a6, 0x49c3, 0x1587, 0x2f2c,
-  0x49c3, 0x49c3, 0x49c3, 0xab48, 0x9aa6, 0x9aa6, 0x7a25, 0x7a25,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x49c3, 0x49c3,
-  0x49c3, 0x49c3, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df, 0xefdf, 0xc79e,
-  0xa79f, 0xa79f, 0x971d, 0x8f1c, 0x96fc, 0xbf1c, 0xefdf, 0xf7ff,
-  0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xa79f, 0xbf9e,
-  0xefdf, 0xdf1b, 0x5ae8, 0x4a26, 0x4aa6, 0x5308, 0x96db, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x973d, 0x9f5d,
-  0x9f1d, 0x5b08, 0x1c66, 0x2225, 0x2e4a, 0x2e4a, 0x5308, 0x971c,
-  0xefdf, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x96db, 0x8309, 0xa3cb,
-  0x969a, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x2e4a, 0x5308, 0xb6fc,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x973d, 0x8309, 0xa307, 0xbbca,
-  0xb42d, 0x4a45, 0x1547, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x97bf, 0x96bb, 0x8287, 0xa307, 0xb369,
-  0xbbec, 0x4a45, 0x1547, 0x2e8a, 0x4a86, 0x8e9a, 0x979f, 0x97bf,
-  0x979f, 0x979f, 0x979f, 0x96db, 0x7ae8, 0x7a25, 0x9aa6, 0xab49,
-  0xbc0c, 0x4a45, 0x1547, 0x2e8a, 0x4aa6, 0x971d, 0x979f, 0x973d,
-  0x979f, 0x979f, 0x96fb, 0x82e8, 0x7a25, 0x92a6, 0xab28, 0xab49,
-  0xab6a, 0x4a24, 0x1547, 0x2e8a, 0x4aa6, 0x8f1d, 0x973d, 0x8309,
-  0x979f, 0x9f5d, 0xa3ab, 0x8225, 0x9286, 0x9286, 0xa308, 0x9b08,
-  0x5244, 0x4244, 0x1d67, 0x2e8a, 0x4aa6, 0x96db, 0x9efb, 0x7a87,
-  0x979f, 0x96db, 0x7a87, 0x7a04, 0x8a65, 0x5224, 0x4a24, 0x4264,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8a, 0x5285, 0xb42d, 0xb3eb, 0x8245,
-  0x96db, 0x7ae9, 0x4a44, 0x4a44, 0x4a85, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xb38a, 0x8a66, 0x7a25,
-  0x9b49, 0x5244, 0x35ca, 0x364a, 0x2e6a, 0x15a8, 0x0d67, 0x2528,
-  0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0xab69, 0x8245, 0x9286,
-  0x8225, 0x7225, 0x5244, 0x4aa5, 0x1d27, 0x1587, 0x1547, 0x4b06,
-  0xc50f, 0xd5f1, 0xc590, 0x6266, 0x51e4, 0x92a6, 0x8245, 0x9286,
-  0x7245, 0x7a45, 0x8aa6, 0x92e7, 0x4a64, 0x1547, 0x2eeb, 0x364a,
-  0x4ac5, 0x3e8b, 0x3eab, 0x4a44, 0x92e7, 0x92c6, 0x8aa6, 0x7a45,
-  0x4387, 0x4387, 0x4387, 0x4367, 0x4244, 0x1ce7, 0x2eeb, 0x36ab,
-  0x4264, 0x1d07, 0x2e2a, 0x4285, 0x4367, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b46, 0x4284, 0x1d68, 0x2e8b,
-  0x4244, 0x4204, 0x4244, 0x3b66, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df, 0xefdf,
-  0xc79e, 0x8ebb, 0x4a86, 0x41a3, 0x4224, 0x4aa6, 0xb6ba, 0xefdf,
-  0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xa7bf,
-  0xb71c, 0x5308, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5308, 0x9f1c,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x973d,
-  0x96bb, 0x4a65, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x8f1c,
-  0xbf7e, 0xe7bf, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x96db, 0x8b29,
-  0xa349, 0x4a44, 0x1547, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x979f,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x973d, 0x8309, 0xa308,
-  0xb369, 0x4a44, 0x1547, 0x2e8a, 0x4a86, 0x8e9a, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x97bf, 0x96bb, 0x8287, 0xa308,
-  0xa328, 0x4a24, 0x1547, 0x2e8a, 0x4aa6, 0x971d, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x82e8, 0x8225, 0x9ac6,
-  0x9ae7, 0x4a24, 0x1547, 0x2e8a, 0x4aa6, 0x8f1c, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x97bf, 0x96fb, 0x82e8, 0x7a04, 0x8a86, 0x9ae7,
-  0x5244, 0x4244, 0x1d67, 0x2e8a, 0x4aa6, 0x96db, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x96db, 0x9b8b, 0x7a04, 0x4a24, 0x4a24, 0x4a64,
-  0x1ce7, 0x1527, 0x15a7, 0x2e8a, 0x5265, 0xb46f, 0x9f1c, 0x9f5d,
-  0x979f, 0x8edb, 0x5308, 0x4a44, 0x4284, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xbc0c, 0xbc8e, 0xb40c,
-  0x971d, 0x5b29, 0x35c9, 0x364a, 0x2e8a, 0x15a8, 0x1587, 0x2d89,
-  0xbdb0, 0xe653, 0xee93, 0xce52, 0x5a65, 0xb40c, 0xbbcb, 0x8266,
-  0x96db, 0x9349, 0x5244, 0x4a85, 0x1d27, 0x1587, 0x25a8, 0xadcf,
-  0xcdd1, 0xcdf1, 0xbdf1, 0x4e6c, 0x4a65, 0xb3aa, 0xb3aa, 0x8245,
-  0x9308, 0x8245, 0x7a05, 0x8a65, 0x4244, 0x1547, 0x2eeb, 0x3e8c,
-  0x3e8b, 0x3e6b, 0x2548, 0x1ce7, 0x4a44, 0xb389, 0x9ac7, 0x8245,
-  0x9b07, 0x7a45, 0x7a45, 0x8a86, 0x4a24, 0x1547, 0x2e4a, 0x42c5,
-  0x4244, 0x4264, 0x4244, 0x4224, 0x4a04, 0x9b28, 0x92c6, 0x8aa6,
-  0x4387, 0x4387, 0x4387, 0x4367, 0x4244, 0x1c86, 0x42a5, 0x3b46,
-  0x3b67, 0x3b67, 0x3b67, 0x3b67, 0x3b87, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4a04, 0x4224, 0x3b46, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df,
-  0xefdf, 0xb6ba, 0x4a66, 0x41a3, 0x4224, 0x4aa6, 0x8eba, 0xbf9e,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9fbf,
-  0x9f3d, 0x5308, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5308, 0x971c,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f,
-  0x8ebb, 0x4a65, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x971c,
-  0x9f9f, 0xbf9e, 0xe7df, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x96db,
-  0x82e9, 0x4a04, 0x1d47, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x979f,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x973d, 0x8309,
-  0x9ac7, 0x4a24, 0x1547, 0x2e8a, 0x4a86, 0x8e9a, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf, 0x96bb, 0x8287,
-  0x9ae7, 0x4a24, 0x1547, 0x2e8a, 0x4aa6, 0x971d, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x82e8, 0x8225,
-  0x8a66, 0x4a04, 0x1547, 0x2e8a, 0x4aa6, 0x8f1d, 0x97bf, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x97bf, 0x96fb, 0x7ac8, 0x7a04, 0x8265,
-  0x5224, 0x4264, 0x1d67, 0x2e8a, 0x4aa6, 0x96db, 0x9f5e, 0x979f,
-  0x979f, 0x979f, 0x971d, 0x96bb, 0x9b8a, 0x5224, 0x4a04, 0x4264,
-  0x1ce7, 0x1527, 0x15a7, 0x2e8a, 0x5285, 0xb44d, 0xbcd0, 0x9f1c,
-  0x979f, 0x8ebb, 0x5328, 0x4aa6, 0x4a85, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xbbec, 0xc44d, 0xbc8e,
-  0x96db, 0x5b6a, 0x35ca, 0x364a, 0x2e6a, 0x15a8, 0x1587, 0x2d89,
-  0xbdb0, 0xe673, 0xee73, 0xd5d1, 0x5a45, 0xb3aa, 0xc42d, 0xc3eb,
-  0xabec, 0x8e17, 0x52a6, 0x4264, 0x1d07, 0x1587, 0x2588, 0xad4f,
-  0xcd50, 0xd571, 0xc590, 0x5ac6, 0x5204, 0xb3aa, 0xbbeb, 0xbbca,
-  0xab28, 0x9b08, 0x7a25, 0x49c3, 0x3a84, 0x1567, 0x2e8b, 0x5285,
-  0x5a04, 0x5265, 0x3e8b, 0x2e6a, 0x4a44, 0xa328, 0xbbaa, 0x9ac7,
-  0x92c6, 0x9b07, 0x7a45, 0x4a04, 0x1c86, 0x1d47, 0x2e2a, 0x4a44,
-  0x6a04, 0x4224, 0x1d27, 0x2e4a, 0x4a65, 0x9b28, 0xa348, 0x92c6,
-  0x4387, 0x43a7, 0x4367, 0x4224, 0x4244, 0x4244, 0x4265, 0x3b67,
-  0x4387, 0x3b66, 0x4244, 0x4265, 0x3b67, 0x43a7, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3b67, 0x3b67, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xc79e, 0xefdf, 0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df,
-  0xf7df, 0xefdf, 0xbf1c, 0x971c, 0x8efc, 0x971c, 0x9f9f, 0x979f,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x96db, 0x52e8, 0x4a26, 0x4aa6, 0x5308, 0xaeba, 0x9f9f,
-  0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x973d, 0x4ae8, 0x1c66, 0x2225, 0x2e4a, 0x364a, 0x5308, 0x971c,
-  0x979f, 0x9f9f, 0xbf9e, 0xe7df, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f,
-  0x8ebb, 0x4a65, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x971c,
-  0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x973d,
-  0x7ae9, 0x4a04, 0x1d47, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf, 0x96db,
-  0x7a66, 0x4a03, 0x1d67, 0x2e8a, 0x4a86, 0x8ebb, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x82e8,
-  0x7a25, 0x4a24, 0x1d67, 0x2e8a, 0x4aa6, 0x96db, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x96fb, 0x82e9, 0x8225,
-  0x8a65, 0x4a04, 0x1547, 0x2e8b, 0x5265, 0xb46f, 0x9f1c, 0x9f5e,
-  0x9f5d, 0x979f, 0x979f, 0x97bf, 0x9f5d, 0x9bab, 0x7a25, 0x8265,
-  0x5224, 0x4264, 0x1d67, 0x2e8b, 0x5265, 0xbc0c, 0xc48f, 0xbc8f,
-  0xbcd0, 0x9f5d, 0x971d, 0x971d, 0x8eba, 0x5286, 0x4a04, 0x4264,
-  0x1ce7, 0x1527, 0x15a7, 0x2e8b, 0x5265, 0xb3aa, 0xc42d, 0xc44d,
-  0xbc2c, 0x8e79, 0x5328, 0x4aa6, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xb38a, 0xc3eb, 0xc44d,
-  0xb3aa, 0x5ac7, 0x35ca, 0x364a, 0x2e6a, 0x1588, 0x1587, 0x2d89,
-  0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0xa328, 0xbbca, 0xbbeb,
-  0xab28, 0x9ae7, 0x5265, 0x4285, 0x1d27, 0x1587, 0x2588, 0xad4f,
-  0xcdb1, 0xcdf1, 0xc590, 0x6266, 0x51e4, 0xa308, 0xab49, 0xbbca,
-  0x8ac6, 0x92c6, 0x9307, 0x7225, 0x4244, 0x1567, 0x2e6a, 0x52e6,
-  0x3e8b, 0x3f2c, 0x3eab, 0x4284, 0x49e4, 0x9b28, 0xa348, 0xa348,
-  0x4387, 0x4387, 0x43a7, 0x4347, 0x4224, 0x1ce7, 0x1ce7, 0x4264,
-  0x362a, 0x2eab, 0x2eeb, 0x364a, 0x4244, 0x4367, 0x43a7, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4204, 0x4204, 0x4204, 0x49e4,
-  0x4224, 0x4284, 0x1d88, 0x2eab, 0x4264, 0x3b67, 0x3ba7, 0x3ba7,
-  0x9f9f, 0xbf9e, 0xefdf, 0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf,
-  0xf7df, 0xdefb, 0x5286, 0x41a3, 0x4224, 0x4aa6, 0x8ebb, 0x9f9f,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f,
-  0x9f1d, 0x5b08, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5308, 0xb6fc,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x971d, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x971c,
-  0x979f, 0x979f, 0x9f9f, 0xbf9e, 0xe7df, 0xefdf, 0xe7df, 0xbf9f,
-  0x971c, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4a86, 0x8ebb, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x96bb, 0x4a86, 0x1547, 0x2e8a, 0x4aa6, 0x96db, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf, 0x96db,
-  0x7ac8, 0x4a04, 0x1d47, 0x2e8b, 0x5265, 0xb46f, 0x9f1c, 0x979f,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x973d, 0x8ebb, 0x7ac8,
-  0x4a03, 0x4244, 0x1d67, 0x2e8b, 0x5265, 0xbbec, 0xbcd0, 0x9f1c,
-  0xbcd0, 0x9f1c, 0x971d, 0x971d, 0x8ebb, 0x52e8, 0x4a65, 0x4264,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8a, 0x5265, 0xb3aa, 0xc44d, 0xbc8f,
-  0xc44d, 0xac2d, 0x52e7, 0x4aa6, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa328, 0xbbeb, 0xc42d,
-  0xb3aa, 0x62a6, 0x35c9, 0x364a, 0x2e6a, 0x15a8, 0x15a8, 0x25a8,
-  0xb56f, 0xe653, 0xee93, 0xde32, 0x5a45, 0xa308, 0xbbca, 0xbbeb,
-  0xab49, 0xab89, 0x5265, 0x4a85, 0x1d07, 0x15a8, 0x26cb, 0x2e8a,
-  0x5ac6, 0xc570, 0xd5f1, 0xc52f, 0x5a25, 0xa308, 0xab49, 0xbbca,
-  0xab28, 0xab28, 0xa307, 0x8a86, 0x4a64, 0x1ce7, 0x1d67, 0x1ce7,
-  0x4264, 0x3e8b, 0x3eac, 0x5265, 0x51e4, 0xa308, 0xab48, 0xab48,
-  0xa328, 0x92c6, 0x92c6, 0x9b28, 0x7245, 0x4224, 0x4224, 0x4204,
-  0x42a5, 0x2ecb, 0x2e6a, 0x4a64, 0x8286, 0x8ac7, 0xa348, 0xa348,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x3b67, 0x3b46, 0x4244,
-  0x35ea, 0x364a, 0x42c5, 0x3b46, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4204,
-  0x4244, 0x4244, 0x3b46, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf, 0xa79f, 0xbf9e,
-  0xf7df, 0xe6fb, 0x5286, 0x41a3, 0x4224, 0x4aa6, 0x8ebb, 0xa7bf,
-  0xb77e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x9f9f,
-  0x9f1d, 0x5b08, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5b08, 0xdf5d,
-  0x9f9e, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9fbf,
-  0x971c, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x9f1c,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9e, 0xe7df, 0xefdf, 0xefdf,
-  0xb71c, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x52a6, 0x8edb, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9fbf,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x5245, 0xac0d, 0x9f5e, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x5265, 0xb44e, 0x9f1c, 0x979f,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x5265, 0xbc0c, 0xbcd0, 0x9f1c,
-  0xbcd0, 0x9f1c, 0x979f, 0x97bf, 0x979f, 0x971d, 0x971d, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x5265, 0xb3aa, 0xc44d, 0xbc8f,
-  0xc42d, 0xbcd0, 0x96db, 0x971d, 0x8ebb, 0x52e8, 0x4a66, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a65, 0xa328, 0xbbcb, 0xc42d,
-  0xbbcb, 0xb3ec, 0x52c7, 0x4aa6, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa308, 0xab49, 0xbbcb,
-  0xa328, 0x5a85, 0x35c9, 0x2e4a, 0x2e6a, 0x15a8, 0x0d67, 0x2528,
-  0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0xa308, 0xab48, 0xbbca,
-  0xab28, 0x9b08, 0x5265, 0x4aa5, 0x1d27, 0x1587, 0x1547, 0x4b06,
-  0xc50f, 0xcdf1, 0xc5b0, 0x6266, 0x51e4, 0xa308, 0xab48, 0xab48,
-  0xab28, 0xab28, 0xa308, 0x9ae7, 0x5265, 0x1d07, 0x26cb, 0x364b,
-  0x4ac5, 0x3e2b, 0x3e2b, 0x4a24, 0x8a66, 0x92a7, 0xab28, 0xab48,
-  0xa348, 0xa348, 0x92c6, 0x92c6, 0x9307, 0x4284, 0x1d27, 0x2e4a,
-  0x4224, 0x4224, 0x4264, 0x6a45, 0x7a45, 0x8aa6, 0x8ac7, 0xa348,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x43a7, 0x3b66, 0x4244, 0x4244,
-  0x4a04, 0x4204, 0x3b46, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b67, 0x3b67,
-  0x3b67, 0x3b87, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf, 0xa79f,
-  0xbf9e, 0xefdf, 0xef5d, 0xef5d, 0xef3c, 0xbf1c, 0x9f9f, 0xa7bf,
-  0xe7bf, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x9f9f, 0x96db, 0x5ae8, 0x5226, 0x52a6, 0x5b08, 0xb6ba, 0xe7df,
-  0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0xa7bf,
-  0x9f1d, 0x4ae8, 0x1c66, 0x2225, 0x2e4a, 0x364a, 0x5308, 0x9f1c,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9e, 0xe7df, 0xefdf,
-  0xdf5d, 0x5286, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x52c7, 0x8f1c,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0xa7bf,
-  0x9f1d, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x5245, 0xac4d, 0x9f5d,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x4a44, 0x9ae8, 0xbc8e, 0x9f1c,
-  0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x4a64, 0xa328, 0xc44d, 0xbc8f,
-  0xc42d, 0xbcb0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x4a65, 0xa308, 0xbbcb, 0xc42d,
-  0xbbcb, 0xc42d, 0xbcd0, 0x9f1c, 0x979f, 0x971d, 0x971d, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a65, 0xa308, 0xab49, 0xbbca,
-  0xab49, 0xbbcb, 0xbc0c, 0xb48f, 0x8e79, 0x4ae8, 0x4a66, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a65, 0xa308, 0xab48, 0xab48,
-  0xab28, 0x9b08, 0x5285, 0x5265, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa308, 0xab48, 0xab48,
-  0xa308, 0x5a65, 0x35ca, 0x2e4a, 0x2e6a, 0x15a8, 0x0d67, 0x2528,
-  0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0x8aa6, 0xab28, 0xab48,
-  0xab28, 0x9b08, 0x5265, 0x4a85, 0x1d27, 0x1587, 0x1547, 0x4b06,
-  0xc50f, 0xd5f1, 0xc590, 0x6266, 0x51e4, 0x8a86, 0x9aa7, 0xab28,
-  0xa348, 0xa348, 0x9b08, 0x8286, 0x4244, 0x1547, 0x2eeb, 0x364a,
-  0x4ac5, 0x3e8b, 0x3eab, 0x4a24, 0x7225, 0x7a45, 0x8aa6, 0x8ac7,
-  0x4387, 0x4387, 0x43a7, 0x4367, 0x4244, 0x1ce7, 0x2eeb, 0x36ab,
-  0x4264, 0x1d07, 0x2e2a, 0x4285, 0x4346, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b46, 0x4284, 0x1d68, 0x2e8b,
-  0x4244, 0x4204, 0x4244, 0x3b66, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xa79f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf,
-  0xa79f, 0xaeba, 0x4a86, 0x41a3, 0x4224, 0x52a6, 0xaeba, 0x9f9f,
-  0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x971d, 0x5308, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5b28, 0xb6fc,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9fbf,
-  0x9f1d, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x52c6, 0x971c,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9e, 0xefdf,
-  0xdf5d, 0x5286, 0x1547, 0x2eab, 0x42a5, 0x5244, 0x9b6a, 0x9efb,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9fbf,
-  0x9f1d, 0x4a86, 0x1547, 0x2e8b, 0x4a44, 0x9ae7, 0xbbcb, 0xbc8e,
-  0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x4a65, 0xa308, 0xab69, 0xc42d,
-  0xbc8e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x4a44, 0x92a6, 0xab49, 0xc42d,
-  0xc42d, 0xc44d, 0xbcd0, 0x9f1c, 0x979f, 0x971d, 0x971d, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a65, 0xa307, 0xab48, 0xbbca,
-  0xbbcb, 0xbbcb, 0xbbec, 0xb48f, 0x8e79, 0x4ae8, 0x4a66, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a65, 0xa308, 0xab48, 0xab48,
-  0xab48, 0x9b28, 0x5285, 0x5265, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa308, 0xab48, 0xab48,
-  0xa308, 0x5a65, 0x35ca, 0x2e4a, 0x2e6a, 0x1588, 0x1587, 0x2d89,
-  0xbdb0, 0xe653, 0xee93, 0xce52, 0x5a45, 0x9b08, 0xab28, 0xab48,
-  0xab28, 0x9b08, 0x5265, 0x4aa5, 0x1d27, 0x1587, 0x25a8, 0xadcf,
-  0xcdd1, 0xcdf1, 0xbdf1, 0x4e6c, 0x4a44, 0x8a86, 0x9ac7, 0xa328,
-  0x9aa7, 0xab28, 0xa308, 0x9ae7, 0x4a64, 0x1547, 0x2eeb, 0x3e8c,
-  0x3e8b, 0x3e6b, 0x2548, 0x1ce7, 0x4a24, 0x8a66, 0x9286, 0x92a7,
-  0x8ac7, 0x9b28, 0xa348, 0x9b28, 0x4a24, 0x1547, 0x2e4a, 0x42c5,
-  0x4244, 0x4264, 0x4244, 0x4224, 0x4a04, 0x7245, 0x7a45, 0x8aa6,
-  0x4387, 0x4387, 0x43a7, 0x4367, 0x4244, 0x1c86, 0x42a5, 0x3b46,
-  0x3b67, 0x3b67, 0x3b67, 0x3b67, 0x3b87, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4a04, 0x4224, 0x3b46, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x9f9f, 0xa79f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df,
-  0xefdf, 0x96db, 0x4a86, 0x41a3, 0x4224, 0x52a6, 0xdefb, 0xc79f,
-  0xbf7e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f1d, 0x5308, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5b28, 0x971d,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0x9f1d, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x4aa6, 0x96ba,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9f,
-  0xdf5d, 0x5286, 0x1547, 0x2eab, 0x42a5, 0x4a24, 0x7a45, 0xab8a,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0x9f1d, 0x4a86, 0x1547, 0x2e8b, 0x4a24, 0x7a05, 0xa328, 0xbbaa,
-  0x973d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x4a44, 0x7a25, 0xa328, 0xab48,
-  0xabab, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x4a44, 0x7a25, 0x9ac6, 0xab28,
-  0xbbaa, 0xc42d, 0xc44d, 0xbcd0, 0x9f1c, 0x971d, 0x971d, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a44, 0x8a86, 0xab28, 0xab48,
-  0xab49, 0xbbca, 0xb3aa, 0xbc0c, 0xac2d, 0x52a6, 0x4a86, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a44, 0x9286, 0xab28, 0xab48,
-  0xab28, 0x9b08, 0x5285, 0x5265, 0x4aa5, 0x1ce6, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa308, 0xab48, 0xab48,
-  0xa308, 0x5a65, 0x35ca, 0x364a, 0x2e6a, 0x15a8, 0x15a7, 0x2d89,
-  0xbdb0, 0xe673, 0xee73, 0xd5d1, 0x5a45, 0xa308, 0xab28, 0xab28,
-  0xab28, 0x9b07, 0x5265, 0x4284, 0x1d07, 0x15a8, 0x36ab, 0xb56f,
-  0xcd50, 0xd571, 0xc590, 0x5ac6, 0x51e4, 0xa308, 0x9ac7, 0x92a7,
-  0x92a7, 0x9aa7, 0x9ae7, 0x51e4, 0x3a84, 0x1567, 0x2eab, 0x5285,
-  0x59e4, 0x5265, 0x3e8b, 0x2e6a, 0x4a44, 0xa2e7, 0x92a6, 0x9286,
-  0x8aa6, 0x8ac7, 0x9b08, 0x4a24, 0x1c86, 0x1d47, 0x2e2a, 0x4a44,
-  0x6a04, 0x4224, 0x1d27, 0x2e4a, 0x4a65, 0x82a6, 0x7a65, 0x7a45,
-  0x4387, 0x4387, 0x4367, 0x4224, 0x4244, 0x4244, 0x4265, 0x3b67,
-  0x4387, 0x3b66, 0x4244, 0x4265, 0x3b67, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3b67, 0x3b67, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xbf9e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf,
-  0xf7df, 0xefdf, 0x9f1c, 0xbf1c, 0xef3c, 0xef5d, 0xf7df, 0xf7ff,
-  0x9f9e, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x96db, 0x52e8, 0x5225, 0x52a6, 0x5b28, 0x96db, 0x9fbf,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4ae8, 0x1c66, 0x2225, 0x2e4a, 0x2e4a, 0x5308, 0x8e9a,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0xb71c, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x4a44, 0x7a87,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971c, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x5286, 0x7a45, 0xa307,
-  0x971c, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4aa6, 0x85d7, 0x82a7, 0xa307,
-  0x7a87, 0x82c8, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8b, 0x4a44, 0x7a67, 0x8245, 0x92a6,
-  0x7a25, 0x92a6, 0xbc2c, 0xc44d, 0xbcd0, 0x9f1c, 0x97bf, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x4a44, 0x7a04, 0x92a6, 0xab28,
-  0x92a6, 0xab28, 0xbbcb, 0xbbeb, 0xc42d, 0xb48f, 0x96db, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a44, 0x8a86, 0x9ac6, 0xab28,
-  0x92a7, 0xab28, 0xa308, 0xa328, 0xab69, 0x5265, 0x4a66, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a44, 0x9286, 0xab28, 0xab48,
-  0x92c7, 0x9b07, 0x5285, 0x4a64, 0x4aa5, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x4a44, 0x9286, 0xab28, 0xab28,
-  0xa308, 0x5a65, 0x35ca, 0x2e4a, 0x2e6a, 0x15a8, 0x15a7, 0x2d89,
-  0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0x9b08, 0xab28, 0x92c7,
-  0xa308, 0x8a86, 0x5244, 0x4aa5, 0x1d07, 0x15a8, 0x36ab, 0xb58f,
-  0xcdb1, 0xcdf1, 0xc590, 0x6266, 0x51e4, 0xa328, 0xab28, 0x92a6,
-  0x7a65, 0x8aa6, 0x8aa6, 0x92e7, 0x4264, 0x1567, 0x2eab, 0x52e6,
-  0x3e8b, 0x3f2c, 0x3eab, 0x4284, 0x51e4, 0x9b08, 0x8ac7, 0x7a65,
-  0x4387, 0x4387, 0x4387, 0x4367, 0x4224, 0x1d07, 0x2e0a, 0x4285,
-  0x362a, 0x2eab, 0x2eeb, 0x364a, 0x4244, 0x4367, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x41e4, 0x4204, 0x4224, 0x49e4,
-  0x4224, 0x4284, 0x1d88, 0x2eab, 0x4264, 0x3b67, 0x3ba7, 0x3ba7,
-  0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e,
-  0xf7df, 0xe6fb, 0x5286, 0x41a3, 0x4224, 0x52a6, 0xdefb, 0xf7df,
-  0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f,
-  0x9f1d, 0x5b08, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5b08, 0x9f1c,
-  0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x8f1d,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x973d,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4a86, 0x8ebb, 0x973d, 0x8309,
-  0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f,
-  0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4aa6, 0x973d, 0x96db, 0x7a87,
-  0x96bb, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x97bf, 0x97bf,
-  0x8e9b, 0x4a66, 0x1547, 0x2e8a, 0x4ac6, 0x8e59, 0x82e9, 0x7a25,
-  0x7a87, 0x7a25, 0x92a7, 0xc42c, 0xc44d, 0xb48f, 0x96db, 0x8ebb,
-  0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a44, 0x7a66, 0x8225, 0x9286,
-  0x7a25, 0x9286, 0xa308, 0xb38a, 0xab8a, 0x5265, 0x4a66, 0x42c6,
-  0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a44, 0x7a04, 0x9286, 0x9aa6,
-  0x7a25, 0x8286, 0x5265, 0x4a65, 0x4aa5, 0x1ce7, 0x1527, 0x1527,
-  0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x4a44, 0x7a25, 0x92a6, 0xab28,
-  0x7a25, 0x5245, 0x35ea, 0x2e4a, 0x2e6a, 0x15a8, 0x15a8, 0x25a8,
-  0xb56f, 0xe653, 0xee93, 0xde32, 0x5a45, 0x8a85, 0x9ac6, 0xab28,
-  0x92a6, 0x9b07, 0x5265, 0x4285, 0x1d07, 0x15a8, 0x26cb, 0x2e8a,
-  0x5ac6, 0xc570, 0xd5f1, 0xc52f, 0x5a25, 0x8a86, 0xab28, 0xab48,
-  0x92a6, 0xa308, 0x9286, 0x8a66, 0x4a64, 0x1ce7, 0x1d67, 0x1ce7,
-  0x4264, 0x3e8b, 0x3eac, 0x5265, 0x51e4, 0x92a6, 0xab28, 0xab28,
-  0x7a45, 0x7a65, 0x8aa6, 0x8ac7, 0x9307, 0x4a44, 0x4224, 0x4204,
-  0x42a5, 0x2ecb, 0x2e6a, 0x4a44, 0x8286, 0x9b28, 0xa328, 0x8ac7,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x3b87, 0x3b46, 0x4244,
-  0x35ea, 0x364a, 0x42c5, 0x3b46, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4204,
-  0x4244, 0x4244, 0x3b46, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f,
-  0xc79e, 0xefdf, 0xf7df, 0xdefb, 0x5286, 0x41a3, 0x4244, 0x4244,
-  0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f1d, 0x5b08, 0x1c86, 0x2245, 0x2e2a, 0x36cb,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x979f, 0x979f, 0x8f1d, 0x4a86, 0x1527, 0x2e8b, 0x2eab, 0x2eab,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x971d, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x4a86,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4aa6, 0x8e9a,
-  0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x971d, 0x4a86, 0x1547, 0x2e8a, 0x4aa6, 0x8ebb,
-  0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f,
-  0x97bf, 0x97bf, 0x8e9b, 0x4a66, 0x1547, 0x2e8b, 0x4a44, 0x7a66,
-  0x973d, 0x8309, 0x7a25, 0x92a6, 0xc42c, 0xc44d, 0xbcd0, 0x96db,
-  0x971d, 0x8ebb, 0x52c8, 0x4244, 0x1d67, 0x2e8b, 0x4a44, 0x7a04,
-  0x96db, 0x82a7, 0x9286, 0xab28, 0xb38a, 0xb3aa, 0xb3eb, 0x52a6,
-  0x4a86, 0x42c6, 0x1ce6, 0x1527, 0x15a7, 0x2e8b, 0x4a44, 0x8a66,
-  0xa349, 0x8245, 0x92a6, 0x9b07, 0x5285, 0x4a65, 0x4aa5, 0x1ce6,
-  0x1527, 0x1527, 0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x4a64, 0x9286,
-  0x8225, 0x8245, 0x8a86, 0x5a65, 0x35ea, 0x2e4a, 0x2e6a, 0x15a8,
-  0x1587, 0x2528, 0xbdb0, 0xe673, 0xee73, 0xd5f1, 0x5a45, 0x8a86,
-  0x7a25, 0x92a6, 0xab28, 0x9b07, 0x5265, 0x4aa5, 0x1d07, 0x15a8,
-  0x2e8a, 0x4b26, 0xc50f, 0xcdf1, 0xc5b0, 0x6266, 0x51e4, 0xa308,
-  0x8225, 0x92a6, 0xa308, 0x9aa7, 0x9286, 0x9ae7, 0x5265, 0x1d07,
-  0x2eeb, 0x364b, 0x4ac5, 0x3e2b, 0x3e2b, 0x5244, 0x9286, 0xab28,
-  0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x8ac7, 0xa328, 0x9307, 0x4284,
-  0x1d27, 0x2e2a, 0x4224, 0x4224, 0x4a64, 0x82a6, 0xa328, 0xa348,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x43a7, 0x3b66,
-  0x4244, 0x4244, 0x4a04, 0x4204, 0x3b46, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3b67, 0x3b67, 0x3b67, 0x3b87, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f,
-  0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf, 0xa79f, 0xbf1c, 0xef5d,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x8edb, 0x52e8, 0x5225,
-  0x9f9e, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x971d, 0x52e8, 0x1c86, 0x19c4,
-  0xbf7e, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0xb71c, 0x4a86, 0x1527, 0x2e8b,
-  0x9f9e, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x971c, 0x4a86, 0x1d47, 0x2f0b,
-  0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x971d, 0x4a86, 0x1d47, 0x2f0b,
-  0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x971d, 0x4a86, 0x1d47, 0x2f0b,
-  0x97bf, 0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc2c, 0xc44d, 0xbcd0,
-  0x9f1c, 0x979f, 0x97bf, 0x97bf, 0x8e9b, 0x4a66, 0x1d47, 0x2f0b,
-  0x9f5d, 0x96fb, 0x8287, 0x9286, 0xab28, 0xbbca, 0xbbeb, 0xc42d,
-  0xbcd0, 0x96db, 0x971d, 0x8ebb, 0x52c8, 0x4244, 0x1d47, 0x2f0b,
-  0xbc8e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab48, 0xa328, 0xb3aa,
-  0xb3ec, 0x52a6, 0x4a86, 0x42c6, 0x1ce6, 0x1527, 0x1587, 0x2eeb,
-  0xbbaa, 0x8266, 0x7a25, 0x92a7, 0xab28, 0x9b08, 0x5265, 0x4a65,
-  0x4aa5, 0x1ce6, 0x1527, 0x1527, 0x2588, 0x2588, 0x2da9, 0x3f0c,
-  0xb38a, 0x8245, 0x9286, 0xab28, 0xa308, 0x5a65, 0x35ca, 0x2e4a,
-  0x2e6a, 0x15a8, 0x1587, 0x2528, 0xbdb0, 0xe673, 0xe673, 0xde52,
-  0x92a7, 0x8245, 0x92a6, 0xa308, 0x92a7, 0x8a86, 0x5265, 0x4aa5,
-  0x1d07, 0x15a8, 0x2e6a, 0x4b26, 0xc50f, 0xd5f1, 0xc590, 0x6286,
-  0x8aa6, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x8ac7, 0x9b08, 0x9307,
-  0x4264, 0x1547, 0x2f0b, 0x364b, 0x4ac5, 0x3e8b, 0x3eab, 0x4224,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x43a7, 0x4367,
-  0x4244, 0x1ce7, 0x2eeb, 0x36ab, 0x4264, 0x1d07, 0x2e2a, 0x4264,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3b46, 0x4284, 0x1d68, 0x2e8b, 0x4244, 0x4204, 0x4264, 0x3b66,
-  0xf7df, 0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f,
-  0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf, 0xa79e, 0xb71c,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df,
-  0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x8f1c, 0x5ac8,
-  0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x971c, 0x5246,
-  0xe7bf, 0xbf9e, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9f, 0xdf3c, 0x5a46,
-  0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x971c, 0x5246,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x8f1c, 0x5246,
-  0x979f, 0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0,
-  0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf, 0x8e9a, 0x5226,
-  0x9f5d, 0x979f, 0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc2c, 0xc44d,
-  0xbcd0, 0x9f1c, 0x979f, 0x971d, 0x971d, 0x8ebb, 0x52e7, 0x4204,
-  0xbcd0, 0x9f1c, 0x96fb, 0x8287, 0x9286, 0xab28, 0xbbca, 0xbbcb,
-  0xbbec, 0xb48f, 0x8e79, 0x4ae8, 0x4a66, 0x42c6, 0x1ce6, 0x1527,
-  0xc44d, 0xbc6e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab48, 0x9b08,
-  0x5285, 0x5265, 0x4ae6, 0x1ce7, 0x1527, 0x1527, 0x2588, 0x25a8,
-  0xc44d, 0xbbcb, 0x8265, 0x7a25, 0x92a7, 0xab28, 0xa308, 0x5a65,
-  0x35ca, 0x2e4a, 0x2e6a, 0x1588, 0x1587, 0x2d89, 0xbdb0, 0xee73,
-  0xbbeb, 0xb3aa, 0x8245, 0x9286, 0xa328, 0xab28, 0xab28, 0x9b08,
-  0x5265, 0x4aa5, 0x1d27, 0x1587, 0x25a8, 0xadcf, 0xcdd1, 0xcdf1,
-  0xbbaa, 0x9ac7, 0x8245, 0x92a6, 0xa308, 0x92a7, 0x92a7, 0xab28,
-  0xa308, 0x9ae7, 0x4a64, 0x1547, 0x2eeb, 0x3e8c, 0x3e8b, 0x3e8b,
-  0xa348, 0x8ac7, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x8ac7, 0xa328,
-  0xa348, 0x9b28, 0x4a24, 0x1547, 0x2e4a, 0x42c5, 0x4244, 0x4264,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x43a7, 0x4367, 0x4244, 0x1c86, 0x42a5, 0x3b46, 0x3b67, 0x3b67,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3b87, 0x4a04, 0x4224, 0x3b46, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xc79e, 0xefdf, 0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f,
-  0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xefdf, 0x9fbf,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df,
-  0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f,
-  0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9e, 0xe7df,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e,
-  0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x9f5d, 0x9f5d, 0x979f, 0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc2c,
-  0xc44d, 0xbcd0, 0x9f1c, 0x97bf, 0x979f, 0x971d, 0x971c, 0x971c,
-  0xbc8e, 0xbcd0, 0x9f1c, 0x96fb, 0x8287, 0x9286, 0xab28, 0xbbca,
-  0xbbeb, 0xc42d, 0xb48f, 0x96db, 0x8ebb, 0x52e8, 0x4a86, 0x4a86,
-  0xc42d, 0xc44d, 0xbc6e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab48,
-  0xab49, 0xab8a, 0x5a85, 0x4aa6, 0x4ae6, 0x1ce7, 0x1527, 0x1527,
-  0xbbeb, 0xc42d, 0xbbcb, 0x8265, 0x7a25, 0x92a7, 0xab28, 0xab48,
-  0xa308, 0x5a85, 0x35ca, 0x364a, 0x2e6a, 0x1588, 0x1587, 0x2588,
-  0xbbca, 0xbbeb, 0xb3aa, 0x8245, 0x9286, 0xa328, 0xab28, 0xab28,
-  0xab48, 0x9b08, 0x5265, 0x4284, 0x1d07, 0x1587, 0x25a8, 0xadcf,
-  0xab49, 0xbbaa, 0x9ac7, 0x8245, 0x92a6, 0xa308, 0x92a7, 0x92a7,
-  0xab28, 0xab48, 0x9ae7, 0x51e4, 0x3a84, 0x1547, 0x2e8a, 0x3e8b,
-  0xa348, 0xa348, 0x8ac7, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x8ac7,
-  0xa328, 0xa348, 0x9b28, 0x4a24, 0x1ca6, 0x1ce7, 0x4264, 0x4244,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x43a7, 0x4367, 0x4224, 0x4244, 0x4224, 0x4204, 0x3b46,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3b67, 0x3b87, 0x3ba7,
-  0x9f9f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f,
-  0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xf7ff,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e,
-  0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0xefdf, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0xbf9e,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x973d, 0x971d,
-  0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7,
-  0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbcd0, 0x9f1c, 0x9f5e, 0x979f, 0x973d, 0x82e9, 0x7a25, 0x92a6,
-  0xbc2c, 0xc44d, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0xc44d, 0xbc8e, 0xbcd0, 0x9f1c, 0x96fb, 0x8287, 0x9286, 0xab28,
-  0xbbca, 0xbbcb, 0xc42d, 0xbcd0, 0x9f1c, 0x97bf, 0x979f, 0x971d,
-  0xbbeb, 0xc42d, 0xc44d, 0xbc6e, 0xb3eb, 0x8245, 0x92a6, 0xab28,
-  0xab48, 0xab49, 0xbbcb, 0xc42d, 0xb48f, 0x96db, 0x8eba, 0x52e8,
-  0xbbca, 0xbbeb, 0xc42d, 0xbbcb, 0x8265, 0x7a25, 0x92a7, 0xab28,
-  0xab28, 0xab28, 0xab49, 0xab8a, 0x5a85, 0x4aa6, 0x4ae6, 0x1ce7,
-  0xab49, 0xbbca, 0xbbeb, 0xb3aa, 0x8245, 0x9286, 0xa328, 0xab28,
-  0xab28, 0xab48, 0xa308, 0x5a85, 0x35ca, 0x364a, 0x2e6a, 0x15a8,
-  0xab28, 0xab49, 0xbbaa, 0x9ac7, 0x8245, 0x92a6, 0xa308, 0x92a7,
-  0x92a7, 0xab28, 0xab48, 0x9b08, 0x5265, 0x4a85, 0x1d27, 0x1587,
-  0xa348, 0xa348, 0xa348, 0x8ac7, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6,
-  0x8ac7, 0xa328, 0xa348, 0xa348, 0x8aa6, 0x8286, 0x4264, 0x1527,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4367, 0x4224, 0x1cc7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4204, 0x4204,
-  0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df, 0xefdf, 0xc79e,
-  0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7ff,
-  0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9e, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbf7e, 0xe7bf, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x973d,
-  0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x96db, 0x7ae9,
-  0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xc42d, 0xbcd0, 0x9f1c, 0x9f5e, 0x979f, 0x973d, 0x82e9, 0x7a25,
-  0x92a6, 0xbc2c, 0xc44d, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x97bf,
-  0xbbeb, 0xc42d, 0xbc8e, 0xbcd0, 0x9f1c, 0x96fb, 0x8287, 0x9286,
-  0xab28, 0xbbca, 0xbbcb, 0xc42d, 0xbcd0, 0x9f1c, 0x971d, 0x971c,
-  0xbbcb, 0xbbeb, 0xc42d, 0xc44d, 0xbc6e, 0xb3eb, 0x8245, 0x92a6,
-  0xab28, 0xab48, 0xab49, 0xbbcb, 0xc44d, 0xac2d, 0x52e7, 0x4ac6,
-  0xbbca, 0xbbca, 0xbbeb, 0xc42d, 0xbbcb, 0x8265, 0x7a25, 0x92a7,
-  0xab28, 0xab28, 0xab28, 0xab49, 0xb38a, 0x6286, 0x35c9, 0x2e4a,
-  0xab48, 0xab49, 0xbbca, 0xbbeb, 0xb3aa, 0x8245, 0x9286, 0xa328,
-  0xab28, 0xab28, 0xab28, 0xab28, 0xab49, 0xab89, 0x5285, 0x4a44,
-  0xab28, 0xab28, 0xab49, 0xbbaa, 0x9ac7, 0x8245, 0x92a6, 0xa308,
-  0x92a7, 0x92a7, 0xab28, 0xab28, 0xab28, 0xab28, 0xa307, 0x9286,
-  0x92c6, 0xa328, 0xa348, 0xa348, 0x8ac7, 0x8aa6, 0x7a45, 0x7a65,
-  0x8aa6, 0x8ac7, 0xa328, 0xa348, 0xa328, 0x92c6, 0x92c6, 0x9b28,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df, 0xefdf,
-  0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf,
-  0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f,
-  0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f,
-  0x9f5d, 0xbf7e, 0xe7df, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbcd0, 0x9f5d, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbc8e, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xc44d, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x96db,
-  0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f,
-  0xbbeb, 0xc42d, 0xbcd0, 0x9f1c, 0x9f5e, 0x979f, 0x973d, 0x82e9,
-  0x7a25, 0x92a6, 0xbc2c, 0xc44d, 0xbcd0, 0x9f1c, 0x979f, 0x979f,
-  0xbbca, 0xbbeb, 0xc44d, 0xbc8e, 0xbcd0, 0x9f1c, 0x96fb, 0x8287,
-  0x9286, 0xab28, 0xbbca, 0xbbcb, 0xc42d, 0xbcd0, 0x9f1c, 0x97bf,
-  0xab49, 0xbbca, 0xbbeb, 0xc42d, 0xc44d, 0xbc6e, 0xb3eb, 0x8245,
-  0x92a6, 0xab28, 0xab48, 0xab49, 0xbbcb, 0xc42d, 0xbcaf, 0x96db,
-  0xab28, 0xab49, 0xbbca, 0xbbeb, 0xc42d, 0xbbcb, 0x8265, 0x7a25,
-  0x92a7, 0xab28, 0xab28, 0xab28, 0xab49, 0xbbcb, 0xb3ca, 0x6286,
-  0xab28, 0xab28, 0xab49, 0xbbca, 0xbbeb, 0xb3aa, 0x8245, 0x9286,
-  0xa328, 0xab28, 0xab28, 0xab28, 0xab28, 0xab49, 0xbbaa, 0xa328,
-  0x9aa6, 0xab28, 0xab28, 0xab49, 0xbbaa, 0x9ac7, 0x8245, 0x92a6,
-  0xa308, 0x92a7, 0x92a7, 0xab28, 0xab28, 0xab28, 0xab28, 0xab28,
-  0x8aa6, 0x92c6, 0xa328, 0xa348, 0xa348, 0x8ac6, 0x8aa6, 0x7a45,
-  0x7a65, 0x8aa6, 0x8ac7, 0xa328, 0xa348, 0xa328, 0x92c6, 0x92c6,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xf7df, 0xf7df, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df, 0xf7df,
-  0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x9f9f, 0xbf9e,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f,
-  0x973d, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x979f,
-  0xabec, 0x9efb, 0xbf9e, 0xe7df, 0xefdf, 0xe7df, 0xbf9e, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xbbaa, 0xbcaf, 0x9f5d, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0xab49, 0xbc6e, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f, 0x979f,
-  0xab49, 0xc42d, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f, 0x979f,
-  0xab48, 0xbbcb, 0xc42d, 0xbcd0, 0x9f1c, 0x9f5e, 0x979f, 0x973d,
-  0x82e9, 0x7a25, 0x92a6, 0xbc0c, 0xc42d, 0xbcaf, 0x9f1c, 0x979f,
-  0xab28, 0xab49, 0xbbcb, 0xc42d, 0xbc8e, 0xbcd0, 0x9f1c, 0x96fb,
-  0x8287, 0x9286, 0xa328, 0xab49, 0xbbca, 0xbbeb, 0xbcd0, 0x9f1c,
-  0xab28, 0xab28, 0xab49, 0xbbeb, 0xc42d, 0xc44d, 0xbc6e, 0xb3eb,
-  0x8245, 0x92a6, 0xab28, 0xab28, 0xab48, 0xbbca, 0xc42d, 0xbc8e,
-  0xab28, 0xab28, 0xab48, 0xbbca, 0xbbeb, 0xc42d, 0xbbcb, 0x8265,
-  0x7a25, 0x92a6, 0xab28, 0xab28, 0xab28, 0xab49, 0xbbca, 0xbbeb,
-  0x92c7, 0xa328, 0xab48, 0xab49, 0xbbca, 0xbbeb, 0xb3aa, 0x8245,
-  0x9286, 0xa328, 0xab28, 0xab28, 0xab28, 0xab28, 0xab49, 0xbbca,
-  0x9286, 0x92a7, 0xab28, 0xab28, 0xab49, 0xbbaa, 0x9ac7, 0x8245,
-  0x92a6, 0xa308, 0x92a7, 0x92a7, 0xab28, 0xab28, 0xab28, 0xab48,
-  0x7a45, 0x8aa6, 0x8ac7, 0xa328, 0xa348, 0xa348, 0x92c6, 0x8aa6,
-  0x7a45, 0x7a65, 0x8aa6, 0x8ac6, 0xa328, 0xa348, 0xa328, 0x92c6,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xbf1c, 0xe73c, 0xef5d, 0xefdf, 0xa79f, 0xbf9e, 0xefdf, 0xf7df,
-  0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f, 0x979f,
-  0x5226, 0x52a6, 0x5b28, 0x96db, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xbf9e, 0x9f9f,
-  0x21e4, 0x2e4a, 0x2e4a, 0x52e8, 0x9f1c, 0xa7bf, 0x9f9f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0x979f,
-  0x2eab, 0x2ecb, 0x2e4a, 0x5b08, 0xdf5d, 0xefdf, 0xe7df, 0xbf9e,
-  0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x36ab, 0x42a4, 0x52a7, 0x8edb, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x2e8b, 0x5265, 0xac0d, 0x9f1c, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f, 0x979f,
-  0x2e8b, 0x5285, 0xbc0c, 0xbcd0, 0x9f1c, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c, 0x979f,
-  0x2eab, 0x4a65, 0xb3aa, 0xc42d, 0xbcd0, 0x9f1c, 0x9f5e, 0x979f,
-  0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc0c, 0xc42d, 0xbcb0, 0x9f1c,
-  0x2eab, 0x4a65, 0xa328, 0xbbcb, 0xc42d, 0xbc8e, 0xbcd0, 0x9f1c,
-  0x96fb, 0x8287, 0x9286, 0xa328, 0xab49, 0xbbca, 0xbbeb, 0xbc8e,
-  0x3e8c, 0x4a65, 0xa308, 0xab49, 0xbbeb, 0xc42d, 0xc44d, 0xbc6e,
-  0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab28, 0xab48, 0xbbcb, 0xc42d,
-  0xde32, 0x6265, 0xa308, 0xab48, 0xbbca, 0xbbeb, 0xc42d, 0xbbcb,
-  0x8265, 0x7a25, 0x92a6, 0xab28, 0xab28, 0xab28, 0xab49, 0xbbcb,
-  0xc50f, 0x5a45, 0x9b08, 0xab48, 0xab49, 0xbbca, 0xbbeb, 0xb3aa,
-  0x8245, 0x9286, 0xab28, 0xab28, 0xab28, 0xab28, 0xab28, 0xab48,
-  0x5204, 0x51e4, 0x92a6, 0xab28, 0xab28, 0xab49, 0xbbaa, 0x9ac7,
-  0x8245, 0x92a6, 0xa308, 0x9aa6, 0x9aa6, 0xab28, 0xab28, 0xab48,
-  0x49c3, 0x7245, 0x8aa6, 0x8ac7, 0xa328, 0xa348, 0xa348, 0x92c6,
-  0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x92c6, 0xa328, 0xa348, 0xa348,
-  0x4224, 0x4367, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3b87, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x8eba, 0x4a86, 0x41a3, 0x4224, 0x4aa6, 0x8eba, 0xc79e, 0xefdf,
-  0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa79f, 0x9f9f,
-  0x4a86, 0x1c87, 0x2245, 0x2e4a, 0x364a, 0x5308, 0x971c, 0x9f9f,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df, 0xe7df, 0xc79e,
-  0x4203, 0x1d27, 0x2e8b, 0x2ecb, 0x364a, 0x5b08, 0x9f1d, 0x9f9f,
-  0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x4224, 0x1d47, 0x2eab, 0x42a5, 0x5ae8, 0xdf1b, 0xefdf, 0xe7df,
-  0xbf9e, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x4224, 0x1d47, 0x2e8a, 0x4a86, 0x8ebb, 0x9fbf, 0x9f9f, 0x9f9f,
-  0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x4224, 0x1d47, 0x2e8a, 0x4aa6, 0x96db, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d, 0x979f,
-  0x4204, 0x1d47, 0x2e8b, 0x5265, 0xb46f, 0x9f1c, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xbcd0, 0x9f1c,
-  0x4264, 0x1d47, 0x2e8b, 0x5265, 0xbbec, 0xbcd0, 0x9f1c, 0x9f5e,
-  0x979f, 0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc0c, 0xc44d, 0xbc8e,
-  0x1527, 0x15a7, 0x2e8a, 0x5265, 0xb3aa, 0xc44d, 0xbc8e, 0xbcd0,
-  0x9f1c, 0x96fb, 0x8287, 0x9286, 0xa328, 0xab49, 0xbbcb, 0xbbeb,
-  0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xa328, 0xbbeb, 0xc42d, 0xc44d,
-  0xbc6e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab28, 0xab49, 0xbbca,
-  0xe673, 0xee93, 0xde32, 0x5a45, 0xa308, 0xbbca, 0xbbeb, 0xc42d,
-  0xbbcb, 0x8265, 0x7a25, 0x92a6, 0xab28, 0xab28, 0xab28, 0xab48,
-  0xcdf1, 0xcdd1, 0xbd70, 0x5a45, 0xa308, 0xab49, 0xbbca, 0xbbeb,
-  0xb3aa, 0x8245, 0x9286, 0xab28, 0xab28, 0xab28, 0xab28, 0xab48,
-  0x3e6b, 0x2548, 0x24c7, 0x4a24, 0xa308, 0xab48, 0xab49, 0xbbaa,
-  0x9ac7, 0x8245, 0x92a6, 0xa308, 0x9aa6, 0x9aa6, 0xab28, 0xab48,
-  0x4264, 0x4244, 0x4224, 0x4a04, 0x8ac6, 0xa348, 0xa348, 0xa348,
-  0x92c6, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x92c6, 0xa328, 0xa348,
-  0x3b67, 0x3b67, 0x3b67, 0x3b87, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x9f9f, 0x9f9f, 0xaeba, 0x4a86, 0x41a3, 0x4224, 0x4aa6, 0xb6ba,
-  0xefdf, 0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0x9f9f, 0xa7bf,
-  0xbf9e, 0x971d, 0x5308, 0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5308,
-  0x971c, 0x9f9f, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7bf, 0xefdf,
-  0x9f9f, 0x971d, 0x4a86, 0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5b08,
-  0x9f1d, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x9f9f, 0x9f9f, 0x9f9f,
-  0x979f, 0x8ebb, 0x4a86, 0x1547, 0x2eab, 0x42a5, 0x5ae8, 0xdf1b,
-  0xefdf, 0xbf9e, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x973d, 0x7ae9, 0x4a04, 0x1d47, 0x2e8a, 0x4a86, 0x8e9a, 0x9fbf,
-  0x9f9f, 0x9f9f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x96ba, 0x7a87, 0x4a03, 0x1d67, 0x2e8a, 0x4aa6, 0x971d, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d, 0x9f5d,
-  0x7a87, 0x7205, 0x4a04, 0x1d47, 0x2e8a, 0x4aa6, 0x96db, 0x979f,
-  0x979f, 0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e, 0xc48f,
-  0x7204, 0x4a04, 0x4264, 0x1d67, 0x2e8b, 0x5265, 0xb46f, 0x9f1c,
-  0x9f5e, 0x979f, 0x973d, 0x82e9, 0x7a25, 0x92a6, 0xbc0c, 0xc44d,
-  0x4264, 0x1ce7, 0x1527, 0x15a7, 0x2e8a, 0x5265, 0xbc0c, 0xc48e,
-  0xbcd0, 0x9f1c, 0x96fb, 0x8287, 0x9286, 0xa328, 0xab49, 0xbbcb,
-  0x1527, 0x2588, 0x2588, 0x2dc9, 0x3e8b, 0x5265, 0xb3aa, 0xc44d,
-  0xc44d, 0xbc6e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab28, 0xab48,
-  0x3589, 0xbdb0, 0xe673, 0xee93, 0xde32, 0x5a45, 0xb38a, 0xc3eb,
-  0xc42d, 0xbbcb, 0x8265, 0x7a25, 0x92a6, 0xab28, 0xab28, 0xab48,
-  0xbd4f, 0xcd50, 0xcd70, 0xcdf1, 0xc590, 0x5a45, 0xa328, 0xbbca,
-  0xbbeb, 0xb3aa, 0x8245, 0x9286, 0xab28, 0xab28, 0xab28, 0xab48,
-  0x5205, 0x5a05, 0x5265, 0x3e8b, 0x3eac, 0x5244, 0xa308, 0xb349,
-  0xbbaa, 0x9ac7, 0x8245, 0x92a6, 0xa308, 0x9aa6, 0x9aa6, 0xab28,
-  0x4a04, 0x7a66, 0x4a44, 0x1d27, 0x2e2a, 0x4a65, 0x9b08, 0xa348,
-  0xa348, 0x92c6, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x92c6, 0xa328,
-  0x3b87, 0x4387, 0x3b66, 0x4244, 0x4265, 0x3b67, 0x43a7, 0x4387,
-  0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3b67, 0x3b67, 0x3ba7, 0x3ba7, 0x3ba7,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xe75d, 0x9f1c,
-  0xbefc, 0xef5d, 0xf7df, 0xf7df, 0xefdf, 0xc79e, 0x9f9f, 0xa7bf,
-  0xe7bf, 0xbf9e, 0x9f9f, 0x9f9f, 0x9fbf, 0x96db, 0x5ae8, 0x4a26,
-  0x52a6, 0x5b28, 0x96db, 0x9f9f, 0x9f9f, 0x9f9f, 0xbf9e, 0xe7df,
-  0x9f9f, 0x9f9f, 0x979f, 0x973d, 0x96bb, 0x4ae8, 0x1c66, 0x2225,
-  0x2e4a, 0x2e4a, 0x4ae8, 0x8f1c, 0x979f, 0x979f, 0x9f9f, 0x9f9f,
-  0x979f, 0x979f, 0x96db, 0x8b29, 0xa349, 0x4a24, 0x1547, 0x2e8b,
-  0x2ecb, 0x364a, 0x5308, 0x971d, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x973d, 0x8309, 0xa308, 0xb369, 0x4a44, 0x1547, 0x2eab,
-  0x42a5, 0x52e8, 0x8edb, 0x979f, 0x979f, 0x979f, 0x979f, 0x979f,
-  0x97bf, 0x96bb, 0x8287, 0xa308, 0xa328, 0x4a24, 0x1547, 0x2e8a,
-  0x4a86, 0x8e9a, 0x979f, 0x979f, 0x979f, 0x973d, 0x971d, 0x9f5d,
-  0x96bb, 0x7ae9, 0x7a25, 0x92a6, 0xa308, 0x4a24, 0x1547, 0x2e8a,
-  0x4aa6, 0x971d, 0x979f, 0x979f, 0x96db, 0x7ae9, 0x82a7, 0xbc6e,
-  0x7a87, 0x8225, 0x9286, 0x9ac6, 0x9ae7, 0x4a24, 0x1547, 0x2e8a,
-  0x4aa6, 0x96db, 0x97bf, 0x973d, 0x82e9, 0x7a25, 0x92a7, 0xbc0c,
-  0x7a25, 0x8a66, 0x9286, 0x9ae7, 0x5244, 0x4244, 0x1d67, 0x2e8b,
-  0x5265, 0xb46f, 0x9f3c, 0x96fb, 0x8287, 0x9286, 0xa328, 0xab49,
-  0x7205, 0x4a24, 0x4a24, 0x4264, 0x1ce7, 0x1527, 0x15a7, 0x2e8a,
-  0x5265, 0xbc0c, 0xc48e, 0xb3eb, 0x8245, 0x92a6, 0xab28, 0xab48,
-  0x4285, 0x1ce7, 0x1527, 0x1527, 0x2588, 0x2588, 0x2dc9, 0x3e8b,
-  0x5265, 0xbc0c, 0xbbcb, 0x8265, 0x7a25, 0x92a6, 0xab28, 0xab48,
-  0x2e8a, 0x1588, 0x1587, 0x2d89, 0xbdb0, 0xe673, 0xee73, 0xd5f1,
-  0x5a45, 0xb3aa, 0xb3aa, 0x8245, 0x9286, 0xab28, 0xab28, 0xab28,
-  0x1d47, 0x1567, 0x2588, 0xad4f, 0xcdb1, 0xcdf1, 0xc590, 0x6266,
-  0x51e4, 0xb38a, 0x9ac7, 0x8245, 0x92a6, 0xa308, 0x9aa6, 0x9aa6,
-  0x4244, 0x1567, 0x2e6a, 0x52e6, 0x3e8b, 0x3f2c, 0x3eab, 0x4284,
-  0x51e4, 0x9b28, 0x92c6, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6, 0x8ac6,
-  0x4204, 0x1ce7, 0x1ce7, 0x4264, 0x362a, 0x2eab, 0x2eeb, 0x364a,
-  0x4244, 0x4367, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x49c3, 0x4204, 0x4204, 0x49e4, 0x4224, 0x4284, 0x1d88, 0x2eab,
-  0x4264, 0x3b67, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7,
-  0xa79f, 0xa79f, 0x9f9f, 0x9f9f, 0xc79e, 0xefdf, 0xf7df, 0xdefb,
-  0x5286, 0x41a3, 0x4224, 0x52a6, 0xdefb, 0xf7df, 0xc79e, 0x9f9f,
-  0xefdf, 0xe7df, 0xbf9e, 0x9f9f, 0x9f9f, 0x9fbf, 0x9f1d, 0x5b08,
-  0x1c86, 0x2245, 0x2e4a, 0x364a, 0x5b08, 0x9f1c, 0x9f9f, 0xbf9e,
-  0x9f9f, 0x9f9f, 0x9f9f, 0x979f, 0x973d, 0x975d, 0x8f1d, 0x4a86,
-  0x1527, 0x2e8b, 0x2ecb, 0x364a, 0x5308, 0x8f1c, 0x979f, 0x9f9f,
-  0x979f, 0x979f, 0x979f, 0x96db, 0x8309, 0xa3cb, 0x969a, 0x4a86,
-  0x1547, 0x2eab, 0x42a5, 0x52e8, 0x8edb, 0x979f, 0x979f, 0x979f,
-  0x979f, 0x979f, 0x973d, 0x8309, 0xa307, 0xbbca, 0xb42d, 0x4a45,
-  0x1547, 0x2e8a, 0x4a86, 0x8e9a, 0x979f, 0x979f, 0x979f, 0x97bf,
-  0x979f, 0x97bf, 0x96bb, 0x8287, 0xa307, 0xb369, 0xbbec, 0x4a45,
-  0x1547, 0x2e8a, 0x4aa6, 0x971d, 0x979f, 0x979f, 0x973d, 0x971d,
-  0x979f, 0x96db, 0x7ae8, 0x8225, 0x92a6, 0xab48, 0xb3cb, 0x4a24,
-  0x1547, 0x2e8a, 0x4aa6, 0x971c, 0x979f, 0x96db, 0x82e9, 0x7a87,
-  0x96db, 0x82e9, 0x8225, 0x8a66, 0x9286, 0x9ae7, 0x5245, 0x4244,
-  0x1d67, 0x2e8a, 0x4aa6, 0x8f1d, 0x975d, 0x82e9, 0x8225, 0x9286,
-  0x9b49, 0x7a25, 0x8265, 0x5224, 0x4a24, 0x4264, 0x1ce6, 0x1527,
-  0x15a7, 0x2e8a, 0x4aa6, 0x96db, 0x9efc, 0x8287, 0x9286, 0xab28,
-  0x4a64, 0x4a44, 0x4a85, 0x1ce7, 0x1527, 0x1527, 0x2588, 0x2588,
-  0x2dc9, 0x3e8b, 0x5285, 0xb42d, 0xb3eb, 0x8245, 0x92a6, 0xab28,
-  0x362a, 0x364a, 0x2e6a, 0x15a8, 0x15a8, 0x25a8, 0xb56f, 0xe653,
-  0xee93, 0xde32, 0x6265, 0xab89, 0x8a66, 0x7a25, 0x92a6, 0xab28,
-  0x4a44, 0x4aa5, 0x1d07, 0x15a8, 0x26cb, 0x2e8a, 0x5ac6, 0xc570,
-  0xd5f1, 0xc52f, 0x5a45, 0xab69, 0x8245, 0x9286, 0xa328, 0xab28,
-  0x9286, 0x9ae7, 0x5285, 0x1ce7, 0x1d67, 0x1ce7, 0x4264, 0x3e8b,
-  0x3eac, 0x5265, 0x59e4, 0x92a6, 0x8245, 0x92a6, 0xa308, 0x9ac6,
-  0x92c6, 0xa328, 0x9307, 0x4a44, 0x4224, 0x4204, 0x42a5, 0x2ecb,
-  0x2e6a, 0x4a65, 0x92e7, 0x92c6, 0x8aa6, 0x7a45, 0x7a65, 0x8aa6,
-  0x4387, 0x4387, 0x4387, 0x3b87, 0x3b46, 0x4244, 0x35ea, 0x364a,
-  0x42c5, 0x3b46, 0x43a7, 0x4387, 0x4387, 0x4387, 0x4387, 0x4387,
-  0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3b87, 0x4204, 0x4244, 0x4244,
-  0x3b46, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7, 0x3ba7
-};
-
-const Animation dinoAnimation = {
-  .name = "Dino",
-  .frameCount = 25,
-  .width = 16,
-  .height = 16,
-  .frameDurations = dinoDurations,
-  .animationFrames = dinoFrames
-};
-#endif // ANIMATION_DINO_H
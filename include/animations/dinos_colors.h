@@ -1,1558 +0,0 @@
-// dinos_colors.h - Auto-generated from dinos_colors.json
-#ifndef ANIMATION_DINOS_COLORS_H
-#define ANIMATION_DINOS_COLORS_H
-
-#include "animation_types.h"
-
-// Frame Durations for dinos_colors (in 100ms units)
-static const uint8_t PROGMEM dinos_colorsDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for dinos_colors
-static const uint16_t PROGMEM dinos_colorsFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0682,
-  0x0682, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0682, 0x0682,
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0682, 0xffff,
-  0x4209, 0x0682, 0x0682, 0x0682, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0682, 0x0682, 0xffff,
-  0x4209, 0x0682, 0x0682, 0x4209, 0x0682, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0x0682, 0x0682, 0x0682,
-  0x0682, 0x0682, 0x0682, 0x0682, 0x0682, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xf369, 0x0682, 0x0682, 0xf7fe, 0xf7fe,
-  0x0682, 0x0682, 0x0682, 0x0682, 0x0682, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xf369, 0x0682, 0xf7fe, 0xf7fe, 0xf7fe,
-  0x0682, 0x0682, 0x0682, 0x0682, 0x0682, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0xf7fe, 0xf7fe, 0xf7fe,
-  0xf7fe, 0x0682, 0x0682, 0x0682, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0xf369, 0xf7fe, 0xf7fe,
-  0x0682, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0x0682, 0x0682,
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0682, 0x0000, 0xeaaa, 0xeaaa, 0xb7b7, 0x0682, 0x0682,
-  0x0682, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0682, 0x0682, 0xffff, 0xffff, 0x0682, 0x0682, 0x0682,
-  0x0682, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xffff, 0x0682, 0x0682, 0x0682, 0x0682, 0x0682, 0xffff,
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xffff, 0xf7fe, 0x0682, 0x0682, 0xffff, 0xffff,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0xf369, 0xf369, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf369, 0xf369, 0xf369, 0xf369,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0,
-  0x0622, 0x1644, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0562,
-  0x26a6, 0xb6b7, 0x1102, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x1644,
-  0xcf5a, 0x5b2c, 0x05a2, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x16a4,
-  0xc739, 0x430a, 0x0622, 0x0643, 0x2b67, 0x0522, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1643, 0x16a4,
-  0x26a6, 0x0e23, 0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x2623, 0x26a6, 0xcfba,
-  0xcfb9, 0x0ea4, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x3625, 0xcfba, 0xf7fe,
-  0xe7dc, 0x26a7, 0x0682, 0x0682, 0x0682, 0x0582, 0x0060, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xf73b, 0xf7fe,
-  0xf7de, 0xbf77, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac8, 0xec0c, 0xdf7a,
-  0xcfda, 0x3e48, 0x00e0, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x3082, 0xcba9, 0x2665,
-  0x26c6, 0xb6f6, 0x1102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0080, 0x0501, 0x1141, 0xca8a, 0xdb2c, 0x9eb2, 0x0e83,
-  0x0662, 0x16a4, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0080, 0x1604, 0x1624, 0xd739, 0xdf5a, 0x1ea6, 0x0682,
-  0x1684, 0x16a4, 0x15c3, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc6b7, 0x2ee7, 0x26c7, 0x16a5, 0x0682, 0x26c7,
-  0xdfdb, 0xef3a, 0xcbaa, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xe3cc, 0xef3a, 0xcf58, 0x0e03, 0x0e03, 0xc719,
-  0xeefb, 0xf40d, 0xe329, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xc2c8, 0xe38a, 0xcb29, 0x10a1, 0x0080, 0x1082,
-  0x20c2, 0xcae8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x00e0, 0x0622, 0x1644, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x0562, 0x26a6, 0xb6b7, 0x1102, 0x0080, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0,
-  0x1644, 0xcf5a, 0x5b2c, 0x05a2, 0x0602, 0x0522, 0x00e0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582,
-  0x16a4, 0xc739, 0x430a, 0x0622, 0x0643, 0x2b67, 0x0522, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1643,
-  0x16a4, 0x26a6, 0x0e23, 0x0662, 0x0662, 0x0643, 0x05e2, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x2623, 0x26a6,
-  0xcfba, 0xcfb9, 0x0ea4, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x3625, 0xcfba,
-  0xf7fe, 0xe7dc, 0x26a7, 0x0682, 0x0682, 0x0682, 0x0562, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xf73b,
-  0xf7fe, 0xf7de, 0xbf77, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac8, 0xec0c,
-  0xdf7a, 0xcfda, 0x3648, 0x00e0, 0x0060, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x3082, 0xcba9,
-  0x2665, 0x26c6, 0xc718, 0x1102, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xca8a, 0xdb2c, 0x9eb2,
-  0x0e83, 0x0e84, 0xc798, 0x1645, 0x0581, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10c1, 0x1624, 0x1624, 0xd739, 0xdf5a, 0x1ea6,
-  0x0662, 0x1685, 0x26a6, 0x0622, 0x0582, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb49, 0xdf18, 0x2ee7, 0x26c7, 0x16a5, 0x0682,
-  0x26c7, 0xdfdb, 0xd6f9, 0x1102, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xd6d9, 0xbf17, 0x0e03, 0x0e03,
-  0xc719, 0xff5c, 0xe3cc, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x1082, 0x0080, 0x0080,
-  0x20e3, 0xdb8a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb08, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7, 0x1102, 0x0080, 0x0080,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c, 0x05a2, 0x0602, 0x05a3,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xab67, 0x1642, 0x0ea4, 0xc739, 0x430a, 0x0622, 0x0643, 0x3327,
-  0x04dd, 0x0083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb28,
-  0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23, 0x0662, 0x0662, 0x0623,
-  0x04dd, 0x0083, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb27,
-  0x2603, 0x26a6, 0xcfba, 0xd7bb, 0x16a4, 0x0662, 0x0662, 0x0682,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xcbaa, 0xe77a, 0xf7fe, 0xefdd, 0x2ec7, 0x0682, 0x0682, 0x0682,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb4a, 0xff3b, 0xf7fe, 0xffdf, 0xc6f9, 0x1604, 0x05e2, 0x05e2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x2061,
-  0xd36a, 0xdc4c, 0xe79b, 0xd75b, 0x21a4, 0x0080, 0x0080, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xca8a, 0xdb4c,
-  0xa6b2, 0x1e44, 0x1684, 0x0e84, 0x0582, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x1624, 0x1624, 0xd739, 0xdf5a,
-  0x1ea6, 0x0682, 0x1684, 0x16a4, 0x05a2, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xb676, 0x2ec7, 0x26c7, 0x16a5,
-  0x0682, 0x26c6, 0xd7bb, 0xc6b9, 0x1102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6d9, 0xcf58, 0x0e03,
-  0x0e04, 0xdf59, 0xeefb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xe38b, 0x2101,
-  0x10a1, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xf369, 0xc2c8,
-  0x2061, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4, 0x0060, 0x0000,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7, 0x1102, 0x0080,
-  0x0438, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c, 0x05a2, 0x0602,
-  0x32ce, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xab67, 0x1642, 0x0ea4, 0xc739, 0x430a, 0x0622, 0x06a2,
-  0x051d, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xbb28, 0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23, 0x0662, 0x0682,
-  0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xbb27, 0x2603, 0x26a6, 0xcfba, 0xd7ba, 0x16a4, 0x0662, 0x0682,
-  0x055f, 0x049a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xe7dc, 0x2ec7, 0x0682, 0x0682,
-  0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb4a, 0xff3b, 0xf7fe, 0xffdf, 0xc719, 0x1604, 0x05e2,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020,
-  0x2061, 0xd36a, 0xdc4c, 0xe79b, 0xd73b, 0x2124, 0x0080, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xca8a,
-  0xdb4c, 0xa6b2, 0x1e44, 0x1684, 0x0e04, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x1624, 0x1624, 0xd739,
-  0xdf5a, 0x1ea6, 0x0682, 0x16a4, 0x1624, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xb676, 0x2ee7, 0x26c7,
-  0x16a5, 0x0682, 0x26c6, 0xdfdb, 0xceb9, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xc698, 0xbf17,
-  0x1e44, 0x2644, 0xd759, 0xdebb, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x20e3,
-  0xcb68, 0xe3c9, 0xe38a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb09, 0xf36a, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x1584, 0x0060,
-  0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xb6b7, 0x1123,
-  0x04dc, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c, 0x0583,
-  0x051d, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xab67, 0x1642, 0x0ea4, 0xc739, 0x4309, 0x0622,
-  0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb28, 0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23, 0x0662,
-  0x053f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb27, 0x2603, 0x26a6, 0xcfba, 0xd7bb, 0x16a4, 0x0662,
-  0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xefdd, 0x2ec7, 0x0682,
-  0x04fd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb4a, 0xff3c, 0xf7fe, 0xffdf, 0xc6f8, 0x1604,
-  0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000,
-  0x1020, 0x2061, 0xd36a, 0xdc4c, 0xe79b, 0xd75b, 0x21a4, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x1141,
-  0xca8a, 0xdb4c, 0xa6b2, 0x1e44, 0x1684, 0x0e84, 0x0562, 0x0060,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x1604, 0x1624,
-  0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684, 0x16a4, 0x15c3, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc6b7, 0x2ee7,
-  0x26c7, 0x16a5, 0x0682, 0x26c7, 0xdfdb, 0xef3a, 0xcba9, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xe3cc, 0xef3a,
-  0xbf17, 0x0e03, 0x0e03, 0xc719, 0xeefb, 0xf40d, 0xdb09, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2e8, 0xcb4a,
-  0x20c3, 0x0080, 0x0080, 0x1082, 0x20c2, 0xcae8, 0xc2c8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0562, 0x1624,
-  0x0062, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xcf59,
-  0x04dc, 0x04dd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf39, 0x62ed,
-  0x055f, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xab67, 0x1642, 0x0ea4, 0xc739, 0x4aca,
-  0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb28, 0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23,
-  0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb27, 0x2603, 0x26a6, 0xcfba, 0xd79a, 0x16a4,
-  0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xe7dc, 0x2ec7,
-  0x04bc, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb4a, 0xff3b, 0xf7fe, 0xf7de, 0xd71b,
-  0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x0000, 0x1020, 0x2061, 0xd36a, 0xdc4c, 0xef9c, 0xe75d, 0x29c5,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c0, 0x0501,
-  0x1141, 0xca8a, 0xdb4c, 0xa6b2, 0x1e44, 0x26a6, 0xbf78, 0x1624,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb28, 0x2665,
-  0x0e24, 0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684, 0x26a6, 0x0623,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xced7,
-  0x2ee7, 0x2ec7, 0x16a5, 0x0682, 0x26c7, 0xdfdb, 0xd6d9, 0x1122,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb287, 0x3965,
-  0xc698, 0xbf17, 0x0e03, 0x0e03, 0xc719, 0xff5c, 0xdbcc, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x1082, 0x10a2, 0x0080, 0x0080, 0x20e3, 0xdb8a, 0xdb28, 0x2881,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xeb69, 0xdb29,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
-  0x149a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0561,
-  0xc6bb, 0x1105, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x16a4,
-  0x4a8c, 0x0c9b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x16a5, 0xd7bb,
-  0x326c, 0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1642, 0x0ea4, 0xd7ba,
-  0x04fd, 0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb28, 0x2623, 0x0682, 0x1684, 0x26a7,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb27, 0x2603, 0x26a6, 0xcfba, 0xe7dc,
-  0x159f, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xf7fe,
-  0xc6bc, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb4a, 0xff3b, 0xf7de, 0xffff,
-  0x1104, 0x0062, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x0000, 0x1020, 0x2061, 0xd36a, 0xdc4c, 0xe77b, 0xe7dd,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
-  0x0501, 0x1141, 0xca8a, 0xdb4c, 0xa6b2, 0x1e44, 0x1684, 0x1684,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
-  0x1624, 0x1624, 0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684, 0x16a5,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,
-  0xb676, 0x2ee7, 0x26c7, 0x16a5, 0x0682, 0x26c6, 0xd7bb, 0xd73b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0xc698, 0xcf58, 0x1e44, 0x2644, 0xdf59, 0xeefb, 0x2945,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c3, 0xdb8a, 0xdba9, 0xdba9, 0xf3cb, 0xdb6a, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xf36a, 0xf369, 0xf369, 0xdb08, 0x1040,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x00a0,
-  0x0418, 0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0562, 0x05a3,
-  0x32ce, 0x04bb, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x05c3, 0x3327,
-  0x04fd, 0x055f, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x0662, 0x0622,
-  0x055f, 0x055f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1643, 0x16a4, 0x16a4,
-  0x053f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb27, 0x2623, 0x26a6, 0xcfba, 0xe7dc,
-  0x157f, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb27, 0x3625, 0xcfba, 0xf7de, 0xf7fe,
-  0xb73e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xf73b, 0xf7de, 0xf7fe,
-  0x2d5c, 0x00e5, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xcac8, 0xec0c, 0xdf7a, 0xdfdc,
-  0xbedc, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0060, 0x0000, 0x1020, 0x3082, 0xcba9, 0x2665, 0x16a4,
-  0x14fc, 0x0083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x0501, 0x1141, 0xca8a, 0xdb2c, 0x9eb2, 0x0e83, 0x0661,
-  0x151d, 0x0083, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1624, 0x1624, 0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684,
-  0xc67a, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xb676, 0x2ee7, 0x26c7, 0x16a5, 0x0682, 0x26c7, 0xdfdb,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2104, 0xc698, 0xbf17, 0x1e44, 0x2644, 0xd759, 0xef3d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x20e3, 0xcb68, 0xe3c9, 0xdb8a, 0x3924,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb09, 0xf36a, 0xeb49, 0xdb08,
-  0x055f, 0x151d, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
-  0x2dbf, 0xb67b, 0x1104, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0562,
-  0xdf3d, 0x5b0e, 0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0100, 0x0602,
-  0xdf1d, 0x42ee, 0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x0682,
-  0x259f, 0x0d1d, 0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1643, 0x16a4,
-  0xc77e, 0x157f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x2623, 0x26a6, 0xcfb9,
-  0xdfbe, 0x2dbf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x3625, 0xcfba, 0xf7fe,
-  0xf7dd, 0xbf3e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xf75b, 0xf7fe,
-  0xcf9e, 0x3d7c, 0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac8, 0xec0c, 0xdf7a,
-  0x25bf, 0xaebd, 0x10e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x3082, 0xc3a9, 0x2e65,
-  0x053f, 0x0d7f, 0x049b, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0080, 0x0501, 0x1141, 0xca8a, 0xdb2c, 0x9eb2, 0x0e84,
-  0x157f, 0x159f, 0x14db, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0080, 0x1604, 0x1624, 0xd739, 0xdf5a, 0x1ea6, 0x0662,
-  0xefbf, 0xef1c, 0xcb8c, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc6b7, 0x2ee7, 0x26c7, 0x16a5, 0x0682, 0x16a5,
-  0xeefb, 0xf42d, 0xe328, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xe3cc, 0xef3a, 0xcf58, 0x0e03, 0x1604, 0xc718,
-  0x20c3, 0xc2c8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xc2c8, 0xe38a, 0xcb29, 0x10a1, 0x0080, 0x1082,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x0083, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x04bc, 0x049a, 0x0438, 0x00c4, 0x0062, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x051e, 0x32ce, 0x32ae, 0x04bb, 0x04fd, 0x0459, 0x00a4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x053f, 0x04fd, 0x04fd, 0x055f, 0x051e, 0x2b10, 0x0459, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c1, 0x0582,
-  0x157f, 0x157f, 0x055f, 0x055f, 0x053f, 0x051e, 0x04fd, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xa367, 0x1642,
-  0xdfbe, 0xcf7e, 0x157f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x2624, 0x16a4,
-  0xf7fd, 0xe7be, 0x25bf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb27, 0x3625, 0xcfb9,
-  0xf7de, 0xf7fe, 0xbf3e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbca, 0xf73b,
-  0xdfbe, 0xcf9e, 0x357c, 0x00c4, 0x0042, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcae8, 0xf3ab,
-  0x157f, 0x25bf, 0xc6fd, 0x1104, 0x0042, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x30a2, 0xdb6a,
-  0x053f, 0x157f, 0xc73f, 0x153d, 0x047b, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xca8a, 0xdb4c, 0xaed3,
-  0x053f, 0x157f, 0x25bf, 0x051d, 0x049a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10c1, 0x1624, 0x1624, 0xd739, 0xd759, 0x26a6,
-  0x2dbf, 0xd79f, 0xd6db, 0x10e4, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb49, 0xdf18, 0x2ee7, 0x26c7, 0x16a5, 0x0682,
-  0xd71d, 0xff3c, 0xe3cc, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xd6d9, 0xbf17, 0x0e04, 0x05e2,
-  0x28e3, 0xdb6a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x1082, 0x0080, 0x0080,
-  0x1020, 0xd308, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c, 0x1104, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0x047a, 0x159f, 0xcf1d, 0x5b0d, 0x049b, 0x04fd, 0x0459,
-  0x00a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb36c, 0x151d, 0x0d7f, 0xc6fd, 0x42ee, 0x051e, 0x051e, 0x2b10,
-  0x0459, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x153e, 0x053f, 0x157f, 0x259f, 0x0d1d, 0x053f, 0x053f, 0x051e,
-  0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0x151e, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f, 0x055f, 0x055f,
-  0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0xdbed, 0xdf5c, 0xf7fe, 0xefbf, 0x2dbf, 0x055f, 0x055f, 0x055f,
-  0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0xf3aa, 0xf71a, 0xf7fe, 0xffdf, 0xc6dc, 0x14fc, 0x04dd, 0x047a,
-  0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xebaa, 0xdc2e, 0xe77e, 0xd73d, 0x2187, 0x0062, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020, 0x1020,
-  0x9ed7, 0x255d, 0x155f, 0x0d7f, 0x047a, 0x0042, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xcaaa, 0xe2eb,
-  0x0d7e, 0x055f, 0x157f, 0x159f, 0x049b, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x1624, 0x1624, 0xd739, 0xef7b,
-  0x055f, 0x25bf, 0xd79f, 0xc69b, 0x10e4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xb676, 0x2ec7, 0x26c6, 0x16c5,
-  0x14fc, 0xd73d, 0xeefb, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6d9, 0xcf58, 0x0e04,
-  0x10a3, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xe38a, 0x2902,
-  0x1020, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xeb69, 0xdb09,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c, 0x1104, 0x0062,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0d, 0x049b, 0x04fd,
-  0x0459, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2081, 0xa32b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee, 0x051e, 0x051e,
-  0x2b10, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xcb4a, 0x24fc, 0x053f, 0x157f, 0x259f, 0x0d1d, 0x053f, 0x053f,
-  0x051e, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xcb4a, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f, 0x055f,
-  0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xcb8b, 0xe77c, 0xf7fe, 0xe7be, 0x2dbf, 0x055f, 0x055f,
-  0x055f, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb49, 0xff3a, 0xf7fe, 0xffdf, 0xc6fd, 0x151c, 0x04dd,
-  0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xd369, 0xdc4e, 0xe77e, 0xd73d, 0x2124, 0x0062, 0x0062,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000, 0x1020,
-  0xdb4c, 0xa676, 0x1d5d, 0x157f, 0x0cfc, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x1141, 0xca8a,
-  0xd71d, 0x25be, 0x053f, 0x157f, 0x151d, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x1624, 0x1644, 0xd758,
-  0x0d7f, 0x055f, 0x25bf, 0xdf9f, 0xce9a, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xb676, 0x2ee7, 0x2ee7,
-  0x151d, 0x255d, 0xd73d, 0xdeba, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xc698, 0xcf39,
-  0xdb8b, 0xdbab, 0xe38a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0xf369, 0xf369, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c, 0x1104,
-  0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0d, 0x049b,
-  0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee, 0x051e,
-  0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb09, 0x251c, 0x053f, 0x157f, 0x259f, 0x0d1d, 0x053f,
-  0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f,
-  0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcb8c, 0xe77d, 0xf7fe, 0xefbf, 0x2dbf, 0x055f,
-  0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb6a, 0xff3b, 0xf7fe, 0xffdf, 0xc6dc, 0x14fc,
-  0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0x2061, 0xd369, 0xdc4e, 0xe77e, 0xd73d, 0x2187, 0x0062,
-  0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060, 0x0000,
-  0xdacb, 0xdb2c, 0xa696, 0x1d5d, 0x155f, 0x0d7f, 0x047a, 0x0042,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0501, 0x0120,
-  0xe75d, 0xd71d, 0x1d9e, 0x053f, 0x157f, 0x159f, 0x14db, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x1624, 0x0622,
-  0x2ddf, 0x159f, 0x055f, 0x25bf, 0xdf9f, 0xef1c, 0xcb8c, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc6b7, 0x2ee7,
-  0xb6db, 0x0cfc, 0x0cfc, 0xc6fd, 0xeefb, 0xf42c, 0xe328, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdbcc, 0xef3a,
-  0x1082, 0x0062, 0x0062, 0x10a2, 0x20c2, 0xcae8, 0xcae8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2c8, 0xdb6a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c,
-  0x1104, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0d,
-  0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee,
-  0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb09, 0x251c, 0x053f, 0x157f, 0x259f, 0x0d1d,
-  0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcb8c, 0xe77c, 0xf7fe, 0xe7be, 0x2dbf,
-  0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb6a, 0xff3a, 0xf7fe, 0xffde, 0xc6dc,
-  0x14fc, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x2061, 0xd369, 0xdc2e, 0xef7e, 0xef7d, 0x29a7,
-  0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0060,
-  0x10a3, 0xcaaa, 0xdb4c, 0xa696, 0x1d5d, 0x259f, 0xc73f, 0x153d,
-  0x047a, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x10c0, 0x0561,
-  0x14fc, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x25bf, 0x051d,
-  0x049a, 0x0062, 0x0000, 0x0000, 0x0000, 0x1020, 0xb328, 0x2e85,
-  0x1dbf, 0x25df, 0x159f, 0x055f, 0x25bf, 0xdf9f, 0xd6db, 0x10e4,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xded9,
-  0xd71c, 0xbedb, 0x0cfc, 0x0cfc, 0xc6fd, 0xff5c, 0xe3cc, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb2a7, 0x28e3,
-  0x10a2, 0x10a2, 0x0062, 0x0062, 0x20e3, 0xdb8a, 0xe329, 0x2081,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xf36a, 0xcae8,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x047a,
-  0x14ba, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf,
-  0xbe9c, 0x1104, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d,
-  0x5b0d, 0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd,
-  0x42ee, 0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x053f, 0x157f, 0x259f,
-  0x0d1d, 0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f,
-  0x157f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb8c, 0xe77c, 0xf7fe, 0xe7be,
-  0x2dbf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb6a, 0xff3a, 0xf7fe, 0xffde,
-  0xc6dc, 0x14fc, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x0000, 0x1020, 0x2061, 0xd369, 0xdc4e, 0xe77e, 0xd73d,
-  0x2187, 0x0062, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x047a, 0x1105, 0xca8a, 0xdb4c, 0xa696, 0x1d5d, 0x155f, 0x0d7f,
-  0x047a, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x159f, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x159f,
-  0x049b, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc6dd, 0x2ddf, 0x25bf, 0x159f, 0x055f, 0x25bf, 0xdf9f, 0xc69b,
-  0x10e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2124, 0xc67a, 0xcf3c, 0x1d3d, 0x253d, 0xdf3d, 0xeefb, 0x2924,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c2, 0xdb8a, 0xdbab, 0xdb8b, 0xf3cb, 0xdb6a, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xf369, 0xf369, 0xf369, 0xdb08, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x04fd,
-  0x153d, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x047a, 0x25bf,
-  0xb67b, 0x1104, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x153d, 0xcf1d,
-  0x5b0d, 0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x047a, 0x157f, 0xc6fd,
-  0x42ee, 0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x157f, 0x259f,
-  0x0d1d, 0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x25bf, 0xcf7e, 0xcf7e,
-  0x0d7f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e, 0xf7fe, 0xe7be,
-  0x25bf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b, 0xf7fe, 0xf7fe,
-  0xbf3e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xcac7, 0xec0c, 0xdf5c, 0xcf9e,
-  0x3d7c, 0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0042, 0x0000, 0x1020, 0x30a1, 0xcb8b, 0x255d, 0x25bf,
-  0xb6bc, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x03f8, 0x1105, 0xca8a, 0xdb2c, 0x9e96, 0x0d7e, 0x053f,
-  0x151c, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x151c, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x159f,
-  0x151d, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xb65a, 0x2ddf, 0x25df, 0x159f, 0x055f, 0x25bf, 0xdf9f,
-  0xce9a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2104, 0xc69a, 0xbefc, 0x1d3d, 0x253d, 0xd73d, 0xdeba,
-  0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x20e3, 0xcb4a, 0xe3ab, 0xe38a, 0x3103,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xf369, 0xeb69, 0xc2c7,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4,
-  0x04fd, 0x153d, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x047a,
-  0x25bf, 0xb67b, 0x1104, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x153d,
-  0xcf1d, 0x5b0d, 0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x047a, 0x157f,
-  0xc6fd, 0x42ee, 0x051e, 0x051e, 0x2b10, 0x0459, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x157f,
-  0x259f, 0x0d1d, 0x053f, 0x053f, 0x051e, 0x04fd, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x25bf, 0xcf7e,
-  0xcf7e, 0x0d7f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e, 0xf7fe,
-  0xe7be, 0x25bf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b, 0xf7fe,
-  0xf7fe, 0xbf3e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac7, 0xec0c, 0xdf5c,
-  0xcf9e, 0x3d7c, 0x00c4, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x30a1, 0xcb8b, 0x255d,
-  0x25bf, 0xb6bd, 0x10e4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0062, 0x0418, 0x1105, 0xca8a, 0xdb2c, 0x9e96, 0x0d7e,
-  0x053f, 0x157f, 0x049b, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0062, 0x151d, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f,
-  0x157f, 0x159f, 0x14db, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc69b, 0x2ddf, 0x25bf, 0x159f, 0x055f, 0x25bf,
-  0xdf9f, 0xef1c, 0xcb8c, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xe3cc, 0xef3c, 0xcf3c, 0x0cfc, 0x0cfc, 0xc6fd,
-  0xeefb, 0xf42c, 0xe328, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xc2c8, 0xe38a, 0xcb49, 0x10a3, 0x0062, 0x10a2,
-  0x20c2, 0xcae8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x00c4, 0x04fd, 0x153d, 0x0062, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041,
-  0x047a, 0x25bf, 0xb67b, 0x1104, 0x0062, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4,
-  0x153d, 0xcf1d, 0x5b0d, 0x049b, 0x04fd, 0x0459, 0x00a4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x047a,
-  0x157f, 0xc6fd, 0x42ee, 0x051e, 0x051e, 0x2b10, 0x0438, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e,
-  0x157f, 0x259f, 0x0d1d, 0x053f, 0x053f, 0x051e, 0x04dc, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x25bf,
-  0xcf7e, 0xcf7e, 0x0d7f, 0x053f, 0x055f, 0x055f, 0x04dc, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e,
-  0xf7fe, 0xe7be, 0x25bf, 0x055f, 0x055f, 0x055f, 0x047a, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b,
-  0xf7fe, 0xf7fe, 0xbf3e, 0x151c, 0x04dd, 0x047a, 0x00c4, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac7, 0xec0c,
-  0xdf5c, 0xcf9e, 0x357c, 0x00c4, 0x0042, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x30a1, 0xcb8b,
-  0x255d, 0x25bf, 0xc6fd, 0x1104, 0x0042, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xca8a, 0xdb2c, 0x9e96,
-  0x0d7e, 0x0d5f, 0xc73f, 0x153d, 0x047b, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a3, 0x151d, 0x151d, 0xd71d, 0xdf3e, 0x1d9e,
-  0x053f, 0x157f, 0x25bf, 0x051d, 0x049a, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb29, 0xdefc, 0x2ddf, 0x25df, 0x159f, 0x055f,
-  0x25bf, 0xdf9f, 0xd6db, 0x10e4, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xd6bb, 0xbedc, 0x0cfc, 0x0cfc,
-  0xc6fd, 0xff5c, 0xe3cc, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x10a2, 0x0062, 0x0062,
-  0x20e3, 0xdb8a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb08, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c, 0x1104, 0x0062, 0x0062,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0d, 0x049b, 0x04dd, 0x049b,
-  0xd680, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee, 0x051e, 0x051e, 0x32ce,
-  0xef40, 0x18c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb09,
-  0x251c, 0x053f, 0x157f, 0x259f, 0x0d1d, 0x053f, 0x053f, 0x04fd,
-  0xef40, 0x18c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb09,
-  0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f, 0x055f, 0x055f,
-  0xd680, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xcb8c, 0xe77c, 0xf7fe, 0xefbf, 0x2dbf, 0x055f, 0x055f, 0x055f,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb6a, 0xff3a, 0xf7fe, 0xffdf, 0xc6dc, 0x14fc, 0x04dc, 0x04dc,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x2061,
-  0xd369, 0xdc4e, 0xe77e, 0xd73d, 0x2187, 0x0062, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xca8a, 0xdb4c,
-  0xa696, 0x1d5d, 0x155f, 0x0d7f, 0x047a, 0x0042, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x151d, 0xd71d, 0xdf3e,
-  0x1d9e, 0x053f, 0x157f, 0x159f, 0x049b, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xb65a, 0x2ddf, 0x25bf, 0x159f,
-  0x055f, 0x25bf, 0xd79f, 0xc69b, 0x10e4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6db, 0xcf3c, 0x0cfc,
-  0x0cfc, 0xdf3d, 0xeefb, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xe38a, 0x20e3,
-  0x10a3, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xf369, 0xc2c7,
-  0x2061, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0061, 0x0000,
-  0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xbe9c, 0x1104, 0x0062,
-  0xc621, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0d, 0x049b, 0x04fd,
-  0x7367, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee, 0x04fd, 0x057f,
-  0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xbb09, 0x251c, 0x053f, 0x157f, 0x259f, 0x0d1d, 0x053f, 0x055f,
-  0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f, 0x055f,
-  0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xcb8c, 0xe77c, 0xf7fe, 0xe7be, 0x2dbf, 0x055f, 0x055f,
-  0xd6a0, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb6a, 0xff3a, 0xf7fe, 0xffdf, 0xc6fd, 0x14fc, 0x04dc,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020,
-  0x2061, 0xd369, 0xdc4e, 0xe77e, 0xd73d, 0x2124, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xca8a,
-  0xdb4c, 0xa696, 0x1d5d, 0x157f, 0x0cfc, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x151d, 0xd71d,
-  0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x151d, 0x0062, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xb65a, 0x2ddf, 0x25df,
-  0x159f, 0x055f, 0x25bf, 0xdf9f, 0xce9a, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xc69a, 0xbefc,
-  0x1d3d, 0x253d, 0xd73d, 0xdeba, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x20e3,
-  0xcb4a, 0xe3ab, 0xe38a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb08, 0xf369, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x14ba, 0x0062,
-  0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xb67b, 0x1105,
-  0xe720, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x5b0e, 0x049b,
-  0xef61, 0x7be6, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x42ee, 0x04fd,
-  0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb09, 0x251c, 0x053f, 0x157f, 0x259f, 0x0d1e, 0x053f,
-  0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f, 0x053f,
-  0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcb8c, 0xe77d, 0xf7fe, 0xefbf, 0x2dbf, 0x055f,
-  0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb6a, 0xff3b, 0xf7fe, 0xffdf, 0xc6dc, 0x151c,
-  0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000,
-  0x1020, 0x2061, 0xd369, 0xdc4e, 0xe77e, 0xd73d, 0x2186, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x1105,
-  0xca8a, 0xdb4c, 0xa696, 0x1d5d, 0x155f, 0x0d7f, 0x047a, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x151d,
-  0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x159f, 0x14bb, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc69b, 0x2ddf,
-  0x25df, 0x159f, 0x055f, 0x25bf, 0xdf9f, 0xef1c, 0xcb8b, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xe3cc, 0xef1c,
-  0xbedc, 0x0cfc, 0x0cfc, 0xc6fd, 0xeefb, 0xf42c, 0xdb08, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2e8, 0xcb49,
-  0x20c2, 0x0062, 0x0062, 0x10a2, 0x20c2, 0xcae8, 0xc2c8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0062,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x047a, 0x151d,
-  0x10a0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x25bf, 0xcf1e,
-  0xe720, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x047a, 0x159f, 0xcf1d, 0x62ec,
-  0xffe0, 0xf781, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x0d7f, 0xc6fd, 0x4aac,
-  0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb09, 0x251c, 0x053f, 0x157f, 0x259f, 0x0d1d,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xd77f, 0x157f,
-  0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcb8c, 0xe77c, 0xf7fe, 0xe7be, 0x2ddf,
-  0xe700, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb6a, 0xff3a, 0xf7fe, 0xf7de, 0xd71c,
-  0x2120, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042,
-  0x0000, 0x1020, 0x2061, 0xd369, 0xdc2e, 0xef7e, 0xe75d, 0x29a7,
-  0xd680, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a3, 0x0418,
-  0x1105, 0xca8a, 0xdb4c, 0xa696, 0x1d5d, 0x259f, 0xbf3f, 0x151d,
-  0xd6a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb0a, 0x255e,
-  0x0d1d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x25bf, 0x04fd,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb8a, 0xcebb,
-  0x2ddf, 0x2ddf, 0x159f, 0x055f, 0x25bf, 0xdf9f, 0xd6bb, 0x1104,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb287, 0x3965,
-  0xc67a, 0xbefc, 0x0cfc, 0x0cfc, 0xc6fd, 0xff5c, 0xdbcb, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x1082, 0x10a2, 0x0062, 0x0062, 0x20e3, 0xdb8a, 0xdb29, 0x2881,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xeb69, 0xdb29,
-  0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0xd682, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x047a,
-  0xdef8, 0x2942, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00a4, 0x049b, 0x159f,
-  0x5aca, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x049a, 0x2dbf, 0xdf9f,
-  0x5ac7, 0xf761, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xa32b, 0x255e, 0xbf5f, 0xe7bf,
-  0xef60, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x055f, 0x25bf, 0x2dbf,
-  0xffe0, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x24fc, 0x259f, 0xcf7e, 0xe7bf,
-  0xffe3, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb8c, 0xe77c, 0xf7fe, 0xf7fe,
-  0xe718, 0xe722, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb6a, 0xff3a, 0xf7fe, 0xffff,
-  0x2122, 0x10a0, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0042, 0x0000, 0x1020, 0x2061, 0xd369, 0xdc4e, 0xe75d, 0xe7bf,
-  0xd680, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0x0418, 0x1105, 0xca8a, 0xdb4c, 0xa696, 0x1d5d, 0x155f, 0x157f,
-  0xd6a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0x151d, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f, 0x159f,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,
-  0xb65a, 0x2ddf, 0x25bf, 0x159f, 0x055f, 0x25bf, 0xd77f, 0xd73d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0xc69a, 0xcf3c, 0x1d3d, 0x253d, 0xdf3d, 0xeefb, 0x2944,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c2, 0xdb8a, 0xdbab, 0xdb8b, 0xf3cb, 0xdb6a, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xf369, 0xf369, 0xf369, 0xdb08, 0x1040,
-  0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0083,
-  0xc601, 0x2120, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x045a, 0x049a,
-  0x6b47, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x04bb, 0x32ef,
-  0xef41, 0xffe0, 0xf781, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x049a, 0x053f, 0x04fd,
-  0xffe0, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x157f, 0x159f,
-  0xffc0, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x25bf, 0xcf7e, 0xe7be,
-  0xffc2, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e, 0xf7fe, 0xf7fe,
-  0xf7d6, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b, 0xf7fe, 0xf7fe,
-  0xe725, 0x2940, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xcac7, 0xec0c, 0xdf5c, 0xdfbe,
-  0xe737, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0042, 0x0000, 0x1020, 0x30a1, 0xcb8b, 0x255d, 0x157f,
-  0xe722, 0x18c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x0418, 0x1105, 0xca8a, 0xdb2c, 0x9e96, 0x0d7e, 0x053f,
-  0xef42, 0x18c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x151d, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f, 0x157f,
-  0xd698, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xb65a, 0x2ddf, 0x25df, 0x159f, 0x055f, 0x25bf, 0xdf9f,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2104, 0xc69a, 0xbefc, 0x1d3d, 0x253d, 0xd71d, 0xef5c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x20e3, 0xcb4a, 0xe3ab, 0xdb8a, 0x3924,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xf369, 0xeb49, 0xdb08,
-  0xffe0, 0xef42, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0xffc5, 0xdef6, 0x2122, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x045a,
-  0xef5c, 0x6b4c, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c4, 0x04fd,
-  0xef5b, 0x6b49, 0xef60, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x049a, 0x055f,
-  0xffc4, 0xef61, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xab2b, 0x153e, 0x157f,
-  0xf7d9, 0xffe2, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x25bf, 0xcf7e,
-  0xefdc, 0xffc5, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e, 0xf7fe,
-  0xefde, 0xf7d7, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b, 0xf7fe,
-  0xf7f9, 0xe747, 0x2120, 0x1080, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcac7, 0xec0c, 0xdf5c,
-  0xffe4, 0xef55, 0x2102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x30a1, 0xc38b, 0x2d5d,
-  0xffc0, 0xffc2, 0xd6c0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0062, 0x0418, 0x1105, 0xca8a, 0xdb2c, 0x9e96, 0x0d7e,
-  0xffc2, 0xffe2, 0xef01, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0062, 0x151d, 0x151d, 0xd71d, 0xdf3e, 0x1d9e, 0x053f,
-  0xfffd, 0xff5a, 0xdbc9, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc69b, 0x2ddf, 0x25bf, 0x159f, 0x055f, 0x159f,
-  0xe6fb, 0xf42d, 0xdb29, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xe3cc, 0xef3c, 0xcf3c, 0x0cfc, 0x14fc, 0xc6dc,
-  0x20c3, 0xc2c8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xc2c8, 0xe38a, 0xcb49, 0x10a3, 0x0062, 0x10a2,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0x18c0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe700, 0xd6a1, 0xc621, 0x2120, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xf780, 0x6b67, 0x6b47, 0xdee0, 0xef40, 0xce41, 0x2100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0xffc0, 0xef40, 0xef41, 0xffe0, 0xf781, 0x7bc6, 0xce41, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a3, 0x047a,
-  0xffc2, 0xffe2, 0xffe0, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xa32b, 0x153e,
-  0xefdc, 0xf7d9, 0xffc2, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb09, 0x251c, 0x157f,
-  0xefde, 0xf7dc, 0xffc5, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xbb0a, 0x353c, 0xcf9e,
-  0xefde, 0xefde, 0xf7d7, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcbac, 0xf75b,
-  0xefdb, 0xf7fa, 0xe746, 0x2120, 0x1080, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xcae8, 0xf3ab,
-  0xffc2, 0xffe4, 0xef58, 0x2122, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x30a2, 0xdb69,
-  0xffc0, 0xffc2, 0xffd8, 0xef63, 0xdec0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xca8a, 0xdb4c, 0xaeb5,
-  0xffc0, 0xffc2, 0xffc4, 0xef60, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a3, 0x151d, 0x151d, 0xd71d, 0xd73e, 0x25be,
-  0xffe5, 0xfffa, 0xeef9, 0x2122, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb29, 0xdefc, 0x2ddf, 0x25df, 0x159f, 0x055f,
-  0xef5a, 0xff3c, 0xdbcc, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xd6bb, 0xbedc, 0x0cfc, 0x04dc,
-  0x20c3, 0xdb6a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x10a2, 0x0062, 0x0062,
-  0x1020, 0xd308, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef7, 0x2122, 0x10a0, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20c0, 0xd6a0, 0xffe2, 0xef79, 0x632c, 0xdec1, 0xef40, 0xce41,
-  0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdbe7, 0xff80, 0xffe2, 0xef58, 0x6b49, 0xef60, 0xf780, 0x7bc6,
-  0xce41, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0xff80, 0xffc0, 0xffc2, 0xffc4, 0xef61, 0xffc0, 0xffc0, 0xef61,
-  0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0xff80, 0xffc4, 0xf7da, 0xffda, 0xffe2, 0xffc0, 0xffc0, 0xffe0,
-  0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0xec0a, 0xf77a, 0xf7fe, 0xffdd, 0xffe5, 0xffe0, 0xffe0, 0xffe0,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0xebab, 0xef1b, 0xf7fe, 0xffdf, 0xe738, 0xe722, 0xef40, 0xd6a0,
-  0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe3aa, 0xec6c, 0xff9b, 0xef7b, 0x39c4, 0x10a0, 0x10a0, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020, 0x1020,
-  0xc732, 0xf762, 0xffc2, 0xffc2, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xcaaa, 0xe2eb,
-  0xf7c2, 0xffe0, 0xffc2, 0xffe2, 0xdec0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x151d, 0xd71d, 0xef5e,
-  0xffe0, 0xffe4, 0xfffb, 0xd6d9, 0x2102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xb65a, 0x2ddf, 0x25bf, 0x159f,
-  0xe722, 0xff99, 0xeefc, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6db, 0xcf3c, 0x0cfc,
-  0x20c1, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xe38a, 0x2904,
-  0x1020, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xeb69, 0xdb08,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2, 0x1080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef7, 0x2122, 0x10a0,
-  0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef79, 0x632c, 0xdec1, 0xef40,
-  0xce41, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2081, 0xcb86, 0xff80, 0xffe2, 0xef58, 0x6b49, 0xef60, 0xf780,
-  0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe388, 0xff21, 0xffe0, 0xffc2, 0xffc4, 0xef61, 0xffc0, 0xffc0,
-  0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdb88, 0xf721, 0xffe4, 0xf7da, 0xffda, 0xffe2, 0xffc0, 0xffc0,
-  0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2081, 0xdbc9, 0xf79a, 0xeffe, 0xf7dc, 0xffe5, 0xffe0, 0xffe0,
-  0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xd34a, 0xf73b, 0xf7fe, 0xf7df, 0xef58, 0xe722, 0xef40,
-  0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xd369, 0xf46c, 0xffbb, 0xef5b, 0x2124, 0x1080, 0x10a0,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000, 0x1020,
-  0xd32c, 0xc6d2, 0xf782, 0xffe2, 0xe722, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x1105, 0xcaaa,
-  0xff79, 0xf7c4, 0xffe0, 0xffe2, 0xef42, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x153d, 0xd71d,
-  0xffe2, 0xffe0, 0xffe4, 0xfffb, 0xd6b9, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xb65a, 0x2ddf, 0x2ddf,
-  0xff60, 0xff63, 0xff99, 0xd6bb, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xc67a, 0xcf1c,
-  0xebc9, 0xf3c9, 0xdb8a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0xeb49, 0xeb49, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef7, 0x2122,
-  0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef79, 0x632c, 0xdec1,
-  0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcb87, 0xff80, 0xffe2, 0xef58, 0x6b49, 0xef60,
-  0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc4, 0xef61, 0xffc0,
-  0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xcb27, 0xff21, 0xffe4, 0xf7da, 0xffda, 0xffe2, 0xffc0,
-  0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xdbc9, 0xf79a, 0xf7fe, 0xffdd, 0xffe5, 0xffe0,
-  0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb4a, 0xff3c, 0xf7fe, 0xffdf, 0xe738, 0xe722,
-  0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0x2061, 0xd36a, 0xf46c, 0xff9b, 0xef7b, 0x39c4, 0x10a0,
-  0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0000,
-  0xdacb, 0xd32c, 0xc6f2, 0xf782, 0xffc2, 0xffc2, 0xd6a0, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x0418, 0x00e5,
-  0xff7b, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffe2, 0xef01, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062, 0x151d, 0x04fd,
-  0xffe5, 0xffe3, 0xffe0, 0xffe5, 0xfffb, 0xff5a, 0xdbc9, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc69b, 0x2ddf,
-  0xdf36, 0xe722, 0xe721, 0xe758, 0xe6fc, 0xf40d, 0xdb29, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdbcc, 0xef1c,
-  0x1082, 0x1080, 0x1080, 0x1082, 0x20c2, 0xcae8, 0xcae8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2c8, 0xdb6a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef7,
-  0x2122, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef79, 0x632c,
-  0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcb87, 0xff80, 0xffe2, 0xef58, 0x6b49,
-  0xef60, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc4, 0xef61,
-  0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb47, 0xff21, 0xffe4, 0xf7da, 0xffda, 0xffe2,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xdbc9, 0xf79a, 0xeffe, 0xf7dc, 0xffe5,
-  0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb4a, 0xf73b, 0xf7fe, 0xf7df, 0xe738,
-  0xe702, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x2061, 0xd36a, 0xf46c, 0xff9b, 0xef7d, 0x39c5,
-  0x2120, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0062,
-  0x20c1, 0xca8a, 0xdb2c, 0xc6f2, 0xf782, 0xffc4, 0xffd8, 0xef42,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a3, 0x047a,
-  0xef22, 0xff78, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffc4, 0xef60,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x1020, 0xb30a, 0x2d7e,
-  0xffe3, 0xffe5, 0xffe2, 0xffe0, 0xffe5, 0xfffb, 0xeef9, 0x2122,
-  0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb8a, 0xdedb,
-  0xe73a, 0xdf37, 0xe721, 0xe721, 0xef58, 0xff3c, 0xdbcc, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb2a7, 0x28e3,
-  0x1082, 0x1082, 0x1080, 0x1080, 0x20e3, 0xdb8a, 0xe329, 0x2081,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xf36a, 0xcae8,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0,
-  0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe0,
-  0xdee0, 0x2120, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe0, 0xef61,
-  0x6327, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb87, 0xff81, 0xffe0, 0xef41,
-  0x6b47, 0xef61, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc0,
-  0xef60, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff21, 0xffe4, 0xf7d7, 0xffc5,
-  0xffe0, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xdbc9, 0xf79a, 0xeffe, 0xf7d7,
-  0xffe2, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb4a, 0xf73b, 0xf7fa, 0xf7c4,
-  0xe720, 0xe720, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x1080, 0x0000, 0x1020, 0x2061, 0xd36a, 0xf46a, 0xff83, 0xef60,
-  0x39c0, 0x10a0, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd6a0, 0x3960, 0xca8a, 0xdb2c, 0xc6f2, 0xf782, 0xffc0, 0xffc0,
-  0xd6a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xffe2, 0xef42, 0xff79, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffe3,
-  0xdec0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xef58, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe4, 0xfffb, 0xd6d9,
-  0x2102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2124, 0xd698, 0xf798, 0xff62, 0xff62, 0xff99, 0xeefc, 0x2124,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c3, 0xdb8a, 0xf3c9, 0xebc9, 0xf3cb, 0xdb6a, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xeb6a, 0xeb49, 0xeb69, 0xdb08, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef60,
-  0xef62, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd680, 0xffc4,
-  0xdef6, 0x2122, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef62, 0xef79,
-  0x632c, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffc2, 0xef58,
-  0x6b49, 0xef60, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xff81, 0xffe2, 0xffc4,
-  0xef61, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe4, 0xf7da, 0xf7d9,
-  0xffe2, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff23, 0xf7f9, 0xefde, 0xf7dc,
-  0xffc5, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf73b, 0xefde, 0xefde,
-  0xf7d7, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xec0c, 0xf79a, 0xf7fa,
-  0xe747, 0x2120, 0x10a0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1080, 0x0000, 0x1020, 0x3082, 0xdbc9, 0xff83, 0xffe4,
-  0xe736, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0xbe00, 0x3960, 0xca8a, 0xd32c, 0xc6f2, 0xf7c1, 0xffe0,
-  0xe722, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0xe722, 0xef62, 0xff79, 0xff99, 0xf7c4, 0xffc0, 0xffe2,
-  0xef42, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd696, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe4, 0xfffb,
-  0xd6b9, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2104, 0xd6b8, 0xe757, 0xf762, 0xff62, 0xff99, 0xd6bb,
-  0x2104, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x20e3, 0xdb88, 0xf3c9, 0xdb8a, 0x3103,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb09, 0xf36a, 0xeb69, 0xc2c7,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120,
-  0xef60, 0xef62, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd680,
-  0xffc4, 0xdef6, 0x2122, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef62,
-  0xef79, 0x632c, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffc2,
-  0xef58, 0x6b49, 0xef60, 0xf780, 0x7bc6, 0xce41, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xff81, 0xffe2,
-  0xffc4, 0xef61, 0xffc0, 0xffc0, 0xef61, 0xef40, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe4, 0xf7da,
-  0xf7d9, 0xffe2, 0xffc0, 0xffc0, 0xffe0, 0xef40, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff23, 0xf7f9, 0xefde,
-  0xf7dc, 0xffc5, 0xffe0, 0xffe0, 0xffe0, 0xd6a0, 0x1080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf73b, 0xefde,
-  0xefde, 0xf7d7, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xec0c, 0xf79a,
-  0xf7fa, 0xe747, 0x2120, 0x1080, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x3082, 0xdbc9, 0xff83,
-  0xffe4, 0xef56, 0x2102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0xc600, 0x3960, 0xca8a, 0xd32c, 0xc6f2, 0xf7c1,
-  0xffc0, 0xffc2, 0xd6c0, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0xe742, 0xef62, 0xff79, 0xff99, 0xf7c4, 0xffc0,
-  0xffc2, 0xffe2, 0xef01, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xe6f7, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe5,
-  0xfffb, 0xff5a, 0xdbc9, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdbcc, 0xff5a, 0xf798, 0xe721, 0xe721, 0xe758,
-  0xe6fc, 0xf40d, 0xdb29, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xc2c8, 0xdb6b, 0xc329, 0x20c0, 0x1080, 0x1082,
-  0x20c2, 0xcae8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2120, 0xef60, 0xef62, 0x1080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860,
-  0xd680, 0xffc4, 0xdef6, 0x2122, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120,
-  0xef62, 0xef79, 0x632c, 0xdec1, 0xef40, 0xce41, 0x2100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0,
-  0xffc2, 0xef58, 0x6b49, 0xef60, 0xf780, 0x7bc6, 0xc621, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xff81,
-  0xffe2, 0xffc4, 0xef61, 0xffc0, 0xffc0, 0xef61, 0xe720, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe4,
-  0xf7da, 0xf7d9, 0xffe2, 0xffc0, 0xffc0, 0xffe0, 0xe720, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff23, 0xf7f9,
-  0xefde, 0xf7dc, 0xffc5, 0xffe0, 0xffe0, 0xffe0, 0xd680, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf73b,
-  0xefde, 0xefde, 0xf7d7, 0xe742, 0xef40, 0xd6a0, 0x2100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xec0c,
-  0xf79a, 0xf7fa, 0xe746, 0x2120, 0x1080, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x3082, 0xdbc9,
-  0xff83, 0xffe4, 0xef58, 0x2122, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a0, 0xc600, 0x3961, 0xca8a, 0xd32c, 0xc6f2,
-  0xf7c1, 0xffc1, 0xffd8, 0xef63, 0xdec0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20c1, 0xef42, 0xef62, 0xff79, 0xff99, 0xf7c4,
-  0xffc0, 0xffc2, 0xffc4, 0xef60, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb2a, 0xff38, 0xffe5, 0xffe5, 0xffe2, 0xffe0,
-  0xffe5, 0xfffb, 0xeef9, 0x2122, 0x1080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xe6f9, 0xdf57, 0xe721, 0xe721,
-  0xef58, 0xff3c, 0xdbcc, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x1082, 0x1080, 0x1080,
-  0x20e3, 0xdb8a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb08, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2100, 0xdec0, 0xffe0, 0xdee0, 0x2120, 0x10a0, 0x10a0,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x20a0, 0xdea0, 0xffe0, 0xef61, 0x6327, 0xdec1, 0xef40, 0xdec1,
-  0x0562, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xcb87, 0xff81, 0xffe0, 0xef41, 0x6b47, 0xef61, 0xf780, 0x7367,
-  0x0602, 0x00a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47,
-  0xff41, 0xffe0, 0xffc2, 0xffc0, 0xef60, 0xffc0, 0xffc0, 0xef61,
-  0x0602, 0x00a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47,
-  0xff21, 0xffe4, 0xf7d7, 0xffc2, 0xffe0, 0xffc0, 0xffc0, 0xffe0,
-  0x0562, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061,
-  0xdbc9, 0xf79b, 0xf7fc, 0xffc2, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb4a, 0xf73b, 0xf7f9, 0xffc2, 0xe720, 0xe720, 0xe720, 0xe720,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x2061,
-  0xd36a, 0xf46a, 0xff83, 0xef60, 0x39c0, 0x10a0, 0x1080, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x3960, 0xca8a, 0xdb2c,
-  0xc6f2, 0xf782, 0xffc0, 0xffc0, 0xd6a0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xef42, 0xef62, 0xff79, 0xff99,
-  0xf7c4, 0xffe0, 0xffc2, 0xffe3, 0xdec0, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xd6b6, 0xffe5, 0xffe5, 0xffe2,
-  0xffe0, 0xffe4, 0xfffb, 0xd6d9, 0x2102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xe6f9, 0xf798, 0xe721,
-  0xe721, 0xff99, 0xeefc, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb6a, 0xe38b, 0x3101,
-  0x20c0, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xf369, 0xc2c8,
-  0x2061, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2, 0x0860, 0x0000,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef7, 0x2122, 0x10a0,
-  0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef79, 0x632c, 0xdec1, 0xef40,
-  0x3327, 0x0542, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xcb87, 0xff80, 0xffe2, 0xef58, 0x6b49, 0xef60, 0xffe0,
-  0x0623, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc4, 0xef61, 0xffc0, 0xffe0,
-  0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020,
-  0xcb47, 0xff21, 0xffe4, 0xf7da, 0xffda, 0xffe2, 0xffc0, 0xffe0,
-  0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xdbc9, 0xf79a, 0xeffe, 0xf7dc, 0xffe5, 0xffe0, 0xffe0,
-  0x0562, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb4a, 0xf73b, 0xf7fe, 0xf7df, 0xef58, 0xe722, 0xe720,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020,
-  0x2061, 0xd36a, 0xf46c, 0xffbb, 0xef5b, 0x2124, 0x1080, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x3960, 0xca8a,
-  0xdb2c, 0xc6f2, 0xf782, 0xffe2, 0xe722, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef42, 0xef62, 0xff79,
-  0xff99, 0xf7c4, 0xffe0, 0xffe2, 0xef42, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6b6, 0xffe5, 0xffe5,
-  0xffe2, 0xffe0, 0xffe4, 0xfffb, 0xd6b9, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6b8, 0xe757,
-  0xf762, 0xff62, 0xff99, 0xd6bb, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x20e3,
-  0xdb88, 0xf3c9, 0xdb8a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820,
-  0xdb09, 0xf36a, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xd6a2, 0x1080,
-  0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xdef6, 0x2942,
-  0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef79, 0x6b2c, 0xdec1,
-  0x0623, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcb87, 0xff80, 0xffe2, 0xef58, 0x6b49, 0xef60,
-  0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc4, 0xef61, 0xffc0,
-  0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xcb47, 0xff21, 0xffe4, 0xf7da, 0xffda, 0xffe2, 0xffe0,
-  0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xdbc9, 0xf79a, 0xf7fe, 0xffdd, 0xffe5, 0xffe0,
-  0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb4a, 0xff3c, 0xf7fe, 0xffdf, 0xe738, 0xe722,
-  0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000,
-  0x1020, 0x2061, 0xd36a, 0xf46c, 0xff9b, 0xef7b, 0x31a4, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x3960,
-  0xca8a, 0xdb2c, 0xc6f2, 0xf782, 0xffc2, 0xffc2, 0xd680, 0x1080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xe742, 0xef62,
-  0xff79, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffe2, 0xe6e1, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xe6f7, 0xffe5,
-  0xffe5, 0xffe2, 0xffe0, 0xffe5, 0xfffb, 0xff5a, 0xdba9, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdbcc, 0xff3a,
-  0xe757, 0xe721, 0xe721, 0xe758, 0xe6fc, 0xf40d, 0xdb09, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2e8, 0xcb2a,
-  0x20c3, 0x1080, 0x1080, 0x1082, 0x20c2, 0xcae8, 0xc2c8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x10a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xd6a0, 0xef42,
-  0x0080, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe4, 0xf799,
-  0x05e2, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe2, 0xef59, 0x5acd,
-  0x0682, 0x0623, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcb87, 0xff80, 0xffe2, 0xef58, 0x5aea,
-  0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc2, 0xffc4, 0xef61,
-  0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb47, 0xff21, 0xffe4, 0xf7da, 0xffda, 0xffe2,
-  0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xdbc9, 0xf79a, 0xeffe, 0xf7dc, 0xffe5,
-  0x05e2, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb4a, 0xf73b, 0xf7fe, 0xf7de, 0xe73a,
-  0x0100, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080,
-  0x0000, 0x1020, 0x2061, 0xd36a, 0xf46c, 0xff9b, 0xef5d, 0x39c5,
-  0x0562, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e0, 0xc620,
-  0x3960, 0xca8a, 0xdb2c, 0xc6f2, 0xf782, 0xffc4, 0xffd7, 0xef42,
-  0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff83,
-  0xef62, 0xff79, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffc4, 0xef60,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xeef7,
-  0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe5, 0xfffb, 0xe6f9, 0x2922,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb287, 0x3165,
-  0xd6b8, 0xe757, 0xe721, 0xe721, 0xef58, 0xff3c, 0xdbac, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x1082, 0x1082, 0x1080, 0x1080, 0x20e3, 0xdb8a, 0xdb28, 0x2881,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xeb69, 0xdb29,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0,
-  0x1584, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xd680,
-  0xc6d9, 0x1122, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2100, 0xdec0, 0xffe2,
-  0x4aaa, 0x0da3, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffe5, 0xfffb,
-  0x32a8, 0x0623, 0x0643, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xff83, 0xfff8, 0xfffc,
-  0x0623, 0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe0, 0xffc5, 0xffe5,
-  0x0682, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff21, 0xffe4, 0xf7d9, 0xfffc,
-  0x16a5, 0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xdbc9, 0xf79a, 0xeffe, 0xf7fe,
-  0xc6f8, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb4a, 0xf73b, 0xf7de, 0xffff,
-  0x1102, 0x0080, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1080, 0x0000, 0x1020, 0x2061, 0xd36a, 0xf46c, 0xff9b, 0xfffd,
-  0x0561, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0,
-  0xc600, 0x3960, 0xca8a, 0xdb2c, 0xc6f2, 0xf782, 0xffc2, 0xffe2,
-  0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0,
-  0xef42, 0xef62, 0xff79, 0xff99, 0xf7c4, 0xffe0, 0xffc2, 0xffe2,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082,
-  0xd6b6, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe4, 0xffda, 0xef5a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0xd6b8, 0xf798, 0xff62, 0xff62, 0xff99, 0xe6db, 0x2925,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c3, 0xdb8a, 0xf3c9, 0xebc9, 0xf3cb, 0xdb6a, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xeb6a, 0xeb49, 0xeb69, 0xdb08, 0x1040,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0x18c0,
-  0x0502, 0x0100, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0860, 0xd680, 0xd6a1,
-  0x3307, 0x05a3, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xdee0, 0x7387,
-  0x0623, 0x0682, 0x0623, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffc0, 0xef60,
-  0x0682, 0x0682, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xff81, 0xffe2, 0xffe2,
-  0x0662, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe4, 0xf7d9, 0xf7fc,
-  0x1685, 0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xcb47, 0xff23, 0xf7f9, 0xefde, 0xf7fe,
-  0xb777, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf73b, 0xefde, 0xf7fe,
-  0x2e27, 0x0101, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xec0c, 0xf79a, 0xf7fb,
-  0xbef8, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1080, 0x0000, 0x1020, 0x3082, 0xdbc9, 0xff83, 0xffe2,
-  0x1604, 0x00a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0xc600, 0x3960, 0xca8a, 0xd32c, 0xc6f2, 0xf7c1, 0xffe0,
-  0x1604, 0x00a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0xef42, 0xef62, 0xff79, 0xff99, 0xf7c4, 0xffc0, 0xffe2,
-  0xc678, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xd6b6, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe5, 0xfffb,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2104, 0xd6b8, 0xe757, 0xf762, 0xff62, 0xff79, 0xe73d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x20e3, 0xdb88, 0xf3c9, 0xdb8a, 0x3924,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb09, 0xf36a, 0xeb49, 0xdb08,
-  0x0682, 0x1624, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0,
-  0x2ea7, 0xb6b6, 0x1102, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0xd680,
-  0xdf5c, 0x5b2c, 0x05a2, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2120, 0xef40,
-  0xdf3b, 0x4309, 0x0622, 0x0643, 0x2b67, 0x0522, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20a0, 0xdea0, 0xffc0,
-  0x26a6, 0x0e23, 0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcb86, 0xffa0, 0xffe2,
-  0xc799, 0x16a4, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffc4, 0xf7f9,
-  0xdfdc, 0x2ea7, 0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff23, 0xf7f9, 0xf7fe,
-  0xf7de, 0xbf78, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf75b, 0xf7fe,
-  0xcfba, 0x3e49, 0x00e0, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xec0c, 0xf79a,
-  0x26c6, 0xaef6, 0x1102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x3082, 0xdbc9, 0xff83,
-  0x0662, 0x0e84, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0xc600, 0x3960, 0xca8a, 0xd32c, 0xc6f1, 0xf7e1,
-  0x1685, 0x16a4, 0x15c3, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0xe742, 0xef62, 0xff79, 0xff99, 0xf7c4, 0xffe0,
-  0xefdd, 0xef3a, 0xcbaa, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xe6f7, 0xffe5, 0xffe5, 0xffe2, 0xffe0, 0xffe2,
-  0xeefb, 0xf42d, 0xe329, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdbcc, 0xff5a, 0xf798, 0xe721, 0xe722, 0xe738,
-  0x20c3, 0xc2c8, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xc2c8, 0xdb6b, 0xc329, 0x20c0, 0x1080, 0x1082,
-  0x0000, 0x1040, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x1040, 0x1020, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x00a0, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x05e2, 0x0583, 0x0502, 0x00e0, 0x0080, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0643, 0x3307, 0x32e7, 0x05a2, 0x0602, 0x0522, 0x00e0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080,
-  0x0662, 0x0602, 0x0603, 0x0682, 0x0623, 0x2b67, 0x0522, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x20c0, 0xd6a0,
-  0x1684, 0x16a4, 0x0682, 0x0682, 0x0662, 0x0643, 0x0602, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xcba6, 0xffa0,
-  0xdfbc, 0xcfb9, 0x1684, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff41, 0xffe2,
-  0xf7de, 0xe7dc, 0x26a7, 0x0682, 0x0682, 0x0682, 0x0582, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xff44, 0xf7f9,
-  0xf7de, 0xf7de, 0xbf77, 0x1604, 0x0602, 0x0582, 0x00e0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2061, 0xdbca, 0xf73b,
-  0xdfbc, 0xcfba, 0x3648, 0x00e0, 0x0060, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xc2c8, 0xebab,
-  0x1684, 0x26c7, 0xc718, 0x1102, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x30a2, 0xd36a,
-  0x0661, 0x1684, 0xc798, 0x1645, 0x0581, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a0, 0xc600, 0x3961, 0xca8a, 0xdb4c, 0xc6d3,
-  0x0662, 0x1685, 0x26a6, 0x0622, 0x0582, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20c1, 0xef42, 0xef62, 0xff79, 0xff99, 0xf7c4,
-  0x2ec7, 0xd7db, 0xd6f9, 0x1102, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xcb2a, 0xff38, 0xffe5, 0xffe5, 0xffe3, 0xffe0,
-  0xd73b, 0xff3c, 0xe3cc, 0x1020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xdb29, 0xe3cc, 0xe6f9, 0xdf57, 0xe722, 0xe720,
-  0x28e3, 0xdb6a, 0xe329, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1040, 0xb2a7, 0x2081, 0x1082, 0x1082, 0x1080, 0x1080,
-  0x1020, 0xd308, 0xf36a, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7, 0x1102, 0x0080, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a1, 0x0562, 0x16c4, 0xcf3a, 0x5b2c, 0x05a2, 0x0602, 0x0522,
-  0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb3a8, 0x1622, 0x0ea4, 0xc739, 0x430a, 0x0622, 0x0643, 0x2b67,
-  0x0522, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x1643, 0x0662, 0x1684, 0x26a6, 0x0e23, 0x0662, 0x0662, 0x0643,
-  0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0x1643, 0x26a6, 0xcfba, 0xd7bb, 0x16a4, 0x0662, 0x0662, 0x06a2,
-  0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xcae8,
-  0xdc0a, 0xdf7a, 0xf7fe, 0xefdd, 0x2ec7, 0x0682, 0x0682, 0x0682,
-  0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0xf3ab, 0xf71b, 0xf7fe, 0xffdf, 0xc6f9, 0x1604, 0x0602, 0x0582,
-  0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xebaa, 0xdc4c, 0xe79b, 0xd75b, 0x21a4, 0x0080, 0x0080, 0x0060,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020, 0x1020,
-  0x9f12, 0x2644, 0x1684, 0x0e84, 0x0582, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x3960, 0xc28a, 0xdaeb,
-  0x0e84, 0x0682, 0x1684, 0x16a4, 0x05a2, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a0, 0xef42, 0xef62, 0xff78, 0xff9b,
-  0x0682, 0x26a6, 0xd7bb, 0xc6b9, 0x1102, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xd6b6, 0xffe5, 0xffe5, 0xffe3,
-  0x1604, 0xd759, 0xeefb, 0x2104, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xe6f9, 0xf797, 0xe722,
-  0x10c1, 0xdb8a, 0xe38a, 0x2081, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb6a, 0xdb8a, 0x3921,
-  0x1020, 0xd308, 0xf369, 0xcae8, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdb08, 0xeb69, 0xdb09,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4, 0x0060, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7, 0x1102, 0x0080,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c, 0x05a2, 0x0602,
-  0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2081, 0xa347, 0x1642, 0x0ea4, 0xc739, 0x430a, 0x0622, 0x0643,
-  0x2b67, 0x0522, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xcb68, 0x2603, 0x0682, 0x1684, 0x26a6, 0x0e23, 0x0662, 0x0662,
-  0x0643, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xcb68, 0x25e3, 0x26a6, 0xcfba, 0xd7ba, 0x16a4, 0x0662, 0x0662,
-  0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xcba9, 0xe77a, 0xf7fe, 0xe7dc, 0x2ec7, 0x0682, 0x0682,
-  0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0xdb4a, 0xff3b, 0xf7fe, 0xffdf, 0xc719, 0x1604, 0x0602,
-  0x0582, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2061, 0xd369, 0xdc4c, 0xe79b, 0xd73b, 0x2124, 0x0080, 0x0080,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000, 0x1020,
-  0xdb4c, 0xa6b2, 0x1e44, 0x1684, 0x0e04, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x3961, 0xc28a,
-  0xd759, 0x26a6, 0x0682, 0x16a4, 0x1624, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xef42, 0xef62, 0xff78,
-  0x0ea4, 0x0682, 0x26c6, 0xdfdb, 0xceb9, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6b6, 0xffe5, 0xffe5,
-  0x1622, 0x2645, 0xd759, 0xdebb, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6b8, 0xe759,
-  0xdba9, 0xdba9, 0xe38a, 0x3103, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x1082,
-  0xf369, 0xf369, 0xeb69, 0xc2c7, 0x1040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4, 0x0060,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7, 0x1102,
-  0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c, 0x05a2,
-  0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xab67, 0x1642, 0x0ea4, 0xc739, 0x430a, 0x0622,
-  0x0643, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb27, 0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23, 0x0662,
-  0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0xbb07, 0x2603, 0x26a6, 0xcfba, 0xd7bb, 0x16a4, 0x0662,
-  0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xefdd, 0x2ec7, 0x0682,
-  0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb4a, 0xff3c, 0xf7fe, 0xffdf, 0xc6f9, 0x1604,
-  0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1020, 0x2061, 0xd36a, 0xdc4c, 0xe79b, 0xd75b, 0x21a4, 0x0080,
-  0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080, 0x0000,
-  0xdacb, 0xdb2c, 0xa6b2, 0x1e44, 0x1684, 0x0e84, 0x0582, 0x0060,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xc600, 0x2940,
-  0xe75b, 0xd759, 0x1ea6, 0x0682, 0x1684, 0x16a4, 0x15c3, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a0, 0xe742, 0xef60,
-  0x2ec7, 0x16a5, 0x0682, 0x26c7, 0xdfdb, 0xef3a, 0xcbaa, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xe6f6, 0xffe5,
-  0xb6f7, 0x0e04, 0x0e03, 0xc719, 0xeefb, 0xf40d, 0xe329, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xdbcc, 0xff5a,
-  0x1082, 0x0080, 0x0080, 0x1082, 0x20c2, 0xcae8, 0xcae8, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xc2c8, 0xdb6a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080, 0x0080,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x15a4,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x26c6, 0xbed7,
-  0x1102, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x16c4, 0xcf3a, 0x5b2c,
-  0x05a2, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xab67, 0x1642, 0x0ea4, 0xc739, 0x430a,
-  0x0622, 0x0643, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb28, 0x2623, 0x0682, 0x1684, 0x26a6, 0x0e23,
-  0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0xbb27, 0x2603, 0x26a6, 0xcfba, 0xd7ba, 0x16a4,
-  0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2061, 0xcbaa, 0xe77a, 0xf7fe, 0xe7dc, 0x2ec7,
-  0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xdb4a, 0xff3b, 0xf7fe, 0xffdf, 0xc6f9,
-  0x15e4, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1020, 0x2061, 0xd36a, 0xdc4c, 0xef9c, 0xef7d, 0x29a5,
-  0x0100, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1080,
-  0x10a1, 0xca8a, 0xdb4c, 0xa6b2, 0x1e44, 0x26a6, 0xc778, 0x1624,
-  0x0581, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x20e0, 0xd6a0,
-  0x1604, 0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684, 0x26a6, 0x0622,
-  0x0582, 0x0080, 0x0000, 0x0000, 0x0000, 0x1020, 0xcb47, 0xffa3,
-  0x1ec5, 0x26c7, 0x16a5, 0x0682, 0x26c7, 0xdfdb, 0xd6f9, 0x1102,
-  0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x1020, 0xdb8a, 0xeef9,
-  0xd71a, 0xbef7, 0x0e03, 0x0e03, 0xc719, 0xff5c, 0xe3cc, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0xb2a7, 0x28e3,
-  0x10a2, 0x1082, 0x0080, 0x0080, 0x20e3, 0xdb8a, 0xe329, 0x2081,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0xdb08, 0xf36a, 0xcae8,
-  0x1040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0080,
-  0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582,
-  0x0582, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e0, 0x0582, 0x06a2,
-  0x05c2, 0x0100, 0x0080, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a1, 0x0582, 0x06a2, 0x0623,
-  0x32e7, 0x05a3, 0x0602, 0x0522, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xab67, 0x1643, 0x0682, 0x0603,
-  0x32e7, 0x0623, 0x0643, 0x2b67, 0x0522, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb28, 0x2623, 0x0682, 0x1684, 0x0662,
-  0x0623, 0x0662, 0x0662, 0x0643, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1020, 0xbb27, 0x2603, 0x26a6, 0xbf98, 0x2ea7,
-  0x0682, 0x0662, 0x0662, 0x06a2, 0x0602, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2061, 0xcbaa, 0xe79a, 0xf7fe, 0xbf98,
-  0x16a4, 0x0682, 0x0682, 0x0682, 0x0582, 0x0080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xdb4a, 0xff3b, 0xcfba, 0x26a6,
-  0x05e2, 0x05e2, 0x0602, 0x0582, 0x00e0, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x0000, 0x1020, 0x2061, 0xdb6a, 0xcc2a, 0x2665, 0x0602,
-  0x0160, 0x0080, 0x0080, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0561, 0x1121, 0xca8a, 0xdb4c, 0xa6b2, 0x1e44, 0x0661, 0x0682,
-  0x0582, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x16a4, 0x1624, 0xd739, 0xdf5a, 0x1ea6, 0x0682, 0x1684, 0x16a5,
-  0x05a2, 0x0080, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc718, 0x2ec7, 0x26c7, 0x16a5, 0x0682, 0x26c6, 0xdfbb, 0xc6b9,
-  0x1102, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2124, 0xc698, 0xcf58, 0x1e44, 0x2644, 0xdf59, 0xeefb, 0x2924,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x20c3, 0xdb8a, 0xdba9, 0xdba9, 0xf3cb, 0xdb6a, 0x1020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xdb08, 0xf36a, 0xf369, 0xf369, 0xdb08, 0x1040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation dinos_colorsAnimation = {
-  .name = "Dinos Colors",
-  .frameCount = 48,
-  .width = 16,
-  .height = 16,
-  .frameDurations = dinos_colorsDurations,
-  .animationFrames = dinos_colorsFrames
-};
-#endif // ANIMATION_DINOS_COLORS_H
@@ -1,918 +0,0 @@
-// ducks_colors.h - Auto-generated from ducks_colors.json
-#ifndef ANIMATION_DUCKS_COLORS_H
-#define ANIMATION_DUCKS_COLORS_H
-
-#include "animation_types.h"
-
-// Frame Durations for ducks_colors (in 100ms units)
-static const uint8_t PROGMEM ducks_colorsDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for ducks_colors
-static const uint16_t PROGMEM ducks_colorsFrames[] = {
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0x0000, 0xffff,
-  0xdc80, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x0000, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xdc80, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x0000, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x0000, 0x0000, 0x8c51, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x0000, 0x8c51, 0x8c51, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0xbdd7, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025c, 0x025c, 0x025c,
-  0x025c, 0x025c, 0x025c, 0x025c, 0x027d, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x08c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c4, 0x0064, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x08c6, 0xa4f3, 0xe73c, 0xef5c,
-  0xef5c, 0xe73d, 0xef5d, 0xd6ba, 0x10a4, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x0883, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x10a4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x10a4, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x10c4, 0x025d, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0884, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x10e5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x10c4, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x10c4, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x08a5, 0x6b4c, 0x840f, 0xad54, 0xe71b, 0xe73c,
-  0xe73c, 0xe73c, 0xef3c, 0xd6ba, 0x10e6, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x025a, 0x0883, 0x0883, 0x08a4, 0x10c4, 0x10c5,
-  0x10c5, 0x10c5, 0x10c4, 0x10c4, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0087, 0x023a, 0x027c, 0x025c, 0x025c,
-  0x025c, 0x027c, 0x023a, 0x0086, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x027d, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x025c, 0x025c,
-  0x025c, 0x025c, 0x025c, 0x025c, 0x027c, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x08c6, 0x10e5, 0x10e5,
-  0x10e5, 0x10e5, 0x10e5, 0x10c5, 0x0065, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x08c6, 0xa4f3, 0xe73c, 0xef5c,
-  0xef5c, 0xe73d, 0xef5d, 0xd6ba, 0x10a4, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x0883, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x10a4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x10a4, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x10c4, 0x025d, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0884, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x10e5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x10c4, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x08a5, 0x6b2c, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x10c4, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x08a5, 0x10a2, 0xa4f3, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x10e6, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x0218, 0x0044, 0x08a4, 0x10c5, 0x10c5,
-  0x10c5, 0x10c4, 0x10a2, 0x10e6, 0x025b, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x00c9, 0x023a, 0x027c, 0x025c, 0x025c,
-  0x027c, 0x023a, 0x0066, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025c, 0x025c, 0x025c,
-  0x025c, 0x025c, 0x025c, 0x025c, 0x027d, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x08c6, 0x10c5, 0x10c5,
-  0x10c5, 0x10c5, 0x10c5, 0x10c4, 0x0064, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x08c6, 0xa4f3, 0xe73c, 0xef5c,
-  0xef5c, 0xe73d, 0xef5d, 0xd6ba, 0x10a4, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x0883, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x10a4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x10a4, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x10c4, 0x025d, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2124, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x08a4, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0884, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x10e5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x10c5, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x10c4, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x10c4, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x08a5, 0x6b2c, 0x8410, 0xad54, 0xe71b, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x10e6, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x08a5, 0x0841, 0x08a4, 0x10c5, 0x10c5,
-  0x10c5, 0x10c4, 0x10a2, 0x10e6, 0x025b, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0086, 0x023a, 0x027c, 0x025c,
-  0x027c, 0x023a, 0x0066, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0x981c, 0x901c, 0x901c,
-  0x901c, 0x901c, 0x901c, 0x901c, 0x981c, 0xa01f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0x901b, 0x2866, 0x20a5, 0x20a5,
-  0x20a5, 0x20a5, 0x20a5, 0x2085, 0x1805, 0x981c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x2066, 0x9d13, 0xe73c, 0xe75c,
-  0xe75c, 0xe75d, 0xe75d, 0xd6ba, 0x1884, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1863, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3104, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1884, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x2864, 0x981c, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x2864, 0x981d, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e4, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75c, 0x1885, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981d, 0x1844, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0x981d, 0x881a, 0x20a5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1004, 0x18a4, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1845, 0x634c, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x20a4, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x901b, 0x2045, 0x10a2, 0x9d13, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x2886, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x8018, 0x1004, 0x1864, 0x2085, 0x2085,
-  0x2085, 0x2084, 0x10a2, 0x2886, 0x901b, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x981d, 0x3009, 0x881a, 0x981c, 0x981c, 0x981c,
-  0x981c, 0x881a, 0x2006, 0x881a, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa01f, 0x981c, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0x981d, 0xa81f, 0xa81f, 0xa01f, 0xa01f, 0xa01f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0x981c, 0x901c, 0x901c,
-  0x901c, 0x901c, 0x901c, 0x901c, 0x981d, 0xa01f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0x901b, 0x2066, 0x20a5, 0x20a5,
-  0x20a5, 0x20a5, 0x20a5, 0x2084, 0x1804, 0x981c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x2066, 0x9d13, 0xe73c, 0xe75c,
-  0xe75c, 0xe75d, 0xe75d, 0xd6ba, 0x1884, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1863, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3104, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1884, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x2864, 0x981c, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x2864, 0x981d, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e4, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75c, 0x1885, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981d, 0x1844, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0x981d, 0x881a, 0x20a5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1004, 0x18a4, 0x7bcf, 0xbdf7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x20a4, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x2045, 0x634c, 0x7c0f, 0xa554, 0xdf1b, 0xe73c,
-  0xe73c, 0xe73c, 0xe75c, 0xd6ba, 0x2886, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x901a, 0x1043, 0x1043, 0x1864, 0x2084, 0x2085,
-  0x2085, 0x2085, 0x20a4, 0x1884, 0x901a, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x981d, 0x2007, 0x881a, 0x981c, 0x981c, 0x981c,
-  0x981c, 0x981c, 0x881a, 0x2006, 0x981d, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa01f, 0x981d, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0xa81f, 0x981d, 0xa01f, 0xa81f, 0xa01f, 0xa01f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0x981c, 0x901c, 0x901c,
-  0x901c, 0x901c, 0x901c, 0x901c, 0x981c, 0xa01f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0x901b, 0x2866, 0x20a5, 0x20a5,
-  0x20a5, 0x20a5, 0x20a5, 0x2085, 0x1805, 0x981c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x2066, 0x9d13, 0xe73c, 0xe75c,
-  0xe75c, 0xe75d, 0xe75d, 0xd6ba, 0x1884, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1863, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3104, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1884, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x2864, 0x981c, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x2864, 0x981d, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e4, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75c, 0x1885, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981d, 0x1844, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0x981d, 0x881a, 0x20a5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1004, 0x18a4, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1845, 0x634c, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x20a4, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x901b, 0x2045, 0x10a2, 0x9d13, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x2886, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x8018, 0x1004, 0x1864, 0x2085, 0x2085,
-  0x2085, 0x2084, 0x10a2, 0x2886, 0x901b, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x981d, 0x3009, 0x881a, 0x981c, 0x981c, 0x981c,
-  0x981c, 0x881a, 0x2006, 0x881a, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa01f, 0x981c, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0x981d, 0xa81f, 0xa81f, 0xa01f, 0xa01f, 0xa01f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0xa81f, 0x981c, 0x901c, 0x901c,
-  0x901c, 0x901c, 0x901c, 0x901c, 0x981d, 0xa01f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0x901b, 0x2066, 0x20a5, 0x20a5,
-  0x20a5, 0x20a5, 0x20a5, 0x2084, 0x1804, 0x981c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x2066, 0x9d13, 0xe73c, 0xe75c,
-  0xe75c, 0xe75d, 0xe75d, 0xd6ba, 0x1884, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1863, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3104, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1884, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x2864, 0x981c, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x2864, 0x981d, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e4, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981c, 0x1864, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75c, 0x1885, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x981d, 0x1844, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0x981d, 0x881a, 0x20a5, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x20a5, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1004, 0x18a4, 0x7bcf, 0xbdf7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x20a4, 0x901c, 0xa81f, 0xa81f,
-  0xa81f, 0x981d, 0x1845, 0x634c, 0x8410, 0xad54, 0xdf1b, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x2886, 0x901c, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x901b, 0x2045, 0x0841, 0x1864, 0x2085, 0x2085,
-  0x2085, 0x2084, 0x10a2, 0x2886, 0x901b, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x881a, 0x2006, 0x881a, 0x981c, 0x981c,
-  0x981c, 0x881a, 0x2006, 0x881a, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0xa81f, 0xa81f, 0x981d, 0xa81f, 0xa81f, 0xa81f,
-  0xa81f, 0xa81f, 0x981d, 0xa81f, 0xa81f, 0xa01f, 0xa01f, 0xa01f,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd800, 0x3061, 0x28a2, 0x28a2,
-  0x28a2, 0x28a2, 0x28a2, 0x2882, 0x2800, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x3061, 0x9d14, 0xe73c, 0xe75d,
-  0xe75d, 0xe75d, 0xe75d, 0xcebb, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x1861, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3102, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2082, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e2, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2041, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x28a2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2000, 0x20a2, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2841, 0x634d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd800, 0x2841, 0x10a2, 0x9d14, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x3082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xc000, 0x2000, 0x2061, 0x2882, 0x2882,
-  0x2882, 0x2082, 0x10a2, 0x3082, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0x4800, 0xd000, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xd000, 0x3000, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd800, 0x3061, 0x28a2, 0x28a2,
-  0x28a2, 0x28a2, 0x28a2, 0x2082, 0x2000, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x3061, 0x9d14, 0xe73c, 0xe75d,
-  0xe75d, 0xe75d, 0xe75d, 0xcebb, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x1861, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3102, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2082, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e2, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2041, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x28a2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2000, 0x20a2, 0x7bcf, 0xbdf7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2841, 0x634d, 0x7c10, 0xa555, 0xdf1c, 0xe73c,
-  0xe73c, 0xe73c, 0xe75d, 0xd6ba, 0x3082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x1841, 0x1841, 0x2061, 0x2082, 0x2882,
-  0x2882, 0x2882, 0x2082, 0x2082, 0xd000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0x3800, 0xd000, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xd000, 0x3000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd800, 0x3061, 0x28a2, 0x28a2,
-  0x28a2, 0x28a2, 0x28a2, 0x2882, 0x2800, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x3061, 0x9d14, 0xe73c, 0xe75d,
-  0xe75d, 0xe75d, 0xe75d, 0xcebb, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x1861, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3102, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2082, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e2, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2041, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x28a2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2000, 0x20a2, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2841, 0x634d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd800, 0x2841, 0x10a2, 0x9d14, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x3082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xc000, 0x2000, 0x2061, 0x2882, 0x2882,
-  0x2882, 0x2082, 0x10a2, 0x3082, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0x4800, 0xd000, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xd000, 0x3000, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd800, 0x3061, 0x28a2, 0x28a2,
-  0x28a2, 0x28a2, 0x28a2, 0x2082, 0x2000, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x3061, 0x9d14, 0xe73c, 0xe75d,
-  0xe75d, 0xe75d, 0xe75d, 0xcebb, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x1861, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3102, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2082, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x3060, 0xe000, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x30e2, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe000, 0x2061, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x2082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2041, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x28a2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2000, 0x20a2, 0x7bcf, 0xbdf7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20a2, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xe800, 0x2841, 0x634d, 0x8410, 0xa555, 0xdf1c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd6ba, 0x3082, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd800, 0x2841, 0x0841, 0x2061, 0x2882, 0x2882,
-  0x2882, 0x2082, 0x10a2, 0x3082, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd000, 0x3000, 0xd000, 0xe000, 0xe000,
-  0xe000, 0xd000, 0x3000, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xe240, 0xe240, 0xe240,
-  0xe240, 0xe240, 0xe240, 0xe240, 0xe260, 0xfa80, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xda40, 0x30c1, 0x28e2, 0x28e2,
-  0x28e2, 0x28e2, 0x28e2, 0x28c2, 0x2860, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe260, 0x30c1, 0x9cf4, 0xe73c, 0xe75d,
-  0xe75d, 0xe73d, 0xe75d, 0xcebb, 0x20a2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x1881, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a2, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x30a0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x30c0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xea60, 0x2081, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfa80, 0xea60, 0xd220, 0x28e2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x2040, 0x20c2, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x28a1, 0x632d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xda40, 0x28a1, 0x10a2, 0x9cf4, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x30e2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xc200, 0x2040, 0x20a1, 0x28c2, 0x28c2,
-  0x28c2, 0x20c2, 0x10a2, 0x30e2, 0xda40, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xea60, 0x48c0, 0xd220, 0xe260, 0xe240, 0xe240,
-  0xe260, 0xd220, 0x3060, 0xd220, 0xfaa0, 0xfaa0, 0xfa80, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfa80, 0xe260, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xea60, 0xfaa0, 0xfaa0, 0xfa80, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xe240, 0xe240, 0xe240,
-  0xe240, 0xe240, 0xe240, 0xe240, 0xea60, 0xfa80, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xda40, 0x30c1, 0x28c2, 0x28c2,
-  0x28c2, 0x28c2, 0x28c2, 0x20c2, 0x2060, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe260, 0x30c1, 0x9cf4, 0xe73c, 0xe75d,
-  0xe75d, 0xe73d, 0xe75d, 0xcebb, 0x20a2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x1881, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a2, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x30a0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x30c0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xea60, 0x2081, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfa80, 0xea60, 0xd220, 0x28e2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x2040, 0x20c2, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x28a1, 0x634d, 0x7c10, 0xa555, 0xdf1c, 0xe73c,
-  0xe73c, 0xe73c, 0xe73d, 0xd6ba, 0x30e2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xd240, 0x1881, 0x1881, 0x20a1, 0x20c2, 0x28c2,
-  0x28c2, 0x28c2, 0x20c2, 0x20c2, 0xd240, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xea60, 0x3880, 0xd220, 0xe260, 0xe240, 0xe240,
-  0xe240, 0xe260, 0xd220, 0x3080, 0xea60, 0xfaa0, 0xfa80, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfa80, 0xea60, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xea60, 0xfa80, 0xfaa0, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xe240, 0xe240, 0xe240,
-  0xe240, 0xe240, 0xe240, 0xe240, 0xe260, 0xfa80, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xda40, 0x30c1, 0x28e2, 0x28e2,
-  0x28e2, 0x28e2, 0x28e2, 0x28c2, 0x2860, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe260, 0x30c1, 0x9cf4, 0xe73c, 0xe75d,
-  0xe75d, 0xe73d, 0xe75d, 0xcebb, 0x20a2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x1881, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a2, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x30a0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x30c0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xea60, 0x2081, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfa80, 0xea60, 0xd220, 0x28e2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x2040, 0x20c2, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x28a1, 0x632d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xda40, 0x28a1, 0x10a2, 0x9cf4, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x30e2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xc200, 0x2040, 0x20a1, 0x28c2, 0x28c2,
-  0x28c2, 0x20c2, 0x10a2, 0x30e2, 0xda40, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xea60, 0x48c0, 0xd220, 0xe260, 0xe240, 0xe240,
-  0xe260, 0xd220, 0x3060, 0xd220, 0xfaa0, 0xfaa0, 0xfa80, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfa80, 0xe260, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xea60, 0xfaa0, 0xfaa0, 0xfa80, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xe240, 0xe240, 0xe240,
-  0xe240, 0xe240, 0xe240, 0xe240, 0xea60, 0xfa80, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xda40, 0x30c1, 0x28c2, 0x28c2,
-  0x28c2, 0x28c2, 0x28c2, 0x20c2, 0x2060, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe260, 0x30c1, 0x9cf4, 0xe73c, 0xe75d,
-  0xe75d, 0xe73d, 0xe75d, 0xcebb, 0x20a2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x1881, 0xad75, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef3a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a2, 0x94d3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x30a0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd480, 0x30c0, 0xe240, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3122, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xe240, 0x20a1, 0xad75, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xea60, 0x2081, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfa80, 0xea60, 0xd220, 0x28e2, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x28c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x2040, 0x20c2, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe75d, 0x20c2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xea60, 0x28a1, 0x632d, 0x8410, 0xa555, 0xdf1c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x30e2, 0xe240, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xda40, 0x28a1, 0x0841, 0x20a1, 0x28c2, 0x28c2,
-  0x28c2, 0x20c2, 0x10a2, 0x30e2, 0xda40, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xd220, 0x3080, 0xd220, 0xe260, 0xe240,
-  0xe260, 0xd220, 0x3060, 0xd220, 0xfaa0, 0xfaa0, 0xfa80, 0xfaa0,
-  0xfa80, 0xfa80, 0xfaa0, 0xfaa0, 0xea60, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xea60, 0xfaa0, 0xfaa0, 0xfa80, 0xfa80, 0xfaa0,
-  0xffc0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xe720, 0xe700, 0xe700,
-  0xe700, 0xe700, 0xe700, 0xe700, 0xe720, 0xffc0, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xdec0, 0x31a1, 0x2942, 0x2942,
-  0x2942, 0x2942, 0x2942, 0x2942, 0x2940, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x3181, 0x9cd4, 0xe73c, 0xe73d,
-  0xe73d, 0xe73d, 0xe73d, 0xce9b, 0x2102, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x18e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x3182, 0xd680, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2122, 0x94b3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd460, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3182, 0xd6a0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xef40, 0xd680, 0x2942, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2100, 0x2102, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2941, 0x630d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xdec0, 0x2961, 0x1082, 0x9cf4, 0xe71c, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x31a2, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xc600, 0x2100, 0x2101, 0x2942, 0x2942,
-  0x2942, 0x2122, 0x10a2, 0x31a2, 0xdec0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffe0, 0xef40, 0x4a60, 0xd6a0, 0xe720, 0xe720, 0xe720,
-  0xe720, 0xd680, 0x31a0, 0xd680, 0xffe0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xe720, 0xffc0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xef40, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffe0, 0xe720, 0xe700, 0xe700,
-  0xe700, 0xe700, 0xe700, 0xe700, 0xef40, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xdec0, 0x3181, 0x2942, 0x2942,
-  0x2942, 0x2942, 0x2942, 0x2122, 0x2120, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x3181, 0x9cd4, 0xe73c, 0xe73d,
-  0xe73d, 0xe73d, 0xe73d, 0xce9b, 0x2102, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x18e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x3182, 0xd680, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2122, 0x94b3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd460, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3182, 0xd6a0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xef40, 0xd680, 0x2942, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2100, 0x2102, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2941, 0x632d, 0x7bf0, 0xa535, 0xdefc, 0xe73c,
-  0xe71c, 0xe71c, 0xe73d, 0xd69a, 0x31a2, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xd6a0, 0x18e1, 0x18e1, 0x2101, 0x2122, 0x2942,
-  0x2942, 0x2942, 0x2122, 0x2102, 0xd6a0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffe0, 0xef40, 0x39c0, 0xd680, 0xe720, 0xe720, 0xe720,
-  0xe720, 0xe720, 0xd680, 0x31a0, 0xef40, 0xffe0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xef40, 0xffc0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xef40, 0xffc0, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xe720, 0xe700, 0xe700,
-  0xe700, 0xe700, 0xe700, 0xe700, 0xe720, 0xffc0, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xdec0, 0x31a1, 0x2942, 0x2942,
-  0x2942, 0x2942, 0x2942, 0x2942, 0x2940, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x3181, 0x9cd4, 0xe73c, 0xe73d,
-  0xe73d, 0xe73d, 0xe73d, 0xce9b, 0x2102, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x18e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x3182, 0xd680, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2122, 0x94b3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd460, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3182, 0xd6a0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xef40, 0xd680, 0x2942, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2100, 0x2102, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2941, 0x630d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xdec0, 0x2961, 0x1082, 0x9cf4, 0xe71c, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x31a2, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xc600, 0x2100, 0x2101, 0x2942, 0x2942,
-  0x2942, 0x2122, 0x10a2, 0x31a2, 0xdec0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffe0, 0xef40, 0x4a60, 0xd6a0, 0xe720, 0xe720, 0xe720,
-  0xe720, 0xd680, 0x31a0, 0xd680, 0xffe0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xe720, 0xffc0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xef40, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffe0, 0xe720, 0xe700, 0xe700,
-  0xe700, 0xe700, 0xe700, 0xe700, 0xef40, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xdec0, 0x3181, 0x2942, 0x2942,
-  0x2942, 0x2942, 0x2942, 0x2122, 0x2120, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x3181, 0x9cd4, 0xe73c, 0xe73d,
-  0xe73d, 0xe73d, 0xe73d, 0xce9b, 0x2102, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x18e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x3182, 0xd680, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2122, 0x94b3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xd460, 0x3160, 0xe720, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xe71a, 0x3182, 0xd6a0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xe720, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xef40, 0x2101, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xef40, 0xd680, 0x2942, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x2942, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2100, 0x2102, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x2122, 0xe700, 0xffe0, 0xffe0,
-  0xffe0, 0xef40, 0x2941, 0x630d, 0x8410, 0xa535, 0xdefc, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x31a2, 0xe720, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xdec0, 0x2961, 0x0841, 0x2101, 0x2942, 0x2942,
-  0x2942, 0x2122, 0x10a2, 0x31a2, 0xdec0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffe0, 0xd6a0, 0x31a0, 0xd680, 0xe720, 0xe720,
-  0xe720, 0xd680, 0x31a0, 0xd680, 0xffe0, 0xffc0, 0xffc0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef40, 0xffc0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xef40, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0,
-  0x07c0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x0720, 0x0700, 0x0700,
-  0x0700, 0x0700, 0x0700, 0x0700, 0x0720, 0x07c0, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x06c0, 0x09a1, 0x1142, 0x1142,
-  0x1142, 0x1142, 0x1142, 0x1142, 0x0140, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0981, 0xa4d4, 0xe73c, 0xef3d,
-  0xef3d, 0xe73d, 0xef3d, 0xd69b, 0x1102, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x08e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2182, 0x0680, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x1122, 0x9cb3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc60, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2182, 0x06a0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x1122, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0740, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x0740, 0x0680, 0x1142, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0100, 0x1102, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0941, 0x6b0d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef3d, 0x1122, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x06c0, 0x0961, 0x1082, 0xa4f4, 0xe71c, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x11a2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x0600, 0x0100, 0x0901, 0x1142, 0x1142,
-  0x1142, 0x1122, 0x10a2, 0x11a2, 0x06c0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07e0, 0x0740, 0x0260, 0x06a0, 0x0720, 0x0720, 0x0720,
-  0x0720, 0x0680, 0x01a0, 0x0680, 0x07e0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x0720, 0x07c0, 0x07e0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x0740, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
-  0x07c0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0700, 0x0700,
-  0x0700, 0x0700, 0x0700, 0x0700, 0x0740, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x06c0, 0x0981, 0x1142, 0x1142,
-  0x1142, 0x1142, 0x1142, 0x1122, 0x0120, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0981, 0xa4d4, 0xe73c, 0xef3d,
-  0xef3d, 0xe73d, 0xef3d, 0xd69b, 0x1102, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x08e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2182, 0x0680, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x1122, 0x9cb3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc60, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2182, 0x06a0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x1122, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0740, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x0740, 0x0680, 0x1142, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0100, 0x1102, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef3d, 0x1122, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0941, 0x6b2d, 0x83f0, 0xad35, 0xe6fc, 0xe73c,
-  0xe71c, 0xe71c, 0xef3d, 0xd69a, 0x11a2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x06a0, 0x08e1, 0x08e1, 0x0901, 0x1122, 0x1142,
-  0x1142, 0x1142, 0x1122, 0x1102, 0x06a0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07e0, 0x0740, 0x01c0, 0x0680, 0x0720, 0x0720, 0x0720,
-  0x0720, 0x0720, 0x0680, 0x01a0, 0x0740, 0x07e0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x0740, 0x07c0, 0x07e0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x07e0, 0x0740, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
-  0x07c0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x0720, 0x0700, 0x0700,
-  0x0700, 0x0700, 0x0700, 0x0700, 0x0720, 0x07c0, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x06c0, 0x09a1, 0x1142, 0x1142,
-  0x1142, 0x1142, 0x1142, 0x1142, 0x0140, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0981, 0xa4d4, 0xe73c, 0xef3d,
-  0xef3d, 0xe73d, 0xef3d, 0xd69b, 0x1102, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x08e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2182, 0x0680, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x1122, 0x9cb3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc60, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2182, 0x06a0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x1122, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0740, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x0740, 0x0680, 0x1142, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0100, 0x1102, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0941, 0x6b0d, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef3d, 0x1122, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x06c0, 0x0961, 0x1082, 0xa4f4, 0xe71c, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x11a2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x0600, 0x0100, 0x0901, 0x1142, 0x1142,
-  0x1142, 0x1122, 0x10a2, 0x11a2, 0x06c0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07e0, 0x0740, 0x0260, 0x06a0, 0x0720, 0x0720, 0x0720,
-  0x0720, 0x0680, 0x01a0, 0x0680, 0x07e0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x0720, 0x07c0, 0x07e0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x0740, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
-  0x07c0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0700, 0x0700,
-  0x0700, 0x0700, 0x0700, 0x0700, 0x0740, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x06c0, 0x0981, 0x1142, 0x1142,
-  0x1142, 0x1142, 0x1142, 0x1122, 0x0120, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0981, 0xa4d4, 0xe73c, 0xef3d,
-  0xef3d, 0xe73d, 0xef3d, 0xd69b, 0x1102, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x08e1, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2182, 0x0680, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x1122, 0x9cb3, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc60, 0x1160, 0x0720, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2182, 0x06a0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0720, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73d, 0x1122, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x0740, 0x0901, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x0740, 0x0680, 0x1142, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1142, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0100, 0x1102, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef3d, 0x1122, 0x0700, 0x07e0, 0x07e0,
-  0x07e0, 0x0740, 0x0941, 0x6b0d, 0x8410, 0xad35, 0xe6fc, 0xe73c,
-  0xe71c, 0xe71c, 0xef5d, 0xd69a, 0x11a2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x06c0, 0x0961, 0x0841, 0x0901, 0x1142, 0x1142,
-  0x1142, 0x1122, 0x10a2, 0x11a2, 0x06c0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07e0, 0x06a0, 0x01a0, 0x0680, 0x0720, 0x0720,
-  0x0720, 0x0680, 0x01a0, 0x0680, 0x07e0, 0x07c0, 0x07c0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x0740, 0x07c0, 0x07e0, 0x07e0,
-  0x07e0, 0x07e0, 0x0740, 0x07c0, 0x07c0, 0x07c0, 0x07c0, 0x07c0,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x04dc, 0x04bc, 0x04bc,
-  0x04bc, 0x04bc, 0x04bc, 0x04bc, 0x04dc, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x049b, 0x0946, 0x1105, 0x1105,
-  0x1105, 0x1105, 0x1105, 0x1105, 0x00e5, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x0926, 0xa4f3, 0xe73c, 0xef3c,
-  0xef3c, 0xe73d, 0xef5d, 0xd69a, 0x10e4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c3, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2164, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x10e4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1104, 0x04dc, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x1104, 0x04dd, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2144, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x057f, 0x04dd, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x04fd, 0x045a, 0x1105, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x00a4, 0x10e4, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x08e5, 0x6b2c, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x1104, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x049b, 0x0905, 0x10a2, 0xa4f3, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x1146, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x0418, 0x00a4, 0x08c4, 0x1105, 0x1105,
-  0x1105, 0x1104, 0x10a2, 0x1146, 0x049b, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x04dd, 0x01a9, 0x047a, 0x04dc, 0x04dc, 0x04dc,
-  0x04dc, 0x045a, 0x0106, 0x047a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x053f, 0x04dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x04fd, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x04dc, 0x04bc, 0x04bc,
-  0x04bc, 0x04bc, 0x04bc, 0x04bc, 0x04dd, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x049b, 0x0926, 0x1105, 0x1105,
-  0x1105, 0x1105, 0x1105, 0x1104, 0x00c4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x0926, 0xa4f3, 0xe73c, 0xef3c,
-  0xef3c, 0xe73d, 0xef5d, 0xd69a, 0x10e4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c3, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2164, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x10e4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1104, 0x04dc, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x1104, 0x04dd, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2144, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x057f, 0x04dd, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x04fd, 0x045a, 0x1105, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x00a4, 0x10e4, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x1104, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x0905, 0x6b2c, 0x83ef, 0xad34, 0xe6fb, 0xe73c,
-  0xe73c, 0xe73c, 0xef3c, 0xd69a, 0x1166, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x049a, 0x08a3, 0x08a3, 0x08e4, 0x1104, 0x1105,
-  0x1105, 0x1105, 0x1104, 0x10e4, 0x049a, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x04dd, 0x0127, 0x047a, 0x04dc, 0x04dc, 0x04dc,
-  0x04dc, 0x04dc, 0x045a, 0x0126, 0x04dd, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x053f, 0x04fd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x04fd, 0x053f, 0x055f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x04dc, 0x04bc, 0x04bc,
-  0x04bc, 0x04bc, 0x04bc, 0x04bc, 0x04dc, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x049b, 0x0946, 0x1105, 0x1105,
-  0x1105, 0x1105, 0x1105, 0x1105, 0x00e5, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x0926, 0xa4f3, 0xe73c, 0xef3c,
-  0xef3c, 0xe73d, 0xef5d, 0xd69a, 0x10e4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c3, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2164, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x10e4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1104, 0x04dc, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x1104, 0x04dd, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2144, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x057f, 0x04dd, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x04fd, 0x045a, 0x1105, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x00a4, 0x10e4, 0x7bcf, 0xbdd7, 0xf7be, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x08e5, 0x6b2c, 0x8410, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x1104, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x049b, 0x0905, 0x10a2, 0xa4f3, 0xe71c, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x1146, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x0418, 0x00a4, 0x08c4, 0x1105, 0x1105,
-  0x1105, 0x1104, 0x10a2, 0x1146, 0x049b, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x04dd, 0x01a9, 0x047a, 0x04dc, 0x04dc, 0x04dc,
-  0x04dc, 0x045a, 0x0106, 0x047a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x053f, 0x04dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x04fd, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x04dc, 0x04bc, 0x04bc,
-  0x04bc, 0x04bc, 0x04bc, 0x04bc, 0x04dd, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x049b, 0x0926, 0x1105, 0x1105,
-  0x1105, 0x1105, 0x1105, 0x1104, 0x00c4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x0926, 0xa4f3, 0xe73c, 0xef3c,
-  0xef3c, 0xe73d, 0xef5d, 0xd69a, 0x10e4, 0x04dc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c3, 0xad55, 0xe73c, 0xffff,
-  0xffbd, 0xffbd, 0xffdd, 0xef1a, 0x2164, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x10e4, 0x9cd2, 0x4229, 0xe6fa,
-  0xdd04, 0xf542, 0xfd62, 0xfd61, 0xdc80, 0x1104, 0x04dc, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xe73d, 0xf79c,
-  0xdd04, 0xf542, 0xfd62, 0xfd62, 0xdc80, 0x1104, 0x04dd, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffdf,
-  0xff9d, 0xffbd, 0xffbd, 0xef1a, 0x2144, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x04dc, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x057f, 0x04dd, 0x08c4, 0xad55, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x04fd, 0x045a, 0x1105, 0xad75, 0xffdf, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xe73c, 0x1105, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x00a4, 0x10e4, 0x7bcf, 0xbdd7, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xef5c, 0x1104, 0x04bc, 0x055f, 0x055f,
-  0x055f, 0x04dd, 0x08e5, 0x6b2c, 0x8410, 0xad54, 0xe6fb, 0xe73c,
-  0xe73c, 0xe73c, 0xef5d, 0xd69a, 0x1146, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x049b, 0x0905, 0x0841, 0x08c4, 0x1105, 0x1105,
-  0x1105, 0x1104, 0x10a2, 0x1146, 0x049b, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x047a, 0x0126, 0x045a, 0x04dc, 0x04dc,
-  0x04dc, 0x045a, 0x0106, 0x047a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x055f, 0x055f, 0x04fd, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x04fd, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f
-};
-
-const Animation ducks_colorsAnimation = {
-  .name = "Ducks Colors",
-  .frameCount = 28,
-  .width = 16,
-  .height = 16,
-  .frameDurations = ducks_colorsDurations,
-  .animationFrames = ducks_colorsFrames
-};
-#endif // ANIMATION_DUCKS_COLORS_H
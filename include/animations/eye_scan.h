@@ -1,790 +0,0 @@
-// eye_scan.h - Auto-generated from eye_scan.json
-#ifndef ANIMATION_EYE_SCAN_H
-#define ANIMATION_EYE_SCAN_H
-
-#include "animation_types.h"
-
-// Frame Durations for eye_scan (in 100ms units)
-static const uint8_t PROGMEM eye_scanDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for eye_scan
-static const uint16_t PROGMEM eye_scanFrames[] = {
-  0x336b, 0x336b, 0x336b, 0x336b, 0x11c5, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c5, 0x11c5,
-  0x336b, 0x336b, 0x11c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c5,
-  0x336b, 0x11c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x11c5, 0x0000, 0x0000, 0x0000, 0x0000, 0x8453, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x8453, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x8453, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x8453, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x8453, 0xffff, 0xffff, 0xfc12, 0xd188,
-  0xd188, 0xfc12, 0xffff, 0xffff, 0x8453, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xfc12, 0xd188, 0xffff,
-  0xd188, 0xd188, 0xfc12, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xd188, 0xd188, 0x0000,
-  0x0000, 0xd188, 0xd188, 0xffff, 0xffff, 0x0000, 0x11c5, 0x0000,
-  0x0000, 0x11c5, 0x0000, 0xffff, 0xffff, 0xd188, 0xd188, 0x0000,
-  0x0000, 0xd188, 0xd188, 0xffff, 0xffff, 0x0000, 0x11c5, 0x11c5,
-  0x11c5, 0x11c5, 0x0000, 0xffff, 0xffff, 0xfc12, 0xd188, 0xd188,
-  0xd188, 0xd188, 0xfc12, 0xffff, 0xffff, 0x0000, 0x11c5, 0x11c5,
-  0x11c5, 0x336b, 0x0000, 0x8453, 0xffff, 0xffff, 0xfc12, 0xd188,
-  0xd188, 0xfc12, 0xffff, 0xffff, 0x8453, 0x0000, 0x336b, 0x11c5,
-  0x336b, 0x336b, 0x11c5, 0x0000, 0x8453, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x8453, 0x0000, 0x11c5, 0x336b, 0x0000,
-  0x336b, 0x336b, 0x336b, 0x11c5, 0x0000, 0x8453, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x8453, 0x0000, 0x11c5, 0x336b, 0x11c5, 0x0000,
-  0x336b, 0x336b, 0x11c5, 0x336b, 0x11c5, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x11c5, 0x336b, 0x11c5, 0x0000, 0x0000,
-  0x336b, 0x336b, 0x336b, 0x11c5, 0x336b, 0x336b, 0x336b, 0x336b,
-  0x336b, 0x336b, 0x336b, 0x336b, 0x11c5, 0x0000, 0x0000, 0x11c5,
-  0x336b, 0x336b, 0x336b, 0x336b, 0x11c5, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x11c5, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef3d, 0xff7e, 0xff5d,
-  0xffbe, 0xffff, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xeefc, 0xf453, 0xd22b, 0xda8c,
-  0xf433, 0xff5d, 0xffff, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0xe6db, 0xfc53, 0xd1a9, 0xc1c9, 0xddd7,
-  0xd24b, 0xf412, 0xff9e, 0xffff, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0xe6db, 0xda2b, 0xb947, 0x1821, 0x18a2,
-  0xb948, 0xd20a, 0xf75d, 0xffff, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c3, 0xe6db, 0xda4b, 0xb947, 0x1821, 0x1820,
-  0xb947, 0xd20b, 0xf75d, 0xffff, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10c2, 0xdebb, 0xfc53, 0xd1ca, 0xb947, 0xb947,
-  0xd1c9, 0xf432, 0xff9e, 0xffff, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xeefc, 0xf453, 0xd22b, 0xd20b,
-  0xf433, 0xff5d, 0xffff, 0xef7d, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8432, 0xef3d, 0xff7e, 0xff7e,
-  0xffbe, 0xffff, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c31, 0xe71c, 0xe75d,
-  0xe73c, 0xdefc, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0861, 0x10a2, 0x10a2,
-  0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x18e3, 0xad96, 0xe73c, 0xef5d,
-  0xe73c, 0xb5b7, 0x4a6a, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xad14, 0xf77d, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x52ab, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xb147, 0xd20a, 0xf433, 0xff9e, 0xffff,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a8a, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xa947, 0xb947, 0xd20b, 0xf75d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0800, 0x1820, 0xc1c9, 0xff5d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x1144, 0x0020, 0x0800, 0x1820, 0xc1c9, 0xff5d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xa947, 0xc147, 0xd20b, 0xf75d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xa927, 0xd20a, 0xf453, 0xff9e, 0xffff,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11a5, 0x18a2, 0xacf4, 0xf77e, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1904, 0xad76, 0xe71c, 0xe73c,
-  0xe71c, 0xb597, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x10c3, 0x18e3, 0x18e3,
-  0x18e3, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2aa8, 0x2aa8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0861, 0x10a2, 0x10a2,
-  0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x18e3, 0xad76, 0xe73c, 0xef5d,
-  0xe73c, 0xb5b7, 0x4a6a, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x52ab, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xb168, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a8a, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x1144, 0x0020, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xb167, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11a5, 0x18a2, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1904, 0xad76, 0xe71c, 0xe73c,
-  0xe71c, 0xb597, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x10c3, 0x18e3, 0x18e3,
-  0x18e3, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2aa8, 0x2aa8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0861, 0x10a2, 0x10a2,
-  0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x18e3, 0xad76, 0xe73c, 0xef5d,
-  0xe73c, 0xb5b7, 0x4a6a, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x52ab, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xb168, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a8a, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x1144, 0x0020, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xb167, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11a5, 0x18a2, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1904, 0xad76, 0xe71c, 0xe73c,
-  0xe71c, 0xb597, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x10c3, 0x18e3, 0x18e3,
-  0x18e3, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2aa8, 0x2aa8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0861, 0x10a2, 0x10a2,
-  0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x18e3, 0xad76, 0xe73c, 0xef5d,
-  0xe73c, 0xb5b7, 0x4a6a, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x52ab, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xb168, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a8a, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x1144, 0x0020, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xb167, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11a5, 0x18a2, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1904, 0xad76, 0xe71c, 0xe73c,
-  0xe71c, 0xb597, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x10c3, 0x18e3, 0x18e3,
-  0x18e3, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2aa8, 0x2aa8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0861, 0x10a2, 0x10a2,
-  0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x18e3, 0xad76, 0xe73c, 0xef5d,
-  0xe73c, 0xb5b7, 0x4a6a, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1882, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x52ab, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xb168, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a8a, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x1144, 0x0020, 0x1800, 0xc1c9, 0xff5d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xb127, 0xd22b, 0xf75d, 0xffff, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xb167, 0xf432, 0xff9e, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11a5, 0x18a2, 0xad35, 0xf7be, 0xffff, 0xffff,
-  0xffff, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1904, 0xad76, 0xe71c, 0xe73c,
-  0xe71c, 0xb597, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x10c3, 0x18e3, 0x18e3,
-  0x18e3, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2aa8, 0x2aa8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x332a, 0x2b09, 0x11a4, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1164, 0x11a5, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0041, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0882, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1000, 0x8105, 0xbd56, 0xe73c, 0xef5d,
-  0xe73c, 0xe73c, 0xb5b7, 0x4a8a, 0x0861, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x80a4, 0xc989, 0xf412, 0xffbe, 0xffff,
-  0xffff, 0xffff, 0xffdf, 0xe75d, 0x7c11, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x1020, 0xb947, 0xc148, 0xd22b, 0xf75d, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xffdf, 0xb5b7, 0x10a2, 0x0943, 0x0040,
-  0x0040, 0x0944, 0x1041, 0xa927, 0x2841, 0xb9c9, 0xff5d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xbdd8, 0x10a2, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x1041, 0xa927, 0x2841, 0xb9c9, 0xff5d, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xad96, 0x1082, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x1061, 0xa927, 0xc148, 0xd22b, 0xff5d, 0xffff,
-  0xffdf, 0xffff, 0xffff, 0xe71c, 0x4a6a, 0x0881, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x1861, 0xb168, 0xebf2, 0xff9e, 0xffdf,
-  0xffdf, 0xffdf, 0xe71c, 0x528b, 0x0861, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x1882, 0x7bb0, 0xb597, 0xb5b7,
-  0xb5d7, 0xad76, 0x4a6a, 0x0861, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08c2, 0x10c2, 0x10c2,
-  0x10c2, 0x10c2, 0x0881, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2ac8,
-  0x2ac8, 0x2ac8, 0x2ac9, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x336a, 0x336b, 0x336b, 0x334a, 0x3329, 0x3329,
-  0x3329, 0x3329, 0x3329, 0x3329, 0x332a, 0x332a, 0x19e5, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x332a, 0x3309, 0x19c5, 0x0061, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0061, 0x11a5, 0x11a5, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0040, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0000, 0x0020, 0x0000,
-  0x0040, 0x0944, 0x0041, 0x39a7, 0x5083, 0x4842, 0x0000, 0x0000,
-  0x0000, 0x4842, 0x5063, 0x39e8, 0x31c8, 0x0041, 0x0944, 0x0040,
-  0x11a5, 0x11a5, 0x0061, 0x39a7, 0x78c5, 0x7084, 0x0800, 0x0000,
-  0x0800, 0x7084, 0x78c4, 0x41e8, 0x31c8, 0x0861, 0x11c5, 0x11a5,
-  0x1a06, 0x2b09, 0x19c5, 0x0061, 0x0800, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0020, 0x0061, 0x19c5, 0x2ae9, 0x11c5,
-  0x334a, 0x336b, 0x334a, 0x19c5, 0x0061, 0x0040, 0x0040, 0x0040,
-  0x0040, 0x0040, 0x0040, 0x0061, 0x11c5, 0x2b09, 0x19c5, 0x0040,
-  0x336a, 0x334a, 0x3329, 0x2b09, 0x2b09, 0x332a, 0x332a, 0x332a,
-  0x332a, 0x332a, 0x332a, 0x332a, 0x3329, 0x19c5, 0x0020, 0x0020,
-  0x334a, 0x1a06, 0x0061, 0x0041, 0x19c5, 0x3309, 0x332a, 0x332a,
-  0x332a, 0x332a, 0x332a, 0x3309, 0x19c5, 0x0020, 0x0020, 0x1184,
-  0x336a, 0x332a, 0x11c5, 0x0040, 0x0020, 0x0040, 0x0040, 0x0040,
-  0x0040, 0x0040, 0x0040, 0x0040, 0x0020, 0x0040, 0x1184, 0x11c5,
-  0x336a, 0x336b, 0x332a, 0x11a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1184, 0x11c5, 0x11c5,
-  0x336a, 0x336a, 0x336a, 0x336a, 0x336b, 0x336b, 0x336b, 0x336b,
-  0x336b, 0x336b, 0x336b, 0x336b, 0x336b, 0x338b, 0x332a, 0x19e5,
-  0x336a, 0x336a, 0x336a, 0x334a, 0x332a, 0x3329, 0x3329, 0x3329,
-  0x3329, 0x3329, 0x3329, 0x3329, 0x332a, 0x2b09, 0x19e5, 0x11c5,
-  0x336a, 0x334a, 0x3309, 0x19c5, 0x0061, 0x0040, 0x0040, 0x0040,
-  0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0040, 0x1144, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1144, 0x0040,
-  0x11a5, 0x11c5, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x11c5, 0x11a5,
-  0x1a06, 0x2b09, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0061, 0x19c5, 0x2ae9, 0x11c5,
-  0x334a, 0x334a, 0x332a, 0x3329, 0x19c5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0061, 0x19c5, 0x3309, 0x3329, 0x19c5, 0x0040,
-  0x334a, 0x1a26, 0x19e6, 0x3309, 0x332a, 0x2b09, 0x2b09, 0x2b09,
-  0x2b09, 0x2b09, 0x2b09, 0x332a, 0x334a, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x332a, 0x19c5, 0x0061, 0x11a5, 0x11c5, 0x11c5, 0x11c5,
-  0x11c5, 0x11c5, 0x11c5, 0x11c5, 0x11a4, 0x0020, 0x0020, 0x1184,
-  0x336a, 0x336b, 0x3309, 0x0881, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x336b, 0x2ae9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1184, 0x11c5, 0x11c5,
-  0x336a, 0x336a, 0x336a, 0x336b, 0x336b, 0x334a, 0x3329, 0x3329,
-  0x3329, 0x3329, 0x3329, 0x3329, 0x332a, 0x332a, 0x19e5, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x332a, 0x3309, 0x19c5, 0x0061, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0061, 0x11a5, 0x11a5, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0040, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0040, 0x1144, 0x0020, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1144, 0x0040,
-  0x11a5, 0x11c5, 0x0040, 0x0020, 0x31a7, 0x31c7, 0x31a7, 0x4062,
-  0x4042, 0x3841, 0x0000, 0x0000, 0x0000, 0x0040, 0x11c5, 0x11a5,
-  0x1a06, 0x2b09, 0x19c5, 0x0040, 0x0020, 0x0020, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x19c5, 0x2ae9, 0x11c5,
-  0x334a, 0x334a, 0x3309, 0x19c5, 0x0061, 0x0040, 0x0040, 0x0040,
-  0x0040, 0x0040, 0x0041, 0x0061, 0x19c5, 0x2b09, 0x19c5, 0x0040,
-  0x334a, 0x1a26, 0x19e6, 0x2ae9, 0x2b09, 0x2b09, 0x2b09, 0x2b09,
-  0x2b09, 0x2b09, 0x2b09, 0x2b09, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x332a, 0x19c5, 0x0061, 0x11a5, 0x11c5, 0x11c5, 0x11c5,
-  0x11c5, 0x11c5, 0x11c5, 0x11c5, 0x11a5, 0x0020, 0x0020, 0x1184,
-  0x336a, 0x336b, 0x3309, 0x0881, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x336b, 0x2ae9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1184, 0x11c5, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x332a, 0x2b09, 0x11a4, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1164, 0x11a5, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0041, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0000, 0x0841, 0x0862, 0x0862,
-  0x0862, 0x0882, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x18e3, 0x7c11, 0xb5b7, 0xb5d7,
-  0xb5d7, 0xbdd8, 0xad76, 0x2124, 0x0861, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xdefb, 0xf7be, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xff9e, 0xde9a, 0x7bb0, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffff, 0xffdf, 0xffdf,
-  0xffff, 0xff9e, 0xf453, 0xda2b, 0xb9a9, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf75d, 0xd22b, 0xb947, 0xa927, 0x1041, 0x0944, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xff7d, 0xc1e9, 0x1820, 0x0800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xff7d, 0xc1e9, 0x1821, 0x0800, 0x0020, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xff7e, 0xd24b, 0xc148, 0xa126, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x4a8a, 0xdedb, 0xe73c, 0xe73c,
-  0xe73c, 0xe6fb, 0xe390, 0xb148, 0x2061, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11c5, 0x0881, 0x10e3, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x18a2, 0x1082, 0x11c5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2b09, 0x2b09, 0x2ae9, 0x2ae9, 0x2ae9,
-  0x2ae9, 0x2ae9, 0x2ae9, 0x2b09, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a26, 0x19e5, 0x11c5, 0x11c5, 0x11c5,
-  0x11c5, 0x11c5, 0x11c5, 0x11c5, 0x11a4, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x11c5, 0x0040, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0021, 0x4a6a, 0xb5b7, 0xe73c,
-  0xef5d, 0xe73c, 0xad96, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x528b, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xb555, 0x1882, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1144, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1021, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x528a, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xad35, 0x18a3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x0861, 0x4a6a, 0xb596, 0xe71c,
-  0xe73c, 0xe71c, 0xad76, 0x1904, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x0881, 0x10c2, 0x18e3,
-  0x18e3, 0x18e3, 0x10c3, 0x11c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac9, 0x2ac8, 0x2ac8,
-  0x2aa8, 0x2aa8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0021, 0x4a6a, 0xb5b7, 0xe73c,
-  0xef5d, 0xe73c, 0xad96, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x528b, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xb555, 0x1882, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1144, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1021, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x528a, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xad35, 0x18a3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x0861, 0x4a6a, 0xb596, 0xe71c,
-  0xe73c, 0xe71c, 0xad76, 0x1904, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x0881, 0x10c2, 0x18e3,
-  0x18e3, 0x18e3, 0x10c3, 0x11c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac9, 0x2ac8, 0x2ac8,
-  0x2aa8, 0x2aa8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0021, 0x4a6a, 0xb5b7, 0xe73c,
-  0xef5d, 0xe73c, 0xad96, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x528b, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xb555, 0x1882, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1144, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1021, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x528a, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xad35, 0x18a3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x0861, 0x4a6a, 0xb596, 0xe71c,
-  0xe73c, 0xe71c, 0xad76, 0x1904, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x0881, 0x10c2, 0x18e3,
-  0x18e3, 0x18e3, 0x10c3, 0x11c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac9, 0x2ac8, 0x2ac8,
-  0x2aa8, 0x2aa8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0021, 0x4a6a, 0xb5b7, 0xe73c,
-  0xef5d, 0xe73c, 0xad96, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x528b, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xb555, 0x1882, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1144, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xff7d, 0xc1e9, 0x1800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffff, 0xf75d, 0xd22b, 0xb127, 0x1021, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xff9e, 0xf432, 0xb168, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x528a, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf7be, 0xad35, 0x18a3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x0861, 0x4a6a, 0xb596, 0xe71c,
-  0xe73c, 0xe71c, 0xad76, 0x1904, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x0881, 0x10c2, 0x18e3,
-  0x18e3, 0x18e3, 0x10c3, 0x11c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac9, 0x2ac8, 0x2ac8,
-  0x2aa8, 0x2aa8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0020, 0x0861, 0x10a2,
-  0x10a2, 0x10a2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x0021, 0x4a6a, 0xb5b7, 0xe73c,
-  0xef5d, 0xe73c, 0xad96, 0x18e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x528b, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf77e, 0xad15, 0x1882, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffff, 0xff9e, 0xf433, 0xd20a, 0xb147, 0x1020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0861, 0xad96, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf75d, 0xd22b, 0xb947, 0xa947, 0x1020, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0861, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xff7d, 0xc1e9, 0x1820, 0x0800, 0x0020, 0x1144, 0x0040,
-  0x0040, 0x0943, 0x1082, 0xb5d7, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xff7d, 0xc1e9, 0x1820, 0x0800, 0x0020, 0x1184, 0x11a5,
-  0x11a5, 0x11a5, 0x0882, 0xad76, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffff, 0xf75d, 0xd22b, 0xc147, 0xb147, 0x1041, 0x11a5, 0x11c5,
-  0x1a06, 0x2ae9, 0x0881, 0x4a6a, 0xe71c, 0xffff, 0xffff, 0xffdf,
-  0xffff, 0xff9e, 0xf453, 0xd20a, 0xb147, 0x1061, 0x2ae9, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x0861, 0x528a, 0xe71c, 0xffdf, 0xffff,
-  0xffff, 0xffff, 0xf77e, 0xad14, 0x18a3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x0861, 0x4a6a, 0xb596, 0xe71c,
-  0xe73c, 0xe71c, 0xad76, 0x1924, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x0881, 0x10c2, 0x18e3,
-  0x18e3, 0x18e3, 0x10c3, 0x11c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac9, 0x2ac8, 0x2ac8,
-  0x2aa8, 0x2aa8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe73c, 0x8452, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffff, 0xff9e,
-  0xff7d, 0xff7e, 0xef3d, 0x8452, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xffff, 0xff7d, 0xfcb4,
-  0xd22b, 0xd20b, 0xf433, 0xeefc, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffff, 0xff9e, 0xfcb4, 0xf659,
-  0xc1c9, 0xb927, 0xd1c9, 0xfc53, 0xe6db, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe73c, 0xffff, 0xf75d, 0xd22b, 0xc1c9,
-  0x1841, 0x1821, 0xb947, 0xda2b, 0xe6db, 0x10e3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe73c, 0xffff, 0xf75d, 0xd22b, 0xb927,
-  0x1821, 0x1821, 0xb947, 0xda2b, 0xe6db, 0x10e3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdefc, 0xffff, 0xff9e, 0xf433, 0xd1c9,
-  0xb947, 0xb947, 0xd1c9, 0xfc53, 0xe6bb, 0x10c3, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7d, 0xffff, 0xff5d, 0xf433,
-  0xd22b, 0xd22b, 0xf453, 0xeefc, 0x8431, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7d, 0xffff, 0xffbe,
-  0xff7e, 0xff7e, 0xef3d, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdefc, 0xe73c,
-  0xe75d, 0xe71c, 0x7c31, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5,
-  0x336a, 0x336a, 0x334a, 0x2b09, 0x11a4, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x1184, 0x11c5,
-  0x336b, 0x332a, 0x19c5, 0x0061, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x1184,
-  0x332a, 0x19c5, 0x0020, 0x0000, 0x0000, 0x0841, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x11a4, 0x0040, 0x0000, 0x0000, 0x1082, 0x8432, 0xe71c, 0xef5d,
-  0xef5d, 0xe71c, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x8432, 0xef7e, 0xffbe, 0xff7d,
-  0xff7d, 0xffbe, 0xef7e, 0x8432, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x8432, 0xef7e, 0xff7d, 0xf453, 0xda8c,
-  0xd22b, 0xf432, 0xff7d, 0xef7e, 0x8432, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xe71c, 0xffbe, 0xf432, 0xd22b, 0xddd7,
-  0xc1c9, 0xd1a9, 0xf432, 0xffbe, 0xe71c, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xef5d, 0xff7e, 0xd20b, 0xb948, 0x18a2,
-  0x1841, 0xb947, 0xd20a, 0xff7d, 0xef5d, 0x10c3, 0x0943, 0x0040,
-  0x0040, 0x0943, 0x10c2, 0xe75d, 0xff7e, 0xd22b, 0xb947, 0x1820,
-  0x1821, 0xb947, 0xd20b, 0xff7d, 0xef5d, 0x10c3, 0x1184, 0x11a5,
-  0x11a5, 0x11a4, 0x10a2, 0xdf1c, 0xffbf, 0xf433, 0xd1c9, 0xb947,
-  0xb947, 0xd1c9, 0xf433, 0xffbe, 0xe71c, 0x10c2, 0x11a4, 0x11c5,
-  0x1a06, 0x2ae9, 0x08a2, 0x7c11, 0xef7e, 0xff7e, 0xf433, 0xd22b,
-  0xd20b, 0xf433, 0xff7d, 0xef7e, 0x8411, 0x08a2, 0x2ac8, 0x19c5,
-  0x334a, 0x334a, 0x11c5, 0x10c3, 0x8431, 0xef7e, 0xffbf, 0xff7e,
-  0xff7e, 0xffbe, 0xef7e, 0x8432, 0x10c3, 0x19c5, 0x2ae9, 0x0061,
-  0x336a, 0x336a, 0x2b09, 0x11a5, 0x10c3, 0x7c11, 0xdf1c, 0xe75d,
-  0xe75d, 0xdf1c, 0x7c11, 0x10c3, 0x11a5, 0x2b09, 0x11a5, 0x0000,
-  0x336a, 0x334a, 0x1a47, 0x2ae9, 0x11c5, 0x08a2, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x08a2, 0x19c5, 0x2b09, 0x19c5, 0x0020, 0x0020,
-  0x336a, 0x336a, 0x332a, 0x1a47, 0x2b09, 0x2ac8, 0x2ac8, 0x2aa8,
-  0x2aa8, 0x2ac8, 0x2ac8, 0x2ae9, 0x11a5, 0x0020, 0x0040, 0x1184,
-  0x336a, 0x336a, 0x336a, 0x332a, 0x19e5, 0x0061, 0x0041, 0x0041,
-  0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0000, 0x1184, 0x11c5
-};
-
-const Animation eye_scanAnimation = {
-  .name = "Eye Scan",
-  .frameCount = 24,
-  .width = 16,
-  .height = 16,
-  .frameDurations = eye_scanDurations,
-  .animationFrames = eye_scanFrames
-};
-#endif // ANIMATION_EYE_SCAN_H
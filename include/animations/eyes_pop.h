@@ -1,374 +0,0 @@
-// eyes_pop.h - Auto-generated from eyes_pop.json
-#ifndef ANIMATION_EYES_POP_H
-#define ANIMATION_EYES_POP_H
-
-#include "animation_types.h"
-
-// Frame Durations for eyes_pop (in 100ms units)
-static const uint8_t PROGMEM eyes_popDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for eyes_pop
-static const uint16_t PROGMEM eyes_popFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdc00, 0xfde0,
-  0xfde0, 0xfde0, 0xfde0, 0xdc00, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xdc00, 0xfde0, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xfde0, 0xdc00, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xdc00, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xdc00, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xfde0, 0x0000,
-  0x0000, 0x0000, 0xdc00, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xdc00,
-  0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0x0000, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0x0000, 0xff69, 0xff69, 0xff69, 0xfde0,
-  0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xfde0,
-  0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xfde0,
-  0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xdc00,
-  0x0000, 0x0000, 0xdc00, 0xff69, 0xff69, 0xff69, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xff69, 0xff69, 0xff69, 0xfde0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xfde0, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xdc00, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xdc00, 0xff69, 0xff69, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xff69, 0xff69, 0xdc00, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xdc00, 0xfde0, 0xff69, 0xff69,
-  0xff69, 0xff69, 0xff69, 0xfde0, 0xdc00, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xdc00, 0xfde0,
-  0xfde0, 0xfde0, 0xfde0, 0xdc00, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff48, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff28, 0xfee7, 0xbbc0, 0x0840,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff28, 0xff69, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff29, 0xe6a8, 0xff29, 0xff49,
-  0xff49, 0xff49, 0xff29, 0xe6a8, 0xff29, 0xff49, 0xf6e7, 0xd420,
-  0x0000, 0x1060, 0xe540, 0xff48, 0xeea8, 0x4a22, 0xe6a8, 0xff49,
-  0xff49, 0xff49, 0xeea8, 0x4a22, 0xe6a8, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff29, 0xeea8, 0xff29, 0xff49,
-  0xff49, 0xff49, 0xff29, 0xeea8, 0xff29, 0xff49, 0xff28, 0xfde0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff49, 0xff49, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe540, 0xff28, 0xff49, 0xff29, 0xfea8, 0xfe88,
-  0xfe88, 0xfe88, 0xfea8, 0xff29, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff49, 0xfec8, 0xf9a2, 0xf921,
-  0xf921, 0xf921, 0xf9a2, 0xfec8, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff28, 0xff49, 0xfea8, 0xfe88,
-  0xfe88, 0xfe88, 0xfea8, 0xff29, 0xff49, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff48, 0xff69, 0xff69,
-  0xff49, 0xff49, 0xff49, 0xff28, 0xfec7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed61, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff27, 0xfdc1, 0xc3c0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbba0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbba0, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff48, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff28, 0xfee7, 0xbbc0, 0x0840,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff28, 0xff69, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff29, 0xe6a8, 0xff29, 0xff49,
-  0xff49, 0xff49, 0xff29, 0xe6a8, 0xff29, 0xff49, 0xf6e7, 0xd420,
-  0x0000, 0x1060, 0xe540, 0xff48, 0xeea8, 0x4a22, 0xe6a8, 0xff49,
-  0xff49, 0xff49, 0xeea8, 0x4a22, 0xe6a8, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff29, 0xeea8, 0xff29, 0xff49,
-  0xff49, 0xff49, 0xff29, 0xeea8, 0xff29, 0xff49, 0xff28, 0xfde0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff49, 0xff49, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe540, 0xff28, 0xff49, 0xff29, 0xfea8, 0xfe88,
-  0xfe88, 0xfe88, 0xfea8, 0xff29, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff49, 0xfec8, 0xf9a2, 0xf921,
-  0xf921, 0xf921, 0xf9a2, 0xfec8, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff28, 0xff49, 0xfea8, 0xfe88,
-  0xfe88, 0xfe88, 0xfea8, 0xff29, 0xff49, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff48, 0xff69, 0xff69,
-  0xff49, 0xff49, 0xff49, 0xff28, 0xfec7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed61, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff27, 0xfdc1, 0xc3c0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbba0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbba0, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff28, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff48, 0xff48, 0xff28, 0xfee7, 0xbbc0, 0x0840,
-  0x0000, 0x0000, 0x20a0, 0xed81, 0xff4a, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff6b, 0xff4a, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0840, 0xbbc0, 0xfeea, 0xe739, 0xffbc, 0xff4c, 0xff48,
-  0xff48, 0xff4c, 0xe739, 0xffbc, 0xff4c, 0xff49, 0xf6e7, 0xd420,
-  0x0000, 0x1060, 0xed62, 0xef17, 0x4a49, 0xe73d, 0xffdb, 0xff4a,
-  0xff4a, 0xef38, 0x4a49, 0xe73d, 0xffdb, 0xff4a, 0xff08, 0xfdc0,
-  0x0000, 0x1060, 0xe560, 0xff2b, 0xef3a, 0xffbc, 0xff4c, 0xff48,
-  0xff48, 0xff4c, 0xef39, 0xffbc, 0xff4c, 0xff49, 0xff28, 0xfde0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff6b, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff6b, 0xff4a, 0xff49, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe540, 0xff28, 0xff48, 0xff28, 0xfe88, 0xfe88,
-  0xfe88, 0xfe88, 0xfe88, 0xff28, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff49, 0xfec8, 0xf9a1, 0xf920,
-  0xf920, 0xf920, 0xf9a1, 0xfec8, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff28, 0xff48, 0xff01, 0xff00,
-  0xff00, 0xff00, 0xff01, 0xff48, 0xff49, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff48, 0xff68, 0xff68,
-  0xff68, 0xff68, 0xff68, 0xff28, 0xfec7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed61, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff27, 0xfdc1, 0xc3c0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbba0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbba0, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff28, 0xff49, 0xff49,
-  0xff49, 0xff48, 0xff48, 0xff48, 0xff28, 0xfee7, 0xbbc0, 0x0840,
-  0x0000, 0x0000, 0x20a0, 0xeda3, 0xff4a, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff6b, 0xff4b, 0xff4a, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0840, 0xbbe4, 0xe6d8, 0xf79c, 0xffbc, 0xff4c, 0xff48,
-  0xff4c, 0xe719, 0xf79c, 0xffbc, 0xff4c, 0xff49, 0xf6e7, 0xd420,
-  0x0000, 0x10a2, 0xd656, 0x4229, 0xad76, 0xf7bf, 0xffba, 0xff6c,
-  0xef38, 0x4228, 0xad76, 0xf7bf, 0xffba, 0xff4a, 0xff08, 0xfdc0,
-  0x0000, 0x1060, 0xe584, 0xef18, 0xf79c, 0xffbc, 0xff4c, 0xff48,
-  0xff4c, 0xe739, 0xf79c, 0xffbc, 0xff4c, 0xff49, 0xff28, 0xfde0,
-  0x0000, 0x1060, 0xe560, 0xff4a, 0xff6b, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff6b, 0xff6b, 0xff4a, 0xff49, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe540, 0xff28, 0xff48, 0xff28, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xff28, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff69, 0xfea8, 0xf901, 0xf860,
-  0xf860, 0xf860, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff28, 0xfec8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec8, 0xff28, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed61, 0xff07, 0xff48,
-  0xff48, 0xff48, 0xff27, 0xfdc1, 0xc3c0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbba0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbba0, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x1082, 0x20e2, 0xc3e3, 0xf6c9, 0xf709, 0xff49, 0xff4a,
-  0xff4b, 0xff4b, 0xf72a, 0xf72a, 0xff48, 0xfee7, 0xbbc0, 0x0840,
-  0x2124, 0xd6ba, 0xef5d, 0xf77c, 0xd698, 0xbdb3, 0xf72d, 0xffdc,
-  0xffde, 0xf7bd, 0xd698, 0xb5b3, 0xef0a, 0xff48, 0xe561, 0x20c0,
-  0xe73c, 0xe73c, 0xf7be, 0xffff, 0xf79e, 0xce79, 0xf79d, 0xe73c,
-  0xf79e, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf709, 0xfee7, 0xd420,
-  0xef7d, 0x4228, 0xad75, 0xffdf, 0xffdf, 0xd6ba, 0xe73c, 0x4208,
-  0xad75, 0xffdf, 0xffdf, 0xce59, 0xad74, 0xf70a, 0xff28, 0xfdc0,
-  0xe73c, 0xef5d, 0xf7be, 0xffdf, 0xf79e, 0xce79, 0xf79d, 0xe73d,
-  0xf79e, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf70a, 0xff28, 0xfde0,
-  0x2124, 0xd6ba, 0xffdd, 0xffbd, 0xd698, 0xbdb3, 0xf74d, 0xfffc,
-  0xfffe, 0xf7dd, 0xd698, 0xbdb3, 0xeeea, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x20e2, 0xed83, 0xff2a, 0xf72a, 0xf709, 0xfea8, 0xfea9,
-  0xfeaa, 0xfeaa, 0xf6a9, 0xf709, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0820, 0xbbc0, 0xfee7, 0xff68, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfea8, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfee7, 0xfea7, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf880, 0xfe87, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xece0, 0xf8c0, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfd20, 0xc3e0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbac0, 0xe040,
-  0xe000, 0xe000, 0xe040, 0xbb20, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x1082, 0x20e2, 0xc3e3, 0xf6c9, 0xf709, 0xff49, 0xff4a,
-  0xff4b, 0xff4b, 0xf72a, 0xf72a, 0xff48, 0xfee7, 0xbbc0, 0x0840,
-  0x2124, 0xd6ba, 0xef5d, 0xf77c, 0xd698, 0xbdb3, 0xf72d, 0xffdc,
-  0xffdd, 0xf7bd, 0xd698, 0xb5b3, 0xef0a, 0xff48, 0xe561, 0x20c0,
-  0xe73c, 0xef5d, 0xffff, 0xffff, 0xf79e, 0xce79, 0xf79d, 0xe73d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf709, 0xfee7, 0xd420,
-  0xef7d, 0x4a69, 0xe73c, 0xffff, 0xf7be, 0xd6ba, 0xe71c, 0x4a49,
-  0xe73c, 0xffff, 0xffdf, 0xce59, 0xad74, 0xf70a, 0xff28, 0xfdc0,
-  0xe73c, 0xef5d, 0xffdf, 0xffdf, 0xf79e, 0xce79, 0xf79d, 0xef5d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf70a, 0xff28, 0xfde0,
-  0x2124, 0xd6ba, 0xffbd, 0xffbd, 0xd698, 0xbdb3, 0xf74d, 0xfffc,
-  0xfffd, 0xf7dd, 0xd698, 0xbdb3, 0xeeea, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x20e2, 0xed83, 0xff2a, 0xf72a, 0xf709, 0xfea8, 0xfea9,
-  0xfeaa, 0xfeaa, 0xf6a9, 0xf709, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0820, 0xbbc0, 0xfee7, 0xff68, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfea8, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfee7, 0xfea7, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf880, 0xfe87, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xece0, 0xf8c0, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfd20, 0xc3e0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbac0, 0xe040,
-  0xe000, 0xe000, 0xe040, 0xbb20, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x1082, 0x20e2, 0xc3e3, 0xf6c9, 0xf709, 0xff49, 0xff4a,
-  0xff4b, 0xff4b, 0xf72a, 0xf72a, 0xff48, 0xfee7, 0xbbc0, 0x0840,
-  0x2124, 0xd6ba, 0xef5d, 0xf77c, 0xd698, 0xbdb3, 0xf72d, 0xffdc,
-  0xffdd, 0xf7bd, 0xd698, 0xb5b3, 0xef0a, 0xff48, 0xe561, 0x20c0,
-  0xe73c, 0xef5d, 0xffff, 0xffff, 0xf79e, 0xce79, 0xf79d, 0xe73d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf709, 0xfee7, 0xd420,
-  0xef7d, 0x4a69, 0xe73c, 0xffff, 0xf7be, 0xd6ba, 0xe71c, 0x4a49,
-  0xe73c, 0xffff, 0xffdf, 0xce59, 0xad74, 0xf70a, 0xff28, 0xfdc0,
-  0xe73c, 0xef5d, 0xffdf, 0xffdf, 0xf79e, 0xce79, 0xf79d, 0xef5d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf70a, 0xff28, 0xfde0,
-  0x2124, 0xd6ba, 0xffbd, 0xffbd, 0xd698, 0xbdb3, 0xf74d, 0xfffc,
-  0xfffd, 0xf7dd, 0xd698, 0xbdb3, 0xeeea, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x20e2, 0xed83, 0xff2a, 0xf72a, 0xf709, 0xfea8, 0xfea9,
-  0xfeaa, 0xfeaa, 0xf6a9, 0xf709, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0820, 0xbbc0, 0xfee7, 0xff68, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfea8, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfee7, 0xfea7, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf880, 0xfe87, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xece0, 0xf8c0, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfd20, 0xc3e0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbac0, 0xe040,
-  0xe000, 0xe000, 0xe040, 0xbb20, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x1082, 0x20e2, 0xc3e3, 0xf6c9, 0xf709, 0xff49, 0xff4a,
-  0xff4b, 0xff4b, 0xf72a, 0xf72a, 0xff48, 0xfee7, 0xbbc0, 0x0840,
-  0x2124, 0xd6ba, 0xef5d, 0xf77c, 0xd698, 0xbdb3, 0xf72d, 0xffdc,
-  0xffdd, 0xf7bd, 0xd698, 0xb5b3, 0xef0a, 0xff48, 0xe561, 0x20c0,
-  0xe73c, 0xef5d, 0xffff, 0xffff, 0xf79e, 0xce79, 0xf79d, 0xe73d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf709, 0xfee7, 0xd420,
-  0xef7d, 0x4a69, 0xe73c, 0xffff, 0xf7be, 0xd6ba, 0xe71c, 0x4a49,
-  0xe73c, 0xffff, 0xffdf, 0xce59, 0xad74, 0xf70a, 0xff28, 0xfdc0,
-  0xe73c, 0xef5d, 0xffdf, 0xffdf, 0xf79e, 0xce79, 0xf79d, 0xef5d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf70a, 0xff28, 0xfde0,
-  0x2124, 0xd6ba, 0xffbd, 0xffbd, 0xd698, 0xbdb3, 0xf74d, 0xfffc,
-  0xfffd, 0xf7dd, 0xd698, 0xbdb3, 0xeeea, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x20e2, 0xed83, 0xff2a, 0xf72a, 0xf709, 0xfea8, 0xfea9,
-  0xfeaa, 0xfeaa, 0xf6a9, 0xf709, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0820, 0xbbc0, 0xfee7, 0xff68, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfea8, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfee7, 0xfea7, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf880, 0xfe87, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xece0, 0xf8c0, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfd20, 0xc3e0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbac0, 0xe040,
-  0xe000, 0xe000, 0xe040, 0xbb20, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x1082, 0x20e2, 0xc3e3, 0xf6c9, 0xf709, 0xff49, 0xff4a,
-  0xff4b, 0xff4b, 0xf72a, 0xf72a, 0xff48, 0xfee7, 0xbbc0, 0x0840,
-  0x2124, 0xd6ba, 0xef5d, 0xf77c, 0xd698, 0xbdb3, 0xf72d, 0xffdc,
-  0xffdd, 0xf7bd, 0xd698, 0xb5b3, 0xef0a, 0xff48, 0xe561, 0x20c0,
-  0xe73c, 0xef5d, 0xffff, 0xffff, 0xf79e, 0xce79, 0xf79d, 0xe73d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf709, 0xfee7, 0xd420,
-  0xef7d, 0x4a69, 0xe73c, 0xffff, 0xf7be, 0xd6ba, 0xe71c, 0x4a49,
-  0xe73c, 0xffff, 0xffdf, 0xce59, 0xad74, 0xf70a, 0xff28, 0xfdc0,
-  0xe73c, 0xef5d, 0xffdf, 0xffdf, 0xf79e, 0xce79, 0xf79d, 0xef5d,
-  0xffdf, 0xffdf, 0xf79e, 0xc639, 0xb593, 0xf70a, 0xff28, 0xfde0,
-  0x2124, 0xd6ba, 0xffbd, 0xffbd, 0xd698, 0xbdb3, 0xf74d, 0xfffc,
-  0xfffd, 0xf7dd, 0xd698, 0xbdb3, 0xeeea, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x20e2, 0xed83, 0xff2a, 0xf72a, 0xf709, 0xfea8, 0xfea9,
-  0xfeaa, 0xfeaa, 0xf6a9, 0xf709, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0820, 0xbbc0, 0xfee7, 0xff68, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfea8, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfee7, 0xfea7, 0xf880, 0xf800,
-  0xf800, 0xf800, 0xf880, 0xfe87, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xece0, 0xf8c0, 0xf800,
-  0xf800, 0xf800, 0xf860, 0xfd20, 0xc3e0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbac0, 0xe040,
-  0xe000, 0xe000, 0xe040, 0xbb20, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1080, 0x1080, 0x1080, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x20a0, 0xbbc0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbbc0, 0x20a0, 0x1040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed81, 0xfee7, 0xff28,
-  0xff28, 0xff28, 0xff28, 0xfee7, 0xed81, 0xbbc0, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff28, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff48, 0xff48, 0xff28, 0xfee7, 0xbbc0, 0x0840,
-  0x0000, 0x0000, 0x20a0, 0xed81, 0xff4a, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff49, 0xff6b, 0xff4a, 0xff49, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0840, 0xbbc0, 0xf6c9, 0xe739, 0xffbc, 0xff4c, 0xff48,
-  0xff48, 0xf70b, 0xe719, 0xffbc, 0xff4c, 0xff49, 0xf6e7, 0xd420,
-  0x0000, 0x1060, 0xe541, 0xb530, 0x4229, 0xef5d, 0xffdb, 0xff4a,
-  0xf729, 0xad50, 0x4208, 0xef5d, 0xffdb, 0xff4a, 0xff08, 0xfdc0,
-  0x0000, 0x1060, 0xe560, 0xf70a, 0xe739, 0xffbc, 0xff4c, 0xff48,
-  0xff48, 0xf70b, 0xe739, 0xffbc, 0xff4c, 0xff49, 0xff28, 0xfde0,
-  0x0000, 0x1060, 0xe560, 0xff28, 0xff6b, 0xff4a, 0xff49, 0xff49,
-  0xff49, 0xff69, 0xff6b, 0xff4a, 0xff49, 0xff49, 0xff28, 0xfdc0,
-  0x0000, 0x1060, 0xe540, 0xff28, 0xff48, 0xff28, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xff28, 0xff49, 0xff49, 0xf6e7, 0xcc20,
-  0x0000, 0x0840, 0xbbc0, 0xfee7, 0xff69, 0xfea8, 0xf901, 0xf860,
-  0xf860, 0xf860, 0xf901, 0xfea8, 0xff69, 0xff48, 0xe561, 0x20c0,
-  0x0000, 0x0000, 0x20a0, 0xed61, 0xff48, 0xfec8, 0xf901, 0xf880,
-  0xf880, 0xf880, 0xf901, 0xfea8, 0xff69, 0xfee7, 0xbba0, 0x0840,
-  0x0000, 0x0000, 0x0820, 0xbbc0, 0xfec7, 0xff28, 0xfec8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec8, 0xff28, 0xfee7, 0xc3e1, 0x1880, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1880, 0xbbc0, 0xed61, 0xff07, 0xff48,
-  0xff48, 0xff48, 0xff27, 0xfdc1, 0xc3c0, 0x1880, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x20a0, 0xbba0, 0xe540,
-  0xe560, 0xe560, 0xe540, 0xbba0, 0x1880, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040, 0x1060,
-  0x1060, 0x1060, 0x1060, 0x1040, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation eyes_popAnimation = {
-  .name = "Eyes Pop",
-  .frameCount = 11,
-  .width = 16,
-  .height = 16,
-  .frameDurations = eyes_popDurations,
-  .animationFrames = eyes_popFrames
-};
-#endif // ANIMATION_EYES_POP_H
@@ -1,1206 +0,0 @@
-// figures_tetris.h - Auto-generated from figures_tetris.json
-#ifndef ANIMATION_FIGURES_TETRIS_H
-#define ANIMATION_FIGURES_TETRIS_H
-
-#include "animation_types.h"
-
-// Frame Durations for figures_tetris (in 100ms units)
-static const uint8_t PROGMEM figures_tetrisDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for figures_tetris
-static const uint16_t PROGMEM figures_tetrisFrames[] = {
-  0x3e9f, 0x3e9f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x0000, 0xd460, 0xd460, 0xd460, 0x0000, 0xd460,
-  0xd460, 0xd460, 0x0000, 0xd460, 0xd460, 0xd460, 0x0000, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x0000, 0xfde7, 0xd460, 0xd460, 0x0000, 0xfde7,
-  0xd460, 0xd460, 0x0000, 0xfde7, 0xd460, 0xd460, 0x0000, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x0000, 0xffff, 0xfde7, 0xd460, 0x0000, 0xffff,
-  0xfde7, 0xd460, 0x0000, 0xffff, 0xfde7, 0xd460, 0x0000, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xd800, 0xffff,
-  0x0000, 0xa000, 0xd800, 0xffff, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xa000, 0xd800,
-  0x0000, 0xa000, 0xa000, 0xd800, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xa000, 0xa000,
-  0x0000, 0xa000, 0xa000, 0xa000, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xd800, 0xffff,
-  0x0000, 0xa000, 0xd800, 0xffff, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xa000, 0xd800,
-  0x0000, 0xa000, 0xa000, 0xd800, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0xa000, 0xa000, 0xa000,
-  0x0000, 0xa000, 0xa000, 0xa000, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e7f, 0x3e7f, 0x35fc, 0x35dc, 0x35dc, 0x2d5a, 0x1104, 0xd658,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35dc, 0x35dc, 0x35fc, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0905, 0x10e2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x28e0, 0x20a0, 0x0020, 0x10c2, 0x10e2, 0x10e2, 0x0905, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc082,
-  0x1800, 0x9000, 0xa800, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa000, 0x9000,
-  0x1800, 0x8800, 0xa000, 0x9000, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x3e9f, 0x3e9f, 0x35fd, 0x1903, 0xe568,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd636,
-  0xe567, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd75,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1924, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc8a2,
-  0x1800, 0x9000, 0xa800, 0xc8a2, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x10e2, 0xc400,
-  0xdc80, 0xc3e0, 0x10e2, 0x35dc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe547,
-  0xe4c1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1800, 0x2000, 0x20a2,
-  0x0000, 0x1800, 0x2000, 0x20a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc8a2, 0xce18,
-  0x18a2, 0x8000, 0xc8a2, 0xcdf7, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x1040,
-  0x1060, 0x1040, 0x0082, 0x35fc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc420, 0xb3a0, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x0800, 0x0800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x35dc,
-  0x35dc, 0x35dc, 0x35fc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x10e2,
-  0x10e2, 0x10e2, 0x0904, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc082,
-  0x1800, 0x9000, 0xa800, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa000, 0x9000,
-  0x1800, 0x8800, 0xa000, 0x9000, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dc,
-  0x35dc, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd555, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc8a2,
-  0x1800, 0x9000, 0xa800, 0xc8a2, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0905, 0x0082, 0x0082, 0x0082,
-  0x0082, 0x0082, 0x0082, 0x0082, 0x0905, 0x35fd, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fc, 0x35dc, 0x35fc, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35dc, 0x35dc, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1882, 0x1904,
-  0x0082, 0x1082, 0x1882, 0x1904, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0xc882, 0xcdf7,
-  0x1882, 0x8000, 0xc882, 0xd5f7, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00c2, 0x0420, 0x2662, 0xc677,
-  0x10c2, 0x0420, 0x2662, 0xc677, 0x1904, 0x35dc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x0922, 0x1124,
-  0x0082, 0x00e2, 0x0922, 0x1124, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fc, 0x35fc, 0x35fc,
-  0x35fc, 0x35fc, 0x35fc, 0x35fc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x0082, 0x0082, 0x0082,
-  0x0082, 0x0082, 0x0082, 0x0082, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d80, 0x2663,
-  0x0100, 0x0480, 0x0d80, 0x2662, 0x0902, 0x35dc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35dc, 0x35dd, 0x35fc, 0x35dc,
-  0x35dc, 0x35dd, 0x35fc, 0x35dc, 0x35dc, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d20, 0x04a0,
-  0x00c0, 0x0480, 0x0d20, 0x04a0, 0x00e2, 0x35dc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x2643,
-  0x0100, 0x0480, 0x0d80, 0x1e42, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0925, 0x1125, 0x1903, 0x10e3, 0x08a3, 0x1125,
-  0x1903, 0x10e3, 0x08a3, 0x1125, 0x1903, 0x10e3, 0x0925, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fc, 0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35dc,
-  0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35fc, 0x3e5f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x0060, 0x0060, 0x0060,
-  0x0000, 0x0060, 0x0060, 0x0060, 0x0082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0420, 0x04a0, 0x0440, 0x00e2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe567, 0xe4e1, 0xc400, 0x20c0, 0xe568,
-  0xe4e1, 0xc400, 0x20c0, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe567, 0xb3a0, 0x20e2, 0xce37,
-  0xe567, 0xb3a0, 0x20e2, 0xce37, 0xe567, 0xb3a0, 0x10e2, 0x35dc,
-  0x3e7f, 0x35fc, 0x0082, 0x1082, 0x1080, 0x1040, 0x0000, 0x10a2,
-  0x1080, 0x1040, 0x0000, 0x10a2, 0x1080, 0x1040, 0x0082, 0x35dc,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0420, 0x2663, 0xc677,
-  0x1904, 0x2d3a, 0x35dc, 0x35dc, 0x35fc, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00c0, 0x0100, 0x10e2,
-  0x0020, 0x00e2, 0x0102, 0x00e2, 0x0904, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xc400, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc400, 0xaba0, 0x18a0, 0xb3a0, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe547, 0xe4c1, 0xc400, 0x20c0, 0xe547,
-  0xe4c1, 0xc400, 0x20c0, 0xe547, 0xe4c1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1925, 0xe6d9, 0xfde8, 0xc400, 0x20e2, 0xe6d9,
-  0xfde8, 0xc400, 0x20e2, 0xe6d9, 0xfde8, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d80, 0x2662,
-  0x0922, 0x35fd, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x1e42, 0xb675,
-  0x1904, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x10e2, 0x10c2, 0x0020, 0x20e2,
-  0x20c0, 0x18a0, 0x0020, 0x10c2, 0x10e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dd, 0x10c2, 0xb3a0, 0xcc20, 0xb3a0, 0x18a0, 0xb3a0,
-  0xc420, 0xaba0, 0x18a0, 0xb3a0, 0xcc20, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe525, 0xdca0, 0xc400, 0x20c0, 0xe525,
-  0xdca0, 0xc400, 0x20c0, 0xe525, 0xdca0, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d20, 0x04a0,
-  0x00e2, 0x35dc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x1e42,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x2d5a, 0x1104, 0xd637,
-  0xe568, 0xb3a0, 0x10c2, 0x2d5a, 0x35fd, 0x35dc, 0x35fd, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0904, 0x10c2, 0x18e2, 0x10c2, 0x0020, 0x20e2,
-  0x28e0, 0x20a0, 0x0020, 0x10c2, 0x18e2, 0x10c2, 0x0904, 0x35fc,
-  0x3e7f, 0x35dc, 0x10c2, 0xb380, 0xc400, 0xab80, 0x18a0, 0xab80,
-  0xc400, 0xab80, 0x18a0, 0xab80, 0xc400, 0xb380, 0x10c2, 0x35dc,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x0060, 0x0060, 0x0060,
-  0x0082, 0x35fc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1903, 0xe567,
-  0xe4e1, 0xc400, 0x10e2, 0x35fd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e5f, 0x35dc, 0x35dc, 0x35fc, 0x2d59, 0x1104, 0xd636,
-  0xe567, 0xb3a0, 0x10c2, 0x2d5a, 0x35fc, 0x35dc, 0x35dc, 0x3e7f,
-  0x3e7f, 0x35fd, 0x0905, 0x0082, 0x0082, 0x0082, 0x0000, 0x1082,
-  0x1080, 0x1040, 0x0000, 0x0082, 0x0082, 0x0082, 0x0905, 0x35fc,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0420, 0x2663, 0xc677,
-  0x1905, 0x35dc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00c0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x1903, 0xe547,
-  0xe4c1, 0xc400, 0x10e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x1925, 0xe6d9,
-  0xfde8, 0xc400, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d80, 0x2662,
-  0x0902, 0x35dc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x1e42, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x10e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb3a0,
-  0xcc20, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x1903, 0xe525,
-  0xdca0, 0xc400, 0x10e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35dd, 0x00e2, 0x0480, 0x0d20, 0x04a0,
-  0x00e2, 0x35dc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x1e42,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x10c2,
-  0x18e2, 0x10c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x10c2, 0xb380,
-  0xc400, 0xb380, 0x10c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x0060, 0x0060, 0x0060,
-  0x0082, 0x35fc, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fc,
-  0x35fc, 0x35fc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x0082,
-  0x0082, 0x0082, 0x0904, 0x35fc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x35dc, 0x35dc, 0x35dc,
-  0x35fc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x00e2, 0x00e2,
-  0x0904, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e2, 0x0902, 0x1104,
-  0x0082, 0x00e2, 0x0902, 0x1104, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dd, 0x35dc, 0x35dc,
-  0x35fc, 0x35dd, 0x35dc, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35dc, 0x35dc,
-  0x35fd, 0x3e5f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0420, 0x1e42, 0xb675,
-  0x10c2, 0x0420, 0x1e42, 0xb675, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x00e3, 0x0923, 0x1925,
-  0x00a3, 0x00e3, 0x0923, 0x1925, 0x0905, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fc, 0x35dc, 0x35dc, 0x35dc,
-  0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35fc, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0905, 0x0082, 0x0082, 0x0082,
-  0x0082, 0x0082, 0x0082, 0x0082, 0x0905, 0x35fd, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fc, 0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2643,
-  0x0100, 0x04a0, 0x0da0, 0x2642, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x1e42, 0xb676,
-  0x10e2, 0x0420, 0x1e42, 0xb675, 0x1904, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x0060, 0x00a0, 0x10a2,
-  0x0000, 0x0060, 0x00a0, 0x1082, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x1082, 0x1082, 0x1082,
-  0x0082, 0x1082, 0x1082, 0x1082, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x2643,
-  0x0100, 0x0480, 0x0d80, 0x1e42, 0x0902, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x26e3, 0xc718,
-  0x1102, 0x04a0, 0x26e3, 0xc717, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1082, 0x9000, 0xa800, 0xc000,
-  0x1800, 0x9000, 0xa800, 0xc000, 0x1082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8800,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0020, 0x00c2, 0x00e2, 0x00c2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00c0, 0x0400, 0x04a0, 0x0440, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d60, 0x0e20,
-  0x0100, 0x0480, 0x0d60, 0x0e20, 0x0102, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1082, 0x9000, 0xd8a2, 0xe618,
-  0x20a2, 0x9000, 0xd8a2, 0xe5f7, 0x1925, 0x35dc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc082,
-  0x1800, 0x9000, 0xa800, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x2d3a, 0x35fd, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00c0, 0x0100, 0x10e2,
-  0x0020, 0x00e2, 0x00e2, 0x00e2, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0400, 0x0480, 0x0400,
-  0x00a0, 0x0400, 0x04a0, 0x0400, 0x00c2, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x0800, 0x1000, 0x10a2,
-  0x0000, 0x0800, 0x1000, 0x10a2, 0x0082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd75,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1924, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dd, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x1e42, 0xb675,
-  0x1904, 0x2d39, 0x35fc, 0x35dc, 0x35dc, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x0060, 0x00a0, 0x1082,
-  0x0000, 0x0062, 0x0082, 0x0082, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1800, 0x2000, 0x20a2,
-  0x0000, 0x1800, 0x2000, 0x20a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x1e42,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x26e3, 0xc717,
-  0x1925, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1082, 0x9000, 0xa800, 0xc000,
-  0x1800, 0x9000, 0xa800, 0xc000, 0x1082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00a0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x04a0, 0x0440,
-  0x00e2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d60, 0x0e20,
-  0x0102, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x1082, 0x9000, 0xd8a2, 0xe618,
-  0x20a2, 0x9000, 0xd8a2, 0xe5f7, 0x1925, 0x35dc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xa800, 0xc082,
-  0x1800, 0x9000, 0xa800, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x2643, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x00c0, 0x0100, 0x10e2,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0400, 0x0480, 0x0400,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e9f, 0x35fd, 0x0082, 0x0800, 0x1000, 0x10a2,
-  0x0000, 0x0800, 0x1000, 0x10a2, 0x0082, 0x35fc, 0x3e9f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd75,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1924, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x0da0, 0x2642,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0420, 0x1e42, 0xb675,
-  0x1904, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x0060, 0x00a0, 0x1082,
-  0x0082, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x35dc, 0x35dc, 0x35dc,
-  0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35fc, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x18a3, 0x1925,
-  0x08a3, 0x1082, 0x18a3, 0x1925, 0x0905, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d80, 0x1e42,
-  0x0902, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x04a0, 0x26e3, 0xc717,
-  0x1925, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f,
-  0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e9f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fc, 0x35dc, 0x35dc,
-  0x35dc, 0x35fc, 0x35dc, 0x35dc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00c2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0440,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00e2, 0x0480, 0x0d60, 0x0e20,
-  0x0102, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x35fd, 0x0905, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0082,
-  0x0082, 0x0082, 0x0082, 0x0082, 0x0082, 0x0905, 0x35fd, 0x3e9f,
-  0x3e5f, 0x35fc, 0x35dc, 0x35dc, 0x35fc, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x3e5f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0904, 0x00e2, 0x00e2, 0x00e2,
-  0x08e4, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35dc, 0x00c2, 0x0400, 0x04a0, 0x0400,
-  0x00c2, 0x35dc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e9f, 0x35dc, 0x1104, 0xd657, 0xe568, 0xb3a0, 0x20c1, 0xd658,
-  0xe568, 0xb3a0, 0x20c1, 0xd658, 0xe568, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1924, 0x1903, 0x10e2, 0x0882, 0x1924,
-  0x1903, 0x10e2, 0x0882, 0x1924, 0x1903, 0x10e2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x361d, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fc, 0x35fc, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fc, 0x35fc, 0x35fc,
-  0x35fd, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x0082, 0x0082, 0x0082,
-  0x0904, 0x35fc, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e9f, 0x35dc, 0x1903, 0xe568, 0xe4e1, 0xc400, 0x20e1, 0xe568,
-  0xe4e1, 0xc400, 0x20e1, 0xe568, 0xe4e1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1082, 0x1082, 0x0882,
-  0x0082, 0x1082, 0x1082, 0x0882, 0x08e4, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x3e5f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e9f, 0x35fd, 0x10e2, 0xc400, 0xdc80, 0xc400, 0x20a0, 0xc400,
-  0xdc80, 0xc400, 0x20a0, 0xc400, 0xdc80, 0xc3e0, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1903, 0xe547, 0xe4c1, 0xc400, 0x20c0, 0xe547,
-  0xe4c1, 0xc400, 0x20c0, 0xe547, 0xe4c1, 0xc400, 0x10e2, 0x35dc,
-  0x3e7f, 0x35dc, 0x1104, 0xd636, 0xe547, 0xb3a0, 0x20c1, 0xd636,
-  0xe547, 0xb3a0, 0x20c1, 0xd636, 0xe547, 0xb3a0, 0x10c2, 0x35dc,
-  0x3e7f, 0x35fd, 0x0905, 0x1104, 0x1903, 0x10c2, 0x0082, 0x1104,
-  0x1903, 0x10c2, 0x0082, 0x1104, 0x1903, 0x10c2, 0x0905, 0x35fc,
-  0x3e7f, 0x3e5f, 0x35fd, 0x35dc, 0x35fd, 0x35fd, 0x35fd, 0x35fd,
-  0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35fd, 0x35dd, 0x35fd, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x35fd, 0x35fd, 0x35dc,
-  0x35fd, 0x35fd, 0x35fd, 0x35dc, 0x35fd, 0x3e7f, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x08e4, 0x1082, 0x1082, 0x1124,
-  0x0082, 0x1082, 0x1082, 0x1924, 0x0904, 0x35fc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8800, 0xc082, 0xcd75,
-  0x1882, 0x8000, 0xc082, 0xd575, 0x1104, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8000, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0082, 0x1000, 0x1800, 0x18a2,
-  0x0000, 0x1000, 0x1800, 0x18a2, 0x0082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0882, 0x8000, 0xc082, 0xcd96,
-  0x18a2, 0x8000, 0xc082, 0xcd75, 0x1925, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x1082, 0x9000, 0xb000, 0xc082,
-  0x1800, 0x9000, 0xb000, 0xc082, 0x1082, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fc, 0x0862, 0x8000, 0x9000, 0x8000,
-  0x1000, 0x8000, 0x9000, 0x8800, 0x1062, 0x35dc, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x35fd, 0x0905, 0x1083, 0x1083, 0x1083,
-  0x0083, 0x1083, 0x1083, 0x1083, 0x0905, 0x35fd, 0x3e7f, 0x3e7f,
-  0x3e7f, 0x3e7f, 0x3e7f, 0x3e5f, 0x35fc, 0x35dc, 0x35dc, 0x35dc,
-  0x35dc, 0x35dc, 0x35dc, 0x35dc, 0x35fc, 0x3e5f, 0x3e7f, 0x3e7f
-};
-
-const Animation figures_tetrisAnimation = {
-  .name = "Figures Tetris",
-  .frameCount = 37,
-  .width = 16,
-  .height = 16,
-  .frameDurations = figures_tetrisDurations,
-  .animationFrames = figures_tetrisFrames
-};
-#endif // ANIMATION_FIGURES_TETRIS_H
@@ -1,1942 +0,0 @@
-// fireworks.h - Auto-generated from fireworks.json
-#ifndef ANIMATION_FIREWORKS_H
-#define ANIMATION_FIREWORKS_H
-
-#include "animation_types.h"
-
-// Frame Durations for fireworks (in 100ms units)
-static const uint8_t PROGMEM fireworksDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for fireworks
-static const uint16_t PROGMEM fireworksFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x300c, 0x300c, 0x300c, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x300c, 0xb596, 0x300c, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x300c, 0x300c, 0x300c, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x300c, 0x300c, 0x300c, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x300c, 0xb596, 0x300c, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x5817, 0x5817, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x300c, 0x4813, 0x300c, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x5817, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x5817, 0x5817, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x4012, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x5817, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x280f, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x4012, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x200c, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x280f, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x000c, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x280f, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x000c, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x5187, 0x5187, 0x5187, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000c, 0x000c, 0x000c, 0x000c, 0x5187, 0xffff, 0x5187, 0x000c,
-  0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2007, 0x2848, 0x2007, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2849, 0x5a4d, 0x2849, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2007, 0x2849, 0x2008, 0x0001, 0x0000,
-  0x0001, 0x0002, 0x2008, 0x2849, 0x2008, 0x0002, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0002, 0x2849, 0x5a4d, 0x2849, 0x0002, 0x0001,
-  0x0002, 0x0002, 0x0003, 0x0804, 0x0804, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0003, 0x2009, 0x284a, 0x2009, 0x0003, 0x0002,
-  0x0003, 0x0003, 0x0805, 0x300c, 0x300c, 0x0004, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0805, 0x0805, 0x0004, 0x0003, 0x0003,
-  0x0004, 0x0005, 0x280c, 0x0806, 0x0805, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0005, 0x300d, 0x300d, 0x0806, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0806, 0x0005, 0x1809, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0806, 0x0807, 0x280c, 0x0806, 0x0005,
-  0x0006, 0x0006, 0x180a, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x180a, 0x0006, 0x0807, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0829, 0x0007, 0x0006, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0807, 0x180a, 0x0007, 0x0006,
-  0x0008, 0x0008, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0007, 0x0008, 0x000a, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0828, 0x0808, 0x0828, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0009, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0829, 0x4167, 0x59e9, 0x4167, 0x0829,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000b, 0x080a, 0x59e9, 0xde57, 0x5a09, 0x080a,
-  0x000b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x080b, 0x59e7, 0xe564, 0x59e7, 0x080b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1003, 0x1024, 0x1003, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1024, 0x2907, 0x1024, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1003, 0x1024, 0x1003, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1004, 0x1025, 0x1004, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1025, 0x2907, 0x1025, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0002, 0x1004, 0x1025, 0x1004, 0x0002, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0004, 0x1008, 0x1007, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x1007, 0x0005, 0x0005, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x1008, 0x1008, 0x0005, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x1007, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0006, 0x0828, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x1008, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x1008, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0829, 0x0007, 0x0006, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0829, 0x0007, 0x0006,
-  0x0008, 0x0008, 0x0007, 0x0008, 0x0828, 0x0807, 0x0827, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x000a, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x0828, 0x4167, 0x59e9, 0x4167, 0x0828,
-  0x0009, 0x0008, 0x0008, 0x0009, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0809, 0x5a09, 0xde57, 0x5a09, 0x0809,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000b, 0x080a, 0x51a7, 0xdcc3, 0x51a7, 0x080a,
-  0x000b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x186a, 0x8b24, 0x186a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0802, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0822, 0x0861, 0x0822, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0002, 0x0822, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0822, 0x0861, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0002, 0x0000, 0x0001, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0025, 0x0025, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0025, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0025, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0026, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0826, 0x0005, 0x0026, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0827, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0827, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0847, 0x0806, 0x0826, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0828, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0827, 0x4165, 0x51e7, 0x4165, 0x0827,
-  0x0008, 0x0008, 0x0008, 0x0829, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x0808, 0x5a08, 0xde57, 0x5a08, 0x0808,
-  0x0009, 0x0008, 0x0008, 0x0009, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0809, 0x51a7, 0xdcc3, 0x51a7, 0x0809,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000b, 0x186a, 0x7ac5, 0x186a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x104b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0825, 0x0805, 0x0825, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0826, 0x4165, 0x51e7, 0x4165, 0x0826,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0807, 0x5a07, 0xde77, 0x5a07, 0x0807,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x0808, 0x51c7, 0xdd44, 0x51c6, 0x0808,
-  0x0009, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x1869, 0x8b04, 0x1869, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000b, 0x082a, 0x49a7, 0x082a, 0x000b,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x080b, 0x082b, 0x080b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0825, 0x0004, 0x0825, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0826, 0x4165, 0x51e7, 0x4165, 0x0826,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0806, 0x5a06, 0xde77, 0x5a07, 0x0806,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0807, 0x51c5, 0xdd44, 0x51c5, 0x0807,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x1068, 0x82e5, 0x1868, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x1049, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x082a, 0x3908, 0x082a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x080b, 0x082b, 0x080b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0824, 0x0003, 0x0824, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0825, 0x4163, 0x51e5, 0x4163, 0x0825,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0805, 0x5a06, 0xde77, 0x5a06, 0x0805,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0806, 0x51c5, 0xdd44, 0x51c5, 0x0806,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x1067, 0x82e4, 0x1867, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0828, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0809, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x080a, 0x20a8, 0x080a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x080b, 0x080b, 0x080b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0823, 0x0003, 0x0823, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0024, 0x4163, 0x51e5, 0x4163, 0x0024,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0004, 0x5a05, 0xde76, 0x5a05, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x51c4, 0xdd44, 0x51c4, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x1066, 0x7ae3, 0x1066, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0827, 0x0007, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x0002, 0x0022, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0023, 0x4163, 0x51e5, 0x4163, 0x0023,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x5a05, 0xde76, 0x5a05, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x51c3, 0xdd24, 0x51c3, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x1065, 0x8302, 0x1065, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0826, 0x51c3, 0x0826, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0007, 0x0827, 0x0007, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0021, 0x0001, 0x0021, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0022, 0x4163, 0x51e5, 0x4163, 0x0022,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x5a05, 0xde76, 0x5a05, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x51c3, 0xdd44, 0x51c3, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x1064, 0x8302, 0x1064, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0826, 0x4145, 0x0826, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0806, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x002b, 0x002b, 0x002b, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x002b, 0x018e, 0x01ae, 0x018e, 0x002b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x3100, 0x3100, 0x3100, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x3100, 0x6a20, 0x6a40, 0x6a20, 0x3100,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3100, 0x6a41, 0xabc3, 0xb3e3, 0xabc3, 0x7261,
-  0x3100, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x28e1, 0x6a20, 0xabc3, 0xf73a, 0xf79d, 0xf73a, 0xabc3,
-  0x6a20, 0x3101, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x3102, 0x6a40, 0xb3e3, 0xff9d, 0xffff, 0xf7bd, 0xb3e3,
-  0x7240, 0x3122, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x30e2, 0x6a20, 0xaba3, 0xf73a, 0xffbd, 0xf73a, 0xabc3,
-  0x6a20, 0x3102, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0824, 0x3103, 0x6a42, 0xb3c3, 0xd503, 0xb3c3, 0x7262,
-  0x3103, 0x0824, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0825, 0x3104, 0x6a22, 0x7262, 0x6a22, 0x3124,
-  0x0825, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0826, 0x3104, 0x4964, 0x3104, 0x0826,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0006, 0x0826, 0x0006, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x002a, 0x000a, 0x002a, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x002b, 0x018e, 0x1a2f, 0x018e, 0x002b, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x1a2f, 0xc69b, 0x1a2f, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x3100, 0x3920, 0x3100, 0x0820,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x3100, 0x61e0, 0x6200, 0x61e0, 0x3100,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x3100, 0x6a20, 0xaba3, 0xb3e3, 0xabc3, 0x6a20,
-  0x3100, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x3100, 0x6a20, 0xb404, 0xf718, 0xff7a, 0xf738, 0xb405,
-  0x6a20, 0x3100, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3101, 0x61e0, 0xaba3, 0xf718, 0xfe26, 0xf5c3, 0xfe26, 0xf738,
-  0xabc3, 0x6200, 0x2901, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x3922, 0x6200, 0xb3e3, 0xff7b, 0xf5c4, 0xb400, 0xf5c3, 0xff9b,
-  0xb3e3, 0x6200, 0x3102, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x3102, 0x61e2, 0xaba3, 0xf718, 0xfe26, 0xf5c3, 0xfe26, 0xf718,
-  0xabc3, 0x6202, 0x3102, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0824, 0x3103, 0x6222, 0xabe5, 0xf718, 0xff7a, 0xf718, 0xb3e5,
-  0x6a22, 0x3103, 0x0824, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0825, 0x3104, 0x6222, 0xaba3, 0xb3e3, 0xaba3, 0x6a22,
-  0x3104, 0x0825, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0826, 0x3104, 0x6202, 0x6202, 0x6202, 0x3104,
-  0x0826, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0826, 0x30e5, 0x3105, 0x30e5, 0x0826,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0807, 0x0807, 0x0807, 0x0008,
-  0x0008, 0x0008, 0x0007, 0x0007, 0x0007, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0029, 0x0008, 0x0029, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x002a, 0x018c, 0x1a0d, 0x018c, 0x002a, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000b, 0x122f, 0xb69b, 0x1a2f, 0x000b, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x022f, 0x16f8, 0x022f, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0820, 0x3120, 0x3920, 0x3920, 0x3920, 0x3920, 0x3920,
-  0x3120, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x30e0, 0x7260, 0x82e2, 0x7a81, 0x82c2, 0x7a81, 0x82e2,
-  0x7260, 0x3100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x3920, 0x82c2, 0xd655, 0x9ba5, 0xe695, 0x9ba5, 0xd656,
-  0x82e2, 0x3920, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3120, 0x7260, 0x8b02, 0x9b63, 0xe541, 0xf5e3, 0xe541, 0x9b63,
-  0x8b02, 0x7260, 0x3100, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3920, 0x82e3, 0xef18, 0xeda3, 0xa3c1, 0x9341, 0xa3c1, 0xed83,
-  0xef18, 0x82e3, 0x3101, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x3921, 0x82c3, 0xeef8, 0xfde4, 0x9362, 0x28e2, 0x9342, 0xf5e4,
-  0xeef8, 0x82e3, 0x3101, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x3922, 0x7a81, 0x9ba5, 0xe521, 0xabe2, 0x9362, 0xa3c2, 0xe521,
-  0x9ba5, 0x7a81, 0x3922, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x3923, 0x82c4, 0xd656, 0xa3c7, 0xe542, 0xf5e4, 0xe542, 0xa3c6,
-  0xd656, 0x82e4, 0x3103, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x3924, 0x7242, 0x9367, 0xd656, 0x9ba7, 0xe696, 0x9ba7, 0xd656,
-  0x9367, 0x7262, 0x3104, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0826, 0x3904, 0x7262, 0x82e4, 0x7a83, 0x82c4, 0x7a83, 0x82e4,
-  0x7262, 0x3924, 0x0826, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0826, 0x3105, 0x3905, 0x3925, 0x3905, 0x3925, 0x3905,
-  0x3105, 0x0826, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0007, 0x0807, 0x0807, 0x0807, 0x0807, 0x0807,
-  0x0007, 0x0008, 0x0028, 0x0008, 0x0028, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0029, 0x016c, 0x1a0d, 0x018c, 0x0029, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x120e, 0xb69b, 0x1a2e, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000b, 0x020f, 0x16b8, 0x020f, 0x000b, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x008c, 0x0452, 0x00ac, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3100, 0x41a2, 0x3100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x28e0, 0x4182, 0x4140, 0x41a2, 0xce36, 0x41a2, 0x3940,
-  0x4182, 0x28e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3962, 0xce36, 0xcce3, 0x5a00, 0xd503, 0x5a00, 0xcce3,
-  0xd636, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3100, 0x41a2, 0x5203, 0x51c0, 0x82e1, 0x9341, 0x82e1, 0x51c0,
-  0x5203, 0x41a2, 0x28e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x41a4, 0xdeb8, 0xed83, 0x8b21, 0x1081, 0x0841, 0x1081, 0x8b21,
-  0xed83, 0xe6d8, 0x4184, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x41a5, 0xdeb8, 0xed84, 0x9362, 0x0822, 0x0002, 0x0822, 0x9362,
-  0xed84, 0xe6d9, 0x4184, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x3122, 0x4184, 0x5a02, 0x7ac2, 0x1883, 0x0843, 0x1883, 0x7ac2,
-  0x5a02, 0x4184, 0x3102, 0x0023, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x3103, 0x51e5, 0xbc42, 0x3963, 0x7ac2, 0x9362, 0x7ac2, 0x3963,
-  0xbc42, 0x51e5, 0x3103, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x49a6, 0xc5d7, 0x72c8, 0xbc42, 0x5a04, 0xd524, 0x5a04, 0xbc42,
-  0x72c8, 0xc5f7, 0x4186, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x3104, 0x5208, 0xc5f7, 0x51e6, 0x4186, 0xd637, 0x49a6, 0x51e6,
-  0xc5f7, 0x5228, 0x30e4, 0x0805, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0826, 0x28e5, 0x4187, 0x3105, 0x3105, 0x4167, 0x3105, 0x3105,
-  0x4187, 0x30e5, 0x0846, 0x0007, 0x0027, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0807, 0x0007, 0x0807, 0x0807, 0x0007, 0x0807, 0x0807,
-  0x0007, 0x0828, 0x016b, 0x120c, 0x018b, 0x0028, 0x0007, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0009, 0x120d, 0xb69b, 0x1a2e, 0x0009, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x01ed, 0x16d7, 0x020d, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x008b, 0x03d1, 0x008b, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x004c, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x41a2, 0xdeb8, 0x41a3, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3100, 0x4182, 0x3960, 0x1060, 0x3960, 0xd523, 0x4160, 0x1060,
-  0x3960, 0x4182, 0x28e0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4182, 0xce16, 0xdd23, 0x7ac0, 0x1880, 0x7ac0, 0x1880, 0x7ac0,
-  0xd523, 0xce36, 0x3962, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x49c3, 0x5203, 0x49a0, 0x1060, 0x0000, 0x0820, 0x0000, 0x1060,
-  0x49a0, 0x5203, 0x49a3, 0x28e0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xde98, 0xe563, 0x8b21, 0x0821, 0x0001, 0x0001, 0x0001, 0x0821,
-  0x8b21, 0xe563, 0xce36, 0x3983, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x6aa7, 0xdd02, 0x8b22, 0x0842, 0x0002, 0x0002, 0x0002, 0x0842,
-  0x8b22, 0xdd22, 0x6286, 0x3102, 0x0002, 0x0002, 0x0002, 0x0002,
-  0xce58, 0x49c4, 0x1883, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x1883, 0x49c4, 0xc5d6, 0x4184, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x4185, 0x49a3, 0x6a83, 0x1884, 0x0004, 0x0824, 0x0004, 0x1084,
-  0x6a83, 0x49a3, 0x4185, 0x3103, 0x0024, 0x0004, 0x0004, 0x0004,
-  0x5206, 0xbc62, 0x3963, 0x6a83, 0x20a4, 0x7ac2, 0x20a4, 0x6a83,
-  0x3963, 0xc462, 0x51e6, 0x3104, 0x0805, 0x0005, 0x0005, 0x0005,
-  0xce59, 0x6266, 0xcce4, 0x49a4, 0x4164, 0xdd24, 0x4164, 0x49a4,
-  0xcce4, 0x6266, 0xc5f7, 0x4187, 0x0025, 0x0006, 0x0006, 0x0006,
-  0x4167, 0x41a7, 0xd637, 0x4187, 0x4187, 0xd637, 0x49a7, 0x4187,
-  0xd637, 0x49c8, 0x328b, 0x3aab, 0x096a, 0x0027, 0x0006, 0x0007,
-  0x0807, 0x30e6, 0x4168, 0x3106, 0x3106, 0x4168, 0x3106, 0x3106,
-  0x4168, 0x2906, 0x1a2c, 0xb69a, 0x122d, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0808, 0x0008, 0x0808, 0x0808, 0x0008, 0x0808, 0x0808,
-  0x0008, 0x0828, 0x01ed, 0x16d7, 0x020d, 0x0009, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x008a, 0x0411, 0x008b, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x002b, 0x020e, 0x002b, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x002c, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3100, 0xc461, 0x3100, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1060, 0x0840, 0x0000, 0x0840, 0x6a61, 0x0840, 0x0000,
-  0x0840, 0x1060, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3982, 0xac01, 0x7281, 0x0820, 0x0000, 0x0820, 0x0000, 0x0820,
-  0x6a61, 0xb401, 0x3982, 0x18a0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xce36, 0x49c2, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0840, 0x49a2, 0xbdb4, 0x3122, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xdd44, 0x7ac1, 0x0821, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0821, 0x7ac1, 0xc4a4, 0x41a4, 0x20a2, 0x0001, 0x0001, 0x0001,
-  0x3101, 0x6a62, 0x0842, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0842, 0x6a62, 0x5203, 0xad55, 0x3144, 0x0002, 0x0002, 0x0002,
-  0xc4a4, 0x3922, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x3122, 0xbc64, 0x41a4, 0x20a2, 0x0003, 0x0003, 0x0003,
-  0xc617, 0x3965, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x3945, 0xbd95, 0x3125, 0x0003, 0x0004, 0x0004, 0x0004,
-  0x49a5, 0x6243, 0x1064, 0x0005, 0x0005, 0x0825, 0x0005, 0x0005,
-  0x1064, 0x6263, 0x41a5, 0x20c4, 0x0025, 0x0005, 0x0005, 0x0005,
-  0xc4a4, 0x4985, 0x6a63, 0x1045, 0x1045, 0x6a63, 0x1045, 0x0845,
-  0x6a63, 0x4185, 0x94c8, 0x42cb, 0x0169, 0x0026, 0x0006, 0x0006,
-  0xc5f7, 0x49a7, 0xbc84, 0x3105, 0x3105, 0xc484, 0x3105, 0x3105,
-  0xc484, 0x41a7, 0xa637, 0xc71b, 0x120b, 0x0007, 0x0006, 0x0007,
-  0x3128, 0x3968, 0xbd96, 0x3948, 0x3948, 0xbd96, 0x3948, 0x3948,
-  0xbd96, 0x3968, 0x2acc, 0x16f7, 0x01ec, 0x0008, 0x0007, 0x0008,
-  0x0808, 0x20a7, 0x3129, 0x28c7, 0x28c7, 0x3129, 0x28c7, 0x28c7,
-  0x3129, 0x20a7, 0x0889, 0x03f0, 0x008a, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0809, 0x0009, 0x0809, 0x0809, 0x0009, 0x0809, 0x0809,
-  0x0009, 0x0809, 0x0009, 0x006a, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x080a, 0x080a, 0x080a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x002b, 0x012c, 0x002b, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x080b, 0x400c, 0x480c, 0x400c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x002b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3122, 0xad34, 0x3122, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0x0000, 0x0000, 0x20a0, 0x3122, 0x20a0, 0x0000,
-  0x0000, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1880, 0x49a0, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0820, 0x49a0, 0x1880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xabe1, 0x1880, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1880, 0xa3c1, 0x3962, 0x18a0, 0x0000, 0x0000, 0x0000,
-  0x6221, 0x0821, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0021, 0x6a83, 0xb532, 0x3123, 0x0001, 0x0001, 0x0001,
-  0x0842, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x3942, 0xbca5, 0x3122, 0x0002, 0x0002, 0x0002,
-  0x6202, 0x0843, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0823, 0x6a84, 0xb553, 0x3125, 0x0003, 0x0003, 0x0003,
-  0xbc84, 0x2904, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x28e3, 0xb444, 0x41a6, 0x18a4, 0x0004, 0x0004, 0x0004,
-  0xbdb5, 0x3126, 0x0004, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x2925, 0x95b5, 0x2229, 0x0107, 0x0005, 0x0005, 0x0005,
-  0x72a6, 0x28e5, 0x0826, 0x0006, 0x0006, 0x0826, 0x0006, 0x0006,
-  0x0825, 0x28e5, 0x5348, 0x0886, 0x0108, 0x0026, 0x0006, 0x0006,
-  0xbc64, 0x3926, 0x5a04, 0x0846, 0x0846, 0x5a04, 0x0846, 0x0846,
-  0x5a04, 0x3146, 0x94a8, 0x1108, 0x0129, 0x0027, 0x0006, 0x0007,
-  0xb576, 0x4188, 0xac24, 0x28e7, 0x28e7, 0xb425, 0x28e7, 0x28e7,
-  0xb424, 0x4188, 0xa576, 0x1410, 0x0068, 0x0007, 0x0008, 0x0008,
-  0x28e8, 0x3128, 0xad35, 0x3128, 0x3108, 0xad35, 0x3128, 0x3108,
-  0xad35, 0x3129, 0x28e8, 0x18e8, 0x0808, 0x0008, 0x0008, 0x0009,
-  0x0809, 0x2088, 0x310a, 0x2888, 0x28a8, 0x290a, 0x20a8, 0x20a8,
-  0x290a, 0x2088, 0x0809, 0x0809, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x080a, 0x400b, 0x58ad, 0x482c, 0x080a, 0x080a, 0x080a,
-  0x000a, 0x080a, 0x000b, 0x00cc, 0x000b, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x080b, 0x50ad, 0xd61b, 0x58ad, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x8322, 0x0860, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0x7bae, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x28c1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x20c1, 0x0840, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x1062, 0x72c3, 0x0841, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0863, 0x83ee, 0x1064, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x1083, 0x7b25, 0x1084, 0x0003, 0x0003, 0x0003,
-  0x3103, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0024, 0x3268, 0x7cf3, 0x09c9, 0x0004, 0x0004, 0x0004,
-  0x8324, 0x1045, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0845, 0x7c6a, 0xc71b, 0x120b, 0x0005, 0x0005, 0x0005,
-  0x8c12, 0x1067, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0005, 0x0847, 0x6cd3, 0x1f18, 0x01eb, 0x0006, 0x0006, 0x0006,
-  0x4166, 0x0827, 0x0006, 0x0007, 0x0007, 0x0006, 0x0007, 0x0007,
-  0x0006, 0x0806, 0x39c7, 0x0430, 0x0088, 0x0006, 0x0007, 0x0007,
-  0x8b26, 0x1067, 0x30e6, 0x0827, 0x0807, 0x3106, 0x0827, 0x0807,
-  0x30e6, 0x1067, 0x7b06, 0x11cb, 0x0028, 0x0007, 0x0008, 0x0008,
-  0x8413, 0x20a9, 0x7ac6, 0x1028, 0x1048, 0x8306, 0x1048, 0x1048,
-  0x7ae6, 0x20c9, 0x7bb2, 0x108a, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x086a, 0x104a, 0x92f1, 0x58ed, 0x506c, 0x83b2, 0x106a, 0x104a,
-  0x7bb2, 0x106a, 0x084a, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x080a, 0x58ce, 0xdd99, 0x58ad, 0x104b, 0x000b, 0x000a,
-  0x104b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x080b, 0x580c, 0xe0b0, 0x580c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x49a1, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x4208, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0821, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0843, 0x49a3, 0x0843, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0023, 0x09a8, 0x538e, 0x09a8, 0x0023, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x120a, 0xb6ba, 0x1a2a, 0x0004, 0x0004, 0x0004,
-  0x0824, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0a09, 0x16d7, 0x01ea, 0x0005, 0x0005, 0x0005,
-  0x51c4, 0x0826, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0825, 0x4a26, 0x0c10, 0x0087, 0x0005, 0x0006, 0x0006,
-  0x4a2d, 0x0827, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0006, 0x0827, 0x4a0d, 0x08a8, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x1048, 0x0008, 0x0808, 0x0807, 0x0808, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0007, 0x1068, 0x012a, 0x0028, 0x0007, 0x0008, 0x0008,
-  0x49c7, 0x1028, 0x482a, 0x58ab, 0x400a, 0x1028, 0x0008, 0x0008,
-  0x0828, 0x0828, 0x49a7, 0x0849, 0x0009, 0x0008, 0x0008, 0x0009,
-  0x4a4f, 0x104a, 0x81cb, 0xddb9, 0x60cd, 0x4988, 0x0829, 0x0829,
-  0x49a8, 0x106a, 0x4a0f, 0x084a, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x082b, 0x082b, 0x798f, 0xd8b0, 0x584c, 0x4a0f, 0x082b, 0x082b,
-  0x4a0f, 0x084b, 0x082b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x182c, 0x880c, 0x180c, 0x082c, 0x080b, 0x080b,
-  0x082c, 0x080b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0185, 0x01a5, 0x0185, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x01a6, 0x032a, 0x034b, 0x032a, 0x01a6, 0x0021, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0042,
-  0x01c7, 0x036b, 0x1572, 0x1593, 0x1572, 0x036b, 0x01c7, 0x0042,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x0187,
-  0x032c, 0x1572, 0xd79d, 0xefde, 0xd79d, 0x1573, 0x032c, 0x01c7,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x01a8,
-  0x034d, 0x1593, 0xefde, 0xffff, 0xefde, 0x1593, 0x034d, 0x01e8,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x0188,
-  0x032d, 0x1553, 0xd79d, 0xefff, 0xd79d, 0x1553, 0x032c, 0x01c9,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0045,
-  0x01a9, 0x034d, 0x1573, 0x16b6, 0x1573, 0x034d, 0x01a9, 0x0045,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0026, 0x01aa, 0x032d, 0x036d, 0x032d, 0x01aa, 0x0026, 0x0006,
-  0x0007, 0x0007, 0x0807, 0x0807, 0x0807, 0x0007, 0x0007, 0x0007,
-  0x0006, 0x0027, 0x018a, 0x01ab, 0x018a, 0x0047, 0x0006, 0x0007,
-  0x0008, 0x0808, 0x400a, 0x58ab, 0x400a, 0x0808, 0x0008, 0x0008,
-  0x0008, 0x0007, 0x0028, 0x00aa, 0x0028, 0x0007, 0x0008, 0x0008,
-  0x0008, 0x0808, 0x588c, 0xdd99, 0x58ac, 0x0808, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0009, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x080a, 0x500c, 0xd88f, 0x500c, 0x080a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x180b, 0x780c, 0x180b, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x100b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0184, 0x01a5, 0x0184, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x01a5, 0x032a, 0x034b, 0x032a, 0x01a5, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x01a5, 0x036b, 0x1572, 0x1d93, 0x1572, 0x036b, 0x01a5, 0x0020,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0042, 0x01a6,
-  0x036b, 0x2593, 0xc79d, 0xd7de, 0xc79d, 0x2593, 0x036b, 0x01c6,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x0167, 0x032c,
-  0x1573, 0xc79d, 0x2fda, 0x17b9, 0x2fda, 0xc79d, 0x1552, 0x034d,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x01a8, 0x034d,
-  0x1d93, 0xdfde, 0x17b9, 0x05b2, 0x17b9, 0xdfde, 0x1d93, 0x036d,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x0188, 0x032c,
-  0x1553, 0xc79d, 0x2ffa, 0x1fb9, 0x2fda, 0xc79d, 0x1553, 0x034d,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0045, 0x0189,
-  0x034d, 0x2593, 0xc79d, 0xd7de, 0xc79d, 0x2593, 0x034d, 0x01a9,
-  0x0006, 0x0006, 0x0806, 0x0006, 0x0806, 0x0006, 0x0006, 0x0026,
-  0x018a, 0x034d, 0x1553, 0x1593, 0x1553, 0x034d, 0x018a, 0x0026,
-  0x0006, 0x0807, 0x4028, 0x50aa, 0x4029, 0x0807, 0x0006, 0x0006,
-  0x0027, 0x018a, 0x030d, 0x034d, 0x032d, 0x018a, 0x0027, 0x0006,
-  0x0008, 0x0807, 0x588b, 0xdd99, 0x58ab, 0x0807, 0x0008, 0x0008,
-  0x0007, 0x0028, 0x018b, 0x01ab, 0x018b, 0x0048, 0x0007, 0x0008,
-  0x0008, 0x0808, 0x500a, 0xd88f, 0x500a, 0x0808, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x0029, 0x0029, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x180a, 0x800c, 0x180a, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x080b, 0x400b, 0x080b, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x080b, 0x080b, 0x080b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040,
-  0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x01a5, 0x0185, 0x0040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0185,
-  0x03ac, 0x142e, 0x03cd, 0x140e, 0x03cd, 0x142e, 0x03ac, 0x01a5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0041, 0x01c6,
-  0x140e, 0xaeba, 0x2cf1, 0xaf1a, 0x2cf1, 0xaeba, 0x140e, 0x0207,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0022, 0x01a6, 0x03ac,
-  0x142e, 0x14d0, 0x0717, 0x17b9, 0x0737, 0x14d0, 0x142e, 0x03cd,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x01c7, 0x140e,
-  0xc75c, 0x1778, 0x0531, 0x0490, 0x0531, 0x1758, 0xc75c, 0x1c4f,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x01a8, 0x140e,
-  0xc75c, 0x17da, 0x0490, 0x0146, 0x0490, 0x17b9, 0xbf5c, 0x1c4f,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x01c9, 0x03cf,
-  0x24d2, 0x0717, 0x0552, 0x0490, 0x0532, 0x0717, 0x24d2, 0x03ef,
-  0x0005, 0x0005, 0x0805, 0x0005, 0x0805, 0x0025, 0x01a9, 0x13f0,
-  0xb6ba, 0x2d13, 0x0717, 0x17b9, 0x0717, 0x2d13, 0xaeba, 0x1451,
-  0x0006, 0x0806, 0x4028, 0x50aa, 0x4028, 0x0806, 0x0046, 0x01ea,
-  0x2c71, 0xb6ba, 0x2cf3, 0xaefb, 0x2cf3, 0xb6ba, 0x2c92, 0x03cf,
-  0x0006, 0x0806, 0x58aa, 0xdd99, 0x58aa, 0x0806, 0x0007, 0x018b,
-  0x038f, 0x1410, 0x03cf, 0x1410, 0x03cf, 0x1410, 0x038f, 0x01eb,
-  0x0008, 0x0808, 0x500a, 0xd88f, 0x500a, 0x0808, 0x0007, 0x0048,
-  0x018b, 0x01ab, 0x01ab, 0x01ab, 0x01ab, 0x01ab, 0x018b, 0x0048,
-  0x0008, 0x0008, 0x1809, 0x780b, 0x1809, 0x0008, 0x0008, 0x0008,
-  0x0009, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0009, 0x0008,
-  0x0009, 0x0009, 0x0009, 0x100a, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x080a, 0x280b, 0x080a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x080b, 0x080b, 0x080b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0000, 0x0020, 0x0164, 0x1206, 0x0164, 0x0020, 0x0000, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0164,
-  0x1227, 0x0206, 0x1227, 0xb679, 0x1227, 0x0206, 0x1207, 0x01a5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x11c7,
-  0xb679, 0x1675, 0x02ea, 0x16b6, 0x02ea, 0x1675, 0xae79, 0x1207,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0022, 0x0165, 0x1228,
-  0x1289, 0x0289, 0x040e, 0x0490, 0x040e, 0x0289, 0x1289, 0x1228,
-  0x0002, 0x0803, 0x3004, 0x3005, 0x3004, 0x0003, 0x11e8, 0xc71b,
-  0x1758, 0x044f, 0x00a4, 0x0043, 0x00a4, 0x044f, 0x1738, 0xd79d,
-  0x0803, 0x3005, 0x6808, 0x6808, 0x6808, 0x3005, 0x19e9, 0xc71b,
-  0x1758, 0x04b0, 0x0044, 0x0002, 0x0044, 0x04b0, 0x1738, 0xd77d,
-  0x3006, 0x6808, 0xb08d, 0xb8ad, 0xb08d, 0x6829, 0x314a, 0x120a,
-  0x02cb, 0x03ce, 0x00c6, 0x0064, 0x00c6, 0x03ce, 0x02cb, 0x120a,
-  0x6808, 0xa88d, 0xf6bc, 0xff5e, 0xf6bc, 0xb0ad, 0x68cb, 0x3a4d,
-  0x05d4, 0x01c9, 0x03ce, 0x04b0, 0x03ee, 0x01c9, 0x05d4, 0x128c,
-  0x700b, 0xb08d, 0xff7e, 0xffff, 0xff7e, 0xb0ad, 0x792d, 0xc5f9,
-  0x2b8f, 0x05d4, 0x02cd, 0x16b7, 0x02cd, 0x05d4, 0x2b6f, 0xc67a,
-  0x680a, 0xa88d, 0xf69c, 0xff5e, 0xf6bc, 0xb0ad, 0x60ab, 0x526e,
-  0xb619, 0x128d, 0x120c, 0xb67a, 0x120c, 0x126d, 0xb619, 0x2aae,
-  0x3808, 0x680b, 0xb08d, 0xd8af, 0xb08d, 0x680b, 0x3028, 0x096b,
-  0x120c, 0x018b, 0x018b, 0x11ec, 0x018b, 0x018b, 0x11ec, 0x018b,
-  0x0809, 0x300a, 0x680b, 0x700b, 0x680b, 0x380a, 0x0809, 0x0029,
-  0x0008, 0x0029, 0x0029, 0x0008, 0x0029, 0x0029, 0x0008, 0x0029,
-  0x0009, 0x080a, 0x300b, 0x380b, 0x300b, 0x080a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x080b, 0x200b, 0x080b, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x080b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x01a5, 0x1227, 0x01a5, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x1207, 0xae99, 0x1227, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0184, 0x1227,
-  0x0206, 0x0082, 0x0206, 0x16d6, 0x0206, 0x0082, 0x0206, 0x1227,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x11e7, 0xb679,
-  0x16d6, 0x03cd, 0x00c3, 0x03cd, 0x00c3, 0x03cd, 0x16b6, 0xc6fb,
-  0x0001, 0x0802, 0x2804, 0x3004, 0x3025, 0x0966, 0x1229, 0x1aaa,
-  0x0249, 0x0083, 0x0001, 0x0042, 0x0001, 0x0083, 0x0249, 0x12aa,
-  0x0802, 0x3005, 0x6808, 0x6808, 0x6008, 0x41ca, 0xb679, 0x1738,
-  0x046f, 0x0043, 0x0002, 0x0002, 0x0002, 0x0043, 0x046f, 0x0737,
-  0x3005, 0x6808, 0xb0ad, 0xb8ce, 0xb0ad, 0x70eb, 0x4aed, 0x0ed7,
-  0x044f, 0x0044, 0x0003, 0x0003, 0x0003, 0x0044, 0x042f, 0x0717,
-  0x7008, 0xb10e, 0xf61b, 0xfebc, 0xf61b, 0xc211, 0xd5d9, 0x422d,
-  0x00a6, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x00c6, 0x00a6,
-  0xb0ad, 0xf61b, 0xf951, 0xf0af, 0xf951, 0xf63b, 0xb9b0, 0x618d,
-  0x2aae, 0x00a7, 0x0005, 0x0046, 0x0005, 0x00a7, 0x036d, 0x022a,
-  0xb8ce, 0xf6bc, 0xf090, 0xb00b, 0xf08f, 0xfebd, 0xb251, 0x25b5,
-  0x21cb, 0x036f, 0x00e8, 0x03d0, 0x00e8, 0x036f, 0x01ea, 0x0655,
-  0xb0ae, 0xf61b, 0xf971, 0xf0d0, 0xf951, 0xfebc, 0xe67b, 0x626f,
-  0x1e56, 0x026d, 0x020c, 0x16d7, 0x020c, 0x024d, 0x1676, 0x02ce,
-  0x700b, 0xb10e, 0xf61b, 0xfebc, 0xf63b, 0xb190, 0x698e, 0x49ed,
-  0xb67a, 0x122d, 0x122d, 0xb67a, 0x122d, 0x122d, 0xae7a, 0x1a4d,
-  0x300a, 0x680b, 0xb0ad, 0xb0ae, 0xb0ad, 0x680b, 0x282a, 0x096c,
-  0x11ed, 0x018c, 0x018c, 0x11ed, 0x018c, 0x018c, 0x11ed, 0x018c,
-  0x080a, 0x300b, 0x680b, 0x680b, 0x680b, 0x300b, 0x080a, 0x002a,
-  0x0009, 0x002a, 0x002a, 0x0009, 0x002a, 0x002a, 0x0009, 0x002a,
-  0x000a, 0x080b, 0x280b, 0x300c, 0x280b, 0x080b, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000b, 0x000b, 0x080b, 0x080b, 0x080b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1185, 0xae58, 0x1185, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0164, 0x1614, 0x0184, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0082,
-  0x0061, 0x0000, 0x0081, 0x03cd, 0x0081, 0x0000, 0x0081, 0x0184,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0104, 0x11e7, 0x0592,
-  0x03ed, 0x0041, 0x0000, 0x0041, 0x0000, 0x0041, 0x03cd, 0x0614,
-  0x3005, 0x3004, 0x3005, 0x3004, 0x3005, 0x4129, 0xa5f8, 0x1269,
-  0x0063, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0083, 0x01e7,
-  0x7829, 0x80aa, 0x7829, 0x80aa, 0x7829, 0x792c, 0x25f5, 0x04f0,
-  0x0063, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0063, 0x040e,
-  0x808b, 0xd578, 0x994d, 0xe579, 0x994d, 0xd599, 0x6a0d, 0x13cf,
-  0x0064, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0064, 0x040e,
-  0x88ab, 0x98ab, 0xe02e, 0xf090, 0xe02e, 0x918e, 0x35b5, 0x692c,
-  0x3006, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0045,
-  0xf6bc, 0xe8af, 0xa00b, 0x900a, 0xa00b, 0xe8af, 0xe6bc, 0x798e,
-  0x3006, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0066,
-  0xf69c, 0xf0b0, 0x900a, 0x2807, 0x900a, 0xf8b0, 0xdefc, 0x2cd2,
-  0x20a8, 0x0806, 0x0006, 0x0046, 0x0006, 0x0006, 0x00a7, 0x03af,
-  0x992f, 0xe00e, 0xa80c, 0x900b, 0xa80c, 0xd88f, 0x4637, 0x61ee,
-  0x0bf0, 0x0068, 0x0068, 0x03f0, 0x0068, 0x0068, 0x03f0, 0x00e9,
-  0xde1a, 0xa12f, 0xe02e, 0xf0b0, 0xe02e, 0xa1af, 0xce1a, 0x81ae,
-  0x1df5, 0x018b, 0x016b, 0x1615, 0x018b, 0x016b, 0x1615, 0x018b,
-  0x914f, 0xd579, 0x992f, 0xe579, 0x992f, 0xd599, 0x918f, 0x810d,
-  0xadd8, 0x11ac, 0x118c, 0xa5d8, 0x118c, 0x118c, 0xa5b8, 0x19ac,
-  0x780c, 0x808d, 0x782c, 0x808d, 0x782c, 0x808d, 0x700c, 0x30ac,
-  0x196d, 0x010c, 0x010c, 0x116d, 0x010c, 0x010c, 0x116d, 0x010c,
-  0x380b, 0x380b, 0x380b, 0x380b, 0x380b, 0x380b, 0x300b, 0x080b,
-  0x000a, 0x000b, 0x000b, 0x000a, 0x000b, 0x000b, 0x000a, 0x000b,
-  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00a2, 0x1593, 0x00a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1164, 0x9554, 0x1164, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061,
-  0x0000, 0x0000, 0x00e3, 0x1164, 0x00e3, 0x0000, 0x0000, 0x0061,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00e3, 0x036c,
-  0x0061, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0061, 0x03ac,
-  0x0001, 0x0002, 0x2804, 0x38a7, 0x30c7, 0x11e7, 0x04d0, 0x00e4,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0063,
-  0x40a7, 0x4005, 0x4087, 0xcd98, 0x51eb, 0xacd5, 0x522c, 0x2805,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0xde1a, 0xc8ae, 0x5808, 0xd0ae, 0x58c9, 0xe1b1, 0xd5f9, 0x4088,
-  0x0803, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x58aa, 0x5008, 0x800a, 0x900a, 0x888b, 0xc4f7, 0x63d2, 0x40ca,
-  0x3007, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0xe00e, 0x880a, 0x1806, 0x0805, 0x1806, 0x908b, 0xe8f0, 0xe63b,
-  0x40a9, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0xe00e, 0x980b, 0x0806, 0x0005, 0x0806, 0x900a, 0xe110, 0xe63a,
-  0x40a9, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x5809, 0x780b, 0x1807, 0x0807, 0x1807, 0x786c, 0x3350, 0x40ea,
-  0x3048, 0x0807, 0x0007, 0x0006, 0x0007, 0x0007, 0x0047, 0x0007,
-  0xc00d, 0x3809, 0x780b, 0x900b, 0x780b, 0x38cb, 0xc0ef, 0x518d,
-  0x2b2f, 0x0868, 0x0007, 0x0048, 0x0007, 0x0088, 0x03d0, 0x0089,
-  0x68ad, 0xb80d, 0x600c, 0xd0af, 0x580b, 0xc8af, 0xe5da, 0xd6bb,
-  0x4d15, 0x094b, 0x0089, 0x03d0, 0x0089, 0x016b, 0x1594, 0x018b,
-  0xce1a, 0x508c, 0x488c, 0xd599, 0x488c, 0x512d, 0xce3a, 0x6270,
-  0x9d37, 0x118d, 0x016c, 0x15b4, 0x016c, 0x116d, 0x9557, 0x11ad,
-  0x40ad, 0x300b, 0x300b, 0x408c, 0x300b, 0x302b, 0x408c, 0x306d,
-  0x114e, 0x00ed, 0x118e, 0x9557, 0x118e, 0x00ed, 0x114e, 0x010d,
-  0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b, 0x080b,
-  0x000b, 0x002c, 0x010d, 0x116e, 0x010d, 0x002c, 0x000b, 0x000c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0041, 0x0268, 0x0041, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0144, 0x0c0f, 0x0144, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0944, 0x6c10, 0x0964, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2003, 0x38a5, 0x2003, 0x0000, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x00e3, 0x0944, 0x00e3, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x38a6, 0xd598, 0x38a6, 0x0083, 0x01c7, 0x0022,
-  0x0001, 0x0001, 0x0002, 0x0001, 0x0002, 0x0001, 0x0001, 0x0001,
-  0x3805, 0x1003, 0x3805, 0xd08e, 0x3866, 0x1b6f, 0x38a7, 0x38a6,
-  0x2004, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0xd00d, 0x7809, 0x1804, 0x7809, 0x1845, 0xa1ef, 0xd8cf, 0xcd98,
-  0x3086, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x4007, 0x1005, 0x0004, 0x0804, 0x0107, 0x23ef, 0x4149, 0x50a9,
-  0x40a8, 0x2806, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x800a, 0x0805, 0x0005, 0x0005, 0x0928, 0x7431, 0x6a6f, 0xe0af,
-  0xcd78, 0x38a8, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x800a, 0x1006, 0x0006, 0x0006, 0x00a8, 0x192a, 0x9210, 0xd84e,
-  0x612b, 0x2827, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x1807, 0x0007, 0x0007, 0x0007, 0x0006, 0x0868, 0x83b3, 0x510b,
-  0xbd78, 0x38a9, 0x0006, 0x0006, 0x0007, 0x0007, 0x0006, 0x0007,
-  0x700b, 0x1808, 0x0007, 0x0808, 0x0007, 0x1049, 0x52af, 0x386a,
-  0x38ab, 0x2809, 0x0008, 0x0028, 0x0008, 0x0008, 0x0028, 0x0008,
-  0x3009, 0x700b, 0x2009, 0x780b, 0x2009, 0x686c, 0x3b93, 0xb8af,
-  0x518e, 0x284a, 0x0849, 0x022d, 0x0049, 0x0049, 0x022d, 0x0049,
-  0xd8af, 0x402b, 0x382a, 0xd0af, 0x382b, 0x40ac, 0xc910, 0x614e,
-  0xce1a, 0x394d, 0x090b, 0x1433, 0x012c, 0x010b, 0x1413, 0x012c,
-  0xddfa, 0x388d, 0x388d, 0xcd79, 0x408d, 0x390d, 0xcd99, 0x49ae,
-  0x9373, 0x310d, 0x114d, 0x7414, 0x114d, 0x094d, 0x6bf4, 0x116d,
-  0x40ad, 0x300c, 0x300c, 0x40ad, 0x300c, 0x302c, 0x40ad, 0x30cc,
-  0x112d, 0x090d, 0x010d, 0x114d, 0x010d, 0x010d, 0x114d, 0x010d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2002, 0x3084, 0x2002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x0a47, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3885, 0xbd16, 0x3885, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x3a29, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x3005, 0xc08d, 0x3005, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0822, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0803, 0x0002, 0x0803, 0x5807, 0x0823, 0x0104, 0x0823, 0x1003,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x5007, 0x0803, 0x0003, 0x0003, 0x0044, 0x0a2a, 0x5848, 0xb00b,
-  0x4087, 0x2004, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0804, 0x0004, 0x0004, 0x0004, 0x0845, 0x32ed, 0x1045, 0x4888,
-  0xc517, 0x3888, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0045, 0x0a4b, 0x0846, 0x7009,
-  0xc08e, 0x48a9, 0x2806, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0826, 0x422d, 0x1149, 0x5808,
-  0x5869, 0xb516, 0x3888, 0x0005, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0006, 0x0868, 0x0a2d, 0x3849,
-  0xb8ae, 0x48aa, 0x2028, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0008, 0x0008, 0x0008, 0x0007, 0x0828, 0x422d, 0x38cb,
-  0xc517, 0x308a, 0x0807, 0x0008, 0x0008, 0x0008, 0x0007, 0x0008,
-  0x0808, 0x0008, 0x0008, 0x0808, 0x0008, 0x0029, 0x110a, 0x302a,
-  0x806d, 0x302a, 0x0008, 0x0009, 0x0008, 0x0008, 0x0009, 0x0009,
-  0x600b, 0x100a, 0x100a, 0x580b, 0x100a, 0x102a, 0x590d, 0x402b,
-  0xc08e, 0x380a, 0x002a, 0x00eb, 0x000a, 0x000a, 0x00eb, 0x002a,
-  0xc8af, 0x380c, 0x380c, 0xc08e, 0x380c, 0x380c, 0xc8af, 0x50ad,
-  0xcdb9, 0x40ad, 0x082b, 0x0a2e, 0x002b, 0x002b, 0x0a2e, 0x004b,
-  0xd5fa, 0x408d, 0x388d, 0xcd79, 0x408d, 0x408d, 0xcd79, 0x48ce,
-  0x7250, 0x304c, 0x102c, 0x4250, 0x084c, 0x082c, 0x4250, 0x084c,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2803, 0xa88c, 0x2803, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x2885, 0xac94, 0x2885, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x1804, 0x2886, 0x1804, 0x0002, 0x0002, 0x0803,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0803, 0x4807,
-  0x1804, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x1805,
-  0xa02b, 0x3887, 0x1805, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0805,
-  0x788a, 0xb495, 0x2888, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x3828, 0xb90e, 0x3027, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0006, 0x1007,
-  0x786c, 0xb496, 0x3089, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0007, 0x3009,
-  0xb0ad, 0x408b, 0x2009, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x308a,
-  0xb4b6, 0x308a, 0x0808, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0809, 0x0009, 0x0009, 0x0809, 0x0009, 0x0009, 0x080a, 0x300a,
-  0x786c, 0x300a, 0x0809, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x600b, 0x100b, 0x100b, 0x580b, 0x100b, 0x100b, 0x582b, 0x384c,
-  0xa88d, 0x304b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0xb80d, 0x300c, 0x300c, 0xa80d, 0x300c, 0x282c, 0x7a0c, 0x32ac,
-  0x85b4, 0x226c, 0x002b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2802, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x2003, 0x806a, 0x2003, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x2864, 0x8370, 0x2864, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x1804, 0x2865, 0x1804, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x2006, 0x1004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x2807, 0x784a, 0x2007, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x2848, 0x9ab1, 0x2848, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0006,
-  0x2827, 0x88ad, 0x2827, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0807,
-  0x5069, 0x8372, 0x206a, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x2009,
-  0x806c, 0x306a, 0x1809, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0029, 0x288b,
-  0x83b3, 0x288b, 0x0809, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x080a, 0x000a, 0x000a, 0x080a, 0x000a, 0x002a, 0x0a2a, 0x2acc,
-  0x42ac, 0x1a2b, 0x002a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x300b, 0x080b, 0x080b, 0x280b, 0x080b, 0x002b, 0x32ac, 0xdebb,
-  0xdb54, 0x224c, 0x002b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x1803, 0x0002, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0803, 0x4847, 0x0803, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0844, 0x41ea, 0x0844, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0825, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x1806, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0806, 0x4848, 0x0806, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0006,
-  0x0827, 0x61ae, 0x0827, 0x0006, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0007,
-  0x0808, 0x506b, 0x0808, 0x0007, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x0028,
-  0x2849, 0x4a2f, 0x0849, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0029, 0x022a, 0x22ac,
-  0x524c, 0x124b, 0x002a, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x002a, 0x12ab, 0xc73a,
-  0xcf1a, 0x12ab, 0x002a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x002b, 0x02ab, 0x1f6c,
-  0x36cd, 0x0aab, 0x002b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x0027,
-  0x0027, 0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x0209, 0x1aab,
-  0x1aab, 0x0229, 0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0029, 0x12cb, 0xc73a,
-  0xc73a, 0x12cb, 0x0029, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x002a, 0x028a, 0x172c,
-  0x172c, 0x028a, 0x002a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x008b, 0x0409,
-  0x0409, 0x008b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0027, 0x0026,
-  0x0026, 0x0027, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x0208, 0x1aaa,
-  0x1aaa, 0x0208, 0x0027, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x12aa, 0xc73a,
-  0xc73a, 0x12aa, 0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0029, 0x028a, 0x174c,
-  0x174c, 0x028a, 0x0029, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x006a, 0x03aa,
-  0x03aa, 0x008a, 0x000b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x004b,
-  0x004b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0026, 0x0026,
-  0x0026, 0x0026, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0027, 0x0208, 0x1aaa,
-  0x1aaa, 0x0208, 0x0027, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0027, 0x1289, 0xc73a,
-  0xc73a, 0x12aa, 0x0027, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x0269, 0x174c,
-  0x174c, 0x0289, 0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x006a, 0x03a9,
-  0x0409, 0x0089, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x008a,
-  0x030a, 0x004a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x004b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0025, 0x0025,
-  0x0025, 0x0025, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0026, 0x0207, 0x1aa9,
-  0x1aa9, 0x0227, 0x0026, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0026, 0x12a9, 0xc73a,
-  0xc73a, 0x12a9, 0x0026, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0027, 0x0268, 0x174c,
-  0x174c, 0x0268, 0x0027, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0068, 0x03a9,
-  0x03a9, 0x0088, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0049,
-  0x0069, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x002a,
-  0x01aa, 0x002a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x002b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x0024,
-  0x0024, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0025, 0x0206, 0x1aa8,
-  0x1aa8, 0x0206, 0x0025, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0025, 0x12a9, 0xc73a,
-  0xc73a, 0x12a9, 0x0025, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0027, 0x0268, 0x172c,
-  0x174c, 0x0268, 0x0027, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0088, 0x0409,
-  0x03c9, 0x0088, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0048, 0x0309,
-  0x0089, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0049,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x00ca, 0x002a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x0023,
-  0x0023, 0x0023, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x0206, 0x1aa8,
-  0x1aa8, 0x0206, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0025, 0x12a8, 0xc73a,
-  0xc73a, 0x12a8, 0x0025, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0026, 0x0267, 0x174c,
-  0x174c, 0x0287, 0x0026, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0067, 0x03a8,
-  0x03a8, 0x0087, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0068,
-  0x0048, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0028, 0x01a9,
-  0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0029,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x0022,
-  0x0022, 0x0022, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x0225, 0x12a7,
-  0x12a7, 0x0225, 0x0023, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x12a7, 0xc73a,
-  0xc73a, 0x12a8, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0025, 0x0266, 0x174c,
-  0x174c, 0x0286, 0x0025, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0066, 0x03a8,
-  0x03a8, 0x0086, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0047,
-  0x0047, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0007,
-  0x0007, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009, 0x0088,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0021, 0x0021,
-  0x0021, 0x0021, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0022, 0x0225, 0x12a7,
-  0x12a7, 0x0225, 0x0022, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0023, 0x12a7, 0xc73a,
-  0xc73a, 0x12c7, 0x0023, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0024, 0x0266, 0x174c,
-  0x174c, 0x0286, 0x0024, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0065, 0x03a8,
-  0x03a8, 0x0085, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0046,
-  0x0046, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0121,
-  0x0121, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0121, 0x0263,
-  0x0263, 0x0121, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0121, 0x0283, 0x03e5,
-  0x03e5, 0x0283, 0x0121, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0121, 0x0283, 0x0405, 0x1589,
-  0x1589, 0x0405, 0x0283, 0x0121, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0021, 0x0123, 0x0284, 0x0406, 0x25ab, 0xdf9c,
-  0xdf9c, 0x25ab, 0x0406, 0x0284, 0x0123, 0x0021, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0103, 0x0265, 0x03e6, 0x1589, 0xdf9c, 0xffff,
-  0xffff, 0xdf9c, 0x1589, 0x03e6, 0x0265, 0x0103, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0104, 0x0265, 0x03e6, 0x1589, 0xdf9c, 0xffff,
-  0xffff, 0xdf9c, 0x158a, 0x03e6, 0x0265, 0x0104, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0024, 0x0125, 0x0266, 0x03e7, 0x25ab, 0xdfbc,
-  0xdfbc, 0x25ab, 0x0407, 0x0266, 0x0125, 0x0024, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0025, 0x0126, 0x0266, 0x0408, 0x162a,
-  0x162a, 0x0408, 0x0266, 0x0126, 0x0025, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0026, 0x0126, 0x0267, 0x03e8,
-  0x03e8, 0x0287, 0x0126, 0x0026, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0007, 0x0026, 0x0126, 0x0248,
-  0x0248, 0x0126, 0x0026, 0x0007, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0027, 0x0108,
-  0x0108, 0x0027, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0142, 0x0283, 0x02a3,
-  0x02a3, 0x0283, 0x0142, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0121, 0x0283, 0x03c5, 0x0405,
-  0x0405, 0x03e5, 0x0283, 0x0121, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0121, 0x0283, 0x0405, 0x1589, 0x15a9,
-  0x15a9, 0x1589, 0x0405, 0x0283, 0x0121, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0121, 0x0283, 0x0405, 0x25ab, 0xd79c, 0xefbd,
-  0xefbd, 0xd79c, 0x25ab, 0x0405, 0x0283, 0x0122, 0x0020, 0x0000,
-  0x0001, 0x0103, 0x0264, 0x03e5, 0x1589, 0xd79c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xd79c, 0x1589, 0x03e5, 0x0264, 0x0103, 0x0001,
-  0x0002, 0x0123, 0x0265, 0x0406, 0x15a9, 0xefbd, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xefbd, 0x15aa, 0x0406, 0x0285, 0x0123, 0x0002,
-  0x0023, 0x0124, 0x0285, 0x0407, 0x15aa, 0xefbd, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xefbd, 0x15aa, 0x0407, 0x0285, 0x0124, 0x0023,
-  0x0024, 0x0105, 0x0246, 0x03e7, 0x158a, 0xd79c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xd79c, 0x158a, 0x03e7, 0x0266, 0x0105, 0x0024,
-  0x0005, 0x0025, 0x0126, 0x0266, 0x0408, 0x25ac, 0xd79c, 0xefbd,
-  0xefbd, 0xd79c, 0x25ac, 0x0408, 0x0266, 0x0126, 0x0025, 0x0005,
-  0x0006, 0x0006, 0x0026, 0x0126, 0x0267, 0x0408, 0x158a, 0x15ab,
-  0x15ab, 0x158a, 0x0408, 0x0267, 0x0126, 0x0026, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0007, 0x0026, 0x0126, 0x0268, 0x03c9, 0x03e9,
-  0x03e9, 0x03c9, 0x0268, 0x0126, 0x0026, 0x0007, 0x0007, 0x0007,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0027, 0x0128, 0x0248, 0x0268,
-  0x0268, 0x0248, 0x0128, 0x0027, 0x0008, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0008, 0x0029, 0x0108, 0x0128,
-  0x0128, 0x0108, 0x0028, 0x0008, 0x0008, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0040, 0x01c2, 0x02c3, 0x02c3, 0x02c3, 0x02c3,
-  0x02c3, 0x02c3, 0x02c3, 0x02c3, 0x01c2, 0x0040, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0182, 0x02c3, 0x0507, 0x1569, 0x0547, 0x1569,
-  0x1569, 0x0547, 0x1569, 0x0507, 0x02c3, 0x0182, 0x0020, 0x0000,
-  0x0020, 0x0182, 0x02a3, 0x0507, 0x25eb, 0xb738, 0x260b, 0xbf99,
-  0xbf9a, 0x260b, 0xb738, 0x2deb, 0x0527, 0x02a3, 0x0182, 0x0020,
-  0x0020, 0x01a3, 0x02a4, 0x1589, 0xb738, 0x2e2b, 0x178c, 0x2fee,
-  0x2fee, 0x178c, 0x262b, 0xb738, 0x1589, 0x02a4, 0x01a3, 0x0020,
-  0x0022, 0x0184, 0x02a4, 0x0548, 0x260b, 0x178c, 0xd7fc, 0xd7dc,
-  0xd7dc, 0xd7fc, 0x178c, 0x260b, 0x0548, 0x02c4, 0x0184, 0x0022,
-  0x0022, 0x0184, 0x02a5, 0x1569, 0xbf9a, 0x2fee, 0xd7dc, 0x27cd,
-  0x27cd, 0xd7dc, 0x2fee, 0xbf9a, 0x156a, 0x02a5, 0x0184, 0x0022,
-  0x0023, 0x0185, 0x02a5, 0x1569, 0xbf9a, 0x2fee, 0xd7dc, 0x2fce,
-  0x27cd, 0xd7dc, 0x2fee, 0xbf9a, 0x156a, 0x02a5, 0x0185, 0x0023,
-  0x0024, 0x0185, 0x02a6, 0x0548, 0x260b, 0x178c, 0xd7fb, 0xd7dc,
-  0xd7dc, 0xd7fc, 0x178c, 0x260b, 0x0548, 0x02a6, 0x0185, 0x0024,
-  0x0025, 0x0186, 0x02a7, 0x158a, 0xb738, 0x2e4d, 0x178c, 0x2fee,
-  0x2fee, 0x178c, 0x2e4c, 0xb738, 0x158a, 0x02a7, 0x0186, 0x0025,
-  0x0026, 0x0187, 0x0287, 0x0529, 0x25ec, 0xb738, 0x260c, 0xbf9a,
-  0xbf9a, 0x260c, 0xb738, 0x2dec, 0x0529, 0x02a7, 0x0187, 0x0026,
-  0x0007, 0x0047, 0x01a7, 0x02e8, 0x0529, 0x158a, 0x0549, 0x158a,
-  0x158a, 0x0549, 0x158a, 0x0529, 0x02e8, 0x01a7, 0x0047, 0x0007,
-  0x0008, 0x0008, 0x0028, 0x0188, 0x02a8, 0x02c8, 0x02c8, 0x02c8,
-  0x02c8, 0x02c8, 0x02c8, 0x02a8, 0x0188, 0x0028, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0049, 0x0189, 0x01a9, 0x01a9, 0x01a9,
-  0x01a9, 0x01a9, 0x01a9, 0x0189, 0x0049, 0x0008, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x0029, 0x0029, 0x0029, 0x0029,
-  0x0029, 0x0029, 0x0029, 0x0029, 0x0009, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0040, 0x01c2, 0x02a3, 0x1326, 0x02c3, 0x02c3, 0x1b26,
-  0x1b26, 0x02c3, 0x02c3, 0x1326, 0x02a3, 0x01c2, 0x0040, 0x0000,
-  0x0020, 0x0182, 0x0283, 0x2388, 0xb657, 0x0b65, 0x0b45, 0xbf19,
-  0xc719, 0x0b45, 0x0b65, 0xb657, 0x2b88, 0x02a3, 0x0182, 0x0020,
-  0x0020, 0x01a2, 0x1305, 0xb677, 0x2c49, 0x16eb, 0x0547, 0x2fae,
-  0x2fae, 0x0547, 0x16ea, 0x2c49, 0xb677, 0x1326, 0x01a2, 0x0020,
-  0x0020, 0x01a3, 0x02c4, 0x1386, 0x16cb, 0xaf98, 0x260b, 0xbfb9,
-  0xbfba, 0x260b, 0xaf98, 0x16eb, 0x1386, 0x02c4, 0x01a3, 0x0020,
-  0x0021, 0x01a3, 0x02c4, 0x0b46, 0x0548, 0x260b, 0x0f8b, 0x2fce,
-  0x2fce, 0x078b, 0x260b, 0x0548, 0x0b46, 0x02c4, 0x01a3, 0x0021,
-  0x0022, 0x0184, 0x1327, 0xc739, 0x2fae, 0xbfba, 0x2fce, 0xd7dc,
-  0xd7dc, 0x2fce, 0xbfba, 0x2fae, 0xc739, 0x1327, 0x0184, 0x0022,
-  0x0023, 0x0185, 0x1308, 0xc73a, 0x2fae, 0xbfba, 0x2fce, 0xd7dc,
-  0xd7dc, 0x27ce, 0xbfba, 0x2fae, 0xc73a, 0x1328, 0x0185, 0x0023,
-  0x0024, 0x01a5, 0x02a7, 0x0b48, 0x0549, 0x260b, 0x0f8b, 0x2fce,
-  0x2fce, 0x0f8b, 0x260b, 0x0549, 0x0b48, 0x02c7, 0x01a5, 0x0024,
-  0x0025, 0x0186, 0x02a7, 0x1368, 0x16cb, 0xaf98, 0x260c, 0xbfba,
-  0xbfba, 0x260c, 0xaf98, 0x16eb, 0x1388, 0x02a7, 0x0186, 0x0025,
-  0x0026, 0x01a6, 0x1328, 0xb678, 0x2c4b, 0x16cb, 0x0549, 0x2fae,
-  0x2fae, 0x0549, 0x16cb, 0x2c4b, 0xb678, 0x1329, 0x01a6, 0x0026,
-  0x0027, 0x0187, 0x02a8, 0x2b8b, 0xb678, 0x1389, 0x0b49, 0xc73a,
-  0xc73a, 0x1349, 0x0b89, 0xb678, 0x2b8c, 0x02a8, 0x0187, 0x0027,
-  0x0008, 0x0048, 0x0188, 0x02a8, 0x130a, 0x02a9, 0x02a9, 0x1b0a,
-  0x1b0a, 0x02a9, 0x02a9, 0x130a, 0x02a8, 0x0188, 0x0048, 0x0008,
-  0x0008, 0x0008, 0x0049, 0x0189, 0x01a9, 0x01a9, 0x01a9, 0x01a9,
-  0x01a9, 0x01a9, 0x01a9, 0x01a9, 0x0189, 0x0049, 0x0008, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0029, 0x0029, 0x0029, 0x0029, 0x0029,
-  0x0029, 0x0029, 0x0029, 0x0029, 0x0029, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x0020, 0x1204, 0xc678, 0x12a4, 0x1244, 0xc698, 0x12a5,
-  0x0aa4, 0xc698, 0x1244, 0x0aa4, 0xc678, 0x1204, 0x0020, 0x0000,
-  0x0020, 0x0182, 0x1244, 0x1326, 0x16aa, 0x0345, 0x1367, 0x1f0b,
-  0x1f0b, 0x1387, 0x0345, 0x16aa, 0x1326, 0x1244, 0x0182, 0x0020,
-  0x0000, 0x1204, 0xae77, 0x270c, 0xaf98, 0x1549, 0x0b66, 0xc79a,
-  0xc79a, 0x0b86, 0x1548, 0xaf98, 0x270c, 0xae77, 0x1204, 0x0000,
-  0x0020, 0x0183, 0x1225, 0x0345, 0x1548, 0x070a, 0x1569, 0x176c,
-  0x176c, 0x1569, 0x070a, 0x1548, 0x0345, 0x1245, 0x0183, 0x0020,
-  0x0021, 0x0183, 0x1245, 0x0325, 0x1386, 0x1569, 0xb758, 0x16ca,
-  0x16aa, 0xb758, 0x1569, 0x1386, 0x0325, 0x1245, 0x0183, 0x0021,
-  0x0022, 0x11e6, 0xae77, 0x276d, 0xaf58, 0x176c, 0x16aa, 0x07aa,
-  0x07aa, 0x16aa, 0x176b, 0xaf58, 0x276d, 0xae77, 0x11e6, 0x0022,
-  0x0023, 0x0185, 0x2329, 0x0eea, 0x262b, 0x074a, 0x16cb, 0x07aa,
-  0x07aa, 0x16cb, 0x074a, 0x262b, 0x0eea, 0x2329, 0x0185, 0x0023,
-  0x0004, 0x1207, 0xae17, 0x23ca, 0xa6d7, 0x25cc, 0xaf58, 0x16ca,
-  0x16aa, 0xaf58, 0x25cc, 0xa6d7, 0x23ca, 0xae17, 0x1207, 0x0004,
-  0x0025, 0x0186, 0x1228, 0x0347, 0x25ac, 0x070a, 0x156a, 0x1f6c,
-  0x1f6c, 0x156a, 0x070a, 0x25ac, 0x0347, 0x1228, 0x0186, 0x0025,
-  0x0026, 0x0187, 0x1289, 0x16ab, 0xaf78, 0x154b, 0x0b68, 0xc77a,
-  0xc79a, 0x0b88, 0x0d2a, 0xaf78, 0x16ab, 0x12a9, 0x01a7, 0x0026,
-  0x0006, 0x1209, 0xb618, 0x1b4a, 0x270d, 0x0348, 0x0308, 0x2f8e,
-  0x2f8e, 0x0308, 0x0348, 0x270d, 0x1b4a, 0xb618, 0x1229, 0x0026,
-  0x0027, 0x0168, 0x11e9, 0x122a, 0xae78, 0x124a, 0x1229, 0xc6fa,
-  0xc71a, 0x1229, 0x122a, 0xae78, 0x1a4a, 0x11e9, 0x0188, 0x0028,
-  0x0008, 0x0028, 0x0028, 0x0189, 0x120b, 0x01a9, 0x01a9, 0x1a0b,
-  0x1a0b, 0x01a9, 0x01a9, 0x120b, 0x0189, 0x0028, 0x0028, 0x0009,
-  0x0009, 0x0009, 0x0009, 0x0029, 0x0009, 0x0029, 0x0029, 0x0009,
-  0x0009, 0x0029, 0x0029, 0x0009, 0x0029, 0x0009, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0000, 0x1204, 0xc6f9, 0x16ca, 0x0101, 0x0203, 0x16eb, 0x0263,
-  0x0263, 0x16eb, 0x0223, 0x00e1, 0x16aa, 0xc6f9, 0x1204, 0x0000,
-  0x0040, 0x01a2, 0x12c5, 0x1306, 0x0446, 0x1284, 0xaed7, 0x1528,
-  0x1528, 0xaed7, 0x1284, 0x0446, 0x1306, 0x12c5, 0x01a2, 0x0040,
-  0x0182, 0x1284, 0x166a, 0xb6f8, 0x16eb, 0x13a7, 0x13a7, 0x0729,
-  0x0729, 0x13a7, 0x13a7, 0x16eb, 0xb6f8, 0x166a, 0x12a4, 0x0182,
-  0x1245, 0xae16, 0x12a6, 0x1225, 0x13a7, 0xb697, 0x13e7, 0x0445,
-  0x0445, 0x13e7, 0xb697, 0x13a7, 0x1225, 0x12a6, 0xae16, 0x1245,
-  0x01c3, 0x1225, 0x0224, 0x0203, 0x0345, 0x13e7, 0x0649, 0x0284,
-  0x0264, 0x0649, 0x13e7, 0x0345, 0x0203, 0x0224, 0x1245, 0x01c3,
-  0x01a4, 0x1286, 0x0669, 0x15ca, 0x06a9, 0x0447, 0x0265, 0x03e7,
-  0x03e7, 0x0265, 0x0427, 0x06a9, 0x15ca, 0x0689, 0x1386, 0x01c4,
-  0x1227, 0xae17, 0x248b, 0xaeb8, 0x1449, 0x03e7, 0x0286, 0x03e7,
-  0x03e7, 0x0286, 0x03e7, 0x1449, 0xaeb8, 0x248b, 0xae57, 0x1247,
-  0x01a5, 0x2309, 0x0e6a, 0x246b, 0x064a, 0x1449, 0x0649, 0x0266,
-  0x0266, 0x0649, 0x1449, 0x064a, 0x246b, 0x0e8a, 0x240a, 0x01e6,
-  0x10c7, 0xadd7, 0x2c0b, 0xae97, 0x246b, 0xae98, 0x13e9, 0x0447,
-  0x0447, 0x13e9, 0xae78, 0x246b, 0xae97, 0x2c0b, 0xae37, 0x1228,
-  0x0026, 0x1209, 0x0287, 0x150a, 0x1eec, 0x13a9, 0x0347, 0x174c,
-  0x174c, 0x0367, 0x13a9, 0x1eec, 0x150a, 0x0287, 0x1229, 0x01a7,
-  0x0006, 0x0207, 0x168b, 0x1309, 0xaef8, 0x1269, 0x0ae9, 0xc79a,
-  0xc79a, 0x1309, 0x0a68, 0xaef8, 0x1309, 0x168b, 0x0207, 0x0027,
-  0x0007, 0x120a, 0xb678, 0x1aca, 0x26cd, 0x0248, 0x0248, 0x2f8e,
-  0x2f8e, 0x0248, 0x0228, 0x26cd, 0x1aca, 0xb678, 0x122a, 0x0007,
-  0x0028, 0x0189, 0x120a, 0x124b, 0xae78, 0x126a, 0x0b2a, 0xc71a,
-  0xc71a, 0x132a, 0x124a, 0xae78, 0x1a4b, 0x120a, 0x0189, 0x0028,
-  0x0009, 0x0029, 0x0029, 0x018a, 0x120b, 0x01aa, 0x01ca, 0x1a0b,
-  0x1a0b, 0x01ca, 0x01aa, 0x120b, 0x018a, 0x0029, 0x0029, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x002a, 0x000a, 0x002a, 0x002a, 0x000a,
-  0x000a, 0x002a, 0x002a, 0x000a, 0x002a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x0223, 0x1306, 0x06a9, 0x1528, 0xc6f9, 0x2c49, 0x04a6, 0x0040,
-  0x0040, 0x04a6, 0x2c49, 0xc6f9, 0x1529, 0x06a9, 0x1306, 0x0223,
-  0x1285, 0xae16, 0x1326, 0x02e3, 0x23e8, 0xb6d7, 0x16aa, 0x00e1,
-  0x00c1, 0x16aa, 0xb6d7, 0x23c8, 0x02e3, 0x1325, 0xae16, 0x12a5,
-  0x0223, 0x1326, 0x1508, 0x06a9, 0x1528, 0x1346, 0x0283, 0x0344,
-  0x0344, 0x0283, 0x1306, 0x1326, 0x0689, 0x1508, 0x1326, 0x0223,
-  0x1305, 0x16aa, 0xaef8, 0x2429, 0xaef8, 0x166a, 0x0101, 0x0060,
-  0x0060, 0x00e1, 0x166a, 0xaeb7, 0x2429, 0xaef7, 0x16aa, 0x1305,
-  0xc6b9, 0x13c7, 0x12a6, 0x0205, 0x12a6, 0x02a5, 0x0305, 0x0042,
-  0x0021, 0x0305, 0x02a5, 0x12a7, 0x0205, 0x12a6, 0x13c7, 0xc6b9,
-  0x1286, 0x02c5, 0x0325, 0x0163, 0x02e5, 0x0063, 0x0042, 0x0002,
-  0x0002, 0x0042, 0x0063, 0x02e5, 0x0163, 0x0325, 0x02c5, 0x1286,
-  0x12e7, 0x0629, 0x1388, 0x05c9, 0x0124, 0x0003, 0x0043, 0x0003,
-  0x0003, 0x0043, 0x0003, 0x0124, 0x05c9, 0x1388, 0x0629, 0x1307,
-  0xbeb9, 0x24ab, 0xae77, 0x1389, 0x0326, 0x0125, 0x02e6, 0x0044,
-  0x0044, 0x02e6, 0x0125, 0x0326, 0x1389, 0xae77, 0x24ab, 0xbeb9,
-  0x2c6b, 0x0e8a, 0x2cab, 0x0629, 0x0347, 0x168b, 0x02a7, 0x0065,
-  0x0065, 0x02a7, 0x168b, 0x0347, 0x0629, 0x2cab, 0x0e8a, 0x2c8b,
-  0xbeb9, 0x2c4b, 0xae77, 0x1328, 0x0cea, 0xb718, 0x1389, 0x03e7,
-  0x03e7, 0x1389, 0xb718, 0x14ea, 0x1328, 0xae77, 0x2c4b, 0xbeb9,
-  0x126a, 0x0268, 0x14ca, 0x02e9, 0x16ec, 0x13e9, 0x02c8, 0x172c,
-  0x174c, 0x02c8, 0x13e9, 0x16ec, 0x02e9, 0x14ca, 0x0268, 0x126a,
-  0x0027, 0x0288, 0x16cb, 0x140b, 0xaf18, 0x138a, 0x0b6a, 0xc75a,
-  0xc75a, 0x136a, 0x0b6a, 0xaf18, 0x1c0b, 0x16cb, 0x0288, 0x0027,
-  0x0028, 0x132b, 0xb6d9, 0x1c2b, 0x270d, 0x02c9, 0x0268, 0x152a,
-  0x152a, 0x0269, 0x02c9, 0x270d, 0x1c2b, 0xb6d9, 0x134b, 0x0028,
-  0x0029, 0x01ea, 0x132c, 0x13ac, 0xaed9, 0x136c, 0x02aa, 0x174c,
-  0x174c, 0x02aa, 0x134c, 0xaed9, 0x1bac, 0x132c, 0x01ea, 0x0029,
-  0x000a, 0x002a, 0x004a, 0x01ea, 0x132c, 0x022a, 0x134c, 0xc73a,
-  0xc73a, 0x134c, 0x022a, 0x132c, 0x01ea, 0x004a, 0x002a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x002b, 0x002b, 0x004b, 0x022b, 0x1b8c,
-  0x1b8c, 0x022b, 0x004b, 0x002b, 0x002b, 0x000b, 0x000b, 0x000b,
-  0x0020, 0x00e1, 0x03c5, 0x1366, 0x05a8, 0x0121, 0x0040, 0x0000,
-  0x0000, 0x0040, 0x0121, 0x05a8, 0x1346, 0x0304, 0x00c1, 0x0020,
-  0x1305, 0x0547, 0x1325, 0x9db5, 0x23c8, 0x0567, 0x02c4, 0x0020,
-  0x0020, 0x02c4, 0x0567, 0x23c8, 0x9db5, 0x1305, 0x0547, 0x1305,
-  0xadf6, 0x1345, 0x0263, 0x24c9, 0x9e35, 0x1325, 0x0060, 0x0000,
-  0x0000, 0x0060, 0x1325, 0x9e35, 0x24c9, 0x0283, 0x0b45, 0xadf6,
-  0x1367, 0x1468, 0x05a8, 0x1325, 0x160a, 0x03c5, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x03a5, 0x160a, 0x13a7, 0x05c8, 0x14e8, 0x1367,
-  0x162a, 0x95f5, 0x2368, 0x9d74, 0x12e6, 0x0082, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0062, 0x0ae6, 0x9d95, 0x2368, 0x9615, 0x162a,
-  0x01e5, 0x1226, 0x0225, 0x1246, 0x0164, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0184, 0x12a7, 0x01c4, 0x12a7, 0x0205,
-  0x00e4, 0x0286, 0x0124, 0x0286, 0x0063, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0063, 0x0286, 0x0124, 0x02a6, 0x00e4,
-  0x15ea, 0x02e6, 0x15aa, 0x0246, 0x0024, 0x0024, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0024, 0x0024, 0x0246, 0x15aa, 0x02c6, 0x15ea,
-  0xa6b7, 0x246a, 0x9676, 0x13c9, 0x00a5, 0x02c6, 0x0065, 0x0005,
-  0x0005, 0x0065, 0x02c6, 0x00a5, 0x13c8, 0x9676, 0x246a, 0xa6b7,
-  0x266c, 0x0ac8, 0x260c, 0x0247, 0x0227, 0x15ea, 0x01e7, 0x0046,
-  0x0046, 0x01e7, 0x15ea, 0x0227, 0x0247, 0x260c, 0x0ac8, 0x266c,
-  0xa637, 0x232b, 0x95f6, 0x12e9, 0x0cc9, 0x9e36, 0x12e9, 0x0347,
-  0x0347, 0x12e9, 0x9e16, 0x0cca, 0x12e9, 0x95f6, 0x232b, 0xa637,
-  0x128a, 0x0228, 0x0caa, 0x0288, 0x160b, 0x132a, 0x0248, 0x164b,
-  0x166b, 0x0248, 0x130a, 0x160b, 0x0288, 0x0caa, 0x0228, 0x128a,
-  0x0028, 0x01e9, 0x0dea, 0x132b, 0x9e36, 0x0aaa, 0x0a8a, 0xae38,
-  0xae38, 0x0a8a, 0x0aaa, 0x9e36, 0x132b, 0x0dea, 0x0209, 0x0028,
-  0x0029, 0x128b, 0x9df6, 0x1b4c, 0x262c, 0x022a, 0x018a, 0x120b,
-  0x120b, 0x018a, 0x022a, 0x260c, 0x1b4b, 0x9df6, 0x128b, 0x0029,
-  0x002a, 0x016a, 0x128b, 0x12cb, 0x9dd6, 0x128b, 0x00aa, 0x032a,
-  0x032a, 0x00aa, 0x128b, 0x9dd6, 0x12cc, 0x128b, 0x016a, 0x002a,
-  0x000b, 0x002b, 0x004b, 0x01ab, 0x12cc, 0x01cb, 0x01eb, 0x062a,
-  0x064a, 0x01eb, 0x01cb, 0x12cc, 0x01ab, 0x004b, 0x002b, 0x000b,
-  0x0000, 0x0020, 0x0020, 0x00a0, 0x01c2, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x01c2, 0x00a0, 0x0020, 0x0020, 0x0000,
-  0x00a0, 0x0182, 0x0202, 0x0ce8, 0x0243, 0x0040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0243, 0x0ce8, 0x0202, 0x0182, 0x00a0,
-  0x0486, 0x00a0, 0x0a64, 0x8d94, 0x1d6a, 0x01c2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x01c2, 0x1d6a, 0x8d94, 0x1264, 0x00a0, 0x0486,
-  0x00a1, 0x0080, 0x0203, 0x1b47, 0x8d53, 0x1285, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x0a85, 0x8d53, 0x1b47, 0x0203, 0x00a0, 0x00a1,
-  0x01e3, 0x0cc8, 0x0284, 0x0d28, 0x1306, 0x0183, 0x0021, 0x0001,
-  0x0001, 0x0021, 0x0183, 0x1306, 0x0d28, 0x0284, 0x0ce8, 0x0203,
-  0x12a6, 0x8533, 0x1ae8, 0x8533, 0x0a86, 0x0042, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0042, 0x0a86, 0x8533, 0x1ae8, 0x8533, 0x12c7,
-  0x01c5, 0x0a66, 0x01e5, 0x0a66, 0x0184, 0x0023, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0023, 0x0184, 0x0a66, 0x01e5, 0x0a66, 0x01c5,
-  0x0226, 0x00a4, 0x0206, 0x0064, 0x0024, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0064, 0x0206, 0x00a4, 0x0226,
-  0x154a, 0x0247, 0x0d0a, 0x01c6, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x01c6, 0x0d0a, 0x0247, 0x154a,
-  0x8db5, 0x230a, 0x8574, 0x1268, 0x0066, 0x01e6, 0x0046, 0x0006,
-  0x0006, 0x0046, 0x01e6, 0x0066, 0x1268, 0x8574, 0x230a, 0x8db5,
-  0x258c, 0x0a88, 0x1d4b, 0x0207, 0x01e7, 0x150a, 0x01c7, 0x0027,
-  0x0027, 0x01c7, 0x150a, 0x0207, 0x0207, 0x1d4b, 0x0a88, 0x258c,
-  0x8d75, 0x1b0b, 0x8534, 0x0ac9, 0x0bea, 0x8d54, 0x12a9, 0x0248,
-  0x0248, 0x12a9, 0x8d54, 0x0c0a, 0x0ac9, 0x8534, 0x1b0b, 0x8d75,
-  0x126a, 0x01e9, 0x0bca, 0x0249, 0x154b, 0x12ea, 0x0209, 0x156b,
-  0x158b, 0x0229, 0x12ea, 0x154b, 0x0249, 0x0bca, 0x01e9, 0x126a,
-  0x0029, 0x01ca, 0x0d2a, 0x130b, 0x8574, 0x0aab, 0x0a8b, 0x9596,
-  0x9596, 0x0aab, 0x0aab, 0x8574, 0x132b, 0x0d2a, 0x01ea, 0x0049,
-  0x002a, 0x126b, 0x8535, 0x132b, 0x1d4c, 0x020a, 0x018a, 0x12ab,
-  0x12ab, 0x018a, 0x020a, 0x1d4c, 0x132b, 0x8535, 0x126b, 0x002a,
-  0x002b, 0x01ab, 0x12ac, 0x12ec, 0x9576, 0x128c, 0x006b, 0x01ea,
-  0x01ea, 0x006b, 0x128c, 0x9576, 0x12ec, 0x12ac, 0x01ab, 0x002b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0020, 0x0182, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0040, 0x0182, 0x0020, 0x0000, 0x0020,
-  0x0141, 0x0000, 0x0080, 0x0c27, 0x00c1, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0202, 0x0c67, 0x0080, 0x0000, 0x0141,
-  0x0020, 0x0020, 0x09c3, 0x642e, 0x1468, 0x0081, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0081, 0x1488, 0x642e, 0x09e3, 0x0020, 0x0020,
-  0x0021, 0x0183, 0x0082, 0x1346, 0x640e, 0x09c5, 0x0021, 0x0001,
-  0x0001, 0x0021, 0x09c5, 0x640e, 0x1366, 0x0082, 0x0183, 0x0021,
-  0x00a3, 0x0c07, 0x0103, 0x0c67, 0x0a66, 0x0043, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0043, 0x0a66, 0x0c67, 0x0103, 0x0c07, 0x00a3,
-  0x0a05, 0x5bce, 0x1226, 0x63ce, 0x0a05, 0x0023, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0023, 0x09e5, 0x63ce, 0x1226, 0x5bce, 0x0a05,
-  0x0084, 0x09c6, 0x00a5, 0x09c7, 0x0044, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0044, 0x09c7, 0x00a5, 0x09c6, 0x0084,
-  0x01a6, 0x0065, 0x0166, 0x0045, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0045, 0x0186, 0x0065, 0x01a6,
-  0x0c6a, 0x0107, 0x0c09, 0x00a6, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0086, 0x0c09, 0x0107, 0x0c6a,
-  0x6c52, 0x1a4a, 0x6411, 0x09c9, 0x0047, 0x0167, 0x0027, 0x0007,
-  0x0007, 0x0027, 0x0167, 0x0047, 0x09c9, 0x6411, 0x1a4a, 0x6c52,
-  0x1cab, 0x0948, 0x144b, 0x00c8, 0x00a8, 0x0c2a, 0x00a8, 0x0008,
-  0x0008, 0x00a8, 0x0c2a, 0x00a8, 0x00c8, 0x144b, 0x0948, 0x14ab,
-  0x6c12, 0x1a2a, 0x63d1, 0x0a09, 0x0b29, 0x6412, 0x09e9, 0x01a8,
-  0x01c8, 0x09e9, 0x6412, 0x0b2a, 0x0a09, 0x63d1, 0x1a2a, 0x6c12,
-  0x11eb, 0x08aa, 0x0aeb, 0x010a, 0x0c6a, 0x126b, 0x08ca, 0x0c8a,
-  0x0caa, 0x08ea, 0x124b, 0x0c6b, 0x010a, 0x0aeb, 0x08aa, 0x11eb,
-  0x002a, 0x008a, 0x0c4a, 0x126b, 0x6412, 0x0a0b, 0x09eb, 0x6c13,
-  0x6c13, 0x09eb, 0x0a0b, 0x6412, 0x126b, 0x0c4a, 0x008a, 0x002a,
-  0x002b, 0x11eb, 0x6c12, 0x12ab, 0x0c6a, 0x08ab, 0x084b, 0x122b,
-  0x122b, 0x084b, 0x088b, 0x0c6a, 0x12ab, 0x6c12, 0x11eb, 0x002b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0101, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0101, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0061, 0x0b45, 0x0162, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0162, 0x0b45, 0x0061, 0x0000, 0x0000,
-  0x0001, 0x0021, 0x0904, 0x4b2b, 0x1366, 0x0062, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0062, 0x1366, 0x4b2c, 0x0904, 0x0021, 0x0001,
-  0x0022, 0x0103, 0x0063, 0x1246, 0x4b0b, 0x0904, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0904, 0x4b0b, 0x1246, 0x0063, 0x0103, 0x0022,
-  0x0084, 0x0b07, 0x00c4, 0x0b47, 0x0985, 0x0023, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0023, 0x0985, 0x0b47, 0x00c4, 0x0b07, 0x0084,
-  0x0925, 0x4acb, 0x1166, 0x4acc, 0x0925, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0925, 0x4acc, 0x1166, 0x4acb, 0x0925,
-  0x0045, 0x0906, 0x0065, 0x0906, 0x0025, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0025, 0x0906, 0x0065, 0x0906, 0x0045,
-  0x0126, 0x0046, 0x0126, 0x0026, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0026, 0x0126, 0x0046, 0x0126,
-  0x0b69, 0x00c7, 0x0b28, 0x0067, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0067, 0x0b28, 0x00c7, 0x0b69,
-  0x5330, 0x116a, 0x4b0f, 0x0929, 0x0027, 0x0128, 0x0028, 0x0008,
-  0x0008, 0x0028, 0x0128, 0x0028, 0x0929, 0x4b0f, 0x116a, 0x5330,
-  0x138b, 0x08e9, 0x134a, 0x0089, 0x0069, 0x0b2a, 0x0069, 0x0008,
-  0x0008, 0x0069, 0x0b2a, 0x0069, 0x0089, 0x132b, 0x08e9, 0x138b,
-  0x52f0, 0x114b, 0x52b0, 0x110b, 0x11eb, 0x4af0, 0x092b, 0x012a,
-  0x012a, 0x092b, 0x4af0, 0x0a0a, 0x092b, 0x4ad0, 0x114b, 0x52f0,
-  0x090b, 0x084b, 0x48f4, 0x50f5, 0x4194, 0x112c, 0x008a, 0x0b6a,
-  0x0b6a, 0x008a, 0x096b, 0x0b4a, 0x00aa, 0x09eb, 0x086b, 0x090b,
-  0x000b, 0x080c, 0x51d5, 0xde5d, 0x7a19, 0x090b, 0x092b, 0x5b31,
-  0x5b31, 0x092b, 0x094b, 0x52f0, 0x096b, 0x02aa, 0x004b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0101, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x0101, 0x0020, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0042, 0x0264, 0x0142, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0142, 0x0264, 0x0042, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x00e3, 0x3229, 0x0a65, 0x0043, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0043, 0x0a65, 0x3229, 0x00e4, 0x0002, 0x0002,
-  0x0003, 0x00a4, 0x0043, 0x09a5, 0x320a, 0x08c5, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x08a5, 0x320a, 0x09a5, 0x0043, 0x00a4, 0x0003,
-  0x0044, 0x0226, 0x0084, 0x0246, 0x0905, 0x0024, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0024, 0x0905, 0x0246, 0x0084, 0x0226, 0x0044,
-  0x08c5, 0x31ea, 0x08e6, 0x31ea, 0x00c5, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x00c5, 0x31ea, 0x08e6, 0x31ea, 0x08c5,
-  0x0026, 0x08a7, 0x0046, 0x08a7, 0x0026, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0026, 0x08a7, 0x0046, 0x08a7, 0x0026,
-  0x00c7, 0x0026, 0x00c7, 0x0026, 0x0007, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0026, 0x00c7, 0x0026, 0x00c7,
-  0x0a68, 0x0088, 0x0228, 0x0047, 0x0007, 0x0007, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0008, 0x0048, 0x0a28, 0x0088, 0x0a68,
-  0x3a2e, 0x090a, 0x3a0e, 0x08aa, 0x0829, 0x00c8, 0x0008, 0x0008,
-  0x0008, 0x0009, 0x00c8, 0x0028, 0x08c9, 0x320d, 0x0909, 0x3a2e,
-  0x0a4b, 0x088a, 0x4954, 0x50d5, 0x4073, 0x0a0b, 0x0049, 0x0009,
-  0x0009, 0x004a, 0x0a0a, 0x084a, 0x082a, 0x120b, 0x088a, 0x124b,
-  0x3a0e, 0x10cc, 0x6957, 0xcd9d, 0x5976, 0x39cf, 0x08cb, 0x00eb,
-  0x00eb, 0x08cb, 0x39ef, 0x40f4, 0x50d5, 0x50f5, 0x10cc, 0x3a0e,
-  0x08eb, 0x102d, 0x803d, 0x90bf, 0x48d5, 0x10cc, 0x004b, 0x022b,
-  0x022b, 0x004b, 0x08cc, 0x5175, 0xd63d, 0x5956, 0x082c, 0x08eb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0062, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0062, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0022, 0x0164, 0x0083, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0083, 0x0144, 0x0022, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0023, 0x2147, 0x0965, 0x0023, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0023, 0x0965, 0x2147, 0x0023, 0x0003, 0x0003,
-  0x0004, 0x0064, 0x0024, 0x08a5, 0x2147, 0x0024, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0024, 0x2147, 0x08a5, 0x0024, 0x0064, 0x0004,
-  0x0025, 0x0146, 0x0045, 0x0146, 0x0045, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0045, 0x0146, 0x0045, 0x0146, 0x0025,
-  0x0026, 0x2109, 0x0846, 0x2109, 0x0026, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0026, 0x2109, 0x0846, 0x2109, 0x0026,
-  0x0007, 0x0807, 0x0006, 0x0007, 0x0006, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0007, 0x0807, 0x0007, 0x0807, 0x0007,
-  0x0027, 0x0008, 0x0808, 0x0808, 0x0808, 0x0008, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0007, 0x0007, 0x0027, 0x0007, 0x0028,
-  0x0149, 0x0829, 0x40b2, 0x50b4, 0x4012, 0x0809, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0809, 0x0809, 0x092a, 0x0049, 0x0149,
-  0x216d, 0x082b, 0x6156, 0xd5bd, 0x58b5, 0x082a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x4012, 0x50b4, 0x50d4, 0x102b, 0x216d,
-  0x096a, 0x082b, 0x50b6, 0x88be, 0x703b, 0x112c, 0x002a, 0x000a,
-  0x000a, 0x002a, 0x092b, 0x58d6, 0xcd9d, 0x5956, 0x082b, 0x096b,
-  0x296d, 0x102d, 0x781c, 0x5816, 0x186e, 0x296d, 0x082c, 0x004b,
-  0x004b, 0x082b, 0x314f, 0x803d, 0x90bf, 0x58d6, 0x102c, 0x296d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0807, 0x0807, 0x0807, 0x0007, 0x0007, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0006, 0x0006, 0x0006, 0x0007, 0x0007,
-  0x0007, 0x0808, 0x3811, 0x50b3, 0x4011, 0x0808, 0x0007, 0x0008,
-  0x0008, 0x0008, 0x0008, 0x0808, 0x0808, 0x0808, 0x0008, 0x0008,
-  0x0008, 0x0809, 0x5895, 0xcd9d, 0x50b4, 0x0809, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0809, 0x4012, 0x50b4, 0x4012, 0x0809, 0x0008,
-  0x0009, 0x080b, 0x701b, 0x889e, 0x5015, 0x080a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x5094, 0xcd9d, 0x58b5, 0x080a, 0x0009,
-  0x000a, 0x000b, 0x200e, 0x5016, 0x701a, 0x100c, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x080b, 0x5015, 0x889e, 0x701b, 0x080c, 0x000a,
-  0x000b, 0x100d, 0x681a, 0x180e, 0x100d, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x100d, 0x781c, 0x5817, 0x180e, 0x000b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0006, 0x0006, 0x0807, 0x0007, 0x0807, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0006, 0x0005, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0807, 0x4011, 0x50b3, 0x3811, 0x0807, 0x0006, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x0807, 0x0807, 0x0807, 0x0007, 0x0007,
-  0x0007, 0x0808, 0x5094, 0xcd9d, 0x58b5, 0x0809, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0808, 0x3812, 0x50b4, 0x4012, 0x0808, 0x0007,
-  0x0008, 0x0809, 0x5015, 0x889e, 0x701b, 0x080a, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0809, 0x5895, 0xcd9d, 0x50b4, 0x0809, 0x0008,
-  0x0009, 0x100b, 0x701a, 0x5817, 0x180d, 0x000a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080b, 0x701b, 0x909e, 0x5015, 0x080a, 0x0009,
-  0x000a, 0x000b, 0x180e, 0x5015, 0x4814, 0x080b, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000b, 0x180e, 0x5016, 0x701b, 0x100c, 0x000a,
-  0x000b, 0x080c, 0x4815, 0x100d, 0x080c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x080c, 0x4815, 0x100d, 0x100d, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0005, 0x0806, 0x0006, 0x0806, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005, 0x0005,
-  0x0005, 0x0807, 0x3810, 0x50b3, 0x4011, 0x0807, 0x0005, 0x0006,
-  0x0006, 0x0006, 0x0006, 0x0807, 0x0007, 0x0807, 0x0006, 0x0006,
-  0x0006, 0x0807, 0x5894, 0xcd9d, 0x50b3, 0x0807, 0x0006, 0x0007,
-  0x0007, 0x0006, 0x0807, 0x4011, 0x50b3, 0x3811, 0x0807, 0x0006,
-  0x0007, 0x0809, 0x701b, 0x889e, 0x5014, 0x0808, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0808, 0x5093, 0xcd9d, 0x58b4, 0x0808, 0x0007,
-  0x0008, 0x0009, 0x180d, 0x5015, 0x701a, 0x100a, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0809, 0x5015, 0x909e, 0x701b, 0x080a, 0x0008,
-  0x0009, 0x100b, 0x6018, 0x180d, 0x100c, 0x080a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x180d, 0x701b, 0x5816, 0x200e, 0x000a, 0x0009,
-  0x000a, 0x080b, 0x180d, 0x3010, 0x3010, 0x080b, 0x000a, 0x000a,
-  0x000a, 0x100c, 0x6019, 0x180e, 0x100d, 0x6019, 0x100c, 0x000a,
-  0x000b, 0x080c, 0x3812, 0x100d, 0x080c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x100e, 0x3812, 0x080c, 0x100d, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0004, 0x0005, 0x0005, 0x0005, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004, 0x0004,
-  0x0005, 0x0806, 0x4010, 0x50b2, 0x3810, 0x0806, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x0806, 0x0006, 0x0806, 0x0005, 0x0005,
-  0x0005, 0x0007, 0x5092, 0xcd9d, 0x58b4, 0x0807, 0x0005, 0x0006,
-  0x0006, 0x0005, 0x0807, 0x3810, 0x50b3, 0x4011, 0x0807, 0x0005,
-  0x0006, 0x0807, 0x5014, 0x889e, 0x701b, 0x0808, 0x0006, 0x0007,
-  0x0007, 0x0006, 0x0807, 0x5894, 0xcd9d, 0x50b3, 0x0807, 0x0006,
-  0x0007, 0x0809, 0x681a, 0x5816, 0x180c, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0809, 0x701b, 0x889e, 0x5015, 0x0808, 0x0007,
-  0x0008, 0x0009, 0x180c, 0x3812, 0x5015, 0x080a, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x180c, 0x5817, 0x701a, 0x080a, 0x0008,
-  0x0009, 0x080b, 0x4814, 0x100c, 0x100b, 0x000a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x5816, 0x4013, 0x180d, 0x000a, 0x0009,
-  0x000a, 0x000b, 0x100d, 0x2810, 0x200f, 0x080b, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000b, 0x100c, 0x100c, 0x4014, 0x080b, 0x000a,
-  0x000b, 0x080c, 0x2810, 0x080c, 0x080c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x080c, 0x200f, 0x080c, 0x080c, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0003, 0x0804, 0x0004, 0x0804, 0x0003, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003, 0x0003,
-  0x0004, 0x0005, 0x4812, 0x58b5, 0x4812, 0x0805, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0004, 0x0805, 0x0005, 0x0805, 0x0004, 0x0004,
-  0x0005, 0x0806, 0x6096, 0xd59d, 0x58b5, 0x0806, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0806, 0x4813, 0x58b5, 0x4812, 0x0806, 0x0005,
-  0x0005, 0x0807, 0x701a, 0x909e, 0x5816, 0x0807, 0x0005, 0x0006,
-  0x0006, 0x0005, 0x0807, 0x5895, 0xd59d, 0x60b6, 0x0807, 0x0005,
-  0x0006, 0x0007, 0x180b, 0x5015, 0x701a, 0x0808, 0x0006, 0x0007,
-  0x0007, 0x0006, 0x0808, 0x5816, 0x909e, 0x701b, 0x0808, 0x0006,
-  0x0007, 0x0809, 0x5015, 0x180b, 0x100b, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0809, 0x681a, 0x5015, 0x180c, 0x0008, 0x0007,
-  0x0008, 0x0009, 0x180c, 0x4013, 0x4815, 0x080a, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x100b, 0x180c, 0x5015, 0x080a, 0x0008,
-  0x0009, 0x080a, 0x3011, 0x100b, 0x100b, 0x000a, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x4815, 0x3812, 0x180c, 0x000a, 0x0009,
-  0x000a, 0x000b, 0x080c, 0x080b, 0x180d, 0x080b, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000b, 0x100c, 0x100c, 0x3012, 0x080b, 0x000a,
-  0x000b, 0x080c, 0x2810, 0x080c, 0x080c, 0x080b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x080c, 0x200f, 0x080c, 0x080c, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0002, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002, 0x0002,
-  0x0003, 0x0004, 0x382e, 0x48b0, 0x382e, 0x0004, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0003, 0x0004, 0x0004, 0x0004, 0x0003, 0x0003,
-  0x0004, 0x0005, 0x48b0, 0xcd9c, 0x50b2, 0x0005, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0005, 0x382e, 0x48b0, 0x382e, 0x0005, 0x0004,
-  0x0005, 0x0806, 0x4832, 0x889e, 0x701a, 0x0807, 0x0004, 0x0005,
-  0x0005, 0x0005, 0x0006, 0x50b2, 0xcd9c, 0x48b1, 0x0006, 0x0005,
-  0x0005, 0x0807, 0x6819, 0x5015, 0x180a, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0005, 0x0807, 0x701a, 0x889e, 0x4832, 0x0806, 0x0006,
-  0x0006, 0x0007, 0x1009, 0x1009, 0x5014, 0x0808, 0x0006, 0x0007,
-  0x0007, 0x0006, 0x0007, 0x180b, 0x5015, 0x701a, 0x0808, 0x0006,
-  0x0007, 0x0808, 0x280e, 0x0808, 0x100a, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0809, 0x5014, 0x100a, 0x100a, 0x0008, 0x0007,
-  0x0008, 0x0009, 0x080a, 0x0809, 0x280f, 0x0809, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x100a, 0x080a, 0x280f, 0x0809, 0x0008,
-  0x0009, 0x080a, 0x200f, 0x080a, 0x080a, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x3010, 0x2810, 0x100b, 0x000a, 0x0009,
-  0x000a, 0x000a, 0x080b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x080b, 0x080c, 0x200f, 0x080b, 0x000a,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x080c, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
-  0x0002, 0x0003, 0x382e, 0x48b0, 0x380e, 0x0003, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0002, 0x0003, 0x0003, 0x0003, 0x0002, 0x0002,
-  0x0003, 0x0004, 0x50b1, 0xcd9c, 0x48b0, 0x0004, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0004, 0x382e, 0x48b0, 0x382e, 0x0004, 0x0003,
-  0x0004, 0x0806, 0x701a, 0x889e, 0x4832, 0x0005, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0005, 0x48b1, 0xcd9c, 0x50b2, 0x0005, 0x0004,
-  0x0005, 0x0005, 0x1809, 0x4814, 0x6819, 0x0807, 0x0004, 0x0005,
-  0x0005, 0x0005, 0x0806, 0x4832, 0x889e, 0x701a, 0x0807, 0x0004,
-  0x0005, 0x0807, 0x5014, 0x1008, 0x1009, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0005, 0x0807, 0x6819, 0x4814, 0x180a, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x1009, 0x0808, 0x4012, 0x0808, 0x0006, 0x0007,
-  0x0007, 0x0006, 0x0007, 0x1009, 0x1009, 0x5014, 0x0808, 0x0006,
-  0x0007, 0x0808, 0x280f, 0x0809, 0x0809, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0809, 0x4012, 0x0809, 0x100a, 0x0008, 0x0007,
-  0x0008, 0x0009, 0x080a, 0x0809, 0x200e, 0x0809, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x100a, 0x080a, 0x280f, 0x0809, 0x0008,
-  0x0009, 0x080a, 0x180d, 0x080a, 0x080a, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x3010, 0x200e, 0x100b, 0x000a, 0x0009,
-  0x000a, 0x000a, 0x080b, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x080b, 0x080b, 0x180d, 0x080b, 0x000a,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x080c, 0x080b, 0x000b,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0001, 0x0001, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0002, 0x300d, 0x48af, 0x300d, 0x0002, 0x0001, 0x0001,
-  0x0001, 0x0001, 0x0001, 0x0002, 0x0002, 0x0002, 0x0001, 0x0001,
-  0x0002, 0x0003, 0x48af, 0xcd9c, 0x50b1, 0x0003, 0x0002, 0x0002,
-  0x0002, 0x0002, 0x0003, 0x302d, 0x48af, 0x302d, 0x0003, 0x0002,
-  0x0003, 0x0004, 0x4811, 0x889e, 0x701a, 0x0805, 0x0003, 0x0003,
-  0x0003, 0x0003, 0x0004, 0x50b1, 0xcd9c, 0x48b0, 0x0004, 0x0003,
-  0x0004, 0x0806, 0x6819, 0x5015, 0x1809, 0x0004, 0x0004, 0x0004,
-  0x0004, 0x0004, 0x0806, 0x701a, 0x889e, 0x4812, 0x0005, 0x0004,
-  0x0005, 0x0005, 0x1008, 0x280c, 0x5014, 0x0806, 0x0005, 0x0005,
-  0x0005, 0x0005, 0x0005, 0x180a, 0x5015, 0x6819, 0x0807, 0x0004,
-  0x0005, 0x0807, 0x4011, 0x0808, 0x1008, 0x0006, 0x0006, 0x0006,
-  0x0006, 0x0005, 0x0807, 0x5014, 0x280d, 0x1009, 0x0006, 0x0006,
-  0x0007, 0x0007, 0x0808, 0x0807, 0x280e, 0x0807, 0x0006, 0x0007,
-  0x0007, 0x0007, 0x0007, 0x1009, 0x0808, 0x4012, 0x0808, 0x0006,
-  0x0007, 0x0808, 0x180c, 0x0808, 0x0809, 0x0008, 0x0007, 0x0008,
-  0x0008, 0x0007, 0x0808, 0x280f, 0x0808, 0x0809, 0x0008, 0x0007,
-  0x0008, 0x0008, 0x0809, 0x0809, 0x180d, 0x0809, 0x0008, 0x0008,
-  0x0008, 0x0008, 0x0009, 0x080a, 0x0809, 0x180d, 0x0809, 0x0008,
-  0x0009, 0x0009, 0x0009, 0x0009, 0x080a, 0x0009, 0x0009, 0x0009,
-  0x0009, 0x0009, 0x080a, 0x180d, 0x080a, 0x080a, 0x0009, 0x0009,
-  0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a, 0x000a,
-  0x000a, 0x000a, 0x000a, 0x080b, 0x000a, 0x000a, 0x000a, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b,
-  0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b, 0x000b
-};
-
-const Animation fireworksAnimation = {
-  .name = "Fireworks",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = fireworksDurations,
-  .animationFrames = fireworksFrames
-};
-#endif // ANIMATION_FIREWORKS_H
@@ -1,406 +0,0 @@
-// flash.h - Auto-generated from flash.json
-#ifndef ANIMATION_FLASH_H
-#define ANIMATION_FLASH_H
-
-#include "animation_types.h"
-
-// Frame Durations for flash (in 100ms units)
-static const uint8_t PROGMEM flashDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for flash
-static const uint16_t PROGMEM flashFrames[] = {
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xfd40, 0xfd40, 0x02bf, 0xfd40, 0x02bf, 0xfd40, 0xffe0, 0xffe0,
-  0xffe0, 0xf8e0, 0xf8e0, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xffe0,
-  0xffe0, 0xffe0, 0xf8e0, 0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf,
-  0xfaa0, 0x02bf, 0xfaa0, 0xfaa0, 0xf8e0, 0xf8e0, 0xf800, 0x02bf,
-  0xc8a0, 0xfd40, 0xf8e0, 0xffff, 0xf800, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0xf8e0, 0xf8e0, 0xf8e0, 0xf8e0, 0xf8e0,
-  0xc8a0, 0xf8e0, 0xf636, 0xf636, 0xf636, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0xf800, 0xf8e0, 0x02bf, 0x02bf, 0xf8e0, 0xf8e0,
-  0xc8a0, 0xc8a0, 0xf636, 0xf636, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xf800, 0xfaa0, 0x02bf, 0xfaa0, 0xfaa0,
-  0xc8a0, 0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x9060, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xfaa0, 0xfaa0, 0x02bf, 0xfaa0, 0x02bf, 0xfaa0, 0xfd40, 0xf800,
-  0xf800, 0xf800, 0xffe0, 0x9060, 0x02bf, 0x9060, 0x9060, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0xf800, 0xf800, 0xfd40,
-  0xfd40, 0x0000, 0x9060, 0x9060, 0x9060, 0x9060, 0x9060, 0x02bf,
-  0x9060, 0x9060, 0x9060, 0x02bf, 0x9060, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x9060, 0x9060, 0x9060, 0x9060, 0x9060, 0x02bf,
-  0xf800, 0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xfaa0, 0x02bf, 0xfaa0, 0x9060, 0x9060, 0xfaa0, 0xfaa0, 0x02bf,
-  0xfaa0, 0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0xf800, 0xf800, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x12dc, 0x02be, 0x12dc, 0x02be, 0x131c, 0x131c,
-  0x131c, 0x127c, 0x127c, 0x127d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x0add, 0xc4a7, 0xc4a7, 0x231b, 0xac6a, 0x233a, 0xc6a7, 0xef82,
-  0xef02, 0xe222, 0xe8e2, 0xd044, 0x223a, 0x02bf, 0x02bf, 0x02bf,
-  0x127c, 0x1adc, 0x2aba, 0x1a9b, 0x2aba, 0x029e, 0x237b, 0xd724,
-  0xff60, 0xfea0, 0xf940, 0xf882, 0xd044, 0x127c, 0x02bf, 0x02bf,
-  0xb948, 0x225b, 0xb948, 0xd125, 0xb948, 0x129d, 0x129d, 0x32b8,
-  0xc1a2, 0xfc60, 0xfa44, 0xfe17, 0xe946, 0x127c, 0x02bf, 0x02bf,
-  0x127d, 0x029f, 0x127d, 0x1a7c, 0x2a5a, 0x2a5a, 0xd924, 0xe0e2,
-  0xc880, 0xf182, 0xf593, 0xf656, 0xcd56, 0x12de, 0x029f, 0x02bf,
-  0x12bc, 0x02be, 0x12bd, 0x127d, 0xc865, 0xd065, 0xe103, 0xf0e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xcdb7, 0x233e, 0x02bf, 0x029f, 0x02bf,
-  0xba88, 0x229a, 0xaaaa, 0x2a7a, 0xd064, 0x39f7, 0x3238, 0xc0c2,
-  0xd080, 0xf000, 0xe883, 0x22bc, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0x2a9a, 0x0a9e, 0x2aba, 0x2a79, 0xe822, 0xe842, 0xe0a2, 0xf000,
-  0xf800, 0xf800, 0xe8c2, 0x127c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0xba88, 0x229b, 0xbaa7, 0xd265, 0xe043, 0xf840, 0xfba0, 0xf8e0,
-  0xf860, 0xe8c2, 0xddc2, 0x131d, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1abc, 0x2aba, 0x3a58, 0xe822, 0xf8a0, 0xfc20,
-  0xec42, 0x3278, 0x8144, 0x1a5a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0xca85, 0xc287, 0x1abb, 0xbaa8, 0xda42, 0xf020, 0xf800, 0xf860,
-  0xe0a2, 0x1a5b, 0x78c5, 0x80c4, 0x125a, 0x02bf, 0x02bf, 0x02bf,
-  0x2a99, 0x1a9c, 0x1abc, 0x3298, 0x9901, 0xa880, 0xe800, 0xf800,
-  0xe822, 0x223a, 0x125b, 0x8881, 0x80c3, 0x0a7d, 0x02bf, 0x02bf,
-  0xba88, 0x22bb, 0xba87, 0xda62, 0xea40, 0xe220, 0x98c2, 0xd842,
-  0xf800, 0xd864, 0x2a18, 0x78c5, 0x78c4, 0x0a7d, 0x02bf, 0x02bf,
-  0x129c, 0x02bf, 0x227a, 0x90c2, 0xa0a0, 0x90c2, 0x125a, 0x225a,
-  0xe822, 0xf800, 0xd064, 0x1a5a, 0x0a9d, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x02be, 0x12dc, 0x1afc, 0x1afc, 0x1b1c, 0x131c,
-  0x131c, 0x127c, 0x127c, 0x127d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x12fd, 0xac69, 0x231b, 0xbca7, 0xd4c5, 0xd4e5, 0xd6e5, 0xe782,
-  0xef02, 0xe222, 0xe8e2, 0xd044, 0x223a, 0x02bf, 0x02bf, 0x02bf,
-  0x1a7c, 0x12dc, 0x1a7c, 0x2a99, 0x2ab9, 0x1adc, 0x3b37, 0xeee2,
-  0xff40, 0xfea0, 0xf940, 0xf882, 0xd044, 0x127c, 0x02bf, 0x02bf,
-  0xb8a8, 0x223b, 0xb8a8, 0xc865, 0xb888, 0x1a3b, 0xb887, 0xf0a0,
-  0xd180, 0xf460, 0xfa44, 0xfe17, 0xe946, 0x127c, 0x02bf, 0x02bf,
-  0x2a7a, 0x0a9e, 0x2a7a, 0x2a79, 0x2a7a, 0x029e, 0x3a58, 0xe0e2,
-  0xd080, 0xe982, 0xf593, 0xf656, 0xcd56, 0x12de, 0x029f, 0x02bf,
-  0xbaa8, 0x22bb, 0xbaa7, 0xcaa5, 0xbaa8, 0x22bb, 0xd265, 0xf100,
-  0xc880, 0xd0e1, 0xed52, 0xcdb7, 0x233e, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2a99, 0x2aba, 0x2a9a, 0xe122, 0xd0a0,
-  0xd080, 0xf000, 0xe883, 0x22bc, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0xca85, 0xc287, 0x1a9b, 0xba88, 0xcaa5, 0xd285, 0xf101, 0xd0a0,
-  0xe820, 0xf800, 0xe8c2, 0x127c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2ab9, 0x2ab9, 0x3a58, 0xe102, 0xf0e0,
-  0xd880, 0xf8a0, 0xe5c2, 0x131c, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229b, 0xba87, 0xd2a5, 0xca65, 0xe062, 0xd080, 0xf0e0,
-  0xf8e0, 0xf0e0, 0x8964, 0x0a9d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0a9e, 0x2a9a, 0x1abc, 0x3a77, 0xe861, 0xf040, 0xd0a0,
-  0xf0e0, 0xd902, 0x1a5a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229a, 0xa28a, 0x1abb, 0xba87, 0xf240, 0xfa00, 0xf040,
-  0xa060, 0x90a2, 0x0a7d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0abe, 0x2aba, 0x1abc, 0x229a, 0xa0e2, 0xf040, 0xf000,
-  0x9082, 0x78c5, 0x0a7d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xca85, 0x229a, 0xd285, 0xd285, 0x22ba, 0xda43, 0xf820, 0xe822,
-  0x225a, 0x0a9d, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x1d3c, 0x155c, 0x055e, 0x155c, 0x055e, 0x155c, 0x1d7c, 0x157c,
-  0x157c, 0x14dc, 0x14dc, 0x14dd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd545, 0xc547, 0x255b, 0xad4a, 0x255b, 0xbd68, 0xd745, 0xefa2,
-  0xef42, 0xe242, 0xe922, 0xd0c4, 0x247a, 0x055f, 0x055f, 0x055f,
-  0x2d19, 0x1d3c, 0x1d1c, 0x2d1a, 0x1cfc, 0x2cfa, 0x3d38, 0xdf64,
-  0xff60, 0xfea0, 0xf940, 0xf882, 0xd0c4, 0x14dc, 0x055f, 0x055f,
-  0xbb48, 0x24db, 0xbb47, 0xe283, 0xe942, 0xe902, 0xd0e5, 0x4456,
-  0xc1e2, 0xfc60, 0xfa44, 0xfe17, 0xe966, 0x14dc, 0x055f, 0x055f,
-  0x151d, 0x053f, 0x3458, 0xe942, 0xe922, 0xe922, 0xf8c0, 0xe102,
-  0xc8a0, 0xf182, 0xf593, 0xf656, 0xcdb6, 0x155e, 0x053f, 0x055f,
-  0x151c, 0x24ba, 0xd8e4, 0xe902, 0x3c78, 0x24ba, 0xe162, 0xf8e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x053f, 0x055f, 0x055f,
-  0xcb05, 0xd305, 0xe262, 0xe0e3, 0xbb07, 0x1cfb, 0xe283, 0xfa20,
-  0xd0a0, 0xf000, 0xe8a3, 0x2c9a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2cb9, 0x2cd9, 0x1d1c, 0x24ba, 0x1d1c, 0x24ba, 0xe902, 0xf820,
-  0xf800, 0xf800, 0xf080, 0x8124, 0x0cfd, 0x0cfd, 0x0cfd, 0x053f,
-  0xd305, 0xbb48, 0x24fb, 0xab8a, 0x24fb, 0xd305, 0xfbe0, 0xf8c0,
-  0xf880, 0xe102, 0xed80, 0x9141, 0x2418, 0x8124, 0x7904, 0x0cdc,
-  0x2499, 0x2499, 0x0cdc, 0x151d, 0x249a, 0xe882, 0xf8a0, 0xfc00,
-  0xec82, 0x4436, 0x81c5, 0x88e2, 0x7924, 0x88c2, 0x8964, 0x0cdc,
-  0x7145, 0x7925, 0x7925, 0x1c39, 0x8124, 0xe800, 0xf000, 0xe8c2,
-  0xf880, 0xd0c4, 0x2c18, 0x0cfc, 0x0cdc, 0x355c, 0xcefd, 0x157f,
-  0x24ba, 0x1c7a, 0x90e2, 0x90a1, 0x9860, 0xa880, 0x98e2, 0x3418,
-  0xe882, 0xf800, 0xd0c4, 0x0cdd, 0x0d9f, 0xdf9f, 0xefdf, 0x2dbf,
-  0xbb48, 0x24fb, 0xc2c5, 0x90e2, 0x8903, 0xd283, 0xcae5, 0x24fb,
-  0xcaa5, 0xf820, 0xe842, 0x2d1c, 0x25bf, 0xd77f, 0xe7bf, 0xefbf,
-  0x14fc, 0x053e, 0x151d, 0x0cdc, 0x0cdc, 0x151c, 0x151c, 0x055f,
-  0x24ba, 0xe842, 0xf882, 0xef1c, 0xd79f, 0x259f, 0x25bf, 0xefbf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x12dc, 0x02be, 0x12dc, 0x02be, 0x131c, 0x131c,
-  0x131c, 0x127c, 0x127c, 0x127d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x0add, 0xc4a7, 0xc4a7, 0x231b, 0xac6a, 0x233a, 0xc6a7, 0xef82,
-  0xef02, 0xe222, 0xe8e2, 0xd044, 0x223a, 0x02bf, 0x02bf, 0x02bf,
-  0x127c, 0x1adc, 0x2aba, 0x1a9b, 0x2aba, 0x029e, 0x237b, 0xd724,
-  0xff60, 0xfea0, 0xf940, 0xf882, 0xd044, 0x127c, 0x02bf, 0x02bf,
-  0xb948, 0x225b, 0xb948, 0xd125, 0xb948, 0x129d, 0x129d, 0x32b8,
-  0xc1a2, 0xfc60, 0xfa44, 0xfe17, 0xe946, 0x127c, 0x02bf, 0x02bf,
-  0x127d, 0x029f, 0x127d, 0x1a7c, 0x2a5a, 0x2a5a, 0xd924, 0xe0e2,
-  0xc880, 0xf182, 0xf593, 0xf656, 0xcd56, 0x12de, 0x029f, 0x02bf,
-  0x12bc, 0x02be, 0x12bd, 0x127d, 0xc865, 0xd065, 0xe103, 0xf0e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xcdb7, 0x233e, 0x02bf, 0x029f, 0x02bf,
-  0xba88, 0x229a, 0xaaaa, 0x2a7a, 0xd064, 0x39f7, 0x3238, 0xc0c2,
-  0xd080, 0xf000, 0xe883, 0x22bc, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0x2a9a, 0x0a9e, 0x2aba, 0x2a79, 0xe822, 0xe842, 0xe0a2, 0xf000,
-  0xf800, 0xf800, 0xe8c2, 0x127c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0xba88, 0x229b, 0xbaa7, 0xd265, 0xe043, 0xf840, 0xfba0, 0xf8e0,
-  0xf860, 0xe8c2, 0xddc2, 0x131d, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1abc, 0x2aba, 0x3a58, 0xe822, 0xf8a0, 0xfc20,
-  0xec42, 0x3278, 0x8144, 0x1a5a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0xca85, 0xc287, 0x1abb, 0xbaa8, 0xda42, 0xf020, 0xf800, 0xf860,
-  0xe0a2, 0x1a5b, 0x78c5, 0x80c4, 0x125a, 0x02bf, 0x02bf, 0x02bf,
-  0x2a99, 0x1a9c, 0x1abc, 0x3298, 0x9901, 0xa880, 0xe800, 0xf800,
-  0xe822, 0x223a, 0x125b, 0x8881, 0x80c3, 0x0a7d, 0x02bf, 0x02bf,
-  0xba88, 0x22bb, 0xba87, 0xda62, 0xea40, 0xe220, 0x98c2, 0xd842,
-  0xf800, 0xd864, 0x2a18, 0x78c5, 0x78c4, 0x0a7d, 0x02bf, 0x02bf,
-  0x129c, 0x02bf, 0x227a, 0x90c2, 0xa0a0, 0x90c2, 0x125a, 0x225a,
-  0xe822, 0xf800, 0xd064, 0x1a5a, 0x0a9d, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x02be, 0x12dc, 0x1afc, 0x1afc, 0x1b1c, 0x131c,
-  0x131c, 0x127c, 0x127c, 0x127d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x12fd, 0xac69, 0x231b, 0xbca7, 0xd4c5, 0xd4e5, 0xd6e5, 0xe782,
-  0xef02, 0xe222, 0xe8e2, 0xd044, 0x223a, 0x02bf, 0x02bf, 0x02bf,
-  0x1a7c, 0x12dc, 0x1a7c, 0x2a99, 0x2ab9, 0x1adc, 0x3b37, 0xeee2,
-  0xff40, 0xfea0, 0xf940, 0xf882, 0xd044, 0x127c, 0x02bf, 0x02bf,
-  0xb8a8, 0x223b, 0xb8a8, 0xc865, 0xb888, 0x1a3b, 0xb887, 0xf0a0,
-  0xd180, 0xf460, 0xfa44, 0xfe17, 0xe946, 0x127c, 0x02bf, 0x02bf,
-  0x2a7a, 0x0a9e, 0x2a7a, 0x2a79, 0x2a7a, 0x029e, 0x3a58, 0xe0e2,
-  0xd080, 0xe982, 0xf593, 0xf656, 0xcd56, 0x12de, 0x029f, 0x02bf,
-  0xbaa8, 0x22bb, 0xbaa7, 0xcaa5, 0xbaa8, 0x22bb, 0xd265, 0xf100,
-  0xc880, 0xd0e1, 0xed52, 0xcdb7, 0x233e, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2a99, 0x2aba, 0x2a9a, 0xe122, 0xd0a0,
-  0xd080, 0xf000, 0xe883, 0x22bc, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0xca85, 0xc287, 0x1a9b, 0xba88, 0xcaa5, 0xd285, 0xf101, 0xd0a0,
-  0xe820, 0xf800, 0xe8c2, 0x127c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2ab9, 0x2ab9, 0x3a58, 0xe102, 0xf0e0,
-  0xd880, 0xf8a0, 0xe5c2, 0x131c, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229b, 0xba87, 0xd2a5, 0xca65, 0xe062, 0xd080, 0xf0e0,
-  0xf8e0, 0xf0e0, 0x8964, 0x0a9d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0a9e, 0x2a9a, 0x1abc, 0x3a77, 0xe861, 0xf040, 0xd0a0,
-  0xf0e0, 0xd902, 0x1a5a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229a, 0xa28a, 0x1abb, 0xba87, 0xf240, 0xfa00, 0xf040,
-  0xa060, 0x90a2, 0x0a7d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0abe, 0x2aba, 0x1abc, 0x229a, 0xa0e2, 0xf040, 0xf000,
-  0x9082, 0x78c5, 0x0a7d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xca85, 0x229a, 0xd285, 0xd285, 0x22ba, 0xda43, 0xf820, 0xe822,
-  0x225a, 0x0a9d, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xefbf, 0xefbf, 0x3ddf, 0xd77f, 0xefbf, 0x157f, 0x053f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x25bf, 0xd77f, 0xdf7f, 0x4e1f, 0xd77f, 0x157f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x153c, 0x3d9c, 0xdf7e, 0xef9c, 0xefbf, 0x2dbf, 0x157c, 0x157c,
-  0x157c, 0x14dc, 0x14dc, 0x14dd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd525, 0xbd27, 0x357b, 0xd5aa, 0xe79d, 0xe7de, 0xefa7, 0xefa2,
-  0xef42, 0xe242, 0xe922, 0xd0c4, 0x247a, 0x055f, 0x055f, 0x055f,
-  0x2d19, 0x1d3c, 0x151c, 0x24fa, 0x3d3c, 0xef3d, 0xffda, 0xefa4,
-  0xff40, 0xfea0, 0xf940, 0xf882, 0xd0c4, 0x14dc, 0x055f, 0x055f,
-  0xbb48, 0x24db, 0xbb47, 0xe283, 0xe942, 0xf9e4, 0xef3d, 0x4519,
-  0xc1c2, 0xfc60, 0xfa44, 0xfe17, 0xe966, 0x14dc, 0x055f, 0x055f,
-  0x151d, 0x053f, 0x3458, 0xe942, 0xe922, 0xe1c5, 0xf658, 0xe1a5,
-  0xc880, 0xf182, 0xf593, 0xf656, 0xcdb6, 0x155e, 0x053f, 0x055f,
-  0x151c, 0x24ba, 0xd8e4, 0xe902, 0x3c78, 0x24bb, 0xe1c4, 0xf900,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x053f, 0x055f, 0x055f,
-  0xcb05, 0xd305, 0xe262, 0xe0e3, 0xbb07, 0x1cfb, 0xe262, 0xfa20,
-  0xd0a0, 0xf000, 0xe8a3, 0x2c9a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2cb9, 0x2cd9, 0x1d1c, 0x24ba, 0x1d1c, 0x24ba, 0xe902, 0xf820,
-  0xf800, 0xf800, 0xf080, 0x8124, 0x0cfd, 0x0cfd, 0x0cfd, 0x053f,
-  0xd305, 0xbb48, 0x24fb, 0xab8a, 0x24fb, 0xd305, 0xfbe0, 0xf8c0,
-  0xf880, 0xe102, 0xed80, 0x9141, 0x2418, 0x8124, 0x8124, 0x0cdc,
-  0x2499, 0x2499, 0x0cdc, 0x151d, 0x249a, 0xe882, 0xf8a0, 0xfc00,
-  0xec82, 0x4436, 0x81c5, 0x88e2, 0x7924, 0x88c2, 0x7924, 0x0cdc,
-  0x7145, 0x7925, 0x7925, 0x1c39, 0x8124, 0xe800, 0xf000, 0xe8c2,
-  0xf880, 0xd0c4, 0x2c18, 0x0cfc, 0x0cdc, 0x0cfc, 0x0cfd, 0x053f,
-  0x24ba, 0x1c7a, 0x90e2, 0x90a1, 0x9860, 0xa880, 0x98e2, 0x3418,
-  0xe882, 0xf800, 0xd0c4, 0x14fd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xbb48, 0x24fb, 0xc2c5, 0x90e2, 0x8903, 0xd283, 0xcae5, 0x24fb,
-  0xcaa5, 0xf820, 0xe842, 0x14dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x053e, 0x151d, 0x0cdc, 0x0cdc, 0x151c, 0x151c, 0x055f,
-  0x24ba, 0xe862, 0xe842, 0x14dc, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x157f, 0xd77f, 0xefbf,
-  0xe7bf, 0x157f, 0x053f, 0x157f, 0x157f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x055f, 0x157f, 0x2dbf,
-  0xd77f, 0x2dbf, 0x25bf, 0xd79f, 0xd77f, 0x157f, 0x053f, 0x055f,
-  0x053f, 0x155c, 0x155c, 0x055e, 0x155c, 0x055e, 0x157c, 0x259c,
-  0xe79c, 0xef1c, 0xef1c, 0xff5d, 0xefbf, 0x157f, 0x053f, 0x055f,
-  0x0d5d, 0xc547, 0xc547, 0x255b, 0xad4a, 0x257a, 0xc747, 0xefa2,
-  0xff62, 0xfa82, 0xf942, 0xf924, 0xe67a, 0x157f, 0x053f, 0x055f,
-  0x14dc, 0x1d3c, 0x2cfa, 0x1cdb, 0x2cda, 0x053e, 0x25bb, 0xd784,
-  0xf740, 0xfe80, 0xf940, 0xf882, 0xe0e4, 0x14dc, 0x055f, 0x055f,
-  0xb9e8, 0x24bb, 0xb9e8, 0xd185, 0xb9e8, 0x14fd, 0x14fd, 0x34b8,
-  0xc1e2, 0xfc60, 0xfa44, 0xfe17, 0xe966, 0x14bc, 0x055f, 0x055f,
-  0x14fd, 0x053f, 0x14fd, 0x1cdc, 0x2c9a, 0x2c7a, 0xd984, 0xe122,
-  0xc880, 0xf182, 0xf593, 0xf656, 0xcdb6, 0x155e, 0x053f, 0x055f,
-  0x151c, 0x053e, 0x153d, 0x14fd, 0xc8e5, 0xd0c5, 0xe143, 0xf0e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x053f, 0x055f, 0x055f,
-  0xbb48, 0x24da, 0xab8a, 0x2c9a, 0xd0c4, 0x3bf7, 0x3438, 0xc0e2,
-  0xd080, 0xf000, 0xe8a3, 0x24fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2cda, 0x0d3e, 0x2cfa, 0x2c99, 0xe862, 0xe862, 0xe0c2, 0xf000,
-  0xf800, 0xf800, 0xe8e2, 0x14fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xbb48, 0x24fb, 0xbb47, 0xd2c5, 0xe083, 0xf840, 0xfba0, 0xf8e0,
-  0xf880, 0xe8e2, 0xde02, 0x157d, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x2cd9, 0x1cfc, 0x1d1c, 0x2cda, 0x3c58, 0xe862, 0xf8a0, 0xfc00,
-  0xec82, 0x3478, 0x81a4, 0x1c9a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xcb05, 0xc347, 0x1cfb, 0xbb48, 0xda82, 0xf020, 0xf800, 0xf860,
-  0xe0e2, 0x1c9b, 0x7925, 0x8104, 0x149a, 0x055f, 0x055f, 0x055f,
-  0x2cd9, 0x1cfc, 0x1d1c, 0x3498, 0x9921, 0xa880, 0xe800, 0xf800,
-  0xe842, 0x247a, 0x14bb, 0x88a1, 0x8103, 0x0cfd, 0x055f, 0x055f,
-  0xbb48, 0x24fb, 0xbb47, 0xdaa2, 0xea40, 0xe220, 0x9902, 0xd882,
-  0xf800, 0xd8c4, 0x2c38, 0x7945, 0x7924, 0x0cfd, 0x055f, 0x055f,
-  0x14fc, 0x055f, 0x24ba, 0x9102, 0xa080, 0x9102, 0x149a, 0x249a,
-  0xe862, 0xf800, 0xd0c4, 0x1c7a, 0x0cfd, 0x053f, 0x055f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x155c, 0x055e, 0x155c, 0x1d5c, 0x1d5c, 0x1d7c, 0x157c,
-  0x157c, 0x14dc, 0x14dc, 0x14dd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x155d, 0xad49, 0x255b, 0xbd47, 0xd545, 0xd565, 0xd745, 0xe7c2,
-  0xef42, 0xe242, 0xe922, 0xd0c4, 0x247a, 0x055f, 0x055f, 0x055f,
-  0x1cdc, 0x153c, 0x1cdc, 0x2cd9, 0x2cd9, 0x1d3c, 0x3d37, 0xef02,
-  0xff40, 0xfea0, 0xf940, 0xf882, 0xd0c4, 0x14dc, 0x055f, 0x055f,
-  0xb948, 0x249b, 0xb948, 0xc8e5, 0xb948, 0x1c9b, 0xb947, 0xf0a0,
-  0xd180, 0xf460, 0xfa44, 0xfe17, 0xe966, 0x14dc, 0x055f, 0x055f,
-  0x249a, 0x0d1e, 0x249a, 0x2c79, 0x2c9a, 0x053e, 0x3458, 0xe0e2,
-  0xd080, 0xe982, 0xf593, 0xf656, 0xcdb6, 0x155e, 0x053f, 0x055f,
-  0xcb88, 0x24fa, 0xcb87, 0xe345, 0xbb48, 0x1cfb, 0xd367, 0xf1a3,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x053f, 0x055f, 0x055f,
-  0xef3c, 0x3dde, 0xef5c, 0xf73c, 0x3cfa, 0x251c, 0xef3c, 0xf658,
-  0xd102, 0xf000, 0xe8a3, 0x24fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xe79f, 0xd77f, 0xf7ff, 0xffbe, 0xe3a7, 0xeba7, 0xf71b, 0xd1c5,
-  0xf020, 0xf800, 0xe8e2, 0x14dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2d9f, 0x3dff, 0xefbf, 0xff7c, 0xfef9, 0xfefa, 0xf6ba, 0xf162,
-  0xd860, 0xf8a0, 0xe5e2, 0x157c, 0x053f, 0x055f, 0x055f, 0x055f,
-  0xe7bf, 0xd79f, 0xe75d, 0xe3a7, 0xe305, 0xf0e3, 0xd902, 0xf0e0,
-  0xf8e0, 0xf0e0, 0x89c4, 0x0cfd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xef3c, 0x2dbe, 0x253c, 0x1d1c, 0x3c77, 0xe881, 0xf020, 0xd0a0,
-  0xf0c0, 0xd922, 0x1c7a, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xcb68, 0x24da, 0xa36a, 0x1cfb, 0xbb27, 0xf240, 0xfa00, 0xf040,
-  0xa040, 0x90c2, 0x0cfd, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x24da, 0x0d3e, 0x2cda, 0x1d1c, 0x24ba, 0xa122, 0xf020, 0xf000,
-  0x90c2, 0x7945, 0x0cfd, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xcb05, 0x24da, 0xd305, 0xd305, 0x24fa, 0xda83, 0xf800, 0xe842,
-  0x247a, 0x0cfd, 0x053f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x157f,
-  0xd77f, 0xefbf, 0x2dbf, 0x259f, 0xd77f, 0xefbf, 0x2dbf, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x259f, 0xd77f, 0xd79f, 0xd79f, 0x4e1f, 0xefbf, 0xd77f, 0x157f,
-  0x1d3c, 0x155c, 0x055e, 0x155c, 0x055e, 0x155c, 0x1d7c, 0x157c,
-  0x157c, 0x251c, 0x3d5c, 0xef1d, 0xd77f, 0xefbf, 0xe79f, 0x1d9f,
-  0xd545, 0xc547, 0x255b, 0xad4a, 0x255b, 0xbd68, 0xd745, 0xefa2,
-  0xef42, 0xe242, 0xe102, 0xe8e4, 0x3cba, 0x2dbf, 0xd77f, 0x157f,
-  0x2d19, 0x1d3c, 0x1d1c, 0x2d1a, 0x1cfc, 0x2cfa, 0x3d38, 0xdf64,
-  0xff60, 0xfea0, 0xf940, 0xf882, 0xd0a4, 0x251c, 0xd79f, 0x2dbf,
-  0xbb48, 0x24db, 0xbb47, 0xe283, 0xe942, 0xe902, 0xd0e5, 0x4456,
-  0xc1e2, 0xfc60, 0xfa44, 0xfe17, 0xe966, 0x24fc, 0xcf7f, 0xefbf,
-  0x151d, 0x053f, 0x3458, 0xe942, 0xe922, 0xe922, 0xf8c0, 0xe102,
-  0xc8a0, 0xf182, 0xf593, 0xf656, 0xcd96, 0x153e, 0x35df, 0xefbf,
-  0x151c, 0x24ba, 0xd8e4, 0xe902, 0x3c78, 0x24ba, 0xe162, 0xf8e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x259f, 0xd77f, 0xefbf,
-  0xcb05, 0xd305, 0xe262, 0xe0e3, 0xbb07, 0x1cfb, 0xe283, 0xfa20,
-  0xd0a0, 0xf000, 0xe8a3, 0x2c9a, 0x0d7f, 0xd79f, 0xdf9f, 0x25bf,
-  0x2cb9, 0x2cd9, 0x1d1c, 0x24ba, 0x1d1c, 0x24ba, 0xe902, 0xf820,
-  0xf800, 0xf800, 0xf080, 0x8124, 0x1d3d, 0xd6fd, 0x355d, 0x053f,
-  0xd305, 0xbb48, 0x24fb, 0xab8a, 0x24fb, 0xd305, 0xfbe0, 0xf8c0,
-  0xf880, 0xe102, 0xed80, 0x9141, 0x2418, 0x9144, 0x7924, 0x0cdc,
-  0x2499, 0x2499, 0x0cdc, 0x151d, 0x249a, 0xe882, 0xf8a0, 0xfc00,
-  0xec82, 0x4436, 0x81c5, 0x88e2, 0x7924, 0x88c2, 0x7924, 0x0cdc,
-  0x7145, 0x7925, 0x7925, 0x1c39, 0x8124, 0xe800, 0xf000, 0xe8c2,
-  0xf880, 0xd0c4, 0x2c18, 0x0cfc, 0x0cdc, 0x0cfc, 0x0cfd, 0x053f,
-  0x24ba, 0x1c7a, 0x90e2, 0x90a1, 0x9860, 0xa880, 0x98e2, 0x3418,
-  0xe882, 0xf800, 0xd0c4, 0x14fd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xbb48, 0x24fb, 0xc2c5, 0x90e2, 0x8903, 0xd283, 0xcae5, 0x24fb,
-  0xcaa5, 0xf820, 0xe842, 0x14dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x053e, 0x151d, 0x0cdc, 0x0cdc, 0x151c, 0x151c, 0x055f,
-  0x24ba, 0xe862, 0xe842, 0x14dc, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x155c, 0x155c, 0x055e, 0x155c, 0x055e, 0x157c, 0x157c,
-  0x157c, 0x14dc, 0x14dc, 0x14dd, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d5d, 0xc547, 0xc547, 0x255b, 0xad4a, 0x257a, 0xc747, 0xefa2,
-  0xef42, 0xe242, 0xe922, 0xd0c4, 0x247a, 0x055f, 0x055f, 0x055f,
-  0x14dc, 0x1d3c, 0x2cfa, 0x1cdb, 0x2cda, 0x053e, 0x25bb, 0xd784,
-  0xff60, 0xfea0, 0xf940, 0xf882, 0xd0c4, 0x14dc, 0x055f, 0x055f,
-  0xb9e8, 0x24bb, 0xb9e8, 0xd185, 0xb9e8, 0x14fd, 0x14fd, 0x34b8,
-  0xc1e2, 0xfc60, 0xfa44, 0xfe17, 0xe966, 0x14dc, 0x055f, 0x055f,
-  0x14fd, 0x053f, 0x14fd, 0x1cdc, 0x2c9a, 0x2c7a, 0xd984, 0xe122,
-  0xc880, 0xf182, 0xf593, 0xf656, 0xcdb6, 0x155e, 0x053f, 0x055f,
-  0x151c, 0x053e, 0x153d, 0x14fd, 0xc8e5, 0xd0c5, 0xe143, 0xf0e0,
-  0xc8a0, 0xd0e1, 0xed52, 0xce17, 0x257e, 0x053f, 0x055f, 0x055f,
-  0xbb48, 0x24da, 0xab8a, 0x2c9a, 0xd0c4, 0x3bf7, 0x3438, 0xc0e2,
-  0xd080, 0xf000, 0xe8a3, 0x24fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2cda, 0x053e, 0x24da, 0x2c99, 0xe862, 0xe862, 0xe0c2, 0xf000,
-  0xf800, 0xf800, 0xe8e2, 0x14fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xbb48, 0x351b, 0xd387, 0xeb04, 0xe0a3, 0xf8e2, 0xfc42, 0xf8e0,
-  0xf880, 0xe8e2, 0xde02, 0x157d, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x3d7c, 0xdf7e, 0xef5c, 0xef3c, 0x4cfa, 0xe71c, 0xff7a, 0xfca2,
-  0xec62, 0x3478, 0x81a4, 0x1c9a, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd79f, 0xd77f, 0x35ff, 0xe75d, 0xec2a, 0xffbe, 0xff7e, 0xf902,
-  0xe0c2, 0x1c9b, 0x7925, 0x8104, 0x149a, 0x055f, 0x055f, 0x055f,
-  0x2d3c, 0x259f, 0x2dbf, 0xef3c, 0xff1a, 0xff7c, 0xf6ba, 0xf861,
-  0xe821, 0x247a, 0x14bb, 0x88a1, 0x8103, 0x0cfd, 0x055f, 0x055f,
-  0xe3a7, 0xe73d, 0xd73d, 0xeb24, 0xf2c2, 0xeaa2, 0x9985, 0xd883,
-  0xf800, 0xd8c4, 0x2c38, 0x7945, 0x7924, 0x0cfd, 0x055f, 0x055f,
-  0xff7c, 0xefbf, 0x355c, 0x88e2, 0xa060, 0x90e1, 0x147a, 0x247a,
-  0xe862, 0xf800, 0xd0c4, 0x1c7a, 0x0cfd, 0x053f, 0x055f, 0x053f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x02be, 0x12dc, 0x1afc, 0x1afc, 0x1b1c, 0x131c,
-  0x131c, 0x127c, 0x127c, 0x127d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x12fd, 0xac69, 0x231b, 0xbca7, 0xd4c5, 0xd4e5, 0xd6e5, 0xe782,
-  0xef02, 0xe222, 0xe8e2, 0xd044, 0x223a, 0x02bf, 0x02bf, 0x02bf,
-  0x1a7c, 0x12dc, 0x1a7c, 0x2a99, 0x2ab9, 0x1adc, 0x3b37, 0xeee2,
-  0xff40, 0xfea0, 0xf940, 0xf882, 0xd044, 0x127c, 0x02bf, 0x02bf,
-  0xb8a8, 0x223b, 0xb8a8, 0xc865, 0xb888, 0x1a3b, 0xb887, 0xf0a0,
-  0xd180, 0xf460, 0xfa44, 0xfe17, 0xe946, 0x127c, 0x02bf, 0x02bf,
-  0x2a7a, 0x0a9e, 0x2a7a, 0x2a79, 0x2a7a, 0x029e, 0x3a58, 0xe0e2,
-  0xd080, 0xe982, 0xf593, 0xf656, 0xcd56, 0x12de, 0x029f, 0x02bf,
-  0xbaa8, 0x22bb, 0xbaa7, 0xcaa5, 0xbaa8, 0x22bb, 0xd265, 0xf100,
-  0xc880, 0xd0e1, 0xed52, 0xcdb7, 0x233e, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2a99, 0x2aba, 0x2a9a, 0xe122, 0xd0a0,
-  0xd080, 0xf000, 0xe883, 0x22bc, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0xca85, 0xc287, 0x1a9b, 0xba88, 0xcaa5, 0xd285, 0xf101, 0xd0a0,
-  0xe820, 0xf800, 0xe8c2, 0x127c, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x2a99, 0x1a9c, 0x1a9c, 0x2ab9, 0x2ab9, 0x3a58, 0xe102, 0xf0e0,
-  0xd880, 0xf8a0, 0xe5c2, 0x131c, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229b, 0xba87, 0xd2a5, 0xca65, 0xe062, 0xd080, 0xf0e0,
-  0xf8e0, 0xf0e0, 0x8964, 0x0a9d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0a9e, 0x2a9a, 0x1abc, 0x3a77, 0xe861, 0xf040, 0xd0a0,
-  0xf0e0, 0xd902, 0x1a5a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0xba88, 0x229a, 0xa28a, 0x1abb, 0xba87, 0xf240, 0xfa00, 0xf040,
-  0xa060, 0x90a2, 0x0a7d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2a9a, 0x0abe, 0x2aba, 0x1abc, 0x229a, 0xa0e2, 0xf040, 0xf000,
-  0x9082, 0x78c5, 0x0a7d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xca85, 0x229a, 0xd285, 0xd285, 0x22ba, 0xda43, 0xf820, 0xe822,
-  0x225a, 0x0a9d, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf
-};
-
-const Animation flashAnimation = {
-  .name = "Flash",
-  .frameCount = 12,
-  .width = 16,
-  .height = 16,
-  .frameDurations = flashDurations,
-  .animationFrames = flashFrames
-};
-#endif // ANIMATION_FLASH_H
@@ -1,1878 +0,0 @@
-// frog.h - Auto-generated from frog.json
-#ifndef ANIMATION_FROG_H
-#define ANIMATION_FROG_H
-
-#include "animation_types.h"
-
-// Frame Durations for frog (in 100ms units)
-static const uint8_t PROGMEM frogDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for frog
-static const uint16_t PROGMEM frogFrames[] = {
-  0x0a23, 0x23c7, 0x34aa, 0x34aa, 0x34aa, 0x23c7, 0x0a23, 0x23c7,
-  0x23c7, 0x0a23, 0xc7de, 0x96da, 0x96da, 0x96da, 0x96da, 0x96da,
-  0x23c7, 0x23c7, 0x0a23, 0x0a23, 0x0a23, 0x0000, 0x0000, 0x0000,
-  0x0a23, 0x0a23, 0x0a23, 0xc7de, 0x96da, 0x96da, 0x96da, 0x96da,
-  0x34aa, 0x0a23, 0x23c7, 0x34aa, 0x34aa, 0x34aa, 0x23c7, 0x23c7,
-  0x34aa, 0x34aa, 0x23c7, 0x0a23, 0xc7de, 0x96da, 0x96da, 0x96da,
-  0x34aa, 0x23c7, 0x34aa, 0x4d8d, 0x34aa, 0x34aa, 0x34aa, 0x0a23,
-  0x34aa, 0x4d8d, 0x34aa, 0x23c7, 0x0a23, 0xc7de, 0x96da, 0x96da,
-  0x34aa, 0x0a23, 0x0a23, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a23,
-  0x23c7, 0x0a23, 0x0000, 0x0000, 0x0000, 0xc7de, 0x96da, 0x96da,
-  0x34aa, 0x23c7, 0x96da, 0x0000, 0x4475, 0x0000, 0x96da, 0x0a23,
-  0x0a23, 0x4475, 0x0000, 0x96da, 0x0000, 0xc7de, 0x96da, 0x96da,
-  0x34aa, 0x34aa, 0x23c7, 0x0000, 0x0000, 0x0000, 0x0a23, 0x34aa,
-  0x34aa, 0x0a23, 0x0000, 0x0a23, 0x23c7, 0x4124, 0xc7de, 0x96da,
-  0x34aa, 0xba85, 0xba85, 0xba85, 0x23c7, 0x34aa, 0x34aa, 0x34aa,
-  0x34aa, 0x34aa, 0x34aa, 0x34aa, 0x34aa, 0xba85, 0x4124, 0xc7de,
-  0x23c7, 0xba85, 0x4124, 0xba85, 0xba85, 0xba85, 0xe40b, 0xba85,
-  0xba85, 0xba85, 0xba85, 0xba85, 0xba85, 0x4124, 0x0000, 0xc7de,
-  0x0a23, 0xba85, 0xba85, 0x4124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x4124, 0xba85, 0x0000, 0xc7de,
-  0x0a23, 0x0a23, 0xba85, 0xba85, 0xba85, 0xba85, 0xe40b, 0xba85,
-  0xba85, 0xba85, 0xba85, 0xba85, 0xba85, 0x4124, 0x0000, 0xc7de,
-  0x23c7, 0x0a23, 0x0000, 0x0000, 0x0000, 0x0a23, 0x0a23, 0x0a23,
-  0x0a23, 0x0a23, 0x0a23, 0x0000, 0x0000, 0x0000, 0xc7de, 0x96da,
-  0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7,
-  0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x0000, 0xc7de, 0x96da, 0x96da,
-  0x0a23, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7,
-  0x23c7, 0x23c7, 0x23c7, 0x0a23, 0x0000, 0xc7de, 0x96da, 0x96da,
-  0x0a23, 0x0a23, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7,
-  0x23c7, 0x23c7, 0x0a23, 0x0000, 0xc7de, 0x96da, 0x96da, 0x96da,
-  0x0a23, 0x0a23, 0x0a23, 0x23c7, 0x23c7, 0x23c7, 0x23c7, 0x23c7,
-  0x23c7, 0x0a23, 0x0000, 0xc7de, 0x96da, 0x96da, 0x96da, 0x96da,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1964, 0xa699, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0x9f1a, 0x96b9, 0x96b9, 0x96d9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x09e3, 0x1944, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x1b67, 0x0a03, 0x1965, 0xa699, 0xa6fa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x0a23, 0x08c2, 0xa679, 0xc7de, 0xbf9d, 0x96da, 0x96b9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x0a03, 0x1945, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x1b67, 0x0a23, 0x08e2, 0x9617, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x2387,
-  0x0a64, 0x0a24, 0x0a03, 0x09e3, 0x2b08, 0xaf3b, 0x9eda, 0x96b9,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b67, 0x1b67, 0x1b67, 0x12e5, 0x08e2, 0xa699, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23c7, 0x2367,
-  0x1284, 0x1285, 0x12a5, 0x1284, 0x1a85, 0xa6fa, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x2367, 0x12a5,
-  0x2c49, 0x3cab, 0x3cab, 0x3cab, 0x2c69, 0x2b48, 0x9eb9, 0x9efa,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1284, 0x2c49,
-  0x450c, 0x08e2, 0x0081, 0x08e2, 0x44ec, 0x2c49, 0x2b28, 0xb73b,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e3, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1ac6, 0xa6da, 0x9efa,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23c7, 0x1b67, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1224, 0x08e2,
-  0x0020, 0x0081, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x1244, 0x09e3, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1224, 0x08e2,
-  0x0020, 0x0081, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x1244, 0x09e3, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1224, 0x08e2,
-  0x0020, 0x0081, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x1244, 0x09e3, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1224, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x450c, 0x44cb,
-  0x1244, 0x0a03, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0x9efa, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb75b, 0xb73b,
-  0xb73b, 0x9efa, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0xa6d9, 0x2b28, 0x1ac6, 0x1ae6, 0x1ae6, 0x1ac6, 0x1aa6, 0x1aa6,
-  0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x1ac6, 0x2387, 0x2408, 0x2428, 0x2408, 0x1b06, 0x0a03, 0x1b06,
-  0x1b46, 0x22e7, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1244, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2387, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x44ec, 0x44cb,
-  0x0a24, 0x0a24, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e3, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1ac6, 0xa6da, 0x9efa,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23c7, 0x1b67, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1224, 0x08e2,
-  0x0020, 0x0081, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x1244, 0x09e3, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1224, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x450c, 0x44cb,
-  0x1244, 0x0a03, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0x9efa, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb75b, 0xb73b,
-  0xb73b, 0x9efa, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0xa6d9, 0x2b28, 0x1ac6, 0x1ae6, 0x1ae6, 0x1ac6, 0x1aa6, 0x1aa6,
-  0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x1ac6, 0x2387, 0x2408, 0x2428, 0x2408, 0x1b06, 0x0a03, 0x1b06,
-  0x1b46, 0x22e7, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1244, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2387, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x44ec, 0x44cb,
-  0x0a24, 0x0a24, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e3, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1ac6, 0xa6da, 0x9efa,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23c7, 0x1b67, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1224, 0x08e2,
-  0x0020, 0x0081, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x1244, 0x09e3, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1224, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x450c, 0x44cb,
-  0x1244, 0x0a03, 0x3ceb, 0x4d8d, 0x452c, 0x12a5, 0x2c29, 0x0a44,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1284, 0x452c, 0x4d8d,
-  0x2c29, 0x08e1, 0x3469, 0x4d6d, 0x3449, 0x08e1, 0x2be8, 0x0a64,
-  0x9efa, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb73b, 0xb75b, 0xb73b,
-  0xb73b, 0x9efa, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0xa6d9, 0x2b28, 0x1ac6, 0x1ae6, 0x1ae6, 0x1ac6, 0x1aa6, 0x1aa6,
-  0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x1ac6, 0x2387, 0x2408, 0x2428, 0x2408, 0x1b06, 0x0a03, 0x1b06,
-  0x1b46, 0x22e7, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x1aa6, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c69,
-  0x2c69, 0x2c28, 0x2c08, 0x2428, 0x3429, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x92a5,
-  0x1a84, 0x12a5, 0x12a5, 0x12a5, 0x1264, 0x3923, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x1081, 0x1a44,
-  0x2c69, 0x3cab, 0x44cb, 0x3cab, 0x2c69, 0x0a24, 0x10e3, 0xb71b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9a04, 0x8a24, 0x11e3, 0x2c69,
-  0x3cab, 0x0902, 0x0061, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x19e3, 0x08e1, 0x3c2a,
-  0x08e2, 0x0162, 0x0060, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b47, 0x1244, 0x08e2,
-  0x0020, 0x0060, 0x1244, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a64, 0x2387, 0x23c7, 0x23c7, 0x2387, 0x12a5, 0x44ec, 0x44cb,
-  0x0a24, 0x0a24, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a43,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c28, 0x2c29, 0x2c08, 0x1b26, 0x0a03, 0x1b26,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e3, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1ac6, 0xa6da, 0x9efa,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23c7, 0x1b67, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x23a7, 0x0a64, 0x0a64, 0x1284, 0x0a64, 0x0a44, 0x0081, 0x0060,
-  0x0a24, 0x0a44, 0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96da,
-  0x2c69, 0x23a7, 0x2c29, 0x3c8a, 0x2c08, 0x2be8, 0x2be8, 0x2387,
-  0x2c49, 0x2c69, 0x23a7, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x0a44, 0x08e3, 0x08c2, 0x08e2, 0x0a44, 0x2c49,
-  0x34aa, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x1a86, 0x3bb1, 0x3bb1, 0x3bb1, 0x1a86, 0x1264,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2be9, 0x75b5, 0x29ec, 0x08c4, 0x29ec, 0x7595, 0x1265,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x2c89, 0x33c9, 0x4c11, 0x18e4, 0x2b2e, 0x08e4, 0x3bd1, 0x12c6,
-  0x2428, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0x9ac5, 0xa265, 0x9a44, 0x2a65, 0x1a03, 0x2285, 0x3c29,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a44, 0x9a64, 0xb348, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2081, 0x2060, 0x28a1, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e2, 0xa679, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1aa6, 0x8637, 0x9eda,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2307, 0xb73b,
-  0x0a03, 0x0a44, 0x2367, 0x23a7, 0x23c7, 0x1b67, 0x08e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a23, 0x0a03, 0x0a64, 0x1b67, 0x12a5, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x23a7, 0x0a64, 0x0a64, 0x1284, 0x0a64, 0x0a44, 0x0081, 0x0060,
-  0x0a24, 0x0a44, 0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96da,
-  0x2c69, 0x23a7, 0x2c29, 0x3c8a, 0x2c08, 0x2be8, 0x2be8, 0x2387,
-  0x2c49, 0x2c69, 0x23a7, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x0a44, 0x08e3, 0x08c2, 0x08e2, 0x0a44, 0x2c49,
-  0x34aa, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x1a86, 0x3bb1, 0x3bb1, 0x3bb1, 0x1a86, 0x1264,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2be9, 0x75b5, 0x29ec, 0x08c4, 0x29ec, 0x7595, 0x1265,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x2c89, 0x33c9, 0x4c11, 0x18e4, 0x2b2e, 0x08e4, 0x3bd1, 0x12c6,
-  0x2428, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0x9ac5, 0xa265, 0x9a44, 0x2a65, 0x1a03, 0x2285, 0x3c29,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a44, 0x9a64, 0xb348, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2081, 0x2060, 0x28a1, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e3, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1ac6, 0xa6da, 0x9efa,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a03, 0x0a44, 0x2367, 0x23a7, 0x23c7, 0x1b67, 0x08e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a23, 0x0a03, 0x0a64, 0x1b67, 0x12a5, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a44, 0x23a7, 0x2c8a, 0x34aa, 0x34aa, 0x23c8, 0x1284, 0x1b67,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x23c8, 0x2c49, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0xa6d9, 0x1ac6, 0x0a44, 0x0a64, 0x0a64, 0x0a44, 0x0a23, 0x0a23,
-  0x1aa6, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x1ac6, 0x2387, 0x2c69, 0x2c69, 0x2c69, 0x23a7, 0x1284, 0x1b46,
-  0x1b46, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96b9, 0x96d9,
-  0x2387, 0x23c8, 0x2c69, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a43, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c69, 0x3c49, 0x3c08, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0xa285,
-  0x9a85, 0x9aa5, 0x9aa5, 0x9aa5, 0x9a85, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x1080,
-  0x1a24, 0x2264, 0x2284, 0x1a64, 0x2a64, 0x8204, 0x18c3, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xab48, 0x1a64,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c69, 0x1a44, 0x10e3, 0xb71b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a23, 0x1a44, 0x346a,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3ccb, 0x2c49, 0x1aa6, 0xb75b,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b46, 0x00e2, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a64, 0x2367, 0x23c7, 0x23c7, 0x23c7, 0x2387, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a44, 0x23a7, 0x2c8a, 0x34aa, 0x34aa, 0x23c8, 0x1284, 0x1b67,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x23c8, 0x2c49, 0x2c69, 0x2c69, 0x2c08, 0x1b26, 0x0a64,
-  0x1264, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c8a, 0x2c29, 0x1284, 0x1284, 0x1264, 0x08e1, 0x00a1, 0x0a03,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c69, 0x12c5, 0x23a7, 0x2c69, 0x2c69, 0x2c49, 0x1b46, 0x08e1,
-  0x2c49, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c89, 0x2387, 0x2c09, 0x3ccb, 0x2c49, 0x2c49, 0x2be8, 0x0a03,
-  0x1b67, 0x1286, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c69, 0x1284, 0x00e1, 0x08c2, 0x08c1, 0x00a1, 0x00a1, 0x00a1,
-  0x1265, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3449, 0x3c08, 0x3408, 0x2c08, 0x1b87, 0x1b87, 0x2c29,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa285, 0xa2c5, 0x3ba7, 0x3c69, 0x448a, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa244, 0x9a64, 0x9a85, 0xbb69, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2881, 0x2060,
-  0x1040, 0x1040, 0x1040, 0x1040, 0x4944, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9244,
-  0x1223, 0x0a44, 0x0a44, 0x0a44, 0x1224, 0x3944, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x1a44, 0x1a84,
-  0x3469, 0x3ccb, 0x44cb, 0x3ccb, 0x2c49, 0x1ac6, 0x9657, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b67, 0x0a44, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2b28, 0xb73b,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2367, 0x0902, 0x3c0a,
-  0x0902, 0x1285, 0x0080, 0x09e3, 0x1ae6, 0x3ceb, 0x2306, 0xa6d9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x1b67, 0x1244, 0x08e2,
-  0x0040, 0x0081, 0x1264, 0x450c, 0x452c, 0x452c, 0x2c49, 0x1aa6,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x2387, 0x1285, 0x44ec, 0x44cb,
-  0x0a24, 0x0a03, 0x44ec, 0x4d8d, 0x454c, 0x1ae5, 0x2c29, 0x0a44,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9224, 0x9224, 0x9224, 0x9a44, 0x9224, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a24,
-  0x1a64, 0x2284, 0x2284, 0x2284, 0x1a23, 0x10e2, 0xa679, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b46, 0x1284,
-  0x2c69, 0x3cab, 0x3ccb, 0x3ccb, 0x2c49, 0x1aa6, 0x8637, 0x9eda,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x2387, 0x1264, 0x2c69,
-  0x3cab, 0x0922, 0x0081, 0x08e2, 0x3cab, 0x2c69, 0x2307, 0xb73b,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23c7, 0x1b67, 0x0902, 0x3c2a,
-  0x0922, 0x1265, 0x0081, 0x0a03, 0x1ae6, 0x3ceb, 0x2307, 0xa6d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x09e3, 0x0081,
-  0x0000, 0x0060, 0x0a04, 0x44ec, 0x452c, 0x4d6d, 0x2c49, 0x1ac6,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b67, 0x1b67, 0x1b67, 0x12e5, 0x08e2, 0xa699, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23c7, 0x2367,
-  0x1284, 0x1285, 0x12a5, 0x1284, 0x1a86, 0xa6da, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x2367, 0x12a5,
-  0x2c49, 0x3cab, 0x3cab, 0x3cab, 0x2c69, 0x2328, 0x8616, 0x9eda,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x2387, 0x1284, 0x2c49,
-  0x450c, 0x08e2, 0x0081, 0x08e2, 0x44ec, 0x2c49, 0x2307, 0xaf3b,
-  0x0a64, 0x23a7, 0x2c49, 0x2c69, 0x2c49, 0x1b46, 0x0a03, 0x1b26,
-  0x1b66, 0x1aa5, 0xa6d9, 0x9f1b, 0x96d9, 0x96d9, 0x96d9, 0x96da,
-  0x23a7, 0x1b67, 0x1284, 0x1284, 0x1264, 0x08c1, 0x0081, 0x00c1,
-  0x0a44, 0x0a44, 0x2307, 0xa6d9, 0x9efa, 0x96b9, 0x96b9, 0x96d9,
-  0x2c49, 0x12a5, 0x2387, 0x2c69, 0x2c69, 0x2c49, 0x2387, 0x1b47,
-  0x2c49, 0x2c89, 0x2387, 0x2b28, 0xa6d9, 0x9efa, 0x96b9, 0x96d9,
-  0x2c89, 0x2387, 0x2c49, 0x3ceb, 0x2c49, 0x2c49, 0x23e8, 0x12a5,
-  0x2c69, 0x450c, 0x2c29, 0x1b06, 0x22e7, 0xaf3b, 0x9efa, 0x96b9,
-  0x2c69, 0x12a5, 0x1a85, 0x08a1, 0x08a2, 0x0061, 0x1103, 0x0a23,
-  0x1b67, 0x1285, 0x0081, 0x08c2, 0x10c2, 0xb71b, 0x9efa, 0x96b9,
-  0x2c89, 0x2c09, 0x6d73, 0x08c3, 0x2ace, 0x08a3, 0x6cf2, 0x1aa5,
-  0x1285, 0x336f, 0x10c3, 0x64b1, 0x1944, 0xa699, 0x9f1a, 0x96d9,
-  0x348a, 0x3c69, 0x3ba8, 0x1081, 0x00a2, 0x0081, 0x1aa6, 0x2c69,
-  0x2c49, 0x1285, 0x00a1, 0x12a5, 0x2347, 0x5a48, 0xaeb9, 0x9efa,
-  0x3c69, 0xa2e5, 0xa264, 0xa264, 0x3b46, 0x3408, 0x3c69, 0x3c89,
-  0x3c89, 0x3c49, 0x3c28, 0x3c49, 0x4449, 0x9244, 0x5a08, 0xb71b,
-  0x3387, 0xa285, 0x6184, 0xa245, 0x9a64, 0x9aa5, 0xbb89, 0x9a85,
-  0x9a64, 0x9a65, 0x9a85, 0x9a85, 0x9a65, 0x5143, 0x18c3, 0xb71b,
-  0x1a44, 0x9a64, 0xaa65, 0x5964, 0x2061, 0x2060, 0x2081, 0x2060,
-  0x2060, 0x2060, 0x2060, 0x2061, 0x5964, 0x89e4, 0x18c2, 0xaf1b,
-  0x0a24, 0x2223, 0x9a44, 0xa224, 0x9204, 0x9a44, 0xb348, 0x9a64,
-  0x9a44, 0x9a44, 0x9a24, 0x9a04, 0x9204, 0x4103, 0x2145, 0xaf1b,
-  0x1b87, 0x0a44, 0x10a1, 0x1081, 0x10a1, 0x1a24, 0x2264, 0x1a44,
-  0x1a44, 0x1a44, 0x1a24, 0x10a1, 0x1040, 0x2124, 0xa699, 0x9efa,
-  0x2387, 0x2387, 0x1b67, 0x1b67, 0x1b67, 0x1b87, 0x1b87, 0x1b87,
-  0x1b87, 0x1b87, 0x1ba7, 0x1ae6, 0x08a2, 0xa679, 0x9f1a, 0x96d9,
-  0x0a64, 0x2367, 0x23c8, 0x23c7, 0x23c7, 0x23a7, 0x23a7, 0x23a7,
-  0x23a7, 0x23c7, 0x2387, 0x0a03, 0x1945, 0xaf1b, 0x9efa, 0x96b9,
-  0x0a23, 0x0a44, 0x1b67, 0x23a7, 0x23a7, 0x23a7, 0x23a7, 0x23a7,
-  0x2387, 0x1b67, 0x0a23, 0x08e2, 0x9617, 0x9efa, 0x96d9, 0x96d9,
-  0x0a23, 0x0a03, 0x0a44, 0x2387, 0x23a7, 0x23a7, 0x23a7, 0x2387,
-  0x0a64, 0x0a24, 0x0a03, 0x09e3, 0x22e7, 0x8e78, 0x96da, 0x96d9
-};
-
-const Animation frogAnimation = {
-  .name = "Frog",
-  .frameCount = 58,
-  .width = 16,
-  .height = 16,
-  .frameDurations = frogDurations,
-  .animationFrames = frogFrames
-};
-#endif // ANIMATION_FROG_H
@@ -1,1846 +0,0 @@
-// game_over.h - Auto-generated from game_over.json
-#ifndef ANIMATION_GAME_OVER_H
-#define ANIMATION_GAME_OVER_H
-
-#include "animation_types.h"
-
-// Frame Durations for game_over (in 100ms units)
-static const uint8_t PROGMEM game_overDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for game_over
-static const uint16_t PROGMEM game_overFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x0000, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x2000, 0x1800, 0x2000, 0x0000, 0x1800, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x0000, 0x0000, 0x2000, 0x1800, 0x2000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x0800, 0x0000, 0x1800, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x2000, 0x2000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x1800, 0x0800, 0x0000, 0x2000, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x2800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x2000, 0x2800, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2800, 0x2000, 0x2800,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x2000, 0x0000, 0x2800, 0x2800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x0000, 0x0000, 0x2800, 0x1000, 0x2000,
-  0x0800, 0x2800, 0x2800, 0x2800, 0x0800, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x0000, 0x0000, 0x0000, 0x2800, 0x2800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x2800, 0x0000, 0x2800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x0000, 0x2800, 0x1000, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x2800, 0x0000, 0x2800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x0800, 0x0000, 0x3000, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0800, 0x2800, 0x0800,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x3000, 0x0800, 0x0000, 0x0000, 0x3000, 0x1000, 0x2800,
-  0x0800, 0x3000, 0x3000, 0x3000, 0x0800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000,
-  0x0800, 0x3000, 0x1000, 0x3000, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x2800, 0x0800, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x3000, 0x2800, 0x0800, 0x3000, 0x3000, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x0000, 0x3000, 0x1000, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x2800, 0x0800, 0x3000, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x3000, 0x0800, 0x0000, 0x3800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0800, 0x2800, 0x0800,
-  0x0000, 0x3000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3000, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3800, 0x0800, 0x0000, 0x0000, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3800, 0x3800, 0x3800, 0x0800, 0x3800, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x0000, 0x0000, 0x0000, 0x3800, 0x3800, 0x3800,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3800, 0x3000, 0x0800, 0x3800, 0x3800, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x1000, 0x0000, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x3000, 0x0800, 0x3800, 0x4000, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3800, 0x1000, 0x0000, 0x4000, 0x3800, 0x0800, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x3000, 0x0800, 0x3000, 0x1000, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x3800, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0000, 0x3800, 0x1800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x4000, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x3800, 0x0000, 0x0000, 0x0000, 0x4000, 0x4000, 0x4000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x4000, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x3800, 0x0800, 0x3800, 0x4000, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x3800, 0x0800, 0x4000, 0x4800, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x3800, 0x0800, 0x3800, 0x1000, 0x3000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x1000, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0000, 0x4000, 0x1800, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x4800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x4000, 0x0000, 0x0000, 0x0000, 0x4800, 0x4800, 0x4800,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x0800, 0x4000, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4800, 0x3800, 0x0800, 0x4800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4800, 0x4800, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x1000, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0800, 0x4000, 0x1800, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x4800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x4000, 0x0000, 0x0000, 0x0800, 0x4800, 0x4800, 0x4800,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000,
-  0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x0800, 0x4000, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x1000, 0x4000, 0x1000, 0x4000,
-  0x1000, 0x4000, 0x1000, 0x0800, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4800, 0x4000, 0x0800, 0x4800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4800, 0x4800, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0800, 0x5000, 0x5000, 0x4800, 0x0000, 0x0800, 0x4000, 0x0800,
-  0x0800, 0x4800, 0x1800, 0x4800, 0x1000, 0x5000, 0x4800, 0x0000,
-  0x0800, 0x5000, 0x1000, 0x0000, 0x0800, 0x4800, 0x2000, 0x4800,
-  0x1000, 0x5800, 0x5800, 0x5800, 0x1000, 0x5000, 0x1800, 0x0000,
-  0x0800, 0x5000, 0x0800, 0x0000, 0x0800, 0x5800, 0x5800, 0x5800,
-  0x1000, 0x5000, 0x1800, 0x5000, 0x1000, 0x5800, 0x4800, 0x0000,
-  0x0800, 0x5000, 0x1800, 0x4800, 0x1000, 0x5000, 0x1800, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000, 0x1800, 0x0000,
-  0x0000, 0x5000, 0x5000, 0x5000, 0x1000, 0x4800, 0x1000, 0x4800,
-  0x1000, 0x4800, 0x1000, 0x4800, 0x1000, 0x5000, 0x4800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,
-  0x0800, 0x5000, 0x5000, 0x5000, 0x1000, 0x4800, 0x1000, 0x4800,
-  0x1000, 0x5000, 0x4800, 0x0800, 0x5000, 0x5000, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1800, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x0800, 0x5000, 0x2000, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5800, 0x4800, 0x0800, 0x5800, 0x5800, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1800, 0x5000, 0x1000, 0x4800, 0x1800, 0x4800,
-  0x1000, 0x5000, 0x1000, 0x0800, 0x5800, 0x5800, 0x1000, 0x0000,
-  0x0000, 0x5000, 0x5000, 0x5000, 0x0000, 0x0800, 0x4800, 0x0800,
-  0x0000, 0x5000, 0x4800, 0x0800, 0x4800, 0x1000, 0x4000, 0x0800,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x5800, 0x0800, 0x0800, 0x5000, 0x0800,
-  0x0800, 0x5800, 0x1800, 0x5000, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1000, 0x0800, 0x0800, 0x5800, 0x2000, 0x5800,
-  0x1000, 0x6000, 0x6000, 0x6800, 0x1000, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x0800, 0x0000, 0x0800, 0x6800, 0x6000, 0x6800,
-  0x1000, 0x5800, 0x1800, 0x5800, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1800, 0x5800, 0x1000, 0x6000, 0x1800, 0x6000,
-  0x1000, 0x5800, 0x1000, 0x5800, 0x1000, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x6000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x5800, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x6000, 0x5800, 0x1000, 0x5800, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x5800, 0x1800, 0x6000, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x1800, 0x0800, 0x6000, 0x2000, 0x6000, 0x0800,
-  0x0800, 0x5800, 0x1000, 0x5800, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x5000, 0x1000, 0x6000, 0x6800, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1800, 0x6000, 0x1000, 0x5000, 0x1800, 0x5000,
-  0x1000, 0x6000, 0x1800, 0x0800, 0x6800, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x6000, 0x0800, 0x0800, 0x5000, 0x0800,
-  0x0800, 0x6000, 0x5800, 0x1000, 0x5000, 0x1800, 0x4800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x6800, 0x6800, 0x6000, 0x0800, 0x1000, 0x5800, 0x1000,
-  0x0800, 0x6000, 0x2000, 0x6000, 0x1000, 0x6800, 0x6000, 0x0800,
-  0x0800, 0x6800, 0x1000, 0x0800, 0x0800, 0x6000, 0x2800, 0x6000,
-  0x1000, 0x7000, 0x7000, 0x7000, 0x1000, 0x6800, 0x2000, 0x0000,
-  0x0800, 0x6800, 0x0800, 0x0000, 0x0800, 0x7000, 0x7000, 0x7000,
-  0x1000, 0x6800, 0x2000, 0x6800, 0x1000, 0x7000, 0x6000, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6000, 0x1000, 0x6800, 0x2000, 0x6800,
-  0x1800, 0x6800, 0x1000, 0x6800, 0x1800, 0x6800, 0x2000, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x1000, 0x6000, 0x1000, 0x6800, 0x6000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x1000, 0x6000, 0x1000, 0x6000,
-  0x1000, 0x6800, 0x6000, 0x1000, 0x6800, 0x6800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1800, 0x6800, 0x1800, 0x6800,
-  0x1800, 0x6800, 0x1800, 0x0800, 0x6800, 0x2800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x1000, 0x6800, 0x1800, 0x6800, 0x1000, 0x6800,
-  0x1000, 0x7000, 0x6000, 0x1000, 0x7000, 0x7800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1000, 0x6000, 0x2000, 0x6000,
-  0x1000, 0x6800, 0x1800, 0x0800, 0x7000, 0x7000, 0x1800, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x0800, 0x1000, 0x5800, 0x1000,
-  0x0800, 0x6800, 0x6000, 0x1000, 0x6000, 0x1800, 0x5000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x6800, 0x0800, 0x1000, 0x6000, 0x1000,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1000, 0x7800, 0x6800, 0x0800,
-  0x0800, 0x7800, 0x1800, 0x0800, 0x0800, 0x6800, 0x2800, 0x6800,
-  0x1800, 0x8000, 0x8000, 0x8000, 0x1800, 0x7800, 0x2000, 0x0000,
-  0x0800, 0x7000, 0x0800, 0x0800, 0x0800, 0x8000, 0x7800, 0x8000,
-  0x1800, 0x7000, 0x2000, 0x7000, 0x1800, 0x8000, 0x6800, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x6800, 0x1800, 0x7000, 0x2000, 0x7000,
-  0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7800, 0x2000, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7800, 0x1000, 0x6800, 0x1000, 0x6800,
-  0x1800, 0x6800, 0x1800, 0x6800, 0x1000, 0x7000, 0x6800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7000, 0x1000, 0x6800, 0x1800, 0x6800,
-  0x1000, 0x7800, 0x6800, 0x1000, 0x7000, 0x7800, 0x7000, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x7800, 0x2000, 0x0800, 0x7800, 0x3000, 0x7800, 0x0800,
-  0x0800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x8000, 0x6800, 0x1000, 0x8000, 0x8800, 0x7000, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x7000, 0x1800, 0x6800, 0x2000, 0x6800,
-  0x1800, 0x7800, 0x2000, 0x0800, 0x8000, 0x8000, 0x1800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7800, 0x0800, 0x1000, 0x6000, 0x1000,
-  0x0800, 0x7800, 0x6800, 0x1000, 0x6800, 0x2000, 0x6000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x7800, 0x0800, 0x1000, 0x7000, 0x1000,
-  0x0800, 0x7800, 0x2000, 0x7800, 0x1800, 0x8000, 0x7800, 0x0800,
-  0x0800, 0x8000, 0x1800, 0x0800, 0x0800, 0x7800, 0x3000, 0x7800,
-  0x1800, 0x8800, 0x8800, 0x8800, 0x1800, 0x8000, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x0800, 0x0800, 0x0800, 0x9000, 0x8800, 0x8800,
-  0x1800, 0x8000, 0x2800, 0x8000, 0x1800, 0x8800, 0x7800, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x7800, 0x1800, 0x8000, 0x2800, 0x8000,
-  0x1800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x8000, 0x7800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x8000, 0x7800, 0x1000, 0x8000, 0x8800, 0x8000, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8000, 0x2000, 0x0800, 0x8000, 0x3000, 0x8000, 0x1000,
-  0x0800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8800, 0x7800, 0x1000, 0x8800, 0x9000, 0x8000, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x8000, 0x1800, 0x7000, 0x2000, 0x7000,
-  0x1800, 0x8000, 0x2000, 0x0800, 0x9000, 0x8800, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x0800, 0x1000, 0x7000, 0x1000,
-  0x0800, 0x8000, 0x7800, 0x1000, 0x7800, 0x2000, 0x6800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x1000, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x8800, 0x0800, 0x1800, 0x8000, 0x1800,
-  0x0800, 0x8800, 0x2800, 0x8800, 0x1800, 0x9000, 0x8800, 0x0800,
-  0x1000, 0x9800, 0x2000, 0x0800, 0x0800, 0x8800, 0x3800, 0x8800,
-  0x1800, 0xa000, 0xa000, 0xa000, 0x1800, 0x9800, 0x2800, 0x0000,
-  0x1000, 0x9000, 0x0800, 0x0800, 0x1000, 0xa000, 0xa000, 0xa000,
-  0x1800, 0x9000, 0x2800, 0x9000, 0x1800, 0xa000, 0x8800, 0x0800,
-  0x1000, 0x9000, 0x2800, 0x8800, 0x2000, 0x9000, 0x3000, 0x9000,
-  0x2000, 0x9000, 0x2000, 0x9000, 0x2000, 0x9800, 0x2800, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9800, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8800, 0x1800, 0x8800, 0x1800, 0x9000, 0x8800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9000, 0x1800, 0x8800, 0x1800, 0x8800,
-  0x1800, 0x9000, 0x8800, 0x1800, 0x9000, 0x9800, 0x9000, 0x0800,
-  0x1000, 0x9000, 0x3000, 0x9000, 0x2000, 0x9000, 0x2000, 0x9000,
-  0x2000, 0x9800, 0x2800, 0x1000, 0x9800, 0x3800, 0x9800, 0x1000,
-  0x1000, 0x9000, 0x1800, 0x9000, 0x2000, 0x9000, 0x2000, 0x9000,
-  0x2000, 0xa000, 0x8800, 0x1800, 0xa000, 0xa800, 0x9000, 0x0800,
-  0x1000, 0x9000, 0x3000, 0x9000, 0x2000, 0x8800, 0x2800, 0x8800,
-  0x2000, 0x9800, 0x2800, 0x0800, 0xa800, 0xa000, 0x2000, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9800, 0x0800, 0x1000, 0x8000, 0x1800,
-  0x0800, 0x9800, 0x8800, 0x1800, 0x8800, 0x2800, 0x7800, 0x1000,
-  0x0000, 0x0800, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa000, 0x0800, 0x2800, 0x9000, 0x2800,
-  0x1000, 0xa000, 0x4000, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x3000, 0x1800, 0x1000, 0xa000, 0x5000, 0x9800,
-  0x2000, 0xb800, 0xb000, 0xb800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0x2000, 0x1000, 0x1000, 0xb800, 0xb000, 0xb800,
-  0x2000, 0xa000, 0x3000, 0xa000, 0x2000, 0xb000, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x4000, 0x9800, 0x2000, 0xa800, 0x4000, 0xa800,
-  0x2000, 0xa000, 0x2000, 0xa000, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x3000, 0x9800,
-  0x2000, 0x9800, 0x2000, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x2000, 0x0000, 0x1800, 0x2000, 0x1800, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x2000, 0x9800,
-  0x2000, 0xa800, 0xa000, 0x1800, 0xa800, 0xb000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4000, 0xa800, 0x2000, 0xa800, 0x3000, 0xa800,
-  0x2000, 0xa800, 0x3800, 0x1000, 0xa800, 0x5000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x3000, 0xa000, 0x2000, 0xa800, 0x3000, 0xa800,
-  0x2000, 0xb000, 0x9800, 0x1800, 0xb800, 0xc000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4000, 0xa800, 0x2000, 0x9800, 0x4000, 0x9800,
-  0x2000, 0xb000, 0x3800, 0x1000, 0xb800, 0xb800, 0x3800, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x0800, 0x1800, 0x9000, 0x1800,
-  0x0800, 0xa800, 0xa000, 0x1800, 0x9800, 0x3800, 0x9000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2800, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa000, 0x1000, 0x2800, 0x9800, 0x3000,
-  0x1000, 0xa000, 0x4800, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x3800, 0x2000, 0x1000, 0xa000, 0x5000, 0xa000,
-  0x2000, 0xb800, 0xb800, 0xb800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0x2800, 0x1800, 0x1000, 0xb800, 0xb800, 0xb800,
-  0x2000, 0xa800, 0x4800, 0xa800, 0x2000, 0xb000, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x4800, 0xa000, 0x2000, 0xa800, 0x4800, 0xa800,
-  0x2000, 0xa800, 0x3800, 0xa800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x2000, 0x9800,
-  0x2000, 0x9800, 0x3800, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x0800, 0x1800, 0x2000, 0x1000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x0800, 0x2000, 0x1000, 0x2000, 0x2800, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x2000, 0x9800,
-  0x2000, 0xa800, 0x9800, 0x1800, 0xa800, 0xb000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4000, 0xa800, 0x2000, 0xa800, 0x3800, 0xa800,
-  0x2000, 0xa800, 0x3000, 0x1000, 0xa800, 0x5000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x3000, 0xa000, 0x2000, 0xa800, 0x3800, 0xa800,
-  0x2000, 0xb000, 0x9800, 0x1800, 0xb800, 0xc000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4800, 0xa800, 0x2000, 0x9800, 0x4800, 0x9800,
-  0x2000, 0xb000, 0x4000, 0x1000, 0xb800, 0xb800, 0x3800, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x1000, 0x2800, 0x9800, 0x2800,
-  0x1000, 0xa800, 0xa000, 0x1800, 0x9800, 0x4000, 0x9000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x0000, 0x2000, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0800, 0x1000, 0x0800, 0x0000, 0x0000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x1800, 0x0000, 0x1800, 0x2000, 0x0000,
-  0x1000, 0xb000, 0xb800, 0xa800, 0x1000, 0x2800, 0x9800, 0x2800,
-  0x1000, 0xa800, 0x4000, 0xa000, 0x2000, 0xb000, 0xa800, 0x1000,
-  0x1000, 0xb000, 0x3800, 0x1800, 0x1000, 0xa800, 0x5000, 0xa800,
-  0x2000, 0xc000, 0xc000, 0xc000, 0x2000, 0xb800, 0x4000, 0x0000,
-  0x1000, 0xb000, 0x2800, 0x1800, 0x1000, 0xc000, 0xc000, 0xc000,
-  0x2000, 0xb000, 0x4800, 0xb000, 0x2000, 0xc000, 0xa800, 0x0800,
-  0x1000, 0xb000, 0x4800, 0xa800, 0x2000, 0xb000, 0x4000, 0xb000,
-  0x2000, 0xb000, 0x3800, 0xb000, 0x2000, 0xb800, 0x4800, 0x0000,
-  0x1000, 0xb000, 0xc000, 0xb000, 0x2000, 0xa000, 0x2000, 0xa000,
-  0x2000, 0xa000, 0x3800, 0xa000, 0x2000, 0xb000, 0xa800, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x1800, 0x1000, 0x2000, 0x1000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x1800, 0x2000, 0x1000, 0x2000, 0x2000, 0x1800, 0x0000,
-  0x1000, 0xb000, 0xc000, 0xb000, 0x2000, 0xa000, 0x2000, 0xa000,
-  0x2000, 0xb000, 0xa800, 0x1800, 0xb000, 0xb800, 0xb000, 0x1000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xb000, 0x3800, 0xb000,
-  0x2000, 0xb800, 0x4000, 0x1000, 0xb800, 0x5000, 0xb800, 0x1000,
-  0x1000, 0xb000, 0x3000, 0xb000, 0x2000, 0xb000, 0x3800, 0xb000,
-  0x2000, 0xc000, 0xa800, 0x1800, 0xc000, 0xc800, 0xb000, 0x1000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xa000, 0x4000, 0xa000,
-  0x2000, 0xb800, 0x4000, 0x1000, 0xc000, 0xc000, 0x3800, 0x0000,
-  0x1000, 0xb000, 0xb800, 0xb000, 0x1000, 0x2800, 0xa000, 0x2800,
-  0x1000, 0xb000, 0xa800, 0x2000, 0xa000, 0x4000, 0x9000, 0x1000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x1800, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2800, 0x0000, 0x1000, 0x2800, 0x1000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x0000, 0x2800, 0x2800, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xb000, 0x1000, 0x3000, 0xa800, 0x3000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xc000, 0xb000, 0x1000,
-  0x1000, 0xc000, 0x4000, 0x2000, 0x1000, 0xb800, 0x5800, 0xb000,
-  0x2000, 0xd000, 0xd000, 0xd000, 0x2800, 0xc000, 0x4800, 0x0000,
-  0x1000, 0xc000, 0x2800, 0x1800, 0x1000, 0xd000, 0xd000, 0xd000,
-  0x2800, 0xc000, 0x5000, 0xc000, 0x2800, 0xd000, 0xb000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xb000, 0x2800, 0xc000, 0x5000, 0xc000,
-  0x2800, 0xc000, 0x3800, 0xc000, 0x2800, 0xc000, 0x4800, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x2000, 0xb000, 0x3000, 0xb000,
-  0x2800, 0xa800, 0x2800, 0xa800, 0x2000, 0xc000, 0xb000, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x1000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2800, 0x1000, 0x2800, 0x2800, 0x2000, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x2000, 0xb000, 0x2800, 0xb000,
-  0x2000, 0xc000, 0xb800, 0x3000, 0xc000, 0xc800, 0xc000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xc000, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xc000, 0x4000, 0x1800, 0xc000, 0x6000, 0xc000, 0x1800,
-  0x1000, 0xb800, 0x3800, 0xb800, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xd000, 0xb000, 0x2000, 0xd000, 0xd800, 0xc000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xc000, 0x2800, 0xb000, 0x4800, 0xb000,
-  0x2800, 0xc000, 0x4000, 0x1000, 0xd000, 0xd000, 0x4000, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x1000, 0x3000, 0xa800, 0x3000,
-  0x1000, 0xc000, 0xb000, 0x2000, 0xb000, 0x4800, 0xa000, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x1000, 0x2800, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x0000, 0x2000, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x2800, 0x3000, 0x3000, 0x0000, 0x1800, 0x3000, 0x1800,
-  0x0000, 0x2800, 0x1800, 0x2800, 0x0800, 0x3000, 0x3000, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xc000, 0x1000, 0x3800, 0xb800, 0x3800,
-  0x1000, 0xc000, 0x5800, 0xc000, 0x2800, 0xd000, 0xc800, 0x1000,
-  0x1800, 0xd000, 0x4800, 0x2800, 0x1800, 0xc800, 0x6800, 0xc000,
-  0x2800, 0xe000, 0xe000, 0xe000, 0x2800, 0xd800, 0x5000, 0x0000,
-  0x1800, 0xd000, 0x3000, 0x2000, 0x1800, 0xe000, 0xd800, 0xe000,
-  0x2800, 0xd000, 0x5800, 0xd000, 0x2800, 0xe000, 0xc000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xc000, 0x2800, 0xd000, 0x5800, 0xd000,
-  0x2800, 0xd000, 0x4000, 0xd000, 0x2800, 0xd800, 0x5000, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xb800, 0x2800, 0xb800, 0x2800, 0xd000, 0xc800, 0x1000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x1800, 0x2800, 0x1000, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x3000, 0x1800, 0x3000, 0x3000, 0x2800, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x2800, 0xb800, 0x2800, 0xb800,
-  0x2800, 0xd000, 0xc800, 0x3000, 0xd000, 0xd800, 0xd000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xd000, 0x2800, 0xd000, 0x3800, 0xd000,
-  0x2800, 0xd800, 0x5000, 0x1800, 0xd000, 0x6800, 0xd800, 0x1800,
-  0x1800, 0xc800, 0x4000, 0xc800, 0x2800, 0xd000, 0x3800, 0xd000,
-  0x2800, 0xe000, 0xc000, 0x2000, 0xe000, 0xe800, 0xd000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xd000, 0x2800, 0xc000, 0x5800, 0xc000,
-  0x2800, 0xd800, 0x5000, 0x1000, 0xe800, 0xe000, 0x4800, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x1000, 0x3800, 0xc000, 0x3800,
-  0x1000, 0xd000, 0xc000, 0x2000, 0xc000, 0x5000, 0xb000, 0x1000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0000, 0x1800, 0x3000, 0x1800,
-  0x0000, 0x2800, 0x3000, 0x0800, 0x2800, 0x1800, 0x2800, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1000, 0x0000, 0x1800, 0x2000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x3020, 0x3820, 0x3820, 0x0000, 0x1800, 0x3820, 0x1800,
-  0x0000, 0x3020, 0x2000, 0x3020, 0x0800, 0x3020, 0x3820, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xc945, 0x1020, 0x4041, 0xc124, 0x4041,
-  0x1020, 0xc945, 0x6061, 0xc145, 0x2841, 0xd165, 0xc945, 0x1020,
-  0x1820, 0xd165, 0x5041, 0x3020, 0x1820, 0xc945, 0x7082, 0xc145,
-  0x2841, 0xe186, 0xe165, 0xe186, 0x2841, 0xd965, 0x5861, 0x0000,
-  0x1820, 0xd165, 0x3020, 0x2800, 0x1820, 0xe186, 0xe165, 0xe165,
-  0x2841, 0xd145, 0x6061, 0xd145, 0x2841, 0xe165, 0xc945, 0x1020,
-  0x1820, 0xd165, 0x6061, 0xc145, 0x2841, 0xd165, 0x6061, 0xd165,
-  0x2841, 0xd145, 0x4841, 0xd145, 0x2841, 0xd965, 0x5861, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x2841, 0xc124, 0x3841, 0xc124,
-  0x2841, 0xc124, 0x4041, 0xc124, 0x3841, 0xd165, 0xc945, 0x1020,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0800, 0x2820, 0x0800, 0x2820,
-  0x0800, 0x3020, 0x2000, 0x3020, 0x2000, 0x3820, 0x3020, 0x0000,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0800, 0x3020, 0x0800, 0x3020,
-  0x0800, 0x3020, 0x3820, 0x2000, 0x3820, 0x3820, 0x3020, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x2841, 0xc145, 0x2841, 0xc145,
-  0x2841, 0xd165, 0xc945, 0x3841, 0xd165, 0xd965, 0xd165, 0x1020,
-  0x1820, 0xd165, 0x6061, 0xd165, 0x2841, 0xd145, 0x3841, 0xd145,
-  0x2841, 0xd965, 0x5861, 0x1820, 0xd965, 0x7082, 0xd965, 0x1820,
-  0x1820, 0xc945, 0x4041, 0xc945, 0x2841, 0xd145, 0x3841, 0xd145,
-  0x2841, 0xe165, 0xc145, 0x2020, 0xe186, 0xe986, 0xd145, 0x1020,
-  0x1820, 0xd165, 0x6061, 0xd165, 0x2841, 0xc145, 0x5861, 0xc145,
-  0x2841, 0xd965, 0x5861, 0x1820, 0xe986, 0xe165, 0x5061, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x1020, 0x4041, 0xc124, 0x4041,
-  0x1020, 0xd165, 0xc945, 0x2041, 0xc145, 0x5861, 0xb124, 0x1020,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0000, 0x1800, 0x3820, 0x1800,
-  0x0000, 0x3020, 0x3020, 0x0800, 0x3020, 0x2000, 0x3020, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x2000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x4800, 0x5000, 0x4800, 0x0800, 0x4000, 0x5000, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x4800, 0x0800, 0x4800, 0x4800, 0x0000,
-  0x0800, 0x7041, 0x8061, 0x7861, 0x1000, 0x4800, 0x7841, 0x5000,
-  0x1000, 0x7041, 0x5800, 0x7041, 0x1000, 0x7041, 0x7861, 0x0800,
-  0x1041, 0xdb4d, 0xeb6d, 0xd30c, 0x1841, 0x7882, 0xdacb, 0x7882,
-  0x1841, 0xd30c, 0x9904, 0xd30c, 0x28a2, 0xdb4d, 0xd30c, 0x1041,
-  0x1061, 0xdb4d, 0x90a2, 0x7041, 0x1841, 0xd30c, 0xa145, 0xd30c,
-  0x28a2, 0xe38e, 0xeb8e, 0xe38e, 0x28a2, 0xdb6d, 0x9104, 0x0800,
-  0x1861, 0xd34d, 0x6841, 0x7020, 0x1841, 0xe3ae, 0xeb8e, 0xe38e,
-  0x28a2, 0xdb4d, 0x9904, 0xdb4d, 0x28a2, 0xe38e, 0xd30c, 0x1041,
-  0x1061, 0xdb4d, 0x9904, 0xd30c, 0x28a2, 0xdb4d, 0x9904, 0xdb4d,
-  0x28c3, 0xd34d, 0x70a2, 0xd34d, 0x30c3, 0xdb6d, 0x9104, 0x0800,
-  0x1041, 0xdb4d, 0xeb8e, 0xdb4d, 0x28a2, 0xcaeb, 0x70a2, 0xcaeb,
-  0x28a2, 0xcaeb, 0x60a2, 0xd30c, 0x58a2, 0xe34d, 0xd30c, 0x1041,
-  0x0800, 0x7041, 0x8041, 0x7041, 0x1000, 0x7041, 0x4800, 0x7041,
-  0x1000, 0x7041, 0x5800, 0x7841, 0x5800, 0x8041, 0x7841, 0x0800,
-  0x0800, 0x7841, 0x8061, 0x7841, 0x1000, 0x6841, 0x1800, 0x6841,
-  0x1000, 0x7841, 0x8061, 0x5800, 0x7841, 0x8061, 0x7841, 0x0800,
-  0x1041, 0xdb4d, 0xeb8e, 0xdb4d, 0x28a2, 0xc2eb, 0x30a2, 0xc2eb,
-  0x28a2, 0xdb4d, 0xdb0c, 0x5882, 0xdb4d, 0xeb6d, 0xdb4d, 0x1041,
-  0x1061, 0xdb4d, 0x9904, 0xdb4d, 0x28c3, 0xd34d, 0x60c3, 0xd34d,
-  0x28c3, 0xdb6d, 0x9104, 0x2061, 0xdb6d, 0xa145, 0xdb6d, 0x1861,
-  0x1861, 0xd34d, 0x70a2, 0xd32c, 0x28c3, 0xd34d, 0x70a2, 0xd34d,
-  0x28a2, 0xe38e, 0xd30c, 0x2082, 0xe38e, 0xf3cf, 0xdb4d, 0x1041,
-  0x1061, 0xdb4d, 0x9904, 0xdb4d, 0x28a2, 0xd30c, 0x9904, 0xd30c,
-  0x28a2, 0xdb6d, 0x8904, 0x1841, 0xe3ae, 0xf38e, 0x88e3, 0x0800,
-  0x1041, 0xdb4d, 0xeb6d, 0xdb4d, 0x1841, 0x7882, 0xdaeb, 0x7882,
-  0x1841, 0xdb4d, 0xd30c, 0x2082, 0xd30c, 0x98e3, 0xc2aa, 0x1041,
-  0x0800, 0x7041, 0x8061, 0x7041, 0x1000, 0x4800, 0x7841, 0x4800,
-  0x1000, 0x7041, 0x7841, 0x1000, 0x7041, 0x5800, 0x7041, 0x0800,
-  0x0000, 0x4800, 0x5000, 0x4800, 0x0800, 0x3800, 0x5000, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x0800, 0x4800, 0x4800, 0x4800, 0x0800,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x1800, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x3020, 0x3820, 0x3820, 0x0000, 0x1800, 0x3820, 0x1800,
-  0x0000, 0x3020, 0x2000, 0x3020, 0x0800, 0x3020, 0x3820, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xc945, 0x1020, 0x4041, 0xc124, 0x4041,
-  0x1020, 0xc945, 0x6061, 0xc145, 0x2841, 0xd165, 0xc945, 0x1020,
-  0x1820, 0xd165, 0x5041, 0x3020, 0x1820, 0xc945, 0x7082, 0xc145,
-  0x2841, 0xe186, 0xe165, 0xe186, 0x2841, 0xd965, 0x5861, 0x0000,
-  0x1820, 0xd165, 0x3020, 0x2800, 0x1820, 0xe186, 0xe165, 0xe165,
-  0x2841, 0xd145, 0x6061, 0xd145, 0x2841, 0xe165, 0xc945, 0x1020,
-  0x1820, 0xd165, 0x6061, 0xc145, 0x2841, 0xd165, 0x6061, 0xd165,
-  0x2841, 0xd145, 0x4041, 0xd145, 0x2841, 0xd965, 0x5861, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x2841, 0xc124, 0x3841, 0xc124,
-  0x2841, 0xb924, 0x2841, 0xb924, 0x2841, 0xd165, 0xc945, 0x1020,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0800, 0x2820, 0x0800, 0x2820,
-  0x0800, 0x3020, 0x1800, 0x3020, 0x1800, 0x3020, 0x3020, 0x0000,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0800, 0x3020, 0x0800, 0x3020,
-  0x0800, 0x3020, 0x3820, 0x1800, 0x3020, 0x3020, 0x2820, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x2841, 0xc145, 0x2841, 0xc145,
-  0x2841, 0xd165, 0xc945, 0x3020, 0xd165, 0xd965, 0xd165, 0x1020,
-  0x1820, 0xd165, 0x5861, 0xd165, 0x2841, 0xd145, 0x3841, 0xd145,
-  0x2841, 0xd965, 0x5861, 0x1820, 0xd965, 0x7082, 0xd965, 0x1820,
-  0x1820, 0xc945, 0x4041, 0xc945, 0x2841, 0xd145, 0x3841, 0xd145,
-  0x2841, 0xe165, 0xc145, 0x2020, 0xe186, 0xe986, 0xd145, 0x1020,
-  0x1820, 0xd165, 0x5861, 0xd165, 0x2841, 0xc145, 0x5861, 0xc145,
-  0x2841, 0xd965, 0x5861, 0x1820, 0xe986, 0xe165, 0x5061, 0x0000,
-  0x1020, 0xd165, 0xd965, 0xd165, 0x1020, 0x4041, 0xc124, 0x4041,
-  0x1020, 0xd165, 0xc945, 0x2041, 0xc145, 0x5861, 0xb124, 0x1020,
-  0x0000, 0x3020, 0x3820, 0x3020, 0x0000, 0x1800, 0x3820, 0x1800,
-  0x0000, 0x3020, 0x3020, 0x0800, 0x3020, 0x2000, 0x3020, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x2800, 0x3000, 0x3000, 0x0000, 0x1800, 0x3000, 0x1800,
-  0x0000, 0x2800, 0x1800, 0x2800, 0x0800, 0x3000, 0x3000, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xc000, 0x1000, 0x3800, 0xb800, 0x3800,
-  0x1000, 0xc000, 0x5800, 0xc000, 0x2800, 0xd000, 0xc800, 0x1000,
-  0x1800, 0xd000, 0x4800, 0x2800, 0x1800, 0xc800, 0x6800, 0xc000,
-  0x2800, 0xe000, 0xe000, 0xe000, 0x2800, 0xd800, 0x5000, 0x0000,
-  0x1800, 0xd000, 0x3000, 0x2000, 0x1800, 0xe000, 0xd800, 0xe000,
-  0x2800, 0xd000, 0x5800, 0xd000, 0x2800, 0xe000, 0xc000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xc000, 0x2800, 0xd000, 0x5800, 0xd000,
-  0x2800, 0xd000, 0x4000, 0xd000, 0x2800, 0xd800, 0x5000, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xb800, 0x2800, 0xb800, 0x2800, 0xd000, 0xc800, 0x1000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x1800, 0x2800, 0x1000, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x3000, 0x1800, 0x3000, 0x3000, 0x2800, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x2800, 0xb800, 0x2800, 0xb800,
-  0x2800, 0xd000, 0xc800, 0x3000, 0xd000, 0xd800, 0xd000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xd000, 0x2800, 0xd000, 0x3800, 0xd000,
-  0x2800, 0xd800, 0x5000, 0x1800, 0xd000, 0x6800, 0xd800, 0x1800,
-  0x1800, 0xc800, 0x4000, 0xc800, 0x2800, 0xd000, 0x3800, 0xd000,
-  0x2800, 0xe000, 0xc000, 0x2000, 0xe000, 0xe800, 0xd000, 0x1000,
-  0x1800, 0xd000, 0x5800, 0xd000, 0x2800, 0xc000, 0x5800, 0xc000,
-  0x2800, 0xd800, 0x5000, 0x1000, 0xe800, 0xe000, 0x4800, 0x0000,
-  0x1000, 0xd000, 0xd800, 0xd000, 0x1000, 0x3800, 0xc000, 0x3800,
-  0x1000, 0xd000, 0xc000, 0x2000, 0xc000, 0x5000, 0xb000, 0x1000,
-  0x0000, 0x2800, 0x3000, 0x2800, 0x0000, 0x1800, 0x3000, 0x1800,
-  0x0000, 0x2800, 0x3000, 0x0800, 0x2800, 0x1800, 0x2800, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2800, 0x0000, 0x1000, 0x2800, 0x1000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x0000, 0x2800, 0x2800, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xb000, 0x1000, 0x3000, 0xa800, 0x3000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xc000, 0xb000, 0x1000,
-  0x1000, 0xc000, 0x4000, 0x2000, 0x1000, 0xb800, 0x5800, 0xb000,
-  0x2000, 0xd000, 0xd000, 0xd000, 0x2800, 0xc000, 0x4800, 0x0000,
-  0x1000, 0xc000, 0x2800, 0x1800, 0x1000, 0xd000, 0xd000, 0xd000,
-  0x2800, 0xc000, 0x5000, 0xc000, 0x2800, 0xd000, 0xb000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xb000, 0x2800, 0xc000, 0x5000, 0xc000,
-  0x2800, 0xc000, 0x3800, 0xc000, 0x2800, 0xc000, 0x4800, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x2000, 0xb000, 0x3000, 0xb000,
-  0x2800, 0xa800, 0x2800, 0xa800, 0x2000, 0xc000, 0xb000, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x1000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2800, 0x1000, 0x2800, 0x2800, 0x2000, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x2000, 0xb000, 0x2800, 0xb000,
-  0x2000, 0xc000, 0xb800, 0x3000, 0xc000, 0xc800, 0xc000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xc000, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xc000, 0x4000, 0x1800, 0xc000, 0x6000, 0xc000, 0x1800,
-  0x1000, 0xb800, 0x3800, 0xb800, 0x2800, 0xc000, 0x3800, 0xc000,
-  0x2800, 0xd000, 0xb000, 0x2000, 0xd000, 0xd800, 0xc000, 0x1000,
-  0x1000, 0xc000, 0x5000, 0xc000, 0x2800, 0xb000, 0x4800, 0xb000,
-  0x2800, 0xc000, 0x4000, 0x1000, 0xd000, 0xd000, 0x4000, 0x0000,
-  0x1000, 0xc000, 0xc800, 0xc000, 0x1000, 0x3000, 0xa800, 0x3000,
-  0x1000, 0xc000, 0xb000, 0x2000, 0xb000, 0x4800, 0xa000, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x1000, 0x2800, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x0000, 0x2000, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0800, 0x1000, 0x0800, 0x0000, 0x0000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x1800, 0x0000, 0x1800, 0x2000, 0x0000,
-  0x1000, 0xb000, 0xb800, 0xa800, 0x1000, 0x2800, 0x9800, 0x2800,
-  0x1000, 0xa800, 0x4000, 0xa000, 0x2000, 0xb000, 0xa800, 0x1000,
-  0x1000, 0xb000, 0x3800, 0x1800, 0x1000, 0xa800, 0x5000, 0xa800,
-  0x2000, 0xc000, 0xc000, 0xc000, 0x2000, 0xb800, 0x4000, 0x0000,
-  0x1000, 0xb000, 0x2800, 0x1800, 0x1000, 0xc000, 0xc000, 0xc000,
-  0x2000, 0xb000, 0x4800, 0xb000, 0x2000, 0xc000, 0xa800, 0x0800,
-  0x1000, 0xb000, 0x4800, 0xa800, 0x2000, 0xb000, 0x4000, 0xb000,
-  0x2000, 0xb000, 0x3800, 0xb000, 0x2000, 0xb800, 0x4800, 0x0000,
-  0x1000, 0xb000, 0xc000, 0xb000, 0x2000, 0xa000, 0x2000, 0xa000,
-  0x2000, 0xa000, 0x3800, 0xa000, 0x2000, 0xb000, 0xa800, 0x1000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x1800, 0x1000, 0x2000, 0x1000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x1800, 0x2000, 0x1000, 0x2000, 0x2000, 0x1800, 0x0000,
-  0x1000, 0xb000, 0xc000, 0xb000, 0x2000, 0xa000, 0x2000, 0xa000,
-  0x2000, 0xb000, 0xa800, 0x1800, 0xb000, 0xb800, 0xb000, 0x1000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xb000, 0x3800, 0xb000,
-  0x2000, 0xb800, 0x4000, 0x1000, 0xb800, 0x5000, 0xb800, 0x1000,
-  0x1000, 0xb000, 0x3000, 0xb000, 0x2000, 0xb000, 0x3800, 0xb000,
-  0x2000, 0xc000, 0xa800, 0x1800, 0xc000, 0xc800, 0xb000, 0x1000,
-  0x1000, 0xb000, 0x4800, 0xb000, 0x2000, 0xa000, 0x4000, 0xa000,
-  0x2000, 0xb800, 0x4000, 0x1000, 0xc000, 0xc000, 0x3800, 0x0000,
-  0x1000, 0xb000, 0xb800, 0xb000, 0x1000, 0x2800, 0xa000, 0x2800,
-  0x1000, 0xb000, 0xa800, 0x2000, 0xa000, 0x4000, 0x9000, 0x1000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x1800, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2800, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x2000, 0x1000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa000, 0x1000, 0x2800, 0x9800, 0x3000,
-  0x1000, 0xa000, 0x4800, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x3800, 0x2000, 0x1000, 0xa000, 0x5000, 0xa000,
-  0x2000, 0xb800, 0xb800, 0xb800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0x2800, 0x1800, 0x1000, 0xb800, 0xb800, 0xb800,
-  0x2000, 0xa800, 0x4800, 0xa800, 0x2000, 0xb000, 0xa000, 0x0800,
-  0x1000, 0xa800, 0x4800, 0xa000, 0x2000, 0xa800, 0x4800, 0xa800,
-  0x2000, 0xa800, 0x3800, 0xa800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x2000, 0x9800,
-  0x2000, 0x9800, 0x3800, 0x9800, 0x2000, 0xa800, 0xa000, 0x0800,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x0800, 0x1800, 0x2000, 0x1000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2800, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x0800, 0x2000, 0x1000, 0x2000, 0x2800, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x2000, 0x9800,
-  0x2000, 0xa800, 0x9800, 0x1800, 0xa800, 0xb000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4000, 0xa800, 0x2000, 0xa800, 0x3800, 0xa800,
-  0x2000, 0xa800, 0x3000, 0x1000, 0xa800, 0x5000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x3000, 0xa000, 0x2000, 0xa800, 0x3800, 0xa800,
-  0x2000, 0xb000, 0x9800, 0x1800, 0xb800, 0xc000, 0xa800, 0x1000,
-  0x1000, 0xa800, 0x4800, 0xa800, 0x2000, 0x9800, 0x4800, 0x9800,
-  0x2000, 0xb000, 0x4000, 0x1000, 0xb800, 0xb800, 0x3800, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x1000, 0x2800, 0x9800, 0x2800,
-  0x1000, 0xa800, 0xa000, 0x1800, 0x9800, 0x4000, 0x9000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1000, 0x2000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x0000, 0x2000, 0x1000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x2000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa000, 0x0800, 0x2800, 0x9000, 0x2800,
-  0x1000, 0xa000, 0x4000, 0x9800, 0x2000, 0xa800, 0xa000, 0x1800,
-  0x2000, 0xb000, 0x3000, 0x1800, 0x1000, 0xa000, 0x5000, 0x9800,
-  0x2000, 0xb800, 0xb000, 0xb800, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x2000, 0xa800, 0x2000, 0x1000, 0x1000, 0xb800, 0xb000, 0xb800,
-  0x2000, 0xa000, 0x3000, 0xa000, 0x2000, 0xb000, 0xa000, 0x1800,
-  0x2000, 0xa800, 0x4000, 0x9800, 0x2000, 0xa800, 0x4000, 0xa800,
-  0x2000, 0xa000, 0x2000, 0xa000, 0x2000, 0xa800, 0x4000, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x3000, 0x9800,
-  0x2000, 0x9800, 0x2000, 0x9800, 0x2000, 0xa800, 0xa000, 0x1800,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x2000, 0x0000, 0x1800, 0x2000, 0x1800, 0x0000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x2000, 0x9800, 0x3000, 0x9800,
-  0x2000, 0xa800, 0xa000, 0x1800, 0xa800, 0xb000, 0xa800, 0x1000,
-  0x2000, 0xa800, 0x4000, 0xa800, 0x2000, 0xa800, 0x3000, 0xa800,
-  0x2000, 0xa800, 0x4000, 0x2000, 0xb000, 0x5000, 0xb000, 0x2000,
-  0x2000, 0xa800, 0x3000, 0xa000, 0x2000, 0xa800, 0x3000, 0xa800,
-  0x2000, 0xb000, 0xa000, 0x2800, 0xb800, 0xc000, 0xa800, 0x2000,
-  0x2000, 0xa800, 0x4000, 0xa800, 0x2000, 0x9800, 0x4000, 0x9800,
-  0x2000, 0xa800, 0x4000, 0x2000, 0xb800, 0xb800, 0x3800, 0x1000,
-  0x1000, 0xa800, 0xb000, 0xa800, 0x1000, 0x2800, 0x9800, 0x2800,
-  0x0800, 0xa800, 0xa000, 0x2800, 0x9800, 0x3800, 0x9000, 0x1000,
-  0x0000, 0x1800, 0x2000, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x1000, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x8800, 0x0800, 0x1800, 0x8000, 0x1800,
-  0x0800, 0x8800, 0x2800, 0x8800, 0x1800, 0x9000, 0x8800, 0x0800,
-  0x1000, 0x9800, 0x2000, 0x0800, 0x0800, 0x8800, 0x3800, 0x8800,
-  0x1800, 0xa000, 0xa000, 0xa000, 0x1800, 0x9800, 0x2800, 0x0000,
-  0x1000, 0x9000, 0x0800, 0x0800, 0x1000, 0xa000, 0xa000, 0xa000,
-  0x1800, 0x9000, 0x2800, 0x9000, 0x1800, 0xa000, 0x8800, 0x0800,
-  0x1000, 0x9000, 0x2800, 0x8800, 0x2000, 0x9000, 0x3000, 0x9000,
-  0x2000, 0x9000, 0x2000, 0x9000, 0x2000, 0x9800, 0x2800, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9800, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8800, 0x1800, 0x8800, 0x1800, 0x9000, 0x8800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9000, 0x1800, 0x8800, 0x1800, 0x8800,
-  0x1800, 0x9000, 0x8800, 0x1800, 0x9000, 0x9800, 0x9000, 0x0800,
-  0x1000, 0x9000, 0x3000, 0x9000, 0x2000, 0x9000, 0x2000, 0x9000,
-  0x2000, 0x9800, 0x2800, 0x1000, 0x9800, 0x3800, 0x9800, 0x1000,
-  0x1000, 0x9000, 0x1800, 0x9000, 0x2000, 0x9000, 0x2000, 0x9000,
-  0x2000, 0xa000, 0x8800, 0x1800, 0xa000, 0xa800, 0x9000, 0x0800,
-  0x1000, 0x9000, 0x3000, 0x9000, 0x2000, 0x8800, 0x2800, 0x8800,
-  0x2000, 0x9800, 0x2800, 0x0800, 0xa800, 0xa000, 0x2000, 0x0000,
-  0x0800, 0x9000, 0x9800, 0x9800, 0x0800, 0x1000, 0x8000, 0x1800,
-  0x0800, 0x9800, 0x8800, 0x1800, 0x8800, 0x2800, 0x7800, 0x1000,
-  0x0000, 0x0800, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x7800, 0x0800, 0x1000, 0x7000, 0x1000,
-  0x0800, 0x7800, 0x2000, 0x7800, 0x1800, 0x8000, 0x7800, 0x0800,
-  0x0800, 0x8000, 0x1800, 0x0800, 0x0800, 0x7800, 0x3000, 0x7800,
-  0x1800, 0x8800, 0x8800, 0x8800, 0x1800, 0x8000, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x0800, 0x0800, 0x0800, 0x9000, 0x8800, 0x8800,
-  0x1800, 0x8000, 0x2800, 0x8000, 0x1800, 0x8800, 0x7800, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x7800, 0x1800, 0x8000, 0x2800, 0x8000,
-  0x1800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x8000, 0x7800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x8000, 0x7800, 0x1000, 0x8000, 0x8800, 0x8000, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8000, 0x2000, 0x0800, 0x8000, 0x3000, 0x8000, 0x1000,
-  0x0800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000, 0x1800, 0x8000,
-  0x1800, 0x8800, 0x7800, 0x1000, 0x8800, 0x9000, 0x8000, 0x0800,
-  0x0800, 0x8000, 0x2800, 0x8000, 0x1800, 0x7000, 0x2000, 0x7000,
-  0x1800, 0x8000, 0x2000, 0x0800, 0x9000, 0x8800, 0x2000, 0x0000,
-  0x0800, 0x8000, 0x8800, 0x8000, 0x0800, 0x1000, 0x7000, 0x1000,
-  0x0800, 0x8000, 0x7800, 0x1000, 0x7800, 0x2000, 0x6800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x6800, 0x0800, 0x1000, 0x6000, 0x1000,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1000, 0x7800, 0x6800, 0x0800,
-  0x0800, 0x7800, 0x1800, 0x0800, 0x0800, 0x6800, 0x2800, 0x6800,
-  0x1800, 0x8000, 0x8000, 0x8000, 0x1800, 0x7800, 0x2000, 0x0000,
-  0x0800, 0x7000, 0x0800, 0x0800, 0x0800, 0x8000, 0x7800, 0x8000,
-  0x1800, 0x7000, 0x2000, 0x7000, 0x1800, 0x8000, 0x6800, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x6800, 0x1800, 0x7000, 0x2000, 0x7000,
-  0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7800, 0x2000, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7800, 0x1000, 0x6800, 0x1000, 0x6800,
-  0x1800, 0x6800, 0x1800, 0x6800, 0x1000, 0x7000, 0x6800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7000, 0x1000, 0x6800, 0x1800, 0x6800,
-  0x1000, 0x7800, 0x6800, 0x1000, 0x7000, 0x7800, 0x7000, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x7800, 0x2000, 0x0800, 0x7800, 0x3000, 0x7800, 0x0800,
-  0x0800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000, 0x1800, 0x7000,
-  0x1800, 0x8000, 0x6800, 0x1000, 0x8000, 0x8800, 0x7000, 0x0800,
-  0x0800, 0x7800, 0x2000, 0x7000, 0x1800, 0x6800, 0x2000, 0x6800,
-  0x1800, 0x7800, 0x2000, 0x0800, 0x8000, 0x8000, 0x1800, 0x0000,
-  0x0800, 0x7000, 0x7800, 0x7800, 0x0800, 0x1000, 0x6000, 0x1000,
-  0x0800, 0x7800, 0x6800, 0x1000, 0x6800, 0x2000, 0x6000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x6800, 0x6800, 0x6000, 0x0800, 0x1000, 0x5800, 0x1000,
-  0x0800, 0x6000, 0x2000, 0x6000, 0x1000, 0x6800, 0x6000, 0x0800,
-  0x0800, 0x6800, 0x1000, 0x0800, 0x0800, 0x6000, 0x2800, 0x6000,
-  0x1000, 0x7000, 0x7000, 0x7000, 0x1000, 0x6800, 0x2000, 0x0000,
-  0x0800, 0x6800, 0x0800, 0x0000, 0x0800, 0x7000, 0x7000, 0x7000,
-  0x1000, 0x6800, 0x2000, 0x6800, 0x1000, 0x7000, 0x6000, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6000, 0x1000, 0x6800, 0x2000, 0x6800,
-  0x1800, 0x6800, 0x1000, 0x6800, 0x1800, 0x6800, 0x2000, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x1000, 0x6000, 0x1000, 0x6800, 0x6000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x1000, 0x6000, 0x1000, 0x6000,
-  0x1000, 0x6800, 0x6000, 0x1000, 0x6800, 0x6800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1800, 0x6800, 0x1800, 0x6800,
-  0x1800, 0x6800, 0x1800, 0x0800, 0x6800, 0x2800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x1000, 0x6800, 0x1800, 0x6800, 0x1000, 0x6800,
-  0x1000, 0x7000, 0x6000, 0x1000, 0x7000, 0x7800, 0x6800, 0x0800,
-  0x0800, 0x6800, 0x2000, 0x6800, 0x1000, 0x6000, 0x2000, 0x6000,
-  0x1000, 0x6800, 0x1800, 0x0800, 0x7000, 0x7000, 0x1800, 0x0000,
-  0x0800, 0x6800, 0x7000, 0x6800, 0x0800, 0x1000, 0x5800, 0x1000,
-  0x0800, 0x6800, 0x6000, 0x1000, 0x6000, 0x1800, 0x5000, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x5800, 0x0800, 0x0800, 0x5000, 0x0800,
-  0x0800, 0x5800, 0x1800, 0x5000, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1000, 0x0800, 0x0800, 0x5800, 0x2000, 0x5800,
-  0x1000, 0x6000, 0x6000, 0x6800, 0x1000, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x0800, 0x0000, 0x0800, 0x6800, 0x6000, 0x6800,
-  0x1000, 0x5800, 0x1800, 0x5800, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1800, 0x5800, 0x1000, 0x6000, 0x1800, 0x6000,
-  0x1000, 0x5800, 0x1000, 0x5800, 0x1000, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x6000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x5800, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x6000, 0x5800, 0x1000, 0x5800, 0x6000, 0x5800, 0x0800,
-  0x0800, 0x5800, 0x1800, 0x6000, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x1800, 0x0800, 0x6000, 0x2000, 0x6000, 0x0800,
-  0x0800, 0x5800, 0x1000, 0x5800, 0x1000, 0x5800, 0x1000, 0x5800,
-  0x1000, 0x6000, 0x5000, 0x1000, 0x6000, 0x6800, 0x5800, 0x0800,
-  0x0800, 0x6000, 0x1800, 0x6000, 0x1000, 0x5000, 0x1800, 0x5000,
-  0x1000, 0x6000, 0x1800, 0x0800, 0x6800, 0x6000, 0x1800, 0x0000,
-  0x0800, 0x5800, 0x6000, 0x6000, 0x0800, 0x0800, 0x5000, 0x0800,
-  0x0800, 0x6000, 0x5800, 0x1000, 0x5000, 0x1800, 0x4800, 0x0800,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0800, 0x5000, 0x5000, 0x4800, 0x0000, 0x0800, 0x4000, 0x0800,
-  0x0800, 0x4800, 0x1800, 0x4800, 0x1000, 0x5000, 0x4800, 0x0000,
-  0x0800, 0x5000, 0x1000, 0x0000, 0x0800, 0x4800, 0x2000, 0x4800,
-  0x1000, 0x5800, 0x5800, 0x5800, 0x1000, 0x5000, 0x1800, 0x0000,
-  0x0800, 0x5000, 0x0800, 0x0000, 0x0800, 0x5800, 0x5800, 0x5800,
-  0x1000, 0x5000, 0x1800, 0x5000, 0x1000, 0x5800, 0x4800, 0x0000,
-  0x0800, 0x5000, 0x1800, 0x4800, 0x1000, 0x5000, 0x1800, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000, 0x1800, 0x0000,
-  0x0000, 0x5000, 0x5000, 0x5000, 0x1000, 0x4800, 0x1000, 0x4800,
-  0x1000, 0x4800, 0x1000, 0x4800, 0x1000, 0x5000, 0x4800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000, 0x0000,
-  0x0800, 0x5000, 0x5000, 0x5000, 0x1000, 0x4800, 0x1000, 0x4800,
-  0x1000, 0x5000, 0x4800, 0x0800, 0x5000, 0x5000, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1800, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5000, 0x1000, 0x0800, 0x5000, 0x2000, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000, 0x1000, 0x5000,
-  0x1000, 0x5800, 0x4800, 0x0800, 0x5800, 0x5800, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x1800, 0x5000, 0x1000, 0x4800, 0x1800, 0x4800,
-  0x1000, 0x5000, 0x1000, 0x0800, 0x5800, 0x5800, 0x1000, 0x0000,
-  0x0000, 0x5000, 0x5000, 0x5000, 0x0000, 0x0800, 0x4800, 0x0800,
-  0x0000, 0x5000, 0x4800, 0x0800, 0x4800, 0x1000, 0x4000, 0x0800,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x1000, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0800, 0x4000, 0x1800, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x4800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x4000, 0x0000, 0x0000, 0x0800, 0x4800, 0x4800, 0x4800,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000,
-  0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x0800, 0x4000, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x1000, 0x4000, 0x1000, 0x4000,
-  0x1000, 0x4000, 0x1000, 0x0800, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4800, 0x4000, 0x0800, 0x4800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4800, 0x4800, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x1000, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0000, 0x4000, 0x1800, 0x4000,
-  0x0800, 0x4800, 0x4800, 0x4800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x4000, 0x0000, 0x0000, 0x0000, 0x4800, 0x4800, 0x4800,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x1000, 0x4000,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x4000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x0800, 0x4000, 0x4000, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000, 0x0800, 0x4000,
-  0x0800, 0x4800, 0x3800, 0x0800, 0x4800, 0x4800, 0x4000, 0x0000,
-  0x0800, 0x4000, 0x1000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4800, 0x4800, 0x1000, 0x0000,
-  0x0000, 0x4000, 0x4800, 0x4000, 0x0000, 0x0800, 0x3800, 0x0800,
-  0x0000, 0x4000, 0x4000, 0x0800, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x3800, 0x0000,
-  0x0800, 0x4000, 0x0800, 0x0000, 0x0000, 0x3800, 0x1800, 0x3800,
-  0x0800, 0x4000, 0x4000, 0x4000, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0800, 0x3800, 0x0000, 0x0000, 0x0000, 0x4000, 0x4000, 0x4000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x4000, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x3800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x3800, 0x0800, 0x3800, 0x4000, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x1800, 0x4000, 0x0800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x4000, 0x3800, 0x0800, 0x4000, 0x4800, 0x3800, 0x0000,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x4000, 0x1000, 0x0000, 0x4000, 0x4000, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x4000, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x3800, 0x0800, 0x3800, 0x1000, 0x3000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3000, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3800, 0x0800, 0x0000, 0x0000, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3800, 0x3800, 0x3800, 0x0800, 0x3800, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x0000, 0x0000, 0x0000, 0x3800, 0x3800, 0x3800,
-  0x0800, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3000, 0x0800, 0x3800, 0x1000, 0x3800,
-  0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x1000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3800, 0x3000, 0x0800, 0x3800, 0x3800, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x1000, 0x0000, 0x3800, 0x1000, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800, 0x0800, 0x3800,
-  0x0800, 0x3800, 0x3000, 0x0800, 0x3800, 0x4000, 0x3800, 0x0000,
-  0x0000, 0x3800, 0x1000, 0x3800, 0x0800, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3800, 0x1000, 0x0000, 0x4000, 0x3800, 0x0800, 0x0000,
-  0x0000, 0x3800, 0x3800, 0x3800, 0x0000, 0x0800, 0x3000, 0x0800,
-  0x0000, 0x3800, 0x3000, 0x0800, 0x3000, 0x1000, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0800, 0x2800, 0x0800,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x3000, 0x0800, 0x0000, 0x0000, 0x3000, 0x1000, 0x2800,
-  0x0800, 0x3000, 0x3000, 0x3000, 0x0800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000,
-  0x0800, 0x3000, 0x1000, 0x3000, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x2800, 0x0800, 0x3000, 0x1000, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x3000, 0x2800, 0x0800, 0x3000, 0x3000, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x0800, 0x0000, 0x3000, 0x1000, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000, 0x0800, 0x3000,
-  0x0800, 0x3000, 0x2800, 0x0800, 0x3000, 0x3800, 0x3000, 0x0000,
-  0x0000, 0x3000, 0x1000, 0x3000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x3000, 0x0800, 0x0000, 0x3800, 0x3000, 0x0800, 0x0000,
-  0x0000, 0x3000, 0x3000, 0x3000, 0x0000, 0x0800, 0x2800, 0x0800,
-  0x0000, 0x3000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x0000, 0x0000, 0x2800, 0x1000, 0x2000,
-  0x0800, 0x2800, 0x2800, 0x2800, 0x0800, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x0000, 0x0000, 0x0000, 0x2800, 0x2800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2000, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x2800, 0x0000, 0x2800, 0x2800, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x0800, 0x0000, 0x2800, 0x1000, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800, 0x0800, 0x2800,
-  0x0800, 0x2800, 0x2800, 0x0000, 0x2800, 0x3000, 0x2800, 0x0000,
-  0x0000, 0x2800, 0x0800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x0800, 0x0000, 0x3000, 0x2800, 0x0800, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x2800, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2800, 0x2800, 0x0800, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2800, 0x2000, 0x2800, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2800, 0x2000, 0x2800,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x2000, 0x0000, 0x2800, 0x2800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x0000, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x0000, 0x0000, 0x2000, 0x2000, 0x2000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0000, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2000, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0800, 0x2000, 0x0800, 0x0000, 0x2000, 0x0800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x2800, 0x2000, 0x0000,
-  0x0000, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000, 0x0800, 0x2000,
-  0x0000, 0x2000, 0x0800, 0x0000, 0x2800, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x2000, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x2000, 0x2000, 0x0000, 0x2000, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x0000, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x2000, 0x1800, 0x2000, 0x0000, 0x1800, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x0000, 0x0000, 0x2000, 0x1800, 0x2000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x1800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x0800, 0x0000, 0x1800, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800, 0x0000, 0x1800,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x2000, 0x2000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x0800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800,
-  0x0000, 0x1800, 0x0800, 0x0000, 0x2000, 0x2000, 0x0800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x0000, 0x1800, 0x0000,
-  0x0000, 0x1800, 0x1800, 0x0000, 0x1800, 0x0800, 0x1800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000,
-  0x0000, 0x1800, 0x1800, 0x1800, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800, 0x1800, 0x1800,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1800, 0x1000, 0x0000, 0x1800, 0x1800, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1800, 0x1800, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1800, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x0800, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x1000, 0x1000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x0800, 0x0000, 0x0800, 0x0000, 0x1000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x1000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x1000, 0x1000, 0x1000, 0x0000,
-  0x0000, 0x1000, 0x0000, 0x1000, 0x0000, 0x0800, 0x0000, 0x0800,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x1000, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0x1000, 0x1000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x1000, 0x0800, 0x0000, 0x0800, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation game_overAnimation = {
-  .name = "Game Over",
-  .frameCount = 57,
-  .width = 16,
-  .height = 16,
-  .frameDurations = game_overDurations,
-  .animationFrames = game_overFrames
-};
-#endif // ANIMATION_GAME_OVER_H
@@ -1,790 +0,0 @@
-// gnome.h - Auto-generated from gnome.json
-#ifndef ANIMATION_GNOME_H
-#define ANIMATION_GNOME_H
-
-#include "animation_types.h"
-
-// Frame Durations for gnome (in 100ms units)
-static const uint8_t PROGMEM gnomeDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for gnome
-static const uint16_t PROGMEM gnomeFrames[] = {
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0xffff, 0x0000, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0xf800, 0x0000,
-  0x0000, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0xf800, 0xf800,
-  0xf800, 0x0000, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0x0000, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x0000, 0x214e, 0x214e, 0x214e, 0x6d6d,
-  0x6d6d, 0x214e, 0x214e, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x214e, 0x6d6d, 0x6d6d,
-  0x0280, 0x214e, 0x214e, 0x214e, 0x0000, 0xffff, 0xfeb6, 0x6a08,
-  0xfeb6, 0xfeb6, 0x6a08, 0x0000, 0x214e, 0x214e, 0x0280, 0x6d6d,
-  0x6d6d, 0x214e, 0x214e, 0x214e, 0x0000, 0xffff, 0xfeb6, 0x7082,
-  0xfeb6, 0xfeb6, 0x7082, 0x0000, 0x214e, 0x214e, 0x6d6d, 0x6d6d,
-  0x0280, 0x214e, 0x214e, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x214e, 0x0280, 0x6d6d,
-  0x6d6d, 0x214e, 0x0000, 0xffff, 0xf800, 0xf800, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xf800, 0xffff, 0x0000, 0x6d6d, 0x6d6d,
-  0x214e, 0x214e, 0x0000, 0x4145, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x0000, 0x4145, 0x0000, 0x214e, 0x7082,
-  0x214e, 0x214e, 0x214e, 0x0000, 0x0000, 0x6a08, 0x6a08, 0x6a08,
-  0x6a08, 0xffff, 0x6a08, 0x0000, 0x0000, 0x214e, 0x214e, 0x7082,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x4145, 0xf800, 0x0000, 0x0000,
-  0x0000, 0x4145, 0x4145, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x4145, 0x0000, 0x0000, 0xb575,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xb575, 0xffff,
-  0xb575, 0xb575, 0xb575, 0xb575, 0xffff, 0xffff, 0xffff, 0xffff,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x218e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x10c5, 0x29cd, 0x5c8d, 0x2a0e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x216c, 0x548c, 0x656c, 0x5cec,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0001, 0x112a, 0x1b24, 0x5d0b, 0x1b43,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18e3, 0x546a, 0x654c, 0x5ceb,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x2164, 0x54ca, 0x1b43,
-  0x214e, 0x192d, 0x0842, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x1082, 0x5c8b, 0x5cec,
-  0x192e, 0x192e, 0x190b, 0x0841, 0x18c2, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x210b, 0x58e4, 0x298d,
-  0x31d0, 0x29ae, 0x0842, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x31ad, 0x6946, 0x39ce,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xf75d, 0xef5e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x218e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc618, 0x2165, 0x546c, 0x29ee, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef3c, 0xfef8, 0xf695,
-  0xfed6, 0xfed7, 0xddf4, 0x2965, 0x5449, 0x6d6c, 0x548c, 0x21ae,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe73c, 0xf675, 0x8aca,
-  0xf634, 0xf654, 0x7248, 0x0020, 0x1ae3, 0x5d0b, 0x1b24, 0x196d,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x10a3, 0xe75c, 0xf676, 0x8a07,
-  0xf655, 0xf675, 0x7985, 0x0861, 0x4c69, 0x656c, 0x548b, 0x21ae,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10c2, 0x12e2, 0x5d2b, 0x1b24, 0x196d,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xee9a, 0x28e2, 0x5429, 0x650c, 0x548c, 0x21ae,
-  0x192e, 0x192e, 0x192d, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd0a2, 0x2081, 0x58e3, 0x296d, 0x194e,
-  0x31cf, 0x31d0, 0x216d, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x1882, 0x6104, 0x39ce, 0x31d0,
-  0xef5e, 0xe73d, 0x9cd4, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xdebb, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x21ae, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x3124, 0x4c0b, 0x29ee, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x21a4, 0x4c2b, 0x21ae, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x2124, 0x546a, 0x1b04, 0x196d, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0861, 0x5d0b, 0x54ab, 0x218e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x1903, 0x4c29, 0x1b24, 0x196d, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10c4, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x2143, 0x4c2a, 0x21ae, 0x214e,
-  0x192e, 0x190c, 0x10a4, 0xc5b6, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x1904, 0x190c, 0x194e,
-  0x31d0, 0x29ae, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31f0,
-  0xef5e, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x192e, 0x190d, 0x0842, 0x4165, 0x2820, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x3965, 0x0842, 0x190d, 0x194e,
-  0x31cf, 0x31cf, 0x29ad, 0x0021, 0x0820, 0x7186, 0x6986, 0x6165,
-  0x7208, 0xddd7, 0x7208, 0x0000, 0x10a3, 0x29ad, 0x31cf, 0x31cf,
-  0xef5d, 0xef7e, 0xd6db, 0x10a2, 0x40e3, 0xb841, 0x1820, 0x1082,
-  0x0841, 0x4186, 0x3904, 0x1082, 0xd6ba, 0xef7e, 0xef5e, 0xef7e,
-  0xffff, 0xffff, 0xef5d, 0x18c3, 0x30e3, 0x1000, 0x18c3, 0x8c71,
-  0x18e3, 0x1082, 0x1082, 0x2104, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xe73c, 0x10a2, 0x0000, 0x0841, 0x9cd3, 0xef5d,
-  0xa534, 0x9cf3, 0x9cf3, 0xa534, 0xf79e, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x214e, 0x192d, 0x0842, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x0842, 0x192d, 0x214e,
-  0x192e, 0x192e, 0x190b, 0x0841, 0x18c2, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x190c, 0x192e, 0x192e,
-  0x31d0, 0x29ae, 0x0842, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x29ae, 0x31d0, 0x31cf,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xef7e, 0xef7e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef3c, 0xfef8, 0xf695,
-  0xfed6, 0xfed7, 0xde14, 0x2925, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe73c, 0xf675, 0x8aca,
-  0xf634, 0xf654, 0x7248, 0x0021, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x10a3, 0xe75c, 0xf676, 0x8a07,
-  0xf655, 0xf675, 0x7985, 0x0821, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x2883, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x192e, 0x192e, 0x192d, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd8a2, 0x1022, 0x190d, 0x192e, 0x192e,
-  0x31cf, 0x31d0, 0x216d, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x10a3, 0x298e, 0x31d0, 0x31cf,
-  0xef5e, 0xe73d, 0x9cd4, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xd6db, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x1905, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218e, 0x4c0a, 0x29a5, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218d, 0x1282, 0x10c2, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0801, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x21ae, 0x43e9, 0x18e3, 0xe69a, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x10eb, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x1904, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x10a4, 0x192c, 0x214e, 0x214e,
-  0x192e, 0x190c, 0x10a4, 0xc596, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x10a4, 0x190c, 0x194e,
-  0x31d0, 0x29ae, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31f0,
-  0xef5e, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x216d, 0x1905, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x548c, 0x5cab, 0x29a5, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x196d, 0x1b24, 0x4c49, 0x10e3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x4c2a, 0x2143, 0x2882, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x1904, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x192e, 0x190d, 0x0822, 0x4165, 0x2820, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x3965, 0x0842, 0x190d, 0x194e,
-  0x31cf, 0x31cf, 0x29ad, 0x0021, 0x0820, 0x7186, 0x6986, 0x6165,
-  0x7208, 0xddd7, 0x7208, 0x0000, 0x10a3, 0x29ad, 0x31cf, 0x31cf,
-  0xef5d, 0xef7e, 0xd6db, 0x10a2, 0x40e3, 0xb841, 0x1820, 0x1082,
-  0x0841, 0x4186, 0x3904, 0x1082, 0xd6ba, 0xef7e, 0xef5e, 0xef7e,
-  0xffff, 0xffff, 0xef5d, 0x18c3, 0x30e3, 0x1000, 0x18c3, 0x8c71,
-  0x18e3, 0x1082, 0x1082, 0x2104, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xe73c, 0x10a2, 0x0000, 0x0841, 0x9cd3, 0xef5d,
-  0xa534, 0x9cf3, 0x9cf3, 0xa534, 0xf79e, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x29ee, 0x546c, 0x2165, 0xc618, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x218e, 0x548c, 0x6d6c, 0x546a, 0x2985, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x196d, 0x1b04, 0x5d0b, 0x0a61, 0x08a2, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x218e, 0x548b, 0x5cab, 0x1902, 0x2882, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x216d, 0x1283, 0x1923, 0xc5b6, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x21ae, 0x4c0b, 0x1081, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x0842, 0x192d, 0x214e,
-  0x194e, 0x296d, 0x5082, 0x1020, 0x18c3, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x190c, 0x192e, 0x192e,
-  0x31d0, 0x29ae, 0x1021, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x29ae, 0x31d0, 0x31cf,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xef7e, 0xef7e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x2a0e, 0x5c8d, 0x29cd, 0x10c5, 0xc618, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x5ccc, 0x656c, 0x548c, 0x194b, 0x2946, 0xef3c, 0xfef8, 0xf695,
-  0xfed6, 0xfed7, 0xde14, 0x2925, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x1b43, 0x5d0b, 0x1b24, 0x192b, 0x10a3, 0xe73c, 0xf675, 0x8aca,
-  0xf634, 0xf654, 0x7248, 0x0021, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x54ea, 0x654c, 0x54ab, 0x196c, 0x10a3, 0xe75c, 0xf676, 0x8a07,
-  0xf655, 0xf675, 0x7985, 0x0821, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x1b43, 0x5d0b, 0x1b24, 0x192c, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x5ccc, 0x650c, 0x548c, 0x196c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x2883, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x298d, 0x6104, 0x216c, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd8a2, 0x1022, 0x190d, 0x192e, 0x192e,
-  0x39ae, 0x6946, 0x294c, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x10a3, 0x298e, 0x31d0, 0x31cf,
-  0xef5e, 0xef3c, 0x9cd3, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xd6db, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x218e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x5ccd, 0x29ee, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x29ae,
-  0x6d6c, 0x548c, 0x216d, 0x10a5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x190d, 0x21ae, 0x548c,
-  0x652c, 0x1b24, 0x196d, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x216d, 0x12e3,
-  0x656c, 0x54ab, 0x218e, 0x190d, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0801, 0x192d, 0x214e, 0x218e, 0x548b,
-  0x654c, 0x1b24, 0x196d, 0x10eb, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x10eb, 0x214e, 0x216d, 0x12e3,
-  0x6d0c, 0x548c, 0x216c, 0x10c4, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x10a4, 0x192c, 0x218e, 0x548c,
-  0x60e3, 0x214b, 0x10c4, 0xc596, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x10a4, 0x190c, 0x218e,
-  0x7125, 0x318d, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31d0,
-  0xef5d, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x218e,
-  0x29ae, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x29ee, 0x5ccd,
-  0x548c, 0x21ae, 0x190d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x10c5, 0x216c, 0x548c, 0x6d6c,
-  0x12e3, 0x216d, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x196d, 0x1b24, 0x652c,
-  0x548b, 0x21ae, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x10ec, 0x218e, 0x54ab, 0x6d6c,
-  0x12e3, 0x196d, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x10a4, 0x194b, 0x1b04, 0x654c,
-  0x548c, 0x216c, 0x10a4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc576, 0x1904, 0x544a, 0x6d0c,
-  0x218e, 0x192d, 0x0842, 0x4165, 0x2820, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x3965, 0x0842, 0x214c, 0x60e3,
-  0x31cf, 0x31cf, 0x29ad, 0x0021, 0x0820, 0x7186, 0x6986, 0x6165,
-  0x7208, 0xddd7, 0x7208, 0x0000, 0x10a3, 0x29ae, 0x39ae, 0x7125,
-  0xef5d, 0xef7e, 0xd6db, 0x10a2, 0x40e3, 0xb841, 0x1820, 0x1082,
-  0x0841, 0x4186, 0x3904, 0x1082, 0xd6ba, 0xef7e, 0xef5e, 0xf75d,
-  0xffff, 0xffff, 0xef5d, 0x18c3, 0x30e3, 0x1000, 0x18c3, 0x8c71,
-  0x18e3, 0x1082, 0x1082, 0x2104, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xe73c, 0x10a2, 0x0000, 0x0841, 0x9cd3, 0xef5d,
-  0xa534, 0x9cf3, 0x9cf3, 0xa534, 0xf79e, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x218e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x10c5, 0x29cd, 0x5c8d, 0x2a0e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x216c, 0x548c, 0x656c, 0x5cec,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0001, 0x112a, 0x1b24, 0x5d0b, 0x1b43,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18e3, 0x546a, 0x654c, 0x5ceb,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x2164, 0x54ca, 0x1b43,
-  0x214e, 0x192d, 0x0842, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x1082, 0x5c8b, 0x5cec,
-  0x192e, 0x192e, 0x190b, 0x0841, 0x18c2, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x210b, 0x58e4, 0x298d,
-  0x31d0, 0x29ae, 0x0842, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x31ad, 0x6946, 0x39ce,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xf75d, 0xef5e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x218e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc618, 0x2165, 0x546c, 0x29ee, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef3c, 0xfef8, 0xf695,
-  0xfed6, 0xfed7, 0xddf4, 0x2965, 0x5449, 0x6d6c, 0x548c, 0x21ae,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe73c, 0xf675, 0x8aca,
-  0xf634, 0xf654, 0x7248, 0x0020, 0x1ae3, 0x5d0b, 0x1b24, 0x196d,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x10a3, 0xe75c, 0xf676, 0x8a07,
-  0xf655, 0xf675, 0x7985, 0x0861, 0x4c69, 0x656c, 0x548b, 0x21ae,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10c2, 0x12e2, 0x5d2b, 0x1b24, 0x196d,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xee9a, 0x28e2, 0x5429, 0x650c, 0x548c, 0x21ae,
-  0x192e, 0x192e, 0x192d, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd0a2, 0x2081, 0x58e3, 0x296d, 0x194e,
-  0x31cf, 0x31d0, 0x216d, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x1882, 0x6104, 0x39ce, 0x31d0,
-  0xef5e, 0xe73d, 0x9cd4, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xdebb, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x21ae, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x3124, 0x4c0b, 0x29ee, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x21a4, 0x4c2b, 0x21ae, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x2124, 0x546a, 0x1b04, 0x196d, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0861, 0x5d0b, 0x54ab, 0x218e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x1903, 0x4c29, 0x1b24, 0x196d, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10c4, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x2143, 0x4c2a, 0x21ae, 0x214e,
-  0x192e, 0x190c, 0x10a4, 0xc5b6, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x1904, 0x190c, 0x194e,
-  0x31d0, 0x29ae, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31f0,
-  0xef5e, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x192e, 0x190d, 0x0842, 0x4165, 0x2820, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x3965, 0x0842, 0x190d, 0x194e,
-  0x31cf, 0x31cf, 0x29ad, 0x0021, 0x0820, 0x7186, 0x6986, 0x6165,
-  0x7208, 0xddd7, 0x7208, 0x0000, 0x10a3, 0x29ad, 0x31cf, 0x31cf,
-  0xef5d, 0xef7e, 0xd6db, 0x10a2, 0x40e3, 0xb841, 0x1820, 0x1082,
-  0x0841, 0x4186, 0x3904, 0x1082, 0xd6ba, 0xef7e, 0xef5e, 0xef7e,
-  0xffff, 0xffff, 0xef5d, 0x18c3, 0x30e3, 0x1000, 0x18c3, 0x8c71,
-  0x18e3, 0x1082, 0x1082, 0x2104, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xe73c, 0x10a2, 0x0000, 0x0841, 0x9cd3, 0xef5d,
-  0xa534, 0x9cf3, 0x9cf3, 0xa534, 0xf79e, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x10eb, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x10a4, 0x28a2, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x10c4, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x214e, 0x192d, 0x0842, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x0842, 0x192d, 0x214e,
-  0x192e, 0x192e, 0x190b, 0x0841, 0x18c2, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x190c, 0x192e, 0x192e,
-  0x31d0, 0x29ae, 0x0842, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x29ae, 0x31d0, 0x31cf,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xef7e, 0xef7e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x10c5, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2946, 0xef3c, 0xff18, 0xfed7,
-  0xfed7, 0xfef7, 0xee75, 0x2945, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190d, 0x10a3, 0xe71b, 0xfed6, 0xf613,
-  0xfe95, 0xfeb5, 0xdd92, 0x1082, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x10a3, 0xe75c, 0xf676, 0x9a68,
-  0xf655, 0xf675, 0x81e6, 0x0821, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x10a3, 0xe6ba, 0xffde, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x190c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x2883, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x192e, 0x192e, 0x192d, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd8a2, 0x1022, 0x190d, 0x192e, 0x192e,
-  0x31cf, 0x31d0, 0x216d, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x10a3, 0x298e, 0x31d0, 0x31cf,
-  0xef5e, 0xe73d, 0x9cd4, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xd6db, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192d, 0x1905, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218e, 0x4c0a, 0x29a5, 0xe73c, 0xfef7, 0xf6b6,
-  0xfed6, 0xfed7, 0xe634, 0x2925, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218d, 0x1282, 0x10c2, 0xe73c, 0xfed7, 0xd592,
-  0xf696, 0xfeb6, 0xbd10, 0x1062, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x21ae, 0x43e9, 0x18e3, 0xe69a, 0xffdf, 0xf7be,
-  0xffdf, 0xffff, 0xe71c, 0x10a3, 0x10eb, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x192c, 0x1904, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x10a4, 0x192c, 0x214e, 0x214e,
-  0x192e, 0x190c, 0x10a4, 0xc596, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x10a4, 0x190c, 0x194e,
-  0x31d0, 0x29ae, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31f0,
-  0xef5e, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x216d, 0x1905, 0xc638, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x548c, 0x5cab, 0x29a5, 0xe73c, 0xfef7, 0xf655,
-  0xfeb6, 0xfed7, 0xddd3, 0x2925, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x196d, 0x1b24, 0x4c49, 0x10e3, 0xe73c, 0xf676, 0x9a68,
-  0xf655, 0xf675, 0x81e6, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x4c2a, 0x2143, 0x2882, 0xeeba, 0xffde, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x214e, 0x192d, 0x1904, 0xc596, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x192e, 0x190d, 0x0822, 0x4165, 0x2820, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x3965, 0x0842, 0x190d, 0x194e,
-  0x31cf, 0x31cf, 0x29ad, 0x0021, 0x0820, 0x7186, 0x6986, 0x6165,
-  0x7208, 0xddd7, 0x7208, 0x0000, 0x10a3, 0x29ad, 0x31cf, 0x31cf,
-  0xef5d, 0xef7e, 0xd6db, 0x10a2, 0x40e3, 0xb841, 0x1820, 0x1082,
-  0x0841, 0x4186, 0x3904, 0x1082, 0xd6ba, 0xef7e, 0xef5e, 0xef7e,
-  0xffff, 0xffff, 0xef5d, 0x18c3, 0x30e3, 0x1000, 0x18c3, 0x8c71,
-  0x18e3, 0x1082, 0x1082, 0x2104, 0xef5d, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xe73c, 0x10a2, 0x0000, 0x0841, 0x9cd3, 0xef5d,
-  0xa534, 0x9cf3, 0x9cf3, 0xa534, 0xf79e, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18c4, 0xc617, 0x28c3, 0x110b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x218e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x29ee, 0x546c, 0x2165, 0xc618, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x192d, 0x214e, 0x214e,
-  0x218e, 0x548c, 0x6d6c, 0x546a, 0x2985, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x196d, 0x1b04, 0x5d0b, 0x0a61, 0x08a2, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0000, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x218e, 0x548b, 0x5cab, 0x1902, 0x2882, 0xeeba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xe6db, 0x28a2, 0x18a4, 0x192c, 0x214e, 0x214e,
-  0x216d, 0x1283, 0x1923, 0xc5b6, 0xd882, 0xf8e3, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xfe9a, 0xd924, 0xc596, 0x10c4, 0x192d, 0x214e,
-  0x21ae, 0x4c0b, 0x1081, 0x4165, 0x2800, 0xd820, 0xf0c3, 0xf0c3,
-  0xf0c3, 0xf945, 0xd8c3, 0x2820, 0x4165, 0x0842, 0x192d, 0x214e,
-  0x194e, 0x296d, 0x5082, 0x1020, 0x18c3, 0x7986, 0x6986, 0x6165,
-  0x71e7, 0xd5d7, 0x7208, 0x0820, 0x0001, 0x190c, 0x192e, 0x192e,
-  0x31d0, 0x29ae, 0x1021, 0x4186, 0xcdb6, 0xc8a2, 0x1020, 0x1082,
-  0x10a2, 0x10a2, 0x3924, 0x30e3, 0x0021, 0x29ae, 0x31d0, 0x31cf,
-  0xef7e, 0xd6db, 0x10a2, 0x30e3, 0x18a2, 0x2061, 0x18c3, 0x9cd3,
-  0x94b2, 0x10a2, 0x1082, 0x1082, 0x18e3, 0xdedb, 0xef7e, 0xef7e,
-  0xffff, 0xef5d, 0x2124, 0x1082, 0x18c3, 0x94d3, 0xb575, 0xef5d,
-  0xbdd7, 0xa514, 0x9cf3, 0x9cf3, 0xad75, 0xf7be, 0xffff, 0xffff,
-  0xffdf, 0xf79e, 0xa534, 0x9cf3, 0xa534, 0xef7d, 0xffdf, 0xffdf,
-  0xef7d, 0xb5b6, 0xad75, 0xb5b6, 0xf79e, 0xffdf, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x190d, 0x18c3, 0xd5f7, 0x10c3,
-  0x110b, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd082, 0x2800,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2001, 0xe000, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x218e, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x214e,
-  0x2a0e, 0x5c8d, 0x29cd, 0x10c5, 0xc618, 0xff3c, 0xff3c, 0xff3c,
-  0xff3c, 0xff3c, 0xff3c, 0xc638, 0x10c5, 0x192d, 0x214e, 0x214e,
-  0x5ccc, 0x656c, 0x548c, 0x194b, 0x2946, 0xef3c, 0xfef8, 0xf695,
-  0xfed6, 0xfed7, 0xde14, 0x2925, 0x190c, 0x214e, 0x214e, 0x214e,
-  0x1b43, 0x5d0b, 0x1b24, 0x192b, 0x10a3, 0xe73c, 0xf675, 0x8aca,
-  0xf634, 0xf654, 0x7248, 0x0021, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x54ea, 0x654c, 0x54ab, 0x196c, 0x10a3, 0xe75c, 0xf676, 0x8a07,
-  0xf655, 0xf675, 0x7985, 0x0821, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x1b43, 0x5d0b, 0x1b24, 0x192c, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x192d, 0x214e, 0x214e, 0x214e,
-  0x5ccc, 0x650c, 0x548c, 0x196c, 0x2000, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x2883, 0x190b, 0x214e, 0x214e, 0x214e,
-  0x298d, 0x6104, 0x216c, 0x1042, 0xd0a2, 0xf020, 0xf0a2, 0xf0c3,
-  0xf0c3, 0xf945, 0xf0c3, 0xd8a2, 0x1022, 0x190d, 0x192e, 0x192e,
-  0x39ae, 0x6946, 0x294c, 0x10a3, 0xd5d6, 0x7a49, 0x6986, 0x6165,
-  0x7208, 0xe5b6, 0x9a8a, 0xd5b6, 0x10a3, 0x298e, 0x31d0, 0x31cf,
-  0xef5e, 0xef3c, 0x9cd3, 0x1061, 0x4165, 0x3924, 0x0820, 0x1082,
-  0x1020, 0xd0a2, 0xd861, 0x5165, 0x2945, 0xd6db, 0xef7e, 0xef7e,
-  0xffff, 0xffdf, 0xad55, 0x18e3, 0x1082, 0x1082, 0x18e3, 0x8c71,
-  0x18e3, 0x1000, 0x40c3, 0x18a2, 0xd6ba, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xf7be, 0xb596, 0x9cf3, 0x9cf3, 0x9cf3, 0xa534, 0xef5d,
-  0x9cd3, 0x0861, 0x0000, 0x1082, 0xef5d, 0xffff, 0xffdf, 0xffdf,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x18e4, 0x192c, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x192d, 0x18e5, 0xb575, 0x28c4, 0x190b,
-  0x192d, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x20a3, 0xc000, 0x2801,
-  0x1022, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x214e, 0x214e, 0x214e, 0x214e, 0x192c, 0x2000, 0xe800, 0xe800,
-  0xd000, 0x2822, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x218e, 0x214e, 0x214e, 0x192d, 0x1021, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xd800, 0x2801, 0x190c, 0x214e, 0x214e, 0x214e, 0x214e,
-  0x5ccd, 0x29ee, 0x214e, 0x192c, 0x28c3, 0xe8a2, 0xf8a2, 0xf8a2,
-  0xf8a2, 0xf8a2, 0xd8a2, 0x28c4, 0x192c, 0x214e, 0x214e, 0x29ae,
-  0x6d6c, 0x548c, 0x216d, 0x10a5, 0xc638, 0xff3c, 0xff3c, 0xf6db,
-  0xff1c, 0xff3c, 0xf6db, 0xc618, 0x18c5, 0x190d, 0x21ae, 0x548c,
-  0x652c, 0x1b24, 0x196d, 0x190c, 0x2946, 0xef5c, 0xf696, 0x8b0b,
-  0xf675, 0xf696, 0x7289, 0x18c4, 0x192c, 0x214e, 0x216d, 0x12e3,
-  0x656c, 0x54ab, 0x218e, 0x190d, 0x10a3, 0xe73c, 0xf676, 0x8a07,
-  0xf655, 0xf655, 0x7985, 0x0801, 0x192d, 0x214e, 0x218e, 0x548b,
-  0x654c, 0x1b24, 0x196d, 0x10eb, 0x10a3, 0xe6ba, 0xffdf, 0xf77d,
-  0xffde, 0xffff, 0xdedb, 0x10a3, 0x10eb, 0x214e, 0x216d, 0x12e3,
-  0x6d0c, 0x548c, 0x216c, 0x10c4, 0x2820, 0xe904, 0xfeba, 0xff5d,
-  0xff3c, 0xff3c, 0xeeba, 0x28a2, 0x10a4, 0x192c, 0x218e, 0x548c,
-  0x60e3, 0x214b, 0x10c4, 0xc596, 0xd0a2, 0xe820, 0xe8c3, 0xe8c3,
-  0xe8c3, 0xf945, 0xe8c3, 0xd0a2, 0xc596, 0x10a4, 0x190c, 0x218e,
-  0x7125, 0x318d, 0x10a3, 0x4165, 0x2041, 0x7986, 0x8186, 0x8165,
-  0x8a08, 0xedb6, 0x81e7, 0x2020, 0x4165, 0x18c3, 0x29ae, 0x31d0,
-  0xef5d, 0xe73d, 0xa514, 0x10c3, 0x0800, 0xc000, 0xd820, 0xd841,
-  0xe041, 0xe8c3, 0xc820, 0x0800, 0x2104, 0xd6ba, 0xef7e, 0xef7e,
-  0xffff, 0xffff, 0xf79e, 0xa514, 0x18e3, 0x2061, 0x1800, 0x48e3,
-  0x4904, 0x48e3, 0x1000, 0x2124, 0xd6db, 0xffff, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffff, 0xf79e, 0xa534, 0x8c92, 0x0861, 0x0020,
-  0x0020, 0x0020, 0x0882, 0xd6ba, 0xffff, 0xffdf, 0xffdf, 0xffdf
-};
-
-const Animation gnomeAnimation = {
-  .name = "Gnome",
-  .frameCount = 24,
-  .width = 16,
-  .height = 16,
-  .frameDurations = gnomeDurations,
-  .animationFrames = gnomeFrames
-};
-#endif // ANIMATION_GNOME_H
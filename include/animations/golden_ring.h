@@ -1,598 +0,0 @@
-// golden_ring.h - Auto-generated from golden_ring.json
-#ifndef ANIMATION_GOLDEN_RING_H
-#define ANIMATION_GOLDEN_RING_H
-
-#include "animation_types.h"
-
-// Frame Durations for golden_ring (in 100ms units)
-static const uint8_t PROGMEM golden_ringDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for golden_ring
-static const uint16_t PROGMEM golden_ringFrames[] = {
-  0x414c, 0x414c, 0x414c, 0x0000, 0x0000, 0xffe1, 0xffff, 0xffff,
-  0xffff, 0xffe1, 0xfea0, 0x0000, 0x0000, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x0000, 0xffe1, 0xffff, 0xffff, 0xfff5, 0xfff5,
-  0xfff5, 0xfff5, 0xffe1, 0xfea0, 0xfd84, 0x0000, 0x414c, 0x414c,
-  0x414c, 0x0000, 0xffff, 0xffff, 0xfff5, 0xfd84, 0xab08, 0x5105,
-  0x5105, 0xab08, 0xfea0, 0xfff5, 0xffe1, 0xfd84, 0x0000, 0x414c,
-  0x0000, 0xfff5, 0xffff, 0xfff5, 0xab08, 0x5105, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xab08, 0xe3a8, 0xfff5, 0xffe1, 0xfd84, 0x0000,
-  0x0000, 0xffff, 0xfff5, 0xab08, 0x0000, 0x0000, 0xca8a, 0xca8a,
-  0xca8a, 0xca8a, 0x0000, 0x0000, 0xfc88, 0xffe1, 0xfea0, 0x0000,
-  0xffe1, 0xffff, 0xfd84, 0x5105, 0x0000, 0xca8a, 0xca8a, 0xca8a,
-  0xca8a, 0xca8a, 0xca8a, 0x0000, 0xe3a8, 0xfea0, 0xffe1, 0xe3a8,
-  0xffe1, 0xffff, 0xab08, 0x0000, 0xfcab, 0xfcab, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcab, 0xfcab, 0x0000, 0xfd84, 0xffe1, 0xe3a8,
-  0xffe1, 0xfff5, 0xab08, 0x0000, 0xfcab, 0xfcab, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcab, 0xfcab, 0x0000, 0xfd84, 0xfea0, 0xab08,
-  0xffe1, 0xffe1, 0xab08, 0x0000, 0xfcab, 0xfcab, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcab, 0xfcab, 0x0000, 0xffe1, 0xfd84, 0xab08,
-  0xfd84, 0xffe1, 0xab08, 0x0000, 0xfcab, 0xfcab, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcab, 0xfcab, 0x0000, 0xfff5, 0xe3a8, 0xab08,
-  0xab08, 0xffe1, 0xfc88, 0xab08, 0x0000, 0xca8a, 0xca8a, 0xca8a,
-  0xca8a, 0xca8a, 0xca8a, 0x0000, 0xffff, 0xfd84, 0xe3a8, 0x69c6,
-  0x0000, 0xe3a8, 0xffe1, 0xe3a8, 0x0000, 0x0000, 0xca8a, 0xca8a,
-  0xca8a, 0xca8a, 0x0000, 0x0000, 0xffe1, 0xe3a8, 0xab08, 0x0000,
-  0x0000, 0xab08, 0xe3a8, 0xfea0, 0xfc88, 0xe3a8, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xffff, 0xffe1, 0xe3a8, 0xab08, 0x69c6, 0x0000,
-  0x414c, 0x0000, 0xab08, 0xe3a8, 0xfd84, 0xfc88, 0xfea0, 0xffe1,
-  0xffe1, 0xfff5, 0xfd84, 0xe3a8, 0xab08, 0x69c6, 0x0000, 0x414c,
-  0x414c, 0x414c, 0x0000, 0xab08, 0xab08, 0xe3a8, 0xe3a8, 0xe3a8,
-  0xe3a8, 0xe3a8, 0xab08, 0xab08, 0x69c6, 0x0000, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x0000, 0x0000, 0x69c6, 0x69c6, 0x69c6,
-  0x69c6, 0x69c6, 0x69c6, 0x0000, 0x0000, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x10a2, 0x2943, 0xef43, 0xffe3,
-  0xffc2, 0xfde4, 0xec86, 0x28e1, 0x30ea, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x30ea, 0x2945, 0xd693, 0xef59, 0xffb2, 0xf790,
-  0xef43, 0xef02, 0xee02, 0xd4a3, 0x28e2, 0x30ea, 0x414c, 0x414c,
-  0x414d, 0x310a, 0x2945, 0xd6db, 0xfffc, 0xffa6, 0xed65, 0xa328,
-  0x6a06, 0x59a5, 0x7a46, 0xe447, 0xd484, 0x28e2, 0x310a, 0x414d,
-  0x5170, 0x18a3, 0xd6b3, 0xfffd, 0xff94, 0xed65, 0x6a04, 0x1861,
-  0x1841, 0x5145, 0x5126, 0x7a06, 0xf467, 0xd483, 0x1882, 0x5171,
-  0x514f, 0x2904, 0xef5b, 0xffd5, 0xed67, 0x9ae6, 0x2882, 0xaa08,
-  0xaa28, 0x2882, 0x5165, 0x71e6, 0xdb88, 0xec27, 0x20a2, 0x514f,
-  0x1881, 0xd4c5, 0xffbc, 0xf773, 0x7a66, 0x2061, 0xaa48, 0xd2ca,
-  0xd2aa, 0xaa48, 0x2081, 0x9aa7, 0xbb48, 0xec28, 0x92a7, 0x1042,
-  0x1060, 0xe526, 0xffda, 0xf786, 0x9b06, 0x1881, 0xe40a, 0xfc8b,
-  0xfc8b, 0xe40a, 0x20a1, 0xcb47, 0xe388, 0xe3a8, 0xa2e7, 0x0840,
-  0x1060, 0xe505, 0xffd1, 0xf783, 0xa326, 0x2081, 0xe42a, 0xfcac,
-  0xfcab, 0xe42a, 0x28c1, 0xdc06, 0xebc8, 0xdb88, 0x9ac7, 0x0840,
-  0x1040, 0xe466, 0xff83, 0xf782, 0xa326, 0x2081, 0xe42a, 0xfcac,
-  0xfcab, 0xe42a, 0x28e0, 0xe5c1, 0xfcc6, 0xe3a8, 0x9ac7, 0x0840,
-  0x1040, 0xe407, 0xfdc4, 0xff22, 0xcb86, 0x2081, 0xe40a, 0xfc8b,
-  0xfc8b, 0xe40a, 0x20e0, 0xe702, 0xfe61, 0xe3c7, 0xa2c7, 0x0840,
-  0x1862, 0xc326, 0xf487, 0xfd65, 0xd386, 0x30a2, 0xaa28, 0xd2ca,
-  0xd2aa, 0xaa28, 0x3164, 0xe730, 0xfe63, 0xe3c7, 0x9287, 0x1042,
-  0x514f, 0x2082, 0xd367, 0xfc67, 0xf467, 0xc326, 0x38c2, 0xa208,
-  0xaa08, 0x3965, 0xd6d9, 0xff93, 0xfcc8, 0xd347, 0x2082, 0x514f,
-  0x5171, 0x1063, 0x92a6, 0xdba8, 0xfc68, 0xfc68, 0xc326, 0x28c1,
-  0x3143, 0xd6d9, 0xffd4, 0xf664, 0xdba7, 0x9286, 0x1063, 0x5171,
-  0x414d, 0x310a, 0x1882, 0x92a6, 0xdb88, 0xf468, 0xfc68, 0xe446,
-  0xe6a4, 0xff72, 0xf587, 0xd3a6, 0x69c5, 0x1862, 0x310a, 0x414d,
-  0x414c, 0x414c, 0x310a, 0x1882, 0x61a5, 0xa2c7, 0xd367, 0xdb87,
-  0xdbc7, 0xd3a8, 0xa2e7, 0x61a5, 0x1062, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x69c6, 0x71e6,
-  0x71e6, 0x69c6, 0x1041, 0x0821, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x30ea, 0x2923, 0xe623, 0xfee2,
-  0xfea3, 0xec86, 0x28c2, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x30ea, 0x2946, 0xd6ba, 0xffdb, 0xffb2,
-  0xff50, 0xee03, 0xcbc5, 0x28c3, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x310a, 0x2943, 0xd6da, 0xfffe, 0xff94, 0xe546,
-  0xd3c8, 0x7a26, 0x7a26, 0xc366, 0x28c2, 0x310a, 0x414d, 0x414d,
-  0x6192, 0x5171, 0x18a2, 0xd6a5, 0xfffc, 0xffd4, 0xe546, 0x28c0,
-  0x5965, 0x5126, 0x5126, 0x7a06, 0xb2e6, 0x1862, 0x5171, 0x61b2,
-  0x6193, 0x514f, 0x2923, 0xef5a, 0xfff3, 0xff64, 0xc365, 0x1841,
-  0x1841, 0x5165, 0x5125, 0x5146, 0x92a7, 0x2082, 0x5150, 0x61b3,
-  0x5971, 0x20a2, 0xd5a3, 0xffda, 0xffc5, 0xe523, 0x30c1, 0xaa48,
-  0xaa48, 0x1861, 0x61a6, 0x5946, 0x69e6, 0x8a86, 0x1883, 0x5991,
-  0x7a36, 0x18a1, 0xe622, 0xfff2, 0xff83, 0xcba6, 0x2081, 0xe42a,
-  0xe42a, 0x20a1, 0xc327, 0xaae7, 0x7207, 0x92a7, 0x1862, 0x7a36,
-  0x7a37, 0x20a2, 0xe621, 0xffd0, 0xf683, 0xa306, 0x2081, 0xe44a,
-  0xec4a, 0x28c1, 0xe406, 0xe3a8, 0xab08, 0x9ac7, 0x1862, 0x7a56,
-  0x7a37, 0x20a2, 0xe620, 0xffa3, 0xf584, 0x9ae7, 0x2081, 0xec4a,
-  0xec4b, 0x28e1, 0xe5a1, 0xfcc6, 0xe3a8, 0x9ac7, 0x1862, 0x7a56,
-  0x7a36, 0x18a2, 0xe600, 0xff81, 0xf4c7, 0x9ac7, 0x1881, 0xe42a,
-  0xe40a, 0x20c1, 0xe620, 0xfe61, 0xf487, 0xa2e7, 0x1862, 0x7a36,
-  0x5971, 0x2083, 0xd425, 0xfe42, 0xf487, 0xa2e7, 0x20a2, 0xaa48,
-  0xaa28, 0x3141, 0xe703, 0xfec1, 0xf487, 0x92a6, 0x1863, 0x5991,
-  0x6193, 0x5150, 0x28c2, 0xe426, 0xe3c8, 0xb328, 0x9287, 0x1041,
-  0x28c1, 0xd5e3, 0xffd8, 0xff64, 0xd3a6, 0x2082, 0x5150, 0x61b3,
-  0x6192, 0x5171, 0x1862, 0xbb06, 0xe388, 0xdb88, 0xa2e7, 0x20a1,
-  0xc365, 0xff84, 0xffd8, 0xf664, 0x9ae5, 0x1062, 0x5171, 0x61b2,
-  0x414d, 0x414d, 0x310a, 0x20a2, 0x9aa6, 0xd368, 0xab08, 0xa2e7,
-  0xec87, 0xf722, 0xf663, 0xc365, 0x2082, 0x310a, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x1882, 0x61c5, 0xa2e7, 0xa308,
-  0xab08, 0xab47, 0x92c6, 0x20a3, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x61a6, 0x69e6,
-  0x69e6, 0x61a6, 0x1862, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x414c, 0x30ea, 0x2920, 0xe620,
-  0xfde4, 0xec66, 0x20a2, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x2942, 0xd6a3, 0xffa3,
-  0xff42, 0xee02, 0x92c6, 0x2083, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x414d, 0x390c, 0x18a1, 0xd6a4, 0xfffa, 0xff92,
-  0xf4c8, 0xab27, 0x7206, 0x8266, 0x1062, 0x392c, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x6192, 0x514f, 0x2942, 0xef53, 0xfffc, 0xfe85,
-  0xdba7, 0x6166, 0x5126, 0x61a6, 0x1862, 0x514f, 0x6192, 0x6192,
-  0x61b2, 0x61b3, 0x5971, 0x20c2, 0xd6a3, 0xffdb, 0xffb3, 0xf585,
-  0xcb46, 0x69c6, 0x5126, 0x69c6, 0x8a86, 0x1883, 0x5971, 0x61b3,
-  0x61b3, 0x69b3, 0x5971, 0x18c1, 0xe743, 0xfffa, 0xffa6, 0xe466,
-  0x28a1, 0x61a6, 0x61c6, 0x69e6, 0x92a7, 0x1062, 0x5991, 0x69b3,
-  0x8278, 0x8a78, 0x7a36, 0x18c1, 0xe723, 0xfff2, 0xffa4, 0xe466,
-  0x2081, 0x9287, 0x7207, 0x69e6, 0x92a7, 0x1862, 0x7a36, 0x8a79,
-  0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe703, 0xfff0, 0xff83, 0xe466,
-  0x2081, 0xc327, 0xab08, 0x7a07, 0x92a7, 0x1862, 0x7a57, 0x8a99,
-  0x8a99, 0x8a99, 0x7a57, 0x1882, 0xe543, 0xff83, 0xfe81, 0xe426,
-  0x30e1, 0xe426, 0xe3a8, 0xab08, 0x9ac7, 0x1862, 0x7a57, 0x8a99,
-  0x8278, 0x8a78, 0x7a36, 0x1882, 0xe466, 0xfe61, 0xf583, 0xdba7,
-  0xab27, 0xf602, 0xfca6, 0xdba8, 0xa2c7, 0x1062, 0x7a36, 0x8a79,
-  0x61b3, 0x61b3, 0x5991, 0x2083, 0xd3e6, 0xfd64, 0xf544, 0xdba7,
-  0xb367, 0xf621, 0xfe41, 0xe3c7, 0x9286, 0x1863, 0x5991, 0x61b3,
-  0x61b2, 0x61b2, 0x6193, 0x5150, 0x28c2, 0xe426, 0xfc87, 0xdb87,
-  0xb328, 0xf4a6, 0xfe22, 0xcb86, 0x2082, 0x5150, 0x6193, 0x61b2,
-  0x6192, 0x6192, 0x6192, 0x5171, 0x1041, 0xcb47, 0xeba8, 0xdb88,
-  0xb328, 0xe3a8, 0xf467, 0xa307, 0x1041, 0x5170, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x414d, 0x392c, 0x1062, 0x92a6, 0xd368, 0xdb88,
-  0xb328, 0xd367, 0xdb68, 0x92a6, 0x1062, 0x392c, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x1882, 0x61c5, 0xa2e7,
-  0xa2e8, 0x7206, 0x61a5, 0x1882, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x61a6,
-  0x71e7, 0x59a6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x2921, 0xee42,
-  0xee43, 0x2921, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x390b, 0x18c1, 0xd685, 0xffda,
-  0xffba, 0xd5c2, 0x18a1, 0x390b, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x414d, 0x414d, 0x390b, 0x18a3, 0xe75a, 0xffff,
-  0xfffd, 0xef23, 0x18a0, 0x390c, 0x414d, 0x414d, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x6192, 0x6192, 0x5150, 0x18c4, 0xe73d, 0xffff,
-  0xfff3, 0xe742, 0x18c1, 0x5150, 0x6192, 0x6192, 0x6192, 0x6192,
-  0x61b2, 0x61b2, 0x61b2, 0x61b3, 0x5171, 0x18c4, 0xe73c, 0xfffd,
-  0xffe5, 0xe721, 0x18c1, 0x5171, 0x61b3, 0x61b2, 0x61b2, 0x61b2,
-  0x61b3, 0x61b3, 0x61b3, 0x61b3, 0x5971, 0x18c4, 0xe73b, 0xfff3,
-  0xffc2, 0xe640, 0x18a1, 0x5971, 0x69b3, 0x61b3, 0x61b3, 0x61b3,
-  0x8278, 0x8278, 0x8278, 0x8a78, 0x7a36, 0x18c3, 0xe730, 0xffe4,
-  0xffc1, 0xe620, 0x18a2, 0x7a36, 0x8a78, 0x8278, 0x8278, 0x8278,
-  0x8a99, 0x8a99, 0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe722, 0xffe1,
-  0xffa1, 0xe600, 0x18a2, 0x7a37, 0x8a99, 0x8a99, 0x8a99, 0x8a99,
-  0x8a99, 0x8a99, 0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe701, 0xffc1,
-  0xfec1, 0xe503, 0x18a2, 0x7a57, 0x8a99, 0x8a99, 0x8a99, 0x8a99,
-  0x8278, 0x8278, 0x8278, 0x8a78, 0x7a36, 0x18a2, 0xe600, 0xfea0,
-  0xfe61, 0xe446, 0x1882, 0x7a36, 0x8a78, 0x8278, 0x8278, 0x8278,
-  0x61b3, 0x61b3, 0x61b3, 0x61b3, 0x5971, 0x1881, 0xe4e3, 0xfd84,
-  0xfd64, 0xe426, 0x1882, 0x5991, 0x61b3, 0x61b3, 0x61b3, 0x61b3,
-  0x61b2, 0x61b2, 0x61b2, 0x61b3, 0x5171, 0x1862, 0xe406, 0xfc87,
-  0xfc67, 0xcb67, 0x1862, 0x5171, 0x61b3, 0x61b2, 0x61b2, 0x61b2,
-  0x6192, 0x6192, 0x6192, 0x6192, 0x5170, 0x1862, 0xcb47, 0xe3a8,
-  0xdb88, 0xa2e7, 0x1062, 0x5170, 0x6192, 0x6192, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x414d, 0x414d, 0x392c, 0x1041, 0xa2c7, 0xb328,
-  0xb328, 0x9aa7, 0x1041, 0x392b, 0x414d, 0x414d, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x390b, 0x1062, 0x8a86, 0xa2e8,
-  0x9ac7, 0x61a5, 0x1042, 0x392b, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x1862, 0x61c6,
-  0x61c6, 0x1061, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x20a2, 0xe446, 0xfdc4,
-  0xe620, 0x2920, 0x30ea, 0x412c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x412c, 0x310a, 0x2083, 0x92a6, 0xed25, 0xff42,
-  0xffa3, 0xd6a3, 0x2942, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x392c, 0x1062, 0x8266, 0x7207, 0xab07, 0xf4c8,
-  0xff92, 0xfffa, 0xd6a4, 0x18a1, 0x390c, 0x414d, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x514f, 0x1862, 0x61a6, 0x5126, 0x6166, 0xdba7,
-  0xfe85, 0xfffc, 0xef53, 0x2942, 0x514f, 0x6192, 0x6192, 0x6192,
-  0x61b3, 0x5971, 0x1863, 0x8a86, 0x69c6, 0x5126, 0x69a6, 0xcb46,
-  0xf565, 0xffb3, 0xffdb, 0xd6a4, 0x20c2, 0x5971, 0x61b3, 0x61b2,
-  0x69b3, 0x5991, 0x1062, 0x92a7, 0x71e7, 0x61c6, 0x61a6, 0x28a1,
-  0xe466, 0xffa6, 0xfffa, 0xe744, 0x18c1, 0x5971, 0x69b3, 0x61b3,
-  0x8a78, 0x7a36, 0x1862, 0x92a7, 0x69e6, 0x7207, 0x9287, 0x1881,
-  0xe446, 0xffa4, 0xfff2, 0xe723, 0x18c1, 0x7a36, 0x8a78, 0x8278,
-  0x8a99, 0x7a57, 0x1862, 0x92a7, 0x7a07, 0xaae8, 0xcb27, 0x2081,
-  0xe446, 0xff83, 0xfff0, 0xe703, 0x18c1, 0x7a37, 0x8a99, 0x8a99,
-  0x8a99, 0x7a57, 0x1862, 0x9ac7, 0xab08, 0xe3a8, 0xe426, 0x30e1,
-  0xe426, 0xfe81, 0xff83, 0xe543, 0x18a2, 0x7a57, 0x8a99, 0x8a99,
-  0x8a78, 0x7a36, 0x1062, 0x9ac7, 0xdb88, 0xfca6, 0xf602, 0xab27,
-  0xdba7, 0xf583, 0xfe61, 0xe466, 0x1882, 0x7a36, 0x8a78, 0x8278,
-  0x61b3, 0x5991, 0x1863, 0x9286, 0xe3c7, 0xfe41, 0xf621, 0xb367,
-  0xdba7, 0xf544, 0xfd64, 0xd3e6, 0x2083, 0x5991, 0x61b3, 0x61b3,
-  0x61b2, 0x6193, 0x5150, 0x2082, 0xcb66, 0xfe22, 0xf4a6, 0xb328,
-  0xdb88, 0xfc67, 0xe427, 0x28c2, 0x5170, 0x6193, 0x61b2, 0x61b2,
-  0x6192, 0x6192, 0x5171, 0x1042, 0xa2e7, 0xf467, 0xe3a8, 0xb328,
-  0xdb88, 0xeba8, 0xcb27, 0x1041, 0x5170, 0x6192, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x392c, 0x1062, 0x9286, 0xdb68, 0xd367, 0xb328,
-  0xdb88, 0xd347, 0x69c5, 0x1042, 0x392c, 0x414d, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x412c, 0x310a, 0x1883, 0x61a5, 0x7206, 0xa2c8,
-  0xa2e8, 0x61a5, 0x1062, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x59a6, 0x71e7,
-  0x61c6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x28c2, 0xec86, 0xfea3,
-  0xfee2, 0xe643, 0x2923, 0x30ea, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x28c3, 0xcbc6, 0xee03, 0xff50,
-  0xff92, 0xffdb, 0xd6ba, 0x2946, 0x30ea, 0x412c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x310a, 0x28c2, 0xc366, 0x7a26, 0x7a26, 0xd3a8,
-  0xe546, 0xff94, 0xfffe, 0xdeda, 0x2943, 0x310a, 0x414d, 0x414d,
-  0x6192, 0x5971, 0x1862, 0xb2e6, 0x7a06, 0x5126, 0x5126, 0x5965,
-  0x28c0, 0xe546, 0xffd4, 0xfffc, 0xd6a5, 0x18a2, 0x5171, 0x61b2,
-  0x6193, 0x5170, 0x2082, 0x92a7, 0x5946, 0x5125, 0x5165, 0x0882,
-  0x1062, 0xc366, 0xff45, 0xfff3, 0xef5a, 0x2923, 0x514f, 0x61b3,
-  0x5991, 0x1883, 0x8a86, 0x71e6, 0x5946, 0x61a5, 0x1082, 0x3396,
-  0x33b7, 0x20e3, 0xe485, 0xffa6, 0xffda, 0xd5c3, 0x20a2, 0x5971,
-  0x7a36, 0x1862, 0x92a7, 0x7207, 0xaae7, 0xc327, 0x18a2, 0x4d3a,
-  0x4d3a, 0x10a2, 0xcb86, 0xff63, 0xfff2, 0xe622, 0x20a1, 0x7236,
-  0x7a56, 0x1863, 0x9ac7, 0xab08, 0xe3a8, 0xe406, 0x18c2, 0x555a,
-  0x555a, 0x10a3, 0xa306, 0xf683, 0xffd0, 0xe622, 0x20c2, 0x7a37,
-  0x7a56, 0x1863, 0x9ac7, 0xe3a8, 0xfcc6, 0xe5a1, 0x1902, 0x553a,
-  0x555a, 0x10a3, 0x9ae6, 0xf564, 0xffa3, 0xe620, 0x20c2, 0x7a37,
-  0x7a36, 0x1862, 0xa2e7, 0xf487, 0xfe61, 0xe620, 0x18e2, 0x4d3a,
-  0x4d3a, 0x10a2, 0xa2c7, 0xf4a7, 0xff81, 0xe600, 0x20a2, 0x7236,
-  0x5991, 0x1863, 0x92a6, 0xf487, 0xfea1, 0xe703, 0x2962, 0x3396,
-  0x3396, 0x18c3, 0xa2c7, 0xf487, 0xfe42, 0xd425, 0x2083, 0x5971,
-  0x6193, 0x5150, 0x2082, 0xd3a6, 0xff64, 0xffd8, 0xd5e3, 0x20e2,
-  0x0862, 0x92a7, 0xb328, 0xe3c8, 0xe426, 0x28c2, 0x5150, 0x61b3,
-  0x6192, 0x5971, 0x1042, 0x92c5, 0xf644, 0xffd8, 0xff84, 0xc365,
-  0x28a1, 0xa2c7, 0xdb88, 0xe388, 0xc306, 0x1862, 0x5171, 0x61b2,
-  0x414d, 0x414d, 0x310a, 0x2082, 0xc365, 0xf663, 0xf722, 0xec87,
-  0xa2e7, 0xab08, 0xd368, 0x9aa6, 0x20a2, 0x310a, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x20a3, 0x92c6, 0xab47, 0xab08,
-  0xa308, 0xa2e7, 0x61c5, 0x1882, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1862, 0x61a6, 0x69e6,
-  0x69e6, 0x61c6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x30ea, 0x28c1, 0xec66, 0xfde4, 0xffc2,
-  0xffe3, 0xef43, 0x2942, 0x10a2, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x28e2, 0xd4a3, 0xee02, 0xef02, 0xef43,
-  0xf790, 0xffb2, 0xef5a, 0xd6b3, 0x2945, 0x30ea, 0x412c, 0x414c,
-  0x414d, 0x310a, 0x28e2, 0xd484, 0xec47, 0x7a46, 0x61a5, 0x6a05,
-  0xa327, 0xed67, 0xff94, 0xfffd, 0xdedb, 0x2945, 0x310a, 0x414d,
-  0x5171, 0x1882, 0xd483, 0xf467, 0x7a06, 0x5126, 0x5145, 0x1063,
-  0x1082, 0x6a05, 0xed66, 0xff94, 0xfffd, 0xd6b3, 0x18c3, 0x5170,
-  0x514f, 0x20a2, 0xe427, 0xdb88, 0x71e6, 0x5165, 0x18c4, 0x3396,
-  0x3377, 0x18c4, 0x9ac6, 0xe546, 0xffd5, 0xef7b, 0x2924, 0x514f,
-  0x1042, 0x92a7, 0xec28, 0xbb48, 0x9aa7, 0x18a3, 0x3396, 0x445b,
-  0x445b, 0x3b96, 0x1082, 0x61c5, 0xf753, 0xffdc, 0xd4c6, 0x1881,
-  0x0820, 0xa2c7, 0xe3a8, 0xe388, 0xcb47, 0x18a2, 0x4d19, 0x5dbc,
-  0x5dbc, 0x4d3a, 0x1082, 0x9ae6, 0xf766, 0xffda, 0xe526, 0x1060,
-  0x0840, 0x9ac7, 0xdb88, 0xebc8, 0xe406, 0x18c2, 0x4d39, 0x5ddc,
-  0x5ddc, 0x5539, 0x10a3, 0xa326, 0xf783, 0xffd1, 0xe505, 0x1060,
-  0x0840, 0x9ac7, 0xe3a8, 0xfc87, 0xe4e3, 0x18e2, 0x4d39, 0x5ddc,
-  0x5ddc, 0x5539, 0x10a3, 0xa326, 0xf782, 0xff83, 0xe466, 0x1040,
-  0x0820, 0x9ac7, 0xe3a7, 0xfd84, 0xe6c2, 0x1902, 0x4d19, 0x5dbc,
-  0x5dbc, 0x4d3a, 0x10a2, 0xcb86, 0xff22, 0xfdc4, 0xe407, 0x1040,
-  0x1042, 0x9287, 0xe3a7, 0xfd86, 0xef10, 0x2985, 0x3376, 0x445b,
-  0x445b, 0x3396, 0x20c3, 0xd386, 0xfd64, 0xf487, 0xc326, 0x1862,
-  0x514f, 0x2082, 0xcb47, 0xfca8, 0xff93, 0xded9, 0x29a8, 0x3376,
-  0x3376, 0x2904, 0xc326, 0xf467, 0xfc67, 0xd367, 0x28a2, 0x514f,
-  0x5171, 0x1063, 0x9286, 0xdba7, 0xf644, 0xffb3, 0xded9, 0x2964,
-  0x20c2, 0xc326, 0xfc67, 0xfc68, 0xe3a8, 0x92a6, 0x1063, 0x5171,
-  0x414d, 0x310a, 0x1862, 0x69c5, 0xd3a6, 0xf587, 0xff72, 0xe6a4,
-  0xe446, 0xfc68, 0xf468, 0xdb88, 0x9aa6, 0x1882, 0x310a, 0x414d,
-  0x414c, 0x414c, 0x310a, 0x1062, 0x61a5, 0xa2e7, 0xd3a8, 0xdbc7,
-  0xdb87, 0xd367, 0xa2c7, 0x61a5, 0x1882, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x69c6, 0x71e6,
-  0x71e6, 0x69c6, 0x1041, 0x0821, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x1061, 0x2100, 0xe640, 0xffe5, 0xfffc,
-  0xffff, 0xfffc, 0xef46, 0x2942, 0x10a2, 0x310a, 0x412c, 0x414c,
-  0x414c, 0x310a, 0x28e2, 0xd4c3, 0xe642, 0xff82, 0xf790, 0xef54,
-  0xef54, 0xf795, 0xffba, 0xef5b, 0xd6b3, 0x2945, 0x30ea, 0x414c,
-  0x310a, 0x28e2, 0xd503, 0xff85, 0xff8f, 0xee43, 0xa347, 0x5986,
-  0x5986, 0xa327, 0xe548, 0xff74, 0xfffd, 0xdeda, 0x2945, 0x310a,
-  0x1061, 0xd4c2, 0xff83, 0xff50, 0xd3e9, 0x9ac6, 0x18a2, 0x0842,
-  0x0842, 0x1082, 0x5144, 0xa348, 0xf734, 0xfffd, 0xd6b3, 0x10a2,
-  0x20c0, 0xe620, 0xff82, 0xeca7, 0x2060, 0x10a4, 0x3376, 0x3bd8,
-  0x3bd8, 0x3376, 0x0884, 0x1040, 0xa348, 0xff74, 0xef5b, 0x2942,
-  0xd3a6, 0xf742, 0xf681, 0xc345, 0x18e4, 0x3396, 0x445b, 0x445b,
-  0x445b, 0x445b, 0x3bb7, 0x08a4, 0x5144, 0xe548, 0xffba, 0xef44,
-  0xe3e7, 0xff42, 0xe543, 0x2902, 0x4cd8, 0x5dbc, 0x559c, 0x559c,
-  0x559c, 0x559c, 0x5dbc, 0x4cd8, 0x10a2, 0xa348, 0xf79a, 0xffe4,
-  0xb367, 0xf641, 0xe522, 0x18c2, 0x4d3a, 0x5ddc, 0x5dbc, 0x5dbc,
-  0x5dbc, 0x5dbc, 0x5ddc, 0x555a, 0x10a2, 0xa308, 0xf771, 0xffe3,
-  0xab27, 0xf564, 0xe6c3, 0x1902, 0x4d3a, 0x5ddc, 0x5dbc, 0x5dbc,
-  0x5dbc, 0x5dbc, 0x5ddc, 0x555a, 0x10a2, 0x9b06, 0xf763, 0xffc1,
-  0xaae7, 0xe408, 0xe6cf, 0x29a6, 0x4cd7, 0x5dbc, 0x559c, 0x559c,
-  0x559c, 0x559c, 0x5dbc, 0x4cd8, 0x18c3, 0xab26, 0xf742, 0xf5c4,
-  0x69e6, 0xd367, 0xfd88, 0xd696, 0x1926, 0x3376, 0x445b, 0x445b,
-  0x445b, 0x445b, 0x3396, 0x10c4, 0x9aa6, 0xf4c7, 0xf6e3, 0xab66,
-  0x1041, 0x9ac7, 0xe407, 0xeea4, 0x2140, 0x1905, 0x3376, 0x3bb8,
-  0x3bb8, 0x3376, 0x10c4, 0x2080, 0xd3e6, 0xfec3, 0xd3e6, 0x1861,
-  0x0821, 0x59a5, 0xaae8, 0xdc06, 0xeec4, 0xd696, 0x2986, 0x1902,
-  0x1902, 0x2102, 0xc326, 0xec66, 0xf5c2, 0xe407, 0x9286, 0x1041,
-  0x310a, 0x1062, 0x61a5, 0xaae8, 0xe407, 0xf588, 0xeecf, 0xe6e3,
-  0xe6c1, 0xe5c1, 0xfc87, 0xf505, 0xe3e7, 0x9aa6, 0x2083, 0x310a,
-  0x414c, 0x310a, 0x1062, 0x61a5, 0x9aa7, 0xab27, 0xd3c8, 0xdbc7,
-  0xdbc7, 0xdba7, 0xd367, 0xa307, 0x9286, 0x2083, 0x310a, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x61c6, 0x71e6, 0x71e6,
-  0x71e6, 0x71e6, 0x69c6, 0x1041, 0x1041, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x10a0, 0x2942, 0xef46, 0xfffc, 0xfffe,
-  0xfffc, 0xffe5, 0xee60, 0x2900, 0x1061, 0x310a, 0x414c, 0x414c,
-  0x412c, 0x30ea, 0x2944, 0xd6a5, 0xef59, 0xffba, 0xf795, 0xef54,
-  0xef54, 0xf791, 0xff82, 0xe642, 0xd4c3, 0x28e2, 0x30ea, 0x414c,
-  0x310a, 0x2945, 0xd6da, 0xfffc, 0xff74, 0xe548, 0xa327, 0x5986,
-  0x5986, 0xa327, 0xee43, 0xff8f, 0xffa5, 0xd503, 0x28e2, 0x310a,
-  0x1082, 0xd693, 0xfffd, 0xf734, 0xa369, 0x5144, 0x1082, 0x0842,
-  0x0842, 0x18a2, 0x9ac6, 0xd3e9, 0xff50, 0xffa3, 0xd4c2, 0x1061,
-  0x2142, 0xef5b, 0xff74, 0xa369, 0x1040, 0x0884, 0x3376, 0x3bd8,
-  0x3bd8, 0x3376, 0x10a4, 0x2060, 0xe487, 0xff82, 0xe640, 0x20c0,
-  0xef44, 0xffba, 0xe548, 0x5144, 0x08a4, 0x33b6, 0x445b, 0x445b,
-  0x445b, 0x445b, 0x3397, 0x18e4, 0xc346, 0xf681, 0xf742, 0xd3a6,
-  0xffe4, 0xff9a, 0xa349, 0x18a2, 0x4cd8, 0x5dbc, 0x559c, 0x559c,
-  0x559c, 0x559c, 0x5dbc, 0x4cd8, 0x2903, 0xe523, 0xff42, 0xe407,
-  0xffe3, 0xf791, 0xa308, 0x10a2, 0x555a, 0x5ddc, 0x5dbc, 0x5dbc,
-  0x5dbc, 0x5dbc, 0x5ddc, 0x4d3a, 0x18c2, 0xe522, 0xf641, 0xb367,
-  0xffa1, 0xf763, 0xa326, 0x1082, 0x555a, 0x5ddc, 0x5dbc, 0x5dbc,
-  0x5dbc, 0x5dbc, 0x5ddc, 0x4d3a, 0x1902, 0xe6c3, 0xf564, 0xb327,
-  0xf5a4, 0xf742, 0xab46, 0x18c3, 0x4cd7, 0x5dbc, 0x559c, 0x559c,
-  0x559c, 0x559c, 0x5dbc, 0x4cd8, 0x2986, 0xe6cf, 0xe408, 0xaae8,
-  0xab66, 0xf6e3, 0xf4e7, 0x9aa6, 0x10c4, 0x3396, 0x445b, 0x445b,
-  0x445b, 0x445b, 0x3376, 0x1926, 0xd696, 0xfd88, 0xd387, 0x69e6,
-  0x1861, 0xd3c6, 0xfec3, 0xd3e6, 0x2080, 0x10c4, 0x3376, 0x3bb8,
-  0x3bb8, 0x3376, 0x1906, 0x2120, 0xe6a4, 0xe407, 0x9ac7, 0x1041,
-  0x1041, 0x9286, 0xe407, 0xf5c2, 0xec66, 0xc326, 0x2902, 0x1902,
-  0x1902, 0x2965, 0xd696, 0xeec4, 0xdc06, 0xaae8, 0x59a5, 0x0821,
-  0x310a, 0x1883, 0x92a6, 0xdbe7, 0xf505, 0xfc87, 0xe5c1, 0xe6c1,
-  0xe6e3, 0xeecf, 0xf588, 0xe407, 0xaae8, 0x61a5, 0x1062, 0x310a,
-  0x414c, 0x310a, 0x2083, 0x9286, 0xa307, 0xd367, 0xdba7, 0xdbc7,
-  0xdbc7, 0xdbc8, 0xab27, 0x9aa7, 0x61a5, 0x1062, 0x310a, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x1041, 0x1041, 0x69c6, 0x71e6, 0x71e6,
-  0x71e6, 0x71e6, 0x61c6, 0x1041, 0x0821, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x10a2, 0x2943, 0xef43, 0xffe3,
-  0xffc2, 0xfde4, 0xec86, 0x28e1, 0x30ea, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x30ea, 0x2945, 0xd693, 0xef59, 0xffb2, 0xf790,
-  0xef43, 0xef02, 0xee02, 0xd4a3, 0x28e2, 0x30ea, 0x414c, 0x414c,
-  0x414d, 0x310a, 0x2945, 0xd6db, 0xfffc, 0xffa6, 0xed65, 0xa327,
-  0x6a05, 0x61a5, 0x7a46, 0xe447, 0xd484, 0x28e2, 0x310a, 0x414d,
-  0x5170, 0x18a3, 0xd6b3, 0xfffd, 0xff94, 0xed65, 0x6a04, 0x1082,
-  0x1063, 0x5145, 0x5126, 0x7a06, 0xf467, 0xd483, 0x1882, 0x5171,
-  0x514f, 0x2904, 0xef5b, 0xffd5, 0xed66, 0x9ae6, 0x18c4, 0x3376,
-  0x3397, 0x10c4, 0x5165, 0x71e6, 0xdb88, 0xec27, 0x20a2, 0x514f,
-  0x1881, 0xd4c5, 0xffbc, 0xf773, 0x7a66, 0x1082, 0x3396, 0x445b,
-  0x445b, 0x3396, 0x18a3, 0x9aa7, 0xbb48, 0xec28, 0x92a7, 0x1042,
-  0x1060, 0xe526, 0xffda, 0xf786, 0x9b06, 0x1082, 0x4d19, 0x5dbc,
-  0x5dbc, 0x4d3a, 0x10a2, 0xcb27, 0xe388, 0xe3a8, 0xa2e7, 0x0840,
-  0x1060, 0xe505, 0xffd1, 0xf783, 0xa326, 0x10a3, 0x5539, 0x5ddc,
-  0x5ddc, 0x4d39, 0x18c2, 0xe406, 0xebc8, 0xdb88, 0x9ac7, 0x0840,
-  0x1040, 0xe466, 0xff83, 0xf782, 0xa326, 0x10a3, 0x5539, 0x5ddc,
-  0x5ddc, 0x4d39, 0x1902, 0xe5c1, 0xfcc6, 0xe3a8, 0x9ac7, 0x0840,
-  0x1040, 0xe407, 0xfdc4, 0xff22, 0xcb86, 0x10a2, 0x4d19, 0x5dbc,
-  0x5dbc, 0x4d1a, 0x1902, 0xe702, 0xfe61, 0xe3c7, 0xa2c7, 0x0840,
-  0x1862, 0xc326, 0xf487, 0xfd65, 0xd386, 0x20c3, 0x3396, 0x445b,
-  0x445b, 0x3396, 0x2965, 0xe730, 0xfe63, 0xe3c7, 0x9287, 0x1042,
-  0x514f, 0x2082, 0xd367, 0xfc67, 0xf467, 0xc326, 0x2904, 0x3376,
-  0x3376, 0x29a8, 0xd6d9, 0xff93, 0xfcc8, 0xd347, 0x2082, 0x514f,
-  0x5171, 0x1063, 0x92a6, 0xdba8, 0xfc68, 0xfc67, 0xc326, 0x20c2,
-  0x2164, 0xded9, 0xffb4, 0xf664, 0xdba7, 0x9286, 0x1063, 0x5171,
-  0x414d, 0x310a, 0x1882, 0x92a6, 0xdb88, 0xf468, 0xfc68, 0xe446,
-  0xe6a3, 0xff72, 0xf587, 0xd3a6, 0x69c5, 0x1862, 0x310a, 0x414d,
-  0x414c, 0x414c, 0x310a, 0x1882, 0x61a5, 0xa2c7, 0xd367, 0xdb87,
-  0xdbc7, 0xd3a8, 0xa2e7, 0x61a5, 0x1062, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x69c6, 0x71e6,
-  0x71e6, 0x69c6, 0x1041, 0x0821, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x30ea, 0x2923, 0xe623, 0xfee2,
-  0xfea3, 0xec86, 0x28c2, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x30ea, 0x2946, 0xd6ba, 0xffdb, 0xffb2,
-  0xff50, 0xee03, 0xcbc5, 0x28c3, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x310a, 0x2943, 0xd6da, 0xfffe, 0xff94, 0xe546,
-  0xd3c8, 0x7a26, 0x7a26, 0xc366, 0x28c2, 0x310a, 0x414d, 0x414d,
-  0x6192, 0x5171, 0x18a2, 0xd6a5, 0xfffc, 0xffd4, 0xe546, 0x28c0,
-  0x5965, 0x5126, 0x5126, 0x7a06, 0xb2e6, 0x1862, 0x5171, 0x61b2,
-  0x6193, 0x514f, 0x2923, 0xef5a, 0xfff3, 0xff64, 0xc366, 0x1062,
-  0x0862, 0x5165, 0x5125, 0x5146, 0x92a7, 0x2082, 0x5150, 0x61b3,
-  0x5971, 0x20a2, 0xd5a3, 0xffda, 0xffc5, 0xe523, 0x28e2, 0x3396,
-  0x33b7, 0x1083, 0x61a5, 0x5946, 0x69e6, 0x8a86, 0x1883, 0x5991,
-  0x7a36, 0x18a1, 0xe622, 0xfff2, 0xff83, 0xcba6, 0x10a2, 0x4d3a,
-  0x4d3a, 0x18a2, 0xc326, 0xaae7, 0x7207, 0x92a7, 0x1862, 0x7a36,
-  0x7a37, 0x20a2, 0xe621, 0xffd0, 0xf683, 0xa306, 0x10a3, 0x555a,
-  0x555a, 0x18c2, 0xe406, 0xe3a8, 0xab08, 0x9ac7, 0x1862, 0x7a56,
-  0x7a37, 0x20a2, 0xe620, 0xffa3, 0xf584, 0xa2e6, 0x10a2, 0x555a,
-  0x555a, 0x18e2, 0xe5a1, 0xfcc6, 0xe3a8, 0x9ac7, 0x1862, 0x7a56,
-  0x7a36, 0x18a2, 0xe600, 0xff81, 0xf4c7, 0xa2c7, 0x10a2, 0x4d3a,
-  0x4d3a, 0x18e2, 0xe600, 0xfe61, 0xf487, 0xa2e7, 0x1862, 0x7a36,
-  0x5971, 0x2083, 0xd425, 0xfe42, 0xf487, 0xa2e7, 0x18c3, 0x3396,
-  0x3396, 0x2962, 0xe703, 0xfec1, 0xf487, 0x92a6, 0x1863, 0x5991,
-  0x6193, 0x5150, 0x28c2, 0xe426, 0xe3c8, 0xb328, 0x92a7, 0x0862,
-  0x20e2, 0xd5e3, 0xffd8, 0xff64, 0xd3a6, 0x2082, 0x5150, 0x61b3,
-  0x6192, 0x5171, 0x1862, 0xbb06, 0xe388, 0xdb88, 0xa2e7, 0x28a1,
-  0xc365, 0xff84, 0xffd8, 0xf664, 0x9ae5, 0x1062, 0x5171, 0x61b2,
-  0x414d, 0x414d, 0x310a, 0x20a2, 0x9aa6, 0xd368, 0xab08, 0xa2e7,
-  0xec87, 0xf722, 0xf663, 0xc365, 0x2082, 0x310a, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x1882, 0x61c5, 0xa2e7, 0xa308,
-  0xab08, 0xab47, 0x92c6, 0x20a3, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x61a6, 0x69e6,
-  0x69e6, 0x61a6, 0x1862, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x414c, 0x30ea, 0x2920, 0xe620,
-  0xfde4, 0xec66, 0x20a2, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x2942, 0xd6a3, 0xffa3,
-  0xff42, 0xee02, 0x92c6, 0x2083, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x414d, 0x390c, 0x18a1, 0xd6a4, 0xfffa, 0xff92,
-  0xf4c8, 0xab27, 0x7206, 0x8266, 0x1062, 0x392c, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x6192, 0x514f, 0x2942, 0xef53, 0xfffc, 0xfe85,
-  0xdba7, 0x6166, 0x5126, 0x61a6, 0x1862, 0x514f, 0x6192, 0x6192,
-  0x61b2, 0x61b3, 0x5971, 0x20c2, 0xd6a3, 0xffdb, 0xffb3, 0xf585,
-  0xcb46, 0x69c6, 0x5126, 0x69c6, 0x8a86, 0x1883, 0x5971, 0x61b3,
-  0x61b3, 0x69b3, 0x5971, 0x18c1, 0xe743, 0xfffa, 0xffa6, 0xe466,
-  0x28a1, 0x61a6, 0x61c6, 0x69e6, 0x92a7, 0x1062, 0x5991, 0x69b3,
-  0x8278, 0x8a78, 0x7a36, 0x18c1, 0xe723, 0xfff2, 0xffa4, 0xe466,
-  0x2081, 0x9287, 0x7207, 0x69e6, 0x92a7, 0x1862, 0x7a36, 0x8a79,
-  0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe703, 0xfff0, 0xff83, 0xe466,
-  0x2081, 0xc327, 0xab08, 0x7a07, 0x92a7, 0x1862, 0x7a57, 0x8a99,
-  0x8a99, 0x8a99, 0x7a57, 0x1882, 0xe543, 0xff83, 0xfe81, 0xe426,
-  0x30e1, 0xe426, 0xe3a8, 0xab08, 0x9ac7, 0x1862, 0x7a57, 0x8a99,
-  0x8278, 0x8a78, 0x7a36, 0x1882, 0xe466, 0xfe61, 0xf583, 0xdba7,
-  0xab27, 0xf602, 0xfca6, 0xdba8, 0xa2c7, 0x1062, 0x7a36, 0x8a79,
-  0x61b3, 0x61b3, 0x5991, 0x2083, 0xd3e6, 0xfd64, 0xf544, 0xdba7,
-  0xb367, 0xf621, 0xfe41, 0xe3c7, 0x9286, 0x1863, 0x5991, 0x61b3,
-  0x61b2, 0x61b2, 0x6193, 0x5150, 0x28c2, 0xe426, 0xfc87, 0xdb87,
-  0xb328, 0xf4a6, 0xfe22, 0xcb86, 0x2082, 0x5150, 0x6193, 0x61b2,
-  0x6192, 0x6192, 0x6192, 0x5171, 0x1041, 0xcb47, 0xeba8, 0xdb88,
-  0xb328, 0xe3a8, 0xf467, 0xa307, 0x1041, 0x5170, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x414d, 0x392c, 0x1062, 0x92a6, 0xd368, 0xdb88,
-  0xb328, 0xd367, 0xdb68, 0x92a6, 0x1062, 0x392c, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x1882, 0x61c5, 0xa2e7,
-  0xa2e8, 0x7206, 0x61a5, 0x1882, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x61a6,
-  0x71e7, 0x59a6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x2921, 0xee42,
-  0xee43, 0x2921, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x390b, 0x18c1, 0xd685, 0xffda,
-  0xffba, 0xd5c2, 0x18a1, 0x390b, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x414d, 0x414d, 0x390b, 0x18a3, 0xe75a, 0xffff,
-  0xfffd, 0xef23, 0x18a0, 0x390c, 0x414d, 0x414d, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x6192, 0x6192, 0x5150, 0x18c4, 0xe73d, 0xffff,
-  0xfff3, 0xe742, 0x18c1, 0x5150, 0x6192, 0x6192, 0x6192, 0x6192,
-  0x61b2, 0x61b2, 0x61b2, 0x61b3, 0x5171, 0x18c4, 0xe73c, 0xfffd,
-  0xffe5, 0xe721, 0x18c1, 0x5171, 0x61b3, 0x61b2, 0x61b2, 0x61b2,
-  0x61b3, 0x61b3, 0x61b3, 0x61b3, 0x5971, 0x18c4, 0xe73b, 0xfff3,
-  0xffc2, 0xe640, 0x18a1, 0x5971, 0x69b3, 0x61b3, 0x61b3, 0x61b3,
-  0x8278, 0x8278, 0x8278, 0x8a78, 0x7a36, 0x18c3, 0xe730, 0xffe4,
-  0xffc1, 0xe620, 0x18a2, 0x7a36, 0x8a78, 0x8278, 0x8278, 0x8278,
-  0x8a99, 0x8a99, 0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe722, 0xffe1,
-  0xffa1, 0xe600, 0x18a2, 0x7a37, 0x8a99, 0x8a99, 0x8a99, 0x8a99,
-  0x8a99, 0x8a99, 0x8a99, 0x8a99, 0x7a37, 0x18c2, 0xe701, 0xffc1,
-  0xfec1, 0xe503, 0x18a2, 0x7a57, 0x8a99, 0x8a99, 0x8a99, 0x8a99,
-  0x8278, 0x8278, 0x8278, 0x8a78, 0x7a36, 0x18a2, 0xe600, 0xfea0,
-  0xfe61, 0xe446, 0x1882, 0x7a36, 0x8a78, 0x8278, 0x8278, 0x8278,
-  0x61b3, 0x61b3, 0x61b3, 0x61b3, 0x5971, 0x1881, 0xe4e3, 0xfd84,
-  0xfd64, 0xe426, 0x1882, 0x5991, 0x61b3, 0x61b3, 0x61b3, 0x61b3,
-  0x61b2, 0x61b2, 0x61b2, 0x61b3, 0x5171, 0x1862, 0xe406, 0xfc87,
-  0xfc67, 0xcb67, 0x1862, 0x5171, 0x61b3, 0x61b2, 0x61b2, 0x61b2,
-  0x6192, 0x6192, 0x6192, 0x6192, 0x5170, 0x1862, 0xcb47, 0xe3a8,
-  0xdb88, 0xa2e7, 0x1062, 0x5170, 0x6192, 0x6192, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x414d, 0x414d, 0x392c, 0x1041, 0xa2c7, 0xb328,
-  0xb328, 0x9aa7, 0x1041, 0x392b, 0x414d, 0x414d, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x390b, 0x1062, 0x8a86, 0xa2e8,
-  0x9ac7, 0x61a5, 0x1042, 0x392b, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x412c, 0x310a, 0x1862, 0x61c6,
-  0x61c6, 0x1061, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x20a2, 0xe446, 0xfdc4,
-  0xe620, 0x2920, 0x30ea, 0x412c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x412c, 0x310a, 0x2083, 0x92a6, 0xed25, 0xff42,
-  0xffa3, 0xd6a3, 0x2942, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x392c, 0x1062, 0x8266, 0x7207, 0xab07, 0xf4c8,
-  0xff92, 0xfffa, 0xd6a4, 0x18a1, 0x390c, 0x414d, 0x414d, 0x414d,
-  0x6192, 0x6192, 0x514f, 0x1862, 0x61a6, 0x5126, 0x6166, 0xdba7,
-  0xfe85, 0xfffc, 0xef53, 0x2942, 0x514f, 0x6192, 0x6192, 0x6192,
-  0x61b3, 0x5971, 0x1863, 0x8a86, 0x69c6, 0x5126, 0x69a6, 0xcb46,
-  0xf565, 0xffb3, 0xffdb, 0xd6a4, 0x20c2, 0x5971, 0x61b3, 0x61b2,
-  0x69b3, 0x5991, 0x1062, 0x92a7, 0x71e7, 0x61c6, 0x61a6, 0x28a1,
-  0xe466, 0xffa6, 0xfffa, 0xe744, 0x18c1, 0x5971, 0x69b3, 0x61b3,
-  0x8a78, 0x7a36, 0x1862, 0x92a7, 0x69e6, 0x7207, 0x9287, 0x1881,
-  0xe446, 0xffa4, 0xfff2, 0xe723, 0x18c1, 0x7a36, 0x8a78, 0x8278,
-  0x8a99, 0x7a57, 0x1862, 0x92a7, 0x7a07, 0xaae8, 0xcb27, 0x2081,
-  0xe446, 0xff83, 0xfff0, 0xe703, 0x18c1, 0x7a37, 0x8a99, 0x8a99,
-  0x8a99, 0x7a57, 0x1862, 0x9ac7, 0xab08, 0xe3a8, 0xe426, 0x30e1,
-  0xe426, 0xfe81, 0xff83, 0xe543, 0x18a2, 0x7a57, 0x8a99, 0x8a99,
-  0x8a78, 0x7a36, 0x1062, 0x9ac7, 0xdb88, 0xfca6, 0xf602, 0xab27,
-  0xdba7, 0xf583, 0xfe61, 0xe466, 0x1882, 0x7a36, 0x8a78, 0x8278,
-  0x61b3, 0x5991, 0x1863, 0x9286, 0xe3c7, 0xfe41, 0xf621, 0xb367,
-  0xdba7, 0xf544, 0xfd64, 0xd3e6, 0x2083, 0x5991, 0x61b3, 0x61b3,
-  0x61b2, 0x6193, 0x5150, 0x2082, 0xcb66, 0xfe22, 0xf4a6, 0xb328,
-  0xdb88, 0xfc67, 0xe427, 0x28c2, 0x5170, 0x6193, 0x61b2, 0x61b2,
-  0x6192, 0x6192, 0x5171, 0x1042, 0xa2e7, 0xf467, 0xe3a8, 0xb328,
-  0xdb88, 0xeba8, 0xcb27, 0x1041, 0x5170, 0x6192, 0x6192, 0x6192,
-  0x414d, 0x414d, 0x392c, 0x1062, 0x9286, 0xdb68, 0xd367, 0xb328,
-  0xdb88, 0xd347, 0x69c5, 0x1042, 0x392c, 0x414d, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x412c, 0x310a, 0x1883, 0x61a5, 0x7206, 0xa2c8,
-  0xa2e8, 0x61a5, 0x1062, 0x310a, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1042, 0x59a6, 0x71e7,
-  0x61c6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x28c2, 0xec86, 0xfea3,
-  0xfee2, 0xe643, 0x2923, 0x30ea, 0x412c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x28c3, 0xcbc6, 0xee03, 0xff50,
-  0xff92, 0xffdb, 0xd6ba, 0x2946, 0x30ea, 0x412c, 0x414c, 0x414c,
-  0x414d, 0x414d, 0x310a, 0x28c2, 0xc366, 0x7a26, 0x7a26, 0xd3a8,
-  0xe546, 0xff94, 0xfffe, 0xdeda, 0x2943, 0x310a, 0x414d, 0x414d,
-  0x6192, 0x5971, 0x1862, 0xb2e6, 0x7a06, 0x5126, 0x5126, 0x5965,
-  0x28c0, 0xe546, 0xffd4, 0xfffc, 0xd6a5, 0x18a2, 0x5171, 0x61b2,
-  0x6193, 0x5170, 0x2082, 0x92a7, 0x5946, 0x5125, 0x5165, 0x1861,
-  0x1841, 0xc365, 0xff45, 0xfff3, 0xef5a, 0x2923, 0x514f, 0x61b3,
-  0x5991, 0x1883, 0x8a86, 0x71e6, 0x5946, 0x61a6, 0x1861, 0xaa48,
-  0xaa48, 0x30a1, 0xe486, 0xffa6, 0xffda, 0xd5c3, 0x20a2, 0x5971,
-  0x7a36, 0x1862, 0x92a7, 0x7207, 0xaae7, 0xc327, 0x20a1, 0xe42a,
-  0xe42a, 0x2081, 0xcb86, 0xff63, 0xfff2, 0xe622, 0x20a1, 0x7236,
-  0x7a56, 0x1863, 0x9ac7, 0xab08, 0xe3a8, 0xe426, 0x28c1, 0xe44a,
-  0xec4a, 0x2081, 0xa306, 0xf683, 0xffd0, 0xe622, 0x20c2, 0x7a37,
-  0x7a56, 0x1863, 0x9ac7, 0xe3a8, 0xfcc6, 0xe5c1, 0x28e1, 0xe44b,
-  0xec4a, 0x2081, 0x9ae7, 0xf564, 0xffa3, 0xe620, 0x20c2, 0x7a37,
-  0x7a36, 0x1862, 0xa2e7, 0xf487, 0xfe61, 0xe620, 0x20c0, 0xe40a,
-  0xe42a, 0x1881, 0x9ac7, 0xf4a7, 0xff81, 0xe600, 0x20a2, 0x7236,
-  0x5991, 0x1863, 0x92a6, 0xf487, 0xfea1, 0xe703, 0x3141, 0xaa28,
-  0xaa48, 0x20a2, 0x9ae7, 0xf487, 0xfe42, 0xd425, 0x2083, 0x5971,
-  0x6193, 0x5150, 0x2082, 0xd3a6, 0xff64, 0xffd8, 0xdde3, 0x28c1,
-  0x1041, 0x9287, 0xb328, 0xe3c8, 0xe426, 0x28c2, 0x5150, 0x61b3,
-  0x6192, 0x5971, 0x1042, 0x92c5, 0xf644, 0xffd8, 0xff84, 0xc365,
-  0x20a1, 0xa2c7, 0xdb88, 0xe388, 0xc306, 0x1862, 0x5171, 0x61b2,
-  0x414d, 0x414d, 0x310a, 0x2082, 0xc365, 0xf663, 0xf722, 0xec87,
-  0xa2e7, 0xab08, 0xd368, 0x9aa6, 0x20a2, 0x310a, 0x414d, 0x414d,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x20a3, 0x92c6, 0xab47, 0xab08,
-  0xa308, 0xa2e7, 0x61c5, 0x1882, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x414c, 0x310a, 0x1862, 0x61a6, 0x69e6,
-  0x69e6, 0x61c6, 0x1041, 0x310a, 0x414c, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x30ea, 0x28c1, 0xec66, 0xfde4, 0xffc2,
-  0xffe3, 0xef43, 0x2942, 0x10a2, 0x310a, 0x412c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x28e2, 0xd4a3, 0xee02, 0xef02, 0xef43,
-  0xf790, 0xffb2, 0xef5a, 0xd6b3, 0x2945, 0x30ea, 0x412c, 0x414c,
-  0x414d, 0x310a, 0x28e2, 0xd484, 0xec47, 0x7a46, 0x61a5, 0x6a05,
-  0xa328, 0xed67, 0xff94, 0xfffd, 0xdedb, 0x2945, 0x310a, 0x414d,
-  0x5171, 0x1882, 0xd483, 0xf467, 0x7a06, 0x5126, 0x5145, 0x1841,
-  0x1861, 0x6a05, 0xed66, 0xff94, 0xfffd, 0xd6b3, 0x18c3, 0x5170,
-  0x514f, 0x20a2, 0xe427, 0xdb88, 0x71e6, 0x5165, 0x2882, 0xaa28,
-  0xaa08, 0x2882, 0x9ac6, 0xe546, 0xffd5, 0xef7b, 0x2924, 0x514f,
-  0x1042, 0x92a7, 0xec28, 0xbb48, 0x9aa7, 0x2081, 0xaa48, 0xd2ca,
-  0xd2aa, 0xaa48, 0x1861, 0x61e6, 0xf753, 0xffdc, 0xd4c6, 0x1881,
-  0x0820, 0xa2c7, 0xe3a8, 0xe388, 0xcb47, 0x20a1, 0xe40a, 0xfc8b,
-  0xfc8b, 0xe40a, 0x1881, 0x92e6, 0xf766, 0xffda, 0xe526, 0x1060,
-  0x0840, 0x9ac7, 0xdb88, 0xebc8, 0xdc06, 0x28c1, 0xe42a, 0xfcac,
-  0xfcab, 0xe44a, 0x2081, 0x9b26, 0xf783, 0xffd1, 0xe505, 0x1060,
-  0x0840, 0x9ac7, 0xe3a8, 0xfc87, 0xe503, 0x28c1, 0xe42a, 0xfcac,
-  0xfcab, 0xe44a, 0x2081, 0xa326, 0xf782, 0xff83, 0xe466, 0x1040,
-  0x0820, 0x9ac7, 0xe3a7, 0xfd84, 0xe6c3, 0x20e0, 0xe40a, 0xfc8b,
-  0xfc8b, 0xe40a, 0x2081, 0xcb86, 0xff22, 0xfdc4, 0xe407, 0x1040,
-  0x1042, 0x9287, 0xe3a7, 0xfd86, 0xe730, 0x3164, 0xaa28, 0xd2aa,
-  0xd2aa, 0xaa48, 0x30a2, 0xd386, 0xfd64, 0xf487, 0xc326, 0x1862,
-  0x514f, 0x2082, 0xcb47, 0xfca8, 0xff93, 0xded9, 0x3966, 0xaa08,
-  0xaa08, 0x38c2, 0xc326, 0xf467, 0xfc67, 0xd367, 0x28a2, 0x514f,
-  0x5171, 0x1063, 0x9286, 0xdba7, 0xf644, 0xffd3, 0xded9, 0x3143,
-  0x28a1, 0xc326, 0xfc68, 0xfc68, 0xe3a8, 0x92a6, 0x1063, 0x5171,
-  0x414d, 0x310a, 0x1862, 0x69c5, 0xd3a6, 0xf587, 0xff72, 0xe6a4,
-  0xe446, 0xf468, 0xf468, 0xdb88, 0x9aa6, 0x1882, 0x310a, 0x414d,
-  0x414c, 0x414c, 0x310a, 0x1062, 0x61a5, 0xa2e7, 0xd3a8, 0xdbc7,
-  0xdb87, 0xd367, 0xa2c7, 0x61a5, 0x1882, 0x310a, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x69c6, 0x71e6,
-  0x71e6, 0x69c6, 0x1041, 0x0821, 0x310a, 0x414c, 0x414c, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x1061, 0x2100, 0xe640, 0xffe5, 0xfffc,
-  0xffff, 0xfffc, 0xef46, 0x2942, 0x10a2, 0x310a, 0x412c, 0x414c,
-  0x414c, 0x310a, 0x28e2, 0xd4c3, 0xe642, 0xff82, 0xf790, 0xef54,
-  0xef54, 0xf795, 0xffba, 0xef5b, 0xd6b3, 0x2945, 0x30ea, 0x414c,
-  0x310a, 0x28e2, 0xd503, 0xff85, 0xff8f, 0xee43, 0xa347, 0x5986,
-  0x5186, 0x9b27, 0xe548, 0xff74, 0xfffd, 0xdeda, 0x2945, 0x310a,
-  0x1061, 0xd4c2, 0xff83, 0xff50, 0xd3e9, 0x9ac6, 0x2081, 0x1021,
-  0x1021, 0x1861, 0x5144, 0xa348, 0xf734, 0xfffd, 0xd6b3, 0x10a2,
-  0x20c0, 0xe620, 0xff82, 0xeca7, 0x2061, 0x2061, 0xaa28, 0xba49,
-  0xba49, 0xaa08, 0x1841, 0x1040, 0xa348, 0xff74, 0xef5b, 0x2942,
-  0xd3a6, 0xf742, 0xf681, 0xc346, 0x28a2, 0xaa48, 0xd2ca, 0xcaaa,
-  0xcaaa, 0xd2aa, 0xb248, 0x2081, 0x5144, 0xe548, 0xffba, 0xef44,
-  0xe3e7, 0xff42, 0xe543, 0x30e1, 0xd3ea, 0xfc8b, 0xf46b, 0xf46b,
-  0xf46b, 0xf46b, 0xfc8b, 0xd3ea, 0x2081, 0xa349, 0xf79a, 0xffe4,
-  0xb367, 0xf641, 0xe543, 0x20c1, 0xe42a, 0xfcac, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcac, 0xec4a, 0x2081, 0x9b08, 0xf771, 0xffe3,
-  0xab27, 0xf564, 0xe6c3, 0x20e0, 0xe42a, 0xfcac, 0xfcab, 0xfcab,
-  0xfcab, 0xfcab, 0xfcac, 0xec4a, 0x1881, 0x9b07, 0xf763, 0xffc1,
-  0xaae7, 0xe408, 0xe6cf, 0x3984, 0xd3ea, 0xfc8b, 0xf46b, 0xf46b,
-  0xf46b, 0xf46b, 0xfc8b, 0xd3ea, 0x28a2, 0xa326, 0xf742, 0xf5c4,
-  0x69e6, 0xd367, 0xfd88, 0xd696, 0x2903, 0xaa28, 0xcaaa, 0xcaaa,
-  0xcaaa, 0xd2aa, 0xaa48, 0x28a2, 0x9aa7, 0xf4c7, 0xf6e3, 0xab66,
-  0x1041, 0x9ac7, 0xe407, 0xeea4, 0x2140, 0x28c3, 0xaa08, 0xb229,
-  0xb229, 0xaa08, 0x2881, 0x2081, 0xd3e6, 0xfec3, 0xd3e6, 0x1861,
-  0x0821, 0x59a5, 0xaae8, 0xdc06, 0xeec4, 0xd696, 0x3164, 0x20e1,
-  0x20e0, 0x3101, 0xc326, 0xec66, 0xf5c2, 0xe407, 0x9286, 0x1041,
-  0x310a, 0x1062, 0x61a5, 0xaae8, 0xe407, 0xf588, 0xe6cf, 0xe6e3,
-  0xe6c1, 0xe5c1, 0xfc87, 0xf505, 0xe3e7, 0x9aa6, 0x2083, 0x310a,
-  0x414c, 0x310a, 0x1062, 0x61a5, 0x9aa7, 0xab27, 0xd3c8, 0xdbc7,
-  0xdbc7, 0xdba7, 0xd367, 0xa307, 0x9286, 0x2083, 0x310a, 0x414c,
-  0x414c, 0x414c, 0x310a, 0x0821, 0x1041, 0x61c6, 0x71e6, 0x71e6,
-  0x71e6, 0x71e6, 0x69c6, 0x1041, 0x1041, 0x310a, 0x414c, 0x414c
-};
-
-const Animation golden_ringAnimation = {
-  .name = "Golden Ring",
-  .frameCount = 18,
-  .width = 16,
-  .height = 16,
-  .frameDurations = golden_ringDurations,
-  .animationFrames = golden_ringFrames
-};
-#endif // ANIMATION_GOLDEN_RING_H
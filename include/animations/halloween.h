@@ -1,534 +0,0 @@
-// halloween.h - Auto-generated from halloween.json
-#ifndef ANIMATION_HALLOWEEN_H
-#define ANIMATION_HALLOWEEN_H
-
-#include "animation_types.h"
-
-// Frame Durations for halloween (in 100ms units)
-static const uint8_t PROGMEM halloweenDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for halloween
-static const uint16_t PROGMEM halloweenFrames[] = {
-  0x3908, 0x3908, 0x3908, 0x3908, 0x3908, 0x8b0d, 0x8b0d, 0x8b0d,
-  0x8b0d, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0x3908,
-  0xaa8a, 0xaa8a, 0xaa6a, 0xa1ea, 0xa1ea, 0xab4d, 0xab4d, 0xab4d,
-  0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0x99c9, 0x99c9,
-  0x4128, 0x4128, 0xaa0a, 0xaa0a, 0x99c9, 0x99c9, 0x9b2d, 0x746e,
-  0x746e, 0x9b2d, 0x9b2d, 0xaa0a, 0xaa0a, 0x9b2d, 0x4128, 0x99c9,
-  0xb1a5, 0xbb6c, 0xb229, 0xa1e9, 0xd384, 0xdaa4, 0xaa23, 0x6b88,
-  0xaa23, 0xaa23, 0xdb45, 0xda44, 0xa1e9, 0xbb2a, 0xbb4b, 0xa1e9,
-  0x4927, 0xa32c, 0xa32c, 0xd384, 0xdaa4, 0xaa23, 0xaa23, 0xdaa4,
-  0xdaa4, 0xaa23, 0xaa23, 0xdaa4, 0xda44, 0xaa09, 0xaa09, 0xaa09,
-  0xbbad, 0xbbad, 0xe466, 0xaa42, 0xe385, 0xe385, 0xaa42, 0xaa42,
-  0xaa42, 0xaa42, 0xdaa4, 0xdaa4, 0xaa42, 0xda44, 0xaa08, 0xaa08,
-  0xb36c, 0xb36c, 0xd426, 0xaa42, 0x6162, 0xdb45, 0xaa42, 0xaa42,
-  0xaa42, 0xaa42, 0xdb45, 0x6162, 0xaa42, 0xdaa4, 0xb228, 0xb32a,
-  0xcbab, 0xcbab, 0xb322, 0xb242, 0x6162, 0x6162, 0x6162, 0xb242,
-  0xb242, 0x6162, 0x6162, 0x6162, 0xb242, 0xe305, 0xba28, 0xcb8a,
-  0xbb8b, 0xca68, 0xb202, 0xb242, 0xeac4, 0xeac4, 0xb242, 0xb242,
-  0xb242, 0xb242, 0xeac4, 0xeac4, 0xb242, 0xb962, 0xbb29, 0xa2c8,
-  0xca68, 0xca68, 0xb202, 0xb242, 0x79a3, 0xdaa3, 0xb242, 0xb242,
-  0xb242, 0xb242, 0xdaa3, 0x79a3, 0xb242, 0xb962, 0xc2e7, 0xc2e7,
-  0xda88, 0xc38b, 0xe305, 0xba62, 0xba62, 0x6162, 0x6162, 0x6162,
-  0x6162, 0x6162, 0x6162, 0xba62, 0xba62, 0xda23, 0xaac8, 0xaac8,
-  0xda88, 0xe3ca, 0xe3ca, 0xba62, 0xba62, 0xba62, 0xba62, 0xba62,
-  0xba62, 0xba62, 0xba62, 0xba62, 0xb962, 0xcb27, 0xcb27, 0xdb28,
-  0xda87, 0xda87, 0xda87, 0x79a4, 0xb962, 0xb962, 0xb962, 0xb962,
-  0xb962, 0xb962, 0xb962, 0xb962, 0x79a4, 0xd267, 0xb2e7, 0x79c5,
-  0xe2a7, 0xe2a7, 0xd287, 0xd287, 0x79a4, 0xe2a7, 0xe2a7, 0x79a4,
-  0x79a4, 0x79a4, 0x79a4, 0x79a4, 0xd287, 0xd287, 0xe243, 0xe243,
-  0x81e5, 0xda87, 0x81e5, 0xda87, 0x81a4, 0xca66, 0xca66, 0x81a4,
-  0x81a4, 0x81a4, 0x81a4, 0x81a4, 0xda87, 0x81e5, 0x81e5, 0x81e5,
-  0xea63, 0xeac7, 0xea63, 0xe2a6, 0x89c3, 0xba25, 0xba25, 0x89c3,
-  0x89c3, 0x89c3, 0x89c3, 0x89c3, 0xf306, 0xf306, 0xf347, 0xf347,
-  0x924a, 0x91ea, 0x922a, 0x91ea, 0x920a, 0xa30d, 0x922a, 0xa32d,
-  0xab4d, 0xab2d, 0xab0c, 0xa209, 0xa1e9, 0xa1e9, 0xa1e7, 0x9986,
-  0x4928, 0x4928, 0x5169, 0x8aac, 0x92cd, 0x930d, 0x930d, 0x8b4d,
-  0x8b4d, 0xa22a, 0xa20a, 0xa1ea, 0xa1ea, 0xa1ea, 0x99c9, 0x5148,
-  0x9186, 0x99c6, 0xa2eb, 0xa22a, 0xaa69, 0xb32b, 0xab8b, 0x556f,
-  0x5d2e, 0xa269, 0xb209, 0xaa09, 0xaa09, 0xa20a, 0x99e9, 0x91c9,
-  0x6188, 0x9acb, 0xb24a, 0xba88, 0xf441, 0xf340, 0xe342, 0x64ab,
-  0xdb82, 0xf320, 0xf300, 0xf281, 0xba28, 0xa2ca, 0x9aca, 0xa209,
-  0xaaaa, 0xb34c, 0xbaa8, 0xf441, 0xfb80, 0xfb20, 0xfb20, 0xeb40,
-  0xfb20, 0xfb20, 0xfb20, 0xfb20, 0xf2a1, 0xc309, 0xb2ea, 0xaa09,
-  0xab4c, 0xb36b, 0xf481, 0xfb60, 0xeb00, 0xfb20, 0xfb20, 0xfb20,
-  0xfb20, 0xfb20, 0xfb20, 0xeb00, 0xfb20, 0xf2a1, 0xb228, 0xaa08,
-  0xc38b, 0xc3aa, 0xfcc0, 0xeb20, 0x4922, 0xd2c0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xd2c0, 0x4922, 0xeae0, 0xfaa0, 0xba27, 0xb228,
-  0xb36c, 0xbb8b, 0xf481, 0xeb20, 0x4102, 0x38e2, 0x4922, 0xeb00,
-  0xeb00, 0x4921, 0x38e2, 0x3902, 0xeae0, 0xfa80, 0xba47, 0xb309,
-  0xcbcc, 0xd3aa, 0xfae1, 0xfb20, 0xdac0, 0xe2e0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xe2e0, 0xdac0, 0xfb00, 0xf1a0, 0xba27, 0xb2e8,
-  0xbb6b, 0xca88, 0xfaa0, 0xeae0, 0x5961, 0xdac0, 0xeb00, 0xe2e0,
-  0xe2e0, 0xeb00, 0xdac0, 0x5961, 0xeac0, 0xf1a0, 0xaa87, 0xa2c8,
-  0xd288, 0xd287, 0xf2c1, 0xfb20, 0xdae0, 0x4921, 0x3902, 0x3902,
-  0x3902, 0x3902, 0x4922, 0xdac0, 0xfae0, 0xf1c1, 0xc2e7, 0xb2e8,
-  0xd288, 0xcb6a, 0xcb89, 0xeaa1, 0xfb00, 0xeac0, 0xe2c0, 0xeac0,
-  0xeac0, 0xeac0, 0xeac0, 0xfae0, 0xe9c0, 0xbaa6, 0xaac7, 0x81e6,
-  0xdaa7, 0xdbca, 0xd3aa, 0x99e4, 0xe980, 0xf9a0, 0xf9a0, 0xf180,
-  0xf180, 0xf180, 0xf180, 0xe980, 0x99c4, 0xc2e7, 0xc2e7, 0xca24,
-  0xe2a7, 0xe2c7, 0xdaa7, 0xc266, 0x91c4, 0xda66, 0xda66, 0x89a4,
-  0x8183, 0x81a3, 0x8183, 0x89a4, 0xc266, 0xca87, 0x9206, 0x89e5,
-  0xda87, 0xe2a7, 0xd287, 0xd286, 0x89c4, 0xc266, 0xc266, 0x81c4,
-  0x79a4, 0x79a4, 0x79a4, 0x81c4, 0xd286, 0xd287, 0xd2e7, 0xd307,
-  0x9205, 0xca86, 0x9a05, 0xca66, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81a3, 0x89c4, 0xca66, 0x91e5, 0x89e5, 0x8a05,
-  0x4928, 0x81a9, 0x5128, 0x89a9, 0x91ea, 0x92cc, 0x920a, 0x92ed,
-  0x930d, 0x8b0d, 0x92ed, 0x920a, 0x89ca, 0x4928, 0x4128, 0x4928,
-  0x9186, 0x91c9, 0x99a7, 0x99e9, 0x9a0a, 0xa30c, 0x9a2a, 0x9b4d,
-  0x9b6d, 0xa32d, 0xa30d, 0xa30c, 0xa2ec, 0xa209, 0xa1e8, 0x924a,
-  0x5147, 0x5988, 0x9aec, 0x9aec, 0x9b2b, 0xa30b, 0x9b2c, 0x556f,
-  0x5d2e, 0xaa69, 0xb229, 0xaa29, 0xaa2a, 0xaa09, 0xa1e9, 0x5968,
-  0x9a6a, 0xab4c, 0xb34c, 0xbaa8, 0xec61, 0xf341, 0xe342, 0x64ab,
-  0xdb82, 0xf320, 0xf300, 0xeaa1, 0xba28, 0xaa29, 0xa209, 0x99e9,
-  0x61a8, 0xa30b, 0xbaa8, 0xf441, 0xfb80, 0xfb20, 0xfb20, 0xeb40,
-  0xfb20, 0xfb20, 0xfb20, 0xfb20, 0xf2a1, 0xaae8, 0xa2ea, 0xaa29,
-  0xb34b, 0xbb8a, 0xf481, 0xfb60, 0xeb00, 0xfb20, 0xfb20, 0xfb20,
-  0xfb20, 0xfb20, 0xfb20, 0xeb00, 0xfb00, 0xf2c1, 0xbb2a, 0xaa29,
-  0xb36c, 0xbb8b, 0xfcc0, 0xeb20, 0x4922, 0xd2c0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xd2c0, 0x4922, 0xeae0, 0xfaa0, 0xba48, 0xb208,
-  0xc3ac, 0xcbcb, 0xfc81, 0xeb20, 0x4102, 0x38e2, 0x4922, 0xeb00,
-  0xeb00, 0x4921, 0x38e2, 0x3902, 0xeae0, 0xfa80, 0xba27, 0xb228,
-  0xbb8b, 0xc38a, 0xf2e1, 0xfb20, 0xdac0, 0xe2e0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xe2e0, 0xdac0, 0xfb00, 0xf1a0, 0xba27, 0xaaa8,
-  0xd3ab, 0xd389, 0xfac0, 0xeae0, 0x5961, 0xdac0, 0xeb00, 0xe2e0,
-  0xe2e0, 0xeb00, 0xdac0, 0x5961, 0xeac0, 0xf980, 0xc247, 0xb309,
-  0xc34a, 0xd2a7, 0xf2a1, 0xfb20, 0xdae0, 0x4921, 0x3902, 0x3902,
-  0x3902, 0x3902, 0x4922, 0xdac0, 0xfae0, 0xf1a1, 0xb2a7, 0xaac7,
-  0xd288, 0xd2a8, 0xd287, 0xeaa1, 0xfb00, 0xeac0, 0xe2c0, 0xeac0,
-  0xeac0, 0xeac0, 0xeac0, 0xfae0, 0xe9c0, 0xcac6, 0xc307, 0xca24,
-  0xdaa7, 0xcb6a, 0xc36a, 0x99e4, 0xe980, 0xf9a0, 0xf9a0, 0xf180,
-  0xf180, 0xf180, 0xf180, 0xe980, 0x99c4, 0xaae7, 0xb2e7, 0x89e5,
-  0xdaa7, 0xda85, 0xe389, 0xca87, 0x91a4, 0xda66, 0xda66, 0x89a4,
-  0x8183, 0x81a3, 0x8183, 0x89a4, 0xca87, 0xd327, 0xd307, 0xcae7,
-  0xe2a7, 0xe2a7, 0xe2c7, 0xd287, 0x89c4, 0xc266, 0xc266, 0x81c4,
-  0x79a4, 0x79a4, 0x79a4, 0x81c4, 0xd287, 0xd287, 0x9a05, 0x9205,
-  0xe2a7, 0xe2a7, 0xdaa6, 0xd286, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81a3, 0x89c4, 0xd286, 0xdaa6, 0xda84, 0xda43,
-  0x99ca, 0x99ea, 0x89a9, 0x91c9, 0x91c9, 0x91ea, 0x91c9, 0x91ea,
-  0xa30d, 0xa32d, 0x9a0a, 0x91c9, 0x91c9, 0x89a9, 0x91e9, 0x9a4a,
-  0x5148, 0x89a9, 0x5968, 0x91c9, 0x91e9, 0x92cc, 0x920a, 0x8b0c,
-  0x8b4d, 0x932d, 0x92ed, 0x9a0a, 0x91e9, 0x5168, 0x4928, 0x5128,
-  0x924a, 0xa22a, 0xa2ec, 0x9a0a, 0xa229, 0xb30b, 0x9a49, 0x4d4f,
-  0x5d4e, 0xab8c, 0xb34c, 0xb32b, 0xab2c, 0xa30c, 0xa1c7, 0x9186,
-  0x6188, 0x92ec, 0x9b2d, 0xa34a, 0xec61, 0xf341, 0xe341, 0x64ab,
-  0xdb82, 0xf321, 0xf321, 0xf2c1, 0xba48, 0xb22a, 0xaa09, 0x6167,
-  0xa9e6, 0xb32b, 0xbb8a, 0xec81, 0xfb80, 0xfb20, 0xfb20, 0xeb40,
-  0xfb20, 0xfb20, 0xfb20, 0xfb20, 0xf2a1, 0xba28, 0xa209, 0xa1e9,
-  0xab2b, 0xb36b, 0xf4a1, 0xfb60, 0xeb00, 0xfb20, 0xfb20, 0xfb20,
-  0xfb20, 0xfb20, 0xfb20, 0xeb00, 0xfb20, 0xf2a1, 0xb2e9, 0xaa29,
-  0xc3ac, 0xc3cb, 0xfcc0, 0xeb20, 0x4922, 0xd2c0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xd2c0, 0x4922, 0xeae0, 0xfac0, 0xc308, 0xb228,
-  0xb36c, 0xbb8b, 0xf481, 0xeb20, 0x4102, 0x38e2, 0x4922, 0xeb00,
-  0xeb00, 0x4921, 0x38e2, 0x3902, 0xeae0, 0xfa80, 0xc247, 0xba28,
-  0xcbab, 0xcb8a, 0xf2e0, 0xfb20, 0xdac0, 0xe2e0, 0xeb00, 0xfb20,
-  0xfb20, 0xeb00, 0xe2e0, 0xdac0, 0xfb00, 0xf1a0, 0xba27, 0xb248,
-  0xbb8b, 0xc38a, 0xfac1, 0xeae0, 0x5961, 0xdac0, 0xeb00, 0xe2e0,
-  0xe2e0, 0xeb00, 0xdac0, 0x5961, 0xeac0, 0xf980, 0xc227, 0xaaa8,
-  0xcbab, 0xd3aa, 0xf2c1, 0xfb20, 0xdae0, 0x4921, 0x3902, 0x3902,
-  0x3902, 0x3902, 0x4922, 0xdac0, 0xfae0, 0xf1a1, 0xc247, 0xb2c7,
-  0x89e6, 0xca88, 0xda86, 0xeaa1, 0xfb00, 0xeac0, 0xe2c0, 0xeac0,
-  0xeac0, 0xeac0, 0xeac0, 0xfae0, 0xe9c0, 0xbaa6, 0xaac7, 0x81e6,
-  0xd267, 0xd287, 0xca87, 0x99c4, 0xe980, 0xf9a0, 0xf9a0, 0xf180,
-  0xf180, 0xf180, 0xf180, 0xe980, 0x91c4, 0xbb07, 0xc307, 0xcae7,
-  0xda87, 0x9226, 0xcb49, 0xd287, 0x91c4, 0xda66, 0xda66, 0x89a4,
-  0x8183, 0x81a3, 0x8183, 0x89a4, 0xb2a7, 0xbae7, 0x8a05, 0x89e5,
-  0xe2a7, 0xdb07, 0xe328, 0xdaa7, 0x89c4, 0xc246, 0xc266, 0x81c4,
-  0x79a4, 0x79a4, 0x79a4, 0x81c4, 0xdaa7, 0xe2c5, 0xd284, 0xd243,
-  0xe2a7, 0xeac7, 0xeac7, 0xd286, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81a3, 0x89c4, 0xda86, 0xda86, 0x9205, 0x89e5,
-  0xa1ea, 0xa1ea, 0xa1ea, 0x91c9, 0x91c9, 0x91c9, 0x91c9, 0x91ca,
-  0x8aed, 0x92ed, 0xa1ea, 0xa1ea, 0x91c9, 0x89a9, 0x4928, 0x4128,
-  0x99ca, 0x99ea, 0x99e9, 0x99c9, 0x91c9, 0x91e9, 0x91c9, 0x922a,
-  0xa34d, 0xa32d, 0xa20a, 0x99c9, 0x91c9, 0x91e9, 0x91c7, 0x9186,
-  0x5947, 0x91e9, 0x9acc, 0x99e9, 0x9a09, 0x9acb, 0x9229, 0x73ec,
-  0x7c0d, 0x9b2c, 0x9aeb, 0x9a09, 0x9a0a, 0x92cc, 0x5988, 0x5147,
-  0x9985, 0xaa29, 0xb30c, 0xaa48, 0xcb25, 0xcb05, 0xa244, 0x7b47,
-  0x9a64, 0xa244, 0xcb06, 0xcb06, 0xbb2a, 0xb32b, 0xaaea, 0x9a69,
-  0x6188, 0x9aeb, 0xab4b, 0xcba6, 0xd325, 0xb263, 0xaa23, 0xcaa4,
-  0xca84, 0xaa23, 0xb243, 0xd2a4, 0xca65, 0xb229, 0xaa29, 0x6188,
-  0xb36c, 0xbb8c, 0xd3e7, 0xb283, 0xcaa4, 0xd325, 0xaa43, 0xaa22,
-  0xaa42, 0xaa43, 0xcaa4, 0xca84, 0xb243, 0xca44, 0xaa08, 0xa208,
-  0xab6c, 0xb36b, 0xd365, 0xaa22, 0x79a2, 0xc264, 0xaa22, 0xaa22,
-  0xaa22, 0xaa23, 0xc2c5, 0x79a3, 0xaa22, 0xd2a4, 0xb2e9, 0xb228,
-  0xc38b, 0xc38a, 0xb303, 0xaa42, 0x7182, 0x7182, 0x71a2, 0xaa42,
-  0xaa42, 0x71a2, 0x71a2, 0x7182, 0xaa42, 0xd2e5, 0xc329, 0xba48,
-  0xbb8b, 0xbb6a, 0xb223, 0xb242, 0xca84, 0xd284, 0xb242, 0xb242,
-  0xb242, 0xaa42, 0xd284, 0xca83, 0xb222, 0xb9a2, 0xba27, 0xba28,
-  0xd3cc, 0xcbab, 0xba43, 0xaa22, 0x91e3, 0xc263, 0xaa42, 0xaa22,
-  0xaa22, 0xaa42, 0xc283, 0x91e3, 0xaa22, 0xb982, 0xc227, 0xba48,
-  0xc36a, 0xc38a, 0xdb05, 0xba62, 0xaa42, 0x79a2, 0x7182, 0x7182,
-  0x7182, 0x7182, 0x79a2, 0xaa22, 0xba42, 0xca44, 0xc267, 0xb2c8,
-  0xca44, 0xdb89, 0xdb89, 0xb263, 0xb242, 0xb222, 0xaa22, 0xb222,
-  0xb222, 0xb222, 0xb222, 0xb222, 0xb1a2, 0xc2e7, 0xc287, 0xcae8,
-  0x91e5, 0xd287, 0xd2a7, 0x91c4, 0xa982, 0xb982, 0xb982, 0xb182,
-  0xb182, 0xb182, 0xb182, 0xa982, 0x89c4, 0xb2e7, 0xb2c7, 0x89e5,
-  0xd287, 0xd287, 0xd287, 0xca87, 0x89c4, 0xd266, 0xd266, 0x89a4,
-  0x7984, 0x81a4, 0x7984, 0x81c4, 0xc307, 0xcb07, 0xd2a4, 0xd223,
-  0xdaa7, 0x9a05, 0x9a05, 0xd287, 0x89c4, 0xc246, 0xc266, 0x81c4,
-  0x79a4, 0x81a4, 0x79a4, 0x81c4, 0xb2c7, 0x9225, 0x9205, 0x9205,
-  0xe2a6, 0xda43, 0xda63, 0xdaa6, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81a3, 0x89c4, 0xdaa6, 0xe2a5, 0xdac5, 0xe307,
-  0xa1ea, 0xa24a, 0xa24a, 0xa1ea, 0x91ea, 0xa30d, 0xa30d, 0x920a,
-  0xa32d, 0xab4d, 0xab0c, 0xa20a, 0xa1ea, 0xa1e9, 0x91c7, 0x9186,
-  0xa1ea, 0xa1ea, 0xa1ea, 0x99c9, 0x99c9, 0x91e9, 0x91e9, 0x91e9,
-  0x92ec, 0x92ed, 0x9a0a, 0xa1ea, 0x99c9, 0x91c9, 0x5148, 0x4948,
-  0x99e9, 0xa1e9, 0x99e9, 0x99c9, 0x91c9, 0x71c9, 0x69c8, 0x69c8,
-  0x6a6a, 0x726a, 0x7a09, 0x91c9, 0x99c9, 0x99e9, 0x9a49, 0x9a4a,
-  0x6168, 0x9a09, 0x9aec, 0x9a09, 0x71e8, 0x6a6a, 0x49a8, 0x4988,
-  0x49a8, 0x49a8, 0x6a6a, 0x71e9, 0x9a09, 0xa2ca, 0x9aca, 0x6187,
-  0xaa8a, 0xaa4a, 0xb34c, 0x7209, 0x6a29, 0x51c8, 0x51c8, 0x7229,
-  0x7229, 0x51c8, 0x51c8, 0x728a, 0x8249, 0xb30a, 0xb2ea, 0xa9e6,
-  0xab4c, 0xab4c, 0x9b0b, 0x51a7, 0x728a, 0x72aa, 0x51e8, 0x51c8,
-  0x51c8, 0x51c8, 0x7a2a, 0x7a2a, 0x5187, 0xaa29, 0xba49, 0xaac9,
-  0xc38b, 0xbb8b, 0x7a8a, 0x59e8, 0x9249, 0x82aa, 0x59e8, 0x51c8,
-  0x51c8, 0x59e8, 0x7a29, 0x9228, 0x59c8, 0x7a08, 0xaa28, 0xb228,
-  0xb36c, 0xab4b, 0x51c7, 0x51c8, 0x8a08, 0x69e8, 0x8208, 0x59c8,
-  0x59c8, 0x8208, 0x61e8, 0x8a08, 0x59e8, 0x7248, 0xaae9, 0xba48,
-  0xcbcc, 0xc3ab, 0x5186, 0x51a6, 0x9228, 0x9228, 0x8208, 0x59e8,
-  0x59e8, 0x8208, 0x9228, 0x9228, 0x51a6, 0x5186, 0xbb08, 0xba48,
-  0xc38b, 0xbb6b, 0x71c5, 0x5185, 0x7a28, 0x7a49, 0x59e8, 0x59c8,
-  0x59c8, 0x59e8, 0x7a49, 0x7a28, 0x5185, 0x7185, 0xba47, 0xc247,
-  0xcb8a, 0xd3aa, 0xc36a, 0x59a6, 0x59c7, 0x59c7, 0x51c7, 0x51c7,
-  0x51c7, 0x51c7, 0x59c7, 0x59c7, 0x5985, 0xb247, 0xc267, 0xc247,
-  0x8a07, 0xc38a, 0xc38a, 0x5185, 0x5186, 0x5186, 0x4965, 0x51a6,
-  0x51a6, 0x4965, 0x5186, 0x5186, 0x5165, 0xaaa7, 0xc267, 0x89c6,
-  0xcae8, 0xdbcb, 0xd3aa, 0x6185, 0x4965, 0x5165, 0x4945, 0x4965,
-  0x4965, 0x4944, 0x4965, 0x4965, 0x5985, 0xbae7, 0xc266, 0xca24,
-  0x9206, 0xdaa7, 0xe2c7, 0xca67, 0x5965, 0x79c6, 0x81c6, 0x5144,
-  0x5144, 0x5144, 0x4944, 0x5965, 0xaaa7, 0xbae7, 0x91e5, 0x89e5,
-  0xda87, 0xda87, 0xdaa7, 0xdaa7, 0x89c4, 0xba46, 0xc246, 0x81c4,
-  0x79a4, 0x79a4, 0x79a4, 0x81c4, 0xc2e7, 0xdac5, 0xd2a5, 0xd2e7,
-  0xe2a7, 0x9205, 0x9205, 0xda86, 0x91e4, 0xb225, 0xba25, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x81c4, 0x89e5, 0x89e5, 0x89e5, 0x8a05,
-  0x99ca, 0x4928, 0x4928, 0x99ca, 0xa20a, 0x92ed, 0x92ed, 0x91ea,
-  0x92ed, 0x930d, 0x8aed, 0x4948, 0x4108, 0x4128, 0x4928, 0x4928,
-  0xa1e9, 0x99a6, 0x9986, 0x99c9, 0x99ea, 0x9b0c, 0x9b0c, 0x9209,
-  0x9b0c, 0x9b2d, 0x9b0c, 0x99ea, 0x99c9, 0x99e9, 0x9209, 0x924a,
-  0xaa09, 0xaa09, 0xa9e9, 0x99c9, 0x89c9, 0x49e8, 0x41e8, 0x41c8,
-  0x41e8, 0x41e8, 0x49e8, 0x99e9, 0x99e9, 0x91c9, 0x5968, 0x5148,
-  0xa209, 0xaa09, 0xa209, 0x91e9, 0x41c8, 0x39e9, 0x4209, 0x4209,
-  0x4209, 0x4209, 0x3a09, 0x41c8, 0x91e9, 0xa209, 0xaac9, 0xa1a5,
-  0x6188, 0xa209, 0x9aeb, 0x41e8, 0x3a09, 0x420a, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x420a, 0x3a09, 0x41e8, 0x9aea, 0xa2ea, 0x6188,
-  0xb32b, 0xb269, 0xab2a, 0x4209, 0x524a, 0x4a6b, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x4a6b, 0x524a, 0x41e8, 0xab0a, 0xbb2a, 0xb34b,
-  0xb36c, 0xa32b, 0x4a09, 0x524a, 0xc289, 0x5a6b, 0x526b, 0x4a6b,
-  0x4a6b, 0x526b, 0x5a6b, 0xc289, 0x524a, 0x49e8, 0xb268, 0xb30a,
-  0xc3ac, 0xbb8c, 0x41e8, 0x524a, 0xba68, 0x6a6a, 0xaa69, 0x526b,
-  0x526b, 0xaa69, 0x6a6a, 0xba68, 0x524a, 0x39c8, 0xaa28, 0xba48,
-  0xbb8b, 0xb36b, 0x39a7, 0x41e9, 0xa227, 0xaa27, 0xaa28, 0x526b,
-  0x526b, 0xaa28, 0xaa27, 0xa227, 0x49e9, 0x39a7, 0xaac9, 0xba48,
-  0xd3ab, 0xcb8a, 0x69a6, 0x3187, 0x524a, 0x526a, 0x524a, 0x4a6b,
-  0x4a6b, 0x524a, 0x526a, 0x524a, 0x3187, 0x69a5, 0xbac8, 0xc268,
-  0xc38b, 0xc38b, 0xb32a, 0x3987, 0x3a09, 0x4209, 0x3a09, 0x4209,
-  0x4209, 0x3a09, 0x4209, 0x3a09, 0x3986, 0xb227, 0xca67, 0xca67,
-  0xcb08, 0xdbeb, 0xcbab, 0x3165, 0x31a7, 0x31a8, 0x2125, 0x31a8,
-  0x31a8, 0x2125, 0x31a8, 0x31a8, 0x3125, 0xba47, 0xca67, 0xc247,
-  0x8a06, 0xcb6a, 0xc38a, 0x3985, 0x2946, 0x2946, 0x2105, 0x2946,
-  0x2946, 0x2105, 0x2946, 0x2966, 0x3945, 0xaaa7, 0xca67, 0x89e6,
-  0xca23, 0xda64, 0xe3a9, 0xcb47, 0x3945, 0x2925, 0x3125, 0x2925,
-  0x2925, 0x2925, 0x2925, 0x3125, 0xb266, 0xcb07, 0xca87, 0xcae7,
-  0x9a05, 0xda86, 0xe2c7, 0xdaa7, 0x89c4, 0xb226, 0xba46, 0x79a4,
-  0x79a4, 0x79a4, 0x79a4, 0x79c4, 0xbaa6, 0x9225, 0x91e5, 0x9205,
-  0xdaa7, 0xe2a7, 0xeac7, 0xdaa7, 0x91e4, 0xb225, 0xba25, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89e4, 0xdac5, 0xe2c5, 0xdaa4, 0xda63,
-  0xa1ea, 0x99ca, 0x91ca, 0xa1ea, 0xa1ea, 0xa20a, 0x91ea, 0x91ea,
-  0xa32d, 0xab4d, 0xab2d, 0xa229, 0xa209, 0x99e9, 0x922a, 0x924a,
-  0x99ca, 0x5148, 0x5168, 0x99ea, 0xa20a, 0x8acc, 0x8acc, 0x89e9,
-  0x8aec, 0x8aec, 0x8aec, 0x92ec, 0x92cc, 0x5169, 0x4928, 0x4928,
-  0xa209, 0xa26a, 0xa2ec, 0xa20a, 0x89c9, 0x41e8, 0x39e8, 0x41c8,
-  0x39c8, 0x39e8, 0x41e8, 0x9209, 0xaa2a, 0xa2eb, 0x99e7, 0x9186,
-  0xaa09, 0xb229, 0xb229, 0x91e9, 0x41c8, 0x39e9, 0x4209, 0x4209,
-  0x4209, 0x4209, 0x3a09, 0x49c8, 0x91e9, 0xa229, 0x9aaa, 0x6188,
-  0xaa29, 0xb209, 0xa209, 0x49c8, 0x3a09, 0x420a, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x420a, 0x3a09, 0x41c8, 0xa229, 0xb30a, 0xaaaa,
-  0xab2b, 0xaa49, 0x9acb, 0x41e9, 0x524a, 0x4a6b, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x4a6b, 0x524a, 0x41e8, 0x92c9, 0xab2a, 0xab2a,
-  0xc38c, 0xb269, 0x49e8, 0x524a, 0xc289, 0x5a6b, 0x526b, 0x4a6b,
-  0x4a6b, 0x526b, 0x5a6b, 0xc289, 0x524a, 0x49e8, 0xbb09, 0xc349,
-  0xb36c, 0xab2b, 0x39e8, 0x524a, 0xba68, 0x6a6a, 0xaa69, 0x526b,
-  0x526b, 0xaa69, 0x6a6a, 0xba68, 0x524a, 0x41c8, 0xb248, 0xb309,
-  0xcbab, 0xbb6a, 0x39a7, 0x41e9, 0xa227, 0xaa27, 0xaa28, 0x526b,
-  0x526b, 0xaa28, 0xaa27, 0xa227, 0x4a09, 0x3986, 0xaa28, 0xba48,
-  0xbb8b, 0xbb6b, 0x69a5, 0x3186, 0x524a, 0x526a, 0x524a, 0x4a6b,
-  0x4a6b, 0x524a, 0x526a, 0x524a, 0x3187, 0x69a5, 0xa287, 0xc248,
-  0xcbab, 0xd3ab, 0xc288, 0x3986, 0x3a09, 0x4209, 0x3a09, 0x4209,
-  0x4209, 0x3a09, 0x4209, 0x3a09, 0x3986, 0xb2c7, 0xc2c7, 0xc267,
-  0x8a06, 0xc38a, 0xbb6a, 0x3145, 0x31a7, 0x31a8, 0x2125, 0x31a8,
-  0x31a8, 0x2125, 0x31a8, 0x31a8, 0x3125, 0xba47, 0xca67, 0xca67,
-  0xca44, 0xd369, 0xcb8a, 0x3965, 0x2946, 0x2946, 0x2105, 0x2946,
-  0x2946, 0x2105, 0x2946, 0x2966, 0x3945, 0xba67, 0xca67, 0xc267,
-  0x89e5, 0x9226, 0xcb8a, 0xbb28, 0x3945, 0x2925, 0x3125, 0x2925,
-  0x2925, 0x2925, 0x2925, 0x3125, 0xba46, 0xc2c7, 0xca87, 0x91e5,
-  0xd307, 0xdb07, 0xe348, 0xe388, 0x89e4, 0xb226, 0xba46, 0x79a4,
-  0x79a4, 0x79a4, 0x79a4, 0x81a4, 0xca66, 0xdaa5, 0xd286, 0xd243,
-  0x9205, 0xe2a7, 0xeac7, 0xe2c7, 0x91e4, 0xb225, 0xba25, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x81c4, 0x89e5, 0x89e5, 0x89e5, 0x89e5,
-  0xa1a6, 0xa1e9, 0xa1ea, 0xa1ea, 0xa1ea, 0xa1ea, 0xa20a, 0xa30c,
-  0xab4d, 0xab4d, 0xab2d, 0xa229, 0xa209, 0x99e9, 0x922a, 0x924a,
-  0xa1e9, 0xa1ea, 0xa20a, 0xa1ea, 0xa1ea, 0x99ea, 0x91c9, 0x9209,
-  0x8aec, 0x8aec, 0x8aec, 0x930d, 0x92ec, 0x5169, 0x4928, 0x4928,
-  0xaa09, 0xa28a, 0xab2c, 0xaa2a, 0x99e9, 0x49c8, 0x39c8, 0x41c8,
-  0x39c8, 0x39c8, 0x41e9, 0x9b2c, 0xab4d, 0xa30c, 0x99e7, 0x9186,
-  0xaa29, 0x9aec, 0x9b0c, 0x9a29, 0x49c8, 0x3a09, 0x4209, 0x4209,
-  0x4209, 0x4209, 0x3a09, 0x49e8, 0x9a29, 0xa2ea, 0x9aca, 0x6188,
-  0xb209, 0xb229, 0xa229, 0x49c8, 0x3a09, 0x420a, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x420a, 0x3a09, 0x49c8, 0xa229, 0xb30a, 0xaaaa,
-  0xba49, 0xba29, 0x9a08, 0x41c8, 0x524a, 0x4a6b, 0x4a6b, 0x4a6b,
-  0x4a6b, 0x4a6b, 0x4a6b, 0x524a, 0x41c8, 0x9a08, 0xab0a, 0xab2a,
-  0xc36c, 0xaa28, 0x49c8, 0x524a, 0xc289, 0x5a6b, 0x526b, 0x4a6b,
-  0x4a6b, 0x526b, 0x5a6b, 0xc289, 0x524a, 0x49e8, 0xbb29, 0xc349,
-  0xbb4b, 0xb269, 0x41c8, 0x524a, 0xba68, 0x6a6a, 0xaa69, 0x526b,
-  0x526b, 0xaa69, 0x6a6a, 0xba68, 0x524a, 0x39e8, 0xab09, 0xb329,
-  0xcbaa, 0xc36a, 0x39a7, 0x41e9, 0xa227, 0xaa27, 0xaa28, 0x526b,
-  0x526b, 0xaa28, 0xaa27, 0xa227, 0x4a09, 0x3986, 0xba68, 0xbb09,
-  0xbb8b, 0xbb6b, 0x69a5, 0x3186, 0x524a, 0x526a, 0x524a, 0x4a6b,
-  0x4a6b, 0x524a, 0x526a, 0x524a, 0x3187, 0x6985, 0xba47, 0xc268,
-  0xcbab, 0xd3ab, 0xc267, 0x3986, 0x3a09, 0x4209, 0x3a09, 0x4209,
-  0x4209, 0x3a09, 0x4209, 0x3a09, 0x3986, 0xaac7, 0xc2e7, 0xc267,
-  0x8a06, 0xcb6a, 0xcaa8, 0x3125, 0x31a8, 0x31a8, 0x2125, 0x31a8,
-  0x31a8, 0x2125, 0x31a8, 0x31a8, 0x2945, 0xa2a7, 0xb2e7, 0xc267,
-  0xca44, 0xd369, 0xcb8a, 0x3965, 0x2946, 0x2946, 0x2105, 0x2946,
-  0x2946, 0x2105, 0x2946, 0x2966, 0x3945, 0xba67, 0xca87, 0xca67,
-  0x89e5, 0x9226, 0xcb8a, 0xbb48, 0x3945, 0x2925, 0x3125, 0x2925,
-  0x2925, 0x2925, 0x2925, 0x3145, 0xba46, 0xd287, 0xd287, 0xd286,
-  0xd2e7, 0xd2e7, 0xdb27, 0xd368, 0x81e4, 0xb226, 0xba46, 0x79a4,
-  0x79a4, 0x79a4, 0x79a4, 0x81a4, 0xd286, 0xdaa5, 0xda86, 0xda43,
-  0x8a05, 0x8a05, 0x89e5, 0x89e5, 0x89c4, 0xba25, 0xba25, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xca86, 0x9a05, 0xca86, 0x91e5,
-  0x924a, 0xa24a, 0xa24a, 0xa24a, 0xa26a, 0xa32d, 0xa32d, 0xa34d,
-  0xa32d, 0xa24b, 0xa30c, 0x920a, 0x91c9, 0x91c7, 0x89a9, 0x9186,
-  0x5148, 0x99ea, 0xa1ea, 0xa1ea, 0xa1ea, 0x9a0a, 0x9a2a, 0x92ec,
-  0x930d, 0x92ec, 0x930d, 0x930d, 0x8acc, 0x5169, 0x4928, 0x4948,
-  0x99e9, 0xa20a, 0xa20a, 0xaa09, 0xa209, 0x79e9, 0x69c8, 0x69e9,
-  0x6a6a, 0x728a, 0x7aaa, 0xa34c, 0xab6d, 0xa32c, 0xa269, 0x9a4a,
-  0xaa2a, 0x9b0c, 0x9b0c, 0xa229, 0x79e9, 0x6a6a, 0x49a8, 0x4988,
-  0x49a8, 0x49a8, 0x6a8a, 0x728a, 0x930c, 0xa30b, 0x9aca, 0x6187,
-  0xb229, 0xbb4c, 0xb34c, 0x7a09, 0x6a28, 0x51c8, 0x51c8, 0x7229,
-  0x7229, 0x51c8, 0x51c8, 0x7209, 0x7209, 0xb2ea, 0xb30a, 0xa9e6,
-  0xba29, 0xba49, 0xaa29, 0x5187, 0x7a29, 0x7a2a, 0x51c8, 0x51c8,
-  0x51c8, 0x51c8, 0x7a2a, 0x7a29, 0x5187, 0xa228, 0xab0a, 0xab0a,
-  0xba49, 0xba48, 0x71e8, 0x59c8, 0x9228, 0x7a29, 0x59e8, 0x51c8,
-  0x51c8, 0x59e8, 0x7a29, 0x9228, 0x59c8, 0x7a08, 0xbb29, 0xc36a,
-  0xb32b, 0xb248, 0x51a7, 0x51c8, 0x8a08, 0x61e8, 0x8208, 0x59c8,
-  0x59c8, 0x8208, 0x61e8, 0x8a08, 0x59e8, 0x7248, 0xab29, 0xb329,
-  0xcbab, 0xba68, 0x5166, 0x51a6, 0x9228, 0x9228, 0x8208, 0x59e8,
-  0x59e8, 0x8208, 0x9228, 0x9228, 0x51a6, 0x5186, 0xc308, 0xbb08,
-  0xc38b, 0xbb4a, 0x71c5, 0x5185, 0x7a28, 0x7a49, 0x59e8, 0x59c8,
-  0x59c8, 0x59e8, 0x7a49, 0x7a28, 0x5185, 0x7185, 0xc268, 0xaaa8,
-  0xcb8a, 0xd3ab, 0xc349, 0x5986, 0x59c7, 0x59c7, 0x51c7, 0x51c7,
-  0x51c7, 0x51c7, 0x59c7, 0x59c7, 0x5985, 0xba47, 0xc267, 0xc267,
-  0x8a07, 0xcb6a, 0xcaa8, 0x5165, 0x5186, 0x5186, 0x4965, 0x51a6,
-  0x51a6, 0x4965, 0x5186, 0x5186, 0x5165, 0xaac7, 0xb2e7, 0xca67,
-  0xcb08, 0xd38a, 0xcaa7, 0x6165, 0x4965, 0x5165, 0x4945, 0x4965,
-  0x4965, 0x4944, 0x4965, 0x4965, 0x5985, 0xbae7, 0xcb07, 0xca87,
-  0x89e5, 0x9206, 0xcb49, 0xc287, 0x5965, 0x79c6, 0x81c6, 0x5144,
-  0x5144, 0x5144, 0x4944, 0x5964, 0xc246, 0xd287, 0xd287, 0xd287,
-  0xd243, 0xd243, 0xda84, 0xdb27, 0x89e4, 0xba46, 0xc246, 0x81c4,
-  0x79a4, 0x79a4, 0x79a4, 0x81c4, 0xd286, 0xd287, 0xda87, 0xd287,
-  0x89e5, 0x89e5, 0x89e5, 0x89e5, 0x89c4, 0xb225, 0xba25, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xca66, 0x9a05, 0xca86, 0x91e5,
-  0x4128, 0x4108, 0x4128, 0x4148, 0x4969, 0x8aed, 0x930d, 0x930d,
-  0x92ed, 0x920a, 0x92cd, 0x91ea, 0x89a9, 0x5148, 0x81a9, 0x5148,
-  0x9186, 0x9986, 0x99a6, 0x9aeb, 0x9aec, 0xa30c, 0xa30c, 0xa32d,
-  0xa30c, 0x9a2a, 0xa2ec, 0x9209, 0x99e9, 0x99e9, 0x91c9, 0x922a,
-  0x5948, 0xa1e9, 0xaa09, 0xa209, 0x89c8, 0x89e8, 0x89e8, 0x7a8a,
-  0x7a8a, 0x7a8a, 0x82aa, 0x828a, 0x92ec, 0x92ec, 0x5968, 0x5147,
-  0xa209, 0xaa29, 0xaa29, 0x89a8, 0x89e8, 0xab2d, 0x82cc, 0x7acc,
-  0x7acc, 0x82ec, 0xb40f, 0x930b, 0x92ca, 0xb32a, 0xaac9, 0xa1a5,
-  0xb229, 0xa30b, 0xa30b, 0x9208, 0xbb4d, 0x82ec, 0x7acc, 0xb36e,
-  0xb36e, 0x7acc, 0x830d, 0xabef, 0x8269, 0xa2ea, 0xa2ea, 0x6188,
-  0xba49, 0xbb4b, 0xb32b, 0x6186, 0xb32d, 0x82cb, 0x5a29, 0x82ec,
-  0x82ec, 0x5a09, 0x82cb, 0xb34d, 0x6186, 0xb30a, 0xbb6b, 0xb34b,
-  0xc248, 0xc269, 0xb228, 0x5965, 0x9a6a, 0xab2d, 0x82ec, 0x82ec,
-  0x82ec, 0x82ec, 0xb34d, 0xa26a, 0x5965, 0xaa28, 0xb32a, 0xb34a,
-  0xc269, 0xba28, 0x6965, 0x5145, 0x8acb, 0x6a69, 0x82cb, 0x82eb,
-  0x82eb, 0x82cb, 0x6a69, 0x82cb, 0x5965, 0xaa07, 0xc329, 0xc349,
-  0xbb4b, 0xb248, 0x6145, 0x5965, 0xbb4c, 0xbb4c, 0x6228, 0x5a08,
-  0x5a08, 0x6228, 0xbb4c, 0xbb4c, 0x5965, 0x6985, 0xb309, 0xaae8,
-  0xd3aa, 0xc288, 0x7185, 0x6165, 0xb32c, 0xbb6c, 0x8aca, 0x82ca,
-  0x82ca, 0x8aca, 0xbb6c, 0xb32c, 0x6165, 0x7185, 0xbae8, 0xbb09,
-  0xc36b, 0xc36b, 0xb32a, 0x6185, 0x8aca, 0x8aeb, 0x8aeb, 0x8aca,
-  0x8aca, 0x8aeb, 0x8aeb, 0x8aca, 0x6985, 0xc247, 0xd288, 0xb2c8,
-  0xcb08, 0xdbeb, 0xd3aa, 0x6985, 0x8289, 0x82a9, 0x82a9, 0x8ac9,
-  0x8ac9, 0x82a9, 0x82a9, 0x82a9, 0x6185, 0xc267, 0xca67, 0xc267,
-  0x8a06, 0xcb49, 0xd2a7, 0x71a4, 0x8268, 0x69a4, 0x71a4, 0x8288,
-  0x8288, 0x6984, 0x6184, 0x8268, 0x71a4, 0xaac7, 0xbae7, 0xca67,
-  0xca23, 0xd244, 0xd287, 0xc246, 0x71a4, 0xaa25, 0xca66, 0x7184,
-  0x6984, 0x7184, 0x6163, 0x6984, 0xc266, 0xd327, 0xdb07, 0xd287,
-  0x9205, 0x9205, 0x9a05, 0xca86, 0x89c4, 0xc246, 0xc266, 0x81c4,
-  0x79a4, 0x81a4, 0x79a4, 0x81c4, 0xd286, 0xdaa7, 0xda87, 0xda87,
-  0xe327, 0xe327, 0xe327, 0xe307, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xd286, 0xdaa6, 0xda86, 0xdaa6,
-  0x9186, 0x9186, 0x9186, 0x99a6, 0xa1c7, 0xa30c, 0xa34d, 0xa32d,
-  0xa22a, 0xa1ea, 0x91ea, 0x91c9, 0x91c9, 0x89a9, 0x91c9, 0x89a9,
-  0x4948, 0x4928, 0x5168, 0x92cc, 0x8acc, 0x8acc, 0x8acc, 0x8aec,
-  0x8aab, 0x89c9, 0x8a8b, 0x91c9, 0x91c9, 0x5968, 0x89a9, 0x5148,
-  0x924a, 0x9a6a, 0xa30c, 0x9b0c, 0x5186, 0x51c7, 0x51c7, 0x51c7,
-  0x51c7, 0x5186, 0x51c7, 0x4905, 0x89c8, 0xa2eb, 0x9a09, 0x9186,
-  0x6168, 0xaa09, 0xaa29, 0x5145, 0x59c7, 0xcdb6, 0xcdf8, 0xcdd7,
-  0xcdd7, 0xcdf8, 0xcdf7, 0x5a08, 0x5186, 0x9b0a, 0x9aca, 0x6188,
-  0xaa09, 0xb229, 0xa209, 0x5186, 0xcdb6, 0xcdd7, 0xc5d7, 0xe679,
-  0xe679, 0xc5d7, 0xc5f7, 0xd618, 0x7b0c, 0xbbee, 0xb34b, 0xaaaa,
-  0xba49, 0xab2b, 0xa30b, 0x4986, 0xcd96, 0x5269, 0x4a28, 0xcdf8,
-  0xcdf8, 0x4a29, 0x5249, 0xd5d7, 0x72eb, 0xa30a, 0xab2a, 0xab0a,
-  0xc269, 0xc38c, 0xb34b, 0x4924, 0xc28b, 0xcd76, 0xc5f7, 0xd639,
-  0xd639, 0xc5d7, 0xcd55, 0xc28b, 0x4924, 0xb2e9, 0xc349, 0xc349,
-  0xc248, 0xba48, 0x6965, 0x4145, 0xbd14, 0x5aaa, 0xbd75, 0xc5d7,
-  0xc5d7, 0xbd76, 0x5aaa, 0xbd14, 0x4965, 0xa207, 0xb329, 0xb32a,
-  0xca68, 0xc248, 0x6165, 0x4165, 0xcd96, 0xc554, 0x4a28, 0x39c7,
-  0x39c7, 0x4a28, 0xc554, 0xcdb6, 0x4145, 0x6965, 0xbb4a, 0xbb29,
-  0xbb4a, 0xba68, 0x8aca, 0x6acb, 0xcdb6, 0xddf7, 0xbd55, 0xb554,
-  0xb554, 0xbd55, 0xde17, 0xd5d7, 0x4145, 0x6985, 0xa2a8, 0xaac8,
-  0xcb8b, 0xd2c8, 0xc36a, 0x72eb, 0xc5b7, 0xcdd7, 0xc5d6, 0xc5b6,
-  0xc5b6, 0xc5d6, 0xcdd6, 0xbd55, 0x4965, 0xaaa7, 0xc2e7, 0xb2c7,
-  0x8a06, 0xc36a, 0xbb6a, 0x4985, 0xacd3, 0xacf3, 0xacd2, 0xb534,
-  0xb534, 0xacd3, 0xacf3, 0xacd2, 0x4944, 0xc267, 0xca87, 0x81e6,
-  0xca44, 0xd369, 0xd369, 0x5985, 0x9430, 0x4965, 0x5185, 0xa491,
-  0xa491, 0x4965, 0x4165, 0x9430, 0x5185, 0xc266, 0xca67, 0xc267,
-  0x89e5, 0x9206, 0xdaa7, 0xca67, 0x5144, 0x6144, 0xba46, 0x5164,
-  0x4944, 0x6963, 0x40e3, 0x5144, 0xc267, 0xbac7, 0x91e5, 0xca67,
-  0xd307, 0xd2e7, 0xdaa7, 0xd286, 0x81a4, 0xba46, 0xc266, 0x81a4,
-  0x7983, 0x81a4, 0x79a4, 0x81a4, 0xd286, 0xe2a4, 0xda64, 0xda86,
-  0x8a05, 0x89e5, 0x9205, 0xca66, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xd286, 0xdaa6, 0xda86, 0xdaa6,
-  0x4128, 0x4128, 0x4928, 0x89ca, 0x920a, 0x92ed, 0x8b0d, 0x92ed,
-  0xa20a, 0xa1ea, 0xa1ea, 0x91ca, 0x91c9, 0x91c9, 0x91c9, 0x91ca,
-  0x924a, 0x924a, 0x9a4a, 0xa30c, 0x9b0c, 0x9b0c, 0x9b0c, 0x9aec,
-  0x99e9, 0x91c9, 0x91a9, 0x91c9, 0x99c9, 0x99e9, 0x91c9, 0x91c9,
-  0x5147, 0x5988, 0x9b0c, 0x8aeb, 0x4986, 0x51c7, 0x51c7, 0x51c7,
-  0x51a7, 0x5186, 0x51a6, 0x4905, 0x89c8, 0x9acc, 0x91e9, 0x5948,
-  0xa1a6, 0xaaeb, 0xab0b, 0x5185, 0x5a07, 0xcdf7, 0xcdf8, 0xc5d7,
-  0xc5d7, 0xcdf8, 0xcdf7, 0x59c7, 0x5145, 0xab0b, 0xa229, 0x9a49,
-  0x6167, 0xaa29, 0xaa09, 0x5186, 0xcdb6, 0xcdf7, 0xc5d7, 0xe679,
-  0xe679, 0xc5d7, 0xc5f7, 0xd618, 0x7b0c, 0xb3ee, 0xa2ea, 0x61a8,
-  0xb229, 0xb249, 0xaa28, 0x4965, 0xcd96, 0x5269, 0x4a28, 0xcdf8,
-  0xcdf8, 0x4a29, 0x5249, 0xd5d7, 0x72eb, 0xb34a, 0xbb4a, 0xb309,
-  0xba69, 0xab2b, 0x9aea, 0x4924, 0xc28b, 0xcd76, 0xc5f7, 0xd639,
-  0xd639, 0xc5d7, 0xcd55, 0xc28b, 0x4924, 0xa2e9, 0xab2a, 0xab2a,
-  0xc269, 0xbb4a, 0x6985, 0x4145, 0xbd14, 0x5aaa, 0xbd75, 0xc5d7,
-  0xc5d7, 0xbd76, 0x5aaa, 0xbd14, 0x4965, 0xb2e8, 0xc349, 0xc36a,
-  0xca68, 0xc268, 0x6165, 0x4165, 0xcd96, 0xc554, 0x4a28, 0x39c7,
-  0x39c7, 0x4a28, 0xc554, 0xcdb6, 0x4145, 0x6985, 0xb309, 0xaae8,
-  0xca68, 0xc268, 0x8aca, 0x6acb, 0xcdb6, 0xddf7, 0xbd55, 0xb554,
-  0xb554, 0xbd55, 0xde17, 0xd5d7, 0x4145, 0x6984, 0xb2e8, 0xbae7,
-  0xc32a, 0xca88, 0xbb4a, 0x72cb, 0xc5b7, 0xcdd7, 0xc5d6, 0xc5b6,
-  0xc5b6, 0xc5d6, 0xcdd6, 0xbd55, 0x4965, 0x9a87, 0xaae8, 0xaae8,
-  0xca24, 0xd2a8, 0xcb69, 0x4985, 0xacd3, 0xacf3, 0xacd2, 0xb534,
-  0xb534, 0xacd3, 0xacf3, 0xacd2, 0x4944, 0xbac7, 0xcb08, 0xcae8,
-  0x8a06, 0xcb6a, 0xc36a, 0x5185, 0x9430, 0x4965, 0x5185, 0xa491,
-  0xa491, 0x4965, 0x4165, 0x9430, 0x5165, 0xca67, 0xd287, 0x91e6,
-  0xcae7, 0xd328, 0xdbaa, 0xca87, 0x5144, 0x6144, 0xba46, 0x5164,
-  0x4944, 0x6963, 0x40e3, 0x5144, 0xc267, 0xd287, 0xca67, 0xca67,
-  0x9205, 0x9a05, 0xdac7, 0xdaa7, 0x89a4, 0xba26, 0xc266, 0x81a4,
-  0x7983, 0x81a4, 0x79a4, 0x81a4, 0xd287, 0x9a05, 0x9a05, 0xd287,
-  0xda43, 0xda43, 0xe2a6, 0xd286, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xd286, 0xe2e6, 0xe307, 0xdaa6,
-  0x924a, 0x924a, 0x91ca, 0x91c9, 0x91c9, 0x920a, 0xa32d, 0xab2d,
-  0xa22a, 0xab0c, 0xab0d, 0xa20a, 0x91c9, 0x99a6, 0xa1a6, 0x91c9,
-  0x4928, 0x4928, 0x5168, 0x91e9, 0x91e9, 0x8aab, 0x8aec, 0x8acc,
-  0x91e9, 0x99e9, 0x91e9, 0x91c9, 0x99c9, 0x99c9, 0x99c9, 0x99c9,
-  0x9186, 0x99c6, 0xa30b, 0x9aeb, 0x5165, 0x51c7, 0x51c7, 0x51c7,
-  0x5166, 0x5166, 0x5166, 0x4904, 0x89a8, 0x99e9, 0x99c9, 0x91c9,
-  0x6168, 0x9aeb, 0x9b0c, 0x5186, 0x5a08, 0xcdf7, 0xcdf8, 0xcdd7,
-  0xc5d7, 0xcdf8, 0xcdf7, 0x59c7, 0x5145, 0x9aca, 0x9a09, 0x6168,
-  0xaa49, 0xbb4c, 0xab2c, 0x59e7, 0xcdf7, 0xcdf7, 0xc5d7, 0xe679,
-  0xe679, 0xc5d7, 0xc5d7, 0xd5d7, 0x7b0c, 0xbbcd, 0xaa49, 0xaa89,
-  0xab0b, 0xba69, 0xaa28, 0x4966, 0xcd96, 0x5269, 0x4a28, 0xcdf8,
-  0xcdf8, 0x4a29, 0x5249, 0xd5d7, 0x72eb, 0xa30a, 0xab0a, 0xab0a,
-  0xba49, 0xba49, 0xaa08, 0x4904, 0xc28b, 0xcd55, 0xc5d7, 0xd639,
-  0xd639, 0xc5d7, 0xcd55, 0xc28b, 0x4924, 0xb309, 0xc36a, 0xc349,
-  0xc269, 0xb30b, 0x6965, 0x4144, 0xbd14, 0x5aaa, 0xbd75, 0xc5d7,
-  0xc5d7, 0xbd76, 0x5aaa, 0xbd14, 0x4965, 0xa2c8, 0xb32a, 0xb329,
-  0xca88, 0xcb6b, 0x6186, 0x4165, 0xcd96, 0xc554, 0x4a28, 0x39c7,
-  0x39c7, 0x4a28, 0xc554, 0xcdb6, 0x4145, 0x6985, 0xc329, 0xbb29,
-  0xca68, 0xca88, 0x8aaa, 0x6acb, 0xcdb6, 0xddf7, 0xbd55, 0xb554,
-  0xb554, 0xbd55, 0xde17, 0xd5d7, 0x4145, 0x6964, 0xa2a8, 0xaac8,
-  0xca67, 0xd268, 0xba68, 0x72ca, 0xc5d7, 0xcdd7, 0xc5d6, 0xc5b6,
-  0xc5b6, 0xc5d6, 0xcdd6, 0xbd55, 0x4945, 0xb226, 0xbae8, 0xb2c7,
-  0x89e6, 0xc267, 0xbb29, 0x4985, 0xacd3, 0xacf3, 0xacd2, 0xb534,
-  0xb534, 0xacd3, 0xacf3, 0xacd2, 0x4144, 0xaaa7, 0xb2e7, 0x81e6,
-  0xcac7, 0xd2a7, 0xcb8a, 0x51a5, 0x9430, 0x4965, 0x5185, 0xa491,
-  0xa491, 0x4965, 0x4165, 0x9430, 0x5185, 0xbae7, 0xcb07, 0xcae7,
-  0x89e5, 0x9206, 0xcb69, 0xbb28, 0x5164, 0x6144, 0xba46, 0x5164,
-  0x4944, 0x6963, 0x40e3, 0x5144, 0xca67, 0xe2a7, 0xd2a7, 0x9206,
-  0xd243, 0xd243, 0xe284, 0xdaa6, 0x89c4, 0xba26, 0xc266, 0x81a4,
-  0x7983, 0x81a4, 0x79a4, 0x81a4, 0xdaa7, 0xda87, 0xd287, 0xd287,
-  0x89e5, 0x91e5, 0xe2a6, 0xe2a6, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xda86, 0x9205, 0x91e5, 0xd286,
-  0x4128, 0x4928, 0x99ca, 0xa1ea, 0x91c9, 0x91ea, 0x92ed, 0x92ed,
-  0xa20a, 0x92ed, 0x930d, 0xa20a, 0x99ca, 0x4948, 0x4948, 0x89a9,
-  0x9186, 0x9186, 0x99ea, 0x99c9, 0x91a9, 0x89c9, 0x9aec, 0x9aec,
-  0x99e9, 0x9aec, 0x9aec, 0x99e9, 0x99e9, 0x9a29, 0x9a4a, 0x99e9,
-  0x5147, 0x5988, 0x92cc, 0x89c9, 0x4905, 0x51a7, 0x51c7, 0x51c7,
-  0x5166, 0x5186, 0x5186, 0x4904, 0x89a8, 0x99e9, 0x99e9, 0x99c9,
-  0x9a6a, 0xab4c, 0xab4c, 0x5165, 0x5a07, 0xcdf7, 0xcdf8, 0xc5d7,
-  0xc5d7, 0xcdf7, 0xcdb6, 0x59a7, 0x5125, 0x9a09, 0xa1e9, 0x99e9,
-  0x61a8, 0xa32c, 0x9b0b, 0x51c7, 0xcdf7, 0xcdf8, 0xc5d7, 0xe679,
-  0xe679, 0xc5d7, 0xc5d7, 0xd5d7, 0x7b0c, 0xb3ce, 0xa229, 0x6167,
-  0xb34b, 0xbb6b, 0xb30b, 0x4986, 0xcdb6, 0x5269, 0x4a28, 0xcdf8,
-  0xcdf8, 0x4a29, 0x5249, 0xd5b6, 0x72eb, 0xb32a, 0xaa49, 0xaae9,
-  0xab2b, 0xc269, 0xaa28, 0x4904, 0xc28b, 0xcd55, 0xc5d7, 0xd639,
-  0xd639, 0xc5d7, 0xcd55, 0xc28b, 0x4924, 0xa2e9, 0xab0a, 0xab2a,
-  0xc269, 0xba48, 0x6965, 0x4145, 0xbd14, 0x5aaa, 0xbd75, 0xc5d7,
-  0xc5d7, 0xbd76, 0x5aaa, 0xbd14, 0x4965, 0xb2e8, 0xc349, 0xc36a,
-  0xca68, 0xb32a, 0x6186, 0x4165, 0xcd96, 0xc554, 0x4a28, 0x39c7,
-  0x39c7, 0x4a28, 0xc554, 0xcdb6, 0x4145, 0x6985, 0xb309, 0xaae8,
-  0xca88, 0xcb6a, 0x8aca, 0x6acb, 0xcdb6, 0xddf7, 0xbd55, 0xb554,
-  0xb554, 0xbd55, 0xde17, 0xd5d7, 0x4145, 0x6965, 0xb2e8, 0xbae7,
-  0xd288, 0xd288, 0xc268, 0x72ca, 0xc5d7, 0xcdd7, 0xc5d6, 0xc5b6,
-  0xc5b6, 0xc5d6, 0xcdd6, 0xbd55, 0x4945, 0xb226, 0xb2c8, 0xaae8,
-  0xca67, 0xd288, 0xba47, 0x4965, 0xacf3, 0xacf3, 0xacd2, 0xb534,
-  0xb534, 0xacd3, 0xacf3, 0xacd2, 0x4944, 0xba47, 0xc307, 0xcae8,
-  0x89e5, 0xca87, 0xc329, 0x5185, 0x9430, 0x4965, 0x5185, 0xa491,
-  0xa491, 0x4965, 0x4165, 0x9430, 0x5185, 0xaaa7, 0xb2e7, 0x89e5,
-  0xca23, 0xd2a7, 0xdb89, 0xba87, 0x5144, 0x6144, 0xba46, 0x5164,
-  0x4944, 0x6963, 0x40e3, 0x5164, 0xbae7, 0xd327, 0xdb07, 0xd224,
-  0x9205, 0x9205, 0x9a46, 0xc327, 0x81c4, 0xba46, 0xc266, 0x81a4,
-  0x7983, 0x81a4, 0x79a4, 0x81a4, 0xdaa7, 0xe2c7, 0xdaa7, 0x9a05,
-  0xe327, 0xe327, 0xe307, 0xdac7, 0x91e4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xe2a7, 0xeaa7, 0xdaa6, 0xd286,
-  0x9186, 0x9986, 0xa1a6, 0xa1ea, 0xa20a, 0xa30c, 0xa34d, 0xa32d,
-  0xa20a, 0xa20a, 0xa20a, 0xa1ea, 0xa1ea, 0x91ca, 0x89a9, 0x91c9,
-  0x4948, 0x5148, 0x99c9, 0xa1ea, 0x91c9, 0x9209, 0x92ec, 0x92ec,
-  0x9a0a, 0x92cc, 0x92cc, 0x9a0a, 0x99ca, 0x5168, 0x5148, 0x91c9,
-  0x924a, 0x9a6a, 0xa22a, 0x91c9, 0x81a7, 0x81e8, 0x8aaa, 0x8aaa,
-  0x81e8, 0x8aaa, 0x8aaa, 0x89c8, 0x91e9, 0xa2cb, 0x99c6, 0x99c9,
-  0x6188, 0x9aec, 0x9b0c, 0x81e8, 0x8a08, 0xa3cf, 0x82ec, 0x82cc,
-  0x82cc, 0x82ec, 0xab2d, 0x89e8, 0x81a7, 0xa209, 0xa1e8, 0xa1e9,
-  0xa9e6, 0xb32b, 0xb34c, 0x92a9, 0xbc0f, 0x830d, 0x7acc, 0xb36e,
-  0xb36e, 0x7acc, 0x82ec, 0xb32d, 0x81c8, 0xa208, 0xa209, 0xa209,
-  0xab2b, 0xab6c, 0xa32b, 0x61a6, 0xabce, 0x7aeb, 0x5a29, 0x82ec,
-  0x82ec, 0x5a49, 0x7acb, 0xb32d, 0x5966, 0xa2c9, 0xaa29, 0xaaea,
-  0xc3ac, 0xc38c, 0xb34b, 0x5985, 0x9a8a, 0xb3ef, 0x82ec, 0x82ec,
-  0x82ec, 0x82ec, 0xb3ce, 0xa28a, 0x5985, 0xb309, 0xb269, 0xc34a,
-  0xb32b, 0xba69, 0x6986, 0x5145, 0x8acb, 0x6a69, 0x82cb, 0x82eb,
-  0x82eb, 0x82cb, 0x6a69, 0x82cb, 0x5965, 0xa2e9, 0xb329, 0xb329,
-  0xca68, 0xc248, 0x6145, 0x5965, 0xbb4c, 0xbb4c, 0x6228, 0x5a08,
-  0x5a08, 0x6228, 0xbb4c, 0xbb4c, 0x5965, 0x6985, 0xbb49, 0xbb08,
-  0xca68, 0xbb2a, 0x71c5, 0x6165, 0xb32c, 0xbb6c, 0x8aca, 0x82ca,
-  0x82ca, 0x8aca, 0xbb6c, 0xb32c, 0x6165, 0x7185, 0xa2a8, 0xaac8,
-  0xd288, 0xd38a, 0xc349, 0x6985, 0x8aca, 0x8aeb, 0x8aeb, 0x8aca,
-  0x8aca, 0x8aeb, 0x8aeb, 0x8aca, 0x6185, 0xb2a7, 0xbae7, 0xb2e8,
-  0xd288, 0xd2a8, 0xca87, 0x6985, 0x82a9, 0x82a9, 0x82a9, 0x8ac9,
-  0x8ac9, 0x82a9, 0x82a9, 0x82a9, 0x6164, 0xba67, 0xb2c7, 0x81e6,
-  0xd267, 0xd287, 0xc267, 0x71a4, 0x8268, 0x69a4, 0x71a4, 0x8288,
-  0x8288, 0x6984, 0x6184, 0x8268, 0x71a4, 0xc267, 0xc2e7, 0xca24,
-  0x91e6, 0xca87, 0xd369, 0xc266, 0x7184, 0xaa25, 0xca66, 0x7184,
-  0x6984, 0x7184, 0x6163, 0x6984, 0xc266, 0xbac7, 0x89e5, 0x89e5,
-  0xd2e7, 0xdaa7, 0xdb07, 0xca86, 0x89c4, 0xc246, 0xc266, 0x81c4,
-  0x79a4, 0x81a4, 0x79a4, 0x81c4, 0xcb07, 0xe284, 0xda63, 0xd2e7,
-  0x8a05, 0x89e5, 0x89e5, 0x89e5, 0x89c4, 0xb225, 0xb225, 0x89c4,
-  0x81c3, 0x81c3, 0x81c3, 0x89c4, 0xdaa7, 0xeaa6, 0xe2a6, 0x9205
-};
-
-const Animation halloweenAnimation = {
-  .name = "Halloween",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = halloweenDurations,
-  .animationFrames = halloweenFrames
-};
-#endif // ANIMATION_HALLOWEEN_H
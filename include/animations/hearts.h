@@ -1,534 +0,0 @@
-// hearts.h - Auto-generated from hearts.json
-#ifndef ANIMATION_HEARTS_H
-#define ANIMATION_HEARTS_H
-
-#include "animation_types.h"
-
-// Frame Durations for hearts (in 100ms units)
-static const uint8_t PROGMEM heartsDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for hearts
-static const uint16_t PROGMEM heartsFrames[] = {
-  0x2d7e, 0x2d7e, 0x0000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x0000,
-  0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x0000, 0xd000, 0xd000, 0x0000, 0x2d7e, 0x0000, 0xd000,
-  0xd000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0x0000, 0xd000, 0xd000,
-  0xd000, 0xd000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xd000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xd000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0x0000, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x0000, 0xd000, 0xd000, 0xd000, 0x0000,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x0000, 0xd000, 0x0000, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x0000, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x0000, 0x0000, 0x2d7e, 0x0000, 0x0000, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x0000, 0xd000, 0xd000, 0x0000, 0xd000, 0xd000, 0x0000,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x0000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0x0000,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x0000, 0xd000, 0xd000, 0xd000, 0x0000, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x0000, 0xd000, 0x0000, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x2d7e, 0x2d7e, 0x0000, 0x2d7e, 0x2d7e, 0x2d7e,
-  0x2498, 0x2062, 0xc000, 0xc000, 0x2062, 0x1c36, 0x2062, 0xc000,
-  0xc000, 0x2062, 0x2498, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xa800, 0xd000, 0xd000, 0xb000, 0x3062, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d5d, 0x2cfa, 0x2cfa, 0x2d5d, 0x2d7d, 0x2d5d, 0x2cfa,
-  0x2cfa, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d1b, 0x00c4, 0x00c4, 0x2cfb, 0x2d9e, 0x2d1b, 0x00c4,
-  0x00c4, 0x2cfb, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xb800, 0xd000, 0xd000, 0xc000, 0x3000, 0xc000, 0xd000,
-  0xd000, 0xc000, 0x1062, 0x24fb, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x18a3, 0x18a3, 0x2498, 0x2d7d, 0x2499, 0x18a3,
-  0x18a3, 0x2498, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x24fb, 0x10e4, 0xb000, 0xb000, 0x10e4, 0x2499, 0x10e4, 0xb000,
-  0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2498, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x2436, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2498, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xa800, 0xd000, 0xd000, 0xb000, 0x2062, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x251b, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2498, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20a4, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fa, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x251b, 0x10e4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x10c4, 0x251b, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20a4, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xb800, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1062, 0x24fb, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7e, 0x251b, 0x10c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x10c4, 0x251b, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2499, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20a4,
-  0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xa800, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2498, 0x2062, 0xc000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xc000, 0x2062, 0x2498, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x251b, 0x10c4, 0xb000, 0xd800, 0xb000, 0x10c4,
-  0x251b, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2499, 0x20c4, 0xa000, 0x28a4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20e4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x2499, 0x2062, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000,
-  0x2062, 0x2498, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x251b, 0x18c4, 0xa000, 0x18c4, 0x251b,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x2d7e, 0x2d7d, 0x2d7e, 0x2d7e, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2498, 0x1926, 0x2498, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x2499, 0x2062, 0xc000, 0xd000, 0xc000, 0x2062,
-  0x2498, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2cfb, 0x0946, 0x2cfb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x24fb, 0x24fb, 0x2d7d, 0x24fb, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d1b, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10c4, 0x10c4, 0x2457, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d5d, 0x2d7d, 0x2d7e, 0x2499, 0x2062, 0xb000, 0x2062, 0x2498,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x1041, 0x1062, 0x2436, 0x1062, 0x1062, 0x2498,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xb000, 0x3062, 0xb000, 0xb000, 0x1062,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20c4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2498, 0x10c4, 0x2498, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d5d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e,
-  0x24fb, 0x1062, 0xc000, 0xc000, 0x3000, 0xc000, 0xc000, 0x1000,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1062,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd800, 0xb000, 0x20c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d5d, 0x2cfa, 0x2cfa, 0x2d5d, 0x2cfb, 0x2cfa, 0x2d5d,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d1b, 0x00c4, 0x00c4, 0x2499, 0x00c4, 0x00c4, 0x2cfb,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000, 0x1062,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4, 0x2498,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x18a3, 0x18c4, 0x2436, 0x18c4, 0x18c4, 0x2498,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xb000, 0x2062, 0xb000, 0xb000, 0x1062,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x251b, 0x10c4, 0xb000, 0xd800, 0xb000, 0x10c4, 0x251b,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2499, 0x20c4, 0xa000, 0x28a4, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1062,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x24fb, 0x1062, 0xc000, 0xd000, 0xc000, 0xd000, 0xc000, 0x1000,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x2d7e, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e,
-  0x2d7e, 0x2d7e, 0x251b, 0x18c4, 0xa000, 0x18c4, 0x251b, 0x2d9e,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b,
-  0x251b, 0x2d7d, 0x2d7d, 0x2498, 0x1926, 0x2498, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x10a4, 0x10a3, 0x2499, 0x2d9e, 0x24b9, 0x10a4,
-  0x10a3, 0x2499, 0x2d7e, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1062,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2499, 0x2062, 0xc000, 0xd800, 0xc000, 0x2062, 0x2498,
-  0x2d7d, 0x2d7d, 0x24fb, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x24fb,
-  0x24fb, 0x2d7d, 0x2d7e, 0x2cfb, 0x0946, 0x2cfb, 0x2d7e, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10c4, 0x10c4, 0x24b9, 0x2d7e, 0x24b9, 0x10c4,
-  0x10c4, 0x2499, 0x2d7e, 0x2d5d, 0x2d1b, 0x2d5d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xb000, 0x20c4, 0x1c37, 0x20c4, 0xb000,
-  0xb000, 0x20a3, 0x2499, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xb000, 0x3041, 0xb000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1000, 0xc000, 0xd000, 0xd000, 0xd000, 0xc000, 0xd000, 0xd000,
-  0xd000, 0xc000, 0x1041, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x1062, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xd000, 0xb000, 0x10c4, 0x24fb, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2499, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xd000, 0xd000,
-  0xb000, 0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xd000, 0xd000, 0xb000,
-  0x20c4, 0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4,
-  0x24b9, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7e, 0x24b9, 0x20c4, 0xa000, 0x20a4, 0x24b9,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7e, 0x2499, 0x1126, 0x2499, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x251b, 0x251b, 0x2d7d, 0x251b, 0x24fb, 0x2d7d,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x251b, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x10a4, 0x10c4, 0x2437, 0x10c4, 0x10c4, 0x2499,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10a4, 0xb000, 0xb000, 0x3041, 0xb000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x251b, 0x10c4, 0xb000, 0xd000, 0xc000, 0xd000, 0xb000, 0x1041,
-  0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x24b9, 0x20c4, 0xb000, 0xd000, 0xb000, 0x20c4, 0x2499,
-  0x2d5d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d, 0x2d7d,
-  0x2d7d, 0x2d7e, 0x2499, 0x2062, 0xb000, 0x2062, 0x2499, 0x2d9e
-};
-
-const Animation heartsAnimation = {
-  .name = "Hearts",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = heartsDurations,
-  .animationFrames = heartsFrames
-};
-#endif // ANIMATION_HEARTS_H
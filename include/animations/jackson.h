@@ -1,1878 +0,0 @@
-// jackson.h - Auto-generated from jackson.json
-#ifndef ANIMATION_JACKSON_H
-#define ANIMATION_JACKSON_H
-
-#include "animation_types.h"
-
-// Frame Durations for jackson (in 100ms units)
-static const uint8_t PROGMEM jacksonDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for jackson
-static const uint16_t PROGMEM jacksonFrames[] = {
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0xa2c8, 0xffff, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0xffff, 0x02bf, 0x02bf, 0x02bf, 0xa2c8, 0xa2c8, 0x0000,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0xffff, 0xa2c8, 0x0000, 0x0000, 0xef5b, 0xa2c8, 0xef5b,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000, 0xef7c, 0xef5b, 0xef5b,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0xf79c, 0xf79c, 0xef5b,
-  0x0084, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0xf79d, 0xef5b, 0xf79c,
-  0x08a4, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000, 0xf79d, 0xef5b,
-  0x0084, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf, 0x0000,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf, 0x02bf,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf, 0x02bf,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf, 0x02bf,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0000, 0x0000, 0x02bf, 0x02bf,
-  0x0000, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x12bd, 0x131f, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x932d, 0xce9d, 0x131f, 0x027d, 0x00a7, 0x0820, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233d, 0xdf1f, 0x233d, 0x025c, 0x0a59, 0x92ca, 0x8a66, 0x18c4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xcebd, 0x8aca, 0x0842, 0x10c4, 0xce16, 0xbbed, 0xc5d5,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dd, 0x08a5, 0x0000, 0x1081, 0xd6b9, 0xef3a, 0xdeb8,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x023a, 0x0022, 0x1081, 0xdefa, 0xf79c, 0xd6b9,
-  0x1927, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x1061, 0xce58, 0xf79c, 0xdefa,
-  0x1905, 0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x2104, 0xce58, 0xce58,
-  0x1127, 0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x00a7, 0x0218, 0x0022, 0x1082, 0x10a4,
-  0x0238, 0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029d, 0x027d, 0x0022, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027d,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12bd, 0x131f, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x932d, 0xce9d, 0x131f, 0x027d, 0x00a7, 0x0820, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233d, 0xdf1f, 0x233d, 0x025c, 0x0a59, 0x92ca, 0x8a66, 0x18c4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xcebd, 0x8aca, 0x0842, 0x10c4, 0xce16, 0xbbed, 0xc5d5,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dd, 0x08a5, 0x0000, 0x1081, 0xd6b9, 0xef3a, 0xdeb8,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x023a, 0x0022, 0x1081, 0xdefa, 0xf79c, 0xd6b9,
-  0x1947, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x1061, 0xce58, 0xf79c, 0xdefa,
-  0x1947, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0022, 0x0000, 0x2103, 0xce58, 0xce58,
-  0x1127, 0x0086, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0087, 0x0042, 0x0022, 0x0000, 0x1082, 0x10a4,
-  0x0238, 0x027c, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027c, 0x027d, 0x025b, 0x0022, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027d,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12bd, 0x131f, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x932d, 0xce9d, 0x131f, 0x027d, 0x00a7, 0x0820, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233d, 0xdf1f, 0x233d, 0x025c, 0x0a59, 0x92ca, 0x8a66, 0x18c4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xcebd, 0x8aca, 0x0842, 0x10c4, 0xce16, 0xbbed, 0xc5d5,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dd, 0x08a5, 0x0000, 0x1081, 0xd6b9, 0xef3a, 0xdeb8,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x025b, 0x0022, 0x1081, 0xdefa, 0xf79c, 0xd6b9,
-  0x1927, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x0022, 0x1061, 0xce58, 0xf79c, 0xdefa,
-  0x196a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0000, 0x0000, 0x2103, 0xce58, 0xce79,
-  0x12fd, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0022, 0x0022, 0x0022, 0x0000, 0x1082, 0x10a4,
-  0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0086, 0x025a, 0x025b, 0x0022, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x02bf, 0x025b, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027d,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12bd, 0x131f, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x932d, 0xce9d, 0x131f, 0x027d, 0x00a7, 0x0820, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233d, 0xdf1f, 0x233d, 0x025c, 0x0a59, 0x92ca, 0x8a66, 0x18c4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xcebd, 0x8aca, 0x0842, 0x10c4, 0xce16, 0xbbed, 0xc5d5,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dd, 0x08a5, 0x0000, 0x1081, 0xd6b9, 0xef3a, 0xdeb8,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x023a, 0x0022, 0x1081, 0xdefa, 0xf79c, 0xd6b9,
-  0x1927, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x1061, 0xce58, 0xf79c, 0xdefa,
-  0x196a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0022, 0x0000, 0x2103, 0xce58, 0xce79,
-  0x12fd, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0086, 0x0000, 0x0022, 0x0000, 0x1082, 0x10a4,
-  0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x00a7, 0x0218, 0x0022, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x025a, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027d,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12bd, 0x131f, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x932d, 0xce9d, 0x131f, 0x027d, 0x00a7, 0x0820, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233d, 0xdf1f, 0x233d, 0x025c, 0x0a59, 0x92ca, 0x8a66, 0x18c4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xcebd, 0x8aca, 0x0842, 0x10c4, 0xce16, 0xbbed, 0xc5d5,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dd, 0x08a5, 0x0000, 0x1081, 0xd6b9, 0xef3a, 0xdeb8,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x023a, 0x0022, 0x1081, 0xdefa, 0xf79c, 0xd6b9,
-  0x1947, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x1061, 0xce58, 0xf79c, 0xdefa,
-  0x1947, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x2103, 0xce78, 0xc637,
-  0x1107, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0000, 0x0000, 0x1082, 0x10a3,
-  0x0218, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0064, 0x0000, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0218, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027d,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x0022, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0863, 0x0821, 0x00a7,
-  0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b, 0x92ca, 0x8a88, 0x0a38,
-  0x027c, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x10e6, 0xd616, 0xab6b, 0x18e4,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x10c4, 0xd6b9, 0xef1a, 0xc616,
-  0x10a4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0023, 0x1082, 0xdefa, 0xf79d, 0xdeb9,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10a4, 0x1081, 0xce58, 0xf79c, 0xdef9,
-  0x1905, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc65b, 0x1081, 0x18e3, 0xce58, 0xd677,
-  0x92eb, 0x0a9d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xd69b, 0x10c4, 0x0000, 0x1082, 0x18a2,
-  0x8269, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x0abd, 0x830f, 0x0a59, 0x0022, 0x0000, 0x0000,
-  0x0862, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0abd, 0x027d, 0x0022, 0x0000, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x0022,
-  0x0042, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x023a,
-  0x0044, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027d, 0x029d,
-  0x0064, 0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf,
-  0x023a, 0x0044, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x025c, 0x02bf,
-  0x027c, 0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x00a7, 0x0841, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a39, 0x8248, 0x8a46, 0x18e4,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x1861, 0xa34b, 0xd679,
-  0x1107, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0001, 0x0861, 0xd698, 0xef5c,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x18c2, 0xdefa, 0xded9,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b, 0x82aa, 0xef1a, 0xdefa,
-  0x10c4, 0x0219, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x18e5, 0xce58, 0xce37,
-  0x1081, 0x0066, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x1082, 0x1082,
-  0x0862, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0820,
-  0x8269, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0820,
-  0x8269, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0000,
-  0x0862, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0042, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x0218, 0x0064,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x027c, 0x025a,
-  0x0064, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027d,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a, 0x0021, 0x0001, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x00a7, 0x0820, 0x0821, 0x00a7,
-  0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a38, 0x92ea, 0x8a88, 0x0a38,
-  0x027c, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x2189, 0xde38, 0xab6b, 0x18e5,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x025c, 0x10e6, 0xce58, 0xc44f, 0xf73c, 0xd6ba,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x2966, 0xef5d, 0xffbe, 0xffff, 0xef5c,
-  0x10c4, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x12ff, 0xc67d, 0xe73c, 0xef5d, 0xffff, 0xef5d,
-  0x10a2, 0x0023, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12fd, 0x10e6, 0x2104, 0xce79, 0xd6ba,
-  0x18c2, 0x0043, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x023a, 0x0022, 0x1082, 0x20c2,
-  0x8269, 0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0000, 0x0820,
-  0x8269, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0000,
-  0x0862, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0042, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x0217, 0x0022,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x023a, 0x0022,
-  0x0022, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0022,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0820, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x0a59, 0x92eb, 0x8a46, 0x0842,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x10c4, 0xde9a, 0xab6b, 0x18a2,
-  0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0001, 0x1081, 0xe73c, 0xf79e, 0xd6ba,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10a4, 0x10a2, 0xef5d, 0xffff, 0xef5d,
-  0x10c4, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc65a, 0x2124, 0xd69a, 0xffff, 0xe6fb,
-  0x1082, 0x0043, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc69d, 0x20e3, 0x2104, 0xce17, 0xa34b,
-  0x0820, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x1afd, 0x7228, 0x0820, 0x18a2, 0x7a26,
-  0x0862, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0863, 0x0000, 0x0021, 0x0820,
-  0x0042, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0218, 0x0022,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0064, 0x025b, 0x0064,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0021, 0x025a, 0x02bf, 0x023a,
-  0x0044, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0021, 0x0064, 0x027d, 0x02bf, 0x027d,
-  0x0065, 0x0044, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0022, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x023a, 0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0044, 0x0044, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0820, 0x0820, 0x0064,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0885, 0x7a06, 0x8a46, 0x0800,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0238, 0x2925, 0x92c8, 0x20c2,
-  0x0022, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x10e6, 0xd6ba, 0xf77d, 0xdedb,
-  0x1082, 0x0043, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0023, 0x1081, 0xef5d, 0xffff, 0xd6ba,
-  0x1082, 0x0043, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10a4, 0x10a2, 0xef5d, 0xef3c, 0x39a6,
-  0x0022, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc65a, 0x2124, 0xce38, 0xbbed, 0xbdb6,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc69d, 0x20e3, 0x18a2, 0x8226, 0x20c2,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x1b1d, 0x7228, 0x0800, 0x0820, 0x0000,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0862, 0x0022, 0x0022, 0x0000,
-  0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0044, 0x025b, 0x025b, 0x0064,
-  0x0022, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x027d,
-  0x023a, 0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0064, 0x027c, 0x02bf, 0x02bf, 0x02bf,
-  0x027d, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0022, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x027c, 0x0022, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x027c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0064, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0064,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0820, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x1905, 0x8a88, 0x20c2,
-  0x0022, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x10e6, 0xd6ba, 0xf79e, 0xdedb,
-  0x1082, 0x0043, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0023, 0x1082, 0xef5d, 0xf79e, 0xd6ba,
-  0x1082, 0x0043, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10a4, 0x1082, 0xd659, 0xab6b, 0x3144,
-  0x0042, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc65a, 0x20e3, 0x1882, 0x92a8, 0xbdb6,
-  0x10c4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xd6dd, 0x8aa8, 0x0800, 0x0840, 0x10a2,
-  0x0042, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x12dd, 0x0863, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0022, 0x0022, 0x0022, 0x0000,
-  0x0022, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x025a, 0x025b, 0x0064,
-  0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0044, 0x027d, 0x02bf, 0x025b,
-  0x0064, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x025a, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x027d, 0x0022, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x00a7, 0x0820, 0x0021, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a59, 0x7a48, 0x1840, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x08a5, 0xa2e9, 0x92c8, 0x0862,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025c, 0x10c4, 0xe6fb, 0xe71b, 0x1082,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x021a, 0x10a4, 0xef5d, 0xf79e, 0x2944,
-  0x0021, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0086, 0x2124, 0xe6fb, 0xe73c, 0xc618,
-  0x10a4, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x12dc, 0xbe19, 0x9b2a, 0x28e3, 0x10a2,
-  0x0042, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x10c4, 0x1860, 0x7a05, 0x0820,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0002, 0x0820, 0x8248, 0x0820,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0a39, 0x0064,
-  0x0022, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0044, 0x027d, 0x025b,
-  0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x025a, 0x02bf, 0x027d,
-  0x0064, 0x0021, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0064, 0x027d, 0x02bf, 0x02bf,
-  0x023a, 0x0064, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x023a, 0x0064, 0x0044, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x027d, 0x0087, 0x0000, 0x0820, 0x00a6, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xc6bf, 0x2b7f, 0x027d, 0x01f7, 0x1882, 0x7a47, 0x0a58, 0x029f,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2b7f, 0xb5fa, 0x10c4, 0x1905, 0x92e9, 0xa2e9, 0x08a5, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x10e7, 0x10a3, 0xc618, 0xf77d, 0xe6fb, 0x1081, 0x0043,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x027d, 0x023a, 0x2167, 0xef7d, 0xef7d, 0x2124, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025c, 0x10a4, 0xef5c, 0xffff, 0xdedb, 0x1082,
-  0x0001, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x025c, 0x10e6, 0xd699, 0xef5d, 0xdeba, 0x18c2,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x10e6, 0x10a2, 0x20c2, 0x8226,
-  0x0863, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0001, 0x0800, 0x8205,
-  0x0863, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0022, 0x0022, 0x0862,
-  0x0042, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x025a, 0x023a,
-  0x0044, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0044, 0x029d, 0x029d,
-  0x0064, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x023a, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0064, 0x0044, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x025b, 0x0086, 0x0000, 0x0820, 0x00a6, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xc6bf, 0x22db, 0x0086, 0x01b5, 0x1883, 0x7a47, 0x0a58, 0x029f,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x231d, 0x728d, 0x0820, 0x18e5, 0x92c9, 0xa2e9, 0x0885, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x0a38, 0x10c4, 0xdeba, 0xf79d, 0xe6fb, 0x2124, 0x0044,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x0044, 0x1081, 0xd6ba, 0xffff, 0xffff, 0xd6ba, 0x1081,
-  0x0043, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x0065, 0x0022, 0x2104, 0xef5c, 0xffff, 0xef7d, 0x10a2,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x027d, 0x023a, 0x08c6, 0xd6dc, 0xffff, 0xdeba, 0x18e4,
-  0x01f8, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x027d, 0x237f, 0xc65a, 0x3165, 0x8226,
-  0x08a5, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x10a4, 0x0820, 0x8205,
-  0x0862, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0022, 0x0022, 0x0862,
-  0x0042, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x025a, 0x023a,
-  0x0044, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0044, 0x029d, 0x029d,
-  0x0064, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x023a, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0087, 0x0000, 0x0800, 0x0064, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x0218, 0x20e5, 0x8287, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x10e6, 0xdeba, 0xef1c, 0x2124, 0x0021,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x023a, 0x0044, 0x1082, 0xef3c, 0xf79e, 0xdedb, 0x1082,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0065, 0x0064, 0x0000, 0x10a2, 0xe6fb, 0xc490, 0xd659, 0x10a2,
-  0x0001, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x023a, 0x0044, 0x10a4, 0xd6ba, 0xd679, 0x2944, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x025a, 0x10c4, 0x20c2, 0x8226, 0x0863,
-  0x023b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0002, 0x0800, 0x8205, 0x0863,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0842, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0218, 0x0064,
-  0x0021, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0044, 0x027d, 0x025b,
-  0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0022, 0x025a, 0x02bf, 0x027d,
-  0x0064, 0x0021, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x023a, 0x0022, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x029f, 0x027c, 0x025c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x00a7, 0x0863, 0x0064, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b, 0x7a48, 0x1840, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x0a9c, 0xa32c, 0x92c8, 0x1883,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x10e6, 0xe6fb, 0xf75c, 0x9b0a,
-  0x0884, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x023a, 0x0044, 0x1082, 0xe75d, 0xffff, 0xe6fb,
-  0x10e6, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12fd, 0x00a6, 0x0000, 0x1082, 0xef5d, 0xffff, 0xef9f,
-  0x12fd, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2b9f, 0xb65f, 0x12ba, 0x0002, 0x1081, 0xd69a, 0xef5d, 0xd6dd,
-  0x131f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xc6bf, 0x237f, 0x027d, 0x0022, 0x0000, 0x1082, 0x10a2, 0x10c4,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x02bf, 0x027d, 0x0064, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025a, 0x0022, 0x0000, 0x0022, 0x0022,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0064, 0x0218, 0x0022,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x025a, 0x027d, 0x0021,
-  0x0021, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x027d, 0x027d, 0x0064,
-  0x0021, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0044, 0x027d, 0x02bf, 0x025b,
-  0x0064, 0x0044, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x027c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0044, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0842, 0x0820, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x0a7b, 0x92eb, 0x92a8, 0x0862,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x10e6, 0xe6fb, 0xef1b, 0x18c2,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0022, 0x1082, 0xef5d, 0xffbe, 0x9b2a,
-  0x0842, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x0021, 0x0000, 0x1082, 0xef5d, 0xffff, 0xe71b,
-  0x1107, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2b9f, 0xc69d, 0x10c4, 0x0000, 0x1082, 0xd69a, 0xef5d, 0xd6fd,
-  0x12dd, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xe73d, 0xd71f, 0x12ba, 0x0022, 0x0000, 0x1082, 0x10a2, 0x10c4,
-  0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x932d, 0x231e, 0x029d, 0x0064, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0a9d, 0x029f, 0x02bf, 0x025a, 0x0022, 0x0000, 0x0022, 0x0022,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0064, 0x0218, 0x0022,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x025a, 0x027d, 0x0021,
-  0x0021, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0021, 0x027d, 0x027d, 0x0064,
-  0x0021, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0044, 0x027d, 0x02bf, 0x025b,
-  0x0064, 0x0044, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0064, 0x0885,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x1840, 0x8226,
-  0x114a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0862, 0x92a8, 0x92cb,
-  0x0a9b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0044, 0x1081, 0xd67b, 0x233e,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00c7, 0x0000, 0x2924, 0xd6fd, 0x133f,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0842, 0x1081, 0xdedb, 0xef9f, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x0abd, 0x82aa, 0x18c2, 0xd6ba, 0xdefd, 0x1b1d,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x131f, 0xc619, 0x2944, 0x1082, 0x20c2, 0x82ab,
-  0x0abd, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x2146, 0xb596, 0x18a2, 0x0800, 0x8248,
-  0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x18c2, 0x7206, 0x0820, 0x0842,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0820, 0x0022, 0x0021,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0218, 0x0064,
-  0x0044, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0064, 0x0064, 0x027d, 0x025b,
-  0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0086, 0x0064, 0x025a, 0x02bf, 0x027d,
-  0x0064, 0x0021, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0063, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x023a, 0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a, 0x0021,
-  0x0022, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0840,
-  0x0862, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0087, 0x0820, 0x8226,
-  0x8269, 0x112a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0218, 0x0021, 0x0842,
-  0x0a7b, 0x029d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000, 0x08a4,
-  0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x0001, 0x1061, 0xc65a,
-  0x131f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x023a, 0x0022, 0x2944, 0xdefd,
-  0x133f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x1082, 0xce38, 0xef9f,
-  0x231d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0021, 0x0000, 0x0000, 0x2124, 0xd659,
-  0x934d, 0x0a9d, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0065, 0x0022, 0x0000, 0x0820, 0x18a2,
-  0x8268, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x023a, 0x0885, 0x71e5, 0x0820,
-  0x0842, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x0885, 0x0000,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0022,
-  0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029d, 0x025a, 0x0022,
-  0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x02bf, 0x12fd, 0x00a6, 0x0022, 0x0022,
-  0x0000, 0x0022, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x131f, 0xc67c, 0x10a2, 0x0001, 0x0218,
-  0x0022, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a, 0x0022,
-  0x0022, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000,
-  0x0862, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x1861,
-  0x7228, 0x114a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0862, 0x7207,
-  0x1abb, 0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000, 0x18e5,
-  0x029d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0001, 0x1061, 0xc63a,
-  0x131f, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0862, 0x2944, 0xdf1d,
-  0x2bbf, 0x0a9d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0884, 0x8267, 0xd659, 0xe73c,
-  0xd69b, 0x830f, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0000, 0x0820, 0x10a2, 0x10a2,
-  0x10c4, 0x0a58, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0064, 0x025a, 0x027d, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x027d, 0x025a, 0x0064, 0x0000,
-  0x0000, 0x0022, 0x0000, 0x0022, 0x0064, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x0044,
-  0x0022, 0x01d6, 0x10c4, 0x0000, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x2167, 0xb5d8, 0x1107, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x10c4, 0xb5b7, 0x237f, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x0042, 0x10a4, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a,
-  0x0021, 0x0022, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064,
-  0x0840, 0x0862, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0087, 0x0820,
-  0x8226, 0x8269, 0x112a, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0218, 0x0021,
-  0x0862, 0x0a7b, 0x029d, 0x029f, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0065, 0x0000,
-  0x0022, 0x0adc, 0x029d, 0x023a, 0x0086, 0x0239, 0x027d, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0000,
-  0x2945, 0xce7b, 0x10e5, 0x0022, 0x0022, 0x0064, 0x0064, 0x12dc,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x18a2,
-  0xc638, 0xdeba, 0x1081, 0x0043, 0x025b, 0x023a, 0x10e6, 0xc67c,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0820, 0x7206,
-  0x20c3, 0x1082, 0x0064, 0x025b, 0x02bf, 0x02bf, 0x027d, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0820,
-  0x0000, 0x0001, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0022,
-  0x0000, 0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0064, 0x0218,
-  0x0022, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x027d, 0x027d, 0x027d,
-  0x0064, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x025a, 0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x025a, 0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d,
-  0x0044, 0x0022, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0021, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d,
-  0x0022, 0x0001, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0820, 0x00a6, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0820, 0x724a, 0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0021,
-  0x0021, 0x0a9b, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000,
-  0x0022, 0x025a, 0x131f, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0000, 0x10c4, 0xc69d, 0x133f, 0x029f, 0x027d, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0000, 0x20c2, 0xc65a, 0x12fd, 0x023a, 0x0086, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0820, 0x7206, 0x18a2, 0x0042, 0x0044, 0x0022, 0x023a, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0000, 0x0820, 0x0000, 0x0064, 0x0218, 0x0022, 0x0044, 0x027c,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x025b, 0x027d, 0x0064, 0x10a4, 0x027c,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0064,
-  0x0000, 0x0022, 0x025a, 0x02bf, 0x029f, 0x12dd, 0xc69d, 0x2b9f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b,
-  0x0044, 0x0022, 0x027d, 0x02bf, 0x029f, 0x131f, 0xd6dd, 0xd6fc,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x023a, 0x0064, 0x027c, 0x02bf, 0x02bf, 0x027d, 0x10e7, 0x10e5,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x0065, 0x027c, 0x02bf, 0x02bf, 0x029f, 0x025c, 0x025c,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x023a, 0x0064, 0x027c, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x023a,
-  0x0022, 0x1040, 0x1040, 0x0064, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0087,
-  0x0820, 0x7a26, 0x828b, 0x0a7b, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0218,
-  0x0021, 0x0862, 0x0a59, 0x02bf, 0x02bf, 0x029f, 0x0a9d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0065,
-  0x0000, 0x0000, 0x0064, 0x025a, 0x029f, 0x0abd, 0x832f, 0x12bd,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0a7b, 0x2b7f, 0xbe5d, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x10a2, 0x0043, 0x0863, 0x82ed, 0xc67e, 0x237f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x1081, 0xb5b8, 0x12ba, 0x023a, 0x0a7a, 0x12dc, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x1082, 0x0042, 0x0022, 0x0022, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0022, 0x0022, 0x0021, 0x0022, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0022, 0x023a, 0x029d, 0x023a, 0x0044, 0x0239, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0021, 0x0022, 0x027d, 0x02bf, 0x029d, 0x10c4, 0x0086, 0x027d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x027c, 0x029f, 0x131f, 0xc69d, 0x12fd, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x0218, 0x0064, 0x027c, 0x029f, 0x12dc, 0xc67c, 0x12fd, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x027d, 0x027d, 0x00a7, 0x10c5, 0x00a7, 0x027d,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x0021, 0x0022, 0x027c, 0x02bf, 0x027c, 0x025c, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0022, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x023a, 0x0022, 0x0001, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0065, 0x0840, 0x0841, 0x00a7, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0862, 0x8225, 0x8248, 0x1259, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0820, 0x1881, 0x82ec, 0x12bd, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x10a2, 0xce7b, 0x1b3f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x10a2, 0xd6fd, 0x133f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x10a2, 0xd67b, 0x233d, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0840, 0x92a8, 0x82cd, 0x0abd, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0842, 0x0a7b, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0022, 0x0022, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x0218, 0x0022, 0x0043, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x0218, 0x0064, 0x023a, 0x0065, 0x10c4, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x025c, 0x12dd, 0xb5fb, 0x131f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x0021, 0x0022, 0x027d, 0x029d, 0x10e7, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0022, 0x027d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x023a, 0x0022, 0x0001, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029d, 0x00a7, 0x0000, 0x0841, 0x00a7, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f,
-  0x027d, 0x0218, 0x0862, 0x7227, 0x0a58, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x0000, 0x0820, 0x0064, 0x025a, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x0a9b, 0x1b3f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x82ec, 0xcebd,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x025a, 0x0abd, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x724a, 0x0abe, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0a7b, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0022, 0x0000, 0x0022, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x0217, 0x0022, 0x0022, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x023a, 0x0064, 0x0022, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x025a, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x027d, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x023a, 0x0022, 0x0021, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029d, 0x00a7, 0x0000, 0x0820, 0x0064, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f,
-  0x027d, 0x0218, 0x0862, 0x71e5, 0x0885, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x0000, 0x0862, 0x0218, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0064, 0x027d, 0x029f, 0x0a9d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0021, 0x0a7b, 0x233d, 0x934d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0843, 0x82ec, 0xd6bd, 0xe71d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0a59, 0x12bd, 0x131f, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x828b, 0x0abd, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x828b, 0x0abd, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0022, 0x0022, 0x0a59, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0064, 0x0218, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0064, 0x025a, 0x027d, 0x0064, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x023a, 0x0064, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x027c, 0x0065, 0x025c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x02bf, 0x02bf, 0x025b, 0x0064, 0x0884, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025b, 0x0044, 0x0820, 0x7228, 0x08c7, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x025a, 0x0064, 0x0000, 0x0022, 0x0a59, 0x027d, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0000, 0x0000, 0x0000, 0x0064, 0x025b, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x0862, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a,
-  0x0022, 0x0000, 0x0000, 0x0022, 0x0a59, 0x72ad, 0x1afd, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x023a, 0x233e, 0xc6bf, 0x233d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0066, 0x12fd, 0xcebe, 0x934d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x02bf, 0x12ff, 0x12bd,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0021, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022,
-  0x0064, 0x029d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064,
-  0x023a, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x00a7, 0x0820, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f,
-  0x0a59, 0x7228, 0x0820, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0065, 0x0820, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0863, 0x8aca, 0x231d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0002, 0x1278, 0xd6dd, 0xd71f, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0044, 0x2b5d, 0xdf3f, 0x233d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0044, 0x12dd, 0xcebd, 0xa34b,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x02bf, 0x1afd, 0x8acb,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x029f, 0x0abd,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0021, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022,
-  0x0064, 0x029d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064,
-  0x023a, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x023a, 0x0044, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x00a7, 0x0820, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f,
-  0x0a59, 0x7228, 0x0820, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0065, 0x0820, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0840, 0x8aca, 0x231d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x1082, 0xd69b, 0xdf3f, 0x2b9f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x233d, 0xd71f, 0xe73d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0064, 0x027d, 0x1b1e, 0x932d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x02bf, 0x029f, 0x0a9d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0021, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022,
-  0x0064, 0x029d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064,
-  0x023a, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f,
-  0x027c, 0x027c, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0022, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0064, 0x0820, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f,
-  0x0a59, 0x7228, 0x0820, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0065, 0x0820, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x12dc, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x8aca, 0xd6bd, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x22b9, 0xc6bf, 0x2b9f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x233d, 0xc6bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0022, 0x0064, 0x027c, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x027d, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0021, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022,
-  0x0064, 0x029d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064,
-  0x023a, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x027d, 0x027c, 0x027c, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a,
-  0x0064, 0x0022, 0x0065, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0086,
-  0x0820, 0x0000, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b,
-  0x7228, 0x0820, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b,
-  0x0863, 0x0000, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0862, 0x12dc, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x8aca, 0xd6dd, 0x2b9f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x1adb, 0xdf1f, 0xef9f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x027d, 0x237f, 0xd73f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0064, 0x027d, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0021, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022,
-  0x0064, 0x029d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0064,
-  0x023a, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x027c, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a,
-  0x0044, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0086,
-  0x0820, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b,
-  0x7228, 0x0820, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b,
-  0x0863, 0x0000, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x027d, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0a7a, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x8aed, 0xe73d,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x023a, 0x231d, 0xd71f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf, 0x131f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0000, 0x0022, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d,
-  0x0022, 0x0021, 0x0217, 0x0065, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0064, 0x023a, 0x0065, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064,
-  0x0022, 0x025b, 0x027c, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0021,
-  0x0022, 0x027d, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0022, 0x027d, 0x027d, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d,
-  0x027c, 0x027c, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064,
-  0x0022, 0x0065, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0086, 0x0820,
-  0x0000, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x0a7b, 0x7228,
-  0x0820, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0863,
-  0x0000, 0x0000, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x0218,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0064, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0087,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x0022, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b,
-  0x0022, 0x0000, 0x0022, 0x0042, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0044,
-  0x0000, 0x0064, 0x0218, 0x0065, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x0064,
-  0x0022, 0x025b, 0x027d, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a,
-  0x0064, 0x027d, 0x027d, 0x0022, 0x0021, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x027c, 0x027c,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0065, 0x0022,
-  0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0862, 0x0820,
-  0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x0abd, 0x82ab, 0x92a8,
-  0x0820, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x233e, 0xd69b,
-  0x10a2, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x133f, 0xd6fd,
-  0x18a2, 0x0000, 0x0022, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x131f, 0xc65a,
-  0x10a2, 0x0000, 0x0022, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x08a4,
-  0x0000, 0x0000, 0x0000, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0842,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0086, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x0abd, 0x7228,
-  0x0820, 0x0000, 0x0000, 0x0064, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0863,
-  0x0000, 0x0000, 0x0064, 0x025b, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022,
-  0x0000, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022,
-  0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000,
-  0x0022, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0022, 0x027d, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c,
-  0x027c, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0086, 0x0820,
-  0x0862, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029e, 0x0a55, 0x92ca,
-  0x8226, 0x0884, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x198a, 0xc5f5,
-  0x20c2, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x025c, 0x1106, 0xc636,
-  0x10a2, 0x0000, 0x0021, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x3209, 0xce57,
-  0x10a2, 0x0000, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x1b5f, 0xae3c, 0xce58,
-  0x1082, 0x0000, 0x0000, 0x0021, 0x027c, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x1b1d, 0x9dfd, 0x231b, 0x10a4,
-  0x0000, 0x0820, 0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x0abd, 0x72cf, 0x1adb, 0x0064, 0x0000,
-  0x0820, 0x71e5, 0x0862, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x0abd, 0x027c, 0x0022, 0x0000,
-  0x0000, 0x0863, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x0000,
-  0x0021, 0x023a, 0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025a, 0x0022, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0022,
-  0x0218, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0064, 0x0217, 0x0022,
-  0x0044, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x023a, 0x0022,
-  0x0021, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c,
-  0x027c, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0022,
-  0x00a7, 0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0842,
-  0x0218, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x027d, 0x0a59, 0x92ea, 0x8a47,
-  0x0862, 0x0044, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x10c4, 0xd658, 0xa34b,
-  0x0820, 0x0000, 0x0064, 0x025b, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x025c, 0x0001, 0x1081, 0xdefa, 0xdeb9,
-  0x2145, 0x0000, 0x0000, 0x00a6, 0x025a, 0x027d, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x12fd, 0x0044, 0x1082, 0xdefa, 0xef7c,
-  0xc637, 0x10c4, 0x0000, 0x0022, 0x0064, 0x0064, 0x027c, 0x02bf,
-  0x029f, 0x131f, 0xdf3f, 0xcedf, 0x129b, 0x1149, 0xce78, 0xf77c,
-  0xce78, 0x1082, 0x0001, 0x025a, 0x025a, 0x00c8, 0x027c, 0x02bf,
-  0x029f, 0x231d, 0xcedf, 0x2b7f, 0x02bf, 0x025b, 0x2146, 0xbdd5,
-  0x2124, 0x0000, 0x0022, 0x027d, 0x02bf, 0x027d, 0x029f, 0x02bf,
-  0x0abd, 0x72cf, 0x1afd, 0x029f, 0x02bf, 0x025a, 0x0022, 0x0861,
-  0x0000, 0x0000, 0x0064, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x0abd, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0000, 0x0001,
-  0x0000, 0x0022, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x027d, 0x0084, 0x0084, 0x0218,
-  0x0022, 0x0021, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0064, 0x08e8, 0x025b,
-  0x0042, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x00c7, 0x08c7, 0x027b, 0x027c,
-  0x0064, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0086, 0x025a, 0x02bf, 0x027c,
-  0x0065, 0x027c, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x027c,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c,
-  0x027c, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0022,
-  0x00a7, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0842,
-  0x0218, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x027d, 0x0a59, 0x92ea, 0x8a46,
-  0x0885, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x10c4, 0xd658, 0xa34b,
-  0x0800, 0x0044, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x0abd, 0x025c, 0x0001, 0x1081, 0xdefa, 0xdeb9,
-  0x2145, 0x0000, 0x0044, 0x023a, 0x027c, 0x0a9d, 0x02bf, 0x02bf,
-  0x029f, 0x0abd, 0x8b2f, 0x22fb, 0x0044, 0x1082, 0xdefa, 0xef7c,
-  0xc637, 0x10c4, 0x0000, 0x0064, 0x08a5, 0x828b, 0x0abd, 0x02bf,
-  0x029f, 0x12ff, 0xd6bd, 0xc6df, 0x129b, 0x1107, 0xce58, 0xf77c,
-  0xce78, 0x1082, 0x0044, 0x023a, 0x0a7b, 0x82ad, 0x0abd, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x133f, 0x029d, 0x0022, 0x2103, 0xbdd6,
-  0x2104, 0x0021, 0x0218, 0x02bf, 0x02bf, 0x0abd, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027c, 0x023a, 0x0022, 0x0000, 0x0861,
-  0x0000, 0x0000, 0x0064, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x00a7, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0022, 0x0086, 0x027d, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027c, 0x0218, 0x0022, 0x0022, 0x0000,
-  0x0064, 0x025a, 0x027d, 0x027c, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0064, 0x0022, 0x0217, 0x0065,
-  0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0064, 0x0064, 0x023a, 0x0065,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0063, 0x025b, 0x027c, 0x0065,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0021, 0x0022, 0x027d, 0x027c, 0x0065,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c, 0x027c,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0022, 0x00a7,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0087, 0x0820, 0x0842, 0x0218,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x0a59, 0x92eb, 0x8a67, 0x08e7,
-  0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x023a, 0x10e7, 0xcdf7, 0xab6b, 0x2125,
-  0x0064, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12fd, 0x10c6, 0x0000, 0x31a6, 0xe71b, 0xdedb,
-  0x1082, 0x0043, 0x023a, 0x027c, 0x0a9d, 0x0abd, 0x02bf, 0x02bf,
-  0x029f, 0x131f, 0xbe5d, 0x82aa, 0x18a2, 0xd6ba, 0xffff, 0xef7d,
-  0x10a2, 0x0000, 0x0064, 0x08a5, 0x828b, 0x82cd, 0x0abd, 0x02bf,
-  0x029f, 0x02bf, 0x131f, 0x0a7b, 0x10c4, 0xdeba, 0xffff, 0xd6ba,
-  0x1082, 0x0001, 0x023a, 0x027c, 0x0a9d, 0x0abd, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0022, 0x2124, 0xc638, 0x2124,
-  0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027c, 0x023a, 0x0022, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x00a7, 0x0064, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0064, 0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x0064, 0x0000, 0x0000, 0x0022,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x0218, 0x0022, 0x0000, 0x0022,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0065, 0x0000, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0022, 0x00a7, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0842, 0x01f8, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x0a59, 0x92ea, 0x8a67, 0x1927, 0x025b,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025b, 0x0065, 0x10c4, 0xde99, 0xbc0e, 0xd658, 0x1106,
-  0x023a, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029d, 0x116a, 0x0063, 0x1082, 0xe73c, 0xff9e, 0xef5d, 0x10a2,
-  0x0023, 0x023a, 0x027c, 0x0a9d, 0x0abd, 0x02bf, 0x02bf, 0x02bf,
-  0x131e, 0xbe3b, 0x129a, 0x10c4, 0xe73c, 0xffff, 0xef5d, 0x10a2,
-  0x0022, 0x0064, 0x0885, 0x828b, 0x82cd, 0x0abd, 0x029f, 0x02bf,
-  0x12bd, 0x8330, 0x0a7b, 0x10c5, 0xef5c, 0xffff, 0xd6ba, 0x10c4,
-  0x01f8, 0x027c, 0x027c, 0x0a9d, 0x0abd, 0x02bf, 0x029f, 0x02bf,
-  0x02bf, 0x0a9d, 0x0239, 0x10a4, 0xd6ba, 0xdedb, 0x2104, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0087, 0x0042, 0x1082, 0x1082, 0x0000, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x025b, 0x0043, 0x0000, 0x0022, 0x0021,
-  0x0218, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0022, 0x0064, 0x0218, 0x0064,
-  0x0064, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0022, 0x025a, 0x02bf, 0x025a,
-  0x0021, 0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x027d, 0x02bf, 0x027d,
-  0x0064, 0x0021, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x027c, 0x02bf, 0x02bf,
-  0x025a, 0x0022, 0x0044, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x027c, 0x02bf, 0x02bf,
-  0x027d, 0x0022, 0x0021, 0x027c, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0065, 0x0043, 0x00a7, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x010a, 0x1083, 0x10c5, 0x0218, 0x02bf,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0a59, 0x92eb, 0x8a67, 0x0884, 0x023a,
-  0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x1107, 0xde99, 0xab6b, 0x18a2, 0x0022,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x1081, 0xe73c, 0xf79e, 0xd6ba, 0x1081,
-  0x0001, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12dc, 0x0001, 0x1081, 0xe75d, 0xffff, 0xef7d, 0x10a2,
-  0x0022, 0x10e7, 0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x133f, 0xc69d, 0x2124, 0x1082, 0xe6fb, 0xffff, 0xd6ba, 0x10c4,
-  0x0a38, 0x728d, 0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xd71f, 0xd679, 0x18a2, 0x930a, 0xd679, 0x2124, 0x0022,
-  0x027c, 0x0abe, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x1b1d, 0x8aca, 0x1040, 0x0820, 0x1081, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0842, 0x0063, 0x0042, 0x0022, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0087, 0x0218, 0x00c8, 0x0218, 0x0022, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x027c, 0x00a7, 0x023a, 0x0022, 0x0021,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x00a7, 0x023a, 0x0042, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x00a7, 0x0239, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x00c8, 0x0239, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0065, 0x0043, 0x00a7, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x010a, 0x1083, 0x10c5, 0x0218, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0a59, 0x92eb, 0x8a67, 0x0884, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x1107, 0xde99, 0xab6b, 0x18a2, 0x0064,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0023, 0x1081, 0xe73c, 0xf79e, 0xd6ba, 0x1081,
-  0x0043, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x10a4, 0x10a2, 0xe75d, 0xffff, 0xef7d, 0x20c2,
-  0x0000, 0x00e9, 0x029d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xc65a, 0x2924, 0xdedb, 0xffff, 0xe6fb, 0x82ca,
-  0x0885, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xc65b, 0x2903, 0x9b0a, 0xd659, 0x2146, 0x0a38,
-  0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x18e5, 0x7227, 0x1861, 0x1061, 0x0000, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0087, 0x0a58, 0x0064, 0x0001, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x027c, 0x00c8, 0x0217, 0x0064, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x00a7, 0x023a, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x00a7, 0x0239, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x00a7, 0x0239, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x00c8, 0x0239, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0065, 0x0043, 0x00a7, 0x029d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x010a, 0x1083, 0x10c5, 0x0218, 0x027d,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0a59, 0x92eb, 0x8a67, 0x0842, 0x0044,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x021a, 0x1107, 0xde99, 0xab6b, 0x18a2, 0x0000,
-  0x0043, 0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029d, 0x10c6, 0x10a2, 0xe73c, 0xf79e, 0xd6ba, 0x10a2,
-  0x0022, 0x0064, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xbe3a, 0x2944, 0xe73c, 0xffff, 0xef7d, 0x10c4,
-  0x01d5, 0x00e9, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x133f, 0xd6dd, 0x2944, 0xd69a, 0xffff, 0xdeba, 0x20c3,
-  0x0086, 0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x12fd, 0xce7a, 0x10a2, 0x2104, 0xc618, 0x3165, 0x7208,
-  0x0a7b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x08e8, 0x82aa, 0x0841, 0x0000, 0x1061, 0x0000, 0x0862,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x027d, 0x0a5a, 0x0042, 0x0021, 0x0022, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x0022, 0x0064, 0x0218, 0x0064, 0x0218,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0064, 0x025a, 0x027d, 0x0022, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x0022, 0x027d, 0x027d, 0x0022, 0x0043,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0021, 0x0022, 0x027d, 0x027c, 0x0064, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x0022, 0x0022, 0x027d, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x0065, 0x0043, 0x00a7, 0x029d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029e, 0x010a, 0x0062, 0x10c5, 0x01f8, 0x027c,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x0218, 0x18e5, 0x8246, 0x20e5, 0x0064,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025b, 0x0024, 0x10c4, 0xce59, 0xbc0d, 0xd638, 0x10c4,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x0064, 0x1081, 0x10a2, 0xef3c, 0xff9e, 0xef3c, 0x10c5,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x1107, 0xc618, 0x2945, 0xe73c, 0xffff, 0xef5c, 0x10c4,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x12fd, 0xc65a, 0x3165, 0xd69a, 0xef5d, 0xd6ba, 0x2105,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0087, 0x0218, 0x18e5, 0x7205, 0x18c2, 0x10a2, 0x18c2, 0x7206,
-  0x0884, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x023a, 0x0087, 0x0022, 0x0820, 0x0000, 0x0000, 0x0000, 0x0820,
-  0x0022, 0x0086, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x025b, 0x0022, 0x0021, 0x0022, 0x0000, 0x0021,
-  0x023a, 0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x0022, 0x0064, 0x0218, 0x0022, 0x0044,
-  0x027d, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x0021, 0x025b, 0x027d, 0x0064, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0022, 0x0044, 0x029d, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x027c, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c, 0x027c, 0x029f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0022, 0x00a7, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x0087, 0x0000, 0x0842, 0x0218, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x0218, 0x0884, 0x7a05, 0x0884, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025b, 0x0064, 0x0042, 0x0841, 0x92c8, 0x20c2, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x08c7, 0x0043, 0x0062, 0x2986, 0xe71b, 0xdeba, 0x10a4,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0abd, 0x72ad, 0x1a98, 0x10c4, 0xd6da, 0xffff, 0xef7d, 0x1107,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x231e, 0xb5fa, 0x39c7, 0xe6fb, 0xef5d, 0xd6dc, 0x22fb,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0087, 0x01f8, 0x2146, 0xc5d6, 0x9b2a, 0x18a2, 0x18a2, 0x726a,
-  0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x023a, 0x0087, 0x0022, 0x10c4, 0x0820, 0x0000, 0x0000, 0x0862,
-  0x00a6, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x027d, 0x023a, 0x0022, 0x0000, 0x0022, 0x023a,
-  0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x027d, 0x0042, 0x0022, 0x0042, 0x027d,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x01f7, 0x0064, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x023a, 0x0065, 0x0044,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x027c, 0x025a, 0x0044,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027d, 0x0065,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x08e8, 0x00e8, 0x025b, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00c9, 0x0883, 0x10a3, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x0218, 0x0884, 0x7a06, 0x0842, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0065, 0x0084, 0x2105, 0x92c9, 0x2125, 0x0064,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x023a, 0x0001, 0x1081, 0xd6ba, 0xf77d, 0xd6ba, 0x10c4,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x00c8, 0x0820, 0x1082, 0xef5d, 0xffff, 0xef5d, 0x10c4,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x0a9b, 0x8aca, 0x3165, 0xd6ba, 0xef5d, 0xd6ba, 0x2105,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x12ff, 0xd69b, 0xce38, 0x2104, 0x10a2, 0x18c2, 0x7228,
-  0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029d, 0x1107, 0x10c5, 0x0000, 0x0000, 0x0000, 0x0862,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x0064, 0x0000, 0x0022, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x0022, 0x0022, 0x0217, 0x0065,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x023a, 0x0065,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x023a, 0x0065,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0022, 0x023a, 0x0042,
-  0x0044, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x023a, 0x0022,
-  0x0021, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0820, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x0a59, 0x92ea, 0x8a46, 0x0842, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0086, 0x10c4, 0xde9a, 0xab6b, 0x18a2, 0x0044,
-  0x025b, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0863, 0x1081, 0xe73c, 0xf79e, 0xd6ba, 0x10c4,
-  0x00a7, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x0abd, 0x82aa, 0x20c2, 0xe75d, 0xffff, 0xef9f, 0x1278,
-  0x00a8, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xbdf9, 0x39c6, 0xd69a, 0xef5d, 0xd6ba, 0x2127,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x2167, 0xb596, 0x2124, 0x10a2, 0x18c2, 0x726a,
-  0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0022, 0x1081, 0x0000, 0x0000, 0x0001, 0x0a59,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0065, 0x0022, 0x0000, 0x0022, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x0064, 0x0218, 0x0064, 0x0022,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x027d, 0x025a, 0x0044,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0064, 0x025a, 0x027d, 0x0064,
-  0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0022, 0x0044, 0x027d, 0x025a,
-  0x0044, 0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0022, 0x0021, 0x027d, 0x027d,
-  0x0065, 0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0820, 0x0064, 0x027d,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x0a59, 0x92ea, 0x8a46, 0x0862, 0x023a,
-  0x027d, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0086, 0x10c4, 0xde9a, 0xab6b, 0x0820, 0x0021,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0863, 0x1081, 0xef5d, 0xe71c, 0x2124, 0x0022,
-  0x0022, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x0abd, 0x82aa, 0x20c2, 0xe75d, 0xffff, 0xdf1d, 0x1278,
-  0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xbe3b, 0x39c7, 0xd69a, 0xef5d, 0xdedb, 0x2105,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x237f, 0xb5d8, 0x2124, 0x10a2, 0x18c2, 0x724a,
-  0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10c4, 0x0000, 0x0000, 0x0021, 0x0a7b,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0044, 0x0000, 0x0022, 0x0042, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x01f7, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x023a, 0x0042, 0x0043,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0042, 0x0043,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0087, 0x0820, 0x0862, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0a59, 0x92ea, 0x8a46, 0x0884, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x1107, 0xde99, 0xab6b, 0x0820, 0x0044,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x021a, 0x10c4, 0xef5c, 0xe71b, 0x1082, 0x0000,
-  0x0064, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029d, 0x10e6, 0x1082, 0xef5d, 0xef7d, 0x2945, 0x0000,
-  0x0021, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x131f, 0xb5fa, 0x39c7, 0xd6ba, 0xffdf, 0xce38, 0x18c2,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x237f, 0xb5d8, 0x39c6, 0xc618, 0x3165, 0x7208,
-  0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x10c4, 0x0000, 0x0861, 0x0000, 0x0862,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0000, 0x0001, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0021, 0x0217, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0064, 0x023a, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x025a, 0x027d, 0x0022, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027d, 0x027d, 0x0022, 0x0021,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027d, 0x0022, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0087, 0x0820, 0x0820, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x0a59, 0x92ea, 0x8a46, 0x0842, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x1107, 0xde99, 0xab6b, 0x0820, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025b, 0x0023, 0x1081, 0xef5d, 0xe71b, 0x1081, 0x0001,
-  0x025a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x0064, 0x1081, 0x1082, 0xef5d, 0xef7d, 0x2945, 0x0000,
-  0x0044, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x1107, 0xc618, 0x39e7, 0xd6ba, 0xffdf, 0xce38, 0x18c2,
-  0x0044, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x12dd, 0xd71f, 0xc638, 0x31a6, 0xc618, 0x3165, 0x7208,
-  0x0a7b, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12dd, 0x10c4, 0x0000, 0x0861, 0x0000, 0x0862,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x025c, 0x0022, 0x0000, 0x0001, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0217, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025a, 0x0021, 0x0064, 0x023a, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0044, 0x025b, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x027c, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029d, 0x00a7, 0x0820, 0x0820, 0x00a6, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x0a59, 0x92ea, 0x8a88, 0x0a38, 0x029f,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x023a, 0x0044, 0x10c4, 0xde9a, 0xab6b, 0x0885, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x0885, 0x0021, 0x1082, 0xef5d, 0xe71b, 0x1081, 0x0044,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12bd, 0x82ed, 0x0a38, 0x08a4, 0xef5d, 0xef7d, 0x2944, 0x0001,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xbe7e, 0x2b5d, 0x2167, 0xd6ba, 0xffdf, 0xce38, 0x18e5,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x235f, 0xc6bf, 0xc638, 0x31a6, 0xc618, 0x3165, 0x7228,
-  0x0abd, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12fd, 0x10c4, 0x0000, 0x0861, 0x0000, 0x0862,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x025c, 0x0022, 0x0000, 0x0001, 0x0000, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0021, 0x0217, 0x0065, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0064, 0x023a, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x025a, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027d, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027c, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0086, 0x023a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x0820, 0x0086, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0862, 0x82a9, 0x0a38, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x023a, 0x0044, 0x10a2, 0xd659, 0x29a9, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0863, 0x0044, 0x0000, 0x1082, 0xef5d, 0xdeda, 0x10e6, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x828b, 0x1a98, 0x0022, 0x2104, 0xef5d, 0xf79d, 0x1082, 0x0023,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233e, 0xc67d, 0x39c7, 0xdedb, 0xffff, 0xdeba, 0x20c2, 0x0043,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0xd6ff, 0xe6fb, 0xef5d, 0xd6ba, 0x3144, 0x7208, 0x0a7b,
-  0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x1b1e, 0x8b0d, 0x20c3, 0x1082, 0x0000, 0x0862, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x0a7b, 0x0022, 0x0000, 0x0022, 0x0022, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x0021, 0x0217, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0064, 0x023a, 0x0064, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0064, 0x025a, 0x027d, 0x0064, 0x0044,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x023a, 0x0044,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x025c, 0x02bf, 0x027c, 0x0065,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x027d, 0x029f, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x0884, 0x0064, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x08a5, 0x7a05, 0x0842, 0x023a, 0x027d, 0x029f,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x023a, 0x0862, 0x92a8, 0x20c3, 0x0042, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0863, 0x0044, 0x1082, 0xe6fb, 0xdedb, 0x1081, 0x0001, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x828b, 0x1a98, 0x10c5, 0xef5d, 0xef7d, 0x10a2, 0x0002, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x233e, 0xae1c, 0x3165, 0xef5d, 0xef7d, 0x10a2, 0x0001, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x1afd, 0x8aca, 0xe6fb, 0xd6ba, 0x1082, 0x0044, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0863, 0x1082, 0x1082, 0x0022, 0x0218, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0086, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0000, 0x0022, 0x0022, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0064, 0x01f7, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0065, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0065, 0x0239, 0x0065, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x027d, 0x027d, 0x029f, 0x02bf, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x023a, 0x0044, 0x0044, 0x027d, 0x02bf, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x00a7, 0x0000, 0x0842, 0x023a, 0x027d, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x0218, 0x20e5, 0x8288, 0x0862, 0x0044, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x10e7, 0xdeba, 0xe6fb, 0x1081, 0x0001, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x025c, 0x18e5, 0xef5d, 0xef7d, 0x1082, 0x0000, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0a9d, 0x9b6d, 0xffbe, 0xef7d, 0x2945, 0x0000, 0x0021, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12ff, 0xcebe, 0xef5c, 0xe73c, 0xc638, 0x1082, 0x0044, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x12bb, 0x10c4, 0x10a2, 0x10a2, 0x0042, 0x025b, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x0087, 0x0000, 0x0000, 0x0001, 0x0022, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x023a, 0x0022, 0x0022, 0x0218, 0x0022, 0x0044, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0022, 0x0022, 0x025a, 0x0064, 0x0021, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0022, 0x0044, 0x027d, 0x025a, 0x0064, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0064, 0x023a, 0x02bf, 0x027c, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027c, 0x02bf, 0x027c, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027d, 0x027d, 0x029f, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0044, 0x0044, 0x027d, 0x02bf, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x029d, 0x00a7, 0x0820, 0x0021, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0a59, 0x82aa, 0x0840, 0x0044, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x023a, 0x0044, 0x10e4, 0xce59, 0x10a2, 0x0000, 0x0086, 0x025b,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x10c4, 0x0000, 0x10a2, 0xd6ba, 0x2944, 0x0022, 0x0218, 0x0086,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xc63a, 0x10a4, 0x1082, 0xef5d, 0xdefb, 0x10c4, 0x01f7, 0x0087,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x023a, 0x10a4, 0xd6ba, 0xdedb, 0x10a2, 0x0066, 0x025b,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x027d, 0x0065, 0x1082, 0x1082, 0x0022, 0x0218, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0064, 0x027d,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0022, 0x0000, 0x0022, 0x0022, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x0217, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x023a, 0x0065, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x0239, 0x0065, 0x027c,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0022, 0x0022, 0x0239, 0x0065, 0x025c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029f, 0x027d, 0x027d, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0044, 0x0044, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x0842, 0x0862, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x1907, 0x8a46, 0x8268, 0x0a7b, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025c, 0x10e7, 0xd658, 0xab6b, 0x1861, 0x0043, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025c, 0x10c4, 0xef5c, 0xe71b, 0x1082, 0x0022, 0x0064,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x025c, 0x2105, 0xef7d, 0xef7d, 0x10c4, 0x01b5, 0x0086,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027c, 0x1afc, 0x8aca, 0xe6fb, 0xd6ba, 0x10a2, 0x0066, 0x025b,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x1127, 0xc65a, 0x20e3, 0x1082, 0x1082, 0x0042, 0x023a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x1afc, 0xce7a, 0x10a2, 0x0000, 0x0000, 0x0022, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x12de, 0x82ed, 0x0840, 0x0000, 0x0022, 0x0042, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x0a7b, 0x0022, 0x0064, 0x0218, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0064, 0x025a, 0x027d, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027d, 0x027c, 0x0065, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027c, 0x027c, 0x0065, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x027c, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x0044, 0x0884, 0x025a, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0064, 0x1840, 0x8226, 0x08a5, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x0842, 0x92a8, 0x9267, 0x0862, 0x027c,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x2124, 0xd679, 0x18c2, 0x0001, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x021a, 0x10a4, 0xdeda, 0xef7d, 0x2124, 0x0000, 0x0044,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x027d, 0x10e7, 0x10a2, 0xef5d, 0xffff, 0xdedb, 0x1082, 0x0043,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x2b9f, 0xadb7, 0x2103, 0xd69a, 0xef5d, 0xd6ba, 0x10e6, 0x023a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0xc69d, 0x2167, 0x0042, 0x1082, 0x10a2, 0x10c4, 0x025b, 0x02bf,
-  0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x131f, 0x027d, 0x025a, 0x0022, 0x0000, 0x0022, 0x027d, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x025b, 0x0022, 0x0022, 0x0042, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0064, 0x0064, 0x0218, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0064, 0x025a, 0x027d, 0x0065, 0x027c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027d, 0x027c, 0x0065, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x027c, 0x0065, 0x027c, 0x027c, 0x0065, 0x025c, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x027c, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x023a, 0x0064, 0x0044, 0x025a,
-  0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0abd, 0x029f, 0x02bf, 0x029d, 0x0087, 0x0000, 0x0820, 0x0064,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x82cd, 0x231d, 0x029f, 0x027d, 0x0218, 0x18e5, 0x8205, 0x0862,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x231d, 0xb65f, 0x2b5d, 0x0044, 0x10c4, 0xd679, 0xab4b, 0x0863,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x237f, 0xb63c, 0x1081, 0x1081, 0xef5d, 0xe6fb, 0x10c4,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x12dc, 0x0022, 0x1082, 0xef7d, 0xef7d, 0x10a2,
-  0x0043, 0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x0001, 0x1061, 0xdedb, 0xef7d, 0x10a2,
-  0x0043, 0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x0065, 0x0042, 0x2124, 0xc618, 0x10e5,
-  0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x025b, 0x0022, 0x1082, 0x0042,
-  0x027d, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x0022, 0x0000, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027d, 0x0064, 0x0022, 0x0022, 0x0022,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0064, 0x023a, 0x023a, 0x0064,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027d, 0x027d, 0x0065,
-  0x027c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027c, 0x0065,
-  0x027c, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x027c, 0x0065, 0x027c, 0x027c, 0x0065,
-  0x025c, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf
-};
-
-const Animation jacksonAnimation = {
-  .name = "Jackson",
-  .frameCount = 58,
-  .width = 16,
-  .height = 16,
-  .frameDurations = jacksonDurations,
-  .animationFrames = jacksonFrames
-};
-#endif // ANIMATION_JACKSON_H
@@ -1,310 +0,0 @@
-// jumping_duck.h - Auto-generated from jumping_duck.json
-#ifndef ANIMATION_JUMPING_DUCK_H
-#define ANIMATION_JUMPING_DUCK_H
-
-#include "animation_types.h"
-
-// Frame Durations for jumping_duck (in 100ms units)
-static const uint8_t PROGMEM jumping_duckDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for jumping_duck
-static const uint16_t PROGMEM jumping_duckFrames[] = {
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xe1ee, 0xe1ee,
-  0xe1ee, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xe1ee, 0xe1ee,
-  0xe1ee, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xffff, 0xffff, 0xf73d,
-  0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xfcad, 0xeaca, 0xffff, 0xf73d,
-  0x2804, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xfb74, 0xffff, 0xf73d,
-  0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xfb74, 0xffff, 0xf73d,
-  0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xffff, 0xffff, 0xf73d,
-  0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0xffff, 0xf73d, 0xffff, 0xffff, 0xf73d,
-  0xf73d, 0xffff, 0xf73d, 0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0xf73d, 0xf73d, 0xffff, 0xffff, 0xf73d,
-  0xf73d, 0xffff, 0xf73d, 0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0xffff, 0xf73d, 0xffff, 0xffff, 0xf73d,
-  0xf73d, 0xffff, 0xf73d, 0xf73d, 0xf73d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xeaca, 0xeaca,
-  0x6e7d, 0xeaca, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xeaca, 0xeaca, 0xeaca,
-  0xfcad, 0xeaca, 0xeaca, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669e, 0x66be,
-  0x66be, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x8dbb, 0xb477, 0xabf5,
-  0xa436, 0x6e5c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6ebe, 0xbd39, 0xfad2, 0xea0e,
-  0xe290, 0x7e3c, 0x6e9d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf5f, 0xffff, 0xffbf, 0xff1d,
-  0xfefd, 0xf71d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e5c, 0xd5f6, 0xf554, 0xfedb, 0xf75e,
-  0x9bf2, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xecaf, 0xea89, 0xf555, 0xf77e,
-  0x9bf2, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb6bc, 0xfbb4, 0xf558, 0xffdf,
-  0xff5e, 0xff3d, 0xaedd, 0x667d, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xbf5e, 0xff5e, 0xff7e, 0xff9e,
-  0xf73d, 0xff3d, 0xb6dd, 0x767d, 0x769d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0xcf7e, 0xffbf, 0xffff, 0xffff, 0xff9e,
-  0xff7e, 0xffbf, 0xf73d, 0xef1d, 0xe71d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x667d, 0x769d, 0xf7df, 0xffbf, 0xffff, 0xffff, 0xff9e,
-  0xf73e, 0xffff, 0xff3e, 0xff3d, 0xef1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x96de, 0xdf7e, 0xffff, 0xffff, 0xffbf,
-  0xf73e, 0xf77e, 0xf6fd, 0xf6fc, 0xcedd, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x86fe, 0xb73e, 0xf5b6, 0xed76,
-  0xd5f8, 0xf4f3, 0xcdd9, 0xaedd, 0x8e9d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x8dd9, 0xbcd3, 0xf36b, 0xeb4b,
-  0xdc2f, 0xfac9, 0xc3af, 0x665c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x665d, 0x8db8, 0xbcd3, 0xb4b3, 0xb514,
-  0xb4d3, 0xac73, 0xac94, 0x6e1c, 0x665d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669d,
-  0x6e9d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e5d, 0x763c, 0x761c,
-  0x761c, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0xad19, 0xeab1, 0xd9ee,
-  0xd270, 0x6e1c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x8efe, 0xde9c, 0xfd38, 0xf496,
-  0xecb6, 0xb6bd, 0x8ebd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xbf1d, 0xffbe, 0xffff, 0xffbf,
-  0xe6dc, 0xff3d, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xeccf, 0xeb2b, 0xfdb6, 0xef3d,
-  0x6a2b, 0xeebb, 0xb6fe, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e5c, 0xd5b5, 0xf2ce, 0xf516, 0xffbf,
-  0xe69b, 0xff1d, 0xaedd, 0x667d, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x6e9d, 0xb73e, 0xfd9a, 0xf65b, 0xffbf,
-  0xf73d, 0xff5e, 0xb6dd, 0x767d, 0x769d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x667d, 0x96fe, 0xf7bf, 0xf79f, 0xffff, 0xffff, 0xff9e,
-  0xf75e, 0xffff, 0xf7bf, 0xef1d, 0xef1d, 0xcefd, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x667d, 0xb73e, 0xf79e, 0xf79e, 0xffff, 0xffff, 0xff9e,
-  0xf71d, 0xeefc, 0xffbf, 0xf73d, 0xf71d, 0xef1d, 0x769d, 0x667d,
-  0x6e7d, 0x6e7d, 0x6e9d, 0x767d, 0xbf3e, 0xffff, 0xffff, 0xff9f,
-  0xf71d, 0xeedc, 0xeefc, 0xeedc, 0xeedc, 0x969d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xa73e, 0xefff, 0xff9e, 0xf73d,
-  0xeefd, 0xf6dc, 0xeefd, 0xef3e, 0xc6fd, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x95f9, 0xc4f3, 0xeb6c, 0xebcd,
-  0xdc0f, 0xf2eb, 0xcbf0, 0x765c, 0x6e7d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8db8, 0xbcd3, 0xb4b3, 0xb514,
-  0xb4d3, 0xac73, 0xac93, 0x6e1c, 0x665d, 0x665d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669e, 0x66be,
-  0x66be, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x8dbb, 0xac77, 0xa415,
-  0xa456, 0x6e5c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6ebe, 0xbd39, 0xfad2, 0xea0f,
-  0xe290, 0x7e3c, 0x6e9d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf5f, 0xffff, 0xffbf, 0xff3d,
-  0xff1d, 0xf71d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e5c, 0xd5f6, 0xf554, 0xfeda, 0xf75e,
-  0x9bf1, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xecaf, 0xea89, 0xf555, 0xf77e,
-  0x9bd1, 0xf6dc, 0xaedd, 0x667d, 0x667d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x769d, 0xbebc, 0xfbd4, 0xf558, 0xffdf,
-  0xff5e, 0xff3d, 0xb6fd, 0x767d, 0x769d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0xd79f, 0xffdf, 0xff9f, 0xff5e, 0xff7e, 0xff9e,
-  0xf73d, 0xffbf, 0xffff, 0xef5e, 0xef1d, 0xef1d, 0x96bd, 0x667d,
-  0x6e7d, 0x769d, 0xb73e, 0xaedd, 0xd77e, 0xffff, 0xffff, 0xff9e,
-  0xff7e, 0xf77e, 0xf73d, 0xeefc, 0xeebc, 0xf6dc, 0xaebd, 0x667d,
-  0x6e7d, 0x6e7d, 0x667d, 0x5e5d, 0xaf3e, 0xffff, 0xffff, 0xff9e,
-  0xf71d, 0xeedc, 0xeedc, 0xeebc, 0xeedc, 0xbe9c, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb75f, 0xffff, 0xffff, 0xffbf,
-  0xf75e, 0xf75e, 0xf75e, 0xff3e, 0xef1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb639, 0xfdb5, 0xfd75, 0xfd94,
-  0xfd34, 0xf4d3, 0xecf4, 0xb69c, 0x8e9d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8db8, 0xb4d3, 0xac93, 0xb4d3,
-  0xb4d3, 0xac52, 0xa473, 0x661c, 0x5e5d, 0x665c, 0x665d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669d,
-  0x669d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e5d, 0x761c, 0x761c,
-  0x761c, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0xad19, 0xea91, 0xd9ee,
-  0xd270, 0x6e1c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x8efe, 0xde9c, 0xfd58, 0xf4b6,
-  0xecb6, 0xb6bd, 0x8ebd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xbf1d, 0xffbe, 0xffff, 0xffbf,
-  0xe6dc, 0xff3d, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x6e5c, 0xeccf, 0xeb2b, 0xfdb6, 0xef3d,
-  0x6a2b, 0xeebb, 0xaedd, 0x5e5d, 0x667d, 0x667d, 0x667d, 0x6e7d,
-  0x6e7d, 0x769d, 0xb73e, 0xb6dd, 0xf5d6, 0xf2ce, 0xf516, 0xffbf,
-  0xe69b, 0xf71d, 0xd73e, 0xb73e, 0xaedd, 0xaedd, 0xaedd, 0x767d,
-  0x6e7d, 0x6e7d, 0xd79f, 0xffdf, 0xff9f, 0xfd9a, 0xf65b, 0xffbf,
-  0xf73d, 0xff7e, 0xffff, 0xff7e, 0xff3d, 0xff3d, 0xef1d, 0x769d,
-  0x6e7d, 0x667d, 0x6e9d, 0xcf7e, 0xffbf, 0xffff, 0xffff, 0xff9e,
-  0xff5e, 0xffff, 0xff7e, 0xf73d, 0xff3d, 0xef1d, 0x96bd, 0x667d,
-  0x6e7d, 0x6e7d, 0x667d, 0x6e7d, 0xd75e, 0xffff, 0xffff, 0xff9e,
-  0xf73d, 0xf71d, 0xeedc, 0xeedc, 0xeedc, 0x96bd, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf3e, 0xffff, 0xffff, 0xff9f,
-  0xf71d, 0xf71d, 0xf71d, 0xf71d, 0xe6fd, 0x6e7d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x665d, 0xb6fd, 0xff9d, 0xff7d, 0xff3c,
-  0xfebb, 0xfebb, 0xf6bb, 0xef1d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8df9, 0xb556, 0xb535, 0xb576,
-  0xb555, 0xacf5, 0xad16, 0x763c, 0x6e5d, 0x665c, 0x665d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669e, 0x66be,
-  0x66be, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x8dbb, 0xb477, 0xa415,
-  0xa456, 0x6e5c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6ebe, 0xbd39, 0xfad1, 0xea0e,
-  0xe270, 0x7e3c, 0x6e9d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf5f, 0xffff, 0xff9f, 0xff1d,
-  0xfefd, 0xf71d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x6e5c, 0xd5f6, 0xfd75, 0xfedb, 0xf77e,
-  0x9c12, 0xf6dc, 0xb6dd, 0x667d, 0x667d, 0x667d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x769d, 0x867c, 0xf4cf, 0xea89, 0xf555, 0xf77e,
-  0x9bf1, 0xf6dc, 0xaedd, 0x6e9d, 0x769d, 0x769d, 0x769d, 0x767d,
-  0x667d, 0x769d, 0xefbf, 0xf77e, 0xff1c, 0xfbb4, 0xf558, 0xffdf,
-  0xff7e, 0xff3e, 0xdf5e, 0xefdf, 0xef5e, 0xef1d, 0xf73d, 0xaedd,
-  0x6e7d, 0x667d, 0x9efe, 0xefbf, 0xf79f, 0xff3e, 0xff7e, 0xff9e,
-  0xf77e, 0xffbf, 0xffdf, 0xff5e, 0xf71d, 0xef1d, 0xcefd, 0x769d,
-  0x6e7d, 0x6e7d, 0x667d, 0x6e7d, 0xbf3e, 0xffff, 0xffff, 0xff9e,
-  0xf6fd, 0xeefc, 0xeefc, 0xeedc, 0xe6dc, 0x7e9d, 0x6e7d, 0x667d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x665d, 0xb75f, 0xffff, 0xffff, 0xffbf,
-  0xf75e, 0xf75e, 0xf75e, 0xff3d, 0xd6fd, 0x6e7d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb639, 0xfdb5, 0xfd75, 0xfd94,
-  0xfd34, 0xf4d3, 0xecf4, 0xb69c, 0x8e9d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8db8, 0xb4d3, 0xac93, 0xb4d3,
-  0xb4d3, 0xac52, 0xa473, 0x661c, 0x665d, 0x665c, 0x665d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x669d, 0x669d,
-  0x669d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x763c, 0x761c, 0x75fc,
-  0x75fc, 0x6e3c, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x7e5d, 0xec57, 0xeb73, 0xdab1,
-  0xe290, 0xac97, 0x6ebe, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf3e, 0xffdf, 0xffbf, 0xff1d,
-  0xfefd, 0xf6fd, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xbe59, 0xfdb5, 0xfeda, 0xf75e,
-  0x9bf1, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xec8e, 0xea89, 0xf555, 0xf77e,
-  0x9bd1, 0xf6dc, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x767c, 0xf5d6, 0xfaf0, 0xf4f7, 0xffdf,
-  0xff7e, 0xff3d, 0xb6dd, 0x767d, 0x6e7d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x769d, 0x9efe, 0xff9f, 0xfd99, 0xf65b, 0xffbf,
-  0xff7e, 0xffdf, 0xf73e, 0xef3d, 0xcefd, 0x7e9d, 0x6e7d, 0x6e7d,
-  0x667d, 0x769d, 0xdfbf, 0xef9f, 0xf79e, 0xffff, 0xffff, 0xff9e,
-  0xf71d, 0xf79e, 0xffdf, 0xff7e, 0xf71d, 0xe71d, 0xa6bd, 0x667d,
-  0x6e7d, 0x6e7d, 0x769d, 0x767d, 0xbf5e, 0xffff, 0xffff, 0xffbf,
-  0xf73e, 0xf73d, 0xf6fd, 0xf6fc, 0xeedc, 0x869d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x667d, 0x8efe, 0xb73e, 0xf5d6, 0xed96,
-  0xd5f8, 0xf534, 0xce19, 0xaefe, 0xaedd, 0x6e7d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x8dd9, 0xbcd3, 0xf38b, 0xf3ec,
-  0xdc2f, 0xfb2a, 0xcc0f, 0x665c, 0x667d, 0x667d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8db8, 0xbcd3, 0xb4b3, 0xb514,
-  0xb4d3, 0xac73, 0xac93, 0x6e1c, 0x665d, 0x665c, 0x665d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669e, 0x66be,
-  0x66be, 0x669e, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e5d, 0xacf9, 0xac56, 0xa3f5,
-  0xabf5, 0xa436, 0x6e5c, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x96bd, 0xfdda, 0xfd58, 0xf496,
-  0xf475, 0xf4b6, 0x967d, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb73e, 0xffde, 0xffff, 0xffbf,
-  0xe6bc, 0xff5e, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0xd553, 0xf36b, 0xfdb6, 0xef3d,
-  0x6a2b, 0xeebb, 0xb6fe, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xeccf, 0xf2ac, 0xf536, 0xffbf,
-  0xe69b, 0xff1d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb6bc, 0xfbb4, 0xf538, 0xffdf,
-  0xf73d, 0xff3d, 0xaedd, 0x5e7d, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xb73e, 0xff5e, 0xff7e, 0xff9e,
-  0xf73d, 0xff3d, 0xd6fd, 0xaedd, 0xa6dd, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x96dd, 0xf79e, 0xffff, 0xffff, 0xff9e,
-  0xff9e, 0xff9e, 0xff1d, 0xff3d, 0xef1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x769d, 0xdf9f, 0xffbf, 0xffff, 0xffff, 0xff9f,
-  0xff9f, 0xffbf, 0xf73d, 0xff3d, 0xef1d, 0x7e9d, 0x667d, 0x6e7d,
-  0x6e7d, 0x667d, 0xaf3e, 0xf7bf, 0xef7e, 0xf7df, 0xff9e, 0xff3d,
-  0xf6fc, 0xff7d, 0xf71d, 0xef1d, 0xef1d, 0xa6bd, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x769d, 0x769d, 0x769d, 0x7e7c, 0xec4f, 0xe3ae,
-  0xccb3, 0xf30b, 0xacd5, 0x6ebe, 0x769d, 0x767d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x669e, 0x95b8, 0xf42d, 0xe34c,
-  0xd490, 0xfb4a, 0xac73, 0x669e, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x95d8, 0xf3cc, 0xf32b, 0xfb8b,
-  0xfb8b, 0xcbcf, 0xd36e, 0x761b, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x665d, 0x665d, 0x8db8, 0xbcf3, 0xb4b3, 0xb514,
-  0xad14, 0x6e1b, 0x8d78, 0x6e1b, 0x665d, 0x665d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x669d, 0x669e, 0x66be,
-  0x66be, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x959a, 0xb497, 0xac15,
-  0xa436, 0x761c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x767d, 0xd4b8, 0xfb13, 0xea2f,
-  0xe22f, 0x9579, 0x6e9d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xaf5f, 0xffff, 0xffbf, 0xff1d,
-  0xfefd, 0xef3d, 0xaedd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e5c, 0xd5f6, 0xf575, 0xfedb, 0xf77e,
-  0x9c12, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x765c, 0xecaf, 0xea89, 0xf555, 0xf77e,
-  0x9bf2, 0xf6dc, 0xb6dd, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0xbebc, 0xfbb4, 0xf558, 0xffdf,
-  0xff5e, 0xff3d, 0xaedd, 0x667d, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x5e5d, 0xaf3e, 0xff5e, 0xff7e, 0xff9e,
-  0xf71d, 0xff3d, 0xb6dd, 0x767d, 0x769d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0x8edd, 0xdf7e, 0xffff, 0xffff, 0xff9e,
-  0xf75e, 0xff7e, 0xf71d, 0xef1d, 0xdf1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0xbf3e, 0xffbf, 0xffff, 0xffff, 0xff9e,
-  0xff9e, 0xffbe, 0xf71d, 0xff3d, 0xef1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0xb73e, 0xffbf, 0xffff, 0xffff, 0xffbf,
-  0xff9f, 0xffbf, 0xf73d, 0xff3d, 0xef1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x667d, 0xaf1e, 0xf77e, 0xef5e, 0xf5b6, 0xf555,
-  0xef1c, 0xff3d, 0xeefc, 0xef1d, 0xdf1d, 0x769d, 0x667d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x6e9d, 0x6e9e, 0x865b, 0xf42d, 0xe30c,
-  0xc4f3, 0xfb6b, 0xacd5, 0x6ebe, 0x769d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x8df9, 0xd490, 0xfbab, 0xf3ab,
-  0xf3cc, 0xeb6c, 0xc3af, 0x6e5c, 0x667d, 0x6e7d, 0x6e7d, 0x6e7d,
-  0x6e7d, 0x6e7d, 0x6e7d, 0x667d, 0x95d8, 0xbcf3, 0xb4d4, 0xb514,
-  0xad14, 0x7db9, 0xa4b4, 0x6e1b, 0x665d, 0x6e7d, 0x6e7d, 0x6e7d
-};
-
-const Animation jumping_duckAnimation = {
-  .name = "Jumping Duck",
-  .frameCount = 9,
-  .width = 16,
-  .height = 16,
-  .frameDurations = jumping_duckDurations,
-  .animationFrames = jumping_duckFrames
-};
-#endif // ANIMATION_JUMPING_DUCK_H
@@ -1,1718 +0,0 @@
-// laughing_minion.h - Auto-generated from laughing_minion.json
-#ifndef ANIMATION_LAUGHING_MINION_H
-#define ANIMATION_LAUGHING_MINION_H
-
-#include "animation_types.h"
-
-// Frame Durations for laughing_minion (in 100ms units)
-static const uint8_t PROGMEM laughing_minionDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for laughing_minion
-static const uint16_t PROGMEM laughing_minionFrames[] = {
-  0xffff, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0xe71d, 0xff09,
-  0xff09, 0xffff, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0xe71d,
-  0x94b4, 0xe71d, 0x5401, 0x0000, 0x5401, 0xe71d, 0x94b4, 0xe71d,
-  0xffff, 0x94b4, 0xe71d, 0x8a00, 0x0000, 0x8a00, 0xe71d, 0x94b4,
-  0xe71d, 0xffff, 0x7d64, 0x5401, 0x7d64, 0xffff, 0xe71d, 0x94b4,
-  0x94b4, 0xe71d, 0xffff, 0xdbc3, 0x8a00, 0xdbc3, 0xffff, 0xe71d,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x94b4,
-  0x94b4, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xfe66, 0xff09, 0xff09, 0xff09, 0xff09, 0xff09, 0xfe66, 0x94b4,
-  0x94b4, 0xfe66, 0xff09, 0xff09, 0xff09, 0xff09, 0xff09, 0xfe66,
-  0xfde7, 0xfe66, 0xff09, 0xff09, 0xff09, 0xfe66, 0xfde7, 0x94b4,
-  0x94b4, 0xfde7, 0xfe66, 0xff09, 0xff09, 0xff09, 0xfe66, 0xfde7,
-  0xe71d, 0xfde7, 0xfe66, 0xfe66, 0xfe66, 0xfde7, 0xe71d, 0x94b4,
-  0x94b4, 0xe71d, 0xfde7, 0xfe66, 0xfe66, 0xfe66, 0xfde7, 0xffff,
-  0x94b4, 0xe71d, 0xe71d, 0xe71d, 0xe71d, 0xe71d, 0x94b4, 0xfde7,
-  0xfde7, 0x94b4, 0xe71d, 0xe71d, 0xe71d, 0xe71d, 0xffff, 0x94b4,
-  0xfde7, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0xfde7, 0xfee7,
-  0xfee7, 0xfde7, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0x94b4, 0xfde7,
-  0xff09, 0xfde7, 0xfde7, 0xfde7, 0xe71d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xe71d, 0xfde7, 0xfde7, 0xfde7, 0xff09,
-  0xff09, 0xff09, 0xff09, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0xff09, 0xff09, 0xff09,
-  0xff09, 0xff09, 0xff09, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0xff09, 0xff09, 0xff09,
-  0xff09, 0xff09, 0xff09, 0x7061, 0x7061, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x7061, 0x7061, 0xff09, 0xff09, 0xff09,
-  0xff09, 0xff09, 0xff09, 0xfce8, 0x7061, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x7061, 0xfce8, 0xff09, 0xff09, 0xff09,
-  0xff09, 0xff09, 0xff09, 0xff09, 0xfce8, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0xfce8, 0xff09, 0xff09, 0xff09, 0xff09,
-  0xff09, 0xff09, 0xff09, 0xff09, 0xff09, 0xfce8, 0xe71d, 0xffff,
-  0xffff, 0xe71d, 0xfce8, 0xff09, 0xff09, 0xff09, 0xff09, 0xff09,
-  0xff2d, 0xf77c, 0xdedc, 0xdedc, 0xdedc, 0xdeda, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf79d, 0xdefc, 0xdedc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad76, 0xa515, 0x94d3, 0x8c73, 0x9cd4, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xa4f4, 0x8c73, 0x9cb3, 0xa515, 0xa536, 0xd699,
-  0xad57, 0xef7e, 0xef7c, 0x6405, 0x1921, 0x5bc4, 0xa535, 0xdeba,
-  0xef5c, 0xad35, 0x8243, 0x20a1, 0x8a83, 0xef3c, 0xef7e, 0xad57,
-  0xf77c, 0xffdd, 0xf7bb, 0x8d66, 0x5c01, 0x8d65, 0xe719, 0xa516,
-  0xa516, 0xeef9, 0xd405, 0x9260, 0xd405, 0xff9b, 0xffdd, 0xf79c,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde6, 0xfe47, 0xfec9, 0xfee9, 0xfee9, 0xfe67, 0xf5c7, 0x9cb3,
-  0x9cb3, 0xf5c7, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe47, 0xfde6,
-  0xfea8, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe06, 0xf689, 0x9cd3,
-  0x9cd3, 0xf689, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe07, 0xfec8,
-  0xdeb8, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xf6ca, 0xd698, 0xa4d4,
-  0x9cd3, 0xd698, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xfeea, 0xf77b,
-  0xa514, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xd699, 0xad13, 0xedc8,
-  0xedc8, 0xad13, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xef3b, 0xad35,
-  0xeda9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xa515, 0xee0b, 0xfeeb,
-  0xfeeb, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa515, 0x8c92, 0x8432, 0x8c92, 0x9cf5, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa515, 0x9452, 0x8432, 0x9472, 0x9cf5, 0xd69b,
-  0xad56, 0xce79, 0x6405, 0x1921, 0x6404, 0xce79, 0xad56, 0xd6ba,
-  0xef3b, 0xad77, 0xce59, 0x8a84, 0x28a1, 0x8a83, 0xce59, 0xa536,
-  0xdefc, 0xef9d, 0x8d88, 0x5c23, 0x8d87, 0xef9d, 0xdedc, 0x9cf5,
-  0x9cf5, 0xd6dc, 0xf77d, 0xd427, 0x9282, 0xd407, 0xf77d, 0xdefd,
-  0xffbd, 0xffdd, 0xf79b, 0xef9b, 0xf79b, 0xffdd, 0xf77c, 0x9cd4,
-  0x9cd4, 0xf77c, 0xffdd, 0xff7b, 0xf75b, 0xff7b, 0xffdd, 0xffbd,
-  0xfe68, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xfe88,
-  0xfde8, 0xfe47, 0xfec8, 0xfee9, 0xfec8, 0xfe66, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe66, 0xfec8, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xdedc, 0xdedc, 0xdeda, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf79d, 0xdefc, 0xdedc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad76, 0xa515, 0x94d3, 0x8c73, 0x9cd4, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xa4f4, 0x8c73, 0x9cb3, 0xa515, 0xa536, 0xd699,
-  0xad57, 0xef7e, 0xef7c, 0x6405, 0x1921, 0x5bc4, 0xa535, 0xdeba,
-  0xef5c, 0xad35, 0x8243, 0x20a1, 0x8a83, 0xef3c, 0xef7e, 0xad57,
-  0xf77c, 0xffdd, 0xf7bb, 0x8d66, 0x5c01, 0x8d65, 0xe719, 0xa516,
-  0xa516, 0xeef9, 0xd405, 0x9260, 0xd405, 0xff9b, 0xffdd, 0xf79c,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde6, 0xfe47, 0xfec9, 0xfee9, 0xfee9, 0xfe67, 0xf5c7, 0x9cb3,
-  0x9cb3, 0xf5c7, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe47, 0xfde6,
-  0xfea8, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe06, 0xf689, 0x9cd3,
-  0x9cd3, 0xf689, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe07, 0xfec8,
-  0xdeb8, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xf6ca, 0xd698, 0xa4d4,
-  0x9cd3, 0xd698, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xfeea, 0xf77b,
-  0xa514, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xd699, 0xad13, 0xedc8,
-  0xedc8, 0xad13, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xef3b, 0xad35,
-  0xeda9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xa515, 0xee0b, 0xfeeb,
-  0xfeeb, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa515, 0x8c92, 0x8432, 0x8c92, 0x9cf5, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa515, 0x9452, 0x8432, 0x9472, 0x9cf5, 0xd69b,
-  0xad56, 0xce79, 0x6405, 0x1921, 0x6404, 0xce79, 0xad56, 0xd6ba,
-  0xef3b, 0xad77, 0xce59, 0x8a84, 0x28a1, 0x8a83, 0xce59, 0xa536,
-  0xdefc, 0xef9d, 0x8d88, 0x5c23, 0x8d87, 0xef9d, 0xdedc, 0x9cf5,
-  0x9cf5, 0xd6dc, 0xf77d, 0xd427, 0x9282, 0xd407, 0xf77d, 0xdefd,
-  0xffbd, 0xffdd, 0xf79b, 0xef9b, 0xf79b, 0xffdd, 0xf77c, 0x9cd4,
-  0x9cd4, 0xf77c, 0xffdd, 0xff7b, 0xf75b, 0xff7b, 0xffdd, 0xffbd,
-  0xfe68, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xfe88,
-  0xfde8, 0xfe47, 0xfec8, 0xfee9, 0xfec8, 0xfe66, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe66, 0xfec8, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xdedc, 0xdedc, 0xdeda, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf79d, 0xdefc, 0xdedc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad76, 0xa515, 0x94d3, 0x8c73, 0x9cd4, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xa4f4, 0x8c73, 0x9cb3, 0xa515, 0xa536, 0xd699,
-  0xad57, 0xef7e, 0xef7c, 0x6405, 0x1921, 0x5bc4, 0xa535, 0xdeba,
-  0xef5c, 0xad35, 0x8243, 0x20a1, 0x8a83, 0xef3c, 0xef7e, 0xad57,
-  0xf77c, 0xffdd, 0xf7bb, 0x8d66, 0x5c01, 0x8d65, 0xe719, 0xa516,
-  0xa516, 0xeef9, 0xd405, 0x9260, 0xd405, 0xff9b, 0xffdd, 0xf79c,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde6, 0xfe47, 0xfec9, 0xfee9, 0xfee9, 0xfe67, 0xf5c7, 0x9cb3,
-  0x9cb3, 0xf5c7, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe47, 0xfde6,
-  0xfea8, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe06, 0xf689, 0x9cd3,
-  0x9cd3, 0xf689, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe07, 0xfec8,
-  0xdeb8, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xf6ca, 0xd698, 0xa4d4,
-  0x9cd3, 0xd698, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xfeea, 0xf77b,
-  0xa514, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xd699, 0xad13, 0xedc8,
-  0xedc8, 0xad13, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xef3b, 0xad35,
-  0xeda9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xa515, 0xee0b, 0xfeeb,
-  0xfeeb, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa515, 0x8c92, 0x8432, 0x8c92, 0x9cf5, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa515, 0x9452, 0x8432, 0x9472, 0x9cf5, 0xd69b,
-  0xad56, 0xce79, 0x6405, 0x1921, 0x6404, 0xce79, 0xad56, 0xd6ba,
-  0xef3b, 0xad77, 0xce59, 0x8a84, 0x28a1, 0x8a83, 0xce59, 0xa536,
-  0xdefc, 0xef9d, 0x8d88, 0x5c23, 0x8d87, 0xef9d, 0xdedc, 0x9cf5,
-  0x9cf5, 0xd6dc, 0xf77d, 0xd427, 0x9282, 0xd407, 0xf77d, 0xdefd,
-  0xffbd, 0xffdd, 0xf79b, 0xef9b, 0xf79b, 0xffdd, 0xf77c, 0x9cd4,
-  0x9cd4, 0xf77c, 0xffdd, 0xff7b, 0xf75b, 0xff7b, 0xffdd, 0xffbd,
-  0xfe68, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfeea, 0xff0b, 0xff0b, 0xff0b, 0xfeea, 0xfe88,
-  0xfde8, 0xfe47, 0xfec8, 0xfee9, 0xfec8, 0xfe66, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe66, 0xfec8, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xdedc, 0xdedc, 0xdeda, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf79d, 0xdefc, 0xdedc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad76, 0xa515, 0x94d3, 0x8c73, 0x9cd4, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xa4f4, 0x8c73, 0x9cb3, 0xa515, 0xa536, 0xd699,
-  0xad57, 0xef7e, 0xef7c, 0x6405, 0x1921, 0x5bc4, 0xa535, 0xdeba,
-  0xef5c, 0xad35, 0x8243, 0x20a1, 0x8a83, 0xef3c, 0xef7e, 0xad57,
-  0xf77c, 0xffdd, 0xf7bb, 0x8d66, 0x5c01, 0x8d65, 0xe719, 0xa516,
-  0xa516, 0xeef9, 0xd405, 0x9260, 0xd405, 0xff9b, 0xffdd, 0xf79c,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde6, 0xfe47, 0xfec9, 0xfee9, 0xfee9, 0xfe67, 0xf5c7, 0x9cb3,
-  0x9cb3, 0xf5c7, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe47, 0xfde6,
-  0xfea8, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe06, 0xf689, 0x9cd3,
-  0x9cd3, 0xf689, 0xfe07, 0xfe46, 0xfe66, 0xfe46, 0xfe07, 0xfec8,
-  0xdeb8, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xf6ca, 0xd698, 0xa4d4,
-  0x9cd3, 0xd698, 0xf6ca, 0xfe08, 0xfde9, 0xfe08, 0xfeea, 0xf77b,
-  0xa514, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xd699, 0xad13, 0xedc8,
-  0xedc8, 0xad13, 0xd699, 0xdeba, 0xdeba, 0xdeba, 0xef3b, 0xad35,
-  0xeda9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xa515, 0xee0b, 0xfeeb,
-  0xfeeb, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa516, 0x9cf5, 0x9cf3, 0x94b2, 0x94d3, 0xd699, 0xff0c,
-  0xff2d, 0xef5c, 0xa4f5, 0x9472, 0x9c93, 0x9cf5, 0x9d15, 0xd69b,
-  0xa536, 0xd6bb, 0xef7c, 0xa66c, 0x5c03, 0x7ce6, 0xa534, 0xdeba,
-  0xef5c, 0xad56, 0xcccd, 0x8a62, 0xcbc6, 0xef3c, 0xd6dc, 0xa536,
-  0xdedc, 0xffdf, 0xf7bd, 0x6444, 0x1100, 0x5c03, 0xce79, 0xa4f6,
-  0xa516, 0xd659, 0x92a3, 0x2060, 0x9282, 0xf77d, 0xffdf, 0xdefc,
-  0xffbd, 0xffdd, 0xf79b, 0x8d66, 0x5c01, 0x8d66, 0xef5a, 0x9cd5,
-  0x9cd5, 0xef3a, 0xd405, 0x9260, 0xd405, 0xff7b, 0xffdd, 0xffbd,
-  0xfe68, 0xfeea, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeea, 0xfe88,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f4, 0xad14, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5e9, 0xedc8, 0xe5a7, 0xe588, 0xad13, 0xd6ba,
-  0xef5c, 0xb533, 0xed89, 0xed67, 0xf588, 0xf5e9, 0xedcb, 0xacf3,
-  0xf60c, 0xff9c, 0xf7bc, 0xae6b, 0x6402, 0x8524, 0xe5ca, 0xa4f4,
-  0xa4f4, 0xedcb, 0xdceb, 0x9261, 0xd3c4, 0xff7b, 0xff9c, 0xf60c,
-  0xff9b, 0xffdd, 0xf79b, 0x6c65, 0x2140, 0x6c44, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x92e4, 0x28e0, 0x92c3, 0xf77b, 0xffdd, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xeea8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf688, 0xe669, 0xf689, 0xfeeb, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa514, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4d4, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa4f4, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4f3, 0xd69b,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5e8, 0xedc9, 0xad13, 0xd6ba,
-  0xef5b, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c8, 0xeda9, 0xad12,
-  0xedea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedca, 0x9cd4,
-  0xa4f4, 0xedca, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf5ea,
-  0xe6f9, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xd676, 0x9cd4,
-  0x9cd4, 0xde56, 0x9303, 0x3941, 0x9303, 0xf759, 0xffbb, 0xe6f9,
-  0xfe68, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xee29, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe68,
-  0xfe08, 0xfe47, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xeda8, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee9, 0xf6c7, 0xee86, 0xf686, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedeb, 0xfe87, 0xf666, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf7ba, 0xbecc, 0x74a2, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf739, 0xedad, 0xa322, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6ea, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfec9, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa514, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4d4, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa4f4, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4f3, 0xd69b,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5e8, 0xedc9, 0xad13, 0xd6ba,
-  0xef5b, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c8, 0xeda9, 0xad12,
-  0xedea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedca, 0x9cd4,
-  0xa4f4, 0xedca, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf5ea,
-  0xe6f9, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xd676, 0x9cd4,
-  0x9cd4, 0xde56, 0x9303, 0x3941, 0x9303, 0xf759, 0xffbb, 0xe6f9,
-  0xfe68, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xee29, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe68,
-  0xfe08, 0xfe47, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xeda8, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee9, 0xf6c7, 0xee86, 0xf686, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedeb, 0xfe87, 0xf666, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf7ba, 0xbecc, 0x74a2, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf739, 0xedad, 0xa322, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6ea, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfec9, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xf77b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec, 0xfee9,
-  0xfee9, 0xff0c, 0xef7b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec,
-  0xef5c, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd69a,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5e8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedcb, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x9b23, 0x3941, 0x9303, 0xf759, 0xffdb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xdeda, 0xad76, 0xedeb,
-  0xedeb, 0xad75, 0xdeba, 0xdeda, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9cb4, 0xd65a, 0xe6fb, 0xf71b,
-  0xf71b, 0xe6fb, 0xd65a, 0x9cb4, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x7923, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x6841, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x6841, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xeda8, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee9, 0xf6c7, 0xee86, 0xf686, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedeb, 0xfe87, 0xf666, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf7ba, 0xbecc, 0x74a2, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf739, 0xedad, 0xa322, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6ea, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfec9, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8142, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8142, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8122, 0x6841, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x6841, 0x8122, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xf77b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec, 0xfee9,
-  0xfee9, 0xff0c, 0xef7b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec,
-  0xef5c, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd69a,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5e8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedcb, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x9b23, 0x3941, 0x9303, 0xf759, 0xffdb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad55, 0xedeb,
-  0xedeb, 0xad55, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9473, 0x9cb4, 0xe6db, 0xf71b,
-  0xf71b, 0xe6db, 0x9cb4, 0x9473, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x70a3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x70a3, 0x7903, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x7041, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x7041, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xffbb, 0xffbd, 0xffbd, 0xffbd, 0xffbb, 0xff0c, 0xfee9,
-  0xfee9, 0xff0c, 0xffbc, 0xffbd, 0xffbd, 0xffbd, 0xffbb, 0xff0d,
-  0xffdd, 0xf79e, 0xdedc, 0xdedc, 0xdedc, 0xdefc, 0xf79c, 0xff0c,
-  0xff0c, 0xffdc, 0xef9e, 0xdedc, 0xdedc, 0xdedc, 0xdefc, 0xf7bd,
-  0xef5d, 0xad35, 0xa4d3, 0xa4f3, 0xa4d3, 0xa514, 0xd6bb, 0xf7bd,
-  0xffde, 0xef7e, 0xad35, 0xa4d3, 0xa4f3, 0xa4d3, 0xa514, 0xd6bb,
-  0xad12, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6bc,
-  0xef5d, 0xb553, 0xeda9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee8, 0xf6a6, 0xee86, 0xf686, 0xedeb, 0x9cd4,
-  0xa4f4, 0xedeb, 0xfe66, 0xf646, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf79a, 0x95a6, 0x7482, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf718, 0xdc65, 0xa301, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfe88, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad55, 0xedeb,
-  0xedeb, 0xad55, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9473, 0x9cb4, 0xe6db, 0xf71b,
-  0xf71b, 0xe6db, 0x9cb4, 0x9473, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x70a3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x70a3, 0x7903, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x7041, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x7041, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xf77b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec, 0xfee9,
-  0xfee9, 0xff0c, 0xef7b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec,
-  0xef5c, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd69a,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5e8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedcb, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x9b23, 0x3941, 0x9303, 0xf759, 0xffdb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad55, 0xedeb,
-  0xedeb, 0xad55, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9473, 0x9cb4, 0xe6db, 0xf71b,
-  0xf71b, 0xe6db, 0x9cb4, 0x9473, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x70a3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x70a3, 0x7903, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x7041, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x7041, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xffbb, 0xffbd, 0xffbd, 0xffbd, 0xffbb, 0xff0c, 0xfee9,
-  0xfee9, 0xff0c, 0xffbc, 0xffbd, 0xffbd, 0xffbd, 0xffbb, 0xff0d,
-  0xffdd, 0xf79e, 0xdedc, 0xdedc, 0xdedc, 0xdefc, 0xf79c, 0xff0c,
-  0xff0c, 0xffdc, 0xef9e, 0xdedc, 0xdedc, 0xdedc, 0xdefc, 0xf7bd,
-  0xef5d, 0xad35, 0xa4d3, 0xa4f3, 0xa4d3, 0xa514, 0xd6bb, 0xf7bd,
-  0xffde, 0xef7e, 0xad35, 0xa4d3, 0xa4f3, 0xa4d3, 0xa514, 0xd6bb,
-  0xad12, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6bc,
-  0xef5d, 0xb553, 0xeda9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee8, 0xf6a6, 0xee86, 0xf686, 0xedeb, 0x9cd4,
-  0xa4f4, 0xedeb, 0xfe66, 0xf646, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf79a, 0x95a6, 0x7482, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf718, 0xdc65, 0xa301, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfe88, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad55, 0xedeb,
-  0xedeb, 0xad55, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9473, 0x9cb4, 0xe6db, 0xf71b,
-  0xf71b, 0xe6db, 0x9cb4, 0x9473, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x70a3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x70a3, 0x7903, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x7041, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x7041, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff0b, 0xff09,
-  0xff0d, 0xf77b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec, 0xfee9,
-  0xfee9, 0xff0c, 0xef7b, 0xdeda, 0xdeba, 0xdeba, 0xdeb9, 0xf6ec,
-  0xef5c, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4d4, 0xa4f4, 0xa4d4, 0xa514, 0xd69a,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5e8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedcb, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x9b23, 0x3941, 0x9303, 0xf759, 0xffdb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d3,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad55, 0xedeb,
-  0xedeb, 0xad55, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4d4, 0x9473, 0x9cb4, 0xe6db, 0xf71b,
-  0xf71b, 0xe6db, 0x9cb4, 0x9473, 0xa4d4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xed68, 0x7923, 0x70a3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x70a3, 0x7903, 0xed68, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8122, 0x7041, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x7041, 0x8122, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c7, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb553, 0xeda8, 0xf5e8, 0xf5c8, 0xf5c7, 0xeda8, 0xacf2,
-  0xf5ea, 0xfec9, 0xfee9, 0xf6c7, 0xee86, 0xf686, 0xedeb, 0x9cf4,
-  0xa4f4, 0xedeb, 0xfe87, 0xf666, 0xfe86, 0xfec8, 0xfec9, 0xf60a,
-  0xff9b, 0xffbb, 0xf7ba, 0xbecc, 0x74a2, 0x95a6, 0xef38, 0x9cd5,
-  0x9cd4, 0xf739, 0xedad, 0xa322, 0xdc65, 0xff79, 0xffbb, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6ea, 0xeea9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfec9, 0xf689, 0xf6a9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8142, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8142, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8122, 0x6841, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x6841, 0x8122, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea6,
-  0xfea6, 0xedc9, 0xacf2, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5ea, 0xfeeb, 0xff2b,
-  0xff2b, 0xfeeb, 0xf5ea, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xf5e9, 0xde57, 0xef3b, 0xf73b,
-  0xf73b, 0xef3b, 0xde57, 0xf5e9, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xf6ca, 0xac90, 0x7925, 0x78e3, 0x78e4,
-  0x78e4, 0x78e3, 0x7925, 0xa490, 0xf6ca, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xecc8, 0x8102, 0x78c3, 0x7904,
-  0x7904, 0x78c3, 0x8102, 0xecc8, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xece9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa515, 0xa516, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa516, 0xa515, 0xa514, 0xd699,
-  0xad12, 0xedec, 0xf77c, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7bf, 0xf77c, 0xedec, 0xacf2,
-  0xf60b, 0xff9b, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffff, 0xff9b, 0xf60b,
-  0xffbd, 0xffdf, 0xf7de, 0xb6ad, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffff, 0xefbd, 0x6444, 0x1100, 0x5c23, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92a3, 0x2060, 0x9282, 0xf77d, 0xffff, 0xffbd,
-  0xfe4c, 0xff9b, 0xf79b, 0x8d45, 0x5c01, 0x8d24, 0xedeb, 0x9cb3,
-  0x9cb3, 0xedcb, 0xd3c3, 0x9260, 0xd3e4, 0xff7b, 0xff9b, 0xfe4c,
-  0xde98, 0xf62c, 0xfe6a, 0xf668, 0xee48, 0xee0a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf5ea, 0xf608, 0xf648, 0xfe6a, 0xfe4c, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd69a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd69a, 0xdeba, 0xdeba, 0xdeda, 0xef1b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xf6aa, 0xfeeb, 0xff0b, 0xff2b,
-  0xff2b, 0xff0b, 0xfeeb, 0xf6aa, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xf5e8, 0xad12, 0xd658, 0xef1a, 0xef1a,
-  0xef1a, 0xef1a, 0xd658, 0xad12, 0xf5e8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xecc8, 0x8985, 0x8186, 0x89a7,
-  0x89a7, 0x8186, 0x8985, 0xecc8, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xece8, 0xde37, 0xef1a,
-  0xef1a, 0xde37, 0xece8, 0xfe89, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13,
-  0xf5c8, 0xfe86, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xeda9, 0x9cd4,
-  0xa4f4, 0xeda9, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xfe86, 0xf5c8,
-  0xfde7, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xf5c8, 0x9cb3,
-  0x9cb3, 0xf5c8, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfde7,
-  0xfe46, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfec8, 0xf627, 0x9cb3,
-  0x9cb3, 0xf628, 0xfec8, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfe46,
-  0xfe08, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xfe29,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13,
-  0xf5c8, 0xfe86, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xeda9, 0x9cd4,
-  0xa4f4, 0xeda9, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xfe86, 0xf5c8,
-  0xfde7, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xf5c8, 0x9cb3,
-  0x9cb3, 0xf5c8, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfde7,
-  0xfe46, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfec8, 0xf627, 0x9cb3,
-  0x9cb3, 0xf628, 0xfec8, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfe46,
-  0xfe08, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xfe29,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5c, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xeda9, 0xf5c8, 0xf5c8, 0xf5c8, 0xeda9, 0xad13,
-  0xf5c8, 0xfe86, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xeda9, 0x9cd4,
-  0xa4f4, 0xeda9, 0xfea6, 0xfea6, 0xfea6, 0xfea6, 0xfe86, 0xf5c8,
-  0xfde7, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xf5c8, 0x9cb3,
-  0x9cb3, 0xf5c8, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfe07, 0xfde7,
-  0xfe46, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfec8, 0xf627, 0x9cb3,
-  0x9cb3, 0xf628, 0xfec8, 0xfec9, 0xfec9, 0xfec9, 0xfec9, 0xfe46,
-  0xfe08, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfee9, 0xfe67, 0xfe29,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad34, 0xa4d3, 0xa4f3, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xad13, 0xd6ba,
-  0xef5c, 0xb554, 0xedcb, 0xf5ea, 0xf5ea, 0xf5ea, 0xedcb, 0xacf3,
-  0xf60b, 0xff9b, 0xffbd, 0xf7bb, 0xf79b, 0xf779, 0xedec, 0x9cd4,
-  0xa4f4, 0xedec, 0xff7a, 0xf75b, 0xff7b, 0xffbd, 0xff9b, 0xf60b,
-  0xffbd, 0xffff, 0xf7de, 0xaead, 0x5c24, 0x8567, 0xef5b, 0x9cd5,
-  0x9cd5, 0xf75b, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffde,
-  0xffbd, 0xffdd, 0xf79b, 0x6c64, 0x2140, 0x6c43, 0xe73a, 0x9cf5,
-  0x9cf5, 0xef1a, 0x92e3, 0x28c0, 0x92c3, 0xf75b, 0xffdd, 0xffbd,
-  0xfe2a, 0xfe68, 0xfeea, 0xeea8, 0xee48, 0xee26, 0xf5eb, 0x9cb3,
-  0x9cb3, 0xf5eb, 0xf606, 0xee48, 0xf688, 0xfeea, 0xfe68, 0xfe2b,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe88, 0xfe2a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xfe2a, 0xfe88, 0xfe89, 0xfe68, 0xfe2a, 0xf75a,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd67a, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd67a, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bb, 0xdeba, 0xff0d,
-  0xef5b, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa515, 0xa515, 0xa515, 0xa536, 0xd699,
-  0xa536, 0xd6bb, 0xf79e, 0xf79e, 0xf79e, 0xd6bc, 0xa556, 0xd6ba,
-  0xef5c, 0xad77, 0xd6bb, 0xf79e, 0xf7be, 0xf79e, 0xd6bb, 0xa536,
-  0xdedc, 0xf7bf, 0xffff, 0xf7de, 0xf7bd, 0xef9d, 0xd6bb, 0x9cf5,
-  0x9cf5, 0xd6bb, 0xf79d, 0xf77d, 0xff9d, 0xffdf, 0xf7bf, 0xdefc,
-  0xffdf, 0xffdf, 0xf7de, 0xaead, 0x6424, 0x8d67, 0xef7c, 0x9cd5,
-  0x9cd5, 0xf77d, 0xdd4f, 0x9283, 0xd406, 0xff9d, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xef9d, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cf5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xf7bd, 0x8d87, 0x5c23, 0x8d88, 0xef7c, 0x9cd5,
-  0x9cd5, 0xef5c, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffff,
-  0xdedc, 0xf7bf, 0xffdf, 0xf7bd, 0xef9c, 0xef9d, 0xd6bb, 0xa4d3,
-  0x9cd3, 0xd6bb, 0xf77d, 0xf77c, 0xf79d, 0xffdf, 0xffdf, 0xf7be,
-  0xa514, 0xd69b, 0xdedc, 0xdedc, 0xdedc, 0xd6bc, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd6bc, 0xdefc, 0xdedc, 0xdefc, 0xef5d, 0xad35,
-  0xeda9, 0xacf2, 0xa4d4, 0xa4f3, 0xa4d3, 0xacf2, 0xedc9, 0xfec9,
-  0xfec9, 0xedc9, 0xacf2, 0xa4d3, 0xa4f3, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5a8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5a8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfec9, 0xfe07, 0xfea9, 0xfea8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfea9, 0xfe07, 0xfec9, 0xfee9,
-  0xfee9, 0xfee9, 0xfec9, 0xfe07, 0xfd84, 0xfea8, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfea8, 0xfd84, 0xfe07, 0xfec9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea8, 0xfd63, 0xeca1, 0xeca1,
-  0xeca1, 0xeca1, 0xfd63, 0xfea8, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xfea8, 0xfea8,
-  0xfea8, 0xfea8, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bb, 0xd6bb, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xf77c, 0xdedc, 0xd6bb, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa515, 0xa516, 0xa516, 0xa536, 0xd698, 0xf6ec,
-  0xff2c, 0xef3a, 0xad56, 0xa516, 0xa536, 0xa515, 0xa514, 0xd699,
-  0xad12, 0xedec, 0xf77c, 0xef9d, 0xe75b, 0xce99, 0xa536, 0xd6ba,
-  0xef5c, 0xad77, 0xd69a, 0xef1b, 0xf75c, 0xf77c, 0xedec, 0xacf2,
-  0xf60b, 0xff9b, 0xf7de, 0xb6ad, 0x6444, 0x8567, 0xce99, 0x9cf6,
-  0x9d15, 0xd69a, 0xdd2e, 0x92a3, 0xd406, 0xff9d, 0xff9c, 0xf60b,
-  0xffbd, 0xffff, 0xefbd, 0x6444, 0x1100, 0x5c23, 0xe75c, 0x9cf5,
-  0x9cd5, 0xef3c, 0x92a3, 0x2060, 0x9262, 0xf77c, 0xffff, 0xffde,
-  0xffbd, 0xffff, 0xf7bd, 0x8d88, 0x5c23, 0x8d88, 0xef5a, 0x9cd5,
-  0x9cd5, 0xf73a, 0xd427, 0x9282, 0xd407, 0xff9d, 0xffff, 0xffbd,
-  0xfe4c, 0xff9b, 0xffbd, 0xf79b, 0xf79a, 0xf779, 0xf62d, 0x9cb3,
-  0x9cb3, 0xf60d, 0xff59, 0xf75a, 0xff7b, 0xffbd, 0xff9b, 0xfe4c,
-  0xde98, 0xf62c, 0xfe8a, 0xfe8a, 0xfe8a, 0xfe2c, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf64c, 0xfe8a, 0xfeaa, 0xfe8a, 0xfe4c, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xedc9,
-  0xedc9, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef1b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xacf3, 0xedc9, 0xfea7,
-  0xfea7, 0xedc9, 0xacf3, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9, 0xfee9,
-  0xfee9, 0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xf6aa, 0xfeeb, 0xff0b, 0xff2b,
-  0xff2b, 0xff0b, 0xfeeb, 0xf6aa, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xf5e8, 0xad12, 0xd658, 0xef1a, 0xef1a,
-  0xef1a, 0xef1a, 0xd658, 0xad12, 0xf5e8, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xecc8, 0x8985, 0x8186, 0x89a7,
-  0x89a7, 0x8186, 0x8985, 0xecc8, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xece8, 0xde37, 0xef1a,
-  0xef1a, 0xde37, 0xece8, 0xfe89, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f4, 0xa4f4, 0xad14, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad55, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5e9, 0xe587, 0xdd47, 0xdd68, 0xad13, 0xd6ba,
-  0xef5c, 0xb533, 0xdd48, 0xdd47, 0xe567, 0xf5c9, 0xedcb, 0xacf3,
-  0xf60c, 0xff9c, 0xf79b, 0x6c24, 0x2140, 0x6c02, 0xe5aa, 0xa4f4,
-  0xa4f4, 0xe58a, 0x9281, 0x28c0, 0x92a2, 0xf75b, 0xff9c, 0xf60c,
-  0xff9b, 0xffdd, 0xf7bc, 0x8566, 0x5c01, 0x8d66, 0xef38, 0x9cd5,
-  0x9cd4, 0xf718, 0xd405, 0x8a60, 0xd405, 0xff9b, 0xffdd, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xf6c9, 0xeec9, 0xf6c8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xfea8, 0xf6a9, 0xfea9, 0xff0b, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8142, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8142, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8122, 0x6841, 0x7041, 0x7041,
-  0x7041, 0x7041, 0x6841, 0x8122, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8122, 0x78e4, 0x7904,
-  0x7904, 0x78e4, 0x8103, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xed09, 0xde57, 0xef3b,
-  0xef3b, 0xde57, 0xed09, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xff0b, 0xff0b,
-  0xff0b, 0xff0b, 0xfec9, 0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xff2d, 0xf77c, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xf6ec, 0xfee9,
-  0xfee9, 0xff2d, 0xef7d, 0xd6dc, 0xd6bc, 0xd6bc, 0xdeba, 0xff0d,
-  0xef5b, 0xad34, 0xa4d3, 0xa4f3, 0xa4f4, 0xad14, 0xd698, 0xf6ec,
-  0xff2c, 0xef5a, 0xad35, 0xa4f3, 0xa4f4, 0xa4f3, 0xa514, 0xd699,
-  0xad13, 0xedcb, 0xf5e9, 0xedc8, 0xe5a7, 0xe588, 0xad13, 0xd6ba,
-  0xef5c, 0xb533, 0xed89, 0xed67, 0xf588, 0xf5e9, 0xedcb, 0xacf3,
-  0xf60c, 0xff9c, 0xf7bc, 0xae6b, 0x6402, 0x8524, 0xe5ca, 0xa4f4,
-  0xa4f4, 0xedcb, 0xdceb, 0x9261, 0xd3c4, 0xff7b, 0xff9c, 0xf60c,
-  0xff9b, 0xffdd, 0xf79b, 0x6c65, 0x2140, 0x6c44, 0xef38, 0x9cd5,
-  0x9cd4, 0xef18, 0x92e4, 0x28e0, 0x92c3, 0xf77b, 0xffdd, 0xffbb,
-  0xfe69, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xeea8, 0xf649, 0x9cb3,
-  0x9cb3, 0xf649, 0xf688, 0xe669, 0xf689, 0xfeeb, 0xfeeb, 0xfe89,
-  0xfde8, 0xfe46, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78c2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9,
-  0xef5d, 0xa514, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4d4, 0xd69a, 0xff0c,
-  0xff2d, 0xef5c, 0xa4f4, 0x9cb3, 0x9cb3, 0x9cb3, 0xa4f3, 0xd69b,
-  0xad13, 0xeda9, 0xf5c8, 0xf5c8, 0xf5e8, 0xedc9, 0xad13, 0xd6ba,
-  0xef5b, 0xb553, 0xedc9, 0xf5e8, 0xf5c8, 0xf5c8, 0xeda9, 0xad12,
-  0xedea, 0xfec9, 0xfec8, 0xee86, 0xe626, 0xee66, 0xedca, 0x9cd4,
-  0xa4f4, 0xedca, 0xf646, 0xe626, 0xf646, 0xfec8, 0xfec9, 0xf5ea,
-  0xe6f9, 0xffbb, 0xf799, 0x7464, 0x3181, 0x7464, 0xd676, 0x9cd4,
-  0x9cd4, 0xde56, 0x9303, 0x3941, 0x9303, 0xf759, 0xffbb, 0xe6f9,
-  0xfe68, 0xfeeb, 0xff0b, 0xeea9, 0xe669, 0xee88, 0xf649, 0x9cb3,
-  0x9cb3, 0xee29, 0xf668, 0xe649, 0xf689, 0xff0b, 0xfeeb, 0xfe68,
-  0xfe08, 0xfe47, 0xfec8, 0xfee9, 0xfee9, 0xfe67, 0xf5e9, 0x9cb3,
-  0x9cb3, 0xf5e9, 0xfe67, 0xfee9, 0xfee9, 0xfec8, 0xfe46, 0xfe08,
-  0xde98, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xf60a, 0xd678, 0xa4d4,
-  0x9cd3, 0xd678, 0xf60a, 0xfe68, 0xfe89, 0xfe68, 0xfe2b, 0xf75b,
-  0xa514, 0xd679, 0xdeba, 0xdeba, 0xdeba, 0xd679, 0xad13, 0xeda8,
-  0xeda8, 0xad13, 0xd679, 0xdeba, 0xdeba, 0xdeda, 0xef3b, 0xad35,
-  0xeda9, 0xad13, 0xa4f4, 0xa4f4, 0xa4f4, 0xa535, 0xee0b, 0xfee9,
-  0xfee9, 0xee0b, 0xa535, 0xa4f4, 0xa4f4, 0xa4f4, 0xad13, 0xedc9,
-  0xfec9, 0xf5e8, 0xf5c8, 0xf5c8, 0xe569, 0xd638, 0xef1b, 0xf73b,
-  0xf73b, 0xef1b, 0xd638, 0xe569, 0xf5c8, 0xf5c8, 0xf5e8, 0xfec9,
-  0xfee9, 0xfee9, 0xfee9, 0xf668, 0x8962, 0x78e3, 0x7904, 0x7904,
-  0x7904, 0x7904, 0x78e3, 0x8962, 0xf668, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7041, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7041, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x78e2, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x78e2, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xff09, 0xf669, 0x8142, 0x7061, 0x7061, 0x7061,
-  0x7061, 0x7061, 0x7061, 0x8142, 0xf669, 0xff09, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfec9, 0xec87, 0x8923, 0x7904, 0x8124,
-  0x8124, 0x7904, 0x8923, 0xec87, 0xfec9, 0xfee9, 0xfee9, 0xfee9,
-  0xfee9, 0xfee9, 0xfee9, 0xfee9, 0xfea9, 0xecc9, 0xde58, 0xef3c,
-  0xef3c, 0xde59, 0xecc9, 0xfea9, 0xfee9, 0xfee9, 0xfee9, 0xfee9
-};
-
-const Animation laughing_minionAnimation = {
-  .name = "Laughing Minion",
-  .frameCount = 53,
-  .width = 16,
-  .height = 16,
-  .frameDurations = laughing_minionDurations,
-  .animationFrames = laughing_minionFrames
-};
-#endif // ANIMATION_LAUGHING_MINION_H
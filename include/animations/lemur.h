@@ -1,630 +0,0 @@
-// lemur.h - Auto-generated from lemur.json
-#ifndef ANIMATION_LEMUR_H
-#define ANIMATION_LEMUR_H
-
-#include "animation_types.h"
-
-// Frame Durations for lemur (in 100ms units)
-static const uint8_t PROGMEM lemurDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for lemur
-static const uint16_t PROGMEM lemurFrames[] = {
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0xffff,
-  0xffff, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0xfffe, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06,
-  0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0xffff, 0xffff,
-  0xffff, 0x4a06, 0x4a06, 0x0040, 0x0040, 0x0040, 0x4a06, 0x4a06,
-  0x4a06, 0x4a06, 0x0040, 0x0040, 0x0040, 0x4a06, 0x4a06, 0xffff,
-  0xffff, 0x4a06, 0x0040, 0x6c09, 0x6c09, 0xf7dd, 0x0040, 0x4a06,
-  0x4a06, 0x0040, 0x6c09, 0x6c09, 0xf7dd, 0x0040, 0x4a06, 0xffde,
-  0xa512, 0x4a06, 0x0040, 0x854a, 0x0040, 0x6c09, 0x0040, 0x4a06,
-  0x4a06, 0x0040, 0x854a, 0x0040, 0x6c09, 0x0040, 0x4a06, 0xa512,
-  0xa512, 0x4a06, 0x0040, 0xa64d, 0xa64d, 0x854a, 0x0040, 0x4a06,
-  0x4a06, 0x0040, 0xa64d, 0xa64d, 0x854a, 0x0040, 0x4a06, 0xa512,
-  0x948e, 0xa512, 0x4a06, 0x0040, 0x0040, 0x0040, 0x4a06, 0x18c3,
-  0x18c3, 0x4a06, 0x0040, 0x0040, 0x0040, 0x4a06, 0xa512, 0x948e,
-  0x948e, 0x948e, 0xa512, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x0040,
-  0x0040, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0xa512, 0x948e, 0x948e,
-  0xbe2b, 0xbe2b, 0xa512, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06,
-  0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0xa512, 0xbe2b, 0xbe2b,
-  0x9509, 0x9509, 0x9509, 0xa512, 0xa512, 0x4a06, 0x4a06, 0x4a06,
-  0x4a06, 0x4a06, 0x4a06, 0xa512, 0xa512, 0x9509, 0x9509, 0x9509,
-  0x7c86, 0x7c86, 0x7c86, 0x7c86, 0x1883, 0xa512, 0xa512, 0xa512,
-  0xa512, 0xa512, 0xa512, 0x1883, 0x7c86, 0x7c86, 0x7c86, 0x7c86,
-  0x5344, 0x5344, 0x5344, 0x946e, 0x6308, 0x1883, 0x1883, 0x1883,
-  0x1883, 0x1883, 0x1883, 0x6308, 0x946e, 0x5344, 0x5344, 0x5344,
-  0x42c3, 0x42c3, 0x42c3, 0xffff, 0x946e, 0x1883, 0x6308, 0x946e,
-  0x946e, 0x6308, 0x1883, 0x946e, 0xffff, 0x42c3, 0x42c3, 0x42c3,
-  0x3222, 0x3222, 0x3222, 0xffff, 0xffff, 0x946e, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x946e, 0xffff, 0xffff, 0x3222, 0x3222, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffde, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffde, 0xffdf, 0xdefb, 0x62ca, 0x5248, 0x5248, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5248, 0x5248, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffde, 0xdefb, 0x62ca, 0x41c6, 0x41e6, 0x41e6, 0x41e6, 0x5268,
-  0x5268, 0x49e6, 0x41e6, 0x41e6, 0x41c6, 0x62ca, 0xdefb, 0xf7df,
-  0xef7d, 0x62ea, 0x41e6, 0x49e6, 0x49e6, 0x49e6, 0x49e6, 0x41e6,
-  0x41e6, 0x49e6, 0x49e6, 0x49e6, 0x49e6, 0x41e6, 0x62ca, 0xef5c,
-  0xe71c, 0x5268, 0x41a5, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x49e6,
-  0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x41a5, 0x5268, 0xe6fb,
-  0xa4f2, 0x4a27, 0x08a1, 0x0881, 0x0881, 0x0881, 0x10a1, 0x41e6,
-  0x41e6, 0x10a1, 0x0881, 0x0881, 0x0881, 0x08a1, 0x4a07, 0xa4f2,
-  0x9cb0, 0x5268, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x41e6,
-  0x41e6, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x5268, 0x9cb0,
-  0x948f, 0x9470, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x41e6, 0x18e3,
-  0x18e3, 0x41e6, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x9470, 0x948f,
-  0x9c8e, 0x9cae, 0x9490, 0x4a27, 0x41e6, 0x49e6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x49e6, 0x41e6, 0x4a27, 0x9490, 0x9caf, 0x9c8e,
-  0xb5eb, 0xb5cc, 0x9cf0, 0x5268, 0x4a27, 0x49e6, 0x41e6, 0x41c6,
-  0x41c6, 0x41e6, 0x49e6, 0x4a27, 0x5268, 0x9cd0, 0xb5cc, 0xb5eb,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5227, 0x5247,
-  0x5247, 0x5227, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x8c4f,
-  0x8c4f, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x3145,
-  0x3145, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b85, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3201, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3201, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffdf, 0xffdf, 0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffdf, 0xdf1b, 0x62ca, 0x39a5, 0x39a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41c5, 0x39a5, 0x39a5, 0x62ca, 0xdf1b, 0xf7df,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c5, 0x41e6,
-  0x41e6, 0x39c5, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ea, 0xef5c,
-  0xe71c, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe71b,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb0, 0x5247, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x39c6,
-  0x39c6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10c1, 0x4a47, 0x9cb0,
-  0x948f, 0x9470, 0x4a27, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x18e3,
-  0x18e3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x4a27, 0x946f, 0x948f,
-  0x9c8e, 0x9cae, 0x9490, 0x41e6, 0x39a5, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x39a5, 0x41e6, 0x9490, 0x9caf, 0x9c8e,
-  0xb5eb, 0xb5cc, 0x9cf0, 0x5268, 0x4a27, 0x4a06, 0x41e6, 0x41c6,
-  0x41c6, 0x41e6, 0x4a06, 0x4a27, 0x5268, 0x9cd0, 0xb5cc, 0xb5eb,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5227, 0x5247,
-  0x5247, 0x5227, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x8c4f,
-  0x8c4f, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x3145,
-  0x3145, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b85, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3221, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ca, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xdf1b, 0x62ca, 0x41e6, 0x41e6, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdf1b, 0x62ca, 0x41e6, 0x4a06, 0x4a06, 0x49e6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x62ea, 0x41c5, 0x41c6, 0x41c6, 0x4a06, 0x4a06,
-  0x49e6, 0x49e6, 0x5268, 0x49e6, 0x41e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x5248, 0x0881, 0x0881, 0x10a1, 0x39a5, 0x49e6,
-  0x4a06, 0x49e6, 0x49e6, 0x49e6, 0x4a06, 0x49e6, 0x41e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x5227, 0x41c6, 0x41c6, 0x39a5, 0x10c2, 0x41c6,
-  0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x49e6, 0x4a06, 0x4a06, 0x41c6, 0x49e6,
-  0x49e6, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x4a06, 0x4a06, 0x4a06,
-  0xb5ec, 0x9cce, 0x9490, 0x4a27, 0x49e6, 0x4a06, 0x49e6, 0x39a5,
-  0x39a6, 0x41c6, 0x10a1, 0x0881, 0x10a1, 0x39a5, 0x49e6, 0x4a06,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x41e6, 0x49e6, 0x41c6, 0x10a1,
-  0x18c3, 0x39a5, 0x41c6, 0x41c6, 0x39a5, 0x10c2, 0x41c6, 0x49e6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x4a06, 0x4a07, 0x4a06, 0x41c6, 0x49e6, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x49e6, 0x49e6, 0x5227, 0x5268, 0x9490,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x8c0e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x4a27, 0x5248, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3201, 0x4284, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ca, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xdf1b, 0x62ca, 0x41e6, 0x41e6, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdf1b, 0x62ca, 0x41e6, 0x4a06, 0x4a06, 0x49e6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x62ea, 0x41c5, 0x41c6, 0x41c6, 0x4a06, 0x4a06,
-  0x49e6, 0x49e6, 0x5268, 0x49e6, 0x41e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x5248, 0x0881, 0x0881, 0x10a1, 0x39a5, 0x49e6,
-  0x4a06, 0x49e6, 0x49e6, 0x49e6, 0x4a06, 0x49e6, 0x41e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x5227, 0x41c6, 0x41c6, 0x39a5, 0x10c2, 0x41c6,
-  0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x49e6, 0x4a06, 0x4a06, 0x41c6, 0x49e6,
-  0x49e6, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x4a06, 0x4a06, 0x4a06,
-  0xb5ec, 0x9cce, 0x9490, 0x4a27, 0x49e6, 0x4a06, 0x49e6, 0x39a5,
-  0x39a6, 0x41c6, 0x10a1, 0x0881, 0x10a1, 0x39a5, 0x49e6, 0x4a06,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x41e6, 0x49e6, 0x41c6, 0x10a1,
-  0x18c3, 0x39a5, 0x41c6, 0x41c6, 0x39a5, 0x10c2, 0x41c6, 0x49e6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x4a06, 0x4a07, 0x4a06, 0x41c6, 0x49e6, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x49e6, 0x49e6, 0x5227, 0x5268, 0x9490,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x8c0e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x4a27, 0x5248, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3201, 0x4284, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xad53, 0xf79d, 0xffde, 0xf7de, 0xf7de, 0xffde, 0xffde, 0xffde,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xf7de, 0xf7de, 0xf7de, 0xef5c, 0xef5c, 0xef5c,
-  0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de, 0xf7de,
-  0x948f, 0xad53, 0xf79d, 0xffde, 0xdefb, 0x62ea, 0x5248, 0x62ca,
-  0xdefb, 0xffde, 0xf7de, 0xffde, 0xffde, 0xffde, 0xf7de, 0xf7de,
-  0x946e, 0xad53, 0xf7bd, 0xe71b, 0x5aa9, 0x41a5, 0x39a5, 0x41e6,
-  0x62ca, 0xdefb, 0xf7de, 0xef5c, 0xef5c, 0xef5c, 0xf7de, 0xffde,
-  0xad32, 0xef5c, 0xdefb, 0x5a89, 0x10a1, 0x10c1, 0x1903, 0x41c6,
-  0x41e6, 0x62ca, 0xd699, 0x62ea, 0x5248, 0x62ca, 0xdefa, 0xef7c,
-  0xad53, 0xe73b, 0x5aaa, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903,
-  0x41a5, 0x49e6, 0x5268, 0x49e6, 0x49e6, 0x49e6, 0x5268, 0x5a68,
-  0xad53, 0xdefa, 0x4a27, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1,
-  0x41c6, 0x4a06, 0x49e6, 0x41c6, 0x41c6, 0x41c6, 0x49e6, 0x41e6,
-  0x9c8f, 0xa4f1, 0x4a07, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1,
-  0x41c6, 0x4a06, 0x41c5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x4a06,
-  0x9c8e, 0x9cb0, 0x5268, 0x41c5, 0x1102, 0x10e1, 0x10e1, 0x41c5,
-  0x4a06, 0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0xb5cc, 0x9cce, 0x9490, 0x4a27, 0x41a6, 0x41c6, 0x41c6, 0x39a5,
-  0x39a6, 0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x49e6, 0x4a06, 0x41e6, 0x10a1,
-  0x18c3, 0x3185, 0x10e2, 0x854b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x9509, 0x9509, 0x94ea, 0x948f, 0x5268, 0x49e6, 0x49e6, 0x39a5,
-  0x10a1, 0x39a5, 0x41c6, 0x1102, 0x10e1, 0x10e1, 0x39c5, 0x5227,
-  0x7466, 0x7466, 0x7466, 0x7c88, 0x8c6f, 0x5268, 0x41e6, 0x3984,
-  0x41c6, 0x41e6, 0x49e6, 0x41c6, 0x41c6, 0x49e7, 0x5a68, 0x9490,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x738a, 0x840e, 0x5268, 0x4a27,
-  0x5247, 0x5227, 0x5247, 0x5227, 0x5268, 0x8c6f, 0x948f, 0x946e,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x948f, 0x39a6, 0x8c4f, 0x9cb1,
-  0x9cb0, 0x9cb0, 0x9490, 0x9cb1, 0x9cd1, 0x5305, 0x4ae4, 0x4ae4,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xe73b, 0x6b4a, 0x8c4d, 0x948e,
-  0x948e, 0x946e, 0x736a, 0x9caf, 0xdefa, 0x42a4, 0x3201, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffdf, 0xffdf, 0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffdf, 0xdf1b, 0x62ca, 0x39a5, 0x39a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41c5, 0x39a5, 0x39a5, 0x62ca, 0xdf1b, 0xf7df,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c5, 0x41e6,
-  0x41e6, 0x39c5, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ea, 0xef5c,
-  0xe71c, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe71b,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb0, 0x5247, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x39c6,
-  0x39c6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10c1, 0x4a47, 0x9cb0,
-  0x948f, 0x9470, 0x4a27, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x18e3,
-  0x18e3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x4a27, 0x946f, 0x948f,
-  0x9c8e, 0x9cae, 0x9490, 0x41e6, 0x39a5, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x39a5, 0x41e6, 0x9490, 0x9caf, 0x9c8e,
-  0xb5eb, 0xb5cc, 0x9cf0, 0x5268, 0x4a27, 0x4a06, 0x41e6, 0x41c6,
-  0x41c6, 0x41e6, 0x4a06, 0x4a27, 0x5268, 0x9cd0, 0xb5cc, 0xb5eb,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5227, 0x5247,
-  0x5247, 0x5227, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x8c4f,
-  0x8c4f, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x3145,
-  0x3145, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b85, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3221, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffde, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffdf, 0xffdf, 0xe6fb, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffdf, 0xdf1b, 0x62ca, 0x39a5, 0x39a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41a5, 0x39a5, 0x39a5, 0x62ca, 0xdf1b, 0xf7df,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c5, 0x41e6,
-  0x41e6, 0x39c5, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ca, 0xef5c,
-  0xe71c, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe6fb,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb0, 0x5227, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x41a6,
-  0x39a6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10c1, 0x4a27, 0x9cb0,
-  0x9c8f, 0x9470, 0x4a27, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x20c3,
-  0x20c3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x4a27, 0x9470, 0x9c8f,
-  0x946e, 0x9c8e, 0x9490, 0x41e6, 0x39a5, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x39a5, 0x41e6, 0x9490, 0x9caf, 0x946e,
-  0x94e9, 0x94ea, 0x9cd0, 0x5268, 0x4a27, 0x49e6, 0x41e6, 0x41c6,
-  0x41c6, 0x41e6, 0x49e6, 0x4a27, 0x5268, 0x9cd0, 0x94ea, 0x94e9,
-  0x7466, 0x7466, 0x7c67, 0x94b0, 0x946f, 0x5268, 0x4a27, 0x5247,
-  0x5247, 0x4a27, 0x5268, 0x946f, 0x94b0, 0x7c68, 0x7466, 0x7466,
-  0x5344, 0x5344, 0x5b65, 0x8c4d, 0x738b, 0x8c4f, 0x9490, 0x9490,
-  0x9490, 0x9490, 0x8c4f, 0x738b, 0x8c4d, 0x5b65, 0x5344, 0x5344,
-  0x42c3, 0x42a3, 0x4ae4, 0x948e, 0x840d, 0x39a6, 0x6b29, 0x6b4a,
-  0x6b4a, 0x6b29, 0x39a6, 0x840d, 0x948e, 0x4ae4, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xded9, 0x9c8f, 0x62e8, 0x8c2d, 0x8c4d,
-  0x8c4d, 0x8c2d, 0x62e8, 0x948f, 0xded9, 0x42a4, 0x3221, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffde, 0xffdf, 0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffde, 0xdf1b, 0x62ca, 0x41a5, 0x41a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41c5, 0x41a5, 0x39a5, 0x62ca, 0xdf1b, 0xffdf,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x49e6,
-  0x41e6, 0x41c6, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ea, 0xef5c,
-  0xe71b, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe6fb,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb1, 0x5248, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x41c6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10c1, 0x5247, 0x9cb0,
-  0x948f, 0x9470, 0x4a27, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x18e3,
-  0x18e3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x4a27, 0x946f, 0x948f,
-  0x948e, 0x9cae, 0x9490, 0x41e7, 0x39a5, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x39a5, 0x49e6, 0x9490, 0x9caf, 0x948e,
-  0xb5eb, 0xb5cc, 0x9cf0, 0x5a68, 0x5227, 0x4a06, 0x49e6, 0x49e6,
-  0x49e6, 0x49e6, 0x4a06, 0x5227, 0x5a68, 0x9cd0, 0xb5cc, 0xb5eb,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5248, 0x82ce,
-  0x8ace, 0x5248, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x9470,
-  0x9470, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x2925,
-  0x2925, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b85, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3201, 0x3222,
-  0xffdf, 0xffdf, 0xffff, 0xef7d, 0xef5d, 0xe75c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffdf, 0xffdf, 0xffdf,
-  0xffde, 0xf7df, 0xdf1b, 0x62ea, 0x5268, 0x5268, 0x62ea, 0xdefb,
-  0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ea, 0xdefb, 0xf7df, 0xffdf,
-  0xffde, 0xdf1b, 0x62ca, 0x39a5, 0x39a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41c5, 0x39a5, 0x39a5, 0x62ca, 0xdf1b, 0xf7df,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c5, 0x41e6,
-  0x41e6, 0x39c5, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ea, 0xef5c,
-  0xe71b, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe6fb,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb0, 0x5247, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x39c6,
-  0x39c6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x4a47, 0x9cb0,
-  0x9c8f, 0x9490, 0x4206, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x18e3,
-  0x18e3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x41e6, 0x9490, 0x9c8f,
-  0x9cae, 0x9cb0, 0x5268, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x41c6, 0x41c6, 0x5268, 0x9cb0, 0x9cae,
-  0xb5ec, 0x9cce, 0x9490, 0x4a27, 0x41e6, 0x4a06, 0x4a06, 0x5248,
-  0x5248, 0x4a06, 0x4a06, 0x41e6, 0x4a27, 0x9470, 0x9cce, 0xb5ec,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x4a27, 0x41e6, 0x5248, 0xd69a,
-  0xd69a, 0x5248, 0x41e6, 0x4a27, 0x5268, 0x9cd0, 0xb5cc, 0xbe0b,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5248, 0x9350,
-  0x9350, 0x5248, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x9450,
-  0x9450, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62c8, 0x2904, 0x2904, 0x2925,
-  0x2925, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b65, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x630a, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3201, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3201, 0x3222,
-  0xffdf, 0xffdf, 0xffff, 0xef7d, 0xef5d, 0xe75c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffdf, 0xffdf, 0xffdf,
-  0xf7de, 0xf7df, 0xdf1b, 0x62ea, 0x5268, 0x5268, 0x62ea, 0xdefb,
-  0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ea, 0xdefb, 0xffdf, 0xffdf,
-  0xf7de, 0xdf1b, 0x62ca, 0x41e6, 0x41e6, 0x41e6, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41e6, 0x41e6, 0x41e6, 0x62ca, 0xdefb, 0xf7df,
-  0xef7d, 0x62ea, 0x41e6, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x41e6,
-  0x41e6, 0x4a06, 0x4a06, 0x4a06, 0x4a06, 0x41e6, 0x62ea, 0xef5c,
-  0xe71b, 0x5268, 0x41e6, 0x41c6, 0x41c6, 0x41c6, 0x4a06, 0x4a06,
-  0x4a06, 0x4a06, 0x41c6, 0x41c6, 0x41c6, 0x41e6, 0x5268, 0xe71b,
-  0xa4f2, 0x5247, 0x39a5, 0x10a1, 0x0881, 0x10a1, 0x39a5, 0x4a06,
-  0x4a06, 0x39a5, 0x10a1, 0x0881, 0x10a1, 0x39a5, 0x5247, 0xa4f2,
-  0x9cb0, 0x5248, 0x10c2, 0x39a5, 0x41c6, 0x39a5, 0x10c2, 0x41c6,
-  0x41c6, 0x10c2, 0x39a5, 0x41c6, 0x39a5, 0x10c1, 0x5247, 0x9cb0,
-  0x948f, 0x9490, 0x4a07, 0x41e6, 0x4a06, 0x4a06, 0x39c6, 0x18e3,
-  0x18e3, 0x39c5, 0x4a06, 0x4a06, 0x41e6, 0x4a06, 0x9470, 0x948f,
-  0x9cae, 0x9cb0, 0x5268, 0x41e6, 0x49e6, 0x4a06, 0x41e6, 0x0881,
-  0x0881, 0x41e6, 0x4a06, 0x49e6, 0x41e6, 0x5268, 0x9cb0, 0x9cae,
-  0xb5ec, 0x9cce, 0x9490, 0x4a27, 0x41e6, 0x49e6, 0x4a06, 0x5248,
-  0x5248, 0x4a06, 0x49e6, 0x41e6, 0x4a27, 0x9470, 0x9cce, 0xb5ec,
-  0xbe0b, 0xb5cc, 0x9cf0, 0x5268, 0x4a27, 0x41e6, 0x5248, 0xd69a,
-  0xd69a, 0x5248, 0x41e6, 0x4a27, 0x5268, 0x9cd0, 0xb5cc, 0xbe0b,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5248, 0x9350,
-  0x9350, 0x5248, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x9450,
-  0x9450, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5344, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x2925,
-  0x2925, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b65, 0x5344, 0x5344,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3201, 0x3222,
-  0xffdf, 0xffdf, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf,
-  0xffdf, 0xffff, 0xffff, 0xffff, 0xffff, 0xffdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7d, 0xffdf,
-  0xffdf, 0xef7d, 0xef5d, 0xef5c, 0xef7c, 0xffde, 0xffde, 0xffdf,
-  0xffde, 0xffdf, 0xe71b, 0x62ea, 0x5268, 0x5268, 0x62ca, 0xdefb,
-  0xe71b, 0x62ca, 0x5268, 0x5268, 0x62ca, 0xdefb, 0xffdf, 0xffdf,
-  0xffde, 0xdf1b, 0x62ca, 0x41a5, 0x41a5, 0x39a5, 0x49e6, 0x5268,
-  0x5268, 0x49e6, 0x41c5, 0x41a5, 0x39a5, 0x62ca, 0xdf1b, 0xffdf,
-  0xef7d, 0x62ea, 0x39a5, 0x10c1, 0x10c1, 0x1903, 0x41c6, 0x49e6,
-  0x41e6, 0x41c6, 0x10c1, 0x10c1, 0x1903, 0x39a5, 0x62ea, 0xef5c,
-  0xe71b, 0x5248, 0x10a1, 0x5367, 0x63c9, 0xb5f5, 0x1923, 0x41c6,
-  0x41c6, 0x10c1, 0x5367, 0x63c9, 0xb5f5, 0x1903, 0x4a27, 0xe6fb,
-  0xa4f2, 0x4a07, 0x08c1, 0x7489, 0x29e3, 0x63e9, 0x10c1, 0x41c6,
-  0x41c6, 0x10c1, 0x7489, 0x29e3, 0x63e9, 0x08c1, 0x4a07, 0xa4f2,
-  0x9cb1, 0x5248, 0x10e1, 0x852b, 0x854b, 0x6c68, 0x10e1, 0x41c6,
-  0x41c6, 0x10e2, 0x852b, 0x854b, 0x6c68, 0x10c1, 0x5247, 0x9cb0,
-  0x948f, 0x9470, 0x4a27, 0x10e2, 0x10e1, 0x10e1, 0x39a5, 0x18e3,
-  0x18e3, 0x39a5, 0x1902, 0x10e1, 0x10e1, 0x4a27, 0x946f, 0x948f,
-  0x948e, 0x9cae, 0x9490, 0x41e7, 0x39a5, 0x41c6, 0x41c6, 0x0881,
-  0x0881, 0x41c6, 0x41c6, 0x39a5, 0x49e6, 0x9490, 0x9caf, 0x948e,
-  0xb5eb, 0xb5cc, 0x9cf0, 0x5a68, 0x5227, 0x4a06, 0x49e6, 0x49e6,
-  0x49e6, 0x49e6, 0x4a06, 0x5227, 0x5a68, 0x9cd0, 0xb5cc, 0xb5eb,
-  0x9509, 0x9509, 0x94ea, 0x94af, 0x8c2f, 0x5268, 0x5248, 0x82ce,
-  0x8ace, 0x5248, 0x5268, 0x8c2f, 0x94af, 0x94ea, 0x9509, 0x9509,
-  0x7466, 0x7466, 0x7c66, 0x7427, 0x39a6, 0x840f, 0x9470, 0x9470,
-  0x9470, 0x9470, 0x8c0f, 0x39a6, 0x7427, 0x7c66, 0x7466, 0x7466,
-  0x5364, 0x5344, 0x5b65, 0x8c6d, 0x62e8, 0x2904, 0x2904, 0x2925,
-  0x2925, 0x2904, 0x2904, 0x62c8, 0x8c6d, 0x5b85, 0x5344, 0x5364,
-  0x42c3, 0x42a3, 0x5325, 0xdefa, 0x9c8f, 0x3145, 0x6309, 0x8c4e,
-  0x8c4e, 0x6309, 0x3145, 0x948f, 0xdefa, 0x5325, 0x42a3, 0x42c3,
-  0x3222, 0x3221, 0x42a4, 0xef7c, 0xef5c, 0x9c8f, 0xe71b, 0xf79d,
-  0xf79d, 0xe73b, 0x9c8f, 0xef5c, 0xef7c, 0x42a4, 0x3201, 0x3222
-};
-
-const Animation lemurAnimation = {
-  .name = "Lemur",
-  .frameCount = 19,
-  .width = 16,
-  .height = 16,
-  .frameDurations = lemurDurations,
-  .animationFrames = lemurFrames
-};
-#endif // ANIMATION_LEMUR_H
@@ -1,1462 +0,0 @@
-// licking_lips.h - Auto-generated from licking_lips.json
-#ifndef ANIMATION_LICKING_LIPS_H
-#define ANIMATION_LICKING_LIPS_H
-
-#include "animation_types.h"
-
-// Frame Durations for licking_lips (in 100ms units)
-static const uint8_t PROGMEM licking_lipsDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for licking_lips
-static const uint16_t PROGMEM licking_lipsFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x9105, 0x9105, 0x9105, 0x2801,
-  0x2801, 0x9105, 0x9105, 0x9105, 0x2801, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x9105, 0x9105, 0x9105, 0x9105, 0x9105,
-  0x9105, 0x9105, 0x9105, 0x9105, 0x9105, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x2801, 0x9105, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3,
-  0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x9105, 0x2801, 0x0000,
-  0x2801, 0x9105, 0x80a3, 0x2801, 0x52aa, 0x8430, 0xdefb, 0xffff,
-  0xdefb, 0xdefb, 0x8430, 0x52aa, 0x2801, 0x80a3, 0x9105, 0x2801,
-  0x80a3, 0x80a3, 0x2801, 0x2801, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2801, 0x2801, 0x80a3, 0x80a3,
-  0x80a3, 0x80a3, 0x2801, 0x2801, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2801, 0x2801, 0x80a3, 0x80a3,
-  0x2801, 0x80a3, 0x80a3, 0x2801, 0x52aa, 0x8430, 0xce79, 0xe73c,
-  0xce79, 0xce79, 0x8430, 0x52aa, 0x2801, 0x80a3, 0x80a3, 0x0000,
-  0x0000, 0x2801, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3,
-  0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x80a3, 0x2801, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x80a3, 0x9a08, 0xc3f0, 0xb34d,
-  0x9a08, 0x9105, 0x9105, 0x80a3, 0x2801, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2801, 0x80a3, 0x80a3, 0x2801,
-  0x2801, 0x80a3, 0x80a3, 0x2801, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x78c4, 0x7083, 0x3842, 0x4a28, 0x7b8e, 0xbd96, 0xd679,
-  0xc5d7, 0xbd96, 0x7b8e, 0x4a28, 0x3842, 0x7083, 0x80c4, 0x3021,
-  0x3801, 0x7083, 0x4021, 0x2801, 0x1061, 0x10c3, 0x2124, 0x2945,
-  0x2124, 0x2124, 0x10c3, 0x0861, 0x0800, 0x3821, 0x7083, 0x3801,
-  0x3001, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b6e, 0xad34, 0xc5d7,
-  0xb555, 0xad14, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x88e5, 0x90e5, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x88a4, 0x88e4, 0x80c4, 0x88c4,
-  0x88a4, 0x8926, 0x8105, 0x78a3, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x78a3, 0x4021, 0xa867, 0xca6b, 0xb9cb, 0xb96a,
-  0xc0c9, 0xcd56, 0xa4f4, 0x1882, 0x3001, 0x78a4, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x3821, 0x38a3, 0xa046, 0xb026, 0xa826,
-  0xb026, 0xb0e8, 0x836e, 0x2904, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78a3, 0x80a4, 0x88c5, 0x88c5,
-  0x80a4, 0x8084, 0x80e4, 0x78a4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3021, 0x7883, 0x99c8, 0xb32d, 0xa2cb,
-  0x91c7, 0x8905, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x7083, 0x70a3, 0x80e4, 0x88c4,
-  0x88c4, 0x80a4, 0x78c4, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x78a4, 0x3021, 0x0800, 0x2041, 0xba6b, 0xc1cb,
-  0xb96a, 0xb888, 0x61e9, 0x20e3, 0x3821, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x3821, 0x28a3, 0xa046, 0xb046, 0xa826,
-  0xa826, 0xb006, 0x9846, 0x28a3, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78a3, 0x88c4, 0x88c5, 0x88c5,
-  0x80a4, 0x80a4, 0x8084, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3021, 0x7883, 0x99c8, 0xb32d, 0xa2cb,
-  0x91c7, 0x8905, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0800, 0x3021, 0x80c4, 0x78a4, 0x7083, 0x7083, 0x8084, 0x80a4,
-  0x80a4, 0x8084, 0x8084, 0x7083, 0x78a3, 0x80c4, 0x3821, 0x2801,
-  0x2801, 0x78c4, 0x80a4, 0x4021, 0x1000, 0x1801, 0x9805, 0xa805,
-  0xa806, 0xa806, 0x9805, 0x1801, 0x1820, 0x78a3, 0x78c4, 0x3001,
-  0x0800, 0x3021, 0x7083, 0x7083, 0x7083, 0x78a4, 0x88e5, 0x88c5,
-  0x88a4, 0x80a4, 0x80a4, 0x7083, 0x7083, 0x7083, 0x3021, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3021, 0x78a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91c7, 0x8905, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x88a4, 0x88e4,
-  0x88c4, 0x80c4, 0x80a4, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x78a4, 0x3001, 0x2924, 0xacb3, 0xc16a, 0xc24b,
-  0xb9cb, 0xc16b, 0xb067, 0x38a3, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x3821, 0x2924, 0xad14, 0xc4f4, 0xb0a8,
-  0xa826, 0xb026, 0xb006, 0x9825, 0x4021, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78a4, 0x8125, 0x8966, 0x88c5,
-  0x80a4, 0x8084, 0x80a4, 0x8084, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3021, 0x7883, 0x99c8, 0xb32d, 0xa2cb,
-  0x91c7, 0x8905, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0800, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x2821, 0x80c4, 0x78a3, 0x1000, 0x20e3, 0x736d, 0xbdb6, 0xd679,
-  0xc5d7, 0xbd96, 0x736d, 0x20e3, 0x3821, 0x78a3, 0x80c4, 0x3021,
-  0x1000, 0x7083, 0x7883, 0x1000, 0x0820, 0x1061, 0x2124, 0x2965,
-  0x2124, 0x2124, 0x10a2, 0x0020, 0x2801, 0x7883, 0x78a3, 0x3001,
-  0x2001, 0x3021, 0x7083, 0x7883, 0x7083, 0x68c4, 0xbd55, 0xd679,
-  0xb575, 0xad34, 0x736d, 0x20e3, 0x1820, 0x7883, 0x7083, 0x0800,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x80a3, 0x80c4, 0x8967, 0x9187,
-  0x8946, 0x8926, 0x80e5, 0x78a4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b6e, 0xcdb7, 0xe69a,
-  0xd679, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6883, 0x70c4, 0x78e4, 0x8167,
-  0xc596, 0xc5f7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0800, 0x2801, 0x3821, 0x7083, 0x80a3, 0x80a4, 0x80c4, 0x80c4,
-  0x8925, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b6e, 0xcdb7, 0xe69a,
-  0xd679, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6883, 0x70c4, 0x78e4, 0x8167,
-  0xc596, 0xc5f7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x0800, 0x3001, 0x7083, 0x80a3, 0x80a4, 0x80c4, 0x80c4,
-  0x8925, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b6e, 0xcdb7, 0xe69a,
-  0xd679, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6883, 0x70c4, 0x78e4, 0x8167,
-  0xc596, 0xc5f7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x0800, 0x3001, 0x7083, 0x80a3, 0x80a4, 0x80c4, 0x80c4,
-  0x8925, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b6e, 0xcdb7, 0xe69a,
-  0xd679, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6883, 0x70c4, 0x78e4, 0x8167,
-  0xc596, 0xc5f7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x0800, 0x3001, 0x7083, 0x80a3, 0x80a4, 0x80c4, 0x80c4,
-  0x8925, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b6e, 0xcdb7, 0xe69a,
-  0xd679, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6883, 0x70c4, 0x78e4, 0x8167,
-  0xc596, 0xc5f7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x0800, 0x3001, 0x7083, 0x80a3, 0x80a4, 0x80c4, 0x80c4,
-  0x8925, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2cb,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78a4, 0x80e5, 0x8925, 0x8946,
-  0x8926, 0x8925, 0x80e5, 0x78a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x80c4, 0x80a4, 0x3821, 0x28e3, 0x7b8e, 0xd659, 0xef5d,
-  0xd69a, 0xce38, 0x83cf, 0x28e4, 0x3021, 0x78a3, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x7883, 0x7883, 0x6863, 0x7925, 0xcdf8, 0xef3c,
-  0xce18, 0xc5d7, 0x83cf, 0x28e4, 0x3821, 0x7883, 0x7083, 0x3001,
-  0x0000, 0x0800, 0x3001, 0x7083, 0x80a3, 0x80c4, 0x8946, 0x8966,
-  0x8926, 0x8105, 0x80e5, 0x78a3, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7883, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xc5f7, 0xbd96, 0x8baf, 0x5a29, 0x3842, 0x7083, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1082,
-  0x1082, 0x2883, 0xb888, 0xb847, 0x4002, 0x3801, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1082,
-  0x1882, 0xa8a8, 0xc088, 0xc0a9, 0xa826, 0x4021, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb534, 0xc5d7,
-  0xb575, 0xbd35, 0x8bf0, 0x94d4, 0x7085, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8125, 0x8105, 0x8105, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3001, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8926, 0x88a4, 0x80a4, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xc5f7, 0xcd56, 0xc8a9, 0xb827, 0x5022, 0x78a3, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1082,
-  0x2883, 0xb8a8, 0xc828, 0xc828, 0xb027, 0x4022, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1882,
-  0xa8a8, 0xc0a9, 0x9867, 0xb868, 0xb827, 0x4022, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb534, 0xc5d7,
-  0xc576, 0xbd35, 0x838e, 0x6229, 0x7044, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x78e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8966,
-  0x8926, 0x88a4, 0xc047, 0xc047, 0x88a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xd576, 0xc0a9, 0xc027, 0xc828, 0xb847, 0x80a4, 0x78c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1082, 0x30a3,
-  0xb8a9, 0xc027, 0xa006, 0xc827, 0xc027, 0x4022, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xa8c8,
-  0xc0a9, 0xa0a7, 0xb888, 0xc068, 0xb027, 0x4022, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x6229, 0x7044, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x88e5, 0x80c5, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88e4,
-  0x88e5, 0x98e5, 0xc067, 0xc047, 0x88c5, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x88a4, 0xc047, 0xc027, 0xc828, 0xc067, 0x88c5, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xc5d7, 0xe619,
-  0xc8c9, 0xc007, 0xa006, 0xc027, 0xc047, 0x80a4, 0x78c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb8c9,
-  0xc828, 0xa005, 0xc027, 0xc828, 0xb827, 0x4022, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb8c9,
-  0xc8c9, 0xa0a7, 0xc088, 0xc068, 0xb027, 0x4022, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x6229, 0x7044, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x80c5, 0x88e5, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88e5,
-  0x90e5, 0xc047, 0xc047, 0x98e6, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8926, 0x88a4,
-  0xc047, 0xc027, 0xc828, 0xc047, 0x80a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7bae, 0xcd36, 0xc0c9,
-  0xc027, 0xa006, 0xc027, 0xb827, 0x4022, 0x70a3, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0020, 0x1041, 0xb8a8, 0xc827,
-  0xa005, 0xc027, 0xc828, 0xb827, 0x3801, 0x3001, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0020, 0x1061, 0xb8a8, 0xc8c9,
-  0xa0a7, 0xc0c9, 0xc089, 0xb067, 0x3801, 0x3801, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xbd35, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x5a29, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8905, 0x78e4, 0x3821,
-  0x3801, 0x80c5, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x8905, 0x90e5,
-  0xb847, 0xc047, 0x98e6, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x80e5, 0x88a4, 0xc047,
-  0xc827, 0xc828, 0xc047, 0x80c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5229, 0x8b2d, 0xc088, 0xc027,
-  0xa006, 0xc027, 0xc068, 0x59e8, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2800, 0x1021, 0xb068, 0xc827, 0xa005,
-  0xc027, 0xc828, 0xb827, 0x1821, 0x2800, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2800, 0x1021, 0xb088, 0xc8c9, 0xa0a8,
-  0xc0c9, 0xc8c9, 0xb088, 0x1821, 0x2800, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x8b8e, 0xbd35, 0xd5d8,
-  0xc576, 0xbd35, 0x8b8f, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3801,
-  0x3801, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x98e5, 0xb847,
-  0xb847, 0x98e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x88a4, 0xc047, 0xc027,
-  0xc828, 0xc047, 0x88e5, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x61e8, 0xb868, 0xc027, 0xa006,
-  0xc027, 0xc068, 0x7b2d, 0x5249, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3801, 0x3801, 0xb067, 0xc827, 0xa005, 0xc027,
-  0xc827, 0xb827, 0x1041, 0x0020, 0x2801, 0x3021, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3801, 0x3801, 0xb067, 0xc088, 0xa0a7, 0xc8e9,
-  0xc8c9, 0xb8c9, 0x1861, 0x0020, 0x2001, 0x1800, 0x7083, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5a29, 0x8b8e, 0xbd35, 0xd5f8,
-  0xc576, 0xbd35, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x80c5, 0x3801,
-  0x3821, 0x78e4, 0x8905, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x98e6, 0xc047, 0xb847,
-  0x90e5, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a3, 0x8884, 0xc047, 0xc027, 0xc828,
-  0xc067, 0x9126, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x78a3, 0x5022, 0xb847, 0xc027, 0xa006, 0xc027,
-  0xc8a9, 0xbd35, 0x7bae, 0x5228, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x7883, 0x4022, 0xb027, 0xc827, 0xa005, 0xc027, 0xc827,
-  0xb827, 0x1882, 0x0841, 0x0820, 0x2001, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x4022, 0xb027, 0xb868, 0x9866, 0xc0c9, 0xd0ea,
-  0xb8c9, 0x1882, 0x0841, 0x0020, 0x0800, 0x3001, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7883, 0x7044, 0x6229, 0x838e, 0xbd35, 0xd5f8,
-  0xc576, 0xb534, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7883, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x88e5, 0x80c5, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x98e6, 0xc047, 0xc047, 0x90e5,
-  0x88e5, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x88a4, 0xc047, 0xc828, 0xc027, 0xc047,
-  0x88a4, 0x8925, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x78c4, 0x80a4, 0xb847, 0xc828, 0xc027, 0xa006, 0xc027,
-  0xc0c9, 0xc597, 0x7baf, 0x5228, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x7883, 0x4022, 0xb827, 0xc828, 0xc828, 0xc027, 0xa005,
-  0xc0a9, 0x9576, 0x10e3, 0x0020, 0x2801, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x4022, 0xb027, 0xc068, 0xc089, 0xc0c9, 0xa0a7,
-  0xc14b, 0x9576, 0x10e3, 0x0020, 0x2801, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7883, 0x7044, 0x6229, 0x8b8e, 0xbd35, 0xd5d8,
-  0xc576, 0xbd96, 0x7bae, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7883, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8905, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x80e4, 0x88e5, 0x80c5, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x90e5, 0xc067, 0xc047, 0x90e5,
-  0x88e5, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x8884, 0xc047, 0xc028, 0xc047,
-  0x88a4, 0x8926, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x70a3, 0x4022, 0xb847, 0xc028, 0xa006, 0xc027,
-  0xc0a9, 0xcd35, 0x7bae, 0x5228, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3801, 0x3801, 0xb827, 0xc828, 0xc027, 0xa005,
-  0xc827, 0xb8a8, 0x1841, 0x0020, 0x2801, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3801, 0x3801, 0xb067, 0xc089, 0xc0c9, 0xa0a8,
-  0xc8c9, 0xb8a8, 0x1861, 0x0020, 0x2801, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7883, 0x6844, 0x6229, 0x8b8e, 0xbd35, 0xd5d8,
-  0xc576, 0xbd35, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7883, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8905, 0x80c5, 0x3801,
-  0x3821, 0x78e4, 0x8905, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0xc047, 0xb847,
-  0x90e5, 0x8905, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x88a4, 0xc047, 0xc828,
-  0xc047, 0x88a4, 0x80e5, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x51e8, 0xb868, 0xc027, 0xa006,
-  0xc027, 0xc088, 0x8b2d, 0x5249, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2800, 0x1021, 0xb827, 0xc828, 0xc027,
-  0xa005, 0xc827, 0xb068, 0x1021, 0x2800, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2800, 0x1021, 0xb088, 0xc8c9, 0xc8e9,
-  0xa0a7, 0xc8c9, 0xb088, 0x1821, 0x2800, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x8b8e, 0xbd35, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3801,
-  0x3801, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x90e5, 0xb847,
-  0xb847, 0x98e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x80e5, 0x88a4, 0xc047,
-  0xc828, 0xc047, 0x88a4, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5229, 0x7b2d, 0xb888, 0xc027,
-  0xa006, 0xc027, 0xb868, 0x61e8, 0x3842, 0x7083, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0020, 0x1041, 0xb827, 0xc827,
-  0xc027, 0xa005, 0xc827, 0xb867, 0x3801, 0x3001, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0020, 0x1061, 0xb8c9, 0xd0ea,
-  0xc0c9, 0xa087, 0xc088, 0xb067, 0x3801, 0x3801, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xbd35, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x5a29, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3801, 0x80c5, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88e5,
-  0xb847, 0xc047, 0x98e6, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8926, 0x88a4,
-  0xc047, 0xc028, 0xc047, 0x8884, 0x78a3, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7bae, 0xbd35, 0xc0c9,
-  0xc027, 0xa006, 0xc027, 0xb827, 0x5022, 0x78a3, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb827,
-  0xc827, 0xc027, 0xa005, 0xc827, 0xb027, 0x4022, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb8c9,
-  0xc8c9, 0xc0c9, 0x9866, 0xb868, 0xb827, 0x4022, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x838e, 0x6229, 0x7044, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88e4,
-  0x88e5, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x9146,
-  0xc067, 0xc047, 0x88a4, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xc5d7, 0xe619,
-  0xc8c9, 0xc007, 0xb868, 0x61e8, 0x3842, 0x7083, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb8c9,
-  0xc828, 0xa006, 0xc027, 0xb867, 0x4002, 0x3801, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xb8c9,
-  0xc8c9, 0xc0c9, 0x9867, 0xb868, 0xa826, 0x4022, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x838e, 0x6229, 0x7844, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88e4,
-  0x88e5, 0x9105, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x88a4, 0x80a4, 0x80e5, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdd7, 0xd619,
-  0xc0c9, 0xc068, 0x8b2d, 0x4a49, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1082, 0x3083,
-  0xb827, 0xc827, 0xb068, 0x2842, 0x2801, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xa8c8,
-  0xc0c9, 0xa0a7, 0xc088, 0xa867, 0x3801, 0x3801, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x6229, 0x6844, 0x7883, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7883, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xd5f8, 0xcdb7, 0x7bae, 0x5228, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x1082, 0x30a3,
-  0xc0c9, 0xc0a9, 0x2862, 0x0820, 0x2801, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x1882, 0xa8c8,
-  0xc8a9, 0xc8a9, 0xa087, 0x1021, 0x2801, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb535, 0xd5f8,
-  0xc576, 0xbd35, 0x8b8f, 0x5229, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8966,
-  0x8946, 0x8125, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e5, 0x80e4, 0x3821,
-  0x3821, 0x80e4, 0x80e5, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x78e4, 0x9105, 0x9105, 0x88e4,
-  0x88e4, 0x9105, 0x9105, 0x80e4, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78c4, 0x8105, 0x8946,
-  0x8926, 0x8105, 0x78c4, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x6863, 0x4042, 0x5a29, 0x83ae, 0xcdd7,
-  0xbd55, 0x83ae, 0x5a29, 0x4042, 0x6863, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78c4, 0x8105, 0x8967,
-  0x8946, 0x8105, 0x78c4, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x7083, 0x80a4, 0x99c8, 0xb30d,
-  0x99c8, 0x88e5, 0x80a3, 0x7083, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4,
-  0x78a4, 0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e5, 0x80e4, 0x3821,
-  0x3821, 0x80e4, 0x80e5, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x78e4, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x78e4, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78a3, 0x80a4, 0x78a3, 0x78a3,
-  0x78a3, 0x78a3, 0x80a4, 0x78a3, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x7083, 0x80a3, 0x78a3, 0x6062, 0x4041,
-  0x4042, 0x6082, 0x78a3, 0x80a3, 0x7083, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x7883, 0x80a3, 0x80c4, 0x80e4,
-  0x78c4, 0x78a3, 0x80a3, 0x7883, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x7083, 0x80a4, 0x99c8, 0xb32d,
-  0x99e8, 0x9105, 0x80a4, 0x7083, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4,
-  0x78a4, 0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e5, 0x80e4, 0x3821,
-  0x3821, 0x80e4, 0x80e5, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x78e4, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x78e4, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78a3, 0x80a4, 0x78a3, 0x78a3,
-  0x78a3, 0x78a3, 0x80a4, 0x78a3, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x7083, 0x80a3, 0x78a3, 0x6062, 0x4041,
-  0x4042, 0x6082, 0x78a3, 0x80a3, 0x7083, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x7883, 0x80a3, 0x80c4, 0x80e4,
-  0x78c4, 0x78a3, 0x80a3, 0x7883, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x7083, 0x80a4, 0x99c8, 0xb32d,
-  0x99e8, 0x9105, 0x80a4, 0x7083, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4,
-  0x78a4, 0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e5, 0x80e4, 0x3821,
-  0x3821, 0x80e4, 0x80e5, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x78e4, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x78e4, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78a3, 0x80a4, 0x78a3, 0x78a3,
-  0x78a3, 0x78a3, 0x80a4, 0x78a3, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x7083, 0x80a3, 0x78a3, 0x6062, 0x4041,
-  0x4042, 0x6082, 0x78a3, 0x80a3, 0x7083, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x7883, 0x80a3, 0x80c4, 0x80e4,
-  0x78c4, 0x78a3, 0x80a3, 0x7883, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x7083, 0x80a4, 0x99c8, 0xb32d,
-  0x99e8, 0x9105, 0x80a4, 0x7083, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4,
-  0x78a4, 0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x78c4, 0x3821,
-  0x3821, 0x78c4, 0x3821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e4, 0x8905, 0x80e4,
-  0x80e4, 0x8905, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x7083, 0x80a4, 0x6083, 0x4882,
-  0x4862, 0x6083, 0x80a4, 0x7083, 0x2801, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x8905, 0x91a7,
-  0x8905, 0x88e5, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4,
-  0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3021, 0x80e5, 0x80e4, 0x3821,
-  0x3821, 0x80e4, 0x80e5, 0x3021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x78e4, 0x9105, 0x9105, 0x88e5,
-  0x88e5, 0x9105, 0x9105, 0x78e4, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78a3, 0x80a4, 0x78a3, 0x78a3,
-  0x78a3, 0x78a3, 0x80a4, 0x78a3, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2801, 0x7083, 0x80a3, 0x78a3, 0x6062, 0x4041,
-  0x4042, 0x6082, 0x78a3, 0x80a3, 0x7083, 0x2801, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x7883, 0x80a3, 0x80c4, 0x80e4,
-  0x78c4, 0x78a3, 0x80a3, 0x7883, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x7083, 0x80a4, 0x99c8, 0xb32d,
-  0x99e8, 0x9105, 0x80a4, 0x7083, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4,
-  0x78a4, 0x78a3, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xc5f7, 0xbd96, 0x7bae, 0x5228, 0x3842, 0x7883, 0x78c4, 0x1020,
-  0x7883, 0x7083, 0x3021, 0x2001, 0x0821, 0x0861, 0x1082, 0x10a2,
-  0x10a2, 0x1082, 0x0861, 0x0821, 0x2001, 0x3021, 0x7083, 0x7883,
-  0x7083, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x7083,
-  0x7083, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x7883,
-  0x7883, 0x7083, 0x3021, 0x2001, 0x0821, 0x0861, 0x1082, 0x10a2,
-  0x1082, 0x1082, 0x0861, 0x0821, 0x2001, 0x3021, 0x7083, 0x7083,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb534, 0xc5d7,
-  0xb575, 0xad34, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xc5f7, 0xbd96, 0x7bae, 0x5228, 0x3842, 0x7883, 0x78c4, 0x1020,
-  0x7883, 0x7083, 0x3021, 0x2001, 0x0821, 0x0861, 0x1082, 0x10a2,
-  0x10a2, 0x1082, 0x0861, 0x0821, 0x2001, 0x3021, 0x7083, 0x7883,
-  0x7883, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1820, 0x7883,
-  0x7883, 0x7083, 0x3021, 0x2001, 0x0821, 0x0861, 0x1082, 0x10a2,
-  0x1082, 0x1082, 0x0861, 0x0821, 0x2001, 0x3021, 0x7083, 0x7083,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb534, 0xc5d7,
-  0xb575, 0xad34, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3821, 0x80c4, 0x7883, 0x3842, 0x5228, 0x7b8e, 0xbdb6, 0xde9a,
-  0xc5f7, 0xbd96, 0x7bae, 0x5228, 0x3842, 0x7883, 0x80c4, 0x3821,
-  0x7883, 0x78a3, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1082,
-  0x1082, 0x0882, 0x0841, 0x0820, 0x2801, 0x3821, 0x78a3, 0x7883,
-  0x7883, 0x7883, 0x3821, 0x2801, 0x0820, 0x0841, 0x0882, 0x1082,
-  0x0882, 0x0881, 0x0841, 0x0820, 0x2801, 0x3821, 0x7883, 0x7883,
-  0x3821, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b8e, 0xb534, 0xc5d7,
-  0xb575, 0xad34, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x1000,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x3021, 0x78e4, 0x8105, 0x78e4, 0x3821,
-  0x3821, 0x78e4, 0x8105, 0x80e4, 0x3021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x3021, 0x80e4, 0x9105, 0x9105, 0x88e5, 0x88c4,
-  0x88e4, 0x88e5, 0x9105, 0x9105, 0x80e4, 0x3021, 0x0000, 0x0000,
-  0x0000, 0x3021, 0x80c4, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8946, 0x8946, 0x8105, 0x78c4, 0x78a4, 0x80c4, 0x3021, 0x0000,
-  0x3021, 0x78c4, 0x7083, 0x3842, 0x4a28, 0x7b8e, 0xbd96, 0xd679,
-  0xc5d7, 0xbd96, 0x7b8e, 0x4a28, 0x3842, 0x7083, 0x80c4, 0x3021,
-  0x3801, 0x7083, 0x4021, 0x2801, 0x1061, 0x10c3, 0x2124, 0x2945,
-  0x2124, 0x2124, 0x10c3, 0x0861, 0x0800, 0x3821, 0x7083, 0x3801,
-  0x3001, 0x7083, 0x7083, 0x3842, 0x5228, 0x7b6e, 0xad34, 0xc5d7,
-  0xb555, 0xad14, 0x7b8e, 0x5228, 0x3842, 0x7083, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x7083, 0x78c4, 0x8105, 0x8966, 0x8967,
-  0x8946, 0x8926, 0x8105, 0x78c4, 0x7083, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x99c8, 0xb32d, 0xa2ab,
-  0x91a7, 0x88e5, 0x88e5, 0x7083, 0x3021, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x3001, 0x70a3, 0x70c4, 0x3842,
-  0x3821, 0x7083, 0x7083, 0x3001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0800, 0x0800, 0x2821, 0x0800, 0x0800, 0x0800, 0x3021,
-  0x3021, 0x0800, 0x0800, 0x0800, 0x2821, 0x0800, 0x0800, 0x0000,
-  0x0800, 0x6883, 0x7883, 0x80e4, 0x80e4, 0x80e4, 0x80e4, 0x80c4,
-  0x80e4, 0x80e4, 0x80e4, 0x80e4, 0x88e4, 0x78a3, 0x6883, 0x0800,
-  0x0800, 0x7083, 0x80a4, 0x78c4, 0x80c4, 0x80e5, 0x8926, 0x8946,
-  0x8926, 0x8926, 0x80e5, 0x80c4, 0x78c4, 0x80a4, 0x7083, 0x0800,
-  0x3021, 0x80c4, 0x78c4, 0x5a49, 0x5aaa, 0x83ef, 0xce59, 0xef3c,
-  0xd67a, 0xce38, 0x83f0, 0x5aaa, 0x5a69, 0x78c4, 0x80c4, 0x3021,
-  0x3001, 0x7083, 0x78c4, 0x5a49, 0x5aaa, 0x83ef, 0xc5d7, 0xde9a,
-  0xc618, 0xc5d7, 0x83ef, 0x5aaa, 0x5a69, 0x78c4, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x78a4, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8905, 0x80e5, 0x78c4, 0x78a4, 0x7083, 0x3021, 0x2801,
-  0x0000, 0x0000, 0x0800, 0x3001, 0x7083, 0x89a7, 0xab0d, 0x9aab,
-  0x91a7, 0x80e5, 0x80e4, 0x7083, 0x3001, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0820, 0x1041, 0x1041,
-  0x2821, 0x0800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x78a3, 0x7083, 0x3821, 0x3001, 0x3001, 0x3001, 0x3001, 0x3001,
-  0x3001, 0x3001, 0x3001, 0x3001, 0x3001, 0x3821, 0x7083, 0x78a3,
-  0x88e5, 0x8905, 0x80e5, 0x8105, 0x8105, 0x8946, 0x9167, 0x9187,
-  0x9167, 0x8967, 0x8946, 0x8105, 0x8105, 0x80e5, 0x8905, 0x88e5,
-  0x4021, 0x78e5, 0x28e3, 0x3165, 0x5a8a, 0x8bf0, 0xd659, 0xf73d,
-  0xde9a, 0xce38, 0x8c10, 0x5a8a, 0x3165, 0x28e3, 0x78e5, 0x4021,
-  0x3001, 0x6883, 0x28c3, 0x3145, 0x52aa, 0x8451, 0xd6db, 0xf7df,
-  0xdf1c, 0xd6ba, 0x8451, 0x52aa, 0x3165, 0x28c3, 0x6883, 0x3001,
-  0x0000, 0x3001, 0x6883, 0x78c4, 0x5a69, 0x83cf, 0xc5b7, 0xde79,
-  0xc5f7, 0xbdb6, 0x83ef, 0x5a69, 0x78c4, 0x6883, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x78c4, 0x8105, 0x8946, 0x8946,
-  0x8926, 0x8905, 0x80e5, 0x78c4, 0x7083, 0x3001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x3821, 0x89a7, 0xab0d, 0x9aab,
-  0x89a7, 0x80e5, 0x78c4, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1041, 0x0841,
-  0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x78a3, 0x7083, 0x3821, 0x3001, 0x3001, 0x3001, 0x3001, 0x3001,
-  0x3001, 0x3001, 0x3001, 0x3001, 0x3001, 0x3821, 0x7083, 0x78a3,
-  0x88e5, 0x8905, 0x80e5, 0x8105, 0x8105, 0x8946, 0x9167, 0x9187,
-  0x9167, 0x8967, 0x8946, 0x8105, 0x8105, 0x80e5, 0x8905, 0x88e5,
-  0x4021, 0x80e5, 0x30e3, 0x3165, 0x5a8a, 0x8c10, 0xd659, 0xf75d,
-  0xde9a, 0xd659, 0x8c10, 0x5a8a, 0x3165, 0x30e3, 0x80e5, 0x4021,
-  0x3001, 0x7083, 0x6883, 0x3145, 0x526a, 0x83ef, 0xce59, 0xef3c,
-  0xd67a, 0xce38, 0x83ef, 0x526a, 0x3145, 0x6883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x78a4, 0x70a3, 0x70a4, 0x78e4, 0x78e5,
-  0x78e5, 0x78e5, 0x70c4, 0x70a3, 0x78a4, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x7883, 0x80a4, 0x80c4, 0x80c4,
-  0x80a4, 0x8083, 0x8083, 0x7883, 0x7083, 0x3001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x3821, 0x89a7, 0xab2d, 0x9acb,
-  0x89c7, 0x8105, 0x78e4, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1041, 0x0841,
-  0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x78a3, 0x7083, 0x3821, 0x3001, 0x3001, 0x3001, 0x3001, 0x3001,
-  0x3001, 0x3001, 0x3001, 0x3001, 0x3001, 0x3821, 0x7083, 0x78a3,
-  0x88e5, 0x8905, 0x80e5, 0x8105, 0x8105, 0x8946, 0x9167, 0x9187,
-  0x9167, 0x8967, 0x8946, 0x8105, 0x8105, 0x80e5, 0x8905, 0x88e5,
-  0x4021, 0x80e5, 0x30e3, 0x3165, 0x5a8a, 0x8c10, 0xd659, 0xf75d,
-  0xde9a, 0xd659, 0x8c10, 0x5a8a, 0x3165, 0x30e3, 0x80e5, 0x4021,
-  0x3001, 0x7083, 0x6883, 0x3145, 0x526a, 0x83ef, 0xce59, 0xef3c,
-  0xd67a, 0xce38, 0x83ef, 0x526a, 0x3145, 0x6883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x78a4, 0x70a3, 0x70a4, 0x78e4, 0x78e5,
-  0x78e5, 0x78e5, 0x70c4, 0x70a3, 0x78a4, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x7883, 0x80a4, 0x80c4, 0x80c4,
-  0x80a4, 0x8083, 0x8083, 0x7883, 0x7083, 0x3001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x3821, 0x89a7, 0xab2d, 0x9acb,
-  0x89c7, 0x8105, 0x78e4, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1041, 0x0841,
-  0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x78a3, 0x7083, 0x3821, 0x3001, 0x3001, 0x3001, 0x3001, 0x3001,
-  0x3001, 0x3001, 0x3001, 0x3001, 0x3001, 0x3821, 0x7083, 0x78a3,
-  0x88e5, 0x8905, 0x80e5, 0x8105, 0x8105, 0x8946, 0x9167, 0x9187,
-  0x9167, 0x8967, 0x8946, 0x8105, 0x8105, 0x80e5, 0x8905, 0x88e5,
-  0x4021, 0x80e5, 0x30e3, 0x3165, 0x5a8a, 0x8c10, 0xd659, 0xf75d,
-  0xde9a, 0xd659, 0x8c10, 0x5a8a, 0x3165, 0x30e3, 0x80e5, 0x4021,
-  0x3001, 0x7083, 0x6883, 0x3145, 0x526a, 0x83ef, 0xce59, 0xef3c,
-  0xd67a, 0xce38, 0x83ef, 0x526a, 0x3145, 0x6883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x78a4, 0x70a3, 0x70a4, 0x78e4, 0x78e5,
-  0x78e5, 0x78e5, 0x70c4, 0x70a3, 0x78a4, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x7883, 0x80a4, 0x80c4, 0x80c4,
-  0x80a4, 0x8083, 0x8083, 0x7883, 0x7083, 0x3001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x3821, 0x89a7, 0xab2d, 0x9acb,
-  0x89c7, 0x8105, 0x78e4, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1041, 0x0841,
-  0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x78a3, 0x7083, 0x3821, 0x3001, 0x3001, 0x3001, 0x3001, 0x3001,
-  0x3001, 0x3001, 0x3001, 0x3001, 0x3001, 0x3821, 0x7083, 0x78a3,
-  0x88e5, 0x8905, 0x80e5, 0x8105, 0x8105, 0x8946, 0x9167, 0x9187,
-  0x9167, 0x8967, 0x8946, 0x8105, 0x8105, 0x80e5, 0x8905, 0x88e5,
-  0x4021, 0x80e5, 0x30e3, 0x3165, 0x5a8a, 0x8c10, 0xd659, 0xf75d,
-  0xde9a, 0xd659, 0x8c10, 0x5a8a, 0x3165, 0x30e3, 0x80e5, 0x4021,
-  0x3001, 0x7083, 0x6883, 0x3145, 0x526a, 0x83ef, 0xce59, 0xef3c,
-  0xd67a, 0xce38, 0x83ef, 0x526a, 0x3145, 0x6883, 0x7083, 0x3001,
-  0x0000, 0x3001, 0x7083, 0x78a4, 0x70a3, 0x70a4, 0x78e4, 0x78e5,
-  0x78e5, 0x78e5, 0x70c4, 0x70a3, 0x78a4, 0x7083, 0x3001, 0x0000,
-  0x0000, 0x0000, 0x3001, 0x7083, 0x7883, 0x80a4, 0x80c4, 0x80c4,
-  0x80a4, 0x8083, 0x8083, 0x7883, 0x7083, 0x3001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2801, 0x3821, 0x89a7, 0xab2d, 0x9acb,
-  0x89c7, 0x8105, 0x78e4, 0x3021, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0820, 0x1041, 0x0841,
-  0x0820, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation licking_lipsAnimation = {
-  .name = "Licking Lips",
-  .frameCount = 45,
-  .width = 16,
-  .height = 16,
-  .frameDurations = licking_lipsDurations,
-  .animationFrames = licking_lipsFrames
-};
-#endif // ANIMATION_LICKING_LIPS_H
@@ -1,566 +0,0 @@
-// loading.h - Auto-generated from loading.json
-#ifndef ANIMATION_LOADING_H
-#define ANIMATION_LOADING_H
-
-#include "animation_types.h"
-
-// Frame Durations for loading (in 100ms units)
-static const uint8_t PROGMEM loadingDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for loading
-static const uint16_t PROGMEM loadingFrames[] = {
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xffff, 0xffff, 0x4208, 0x4208,
-  0x4208, 0x4208, 0xffff, 0xffff, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xffff, 0x4208, 0x4208, 0xbae0, 0xbae0,
-  0xfbe0, 0xfbe0, 0x4208, 0x4208, 0xffff, 0xbae0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0x4208, 0xbae0, 0xbae0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0x4208, 0xffff, 0xbae0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xffff, 0xbae0, 0xbae0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0x4208, 0xbae0, 0xbae0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc84, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc02, 0xeed9, 0xdeba, 0x62ea, 0x5269,
-  0x5a89, 0x6aea, 0xdeb9, 0xeef9, 0xfc64, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x6aa8, 0x62a8, 0xaac1, 0xbae0,
-  0xe380, 0xe381, 0x62a8, 0x630b, 0xde77, 0xcba4, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xeba0, 0xf3c0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xdb80, 0x732a, 0xe6d9, 0xcb62, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x730a, 0xd637, 0xc342,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xdb81, 0x72c7, 0xb2e1,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc84, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xde77, 0x62eb, 0x5269,
-  0x5a89, 0x6aea, 0xdeb9, 0xeef9, 0xfc64, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x72c8, 0xaac1, 0xbae0,
-  0xe380, 0xe381, 0x62a8, 0x630b, 0xde77, 0xcba4, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xdb80, 0x732a, 0xe6d9, 0xcb62, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x732a, 0xe6b9, 0xc342,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xec03, 0xe6b8, 0xc343,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x72a7, 0xb2e1,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc42,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc02, 0xeeb8,
-  0xef1b, 0xeed8, 0xfc84, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x6ac8,
-  0x5a89, 0x6aea, 0xdeb9, 0xeef9, 0xfc64, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0,
-  0xeba0, 0xdb81, 0x62a8, 0x630b, 0xde77, 0xcba4, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xdb80, 0x732a, 0xe6d9, 0xcb62, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x732a, 0xe6b8, 0xc342,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xec03, 0xf71a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xf73a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xe6b8, 0xc343,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x72a7, 0xb2e1,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xee96, 0xfc85, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0,
-  0xeba0, 0x730a, 0xdeba, 0xeef9, 0xfc64, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xe381, 0x62a8, 0x630b, 0xde77, 0xcba4, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xeba0, 0xdb80, 0x732a, 0xe6d9, 0xcb62, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x732a, 0xe6b8, 0xc342,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xec03, 0xf71a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xf73a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xe6b8, 0xc343,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xb2c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xe6b9, 0xb323, 0xbac0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xebc0, 0x72a7, 0xbae0, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xee97, 0xfc64, 0xf3c0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x732a, 0xeed9, 0xcb62, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x732a, 0xe6b8, 0xc342,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xec03, 0xf71a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xf73a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xe6b8, 0xc343,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xb2c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc85, 0xe6d9, 0xb323, 0xbac0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbe0, 0xfc22, 0xfc85, 0xde77, 0x6aea, 0xb2c0, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc02, 0xeed9, 0xdeba, 0x6aea, 0xa2a0, 0xc300, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xebc0, 0x6ac8, 0x62a8, 0xaac1, 0xc300, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xeba0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc22, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfef8, 0xf423,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xf73a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xf73a, 0xc363,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xe6b8, 0xc343,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xb2c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc85, 0xe6d9, 0xb323, 0xbac0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc22, 0xfc85, 0xde77, 0x6aea, 0xb2c0, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc22,
-  0xfc22, 0xfc64, 0xeef9, 0xdeba, 0x6aea, 0xa2a0, 0xc300, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc02, 0xeeb8,
-  0xef1b, 0xdeb9, 0x62ea, 0x5a88, 0xaac1, 0xc300, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xeba0, 0x5aa9,
-  0x4a6a, 0x5289, 0xa2a1, 0xb2c0, 0xf3a0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfc22, 0xfbe0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xff18, 0xf422, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc85, 0xeed9, 0xc342, 0xc2e0,
-  0xfbc0, 0xfbc0, 0xfc22, 0xee97, 0xfc85, 0xfc22, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc22, 0xfc85, 0xde77, 0x6aea, 0xb2c0, 0xc2e0,
-  0xfbc0, 0xfbe0, 0xeba0, 0x730a, 0xdeba, 0xeed9, 0xfc84, 0xfc22,
-  0xfc22, 0xfc64, 0xeef9, 0xdeba, 0x6aea, 0xa2a0, 0xc300, 0xf3a0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xe381, 0x6aa8, 0x6aea, 0xdeb9, 0xef1b,
-  0xef1b, 0xdeb9, 0x62ea, 0x5a88, 0xaac1, 0xc300, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xdb81, 0x5aa9, 0x4a8a,
-  0x4a8a, 0x5289, 0xa2a1, 0xb2c0, 0xf3a0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xfc22, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xfef8, 0xf402, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc23, 0xeed9, 0xc3a5, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x7b2a, 0xe6b9, 0xc342, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xeba0, 0x730a, 0xd657, 0xcbc5, 0xfc02, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc22, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xdb80, 0x730a, 0xd6ba, 0xeed9, 0xfc84, 0xfc22,
-  0xfc22, 0xfc85, 0xee97, 0xf402, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xe381, 0x6aa8, 0x6aea, 0xdeb9, 0xef1b,
-  0xef1b, 0xdeb9, 0x6aea, 0xb2c0, 0xcb00, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xdb81, 0x5aa9, 0x4a8a,
-  0x4a8a, 0x5289, 0xa2a1, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc22, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc64, 0xee97, 0xf402, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xeed8, 0x6b0a, 0xb2c0, 0xcb00, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xf73a, 0xb323, 0xbac0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xff3a, 0xc342, 0xbae0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xe6b8, 0xc3a5, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x7b2a, 0xe6d9, 0xc342, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xeba0, 0x730a, 0xd657, 0xcbc5, 0xfc02, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xdb80, 0x730a, 0xd6ba, 0xeed9, 0xfc85, 0xfc22,
-  0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xe381, 0x6aa8, 0x6aea, 0xdeb9, 0xeed9,
-  0xf402, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xdb81, 0x5a89, 0x5289,
-  0xb2e1, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfbe0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xee97, 0xf402, 0xf3a0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xde77, 0x6aea, 0xb2c0, 0xcb00, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xc2e0, 0xf3a0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc64, 0xe6d9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xeed8, 0x6b0a, 0xb2c0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xf73a, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xff3a, 0xc342, 0xbae0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xe6b8, 0xc3a5, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x7b2a, 0xe6d9, 0xc342, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xec03, 0xe6d9, 0xc3a5, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xeba0, 0x730a, 0xd658, 0xcba5, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xdb80, 0x730a, 0xd657, 0xcb62, 0xf3a0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xe381, 0x72c7, 0xb2e0, 0xcb00, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfbe0,
-  0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc85, 0xee96, 0xf402,
-  0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x6aea, 0xb2c0,
-  0xcb00, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xc2e0,
-  0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc64, 0xe6d9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xeed8, 0x6b0a, 0xb2c0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xf73a, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xff3a, 0xc342, 0xbae0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xe6b8, 0xc3a5, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x7b2a, 0xe6d9, 0xc362, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xec03, 0xe6b9, 0xbb42, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbe0, 0xebc0, 0x72a7, 0xb2e0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc42, 0xfbe0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xeeb8, 0xf402, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x62ea, 0x5269,
-  0x62a8, 0xbb00, 0xcb00, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xbae0,
-  0xe380, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbe0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc64, 0xe6d9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xeed8, 0x6b0a, 0xb2c0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xf73a, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc43, 0xff3a, 0xc343, 0xc2e0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc23, 0xe6b8, 0xbb42, 0xbae0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x72a7, 0xb2e0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc64, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x62ea, 0x5269,
-  0x5a89, 0x6b0b, 0xde57, 0xcb62, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xbae0,
-  0xe380, 0xdb81, 0x72c8, 0xb2e0, 0xcb00, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc64, 0xe6d9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xeef9, 0x6b0a, 0xb2c0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc23, 0xe6b8, 0xb323, 0xbac0, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x72a7, 0xb2e0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc64, 0xfc22, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x62ea, 0x5269,
-  0x5a89, 0x6aea, 0xdeba, 0xeed9, 0xf402, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xbae0,
-  0xe380, 0xe381, 0x6aa8, 0x62a8, 0xbb00, 0xcb00, 0xf3c0, 0xfbe0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfc85, 0xe6d9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfc22, 0xde77, 0x6aea, 0xb2c0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xeba0, 0x72c7, 0xaac1, 0xc300, 0xf3a0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc84, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x62ea, 0x5269,
-  0x5a89, 0x6aea, 0xdeb9, 0xeed9, 0xfc64, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xbae0,
-  0xe380, 0xe381, 0x62a8, 0x630b, 0xde57, 0xcb62, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfc22, 0xeef9, 0x6b0a, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xdb81, 0x72c8, 0xb2e0, 0xcb00, 0xf3c0,
-  0xfbc0, 0xfc22, 0xe6b9, 0xb323, 0xbae0, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0,
-  0xfbe0, 0xebc0, 0x72a7, 0xb2e0, 0xc300, 0xf3c0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc42, 0xfc43,
-  0xfc43, 0xfc42, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfc22, 0xfc64, 0xeed8, 0xef1b,
-  0xef1b, 0xeed8, 0xfc84, 0xfc22, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfc64, 0xeef9, 0xdeba, 0x62ea, 0x5269,
-  0x5a89, 0x6aea, 0xdeb9, 0xeef9, 0xfc64, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfc64, 0xe677, 0x62eb, 0x5a88, 0xaac1, 0xbae0,
-  0xe380, 0xe381, 0x62a8, 0x630b, 0xde77, 0xd3c5, 0xf3a0, 0xfbe0,
-  0xfbc0, 0xfc22, 0xde77, 0x6aea, 0xa2a0, 0xbae0, 0xf3a0, 0xfbc0,
-  0xfbe0, 0xfbc0, 0xeba0, 0xdb80, 0x730a, 0xd657, 0xcb62, 0xf3a0,
-  0xfbe0, 0xebc0, 0x72c8, 0xaac1, 0xc300, 0xf3a0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0, 0xe381, 0x72c8, 0xb2e0, 0xc300,
-  0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xeba0, 0xf3c0, 0xf3c0,
-  0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0
-};
-
-const Animation loadingAnimation = {
-  .name = "Loading",
-  .frameCount = 17,
-  .width = 16,
-  .height = 16,
-  .frameDurations = loadingDurations,
-  .animationFrames = loadingFrames
-};
-#endif // ANIMATION_LOADING_H
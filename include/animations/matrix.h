@@ -1,278 +0,0 @@
-// matrix.h - Auto-generated from matrix.json
-#ifndef ANIMATION_MATRIX_H
-#define ANIMATION_MATRIX_H
-
-#include "animation_types.h"
-
-// Frame Durations for matrix (in 100ms units)
-static const uint8_t PROGMEM matrixDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for matrix
-static const uint16_t PROGMEM matrixFrames[] = {
-  0x0000, 0x1360, 0x0000, 0x0000, 0x1460, 0x0000, 0x0000, 0x00c0,
-  0x0000, 0x0000, 0x0000, 0x0a80, 0x0000, 0x0000, 0x1d40, 0x0000,
-  0x0000, 0x1360, 0x0000, 0x0000, 0x1460, 0x0000, 0x0000, 0x00c0,
-  0x0000, 0x0000, 0x0000, 0x0a80, 0x0000, 0x0000, 0x1d40, 0x0000,
-  0x0000, 0x1460, 0x0000, 0x00c0, 0x1d40, 0x0000, 0x0000, 0x09a0,
-  0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1460, 0x0000, 0x00c0, 0x1d40, 0x0000, 0x0000, 0x09a0,
-  0x0000, 0x0000, 0x0000, 0x1360, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1d40, 0x0000, 0x09a0, 0x0000, 0x0000, 0x0000, 0x0a80,
-  0x0000, 0x00c0, 0x0000, 0x1460, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1d40, 0x0000, 0x09a0, 0x0000, 0x0000, 0x0000, 0x0a80,
-  0x0000, 0x00c0, 0x0000, 0x1460, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0a80, 0x0000, 0x0000, 0x0000, 0x1360,
-  0x0000, 0x09a0, 0x0000, 0x1d40, 0x0000, 0x0000, 0x00c0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0a80, 0x0000, 0x0000, 0x0000, 0x1360,
-  0x0000, 0x09a0, 0x0000, 0x1d40, 0x0000, 0x0000, 0x00c0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1360, 0x00c0, 0x0000, 0x0000, 0x1460,
-  0x0000, 0x0a80, 0x0000, 0x0000, 0x0000, 0x0000, 0x09a0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1360, 0x00c0, 0x0000, 0x0000, 0x1460,
-  0x0000, 0x0a80, 0x0000, 0x0000, 0x0000, 0x0000, 0x09a0, 0x0000,
-  0x0000, 0x00c0, 0x0000, 0x1460, 0x09a0, 0x0000, 0x0000, 0x1d40,
-  0x0000, 0x1360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a80, 0x0000,
-  0x0000, 0x00c0, 0x0000, 0x1460, 0x09a0, 0x0000, 0x0000, 0x1d40,
-  0x0000, 0x1360, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a80, 0x0000,
-  0x0000, 0x09a0, 0x0000, 0x1d40, 0x0a80, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1460, 0x0000, 0x00c0, 0x0000, 0x0000, 0x1360, 0x0000,
-  0x0000, 0x09a0, 0x0000, 0x1d40, 0x0a80, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1460, 0x0000, 0x00c0, 0x0000, 0x0000, 0x1360, 0x0000,
-  0x0000, 0x0a80, 0x0000, 0x0000, 0x1360, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1d40, 0x0000, 0x09a0, 0x0000, 0x0000, 0x1460, 0x0000,
-  0x0000, 0x0a80, 0x0000, 0x0000, 0x1360, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1d40, 0x0000, 0x09a0, 0x0000, 0x0000, 0x1460, 0x0000,
-  0x0040, 0x0a00, 0x0020, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1460, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0080, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09a0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0aa0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13a0, 0x0080, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1ca0, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13a0, 0x0080, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1460, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0080, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09c0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0ac0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09c0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0ac0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09c0, 0x0000, 0x0060, 0x1460,
-  0x00c0, 0x0ac0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1460, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0080, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x12e0, 0x00e0, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a00, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x12e0, 0x00e0, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a00, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09a0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0aa0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0040, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1440, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0140, 0x00a0, 0x1460, 0x0080, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a00, 0x0040, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0140, 0x00a0, 0x1460, 0x0080, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0060, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09a0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0aa0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0000, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1460, 0x00a0, 0x0140, 0x0020, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1460, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0080, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09a0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0aa0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ae0, 0x0040, 0x0060, 0x13c0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1400, 0x0080,
-  0x0060, 0x1380, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0140,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0040, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1c60, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1c80, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ac0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x13a0, 0x0060, 0x0100, 0x1420, 0x0060, 0x0000, 0x0160,
-  0x0020, 0x0000, 0x0040, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x1440, 0x00a0, 0x0140, 0x0080, 0x0000, 0x0020, 0x0a00,
-  0x0040, 0x0080, 0x0060, 0x13a0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0080, 0x13e0, 0x00a0, 0x0160, 0x0020, 0x0000, 0x0020, 0x0a20,
-  0x0040, 0x00a0, 0x0060, 0x13c0, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0000, 0x0040, 0x0ac0,
-  0x0060, 0x0120, 0x00a0, 0x1460, 0x0080, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0040, 0x0000, 0x0040, 0x0ae0,
-  0x0080, 0x0140, 0x0080, 0x1400, 0x0060, 0x0000, 0x00a0, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x12c0, 0x00e0, 0x0000, 0x0060, 0x1380,
-  0x00a0, 0x0a00, 0x0040, 0x0040, 0x0000, 0x0020, 0x0140, 0x0020,
-  0x0000, 0x0000, 0x0040, 0x1300, 0x0100, 0x0000, 0x0060, 0x13a0,
-  0x00a0, 0x0a20, 0x0040, 0x0000, 0x0000, 0x0020, 0x0160, 0x0020,
-  0x0000, 0x0080, 0x0060, 0x13c0, 0x09a0, 0x0000, 0x0060, 0x1440,
-  0x00c0, 0x0aa0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a00, 0x0040,
-  0x0000, 0x00a0, 0x0060, 0x13e0, 0x09e0, 0x0000, 0x0060, 0x1400,
-  0x00c0, 0x0ae0, 0x0040, 0x0000, 0x0000, 0x0020, 0x0a20, 0x0040,
-  0x0020, 0x0140, 0x0080, 0x1c80, 0x0a80, 0x0020, 0x0000, 0x0040,
-  0x0060, 0x13a0, 0x0060, 0x0080, 0x0000, 0x0040, 0x0ac0, 0x0040,
-  0x0020, 0x0160, 0x0080, 0x1440, 0x0aa0, 0x0020, 0x0000, 0x0000,
-  0x0060, 0x13c0, 0x0080, 0x00a0, 0x0000, 0x0040, 0x0ae0, 0x0040,
-  0x0040, 0x0a00, 0x0020, 0x00a0, 0x0ac0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1460, 0x00a0, 0x0140, 0x0000, 0x0060, 0x1380, 0x0060,
-  0x0040, 0x0a20, 0x0020, 0x0020, 0x0ae0, 0x0040, 0x0000, 0x0000,
-  0x0060, 0x1400, 0x00a0, 0x0160, 0x0000, 0x0060, 0x13a0, 0x0060,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x0080,
-  0x0000, 0x0040, 0x0040, 0x0a00, 0x0020, 0x0060, 0x1440, 0x0080,
-  0x0040, 0x0ac0, 0x0040, 0x0040, 0x13a0, 0x0060, 0x0000, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0a20, 0x0020, 0x0060, 0x1440, 0x0080
-};
-
-const Animation matrixAnimation = {
-  .name = "Matrix",
-  .frameCount = 8,
-  .width = 16,
-  .height = 16,
-  .frameDurations = matrixDurations,
-  .animationFrames = matrixFrames
-};
-#endif // ANIMATION_MATRIX_H
@@ -1,310 +0,0 @@
-// minion.h - Auto-generated from minion.json
-#ifndef ANIMATION_MINION_H
-#define ANIMATION_MINION_H
-
-#include "animation_types.h"
-
-// Frame Durations for minion (in 100ms units)
-static const uint8_t PROGMEM minionDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for minion
-static const uint16_t PROGMEM minionFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x10a7, 0x0000, 0x10a7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0x4251, 0x4251, 0x4251, 0x10a7,
-  0xffc0, 0xffc0, 0xb560, 0x4251, 0x4251, 0x10a7, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0x4251, 0x4251, 0x94fb, 0x94fb, 0x4251,
-  0x10a7, 0x298d, 0x4251, 0x94fb, 0x94fb, 0x4251, 0x10a7, 0x0000,
-  0x6bb6, 0x4251, 0x6bb6, 0x4251, 0x94fb, 0xffff, 0x4251, 0x0000,
-  0x4251, 0x10a7, 0x94fb, 0xffff, 0x4251, 0x0000, 0x4251, 0x0000,
-  0x6bb6, 0x4251, 0x6bb6, 0x4251, 0x94fb, 0xc6de, 0x0000, 0x0000,
-  0x4251, 0x10a7, 0x94fb, 0xc6de, 0x0000, 0x0000, 0x4251, 0x0000,
-  0x6bb6, 0x4251, 0x6bb6, 0x4251, 0x4251, 0x94fb, 0x94fb, 0x4251,
-  0x10a7, 0x298d, 0x4251, 0x94fb, 0x94fb, 0x4251, 0x10a7, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xb560, 0x4251, 0x4251, 0x4251, 0x10a7,
-  0xb560, 0xb560, 0xb560, 0x4251, 0x4251, 0x10a7, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xb560, 0xb560, 0xb560, 0xb560, 0xdea1,
-  0xffc0, 0xffc0, 0xb560, 0xb560, 0xb560, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xdea1, 0xdea1, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0x0000, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,
-  0xb560, 0xb560, 0xb560, 0xdea1, 0xdea1, 0xffc0, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce42, 0xef01, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x52d1, 0x52d0, 0x39e8,
-  0xdea1, 0xef01, 0xad22, 0x632f, 0x4250, 0x18e8, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x4ab2, 0x8cba, 0x7c59, 0x3a0f,
-  0x2968, 0x31eb, 0x52d1, 0x8cba, 0x8479, 0x3a2f, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x4a92, 0x8cda, 0xdefd, 0x4a90, 0x0863,
-  0x31ce, 0x190a, 0x8cb9, 0xdf1e, 0x4a90, 0x0863, 0x31cd, 0x0041,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cba, 0xb61b, 0x1905, 0x0842,
-  0x31ce, 0x192a, 0x8499, 0xb61b, 0x1905, 0x0842, 0x31cd, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab2, 0x849a, 0x7c18, 0x3a0f,
-  0x2148, 0x31cb, 0x52d1, 0x8499, 0x7c38, 0x3a2f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffc0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xf780, 0xe700, 0xffa0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xd660, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdec1, 0xe700, 0x4a20, 0xd640,
-  0xe700, 0xe6e0, 0xe700, 0xd680, 0x3180, 0x0000, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xde80, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39c0, 0xc5e0, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce42, 0xef01, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x52d1, 0x52d0, 0x39e8,
-  0xdea1, 0xef01, 0xad22, 0x632f, 0x4250, 0x18e8, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x4ab2, 0x8cba, 0x7c59, 0x3a0f,
-  0x2968, 0x31eb, 0x52d1, 0x8cba, 0x8479, 0x3a2f, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x4a92, 0x8cda, 0xdefd, 0x4a90, 0x0863,
-  0x31ce, 0x190a, 0x8cb9, 0xdf1e, 0x4a90, 0x0863, 0x31cd, 0x0041,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cba, 0xb61b, 0x1905, 0x0842,
-  0x31ce, 0x192a, 0x8499, 0xb61b, 0x1905, 0x0842, 0x31cd, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab2, 0x849a, 0x7c18, 0x3a0f,
-  0x2148, 0x31cb, 0x52d1, 0x8499, 0x7c38, 0x3a2f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffc0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xf780, 0xe700, 0xffa0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xd660, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdec1, 0xe700, 0x4a20, 0xd640,
-  0xe700, 0xe6e0, 0xe700, 0xd680, 0x3180, 0x0000, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xde80, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39c0, 0xc5e0, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce42, 0xef01, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x52d1, 0x52d0, 0x39e8,
-  0xdea1, 0xef01, 0xad22, 0x632f, 0x4250, 0x18e8, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x4ab2, 0x8cba, 0x7c59, 0x3a0f,
-  0x2968, 0x31eb, 0x52d1, 0x8cba, 0x8479, 0x3a2f, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x4a92, 0x8cda, 0xdefd, 0x4a90, 0x0863,
-  0x31ce, 0x190a, 0x8cb9, 0xdf1e, 0x4a90, 0x0863, 0x31cd, 0x0041,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cba, 0xb61b, 0x1905, 0x0842,
-  0x31ce, 0x192a, 0x8499, 0xb61b, 0x1905, 0x0842, 0x31cd, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab2, 0x849a, 0x7c18, 0x3a0f,
-  0x2148, 0x31cb, 0x52d1, 0x8499, 0x7c38, 0x3a2f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffc0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef20, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xf780, 0xe700, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xd660, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdec1, 0xe700, 0x39c0, 0x2940,
-  0x2940, 0x2940, 0x2940, 0x2940, 0x2120, 0x0000, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xf780, 0xe6e0, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe6e0, 0xd660, 0x1080, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce43, 0xe701, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aee, 0x5aee, 0x5b0d, 0x3a07,
-  0xde81, 0xef01, 0xad42, 0x634d, 0x4a8e, 0x18e7, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x52b1, 0xc606, 0xd664, 0x424d,
-  0x2968, 0x31eb, 0x5aef, 0xc626, 0xd684, 0x424d, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x4a92, 0x8cda, 0xe73b, 0x52ce, 0x0863,
-  0x31ce, 0x190a, 0x8cb9, 0xe73b, 0x52ce, 0x0883, 0x31cd, 0x0041,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cba, 0xae1c, 0x1905, 0x0842,
-  0x31ce, 0x192a, 0x8499, 0xae1c, 0x1905, 0x0842, 0x31cd, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab2, 0x849a, 0x7c18, 0x3a0f,
-  0x2148, 0x31cb, 0x52d1, 0x8499, 0x7c38, 0x3a2f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xffa0, 0xef20, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39e0, 0xd680, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce43, 0xe701, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x5aef, 0x5aee, 0x39e7,
-  0xd681, 0xef01, 0xad22, 0x634d, 0x4a6e, 0x10c7, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x5aef, 0xc623, 0xe6e2, 0x5aed,
-  0x2968, 0x31eb, 0x5b0d, 0xce23, 0xe702, 0x5aed, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x52b0, 0xbde5, 0xf762, 0xef00, 0xce42,
-  0x424e, 0x2128, 0xbdc5, 0xf762, 0xef00, 0xce42, 0x4a6e, 0x0021,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cd8, 0xb619, 0x2964, 0x18e2,
-  0x31ee, 0x192a, 0x8cb7, 0xb619, 0x2964, 0x18e2, 0x39ed, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab3, 0x849a, 0x7418, 0x39ef,
-  0x2148, 0x31cb, 0x52d1, 0x849a, 0x7418, 0x3a0f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xffa0, 0xef20, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39e0, 0xd680, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce43, 0xe701, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x5aef, 0x5aee, 0x39e7,
-  0xd681, 0xef01, 0xad22, 0x634d, 0x4a6e, 0x10c7, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x52cf, 0xc5e4, 0xc603, 0x52cd,
-  0x2968, 0x31eb, 0x5b0d, 0xc5e3, 0xc623, 0x52cd, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x52b0, 0xc5e3, 0xdec0, 0xffa0, 0xe702,
-  0x424e, 0x2128, 0xbdc3, 0xdec1, 0xffa0, 0xe702, 0x4a6e, 0x0021,
-  0x6376, 0x4a72, 0x6355, 0x52b0, 0xc603, 0xef42, 0xf782, 0xe6e2,
-  0x4a6e, 0x2128, 0xbde3, 0xef42, 0xf782, 0xe6e2, 0x4a6d, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x52d0, 0x8cb7, 0x8cb8, 0x4a8f,
-  0x2148, 0x31cb, 0x5aef, 0x8cb7, 0x8cb8, 0x52af, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b1, 0x4a90, 0x31a8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4a90, 0x10c8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xffa0, 0xef20, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39e0, 0xd680, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce43, 0xe701, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aef, 0x5aef, 0x5aee, 0x39e7,
-  0xd681, 0xef01, 0xad22, 0x634d, 0x4a6e, 0x10c7, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x52cf, 0xc5e4, 0xc603, 0x52cd,
-  0x2968, 0x31eb, 0x5b0d, 0xc5e3, 0xc623, 0x52cd, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x52b0, 0xc5e3, 0xdec1, 0xff80, 0xe702,
-  0x426e, 0x2128, 0xbdc3, 0xdec1, 0xff80, 0xe702, 0x4a6e, 0x0021,
-  0x6376, 0x4a72, 0x6355, 0x52b0, 0xc603, 0xff80, 0xffc0, 0xe6e2,
-  0x4a6e, 0x2128, 0xbde3, 0xff80, 0xffc0, 0xe6e2, 0x4a6d, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x4ab0, 0x5aef, 0xe6e2, 0xe6e2, 0x52cd,
-  0x2148, 0x31cb, 0x632d, 0xe6e2, 0xe6e2, 0x5acd, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x5aee, 0x52ce, 0x31a7,
-  0x9cc1, 0xad41, 0x9ce2, 0x632d, 0x52ce, 0x10c7, 0x0001, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad21, 0xa521, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad21, 0x9ca1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xffa0, 0xef20, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39e0, 0xd680, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0860, 0x1060, 0x1080, 0x2125, 0x10a1, 0x2125,
-  0x18c0, 0x10a0, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x9480, 0xa4e0, 0xa500, 0xc601, 0xce21, 0xe700,
-  0xe6e0, 0xe700, 0xd680, 0x2120, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c0, 0x9480, 0xb560, 0xb5a0, 0xc622, 0xce43, 0xe701, 0xef20,
-  0xffc0, 0xffc0, 0xffa0, 0xce21, 0x10a1, 0x0000, 0x0000, 0x0000,
-  0xa500, 0xb560, 0xb560, 0xbdc3, 0x5aee, 0x5aee, 0x5b0d, 0x3a07,
-  0xde81, 0xef01, 0xad42, 0x634d, 0x4a8e, 0x18e7, 0x0001, 0x0000,
-  0xad41, 0xa521, 0xa502, 0x52cf, 0x52b1, 0xc606, 0xd664, 0x424d,
-  0x2968, 0x31eb, 0x5aef, 0xc626, 0xd684, 0x424d, 0x10c7, 0x0000,
-  0x6b93, 0x52d0, 0x6373, 0x4a92, 0x8cda, 0xe73b, 0x52ce, 0x0863,
-  0x31ce, 0x190a, 0x8cb9, 0xe73b, 0x52ce, 0x0883, 0x31cd, 0x0041,
-  0x6376, 0x4a72, 0x6355, 0x4a92, 0x8cba, 0xae1c, 0x1905, 0x0842,
-  0x31ce, 0x192a, 0x8499, 0xae1c, 0x1905, 0x0842, 0x31cd, 0x0021,
-  0x6b93, 0x52d0, 0x6b93, 0x52b0, 0x4ab2, 0x849a, 0x7c18, 0x3a0f,
-  0x2148, 0x31cb, 0x52d1, 0x8499, 0x7c38, 0x3a2f, 0x10c7, 0x0000,
-  0xad21, 0xa521, 0xad21, 0x9ce2, 0x52ce, 0x52b0, 0x4ab0, 0x31c8,
-  0x9cc1, 0xad41, 0x9ce2, 0x5aef, 0x4ab0, 0x18e8, 0x0000, 0x0000,
-  0xad40, 0xb560, 0xad60, 0xad60, 0xad41, 0xad21, 0xad41, 0xce21,
-  0xf760, 0xf760, 0xbda0, 0xad41, 0x9cc1, 0x0860, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xad40, 0xb580, 0xd661, 0xdea1, 0xf760, 0xffa0,
-  0xffa0, 0xffa0, 0xf760, 0xdec1, 0xc601, 0x1080, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xce61, 0xdea1, 0xf780, 0xffa0, 0xffa0,
-  0xffa0, 0xffa0, 0xffa0, 0xffa0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xffa0, 0xffc0,
-  0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xef00, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xffa0, 0xef20, 0x39c0,
-  0x2940, 0x2940, 0x2940, 0x39e0, 0xd680, 0x10a0, 0x0000, 0x0000,
-  0xad40, 0xad40, 0xb560, 0xd661, 0xdea1, 0xff80, 0xff80, 0xe6e0,
-  0xe6e0, 0xe6e0, 0xe6e0, 0xe700, 0xe700, 0x10a0, 0x0000, 0x0000
-};
-
-const Animation minionAnimation = {
-  .name = "Minion",
-  .frameCount = 9,
-  .width = 16,
-  .height = 16,
-  .frameDurations = minionDurations,
-  .animationFrames = minionFrames
-};
-#endif // ANIMATION_MINION_H
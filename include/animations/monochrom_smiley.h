@@ -1,1942 +0,0 @@
-// monochrom_smiley.h - Auto-generated from monochrom_smiley.json
-#ifndef ANIMATION_MONOCHROM_SMILEY_H
-#define ANIMATION_MONOCHROM_SMILEY_H
-
-#include "animation_types.h"
-
-// Frame Durations for monochrom_smiley (in 100ms units)
-static const uint8_t PROGMEM monochrom_smileyDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for monochrom_smiley
-static const uint16_t PROGMEM monochrom_smileyFrames[] = {
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0x18e3,
-  0x18e3, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0x18e3,
-  0x18e3, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ce, 0x8cce, 0xbe33, 0xc673, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ce, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe12, 0xb612, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xbe12, 0x5b09, 0x5b09, 0xbe12, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xbe12, 0x5b09, 0x5b09, 0xbe12, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe13, 0xbe13, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x8cad, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x8cad, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb612, 0xb612, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x52c8, 0x5b09, 0xbe12, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x52c8, 0x5b09, 0xbe12, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb612, 0xbe13, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ce, 0x8cce, 0xbe33, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ce, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xb612, 0xb612, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xbe12, 0x5b09, 0x5b09, 0xbe12, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xbe12, 0x5b09, 0x5b09, 0xbe12, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe13, 0xbe13, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc653, 0xb5f2,
-  0xb5f2, 0xc653, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xc674, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x848d, 0xb5d2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc673, 0xbe53, 0x8c8d, 0x2964, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xb5f2, 0xb5f2, 0xbe53,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53,
-  0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xbe53, 0x94ce, 0x848d,
-  0xb5d2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0x8c8d, 0x2964,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31c6, 0x31a5, 0xb5f2, 0xc674, 0xc673, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a5,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x8c8d, 0x2985, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xbe33, 0xbe53, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x8c8d, 0x3185, 0x31a6, 0xb5f2, 0xc674, 0xbe53,
-  0x94ce, 0x848d, 0xb5d2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xbe53,
-  0x8c8d, 0x2964, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2985,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x3185,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xbe33, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc673, 0xbe53, 0x8c8d, 0x2985, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2, 0xb5f2, 0xbe53,
-  0xc673, 0xbe53, 0x8c8d, 0x3185, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x31a6, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2964, 0x31a6, 0xb5f2,
-  0xc674, 0xc653, 0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8c8d, 0xb5d2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53, 0xc674, 0xc674,
-  0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a5, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2964,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8c8d,
-  0xb5d2, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a5,
-  0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5d2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0x8c8d, 0x2964, 0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0x94ce, 0x8c8d, 0xb5d2, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xbe33, 0xbe53, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x2985,
-  0x2985, 0xb5f2, 0xc694, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc673, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x2985,
-  0x2985, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x2985,
-  0x2985, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5d2, 0xc673, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xb5f2, 0x31a6, 0x2964, 0x848d, 0xbe53, 0xc673, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5f2, 0x8c8d, 0x8cce, 0xbe33, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xbe53, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc653, 0xb5f2,
-  0xb5f2, 0xc653, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5d2, 0xc673, 0xc674, 0xb5f2, 0x31a5, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x2964, 0x848d, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0x8c8d, 0x8cce, 0xbe33, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xbe53, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5d2,
-  0xc673, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2964, 0x848d,
-  0xbe53, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xbe33, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2, 0x8c8d, 0x8cce,
-  0xbe33, 0xc674, 0xb5f2, 0x31a6, 0x2985, 0x8c8d, 0xbe53, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xbe53, 0xbe33,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2985, 0x8c8d, 0xbe53, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe33, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xb5f2,
-  0xb5f2, 0xc653, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe33, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x2985, 0x8c8d, 0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x2985, 0x8c8d, 0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc674, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc674, 0xbe53, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5d2, 0x8c8d, 0x8cce, 0xbe33, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc673, 0xc653, 0xc674,
-  0xb5f2, 0x31a6, 0x2944, 0x8c8d, 0xbe53, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe33, 0xc653, 0xc674,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5d2, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2985, 0x8c8d, 0xbe53, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2985, 0x8c8d, 0xbe53, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe33, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc653, 0xb5f2,
-  0xb5f2, 0xc653, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673, 0xc674,
-  0xbe53, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xb5d2,
-  0x8c8d, 0x8cce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a6,
-  0x2944, 0x8c8d, 0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31c6, 0x31a5, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5d2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc673, 0xc674, 0xbe53, 0xbe33,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xb5d2, 0x8c8d, 0x8cce,
-  0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x2944, 0x8c8d,
-  0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5d2,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xc674, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674, 0xc673, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x848d, 0xb5d2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc673, 0xbe53, 0x8c8d, 0x2964, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2144, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xb5f2, 0xb5f2, 0xbe53,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0x2944, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53,
-  0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x2985,
-  0x2965, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53,
-  0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xbe53, 0x94ce, 0x848d,
-  0xb5d2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0x8c8d, 0x2964,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31c6, 0x31a5, 0xb5f2, 0xc674, 0xc673, 0xb5f2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc694, 0xb5f2, 0x31a5,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31c6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x8c8d, 0x2985, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xbe33, 0xbe53, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x8c8d, 0x3185, 0x31a6, 0xb5f2, 0xc674, 0xbe53,
-  0x94ce, 0x848d, 0xb5d2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xbe53,
-  0x8c8d, 0x2964, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2985,
-  0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x3185,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xbe33, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc673, 0xbe53, 0x8c8d, 0x2985, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2, 0xb5f2, 0xbe53,
-  0xc673, 0xbe53, 0x8c8d, 0x3185, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x31a6, 0x31a5, 0xb5f2,
-  0xc674, 0xc653, 0xbe33, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2964, 0x31a6, 0xb5f2,
-  0xc674, 0xc653, 0xc673, 0xc674, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8c8d, 0xb5d2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53, 0xc674, 0xc674,
-  0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x31a6,
-  0x31a5, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a5, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8c8d, 0x2964,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8c8d,
-  0xb5d2, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe33, 0xbe53,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xb5d2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0x8c8d, 0x2964, 0x31a6, 0xb5f2, 0xc674, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0x94ce, 0x8c8d, 0xb5d2, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xbe33, 0xbe53, 0xc674, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xb5f2, 0x31c6, 0x31c6, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5d2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc674, 0xb5f2, 0x31a6, 0x2964, 0x8c8d, 0xbe33, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xb5f2, 0x8c8d, 0x848d, 0x94ce, 0xbe53,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc674, 0xbe33, 0x94ce, 0x94ce, 0xbe53,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xbe33, 0xbe33, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc673, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5,
-  0xb5d2, 0xc674, 0xc673, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2964,
-  0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2, 0x8c8d,
-  0x848d, 0x94ce, 0xbe33, 0xc673, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xbe33,
-  0x94ce, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc673, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xadb1, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2103, 0x5ae8, 0xb5f2, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xadd1, 0x5ae8, 0x52c7, 0x8cad, 0xbe53,
-  0xc673, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xb612, 0x8cad, 0x8cce, 0xbe33,
-  0xc673, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0xbe33, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5d2, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2964, 0x848d, 0xbe53, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xb5f2, 0x8c8d, 0x8cce, 0xbe33, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xbe53, 0xbe33, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x2144,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a5, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2985, 0x2985, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x8c8d, 0xbe33, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31a5, 0x2124,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe12, 0x846d, 0x844c,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8cad, 0x8cce,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x8cad, 0xbe12,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe12, 0x94ee, 0xbe33,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6,
-  0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2144, 0xb5f2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x8c8d, 0xbe33, 0xc673, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x3185, 0x2985, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2985, 0x2985, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2965, 0x2944, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x8c8d, 0xbe33, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xbe12, 0x5b09, 0x5ae8, 0xbe12, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe13, 0xbe13, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2965, 0x18e3,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xadd2, 0x52a8, 0x4246,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xbe33, 0x5b09, 0x4a87, 0x52e8,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xb5f2, 0x52e8, 0x52c8, 0xadd1,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xbe12, 0x94ce, 0x7c2c, 0x6349, 0xbe13,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xbe53, 0xb5f2,
-  0xb5f2, 0xbe12, 0x94ce, 0x8cad, 0x8c8d, 0x94ce, 0xb5f2, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x31c6,
-  0x3185, 0x846d, 0x8cad, 0x8cad, 0x94ce, 0xbe12, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5f2, 0x2944,
-  0x2124, 0x7c2c, 0x8cce, 0xbe12, 0xbe53, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe12, 0xbe12, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x8c8d, 0xbe33, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xbe12, 0x5ae8, 0x5ae8, 0xbe12, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x3185, 0x2985, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2965, 0x2965, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2965, 0x2944, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2144, 0x2124, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xbe12, 0x5b09, 0x5ae8, 0xbe12, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xbe13, 0xbe13, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0xc653, 0xc673, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb5f2, 0x31c6, 0x2944,
-  0xc653, 0xbe53, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2965, 0x18e3,
-  0xb612, 0x94ee, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xadd2, 0x52a8, 0x4246,
-  0x94ce, 0x8c8d, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xbe33, 0x5b09, 0x4a87, 0x52e8,
-  0xb612, 0x8cad, 0x8cad, 0xbe12, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc673, 0xc674, 0xb5f2, 0x52e8, 0x52c8, 0xadd1,
-  0xbe33, 0x94ee, 0x848d, 0x94ce, 0xbe12, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xbe53, 0xbe12, 0x94ce, 0x7c2c, 0x6349, 0xbe13,
-  0xc673, 0xbe33, 0x94ce, 0x8c8d, 0x8cad, 0x94ce, 0xbe12, 0xb5f2,
-  0xb5f2, 0xbe12, 0x94ce, 0x8cad, 0x8c8d, 0x94ce, 0xb5f2, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x94ee, 0x8cad, 0x8cad, 0x846d, 0x3185,
-  0x3185, 0x846d, 0x8cad, 0x8cad, 0x94ce, 0xbe12, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe12, 0x8cce, 0x7c4c, 0x2124,
-  0x2124, 0x7c2c, 0x8cce, 0xbe12, 0xbe53, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe12, 0xbe12, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xbe12, 0x5ae8, 0x5ae8, 0xbe12, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2965, 0x2965, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2144, 0x2124, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xbe33, 0xbe33, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0x8cad, 0x94ce, 0xbe33, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb612, 0x31c6, 0x2944,
-  0x848d, 0x8cad, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb5f2, 0x2944, 0x18c3,
-  0x848d, 0x8cad, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xadb1, 0x2965, 0x18c3,
-  0x8cad, 0x8c8d, 0x94ce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xbe33, 0x5b29, 0x4246, 0x2985,
-  0xb612, 0x8cad, 0x8cad, 0xbe12, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xadd2, 0x52c8, 0x52c8, 0xadb1,
-  0xbe33, 0x94ee, 0x848d, 0x94ce, 0xbe12, 0xbe53, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xbe33, 0xadd2, 0x5b09, 0x4a67, 0x5b29, 0xbe33,
-  0xc673, 0xbe33, 0x94ce, 0x8c8d, 0x8cad, 0x94ce, 0xbe12, 0xb5f2,
-  0xb5f2, 0xadd2, 0x5b29, 0x52c8, 0x4a67, 0x5b09, 0xb5d2, 0xc674,
-  0xc653, 0xc673, 0xbe33, 0x94ee, 0x8cad, 0x8cad, 0x846d, 0x31a5,
-  0x2965, 0x52a8, 0x4a87, 0x52c8, 0x5b29, 0xb5d2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe12, 0x8cce, 0x7c4c, 0x2124,
-  0x18e3, 0x4246, 0x52c8, 0xadd1, 0xbe33, 0xc673, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb612, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xb612, 0xbe12, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0x52c8, 0x5b29, 0xbe12, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb612, 0x31c6, 0x2944,
-  0x4a67, 0x52c8, 0xbe12, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2945, 0x18c3,
-  0x4a67, 0x52c8, 0xadd1, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x2945, 0x18c3,
-  0x52c8, 0x4a87, 0x5b09, 0xbe33, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31c6, 0x18e3, 0x2965,
-  0xadd1, 0x52c8, 0x52a8, 0xadd1, 0xc674, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xad91, 0x2144, 0x2944, 0xa591,
-  0xbe33, 0x5b29, 0x4a67, 0x5b09, 0xadd1, 0xbe33, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x39c6, 0xb612,
-  0xc673, 0xb5f2, 0x5b09, 0x4a67, 0x52a7, 0x5b09, 0xadd1, 0xb5f2,
-  0xb5f2, 0xad91, 0x31c6, 0x2124, 0x18c3, 0x31a6, 0xadb1, 0xc673,
-  0xc673, 0xc674, 0xb5f2, 0x5b29, 0x52c8, 0x4a87, 0x52a8, 0x2985,
-  0x2945, 0x2945, 0x18e3, 0x2944, 0x39c6, 0xadb1, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe33, 0xadd1, 0x52c8, 0x4246, 0x2103,
-  0x18e3, 0x18c3, 0x2945, 0xa591, 0xb612, 0xc673, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb612, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xb612, 0xbe12, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0x52c8, 0x5b29, 0xbe12, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb612, 0x31c6, 0x2944,
-  0x4a67, 0x52a8, 0xbe12, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2945, 0x18c3,
-  0x4226, 0x3185, 0xad91, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x2945, 0x18c3,
-  0x2965, 0x18e3, 0x31a6, 0xb612, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31c6, 0x18e3, 0x2965,
-  0xa591, 0x2944, 0x2124, 0xad91, 0xc674, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xad91, 0x2144, 0x2944, 0xa591,
-  0xb612, 0x39c6, 0x18e3, 0x31a6, 0xad91, 0xb612, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x39c6, 0xb612,
-  0xc673, 0xadb1, 0x31a6, 0x18e3, 0x2124, 0x31a6, 0xad91, 0xb5f2,
-  0xb5f2, 0xad91, 0x31c6, 0x2124, 0x18c3, 0x31a6, 0xadb1, 0xc673,
-  0xc673, 0xc674, 0xadb1, 0x39c6, 0x2944, 0x18e3, 0x2945, 0x2965,
-  0x2965, 0x2945, 0x18e3, 0x2944, 0x39c6, 0xadb1, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xb612, 0xad91, 0x2945, 0x18c3, 0x18e3,
-  0x18e3, 0x18c3, 0x2945, 0xa591, 0xb612, 0xc673, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb612, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0x2944, 0x31c6, 0xb5f2, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb612, 0x31c6, 0x2944,
-  0x18c3, 0x2945, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2945, 0x18c3,
-  0x18c3, 0x2945, 0xad91, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x2945, 0x18c3,
-  0x2965, 0x18e3, 0x31a6, 0xb612, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31c6, 0x18e3, 0x2965,
-  0xa591, 0x2944, 0x2124, 0xad91, 0xc674, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xad91, 0x2144, 0x2944, 0xa591,
-  0xb612, 0x39c6, 0x18e3, 0x31a6, 0xad91, 0xb612, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x39c6, 0xb612,
-  0xc673, 0xadb1, 0x31a6, 0x18e3, 0x2124, 0x31a6, 0xad91, 0xb5f2,
-  0xb5f2, 0xad91, 0x31c6, 0x2124, 0x18c3, 0x31a6, 0xadb1, 0xc673,
-  0xc673, 0xc674, 0xadb1, 0x39c6, 0x2944, 0x18e3, 0x2945, 0x2965,
-  0x2965, 0x2945, 0x18e3, 0x2944, 0x39c6, 0xadb1, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xb612, 0xad91, 0x2945, 0x18c3, 0x18e3,
-  0x18e3, 0x18c3, 0x2945, 0xa591, 0xb612, 0xc673, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb612, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc674,
-  0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xb5f2, 0xb5f2,
-  0x2944, 0x31c6, 0xb5f2, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xb612, 0x31c6, 0x2944,
-  0x18c3, 0x2945, 0xb5f2, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x2945, 0x18c3,
-  0x18c3, 0x2945, 0xad91, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x2945, 0x18c3,
-  0x2965, 0x18e3, 0x31a6, 0xb612, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31c6, 0x18e3, 0x2965,
-  0xa591, 0x2944, 0x2124, 0xad91, 0xc674, 0xc674, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xad91, 0x2144, 0x2944, 0xa591,
-  0xb612, 0x39c6, 0x18e3, 0x31a6, 0xad91, 0xb612, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x39c6, 0xb612,
-  0xc673, 0xadb1, 0x31a6, 0x18e3, 0x2124, 0x31a6, 0xad91, 0xb5f2,
-  0xb5f2, 0xad91, 0x31c6, 0x2124, 0x18c3, 0x31a6, 0xadb1, 0xc673,
-  0xc673, 0xc674, 0xadb1, 0x39c6, 0x2944, 0x18e3, 0x2945, 0x2965,
-  0x2965, 0x2945, 0x18e3, 0x2944, 0x39c6, 0xadb1, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xb612, 0xad91, 0x2945, 0x18c3, 0x18e3,
-  0x18e3, 0x18c3, 0x2945, 0xa591, 0xb612, 0xc673, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x8c8d, 0xbe33, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x3185, 0x3185, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2124, 0x2124, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xbe33, 0xbe33, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xbe33, 0xbe33,
-  0x8ccd, 0x94ee, 0xbe33, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xbe53, 0x94ee, 0x8cce,
-  0x7c2c, 0x846d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x846d, 0x7c4c,
-  0x2124, 0x31a5, 0xb612, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xb612, 0x31a5, 0x2124,
-  0x2944, 0x2945, 0xad91, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xad91, 0x2945, 0x2944,
-  0xa591, 0x2945, 0x3185, 0xad91, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xad91, 0x3185, 0x2944, 0xa591,
-  0xb612, 0x39e6, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x39c6, 0xb612,
-  0xbe53, 0xb612, 0xad91, 0x3185, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2985, 0xad91, 0xb612, 0xc653,
-  0xc653, 0xc674, 0xbe53, 0x8cad, 0x846d, 0x844c, 0x844c, 0x844c,
-  0x844c, 0x844c, 0x844c, 0x846d, 0x8cad, 0xbe53, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe33, 0x8cce, 0x8c8d, 0x8cad,
-  0x8cad, 0x8c8d, 0x8cce, 0xbe12, 0xbe53, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xbe53, 0xbe53, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x8c8d, 0x848d, 0xb612, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x3185, 0x2944, 0x8cae, 0xbe53, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a5, 0xb5d2, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653, 0xc673, 0xc673,
-  0xbe53, 0xbe53, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xc674, 0xbe53, 0xbe53,
-  0x846d, 0x8c8d, 0xb5d2, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5d2, 0x8c8d, 0x846d,
-  0x2124, 0x2124, 0x2944, 0x2945, 0x2945, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x2945, 0x2945, 0x2944, 0x2124, 0x2124,
-  0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2945,
-  0xb5d2, 0x8c8d, 0x846d, 0x844c, 0x844c, 0x844c, 0x844c, 0x844c,
-  0x844c, 0x844c, 0x844c, 0x844c, 0x844c, 0x846d, 0x8c8d, 0xb5d2,
-  0xc673, 0xbe53, 0xbe33, 0x94ee, 0x8cce, 0x8cce, 0x8cce, 0x8cce,
-  0x8cce, 0x8cce, 0x8cce, 0x8cce, 0x94ee, 0xbe33, 0xbe53, 0xc674,
-  0xc653, 0xc673, 0xc673, 0xbe33, 0xbe33, 0xbe33, 0xbe33, 0xbe33,
-  0xbe33, 0xbe33, 0xbe33, 0xbe33, 0xbe33, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ee, 0x94ce, 0xbe33, 0xc674, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xb612, 0x846d, 0x846d, 0xadd1, 0xc653, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc674, 0xb612, 0x3185, 0x2104, 0x4207, 0xb612, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xb5d2, 0x3185, 0x31a5, 0xad91, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xbe53, 0x94ee, 0x8c8d, 0xb5d2, 0xc674, 0xc674, 0xc673,
-  0xc673, 0xc673, 0xc653, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe53, 0xc674, 0xbe33, 0xbe33, 0xbe33,
-  0xbe33, 0xbe33, 0xbe33, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xc674, 0xbe33, 0x94ee, 0x8cce, 0x8cce,
-  0x8cce, 0x8cce, 0x94ee, 0xbe33, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xb5d2, 0x8c8d, 0x7c4c, 0x7c4c, 0x844c,
-  0x844c, 0x7c4c, 0x7c4c, 0x848d, 0xb5d2, 0xb5f2, 0xb5f2, 0xb5f2,
-  0x2944, 0x2944, 0x2944, 0x2944, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2944, 0x2944, 0x2944,
-  0x2945, 0x2945, 0x2945, 0x2124, 0x2124, 0x2124, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x2124, 0x2124, 0x2124, 0x2944, 0x2945, 0x2945,
-  0xb5f2, 0xb5f2, 0xb5d2, 0x8c8d, 0x844c, 0x844c, 0x844c, 0x844c,
-  0x844c, 0x844c, 0x844c, 0x844c, 0x8c8d, 0xb5d2, 0xb5f2, 0xb5f2,
-  0xc673, 0xc674, 0xc674, 0xbe33, 0x94ee, 0x8cce, 0x8cce, 0x8cce,
-  0x8cce, 0x8cce, 0x8cce, 0x94ee, 0xbe33, 0xc674, 0xc674, 0xc674,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0xbe33, 0xbe33, 0xbe33,
-  0xbe33, 0xbe33, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc673, 0xb612, 0x4207, 0x31a5, 0xad91, 0xc674, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xad91, 0x3185, 0x31a5, 0xad91, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xbe53, 0x73ec, 0x2104, 0x3a07, 0xb612, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xad91, 0x3185, 0x31a5, 0xad91, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xb612, 0x4207, 0x31a6, 0xad91, 0xc694, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc673, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc674, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc674, 0xc694, 0xc694, 0xadb1, 0x31c6, 0x2944, 0x2945,
-  0x2945, 0x2944, 0x31a6, 0xad91, 0xc674, 0xc674, 0xc673, 0xc673,
-  0xbe33, 0xbe33, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x18e3, 0x2124,
-  0x2124, 0x18e3, 0x18e3, 0x31a6, 0xad91, 0xb5f2, 0xbe33, 0xbe53,
-  0x8cad, 0x846d, 0x31a5, 0x2944, 0x18e3, 0x18e3, 0x2985, 0x7c2c,
-  0x7c2c, 0x3185, 0x18e3, 0x18e3, 0x2944, 0x3185, 0x846d, 0x8cce,
-  0x8cce, 0x846d, 0x3185, 0x18c3, 0x18e3, 0x2124, 0x73cb, 0x844c,
-  0x844c, 0x73cb, 0x2124, 0x18e3, 0x18c3, 0x3185, 0x846d, 0x8cce,
-  0xbe33, 0xbe53, 0xadb1, 0x31a6, 0x18e3, 0x18e3, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x18e3, 0x18e3, 0x31a6, 0xad91, 0xbe53, 0xbe53,
-  0xc673, 0xc673, 0xc674, 0xadb1, 0x31c6, 0x2945, 0x2965, 0x2965,
-  0x2965, 0x2965, 0x2945, 0x31c6, 0xadb1, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc673, 0xb612, 0x4207, 0x31a5, 0xad91, 0xc674, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31a6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xad91, 0x31a6, 0x31a5, 0xa591, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xc674, 0x9d30, 0x2124, 0x3a07, 0xb612, 0xc673,
-  0xc653, 0xc674, 0xb5f2, 0x2944, 0x2144, 0xb5f2, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xad91, 0x31a6, 0x31a6, 0xad91, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb5f2, 0x31c6, 0x31a6, 0xb5f2, 0xc674, 0xc673,
-  0xc673, 0xb612, 0x4207, 0x31a5, 0xad91, 0xc694, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc673, 0xb5f2, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb5f2, 0xb5f2, 0xc674, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc673, 0xc694, 0xc694, 0xadb1, 0x31c6, 0x2944, 0x2944,
-  0x2944, 0x2944, 0x31a6, 0xad91, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xbe53, 0xb612, 0xad91, 0x31a6, 0x18e3, 0x18e3, 0x2944,
-  0x2944, 0x18e3, 0x18e3, 0x31a6, 0xad91, 0xb612, 0xbe53, 0xc673,
-  0xc674, 0xb5f2, 0x31a6, 0x2944, 0x18e3, 0x18e3, 0x31c6, 0xadb1,
-  0xadb1, 0x39c6, 0x18e3, 0x18e3, 0x2944, 0x31a6, 0xb5f2, 0xc674,
-  0xc674, 0xb5f2, 0x31a6, 0x18c3, 0x18e3, 0x2944, 0x9d30, 0xb612,
-  0xb612, 0x9d30, 0x2945, 0x18e3, 0x18c3, 0x31a6, 0xb5f2, 0xc674,
-  0xc653, 0xc673, 0xadb1, 0x31a6, 0x18e3, 0x18e3, 0x2945, 0x2944,
-  0x2944, 0x2945, 0x18e3, 0x18e3, 0x31a6, 0xadb1, 0xc673, 0xc673,
-  0xc653, 0xc673, 0xc674, 0xadb1, 0x31c6, 0x2945, 0x2945, 0x2945,
-  0x2945, 0x2945, 0x2945, 0x31c6, 0xadb1, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2,
-  0xb5f2, 0xb5f2, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xbe53, 0xb612, 0xb612, 0xc673, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe12, 0xb612, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe33, 0x634a, 0x5b09, 0xb5d2, 0xc674, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xbe12, 0x5b09, 0x5b09, 0xbe12, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xadd2, 0x5b09, 0x5b09, 0xadd1, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xb612, 0x52c8, 0x52c8, 0xb612, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xc674, 0xad91, 0x52c8, 0x6349, 0xbe12, 0xc673,
-  0xc653, 0xc674, 0xb612, 0x52c8, 0x52c8, 0xb612, 0xc674, 0xc673,
-  0xc653, 0xc673, 0xadd1, 0x5b09, 0x5b09, 0xadd1, 0xc673, 0xc653,
-  0xc653, 0xc674, 0xbe12, 0x5b29, 0x5b09, 0xbe12, 0xc674, 0xc673,
-  0xc673, 0xbe33, 0x634a, 0x5b09, 0xb5d2, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc673, 0xbe13, 0xbe13, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xb612, 0xbe13, 0xc673, 0xbe13, 0xb612, 0xb612,
-  0xb612, 0xb612, 0xbe12, 0xc674, 0xc674, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xb5d2, 0x5b29, 0x52c8, 0x52c8,
-  0x52c8, 0x52c8, 0x5b09, 0xb5d2, 0xc674, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xadd2, 0x5b09, 0x4a87, 0x4a87, 0x4aa7,
-  0x4aa7, 0x4a87, 0x4a87, 0x5b09, 0xadd1, 0xbe33, 0xc653, 0xc673,
-  0xc674, 0xbe12, 0x5b29, 0x52c8, 0x4a87, 0x4a87, 0x52c8, 0x844c,
-  0x844c, 0x52e8, 0x4a87, 0x4a87, 0x52c8, 0x5b09, 0xbe12, 0xc674,
-  0xc674, 0xbe12, 0x5b09, 0x4a67, 0x4a87, 0x52a7, 0x7c2c, 0x846d,
-  0x846d, 0x7c2c, 0x52a7, 0x4a87, 0x4a67, 0x5b09, 0xbe12, 0xc674,
-  0xc653, 0xc673, 0xb5d2, 0x5b29, 0x4a87, 0x4a87, 0x4aa7, 0x4aa7,
-  0x4aa7, 0x4aa7, 0x4a87, 0x4a87, 0x5b09, 0xb5d2, 0xc673, 0xc673,
-  0xc653, 0xc673, 0xc674, 0xb5d2, 0x5b29, 0x52c8, 0x52c8, 0x52c8,
-  0x52c8, 0x52c8, 0x52c8, 0x5b29, 0xb5d2, 0xc674, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xc673, 0xbe13, 0xb612, 0xbe12, 0xbe12,
-  0xbe12, 0xbe12, 0xb612, 0xbe13, 0xc673, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc674, 0xc674,
-  0xc674, 0xc674, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc674, 0xc674, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ee, 0x8cce, 0xbe12, 0xc673, 0xc653, 0xc653,
-  0xc653, 0xc673, 0xbe53, 0x94ce, 0x94ce, 0xbe33, 0xc673, 0xc673,
-  0xc653, 0xc673, 0xbe12, 0x94ce, 0x94ce, 0xbe12, 0xc673, 0xc653,
-  0xc653, 0xc673, 0xbe33, 0x8cad, 0x8cad, 0xbe33, 0xc673, 0xc673,
-  0xc653, 0xc673, 0xc673, 0xb612, 0x8cad, 0x94ee, 0xbe33, 0xc673,
-  0xc653, 0xc673, 0xbe33, 0x8cad, 0x8cad, 0xbe33, 0xc673, 0xc673,
-  0xc653, 0xc673, 0xbe12, 0x94ce, 0x94ce, 0xbe12, 0xc673, 0xc653,
-  0xc653, 0xc673, 0xbe53, 0x94ce, 0x94ce, 0xbe33, 0xc673, 0xc673,
-  0xc673, 0xbe53, 0x94ee, 0x94ce, 0xbe12, 0xc674, 0xc674, 0xc673,
-  0xc673, 0xc674, 0xc674, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe33, 0xbe33, 0xc673, 0xbe12, 0xb612, 0xbe33,
-  0xbe33, 0xb612, 0xbe12, 0xc674, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xc674, 0xb5d2, 0x5b09, 0x5ae8, 0x846d,
-  0x846d, 0x5ae8, 0x5b09, 0xb5d2, 0xc673, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xbe53, 0xb5f2, 0x5b09, 0x4a87, 0x4a87, 0x4aa7,
-  0x4aa7, 0x4a87, 0x4a87, 0x5b09, 0xb5f2, 0xbe53, 0xc653, 0xc673,
-  0xc673, 0xbe53, 0x94ce, 0x848d, 0x52c8, 0x4a87, 0x4a87, 0x4a87,
-  0x4a87, 0x4a87, 0x4a87, 0x52c8, 0x848d, 0x94ce, 0xbe33, 0xc674,
-  0xc673, 0xbe53, 0x94ce, 0x8c8d, 0x844c, 0x52c8, 0x4a87, 0x4a87,
-  0x4a87, 0x4a87, 0x52c8, 0x844c, 0x848d, 0x94ce, 0xbe33, 0xc674,
-  0xc653, 0xc673, 0xbe33, 0x94ce, 0x8c8d, 0x844c, 0x52c8, 0x4a87,
-  0x4a87, 0x52c8, 0x844c, 0x8c8d, 0x94ce, 0xbe12, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe33, 0x94ee, 0x8cce, 0x846d, 0x5b08,
-  0x5b08, 0x846d, 0x8cce, 0x94ce, 0xbe12, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0xbe33, 0xbe33, 0xbe12,
-  0xbe12, 0xbe33, 0xbe33, 0xbe33, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xc673, 0xc674,
-  0xc674, 0xc673, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2, 0xb5f2, 0xc673,
-  0xc673, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x31a6, 0x31a5, 0xad91,
-  0xadb1, 0x31a6, 0x31a5, 0xad91, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x18e3, 0x18e3, 0x2945,
-  0x2945, 0x18e3, 0x18e3, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x18e3, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x18e3, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xadb1, 0x31a6, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x31a6, 0xadb1, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xadb1, 0x31a6, 0x18e3,
-  0x18e3, 0x31a6, 0xadb1, 0xc674, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xadb1, 0x31a6,
-  0x31a6, 0xadb1, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2,
-  0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2, 0xb5f2, 0xc673,
-  0xc673, 0xb5f2, 0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xad91, 0x31a6, 0x31a5, 0xad91,
-  0xadb1, 0x31a6, 0x31a5, 0xad91, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x18e3, 0x18e3, 0x2945,
-  0x2945, 0x18e3, 0x18e3, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xb5f2, 0x31a6, 0x18e3, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x18e3, 0x31a6, 0xb5f2, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xadb1, 0x31a6, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x31a6, 0xadb1, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xadb1, 0x31a6, 0x18e3,
-  0x18e3, 0x31a6, 0xadb1, 0xc674, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xadb1, 0x31a6,
-  0x31a6, 0xadb1, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xb5f2,
-  0xb5f2, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xbe12, 0xb5f2, 0xc673,
-  0xc673, 0xb5f2, 0xbe12, 0xc673, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x52c8, 0x39c6, 0xad91,
-  0xadb1, 0x39c6, 0x52c8, 0xb5d2, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xbe12, 0x5ae8, 0x2124, 0x18e3, 0x2945,
-  0x2945, 0x18e3, 0x2104, 0x5ae8, 0xbe12, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc674, 0xbe12, 0x5b08, 0x2124, 0x18e3, 0x18e3,
-  0x18e3, 0x18e3, 0x2104, 0x5ae8, 0xbe12, 0xc674, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x52e8, 0x2124, 0x18e3,
-  0x18e3, 0x2124, 0x52e8, 0xb5d2, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xb5f2, 0x52e8, 0x2124,
-  0x2124, 0x52e8, 0xb5f2, 0xc674, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xb5f2, 0x5ae9,
-  0x5ae8, 0xb5d2, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc673, 0xbe13,
-  0xbe13, 0xc673, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xc674, 0xc653,
-  0xc653, 0xc674, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0xbe13, 0xc673,
-  0xc673, 0xbe13, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe32, 0x848d, 0x6329, 0xb5d2,
-  0xb5d2, 0x6349, 0x848d, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x8cad, 0x52c8, 0x4267, 0x52a8,
-  0x52a8, 0x4267, 0x52c8, 0x8cad, 0xbe53, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc673, 0xbe53, 0x8cad, 0x52a8, 0x2944, 0x2104,
-  0x2104, 0x2944, 0x52a7, 0x8cad, 0xbe53, 0xc673, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe32, 0x8c8d, 0x4a87, 0x2124,
-  0x2124, 0x4a87, 0x8c8d, 0xbe32, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8c8d, 0x52a7,
-  0x52a7, 0x8c8d, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8cae,
-  0x8cad, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xbe53, 0xc673,
-  0xc674, 0xbe53, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe12, 0x950e, 0xbe32,
-  0xbe33, 0x950e, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x94ce, 0x846c, 0x846d,
-  0x846d, 0x846c, 0x8cce, 0xbe33, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc673, 0xbe53, 0x8cae, 0x52c8, 0x2144,
-  0x2144, 0x52c8, 0x8cae, 0xbe53, 0xc673, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x846d, 0x2965,
-  0x2964, 0x846d, 0xbe32, 0xc673, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe33, 0x8c8d,
-  0x8c8d, 0xbe12, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xbe53,
-  0xbe53, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc673, 0xc673, 0xc673, 0xc673, 0xc673, 0xbe53, 0x8c8d, 0x2124,
-  0x2124, 0x8c8d, 0xbe53, 0xc673, 0xc673, 0xc673, 0xc673, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673, 0xb5d2, 0x31a6,
-  0x31a6, 0xb5d2, 0xc673, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xb5f2,
-  0xb5f2, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc674,
-  0xc674, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653,
-  0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc653, 0xc673
-};
-
-const Animation monochrom_smileyAnimation = {
-  .name = "Monochrom Smiley",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = monochrom_smileyDurations,
-  .animationFrames = monochrom_smileyFrames
-};
-#endif // ANIMATION_MONOCHROM_SMILEY_H
@@ -1,150 +0,0 @@
-// mtv.h - Auto-generated from mtv.json
-#ifndef ANIMATION_MTV_H
-#define ANIMATION_MTV_H
-
-#include "animation_types.h"
-
-// Frame Durations for mtv (in 100ms units)
-static const uint8_t PROGMEM mtvDurations[] = { 2, 2, 2, 2 };
-
-// RGB565 Frame Data for mtv
-static const uint16_t PROGMEM mtvFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xc820, 0x0000, 0x0000, 0xc820,
-  0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xc820, 0xc820, 0x0000, 0x0000, 0xc820,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0x055f, 0xfd40, 0xc820, 0xc820, 0xc820, 0x0000, 0x0000, 0xc820,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0xfd40, 0xfd40, 0x055f,
-  0x0000, 0xc820, 0xc820, 0xfd40, 0xc820, 0x0000, 0x0000, 0xc820,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc820, 0xc820, 0xc820, 0xfd40, 0xc820, 0x0000, 0xc820, 0xc820,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xc820, 0xfd40, 0xc820, 0xfd40, 0xc820, 0xc820, 0xc820, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xfd40, 0xc820, 0xfd40, 0x055f, 0xc820, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xfd40, 0xc820, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xfd40, 0xfd40, 0xfd40, 0x055f, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a0, 0x10a0, 0x1080, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1080, 0x10a0, 0x1080, 0x0801, 0x0000, 0x0000, 0x0000,
-  0xe720, 0xef40, 0xdea1, 0x712e, 0x0803, 0x0000, 0x0000, 0x0000,
-  0x2100, 0xd6a0, 0xef40, 0xdea2, 0x608f, 0x0001, 0x0000, 0x0000,
-  0xffe0, 0xffe0, 0xffe0, 0xeec3, 0x712e, 0x0803, 0x0000, 0x2100,
-  0xdec0, 0xffe0, 0xffe0, 0xf742, 0x7091, 0x0002, 0x0000, 0x0000,
-  0xffc0, 0xffc0, 0xffc0, 0xffe0, 0xeec3, 0x712e, 0x2901, 0xd6c0,
-  0xffe0, 0xffc0, 0xffe0, 0xf741, 0x6911, 0x0002, 0x0000, 0x0062,
-  0xffc0, 0xffc0, 0xffc0, 0xffe0, 0xffe0, 0xf741, 0xef40, 0xffe0,
-  0xffe0, 0xffc0, 0xffe0, 0xd765, 0x1cb9, 0x0042, 0x0062, 0x047a,
-  0xffc0, 0xffc0, 0xffc0, 0xf741, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xf741, 0xffc0, 0xdf64, 0x25bb, 0x04dd, 0x0062, 0x0062, 0x04dd,
-  0xffc0, 0xffe0, 0xef22, 0x89af, 0xdea2, 0xffe0, 0xffe0, 0xe6a3,
-  0x81ae, 0xcec6, 0x25ba, 0x157d, 0x04dc, 0x0062, 0x0042, 0x04dc,
-  0xffc0, 0xffe0, 0xf722, 0x6891, 0x28e2, 0xd6a0, 0xe6c1, 0x710e,
-  0x08a7, 0x0cfb, 0x159d, 0xc747, 0x151a, 0x0042, 0x00c4, 0x04fd,
-  0xffc0, 0xffe0, 0xf722, 0x68b1, 0x0002, 0x1080, 0x1080, 0x0043,
-  0x049a, 0x0d7d, 0x1d7c, 0xd785, 0x1519, 0x0127, 0x047a, 0x04fd,
-  0xffc0, 0xffe0, 0xf722, 0x68b1, 0x0002, 0x0000, 0x0000, 0x0042,
-  0x14b8, 0xc747, 0x2db9, 0xd745, 0x251b, 0x04fd, 0x047a, 0x00c4,
-  0xffc0, 0xffe0, 0xf722, 0x68b1, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x1102, 0xd703, 0x2dda, 0xdee4, 0x6974, 0x041a, 0x00c4, 0x0000,
-  0xffe0, 0xffe0, 0xf742, 0x70b1, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x1080, 0xd702, 0x4618, 0xdf04, 0x70b1, 0x0044, 0x0000, 0x0000,
-  0xe720, 0xef40, 0xdea2, 0x608f, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x1080, 0xd680, 0xdf02, 0xde82, 0x608f, 0x0001, 0x0000, 0x0000,
-  0x1080, 0x1080, 0x1080, 0x0801, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1080, 0x10a0, 0x1080, 0x0801, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1002, 0x1002, 0x1002, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1002, 0x1002, 0x1002, 0x0020, 0x0000, 0x0000, 0x0000,
-  0xe01c, 0xe81d, 0xd83b, 0x516a, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x2004, 0xd01a, 0xe81d, 0xd83b, 0x4188, 0x0020, 0x0000, 0x0000,
-  0xf81f, 0xf81f, 0xf81f, 0xe05c, 0x516a, 0x0040, 0x0000, 0x2004,
-  0xd81b, 0xf81f, 0xf81f, 0xf03e, 0x49a9, 0x0020, 0x0000, 0x0000,
-  0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xe05c, 0x516a, 0x2024, 0xd01a,
-  0xf81f, 0xf81f, 0xf81f, 0xe83d, 0x5a0b, 0x0020, 0x0000, 0x1082,
-  0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xe83d, 0xe81d, 0xf81f,
-  0xf81f, 0xf81f, 0xf81f, 0xf93f, 0xde5b, 0x1082, 0x1082, 0xd69a,
-  0xf81f, 0xf81f, 0xf81f, 0xe83d, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
-  0xe83d, 0xf81f, 0xf93f, 0xfeff, 0xef5d, 0x1082, 0x1082, 0xef5d,
-  0xf81f, 0xf81f, 0xe83d, 0x698d, 0xd83b, 0xf81f, 0xf81f, 0xd85b,
-  0x614c, 0xe95d, 0xfebf, 0xff7f, 0xe73c, 0x1082, 0x1082, 0xe73c,
-  0xf81f, 0xf81f, 0xe83d, 0x49a9, 0x2024, 0xd01a, 0xd83b, 0x516a,
-  0x2965, 0xe6fc, 0xff5f, 0xf9ff, 0xe69c, 0x10a2, 0x2124, 0xef5d,
-  0xf81f, 0xf81f, 0xe83d, 0x49a9, 0x0020, 0x1002, 0x1002, 0x10a2,
-  0xdebb, 0xff7f, 0xff1f, 0xf95f, 0xee9d, 0x39c7, 0xd6ba, 0xef5d,
-  0xf81f, 0xf81f, 0xe83d, 0x49a9, 0x0020, 0x0000, 0x0000, 0x10a2,
-  0xd61a, 0xf9ff, 0xfe7f, 0xf95f, 0xeebd, 0xef7d, 0xd6ba, 0x2124,
-  0xf81f, 0xf81f, 0xe83d, 0x49a9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x2084, 0xe8bd, 0xfebf, 0xe8fd, 0x6aad, 0xce79, 0x2124, 0x0000,
-  0xf81f, 0xf81f, 0xf03e, 0x49a9, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x1002, 0xe8bd, 0xfe1f, 0xf0fe, 0x49a9, 0x10a2, 0x0000, 0x0000,
-  0xe01c, 0xe81d, 0xd83b, 0x4188, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x1002, 0xd01a, 0xe89d, 0xd85b, 0x4188, 0x0000, 0x0000, 0x0000,
-  0x1002, 0x1002, 0x1002, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1002, 0x1002, 0x1002, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0801, 0x0801, 0x0801, 0x1002, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0801, 0x0801, 0x0801, 0x1002, 0x0000, 0x0000, 0x0000,
-  0x6012, 0x6012, 0x6813, 0xc019, 0x2004, 0x0000, 0x0000, 0x0000,
-  0x0802, 0x5811, 0x6012, 0x7013, 0xc819, 0x1002, 0x0000, 0x0000,
-  0x6814, 0x6814, 0x6814, 0x8016, 0xc019, 0x2004, 0x0000, 0x0802,
-  0x5811, 0x6814, 0x6814, 0x7815, 0xd81c, 0x1002, 0x0000, 0x0000,
-  0x6814, 0x6814, 0x6814, 0x6814, 0x8016, 0xc019, 0x2005, 0x5811,
-  0x6814, 0x6814, 0x6814, 0x7815, 0xd879, 0x1002, 0x0000, 0x1060,
-  0x6814, 0x6814, 0x6814, 0x6814, 0x6814, 0x7015, 0x6013, 0x6814,
-  0x6814, 0x6814, 0x6814, 0x80d1, 0xdc03, 0x1060, 0x1060, 0xd460,
-  0x6814, 0x6814, 0x6814, 0x7015, 0x6814, 0x6814, 0x6814, 0x6814,
-  0x7815, 0x6814, 0x80d1, 0xeca2, 0xece0, 0x1060, 0x1060, 0xecc0,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x7013, 0x6814, 0x6814, 0x8016,
-  0xc01b, 0x88d2, 0xe463, 0xf501, 0xe4c0, 0x1060, 0x1040, 0xe4c0,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x2005, 0x5810, 0x7013, 0xc019,
-  0x48c4, 0xe4a1, 0xf4e1, 0x894f, 0xdc61, 0x1060, 0x20c0, 0xece0,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x1002, 0x0001, 0x0801, 0x2062,
-  0xd480, 0xf501, 0xecc2, 0x80d1, 0xdc41, 0x3940, 0xd460, 0xece0,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x1002, 0x0000, 0x0000, 0x1060,
-  0xcc01, 0x894f, 0xe443, 0x80f1, 0xec44, 0xed00, 0xd460, 0x20c0,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x1002, 0x0000, 0x0000, 0x0000,
-  0x1041, 0x7071, 0xe463, 0x8093, 0xe8ba, 0xdc22, 0x20c0, 0x0000,
-  0x6814, 0x6814, 0x7815, 0xd81c, 0x1002, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x7071, 0xdc05, 0x8874, 0xd81c, 0x2042, 0x0000, 0x0000,
-  0x6012, 0x6012, 0x7013, 0xc819, 0x1002, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x5811, 0x6851, 0x7013, 0xc819, 0x1002, 0x0000, 0x0000,
-  0x0801, 0x0801, 0x0801, 0x1002, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0001, 0x0001, 0x0801, 0x1002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation mtvAnimation = {
-  .name = "Mtv",
-  .frameCount = 4,
-  .width = 16,
-  .height = 16,
-  .frameDurations = mtvDurations,
-  .animationFrames = mtvFrames
-};
-#endif // ANIMATION_MTV_H
@@ -1,1910 +0,0 @@
-// nemo.h - Auto-generated from nemo.json
-#ifndef ANIMATION_NEMO_H
-#define ANIMATION_NEMO_H
-
-#include "animation_types.h"
-
-// Frame Durations for nemo (in 100ms units)
-static const uint8_t PROGMEM nemoDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for nemo
-static const uint16_t PROGMEM nemoFrames[] = {
-  0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f,
-  0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f, 0x079f,
-  0x041f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f,
-  0x053f, 0x053f, 0x053f, 0x075f, 0x075f, 0x075f, 0x075f, 0x075f,
-  0x041f, 0x041f, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x06ff, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x06ff, 0x06ff, 0x06ff, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x069f, 0x069f, 0x069f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x063f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x05df, 0x041f, 0x05df, 0x053f, 0x05df,
-  0x053f, 0x053f, 0x053f, 0x041f, 0x041f, 0x053f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x057f, 0x057f, 0x041f, 0x057f, 0x053f, 0x057f,
-  0x053f, 0x053f, 0x053f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x04df, 0x04df,
-  0x04df, 0x04df, 0x041f, 0x04df, 0x04df, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x047f, 0x047f,
-  0x047f, 0x047f, 0x041f, 0x047f, 0x047f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x057f, 0x053f, 0x057f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x055f,
-  0x051f, 0x051f, 0x051f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x053f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x053f, 0x059f,
-  0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x04bf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x053f, 0x055f,
-  0x051f, 0x051f, 0x04ff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x04ff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x04bf,
-  0x04bf, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x045f, 0x045f,
-  0x045f, 0x045f, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x07dd, 0x17dc, 0x17dc, 0x17dc, 0x1fdc, 0x1fdc, 0x1fdc, 0x1fdc,
-  0x06df, 0x073f, 0x073f, 0x073f, 0x077f, 0x077f, 0x079d, 0x079c,
-  0x175c, 0x175c, 0x175c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f9c,
-  0x047f, 0x069f, 0x071f, 0x071f, 0x073f, 0x073d, 0x073c, 0x16fc,
-  0x159c, 0x157c, 0x1d9c, 0x1efc, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f1c,
-  0x03ff, 0x047f, 0x067f, 0x06df, 0x06fd, 0x06fc, 0x16dc, 0x159c,
-  0x155c, 0x1d5c, 0x1d5c, 0x1d9c, 0x1ebc, 0x1ebc, 0x1e7c, 0x1cdc,
-  0x041f, 0x045f, 0x049f, 0x04bd, 0x0e5c, 0x169c, 0x167c, 0x157c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1c9c, 0x1c9c, 0x1c5c,
-  0x045f, 0x045f, 0x047d, 0x0c7c, 0x14bc, 0x161c, 0x159c, 0x1d5c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c5c, 0x1c7c,
-  0x045e, 0x047d, 0x0c9c, 0x159c, 0x14bc, 0x1ddc, 0x1d7c, 0x1ddc,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1d1c, 0x1c7c, 0x147c,
-  0x047d, 0x0c7c, 0x157c, 0x159c, 0x149c, 0x1d7c, 0x1d5c, 0x1d9c,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c7c, 0x147c, 0x147c,
-  0x0c5c, 0x147c, 0x149c, 0x149c, 0x1c7c, 0x1c9c, 0x1d3c, 0x1d5c,
-  0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x147c,
-  0x147c, 0x147c, 0x147c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1cfc, 0x1d1c,
-  0x1d1c, 0x1cfc, 0x1c7c, 0x1cfc, 0x1cfc, 0x147c, 0x147c, 0x0c7c,
-  0x147c, 0x147c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1cbc, 0x1cbc,
-  0x1cbc, 0x1cbc, 0x1c7c, 0x14bc, 0x14bc, 0x147c, 0x0c7c, 0x047d,
-  0x147c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c7c, 0x1c7c,
-  0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x147c, 0x0c5c, 0x047d, 0x045f,
-  0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c,
-  0x1c1c, 0x141c, 0x141c, 0x141c, 0x041c, 0x041d, 0x041f, 0x041f,
-  0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc,
-  0x13dc, 0x13dc, 0x13dc, 0x0bdc, 0x03dd, 0x03df, 0x03bf, 0x03bf,
-  0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x141c,
-  0x141c, 0x141c, 0x041c, 0x041d, 0x041f, 0x041f, 0x03df, 0x03df,
-  0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x147c, 0x147c,
-  0x147c, 0x0c5c, 0x047d, 0x045e, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x07dd, 0x17dc, 0x17dc, 0x17dc, 0x1fdc, 0x1fdc, 0x1fdc, 0x1fdc,
-  0x06df, 0x073f, 0x073f, 0x073f, 0x077f, 0x077f, 0x079d, 0x079c,
-  0x175c, 0x175c, 0x175c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f9c,
-  0x047f, 0x069f, 0x071f, 0x071f, 0x073f, 0x073d, 0x073c, 0x16fc,
-  0x159c, 0x157c, 0x1d9c, 0x1efc, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f1c,
-  0x03ff, 0x047f, 0x067f, 0x06df, 0x06fd, 0x06fc, 0x16dc, 0x159c,
-  0x155c, 0x1d5c, 0x1d5c, 0x1d9c, 0x1ebc, 0x1ebc, 0x1e7c, 0x1cdc,
-  0x041f, 0x045f, 0x049f, 0x04bd, 0x0e5c, 0x169c, 0x167c, 0x157c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1c9c, 0x1c9c, 0x1c5c,
-  0x045f, 0x045f, 0x047d, 0x0c7c, 0x14bc, 0x161c, 0x159c, 0x1d5c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c5c, 0x1c7c,
-  0x045e, 0x047d, 0x0c9c, 0x159c, 0x14bc, 0x1ddc, 0x1d7c, 0x1ddc,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1d1c, 0x1c7c, 0x147c,
-  0x047d, 0x0c7c, 0x157c, 0x159c, 0x149c, 0x1d7c, 0x1d5c, 0x1d9c,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c7c, 0x147c, 0x147c,
-  0x0c5c, 0x147c, 0x149c, 0x149c, 0x1c7c, 0x1c9c, 0x1d3c, 0x1d5c,
-  0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x147c,
-  0x147c, 0x147c, 0x147c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1cfc, 0x1d1c,
-  0x1d1c, 0x1cfc, 0x1c7c, 0x1cfc, 0x1cfc, 0x147c, 0x147c, 0x0c7c,
-  0x147c, 0x147c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1cbc, 0x1cbc,
-  0x1cbc, 0x1cbc, 0x1c7c, 0x14bc, 0x14bc, 0x147c, 0x0c7c, 0x047d,
-  0x147c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c7c, 0x1c7c,
-  0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x147c, 0x0c5c, 0x047d, 0x045f,
-  0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c,
-  0x1c1c, 0x141c, 0x141c, 0x141c, 0x041c, 0x041d, 0x041f, 0x041f,
-  0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc,
-  0x13dc, 0x13dc, 0x13dc, 0x0bdc, 0x03dd, 0x03df, 0x03bf, 0x03bf,
-  0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x141c,
-  0x141c, 0x141c, 0x041c, 0x041d, 0x041f, 0x041f, 0x03df, 0x03df,
-  0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x147c, 0x147c,
-  0x147c, 0x0c5c, 0x047d, 0x045e, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fa,
-  0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x253a, 0x249a, 0x249a,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259a, 0x25ba,
-  0x257a, 0x257a, 0x255a, 0x249a, 0x249a, 0x24ba, 0x249a, 0x1c9b,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x255a, 0x257a,
-  0x255a, 0x255a, 0x24ba, 0x249a, 0x24ba, 0x249a, 0x1c9a, 0x2c99,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x251a, 0x253a,
-  0x253a, 0x251a, 0x24ba, 0x253a, 0x253a, 0x1c9b, 0x2c99, 0xd404,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x24da, 0x24da,
-  0x24da, 0x24da, 0x249a, 0x24da, 0x1cdb, 0x149b, 0x2478, 0xeaa1,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a,
-  0x249a, 0x249a, 0x249a, 0x1c9b, 0x149b, 0x0c9b, 0x1c3a, 0xd0e5,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x245a, 0x245a, 0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x043e, 0x13bd,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x1c1b, 0x141b, 0x0c1b, 0x041d, 0x041f, 0x03ff, 0x03df,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249b,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fa,
-  0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x253a, 0x249a, 0x3498,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259a, 0x25ba,
-  0x257a, 0x257a, 0x255a, 0x249a, 0x249a, 0x24bb, 0x44b6, 0xdd03,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x255a, 0x257a,
-  0x255a, 0x255a, 0x24ba, 0x249a, 0x24ba, 0x4497, 0xdd46, 0xfd82,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x251a, 0x253a,
-  0x253a, 0x251a, 0x24ba, 0x253a, 0x3538, 0xdc66, 0xff5a, 0xf71a,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x24da, 0x24da,
-  0x24da, 0x24da, 0x249a, 0x24fb, 0x2cb8, 0xeb04, 0xf678, 0xb1a5,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a,
-  0x249a, 0x249a, 0x249a, 0x1c9b, 0x2439, 0xd104, 0xfa81, 0xfb60,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x245a, 0x245a, 0x1c5b, 0x145b, 0x0c5b, 0x23b8, 0xd0e4, 0xea82,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x1c1b, 0x141b, 0x0c1b, 0x041d, 0x041f, 0x139d, 0x139d,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x041f, 0x03ff,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fb,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x34b8, 0x3498,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24bb, 0x4476, 0xdbe3, 0xebe2,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fa,
-  0x257a, 0x257a, 0x255a, 0x24bb, 0x4497, 0xdc46, 0xfb00, 0xfae0,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259a, 0x25ba,
-  0x257a, 0x257a, 0x253b, 0x44b6, 0xdd25, 0xde97, 0xf544, 0xfd00,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x255a, 0x257a,
-  0x255a, 0x255a, 0x44b7, 0xdd45, 0xfda3, 0xfef3, 0xff79, 0xfd82,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x251a, 0x253a,
-  0x253a, 0x3518, 0xdc66, 0xff5a, 0xf6f8, 0xfda6, 0xff5a, 0xfd83,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x24da, 0x24da,
-  0x24fb, 0x3498, 0xeb04, 0xf698, 0xb9e4, 0xf4c2, 0xd6d9, 0xf563,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a,
-  0x249b, 0x3439, 0xd904, 0xfa81, 0xf380, 0xf464, 0xc5d7, 0xf443,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x245a, 0x245b, 0x3bb7, 0xd8e3, 0xe2e4, 0xad98, 0xdb26, 0xfa60,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x1c1b, 0x141b, 0x1bd9, 0x13fb, 0x0c3f, 0x237a, 0xd0c5,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x047d, 0x045f, 0x041f, 0x03ff, 0x139d,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x3558, 0x34d8, 0x34b8, 0x249b,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x255b, 0x4536, 0xdc03, 0xebe2, 0xdbe4, 0x4476,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fa,
-  0x257a, 0x257b, 0x4557, 0xdc66, 0xfb00, 0xfae0, 0xfae0, 0xebe1,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259a, 0x25ba,
-  0x257b, 0x4556, 0xdd45, 0xde97, 0xf544, 0xfce0, 0xfc20, 0xfc41,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x255a, 0x257a,
-  0x4557, 0xdd65, 0xfda3, 0xfed3, 0xff7a, 0xfd62, 0xfd41, 0xfeb2,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x251a, 0x3518,
-  0xdc66, 0xff5a, 0xf6f8, 0xfda6, 0xff7a, 0xfd62, 0xfd02, 0xff9c,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x24db, 0x3498,
-  0xeb04, 0xf698, 0xb9e4, 0xf4c2, 0xd6da, 0xf4e2, 0xf9a2, 0xd63a,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x3439,
-  0xd904, 0xfa81, 0xf380, 0xf464, 0xc5d7, 0xf442, 0xfc80, 0xfc62,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x4397, 0xd8e3, 0xe2e4, 0xad98, 0xdb26, 0xfa80, 0xfbe0, 0xfba0,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x2bb9, 0x23f9, 0x143c, 0x2bb8, 0xd104, 0xea62, 0xe0e2,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5c, 0x045d, 0x045f, 0x13dd, 0x13dd, 0x139d,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25bb, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257b, 0x257b, 0x3558, 0x3d58, 0x34d8, 0x24ba, 0x249b,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257b, 0x257b, 0x4536, 0xdc03, 0xebe2, 0xdbe3, 0x4477, 0x249b,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fb,
-  0x259b, 0x4557, 0xdc66, 0xfb00, 0xfae0, 0xfae0, 0xdc03, 0x3cb9,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259b, 0x25bb,
-  0x4556, 0xdd45, 0xde97, 0xf544, 0xfce0, 0xfc00, 0xf463, 0xae3b,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x255a, 0x4557,
-  0xdd65, 0xfda3, 0xfed3, 0xff7a, 0xfd62, 0xfd41, 0xfed3, 0xffbe,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249a, 0x249b, 0x34f8, 0xdc66,
-  0xff5a, 0xf6f8, 0xfda6, 0xff7a, 0xfd62, 0xfd02, 0xf79c, 0xffdf,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x3498, 0xeb04,
-  0xf698, 0xb9e4, 0xf4c2, 0xd6da, 0xf4e2, 0xf981, 0xd65a, 0xcf3f,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x3439, 0xd904,
-  0xfa81, 0xf380, 0xf464, 0xc5d7, 0xf422, 0xfb80, 0xf404, 0xa61c,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x4397,
-  0xd8e3, 0xe2e4, 0xad98, 0xdb46, 0xfa80, 0xfa80, 0xd104, 0x23dc,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x33b8, 0x2bf9, 0x1c3b, 0x2bb7, 0xd8e4, 0xda84, 0x239b, 0x03bf,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x13fc, 0x13fd, 0x041f, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x047f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257b, 0x25bb, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257b, 0x257b, 0x3558, 0x3d58, 0x3558, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257b,
-  0x257b, 0x4536, 0xdc23, 0xebe2, 0xdc03, 0x4476, 0x249a, 0x249b,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259b, 0x25fb,
-  0x4577, 0xdc66, 0xfb00, 0xfae0, 0xfae0, 0xdc03, 0x3cb8, 0x3499,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24ba, 0x259a, 0x259b, 0x4596,
-  0xdd65, 0xde97, 0xf544, 0xfce0, 0xfc00, 0xf463, 0xb5f9, 0xe425,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x249a, 0x24ba, 0x4557, 0xdd65,
-  0xfda3, 0xfed3, 0xff7a, 0xfd62, 0xfd41, 0xfed3, 0xff5b, 0xfb62,
-  0x149b, 0x1c9b, 0x249a, 0x249a, 0x249b, 0x3478, 0xdc66, 0xff7a,
-  0xf6f8, 0xfda6, 0xff7a, 0xfd62, 0xfce2, 0xf79d, 0xff9d, 0xfd42,
-  0x1c9b, 0x249a, 0x249a, 0x249a, 0x249b, 0x3458, 0xeb04, 0xf698,
-  0xb9e4, 0xf4c2, 0xd6da, 0xf4e2, 0xf9a1, 0xd67a, 0xd6dc, 0xf402,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x3439, 0xd904, 0xfa81,
-  0xf380, 0xec64, 0xc5d7, 0xf442, 0xfc80, 0xf424, 0xad99, 0xf122,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x4397, 0xd8e3,
-  0xe2e4, 0xad98, 0xdb26, 0xfaa0, 0xeba2, 0xd124, 0x33fa, 0xd3c5,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x241a, 0x241a, 0x33b8,
-  0x33f9, 0x243b, 0x3bb7, 0xc106, 0x2bb8, 0x13bd, 0x03de, 0x13dd,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245b,
-  0x1c5b, 0x145b, 0x0c5b, 0x141b, 0x045f, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257b, 0x257b, 0x257b, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259b,
-  0x3558, 0x3558, 0x3558, 0x257a, 0x2d7a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x259b, 0x4536,
-  0xdc23, 0xec02, 0xdc23, 0x4d36, 0x6ddc, 0x2cbb, 0x249a, 0x249a,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25fb, 0x4577, 0xdc66,
-  0xfb00, 0xfae0, 0xfae0, 0xdc03, 0x44d9, 0x3539, 0x249a, 0x249b,
-  0x049c, 0x0cbb, 0x159b, 0x1d9b, 0x24db, 0x4596, 0xdd65, 0xde97,
-  0xf544, 0xfce0, 0xfc00, 0xf463, 0xb5f9, 0xd446, 0x4476, 0x1c9b,
-  0x0c9b, 0x149b, 0x1cbb, 0x24ba, 0x4497, 0xdd65, 0xfda3, 0xfed3,
-  0xff7a, 0xfd62, 0xfd41, 0xfed3, 0xff5c, 0xfb62, 0xd425, 0x3cb7,
-  0x149b, 0x1c9b, 0x249b, 0x3478, 0xdc46, 0xff5a, 0xf6f8, 0xfda6,
-  0xff7a, 0xfd62, 0xfce2, 0xf79d, 0xff9d, 0xf565, 0xde77, 0xed24,
-  0x1c9b, 0x249a, 0x249b, 0x3458, 0xeb04, 0xf698, 0xb9e4, 0xf4c2,
-  0xd6da, 0xf4e2, 0xf9a1, 0xd65a, 0xd6dc, 0xf465, 0xf6fa, 0xfb02,
-  0x249a, 0x249a, 0x249b, 0x3439, 0xd904, 0xfa81, 0xf380, 0xec64,
-  0xc5d7, 0xf442, 0xfc80, 0xf484, 0xad99, 0xe985, 0xc4f6, 0xe105,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x4397, 0xd8e3, 0xe2e4, 0xad98,
-  0xdb26, 0xfa80, 0xfbe0, 0xd404, 0x3457, 0xd384, 0xd146, 0x235a,
-  0x241a, 0x241a, 0x241a, 0x23fa, 0x241a, 0x33b8, 0x33f8, 0x2c3b,
-  0x4397, 0xd8e3, 0xdaa3, 0x2bf7, 0x041c, 0x141c, 0x139c, 0x03bf,
-  0x245a, 0x245a, 0x245a, 0x245a, 0x245a, 0x245b, 0x245b, 0x245a,
-  0x1c5b, 0x2419, 0x1c39, 0x045d, 0x045f, 0x041f, 0x041f, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0cbb, 0x049d, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x2f3a, 0x373b,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26ba, 0x2eba, 0x7e3c,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e5b, 0x2679, 0x2e58, 0x3578,
-  0x257b, 0x257b, 0x257a, 0x255a, 0x255a, 0x24da, 0x24ba, 0x2cbb,
-  0x045f, 0x049e, 0x049d, 0x0cbc, 0x3497, 0xdc24, 0xec02, 0xdc23,
-  0x4537, 0x257b, 0x257a, 0x2d7a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x049e, 0x049d, 0x0cdc, 0x35b7, 0xdc46, 0xfae0, 0xfae0, 0xfae0,
-  0xdc23, 0x3d58, 0x3d79, 0x75dc, 0x2cdb, 0x253b, 0x24bb, 0x249b,
-  0x049c, 0x0cbc, 0x3576, 0xdd65, 0xde97, 0xf544, 0xfce0, 0xfc00,
-  0xf463, 0xb619, 0xd446, 0x4c96, 0x249b, 0x3498, 0x3478, 0x1c9b,
-  0x0c9b, 0x34b7, 0xdd66, 0xfda3, 0xfed3, 0xff7a, 0xfd62, 0xfd41,
-  0xfed3, 0xff5c, 0xfb62, 0xd425, 0x5495, 0xdbe4, 0xdb03, 0x3c57,
-  0x2478, 0xd466, 0xff5a, 0xf6f8, 0xfda6, 0xff7a, 0xfd62, 0xfce2,
-  0xf79d, 0xff9d, 0xf565, 0xde97, 0xed04, 0xfae0, 0xfa80, 0xeac1,
-  0x3458, 0xeb24, 0xf698, 0xb9e4, 0xf4c2, 0xd6da, 0xf4e2, 0xf9a1,
-  0xd65a, 0xd6dc, 0xf465, 0xf71a, 0xfb02, 0xfa80, 0xfaa0, 0xfa80,
-  0x3438, 0xd904, 0xfa81, 0xf380, 0xec64, 0xc5d7, 0xf442, 0xfc80,
-  0xec84, 0xb599, 0xe985, 0xc4f7, 0xe124, 0xfa20, 0xfaa0, 0xeac2,
-  0x245a, 0x43b7, 0xd8e3, 0xe2e4, 0xad98, 0xdb26, 0xfa80, 0xfbe0,
-  0xebc1, 0x4c56, 0xdb84, 0xd146, 0x3b56, 0xd104, 0xd284, 0x2bda,
-  0x241a, 0x241a, 0x33b8, 0x33d8, 0x2c3b, 0x4397, 0xd904, 0xea62,
-  0xd924, 0x2bb8, 0x2419, 0x1bb9, 0x041c, 0x13bc, 0x13bd, 0x03df,
-  0x245a, 0x245a, 0x245b, 0x245b, 0x245a, 0x245a, 0x33f9, 0x3418,
-  0x2c19, 0x145b, 0x0c5c, 0x047d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x2fdb, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x2f7b, 0x6f9c, 0x2f9b,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x2f3a, 0x2f3a, 0x2f1a,
-  0x041f, 0x049f, 0x067f, 0x06df, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x2d9b, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x14db, 0x1e59, 0x2699, 0x1e7b, 0x259b,
-  0x257a, 0x2d9b, 0x765c, 0x2d7a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x047f, 0x049f, 0x2478, 0xd3e4, 0xec02, 0xdc23, 0x4557, 0x259b,
-  0x257b, 0x257a, 0x2d7a, 0x2d5a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x049e, 0x2499, 0xd446, 0xfb00, 0xfae0, 0xfae0, 0xdc23, 0x3dd8,
-  0x3579, 0x257a, 0x255a, 0x24bb, 0x249a, 0x253a, 0x249a, 0x249a,
-  0x2c98, 0xd546, 0xde97, 0xf544, 0xfce0, 0xfc00, 0xf463, 0xb619,
-  0xd446, 0x4516, 0x253a, 0x3499, 0x249a, 0x24ba, 0x249a, 0x1c9b,
-  0xed64, 0xfda4, 0xfef3, 0xff7a, 0xfd62, 0xfd41, 0xfed3, 0xff5c,
-  0xfb62, 0xdc25, 0x54b5, 0xcc26, 0x4476, 0x249a, 0x1c9b, 0x149b,
-  0xffbd, 0xf6d8, 0xfda6, 0xff7a, 0xfd62, 0xfce2, 0xf79d, 0xff9d,
-  0xf565, 0xde97, 0xed24, 0xfc20, 0xdc23, 0x2c99, 0x149b, 0x0c9b,
-  0xf6fa, 0xb9e4, 0xf4c2, 0xd6da, 0xf4e2, 0xf9a1, 0xd65a, 0xd6dc,
-  0xf465, 0xf71a, 0xfc62, 0xfc00, 0xec01, 0x2c99, 0x0c9c, 0x049d,
-  0xfac1, 0xf380, 0xec64, 0xc5d7, 0xf442, 0xfc80, 0xf484, 0xb599,
-  0xe985, 0xc537, 0xe344, 0xfbc0, 0xdc24, 0x1c99, 0x049d, 0x049e,
-  0xe8a1, 0xe2e4, 0xad98, 0xdb26, 0xfa80, 0xfbe0, 0xdc04, 0x4c57,
-  0xdb84, 0xd146, 0x4bb5, 0xc306, 0x2c37, 0x045d, 0x045e, 0x041f,
-  0x33b8, 0x33f9, 0x2c3b, 0x4396, 0xd8e3, 0xdaa3, 0x43f7, 0x241a,
-  0x3418, 0x2bb8, 0x141b, 0x1bf9, 0x041d, 0x041f, 0x03ff, 0x03bf,
-  0x245b, 0x245b, 0x245a, 0x245a, 0x33f8, 0x3438, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249b, 0x249b, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x17fb, 0x1fdb, 0x1fdb, 0x27da, 0x2fdb, 0x77bc, 0x2fdb, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x179b,
-  0x677c, 0x275b, 0x275a, 0x277a, 0x277a, 0x2f7a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x25bb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06df, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x14bc, 0x1cda, 0x1e59, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x247a, 0xd3e4, 0xebe2, 0xdc43, 0x3df7, 0x259b, 0x259b,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x24ba, 0xd446, 0xfb00, 0xfae0, 0xfae0, 0xdc23, 0x3d78, 0x35d9,
-  0x257a, 0x257a, 0x255a, 0x24bb, 0x249a, 0x253a, 0x249a, 0x249a,
-  0xe544, 0xde97, 0xf544, 0xfce0, 0xfc00, 0xf463, 0xb619, 0xd466,
-  0x4516, 0x257a, 0x3538, 0x34b8, 0x249a, 0x2cdb, 0x249a, 0x1c9b,
-  0xfda4, 0xfed3, 0xff7a, 0xfd62, 0xfd41, 0xfed3, 0xff5c, 0xfb62,
-  0xdc45, 0x5535, 0xdc64, 0xdd03, 0x4cd7, 0x6dbc, 0x24bb, 0x149b,
-  0xf6d7, 0xfdc6, 0xff7a, 0xfd62, 0xfd02, 0xf79d, 0xff9d, 0xf565,
-  0xde97, 0xed64, 0xfd20, 0xfd20, 0xdd23, 0x34b9, 0x149b, 0x0c9b,
-  0xb142, 0xf4e2, 0xd6da, 0xf4e2, 0xf981, 0xd67a, 0xd6dc, 0xf465,
-  0xf73a, 0xfd62, 0xfd20, 0xfd40, 0xed21, 0x2499, 0x0c9c, 0x049d,
-  0xf380, 0xf464, 0xc5d7, 0xf422, 0xfb80, 0xf404, 0xb599, 0xe985,
-  0xc557, 0xe464, 0xfd00, 0xfd40, 0xdd24, 0x1c99, 0x049d, 0x049e,
-  0xe324, 0xad77, 0xdb46, 0xfa80, 0xeaa2, 0xd904, 0x4c17, 0xdb84,
-  0xd145, 0x53d5, 0xdc44, 0xdce3, 0x2c77, 0x045d, 0x045e, 0x041f,
-  0x33f9, 0x2c3b, 0x4396, 0xc905, 0x4396, 0x33b9, 0x23fa, 0x3418,
-  0x33b8, 0x1c1b, 0x2419, 0x1c19, 0x041d, 0x041f, 0x03ff, 0x03bf,
-  0x245b, 0x245a, 0x245a, 0x33f9, 0x245a, 0x245b, 0x245a, 0x245b,
-  0x1c5b, 0x145b, 0x0c5c, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249b, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06df, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x145d, 0x14bc, 0x14db, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x243a, 0xd3e4, 0xebe2, 0xdbe4, 0x34d7, 0x1e3b, 0x25bb, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x2cbb, 0x249a,
-  0xe424, 0xfb00, 0xfae0, 0xfae0, 0xdc03, 0x3dd8, 0x3579, 0x25fb,
-  0x257b, 0x257a, 0x255a, 0x24ba, 0x249a, 0x2d5b, 0x75dc, 0x2cbb,
-  0xdeb9, 0xf544, 0xfce0, 0xfc00, 0xf463, 0xb619, 0xd446, 0x4576,
-  0x257a, 0x3558, 0x255a, 0x249a, 0x249a, 0x24ba, 0x2cbb, 0x1c9b,
-  0xf6f5, 0xff79, 0xfd62, 0xfd41, 0xfed3, 0xff5c, 0xfb62, 0xdc45,
-  0x5534, 0xcc45, 0x4496, 0x24ba, 0x24ba, 0x249a, 0x1c9b, 0x149b,
-  0xfda4, 0xff7a, 0xfd62, 0xfce2, 0xf79d, 0xff9d, 0xf565, 0xde97,
-  0xed24, 0xfc00, 0xdc23, 0x3538, 0x253a, 0x1c9b, 0x149b, 0x0c9b,
-  0xf542, 0xd6d9, 0xf4e2, 0xf9a1, 0xd67a, 0xd6dc, 0xf465, 0xf71a,
-  0xfc62, 0xfc00, 0xec21, 0x3cd8, 0x251b, 0x149b, 0x0c9b, 0x049d,
-  0xec85, 0xc5b7, 0xf442, 0xfc80, 0xf424, 0xb599, 0xe985, 0xc537,
-  0xe344, 0xfbc0, 0xdc04, 0x34b9, 0x65bd, 0x14bb, 0x049d, 0x049e,
-  0xadba, 0xdb26, 0xfaa0, 0xfba0, 0xd924, 0x4c17, 0xdb84, 0xd145,
-  0x53b5, 0xcb06, 0x3c37, 0x145b, 0x147b, 0x045d, 0x045e, 0x041f,
-  0x2c3b, 0x4397, 0xd8e3, 0xdaa3, 0x43b7, 0x241a, 0x3418, 0x33b8,
-  0x23fa, 0x2bf9, 0x141b, 0x0c1b, 0x041c, 0x041f, 0x03ff, 0x03bf,
-  0x245a, 0x245a, 0x33f8, 0x3438, 0x245a, 0x245a, 0x245b, 0x245b,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249b, 0x249b, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x2f7a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x2f3a, 0x777c, 0x371b,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x2eda, 0x2e9a, 0x24fa,
-  0x145c, 0x145c, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0xebe2, 0xdbe4, 0x2c78, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0xfae0, 0xfae0, 0xdc23, 0x35b9, 0x2cd9, 0x25fb, 0x259b, 0x25fb,
-  0x259b, 0x257a, 0x255a, 0x24ba, 0x249a, 0x253a, 0x24ba, 0x249a,
-  0xfce0, 0xfc20, 0xf463, 0xb619, 0xd446, 0x4576, 0x259b, 0x3598,
-  0x3538, 0x257a, 0x255a, 0x249a, 0x2cbb, 0x24ba, 0x249a, 0x1c9b,
-  0xfd40, 0xfd41, 0xfed3, 0xff5c, 0xfb62, 0xdc45, 0x5555, 0xdc04,
-  0xdb03, 0x44f6, 0x24ba, 0x2cbb, 0x75dc, 0x2cbb, 0x1c9b, 0x149b,
-  0xfd20, 0xfd02, 0xf79d, 0xff9d, 0xf565, 0xde97, 0xed04, 0xfae0,
-  0xfa80, 0xdae3, 0x3478, 0x253a, 0x2d5a, 0x1cbb, 0x149b, 0x0c9b,
-  0xfca0, 0xf1a2, 0xd65a, 0xd6dc, 0xf465, 0xf71a, 0xfb02, 0xfa80,
-  0xfa80, 0xeaa1, 0x3478, 0x24db, 0x1cdb, 0x149b, 0x0c9b, 0x049d,
-  0xfc00, 0xfc80, 0xec84, 0xb599, 0xe985, 0xc4f7, 0xe124, 0xfa20,
-  0xfa80, 0xdae4, 0x3478, 0x1c9b, 0x149b, 0x0c9b, 0x049d, 0x049e,
-  0xfa80, 0xfbe0, 0xebc1, 0x4c56, 0xdb84, 0xd145, 0x5355, 0xd904,
-  0xdaa3, 0x4417, 0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f,
-  0xe8c2, 0xea62, 0xd924, 0x33b8, 0x3419, 0x33b8, 0x241a, 0x33b8,
-  0x33f8, 0x1c1b, 0x141b, 0x0c1b, 0x041d, 0x041f, 0x03ff, 0x03bf,
-  0x33f8, 0x3418, 0x33f8, 0x243a, 0x245b, 0x245b, 0x245a, 0x245b,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249b, 0x249b, 0x249b, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x2f9b, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x2efa, 0x777c, 0x2f3a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x2eba, 0x2eda, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x0cbe, 0x149b, 0x0cdb, 0x15bb, 0x1cdb, 0x25fa, 0x259a, 0x25fa,
-  0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x253a, 0x249a, 0x249a,
-  0xae1b, 0xd446, 0x3556, 0x1d9b, 0x34b9, 0x259a, 0x259b, 0x25ba,
-  0x257a, 0x257a, 0x255a, 0x249a, 0x249a, 0x24ba, 0x249a, 0x1c9b,
-  0xf75c, 0xfb82, 0xd445, 0x54b5, 0xcc26, 0x44b6, 0x255b, 0x257a,
-  0x255a, 0x255a, 0x24ba, 0x249a, 0x24ba, 0x249a, 0x1c9b, 0x149b,
-  0xff9c, 0xfd65, 0xde97, 0xed24, 0xfc00, 0xdc23, 0x3518, 0x253a,
-  0x253a, 0x251a, 0x24ba, 0x253a, 0x253a, 0x1c9b, 0x149b, 0x0c9b,
-  0xd6bb, 0xf465, 0xf71a, 0xfc62, 0xfc00, 0xec21, 0x3cd8, 0x24db,
-  0x24da, 0x24da, 0x249a, 0x24da, 0x1cdb, 0x149b, 0x0c9b, 0x049d,
-  0xadbb, 0xe985, 0xc537, 0xe344, 0xfbc0, 0xdc23, 0x3498, 0x249b,
-  0x249a, 0x249a, 0x249a, 0x1c9b, 0x149b, 0x0c9b, 0x049d, 0x049e,
-  0x3c59, 0xdb84, 0xd145, 0x53b5, 0xcb06, 0x4416, 0x245a, 0x245a,
-  0x245a, 0x245a, 0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f,
-  0x241a, 0x3418, 0x33b8, 0x23fa, 0x33f9, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x1c1b, 0x141b, 0x0c1b, 0x041d, 0x041f, 0x03ff, 0x03bf,
-  0x245a, 0x245b, 0x245b, 0x245a, 0x245b, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x075f, 0x073f, 0x073f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x0ffb, 0x17db, 0x1fdb, 0x27da, 0x27da, 0x27da, 0x27da, 0x27db,
-  0x06df, 0x06ff, 0x071f, 0x073f, 0x075f, 0x077f, 0x079d, 0x0f9b,
-  0x177b, 0x1f5b, 0x275a, 0x277a, 0x277a, 0x277a, 0x277a, 0x279a,
-  0x047f, 0x067f, 0x06ff, 0x071f, 0x073f, 0x073d, 0x0f3b, 0x171b,
-  0x1dbb, 0x259a, 0x25ba, 0x26fa, 0x273a, 0x273a, 0x273a, 0x271a,
-  0x041f, 0x049f, 0x067f, 0x06de, 0x06fd, 0x0efb, 0x16db, 0x1dbb,
-  0x257a, 0x257a, 0x257a, 0x25ba, 0x26ba, 0x26da, 0x269a, 0x24fa,
-  0x045f, 0x045f, 0x04be, 0x04dd, 0x0e7b, 0x16bb, 0x1e7b, 0x259a,
-  0x257a, 0x257a, 0x257a, 0x257a, 0x255a, 0x24da, 0x24ba, 0x249a,
-  0x045f, 0x049e, 0x049d, 0x0cbb, 0x14db, 0x1e3b, 0x25ba, 0x257a,
-  0x257a, 0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x249a, 0x249a,
-  0x049e, 0x049d, 0x0cdb, 0x15bb, 0x1cdb, 0x25da, 0x259a, 0x25fa,
-  0x257a, 0x257a, 0x255a, 0x24ba, 0x249a, 0x253a, 0x249a, 0x249a,
-  0x147a, 0x0cbb, 0x2579, 0x2db9, 0x24ba, 0x259a, 0x259a, 0x25ba,
-  0x257a, 0x257a, 0x255a, 0x249a, 0x249a, 0x24ba, 0x249a, 0x1c9b,
-  0xd446, 0x4c95, 0xdc64, 0xdd23, 0x44b6, 0x24ba, 0x255a, 0x257a,
-  0x255a, 0x255a, 0x24ba, 0x249a, 0x24ba, 0x249a, 0x1c9b, 0x149b,
-  0xdeba, 0xed44, 0xfd20, 0xfd20, 0xdd23, 0x34b8, 0x251a, 0x253a,
-  0x253a, 0x251a, 0x24ba, 0x253a, 0x253a, 0x1c9b, 0x149b, 0x0c9b,
-  0xef9d, 0xfd62, 0xfd20, 0xfd40, 0xed21, 0x34b8, 0x24db, 0x24da,
-  0x24da, 0x24da, 0x249a, 0x24da, 0x1cdb, 0x149b, 0x0c9b, 0x049d,
-  0xbdb9, 0xe464, 0xfd00, 0xfd40, 0xdd24, 0x3498, 0x249b, 0x249a,
-  0x249a, 0x249a, 0x249a, 0x1c9b, 0x149b, 0x0c9b, 0x049d, 0x049e,
-  0xd106, 0x53d5, 0xdc44, 0xdce3, 0x4477, 0x243a, 0x245a, 0x245a,
-  0x245a, 0x245a, 0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f,
-  0x33b8, 0x23fa, 0x3418, 0x3418, 0x241a, 0x241a, 0x241a, 0x241a,
-  0x241a, 0x1c1b, 0x141b, 0x0c1b, 0x041d, 0x041f, 0x03ff, 0x03bf,
-  0x245b, 0x245a, 0x245b, 0x245b, 0x245a, 0x245a, 0x245a, 0x245a,
-  0x1c5b, 0x145b, 0x0c5b, 0x045d, 0x045e, 0x041f, 0x03ff, 0x03df,
-  0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x249a, 0x1c9b,
-  0x149b, 0x0c9b, 0x049c, 0x049e, 0x045f, 0x045f, 0x041f, 0x041f,
-  0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x07dd, 0x17dc, 0x17dc, 0x17dc, 0x1fdc, 0x1fdc, 0x1fdc, 0x1fdc,
-  0x06df, 0x073f, 0x073f, 0x073f, 0x077f, 0x077f, 0x079d, 0x079c,
-  0x175c, 0x175c, 0x175c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f9c,
-  0x047f, 0x069f, 0x071f, 0x071f, 0x073f, 0x073d, 0x073c, 0x16fc,
-  0x159c, 0x157c, 0x1d9c, 0x1efc, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f1c,
-  0x03ff, 0x047f, 0x067f, 0x06df, 0x06fd, 0x06fc, 0x0edc, 0x159c,
-  0x155c, 0x1d5c, 0x1d5c, 0x1d9c, 0x1ebc, 0x1ebc, 0x1e7c, 0x1cdc,
-  0x041f, 0x045f, 0x047f, 0x04bd, 0x0e5c, 0x0e9c, 0x167c, 0x157c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1c9c, 0x1c9c, 0x1c5c,
-  0x045f, 0x045f, 0x045d, 0x0c7c, 0x0cbc, 0x15dc, 0x157c, 0x1d5c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c5c, 0x1c7c,
-  0x045e, 0x047e, 0x049c, 0x159c, 0x14bc, 0x15dc, 0x1d7c, 0x1ddc,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1d1c, 0x1c7c, 0x147c,
-  0x045d, 0x147b, 0x0d7c, 0x157c, 0x149c, 0x1d7c, 0x1d5c, 0x1d9c,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c5c, 0x1c7c, 0x147c, 0x147c,
-  0x2c78, 0xc426, 0x3478, 0x147c, 0x1c5c, 0x1c9c, 0x1d3c, 0x1d5c,
-  0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x0c7c,
-  0xece2, 0xfc20, 0xdc04, 0x2c5a, 0x147c, 0x1c7c, 0x1cfc, 0x1d1c,
-  0x1d1c, 0x1cfc, 0x1c7c, 0x1cfc, 0x14fc, 0x147c, 0x0c7c, 0x045c,
-  0xfc00, 0xfc00, 0xec01, 0x2c59, 0x147c, 0x1c7c, 0x1cbc, 0x1cbc,
-  0x1cbc, 0x1cbc, 0x1c7c, 0x14bc, 0x14bc, 0x0c7c, 0x045c, 0x047d,
-  0xeae2, 0xfbc0, 0xdc04, 0x2c5a, 0x145c, 0x1c5c, 0x1c7c, 0x1c7c,
-  0x1c7c, 0x1c7c, 0x147c, 0x147c, 0x0c5c, 0x045c, 0x045d, 0x045f,
-  0x3bd7, 0xcb06, 0x3bf7, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c,
-  0x1c1c, 0x141c, 0x141c, 0x141c, 0x041c, 0x041d, 0x041f, 0x041f,
-  0x1bdc, 0x2bba, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc,
-  0x13dc, 0x13dc, 0x13dc, 0x0bdc, 0x03dd, 0x03df, 0x03bf, 0x03bf,
-  0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x141c,
-  0x141c, 0x141c, 0x041d, 0x041d, 0x041f, 0x03ff, 0x03df, 0x03df,
-  0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x147c, 0x147c,
-  0x0c5c, 0x0c5c, 0x045d, 0x045e, 0x045f, 0x041f, 0x041f, 0x03ff,
-  0x077f, 0x077f, 0x077f, 0x077f, 0x079f, 0x07df, 0x07df, 0x07dd,
-  0x07dc, 0x17dc, 0x17dc, 0x1fdc, 0x1fdc, 0x1fdc, 0x1fdc, 0x1fdc,
-  0x06df, 0x073f, 0x073f, 0x073f, 0x077f, 0x077f, 0x079d, 0x079c,
-  0x175c, 0x175c, 0x1f5c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f7c, 0x1f9c,
-  0x047f, 0x067f, 0x071f, 0x071f, 0x073f, 0x073d, 0x073c, 0x16fc,
-  0x159c, 0x1d7c, 0x1d9c, 0x1efc, 0x1f3c, 0x1f3c, 0x1f3c, 0x1f1c,
-  0x03ff, 0x047f, 0x067f, 0x06df, 0x06fd, 0x06fc, 0x16dc, 0x159c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d9c, 0x1ebc, 0x1ebc, 0x1e7c, 0x1cdc,
-  0x041f, 0x045f, 0x049f, 0x04bd, 0x0e5c, 0x169c, 0x167c, 0x1d7c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1d5c, 0x1c9c, 0x1c9c, 0x1c7c,
-  0x045f, 0x045f, 0x047d, 0x0c7c, 0x14bc, 0x161c, 0x1d7c, 0x1d5c,
-  0x1d5c, 0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c5c, 0x1c7c,
-  0x045f, 0x047e, 0x0c9c, 0x159c, 0x14bc, 0x1ddc, 0x1d7c, 0x1ddc,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1d1c, 0x1c7c, 0x1c7c,
-  0x1c5b, 0x1c5a, 0x157c, 0x157c, 0x1c9c, 0x1d7c, 0x1d5c, 0x1d9c,
-  0x1d5c, 0x1d5c, 0x1d3c, 0x1c7c, 0x1c7c, 0x1c7c, 0x1c7c, 0x147c,
-  0xebc2, 0xdb04, 0x3458, 0x1c7c, 0x1c7c, 0x1c9c, 0x1d3c, 0x1d5c,
-  0x1d5c, 0x1d3c, 0x1c9c, 0x1c7c, 0x1c7c, 0x1c7c, 0x147c, 0x147c,
-  0xfaa0, 0xfa80, 0xdae4, 0x2c3a, 0x147c, 0x1c7c, 0x1cfc, 0x1d1c,
-  0x1d1c, 0x1cfc, 0x1c7c, 0x1cfc, 0x1cfc, 0x147c, 0x147c, 0x0c7c,
-  0xfaa0, 0xfa80, 0xeaa1, 0x2c39, 0x147c, 0x1c7c, 0x1cbc, 0x1cbc,
-  0x1cbc, 0x1cbc, 0x1c7c, 0x1cbc, 0x14bc, 0x147c, 0x0c7c, 0x047d,
-  0xfa60, 0xfa80, 0xdae4, 0x2c3a, 0x145c, 0x1c5c, 0x1c7c, 0x1c7c,
-  0x1c7c, 0x1c7c, 0x1c5c, 0x147c, 0x147c, 0x0c5c, 0x047d, 0x045f,
-  0xe8a2, 0xda84, 0x3bd8, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c,
-  0x1c1c, 0x1c1c, 0x141c, 0x141c, 0x0c1c, 0x041d, 0x041f, 0x041f,
-  0x2b7a, 0x2bba, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc, 0x1bdc,
-  0x1bdc, 0x13dc, 0x13dc, 0x0bdc, 0x03dd, 0x03df, 0x03bf, 0x03bf,
-  0x1c3c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c, 0x1c1c,
-  0x141c, 0x141c, 0x0c1c, 0x041d, 0x041f, 0x041f, 0x03df, 0x03df,
-  0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x1c5c, 0x147c,
-  0x147c, 0x0c5c, 0x047d, 0x045e, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x057f, 0x053f, 0x057f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x055f,
-  0x051f, 0x051f, 0x051f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x053f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x053f, 0x059f,
-  0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x04bf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x053f, 0x055f,
-  0x051f, 0x051f, 0x04ff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x04ff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x04bf,
-  0x04bf, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x045f, 0x045f,
-  0x045f, 0x045f, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x057f, 0x053f, 0x057f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x055f,
-  0x051f, 0x051f, 0x051f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x053f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x053f, 0x059f,
-  0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x04bf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x053f, 0x055f,
-  0x051f, 0x051f, 0x04ff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x04ff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x04bf,
-  0x04bf, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x045f, 0x045f,
-  0x045f, 0x045f, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x057f, 0x053f, 0x057f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x055f,
-  0x051f, 0x051f, 0x051f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x053f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x053f, 0x059f,
-  0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x04bf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x053f, 0x055f,
-  0x051f, 0x051f, 0x04ff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x04ff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x04bf,
-  0x04bf, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x045f, 0x045f,
-  0x045f, 0x045f, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x0bff, 0x0bff, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x035f, 0x0b9f, 0x8dff, 0x95ff, 0x0b9f, 0x035f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x0bff, 0x8e1f, 0x8e1f, 0x0bff, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x03ff, 0x041f, 0x0c3f, 0x0c3f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x0d7f, 0x0d3f, 0x0d7f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x0d5f,
-  0x0d1f, 0x0d1f, 0x0d1f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x0d3f,
-  0x0d1f, 0x0d1f, 0x0d1f, 0x153f, 0x153f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x0d5f, 0x0d3f,
-  0x0d1f, 0x0d1f, 0x153f, 0x96bf, 0x963f, 0x0c5f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x0d3f, 0x059f,
-  0x0d3f, 0x0d1f, 0x153f, 0x963f, 0x963f, 0x14ff, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x0d3f, 0x055f,
-  0x0d3f, 0x0d1f, 0x0cff, 0x0c5f, 0x0c3f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x0cff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x14dd,
-  0x14dc, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x03ff, 0x041f, 0x145d, 0xd524,
-  0xdd04, 0x145c, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x041f, 0x0c3f, 0x041f, 0x141c, 0xed01,
-  0xec21, 0x141c, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x0bff, 0x75bf, 0x0bff, 0x13dd, 0xece2,
-  0xec22, 0x13bd, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x0b9f, 0x037f, 0x237a, 0xec22,
-  0xece1, 0x239a, 0x035f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x23ba, 0xdc04, 0xfc40,
-  0xfd00, 0xdc24, 0x2bba, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x13fd, 0xd424, 0xfd00, 0xfd20,
-  0xfd20, 0xfd00, 0xd424, 0x13fd, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x0fdf, 0x8fdf, 0x8fdf, 0x0fdf, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x175d,
-  0x175d, 0x075f, 0x075f, 0x077f, 0x0f7f, 0x0f7f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x0f5f, 0x073f, 0x073f, 0x171d, 0xd584,
-  0xdd44, 0x1d7d, 0x059f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x0e7f, 0x773f, 0x0edf, 0x06df, 0x16bc, 0xed21,
-  0xec41, 0x1d3c, 0x055f, 0x0d9f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x0c7f, 0x061f, 0x067f, 0x165d, 0xed22,
-  0xec42, 0x1d5d, 0x157f, 0x0d5f, 0x0d3f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05ff, 0x2d5a, 0xec42,
-  0xed01, 0x3d5a, 0x767f, 0x155f, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x257b, 0xdc64, 0xfc40,
-  0xfd00, 0xdc84, 0x3d3a, 0x043f, 0x041f, 0x0cff, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x155d, 0x243a, 0xd3e4, 0xfca0, 0xfcc0,
-  0xfcc0, 0xfca0, 0xd3e3, 0x241a, 0x143d, 0x043f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x243a, 0xd4a4, 0xebc2, 0xe262, 0xe262, 0xe262,
-  0xe262, 0xe262, 0xe262, 0xe3c2, 0xd4a4, 0x241a, 0x041f, 0x041f,
-  0x041f, 0x23fb, 0xd3a4, 0xe262, 0xe2a4, 0xf71b, 0xff7d, 0xff7d,
-  0xff7d, 0xff7d, 0xf71b, 0xe2c4, 0xe262, 0xd3a4, 0x23fa, 0x041f,
-  0x2bda, 0xd2a4, 0xeaa3, 0xf71b, 0xf77d, 0xf73d, 0xf73d, 0xf73d,
-  0xf73d, 0xf73d, 0xf73d, 0xf77d, 0xf71b, 0xeac4, 0xd284, 0x2bda,
-  0xe262, 0xe2a4, 0xf6fb, 0xf75d, 0xd65a, 0xa964, 0xa8e2, 0xa8e2,
-  0xa8e2, 0xa8e2, 0xa964, 0xd63a, 0xf75d, 0xf6fb, 0xe2a4, 0xe262,
-  0xe2a4, 0xf6fb, 0xce3b, 0xb144, 0xda22, 0xf380, 0xf3c0, 0xf3c0,
-  0xf3c0, 0xf3c0, 0xf380, 0xda22, 0xb144, 0xce3b, 0xf6fb, 0xe2a4,
-  0xf75d, 0xce3a, 0xb144, 0xea40, 0xfba0, 0xfc40, 0xfd20, 0xfd20,
-  0xfd20, 0xfd20, 0xfc40, 0xfba0, 0xea40, 0xb144, 0xce1a, 0xf77d,
-  0xef3d, 0xb165, 0xea40, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbe0, 0xea40, 0xb164, 0xef3d,
-  0xce9c, 0xda02, 0xfa80, 0xfc00, 0xfd00, 0xfd40, 0xfd20, 0xfd20,
-  0xfd20, 0xfd20, 0xfd40, 0xfd00, 0xfc00, 0xfa80, 0xda02, 0xd69c,
-  0x07df, 0x07ff, 0x277a, 0xe502, 0xfba0, 0xe242, 0xe222, 0xe222,
-  0xe284, 0xed52, 0xe2a4, 0xfba0, 0xece1, 0x2f5a, 0x07ff, 0x07df,
-  0x079f, 0x26fb, 0xd424, 0xe262, 0xe2a4, 0xf6fa, 0xff7d, 0xff7d,
-  0xff7d, 0xffde, 0xf71b, 0xe2c4, 0xe262, 0xd424, 0x26fa, 0x079f,
-  0x2e9a, 0xd304, 0xeaa3, 0xf6fb, 0xf77d, 0xf73d, 0xf73d, 0xf73d,
-  0xf73d, 0xf73d, 0xf73d, 0xf77d, 0xf71b, 0xeaa4, 0xd304, 0x2e9a,
-  0xe2a2, 0xe2a4, 0xf6fb, 0xf75d, 0xd65a, 0xa964, 0xa8e2, 0xa8e2,
-  0xa8e2, 0xa8e2, 0xa964, 0xd63a, 0xf75d, 0xf6fb, 0xe2a4, 0xe2a2,
-  0xe2a4, 0xf6fb, 0xce3b, 0xb144, 0xda22, 0xf380, 0xf3c0, 0xf3c0,
-  0xf3c0, 0xf3c0, 0xf380, 0xda22, 0xb144, 0xce3b, 0xf6fb, 0xe2a4,
-  0xf75d, 0xce3a, 0xb144, 0xea40, 0xfba0, 0xfc40, 0xfd20, 0xfd20,
-  0xfd20, 0xfd20, 0xfc40, 0xfba0, 0xea40, 0xb144, 0xce1a, 0xf77d,
-  0xef5d, 0xb165, 0xea20, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbe0, 0xea40, 0xb164, 0xf75d,
-  0xce1a, 0xda02, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce19,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xffbd, 0xfd45, 0xe2e3, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa902, 0xdac2, 0xfd45, 0xffbd, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffbc, 0xff7c, 0xf6da, 0xfb02, 0xfbe0,
-  0xfbe0, 0xfb02, 0xf6da, 0xff7c, 0xffbc, 0xffdf, 0xffdf, 0xffdf,
-  0xe2a5, 0xf77d, 0xce1a, 0xa8c2, 0xd9c0, 0xfbe0, 0xfc20, 0xfc20,
-  0xfc20, 0xfc20, 0xfbe0, 0xd9c0, 0xa8c2, 0xce1a, 0xf77d, 0xe2a5,
-  0xff5c, 0xeeba, 0xb164, 0xea60, 0xfbc0, 0xfc20, 0xfd00, 0xfd20,
-  0xfd20, 0xfd00, 0xfc40, 0xfbc0, 0xea60, 0xb164, 0xeeba, 0xff5c,
-  0xf75d, 0xb185, 0xea20, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbe0, 0xea40, 0xb164, 0xf75d,
-  0xce1a, 0xda02, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce19,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfbe0,
-  0xfae0, 0xfd00, 0xfd20, 0xfc00, 0xfac0, 0xfa80, 0xfa80, 0xfa80,
-  0xfa80, 0xfa80, 0xfa80, 0xfac0, 0xfc00, 0xfd20, 0xfd00, 0xfae0,
-  0xef3d, 0xb103, 0xf260, 0xfc00, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfc00, 0xf260, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbc0, 0xfac0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfac0, 0xfbc0, 0xfa80, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfa80, 0xd9a0, 0xa040, 0x7803, 0x7004,
-  0x7004, 0x7803, 0xa040, 0xd9a0, 0xfa80, 0xfa80, 0xf060, 0xc800,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xe1a0, 0xa860, 0x8043, 0x7864,
-  0x7864, 0x8043, 0xa860, 0xe1a0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xf240, 0xf280, 0xeb80, 0xebc0,
-  0xebc0, 0xeb80, 0xf280, 0xf240, 0xf860, 0xf020, 0xc800, 0xb005,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xd9c0, 0xa860, 0x8043, 0x7844,
-  0x7844, 0x8043, 0xa860, 0xd9c0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xf280, 0xf380, 0xf3a0,
-  0xf3a0, 0xf380, 0xf280, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf860, 0xfa60, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfa60, 0xf860, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xd9c0, 0xa860, 0x8043, 0x7844,
-  0x7844, 0x8043, 0xa860, 0xd9c0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xf280, 0xf380, 0xf3a0,
-  0xf3a0, 0xf380, 0xf280, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf860, 0xfa60, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfa60, 0xf860, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xd9c0, 0xa860, 0x8043, 0x7844,
-  0x7844, 0x8043, 0xa860, 0xd9c0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xf280, 0xf380, 0xf3a0,
-  0xf3a0, 0xf380, 0xf280, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf860, 0xfa60, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfa60, 0xf860, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xe1a0, 0xa860, 0x8043, 0x7864,
-  0x7864, 0x8043, 0xa860, 0xe1a0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xf240, 0xf280, 0xeb80, 0xebc0,
-  0xebc0, 0xeb80, 0xf280, 0xf240, 0xf860, 0xf020, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xe1a0, 0xa860, 0x8043, 0x7864,
-  0x7864, 0x8043, 0xa860, 0xe1a0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xf240, 0xf280, 0xeb80, 0xebc0,
-  0xebc0, 0xeb80, 0xf280, 0xf240, 0xf860, 0xf020, 0xc800, 0xb005,
-  0xef3d, 0xb103, 0xf260, 0xfc00, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfc00, 0xf260, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbc0, 0xfac0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfac0, 0xfbc0, 0xfa80, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfa80, 0xd9a0, 0xa040, 0x7803, 0x7004,
-  0x7004, 0x7803, 0xa040, 0xd9a0, 0xfa80, 0xfa80, 0xf060, 0xc800,
-  0xef3d, 0xb103, 0xf260, 0xfc00, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfc00, 0xf260, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbc0, 0xfac0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfac0, 0xfbc0, 0xfa80, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfa80, 0xd9a0, 0xa040, 0x7803, 0x7004,
-  0x7004, 0x7803, 0xa040, 0xd9a0, 0xfa80, 0xfa80, 0xf060, 0xc800,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfac0, 0xfac0,
-  0xfac0, 0xfac0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfac0, 0xfa80, 0xf260, 0xf260,
-  0xf260, 0xf260, 0xfa80, 0xfac0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xf260, 0xd180, 0xa040, 0x7824,
-  0x7824, 0xa040, 0xd180, 0xf260, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xe1a0, 0xa860, 0x8043, 0x7864,
-  0x7864, 0x8043, 0xa860, 0xe1a0, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xf240, 0xf280, 0xeb80, 0xebc0,
-  0xebc0, 0xeb80, 0xf280, 0xf240, 0xf860, 0xf020, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfcc0, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfae0, 0xfaa0, 0xfa80, 0xf240, 0xea40,
-  0xea40, 0xf240, 0xfa80, 0xfaa0, 0xfae0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xfa80, 0xe1c0, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xe1c0, 0xfa80, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xf2a0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xf2a0, 0xfa60, 0xf860, 0xf020, 0xc800, 0xb005,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xffff, 0xff7d,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff39, 0xff9c, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfa80, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfbc0, 0xfd00, 0xfd00, 0xfc00,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xfa80, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xfa80, 0xfae0, 0xfd00, 0xfce0, 0xfac0,
-  0xf060, 0xfa80, 0xfbe0, 0xfaa0, 0xd9a0, 0xb080, 0xea20, 0xea60,
-  0xea60, 0xea20, 0xb0a0, 0xd9a0, 0xfaa0, 0xfbe0, 0xfa80, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf280, 0xd980, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd980, 0xf280, 0xfa60, 0xfa40, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf260, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea60, 0xfa60, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf260, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea60, 0xfa60, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xef3d, 0xb103, 0xf240, 0xfae0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfae0, 0xf240, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfbc0, 0xfc20, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbc0, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbc0, 0xf280, 0xa880, 0x9083, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf200, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfaa0, 0xf240, 0xd160, 0xa040, 0x8023,
-  0x8024, 0xa040, 0xd160, 0xea40, 0xf280, 0xf220, 0xf060, 0xc800,
-  0xef3d, 0xb103, 0xf240, 0xfae0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfae0, 0xf240, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfbc0, 0xfc20, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbc0, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbc0, 0xf280, 0xa880, 0x9083, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf200, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfaa0, 0xf240, 0xd160, 0xa040, 0x8023,
-  0x8024, 0xa040, 0xd160, 0xea40, 0xf280, 0xf220, 0xf060, 0xc800,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf260, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea60, 0xfa60, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf260, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea60, 0xfa60, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xa860, 0xf280, 0xfbe0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbe0, 0xf280, 0xa860,
-  0xf260, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf260, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea60, 0xfa60, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc801, 0xf020, 0xf860, 0xfa20, 0xfa60, 0xf360, 0xeba0,
-  0xeba0, 0xf360, 0xfa60, 0xfa20, 0xf860, 0xf020, 0xc801, 0xb005,
-  0xa806, 0xb005, 0xc800, 0xf000, 0xf820, 0xf860, 0xfa80, 0xfac0,
-  0xfac0, 0xfa80, 0xf860, 0xf820, 0xf000, 0xc800, 0xb005, 0xa806,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xcdfa, 0xe222, 0xfaa0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfac0, 0xe222, 0xcdf9,
-  0xa8e2, 0xf260, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbe0, 0xf280, 0xa880, 0x9063, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf220, 0xf860,
-  0xc800, 0xf040, 0xfa40, 0xfa60, 0xf240, 0xd180, 0xa8a0, 0x8883,
-  0x8883, 0xa8a0, 0xd180, 0xea40, 0xfa40, 0xf200, 0xf040, 0xc800,
-  0xb005, 0xc800, 0xf020, 0xf860, 0xfa60, 0xfaa0, 0xf380, 0xeba0,
-  0xeba0, 0xf380, 0xfaa0, 0xfa60, 0xf860, 0xf040, 0xc800, 0xb005,
-  0xef3d, 0xb103, 0xf240, 0xfae0, 0xfbe0, 0xfc40, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfc40, 0xfbe0, 0xfae0, 0xf240, 0xb102, 0xf73d,
-  0xce1a, 0xda22, 0xfaa0, 0xfbc0, 0xfc20, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbc0, 0xfaa0, 0xda02, 0xce1a,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb22, 0xfb02, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfac0, 0xfb02, 0xfb22, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5c, 0xff9d, 0xff3b, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xfdaf, 0xfb43,
-  0xff7c, 0xffbe, 0xffdf, 0xf75d, 0xef5d, 0xff3b, 0xfb02, 0xfaa0,
-  0xfaa0, 0xfae2, 0xee98, 0xffff, 0xf75d, 0xffdf, 0xffbe, 0xff9d,
-  0xffff, 0xffff, 0xf75d, 0xa144, 0x2904, 0xd658, 0xfb02, 0xfaa0,
-  0xfac0, 0xe260, 0x3165, 0xce18, 0xb9e7, 0xf73c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea80, 0xfbe0,
-  0xfbe0, 0xe280, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xff7c, 0xffff, 0xffbd, 0xfd65, 0xe2a1, 0xa060, 0xf280, 0xfc20,
-  0xfc20, 0xf2a0, 0xa080, 0xda81, 0xfd45, 0xffbd, 0xff9d, 0xff7c,
-  0xfb64, 0xff1a, 0xff9c, 0xff39, 0xfd2d, 0xe201, 0xfbc0, 0xfd00,
-  0xfd00, 0xfbc0, 0xe201, 0xfd2d, 0xff5a, 0xff7a, 0xfc84, 0xfb22,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf2a0, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf2a0, 0xe241, 0xfc22, 0xfd62, 0xfd00, 0xfc00,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbc0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfa80, 0xf2a0, 0xfcc0, 0xfd00, 0xfc20,
-  0xfaa0, 0xfce0, 0xfd00, 0xfae0, 0xf260, 0xf260, 0xfa80, 0xfaa0,
-  0xfaa0, 0xfa80, 0xf260, 0xe220, 0xb0a0, 0xea80, 0xfbc0, 0xfaa0,
-  0xf060, 0xfa80, 0xfbc0, 0xf280, 0xa880, 0x9083, 0xea20, 0xf260,
-  0xea60, 0xea20, 0x8883, 0x8883, 0xd160, 0xd0a0, 0xf200, 0xf060,
-  0xc800, 0xf060, 0xfa80, 0xfaa0, 0xf240, 0xd160, 0xa040, 0x8023,
-  0x8024, 0xa040, 0xd160, 0xea40, 0xf280, 0xf220, 0xf060, 0xc800,
-  0xe2a5, 0xf77d, 0xce1a, 0xa8c2, 0xd9c0, 0xfbe0, 0xfc20, 0xfc20,
-  0xfc20, 0xfc20, 0xfbe0, 0xd9c0, 0xa8c2, 0xce1a, 0xf77d, 0xe2a5,
-  0xff5c, 0xeeba, 0xb164, 0xea60, 0xfbc0, 0xfc20, 0xfd00, 0xfd20,
-  0xfd20, 0xfd00, 0xfc40, 0xfbc0, 0xea60, 0xb164, 0xeeba, 0xff5c,
-  0xf75d, 0xb185, 0xea20, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd00, 0xfc40, 0xfbe0, 0xea40, 0xb164, 0xf75d,
-  0xce1a, 0xda02, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd40,
-  0xfd40, 0xfd40, 0xfd40, 0xfd00, 0xfc00, 0xfaa0, 0xda02, 0xce19,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd20, 0xfd20, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc40, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbd, 0xfd45, 0xe2c2, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa102, 0xdac2, 0xfd44, 0xffbd, 0xffff, 0xffff,
-  0xff7c, 0xffdf, 0xffff, 0xffbd, 0xff7c, 0xf678, 0xfb22, 0xfc00,
-  0xfc00, 0xfb22, 0xf678, 0xff7c, 0xffbd, 0xffff, 0xffdf, 0xff7d,
-  0xfb64, 0xff1a, 0xff9d, 0xff5c, 0xf590, 0xe2a3, 0xfbe0, 0xfd00,
-  0xfd00, 0xfbe0, 0xe2a3, 0xf590, 0xff5c, 0xff9d, 0xff3a, 0xfb64,
-  0xfac0, 0xfc42, 0xfc62, 0xfb22, 0xe221, 0xf280, 0xfbe0, 0xfc00,
-  0xfc00, 0xfbe0, 0xf280, 0xe221, 0xfb22, 0xfc62, 0xfc42, 0xfae0,
-  0xfbe0, 0xfd00, 0xfd00, 0xfbe0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xfbe0, 0xfd00, 0xfd00, 0xfbe0,
-  0xfae0, 0xfd00, 0xfd20, 0xfc00, 0xfac0, 0xfa80, 0xfa80, 0xfa80,
-  0xfa80, 0xfa80, 0xfa80, 0xfac0, 0xfc00, 0xfd20, 0xfd00, 0xfae0,
-  0x07df, 0x07ff, 0x277a, 0xe502, 0xfba0, 0xe242, 0xe222, 0xe222,
-  0xe222, 0xe222, 0xe242, 0xfba0, 0xece1, 0x2f5a, 0x07ff, 0x07df,
-  0x079f, 0x26fb, 0xd424, 0xe262, 0xe2a4, 0xf6fa, 0xff7d, 0xff7d,
-  0xff7d, 0xff7d, 0xf71a, 0xe2c4, 0xe262, 0xd424, 0x26fa, 0x079f,
-  0x2e9a, 0xd304, 0xeaa3, 0xf6fb, 0xf77d, 0xf73d, 0xf73d, 0xf73d,
-  0xf73d, 0xf73d, 0xf73d, 0xf77d, 0xf71b, 0xeaa4, 0xd304, 0x2e9a,
-  0xe2a2, 0xe2a4, 0xf6fb, 0xf75d, 0xd65a, 0xa964, 0xa8e2, 0xa8e2,
-  0xa8e2, 0xa8e2, 0xa964, 0xd63a, 0xf75d, 0xf6fb, 0xe2a4, 0xe2a2,
-  0xe2a4, 0xf6fb, 0xce3b, 0xb144, 0xda22, 0xf380, 0xf3c0, 0xf3c0,
-  0xf3c0, 0xf3c0, 0xf380, 0xda22, 0xb144, 0xce3b, 0xf6fb, 0xe2a4,
-  0xf75d, 0xce3a, 0xb144, 0xea40, 0xfba0, 0xfc40, 0xfd20, 0xfd20,
-  0xfd20, 0xfd41, 0xfc61, 0xfbc0, 0xea40, 0xb144, 0xce1a, 0xf77d,
-  0xef5d, 0xb165, 0xea20, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd20,
-  0xfd61, 0xfed1, 0xfeb1, 0xfc61, 0xfbc0, 0xea40, 0xb164, 0xf75d,
-  0xce1a, 0xda02, 0xfaa0, 0xfc00, 0xfd00, 0xfd40, 0xfd40, 0xfd20,
-  0xfd41, 0xfed1, 0xfed1, 0xfd21, 0xfc00, 0xfaa0, 0xda02, 0xce19,
-  0xa8e2, 0xf280, 0xfbc0, 0xfc20, 0xfd00, 0xfd20, 0xfd20, 0xfd40,
-  0xfd40, 0xfd41, 0xfd41, 0xfd00, 0xfc20, 0xfbc0, 0xf280, 0xb0e2,
-  0xf240, 0xfa80, 0xfac0, 0xfbc0, 0xfc00, 0xfc00, 0xfc40, 0xfd00,
-  0xfd00, 0xfc20, 0xfc00, 0xfc00, 0xfbc0, 0xfac0, 0xfa80, 0xf260,
-  0xfa80, 0xfac1, 0xfb02, 0xfb43, 0xfb22, 0xfac0, 0xfbc0, 0xfc20,
-  0xfc20, 0xfbc0, 0xfae0, 0xfb22, 0xfb23, 0xfb02, 0xfac1, 0xfaa0,
-  0xfb43, 0xfdaf, 0xff5b, 0xf6da, 0xee98, 0xfb64, 0xfac0, 0xfbc0,
-  0xfbc0, 0xfac0, 0xeac2, 0xff1a, 0xf6fb, 0xff5b, 0xfdaf, 0xfb43,
-  0xff7c, 0xffde, 0xf75d, 0xa145, 0x2904, 0xd5f6, 0xfb02, 0xfaa0,
-  0xfac0, 0xe240, 0x3102, 0xce18, 0xba07, 0xf73d, 0xffde, 0xff9d,
-  0xffff, 0xffff, 0xff7c, 0xe2c1, 0x2020, 0x28a2, 0xea60, 0xfac0,
-  0xfac0, 0xe260, 0x1820, 0x30a1, 0xe2c2, 0xff7c, 0xffff, 0xffff,
-  0xffdf, 0xffff, 0xffbd, 0xfd45, 0xe2e3, 0xa0e2, 0xf280, 0xfbe0,
-  0xfbe0, 0xf280, 0xa902, 0xdac2, 0xfd45, 0xffbd, 0xffff, 0xffff,
-  0xffdf, 0xffdf, 0xffdf, 0xffbc, 0xff7c, 0xf6da, 0xfb02, 0xfbe0,
-  0xfbe0, 0xfb02, 0xf6da, 0xff7c, 0xffbc, 0xffdf, 0xffdf, 0xffdf,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x175d,
-  0x175d, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x171d, 0xd584,
-  0xdd44, 0x1d7d, 0x059f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x16bc, 0xed21,
-  0xec41, 0x1d3c, 0x157f, 0x15bf, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x165d, 0xed22,
-  0xec42, 0x255d, 0x8ebf, 0x96bf, 0x157f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05ff, 0x2d5a, 0xec42,
-  0xed01, 0x3d5a, 0x8ebf, 0x969f, 0x0c5f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x0c7f, 0x257b, 0xdc64, 0xfc40,
-  0xfd00, 0xdc84, 0x353a, 0x0c5f, 0x041f, 0x04ff, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x1d9d, 0x9dfa, 0xe424, 0xfca0, 0xfcc0,
-  0xfcc0, 0xfca0, 0xd3e3, 0x241a, 0x143d, 0x043f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x243a, 0xd4c4, 0xf3e2, 0xe262, 0xe262, 0xe262,
-  0xe262, 0xe262, 0xe262, 0xe3c2, 0xd4a4, 0x241a, 0x041f, 0x041f,
-  0x041f, 0x23fb, 0xd3a4, 0xe262, 0xe2a4, 0xf71b, 0xff7d, 0xff7d,
-  0xff7d, 0xff7d, 0xf71b, 0xe2c4, 0xe262, 0xd3a4, 0x23fa, 0x041f,
-  0x2bda, 0xd2a4, 0xeaa3, 0xf71b, 0xf77d, 0xf73d, 0xf73d, 0xf73d,
-  0xf73d, 0xf73d, 0xf73d, 0xf77d, 0xf71b, 0xeac4, 0xd284, 0x2bda,
-  0xe262, 0xe2a4, 0xf6fb, 0xf75d, 0xd65a, 0xa964, 0xa8e2, 0xa8e2,
-  0xa8e2, 0xa8e2, 0xa964, 0xd63a, 0xf75d, 0xf6fb, 0xe2a4, 0xe262,
-  0xe2a4, 0xf6fb, 0xce3b, 0xb144, 0xda22, 0xf380, 0xf3c0, 0xf3c0,
-  0xf3c0, 0xf3c0, 0xf380, 0xda22, 0xb144, 0xce3b, 0xf6fb, 0xe2a4,
-  0xf75d, 0xce3a, 0xb144, 0xea40, 0xfba0, 0xfc40, 0xfd20, 0xfd20,
-  0xfd20, 0xfd41, 0xfc40, 0xfba0, 0xea40, 0xb144, 0xce1a, 0xf77d,
-  0xef3d, 0xb165, 0xea40, 0xfbe0, 0xfc40, 0xfd00, 0xfd40, 0xfd20,
-  0xfd61, 0xfe6e, 0xfd21, 0xfc40, 0xfbe0, 0xea40, 0xb164, 0xef3d,
-  0xce9c, 0xda02, 0xfa80, 0xfc00, 0xfd00, 0xfd40, 0xfd20, 0xfd20,
-  0xfd40, 0xfd61, 0xfd40, 0xfd00, 0xfc00, 0xfa80, 0xda02, 0xd69c,
-  0x07df, 0x07df, 0x07df, 0x0fdf, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x0fdf, 0x8fdf, 0x8fdf, 0x0fdf, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x0f9f, 0x77bf, 0x0f9f, 0x077f, 0x077f, 0x077f,
-  0x075f, 0x075f, 0x075f, 0x0f7f, 0x0f7f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x0f3f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x0d7f, 0x0d3f, 0x0d7f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x0d5f,
-  0x0d1f, 0x0d1f, 0x0d1f, 0x0d5f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x0d3f,
-  0x0d1f, 0x153f, 0x0d1f, 0x0d1f, 0x0d1f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x0d5f, 0x0d1f,
-  0x153f, 0x7e7f, 0x153f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x0d3f, 0x059f,
-  0x0d3f, 0x153f, 0x0d1f, 0x043f, 0x041f, 0x0cdf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x0d3f, 0x055f,
-  0x0d3f, 0x0d1f, 0x0cff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x0cff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x14dd,
-  0x14dc, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x145d, 0xd524,
-  0xdd04, 0x145c, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x143c, 0xed01,
-  0xec21, 0x141c, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x13dd, 0xece2,
-  0xec22, 0x13bd, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x237a, 0xec22,
-  0xece1, 0x239a, 0x035f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x23ba, 0xdc04, 0xfc40,
-  0xfd00, 0xdc24, 0x2bba, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x13fd, 0xd424, 0xfd00, 0xfd20,
-  0xfd20, 0xfd00, 0xd424, 0x13fd, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x0fdf, 0x77df,
-  0x0fdf, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df, 0x07df,
-  0x073f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x077f, 0x0f7f,
-  0x075f, 0x075f, 0x075f, 0x077f, 0x077f, 0x077f, 0x077f, 0x079f,
-  0x047f, 0x06bf, 0x073f, 0x073f, 0x073f, 0x073f, 0x073f, 0x06ff,
-  0x057f, 0x053f, 0x057f, 0x06ff, 0x073f, 0x073f, 0x073f, 0x071f,
-  0x03ff, 0x047f, 0x067f, 0x06bf, 0x06df, 0x06df, 0x06bf, 0x055f,
-  0x051f, 0x051f, 0x051f, 0x055f, 0x069f, 0x06bf, 0x067f, 0x047f,
-  0x041f, 0x03ff, 0x043f, 0x045f, 0x061f, 0x067f, 0x065f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x051f, 0x051f, 0x045f, 0x043f, 0x03ff,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x045f, 0x05df, 0x053f, 0x051f,
-  0x051f, 0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x03ff, 0x041f,
-  0x041f, 0x03ff, 0x045f, 0x055f, 0x045f, 0x059f, 0x053f, 0x059f,
-  0x051f, 0x051f, 0x04ff, 0x043f, 0x041f, 0x04bf, 0x041f, 0x041f,
-  0x03ff, 0x041f, 0x051f, 0x053f, 0x043f, 0x053f, 0x053f, 0x055f,
-  0x051f, 0x051f, 0x04ff, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x043f, 0x041f, 0x041f, 0x043f, 0x04ff, 0x051f,
-  0x051f, 0x04ff, 0x043f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x03ff, 0x041f, 0x041f, 0x04bf, 0x04bf,
-  0x04bf, 0x04bf, 0x041f, 0x049f, 0x049f, 0x041f, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x041f, 0x045f, 0x045f,
-  0x045f, 0x045f, 0x041f, 0x045f, 0x045f, 0x041f, 0x041f, 0x041f,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x041f, 0x041f,
-  0x041f, 0x041f, 0x03ff, 0x041f, 0x041f, 0x03ff, 0x03ff, 0x03ff,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f, 0x037f,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf, 0x03bf,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff,
-  0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff, 0x03ff
-};
-
-const Animation nemoAnimation = {
-  .name = "Nemo",
-  .frameCount = 59,
-  .width = 16,
-  .height = 16,
-  .frameDurations = nemoDurations,
-  .animationFrames = nemoFrames
-};
-#endif // ANIMATION_NEMO_H
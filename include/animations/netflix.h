@@ -1,1046 +0,0 @@
-// netflix.h - Auto-generated from netflix.json
-#ifndef ANIMATION_NETFLIX_H
-#define ANIMATION_NETFLIX_H
-
-#include "animation_types.h"
-
-// Frame Durations for netflix (in 100ms units)
-static const uint8_t PROGMEM netflixDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for netflix
-static const uint16_t PROGMEM netflixFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a,
-  0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a, 0x528a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x528a, 0x528a, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x528a, 0x528a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xa000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1841, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x1000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1020, 0x0820,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb800,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3800,
-  0xa000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb800,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3800,
-  0xa000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xa000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0041, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb800,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3800,
-  0xa000, 0x2000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb800,
-  0x2000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb000, 0xc800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3000, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd800, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0800, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0800, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0800, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0800, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0800, 0xb000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb000,
-  0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3000,
-  0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x2000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x1000,
-  0x0800, 0x8800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0820, 0x1041, 0x0841,
-  0x0841, 0x1041, 0x0820, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0820, 0x1820, 0x0020,
-  0x0020, 0x0820, 0x1020, 0x0820, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xb000, 0x2000,
-  0x0000, 0x1000, 0xb000, 0x1000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xb800,
-  0x2000, 0x1000, 0xc000, 0x1000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xb800, 0x3800,
-  0xa000, 0x3800, 0xc000, 0x1000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x1800, 0xb800, 0xd000, 0x1000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xc000, 0x1000,
-  0x0000, 0x2000, 0xc800, 0x1000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x1820, 0xb841, 0x1841,
-  0x0041, 0x1820, 0xb820, 0x1820, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x5208, 0x4208,
-  0x4208, 0x4208, 0x5249, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4249, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4249, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4a08, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x5020, 0x0820,
-  0x0020, 0x0820, 0x5020, 0x0820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x5000, 0x0800,
-  0x0000, 0x0800, 0x5000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0041, 0x0041, 0x0041,
-  0x0041, 0x0841, 0x0041, 0x0041, 0x0041, 0x0041, 0x0820, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x5208, 0x5208,
-  0x4208, 0x4208, 0x4208, 0x5208, 0x5208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x1820, 0xd020, 0xd020,
-  0x2820, 0x0020, 0x1020, 0xd020, 0xd020, 0x1820, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xd000, 0xe800,
-  0xc800, 0x1800, 0x0800, 0xd800, 0xd800, 0x1000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0800, 0xa800, 0xe000,
-  0xd800, 0xc800, 0x3000, 0xd800, 0xd800, 0x1000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xc800, 0xa800,
-  0x2800, 0xc000, 0xd800, 0xe800, 0xd000, 0x1000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x1000, 0xd800, 0xd000,
-  0x0800, 0x1800, 0xc800, 0xe800, 0xd000, 0x1000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x1000, 0xd800, 0xd800,
-  0x1000, 0x0000, 0x1800, 0xd800, 0xd800, 0x1000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x1020, 0xc841, 0xd041,
-  0x1841, 0x0020, 0x1020, 0xa041, 0xc841, 0x1841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x5208, 0x5208,
-  0x4208, 0x4208, 0x4a49, 0x4a08, 0x5208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4249, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4249, 0x10a2, 0x0041, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4a08, 0x4a08,
-  0x4208, 0x4208, 0x4a49, 0x41e7, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0820, 0x5820, 0x5820,
-  0x0820, 0x0020, 0x0820, 0x5820, 0x5000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x5800, 0x5800,
-  0x0000, 0x0000, 0x0000, 0x5800, 0x5800, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0040, 0x0040, 0x0040, 0x0041,
-  0x0041, 0x0041, 0x0841, 0x0041, 0x0041, 0x0041, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a09, 0x5208, 0x5208,
-  0x5208, 0x4208, 0x4208, 0x4208, 0x5208, 0x4a08, 0x5208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0822, 0x402d, 0xd022, 0xe020,
-  0xc820, 0x2820, 0x0020, 0x1820, 0xc020, 0x7820, 0xc061, 0x5a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0001, 0x380e, 0xd801, 0xe800,
-  0xe800, 0xc800, 0x1800, 0x0800, 0xd000, 0xb000, 0xd020, 0x5a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0001, 0x380e, 0xb001, 0xe000,
-  0xe800, 0xe800, 0xc000, 0x3000, 0xd000, 0xc000, 0xd020, 0x5a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0001, 0x380e, 0xd001, 0xc000,
-  0xd800, 0xd800, 0xe800, 0xd800, 0xe000, 0xe000, 0xd820, 0x5a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0001, 0x380e, 0xd801, 0xe000,
-  0xa800, 0x2800, 0xc000, 0xe800, 0xe800, 0xe800, 0xd820, 0x5a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0001, 0x380e, 0xd801, 0xf000,
-  0xd000, 0x0800, 0x1800, 0xc000, 0xe800, 0xe800, 0xd820, 0x5a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0822, 0x402d, 0xd042, 0xe041,
-  0xc841, 0x1820, 0x0020, 0x2041, 0xc841, 0xe041, 0xd061, 0x5a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a4a, 0x5208, 0x5208,
-  0x5208, 0x4208, 0x4a49, 0x4208, 0x5208, 0x5208, 0x5208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4248, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0041, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a4a, 0x4a08, 0x4a08,
-  0x4a08, 0x4208, 0x4a49, 0x39e7, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0822, 0x302d, 0x5822, 0x6020,
-  0x5820, 0x0820, 0x0020, 0x0820, 0x5000, 0x5800, 0x5000, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x300e, 0x5801, 0x6000,
-  0x5800, 0x0000, 0x0000, 0x0000, 0x5800, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x6b6d, 0x6b4d, 0x738e, 0x632c, 0x632c, 0x6b2d, 0x7b2c, 0x7b2c,
-  0x7b2c, 0x732c, 0x732c, 0x632c, 0x738e, 0x632c, 0x632c, 0x6b6d,
-  0x6b8d, 0x2104, 0x83d3, 0x18c3, 0x0842, 0x404e, 0xd042, 0xe041,
-  0xd041, 0x7841, 0xc041, 0x38a3, 0x83f4, 0x10a3, 0x1082, 0x738e,
-  0x6b6d, 0x18c3, 0x83d4, 0x0862, 0x0001, 0x380e, 0xd801, 0xe800,
-  0xd800, 0x7000, 0xd800, 0xd041, 0x9b92, 0x0041, 0x0040, 0x6b6d,
-  0x6b6d, 0x18c3, 0x83d4, 0x0862, 0x0001, 0x380e, 0xb001, 0xe000,
-  0xd800, 0x7000, 0xd800, 0xf000, 0xd041, 0x2000, 0x0041, 0x6b6d,
-  0x6b6d, 0x18c3, 0x83d4, 0x0862, 0x0001, 0x380e, 0xd001, 0xc000,
-  0xd000, 0x7000, 0xd800, 0xe800, 0xe000, 0xc800, 0x2841, 0x6b6d,
-  0x6b6d, 0x18c3, 0x83d4, 0x0862, 0x0001, 0x380e, 0xd801, 0xe000,
-  0xb000, 0x7000, 0xd800, 0xe800, 0xc000, 0xe000, 0xd041, 0x836d,
-  0x6b6d, 0x18c3, 0x83d4, 0x0861, 0x0001, 0x380e, 0xd801, 0xe800,
-  0xe000, 0xa800, 0xd800, 0xd800, 0xe000, 0xc000, 0xd841, 0x836d,
-  0x6b8d, 0x2104, 0x83f3, 0x18c3, 0x0842, 0x404e, 0xd062, 0xe061,
-  0xd861, 0x7861, 0x9841, 0x3841, 0xd061, 0xd861, 0xa8a2, 0x7b8e,
-  0x6b6d, 0x6b4d, 0x736e, 0x632c, 0x632c, 0x736e, 0x732c, 0x732c,
-  0x732c, 0x6b2c, 0x7b6d, 0x632c, 0x732c, 0x7b2c, 0x732c, 0x6b6d,
-  0x0841, 0x0841, 0x0841, 0x0861, 0x18e3, 0x6b6d, 0x1904, 0x10a2,
-  0x10a2, 0x1904, 0x6b6d, 0x1904, 0x0861, 0x0041, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x5aeb, 0x736f, 0x6b2c, 0x6b2c,
-  0x6b2c, 0x6b2c, 0x736d, 0x5aeb, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0842, 0x384e, 0x6042, 0x6041,
-  0x6041, 0x6041, 0x5841, 0x1841, 0x5000, 0x5800, 0x5000, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x300e, 0x5801, 0x6000,
-  0x5800, 0x6000, 0x5000, 0x0800, 0x5000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x736d, 0x734d, 0x738e, 0x6b4d, 0x73ad, 0x6b4e, 0x732c, 0x7b2c,
-  0x7b2c, 0x6b2c, 0x7b2c, 0x7b2c, 0x738e, 0x6b4d, 0x7bce, 0x738e,
-  0x7b8d, 0xa104, 0x8bd3, 0x2964, 0xce4b, 0x590f, 0xd042, 0xe041,
-  0xd041, 0x7041, 0xd041, 0xd8a3, 0x9bd3, 0x7146, 0xde9a, 0x8451,
-  0x7b6d, 0xa8c3, 0x8bb3, 0x2103, 0xd66b, 0x50af, 0xd001, 0xe800,
-  0xd800, 0x7000, 0xd800, 0xe062, 0x9bd3, 0x7104, 0xe6db, 0x8451,
-  0x7b6d, 0xa8c3, 0x8bb3, 0x2123, 0xd66b, 0x50cf, 0xa801, 0xe000,
-  0xd800, 0x7000, 0xd800, 0xe062, 0x9bd3, 0x7905, 0xe6db, 0x8451,
-  0x7b6d, 0xa8c3, 0x8bb3, 0x2123, 0xd66b, 0x50cf, 0xc801, 0xc000,
-  0xd000, 0x7000, 0xd800, 0xe062, 0xa3d3, 0xd905, 0xeedb, 0x8451,
-  0x7b6d, 0xa8c3, 0x8bb3, 0x2123, 0xd66b, 0x50cf, 0xd801, 0xe000,
-  0xb000, 0x7000, 0xd800, 0xe062, 0xabd3, 0xe105, 0xeedb, 0x8451,
-  0x7b6d, 0xa8c3, 0x8bb3, 0x2103, 0xd66b, 0x50af, 0xd801, 0xe800,
-  0xe000, 0xa800, 0xd800, 0xe062, 0xabd3, 0xe104, 0xf6db, 0x8451,
-  0x7b8d, 0xa104, 0x8bd3, 0x2964, 0xce4b, 0x590f, 0xd062, 0xe061,
-  0xd861, 0x7861, 0xa841, 0xd8a3, 0xa3d3, 0xd966, 0xe69a, 0x8451,
-  0x736d, 0x734d, 0x736e, 0x6b4d, 0x73ad, 0x738e, 0x732c, 0x732c,
-  0x732c, 0x6b2c, 0x7b6d, 0x732c, 0x736e, 0x734d, 0x7bae, 0x738e,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x18c3, 0x6b6d, 0x1904, 0x10a2,
-  0x10a2, 0x1904, 0x6b6d, 0x18e3, 0x0841, 0x0041, 0x0040, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x630b, 0x738f, 0x6b2c, 0x6b2c,
-  0x6b2c, 0x6b2c, 0x736d, 0x62eb, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4820, 0x3988, 0x0840, 0x39a2, 0x386e, 0x6042, 0x6041,
-  0x6041, 0x6041, 0x6041, 0x6062, 0x4188, 0x5061, 0x3988, 0x0021,
-  0x0800, 0x5021, 0x41a9, 0x0840, 0x3161, 0x382e, 0x5801, 0x6000,
-  0x5800, 0x5800, 0x6000, 0x5820, 0x49a9, 0x5862, 0x41a8, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x736d, 0x734d, 0x738e, 0x732d, 0x6b2e, 0x7baf, 0x734d, 0x7bad,
-  0x7b2c, 0x7b2d, 0x7bae, 0x7b4d, 0x732c, 0x6b2c, 0x6b2c, 0x736d,
-  0x7b8d, 0xa104, 0xa3d3, 0xc8a4, 0x58f0, 0xde5b, 0xb9a4, 0xee4a,
-  0xe0e2, 0xe0e3, 0xf679, 0xe104, 0xa841, 0x6841, 0x60a2, 0x7b8e,
-  0x7b6d, 0xa0c3, 0xa3d3, 0xd043, 0x50b0, 0xe69b, 0xb963, 0xf669,
-  0xe8a0, 0xe882, 0xfeba, 0xe8a2, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x7b6d, 0xa0c3, 0xa3d3, 0xd043, 0x50b0, 0xe67b, 0xb963, 0xf669,
-  0xe8a0, 0xe882, 0xfe9a, 0xe0c3, 0xa800, 0x6800, 0x6041, 0x736d,
-  0x7b6d, 0xa0c3, 0xa3d3, 0xd043, 0x50b0, 0xe67b, 0xb963, 0xf669,
-  0xe0a0, 0xe882, 0xfe9a, 0xe0c3, 0xb800, 0xc800, 0x6841, 0x736d,
-  0x7b6d, 0xa0c3, 0xa3d3, 0xd043, 0x50b0, 0xe67b, 0xb963, 0xee69,
-  0xc0a0, 0xe082, 0xfeba, 0xe0c3, 0xb800, 0xd800, 0x6841, 0x736d,
-  0x7b6d, 0xa0c3, 0xa3d3, 0xd043, 0x50b0, 0xe69b, 0xb963, 0xf669,
-  0xe8a0, 0xe882, 0xf618, 0xe0a2, 0xb800, 0xd800, 0x6841, 0x736d,
-  0x7b8d, 0xa104, 0xa3f3, 0xc8a4, 0x58f0, 0xde5a, 0xb9a5, 0xee4a,
-  0xe102, 0xd861, 0xb8c3, 0xd861, 0xb061, 0xd061, 0x70a2, 0x738e,
-  0x736d, 0x734d, 0x736e, 0x732d, 0x6b2e, 0x7bef, 0x734d, 0x73ad,
-  0x732c, 0x732c, 0x7b4d, 0x732c, 0x732c, 0x732c, 0x6b2c, 0x6b6d,
-  0x0841, 0x0841, 0x0841, 0x0861, 0x18e3, 0x6b4d, 0x1904, 0x1082,
-  0x10a2, 0x1903, 0x6b6d, 0x18e3, 0x0861, 0x0041, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0821, 0x62ec, 0x73ae, 0x6b2c, 0x6b4c,
-  0x6b2c, 0x6b2c, 0x73ae, 0x62eb, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x4820, 0x4188, 0x5022, 0x406e, 0x49eb, 0x58a2, 0x41a1,
-  0x6081, 0x6062, 0x49e9, 0x6082, 0x5800, 0x5800, 0x5000, 0x0800,
-  0x0800, 0x5021, 0x49c9, 0x5822, 0x382e, 0x41aa, 0x5840, 0x3960,
-  0x5820, 0x5820, 0x49a9, 0x5821, 0x6000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x736d, 0x734c, 0x7bad, 0x7b4c, 0x6b2c, 0x632c, 0x734d, 0x7bae,
-  0x7b4d, 0x732c, 0x6b2c, 0x7b2c, 0x732c, 0x6b2c, 0x6b2e, 0x6b6e,
-  0x7b6e, 0xa943, 0xee4a, 0xd902, 0x6041, 0x1841, 0xa104, 0xee79,
-  0xe104, 0xa841, 0x7041, 0xd041, 0xa841, 0x6042, 0x40af, 0x738f,
-  0x7b4d, 0xb102, 0xf689, 0xe0a1, 0x6000, 0x1000, 0xa0a2, 0xf6ba,
-  0xe8a2, 0xa800, 0x7000, 0xd800, 0xb000, 0x6001, 0x384f, 0x736f,
-  0x7b4d, 0xa902, 0xf669, 0xe0c1, 0x6000, 0x1000, 0xa0a2, 0xf69a,
-  0xe8c3, 0xa800, 0x7000, 0xd800, 0xa800, 0x6001, 0x384f, 0x736f,
-  0x7b4d, 0xa902, 0xf669, 0xe0c1, 0x6000, 0x1000, 0xa0a2, 0xf69a,
-  0xe8c3, 0xa800, 0x7000, 0xd800, 0xa800, 0x6001, 0x384f, 0x736f,
-  0x7b4d, 0xa902, 0xf669, 0xe0c1, 0x6000, 0x1000, 0xa0a2, 0xf69a,
-  0xe8c3, 0xa800, 0x7000, 0xd800, 0xa800, 0x6001, 0x384f, 0x736f,
-  0x7b4d, 0xb102, 0xf689, 0xe0a1, 0x6000, 0x1000, 0xa0a2, 0xf6ba,
-  0xe8a2, 0xa800, 0x7000, 0xd800, 0xb000, 0x6001, 0x384f, 0x736f,
-  0x7b6e, 0xa943, 0xee4a, 0xd902, 0x6041, 0x1841, 0xa104, 0xee79,
-  0xe104, 0xa861, 0x7041, 0xd061, 0xa861, 0x6062, 0x40af, 0x738f,
-  0x6b6d, 0x734c, 0x7bad, 0x734c, 0x6b2c, 0x6b6d, 0x732c, 0x73ae,
-  0x732c, 0x732c, 0x736d, 0x732c, 0x732c, 0x6b2c, 0x6b2d, 0x6b6d,
-  0x0841, 0x0841, 0x0041, 0x0841, 0x18e3, 0x6b6d, 0x1904, 0x1082,
-  0x10a2, 0x1904, 0x6b6d, 0x1904, 0x0861, 0x0841, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x62eb, 0x736d, 0x6b2c, 0x6b4d,
-  0x6b2c, 0x6b2c, 0x736d, 0x62eb, 0x0820, 0x0000, 0x0001, 0x0000,
-  0x0800, 0x4820, 0x3960, 0x5020, 0x5841, 0x1841, 0x5882, 0x51e9,
-  0x6082, 0x6041, 0x6041, 0x6041, 0x5800, 0x5001, 0x300c, 0x0001,
-  0x0800, 0x5020, 0x4180, 0x5820, 0x5000, 0x0800, 0x5020, 0x49a9,
-  0x5821, 0x6000, 0x5800, 0x5800, 0x6000, 0x5801, 0x300e, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x738e, 0x7bcd, 0x734c, 0x6b2c, 0x6b2c, 0x632c, 0x632c, 0x632c,
-  0x6b2c, 0x732c, 0x732c, 0x732c, 0x732c, 0x6b2c, 0x6b2c, 0x736d,
-  0x842f, 0xe68b, 0xa8e2, 0x6841, 0x5841, 0x1041, 0x0841, 0x1041,
-  0x6041, 0xa041, 0xa841, 0xa841, 0xa041, 0x6841, 0x60a2, 0x7b8e,
-  0x842f, 0xeecb, 0xb0a0, 0x6000, 0x5000, 0x0000, 0x0000, 0x0000,
-  0x5800, 0xa800, 0xb000, 0xa800, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x842f, 0xeecb, 0xa8a1, 0x6000, 0x5000, 0x0800, 0x0000, 0x0000,
-  0x5800, 0xa800, 0xa800, 0xa800, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x842f, 0xeecb, 0xa8a1, 0x6000, 0x5000, 0x0800, 0x0000, 0x0000,
-  0x5800, 0xa800, 0xa800, 0xa800, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x842f, 0xeecb, 0xa8a1, 0x6000, 0x5000, 0x0800, 0x0000, 0x0000,
-  0x5800, 0xa800, 0xa800, 0xa800, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x842f, 0xeecb, 0xb0a0, 0x6000, 0x5000, 0x0000, 0x0000, 0x0000,
-  0x5800, 0xa800, 0xb000, 0xa800, 0xa800, 0x6000, 0x6041, 0x736d,
-  0x842f, 0xe68b, 0xa902, 0x6861, 0x5861, 0x1041, 0x0841, 0x1061,
-  0x6061, 0xa061, 0xa841, 0xa861, 0xa061, 0x6861, 0x60a2, 0x7b8e,
-  0x738d, 0x7bad, 0x734c, 0x6b2c, 0x6b2c, 0x6b6d, 0x632c, 0x632c,
-  0x6b2c, 0x732c, 0x7b6d, 0x732c, 0x732c, 0x6b2c, 0x6b2c, 0x6b6d,
-  0x0841, 0x0041, 0x0041, 0x0861, 0x18e3, 0x6b6d, 0x2104, 0x10a2,
-  0x10a2, 0x1904, 0x6b6d, 0x1904, 0x0861, 0x0841, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x62eb, 0x736d, 0x632c, 0x632c,
-  0x6b2c, 0x6b2c, 0x736d, 0x62eb, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x3140, 0x5020, 0x5800, 0x5841, 0x1041, 0x0841, 0x1041,
-  0x5841, 0x6041, 0x6041, 0x6041, 0x5800, 0x5800, 0x5000, 0x0800,
-  0x0020, 0x3160, 0x5820, 0x6000, 0x5800, 0x0000, 0x0000, 0x0000,
-  0x5000, 0x6000, 0x5800, 0x5800, 0x6000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0041, 0x0041, 0x0041, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0041, 0x0041, 0x0041, 0x0041, 0x0020, 0x0020,
-  0x4a49, 0x5208, 0x5208, 0x4a08, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x5208, 0x5208, 0x5208, 0x5208, 0x4a49,
-  0x5a49, 0xa061, 0xa020, 0x5820, 0x0820, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x1020, 0x9820, 0xa820, 0xa820, 0xa061, 0x5a49,
-  0x5249, 0xa820, 0xa800, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xa000, 0xb000, 0xb000, 0xa020, 0x5a49,
-  0x5249, 0xa041, 0xa800, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xa000, 0xb000, 0xa800, 0xa020, 0x5a49,
-  0x5249, 0xa041, 0xa800, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xa000, 0xb000, 0xa800, 0xa020, 0x5a49,
-  0x5249, 0xa041, 0xa800, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xa000, 0xb000, 0xa800, 0xa020, 0x5a49,
-  0x5a49, 0xa820, 0xa800, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0xa000, 0xb000, 0xb000, 0xa020, 0x5a49,
-  0x5a49, 0xa061, 0xa041, 0x5841, 0x0820, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x1020, 0x9841, 0xa841, 0xa841, 0xa061, 0x5a49,
-  0x4a49, 0x5228, 0x5208, 0x4a08, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4a08, 0x5208, 0x5208, 0x5208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0041, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4249, 0x10a2, 0x0041, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0820, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x41e7, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x5000, 0x5800, 0x5000, 0x0820, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0820, 0x5020, 0x5800, 0x5800, 0x5000, 0x0800,
-  0x0800, 0x5000, 0x6000, 0x5800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x5000, 0x6000, 0x6000, 0x5800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0041, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0041, 0x0020, 0x0020,
-  0x4a49, 0x4a08, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a08, 0x4a49,
-  0x5249, 0x5061, 0x0820, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x1020, 0x9061, 0x5a49,
-  0x5249, 0x5020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9820, 0x5a49,
-  0x5249, 0x5041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9820, 0x5a49,
-  0x5249, 0x5041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9820, 0x5a49,
-  0x5249, 0x5041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9820, 0x5a49,
-  0x5249, 0x5020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x9820, 0x5a49,
-  0x5249, 0x5061, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x1041, 0x9061, 0x5a49,
-  0x4a49, 0x4a28, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4a08, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x4800, 0x0800, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0800, 0x4800, 0x0800,
-  0x0800, 0x5000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x5000, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0020, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0841, 0x0020, 0x0020,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x4a49, 0x0861, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0020, 0x0861, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4a49,
-  0x4a49, 0x0861, 0x0841, 0x0841, 0x0020, 0x0020, 0x0020, 0x0841,
-  0x0841, 0x0020, 0x0020, 0x0020, 0x0841, 0x0841, 0x0861, 0x4a49,
-  0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x4208, 0x4208, 0x4208, 0x4208, 0x4a49,
-  0x0020, 0x0020, 0x0020, 0x0841, 0x10a2, 0x4a49, 0x10a2, 0x0861,
-  0x0861, 0x10a2, 0x4a49, 0x10a2, 0x0841, 0x0020, 0x0020, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4a49, 0x4208, 0x4208,
-  0x4208, 0x4208, 0x4a49, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020,
-  0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation netflixAnimation = {
-  .name = "Netflix",
-  .frameCount = 32,
-  .width = 16,
-  .height = 16,
-  .frameDurations = netflixDurations,
-  .animationFrames = netflixFrames
-};
-#endif // ANIMATION_NETFLIX_H
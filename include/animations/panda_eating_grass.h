@@ -1,1078 +0,0 @@
-// panda_eating_grass.h - Auto-generated from panda_eating_grass.json
-#ifndef ANIMATION_PANDA_EATING_GRASS_H
-#define ANIMATION_PANDA_EATING_GRASS_H
-
-#include "animation_types.h"
-
-// Frame Durations for panda_eating_grass (in 100ms units)
-static const uint8_t PROGMEM panda_eating_grassDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for panda_eating_grass
-static const uint16_t PROGMEM panda_eating_grassFrames[] = {
-  0x0420, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x01e0, 0x02e0, 0x02e0,
-  0x0320, 0x02a0, 0x0220, 0x01e0, 0x02e0, 0x02a0, 0x0420, 0x03c0,
-  0x0580, 0x0580, 0x01e0, 0x0320, 0x02a0, 0x01e0, 0x0220, 0x01e0,
-  0x04c0, 0x04c0, 0x0220, 0x01e0, 0x0320, 0x02a0, 0x0420, 0x03c0,
-  0x0380, 0x03c0, 0x0000, 0x0000, 0x0000, 0x01e0, 0x0220, 0x01e0,
-  0x02e0, 0x02a0, 0x0220, 0x0000, 0x0000, 0x0000, 0x0580, 0x0580,
-  0x0420, 0x03c0, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0380, 0x03c0,
-  0x0420, 0x03c0, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0420, 0x03c0,
-  0x0420, 0x03c0, 0x0220, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x04c0, 0x0420, 0x03c0,
-  0x0420, 0x03c0, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0xffff,
-  0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff, 0x0420, 0x03c0,
-  0x0580, 0x0580, 0xffff, 0xffff, 0x0000, 0xffff, 0x0000, 0xffff,
-  0xffff, 0x0000, 0xffff, 0x0000, 0xffff, 0xffff, 0x0420, 0x03c0,
-  0x0380, 0x03c0, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0xffff,
-  0xffff, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0420, 0x03c0,
-  0x0420, 0x03c0, 0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff, 0x0420, 0x03c0,
-  0x0420, 0x03c0, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000,
-  0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x0580, 0x0580,
-  0x0420, 0x03c0, 0x0220, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0x02a0, 0x0380, 0x03c0,
-  0x0420, 0x03c0, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xffff, 0xffff, 0x2945, 0x2945, 0x0420, 0x03c0,
-  0x0580, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x2945, 0x2945, 0x2945, 0x03c0,
-  0x0380, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0x2945, 0x03c0,
-  0x0420, 0x0000, 0x0000, 0x2945, 0x2945, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2945, 0x2945, 0x0000, 0x0000, 0x2945, 0x03c0,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0280, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0260, 0x0300, 0x02a0, 0x01e0, 0x0200, 0x0220,
-  0x0440, 0x0440, 0x0240, 0x01e0, 0x0300, 0x02c0, 0x0400, 0x03e0,
-  0x03c0, 0x03a0, 0x0220, 0x02c0, 0x0260, 0x01c0, 0x01e0, 0x01e0,
-  0x02e0, 0x02a0, 0x0200, 0x01c0, 0x02a0, 0x02a0, 0x04e0, 0x0540,
-  0x0400, 0x0360, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1362, 0x1302, 0x1262, 0x0040, 0x0020, 0x0080, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef9d, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x03a0, 0x03c0,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x03c0, 0x03c0,
-  0x0420, 0x03a0, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03c0,
-  0x0520, 0x1542, 0xd75a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1482, 0x03e0,
-  0x0400, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefdd, 0x1d63, 0x0520,
-  0x0400, 0x1402, 0xd6fa, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xdf1b, 0x1402, 0x03c0,
-  0x0420, 0x0320, 0x2144, 0xd6ba, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdefb, 0x4268, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x2104, 0xdedb, 0xef7d, 0x39e7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4208, 0x2124, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x2124, 0xd69a, 0xd69a, 0xce79,
-  0xce79, 0xd69a, 0xd6ba, 0x2124, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x10a2, 0x18c3, 0x18c3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0280, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0260, 0x0300, 0x0280, 0x01e0, 0x0200, 0x0220,
-  0x0440, 0x0440, 0x0240, 0x0200, 0x0300, 0x02c0, 0x0400, 0x03e0,
-  0x03a0, 0x0360, 0x0220, 0x02c0, 0x02a0, 0x01e0, 0x01e0, 0x01e0,
-  0x02e0, 0x02a0, 0x01e0, 0x01c0, 0x02c0, 0x02c0, 0x0500, 0x0520,
-  0x03c0, 0x0080, 0x0020, 0x0080, 0x1442, 0x12a2, 0x1282, 0x1262,
-  0x1362, 0x12c2, 0x0040, 0x0020, 0x0060, 0x0260, 0x03a0, 0x03c0,
-  0x03c0, 0x0040, 0x0000, 0x2104, 0xd71a, 0xef7d, 0xe77c, 0xef7d,
-  0xef9d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x02a0, 0x03e0, 0x03a0,
-  0x03c0, 0x0080, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0400, 0x0420, 0x03a0,
-  0x0420, 0x2404, 0xdf1b, 0xffff, 0xe73c, 0xe73c, 0xffdf, 0xffdf,
-  0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x02e0, 0x0400, 0x03c0,
-  0x1d63, 0xd77a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d, 0xef7d,
-  0x2124, 0x31a6, 0xdedb, 0xffff, 0xdf3b, 0x1302, 0x03e0, 0x03c0,
-  0x1402, 0xef9d, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c, 0xe73c,
-  0x2104, 0xad55, 0x39c7, 0xef3d, 0xef9d, 0x1322, 0x03e0, 0x03a0,
-  0x1462, 0xe79c, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d, 0xef7d,
-  0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1322, 0x0400, 0x03e0,
-  0x1462, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c, 0xe73c,
-  0xd6ba, 0x2104, 0x2104, 0xef5d, 0xef9d, 0x1342, 0x04e0, 0x0520,
-  0x1462, 0xd75a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7, 0x39c7,
-  0xef7d, 0xef5d, 0xef5d, 0xffff, 0xdefb, 0x12e2, 0x0380, 0x03e0,
-  0x0420, 0x2404, 0xd6fa, 0xffff, 0xffff, 0xe71c, 0xce79, 0xce79,
-  0xe71c, 0xffff, 0xffff, 0xdedb, 0x4228, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x2104, 0xdedb, 0xef7d, 0x39e7, 0x2965, 0x2965,
-  0x39c7, 0xef7d, 0xdedb, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x2124, 0xd6ba, 0xd69a, 0xce79, 0xce79,
-  0xd69a, 0xd69a, 0x2124, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x31a6, 0x18c3, 0x18c3, 0x18c3,
-  0x18c3, 0x10a2, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0280, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0260, 0x0300, 0x02a0, 0x01e0, 0x0200, 0x0220,
-  0x0440, 0x0440, 0x0240, 0x01e0, 0x0300, 0x02c0, 0x0400, 0x03e0,
-  0x03c0, 0x03a0, 0x0220, 0x02c0, 0x0260, 0x01c0, 0x01e0, 0x01e0,
-  0x02e0, 0x02a0, 0x0200, 0x01c0, 0x02a0, 0x02a0, 0x04e0, 0x0540,
-  0x0400, 0x0360, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1362, 0x1302, 0x1262, 0x0040, 0x0020, 0x0080, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef9d, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x03a0, 0x03c0,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x03c0, 0x03c0,
-  0x0420, 0x03a0, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03c0,
-  0x0520, 0x1542, 0xd75a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1482, 0x03e0,
-  0x0400, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefdd, 0x1d63, 0x0520,
-  0x0400, 0x1402, 0xd6fa, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xdf1b, 0x1402, 0x03c0,
-  0x0420, 0x0320, 0x2144, 0xd6ba, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdefb, 0x4268, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x2104, 0xdedb, 0xef7d, 0x39e7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4208, 0x2124, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x2124, 0xd69a, 0xd69a, 0xce79,
-  0xce79, 0xd69a, 0xd6ba, 0x2124, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x10a2, 0x18c3, 0x18c3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0280, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0240, 0x0300, 0x02a0, 0x01e0, 0x0200, 0x0220,
-  0x0440, 0x0440, 0x0240, 0x01e0, 0x0300, 0x02c0, 0x0420, 0x03e0,
-  0x03c0, 0x03a0, 0x0240, 0x02c0, 0x0260, 0x01c0, 0x01e0, 0x01e0,
-  0x02e0, 0x02a0, 0x0200, 0x01e0, 0x02a0, 0x02a0, 0x04c0, 0x0520,
-  0x0400, 0x0380, 0x0200, 0x0060, 0x0020, 0x0040, 0x1242, 0x1282,
-  0x1362, 0x1302, 0x12a2, 0x1242, 0x0040, 0x0020, 0x00c0, 0x0380,
-  0x0400, 0x03a0, 0x0200, 0x0000, 0x0000, 0x2104, 0xd6da, 0xef7d,
-  0xef7d, 0xef7d, 0xef7d, 0xd6fa, 0x2104, 0x0000, 0x0020, 0x0340,
-  0x0400, 0x0380, 0x0200, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x0360,
-  0x0440, 0x03c0, 0x0240, 0x2364, 0xdf1b, 0xffff, 0xe73c, 0xe73c,
-  0xffdf, 0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf1b, 0x2444, 0x03a0,
-  0x0540, 0x04e0, 0x12c2, 0xd71a, 0xffff, 0xdedb, 0x31a6, 0x2124,
-  0xef5d, 0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1402,
-  0x03c0, 0x03a0, 0x12c2, 0xef7d, 0xef5d, 0x31a6, 0xad55, 0x2104,
-  0xe73c, 0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xef9d, 0x1402,
-  0x0400, 0x0380, 0x1322, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124,
-  0xef7d, 0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1422,
-  0x0400, 0x0380, 0x1282, 0xef9d, 0xef7d, 0x2124, 0x2104, 0xd6ba,
-  0xe73c, 0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1d63,
-  0x0400, 0x0380, 0x1262, 0xd6da, 0xffff, 0xef5d, 0xef5d, 0xef7d,
-  0x39c7, 0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffff, 0xd75a, 0x1422,
-  0x0420, 0x0320, 0x0060, 0x2104, 0xd6ba, 0xffff, 0xffff, 0xe71c,
-  0xce79, 0xce79, 0xe71c, 0xffff, 0xffff, 0xdf3b, 0x2464, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x2104, 0xdedb, 0xef7d, 0x39e7,
-  0x2965, 0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4228, 0x1983, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x2104, 0xd69a, 0xd69a,
-  0xce79, 0xce79, 0xd6ba, 0xd6ba, 0x2124, 0x20e3, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x1082, 0x18c3,
-  0x18c3, 0x18c3, 0x39c7, 0x31a6, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0280, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0260, 0x0300, 0x02a0, 0x01e0, 0x0200, 0x0220,
-  0x0440, 0x0440, 0x0240, 0x01e0, 0x0300, 0x02c0, 0x0400, 0x03e0,
-  0x03c0, 0x03a0, 0x0220, 0x02c0, 0x0260, 0x01c0, 0x01e0, 0x01e0,
-  0x02e0, 0x02a0, 0x0200, 0x01c0, 0x02a0, 0x02a0, 0x04e0, 0x0540,
-  0x0400, 0x0360, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1362, 0x1302, 0x1262, 0x0040, 0x0020, 0x0080, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef9d, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x03a0, 0x03c0,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x03c0, 0x03c0,
-  0x0420, 0x03a0, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03c0,
-  0x0520, 0x1542, 0xd75a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1482, 0x03e0,
-  0x0400, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefdd, 0x1d63, 0x0520,
-  0x0400, 0x1402, 0xd6fa, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffdf, 0xdf1b, 0x1402, 0x03c0,
-  0x0420, 0x0320, 0x2144, 0xdedb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xe71c, 0x4268, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x2104, 0xd6ba, 0xdefb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdedb, 0x4208, 0x2124, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x2124, 0xd69a, 0xd69a, 0xce79,
-  0xce79, 0xd69a, 0xd6ba, 0x2124, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x10a2, 0x18c3, 0x18c3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xdefb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xd6ba, 0xdefb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd69a, 0xd6ba, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xdefb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xd6ba, 0xdefb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd6ba, 0xdefb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a6, 0x31a6,
-  0x18c3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xdefb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xd6ba, 0xdefb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd6ba, 0xdefb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x1922, 0x31a6, 0x4226,
-  0x18c3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0020, 0x0920, 0x5de0, 0x21e0, 0x5de0,
-  0x0880, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x1983, 0x0680, 0x17a0, 0x6f20, 0x1700,
-  0x00a0, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xdefb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xd6ba, 0xdedb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x2104, 0xe73a, 0xd6ba, 0xdf1a,
-  0xd69a, 0xd69a, 0xd6ba, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0020, 0x0920, 0x7682, 0x3282, 0x7682,
-  0x2142, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x1983, 0x0680, 0x1780, 0x6f20, 0x16e0,
-  0x0080, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce7a,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xdeba, 0xe75b, 0x39c7, 0x2143,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x0000, 0x19a2, 0x8724, 0xcf55, 0x8704,
-  0xc677, 0xd69a, 0xd6ba, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0060, 0x0020, 0x0900, 0x05e0, 0x1700, 0x77a2, 0x1ea0,
-  0x21c2, 0x18c2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03c0, 0x2164, 0x3a06, 0x7621, 0x2a23, 0x0140, 0x0e60, 0x09e0,
-  0x65a0, 0x08a0, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xf7fd, 0xe73c, 0xdf1a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xcf78, 0x8f44, 0x3242, 0x7682,
-  0x1922, 0x20e4, 0xef5d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x1681, 0x1700, 0x6720, 0x2722,
-  0x0920, 0x2925, 0xdedb, 0x2945, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0920, 0x0100, 0x1e82, 0xb715,
-  0x8664, 0xceb8, 0xd69a, 0x1082, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x10a2,
-  0x08c0, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xd77a, 0xdf9b, 0x31c4, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x1682, 0x1f22, 0x6f02, 0xce97,
-  0xd69a, 0xd69a, 0xd69a, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0920, 0x0100, 0x0e00, 0x1142,
-  0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe73c, 0xd69a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdebb, 0xef5d, 0x2124, 0x1082,
-  0x1082, 0x2104, 0xef5d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x21c4, 0xc6d8, 0x1922, 0x10a2,
-  0x10a2, 0x2945, 0xdefb, 0x4a28, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x05e0, 0x1f02, 0x7702, 0xceb8,
-  0xd69a, 0xd6ba, 0xd69a, 0x10a2, 0x20e3, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0940, 0x0100, 0x0e00, 0x1142,
-  0x10a2, 0x10a2, 0x10a2, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdebb, 0xef5d, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x21a4, 0xd75a, 0xdf3a, 0xd6ba,
-  0xd69a, 0xd69a, 0xdedb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x05e0, 0x1f22, 0x7f43, 0x3a26,
-  0x18a3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0940, 0x0100, 0x0de0, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe73c, 0xd69a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdebb, 0xef5d, 0x2124, 0x1082,
-  0x1082, 0x2104, 0xef5d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x21c4, 0xc6d8, 0x1922, 0x10a2,
-  0x10a2, 0x2945, 0xdefb, 0x4a28, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x05e0, 0x1f02, 0x7702, 0xceb8,
-  0xd69a, 0xd6ba, 0xd69a, 0x10a2, 0x20e3, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0940, 0x0100, 0x0e00, 0x1142,
-  0x10a2, 0x10a2, 0x10a2, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdebb, 0xef5d, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x21a4, 0xd75a, 0xdf3a, 0xd6ba,
-  0xd69a, 0xd69a, 0xdedb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0020, 0x0900, 0x05e0, 0x1f22, 0x7f43, 0x3a26,
-  0x18a3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0b41, 0x2144, 0x3a06, 0x6da1, 0x0940, 0x0100, 0x0de0, 0x00a0,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x31e6, 0x2945, 0x2965, 0x4246, 0x2104, 0x0000, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef5d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xeffd, 0xe7fc, 0xdf3a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x2925, 0xd758, 0x3fc7, 0x1f22, 0x7722,
-  0x1902, 0x20e4, 0xef5d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00e0, 0x20e4, 0x31e5, 0x8ec5, 0xbeb6, 0x2264, 0x1e82,
-  0x1122, 0x2925, 0xdedb, 0x2945, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0380, 0x29c5, 0x2945, 0x2965, 0x31e5, 0x2924, 0xc5f8, 0xd71a,
-  0xd69a, 0xd6ba, 0xd69a, 0x1082, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03c0, 0x2184, 0x2925, 0x2945, 0x2104, 0x0000, 0x10a2, 0x18a3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xeffd, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x2925, 0xd778, 0x3f67, 0x29e5, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00e0, 0x20e4, 0x31e5, 0x8ec5, 0xcf38, 0xd69a, 0xd69a,
-  0xd69a, 0xd69a, 0xd69a, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0380, 0x29c5, 0x2945, 0x2965, 0x3a05, 0x18c3, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03c0, 0x2184, 0x2925, 0x2945, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xeffd, 0xe73c, 0xd69a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x2925, 0xd778, 0x3f47, 0x1102, 0x1082,
-  0x1082, 0x2104, 0xef5d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00e0, 0x20e4, 0x31e5, 0x8ee5, 0xd778, 0x2145, 0x10a2,
-  0x10a2, 0x2945, 0xdedb, 0x2945, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0380, 0x29c5, 0x2945, 0x2945, 0x4a88, 0xd6ba, 0xd69a, 0xd69a,
-  0xd69a, 0xd6ba, 0xd69a, 0x1082, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03c0, 0x2184, 0x2925, 0x2925, 0x2925, 0x10a2, 0x18c3, 0x18c3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe73c, 0xd73a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xdedb, 0xdefb, 0x3244, 0x15e2,
-  0x1122, 0x2104, 0xef5d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x0020, 0x3186, 0x4aa8, 0x6dc1, 0x19c2,
-  0x10a2, 0x2945, 0xdedb, 0x2945, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x2965, 0x2924, 0x2944, 0x4a88, 0xc618,
-  0xd69a, 0xd6ba, 0xd69a, 0x1082, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2924, 0x2945, 0x2925, 0x2925, 0x18c3,
-  0x18c3, 0x18c3, 0x31a6, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xdedb, 0xef7d, 0x39e7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x2124, 0xdedb, 0xd69a, 0xd69a,
-  0xd69a, 0xd69a, 0xd69a, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0020, 0x2104, 0x4208, 0x18e3, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x3186, 0x2945, 0x2945, 0x2965, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe73c, 0xd69a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdedb, 0xef5d, 0x2124, 0x1082,
-  0x1082, 0x2104, 0xef5d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2124, 0xdedb, 0x2945, 0x10a2,
-  0x10a2, 0x2945, 0xdefb, 0x4a28, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd6ba, 0xd69a, 0x10a2, 0x20e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0020, 0x2124, 0x4208, 0x18e3, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x3186, 0x2945, 0x2945, 0x2965, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdedb, 0xef7d, 0x39e7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd69a, 0xdedb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a6, 0x31a6,
-  0x18c3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe73c, 0xd69a,
-  0xd69a, 0xe73c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdedb, 0xef5d, 0x2124, 0x1082,
-  0x1082, 0x2104, 0xef5d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2124, 0xdedb, 0x2945, 0x10a2,
-  0x10a2, 0x2945, 0xdefb, 0x4a28, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0861, 0xd69a, 0xd6ba, 0xd69a,
-  0xd69a, 0xd6ba, 0xd69a, 0x10a2, 0x20e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0020, 0x1082, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02c0, 0x02c0, 0x0260, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01c0, 0x0280, 0x0280, 0x03e0, 0x03c0,
-  0x0540, 0x04c0, 0x00a0, 0x0040, 0x0040, 0x1222, 0x1282, 0x12a2,
-  0x14a2, 0x14a2, 0x1282, 0x0040, 0x0020, 0x0080, 0x03e0, 0x03e0,
-  0x03c0, 0x0380, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xe79c, 0xefbd, 0xd6fa, 0x2124, 0x0000, 0x0040, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0060, 0x0360, 0x03e0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdefb, 0x2344, 0x03e0, 0x03a0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1442, 0x03a0,
-  0x0420, 0x1422, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x0520, 0x1562, 0xefbd, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2104, 0x2104, 0xef5d, 0xefbd, 0x1462, 0x03a0,
-  0x03e0, 0x1402, 0xd71a, 0xffff, 0xef5d, 0xef5d, 0xef7d, 0x39c7,
-  0x39c7, 0xef7d, 0xef5d, 0xef5d, 0xffdf, 0xd73a, 0x1462, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xffff, 0xffff, 0xe71c, 0xce79,
-  0xce79, 0xe71c, 0xffff, 0xffff, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdedb, 0xef7d, 0x39e7, 0x2965,
-  0x2965, 0x39c7, 0xef7d, 0xe71c, 0x4228, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd69a, 0xdedb, 0x4208, 0x2124, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x10a2, 0x31a6, 0x31a6,
-  0x18c3, 0x18c3, 0x2965, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x0200, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0520, 0x04e0, 0x0220, 0x02a0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01c0, 0x02a0, 0x0280, 0x0400, 0x03e0,
-  0x03c0, 0x0380, 0x0060, 0x0020, 0x0040, 0x1222, 0x1282, 0x1262,
-  0x1342, 0x1322, 0x1262, 0x0040, 0x0020, 0x0080, 0x04c0, 0x0540,
-  0x0400, 0x0360, 0x0040, 0x0000, 0x2104, 0xd6da, 0xef7d, 0xef7d,
-  0xef7d, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0020, 0x0360, 0x03e0,
-  0x0420, 0x0360, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x03a0, 0x03c0,
-  0x0400, 0x0380, 0x22e4, 0xdefb, 0xffff, 0xe73c, 0xe73c, 0xffdf,
-  0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf3b, 0x24c4, 0x0400, 0x03a0,
-  0x0420, 0x1422, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d,
-  0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd77a, 0x1442, 0x03a0,
-  0x0520, 0x1d63, 0xefdd, 0xef3d, 0x31a6, 0xad55, 0x2104, 0xe73c,
-  0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1462, 0x03a0,
-  0x03a0, 0x1422, 0xef9d, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d,
-  0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xefbd, 0x1442, 0x03a0,
-  0x03e0, 0x1402, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c,
-  0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1482, 0x03c0,
-  0x0400, 0x1402, 0xd73a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7,
-  0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd75a, 0x1562, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xdefb, 0xef7d, 0x4a49, 0xce79, 0xd69a,
-  0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2344, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xd6ba, 0xdefb, 0x39c7, 0x2965,
-  0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4228, 0x2163, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x2104, 0xd6ba, 0xd6ba, 0xd69a,
-  0xd69a, 0xd69a, 0xd6ba, 0x2124, 0x18e3, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0320, 0x02a0, 0x0200, 0x02a0, 0x02c0,
-  0x0340, 0x02c0, 0x0220, 0x01e0, 0x02c0, 0x02c0, 0x0400, 0x03c0,
-  0x0520, 0x04e0, 0x0240, 0x02c0, 0x0260, 0x01c0, 0x0200, 0x0200,
-  0x0420, 0x0420, 0x0220, 0x01e0, 0x02a0, 0x0280, 0x03a0, 0x03e0,
-  0x03c0, 0x03a0, 0x0200, 0x0060, 0x0020, 0x0040, 0x1242, 0x1262,
-  0x1342, 0x1322, 0x12a2, 0x1222, 0x0040, 0x0020, 0x00c0, 0x04c0,
-  0x0400, 0x0380, 0x0200, 0x0000, 0x0000, 0x2104, 0xd6da, 0xef7d,
-  0xef7d, 0xef7d, 0xef7d, 0xd6da, 0x2104, 0x0000, 0x0040, 0x0380,
-  0x0400, 0x03a0, 0x0200, 0x0040, 0x2104, 0xdedb, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0080, 0x0360,
-  0x0400, 0x0380, 0x0240, 0x2364, 0xdf1b, 0xffff, 0xe73c, 0xe73c,
-  0xffdf, 0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf1b, 0x2444, 0x03a0,
-  0x0440, 0x03a0, 0x12a2, 0xd71a, 0xffff, 0xdedb, 0x31a6, 0x2124,
-  0xef5d, 0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1402,
-  0x0540, 0x04e0, 0x12c2, 0xef7d, 0xef5d, 0x31a6, 0xad55, 0x2104,
-  0xe73c, 0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xef9d, 0x1402,
-  0x03c0, 0x03a0, 0x12c2, 0xef7d, 0xef5d, 0x1082, 0x1082, 0x2124,
-  0xef7d, 0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1402,
-  0x0400, 0x0380, 0x1322, 0xef9d, 0xef5d, 0x2124, 0x2104, 0xd6ba,
-  0xe73c, 0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xefbd, 0x1c23,
-  0x0400, 0x0380, 0x1282, 0xd6da, 0xffff, 0xe73c, 0xd6ba, 0xef7d,
-  0x39c7, 0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd75a, 0x1d63,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xdedb, 0xef7d, 0x4a49, 0xce79,
-  0xd69a, 0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf3b, 0x2424, 0x03c0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x2104, 0xd6ba, 0xdefb, 0x39c7,
-  0x2965, 0x2965, 0x39c7, 0xdedb, 0xdefb, 0x4268, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x2104, 0xd6ba, 0xd6ba,
-  0xd69a, 0xd69a, 0xd69a, 0xdedb, 0x4208, 0x2124, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0x10a2, 0x10a2, 0x18c3, 0x10a2, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x18e3, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03c0, 0x02e0, 0x0300, 0x0260, 0x01c0, 0x0280, 0x02c0,
-  0x0320, 0x02c0, 0x0200, 0x01e0, 0x02a0, 0x0280, 0x03a0, 0x0360,
-  0x0520, 0x04e0, 0x0260, 0x02c0, 0x0080, 0x0020, 0x0040, 0x1262,
-  0x14a2, 0x14a2, 0x12a2, 0x1262, 0x1322, 0x0060, 0x0040, 0x0040,
-  0x03c0, 0x03a0, 0x0260, 0x02e0, 0x0020, 0x0000, 0x2104, 0xd6da,
-  0xefbd, 0xe7bc, 0xe77c, 0xef7d, 0xd6fa, 0x2124, 0x0000, 0x0000,
-  0x0400, 0x0380, 0x0260, 0x03e0, 0x0080, 0x2104, 0xdedb, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x2124, 0x0040,
-  0x0400, 0x0380, 0x0240, 0x02e0, 0x2324, 0xdefb, 0xffff, 0xe73c,
-  0xe73c, 0xffdf, 0xffdf, 0xe73c, 0xe73c, 0xffff, 0xd71a, 0x2c05,
-  0x0400, 0x0380, 0x0240, 0x1342, 0xd73a, 0xffff, 0xdedb, 0x31a6,
-  0x2124, 0xef5d, 0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xefbd,
-  0x0440, 0x03c0, 0x0240, 0x1362, 0xef9d, 0xef5d, 0x31a6, 0xad55,
-  0x2104, 0xe73c, 0xe73c, 0x2104, 0xad55, 0x39c7, 0xe73c, 0xffff,
-  0x0540, 0x04e0, 0x0260, 0x1362, 0xef9d, 0xef5d, 0x1082, 0x1082,
-  0x2124, 0xef7d, 0xef7d, 0x2945, 0x1082, 0x0861, 0xe73c, 0xffff,
-  0x03c0, 0x03a0, 0x0240, 0x1362, 0xefbd, 0xef5d, 0x2124, 0x2104,
-  0xd6ba, 0xe73c, 0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xffff,
-  0x0400, 0x03a0, 0x02c0, 0x1362, 0xd6fa, 0xffff, 0xe73c, 0xd6ba,
-  0xef7d, 0x39c7, 0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffdf, 0xefbd,
-  0x0400, 0x0380, 0x0220, 0x0280, 0x2144, 0xdedb, 0xef7d, 0x4a49,
-  0xce79, 0xd69a, 0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf7b, 0x2da5,
-  0x0400, 0x03a0, 0x01e0, 0x0040, 0x0000, 0x2104, 0xd6ba, 0xdedb,
-  0x39c7, 0x2965, 0x2965, 0x39c7, 0xdedb, 0xdf1b, 0x2424, 0x03c0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x0000, 0x0000, 0x2124, 0xdedb,
-  0xd6ba, 0xd69a, 0xd69a, 0xd6ba, 0xdefb, 0x4268, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x3186,
-  0x18c3, 0x18c3, 0x3186, 0x18e3, 0x3186, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0440, 0x03e0, 0x02a0, 0x0020, 0x0000, 0x0020, 0x1302, 0x1362,
-  0x1b83, 0x1302, 0x12a2, 0x1222, 0x0000, 0x0000, 0x0040, 0x0360,
-  0x0520, 0x04e0, 0x0200, 0x0000, 0x0000, 0x2104, 0xd6da, 0xe77c,
-  0xe77c, 0xe77c, 0xe77c, 0xd6da, 0x2124, 0x0000, 0x0040, 0x0380,
-  0x03c0, 0x03a0, 0x0200, 0x0060, 0x2124, 0xdedb, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xdedb, 0x2104, 0x0080, 0x04c0,
-  0x0400, 0x0380, 0x0260, 0x24a4, 0xdf3b, 0xffff, 0xe73c, 0xe73c,
-  0xffdf, 0xffdf, 0xe73c, 0xe73c, 0xffff, 0xdf1b, 0x23e4, 0x03c0,
-  0x0400, 0x0380, 0x12a2, 0xd73a, 0xffff, 0xdedb, 0x31a6, 0x2124,
-  0xef5d, 0xef7d, 0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x1402,
-  0x0400, 0x0380, 0x12a2, 0xef7d, 0xef5d, 0x31a6, 0xad55, 0x2104,
-  0xe73c, 0xe73c, 0x2104, 0xad55, 0x39c7, 0xef3d, 0xef9d, 0x1402,
-  0x0440, 0x03a0, 0x12a2, 0xef7d, 0xef5d, 0x1082, 0x1082, 0x2124,
-  0xef7d, 0xef7d, 0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1402,
-  0x0540, 0x04e0, 0x12c2, 0xef7d, 0xef7d, 0x2124, 0x2104, 0xd6ba,
-  0xe73c, 0xe73c, 0xd6ba, 0x2124, 0x2104, 0xef5d, 0xef9d, 0x1402,
-  0x03c0, 0x03a0, 0x12a2, 0xd71a, 0xffff, 0xe73c, 0xd6ba, 0xef7d,
-  0x39c7, 0x39c7, 0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd73a, 0x1402,
-  0x0400, 0x03a0, 0x02c0, 0x23c4, 0xdf1b, 0xef7d, 0x4a49, 0xce79,
-  0xd69a, 0xd69a, 0xd69a, 0x4a49, 0xef7d, 0xdf5b, 0x24a4, 0x03e0,
-  0x0400, 0x0380, 0x0220, 0x0280, 0x2144, 0xd6ba, 0xdefb, 0x39c7,
-  0x2965, 0x2965, 0x39c7, 0xdedb, 0xdf1b, 0x2384, 0x04e0, 0x0520,
-  0x0400, 0x03a0, 0x01e0, 0x0040, 0x0000, 0x2104, 0xd6ba, 0xd6ba,
-  0xd69a, 0xd69a, 0xd6ba, 0xdefb, 0x4248, 0x0260, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x0000, 0x0000, 0x18c3, 0x39c7,
-  0x39c7, 0x39c7, 0x39c7, 0x31a6, 0x2924, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x20e3,
-  0x0000, 0x0000, 0x18e3, 0x0020, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x03e0, 0x0060, 0x0000, 0x0020, 0x12a2, 0x1a83, 0x1322, 0x1362,
-  0x1b83, 0x12e2, 0x0020, 0x0000, 0x0020, 0x0280, 0x0400, 0x03c0,
-  0x04a0, 0x0060, 0x0000, 0x2104, 0xd6da, 0xe77c, 0xe77c, 0xe77c,
-  0xe77c, 0xd6da, 0x2124, 0x0000, 0x0020, 0x0280, 0x0420, 0x03e0,
-  0x0360, 0x0080, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xdedb, 0x2124, 0x0040, 0x0280, 0x0500, 0x0520,
-  0x03e0, 0x2404, 0xdf1b, 0xffff, 0xe73c, 0xe73c, 0xffdf, 0xffdf,
-  0xe73c, 0xe73c, 0xffff, 0xdf1b, 0x2384, 0x02a0, 0x03a0, 0x03c0,
-  0x1462, 0xd75a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d, 0xef7d,
-  0x2124, 0x31a6, 0xdedb, 0xffff, 0xd73a, 0x1342, 0x03e0, 0x03a0,
-  0x1462, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c, 0xe73c,
-  0x2104, 0xad55, 0x39c7, 0xef3d, 0xefbd, 0x14a2, 0x0400, 0x03a0,
-  0x1482, 0xe79c, 0xef5d, 0x1082, 0x1082, 0x2124, 0xef7d, 0xef7d,
-  0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1342, 0x03e0, 0x03c0,
-  0x1d63, 0xefbd, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c, 0xe73c,
-  0xd6ba, 0x2124, 0x2104, 0xef5d, 0xef9d, 0x1322, 0x03e0, 0x03c0,
-  0x1402, 0xd73a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7, 0x39c7,
-  0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd71a, 0x1302, 0x03e0, 0x03a0,
-  0x0400, 0x2444, 0xdf3b, 0xef7d, 0x4a49, 0xce79, 0xd69a, 0xd69a,
-  0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x23a4, 0x02c0, 0x0400, 0x03e0,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xdedb, 0x39c7, 0x2965, 0x2965,
-  0x39c7, 0xdedb, 0xdebb, 0x2144, 0x0280, 0x02c0, 0x0500, 0x0520,
-  0x0400, 0x03a0, 0x01c0, 0x2124, 0xd6ba, 0xd6ba, 0xce79, 0xd69a,
-  0xd6ba, 0xdedb, 0x2124, 0x0000, 0x2143, 0x0280, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0060, 0x0000, 0x1082, 0x10a2, 0x18e3, 0x39c7,
-  0x39c7, 0x31a6, 0x2104, 0x2104, 0x2925, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x18e3, 0x20e3,
-  0x0000, 0x0000, 0x18e3, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x03c0, 0x0340, 0x02c0, 0x0300, 0x0280, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x0260, 0x01e0, 0x01c0, 0x02c0, 0x02c0, 0x03e0, 0x03c0,
-  0x0060, 0x0040, 0x0060, 0x1322, 0x1302, 0x1262, 0x1282, 0x12a2,
-  0x1442, 0x0080, 0x0020, 0x0060, 0x02c0, 0x02c0, 0x0400, 0x03e0,
-  0x0000, 0x0000, 0x2104, 0xd6fa, 0xef9d, 0xef7d, 0xe77c, 0xef7d,
-  0xd71a, 0x2124, 0x0000, 0x0020, 0x02c0, 0x02e0, 0x0500, 0x0520,
-  0x0040, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xdedb, 0x2104, 0x0060, 0x02c0, 0x02c0, 0x03a0, 0x03c0,
-  0x2464, 0xd71a, 0xffff, 0xe73c, 0xe73c, 0xffdf, 0xffdf, 0xe73c,
-  0xe73c, 0xffff, 0xdefb, 0x2364, 0x0320, 0x02e0, 0x03e0, 0x03a0,
-  0xefbd, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d, 0xef7d, 0x2124,
-  0x31a6, 0xdedb, 0xffff, 0xd75a, 0x14a2, 0x0460, 0x0400, 0x03a0,
-  0xffff, 0xe73c, 0x31a6, 0xad55, 0x2104, 0xe73c, 0xe73c, 0x2104,
-  0xad55, 0x39c7, 0xef3d, 0xefbd, 0x1362, 0x02c0, 0x03e0, 0x03c0,
-  0xffff, 0xe73c, 0x1082, 0x1082, 0x2124, 0xef7d, 0xef7d, 0x2945,
-  0x1082, 0x0861, 0xef3d, 0xef9d, 0x1362, 0x02a0, 0x03e0, 0x03c0,
-  0xffff, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c, 0xe73c, 0xd6ba,
-  0x2124, 0x2104, 0xef5d, 0xefbd, 0x1382, 0x02a0, 0x03e0, 0x03a0,
-  0xef9d, 0xffdf, 0xe73c, 0xd6ba, 0xef7d, 0x39c7, 0x39c7, 0xef5d,
-  0xd6ba, 0xe73c, 0xffff, 0xd6fa, 0x1362, 0x02a0, 0x0400, 0x03e0,
-  0x24a4, 0xd75a, 0xef7d, 0x4a49, 0xce79, 0xd69a, 0xd69a, 0xd69a,
-  0x4a49, 0xef7d, 0xdedb, 0x2144, 0x02a0, 0x02e0, 0x0500, 0x0520,
-  0x0400, 0x2444, 0xd71a, 0xdedb, 0x39c7, 0x2965, 0x2965, 0x39c7,
-  0xdedb, 0xdefb, 0x2124, 0x0000, 0x2143, 0x0280, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x2144, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a, 0xd6ba,
-  0xdedb, 0x4208, 0x2104, 0x2104, 0x2925, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00a0, 0x0000, 0x1082, 0x10a2, 0x18c3, 0x31a6, 0x31a6,
-  0x10a2, 0x0020, 0x18e3, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380,
-  0x0420, 0x0360, 0x02a0, 0x02c0, 0x0280, 0x01e0, 0x02a0, 0x02c0,
-  0x0320, 0x02c0, 0x01e0, 0x01c0, 0x0280, 0x02c0, 0x03e0, 0x03c0,
-  0x04c0, 0x00c0, 0x0040, 0x0060, 0x12c2, 0x1262, 0x1282, 0x12a2,
-  0x14a2, 0x1482, 0x0080, 0x0020, 0x0060, 0x0280, 0x0420, 0x03e0,
-  0x0360, 0x0040, 0x0000, 0x2104, 0xd6fa, 0xef7d, 0xe77c, 0xef7d,
-  0xefbd, 0xd71a, 0x2124, 0x0000, 0x0000, 0x0280, 0x0500, 0x0520,
-  0x03c0, 0x0080, 0x2104, 0xdedb, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xdedb, 0x2124, 0x0040, 0x0260, 0x03a0, 0x03c0,
-  0x0400, 0x2404, 0xdf1b, 0xffff, 0xe73c, 0xe73c, 0xffdf, 0xffdf,
-  0xe73c, 0xe73c, 0xffff, 0xdf1b, 0x2384, 0x02e0, 0x03e0, 0x03a0,
-  0x1462, 0xd75a, 0xffff, 0xdedb, 0x31a6, 0x2124, 0xef5d, 0xef7d,
-  0x2124, 0x31a6, 0xdedb, 0xffff, 0xd75a, 0x14a2, 0x0400, 0x03a0,
-  0x1482, 0xefbd, 0xef5d, 0x31a6, 0xad55, 0x2104, 0xe73c, 0xe73c,
-  0x2104, 0xad55, 0x39c7, 0xef3d, 0xef9d, 0x1342, 0x03e0, 0x03c0,
-  0x1d63, 0xe7bc, 0xef3d, 0x1082, 0x1082, 0x2124, 0xef7d, 0xef7d,
-  0x2945, 0x1082, 0x0861, 0xef3d, 0xef9d, 0x1322, 0x03e0, 0x03c0,
-  0x1402, 0xef9d, 0xef5d, 0x2124, 0x2104, 0xd6ba, 0xe73c, 0xe73c,
-  0xd6ba, 0x2124, 0x2104, 0xef5d, 0xef9d, 0x1322, 0x03e0, 0x03a0,
-  0x1442, 0xd73a, 0xffff, 0xe73c, 0xd6ba, 0xef7d, 0x39c7, 0x39c7,
-  0xef5d, 0xd6ba, 0xe73c, 0xffff, 0xd73a, 0x1322, 0x0400, 0x03e0,
-  0x0400, 0x2444, 0xdf5b, 0xef7d, 0x4a49, 0xce79, 0xd69a, 0xd69a,
-  0xd69a, 0x4a49, 0xef7d, 0xdf1b, 0x2384, 0x02c0, 0x0500, 0x0520,
-  0x0400, 0x0380, 0x22c4, 0xd6da, 0xdedb, 0x39c7, 0x2965, 0x2965,
-  0x39c7, 0xdedb, 0xdedb, 0x2945, 0x1943, 0x0280, 0x03a0, 0x03e0,
-  0x0420, 0x0320, 0x0040, 0x2104, 0xd6ba, 0xd6ba, 0xd69a, 0xd69a,
-  0xd6ba, 0xdedb, 0x4228, 0x20e3, 0x2924, 0x2184, 0x0380, 0x03a0,
-  0x04c0, 0x00c0, 0x0000, 0x0000, 0x1082, 0x18c3, 0x31a6, 0x31a6,
-  0x18c3, 0x10a2, 0x18e3, 0x0841, 0x2104, 0x2925, 0x21a4, 0x0380,
-  0x0360, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x2104, 0x2164, 0x0360,
-  0x03a0, 0x0060, 0x0000, 0x2104, 0x2104, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0x2104, 0x0000, 0x0020, 0x2164, 0x0380
-};
-
-const Animation panda_eating_grassAnimation = {
-  .name = "Panda Eating Grass",
-  .frameCount = 33,
-  .width = 16,
-  .height = 16,
-  .frameDurations = panda_eating_grassDurations,
-  .animationFrames = panda_eating_grassFrames
-};
-#endif // ANIMATION_PANDA_EATING_GRASS_H
@@ -1,118 +0,0 @@
-// parrot.h - Auto-generated from parrot.json
-#ifndef ANIMATION_PARROT_H
-#define ANIMATION_PARROT_H
-
-#include "animation_types.h"
-
-// Frame Durations for parrot (in 100ms units)
-static const uint8_t PROGMEM parrotDurations[] = { 2, 2, 2 };
-
-// RGB565 Frame Data for parrot
-static const uint16_t PROGMEM parrotFrames[] = {
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0x0021, 0x0021,
-  0x0021, 0x0021, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0, 0x0021, 0x0021, 0x013e, 0x013e,
-  0x013e, 0x013e, 0x0021, 0x0021, 0xfbe0, 0xfbe0, 0xfbe0, 0xfbe0,
-  0xfc20, 0xfc20, 0xfc20, 0x0021, 0x013e, 0x013e, 0x141e, 0x141e,
-  0x141e, 0x141e, 0x013e, 0x013e, 0x0021, 0xfc20, 0xfc20, 0xfc20,
-  0xfc20, 0xfc20, 0x0021, 0x013e, 0x141e, 0x141e, 0x0efe, 0x0efe,
-  0x0efe, 0x0efe, 0x141e, 0x141e, 0x013e, 0x0021, 0xfc20, 0xfc20,
-  0xfc60, 0xfc60, 0x0021, 0x013e, 0x141e, 0x0efe, 0x07df, 0xcfdf,
-  0xcfdf, 0x07df, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfc60, 0xfc60,
-  0xfc60, 0x0021, 0x013e, 0xf5e0, 0xf5e0, 0x0efe, 0xcfdf, 0xcfdf,
-  0xcfdf, 0xcfdf, 0x0efe, 0xf5e0, 0xf5e0, 0x013e, 0x0021, 0xfc60,
-  0xfca0, 0x0021, 0xf5e0, 0xf5e0, 0x0021, 0xf5e0, 0xcfdf, 0xcfdf,
-  0xcfdf, 0xcfdf, 0xf5e0, 0x0021, 0xf5e0, 0xf5e0, 0x0021, 0xfca0,
-  0xfca0, 0x0021, 0xf5e0, 0xf5e0, 0x0021, 0xf5e0, 0xf2c1, 0xf2c1,
-  0xf2c1, 0xf2c1, 0xf5e0, 0x0021, 0xf5e0, 0xf5e0, 0x0021, 0xfca0,
-  0xfce0, 0x0021, 0x013e, 0xf5e0, 0xf5e0, 0xf5e0, 0xf2c1, 0xf2c1,
-  0xf2c1, 0xf2c1, 0xf5e0, 0xf5e0, 0xf5e0, 0x013e, 0x0021, 0xfce0,
-  0xfce0, 0xfce0, 0x0021, 0x013e, 0x141e, 0xf5e0, 0xf2c1, 0xf2c1,
-  0xf2c1, 0xf2c1, 0xf5e0, 0x0efe, 0x141e, 0x0021, 0xfce0, 0xfce0,
-  0xfd20, 0xfd20, 0x0021, 0x013e, 0x141e, 0x0efe, 0xf2c1, 0xf2c1,
-  0xf2c1, 0xf2c1, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfd20, 0xfd20,
-  0xfd20, 0xfd20, 0xfd20, 0x0021, 0x013e, 0x141e, 0x0efe, 0xf2c1,
-  0xf2c1, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfd20, 0xfd20, 0xfd20,
-  0xfd60, 0xfd60, 0x0021, 0x013e, 0x141e, 0x0efe, 0x07df, 0x07df,
-  0x07df, 0x07df, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfd60, 0xfd60,
-  0xfd60, 0x0021, 0x013e, 0x141e, 0x0efe, 0x07df, 0x07df, 0x8fbe,
-  0x8fbe, 0x07df, 0x07df, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfd60,
-  0xfda0, 0x0021, 0x013e, 0x141e, 0x0efe, 0x07df, 0x8fbe, 0xcfdf,
-  0xcfdf, 0x8fbe, 0x07df, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfda0,
-  0xfda0, 0x0021, 0x013e, 0x141e, 0x0efe, 0x07df, 0x8fbe, 0xcfdf,
-  0xcfdf, 0x8fbe, 0x07df, 0x0efe, 0x141e, 0x013e, 0x0021, 0xfda0,
-  0xf3c0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbe0, 0xfbe0, 0xe380, 0xe380,
-  0xe380, 0xe380, 0xfbe0, 0xfbe0, 0xfbc0, 0xfbc0, 0xfbc0, 0xfbc0,
-  0xf3e0, 0xf3e0, 0xf3e0, 0xfbe0, 0xeba0, 0xd340, 0x28c3, 0x1883,
-  0x1883, 0x28c3, 0xd340, 0xeba0, 0xfbe0, 0xf3e0, 0xf3e0, 0xfbe0,
-  0xf400, 0xf400, 0xfc20, 0xd380, 0x28c2, 0x1085, 0x0139, 0x013b,
-  0x013b, 0x0139, 0x1085, 0x28c2, 0xd380, 0xfc00, 0xf400, 0xfc00,
-  0xf420, 0xfc20, 0xd380, 0x28e4, 0x0139, 0x017b, 0x0bde, 0x0c1e,
-  0x0c1e, 0x0bde, 0x017b, 0x0139, 0x20e5, 0xd380, 0xfc20, 0xfc20,
-  0xfc40, 0xec00, 0x28c2, 0x0119, 0x0b9e, 0x0c3e, 0x0e7e, 0x1ebe,
-  0x1ebe, 0x0e7e, 0x0c5e, 0x0b9e, 0x0119, 0x28c2, 0xec00, 0xfc60,
-  0xfc60, 0xd3c0, 0x1085, 0x1199, 0x243c, 0x0e9e, 0x1f9e, 0xafbe,
-  0xafbe, 0x279e, 0x0e9e, 0x243c, 0x1199, 0x1085, 0xd3a0, 0xfc60,
-  0xe420, 0x28e3, 0x2195, 0xd524, 0xd5c4, 0x3eb9, 0xafbf, 0xc7df,
-  0xc7df, 0xafbf, 0x3eba, 0xd5c4, 0xd524, 0x21b5, 0x28e3, 0xe420,
-  0xe420, 0x2901, 0xcd02, 0xf5e0, 0xe560, 0xdde4, 0xcf3a, 0xcf5c,
-  0xcf5c, 0xcf3a, 0xdde5, 0xdd60, 0xf5e0, 0xd522, 0x2901, 0xe420,
-  0xe440, 0x2901, 0xcd22, 0xe580, 0x49e0, 0xe520, 0xf363, 0xeb23,
-  0xeb23, 0xf363, 0xe520, 0x49e0, 0xe560, 0xd522, 0x2901, 0xe440,
-  0xe480, 0x2903, 0x2195, 0xcd05, 0xd542, 0xf580, 0xf300, 0xf2a0,
-  0xf2a0, 0xf300, 0xf580, 0xd582, 0xcd65, 0x21b5, 0x2903, 0xe480,
-  0xfd00, 0xd460, 0x1085, 0x119a, 0x343a, 0xd585, 0xf300, 0xf2c1,
-  0xf2c1, 0xf300, 0xd5c4, 0x367a, 0x1bda, 0x10c5, 0xd440, 0xfd00,
-  0xfd20, 0xecc0, 0x2902, 0x0119, 0x0bbe, 0x2dfa, 0xcb65, 0xda80,
-  0xda80, 0xcb45, 0x2e1a, 0x0c1e, 0x0159, 0x2902, 0xecc0, 0xfd20,
-  0xfd40, 0xfd40, 0xc420, 0x10a6, 0x019b, 0x0c7e, 0x1df9, 0x2902,
-  0x2902, 0x1df9, 0x0c7e, 0x019b, 0x10a7, 0xc420, 0xfd40, 0xfd40,
-  0xfd60, 0xdca0, 0x2904, 0x0959, 0x0bfe, 0x0e9e, 0x173c, 0xc345,
-  0xc345, 0x173c, 0x0e9e, 0x0bfe, 0x0979, 0x2905, 0xd480, 0xfd60,
-  0xed20, 0x2902, 0x0119, 0x0bde, 0x0e7e, 0x079e, 0x1f9e, 0x8f5c,
-  0x8f5c, 0x1f9e, 0x079e, 0x0e9e, 0x0bde, 0x0119, 0x2903, 0xed20,
-  0xe500, 0x18a3, 0x013b, 0x141e, 0x0ebe, 0x0f9e, 0x7f9e, 0xbfbe,
-  0xbfbe, 0x7f9e, 0x0f9e, 0x0ebe, 0x141e, 0x013b, 0x18a3, 0xe500,
-  0xf1e0, 0xf1e0, 0xf1e0, 0xf200, 0xe1c0, 0xc9a0, 0x1863, 0x0023,
-  0x0023, 0x1063, 0xc9a0, 0xe1c0, 0xf200, 0xf1e0, 0xf1e0, 0xf1e0,
-  0xf200, 0xf200, 0xf220, 0xd1c0, 0x2882, 0x1865, 0x0939, 0x095b,
-  0x095b, 0x0939, 0x1865, 0x2882, 0xd1c0, 0xf220, 0xf200, 0xf220,
-  0xf220, 0xf220, 0xd1c0, 0x28a4, 0x0139, 0x017b, 0x0bde, 0x0c1e,
-  0x0c1e, 0x0bde, 0x017b, 0x0139, 0x20a5, 0xd1c0, 0xf220, 0xf220,
-  0xf240, 0xe220, 0x2882, 0x0119, 0x0b9e, 0x0c3e, 0x0e7e, 0x1ebe,
-  0x1ebe, 0x0e7e, 0x0c5e, 0x0b9e, 0x0119, 0x2882, 0xe220, 0xf240,
-  0xf260, 0xd200, 0x1065, 0x1199, 0x243c, 0x0e9e, 0x1f9e, 0xafbe,
-  0xafbe, 0x279e, 0x0e9e, 0x245c, 0x1199, 0x1065, 0xca00, 0xf260,
-  0xe260, 0x28a3, 0x21b5, 0xcd24, 0xc564, 0x3eb9, 0xafbf, 0xc7df,
-  0xc7df, 0xafbf, 0x3eba, 0xc564, 0xd524, 0x29b5, 0x28a3, 0xe260,
-  0xda60, 0x28c1, 0xd522, 0xe560, 0x3960, 0xcd84, 0xcf3a, 0xcf5c,
-  0xcf5c, 0xcf5a, 0xcd85, 0x3960, 0xe560, 0xd522, 0x28c1, 0xda40,
-  0xda80, 0x28c1, 0xcd22, 0xe560, 0x3980, 0xdd20, 0xf363, 0xeb23,
-  0xeb23, 0xf363, 0xe520, 0x3960, 0xe560, 0xd522, 0x28c1, 0xda80,
-  0xe2a0, 0x28a3, 0x21b5, 0xcd05, 0xd562, 0xf580, 0xf300, 0xf2a0,
-  0xf2a0, 0xf300, 0xf580, 0xd5a2, 0xcd65, 0x21b5, 0x28a3, 0xe2a0,
-  0xf300, 0xd2a0, 0x1085, 0x119a, 0x343a, 0xd585, 0xf300, 0xf2c1,
-  0xf2c1, 0xf300, 0xd5c4, 0x367a, 0x1bda, 0x10a5, 0xd2a0, 0xf320,
-  0xfb20, 0xe2e0, 0x28c2, 0x0119, 0x0bbe, 0x2dfa, 0xcb65, 0xf2a0,
-  0xf2a0, 0xd365, 0x2e1a, 0x0c1e, 0x0159, 0x28c2, 0xe2e0, 0xfb20,
-  0xf340, 0xf340, 0xc2a0, 0x1086, 0x019b, 0x0c7e, 0x2e3a, 0xcb65,
-  0xcb65, 0x2e3a, 0x0c7e, 0x019b, 0x1087, 0xc2a0, 0xf340, 0xf360,
-  0xf360, 0xd2e0, 0x28c4, 0x0959, 0x0bfe, 0x0e7e, 0x079e, 0x1f5c,
-  0x1f5c, 0x079e, 0x0e9e, 0x0bfe, 0x0979, 0x28c5, 0xd2e0, 0xf360,
-  0xe340, 0x28c2, 0x0119, 0x0bde, 0x0e7e, 0x079e, 0x17be, 0x7fbe,
-  0x7fbe, 0x17be, 0x079e, 0x0e9e, 0x0bde, 0x0139, 0x28c3, 0xe340,
-  0xe340, 0x1883, 0x013b, 0x141e, 0x0ebe, 0x0f9e, 0x7f9e, 0xbfbe,
-  0xbfbe, 0x7f9e, 0x0f9e, 0x0ebe, 0x141e, 0x013b, 0x1883, 0xe340,
-  0xe380, 0x1883, 0x013b, 0x13fe, 0x0ebe, 0x0f9e, 0x879e, 0xc7be,
-  0xc7be, 0x879e, 0x0f9e, 0x0ebe, 0x141e, 0x013b, 0x1883, 0xe380
-};
-
-const Animation parrotAnimation = {
-  .name = "Parrot",
-  .frameCount = 3,
-  .width = 16,
-  .height = 16,
-  .frameDurations = parrotDurations,
-  .animationFrames = parrotFrames
-};
-#endif // ANIMATION_PARROT_H
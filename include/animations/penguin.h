@@ -1,662 +0,0 @@
-// penguin.h - Auto-generated from penguin.json
-#ifndef ANIMATION_PENGUIN_H
-#define ANIMATION_PENGUIN_H
-
-#include "animation_types.h"
-
-// Frame Durations for penguin (in 100ms units)
-static const uint8_t PROGMEM penguinDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for penguin
-static const uint16_t PROGMEM penguinFrames[] = {
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0xffff, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x2124, 0x2124,
-  0x2124, 0x2124, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x2124, 0x2124, 0x39e7, 0x39e7,
-  0x39e7, 0x39e7, 0x2124, 0x2124, 0x86be, 0xffff, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x86be, 0x2124, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x39e7, 0x2124, 0x86be, 0x6eff, 0x86be, 0x86be,
-  0x86be, 0x86be, 0x86be, 0x2124, 0x39e7, 0x4228, 0x528a, 0x528a,
-  0x528a, 0x528a, 0xb6fc, 0xa659, 0x2124, 0x84f8, 0x6eff, 0x86be,
-  0x86be, 0x86be, 0x6eff, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0xc79e, 0xb6fc, 0x0000, 0x8535, 0x9d9a, 0x6eff, 0x86be,
-  0x86be, 0x6eff, 0x84f8, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0xc79e, 0xb6fc, 0xa659, 0x8535, 0xe340, 0x84f8, 0x6eff,
-  0x6eff, 0x84f8, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0xc79e, 0xb6fc, 0xa659, 0x8535, 0xb1e0, 0x84f8, 0x6eff,
-  0x84f8, 0x9d9a, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0xc79e, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x84f8,
-  0x9d9a, 0x9d9a, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0xffff, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x9d9a,
-  0x9d9a, 0x9d9a, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0x528a, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x9d9a,
-  0x9d9a, 0x9d9a, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0x528a, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x9d9a,
-  0x9d9a, 0x9d9a, 0x9d9a, 0xffff, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0x528a, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x9d9a,
-  0x9d9a, 0x9d9a, 0x9d9a, 0x2124, 0x39e7, 0x4228, 0x528a, 0x5acb,
-  0x5acb, 0x528a, 0xb6fc, 0xa659, 0x8535, 0x9d9a, 0x9d9a, 0x9d9a,
-  0x86bd, 0x86bd, 0x8ebd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x8ebd, 0xd77e, 0x8ebd, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x86bd, 0x8ebd, 0x86bd, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x31a6, 0x2986, 0x3208, 0x865c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4a8a, 0x3a08, 0x39a6, 0xc6bb, 0x7ede, 0x7e9d, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x4a69, 0x528a,
-  0x632c, 0xa618, 0xa638, 0x4228, 0x39e8, 0x74f8, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x632c,
-  0xae7a, 0x3a49, 0x9df8, 0x5268, 0x3985, 0x8cf6, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4228, 0x528a, 0x632c,
-  0xc75d, 0xb6fc, 0xb699, 0xcb42, 0xd2e0, 0xcba5, 0x8517, 0x6ebf,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x39c7, 0x4228, 0x528a, 0x630c,
-  0xc75d, 0xc79e, 0xb699, 0xb2a3, 0xb283, 0x9cf6, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x630c,
-  0xc75d, 0xc77e, 0xb6db, 0xa5d7, 0x8d14, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x630c,
-  0xc75d, 0xc77e, 0xb6db, 0xa639, 0x8555, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x630c,
-  0xdf1c, 0xc77e, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4208, 0x528a, 0x52aa,
-  0x6b6d, 0xbf1c, 0xb6fc, 0xa639, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x31a6, 0x4a28, 0x4228, 0x528a, 0x52aa,
-  0x5b0c, 0xbefc, 0xb6fc, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d18, 0x4208, 0xce59, 0x52aa, 0x4a69, 0x52aa,
-  0x630c, 0xbefc, 0xb6fc, 0x9e39, 0x8d35, 0x9579, 0x957a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x869d, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x8ebd, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x8ebd, 0xdf7e, 0x8ede, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x8ebd, 0x7e5c, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39a6, 0x31a6, 0x2986, 0x31e8, 0x7e3b, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4a8a, 0x4a69, 0x39c7, 0x3a08, 0x7e3b, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x5b2c,
-  0x9db7, 0xae9a, 0x5aeb, 0xc639, 0x8515, 0x7d38, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4208, 0x5aec, 0xae79,
-  0x3a49, 0xae17, 0x5ac9, 0x5227, 0x2923, 0x8518, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4208, 0x5aeb, 0xc75d,
-  0xbefb, 0xdc06, 0xd300, 0xcae0, 0xc343, 0x9d38, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xc75d,
-  0xcfdf, 0xc6b9, 0xb2c4, 0xb283, 0x94d2, 0x9579, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xc75d,
-  0xcfdf, 0xc77e, 0xb679, 0xa5d7, 0x8535, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xbefc,
-  0xcfbf, 0xc77d, 0xb6fc, 0xa639, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x528a, 0x73cf,
-  0xc77d, 0xc77e, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4208, 0x5aeb, 0xd6ba,
-  0xcfbf, 0xc77d, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x31a6, 0x4a28, 0x4228, 0x528a, 0x6b6e,
-  0xc75d, 0xc77e, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d18, 0x4208, 0xce59, 0x52aa, 0x4a69, 0x5b0c,
-  0xc75d, 0xc77e, 0xb6db, 0x9e39, 0x8d35, 0x9579, 0x957a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8edd,
-  0xe79f, 0x8edd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x8ede, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x86bd, 0x8ede, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x8ebd, 0xd73d, 0x7dfa, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3a08, 0x2986, 0x39c7, 0x39a6,
-  0x39a6, 0x39c7, 0x2986, 0x31e8, 0x7e3b, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x2986, 0x31a6, 0x4208, 0x4a8a,
-  0x4a69, 0x4228, 0x39a6, 0x3a08, 0x7e3b, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39a7, 0x4208, 0x5b0c, 0x95b7,
-  0xa659, 0x52cb, 0x4a6a, 0xce9a, 0x8514, 0x7d18, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39a6, 0x4a8a, 0xa618, 0x3a49,
-  0xb658, 0x6b0b, 0x5a89, 0x9d54, 0x29a6, 0x8518, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39a6, 0x4a8a, 0xb71c, 0xbefb,
-  0xdc26, 0xd300, 0xd300, 0xcba4, 0x84b2, 0x9579, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x31a6, 0x4a69, 0xbefc, 0xcfdf,
-  0xcf1a, 0xbac4, 0xb2a3, 0xa595, 0x8d56, 0x9579, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x3186, 0x31a6, 0x4a8a, 0xbf1c, 0xcfdf,
-  0xcfbf, 0xc6fb, 0xb679, 0x9e39, 0x8d55, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4a69, 0xb6ba, 0xcfbf,
-  0xcfbf, 0xc77e, 0xb6fc, 0xa639, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x632d, 0xc75d,
-  0xcfdf, 0xc77d, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xe77d,
-  0xd7df, 0xc77d, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xc75d,
-  0xcfdf, 0xc77d, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xc75d,
-  0xcfbf, 0xc77d, 0xb6db, 0x9e39, 0x8d35, 0x9579, 0x957a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8ebd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x8ede, 0xdf9f,
-  0x8ede, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x86bd, 0x8ede, 0x86bd, 0x7e3b, 0x863b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x8ebd, 0xd73d, 0x7dfa, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3a08, 0x2986, 0x31a6, 0x39a6,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5b, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x2986, 0x31a6, 0x4a8a, 0x4a69,
-  0x4228, 0x4228, 0x3a07, 0x3a08, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39a6, 0x52aa, 0x95b6, 0xa659,
-  0x52cb, 0x52cb, 0x95b7, 0x8514, 0x4a8b, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x2986, 0x4228, 0x9596, 0x3a28, 0xae37,
-  0x6b2b, 0x62ea, 0xa5b5, 0x3a08, 0xce59, 0x9dba, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2966, 0x4228, 0xae9a, 0xb699, 0xdc06,
-  0xd300, 0xd300, 0xd3e5, 0x9d95, 0x9576, 0x9579, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x4228, 0xae7a, 0xc79e, 0xcefa,
-  0xbac4, 0xb2c3, 0xb637, 0xa659, 0x8535, 0x9579, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x2986, 0x4228, 0xae9a, 0xc77e, 0xcfbf,
-  0xcf5d, 0xbefb, 0xb6db, 0xa639, 0x8d55, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x2986, 0x4208, 0xa638, 0xc77d, 0xcfbf,
-  0xcfdf, 0xc77e, 0xb6db, 0x9e38, 0x84f4, 0x9579, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c6, 0x52cb, 0xbf1c, 0xcfdf,
-  0xcfbf, 0xc77d, 0xb6fb, 0x9dd7, 0x3a29, 0x8d18, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4a69, 0xbefc, 0xcfdf,
-  0xcfbf, 0xc77d, 0xb6fb, 0x9dd7, 0x39e7, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4a8a, 0xbefc, 0xd7df,
-  0xefdf, 0xc77d, 0xb6fb, 0x9dd7, 0x39e8, 0x8d18, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4a69, 0xbefc, 0xcfbf,
-  0xcfbf, 0xc77d, 0xb6fb, 0x9dd7, 0x39e8, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8ebd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x8ede, 0xdf9f,
-  0x8ede, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x863b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x8ebd, 0x7e5c, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x8ede, 0xd73d, 0x3a28, 0x2986, 0x31a6, 0x39c7,
-  0x39c7, 0x31a6, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7dfa, 0x29a6, 0x4208, 0x4a69, 0x4228,
-  0x4228, 0x4a69, 0x4208, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x4249, 0x8d35, 0xa639, 0x52cb,
-  0x52cb, 0xa639, 0x8d35, 0x4249, 0x31c7, 0x74d7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x3208, 0x84f4, 0x3208, 0xae37, 0x6b2b,
-  0x6b2b, 0xae37, 0x3208, 0x8514, 0x39e7, 0x8d58, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x31e7, 0x95d7, 0xae38, 0xd406, 0xd300,
-  0xd300, 0xd406, 0xae17, 0x95d7, 0x4228, 0xd6bb, 0x8579, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8cf7, 0x39e8, 0x95d7, 0xb6fc, 0xc6b9, 0xbac4,
-  0xbac4, 0xc6b9, 0xb6fc, 0x9dd7, 0x39e8, 0x9538, 0x8539, 0x6e9e,
-  0x8518, 0x957a, 0x8d18, 0x39e8, 0x9dd7, 0xb6fc, 0xc77e, 0xcf5d,
-  0xcf5d, 0xc77e, 0xb6fc, 0x9df7, 0x39e8, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x39e8, 0x9576, 0xb6db, 0xc77d, 0xcfdf,
-  0xcfdf, 0xc77d, 0xb6db, 0x9596, 0x39e8, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x84d7, 0x2986, 0x4269, 0xae7a, 0xc77e, 0xcfbf,
-  0xcfbf, 0xc77e, 0xae9a, 0x4a69, 0x2986, 0x84d6, 0x957a, 0x959a,
-  0x959a, 0x8d38, 0x31c7, 0x2124, 0x4228, 0xae7a, 0xc77e, 0xcfbf,
-  0xcfbf, 0xc77e, 0xae7a, 0x4228, 0x2124, 0x31c7, 0x8d38, 0x9d9a,
-  0x959a, 0x8d38, 0x2966, 0x2124, 0x4228, 0xae7a, 0xc77e, 0xcfbf,
-  0xcfbf, 0xc77e, 0xae7a, 0x4228, 0x2124, 0x2966, 0x8d38, 0x9d9a,
-  0x959a, 0x8d38, 0x2986, 0x2124, 0x4228, 0xae7a, 0xc77e, 0xcfbf,
-  0xcfbf, 0xefdf, 0xb69a, 0x4228, 0x2124, 0x2986, 0x8d18, 0x9d9a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x8ede, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x865b,
-  0xd71c, 0x865b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x29a6,
-  0x31a6, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x86bd, 0x8ede, 0x7e5c, 0x31e8, 0x2986, 0x39c7, 0x39c7,
-  0x31a6, 0x31a6, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x8ebd, 0xdf9e, 0x7dfa, 0x3208, 0x4208, 0x4228, 0x4228,
-  0x4a69, 0x4a8a, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x865c, 0x428a, 0x8514, 0xa639, 0x52cb, 0x52cb,
-  0xa639, 0x95b7, 0x52aa, 0x39c7, 0x31c8, 0x74d7, 0x76be, 0x86be,
-  0x869d, 0x7ebe, 0x769d, 0x7492, 0x31c7, 0xa5d6, 0x6b2b, 0x6b2b,
-  0xae37, 0x3a28, 0x95b6, 0x4228, 0x2966, 0x9558, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x7d38, 0x8535, 0x9575, 0xd3e5, 0xd300, 0xd300,
-  0xdc06, 0xb699, 0xae9a, 0x4228, 0x31a6, 0xd6bb, 0x8579, 0x6ebe,
-  0x6e7e, 0x7d39, 0x9559, 0x8d55, 0xa659, 0xb637, 0xb2c4, 0xbac4,
-  0xcefa, 0xc79e, 0xae9a, 0x4228, 0x3186, 0x9538, 0x8539, 0x6e9e,
-  0x8518, 0x9579, 0x9579, 0x8d55, 0xa639, 0xb6db, 0xbefb, 0xcf5d,
-  0xcfbf, 0xc77e, 0xae9a, 0x4228, 0x2986, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x9579, 0x84f4, 0x9e38, 0xb6db, 0xc77e, 0xcfdf,
-  0xcfbf, 0xc77e, 0xa639, 0x4228, 0x2986, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d18, 0x3a29, 0x95d7, 0xb6fb, 0xc77d, 0xcfbf,
-  0xcfdf, 0xbf1c, 0x52cb, 0x39c6, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d18, 0x39e7, 0x95d7, 0xb6fb, 0xc77d, 0xcfbf,
-  0xcfdf, 0xbf1c, 0x4a69, 0x39a6, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d18, 0x39e8, 0x95d7, 0xb6fb, 0xc77d, 0xcfbf,
-  0xcfdf, 0xbf1c, 0x4a8a, 0x39a6, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d18, 0x39e8, 0x95d7, 0xb6fb, 0xc77d, 0xcfbf,
-  0xd7df, 0xe75d, 0x528a, 0x31a6, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x8ebd, 0x86be, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x3a08, 0xcebb, 0x865c, 0x7e3b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x86bd, 0x8ede, 0x7e5b, 0x31e8, 0x2986, 0x39c7, 0x39a6,
-  0x39c7, 0x4a48, 0x31a6, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x8ebd, 0xdf9f, 0x8e5b, 0x31e8, 0x39a6, 0x4228, 0x4a69,
-  0x4a8a, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x8e9d, 0x7d15, 0x8d76, 0x4a69, 0x52cb, 0xa659,
-  0x95b7, 0x5b0c, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x661c, 0x29a7, 0x9534, 0x5a89, 0x62ea, 0xb658,
-  0x3a49, 0xa618, 0x4a8a, 0x39a6, 0x2965, 0x8538, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x7d38, 0x8492, 0xcbc5, 0xd300, 0xd300, 0xdc26,
-  0xbefb, 0xbf1c, 0x4a8a, 0x39c7, 0x4228, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d39, 0x9559, 0x8d56, 0xa5b5, 0xb2a3, 0xbac4, 0xcefa,
-  0xcfff, 0xbf1c, 0x4a69, 0x4a28, 0xc659, 0x9d9a, 0x7d18, 0x6e9e,
-  0x8518, 0x9579, 0x9579, 0x8555, 0x9e39, 0xb679, 0xc6fb, 0xcfbf,
-  0xcfdf, 0xbf1c, 0x4a8a, 0x39c6, 0x4208, 0x8d38, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x8555, 0xa639, 0xb6fc, 0xc77e, 0xcfbf,
-  0xcfbf, 0xb6bb, 0x4a69, 0x39a6, 0x2986, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77d, 0xcfdf,
-  0xc75d, 0x634d, 0x4208, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77d, 0xcfdf,
-  0xc75d, 0x5aeb, 0x4208, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77d, 0xcfdf,
-  0xc75d, 0x5aeb, 0x4208, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8535, 0x9e39, 0xb6db, 0xc77d, 0xcfbf,
-  0xc75d, 0x5aeb, 0x4208, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x8ebd, 0x86be, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x3a08, 0xcebb, 0x865c, 0x7e3b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e3b, 0x3208, 0x2986, 0x31a6, 0x39a6,
-  0x39c7, 0x4a49, 0x31a6, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x865c, 0x31a6, 0x31a6, 0x4a69, 0x4a8a,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x8edd, 0xc6bb, 0x4228, 0x4249, 0xa639, 0x95b7,
-  0x632c, 0x528a, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x3164, 0x41c6, 0x5a89, 0xa5b5, 0x3a29,
-  0xae79, 0x5b0c, 0x4208, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x84f7, 0xc323, 0xd2e0, 0xd300, 0xd406, 0xc6fb,
-  0xc75e, 0x5aeb, 0x4208, 0x31a6, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d39, 0x9559, 0x94f2, 0xb283, 0xb2c3, 0xc6b9, 0xcfdf,
-  0xc75d, 0x5aeb, 0x4208, 0x4a48, 0x31a6, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9579, 0x9579, 0x8535, 0xa5d7, 0xb679, 0xc77e, 0xcfdf,
-  0xc77e, 0x5aeb, 0x528a, 0xc617, 0x4208, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x8555, 0xa639, 0xb6fc, 0xc77d, 0xcfbf,
-  0xbefc, 0x5aeb, 0x4208, 0x4228, 0x31a6, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77e, 0xc75d,
-  0x6b6e, 0x528a, 0x4208, 0x31a6, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77e, 0xc75d,
-  0x630c, 0x4a69, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6db, 0xc77e, 0xc75d,
-  0x632c, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8535, 0x9e39, 0xb6db, 0xc77e, 0xc75d,
-  0x632c, 0x4a69, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e1b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x31a6,
-  0x3a08, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x31a6, 0x4228,
-  0xc5f7, 0x4228, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x2986, 0x4208, 0x4a8a, 0x4228,
-  0x528a, 0x4228, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x4a8a, 0xa618, 0x9db7, 0x5b2c,
-  0x4a8a, 0x4a69, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x761a, 0x4a27, 0xde99, 0xae7a, 0x3a28, 0xae7a,
-  0x632c, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x767c, 0xcbe6, 0xd2e0, 0xdba4, 0xb699, 0xb6fc, 0xc75d,
-  0x632c, 0x528a, 0x4208, 0x31a6, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d39, 0x9d16, 0xb283, 0xb2a3, 0xb699, 0xc79e, 0xc75d,
-  0x632c, 0x4a69, 0x4228, 0x4a48, 0x31a6, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9579, 0x9579, 0x8d14, 0xa5d7, 0xb6db, 0xc77e, 0xc77d,
-  0x632c, 0x4a69, 0x528a, 0xc617, 0x4208, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x8556, 0xa639, 0xb6db, 0xc77e, 0xbefc,
-  0x630c, 0x5269, 0x4228, 0x4228, 0x31a6, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6fb, 0xbf1c, 0x6b6d,
-  0x52aa, 0x528a, 0x4208, 0x31a6, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8555, 0xa639, 0xb6fb, 0xbefc, 0x5b0c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xb6fb, 0xbefc, 0x632c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8535, 0x9e39, 0xb6fb, 0xbefc, 0x632c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x31e8, 0x2986, 0x39c7, 0x4a28,
-  0x39c7, 0x39c6, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x31e8, 0x39e7, 0x528a, 0xc638,
-  0x528a, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x42ab, 0x9db7, 0xa639, 0x632d, 0x5aeb,
-  0x528a, 0x4a69, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86bd, 0x767b, 0x8535, 0xe75d, 0xbf1c, 0xb6ba, 0x5b0c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x7e7c, 0xc3c5, 0x8d13, 0xa659, 0xb6fc, 0xbf1c, 0x632c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e9e, 0x84f7, 0xaaa5, 0x8cf3, 0x9e39, 0xb6fb, 0xbefc, 0x632c,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x2986, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9559, 0x9538, 0x8535, 0xa639, 0xb6fb, 0xbf1c, 0x632c,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x4208, 0x8d38, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x957a, 0x8555, 0xa639, 0xb6db, 0xb6ba, 0x5b0c,
-  0x52aa, 0x528a, 0x4208, 0x4a49, 0xc659, 0x9dba, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xae7a, 0x632d, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x4208, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8555, 0xa639, 0xae7a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x2986, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8555, 0xa639, 0xae7a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8535, 0xa639, 0xae7a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5b, 0x31e8, 0x2986, 0x39c7, 0x4a28,
-  0x39c7, 0x39c6, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e3b, 0x31e8, 0x3186, 0x528a, 0xc638,
-  0x528a, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e9d, 0x7d14, 0x8d76, 0x52cb, 0x528a, 0x5aeb,
-  0x528a, 0x4a69, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x761a, 0x31e7, 0x9dd7, 0xa639, 0x5aeb, 0x528a,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x767c, 0xcc28, 0xde99, 0xae7a, 0xae7a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d39, 0x9d37, 0x9576, 0xa659, 0xae7a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9579, 0x957a, 0x8535, 0xa639, 0xae9a, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x8555, 0xa639, 0xa638, 0x5aeb, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x9558, 0x9d9a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8d55, 0x9dd7, 0x52cb, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x31c7, 0xd6dc, 0x9dba, 0x957a,
-  0x957a, 0x957a, 0x9579, 0x8d56, 0x95d7, 0x4a69, 0x4a69, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x9558, 0x9d9a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x8d56, 0x95d7, 0x4a8a, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x8d55, 0x95d7, 0x4a69, 0x4a69, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5b, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x31a6, 0x39c6, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e1b, 0x2986, 0x31a6, 0x4208, 0x4228,
-  0x528a, 0x4228, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x869d, 0x7d35, 0x4269, 0x4208, 0x4a69, 0x5aeb,
-  0xce59, 0x5aeb, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x7ebe, 0x767d, 0x8556, 0x9596, 0x4a69, 0x528a, 0x5acb,
-  0x632c, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x8559, 0x8d55, 0x9dd7, 0x4a8a, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x8559, 0xdf1c, 0x9576, 0x95d7, 0x4a69, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9579, 0x9dba, 0x8d56, 0x9dd7, 0x4a8a, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x8d55, 0x9596, 0x4a69, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x9558, 0x9d9a, 0x957a,
-  0x957a, 0x959a, 0x9579, 0x84f4, 0x4a69, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x31c7, 0xd6dc, 0x9dba, 0x957a,
-  0x957a, 0x957a, 0x9599, 0x84f4, 0x4208, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x9558, 0x9d9a, 0x957a,
-  0x957a, 0x959a, 0x9599, 0x84f4, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x959a,
-  0x957a, 0x957a, 0x9579, 0x84f4, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8edd, 0xe79f, 0x8edd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x8ebd, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3a49, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x5aeb, 0x4228, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x7ebe, 0x769d, 0x74b3, 0x4208, 0x4208, 0x528a, 0x52aa,
-  0x632c, 0xce59, 0x528a, 0x31a6, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x8579, 0x84f4, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x5acb, 0x5aeb, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x8559, 0xdf1d, 0x8d14, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9579, 0x9dba, 0x84f4, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x957a, 0x9579, 0x7cb3, 0x4228, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x2986, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x31c7, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x4208, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4a49, 0xc659, 0x9dba, 0x957a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x4208, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c6, 0x2966, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8edd, 0xe79f, 0x8edd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x8ebd, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x5aeb, 0x4228, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x632c, 0xce59, 0x528a, 0x31a6, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2966, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x5acb, 0x5aeb, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d39, 0x8d18, 0x4228, 0x39c7, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x9559, 0x9dba, 0xc659, 0x4a49, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x4208, 0x39c7, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x2986, 0x39a7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x31a6, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x4a48, 0x31a6, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x528a, 0xbdf7, 0x4208, 0x8d18, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x4a48, 0x31a6, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x8ebd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x8ebd, 0xd77e, 0x8ebd, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86be, 0x8ebd, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x4a69, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x5acb,
-  0x632c, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4228, 0x528a, 0x632c,
-  0xce59, 0x5aeb, 0x4208, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x31a6, 0x4208, 0x528a, 0x5acb,
-  0x632c, 0x528a, 0x4208, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x31a6, 0x4a28, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3a08, 0xc5f7, 0x528a, 0x4a69, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x84d7, 0x3186, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x31a6, 0x2986, 0x84d6, 0x957a, 0x959a,
-  0x959a, 0x8d38, 0x31c7, 0x2124, 0x39c7, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x4a49, 0x2945, 0x31c7, 0x8d38, 0x9d9a,
-  0x959a, 0x8d38, 0x2966, 0x2124, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x528a, 0xc618, 0x31a6, 0x2965, 0x8d38, 0x9d9a,
-  0x959a, 0x8d38, 0x2986, 0x2124, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x4a49, 0x2945, 0x2986, 0x8d18, 0x9d9a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x869d, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x8ebd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x8ebd, 0xdf9f, 0x8ebd, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x865c, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75d9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x4208, 0x39c7, 0x31c8, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x76be, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4208, 0x528a, 0x632c,
-  0x5acb, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x31a6, 0x4208, 0x5aeb, 0xce59,
-  0x632c, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x8519, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x31a6, 0x4a28, 0x4228, 0x528a, 0x632c,
-  0x5acb, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d18, 0x3a08, 0xc5f7, 0x528a, 0x4a69, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x31a6, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x31a6, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x2986, 0x8d18, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x39c7, 0x4208, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4a49, 0xd6bb, 0x9dba, 0x957a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x869d, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x8ebd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x8ebd, 0xdf9f, 0x8ebd, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x865c, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x7e5c, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x75b9, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x4208, 0x39c7, 0x3a29, 0x74f7, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4208, 0x7c92, 0x9579, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4208, 0x528a, 0x632c,
-  0x5acb, 0x528a, 0x4208, 0x4228, 0x84f4, 0x9579, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x39c7, 0x4208, 0x5aeb, 0xce59,
-  0x632c, 0x528a, 0x4208, 0x4228, 0x7cf4, 0x9579, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x2986, 0x39a6, 0x4208, 0x528a, 0x632c,
-  0x5acb, 0x528a, 0x4208, 0x4228, 0x84f4, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x4228, 0x39c7, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4208, 0x7cb3, 0x9579, 0x959a, 0x957a,
-  0x957a, 0x957a, 0x9dba, 0xc659, 0x4a49, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x31c7, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x4208, 0x39c7, 0x4208, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x2986, 0x8d38, 0x959a, 0x957a,
-  0x957a, 0x959a, 0x8d38, 0x2986, 0x39a7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d38, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x39c7, 0x3186, 0x8d18, 0x959a, 0x957a,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86be, 0x8ebd, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x865c, 0xd77e, 0x8ebd, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x3208, 0x865b, 0x86be, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x2986, 0x7e1a, 0x76be, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x5269, 0x4208, 0x4269, 0x7cf4, 0x7d39, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4a69, 0x9596, 0x8d35, 0x8d79, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x5269, 0x4a6a, 0x9dd7, 0x8d56, 0x9579, 0x7d39, 0x6ebe,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x39c7, 0x4228, 0x528a, 0x5acb,
-  0x632c, 0x528a, 0x4a69, 0x95d7, 0x8d56, 0x9579, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x632c,
-  0xce59, 0x5aeb, 0x4a69, 0x9dd7, 0x8d56, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x5acb,
-  0x632c, 0x528a, 0x4a69, 0x9576, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x9d9a, 0x9559, 0x31a6, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4228, 0x4a69, 0x84f4, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x9dba, 0xd6dc, 0x39c7, 0x31a6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4208, 0x7cf4, 0x9599, 0x957a, 0x957a,
-  0x957a, 0x9d9a, 0x9558, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4228, 0x7cf4, 0x9599, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4208, 0x4228, 0x7cf4, 0x9579, 0x957a, 0x957a,
-  0x86bd, 0x86bd, 0x8edd, 0xe79f, 0x8edd, 0x86bd, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x8ebd, 0x869d, 0x869d, 0x86bd, 0x86bd,
-  0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x86bd, 0x86bd, 0x7e3b, 0x7e3b,
-  0x7e3b, 0x7e3b, 0x86bd, 0x86bd, 0x869d, 0x869d, 0x869d, 0x86bd,
-  0x869d, 0x869d, 0x869d, 0x869d, 0x7e5b, 0x75d9, 0x3208, 0x2986,
-  0x2986, 0x3208, 0x75d9, 0x7e5b, 0x869d, 0x8ebd, 0x86bd, 0x86bd,
-  0x869d, 0x869d, 0x86bd, 0x7e5c, 0x3208, 0x2986, 0x39c7, 0x39c7,
-  0x39c7, 0x39c7, 0x2986, 0x31e8, 0x865c, 0xd79f, 0x8ebd, 0x869d,
-  0x869d, 0x869d, 0x86bd, 0x75d9, 0x29a6, 0x31a6, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x39a6, 0x3a08, 0x7e1b, 0x7ede, 0x86bd, 0x86bd,
-  0x869d, 0x86bd, 0x7e5c, 0x3208, 0x39c7, 0x4208, 0x528a, 0x528a,
-  0x528a, 0x528a, 0x52aa, 0x8514, 0x8555, 0x7d39, 0x76be, 0x86be,
-  0x869d, 0x86be, 0x6e3c, 0x29a6, 0x39c6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x5aeb, 0x95b7, 0x31c7, 0x7cb3, 0x9558, 0x769e, 0x7ebe,
-  0x7ebe, 0x769e, 0x74d7, 0x2986, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x5aeb, 0xae7a, 0x95d7, 0x8d13, 0xc3c7, 0x8517, 0x6ebf,
-  0x6e7e, 0x7d59, 0x8d18, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x5aeb, 0xae7a, 0xa659, 0x8d35, 0x9d37, 0x8518, 0x6e9e,
-  0x8518, 0x957a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x5aaa, 0x6b4d, 0xae9a, 0xa639, 0x8d55, 0x9579, 0x957a, 0x8518,
-  0x9579, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x630c, 0xd69a, 0xb69a, 0x9e38, 0x8d55, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x9d9a, 0x9559, 0x31a6, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x5acb, 0x5aeb, 0x52cb, 0x95d7, 0x8d55, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x9dba, 0xd6dc, 0x39c7, 0x31a6, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x4a69, 0x4a69, 0x95d7, 0x8d56, 0x9579, 0x957a, 0x957a,
-  0x957a, 0x9d9a, 0x9558, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x528a, 0x4a6a, 0x95d7, 0x8d56, 0x9579, 0x959a, 0x959a,
-  0x957a, 0x959a, 0x8d38, 0x3186, 0x39c7, 0x4228, 0x528a, 0x52aa,
-  0x52aa, 0x5269, 0x4a69, 0x95d7, 0x8d55, 0x9579, 0x957a, 0x957a
-};
-
-const Animation penguinAnimation = {
-  .name = "Penguin",
-  .frameCount = 20,
-  .width = 16,
-  .height = 16,
-  .frameDurations = penguinDurations,
-  .animationFrames = penguinFrames
-};
-#endif // ANIMATION_PENGUIN_H
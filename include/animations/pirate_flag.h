@@ -1,758 +0,0 @@
-// pirate_flag.h - Auto-generated from pirate_flag.json
-#ifndef ANIMATION_PIRATE_FLAG_H
-#define ANIMATION_PIRATE_FLAG_H
-
-#include "animation_types.h"
-
-// Frame Durations for pirate_flag (in 100ms units)
-static const uint8_t PROGMEM pirate_flagDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for pirate_flag
-static const uint16_t PROGMEM pirate_flagFrames[] = {
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0x0000,
-  0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0xffff,
-  0xffff, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0x0000, 0xffff, 0xffff, 0xffff, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffff, 0x0000,
-  0x0000, 0xffff, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xffff, 0x0000, 0xffff, 0x0000, 0xffff, 0xffff,
-  0xffff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-  0x0000, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x0000, 0x0000, 0xffff, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x0000, 0x0000, 0x0000, 0x0000, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d, 0x6b4d,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x632c, 0x2104, 0x0841, 0x0841,
-  0x1082, 0x630c, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b6d, 0x6b6d, 0x630c, 0x0861, 0x18e3, 0xc638, 0x2945, 0x0000,
-  0x0000, 0x0020, 0x18c3, 0x1082, 0x630c, 0x6b6d, 0x6b6d, 0x630c,
-  0x1082, 0x0841, 0x0841, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x2124, 0xc638, 0x1082, 0x0841, 0x0841, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x1082, 0x0000, 0x1082, 0xb596, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2124, 0xb596, 0x10a2, 0x0000, 0x1082, 0x2124,
-  0xdedb, 0xdefb, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x2104, 0xdedb, 0xef5d,
-  0xffdf, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xef5d, 0xd6ba, 0x2124, 0x0000, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0xef5d, 0x39c7, 0xad75, 0x39c7, 0xb596, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x2124, 0xef7d, 0xdeba,
-  0x4a49, 0xc618, 0x1082, 0x2124, 0xce59, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xef5d, 0xc618, 0x2104, 0xc618, 0x4a69,
-  0xb596, 0x2124, 0x0000, 0x1082, 0xc618, 0x18e3, 0x0841, 0x0841,
-  0x0841, 0x0000, 0x2124, 0xc638, 0x2945, 0x0020, 0x2104, 0xb596,
-  0x2124, 0x0000, 0x0000, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x6b4d,
-  0x630c, 0x10a2, 0x0841, 0x18c3, 0x0000, 0x0000, 0x0000, 0x1082,
-  0x0841, 0x0841, 0x1082, 0x632c, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b6d, 0x62eb, 0x0841, 0x0000, 0x0000, 0x0020,
-  0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d,
-  0x6b4d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1061, 0x0841,
-  0x0841, 0x0861, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x1082, 0x18e3, 0x10a2, 0x0000,
-  0x0000, 0x10a2, 0x18e3, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b6d,
-  0x630c, 0x1082, 0x0841, 0x0841, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x1082, 0xc618, 0xdedb, 0x1061, 0x0000, 0x0841, 0x0841, 0x0841,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0xb596, 0x10a2, 0x0000, 0x1082, 0x10a2,
-  0x2945, 0xce59, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x2104, 0xdedb, 0xef5d,
-  0xe73c, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xe73c,
-  0xffdf, 0xef5d, 0xd69a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xd6ba, 0xef5d, 0xffff,
-  0xffff, 0xef7d, 0x2124, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x39c7, 0xef5d, 0xe73c,
-  0xe73c, 0xd69a, 0x2104, 0xc618, 0xef5d, 0xc638, 0x0861, 0x0000,
-  0x0000, 0x0861, 0xc638, 0xdefb, 0x2124, 0x1082, 0xc638, 0x39e7,
-  0x2945, 0x10a2, 0x0000, 0x2124, 0xc638, 0x2945, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x2124, 0xc638, 0x1082, 0x0000, 0x2104, 0xc618,
-  0xc618, 0x0861, 0x0000, 0x0000, 0x18c3, 0x1082, 0x630c, 0x6b6d,
-  0x6b6d, 0x632c, 0x1082, 0x18c3, 0x0861, 0x0000, 0x0000, 0x10a2,
-  0x10a2, 0x0861, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b4d, 0x6b4d, 0x630c, 0x0841, 0x0000, 0x0000,
-  0x0020, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d,
-  0x6b4d, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x630c, 0x1082,
-  0x0841, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 0x632c, 0x2104, 0x0020, 0x0000,
-  0x0000, 0x2124, 0xc638, 0x18e3, 0x0841, 0x1082, 0x630c, 0x6b6d,
-  0x6b6d, 0x630c, 0x1082, 0x0841, 0x18e3, 0xc638, 0x2945, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x1082, 0x0000, 0x0000, 0x0841, 0x0841,
-  0x0841, 0x0841, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xb596, 0x10a2, 0x1082, 0x10a2, 0x10a2,
-  0x10a2, 0x10a2, 0x1082, 0x10a2, 0xb596, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0xd6ba, 0xef7d, 0xef5d,
-  0xef5d, 0xef7d, 0xd6ba, 0x10a2, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef7d, 0xffff,
-  0xffff, 0xef7d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc618, 0x4a49, 0xef5d,
-  0xef5d, 0x4a49, 0xc618, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x0000, 0x10a2, 0x2104, 0xd6ba, 0xffff,
-  0xffff, 0xd6ba, 0x2124, 0x10a2, 0x0000, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xb596, 0x39c7, 0xad75, 0x2124, 0xe73c, 0xe73c,
-  0xe73c, 0xef5d, 0x2124, 0xad75, 0x39c7, 0xb596, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xce59, 0x2124, 0x1082, 0xc638, 0x39c7,
-  0x39c7, 0xc638, 0x10a2, 0x2124, 0xce59, 0x2124, 0x0000, 0x0841,
-  0x0841, 0x0841, 0x18c3, 0xc618, 0x1082, 0x0000, 0x2104, 0xc618,
-  0xc638, 0x2104, 0x0000, 0x1082, 0xc618, 0x18c3, 0x0861, 0x630c,
-  0x6b4d, 0x6b6d, 0x632c, 0x2104, 0x0861, 0x0841, 0x0000, 0x10a2,
-  0x10a2, 0x0000, 0x0841, 0x0861, 0x2104, 0x632c, 0x6b6d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x0000,
-  0x0000, 0x0841, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x18c3, 0x62eb, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b4d,
-  0x0841, 0x10a2, 0x18e3, 0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x0861, 0x0841,
-  0x1082, 0xc618, 0xdedb, 0x1082, 0x0841, 0x0841, 0x1082, 0x630c,
-  0x6b6d, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x18e3, 0x10a2, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x0841, 0x0841, 0x0841, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x2104, 0xb596, 0x10a2, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x2124, 0xce59, 0x2945,
-  0x10a2, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xe73c,
-  0xef5d, 0xdedb, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0x4a69, 0xdedb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x2124, 0xef7d, 0xffff,
-  0xffff, 0xef5d, 0xd6ba, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0861, 0xc618, 0xef5d, 0xc618, 0x2104, 0xd69a, 0xe73c,
-  0xe73c, 0xef5d, 0x39c7, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x2124, 0xc638, 0x2945, 0x0000, 0x1082, 0x2945,
-  0x39e7, 0xc638, 0x1082, 0x2104, 0xdedb, 0xce59, 0x0861, 0x0000,
-  0x1082, 0x5acb, 0x1082, 0x18c3, 0x0000, 0x0000, 0x0861, 0xc618,
-  0xc638, 0x2104, 0x0000, 0x1082, 0xc638, 0x2945, 0x0841, 0x0841,
-  0x6b6d, 0x73ae, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0861, 0x10a2,
-  0x10a2, 0x0000, 0x0000, 0x0861, 0x18c3, 0x1082, 0x632c, 0x6b6d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0020,
-  0x0000, 0x0000, 0x0841, 0x630c, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x2104, 0x632c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x0841, 0x2945, 0xc638, 0x18e3, 0x0861, 0x630c, 0x6b6d, 0x6b4d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d, 0x630c, 0x1082,
-  0x1082, 0xc618, 0xdedb, 0x0861, 0x0000, 0x0841, 0x0841, 0x1082,
-  0x630c, 0x6b6d, 0x6b6d, 0x630c, 0x1082, 0x18c3, 0x0020, 0x0000,
-  0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0841, 0x0841, 0x1082, 0xc638, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x1082, 0xb596, 0x10a2, 0x0000, 0x1082, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x2104, 0xdedb, 0xdedb,
-  0x2124, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xffdf,
-  0xef5d, 0xdedb, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x0000, 0x2124, 0xd6ba, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xb596, 0x39c7, 0xad75, 0x39c7, 0xef5d, 0xef5d,
-  0xffdf, 0xef5d, 0xd69a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xce59, 0x2124, 0x1082, 0xc618, 0x4a49,
-  0xd6ba, 0xef7d, 0x2945, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x18c3, 0xc618, 0x1082, 0x0000, 0x2104, 0xb596,
-  0x4a69, 0xc618, 0x2104, 0xc618, 0xef5d, 0xc638, 0x1082, 0x0000,
-  0x1082, 0x632c, 0x632c, 0x2104, 0x0841, 0x0000, 0x0000, 0x2124,
-  0xb596, 0x2104, 0x0020, 0x2124, 0xc638, 0x2124, 0x0000, 0x0841,
-  0x6b6d, 0x73ae, 0x73ae, 0x6b4d, 0x632c, 0x1082, 0x0841, 0x0841,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0841, 0x1082, 0x630c,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c,
-  0x0020, 0x0000, 0x0000, 0x0841, 0x5aeb, 0x6b6d, 0x6b4d, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b2c, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x18c3, 0x0861, 0x1082, 0x630c, 0x6b6d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2945, 0xc638, 0x1082, 0x0000, 0x0841, 0x1082, 0x630c,
-  0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d,
-  0x1082, 0xc618, 0xdedb, 0x2945, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b6d, 0x630c, 0x0861, 0x0841,
-  0x0000, 0x10a2, 0x2124, 0xb596, 0x10a2, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x0841, 0x0841, 0x18e3, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x0020, 0x2124, 0xce59, 0x2945,
-  0x10a2, 0x1082, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xe73c,
-  0xef5d, 0xdedb, 0x1082, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xdedb, 0x2104, 0x1082, 0xb596, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xd6ba, 0xef5d, 0xffdf,
-  0xef5d, 0x4a49, 0xc618, 0x10a2, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x39a6, 0xef5d, 0xffff,
-  0xffff, 0xef5d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdefb, 0x2124, 0x0861, 0xd69a, 0xe73c,
-  0xe73c, 0xffff, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x1082, 0x0000, 0x10a2, 0x2945,
-  0x39e7, 0xc638, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0841, 0x18c3, 0x0841, 0x0000, 0x0861, 0xc618,
-  0xc638, 0x18e3, 0x0861, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x630c, 0x1082, 0x0841, 0x10a2,
-  0x1082, 0x0000, 0x0000, 0x2124, 0xdedb, 0xce59, 0x0861, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x632c, 0x1082,
-  0x0841, 0x0841, 0x0000, 0x1082, 0xc638, 0x2945, 0x0861, 0x0841,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d,
-  0x6b6d, 0x630c, 0x0841, 0x0000, 0x1082, 0x0020, 0x630c, 0x6b6d,
-  0x7bae, 0x632c, 0x2124, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x2124, 0xc618, 0x18e3, 0x0841, 0x1082, 0x630c, 0x6b6d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2945, 0xc638, 0x1082, 0x0000, 0x0000, 0x0841, 0x1082,
-  0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x10a2, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x630c, 0x1082,
-  0x0000, 0x1082, 0x1082, 0xb596, 0x10a2, 0x1082, 0x10a2, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0841, 0x18c3, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x1082, 0xd6ba, 0xef7d, 0xd6ba,
-  0x2124, 0x1082, 0x0000, 0x0000, 0x1082, 0xc638, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef7d, 0xffdf,
-  0xef5d, 0xdedb, 0x2124, 0x0020, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc618, 0x4a49, 0xe73c,
-  0xffff, 0xef5d, 0xd69a, 0x2124, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x0000, 0x10a2, 0x2104, 0xd6ba, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xb596, 0x39c7, 0xad75, 0x2124, 0xe73c, 0xef5d,
-  0xffdf, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xce59, 0x2124, 0x1082, 0xc618, 0x4a49,
-  0xd6ba, 0xef7d, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18c3, 0xc618, 0x1082, 0x0000, 0x2104, 0xb596,
-  0x4a69, 0xc618, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x5aeb, 0x2104, 0x0861, 0x0841, 0x0000, 0x2124,
-  0xb596, 0x2104, 0x1082, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x1082, 0x630c, 0x73ae, 0x6b4d, 0x6b6d, 0x632c, 0x1082, 0x0841,
-  0x1082, 0x0000, 0x0000, 0x2124, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x632c,
-  0x1082, 0x0841, 0x0841, 0x1082, 0xc638, 0x2945, 0x0000, 0x0841,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x1082, 0x0000, 0x0841, 0x630c,
-  0x7bae, 0x632c, 0x18c3, 0x0841, 0x630c, 0x6b6d, 0x6b4d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x2124, 0xc618, 0x10a2, 0x0841, 0x0841, 0x1082, 0x630c,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x10a2, 0xad75, 0x31a6, 0xb596, 0x10a2, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0841, 0x0841, 0x1082, 0x630c, 0x6b4d, 0x6b4d, 0x6b4d,
-  0x0000, 0x1082, 0x0000, 0x1082, 0x0020, 0x2124, 0xce59, 0x2945,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0841, 0x18c3, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xef5d,
-  0xd6ba, 0x2124, 0x0000, 0x0000, 0x1082, 0xc638, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xdefb, 0x2124, 0x0020, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xef5d, 0xffdf,
-  0xffdf, 0xef5d, 0xd69a, 0x2124, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x2124, 0xef7d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xef5d, 0xc618, 0x2104, 0xd69a, 0xe73c,
-  0xe71c, 0xe73c, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x2945, 0x0000, 0x1082, 0x2945,
-  0x39e7, 0xdefb, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x18c3, 0x0000, 0x0000, 0x0861, 0xbdf7,
-  0xd6ba, 0xce79, 0x2104, 0xad75, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x632c, 0x630c, 0x1082, 0x0841, 0x0841, 0x10a2,
-  0x10a2, 0x1082, 0x0020, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x1082, 0x630c, 0x7bae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x0861,
-  0x0020, 0x0000, 0x0000, 0x0861, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x632c, 0x1082, 0x0841, 0x18e3, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b6d, 0x632c, 0x18c3, 0x0000, 0x0000, 0x0000,
-  0x7bae, 0x632c, 0x18e3, 0x0000, 0x0841, 0x630c, 0x6b6d, 0x6b4d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x2124, 0xc618, 0x1082, 0x0000, 0x0841, 0x0841, 0x1082,
-  0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x10a2, 0xad75, 0x31a6, 0xb596, 0x10a2, 0x0000, 0x1082, 0x1082,
-  0x0000, 0x0000, 0x0841, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d,
-  0x0000, 0x1082, 0x0000, 0x1082, 0x0020, 0x2104, 0xdedb, 0xdedb,
-  0x2124, 0x1082, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd6ba, 0xef5d, 0xffdf,
-  0xef5d, 0xdedb, 0x1082, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xdedb, 0x2104, 0x0861, 0xc618, 0xef5d, 0xc618, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xd6ba, 0xef5d, 0xffff,
-  0xef5d, 0x4a49, 0xc618, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x39c7, 0xef5d, 0xef5d,
-  0xffdf, 0xef5d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdefb, 0x2124, 0x1082, 0xc618, 0x4a49,
-  0xd6ba, 0xffff, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x1082, 0x0000, 0x2104, 0xb596,
-  0x4a69, 0xc638, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x18c3, 0x0841, 0x0000, 0x0000, 0x2124,
-  0xb596, 0x2104, 0x0861, 0xb596, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x630c, 0x6b4d, 0x630c, 0x1082, 0x0841, 0x0841,
-  0x1082, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000,
-  0x1082, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c,
-  0x0861, 0x0841, 0x0000, 0x0861, 0xd6ba, 0xce59, 0x1082, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b6d, 0x632c, 0x1082, 0x0861, 0x18e3, 0x10a2, 0x0000, 0x0000,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x62eb, 0x0020, 0x0000, 0x0000,
-  0x7bae, 0x632c, 0x18e3, 0x0000, 0x0000, 0x0841, 0x630c, 0x6b6d,
-  0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x2124, 0xc618, 0x1082, 0x0000, 0x0000, 0x0841, 0x0841,
-  0x1082, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae,
-  0x10a2, 0xad75, 0x31a6, 0xb596, 0x10a2, 0x1082, 0x10a2, 0x10a2,
-  0x1082, 0x0000, 0x0000, 0x0841, 0x0841, 0x2104, 0x632c, 0x6b6d,
-  0x0000, 0x1082, 0x0000, 0x1082, 0x1082, 0xd6ba, 0xef7d, 0xef5d,
-  0xd6ba, 0x2124, 0x0000, 0x0000, 0x1082, 0xc638, 0x18e3, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef7d, 0xffff,
-  0xffff, 0xdefb, 0x2124, 0x0020, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xc618, 0x4a49, 0xe73c,
-  0xffdf, 0xef5d, 0xd69a, 0x2124, 0xad75, 0x31a6, 0xad75, 0x10a2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2104, 0xd6ba, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xad75, 0x2124, 0xe73c, 0xe73c,
-  0xe71c, 0xe73c, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdefb, 0x2124, 0x1082, 0xc638, 0x39c7,
-  0x39c7, 0xdefb, 0x2945, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x1082, 0x0000, 0x2104, 0xc618,
-  0xd69a, 0xd69a, 0x1082, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x18c3, 0x0861, 0x0841, 0x0000, 0x1082,
-  0x10a2, 0x1082, 0x10a2, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x630c, 0x6b4d, 0x6b6d, 0x632c, 0x1082, 0x0020,
-  0x0020, 0x0000, 0x0000, 0x2124, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x1082, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d,
-  0x632c, 0x1082, 0x0841, 0x1082, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b6d, 0x632c, 0x10a2, 0x18c3, 0x0841, 0x0000, 0x0000,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d, 0x630c, 0x0841, 0x0000,
-  0x73ae, 0x6b6d, 0x62eb, 0x0841, 0x0000, 0x0000, 0x0841, 0x630c,
-  0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841,
-  0x0841, 0x1082, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2124, 0xce59, 0x2945, 0x0000, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x1082, 0x630c, 0x6b4d, 0x6b4d, 0x73ae,
-  0x1082, 0xc618, 0xef5d, 0xc638, 0x1082, 0x2104, 0xce59, 0x2945,
-  0x10a2, 0x1082, 0x0000, 0x0000, 0x0841, 0x18c3, 0x1082, 0x630c,
-  0x0000, 0x10a2, 0x10a2, 0x10a2, 0x1082, 0xd6ba, 0xef5d, 0xe73c,
-  0xef5d, 0xdedb, 0x1082, 0x0000, 0x1082, 0xc638, 0x2945, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xdedb, 0x2124, 0x0020, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0x4a49, 0xc618, 0x2945, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xef7d, 0xffff,
-  0xffff, 0xef5d, 0xef5d, 0x18c3, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0xb596, 0x2104, 0xd69a, 0xe73c,
-  0xe73c, 0xffff, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0020, 0x1082, 0x2945,
-  0x39e7, 0xc638, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xd6ba, 0x0861, 0x0000, 0x0861, 0xc618,
-  0xc638, 0x18e3, 0x0861, 0xb596, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x18c3, 0x0841, 0x0841, 0x0841, 0x10a2,
-  0x1082, 0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0861, 0x630c, 0x6b6d, 0x6b6d, 0x630c, 0x0861,
-  0x0020, 0x0841, 0x0000, 0x0861, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x1082, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x6b6d, 0x632c, 0x0861, 0x18e3, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b6d, 0x632c, 0x2104, 0x0841, 0x0841, 0x0000,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841,
-  0x73ae, 0x6b4d, 0x6b4d, 0x630c, 0x0841, 0x0000, 0x0000, 0x0841,
-  0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x18c3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae,
-  0x0841, 0x2945, 0xc638, 0x1082, 0x0000, 0x0000, 0x1082, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d,
-  0x1082, 0xc618, 0xdedb, 0x2124, 0x0020, 0x2104, 0xdedb, 0xdedb,
-  0x2124, 0x1082, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0841, 0x0841,
-  0x0000, 0x10a2, 0x2124, 0xb596, 0x2124, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0xdedb, 0x2124, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xef5d, 0xd69a, 0x2104, 0xc618, 0xef5d, 0xc618, 0x1082,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xef5d, 0xef5d,
-  0xffdf, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xad75, 0x2124, 0xbdf7, 0x4a49,
-  0xd6ba, 0xef7d, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0020, 0x2104, 0xb596,
-  0x4a69, 0xc618, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdedb, 0x1082, 0x0000, 0x0000, 0x2124,
-  0xb596, 0x2104, 0x1082, 0xb596, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x18e3, 0x0841, 0x0841, 0x0841,
-  0x1082, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x6b6d, 0x630c,
-  0x0861, 0x0841, 0x0841, 0x0861, 0xd6ba, 0xce59, 0x1082, 0x0000,
-  0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b6d, 0x6b6d, 0x632c, 0x1082, 0x18c3, 0x10a2, 0x0000, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0841,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d, 0x6b4d,
-  0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b6d, 0x632c, 0x2124, 0x0861, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0841, 0x1082, 0x630c, 0x6b4d, 0x73ae, 0x73ae,
-  0x0841, 0x18c3, 0xc638, 0x1082, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0841, 0x2104, 0x632c, 0x6b6d,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0020, 0x2104, 0xdedb, 0xef5d,
-  0xd6ba, 0x2124, 0x0000, 0x0000, 0x1082, 0xc638, 0x18e3, 0x0841,
-  0x10a2, 0xad75, 0x31a6, 0xad75, 0x2124, 0xd69a, 0xef5d, 0xffff,
-  0xffff, 0xdefb, 0x2124, 0x0020, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xe73c,
-  0xffdf, 0xef5d, 0xd69a, 0x2124, 0xad75, 0x31a6, 0xad75, 0x10a2,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd69a, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xef5d, 0xe73c,
-  0xe71c, 0xe73c, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0xc638, 0x39c7,
-  0x39c7, 0xdefb, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x1082, 0x18e3, 0xc618,
-  0xd69a, 0xce79, 0x2104, 0xad75, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdefb, 0x2124, 0x0000, 0x0000, 0x1082,
-  0x10a2, 0x1082, 0x0020, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x1082, 0x0841, 0x0841, 0x0020,
-  0x0020, 0x0000, 0x0000, 0x0861, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x18c3, 0x1082, 0x632c, 0x6b6d, 0x6b6d,
-  0x632c, 0x1082, 0x0841, 0x18e3, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x0841, 0x1082, 0x630c, 0x6b4d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b6d, 0x6b6d, 0x632c, 0x2104, 0x0841, 0x0000, 0x0000,
-  0x6b4d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x632c, 0x1082, 0x0841,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b4d,
-  0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x0000,
-  0x0000, 0x0841, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x6b4d, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x73ae,
-  0x0841, 0x0841, 0x18c3, 0x0000, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0x10a2, 0x1082, 0x0000, 0x0000, 0x0000, 0x18c3, 0x1082, 0x630c,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0000, 0x0861, 0xd6ba, 0xef5d,
-  0xef5d, 0xdedb, 0x1082, 0x0000, 0x2945, 0xce59, 0x2945, 0x0841,
-  0x1082, 0xc618, 0xef5d, 0xc638, 0x1082, 0x2104, 0xd6ba, 0xffff,
-  0xffff, 0xdedb, 0x2104, 0x0861, 0xc618, 0xef5d, 0xc618, 0x1082,
-  0x0000, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0xc618, 0x4a49, 0xef5d,
-  0xef5d, 0x4a49, 0xc618, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef5d, 0xffff,
-  0xffff, 0xef5d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xffff, 0xe73c,
-  0xe73c, 0xffff, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xc638, 0x39c7,
-  0x39c7, 0xc638, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0xb596, 0x1082, 0x18e3, 0xc618,
-  0xc638, 0x18e3, 0x0861, 0xb596, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000, 0x1082,
-  0x1082, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xd6ba, 0x0861, 0x0000, 0x0841, 0x0020,
-  0x0020, 0x0841, 0x0000, 0x0861, 0xd6ba, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x18c3, 0x0841, 0x1082, 0x632c, 0x6b6d,
-  0x6b6d, 0x632c, 0x1082, 0x0841, 0x18c3, 0x10a2, 0x0000, 0x0000,
-  0x0841, 0x0841, 0x0861, 0x630c, 0x6b6d, 0x6b6d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x0861, 0x0841, 0x0000,
-  0x6b4d, 0x6b4d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1082,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841,
-  0x0000, 0x0000, 0x0841, 0x630c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae,
-  0x6b6d, 0x738e, 0x6b4d, 0x630c, 0x1082, 0x0841, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x2104, 0x632c, 0x6b6d,
-  0x1082, 0x5aeb, 0x2124, 0x0841, 0x0000, 0x0000, 0x0000, 0x1082,
-  0x10a2, 0x1082, 0x0000, 0x0000, 0x1082, 0xc638, 0x18e3, 0x0841,
-  0x0000, 0x18c3, 0xc638, 0x1082, 0x0000, 0x0000, 0x2104, 0xd6ba,
-  0xef5d, 0xdedb, 0x2124, 0x0020, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0020, 0x2104, 0xdedb, 0xffff,
-  0xffff, 0xef5d, 0xd69a, 0x2124, 0xad75, 0x31a6, 0xad75, 0x10a2,
-  0x10a2, 0xad75, 0x31a6, 0xad75, 0x2124, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x1082, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xe73c, 0xe71c,
-  0xe73c, 0xef7d, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0xdefb, 0x39e7,
-  0x39c7, 0xc638, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xad75, 0x2104, 0xce79, 0xd69a,
-  0xc618, 0x18e3, 0x1082, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0020, 0x1082, 0x10a2,
-  0x1082, 0x0000, 0x0000, 0x2124, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdedb, 0x1082, 0x0000, 0x0000, 0x0020,
-  0x0020, 0x0841, 0x0841, 0x1082, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2124, 0xc638, 0x18e3, 0x0841, 0x1082, 0x632c,
-  0x6b6d, 0x6b6d, 0x632c, 0x10a2, 0x18c3, 0x0841, 0x0000, 0x0000,
-  0x0841, 0x0000, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x6b6d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b4d, 0x630c, 0x1082, 0x0841,
-  0x630c, 0x18c3, 0x630c, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b4d,
-  0x73ae, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c,
-  0x0841, 0x0000, 0x0000, 0x0841, 0x630c, 0x6b4d, 0x6b4d, 0x73ae,
-  0x6b6d, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x18c3, 0x1082, 0x630c,
-  0x1082, 0x630c, 0x630c, 0x1082, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x1082, 0x0000, 0x0000, 0x1082, 0xc638, 0x2945, 0x0841,
-  0x0000, 0x0020, 0x18c3, 0x0000, 0x0000, 0x0000, 0x1082, 0x2124,
-  0xdedb, 0xdefb, 0x2124, 0x0020, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0000, 0x2104, 0xdedb, 0xef5d,
-  0xffdf, 0xef5d, 0xd69a, 0x2124, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x1082, 0xc618, 0xef5d, 0xc618, 0x2104, 0xd69a, 0xef5d, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x10a2, 0x10a2, 0x18c3, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xef5d, 0xd69a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0xef5d, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xef7d, 0xdeba,
-  0x4a49, 0xc5f7, 0x2124, 0xad75, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0xc618, 0x4a69,
-  0xb596, 0x2104, 0x0020, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0xb596, 0x1082, 0x20e3, 0xb596,
-  0x2124, 0x0000, 0x0000, 0x0861, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000, 0x1082,
-  0x0841, 0x0841, 0x0841, 0x18e3, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xd6ba, 0x1082, 0x0841, 0x0841, 0x0861,
-  0x630c, 0x6b6d, 0x6b6d, 0x632c, 0x2104, 0x0841, 0x0841, 0x0000,
-  0x0841, 0x0000, 0x10a2, 0x18c3, 0x1082, 0x632c, 0x6b6d, 0x6b6d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x1082,
-  0x630c, 0x1082, 0x0861, 0x630c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x73ae, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d,
-  0x630c, 0x0841, 0x0000, 0x0000, 0x0841, 0x5aeb, 0x6b6d, 0x6b4d,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1082, 0x0841,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x18c3, 0x0841, 0x0841,
-  0x1082, 0x630c, 0x6b4d, 0x630c, 0x1082, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0020, 0x18c3, 0x0841, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0x2945, 0xce59, 0x2124, 0x0861, 0xc618, 0xef5d, 0xc618, 0x1082,
-  0x0000, 0x2124, 0xc638, 0x1082, 0x0000, 0x0861, 0xd6ba, 0xef5d,
-  0xe73c, 0xef5d, 0xd6ba, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x2124, 0x0020, 0x2104, 0xd6ba, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2124, 0xb596, 0x2945, 0xc618, 0x4a49, 0xe73c,
-  0xffdf, 0xef5d, 0xd69a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0xef5d, 0xef5d, 0xffff,
-  0xffff, 0xef7d, 0x2945, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xffff, 0xe73c,
-  0xe73c, 0xd69a, 0x2104, 0xb596, 0x2124, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xc638, 0x39e7,
-  0x2945, 0x10a2, 0x0020, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xb596, 0x1082, 0x18e3, 0xc618,
-  0xc618, 0x0861, 0x0000, 0x0861, 0xd6ba, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x1082,
-  0x10a2, 0x0841, 0x0841, 0x0841, 0x18c3, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdedb, 0x1082, 0x0000, 0x0841, 0x0020,
-  0x0861, 0x630c, 0x6b6d, 0x6b6d, 0x630c, 0x0861, 0x0841, 0x0841,
-  0x0841, 0x0000, 0x2124, 0xc638, 0x18e3, 0x0861, 0x632c, 0x6b6d,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b4d, 0x6b4d,
-  0x630c, 0x10a2, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b4d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b4d,
-  0x6b6d, 0x630c, 0x0841, 0x0000, 0x0000, 0x18c3, 0x632c, 0x6b6d,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c, 0x1082,
-  0x0841, 0x0841, 0x0000, 0x0000, 0x1082, 0xc618, 0x18e3, 0x0841,
-  0x1082, 0x630c, 0x6b4d, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x0020, 0x18c3, 0x0841, 0x0841, 0x0000, 0x0000, 0x1082,
-  0x10a2, 0x10a2, 0x1082, 0x10a2, 0xb596, 0x31a6, 0xad75, 0x10a2,
-  0x0000, 0x2124, 0xc638, 0x1082, 0x0000, 0x0000, 0x2104, 0xd6ba,
-  0xef5d, 0xef7d, 0xd6ba, 0x10a2, 0x1082, 0x0000, 0x1082, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x2124, 0x0020, 0x2104, 0xdedb, 0xffff,
-  0xffff, 0xef7d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2124, 0xb596, 0x2124, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0x4a49, 0xc618, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xd6ba, 0x2124, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd69a, 0xe73c, 0xe71c,
-  0xe73c, 0xef5d, 0x2124, 0xad75, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xdefb, 0x39e7,
-  0x39c7, 0xc638, 0x10a2, 0x2104, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x1082, 0xd69a, 0xd69a,
-  0xc618, 0x2104, 0x0000, 0x1082, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x10a2, 0x1082, 0x10a2,
-  0x1082, 0x0000, 0x0841, 0x0861, 0x18c3, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x1082, 0xc638, 0xdefb, 0x2124, 0x0000, 0x0000, 0x0020,
-  0x0020, 0x1082, 0x632c, 0x6b6d, 0x6b4d, 0x630c, 0x1082, 0x0841,
-  0x0841, 0x0000, 0x2124, 0xc638, 0x1082, 0x0841, 0x1082, 0x632c,
-  0x6b6d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b4d,
-  0x630c, 0x10a2, 0x0841, 0x18c3, 0x10a2, 0x632c, 0x6b6d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b4d, 0x6b2c, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x0000, 0x1082, 0x0841, 0x630c,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x630c,
-  0x1082, 0x0841, 0x0841, 0x0000, 0x1082, 0xc638, 0x2945, 0x0861,
-  0x1082, 0x630c, 0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x1082, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0861, 0x5acb, 0x1082, 0x0841, 0x0841, 0x0000, 0x0000,
-  0x1082, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x10a2, 0x18c3, 0x0000, 0x0000, 0x0000, 0x1082, 0x2124,
-  0xdedb, 0xdefb, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x2945, 0x0000, 0x0861, 0xd6ba, 0xef5d,
-  0xffdf, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xdedb, 0xc638, 0x1082, 0x2104, 0xd6ba, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1082, 0x10a2, 0x10a2, 0xc618, 0x4a49, 0xe73c,
-  0xffff, 0xef5d, 0xd6ba, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef5d, 0xffdf,
-  0xef5d, 0xef5d, 0x39c7, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xffff, 0xd6ba,
-  0x4a49, 0xc618, 0x1082, 0x2104, 0xdedb, 0xce59, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xc638, 0x4a69,
-  0xb596, 0x2124, 0x0000, 0x1082, 0xc638, 0x2945, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x2124, 0xb596, 0x1082, 0x18e3, 0xb596,
-  0x2124, 0x0000, 0x0000, 0x0841, 0x18c3, 0x0841, 0x0841, 0x0000,
-  0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000, 0x0000, 0x1082,
-  0x0841, 0x0841, 0x1082, 0x630c, 0x6b4d, 0x6b6d, 0x630c, 0x1082,
-  0x0841, 0x0861, 0xc638, 0xd6ba, 0x0861, 0x0000, 0x0841, 0x0861,
-  0x630c, 0x6b6d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x630c, 0x10a2, 0x10a2, 0x18e3, 0x0861, 0x1082, 0x632c, 0x6b6d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x630c, 0x0861, 0x5aeb, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b4d, 0x6b6d, 0x630c, 0x0841, 0x1082, 0x0000, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d,
-  0x630c, 0x1082, 0x0841, 0x0841, 0x1082, 0xc638, 0x2945, 0x0000,
-  0x1082, 0x630c, 0x7bae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c, 0x1082,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x2124, 0xdedb, 0xc638, 0x1082,
-  0x0000, 0x0861, 0x630c, 0x632c, 0x1082, 0x0841, 0x0841, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x10a2, 0x0000,
-  0x0000, 0x10a2, 0x18e3, 0x0841, 0x0000, 0x0000, 0x0000, 0x1082,
-  0x2945, 0xce59, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x1082, 0x0000, 0x0000, 0x2104, 0xd6ba,
-  0xef5d, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0020, 0x2104, 0xdedb, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x18c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0xb596, 0x2124, 0xd69a, 0xef5d, 0xffdf,
-  0xffdf, 0xef5d, 0xd69a, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xef5d,
-  0xffff, 0xef7d, 0x2124, 0x10a2, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd69a, 0xe73c, 0xe71c,
-  0xe73c, 0xd69a, 0x2104, 0xc618, 0xef5d, 0xc638, 0x1082, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2945, 0xdefb, 0x4208,
-  0x2945, 0x10a2, 0x0000, 0x2124, 0xc638, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0xad75, 0x2104, 0xce79, 0xd6ba,
-  0xbdf7, 0x0861, 0x0000, 0x0000, 0x18c3, 0x0841, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0020, 0x1082, 0x10a2,
-  0x10a2, 0x0841, 0x0841, 0x1082, 0x630c, 0x6b6d, 0x6b4d, 0x6b4d,
-  0x0841, 0x0861, 0xc638, 0xdedb, 0x1082, 0x0000, 0x0000, 0x0020,
-  0x0861, 0x630c, 0x6b6d, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x2124, 0xc638, 0x2104, 0x0841, 0x1082, 0x632c,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x630c, 0x0020, 0x18c3, 0x632c, 0x6b6d, 0x6b4d, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x632c, 0x18e3, 0x0000, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x6b6d, 0x630c, 0x1082, 0x0841, 0x18e3, 0xc638, 0x2945, 0x0000,
-  0x1082, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d, 0x630c,
-  0x1082, 0x0841, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x0861, 0x630c, 0x6b6d, 0x630c, 0x1082, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x10a2, 0x18e3, 0x0841, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x1082, 0x10a2, 0x1082, 0x10a2, 0xb596, 0x1082, 0x0000, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x1082, 0x0000, 0x0000, 0x1082, 0x2124,
-  0xd6ba, 0xef7d, 0xd6ba, 0x10a2, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0020, 0x2104, 0xdedb, 0xef5d,
-  0xffdf, 0xef7d, 0xef5d, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0xb596, 0x2124, 0xd69a, 0xef5d, 0xffff,
-  0xef5d, 0x4a49, 0xc618, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x18c3, 0xdedb, 0x4a69, 0xe73c,
-  0xffff, 0xd6ba, 0x2124, 0x10a2, 0x0000, 0x1082, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xd69a, 0xef5d, 0xffdf,
-  0xef5d, 0xe73c, 0x2124, 0xad75, 0x39c7, 0xb596, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2124, 0xef7d, 0xdeba,
-  0x4a49, 0xc618, 0x10a2, 0x2124, 0xce59, 0x2124, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x10a2, 0xc618, 0x4a69,
-  0xb596, 0x2124, 0x0000, 0x1082, 0xc618, 0x18e3, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x1082, 0x20e3, 0xb596,
-  0x2124, 0x0000, 0x0841, 0x0841, 0x2104, 0x632c, 0x6b6d, 0x6b4d,
-  0x0841, 0x0861, 0xc638, 0xdefb, 0x2124, 0x0000, 0x0000, 0x1082,
-  0x0841, 0x1082, 0x632c, 0x6b6d, 0x6b4d, 0x73ae, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x2124, 0xc638, 0x10a2, 0x0841, 0x0841, 0x1082,
-  0x632c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x630c, 0x0841, 0x1082, 0x0841, 0x630c, 0x6b6d, 0x6b4d,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x73ae, 0x73ae, 0x6b4d, 0x6b6d, 0x62eb, 0x0020, 0x0000,
-  0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x6b6d, 0x630c, 0x1082, 0x0861, 0x18e3, 0x10a2, 0x0000,
-  0x1082, 0x630c, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x6b6d, 0x6b6d,
-  0x630c, 0x1082, 0x0841, 0x0000, 0x0861, 0xd6ba, 0xc638, 0x1082,
-  0x0000, 0x0861, 0x630c, 0x6b6d, 0x6b6d, 0x630c, 0x1082, 0x0841,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x2945, 0xce59, 0x2945, 0x0000,
-  0x0000, 0x10a2, 0x18e3, 0x0841, 0x0841, 0x0841, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x0000, 0x1082, 0xb596, 0x2124, 0x0000, 0x0000,
-  0x1082, 0xc618, 0xdedb, 0x1061, 0x0000, 0x0000, 0x1082, 0x10a2,
-  0x2945, 0xce59, 0x2124, 0x0020, 0x1082, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x2124, 0xce59, 0x2945, 0x0000, 0x0861, 0xd6ba, 0xef5d,
-  0xe73c, 0xef5d, 0xd6ba, 0x1082, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x2104, 0xb596, 0x1082, 0x2104, 0xd6ba, 0xffff,
-  0xef5d, 0x4a69, 0xdedb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0xc618, 0x4a49, 0xe73c,
-  0xffdf, 0xef5d, 0xd6ba, 0x2124, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x1082, 0xef5d, 0xef5d, 0xffff,
-  0xffff, 0xef7d, 0x39c7, 0xb596, 0x2124, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0861, 0xd6ba, 0xffff, 0xe73c,
-  0xe73c, 0xd69a, 0x1082, 0x2104, 0xdedb, 0xce59, 0x0861, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x10a2, 0x2124, 0xc638, 0x39e7,
-  0x2945, 0x10a2, 0x0000, 0x1082, 0xc638, 0x2945, 0x0841, 0x0841,
-  0x0000, 0x0000, 0x10a2, 0x2124, 0xb596, 0x1082, 0x18e3, 0xc618,
-  0xc618, 0x0861, 0x0000, 0x0841, 0x18c3, 0x1082, 0x630c, 0x6b6d,
-  0x0841, 0x0861, 0xc638, 0xdefb, 0x2124, 0x0000, 0x0000, 0x1082,
-  0x10a2, 0x0841, 0x1082, 0x630c, 0x6b4d, 0x6b6d, 0x73ae, 0x73ae,
-  0x630c, 0x1082, 0x2124, 0xc638, 0x1082, 0x0000, 0x0841, 0x0841,
-  0x0861, 0x632c, 0x6b6d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae,
-  0x73ae, 0x630c, 0x0841, 0x1082, 0x0000, 0x0841, 0x630c, 0x6b6d,
-  0x6b4d, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae, 0x73ae
-};
-
-const Animation pirate_flagAnimation = {
-  .name = "Pirate Flag",
-  .frameCount = 23,
-  .width = 16,
-  .height = 16,
-  .frameDurations = pirate_flagDurations,
-  .animationFrames = pirate_flagFrames
-};
-#endif // ANIMATION_PIRATE_FLAG_H
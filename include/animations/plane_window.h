@@ -1,502 +0,0 @@
-// plane_window.h - Auto-generated from plane_window.json
-#ifndef ANIMATION_PLANE_WINDOW_H
-#define ANIMATION_PLANE_WINDOW_H
-
-#include "animation_types.h"
-
-// Frame Durations for plane_window (in 100ms units)
-static const uint8_t PROGMEM plane_windowDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for plane_window
-static const uint16_t PROGMEM plane_windowFrames[] = {
-  0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xc61a, 0xc61a, 0xc61a, 0xc61a,
-  0xc61a, 0xc61a, 0xc61a, 0xc61a, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xfffd, 0xc61a, 0x7bf1, 0x630e, 0x630e, 0x630e,
-  0x630e, 0x630e, 0x630e, 0x7bf1, 0xc61a, 0xfffd, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x7bf1, 0x630e, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x630e, 0x7bf1, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x4d3f, 0x7e1f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0x4d3f, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x7e1f, 0x8e3f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xbf1f, 0xbdff, 0x9cdf, 0x4d3f,
-  0x4d3f, 0xadbf, 0xbdff, 0xc73f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xfffd, 0xfffd, 0xbf1f, 0xbdff,
-  0xadbf, 0xd69f, 0xc73f, 0xfffd, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xfffd, 0xbf1f, 0xfffd, 0xf7de,
-  0xd69f, 0xc73f, 0xfffd, 0xfffd, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xfffd, 0xfffd, 0xc67f, 0xd69f,
-  0xc73f, 0xfffd, 0xfffd, 0xfffd, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xfffd, 0xf7de, 0xd75f, 0xc73f,
-  0xbf1f, 0xbf1f, 0xbf1f, 0xbf1f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xc73f, 0xd75f, 0xd79f, 0xfffd,
-  0xfffd, 0xd79f, 0xd79f, 0xbf1f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xe7bf, 0xd79f, 0xbf1f, 0xbf1f,
-  0xd79f, 0xfffd, 0xfffd, 0xd79f, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x630e, 0xc73f, 0xbf1f, 0xd79f, 0xfffd,
-  0xbf1f, 0xbf1f, 0xd79f, 0xfffd, 0x630e, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xc61a, 0x7bf1, 0x630e, 0xfffd, 0xfffd, 0xfffd,
-  0xd79f, 0xd79f, 0xfffd, 0x630e, 0x7bf1, 0xc61a, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xfffd, 0xc61a, 0x7bf1, 0x630e, 0x630e, 0x630e,
-  0x630e, 0x630e, 0x630e, 0x7bf1, 0xc61a, 0xfffd, 0xfffd, 0xfffd,
-  0xfffd, 0xfffd, 0xfffd, 0xfffd, 0xc61a, 0xc61a, 0xc61a, 0xc61a,
-  0xc61a, 0xc61a, 0xc61a, 0xc61a, 0xfffd, 0xfffd, 0xfffd, 0xfffd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fe, 0x555f, 0x553f, 0x551f,
-  0x4d1f, 0x553f, 0x7ddf, 0x85bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x94fd, 0xb6bf, 0xb5ff, 0x951f,
-  0x5d3f, 0x7ddf, 0xb5ff, 0xa59d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe73b, 0xffdd, 0xef9d, 0xc6df,
-  0xbe5f, 0xb5ff, 0xc65f, 0xb67d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xffdd, 0xcf3e, 0xe79d,
-  0xef9d, 0xc67f, 0xc6ff, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xfffd, 0xef9d, 0xd6de,
-  0xc69f, 0xbeff, 0xefbd, 0xef5b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xefdd, 0xf7bd, 0xe77d,
-  0xbeff, 0xbeff, 0xc71f, 0xb6bd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbedd, 0xd75e, 0xcf3f, 0xc71f,
-  0xcf5f, 0xefbd, 0xf7dd, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xd71d, 0xd77f, 0xcf5f, 0xcf5f,
-  0xbeff, 0xc71f, 0xd77f, 0xe75c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xbebc, 0xc71f, 0xc71f, 0xc71f,
-  0xd77f, 0xf7bd, 0xc71f, 0xae5c, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xc6bc, 0xe75c, 0xe75b,
-  0xef7b, 0xef7b, 0xc6bc, 0x6b90, 0x7c12, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x7390, 0x73b0, 0x73b0,
-  0x7390, 0x7390, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x551f, 0x553f, 0x553f,
-  0x551f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x5cfd, 0x953f, 0xb6bf, 0xb5ff,
-  0x951f, 0x7ddf, 0x8e1e, 0xa57d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb69d, 0xf79d, 0xf7dd, 0xef9d,
-  0xcefe, 0xce9e, 0xaddf, 0xad9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xfffd, 0xf7dd, 0xd75e,
-  0xefbd, 0xe75d, 0xbe3f, 0xb67d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbebd, 0xf7bd, 0xf7dd, 0xf7bd,
-  0xcebe, 0xc63e, 0xbedf, 0xdf3c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb69d, 0xcf3f, 0xf7bd, 0xefbd,
-  0xf7bd, 0xef9d, 0xc71f, 0xbebd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcf1d, 0xdf9e, 0xcf3f, 0xc71f,
-  0xc71f, 0xc71f, 0xd77f, 0xdf5c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xefbe, 0xd77f, 0xcf5f,
-  0xcf5f, 0xcf5f, 0xc71f, 0xbedd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xd6fb, 0xdf9f, 0xd77f, 0xc71f,
-  0xc71f, 0xc71f, 0xd77f, 0xdf1a, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xbebc, 0xb6be, 0xc6fd,
-  0xe75b, 0xef7b, 0xdf1a, 0x7bd0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x7390, 0x6b90, 0x7390,
-  0x7390, 0x73b0, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x551f, 0x553f,
-  0x553f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54dd, 0x5d3f, 0x953f, 0xb69f,
-  0xb5ff, 0xa5df, 0x8e1f, 0x7d9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x94dd, 0xbedf, 0xf79d, 0xf7dd,
-  0xe79d, 0xd73e, 0xc67f, 0x94dd, 0x6b50, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbe9d, 0xefbd, 0xffdc, 0xefbd,
-  0xdf5e, 0xe79d, 0xef7d, 0xb5bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xdf3c, 0xcf3f, 0xe79d, 0xf7dd,
-  0xe77d, 0xc63e, 0xc63f, 0xb69d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb6bd, 0xc73f, 0xd73e, 0xc73f,
-  0xc71f, 0xef9d, 0xf7bd, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6fd, 0xdf9e, 0xefbd, 0xd77f,
-  0xd75f, 0xc71f, 0xc71f, 0xbebd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6fd, 0xcf3f, 0xf7dd, 0xffdd,
-  0xf7dd, 0xd77f, 0xcf5f, 0xc6fe, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbebc, 0xd79f, 0xdf9f, 0xf7dd,
-  0xdf9f, 0xd77f, 0xc71f, 0xae5c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdf1a, 0xef7c, 0xcf1d,
-  0xc6fd, 0xb6be, 0xbebc, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x7390, 0x7390,
-  0x7390, 0x6b90, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d1f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x4d1f, 0x551f,
-  0x553f, 0x5d5f, 0x7ddf, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54dd, 0x551f, 0x5d3f, 0x953f,
-  0xb6bf, 0xbe7f, 0xb5ff, 0x859d, 0x6370, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x8cbd, 0x951f, 0xbede, 0xef9d,
-  0xefbd, 0xefbd, 0xcf1f, 0xb5dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb67d, 0xc6ff, 0xefbd, 0xf7dd,
-  0xf7dd, 0xd75e, 0xef9d, 0xe73b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xf7dd, 0xcf3e, 0xefbd,
-  0xefbd, 0xef9d, 0xc63f, 0xbddd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef5b, 0xefbd, 0xd73e, 0xc73f,
-  0xc71f, 0xbeff, 0xc6ff, 0xdf1c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbedd, 0xd75e, 0xd75f, 0xd75f,
-  0xefbd, 0xd77f, 0xd77f, 0xbebd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xd73d, 0xd77f, 0xbeff, 0xc71f,
-  0xf7bd, 0xffdd, 0xf7dd, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xd6fb, 0xf7dd, 0xdf9f, 0xd77f,
-  0xdf9f, 0xf7dd, 0xdf9f, 0xc6bc, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xe71a, 0xef7b, 0xef7b,
-  0xe75b, 0xcf1d, 0xbebc, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x73b0, 0x7390,
-  0x7390, 0x7390, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d1f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x4d3f, 0x4d1f,
-  0x551f, 0x5d5f, 0x7dff, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x551f, 0x551f, 0x5d3f,
-  0x953f, 0xbede, 0xce9e, 0xa59d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54dd, 0x8cff, 0x951f, 0xb6bf,
-  0xe77d, 0xf7dd, 0xe79e, 0xbe9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x94dd, 0xbebf, 0xbeff, 0xe79d,
-  0xffdd, 0xefbd, 0xcf3e, 0xdf3c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb5bd, 0xef9d, 0xefbd, 0xdf5e,
-  0xe79d, 0xf7bd, 0xef9d, 0xbdfd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb69d, 0xcf3f, 0xf7bd, 0xe79d,
-  0xc71f, 0xc71f, 0xc71f, 0xb69d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcf1d, 0xdf9e, 0xcf3f, 0xc71f,
-  0xcf5f, 0xd75f, 0xf7bd, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75c, 0xefbe, 0xd77f, 0xd75f,
-  0xbeff, 0xc71f, 0xf7dd, 0xef7b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67c, 0xdf9f, 0xffdd, 0xf7dd,
-  0xdf9f, 0xd77f, 0xdf9f, 0xe71a, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdf1a, 0xef7b, 0xef7b,
-  0xef7b, 0xef7b, 0xdf1a, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x7390, 0x7390,
-  0x7390, 0x73b0, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x553f, 0x7dff, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54dd, 0x4d3f, 0x551f, 0x551f,
-  0x5d5f, 0xa5df, 0xcf1e, 0xbe3d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x8cbd, 0x5d1f, 0x8cff, 0x951f,
-  0xbede, 0xefbd, 0xefbd, 0xe75c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xad7d, 0x9d1f, 0xbe9f, 0xcf1e,
-  0xefbd, 0xf7dd, 0xf7dd, 0xc6dd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xae5d, 0xbe1f, 0xe77d, 0xefbd,
-  0xd75e, 0xf7dd, 0xf7dd, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb69d, 0xcf1f, 0xd73e, 0xcf3e,
-  0xefbd, 0xf7bd, 0xc73f, 0xb6bd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xdf3c, 0xf7dd, 0xdf7e, 0xd75f,
-  0xc71f, 0xc71f, 0xcf5f, 0xc6fd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcefd, 0xdf7f, 0xf7bd, 0xf7bd,
-  0xd77f, 0xd75f, 0xc71f, 0xb6be, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xcedb, 0xc71f, 0xc71f, 0xdf9f,
-  0xffdd, 0xf7dd, 0xdf9f, 0xbebc, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xbebc, 0xcf1d, 0xe75b,
-  0xef7b, 0xef7b, 0xe71a, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x7390, 0x7390, 0x7390,
-  0x7390, 0x7390, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x553f, 0x7ddf, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x551f, 0x4d1f, 0x551f,
-  0x553f, 0x7ddf, 0xb61f, 0xbe9d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xa57d, 0x94ff, 0x5d1f, 0x8cff,
-  0xaddf, 0xcf1e, 0xefbd, 0xef5b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb65d, 0xb5df, 0x9d1f, 0xc6de,
-  0xd73e, 0xe79d, 0xfffd, 0xef7b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb5dd, 0xbebf, 0xc67f, 0xef9d,
-  0xe79d, 0xc71e, 0xffdd, 0xef7b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe73c, 0xcf3f, 0xd73e, 0xcf3e,
-  0xbeff, 0xbeff, 0xf7bd, 0xef5b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6dd, 0xdf9e, 0xe79d, 0xefbd,
-  0xd77e, 0xd75f, 0xc71f, 0xb6bd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcf1d, 0xcf3f, 0xc71f, 0xd77e,
-  0xf7bd, 0xf7dd, 0xd77f, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb67c, 0xdf9f, 0xf7bd, 0xc71f,
-  0xc71f, 0xdf9f, 0xfffd, 0xe71a, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdf1a, 0xef7b, 0xcf1d,
-  0xc6fd, 0xef7c, 0xe71a, 0x7bd0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x7390, 0x7390,
-  0x7390, 0x7390, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d1f, 0x553f, 0x75df, 0x85bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xa57d, 0x5d5f, 0x551f, 0x4d1f,
-  0x553f, 0x7ddf, 0x8e3e, 0xa5bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67d, 0xb5ff, 0x94ff, 0x5d3f,
-  0xa5bf, 0xb5ff, 0xcf1f, 0xe73b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xdf3c, 0xc6df, 0xb5df, 0xaddf,
-  0xcefe, 0xcf1e, 0xf7bd, 0xef7b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67d, 0xbe3f, 0xc6fe, 0xce9e,
-  0xe79d, 0xefbd, 0xcf3f, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb5dd, 0xe77e, 0xefbd, 0xcf1e,
-  0xc71f, 0xc71e, 0xbeff, 0xb6bd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbebd, 0xd75e, 0xcf3f, 0xd75f,
-  0xefbd, 0xefbd, 0xdf9f, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xd71d, 0xd77f, 0xcf5f, 0xbeff,
-  0xc71f, 0xd77e, 0xf7dd, 0xef7c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67c, 0xc71f, 0xc71f, 0xd77f,
-  0xf7bd, 0xc71f, 0xc71f, 0xc6bc, 0x7390, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdefa, 0xef7b, 0xef7b,
-  0xef7b, 0xcf1d, 0xbebc, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x73b0, 0x7390,
-  0x7390, 0x7390, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cbc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x551e, 0x553f, 0x4d1f, 0x4d3f,
-  0x4d1f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xae7d, 0xadff, 0x5d3f, 0x551f,
-  0x553f, 0x7ddf, 0x8e1e, 0x7dbd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xc6ff, 0xaddf, 0x951f,
-  0x85bf, 0xadff, 0xadff, 0xb67d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xefbd, 0xbedf, 0xbe3f,
-  0xbdff, 0xc6ff, 0xc71f, 0xe73c, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xc71f, 0xc69f, 0xcf1e,
-  0xc69f, 0xef9d, 0xefbd, 0xbebd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb69d, 0xc6bf, 0xef9d, 0xe79d,
-  0xbeff, 0xc71f, 0xc71f, 0xb6bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcefd, 0xd73e, 0xcf3f, 0xc71f,
-  0xbeff, 0xcf5f, 0xefbd, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75c, 0xdf9f, 0xcf5f, 0xcf5f,
-  0xcf5f, 0xbf1f, 0xc73f, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6bc, 0xd77f, 0xc71f, 0xc71f,
-  0xc71f, 0xd77f, 0xf7bd, 0xb67c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x6b90, 0xae5c, 0xc6fd, 0xe75b,
-  0xe75b, 0xef7b, 0xe71a, 0x73b0, 0x7c12, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x6b90, 0x7390, 0x7390,
-  0x73b0, 0x73b0, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x555f, 0x553f, 0x4d1f,
-  0x4d1f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x94fd, 0xb6bf, 0xadff, 0x5d3f,
-  0x553f, 0x75df, 0x8e1e, 0x7d9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbe9d, 0xefbd, 0xc6fe, 0xb5ff,
-  0xa5bf, 0x8dfe, 0xa5bf, 0x94dd, 0x6b50, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xfffd, 0xefbd, 0xceff,
-  0xc67e, 0xaddf, 0xbedf, 0xb67d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef5b, 0xf7dd, 0xcf3e, 0xcebe,
-  0xc6fe, 0xbe1f, 0xf7bd, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbebd, 0xcf3f, 0xcf3e, 0xe79d,
-  0xef9d, 0xc6fe, 0xefbd, 0xbedd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xdf3c, 0xe79e, 0xd77f, 0xc71f,
-  0xc71f, 0xbeff, 0xc71f, 0xc6fd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xef7b, 0xf7dd, 0xf7bd, 0xd77f,
-  0xcf5f, 0xcf5f, 0xcf5f, 0xb6be, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6dc, 0xf7dd, 0xdf9f, 0xd77f,
-  0xc71f, 0xc71f, 0xc71f, 0xbebc, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xc6bc, 0xc71e, 0xb6bd,
-  0xc6fd, 0xe75c, 0xdf1a, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x7390, 0x7390, 0x6b90,
-  0x7390, 0x73b0, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x551f, 0x553f, 0x553f,
-  0x4d1f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x8c9d, 0x951f, 0xb69f, 0xaddf,
-  0x655f, 0x7ddf, 0x861e, 0x7d9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xad9d, 0xc6df, 0xefbd, 0xc6ff,
-  0xbe5f, 0xb5ff, 0x85df, 0x8cdd, 0x6b50, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbebd, 0xf7dd, 0xffdc, 0xe79d,
-  0xd71e, 0xbe3f, 0x9d3f, 0xb65d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xf7dd, 0xefbd, 0xd73e,
-  0xc69f, 0xbedf, 0xbe1f, 0xe73b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbebd, 0xcf3f, 0xd73e, 0xc71f,
-  0xc6ff, 0xe79d, 0xc71f, 0xe75b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6fd, 0xdf9e, 0xefbd, 0xd77f,
-  0xd77f, 0xc71f, 0xbf1f, 0xb6bd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6fd, 0xcf3f, 0xf7dd, 0xffdd,
-  0xf7dd, 0xd77f, 0xcf5f, 0xc6fe, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xbebc, 0xd79f, 0xdf9f, 0xf7dd,
-  0xdf9f, 0xd77f, 0xc71f, 0xae5c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdf1a, 0xef7c, 0xcf1d,
-  0xc6fd, 0xb6be, 0xbebc, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x7390, 0x7390,
-  0x7390, 0x6b90, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d3f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x551f, 0x551f, 0x553f,
-  0x553f, 0x553f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54dd, 0x8cdf, 0x951f, 0xb69f,
-  0xadff, 0x85ff, 0x8e1e, 0x759d, 0x6370, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x94bd, 0xb5df, 0xc6df, 0xefbd,
-  0xcf1e, 0xc67e, 0xa5bf, 0x5cfd, 0x6350, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xad9d, 0xc6ff, 0xf7bd, 0xf7dd,
-  0xefbd, 0xc6ff, 0xb5df, 0x94bd, 0x6b50, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xbe9d, 0xf7bd, 0xefbd, 0xf7bd,
-  0xcf1e, 0xbe3f, 0xbebf, 0xadbd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75b, 0xefbd, 0xd75e, 0xc73f,
-  0xbeff, 0xbedf, 0xbeff, 0xb67d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xc6dd, 0xd75e, 0xcf5f, 0xd75f,
-  0xf7bd, 0xd77e, 0xd77f, 0xb6bd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xd73d, 0xd77f, 0xbeff, 0xc71f,
-  0xf7bd, 0xffdd, 0xf7dd, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xd6fb, 0xf7dd, 0xdf9f, 0xd77f,
-  0xdf9f, 0xf7dd, 0xdf9f, 0xc6bc, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xe71a, 0xef7b, 0xef7b,
-  0xe75b, 0xcf1d, 0xbebc, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x73b0, 0x7390,
-  0x7390, 0x7390, 0x7390, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d1f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x4cfd, 0x4d3f, 0x551f, 0x551f,
-  0x553f, 0x5d5f, 0x75df, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x551f, 0x8cdf, 0x951f,
-  0xb6bf, 0xb65f, 0x961e, 0x7d9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xad9d, 0x9d1f, 0xb5df, 0xbedf,
-  0xe79d, 0xd73e, 0xbe5f, 0x94dd, 0x6b50, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xdefc, 0xbe1f, 0xbedf, 0xefbd,
-  0xffdd, 0xe79d, 0xbedf, 0xad9d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb5dd, 0xbedf, 0xe7bd, 0xffdd,
-  0xe79d, 0xbeff, 0xbe3f, 0xb67d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb67d, 0xc73f, 0xf7bd, 0xe79d,
-  0xc71f, 0xbeff, 0xbeff, 0xb69d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcf1d, 0xdf9e, 0xcf3f, 0xc71f,
-  0xcf5f, 0xd75f, 0xf7dd, 0xcf1d, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe75c, 0xefbe, 0xd77f, 0xd75f,
-  0xbeff, 0xc71f, 0xf7dd, 0xef7b, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67c, 0xdf9f, 0xffdd, 0xf7dd,
-  0xdf9f, 0xd77f, 0xdf9f, 0xe71a, 0x738f, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xdf1a, 0xef7b, 0xef7b,
-  0xef7b, 0xef7b, 0xdf1a, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x73b0, 0x7390, 0x7390,
-  0x7390, 0x73b0, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd,
-  0xffdd, 0xfffd, 0xfffd, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffd, 0xfffd, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xbdf9, 0x8412, 0x6370, 0x6370, 0x6370,
-  0x6370, 0x6370, 0x6370, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x5b50, 0x4cdc, 0x4cfe, 0x4cfd,
-  0x4cfd, 0x4cfe, 0x4cdc, 0x6370, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6370, 0x4cdc, 0x4d3f, 0x4d3f, 0x4d3f,
-  0x4d3f, 0x4d1f, 0x555f, 0x757c, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6350, 0x54fd, 0x4d3f, 0x4d3f, 0x551f,
-  0x551f, 0x5d5f, 0x7dff, 0x85dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b50, 0x8cbd, 0x5d3f, 0x551f, 0x8cdf,
-  0x9d1f, 0xbedf, 0xc69e, 0x85bd, 0x6370, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xb67d, 0xb5ff, 0x9cff, 0xb5df,
-  0xcefe, 0xefbd, 0xcf1f, 0xadbd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xe73b, 0xef7d, 0xbe1f, 0xcefe,
-  0xf7dd, 0xf7dd, 0xefbd, 0xb67d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb5bd, 0xc63f, 0xc6fe, 0xefbd,
-  0xf7dd, 0xefbd, 0xc6ff, 0xb5dd, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b70, 0xb69d, 0xc71f, 0xcf3e, 0xcf3e,
-  0xefbd, 0xc71f, 0xbeff, 0xb69d, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x7390, 0xdf3c, 0xf7dd, 0xdf7e, 0xd77f,
-  0xc71f, 0xbeff, 0xcf5f, 0xc6fd, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x6b90, 0xcefd, 0xdf7f, 0xf7bd, 0xf7bd,
-  0xd77f, 0xd75f, 0xc71f, 0xb6be, 0x6b70, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xbdd8, 0x738f, 0xcedb, 0xc71f, 0xc71f, 0xdf9f,
-  0xffdd, 0xf7dd, 0xdf9f, 0xbebc, 0x6b90, 0xbdd8, 0xf7bc, 0xfffd,
-  0xffdc, 0xf7bc, 0xc619, 0x8412, 0x73b0, 0xbebc, 0xcf1d, 0xe75b,
-  0xef7b, 0xef7b, 0xe71a, 0x73b0, 0x8412, 0xc619, 0xf7bc, 0xfffd,
-  0xffdc, 0xffdc, 0xf79c, 0xc619, 0x8412, 0x7390, 0x7390, 0x7390,
-  0x7390, 0x7390, 0x73b0, 0x8412, 0xbdf9, 0xf79c, 0xffdc, 0xfffd,
-  0xffdc, 0xffdc, 0xfffc, 0xf79c, 0xbdf9, 0xb5b8, 0xb5b8, 0xb5b8,
-  0xb5b8, 0xb5b8, 0xb5b8, 0xbdf9, 0xf79c, 0xfffc, 0xffdc, 0xffdd
-};
-
-const Animation plane_windowAnimation = {
-  .name = "Plane Window",
-  .frameCount = 15,
-  .width = 16,
-  .height = 16,
-  .frameDurations = plane_windowDurations,
-  .animationFrames = plane_windowFrames
-};
-#endif // ANIMATION_PLANE_WINDOW_H
@@ -1,982 +0,0 @@
-// pokeball.h - Auto-generated from pokeball.json
-#ifndef ANIMATION_POKEBALL_H
-#define ANIMATION_POKEBALL_H
-
-#include "animation_types.h"
-
-// Frame Durations for pokeball (in 100ms units)
-static const uint8_t PROGMEM pokeballDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for pokeball
-static const uint16_t PROGMEM pokeballFrames[] = {
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfddb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20e4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1062, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1062, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x28e4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfddb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfddb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20c4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20e4, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd6ba, 0x3986, 0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xce9a, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20a2, 0x1062, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xa8c5, 0x30e4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2062, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20e4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfddb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe559, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3166, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xce99, 0x3166, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe75c, 0x39a6, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffff, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xef5d, 0xe75d, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3945, 0xbdf7, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc106, 0x2082, 0x20e4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd106, 0x2062, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x88e6, 0x30e4, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x30e4, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe558, 0xe559, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2904, 0x3166, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe73c, 0xd69a, 0x3146, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffff, 0xef5d, 0x3186, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffdf, 0xffdf, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffff, 0xffff, 0xe73c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe73c, 0xffff, 0xe75c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3145, 0xd6ba, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc106, 0x30a3, 0x18e3, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd107, 0x80c6, 0x28c4, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2082, 0x30e4, 0xdd17, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe559, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3166, 0xd4f6, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd6ba, 0x3186, 0x3146, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffdf, 0xef5d, 0xd69a, 0x3146, 0xe579, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffff, 0xffff, 0xef5d, 0x3186, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe73c, 0xffdf, 0xffdf, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2124, 0xe73c, 0xffff, 0xe73c, 0x2104, 0xe558, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x0882, 0xe73c, 0xffff, 0xe75c, 0x2104, 0xe558, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x20a2, 0xd69a, 0xf7be, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc106, 0x4125, 0x8c32, 0x2945, 0xd517, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe128, 0x80e6, 0x1041, 0x20c3, 0xed99, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9107, 0x2883, 0x20c3, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3104, 0xd4f7, 0xed99, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe558, 0xe559, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2904, 0x3166, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe73c, 0xd6ba, 0x3186, 0x3146, 0xd517, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xffff, 0xffff, 0xef5d, 0xd69a, 0x3146, 0xe579, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe73c, 0xffdf, 0xffff, 0xef5d, 0x3186, 0xd4f7, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x39c7, 0xd6ba, 0xffdf, 0xffdf, 0xd6ba, 0x3166, 0xe559, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xce59, 0x31a6, 0xe73c, 0xffff, 0xe75c, 0x2104, 0xe558, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9493, 0x3186, 0xe73c, 0xffff, 0xe71c, 0x2104, 0xe558, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x28e4, 0xc618, 0xffdf, 0xf79e, 0x9cd4, 0x3125, 0xe579, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc0e6, 0x4145, 0xd69a, 0xad36, 0x2904, 0xd4f7, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe148, 0x9107, 0x20e4, 0x83f1, 0x3125, 0xed79, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9907, 0x9107, 0x1862, 0x2925, 0xdd17, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2083, 0x30e4, 0xd517, 0xed79, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe558, 0xe558, 0xe559, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2925, 0x2924, 0x3166, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd69a, 0xe73c, 0xd6ba, 0x3186, 0x3146, 0xd517, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2945, 0xef5d, 0xffff, 0xef5d, 0xd69a, 0x3146, 0xe579, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x0861, 0xce79, 0xffff, 0xffff, 0xef5d, 0x3186, 0xd4f7, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1082, 0x31a6, 0xdedb, 0xffdf, 0xffdf, 0xd6ba, 0x3166, 0xe559,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xad16, 0xc639, 0x31a6, 0xe73c, 0xffff, 0xe75c, 0x2104, 0xe558,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xa4d5, 0x9c93, 0x3166, 0xe73c, 0xffff, 0xe71c, 0x2104, 0xe558,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1862, 0x18e3, 0xdedb, 0xffff, 0xf77e, 0x9cd4, 0x3125, 0xe579,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xb8c5, 0x20a2, 0xe73c, 0xf7bf, 0xad36, 0x2104, 0xd4f7, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd907, 0x3083, 0x9493, 0xa4f5, 0x8c32, 0x3125, 0xed79, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc906, 0x88e6, 0x1062, 0x18c3, 0x3145, 0xdd17, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2082, 0x2083, 0x20c3, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xe579, 0xed79, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe579, 0xe579, 0xe579, 0xe559, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2082, 0x2082, 0x1082, 0x3166, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd106, 0xc0e6, 0x20a2, 0xbe18, 0x39a6, 0x3146, 0xd517, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe928, 0xd907, 0x28a3, 0xe73c, 0xef5d, 0xd69a, 0x3146, 0xe579,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xc0e6, 0x20a2, 0xe75d, 0xffff, 0xef5d, 0x3186, 0xd4f7,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc106, 0x2882, 0x2124, 0xd6ba, 0xffdf, 0xffdf, 0xd6ba, 0x3166,
-  0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1862, 0x9c94, 0xce59, 0x31a6, 0xe73c, 0xffff, 0xe75c, 0x2104,
-  0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1862, 0x9473, 0x9cb4, 0x3166, 0xe73c, 0xffff, 0xe71c, 0x2104,
-  0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xc106, 0x2862, 0x18e3, 0xd6ba, 0xffff, 0xf77e, 0x9cd4, 0x3125,
-  0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xc0e6, 0x20a2, 0xe75d, 0xf7bf, 0xad36, 0x2104, 0xd4f7,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe948, 0xd107, 0x20c3, 0xdedb, 0xad36, 0x8c32, 0x3125, 0xed79,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9907, 0x88e6, 0x1862, 0x8c31, 0x2925, 0x2925, 0xdd17, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2083, 0x2082, 0x1082, 0x2925, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd4f7, 0x3904, 0x2082, 0x2082, 0x20c3, 0xd4f7, 0xe579, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x3083, 0xc106, 0xd106, 0xb0e6, 0x20a2, 0x2104, 0x3166, 0xd517,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd107, 0xe927, 0xd907, 0x30c3, 0xd6ba, 0xe73c, 0xd69a, 0x3146,
-  0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xe927, 0xc0e6, 0x20a2, 0xef5d, 0xffff, 0xef5d, 0x3186,
-  0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xc906, 0x2882, 0x2124, 0xd6ba, 0xffdf, 0xffdf, 0xd6ba,
-  0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd106, 0x2882, 0x9cb4, 0xce59, 0x31a6, 0xe73c, 0xffff, 0xe75c,
-  0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd106, 0x2882, 0x9473, 0x9c93, 0x3166, 0xe73c, 0xffff, 0xe71c,
-  0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xc906, 0x1862, 0x2965, 0xdedb, 0xffdf, 0xf77e, 0x9cd4,
-  0x3125, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe948, 0xd107, 0x2082, 0xd6ba, 0xffff, 0xf79e, 0xad36, 0x2104,
-  0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9907, 0x9107, 0x2924, 0xe73c, 0xf79e, 0xad36, 0x8c32, 0x3125,
-  0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1882, 0x1062, 0x83f1, 0xa4f5, 0x9c93, 0x2925, 0x2925, 0xdd17,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd4f7, 0x28e4, 0x20e4, 0x20e4, 0x3125, 0xd4f7, 0xed79, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xed79, 0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xd517, 0x30e4, 0x2082, 0x2082, 0x30e4, 0xd4f7, 0xe579,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2082, 0x3083, 0xc106, 0xd106, 0xd106, 0xc106, 0x2062, 0x3145,
-  0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd106, 0xd107, 0xe927, 0xe947, 0xe948, 0xc968, 0x3145, 0xbe18,
-  0x3166, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xe927, 0xe927, 0xd106, 0xc0e6, 0x4166, 0xdedb, 0xef5d,
-  0x3186, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xe927, 0xc906, 0x2882, 0x3124, 0xc638, 0xffff, 0xffdf,
-  0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe927, 0xd107, 0x2882, 0x9cb4, 0xce59, 0x31a6, 0xe73c, 0xffff,
-  0xe75c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe127, 0xd107, 0x3082, 0x9473, 0x9493, 0x3166, 0xe73c, 0xffff,
-  0xe71c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xb148, 0xe127, 0xb906, 0x28e4, 0x2966, 0xdedb, 0xffdf, 0xf77e,
-  0x9cd4, 0x3125, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xb148, 0xc106, 0x4104, 0xd6ba, 0xef5d, 0xffff, 0xf79e, 0xad36,
-  0x2104, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x88e6, 0x2062, 0x9c94, 0xf79e, 0xffdf, 0xf77e, 0xad36, 0x8c32,
-  0x3125, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2082, 0x18c3, 0x9453, 0xa4f5, 0xa4f5, 0x9c93, 0x2925, 0x2925,
-  0xdd17, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0xd517, 0x3125, 0x20c3, 0x20c3, 0x3125, 0xd4f7, 0xed79,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xe599, 0xd517, 0x30e4, 0x2082, 0x2082, 0x30e4, 0xd4f7,
-  0xed99, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd4f7, 0x3104, 0x3082, 0xc106, 0xd106, 0xd106, 0xc106, 0x3083,
-  0x20c3, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x2062, 0xc0e6, 0xd106, 0xe927, 0xe947, 0xe948, 0xf1c9, 0xb967,
-  0x1882, 0x20c3, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1821, 0xd107, 0xe928, 0xe927, 0xd107, 0xd106, 0xc106, 0x4966,
-  0xc638, 0x3186, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xa128, 0xe127, 0xe927, 0xc906, 0x2882, 0x20a3, 0x20a2, 0xd6ba,
-  0xffff, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xb148, 0xe128, 0xd106, 0x2882, 0x9cb4, 0xce59, 0x2124, 0xe73c,
-  0xffff, 0xe75c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xb148, 0xe128, 0xd106, 0x1861, 0x9453, 0x9c93, 0x3186, 0xe73c,
-  0xffff, 0xe71c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0x9928, 0xb128, 0xc106, 0x20a3, 0x2104, 0x3166, 0xdedb, 0xffdf,
-  0xf77e, 0x9cd4, 0x3125, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1821, 0x80e6, 0x3925, 0xd69a, 0xe75c, 0xef5d, 0xffff, 0xf79e,
-  0xad36, 0x2104, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0x1062, 0x1061, 0x83f1, 0xbdb8, 0xf7be, 0xffdf, 0xf77e, 0xad36,
-  0x8c32, 0x3125, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xd517, 0x20e4, 0x2925, 0x9453, 0xa4f5, 0xa4f5, 0x9c93, 0x2925,
-  0x2925, 0xdd17, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xed99, 0xd517, 0x3125, 0x20c3, 0x20c3, 0x3125, 0xd4f7,
-  0xed79, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559, 0xe579, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xe599, 0xd517, 0x30e4, 0x2082, 0x2082, 0x30e4,
-  0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xdd17, 0x30e4, 0x3082, 0xc106, 0xd106, 0xd106, 0xc106,
-  0x3083, 0x30e4, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0x3104, 0xb8e6, 0xd106, 0xe927, 0xe947, 0xe948, 0xe9c9,
-  0xd9a9, 0xa8c5, 0x30c4, 0xe579, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xccf7, 0x30a3, 0xd107, 0xe928, 0xe927, 0xd107, 0xd106, 0xe948,
-  0xc988, 0x30c3, 0x20e4, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0x1882, 0x9107, 0xe127, 0xe927, 0xc906, 0x2882, 0x30c3, 0xb0e6,
-  0x4145, 0xd6da, 0xd6ba, 0x3166, 0xe559, 0xfdfb, 0xfddb, 0xfdfb,
-  0x0800, 0x9927, 0xe948, 0xd907, 0x2862, 0x9cb4, 0xce59, 0x3124,
-  0xd69a, 0xffff, 0xef5d, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfdfb,
-  0x0800, 0x9927, 0xe148, 0xc0e6, 0x28e4, 0x9473, 0x9493, 0x3186,
-  0xef5d, 0xffff, 0xe71c, 0x2104, 0xe558, 0xfdfb, 0xfddb, 0xfdfb,
-  0x1882, 0x9107, 0x90e7, 0x4165, 0xc659, 0x3186, 0x2965, 0xdedb,
-  0xffdf, 0xf77e, 0x9cd4, 0x3125, 0xe579, 0xfdfb, 0xfddb, 0xfdfb,
-  0xd4f7, 0x1882, 0x20e4, 0xd69a, 0xf7be, 0xef5d, 0xef5d, 0xffff,
-  0xf79e, 0xad36, 0x2104, 0xd4f7, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xe579, 0x3145, 0x83f1, 0xa4f5, 0xbd98, 0xf79e, 0xffdf, 0xf77e,
-  0xad36, 0x8c32, 0x3125, 0xed79, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xdd38, 0x3145, 0x2904, 0x9453, 0xa4f5, 0xa4f5, 0x9c93,
-  0x2925, 0x2925, 0xdd17, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x3125, 0x20c3, 0x20c3, 0x3125,
-  0xd4f7, 0xed79, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559, 0xe579,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579,
-  0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xe599, 0xd517, 0x30e4, 0x2082, 0x2082,
-  0x30e4, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xdd17, 0x30e4, 0x3082, 0xc106, 0xd106, 0xd106,
-  0xc106, 0x3083, 0x30e4, 0xd517, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xed99, 0x30e4, 0xb8e6, 0xd106, 0xe927, 0xe947, 0xe948,
-  0xe9c9, 0xd9a9, 0xc106, 0x30e4, 0xe579, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xd517, 0x2883, 0xd107, 0xe928, 0xe927, 0xd107, 0xd106,
-  0xe948, 0xf1ca, 0xd988, 0x2062, 0xd4f7, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe579, 0x3104, 0x9107, 0xe148, 0xe927, 0xc906, 0x2882, 0x30c3,
-  0xc106, 0xd907, 0xc106, 0x2082, 0x20e4, 0xe579, 0xfdfb, 0xfdfb,
-  0xe559, 0x2083, 0x9907, 0xd107, 0xc0e6, 0x2862, 0x9cb4, 0xce79,
-  0x20a2, 0x20a2, 0x3945, 0xc618, 0x2104, 0xe558, 0xfdfb, 0xfdfb,
-  0xe559, 0x2083, 0x80e6, 0x2883, 0x20a3, 0x18e3, 0x9473, 0x9c93,
-  0x2986, 0xd6ba, 0xef7d, 0xe71c, 0x2104, 0xe558, 0xfdfb, 0xfdfb,
-  0xe579, 0x20e4, 0x1061, 0x9493, 0xe73c, 0xdedb, 0x3166, 0x2965,
-  0xdedb, 0xffff, 0xf79e, 0x9cd4, 0x3125, 0xe579, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xd4f7, 0x18a3, 0xa4f5, 0xf7be, 0xf7bf, 0xe75c, 0xef5d,
-  0xffff, 0xf79e, 0xad36, 0x2104, 0xd4f7, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xed79, 0x3145, 0x8c52, 0xa4f5, 0xbd98, 0xf79e, 0xffdf,
-  0xf77e, 0xad36, 0x8c32, 0x3125, 0xed79, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xdd17, 0x3125, 0x2904, 0x9453, 0xa4f5, 0xa4f5,
-  0x9c93, 0x2925, 0x2925, 0xdd17, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x3125, 0x20c3, 0x20c3,
-  0x3125, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559,
-  0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe579,
-  0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe599, 0xd517, 0x30e4, 0x2082,
-  0x2082, 0x30e4, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x30e4, 0x3082, 0xc106, 0xd106,
-  0xd106, 0xc106, 0x3083, 0x30e4, 0xd517, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xed99, 0x30e4, 0xb8e6, 0xd106, 0xe927, 0xe947,
-  0xe948, 0xe9c9, 0xd9a9, 0xc106, 0x30e4, 0xe579, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xd517, 0x2883, 0xd107, 0xe928, 0xe927, 0xd107,
-  0xd106, 0xe948, 0xf1ca, 0xd9a9, 0x3083, 0xd4f7, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xe579, 0x30e4, 0x9107, 0xe148, 0xe927, 0xc906, 0x2882,
-  0x30c3, 0xc906, 0xe948, 0xf1c9, 0xc906, 0x30e4, 0xe579, 0xfdfc,
-  0xfdfb, 0xe579, 0x1882, 0x88e6, 0xd107, 0xc0e6, 0x2862, 0x9cb4,
-  0xce79, 0x30a3, 0xb8c5, 0xd907, 0xc0e6, 0x2062, 0xe559, 0xfdfc,
-  0xfdfb, 0xe579, 0x1062, 0x1882, 0x2082, 0x20a3, 0x18e3, 0x9473,
-  0x9cb4, 0x1904, 0x20a3, 0x28c3, 0x1882, 0x1062, 0xe579, 0xfdfc,
-  0xfdfb, 0xe579, 0x3125, 0x83f1, 0xa4f5, 0xe73c, 0xdedb, 0x3166,
-  0x2965, 0xd6ba, 0xe75d, 0xdedb, 0x8c32, 0x2925, 0xe579, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xd517, 0x2925, 0xa515, 0xf7be, 0xf7bf, 0xe75c,
-  0xef5d, 0xffff, 0xf7bf, 0xad56, 0x2925, 0xd4f7, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xed79, 0x3125, 0x8c52, 0xa4f5, 0xbd98, 0xf79e,
-  0xffdf, 0xf77e, 0xad36, 0x8c32, 0x3125, 0xed79, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3125, 0x2904, 0x9453, 0xa4f5,
-  0xa4f5, 0x9c93, 0x2925, 0x2925, 0xdd17, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x3125, 0x20c3,
-  0x20c3, 0x3125, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559,
-  0xe559, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579,
-  0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe599, 0xd517, 0x30e4,
-  0x2082, 0x2082, 0x30e4, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x30e4, 0x3082, 0xc106,
-  0xd106, 0xd106, 0xc106, 0x3083, 0x30e4, 0xd517, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x30e4, 0xb8e6, 0xd106, 0xe927,
-  0xe947, 0xe948, 0xe9c9, 0xd9a9, 0xc106, 0x30e4, 0xe579, 0xfdfc,
-  0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x2062, 0xd107, 0xf148, 0xe927,
-  0xd107, 0xd106, 0xe948, 0xf1ca, 0xd9a9, 0x3083, 0xd4f7, 0xfdfb,
-  0xfddb, 0xfdfb, 0xed79, 0x20e4, 0x1861, 0xc0e6, 0xd106, 0xc106,
-  0x2882, 0x30c3, 0xc906, 0xe948, 0xf1c9, 0xc106, 0x3104, 0xe579,
-  0xfddb, 0xfdfb, 0xe559, 0x18c3, 0x83f1, 0x3125, 0x20a3, 0x1862,
-  0x9cb4, 0xce79, 0x30a3, 0xb8c5, 0xd907, 0xd106, 0x2082, 0xe559,
-  0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xe71c, 0xd6ba, 0x2966,
-  0x9453, 0x9cb4, 0x1904, 0x20a3, 0x38c3, 0xb0e5, 0x2082, 0xe559,
-  0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9453, 0xbdb8, 0xffdf, 0xdefb,
-  0x3166, 0x2965, 0xd6ba, 0xe75d, 0xce7a, 0x20a2, 0x20c4, 0xe579,
-  0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x2904, 0xa4f5, 0xf79e, 0xf7bf,
-  0xe75c, 0xef5d, 0xffff, 0xf7bf, 0xad36, 0x18c3, 0xd4f7, 0xfdfb,
-  0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3125, 0x8c52, 0xa4f5, 0xbd98,
-  0xf79e, 0xffdf, 0xf77e, 0xad36, 0x8c32, 0x3125, 0xed79, 0xfdfc,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3125, 0x2904, 0x9453,
-  0xa4f5, 0xa4f5, 0x9c93, 0x2925, 0x2925, 0xdd17, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x3125,
-  0x20c3, 0x20c3, 0x3125, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579,
-  0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe599, 0xd517,
-  0x30e4, 0x2082, 0x2082, 0x30e4, 0xd4f7, 0xe579, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x30e4, 0x3082,
-  0xc106, 0xd106, 0xd106, 0xc106, 0x3083, 0x30e4, 0xd517, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x30e4, 0xa8c5, 0xd906,
-  0xe927, 0xe947, 0xe948, 0xe9c9, 0xd9a9, 0xc106, 0x30e4, 0xe579,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x18c3, 0x30a3, 0xc906,
-  0xe927, 0xd107, 0xd106, 0xe948, 0xf1ca, 0xd9a9, 0x30a3, 0xd4f7,
-  0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93, 0xd69a, 0x4145,
-  0xb0e6, 0x2882, 0x30c3, 0xc906, 0xe948, 0xe9c9, 0xc127, 0x2082,
-  0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xffdf, 0xd6ba,
-  0x28e4, 0x9c93, 0xce79, 0x30a3, 0xd106, 0xe948, 0xd107, 0x1000,
-  0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xf79e, 0xef5d,
-  0x3186, 0x9453, 0x9c94, 0x2904, 0xc0e6, 0xe927, 0xd107, 0x1000,
-  0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9453, 0xbd98, 0xf7be,
-  0xdedb, 0x3166, 0x3166, 0xc638, 0x4166, 0xc0e6, 0xc106, 0x2082,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x2904, 0xa4f5, 0xf79e,
-  0xf7bf, 0xe75c, 0xef5d, 0xffff, 0xd6ba, 0x28e4, 0x2062, 0xd4f7,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3125, 0x8c52, 0xa4f5,
-  0xbd98, 0xf79e, 0xffdf, 0xf77e, 0xad36, 0x83f1, 0x2945, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3125, 0x2904,
-  0x9453, 0xa4f5, 0xa4f5, 0x9c93, 0x2925, 0x3125, 0xdd17, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd517,
-  0x3125, 0x20c3, 0x20c3, 0x3125, 0xd4f7, 0xed79, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xe579, 0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed99,
-  0xd517, 0x30e4, 0x2082, 0x2082, 0x30e4, 0xd4f7, 0xe599, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x20c3,
-  0x3082, 0xc106, 0xd106, 0xd106, 0xc106, 0x3083, 0x30e4, 0xd4f7,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x20c3, 0x1882,
-  0xb0e5, 0xe927, 0xe947, 0xe948, 0xe9c9, 0xd9a9, 0xc106, 0x2062,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x3165, 0xc618,
-  0x4966, 0xc106, 0xd106, 0xd106, 0xe948, 0xf1ca, 0xd9a9, 0x2021,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93, 0xffdf,
-  0xd6db, 0x20a3, 0x2082, 0x30c3, 0xc906, 0xe948, 0xe9a9, 0xd927,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xffdf,
-  0xef5d, 0x18e3, 0x9493, 0xce79, 0x30c3, 0xd106, 0xe948, 0xe948,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xf79e,
-  0xe73c, 0x3186, 0x9453, 0x9493, 0x1862, 0xd106, 0xe927, 0xe927,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9453, 0xbd98,
-  0xf7be, 0xdedb, 0x3186, 0x2104, 0x20a3, 0xc106, 0xe927, 0xd927,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x2904, 0xa4f5,
-  0xf79e, 0xf7bf, 0xef5d, 0xef5d, 0xd6da, 0x4125, 0xb0e5, 0x2020,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3125, 0x8c52,
-  0xa4f5, 0xbd98, 0xf79e, 0xffdf, 0xf79e, 0x8c32, 0x1041, 0x1062,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3125,
-  0x2904, 0x9453, 0xa4f5, 0xa4f5, 0x9c93, 0x2925, 0x20e4, 0xd517,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed79,
-  0xd517, 0x3125, 0x20c3, 0x20c3, 0x3125, 0xd4f7, 0xed99, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xe579, 0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xe579, 0xd517, 0x30e4, 0x2082, 0x2082, 0x30e4, 0xd4f7, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd37,
-  0x3166, 0x1862, 0xc106, 0xd106, 0xd106, 0xc106, 0x30a3, 0x20a3,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3166,
-  0xbe18, 0x3125, 0xc0e6, 0xe927, 0xe947, 0xe948, 0xd988, 0xd9a9,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x3145,
-  0xef5d, 0xdefb, 0x4165, 0xc0e6, 0xd106, 0xe927, 0xe948, 0xf1ca,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93,
-  0xf7be, 0xffff, 0xc638, 0x2904, 0x30a3, 0xc907, 0xe927, 0xe948,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5,
-  0xffdf, 0xef5d, 0x3166, 0x9cb4, 0xce79, 0x30c3, 0xd106, 0xe927,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5,
-  0xf79e, 0xe73c, 0x2966, 0x9453, 0x9c93, 0x2882, 0xd106, 0xe928,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9453,
-  0xbd98, 0xf7be, 0xdedb, 0x3186, 0x28e4, 0xb0e6, 0xe927, 0xe927,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x2904,
-  0xa4f5, 0xf79e, 0xf7bf, 0xef5d, 0xd6ba, 0x4145, 0xc106, 0xe128,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3125,
-  0x8c52, 0xa4f5, 0xbd98, 0xf79e, 0xffdf, 0xd69a, 0x28a3, 0x88e6,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17,
-  0x3125, 0x2904, 0x9453, 0xa4f5, 0xa4f5, 0x9c93, 0x18c3, 0x1882,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xed79, 0xd517, 0x3125, 0x20c3, 0x20c3, 0x3125, 0xd517, 0xe599,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559, 0xe579, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfc, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe579, 0xe579, 0xe579, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xe579, 0xd4f7, 0x20c3, 0x2082, 0x2082, 0x30e4, 0xd4f7,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xdd17, 0x3966, 0x2104, 0x20a2, 0xb0e6, 0xd106, 0xc106, 0x30a3,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79,
-  0x3166, 0xd69a, 0xe73c, 0xd6ba, 0x30c3, 0xd907, 0xe948, 0xd988,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7,
-  0x2945, 0xe75c, 0xffff, 0xef7d, 0x20a2, 0xb8c5, 0xe927, 0xe948,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125,
-  0x9c93, 0xf7be, 0xffdf, 0xd6ba, 0x2104, 0x30a3, 0xc907, 0xe927,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3,
-  0xa4f5, 0xffdf, 0xef5d, 0x2965, 0x9cb4, 0xce79, 0x30c3, 0xd106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3,
-  0xa4f5, 0xf79e, 0xe73c, 0x2966, 0x9453, 0x9cb4, 0x3082, 0xd106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125,
-  0x9453, 0xbd98, 0xf7be, 0xdedb, 0x2966, 0x1862, 0xc906, 0xe927,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517,
-  0x2904, 0xa4f5, 0xf79e, 0xffdf, 0xd6ba, 0x2082, 0xd107, 0xe948,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79,
-  0x3125, 0x8c52, 0xa4f5, 0xbdb8, 0xe71c, 0x3125, 0x90e7, 0xa107,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xdd17, 0x3125, 0x2904, 0x9453, 0xa4f5, 0x83f1, 0x1062, 0x1882,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xed79, 0xd517, 0x3125, 0x20e4, 0x20e4, 0x20e4, 0xd4f7,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe559, 0xed79, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfdfc, 0xfe1c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe559, 0xe558, 0xe579, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xe579, 0xd4f7, 0x3966, 0x2104, 0x1082, 0x2082,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xdd17, 0x3146, 0x3186, 0xd6da, 0xd6ba, 0x20a2, 0xb8c5,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xed79, 0x3166, 0xd69a, 0xef5d, 0xffff, 0xef7d, 0x28c3, 0xd106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xd4f7, 0x2945, 0xe75c, 0xffff, 0xffff, 0xd6ba, 0x2082, 0xd106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579,
-  0x3125, 0x9c93, 0xf7be, 0xffdf, 0xdedb, 0x2986, 0x20a2, 0xc106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559,
-  0x18c3, 0xa4f5, 0xffdf, 0xef5d, 0x2965, 0x9c93, 0xce59, 0x20c3,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559,
-  0x18c3, 0xa4f5, 0xf79e, 0xe73c, 0x2966, 0x9453, 0x9c94, 0x1882,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579,
-  0x3125, 0x9453, 0xbd98, 0xf7be, 0xdedb, 0x2966, 0x1862, 0xc106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb,
-  0xd517, 0x2904, 0xa4f5, 0xf79e, 0xffbf, 0xd6ba, 0x20a2, 0xd106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xed79, 0x3125, 0x8c52, 0xa4f5, 0xbdb8, 0xdefc, 0x28c3, 0xc906,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xdd17, 0x3125, 0x2904, 0x9473, 0x9473, 0x1862, 0x88e6,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x3125, 0x20c3, 0x1082, 0x2082,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe559, 0xe579, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfdfc, 0xfe1c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe559, 0xe558, 0xe559,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xe579, 0xd4f7, 0x3166, 0x2904, 0x2925,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xdd17, 0x3146, 0x3186, 0xd6ba, 0xe73c, 0xd69a,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xed79, 0x3166, 0xd69a, 0xef5d, 0xffff, 0xef7d, 0x2965,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xd4f7, 0x2945, 0xe75c, 0xffff, 0xffff, 0xd69a, 0x0861,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0x3125, 0x9c93, 0xf7be, 0xffdf, 0xdedb, 0x3166, 0x10a2,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe559, 0x18c3, 0xa4f5, 0xffdf, 0xef5d, 0x2965, 0x9493, 0xe6fc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe559, 0x18c3, 0xa4f5, 0xf79e, 0xe73c, 0x2966, 0x9473, 0xad16,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xe579, 0x3125, 0x9453, 0xbd98, 0xffbf, 0xdedb, 0x20e3, 0x1862,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xd517, 0x2904, 0xa4f5, 0xf7bf, 0xe73c, 0x20a2, 0xb8c5,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xed79, 0x3125, 0x8c52, 0xa4f5, 0x9493, 0x28a3, 0xd107,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xdd17, 0x3145, 0x18c3, 0x1062, 0x80e6, 0x9907,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd4f7, 0x20c3, 0x2083, 0x2083,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xed79, 0xe579, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc, 0xfe1c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe559, 0xe559,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe579, 0xd4f7, 0x3166, 0x2904,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3146, 0x3186, 0xd6ba, 0xe73c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xed79, 0x3166, 0xd69a, 0xef5d, 0xffff, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xd4f7, 0x2945, 0xe75c, 0xffff, 0xffff, 0xe73c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xe579, 0x3125, 0x9c93, 0xf7be, 0xffdf, 0xd6ba, 0x3186,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xffdf, 0xef5d, 0x3166, 0x8c52,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xf79e, 0xe73c, 0x3186, 0x8c53,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xe579, 0x3125, 0x9453, 0xbd98, 0xf7be, 0xc638, 0x3104,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfdfb, 0xfdfb, 0xd517, 0x2904, 0xa4f5, 0xd69a, 0x4166, 0xc0e6,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xed79, 0x3145, 0x83f1, 0x20e4, 0x90e7, 0xe148,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xdd38, 0x2925, 0x1862, 0x8907, 0xa107,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed79, 0xd517, 0x30e4, 0x2083,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe579, 0xd4f7, 0x3966,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3146, 0x3186, 0xd6ba,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3166, 0xd69a, 0xef5d, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x2945, 0xe75c, 0xffff, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93, 0xf7be, 0xffdf, 0xef5d,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xffdf, 0xe73c, 0x2945,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xf79e, 0xe73c, 0x10a2,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9453, 0xbdb8, 0xce79, 0x20c3,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x2905, 0x83f1, 0x3925, 0xc106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x20c4, 0x1041, 0x80e6, 0xb148,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x20c3, 0x2883, 0x8907,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xed99, 0xd4f7, 0x3105,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfb, 0xed79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe559, 0xe559,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x3166, 0x2904,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3166, 0xd69a, 0xe73c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x2945, 0xe75c, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93, 0xf7be, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xf7be, 0xffff,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xffbf, 0xef5d,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c93, 0xce7a, 0x3945,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x18c3, 0x28a3, 0xc106,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x28e4, 0x78c6, 0xa107,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xdd17, 0x30e4, 0x2083,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe579, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x3966,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x3166, 0xce79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x3166, 0xe73c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3125, 0x9c94, 0xffbf,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0xa4f5, 0xe71c,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x18c3, 0x83f1, 0x2925,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed79, 0x20e4, 0x1062, 0x88e7,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x1862, 0x9907,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xed99, 0x30e4, 0x88e6,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd517, 0x3105,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xe579,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfddb, 0xed79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x20e4,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x18c3,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x3145, 0x9473,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x20c3, 0x8c52,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x1062, 0x1862,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x30e4, 0x78e6,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfb, 0xd4f7, 0x1882,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x20e4,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfddb, 0xed79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfddb, 0xed79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x20e4,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x1062,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe559, 0x1062,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xe579, 0x28e4,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfddb, 0xed79,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb, 0xfdfc,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb,
-  0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfddb, 0xfdfb
-};
-
-const Animation pokeballAnimation = {
-  .name = "Pokeball",
-  .frameCount = 30,
-  .width = 16,
-  .height = 16,
-  .frameDurations = pokeballDurations,
-  .animationFrames = pokeballFrames
-};
-#endif // ANIMATION_POKEBALL_H
@@ -1,534 +0,0 @@
-// ps_symbols.h - Auto-generated from ps_symbols.json
-#ifndef ANIMATION_PS_SYMBOLS_H
-#define ANIMATION_PS_SYMBOLS_H
-
-#include "animation_types.h"
-
-// Frame Durations for ps_symbols (in 100ms units)
-static const uint8_t PROGMEM ps_symbolsDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for ps_symbols
-static const uint16_t PROGMEM ps_symbolsFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446,
-  0x0446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ec,
-  0x07ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x07ec,
-  0x07ec, 0x0446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ec, 0x0446,
-  0x0446, 0x07ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x07ec, 0x0000,
-  0x0000, 0x07ec, 0x0446, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ec, 0x064a, 0x0000,
-  0x0000, 0x064a, 0x07ec, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0446, 0x07ec, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x07ec, 0x0446, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x07ec, 0x064a, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x064a, 0x07ec, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0446, 0x07ec, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07ec, 0x0446, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07ec, 0x064a, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x064a, 0x07ec, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0446, 0x07ec, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x07ec, 0x0446, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x07ec, 0x064a, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x064a, 0x07ec, 0x0000, 0x0000,
-  0x0000, 0x0446, 0x07ec, 0x0446, 0x064a, 0x064a, 0x064a, 0x064a,
-  0x064a, 0x064a, 0x064a, 0x064a, 0x0446, 0x07ec, 0x0446, 0x0000,
-  0x0000, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec,
-  0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x07ec, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x03c6, 0x03c6,
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c1, 0x072b, 0x072b,
-  0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0406, 0x076b, 0x076b,
-  0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e1, 0x06ca, 0x0467, 0x0467,
-  0x06ca, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0040, 0x0426, 0x070b, 0x00c1, 0x00c1,
-  0x06eb, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00c1, 0x06eb, 0x0588, 0x0040, 0x0040,
-  0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000,
-  0x0101, 0x070b, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000, 0x0000,
-  0x0060, 0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0101, 0x070b, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0060, 0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000,
-  0x0040, 0x0426, 0x06eb, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e1, 0x06eb, 0x0426, 0x0040, 0x0000, 0x0000,
-  0x00e1, 0x06ca, 0x05e9, 0x00e1, 0x0060, 0x0060, 0x0060, 0x0060,
-  0x0060, 0x0060, 0x00c1, 0x05c9, 0x06eb, 0x00e1, 0x0000, 0x0000,
-  0x0487, 0x076b, 0x0528, 0x05c9, 0x05e9, 0x05e9, 0x05e9, 0x05e9,
-  0x05e9, 0x05e9, 0x05c9, 0x0528, 0x076b, 0x0446, 0x0040, 0x0000,
-  0x06ea, 0x070b, 0x06ca, 0x070b, 0x070b, 0x070b, 0x070b, 0x070b,
-  0x070b, 0x070b, 0x070b, 0x06ca, 0x072b, 0x064a, 0x0080, 0x0000,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x03c6, 0x03c6, 0x0040,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00c1, 0x072b, 0x072b, 0x00e1,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0040, 0x0406, 0x076b, 0x076b, 0x0426,
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00e1, 0x06ca, 0x0467, 0x0467, 0x06ca,
-  0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x0426, 0x070b, 0x00c1, 0x00c1, 0x06eb,
-  0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00c1, 0x06eb, 0x0588, 0x0040, 0x0040, 0x0588,
-  0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x0000, 0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000, 0x0101,
-  0x070b, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x1000, 0xa0c0,
-  0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000, 0x0000, 0x0060,
-  0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x1000, 0xa0c0,
-  0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0101, 0x070b, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x00e1, 0x06ca, 0x0588, 0x0060, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0487, 0x06ca, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x00e1, 0x06eb, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x078c, 0x05c9, 0x00e1, 0x0060, 0x0060, 0x0060, 0x0060, 0x0060,
-  0x0060, 0x00c1, 0x05c9, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000,
-  0x07ac, 0x0528, 0x05c9, 0x05e9, 0x05e9, 0x05e9, 0x05e9, 0x05e9,
-  0x05e9, 0x05c9, 0x0528, 0x076b, 0x0446, 0x0040, 0x0000, 0x0000,
-  0x070b, 0x06ca, 0x070b, 0x070b, 0x070b, 0x070b, 0x070b, 0x070b,
-  0x070b, 0x070b, 0x06ca, 0x072b, 0x064a, 0x0080, 0x0000, 0x0000,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2020, 0xa101, 0xb101,
-  0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1820, 0xa8c0, 0xe940, 0xfb29, 0xfb6a,
-  0x03c6, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x80a0, 0xe141, 0xf120, 0xe920, 0xe141, 0xe941,
-  0x070b, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xe181, 0xfb08, 0xa901, 0x2020, 0x1000, 0x1000,
-  0x078c, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0xa901, 0xf2e8, 0xa921, 0x1820, 0x0000, 0x0000, 0x0000,
-  0x0609, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2020, 0xe120, 0xb900, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0121, 0x06eb, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000, 0x0800,
-  0xa8c0, 0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0060, 0x0568, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000, 0x0800,
-  0xa8c0, 0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0101, 0x070b, 0x0426, 0x0040, 0x0000, 0x0000, 0x0000,
-  0x2020, 0xe100, 0xb8c0, 0x1800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0060, 0x0588, 0x06eb, 0x00e1, 0x0000, 0x0000, 0x0000,
-  0x0800, 0xa8c0, 0xf161, 0xa900, 0x1000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x00e1, 0x06eb, 0x0426, 0x0040, 0x0000, 0x0000,
-  0x0000, 0x1840, 0xe309, 0xf36a, 0x8901, 0x1000, 0x0800, 0x0800,
-  0x0080, 0x0060, 0x00c1, 0x05c9, 0x06eb, 0x00e1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8101, 0xe34a, 0xeb29, 0x9101, 0x80e1, 0x88e1,
-  0x05e9, 0x05e9, 0x05c9, 0x0528, 0x076b, 0x0446, 0x0040, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1840, 0xa921, 0xdb09, 0xf34a, 0xf34a,
-  0x070b, 0x070b, 0x070b, 0x06ca, 0x072b, 0x064a, 0x0080, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2041, 0xa101, 0xb101,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x1000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2020, 0xa901,
-  0xa901, 0x2020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x1820, 0xa8c0, 0xe940, 0xfb29,
-  0xfb29, 0xe940, 0xa8c0, 0x2020, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x80a0, 0xe141, 0xf120, 0xe920, 0xe141,
-  0xe141, 0xe920, 0xf120, 0xe141, 0x80a0, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1820, 0xe181, 0xfb08, 0xa901, 0x2020, 0x1000,
-  0x1000, 0x1820, 0xa901, 0xfb08, 0xe181, 0x2020, 0x0000, 0x0000,
-  0x0000, 0x0800, 0xa901, 0xf2e8, 0xa921, 0x1820, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1820, 0xa921, 0xf2e8, 0xa901, 0x0800, 0x0000,
-  0x0000, 0x2020, 0xe120, 0xb900, 0x1820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1820, 0xb900, 0xe120, 0x2020, 0x0000,
-  0x0800, 0xa8c0, 0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800,
-  0x0800, 0xa8c0, 0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800,
-  0x0000, 0x2020, 0xe100, 0xb8c0, 0x1800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x1800, 0xb8c0, 0xe100, 0x2020, 0x0000,
-  0x0000, 0x0800, 0xa8c0, 0xf161, 0xa900, 0x1000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1000, 0xa900, 0xf161, 0xa8c0, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x1840, 0xe309, 0xf36a, 0x8901, 0x1000, 0x0800,
-  0x0800, 0x1000, 0x8101, 0xf36a, 0xe309, 0x2040, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x8101, 0xe34a, 0xeb29, 0x9101, 0x80e1,
-  0x80e1, 0x9101, 0xeb29, 0xe34a, 0x8101, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x1840, 0xa921, 0xdb09, 0xf34a,
-  0xf34a, 0xe309, 0xa921, 0x1840, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2041, 0xa901,
-  0xa901, 0x2041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2020, 0xa901, 0xa901,
-  0x2020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1820, 0xa8c0, 0xe940, 0xfb29, 0xfb29,
-  0xe940, 0xa8c0, 0x2020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x80a0, 0xe141, 0xf120, 0xe920, 0xe141, 0xe141,
-  0xe920, 0xf120, 0xe141, 0x80a0, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xe181, 0xfb08, 0xa901, 0x2020, 0x1000, 0x1000,
-  0x1820, 0xa901, 0xfb08, 0xe181, 0x2020, 0x0000, 0x0000, 0x0000,
-  0x0800, 0xa8e1, 0xf2e8, 0xa921, 0x1820, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xa921, 0xf2e8, 0xa901, 0x0800, 0x0000, 0x0000,
-  0x2020, 0xe100, 0xb900, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1820, 0xb900, 0xe120, 0x2020, 0x0000, 0x0000,
-  0xb8e0, 0xe920, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000,
-  0xb8e0, 0xe920, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000,
-  0x2020, 0xe100, 0xb8c0, 0x1800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x1800, 0xb8c0, 0xe100, 0x2020, 0x0000, 0x0000,
-  0x0800, 0xa8c0, 0xf161, 0xa900, 0x1000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1000, 0xa900, 0xf161, 0xa8c0, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x1840, 0xe309, 0xf36a, 0x8901, 0x1000, 0x0800, 0x0800,
-  0x1000, 0x8101, 0xf36a, 0xe309, 0x2040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x8101, 0xe34a, 0xeb29, 0x9101, 0x80e1, 0x80e1,
-  0x9101, 0xeb29, 0xe34a, 0x8101, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0800, 0x1840, 0xa921, 0xdb09, 0xf34a, 0xf34a,
-  0xe309, 0xa921, 0x1840, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x2041, 0xa901, 0xa901,
-  0x2041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x2020, 0xa901, 0xa901, 0x2020,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0190,
-  0x0000, 0x0800, 0x1820, 0xa8c0, 0xe940, 0xfb29, 0xfb29, 0xe940,
-  0xa8c0, 0x2020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0022, 0x0215,
-  0x0800, 0x8080, 0xe141, 0xf120, 0xe920, 0xe141, 0xe141, 0xe920,
-  0xf120, 0xe141, 0x80a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x2020, 0xe161, 0xfb08, 0xa901, 0x2020, 0x1000, 0x1000, 0x1820,
-  0xa901, 0xfb08, 0xe181, 0x2020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xb901, 0xeae8, 0xa921, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1820, 0xa921, 0xf2e8, 0xa901, 0x0800, 0x0000, 0x0000, 0x0000,
-  0xf120, 0xb900, 0x1820, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xb900, 0xe120, 0x2020, 0x0000, 0x0000, 0x0000,
-  0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000, 0x0000,
-  0xf120, 0x88a0, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000, 0x0000,
-  0xf120, 0xb8c0, 0x1800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1800, 0xb8c0, 0xe100, 0x2020, 0x0000, 0x0000, 0x0000,
-  0xb8e0, 0xe961, 0xa900, 0x1000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1000, 0xa900, 0xf161, 0xa8c0, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x2040, 0xe309, 0xf36a, 0x8901, 0x1000, 0x0800, 0x0800, 0x1000,
-  0x8101, 0xf36a, 0xe309, 0x2040, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0800, 0x8101, 0xe34a, 0xeb29, 0x9101, 0x80e1, 0x80e1, 0x9101,
-  0xeb29, 0xe34a, 0x8101, 0x0800, 0x0000, 0x0000, 0x0000, 0x0001,
-  0x0000, 0x0800, 0x1840, 0xa921, 0xdb09, 0xf34a, 0xf34a, 0xe309,
-  0xa921, 0x1840, 0x0800, 0x0000, 0x0000, 0x0000, 0x0021, 0x01b1,
-  0x0000, 0x0000, 0x0000, 0x0800, 0x2041, 0xa901, 0xa901, 0x2041,
-  0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x3359,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0800, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1000, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x01b1, 0x0236, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe920, 0xa8c0, 0x2020, 0x0800, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0236, 0x33de, 0x09f2, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe920, 0xf120, 0xe141, 0x80a0, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0043, 0x0a77, 0x33bd, 0x0a12, 0x0063, 0x0000, 0x0000, 0x0000,
-  0x2020, 0xa901, 0xfb08, 0xe181, 0x2020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x0a77, 0x5cbe, 0x43db, 0x08a4, 0x0000, 0x0000,
-  0x0000, 0x1820, 0xa921, 0xf2e8, 0xa901, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x1297, 0x64df, 0x3bdb, 0x08a4, 0x0062,
-  0x0000, 0x0000, 0x1820, 0xb900, 0xe120, 0x2020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdd,
-  0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f,
-  0x0000, 0x0000, 0x0000, 0x88a0, 0xf120, 0xa8c0, 0x0800, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f,
-  0x0000, 0x0000, 0x1800, 0xb8c0, 0xe100, 0x2020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdc,
-  0x0000, 0x1000, 0xa900, 0xf161, 0xa8c0, 0x0800, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x1297, 0x64ff, 0x3bdb, 0x08a4, 0x0042,
-  0x1000, 0x8101, 0xf36a, 0xe309, 0x2040, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x1297, 0x6d1f, 0x6c9b, 0x08a4, 0x0000, 0x0000,
-  0x9101, 0xeb09, 0xe34a, 0x8101, 0x0800, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x09f2, 0x64ff, 0x6c9b, 0x10c4, 0x0000, 0x0000, 0x0000,
-  0xdb09, 0xa921, 0x1840, 0x0800, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x09f2, 0x3c1e, 0x3bdb, 0x08a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1041, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042,
-  0x3379, 0x3b9a, 0x0884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0062, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0021, 0x01b1, 0x0236, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x0236, 0x01b1, 0x0021,
-  0x0021, 0x0236, 0x33de, 0x09f2, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x09f2, 0x2bde, 0x0236, 0x0022,
-  0x0000, 0x0043, 0x0a77, 0x33bd, 0x0a12, 0x0063, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0063, 0x0a12, 0x33bd, 0x0a77, 0x0043, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x0a77, 0x5cbe, 0x43db, 0x08a4, 0x0000,
-  0x0000, 0x0884, 0x43db, 0x5cbe, 0x0a77, 0x0043, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x1297, 0x64df, 0x3bdb, 0x0884,
-  0x0884, 0x3bdb, 0x64df, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd,
-  0x3bdd, 0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f,
-  0x031f, 0x01f3, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f,
-  0x031f, 0x01f3, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd,
-  0x3bdc, 0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x1297, 0x64ff, 0x3bdb, 0x0884,
-  0x0884, 0x3bdb, 0x64ff, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x1297, 0x6d1f, 0x6c9b, 0x08a4, 0x0000,
-  0x0000, 0x08a4, 0x6c9b, 0x6d1f, 0x1297, 0x0043, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x09f2, 0x64ff, 0x6c9b, 0x10c4, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10a4, 0x6c9b, 0x64ff, 0x09f2, 0x0022, 0x0000,
-  0x0021, 0x09f2, 0x3c1e, 0x3bdb, 0x08a4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x08a4, 0x3bdb, 0x3c1e, 0x09f2, 0x0021,
-  0x0042, 0x3379, 0x3b9a, 0x0884, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0884, 0x3b9a, 0x3379, 0x0042,
-  0x0000, 0x0042, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0042, 0x0000,
-  0x0021, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x01d3, 0x0236, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0236, 0x01b1, 0x0021, 0x0000,
-  0x0278, 0x2bbd, 0x09f2, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x09f2, 0x2bde, 0x0256, 0x0021, 0x0000,
-  0x0064, 0x0a57, 0x33bd, 0x0a12, 0x0063, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0063, 0x0a12, 0x33bd, 0x0a77, 0x0043, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x0a77, 0x5cbe, 0x43db, 0x08a4, 0x0000, 0x0000,
-  0x0884, 0x43db, 0x5cbe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x1297, 0x64df, 0x3bdb, 0x0884, 0x0884,
-  0x3bdb, 0x64df, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdd,
-  0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f,
-  0x01f3, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f,
-  0x01f3, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdc,
-  0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x1297, 0x64ff, 0x3bdb, 0x0884, 0x0884,
-  0x3bdb, 0x64ff, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x1297, 0x6d1f, 0x6c9b, 0x08a4, 0x0000, 0x0000,
-  0x08a4, 0x6c9b, 0x6d1f, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x09f1, 0x64ff, 0x6c9b, 0x10c4, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a4, 0x6c9b, 0x64ff, 0x09f2, 0x0022, 0x0000, 0x0000,
-  0x0a13, 0x3bfe, 0x3bdb, 0x08a4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x08a4, 0x3bdb, 0x3c1e, 0x09f2, 0x0021, 0x0000,
-  0x3bbc, 0x3b9a, 0x0884, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0884, 0x3b9a, 0x337a, 0x0042, 0x0000,
-  0x0062, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0062, 0x0000, 0x0000,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0821,
-  0x0236, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x0236, 0x01b1, 0x0021, 0x0820, 0x79aa,
-  0x33de, 0x09f2, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x09f2, 0x2bde, 0x0256, 0x0021, 0x0820, 0x91ec,
-  0x0a99, 0x33bd, 0x0a12, 0x0063, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0063, 0x0a12, 0x33bd, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0821,
-  0x0043, 0x0a77, 0x5cbe, 0x43db, 0x08a4, 0x0000, 0x0000, 0x0884,
-  0x43db, 0x5cbe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x1297, 0x64df, 0x3bdb, 0x0884, 0x0884, 0x3bdb,
-  0x64df, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdd, 0x3bfe,
-  0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f, 0x01f3,
-  0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0042, 0x01f3, 0x031f, 0x031f, 0x01f3,
-  0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0043, 0x0a77, 0x3bfe, 0x3bdd, 0x3bdc, 0x3bfe,
-  0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x1297, 0x64ff, 0x3bdb, 0x0884, 0x0884, 0x3bdb,
-  0x64ff, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0043, 0x1297, 0x6d1f, 0x6c9b, 0x08a4, 0x0000, 0x0000, 0x08a4,
-  0x6c9b, 0x6d1f, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0a13, 0x64de, 0x6c9b, 0x10c4, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a4, 0x6c9b, 0x64ff, 0x09f2, 0x0022, 0x0000, 0x0000, 0x0821,
-  0x3c3f, 0x3bdb, 0x08a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x08a4, 0x3bdb, 0x3c1e, 0x09f2, 0x0001, 0x0821, 0x9a0d,
-  0x3b9a, 0x08a4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0884, 0x3b9a, 0x337a, 0x0042, 0x1021, 0xba90,
-  0x0042, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0042, 0x0062, 0x0000, 0x0000, 0x1041,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x1041, 0x1041, 0x1041,
-  0x0000, 0x0000, 0x0000, 0x0043, 0x0236, 0x01b1, 0x0021, 0x0820,
-  0x798a, 0x89cb, 0xa22d, 0xa22e, 0xa26e, 0xcb12, 0xd332, 0xd332,
-  0x0000, 0x0000, 0x0022, 0x09f2, 0x2bde, 0x0256, 0x0021, 0x0820,
-  0xa22d, 0xdb13, 0xe313, 0xe333, 0xdcb6, 0xed79, 0xfd97, 0xfdb7,
-  0x0000, 0x0063, 0x0a12, 0x33bd, 0x0a77, 0x0043, 0x0000, 0x0821,
-  0xaa4e, 0xe313, 0xb26f, 0xaa4e, 0xcb32, 0xcc95, 0xccb5, 0xccb5,
-  0x08a4, 0x43da, 0x5cbe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x1041,
-  0xd2f1, 0xe354, 0xa22e, 0x1842, 0x1021, 0x1061, 0x1061, 0x1061,
-  0x441d, 0x64df, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xd312, 0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xd332, 0xed38, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01d2, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xd332, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01d2, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xd332, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x3bfe, 0x0a77, 0x0043, 0x0000, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xd332, 0xed38, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x441d, 0x64ff, 0x1297, 0x0043, 0x0000, 0x0000, 0x0000, 0x1021,
-  0xcb12, 0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x08a4, 0x6c9a, 0x6d1f, 0x1297, 0x0043, 0x0000, 0x0000, 0x0821,
-  0xaa4e, 0xe333, 0xa22e, 0x1842, 0x1021, 0x1021, 0x1021, 0x1021,
-  0x0000, 0x10a4, 0x6c9b, 0x64ff, 0x09f2, 0x0022, 0x0000, 0x0821,
-  0xa22e, 0xdb13, 0xa20d, 0xa26e, 0xd312, 0xd332, 0xd332, 0xd332,
-  0x0000, 0x0000, 0x08a4, 0x3bdb, 0x3c1e, 0x09f2, 0x0001, 0x0820,
-  0xaa4e, 0xe333, 0xe374, 0xdcd6, 0xfd97, 0xfdb7, 0xfd97, 0xfdb7,
-  0x0000, 0x0000, 0x0000, 0x0884, 0x3b9a, 0x337a, 0x0042, 0x0821,
-  0xba90, 0xd312, 0xc454, 0xc495, 0xc4b5, 0xc4b5, 0xc4b5, 0xccb5,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0062, 0x0000, 0x0000,
-  0x1041, 0x1041, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x0000, 0x0820, 0x0821, 0x0821, 0x0821, 0x0821, 0x1041, 0x1041,
-  0x1041, 0x1041, 0x0821, 0x0821, 0x0821, 0x0821, 0x0820, 0x0000,
-  0x0820, 0x798a, 0x89cb, 0xa22d, 0xa22e, 0xa26e, 0xcb12, 0xd332,
-  0xd332, 0xcb12, 0xa26e, 0xa22e, 0xa22d, 0x89cb, 0x798a, 0x0821,
-  0x0821, 0xa22d, 0xdb13, 0xe313, 0xe333, 0xdcb6, 0xed79, 0xfd97,
-  0xfd97, 0xed79, 0xdcb6, 0xe333, 0xe313, 0xdb13, 0xa22d, 0x0821,
-  0x0821, 0xaa4e, 0xe313, 0xb26f, 0xaa4e, 0xcb32, 0xcc95, 0xccb5,
-  0xccb5, 0xcc95, 0xcb32, 0xaa4e, 0xb26f, 0xe313, 0xaa4e, 0x0821,
-  0x1041, 0xcad1, 0xe354, 0xa22e, 0x1842, 0x1021, 0x1061, 0x1061,
-  0x1061, 0x1061, 0x1021, 0x1842, 0xa22e, 0xe354, 0xcad1, 0x1041,
-  0x1041, 0xd312, 0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041,
-  0x1041, 0xd312, 0xed38, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0821, 0xa26e, 0xdcd6, 0xd312, 0x1041,
-  0x1021, 0xd312, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1041,
-  0x1021, 0xd312, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1041,
-  0x1041, 0xd312, 0xed38, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0821, 0xa26e, 0xed38, 0xd332, 0x1041,
-  0x1041, 0xcaf2, 0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041,
-  0x0821, 0xa24e, 0xe333, 0xa22e, 0x1842, 0x1021, 0x1021, 0x1021,
-  0x1021, 0x1021, 0x1021, 0x1842, 0xa22d, 0xe354, 0xcad1, 0x1041,
-  0x0821, 0xa22d, 0xdb13, 0xa20d, 0xa26e, 0xd312, 0xd332, 0xd332,
-  0xd332, 0xd332, 0xd312, 0xa26e, 0xa20d, 0xdb13, 0xa24e, 0x0821,
-  0x0821, 0xaa4e, 0xe333, 0xe374, 0xdcd6, 0xfd97, 0xfdb7, 0xfd97,
-  0xfd97, 0xfdb7, 0xfd97, 0xdcd6, 0xe374, 0xe333, 0xaa4e, 0x1021,
-  0x1041, 0xba8f, 0xd312, 0xc454, 0xc495, 0xc4b5, 0xc4b5, 0xc4b5,
-  0xc4b5, 0xc4b5, 0xc4b5, 0xc495, 0xc454, 0xd312, 0xba90, 0x1041,
-  0x0000, 0x1041, 0x1041, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1041, 0x1041, 0x0000,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0821, 0x1041, 0x1041, 0x1041,
-  0x1041, 0x0821, 0x0821, 0x0821, 0x0821, 0x0820, 0x0000, 0x0000,
-  0x81ab, 0x89cb, 0xa22d, 0xa22e, 0xa26e, 0xcb12, 0xd332, 0xd332,
-  0xcb12, 0xa26e, 0xa22e, 0xa22d, 0x89cb, 0x798a, 0x0820, 0x0000,
-  0xb26f, 0xdb12, 0xe313, 0xe333, 0xdcb6, 0xed79, 0xfd97, 0xfd97,
-  0xed79, 0xdcb6, 0xe333, 0xe313, 0xdb13, 0xa22e, 0x0821, 0x0000,
-  0xba6f, 0xdb13, 0xb26f, 0xaa4e, 0xcb32, 0xcc95, 0xccb5, 0xccb5,
-  0xcc95, 0xcb32, 0xaa4e, 0xb26f, 0xe313, 0xaa4e, 0x0821, 0x0000,
-  0xe333, 0xe353, 0xa22e, 0x1842, 0x1021, 0x1061, 0x1061, 0x1061,
-  0x1061, 0x1021, 0x1842, 0xa22e, 0xe354, 0xd2f2, 0x1041, 0x0000,
-  0xe354, 0xdc96, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1021, 0x0000,
-  0xe374, 0xed17, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xdcd6, 0xd332, 0x1021, 0x0000,
-  0xeb74, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000,
-  0xeb74, 0xf556, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000,
-  0xeb74, 0xed17, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xed38, 0xd332, 0x1021, 0x0000,
-  0xe353, 0xdc96, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1021, 0x0000,
-  0xba6f, 0xdb33, 0xa22e, 0x1842, 0x1021, 0x1021, 0x1021, 0x1021,
-  0x1021, 0x1021, 0x1842, 0xa22d, 0xe354, 0xd2f2, 0x1041, 0x0000,
-  0xb26f, 0xdaf2, 0xa20d, 0xa26e, 0xd312, 0xd332, 0xd332, 0xd332,
-  0xd332, 0xd312, 0xa26e, 0xa20d, 0xdb13, 0xaa4e, 0x0821, 0x0000,
-  0xba8f, 0xe333, 0xe374, 0xdcd6, 0xfd97, 0xfdb7, 0xfd97, 0xfd97,
-  0xfdb7, 0xfd97, 0xdcd6, 0xe374, 0xe333, 0xaa4e, 0x0821, 0x0000,
-  0xcad1, 0xcb12, 0xc454, 0xc495, 0xc4b5, 0xc4b5, 0xc4b5, 0xc4b5,
-  0xc4b5, 0xc4b5, 0xc495, 0xc454, 0xd312, 0xba90, 0x1021, 0x0000,
-  0x1041, 0x1041, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1041, 0x1041, 0x0000, 0x0000,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x1041, 0x1041, 0x1041, 0x1041,
-  0x0821, 0x0821, 0x0821, 0x0821, 0x0820, 0x0000, 0x0000, 0x0000,
-  0x89cb, 0xa22d, 0xa22e, 0xa26e, 0xcb12, 0xd332, 0xd332, 0xcb12,
-  0xa26e, 0xa22e, 0xa22d, 0x89cb, 0x798a, 0x0820, 0x0000, 0x0000,
-  0xe313, 0xe313, 0xe333, 0xdcb6, 0xed79, 0xfd97, 0xfd97, 0xed79,
-  0xdcb6, 0xe333, 0xe313, 0xdb13, 0xa22e, 0x0821, 0x0000, 0x0000,
-  0xe313, 0xb26f, 0xaa4e, 0xcb32, 0xcc95, 0xccb5, 0xccb5, 0xcc95,
-  0xcb32, 0xaa4e, 0xb26f, 0xe313, 0xaa4e, 0x0821, 0x0000, 0x0000,
-  0xe353, 0xa22e, 0x1842, 0x1021, 0x1061, 0x1061, 0x1061, 0x1061,
-  0x1021, 0x1842, 0xa22e, 0xe354, 0xd2f2, 0x1041, 0x0000, 0x0000,
-  0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041, 0x0000, 0x0000,
-  0xed58, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0821, 0xa26e, 0xdcd6, 0xd332, 0x1041, 0x0000, 0x0000,
-  0xf596, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000, 0x0000,
-  0xf596, 0xaa6e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000, 0x0000,
-  0xed58, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0821, 0xa26e, 0xed38, 0xd332, 0x1021, 0x0000, 0x0000,
-  0xdcb6, 0xa26e, 0x0821, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041, 0x0000, 0x0000,
-  0xe353, 0xa22e, 0x1842, 0x1021, 0x1021, 0x1021, 0x1021, 0x1021,
-  0x1021, 0x1842, 0xa22d, 0xe354, 0xd2f2, 0x1041, 0x0000, 0x0000,
-  0xdb13, 0xa20d, 0xa26e, 0xd312, 0xd332, 0xd332, 0xd332, 0xd332,
-  0xd312, 0xa26e, 0xa20d, 0xdb13, 0xaa4e, 0x0821, 0x0000, 0x0040,
-  0xeb34, 0xe374, 0xdcd6, 0xfd97, 0xfdb7, 0xfd97, 0xfd97, 0xfdb7,
-  0xfd97, 0xdcd6, 0xe374, 0xe333, 0xaa4e, 0x0821, 0x0040, 0x03e6,
-  0xcb12, 0xc454, 0xc495, 0xc4b5, 0xc4b5, 0xc4b5, 0xc4b5, 0xc4b5,
-  0xc4b5, 0xc495, 0xc454, 0xd312, 0xba90, 0x1021, 0x0080, 0x064a,
-  0x1041, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062, 0x1062,
-  0x1062, 0x1062, 0x1062, 0x1041, 0x1041, 0x0000, 0x0000, 0x00a1,
-  0x1041, 0x1021, 0x0821, 0x0821, 0x0821, 0x0820, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0040,
-  0xcb12, 0xa26e, 0xa22e, 0xa22d, 0x89cb, 0x798a, 0x0820, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x03c6, 0x0426,
-  0xed59, 0xdcb6, 0xe333, 0xe313, 0xdb13, 0xa22e, 0x0821, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x00c1, 0x070b, 0x07ac,
-  0xcc95, 0xcb32, 0xaa4e, 0xb26f, 0xe313, 0xaa4e, 0x0821, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0040, 0x0406, 0x076b, 0x07ac,
-  0x1061, 0x1041, 0x1842, 0xa22e, 0xe354, 0xd2f2, 0x1041, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00e1, 0x06ca, 0x0487, 0x0406,
-  0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0040, 0x0426, 0x070b, 0x00e1, 0x0040,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xdcd6, 0xd332, 0x1041, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000,
-  0x0000, 0x0000, 0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xf556, 0xd332, 0x1021, 0x0000,
-  0x0000, 0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0821, 0xa26e, 0xed38, 0xd332, 0x1021, 0x0000,
-  0x0000, 0x0040, 0x0426, 0x070b, 0x0101, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0820, 0xa24e, 0xdc96, 0xd312, 0x1041, 0x0000,
-  0x0000, 0x00c1, 0x06eb, 0x0588, 0x0060, 0x0000, 0x0000, 0x0000,
-  0x1021, 0x1021, 0x1842, 0xa22d, 0xe354, 0xd2f2, 0x1041, 0x0000,
-  0x0040, 0x0426, 0x06eb, 0x0101, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd332, 0xd312, 0xa26e, 0xa20d, 0xdb13, 0xaa4e, 0x0821, 0x0000,
-  0x00c1, 0x06eb, 0x05e9, 0x00e1, 0x0060, 0x0060, 0x0060, 0x0080,
-  0xfd97, 0xfd97, 0xdcd6, 0xe374, 0xe333, 0xaa4e, 0x0821, 0x0040,
-  0x0426, 0x076b, 0x0528, 0x05c9, 0x05e9, 0x05e9, 0x05e9, 0x05e9,
-  0xc494, 0xc4b5, 0xc495, 0xc454, 0xd312, 0xba90, 0x1021, 0x0080,
-  0x064a, 0x072b, 0x06ca, 0x070b, 0x070b, 0x070b, 0x070b, 0x070b,
-  0x1062, 0x1062, 0x1062, 0x1062, 0x1041, 0x1041, 0x0000, 0x0000,
-  0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1, 0x00a1
-};
-
-const Animation ps_symbolsAnimation = {
-  .name = "Ps Symbols",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = ps_symbolsDurations,
-  .animationFrames = ps_symbolsFrames
-};
-#endif // ANIMATION_PS_SYMBOLS_H
@@ -1,1814 +0,0 @@
-// queen.h - Auto-generated from queen.json
-#ifndef ANIMATION_QUEEN_H
-#define ANIMATION_QUEEN_H
-
-#include "animation_types.h"
-
-// Frame Durations for queen (in 100ms units)
-static const uint8_t PROGMEM queenDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for queen
-static const uint16_t PROGMEM queenFrames[] = {
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x2903,
-  0x2903, 0x2903, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0xfd2f,
-  0xfd2f, 0x2903, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x5983,
-  0xfd2f, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x0000, 0x781a, 0xfd2f,
-  0xfd2f, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x0000, 0x781a, 0x781a, 0x781a,
-  0xfd2f, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x0000, 0x7bef, 0x781a, 0xfd2f, 0xffff,
-  0xfd2f, 0xffff, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x7bef, 0xfd2f, 0xffff,
-  0xffff, 0xffff, 0xfd2f, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0xfd2f, 0xfd2f, 0x7bef,
-  0xffff, 0xffff, 0x781a, 0xfd2f, 0xfd2f, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0xfd2f, 0x781a, 0xffff,
-  0x7bef, 0xffff, 0x781a, 0x781a, 0xfd2f, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0xffff,
-  0xffff, 0x7bef, 0x7bef, 0x781a, 0xfd2f, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x7d56,
-  0x7d56, 0x7d56, 0x781a, 0xfd2f, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x7d56, 0x7d56,
-  0x7d56, 0x7d56, 0x7d56, 0x781a, 0x7bef, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x781a, 0x7d56, 0x7d56, 0x781a,
-  0x781a, 0x781a, 0x7d56, 0x7d56, 0x781a, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x781a, 0x7d56, 0x7d56, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0x7d56, 0x7d56, 0x781a, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0xce38, 0xce38, 0xce38, 0x781a, 0x781a,
-  0x781a, 0x781a, 0x781a, 0xce38, 0xce38, 0xce38, 0x781a, 0x781a,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x1805, 0x5851, 0xd3ef,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5010, 0x1845, 0x5010, 0x6873, 0x8153,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5012, 0x1845, 0x62ad, 0x68f2, 0xe491, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb1, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x6092, 0x8b6f, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf510, 0xe46f, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xe4af, 0xe4af, 0x9cb2,
-  0xef7d, 0xef5e, 0x8153, 0xe44f, 0xe46f, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x8173, 0xde9c,
-  0xa534, 0xdebb, 0x68f4, 0x70b2, 0xe46f, 0x6893, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x6894, 0xe71d,
-  0xe73c, 0x8c71, 0x72f0, 0x7112, 0xd3f0, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7d36,
-  0x85b7, 0x74d5, 0x6973, 0xcb90, 0x7112, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74f5,
-  0x74d5, 0x74f6, 0x7495, 0x6973, 0x7290, 0x5853, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x60d3,
-  0x5873, 0x60d3, 0x7495, 0x7495, 0x6113, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x5813, 0x5813, 0x60d3, 0x7d16, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x781a, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x7837, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6815, 0x2007, 0x7056, 0xdbf0,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x6815, 0x2046, 0x6815, 0x8079, 0x9958,
-  0xf4d0, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7017, 0x2046, 0x62ae, 0x80f7, 0xe492, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb2, 0x88b7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7017, 0x7898, 0x8b70, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf511, 0xec70, 0x88d8, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xecb0, 0xecb0, 0x9cb2,
-  0xef7d, 0xf75f, 0x9158, 0xec50, 0xec70, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x9978, 0xde9c,
-  0xa533, 0xdebc, 0x80f9, 0x88b7, 0xec70, 0x8098, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x809a, 0xef1e,
-  0xe73c, 0x8c71, 0x7af1, 0x8917, 0xdbf1, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7859, 0x78f9, 0x8537,
-  0x85b6, 0x74d5, 0x8177, 0xd392, 0x8917, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7476, 0x7cb6, 0x74d6,
-  0x74d6, 0x74f6, 0x7496, 0x8177, 0x7a92, 0x7858, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7859, 0x7496, 0x7d36, 0x8238, 0x7899,
-  0x7879, 0x78d9, 0x7496, 0x7496, 0x7918, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x8516, 0xb518, 0x8099, 0x7819,
-  0x7819, 0x7819, 0x78d9, 0x7d16, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xbdb8, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd98, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x1805, 0x5851, 0xd3ef,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5010, 0x1845, 0x5010, 0x6873, 0x8153,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5012, 0x1845, 0x62ad, 0x68f2, 0xe491, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb1, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x6092, 0x8b6f, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf510, 0xe46f, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xe4af, 0xe4af, 0x9cb2,
-  0xef7d, 0xef5e, 0x8153, 0xe44f, 0xe46f, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x8173, 0xde9c,
-  0xa534, 0xdebb, 0x68f4, 0x70b2, 0xe46f, 0x6893, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x6894, 0xe71d,
-  0xe73c, 0x8c71, 0x72f0, 0x7112, 0xd3f0, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7d36,
-  0x85b7, 0x74d5, 0x6973, 0xcb90, 0x7112, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74f5,
-  0x74d5, 0x74f6, 0x7495, 0x6973, 0x7290, 0x5853, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x60d3,
-  0x5873, 0x60d3, 0x7495, 0x7495, 0x6113, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x5813, 0x5813, 0x60d3, 0x7d16, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x781a, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x7837, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6815, 0x2007, 0x7056, 0xdbf0,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x6815, 0x2046, 0x6815, 0x8079, 0x9958,
-  0xf4d0, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7017, 0x2046, 0x62ae, 0x80f7, 0xe492, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb2, 0x88b7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7017, 0x7898, 0x8b70, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf511, 0xec70, 0x88d8, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xecb0, 0xecb0, 0x9cb2,
-  0xef7d, 0xf75f, 0x9158, 0xec50, 0xec70, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x9978, 0xde9c,
-  0xa533, 0xdebc, 0x80f9, 0x88b7, 0xec70, 0x8098, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x809a, 0xef1e,
-  0xe73c, 0x8c71, 0x7af1, 0x8917, 0xdbf1, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x8537,
-  0x85b6, 0x74d5, 0x8177, 0xd392, 0x8917, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74f6,
-  0x74d6, 0x74f6, 0x7496, 0x8177, 0x7a92, 0x7858, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x78d9,
-  0x7879, 0x78d9, 0x7496, 0x7496, 0x7918, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7819, 0x7819, 0x78d9, 0x7d16, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd98, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x1805, 0x5851, 0xd3ef,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5010, 0x1845, 0x5010, 0x6873, 0x8153,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5012, 0x1845, 0x62ad, 0x68f2, 0xe491, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb1, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x6092, 0x8b6f, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf510, 0xe46f, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xe4af, 0xe4af, 0x9cb2,
-  0xef7d, 0xef5e, 0x8153, 0xe44f, 0xe46f, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x8173, 0xde9c,
-  0xa534, 0xdebb, 0x68f4, 0x70b2, 0xe46f, 0x6893, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x6894, 0xe71d,
-  0xe73c, 0x8c71, 0x72f0, 0x7112, 0xd3f0, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5853, 0x60f3, 0x7d36,
-  0x85b7, 0x74d5, 0x6973, 0xcb90, 0x7112, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7475, 0x74b6, 0x74d5,
-  0x74d5, 0x74f6, 0x7495, 0x6973, 0x7290, 0x5853, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5853, 0x7495, 0x7d36, 0x8237, 0x6094,
-  0x5873, 0x60d3, 0x7495, 0x7495, 0x6113, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x8516, 0xad17, 0x6894, 0x5813,
-  0x5813, 0x5813, 0x60d3, 0x7d16, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd37, 0xbdb7, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x781a, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x7837, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6815, 0x2007, 0x7056, 0xdbf0,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x6815, 0x2046, 0x6815, 0x8079, 0x9958,
-  0xf4d0, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7017, 0x2046, 0x62ae, 0x80f7, 0xe492, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb2, 0x88b7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7017, 0x7898, 0x8b70, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf511, 0xec70, 0x88d8, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xecb0, 0xecb0, 0x9cb2,
-  0xef7d, 0xf75f, 0x9158, 0xec50, 0xec70, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x9978, 0xde9c,
-  0xa533, 0xdebc, 0x80f9, 0x88b7, 0xec70, 0x8098, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x809a, 0xef1e,
-  0xe73c, 0x8c71, 0x7af1, 0x8917, 0xdbf1, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x8537,
-  0x85b6, 0x74d5, 0x8177, 0xd392, 0x8917, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74f6,
-  0x74d6, 0x74f6, 0x7496, 0x8177, 0x7a92, 0x7858, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x78d9,
-  0x7879, 0x78d9, 0x7496, 0x7496, 0x7918, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7819, 0x7819, 0x78d9, 0x7d16, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd98, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x1805, 0x5851, 0xd3ef,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5010, 0x1845, 0x5010, 0x6873, 0x8153,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5012, 0x1845, 0x62ad, 0x68f2, 0xe491, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb1, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x6092, 0x8b6f, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf510, 0xe46f, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xe4af, 0xe4af, 0x9cb2,
-  0xef7d, 0xef5e, 0x8153, 0xe44f, 0xe46f, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x8173, 0xde9c,
-  0xa534, 0xdebb, 0x68f4, 0x70b2, 0xe46f, 0x6893, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x6894, 0xe71d,
-  0xe73c, 0x8c71, 0x72f0, 0x7112, 0xd3f0, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7d36,
-  0x85b7, 0x74d5, 0x6973, 0xcb90, 0x7112, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74f5,
-  0x74d5, 0x74f6, 0x7495, 0x6973, 0x7290, 0x5853, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x60d3,
-  0x5873, 0x60d3, 0x7495, 0x7495, 0x6113, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x5813, 0x5813, 0x60d3, 0x7d16, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x781a, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x7837, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6815, 0x2007, 0x7056, 0xdbf0,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x6815, 0x2046, 0x6815, 0x8079, 0x9958,
-  0xf4d0, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7017, 0x2046, 0x62ae, 0x80f7, 0xe492, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb2, 0x88b7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7017, 0x7898, 0x8b70, 0xf550, 0xf77c,
-  0xffde, 0xffbe, 0xf511, 0xec70, 0x88d8, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xecb0, 0xecb0, 0x9cb2,
-  0xef7d, 0xf75f, 0x9158, 0xec50, 0xec70, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x9978, 0xde9c,
-  0xa533, 0xdebc, 0x80f9, 0x88b7, 0xec70, 0x8098, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x809a, 0xef1e,
-  0xe73c, 0x8c71, 0x7af1, 0x8917, 0xdbf1, 0x8078, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7859, 0x78f9, 0x8537,
-  0x85b6, 0x74d5, 0x8177, 0xd392, 0x8917, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7476, 0x7cb6, 0x74d6,
-  0x74d6, 0x74f6, 0x7496, 0x8177, 0x7a92, 0x7858, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7859, 0x7496, 0x7d36, 0x8238, 0x7899,
-  0x7879, 0x78d9, 0x7496, 0x7496, 0x7918, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x8516, 0xb518, 0x8099, 0x7819,
-  0x7819, 0x7819, 0x78d9, 0x7d16, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xbdb8, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd98, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x1805, 0x5851, 0xd3ef,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5010, 0x1845, 0x5010, 0x6873, 0x8153,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5012, 0x1845, 0x62ad, 0x68f2, 0xe491, 0xf6dc,
-  0xfdb3, 0xff3b, 0xecb1, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x6092, 0x8b6f, 0xf550, 0xffde,
-  0xffde, 0xff9e, 0xf510, 0xe44f, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xe48f, 0xf4f0, 0xef5c,
-  0xffff, 0xef3e, 0x7953, 0xf4af, 0xdc10, 0x6873, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x7912, 0x9452,
-  0xef7d, 0xef1d, 0x8173, 0xdbf0, 0x70d2, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x6894, 0xd67b,
-  0x94b2, 0xe510, 0xdc10, 0x70b2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7d36,
-  0x7d35, 0x83f0, 0x68f2, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74f5,
-  0x74d6, 0x74b5, 0x7370, 0x6092, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x60d3,
-  0x5873, 0x60d3, 0x7474, 0x7390, 0x60b3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x5813, 0x5813, 0x60d3, 0x7cf5, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x781a, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x7837, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6815, 0x2007, 0x7056, 0xdbf0,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x6815, 0x2046, 0x6815, 0x8079, 0x9958,
-  0xf4d0, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7017, 0x2046, 0x62ae, 0x80f7, 0xe492, 0xf6fc,
-  0xfdb3, 0xff3b, 0xecb2, 0x88b7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7017, 0x7898, 0x8b70, 0xf550, 0xff9c,
-  0xffde, 0xffbe, 0xfd70, 0xec70, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xecb0, 0xf4cf, 0xf551,
-  0xff9d, 0xff7c, 0xfd70, 0xec70, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8917, 0x93f1,
-  0xed30, 0xfd91, 0xec71, 0x88b8, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x809a, 0xd67b,
-  0x94b1, 0xde7b, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x8537,
-  0x7555, 0x8412, 0x7898, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74f6,
-  0x74d6, 0x74b5, 0x7b91, 0x7898, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x78d9,
-  0x7879, 0x78d9, 0x7c75, 0x7b91, 0x78b8, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7819, 0x7819, 0x78d9, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd98, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5851, 0xd3ee,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5010, 0x2065, 0x7952,
-  0xf4cf, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x20a4, 0xd48e, 0xeefc,
-  0xfdb3, 0xff5b, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6013, 0x6051, 0x1825, 0x6aed, 0xed30, 0xff9d,
-  0xffbe, 0xff7d, 0xfd70, 0xdc10, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x70f1, 0x6912, 0x93ef, 0xed51,
-  0xff5b, 0xfd71, 0xe46f, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xe450, 0xe470, 0xe450, 0xdc6f, 0x940f,
-  0xf571, 0xf4f1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x6873, 0x6892, 0x83f1,
-  0xef3b, 0xe6fc, 0x6094, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x58b3, 0x74d5,
-  0x84b2, 0x7cf5, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74f6,
-  0x7494, 0x7c30, 0x7475, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x60d3,
-  0x6093, 0x7370, 0x7d35, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x5813, 0x6092, 0x7370, 0x7d55, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x5813, 0x5813, 0x68b3, 0xbd97, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8079, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x6015, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe411, 0x88f6, 0x28a5, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe451, 0xec70, 0xd42e, 0x8bf1, 0xe6da,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x8079, 0x7898, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7898, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x6873, 0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x6873, 0xcb90, 0x78f2, 0x6893, 0x70d2, 0xe470, 0xcc0d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x70b2, 0xdbf0, 0xe470, 0xf4cf, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0x78d3, 0xd40e, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x5031, 0x7b91, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x8078, 0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xd392, 0x90f7, 0x8098, 0x88d8, 0xec71, 0xcc0d, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x88b8, 0xdbf1, 0xec70, 0xf4d0, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0x90d8, 0xd40f, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7036, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xbb8d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x4810, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x70f1, 0x20a4, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xe450, 0xe46f, 0xd42e, 0x8bf0, 0xe6da,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x6873, 0x6092, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6093, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8079, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x6015, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe411, 0x88f6, 0x28a5, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe451, 0xec70, 0xd42e, 0x8bf1, 0xe6da,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x8079, 0x7898, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7898, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x6873, 0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x6873, 0xcb90, 0x78f2, 0x6893, 0x70d2, 0xe470, 0xcc0d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x70b2, 0xdbf0, 0xe470, 0xf4cf, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0x78d3, 0xd40e, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x5031, 0x7b91, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x8078, 0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xd392, 0x90f7, 0x8098, 0x88d8, 0xec71, 0xcc0d, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x88b8, 0xdbf1, 0xec70, 0xf4d0, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0x90d8, 0xd40f, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7036, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xbb8d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x4810, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x70f1, 0x20a4, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xe450, 0xe46f, 0xd42e, 0x8bf0, 0xe6da,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x6873, 0x6092, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6093, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8079, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x6015, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe411, 0x88f6, 0x28a5, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe451, 0xec70, 0xd42e, 0x8bf1, 0xe6da,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x8079, 0x7898, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7898, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x6873, 0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x6873, 0xcb90, 0x78f2, 0x6893, 0x70d2, 0xe470, 0xcc0d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x70b2, 0xdbf0, 0xe470, 0xf4cf, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0x78d3, 0xd40e, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0x5031, 0x7b91, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x8078, 0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xd392, 0x90f7, 0x8098, 0x88d8, 0xec71, 0xcc0d, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x88b8, 0xdbf1, 0xec70, 0xf4d0, 0xd44c, 0x3985, 0xd679,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0x90d8, 0xd40f, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7036, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0xbb8d, 0x3945,
-  0xe510, 0xff5c, 0xe4b1, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x4810, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xdbf0, 0x6873, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x70f1, 0x20a4, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x70d2, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xe450, 0xe46f, 0xd42e, 0x8bf0, 0xe6da,
-  0xfdd3, 0xfd91, 0xe470, 0x6053, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x6873, 0x6873, 0x6092, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6093, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8079, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xecb2, 0x88d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x6015, 0x3125, 0xd699,
-  0xffbe, 0xffbe, 0xfd50, 0xe3f1, 0x8078, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe411, 0x88f6, 0x28a5, 0x736c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x90d7, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xe451, 0xec70, 0xd42e, 0x8bf1, 0xe6da,
-  0xfdd3, 0xfd91, 0xec71, 0x8058, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x8078, 0x8079, 0x7898, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7898, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8078, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xe450, 0x8079, 0x7018, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec70, 0x88d8, 0x8059, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec50, 0xec70, 0x88d8, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x88b8, 0xec71, 0xcbed, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x6874, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x2026, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7056, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x5813, 0x5813, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x6873, 0x70b3, 0xbb8d, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdbf0, 0x8132, 0xbb8d, 0x3985, 0xd679,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70b3, 0xcbaf, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0x5031, 0x7b91, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xdc11, 0x8078, 0x88b8, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xdbf1, 0x9937, 0xc38e, 0x3985, 0xd679,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x88b8, 0xcbb0, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x7036, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8078, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xe450, 0x8079, 0x7018, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec70, 0x88d8, 0x8059, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec50, 0xec70, 0x88d8, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x88b8, 0xec71, 0xcbed, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x6874, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x2026, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7056, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6052, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5832, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0x5813, 0x5813, 0x6873, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdc10, 0x6873, 0x70b3, 0xbb8d, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6873, 0xdbf0, 0x8132, 0xbb8d, 0x3985, 0xd679,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70b3, 0xcbaf, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6873, 0x5031, 0x7b91, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7838, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0x7819, 0x7819, 0x8078, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xdc11, 0x8078, 0x88b8, 0xc38e, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8078, 0xdbf1, 0x9937, 0xc38e, 0x3985, 0xd679,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x88b8, 0xcbb0, 0x3104, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8078, 0x7036, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8078, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xe450, 0x8079, 0x7018, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec70, 0x88d8, 0x8059, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec50, 0xec70, 0x88d8, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x88b8, 0xec71, 0xcbed, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x6874, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x2026, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7056, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8078, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xe450, 0x8079, 0x7018, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec70, 0x88d8, 0x8059, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec50, 0xec70, 0x88d8, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x88b8, 0xec71, 0xcbed, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x6874, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x2026, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7056, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7017,
-  0x7017, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x8058, 0x7819, 0x7038, 0x4928,
-  0x4145, 0x38c6, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xdbf1, 0x8078, 0x8058, 0xd42e,
-  0xdc8c, 0x5186, 0x7017, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xe450, 0x8079, 0x7018, 0x8248,
-  0xf4ee, 0xe46f, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec70, 0x88d8, 0x8059, 0xdc10,
-  0xfd2f, 0xf4b0, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x8078, 0xec50, 0xec70, 0x88d8, 0x80b6,
-  0xf4af, 0xf4f1, 0x88d8, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x88b8, 0xec71, 0xcbed, 0x3946,
-  0xe510, 0xff5c, 0xec92, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x6874, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7017, 0x2026, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f1, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7056, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xec71, 0x8078, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7878, 0x8c12,
-  0xef5c, 0xeefd, 0x88f9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78b8, 0x7bd0,
-  0x8575, 0x8537, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x7819, 0x78d9, 0x7496, 0x74b5,
-  0x7c10, 0x74b5, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x78b9, 0x7496, 0x7496, 0x7918,
-  0x7af1, 0x7957, 0x7496, 0x7496, 0x78d9, 0x7819, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x80f9, 0x7cb6, 0x7d16, 0x78d9, 0x7819,
-  0x7898, 0x7af1, 0x7918, 0x7cf6, 0x7cb6, 0x80f9, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xbd38, 0xc638, 0xbd98, 0x8079, 0x7819,
-  0x7858, 0x7b30, 0x80d8, 0xbd78, 0xc638, 0xbd38, 0x8079, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5012,
-  0x5011, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x6853, 0x5813, 0x5832, 0x4127,
-  0x4145, 0x30c5, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xdbf0, 0x6873, 0x6053, 0xd42d,
-  0xdc8d, 0x4986, 0x5812, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe450, 0x6873, 0x5812, 0x8247,
-  0xf4ee, 0xe46f, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe46f, 0x70d2, 0x6053, 0xdc0f,
-  0xfd2f, 0xf4af, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x6873, 0xe44f, 0xec6f, 0x70d2, 0x68b1,
-  0xf4af, 0xf4f0, 0x70d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x70b2, 0xe470, 0xcbed, 0x3945,
-  0xe510, 0xff5c, 0xe491, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5870, 0x3125, 0xd699,
-  0xffbe, 0xffde, 0xf4f1, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5012, 0x1825, 0x734c, 0xf5b3,
-  0xff9d, 0xff7c, 0xf4f0, 0x6872, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5051, 0x8391, 0xeefa,
-  0xfdd3, 0xfd91, 0xe470, 0x6873, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x6072, 0x8c11,
-  0xef5c, 0xe6fc, 0x70f4, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7bd0,
-  0x8576, 0x7d36, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x5813, 0x60d3, 0x7495, 0x74b4,
-  0x7c10, 0x74b5, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x60b3, 0x7495, 0x7495, 0x6113,
-  0x72f0, 0x6153, 0x7495, 0x7495, 0x60d3, 0x5813, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x68f4, 0x7cb6, 0x7d16, 0x60d3, 0x5813,
-  0x6092, 0x72f0, 0x6113, 0x7cf6, 0x7cb6, 0x68f4, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xb537, 0xc638, 0xbd97, 0x6073, 0x5813,
-  0x6053, 0x732f, 0x60d3, 0xbd77, 0xc638, 0xb537, 0x6073, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88d8, 0xccd1, 0xd551, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x2906, 0x2103, 0x20c2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x80b9, 0xdebd, 0xd6da, 0x2944, 0xbc6e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8099, 0xf69c, 0xff1b, 0xc4cf, 0xcccf, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8017, 0xe8e5, 0xf164, 0xd4ae, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xcbef, 0xd46d, 0xcccf, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70d3, 0xccd1, 0xd551, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5012, 0x2905, 0x2103, 0x20c2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x68b4, 0xdebc, 0xd6da, 0x2944, 0xbc6e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6894, 0xf69c, 0xff1b, 0xc4cf, 0xcccf, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6812, 0xe8e5, 0xf164, 0xd4ae, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6072, 0xc3ee, 0xd46e, 0xcccf, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70d3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5012, 0x2905, 0x2081, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x68b4, 0xdd57, 0xd061, 0x2881, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6832, 0xe8e5, 0xf0c2, 0xc42d, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc40e, 0xd4ae, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xcd0f, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88d8, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x2906, 0x2081, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x80b9, 0xdd57, 0xd061, 0x2881, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8037, 0xe8e5, 0xf0c2, 0xc42d, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xcc0f, 0xd4ae, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd51, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x3164, 0x20e3, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xd4f3, 0xedd3, 0xdd51, 0xd551, 0xdd51, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xedd3, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xedf3, 0xedb2, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813,
-  0x7819, 0x7819, 0x7819, 0x7819, 0x6015, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0801, 0x6015, 0x7017, 0x7819, 0x7819,
-  0x7819, 0x7819, 0x7819, 0x7018, 0x2065, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0802, 0x1004, 0x7017, 0x781a,
-  0x7819, 0x7819, 0x7819, 0x88d8, 0xd4f1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x7819, 0x7819, 0x8079, 0xdcf4, 0xedf3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1003, 0x7017,
-  0x7819, 0x7819, 0x88f8, 0xed73, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x8059, 0xdcf3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x7819, 0x88f8, 0xd512, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xdcf4, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0802, 0x7017,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0802, 0x7017,
-  0x88f8, 0xccd2, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x1004, 0x7017,
-  0x7017, 0x3043, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0801, 0x6815, 0x7819,
-  0x8017, 0xd843, 0xc841, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x1003, 0x7017, 0x781a,
-  0x8078, 0xcc0f, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x1003, 0x6816, 0x7819, 0x7819,
-  0x8078, 0xc490, 0xcd0f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x7057, 0x7819, 0x7819, 0x7819,
-  0x8078, 0xc470, 0xccef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd550, 0xbc50, 0x8079, 0x7819, 0x7819, 0x7819,
-  0x5813, 0x5813, 0x5813, 0x5813, 0x4810, 0x0001, 0x1061, 0x1081,
-  0x1061, 0x0000, 0x0000, 0x0001, 0x4810, 0x5812, 0x5813, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x5012, 0x1864, 0x20c2, 0xc4f0, 0xdd71,
-  0xccf0, 0x1061, 0x0000, 0x0000, 0x0801, 0x0803, 0x5812, 0x5813,
-  0x5813, 0x5813, 0x5813, 0x70d3, 0xccf1, 0xdd71, 0xedd3, 0xf5f3,
-  0xcd10, 0x1061, 0x0000, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x5813, 0x5813, 0x6073, 0xd4f3, 0xf5f3, 0xedd3, 0xedd3, 0xdd71,
-  0x20c2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5813, 0x5813, 0x70f3, 0xe573, 0xf5f3, 0xedd3, 0xedf3, 0xdd51,
-  0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x5011,
-  0x5813, 0x6053, 0xd4f3, 0xdd71, 0xd531, 0xd551, 0xedd3, 0xdd71,
-  0x20e2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x5813, 0x70f3, 0xd511, 0x20e2, 0x20e2, 0x3144, 0xdd71, 0xf5f3,
-  0xccf0, 0x1061, 0x1061, 0x1061, 0x0000, 0x0000, 0x0801, 0x5011,
-  0x70f3, 0xdcf3, 0xdd51, 0x3124, 0xc4cf, 0xdd71, 0xedb3, 0xf5f3,
-  0xdd71, 0x3144, 0xccf0, 0xccf0, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xdd71, 0xedd3, 0xedd3, 0xedb2, 0xedb2,
-  0xedb2, 0xdd71, 0xf5f3, 0xe572, 0x1061, 0x0000, 0x0801, 0x5011,
-  0xe573, 0xedd3, 0xedd3, 0xf5f3, 0xedb3, 0xd510, 0xd4ef, 0xd510,
-  0xedb2, 0xedd3, 0xdd71, 0xccf0, 0x1061, 0x0000, 0x0001, 0x5011,
-  0x70f3, 0xccd1, 0xd571, 0xdd51, 0xe592, 0xccf0, 0xcccf, 0xd4ef,
-  0xedd3, 0xdd71, 0x20e3, 0x1061, 0x0000, 0x0000, 0x0803, 0x5011,
-  0x5011, 0x2843, 0x2061, 0x20a2, 0xc48e, 0xd4ef, 0xccef, 0xd4ef,
-  0xedd3, 0xdd51, 0x0841, 0x0000, 0x0000, 0x0001, 0x5010, 0x5813,
-  0x6811, 0xd042, 0xd041, 0x28a2, 0xbc8e, 0xd4ef, 0xccef, 0xccef,
-  0xedd2, 0xdd71, 0x20c2, 0x0000, 0x0000, 0x0802, 0x5812, 0x5813,
-  0x6873, 0xcc0e, 0xd48e, 0xc48e, 0xccef, 0xd4ef, 0xccaf, 0xbc4d,
-  0xedb2, 0xedd3, 0xbc8e, 0x18a2, 0x0802, 0x5010, 0x5813, 0x5813,
-  0x6073, 0xc490, 0xd50f, 0xd4ef, 0xccef, 0xccae, 0xbc4d, 0xe592,
-  0xedd3, 0xedd3, 0xdd51, 0xac0e, 0x5851, 0x5813, 0x5813, 0x5813,
-  0x6073, 0xc470, 0xd4ef, 0xccef, 0xcccf, 0xa3ab, 0xdd71, 0xedd3,
-  0xedd3, 0xedb3, 0xd551, 0xbc4f, 0x6073, 0x5813, 0x5813, 0x5813
-};
-
-const Animation queenAnimation = {
-  .name = "Queen",
-  .frameCount = 56,
-  .width = 16,
-  .height = 16,
-  .frameDurations = queenDurations,
-  .animationFrames = queenFrames
-};
-#endif // ANIMATION_QUEEN_H
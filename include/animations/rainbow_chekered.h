@@ -1,470 +0,0 @@
-// rainbow_chekered.h - Auto-generated from rainbow_chekered.json
-#ifndef ANIMATION_RAINBOW_CHEKERED_H
-#define ANIMATION_RAINBOW_CHEKERED_H
-
-#include "animation_types.h"
-
-// Frame Durations for rainbow_chekered (in 100ms units)
-static const uint8_t PROGMEM rainbow_chekeredDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for rainbow_chekered
-static const uint16_t PROGMEM rainbow_chekeredFrames[] = {
-  0xf000, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0xfd40, 0x0000, 0xafe0, 0x0000, 0x07f5, 0x0000,
-  0x055f, 0x0000, 0xa81f, 0x0000, 0xf80a, 0x0000, 0xf940, 0x0000,
-  0x0000, 0xfaa0, 0x0000, 0xffe0, 0x0000, 0x07e0, 0x0000, 0x07ff,
-  0x0000, 0x02bf, 0x0000, 0xf81f, 0x0000, 0xfa20, 0x0000, 0xfaa0,
-  0xca20, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x05e0, 0x01e4,
-  0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817, 0x3823, 0xb980, 0x2840,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265,
-  0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x3860, 0xb000, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e,
-  0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xb8e0,
-  0xb9e0, 0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a60, 0x0560, 0x0265,
-  0x0596, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb160, 0x3860,
-  0x2820, 0xb800, 0x38a0, 0xbbe0, 0x31a0, 0x85e0, 0x09e1, 0x05ef,
-  0x01a6, 0x03f7, 0x08a7, 0x7817, 0x3006, 0xb807, 0x3840, 0xc900,
-  0xc900, 0x3840, 0xb800, 0x38a0, 0xbbe0, 0x39c0, 0x85e0, 0x09e1,
-  0x05ef, 0x01c7, 0x03f7, 0x08a7, 0x7817, 0x3806, 0xb807, 0x2821,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a60, 0x0560,
-  0x0265, 0x0596, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3860,
-  0x3860, 0xb1c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560,
-  0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xb980,
-  0xb900, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41,
-  0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x3840,
-  0x2840, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x05e0,
-  0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817, 0x3823, 0xc9c0,
-  0xc9c0, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0,
-  0x05e0, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817, 0x2803,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60,
-  0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x3860, 0xb0e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580,
-  0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4007, 0xb808,
-  0xb980, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a60,
-  0x0560, 0x0265, 0x0596, 0x0189, 0x01d5, 0x2829, 0xb015, 0x3804,
-  0x2840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xbbe0, 0x31a0, 0x85e0,
-  0x09e1, 0x05ef, 0x01a6, 0x03f7, 0x08a7, 0x7817, 0x3006, 0xc808,
-  0xc808, 0x3840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xbbe0, 0x39c0,
-  0x85e0, 0x09e1, 0x05ef, 0x01c7, 0x03f7, 0x08a7, 0x7817, 0x2005,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb580,
-  0x2a60, 0x0560, 0x0265, 0x0596, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x3821, 0xb160, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560,
-  0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb817,
-  0xb807, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220,
-  0x7580, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x3807,
-  0x2821, 0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0,
-  0x21e0, 0x05e0, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xd019,
-  0xc819, 0x3823, 0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940,
-  0xbde0, 0x21e0, 0x05e0, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x1045,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d6, 0x1827,
-  0x3806, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0,
-  0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7817,
-  0xb817, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980,
-  0xb580, 0x2a60, 0x0560, 0x0265, 0x0596, 0x0189, 0x01d6, 0x1827,
-  0x2803, 0xb808, 0x3840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xbbe0,
-  0x31a0, 0x85e0, 0x09e1, 0x05ef, 0x01a6, 0x03f7, 0x08a7, 0x8819,
-  0x881a, 0x3006, 0xb807, 0x3840, 0xb900, 0x3840, 0xb800, 0x38a0,
-  0xbbe0, 0x39c0, 0x85e0, 0x09e1, 0x05ef, 0x01c7, 0x03f7, 0x00a5,
-  0x3007, 0xa816, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb580, 0x2a60, 0x0560, 0x0265, 0x0596, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x3007, 0xa815, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0,
-  0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0189, 0x01f7,
-  0x7817, 0x4007, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0,
-  0xb3a0, 0x4220, 0x7580, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x00c7,
-  0x2005, 0xb817, 0x3823, 0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0,
-  0x3940, 0xbde0, 0x21e0, 0x05e0, 0x01e4, 0x05f7, 0x0147, 0x0239,
-  0x0239, 0x2027, 0xb817, 0x3823, 0xb980, 0x3880, 0xb9e0, 0x3860,
-  0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x05e0, 0x01e4, 0x05f7, 0x0125,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0867, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800,
-  0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03f7,
-  0x01f7, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860,
-  0xa9c0, 0x4980, 0xb580, 0x2a60, 0x0560, 0x0265, 0x0576, 0x0187,
-  0x0845, 0x7817, 0x3006, 0xb807, 0x3840, 0xb900, 0x3840, 0xb800,
-  0x38a0, 0xbbe0, 0x31a0, 0x85e0, 0x09e1, 0x05ef, 0x01a6, 0x0459,
-  0x0459, 0x08a7, 0x7817, 0x3806, 0xb807, 0x3840, 0xb900, 0x3840,
-  0xb800, 0x38a0, 0xbbe0, 0x39c0, 0x85e0, 0x09e1, 0x05ef, 0x0164,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a61, 0x058e, 0x01e7,
-  0x0107, 0x01f6, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0,
-  0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0560, 0x0245, 0x05f7,
-  0x03f7, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880,
-  0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x058e, 0x01e7,
-  0x00a5, 0x0217, 0x2027, 0xb817, 0x3823, 0xb980, 0x3880, 0xb9e0,
-  0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x05e0, 0x01e4, 0x067a,
-  0x0679, 0x0147, 0x01f7, 0x2027, 0xb817, 0x3823, 0xb980, 0x3880,
-  0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x05e0, 0x0162,
-  0x01a7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a60, 0x0580, 0x01e3,
-  0x01c7, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860, 0xa8e0,
-  0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x0a41, 0x05ef,
-  0x05f7, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960, 0x4880,
-  0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a60, 0x0580, 0x01e3,
-  0x0125, 0x0417, 0x08a7, 0x7817, 0x3006, 0xb807, 0x3840, 0xb900,
-  0x3840, 0xb800, 0x38a0, 0xbbe0, 0x31a0, 0x85e0, 0x09e1, 0x0671,
-  0x0671, 0x01c6, 0x03f7, 0x08a7, 0x7817, 0x3806, 0xb807, 0x3840,
-  0xb900, 0x3840, 0xb800, 0x38a0, 0xbbe0, 0x39c0, 0x7de0, 0x1160,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb580, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x01e6, 0x0595, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824, 0xa960,
-  0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xb560, 0x2a40, 0x05e0,
-  0x05ef, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007, 0x4860,
-  0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x7580, 0x09e0,
-  0x0164, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817, 0x3823, 0xb980,
-  0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x21e0, 0x0660,
-  0x0660, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817, 0x3823,
-  0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xbde0, 0x2160,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x01e1, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008, 0xb007,
-  0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x4220, 0x85e0,
-  0x05e0, 0x0245, 0x0596, 0x0189, 0x01d5, 0x2829, 0xb015, 0x4824,
-  0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xad80, 0x31e0,
-  0x0161, 0x05ef, 0x01a6, 0x03f7, 0x08a7, 0x7817, 0x3006, 0xb807,
-  0x3840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xbbe0, 0x31a0, 0x8e60,
-  0x8e60, 0x09e1, 0x05ef, 0x01c7, 0x03f7, 0x08a7, 0x7817, 0x3806,
-  0xb807, 0x3840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xbc00, 0x2920,
-  0x19e0, 0x0580, 0x0265, 0x0596, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39c0,
-  0x19e0, 0x0580, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829, 0xb015,
-  0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xa9c0, 0x4980, 0xbde0,
-  0x7de0, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016, 0x4008,
-  0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xb3a0, 0x39a0,
-  0x0960, 0x05e0, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027, 0xb817,
-  0x3823, 0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x3940, 0xce60,
-  0xd660, 0x21e0, 0x05e0, 0x01e4, 0x05f7, 0x0147, 0x01f7, 0x2027,
-  0xb817, 0x3823, 0xb980, 0x3880, 0xb9e0, 0x3860, 0xb9e0, 0x28c0,
-  0x39e0, 0x7580, 0x0a41, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7580, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbde0, 0x2a40, 0x0560, 0x0265, 0x0576, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3920,
-  0x39e0, 0x7560, 0x0a61, 0x058e, 0x0228, 0x03b6, 0x08c9, 0x7016,
-  0x4008, 0xb007, 0x4860, 0xa8e0, 0x4880, 0xa800, 0x48c0, 0xbbe0,
-  0xbd60, 0x2a40, 0x0560, 0x0265, 0x0596, 0x0189, 0x01d5, 0x2829,
-  0xb015, 0x4824, 0xa960, 0x4880, 0xa9c0, 0x4860, 0xb1c0, 0x3900,
-  0x2140, 0x85e0, 0x09e1, 0x05ef, 0x01a6, 0x03f7, 0x08a7, 0x7817,
-  0x3006, 0xb807, 0x3840, 0xb900, 0x3840, 0xb800, 0x38a0, 0xcc40
-};
-
-const Animation rainbow_chekeredAnimation = {
-  .name = "Rainbow Chekered",
-  .frameCount = 14,
-  .width = 16,
-  .height = 16,
-  .frameDurations = rainbow_chekeredDurations,
-  .animationFrames = rainbow_chekeredFrames
-};
-#endif // ANIMATION_RAINBOW_CHEKERED_H
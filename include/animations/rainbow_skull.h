@@ -1,342 +0,0 @@
-// rainbow_skull.h - Auto-generated from rainbow_skull.json
-#ifndef ANIMATION_RAINBOW_SKULL_H
-#define ANIMATION_RAINBOW_SKULL_H
-
-#include "animation_types.h"
-
-// Frame Durations for rainbow_skull (in 100ms units)
-static const uint8_t PROGMEM rainbow_skullDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for rainbow_skull
-static const uint16_t PROGMEM rainbow_skullFrames[] = {
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0x0000, 0x0000, 0xf81f, 0xa81f, 0x02bf, 0x055f,
-  0x07ff, 0x07e0, 0xffe0, 0xfd40, 0x0000, 0x0000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0x0000, 0xf81f, 0xa81f, 0x02bf, 0x055f, 0x07ff,
-  0x07e0, 0xffe0, 0xfd40, 0xfaa0, 0xf800, 0x0000, 0xf800, 0xf800,
-  0xf800, 0x0000, 0xf81f, 0xa81f, 0x02bf, 0x055f, 0x07ff, 0x07e0,
-  0xffe0, 0xfd40, 0xfaa0, 0xf800, 0xf81f, 0xa81f, 0x0000, 0xf800,
-  0xf800, 0x0000, 0xa81f, 0x0000, 0x0000, 0x0000, 0x07e0, 0xffe0,
-  0xfd40, 0xfaa0, 0x0000, 0x0000, 0x0000, 0x02bf, 0x0000, 0xf800,
-  0x0000, 0xa81f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfd40,
-  0xfaa0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07ff, 0x0000,
-  0x0000, 0x02bf, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xfaa0,
-  0xf800, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x07e0, 0x0000,
-  0x0000, 0x055f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xf800,
-  0xf81f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0x0000,
-  0x0000, 0x07ff, 0x07e0, 0x0000, 0x0000, 0x0000, 0xf800, 0xf81f,
-  0xa81f, 0x02bf, 0x0000, 0x0000, 0x0000, 0xffe0, 0xfd40, 0x0000,
-  0xf800, 0x0000, 0xffe0, 0xfd40, 0xfaa0, 0xf800, 0xf81f, 0x0000,
-  0x0000, 0x055f, 0x07ff, 0x07e0, 0xffe0, 0xfd40, 0x0000, 0xf800,
-  0xf800, 0xf800, 0x0000, 0xfaa0, 0xf800, 0xf81f, 0xa81f, 0x0000,
-  0x0000, 0x07ff, 0x07e0, 0xffe0, 0xfd40, 0x0000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x0000, 0xf81f, 0xa81f, 0x02bf, 0x055f,
-  0x07ff, 0x07e0, 0xffe0, 0xfd40, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x0000, 0xa81f, 0x02bf, 0x0000, 0x07ff,
-  0x07e0, 0x0000, 0xfd40, 0xfaa0, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0x0000, 0x02bf, 0x055f, 0x0000, 0x07e0,
-  0xffe0, 0x0000, 0xfaa0, 0xf800, 0x0000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0, 0xe260, 0xe240, 0xe240, 0xe240,
-  0xe240, 0xe240, 0xe240, 0xe260, 0xfaa0, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfaa0, 0xfa80, 0xea60, 0xd240, 0x3062, 0x1862, 0x10a2, 0x10c2,
-  0x10e0, 0x28e0, 0x28a0, 0x38a0, 0xd240, 0xea60, 0xfa80, 0xfaa0,
-  0xfaa0, 0xea60, 0x2060, 0x2824, 0x705a, 0x0a9d, 0x051d, 0x0718,
-  0x2742, 0xd6e0, 0xe4a0, 0xd220, 0x3042, 0x2040, 0xea60, 0xfaa0,
-  0xfaa0, 0xd240, 0x2824, 0x705b, 0x1abf, 0x055f, 0x079b, 0x27e4,
-  0xdf80, 0xfd60, 0xfaa0, 0xf865, 0xc819, 0x2044, 0xd240, 0xfaa0,
-  0xea60, 0x3061, 0x705a, 0x1a3d, 0x04bd, 0x06fa, 0x27e4, 0xdf80,
-  0xfd40, 0xfa80, 0xe842, 0xe018, 0x985d, 0x0a5b, 0x2082, 0xea60,
-  0xd220, 0x1084, 0x09d9, 0x0065, 0x0062, 0x1122, 0xc680, 0xfd40,
-  0xfa80, 0xd040, 0x2000, 0x1002, 0x0864, 0x03f8, 0x0922, 0xd220,
-  0x1062, 0x0238, 0x0064, 0x0000, 0x0000, 0x0000, 0x20c0, 0xea40,
-  0xe862, 0x2000, 0x0000, 0x0000, 0x0000, 0x0102, 0x1600, 0x10e0,
-  0x0083, 0x047a, 0x0062, 0x0000, 0x0000, 0x0000, 0x0800, 0xe824,
-  0xe018, 0x1002, 0x0000, 0x0000, 0x0000, 0x1080, 0xc660, 0x10c0,
-  0x00a2, 0x0697, 0x1142, 0x0000, 0x0000, 0x0000, 0x2004, 0xd81b,
-  0x985e, 0x0844, 0x0000, 0x0000, 0x0000, 0x28c0, 0xd460, 0x1080,
-  0x10c0, 0x1682, 0xc6a0, 0x28c0, 0x1000, 0x2004, 0xc81a, 0x983d,
-  0x125d, 0x049b, 0x0102, 0x10a0, 0x20c0, 0xdc20, 0xd280, 0x2060,
-  0xd220, 0x3940, 0xd480, 0xea40, 0xe824, 0xe01b, 0x983d, 0x1004,
-  0x00a4, 0x0718, 0x2742, 0xd6e0, 0xeca0, 0xd280, 0x48a0, 0xd220,
-  0xfaa0, 0xda20, 0x40a0, 0xd842, 0xf01a, 0x987f, 0x125d, 0x00c4,
-  0x0120, 0x2762, 0xdfa0, 0xfd40, 0xdaa0, 0x40a0, 0xd220, 0xfaa0,
-  0xfaa0, 0xfaa0, 0xd220, 0x3022, 0x805d, 0x1a9f, 0x04bd, 0x0718,
-  0x2742, 0xc700, 0xfd20, 0xe280, 0x3080, 0xd220, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xea60, 0x1042, 0x0abd, 0x04bd, 0x0164, 0x2f62,
-  0xc740, 0x3960, 0xea20, 0xe842, 0x2020, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xea60, 0x28c2, 0x047a, 0x063a, 0x1102, 0xc640,
-  0xd4c0, 0x2040, 0xd022, 0xd015, 0x3862, 0xe260, 0xfaa0, 0xfaa0,
-  0xfa80, 0xfaa0, 0xfaa0, 0xd240, 0x10a2, 0x00a2, 0x0020, 0x1080,
-  0x1060, 0x0000, 0x1000, 0x2022, 0xd220, 0xfaa0, 0xfaa0, 0xfaa0,
-  0xfd20, 0xfd40, 0xfd40, 0xfd40, 0xecc0, 0xe4a0, 0xe4a0, 0xe4a0,
-  0xe4a0, 0xe4a0, 0xe4c0, 0xe4c0, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xfd20, 0xfd20, 0xece0, 0xd460, 0x2102, 0x10c2, 0x1102, 0x1100,
-  0x2920, 0x28e0, 0x28a0, 0x38c0, 0xd460, 0xece0, 0xfd20, 0xfd40,
-  0xfd40, 0xece0, 0x20c0, 0x10a4, 0x029a, 0x04fd, 0x0718, 0x2722,
-  0xd6c0, 0xe480, 0xe220, 0xd022, 0x2842, 0x20a0, 0xece0, 0xfd40,
-  0xfd40, 0xd460, 0x10a4, 0x029b, 0x055f, 0x07bb, 0x27e4, 0xdf80,
-  0xfd60, 0xfaa0, 0xf864, 0xf01b, 0x803b, 0x18a4, 0xd460, 0xfd40,
-  0xecc0, 0x28e1, 0x029a, 0x04bd, 0x06fa, 0x1744, 0xdf80, 0xfd40,
-  0xfa80, 0xf844, 0xe018, 0x983d, 0x1a5d, 0x049b, 0x2122, 0xecc0,
-  0xd460, 0x1124, 0x03f9, 0x00c5, 0x00a2, 0x10e0, 0xd460, 0xfaa0,
-  0xf844, 0xd016, 0x2005, 0x0802, 0x00c4, 0x05f8, 0x2182, 0xd460,
-  0x10e2, 0x0458, 0x00c4, 0x0000, 0x0000, 0x0000, 0x2040, 0xe824,
-  0xe818, 0x2005, 0x0000, 0x0000, 0x0000, 0x1122, 0xc5e0, 0x2900,
-  0x00a2, 0x0678, 0x00a2, 0x0000, 0x0000, 0x0000, 0x1001, 0xd81b,
-  0x983d, 0x0802, 0x0000, 0x0000, 0x0000, 0x1060, 0xd460, 0x1060,
-  0x00a0, 0x16a2, 0x1120, 0x0000, 0x0000, 0x0000, 0x1804, 0x889e,
-  0x1a5e, 0x00c5, 0x0000, 0x0000, 0x0000, 0x2860, 0xd220, 0x1020,
-  0x2100, 0xc660, 0xdc80, 0x2060, 0x1002, 0x1804, 0x785a, 0x123d,
-  0x04bc, 0x0698, 0x1142, 0x1060, 0x2060, 0xd9e0, 0xd040, 0x2060,
-  0xd460, 0x4980, 0xd220, 0xe844, 0xd81a, 0x887d, 0x123d, 0x0044,
-  0x00e2, 0x2742, 0xd700, 0xeca0, 0xea20, 0xd040, 0x48c0, 0xd460,
-  0xfd40, 0xd460, 0x40e2, 0xd018, 0xa07f, 0x1abf, 0x04dd, 0x00e2,
-  0x2120, 0xdee0, 0xfd60, 0xfaa0, 0xd860, 0x40a0, 0xd480, 0xfd40,
-  0xfd20, 0xfd40, 0xd460, 0x2084, 0x0a9d, 0x053f, 0x06fa, 0x2742,
-  0xd6e0, 0xed00, 0xfa80, 0xe042, 0x3040, 0xd460, 0xfd40, 0xfd40,
-  0xfd20, 0xfd40, 0xecc0, 0x10c2, 0x053d, 0x071b, 0x11c4, 0xdee0,
-  0xed40, 0x38c0, 0xe825, 0xe019, 0x2042, 0xe4c0, 0xfd40, 0xfd40,
-  0xfd20, 0xfd40, 0xecc0, 0x2962, 0x0678, 0x0684, 0x10e0, 0xd440,
-  0xd280, 0x2022, 0xc818, 0x981a, 0x30c2, 0xe4c0, 0xfd40, 0xfd40,
-  0xfd20, 0xfd40, 0xfd40, 0xd480, 0x1102, 0x00a0, 0x0000, 0x1040,
-  0x1020, 0x0000, 0x1002, 0x1862, 0xd460, 0xfd40, 0xfd40, 0xfd20,
-  0xffc0, 0xffe0, 0xffe0, 0xffe0, 0xef20, 0xe700, 0xe700, 0xe700,
-  0xe700, 0xe720, 0xe720, 0xe720, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xef40, 0xd6a0, 0x2182, 0x1142, 0x1140, 0x2940,
-  0x2920, 0x28e0, 0x28a0, 0x3922, 0xd6a0, 0xef40, 0xffc0, 0xffe0,
-  0xffe0, 0xef60, 0x2120, 0x1124, 0x04db, 0x0718, 0x2722, 0xd6c0,
-  0xe480, 0xe220, 0xe004, 0xd018, 0x20a4, 0x2100, 0xef40, 0xffe0,
-  0xffc0, 0xd6a0, 0x1124, 0x04db, 0x07bb, 0x27e4, 0xdfa0, 0xfd60,
-  0xfaa0, 0xf864, 0xf01b, 0x987f, 0x023b, 0x0924, 0xd6a0, 0xffc0,
-  0xef40, 0x2981, 0x04db, 0x06fb, 0x1744, 0xc700, 0xfd20, 0xfa80,
-  0xf844, 0xf01b, 0x983d, 0x123c, 0x04dd, 0x0698, 0x21c2, 0xef20,
-  0xd680, 0x11c5, 0x05f9, 0x0144, 0x00a0, 0x20c0, 0xd220, 0xf864,
-  0xf01b, 0x981b, 0x1004, 0x0022, 0x0102, 0x0602, 0x21a0, 0xd680,
-  0x1142, 0x0636, 0x0124, 0x0000, 0x0000, 0x0000, 0x2022, 0xd81b,
-  0x983d, 0x1004, 0x0000, 0x0000, 0x0000, 0x10e0, 0xc3e0, 0x2900,
-  0x00a0, 0x1682, 0x00a0, 0x0000, 0x0000, 0x0000, 0x0802, 0x887d,
-  0x1a3d, 0x0022, 0x0000, 0x0000, 0x0000, 0x1020, 0xd220, 0x1020,
-  0x10a0, 0xc660, 0x20e0, 0x0000, 0x0000, 0x0000, 0x0044, 0x0add,
-  0x04dd, 0x0102, 0x0000, 0x0000, 0x0000, 0x2800, 0xd022, 0x1000,
-  0x2100, 0xd440, 0xda40, 0x2022, 0x0802, 0x0044, 0x029a, 0x04bd,
-  0x06fa, 0x16c2, 0x1100, 0x1040, 0x2000, 0xd804, 0xd016, 0x2082,
-  0xd6a0, 0x4980, 0xd022, 0xe01a, 0x887d, 0x0abd, 0x04bd, 0x00a4,
-  0x0902, 0xd6e0, 0xecc0, 0xea20, 0xe824, 0xd016, 0x4924, 0xd6a0,
-  0xffe0, 0xd6c0, 0x4102, 0x883b, 0x1a9f, 0x055f, 0x071a, 0x1122,
-  0x20a0, 0xeca0, 0xfac0, 0xf864, 0xd816, 0x4104, 0xd6c0, 0xffe0,
-  0xffc0, 0xffe0, 0xd6a0, 0x18e4, 0x04fd, 0x079b, 0x1744, 0xd6e0,
-  0xeca0, 0xea80, 0xf844, 0xe018, 0x3085, 0xd6a0, 0xffe0, 0xffe0,
-  0xffc0, 0xffe0, 0xef20, 0x1122, 0x0738, 0x1764, 0x11a0, 0xeca0,
-  0xeac0, 0x3842, 0xd81b, 0x983d, 0x1882, 0xe740, 0xffe0, 0xffe0,
-  0xffc0, 0xffe0, 0xef20, 0x21c0, 0x1682, 0xae80, 0x20a0, 0xd200,
-  0xd060, 0x1802, 0x805a, 0x19da, 0x2162, 0xef20, 0xffe0, 0xffe0,
-  0xffc0, 0xffc0, 0xffc0, 0xd6a0, 0x1120, 0x10a0, 0x0000, 0x1020,
-  0x1000, 0x0000, 0x0802, 0x10c2, 0xd6a0, 0xffc0, 0xffc0, 0xffc0,
-  0x07c0, 0x07e0, 0x07e0, 0x07e0, 0x0720, 0x0700, 0x0700, 0x0700,
-  0x0720, 0x0720, 0x0720, 0x0720, 0x07e0, 0x07e0, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x0740, 0x06a0, 0x01c2, 0x0140, 0x1140, 0x1120,
-  0x10e0, 0x10a0, 0x10a2, 0x0922, 0x0680, 0x0740, 0x07c0, 0x07e0,
-  0x07e0, 0x0740, 0x0100, 0x0184, 0x06b6, 0x2722, 0xd6c0, 0xec80,
-  0xea20, 0xe804, 0xd81b, 0x883b, 0x08e4, 0x0120, 0x0740, 0x07e0,
-  0x07c0, 0x06a0, 0x0184, 0x06b6, 0x27e4, 0xdfa0, 0xfd60, 0xfaa0,
-  0xf864, 0xf01b, 0x987f, 0x1adf, 0x047b, 0x0162, 0x06a0, 0x07c0,
-  0x0720, 0x01a2, 0x06b6, 0x1744, 0xc700, 0xed00, 0xfa80, 0xf844,
-  0xf01b, 0x987f, 0x123d, 0x04bd, 0x071a, 0x16a2, 0x01c0, 0x0720,
-  0x0680, 0x01c0, 0x0622, 0x0140, 0x1080, 0x2060, 0xd022, 0xf01a,
-  0x987f, 0x11fb, 0x0064, 0x0062, 0x1142, 0xb600, 0x2160, 0x0680,
-  0x0140, 0x1620, 0x0120, 0x0000, 0x0000, 0x0000, 0x1802, 0x887d,
-  0x1a3d, 0x0064, 0x0000, 0x0000, 0x0000, 0x28a0, 0xc1e0, 0x18c0,
-  0x10a0, 0xc660, 0x10a0, 0x0000, 0x0000, 0x0000, 0x0022, 0x0abd,
-  0x04bd, 0x0042, 0x0000, 0x0000, 0x0000, 0x1000, 0xd022, 0x1800,
-  0x1860, 0xd440, 0x2880, 0x0000, 0x0000, 0x0000, 0x00a4, 0x053d,
-  0x071b, 0x1142, 0x0000, 0x0000, 0x0000, 0x2804, 0xc818, 0x1803,
-  0x10c0, 0xd220, 0xd842, 0x2002, 0x0022, 0x00a4, 0x04db, 0x06fb,
-  0x1744, 0xc680, 0x28c0, 0x1000, 0x2004, 0xc81b, 0x981b, 0x0882,
-  0x06a0, 0x2142, 0xd018, 0x887d, 0x0a9d, 0x053d, 0x06fb, 0x0124,
-  0x10e0, 0xe4a0, 0xea40, 0xe824, 0xe01b, 0x981b, 0x1124, 0x06a0,
-  0x07e0, 0x06a0, 0x1144, 0x0a3b, 0x053f, 0x07bb, 0x1764, 0x10e0,
-  0x2040, 0xea20, 0xf864, 0xf01b, 0x981b, 0x1124, 0x06c0, 0x07e0,
-  0x07c0, 0x07e0, 0x06a0, 0x0164, 0x0718, 0x27e4, 0xc700, 0xe4a0,
-  0xe220, 0xe842, 0xe81b, 0x983d, 0x1084, 0x06a0, 0x07e0, 0x07e0,
-  0x07c0, 0x07e0, 0x0720, 0x0120, 0x2f42, 0xc720, 0x3960, 0xea40,
-  0xf062, 0x3002, 0x809d, 0x1a3d, 0x00c2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07e0, 0x0720, 0x11c0, 0xc660, 0xd4c0, 0x2040, 0xd022,
-  0xd015, 0x1024, 0x0a5a, 0x041a, 0x01a2, 0x0720, 0x07e0, 0x07e0,
-  0x07c0, 0x07c0, 0x07c0, 0x06a0, 0x1120, 0x1060, 0x0000, 0x1000,
-  0x1002, 0x0000, 0x0042, 0x00e2, 0x06a0, 0x07c0, 0x07c0, 0x07c0,
-  0x07df, 0x07ff, 0x07ff, 0x07ff, 0x073d, 0x071c, 0x071c, 0x073c,
-  0x073c, 0x073c, 0x073c, 0x073c, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0x07df, 0x07df, 0x075d, 0x06ba, 0x01c4, 0x1142, 0x1122, 0x10e2,
-  0x10a2, 0x10a5, 0x08a5, 0x0147, 0x069a, 0x075d, 0x07df, 0x07ff,
-  0x07ff, 0x075d, 0x0104, 0x0182, 0x26a0, 0xd6e0, 0xec80, 0xea20,
-  0xe804, 0xd81a, 0x885c, 0x0a3a, 0x0126, 0x0104, 0x075d, 0x07ff,
-  0x07df, 0x06ba, 0x0182, 0x26a0, 0xdfa0, 0xfd60, 0xfaa0, 0xf864,
-  0xf01b, 0x987f, 0x1abf, 0x057f, 0x0698, 0x11a4, 0x06ba, 0x07df,
-  0x073d, 0x01a5, 0x26a0, 0xc740, 0xed00, 0xea80, 0xf844, 0xf01b,
-  0x987f, 0x12bf, 0x04bd, 0x06fa, 0x1744, 0xc680, 0x11c4, 0x073d,
-  0x069a, 0x21c2, 0xb620, 0x2920, 0x1060, 0x2022, 0xd018, 0x987f,
-  0x12bf, 0x043a, 0x00c4, 0x00a2, 0x1100, 0xc440, 0x2101, 0x069a,
-  0x1142, 0xc5e0, 0x2920, 0x0000, 0x0000, 0x0000, 0x1024, 0x0abd,
-  0x04bd, 0x00c4, 0x0000, 0x0000, 0x0000, 0x2040, 0xc002, 0x1882,
-  0x1860, 0xd460, 0x1060, 0x0000, 0x0000, 0x0000, 0x0041, 0x051d,
-  0x06fb, 0x0082, 0x0000, 0x0000, 0x0000, 0x1002, 0xc818, 0x1802,
-  0x1820, 0xd220, 0x2842, 0x0000, 0x0000, 0x0000, 0x0125, 0x0758,
-  0x1764, 0x1100, 0x0000, 0x0000, 0x0000, 0x1805, 0x803a, 0x1002,
-  0x1082, 0xd022, 0xd018, 0x1025, 0x0062, 0x0125, 0x06b6, 0x1744,
-  0xc700, 0xdc60, 0x2060, 0x1002, 0x1804, 0x787b, 0x11da, 0x00c4,
-  0x06ba, 0x1927, 0x881a, 0x0abd, 0x051d, 0x0738, 0x1744, 0x0120,
-  0x20a0, 0xea40, 0xe844, 0xd81a, 0x887d, 0x11da, 0x0189, 0x06ba,
-  0x07ff, 0x06bb, 0x0968, 0x047b, 0x079b, 0x27e4, 0xcf20, 0x20c0,
-  0x2000, 0xe824, 0xf81b, 0x987f, 0x19fb, 0x0168, 0x06ba, 0x07ff,
-  0x07df, 0x07ff, 0x06ba, 0x0184, 0x2722, 0xd780, 0xed00, 0xea40,
-  0xe824, 0xe018, 0x987f, 0x123c, 0x00e6, 0x06ba, 0x07ff, 0x07ff,
-  0x07df, 0x07ff, 0x073d, 0x1121, 0xdec0, 0xed20, 0x38c0, 0xe825,
-  0xe818, 0x2027, 0x0add, 0x04bd, 0x00e4, 0x073c, 0x07ff, 0x07ff,
-  0x07df, 0x07ff, 0x073d, 0x11a5, 0xd440, 0xd280, 0x2022, 0xc818,
-  0x981a, 0x0844, 0x047a, 0x063a, 0x01c7, 0x073c, 0x07ff, 0x07ff,
-  0x07df, 0x07df, 0x07df, 0x06ba, 0x10e2, 0x1020, 0x0000, 0x1002,
-  0x0802, 0x0000, 0x0062, 0x0124, 0x06ba, 0x07df, 0x07df, 0x07df,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x04bc, 0x04bc, 0x04dc, 0x04dc,
-  0x04dc, 0x04dc, 0x04dc, 0x04dc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x04fd, 0x047a, 0x1165, 0x10e2, 0x10a2, 0x1062,
-  0x1065, 0x0865, 0x00a5, 0x0127, 0x047a, 0x04fd, 0x053f, 0x055f,
-  0x055f, 0x04fd, 0x00a4, 0x2162, 0xd660, 0xeca0, 0xea20, 0xe804,
-  0xd81a, 0x885c, 0x0a9c, 0x049a, 0x0144, 0x00a4, 0x04fd, 0x055f,
-  0x055f, 0x047a, 0x2162, 0xde40, 0xfd60, 0xfaa0, 0xf864, 0xf01b,
-  0x987f, 0x1a9f, 0x057f, 0x07bb, 0x16c1, 0x1141, 0x047a, 0x055f,
-  0x04dd, 0x0945, 0xd640, 0xed20, 0xe280, 0xe842, 0xf01b, 0x987f,
-  0x129f, 0x055f, 0x06fb, 0x1744, 0xc720, 0xdc60, 0x1124, 0x04dd,
-  0x047a, 0x2122, 0xcc40, 0x28c0, 0x1020, 0x2002, 0x883a, 0x1a9f,
-  0x055f, 0x067b, 0x0124, 0x00a0, 0x28c0, 0xca20, 0x28a4, 0x045a,
-  0x10c2, 0xc3e0, 0x20c0, 0x0000, 0x0000, 0x0000, 0x0864, 0x051d,
-  0x071b, 0x0124, 0x0000, 0x0000, 0x0000, 0x2022, 0xb818, 0x1065,
-  0x1820, 0xd220, 0x1020, 0x0000, 0x0000, 0x0000, 0x0082, 0x0738,
-  0x1764, 0x0080, 0x0000, 0x0000, 0x0000, 0x0802, 0x803a, 0x1002,
-  0x1800, 0xd022, 0x2002, 0x0000, 0x0000, 0x0000, 0x0120, 0x2f62,
-  0xcf40, 0x20c0, 0x0000, 0x0000, 0x0000, 0x0065, 0x0a5a, 0x0022,
-  0x1064, 0xc818, 0x885b, 0x0864, 0x00a2, 0x0120, 0x26c0, 0xc720,
-  0xed00, 0xd240, 0x2022, 0x0802, 0x0044, 0x02bb, 0x041a, 0x00c4,
-  0x047a, 0x10e9, 0x0a3a, 0x051d, 0x0718, 0x2742, 0xc720, 0x2120,
-  0x2060, 0xe824, 0xe01a, 0x887d, 0x0abd, 0x043a, 0x0189, 0x047a,
-  0x055f, 0x047a, 0x0169, 0x0698, 0x27e5, 0xdfa0, 0xf500, 0x2040,
-  0x2004, 0xd81b, 0xa07f, 0x1abf, 0x043b, 0x0188, 0x047a, 0x055f,
-  0x053f, 0x055f, 0x047a, 0x1184, 0xd6c0, 0xfd40, 0xea80, 0xe824,
-  0xd81a, 0x983d, 0x12bf, 0x04bd, 0x0126, 0x047a, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x04dd, 0x10a2, 0xec80, 0xeaa0, 0x3842, 0xd81b,
-  0xa03d, 0x1067, 0x053d, 0x06fa, 0x00e4, 0x04bc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x04dd, 0x1105, 0xd220, 0xd060, 0x1802, 0x805a,
-  0x19da, 0x00a4, 0x0677, 0x06a4, 0x0164, 0x04dd, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x047a, 0x1082, 0x1000, 0x0000, 0x0802,
-  0x0022, 0x0000, 0x00a2, 0x00e2, 0x047a, 0x055f, 0x055f, 0x053f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025d, 0x025c, 0x027c, 0x027c,
-  0x027c, 0x025c, 0x025c, 0x025c, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x029f, 0x027d, 0x023a, 0x10c4, 0x1062, 0x1042, 0x1025,
-  0x0825, 0x0065, 0x00a5, 0x00e7, 0x023a, 0x027d, 0x029f, 0x02bf,
-  0x02bf, 0x027d, 0x0044, 0x20e2, 0xd420, 0xea40, 0xe824, 0xd81a,
-  0x885c, 0x0a9c, 0x051c, 0x0698, 0x1144, 0x0044, 0x027d, 0x02bf,
-  0x02bf, 0x023a, 0x20e2, 0xdc20, 0xfaa0, 0xf864, 0xf01b, 0x987f,
-  0x1a9f, 0x055f, 0x07bb, 0x2fe4, 0xce80, 0x20e1, 0x023a, 0x02bf,
-  0x027d, 0x08c5, 0xd420, 0xeaa0, 0xe842, 0xe018, 0x987f, 0x129f,
-  0x055f, 0x079b, 0x1744, 0xc700, 0xed00, 0xda40, 0x1084, 0x027d,
-  0x023a, 0x20a2, 0xca40, 0x2860, 0x1000, 0x1024, 0x0a5a, 0x053f,
-  0x079b, 0x06c4, 0x0120, 0x1080, 0x2060, 0xc020, 0x2024, 0x023a,
-  0x1062, 0xc1e0, 0x2040, 0x0000, 0x0000, 0x0000, 0x00c4, 0x0738,
-  0x1764, 0x0120, 0x0000, 0x0000, 0x0000, 0x1802, 0x7038, 0x0825,
-  0x1800, 0xd022, 0x1000, 0x0000, 0x0000, 0x0000, 0x0080, 0x2742,
-  0xc720, 0x1080, 0x0000, 0x0000, 0x0000, 0x0022, 0x0a3a, 0x0042,
-  0x1802, 0xc818, 0x1024, 0x0000, 0x0000, 0x0000, 0x2120, 0xdf00,
-  0xf520, 0x2060, 0x0000, 0x0000, 0x0000, 0x00c5, 0x049a, 0x0082,
-  0x0824, 0x805a, 0x0a5b, 0x00c5, 0x00a0, 0x2120, 0xd660, 0xed00,
-  0xea80, 0xd022, 0x2002, 0x0022, 0x00a4, 0x04fb, 0x065a, 0x00c4,
-  0x023a, 0x08c9, 0x047a, 0x0738, 0x2742, 0xdee0, 0xed00, 0x20c0,
-  0x2021, 0xe01a, 0x887d, 0x0a9d, 0x053d, 0x067a, 0x0189, 0x023a,
-  0x02bf, 0x023b, 0x0146, 0x16c2, 0xd7a0, 0xfd60, 0xea80, 0x2022,
-  0x1004, 0x887d, 0x1a9f, 0x055f, 0x067b, 0x0168, 0x023a, 0x02bf,
-  0x02bf, 0x02bf, 0x023a, 0x1122, 0xeca0, 0xfaa0, 0xe842, 0xd81a,
-  0x885d, 0x125d, 0x055f, 0x06fa, 0x0166, 0x021a, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x1042, 0xea20, 0xe862, 0x3002, 0x889d,
-  0x1a3d, 0x0107, 0x0738, 0x1764, 0x00c1, 0x025d, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027d, 0x1064, 0xd022, 0xd015, 0x1024, 0x0a5a,
-  0x03fa, 0x00e2, 0x1681, 0xaea0, 0x1104, 0x025d, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x023a, 0x1022, 0x1002, 0x0000, 0x0042,
-  0x0062, 0x0000, 0x0080, 0x10c2, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0xa01f, 0xa81f, 0xa81f, 0xa81f, 0x901d, 0x901c, 0x901c, 0x901c,
-  0x981c, 0x981c, 0x981c, 0x981c, 0xa81f, 0xa81f, 0xa81f, 0xa81f,
-  0xa01f, 0xa01f, 0x981d, 0x881a, 0x2824, 0x2002, 0x2005, 0x1805,
-  0x1025, 0x0865, 0x08a5, 0x1085, 0x881a, 0x981d, 0xa01f, 0xa81f,
-  0xa81f, 0x981d, 0x1004, 0x2862, 0xd1e0, 0xe824, 0xd81a, 0x807c,
-  0x0a9c, 0x051c, 0x0738, 0x16c2, 0x1902, 0x1804, 0x981d, 0xa81f,
-  0xa81f, 0x881a, 0x2862, 0xd1e0, 0xf864, 0xf01b, 0x987f, 0x1a9f,
-  0x055f, 0x079b, 0x27e4, 0xdfa0, 0xdc80, 0x2841, 0x881a, 0xa81f,
-  0x981d, 0x2825, 0xd1e0, 0xe862, 0xe018, 0x983d, 0x12bf, 0x055f,
-  0x079b, 0x27e4, 0xc700, 0xed00, 0xeaa0, 0xd022, 0x2804, 0x981d,
-  0x881a, 0x3002, 0xc020, 0x2800, 0x1002, 0x0844, 0x047a, 0x079b,
-  0x27e4, 0xb6c0, 0x2920, 0x1060, 0x2022, 0xc016, 0x2026, 0x881a,
-  0x2002, 0xc002, 0x2000, 0x0000, 0x0000, 0x0000, 0x00e2, 0x2742,
-  0xc740, 0x2920, 0x0000, 0x0000, 0x0000, 0x1045, 0x0238, 0x0845,
-  0x1002, 0xc818, 0x1002, 0x0000, 0x0000, 0x0000, 0x0880, 0xdee0,
-  0xed20, 0x1040, 0x0000, 0x0000, 0x0000, 0x0062, 0x047a, 0x0083,
-  0x0802, 0x805a, 0x0845, 0x0000, 0x0000, 0x0000, 0x20c0, 0xf4a0,
-  0xf2a0, 0x2022, 0x0000, 0x0000, 0x0000, 0x0145, 0x0698, 0x00c2,
-  0x0824, 0x0a5a, 0x049b, 0x0102, 0x10a0, 0x20c0, 0xd420, 0xeaa0,
-  0xe842, 0xd018, 0x1025, 0x0062, 0x0125, 0x06f6, 0x06a4, 0x08a2,
-  0x881a, 0x18a9, 0x0698, 0x2742, 0xd6e0, 0xeca0, 0xeaa0, 0x2040,
-  0x1802, 0x887c, 0x0a9d, 0x051d, 0x0758, 0x06c4, 0x1924, 0x881a,
-  0xa81f, 0x881b, 0x2926, 0xc6a0, 0xfd60, 0xfaa0, 0xe842, 0x1802,
-  0x0044, 0x0abd, 0x055f, 0x079b, 0x06c4, 0x1903, 0x901a, 0xa81f,
-  0xa01f, 0xa81f, 0x881a, 0x30c2, 0xe240, 0xf864, 0xe018, 0x887c,
-  0x0a9d, 0x04bd, 0x079a, 0x1744, 0x0921, 0x881a, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x981d, 0x1802, 0xe824, 0xe818, 0x2027, 0x0add,
-  0x04be, 0x0164, 0x2f42, 0xc720, 0x2082, 0x981d, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0x981c, 0x2807, 0xc818, 0x981a, 0x0844, 0x047a,
-  0x063a, 0x1102, 0xc640, 0xd4c0, 0x2864, 0x981d, 0xa81f, 0xa81f,
-  0xa01f, 0xa81f, 0xa81f, 0x901a, 0x1805, 0x0802, 0x0000, 0x0062,
-  0x00a2, 0x0020, 0x1080, 0x2062, 0x881a, 0xa81f, 0xa81f, 0xa01f,
-  0xf81f, 0xf81f, 0xf81f, 0xf81f, 0xe01c, 0xe01c, 0xe01c, 0xe01c,
-  0xe01c, 0xe01c, 0xe01c, 0xe01c, 0xf81f, 0xf81f, 0xf81f, 0xf81f,
-  0xf81f, 0xf81f, 0xe81d, 0xd01a, 0x3804, 0x2805, 0x2005, 0x1025,
-  0x1065, 0x10a5, 0x10a3, 0x30a4, 0xd01a, 0xe81d, 0xf81f, 0xf81f,
-  0xf81f, 0xe81d, 0x2004, 0x3002, 0xd004, 0xd81a, 0x807c, 0x0a9c,
-  0x051c, 0x0718, 0x2741, 0xc680, 0x30c2, 0x2004, 0xe81d, 0xf81f,
-  0xf81f, 0xd01a, 0x3001, 0xd004, 0xf01b, 0xa07f, 0x1a9f, 0x055f,
-  0x079b, 0x27e4, 0xdfa0, 0xfd40, 0xd240, 0x3023, 0xd01a, 0xf81f,
-  0xe01d, 0x3004, 0xd004, 0xe818, 0x983d, 0x125d, 0x055f, 0x079b,
-  0x27e4, 0xdf80, 0xed00, 0xe280, 0xe862, 0xd018, 0x3807, 0xe01c,
-  0xd01a, 0x3806, 0xc016, 0x2805, 0x0802, 0x00a4, 0x0698, 0x27e4,
-  0xdf80, 0xdcc0, 0x20a0, 0x1020, 0x2002, 0x8818, 0x2047, 0xd01a,
-  0x2805, 0xc018, 0x2005, 0x0000, 0x0000, 0x0000, 0x1122, 0xdee0,
-  0xed20, 0x20a0, 0x0000, 0x0000, 0x0000, 0x0864, 0x0438, 0x1085,
-  0x0802, 0x803a, 0x0802, 0x0000, 0x0000, 0x0000, 0x1040, 0xeca0,
-  0xeaa0, 0x1020, 0x0000, 0x0000, 0x0000, 0x00a2, 0x0678, 0x00c2,
-  0x0042, 0x0a5a, 0x00c5, 0x0000, 0x0000, 0x0000, 0x2060, 0xea20,
-  0xe862, 0x2002, 0x0000, 0x0000, 0x0000, 0x0140, 0x16a2, 0x00c0,
-  0x1064, 0x047a, 0x06b8, 0x1142, 0x1060, 0x2060, 0xd1e0, 0xe842,
-  0xe018, 0x883b, 0x0864, 0x00a2, 0x0120, 0x26c0, 0xb6a0, 0x28a2,
-  0xd01a, 0x20e7, 0x0ec2, 0xd700, 0xeca0, 0xea20, 0xe842, 0x2000,
-  0x1024, 0x0a9d, 0x051d, 0x0718, 0x2762, 0xb6c0, 0x4924, 0xd01a,
-  0xf81f, 0xd01a, 0x30e4, 0xd480, 0xfac0, 0xf864, 0xe019, 0x1024,
-  0x00c4, 0x053d, 0x079b, 0x27e4, 0xb6c0, 0x4904, 0xd01b, 0xf81f,
-  0xf81f, 0xf81f, 0xd01a, 0x3042, 0xe024, 0xf01a, 0x983d, 0x0a9d,
-  0x051d, 0x06fa, 0x27e4, 0xc720, 0x3922, 0xd01a, 0xf81f, 0xf81f,
-  0xf81f, 0xf81f, 0xe01c, 0x2004, 0xd81b, 0x983d, 0x1067, 0x053d,
-  0x071b, 0x11c4, 0xdee0, 0xed20, 0x2042, 0xe01d, 0xf81f, 0xf81f,
-  0xf81f, 0xf81f, 0xe01c, 0x3007, 0x805a, 0x19da, 0x00a4, 0x0677,
-  0x0684, 0x10e0, 0xd440, 0xd280, 0x3824, 0xe01d, 0xf81f, 0xf81f,
-  0xf81f, 0xf81f, 0xf81f, 0xd01a, 0x1804, 0x0022, 0x0000, 0x00a2,
-  0x00a0, 0x0000, 0x1040, 0x2022, 0xd01a, 0xf81f, 0xf81f, 0xf81f
-};
-
-const Animation rainbow_skullAnimation = {
-  .name = "Rainbow Skull",
-  .frameCount = 10,
-  .width = 16,
-  .height = 16,
-  .frameDurations = rainbow_skullDurations,
-  .animationFrames = rainbow_skullFrames
-};
-#endif // ANIMATION_RAINBOW_SKULL_H
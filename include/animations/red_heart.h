@@ -1,182 +0,0 @@
-// red_heart.h - Auto-generated from red_heart.json
-#ifndef ANIMATION_RED_HEART_H
-#define ANIMATION_RED_HEART_H
-
-#include "animation_types.h"
-
-// Frame Durations for red_heart (in 100ms units)
-static const uint8_t PROGMEM red_heartDurations[] = { 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for red_heart
-static const uint16_t PROGMEM red_heartFrames[] = {
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x5800, 0x2800, 0x0800, 0x0800, 0x0800, 0x2800, 0x5800,
-  0x5800, 0x2800, 0x0800, 0x0800, 0x0800, 0x2800, 0x5800, 0x0800,
-  0x0800, 0x2800, 0x0800, 0xd000, 0xd000, 0xd000, 0x0800, 0x2800,
-  0x2800, 0x0800, 0xd000, 0xd000, 0xd000, 0x0800, 0x2800, 0x0800,
-  0x0800, 0x0800, 0xd000, 0x9020, 0x9020, 0x9020, 0xd000, 0x0800,
-  0x0800, 0xd000, 0x8820, 0x9020, 0x9020, 0xd000, 0x0800, 0x0800,
-  0x0800, 0x0800, 0xd000, 0x9020, 0x9020, 0x8820, 0xd000, 0x0800,
-  0x0800, 0xd000, 0x8820, 0x8820, 0x8820, 0xd000, 0x0800, 0x0800,
-  0x0800, 0xd000, 0x9020, 0x5800, 0x5800, 0x5800, 0x9020, 0xd000,
-  0xd000, 0x9020, 0x5800, 0x5800, 0x5800, 0x9020, 0xd000, 0x0800,
-  0x0800, 0xd000, 0x9020, 0x5800, 0x5800, 0x5800, 0x5800, 0x9020,
-  0x8820, 0x5800, 0x5800, 0x5800, 0x5800, 0x8820, 0xd000, 0x0800,
-  0x0800, 0xd000, 0x9020, 0x5800, 0x5800, 0x2800, 0x2800, 0x5800,
-  0x5800, 0x2800, 0x2800, 0x5800, 0x5800, 0x9020, 0xd000, 0x0800,
-  0x0800, 0xd000, 0x9020, 0x5800, 0x5800, 0x2800, 0x2800, 0x5800,
-  0x5800, 0x2800, 0x2800, 0x5800, 0x5800, 0x9020, 0xd000, 0x0800,
-  0x0800, 0x0800, 0xd000, 0x9020, 0x8820, 0x5800, 0x2800, 0x2800,
-  0x2800, 0x2800, 0x5800, 0x9020, 0x9020, 0xd000, 0x0800, 0x0800,
-  0x0800, 0x2800, 0x0800, 0xd000, 0xd000, 0x9020, 0x5800, 0x2800,
-  0x2800, 0x5800, 0x9020, 0xd000, 0xd000, 0x0800, 0x2800, 0x0800,
-  0x0800, 0x5800, 0x2800, 0x0800, 0x0800, 0xd000, 0x9020, 0x5800,
-  0x5800, 0x9020, 0xd000, 0x0800, 0x0800, 0x2800, 0x5800, 0x0800,
-  0x0800, 0x5800, 0x2800, 0x0800, 0x0800, 0xd000, 0x9020, 0x5800,
-  0x5800, 0x8820, 0xd000, 0x0800, 0x0800, 0x2800, 0x5800, 0x0800,
-  0x0800, 0x8820, 0x5800, 0x2800, 0x2800, 0x0800, 0xd000, 0x8820,
-  0x9020, 0xd000, 0x0800, 0x2800, 0x2800, 0x5800, 0x9020, 0x0800,
-  0x0800, 0xd000, 0x8820, 0x5800, 0x5800, 0x2800, 0x0800, 0xd000,
-  0xd000, 0x0800, 0x2800, 0x4800, 0x5800, 0x9020, 0xd000, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800, 0x0800,
-  0x0800, 0x1000, 0x0000, 0x3800, 0x5800, 0x5000, 0x0800, 0x0800,
-  0x1000, 0x0000, 0x5000, 0x6000, 0x4000, 0x0000, 0x1000, 0x0800,
-  0x1000, 0x2000, 0x1800, 0x8800, 0xc800, 0xb800, 0x3000, 0x2000,
-  0x2000, 0x2000, 0xa800, 0xc800, 0x9800, 0x1800, 0x2000, 0x1000,
-  0x0000, 0x1000, 0xb000, 0xa020, 0x8820, 0x9020, 0xc000, 0x4000,
-  0x3000, 0xc000, 0x9020, 0x8820, 0x9820, 0xb800, 0x1800, 0x0000,
-  0x4000, 0xa000, 0x9820, 0x7820, 0x6020, 0x6820, 0x9020, 0x9820,
-  0x9800, 0x9820, 0x6820, 0x6020, 0x7020, 0x9820, 0xa000, 0x5000,
-  0x4800, 0xb020, 0x7820, 0x5000, 0x4000, 0x4000, 0x6820, 0x9820,
-  0xa020, 0x7020, 0x4800, 0x4000, 0x4800, 0x7020, 0xa820, 0x5800,
-  0x3820, 0x8820, 0x5800, 0x3000, 0x2000, 0x2800, 0x4800, 0x7020,
-  0x7820, 0x5000, 0x2800, 0x2000, 0x3000, 0x5800, 0x8020, 0x4820,
-  0x3820, 0x8820, 0x6000, 0x3800, 0x2000, 0x2800, 0x2800, 0x4800,
-  0x5000, 0x2800, 0x2800, 0x2000, 0x3000, 0x5800, 0x8820, 0x4820,
-  0x3820, 0x8820, 0x5800, 0x3800, 0x1800, 0x1000, 0x1000, 0x2800,
-  0x2800, 0x1000, 0x0800, 0x1800, 0x3000, 0x5800, 0x8020, 0x4020,
-  0x4000, 0xa020, 0x7020, 0x4800, 0x2800, 0x1000, 0x0800, 0x1000,
-  0x1000, 0x0000, 0x1000, 0x2800, 0x4000, 0x6820, 0xa020, 0x5000,
-  0x4800, 0xb800, 0x9020, 0x7020, 0x4800, 0x2800, 0x0800, 0x0800,
-  0x0800, 0x0800, 0x2000, 0x4800, 0x6820, 0x9020, 0xb800, 0x6000,
-  0x0800, 0x1800, 0xb800, 0xa020, 0x7020, 0x5000, 0x2800, 0x1000,
-  0x0800, 0x2000, 0x4800, 0x7020, 0x9820, 0xc000, 0x2800, 0x0800,
-  0x0800, 0x1800, 0x3800, 0x9000, 0xa820, 0x7020, 0x4800, 0x2800,
-  0x2000, 0x4800, 0x7020, 0xa020, 0x9800, 0x4000, 0x1800, 0x1000,
-  0x1800, 0x3000, 0x0800, 0x5000, 0x9000, 0xa020, 0x7020, 0x4800,
-  0x4000, 0x6820, 0x9820, 0x9000, 0x6000, 0x0800, 0x3000, 0x2000,
-  0x2800, 0x5800, 0x3000, 0x0800, 0x3800, 0xb800, 0x9820, 0x6820,
-  0x6820, 0x9020, 0xb800, 0x4800, 0x0000, 0x2800, 0x5800, 0x3000,
-  0x3820, 0x8820, 0x5800, 0x3800, 0x1800, 0x1800, 0xb000, 0xa020,
-  0x9820, 0xc000, 0x2800, 0x1800, 0x3000, 0x5800, 0x8820, 0x4820,
-  0x1800, 0x3800, 0x2800, 0x1800, 0x0800, 0x0800, 0x4800, 0x4000,
-  0x3800, 0x4800, 0x0800, 0x0800, 0x1800, 0x2800, 0x3800, 0x2000,
-  0x0000, 0x0800, 0x5000, 0x4800, 0x3820, 0x4020, 0x5800, 0x2000,
-  0x1800, 0x5800, 0x4020, 0x4020, 0x4800, 0x5800, 0x0800, 0x0000,
-  0x1000, 0x2800, 0xb800, 0xa020, 0x8020, 0x8820, 0xc000, 0x5800,
-  0x4800, 0xc000, 0x8820, 0x8020, 0x9820, 0xc000, 0x3000, 0x1000,
-  0x4800, 0xc000, 0x9020, 0x6820, 0x5800, 0x5800, 0x8020, 0xb020,
-  0xb800, 0x8820, 0x6000, 0x5800, 0x6020, 0x9020, 0xc000, 0x6000,
-  0x4020, 0x9820, 0x6820, 0x4000, 0x3000, 0x3000, 0x5820, 0x8820,
-  0x9020, 0x6020, 0x3800, 0x3000, 0x4000, 0x6820, 0x9820, 0x5020,
-  0x3000, 0x7020, 0x4800, 0x2800, 0x1800, 0x1800, 0x3800, 0x6020,
-  0x6820, 0x4000, 0x1800, 0x1800, 0x2000, 0x4000, 0x7020, 0x3800,
-  0x2000, 0x5000, 0x2800, 0x1000, 0x0000, 0x0800, 0x1800, 0x4000,
-  0x4800, 0x2000, 0x0800, 0x0000, 0x0800, 0x2800, 0x5000, 0x3000,
-  0x2000, 0x5800, 0x2800, 0x1000, 0x0000, 0x0000, 0x0000, 0x1800,
-  0x2000, 0x0000, 0x0000, 0x0000, 0x1000, 0x2800, 0x5000, 0x3000,
-  0x2000, 0x5000, 0x2800, 0x0800, 0x3000, 0x9800, 0x9800, 0x3800,
-  0x2800, 0x9800, 0xa000, 0x4000, 0x0800, 0x2800, 0x5000, 0x2800,
-  0x2800, 0x6820, 0x3800, 0x1800, 0x3000, 0x8800, 0xc800, 0x7800,
-  0x6800, 0xc800, 0x9000, 0x3800, 0x1800, 0x3800, 0x6020, 0x3800,
-  0x3820, 0x9020, 0x6000, 0x4000, 0x1800, 0x0800, 0xa000, 0xc800,
-  0xc800, 0xb000, 0x1800, 0x1800, 0x3800, 0x6000, 0x8820, 0x4820,
-  0x4800, 0xc800, 0x8820, 0x6020, 0x4000, 0x2000, 0x0800, 0x8800,
-  0xa000, 0x0800, 0x2000, 0x4000, 0x6020, 0x8820, 0xc000, 0x6800,
-  0x1800, 0x4800, 0xb000, 0x9020, 0x6020, 0x4000, 0x1800, 0x3000,
-  0x3000, 0x1800, 0x4000, 0x6020, 0x8820, 0xb820, 0x5000, 0x2000,
-  0x0800, 0x1000, 0x7800, 0x9820, 0x9020, 0x6020, 0x3800, 0x1800,
-  0x1000, 0x3800, 0x6020, 0x8820, 0x9820, 0x8000, 0x1800, 0x0800,
-  0x1000, 0x2800, 0x0000, 0x7000, 0xb000, 0x8820, 0x6000, 0x3800,
-  0x3800, 0x6000, 0x8820, 0xa820, 0x8800, 0x0000, 0x2800, 0x1800,
-  0x2000, 0x5800, 0x2800, 0x1000, 0x4800, 0xc800, 0x9020, 0x6820,
-  0x6020, 0x8820, 0xc000, 0x5800, 0x1000, 0x2800, 0x5000, 0x2800,
-  0x1000, 0x2000, 0x1000, 0x0800, 0x1800, 0x5000, 0x3800, 0x2800,
-  0x2800, 0x3820, 0x5000, 0x2000, 0x0800, 0x1000, 0x2000, 0x1000,
-  0x2800, 0x5800, 0x4020, 0x3000, 0x2800, 0x2800, 0x3820, 0x5000,
-  0x5800, 0x4020, 0x3000, 0x2800, 0x3000, 0x4020, 0x5800, 0x3000,
-  0x4800, 0xc000, 0x8820, 0x6020, 0x5000, 0x5800, 0x8020, 0xb020,
-  0xb000, 0x8020, 0x5800, 0x5000, 0x6020, 0x8820, 0xc000, 0x6000,
-  0x3820, 0x8820, 0x6000, 0x3800, 0x2800, 0x2800, 0x5000, 0x7820,
-  0x8020, 0x5800, 0x3000, 0x2800, 0x3000, 0x5800, 0x8820, 0x4820,
-  0x2800, 0x6020, 0x3800, 0x1800, 0x0000, 0x0800, 0x2800, 0x5000,
-  0x5820, 0x3000, 0x0800, 0x0000, 0x1000, 0x3000, 0x6020, 0x3000,
-  0x1800, 0x4000, 0x1800, 0x3800, 0x5000, 0x5000, 0x1800, 0x3000,
-  0x3800, 0x1000, 0x4800, 0x5800, 0x4000, 0x1800, 0x4000, 0x2000,
-  0x1000, 0x2000, 0x0000, 0x8000, 0xd000, 0xc800, 0x2800, 0x1800,
-  0x2000, 0x2000, 0xb000, 0xd000, 0x9800, 0x0000, 0x2000, 0x1800,
-  0x1000, 0x2000, 0x0000, 0x8000, 0xc800, 0xc800, 0xc800, 0x4000,
-  0x3000, 0xc000, 0xc000, 0xc800, 0x9000, 0x0000, 0x2000, 0x1800,
-  0x1000, 0x2000, 0x0000, 0x8000, 0xc000, 0x9020, 0x9820, 0x9800,
-  0x9000, 0x9820, 0x9020, 0xb820, 0x9800, 0x0000, 0x2000, 0x1000,
-  0x1800, 0x3800, 0x1000, 0x5000, 0x8800, 0x9820, 0x8820, 0xa020,
-  0xa820, 0x8020, 0x9820, 0x9000, 0x6000, 0x1000, 0x3000, 0x2000,
-  0x2800, 0x5800, 0x3000, 0x0800, 0x3800, 0xb800, 0x9020, 0x8820,
-  0x8820, 0x9020, 0xb800, 0x4800, 0x0000, 0x2800, 0x5800, 0x3000,
-  0x3020, 0x8020, 0x5800, 0x3000, 0x1800, 0x1800, 0xb000, 0xa020,
-  0x9820, 0xc000, 0x2800, 0x1800, 0x3000, 0x5000, 0x8020, 0x4820,
-  0x4800, 0xb800, 0x8020, 0x5800, 0x3800, 0x1800, 0x3800, 0x9000,
-  0x9800, 0x4000, 0x1800, 0x3000, 0x5000, 0x7820, 0xb020, 0x6000,
-  0x3000, 0x8800, 0xa020, 0x8020, 0x5820, 0x3000, 0x0800, 0x5800,
-  0x6800, 0x0800, 0x3000, 0x5000, 0x7820, 0xa020, 0x8800, 0x4000,
-  0x0000, 0x1000, 0xa800, 0xa020, 0x8020, 0x5800, 0x3000, 0x1000,
-  0x0800, 0x2800, 0x5000, 0x7820, 0xa020, 0xb000, 0x1800, 0x0000,
-  0x1000, 0x2000, 0x0800, 0x8000, 0xb820, 0x8020, 0x6000, 0x3000,
-  0x3000, 0x5800, 0x8020, 0xb020, 0x9800, 0x1000, 0x2000, 0x1000,
-  0x0800, 0x1000, 0x0000, 0x3000, 0x4800, 0x3820, 0x2800, 0x1800,
-  0x1800, 0x2800, 0x3000, 0x4800, 0x3800, 0x0000, 0x1000, 0x0800,
-  0x1800, 0x4020, 0x3000, 0x1800, 0x1000, 0x1000, 0x2800, 0x3800,
-  0x3820, 0x2800, 0x1800, 0x1000, 0x1800, 0x2800, 0x4020, 0x2000,
-  0x3820, 0x8820, 0x5800, 0x3000, 0x2000, 0x2000, 0x4800, 0x7020,
-  0x7820, 0x5000, 0x2800, 0x2000, 0x3000, 0x5800, 0x8020, 0x4020,
-  0x2000, 0x5800, 0x2800, 0x1000, 0x0000, 0x0800, 0x2000, 0x4800,
-  0x5000, 0x2000, 0x0800, 0x0000, 0x0800, 0x2800, 0x5800, 0x3000,
-  0x1800, 0x3000, 0x0000, 0x6000, 0xa000, 0x9000, 0x1000, 0x2000,
-  0x2800, 0x0800, 0x8800, 0xa000, 0x7000, 0x0000, 0x2800, 0x1800,
-  0x0800, 0x1800, 0x4800, 0x9000, 0xb020, 0xa820, 0x6000, 0x2800,
-  0x2000, 0x5800, 0xa020, 0xb020, 0x9820, 0x5000, 0x2000, 0x0800,
-  0x0000, 0x1000, 0xc000, 0xa020, 0x8020, 0x8820, 0xc800, 0x5000,
-  0x4000, 0xc800, 0x9020, 0x8020, 0x9820, 0xc800, 0x2000, 0x0000,
-  0x0000, 0x1000, 0xb800, 0xa020, 0x8820, 0x8820, 0x8820, 0xa820,
-  0xb000, 0x8820, 0x8820, 0x8820, 0x9820, 0xc000, 0x2000, 0x0000,
-  0x0000, 0x1000, 0xb800, 0xa020, 0x7820, 0x6020, 0x6020, 0x8820,
-  0x9020, 0x6020, 0x6020, 0x7820, 0x9820, 0xc800, 0x1800, 0x0000,
-  0x0800, 0x1800, 0x7000, 0x9820, 0x9020, 0x6020, 0x5000, 0x6820,
-  0x6820, 0x5000, 0x6020, 0x8820, 0x9820, 0x7800, 0x2000, 0x0800,
-  0x1000, 0x2800, 0x0000, 0x7000, 0xb000, 0x8820, 0x6000, 0x5800,
-  0x5800, 0x5800, 0x8820, 0xa820, 0x8800, 0x0000, 0x2800, 0x1800,
-  0x2000, 0x5000, 0x2800, 0x1000, 0x4000, 0xc800, 0x8820, 0x6020,
-  0x6020, 0x8820, 0xc000, 0x5800, 0x1000, 0x2000, 0x5000, 0x3000,
-  0x3000, 0x7820, 0x4800, 0x2800, 0x2000, 0x4800, 0xb000, 0x9020,
-  0x8820, 0xb820, 0x5000, 0x2000, 0x2000, 0x4800, 0x7020, 0x4000,
-  0x4000, 0xa020, 0x7020, 0x4800, 0x2800, 0x1000, 0x7800, 0x9820,
-  0x9820, 0x8000, 0x1800, 0x2000, 0x4000, 0x6820, 0xa020, 0x5000,
-  0x4800, 0xb800, 0x9020, 0x7020, 0x4800, 0x2800, 0x0000, 0x7800,
-  0x8800, 0x0000, 0x2000, 0x4800, 0x6820, 0x9020, 0xb800, 0x5800,
-  0x0800, 0x1800, 0xb800, 0xa020, 0x7820, 0x5000, 0x2800, 0x1800,
-  0x1800, 0x2800, 0x5000, 0x7020, 0x9820, 0xc000, 0x2800, 0x0800,
-  0x0000, 0x0800, 0x4800, 0x4000, 0x3000, 0x2000, 0x1800, 0x0800,
-  0x0800, 0x1000, 0x2000, 0x3000, 0x4000, 0x4800, 0x0800, 0x0000
-};
-
-const Animation red_heartAnimation = {
-  .name = "Red Heart",
-  .frameCount = 5,
-  .width = 16,
-  .height = 16,
-  .frameDurations = red_heartDurations,
-  .animationFrames = red_heartFrames
-};
-#endif // ANIMATION_RED_HEART_H
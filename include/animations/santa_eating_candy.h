@@ -1,1270 +0,0 @@
-// santa_eating_candy.h - Auto-generated from santa_eating_candy.json
-#ifndef ANIMATION_SANTA_EATING_CANDY_H
-#define ANIMATION_SANTA_EATING_CANDY_H
-
-#include "animation_types.h"
-
-// Frame Durations for santa_eating_candy (in 100ms units)
-static const uint8_t PROGMEM santa_eating_candyDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for santa_eating_candy
-static const uint16_t PROGMEM santa_eating_candyFrames[] = {
-  0x1a08, 0x032a, 0x032a, 0x032a, 0x032a, 0x032a, 0x032a, 0x032a,
-  0x032a, 0x032a, 0x032a, 0x032a, 0x032a, 0x032a, 0x032a, 0x1a08,
-  0x032a, 0x5daa, 0xd69a, 0xffff, 0xe927, 0xe927, 0xe927, 0xe927,
-  0xe927, 0x2429, 0x2429, 0x2429, 0x2429, 0x2429, 0x5daa, 0x032a,
-  0x032a, 0x2429, 0xd69a, 0xd69a, 0x2429, 0xa948, 0xe927, 0xe927,
-  0xe927, 0xa948, 0x2429, 0x2429, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0x2429, 0xa948, 0xa948, 0xa948, 0xa948,
-  0xe927, 0xe927, 0xa948, 0x2429, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xbdb6, 0xbdb6, 0xbdb6, 0xbdb6, 0xbdb6,
-  0xbdb6, 0xbdb6, 0xbdb6, 0xbdb6, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0x2429, 0xfd15, 0xffff, 0xffff, 0xfd15,
-  0xfd15, 0xffff, 0xffff, 0x2429, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xfd15, 0xfd15, 0xfd15, 0x1083, 0xfd15,
-  0xfd15, 0x1083, 0xfd15, 0x2429, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xbdb6, 0xffff, 0xffff, 0xfd15, 0xfd15,
-  0xfb6f, 0xfd15, 0xffff, 0xbdb6, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xbdb6, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbdb6, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0x2429, 0xbdb6, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbdb6, 0x2429, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2429, 0xa948, 0xa948, 0xbdb6, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xbdb6, 0xa948, 0x2429, 0x2429, 0x032a,
-  0x032a, 0xa948, 0xe927, 0xe927, 0xe927, 0xbdb6, 0xbdb6, 0xbdb6,
-  0xbdb6, 0xbdb6, 0xbdb6, 0xe927, 0xe927, 0xa948, 0x2429, 0x032a,
-  0x032a, 0xa948, 0xe927, 0xe927, 0xe927, 0xe927, 0xe927, 0xffff,
-  0x738e, 0xe927, 0xe927, 0xe927, 0xe927, 0xa948, 0x2429, 0x032a,
-  0x032a, 0xa948, 0xe927, 0xe927, 0xe927, 0xe927, 0xe927, 0xffff,
-  0xd69a, 0xe927, 0xe927, 0xe927, 0xe927, 0xa948, 0x5daa, 0x032a,
-  0x1a08, 0xa948, 0xe927, 0xe927, 0xe927, 0xe927, 0xe927, 0xffff,
-  0x738e, 0xe927, 0xe927, 0xe927, 0xe927, 0xa948, 0x032a, 0x1a08,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73d, 0xe6fc, 0xf535,
-  0xf535, 0xe6fc, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x41a8, 0xec93,
-  0xec93, 0x41a8, 0xd4f4, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef1c, 0x41e8, 0xecb4,
-  0xe3b0, 0x41c8, 0xe6db, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef7d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x23e9, 0x0b0a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xd927, 0x9988, 0x6a66, 0x51e6,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xd927, 0x69c6, 0x9327, 0x9307,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xd947, 0x7a26, 0x9307, 0x5a06,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x7246, 0x6a46,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2429, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x340a, 0x23e9, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xef9e, 0xad54, 0x6aa7, 0x5226, 0x2ba9, 0x034a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xc576, 0xb534, 0x6268, 0x9307, 0x9307, 0x6286, 0x12e9,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xd988, 0x7a26, 0x9307, 0x5a06, 0x7226, 0x9968,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xd967, 0x8226, 0x7226, 0xa968, 0xe128,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xd947, 0xa948, 0xd927, 0xe927,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf5, 0xeefc, 0xef7d, 0x448b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x4a08, 0xd6ba, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xe6ba, 0x7287, 0x6a69, 0xa513, 0x344a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xef7d,
-  0x6aaa, 0x9327, 0x9307, 0x6ac7, 0x33c9, 0x2429, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7df, 0xef3c,
-  0x7b09, 0x9307, 0x5a06, 0x7206, 0x99a8, 0x3ba9, 0x2bc9, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xa4f3, 0x7a87, 0x7206, 0xa968, 0xd927, 0xa968, 0x922a, 0x0b0a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xe6db,
-  0x83af, 0xc968, 0xa948, 0xd927, 0xe927, 0xea2b, 0xde18, 0x138c,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe189, 0xb928, 0xd927, 0xea2b, 0xf5f8, 0xa26c, 0x12ca,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe107, 0xb9ca, 0xf67a, 0xea4b, 0xa128, 0x2208,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfd15, 0xeefc, 0xef5d, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xdb4e, 0x41e8, 0xdf1c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xe6da,
-  0x7ac8, 0x51e6, 0xad34, 0xad95, 0x344a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xf79e, 0x6aaa,
-  0x9307, 0x9307, 0x7ac8, 0xa554, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf7be, 0xef5d, 0x7ae8,
-  0x9307, 0x5a06, 0x72c8, 0xacd3, 0x9a0a, 0x3ba9, 0x2bc9, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xb554,
-  0x72a7, 0x7267, 0xac92, 0xb1ea, 0xd927, 0xa968, 0x922a, 0x0b0a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x7b6d, 0xc968, 0xb189, 0xd927, 0xe907, 0xea2b, 0xde18, 0x138c,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe189, 0xb928, 0xd927, 0xea2b, 0xf5f8, 0xa26c, 0x12ca,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe107, 0xb9ca, 0xf67a, 0xea4b, 0xa128, 0x2208,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef3d, 0xef1c,
-  0xf71c, 0xe6fb, 0xef3c, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xf79d, 0x6aca,
-  0x9b89, 0x9b89, 0x8309, 0xa554, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf7be, 0xef5d, 0x7ae9,
-  0x9348, 0x6227, 0x72c8, 0xacb3, 0x9a0a, 0x3ba9, 0x2bc9, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xb595,
-  0xad34, 0xb514, 0xacd3, 0xb1ca, 0xd927, 0xa968, 0x922a, 0x0b0a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x83af, 0xd1a9, 0xb189, 0xd927, 0xe907, 0xea2b, 0xde18, 0x138c,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xd988, 0xb928, 0xd927, 0xea2b, 0xf5f8, 0xa26c, 0x12ca,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe107, 0xb9ca, 0xf67a, 0xea4b, 0xa128, 0x2208,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef3d, 0xef1c,
-  0xef1b, 0xe6db, 0xef3c, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xf79e, 0x7b2c,
-  0xabeb, 0xac0b, 0x8b8b, 0xad54, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7be, 0xe73c,
-  0xef5c, 0xef5c, 0xe73c, 0xbd15, 0x99e9, 0x3ba9, 0x2bc9, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xb596, 0xbd96, 0xbd35, 0xb1ca, 0xd927, 0xa968, 0x922a, 0x0b0a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xe6db,
-  0x83ae, 0xd1a9, 0xb189, 0xd927, 0xe907, 0xea2b, 0xde18, 0x138c,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xd988, 0xb928, 0xd927, 0xea2b, 0xf5f8, 0xa26c, 0x12ca,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe107, 0xb9ca, 0xf67a, 0xea4b, 0xa128, 0x2208,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xfd56, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xeedb, 0xfd15,
-  0xfcf4, 0xeedb, 0xef5c, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef7d, 0x528b, 0xecd4,
-  0xebd0, 0x526a, 0xe73c, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xff9e,
-  0xff7e, 0xef5d, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2bc9, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xbd35, 0xb1ca, 0xd927, 0xa968, 0x922a, 0x0b0a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xe6db,
-  0x83ae, 0xd1a9, 0xb189, 0xd927, 0xe907, 0xea2b, 0xde18, 0x138c,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xd988, 0xb928, 0xd927, 0xea2b, 0xf5f8, 0xa26c, 0x12ca,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe107, 0xb9ca, 0xf67a, 0xea4b, 0xa128, 0x2208,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73d, 0xe6fc, 0xf535,
-  0xf535, 0xe6fc, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x41a8, 0xec93,
-  0xec93, 0x41a8, 0xd4f4, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef1c, 0x41e8, 0xecd4,
-  0xebd0, 0x41e8, 0xe6fc, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xf73c,
-  0xeefb, 0xdedb, 0xef3c, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffbe, 0xac4d,
-  0x72ca, 0x834a, 0x8b6b, 0xa554, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7be, 0xef5c,
-  0xe73c, 0xef5c, 0xe73c, 0xbd14, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdb6, 0xc596, 0xc535, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x0b2a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x4369, 0x91a8,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa948, 0xa968, 0xe128,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xb148, 0xd927, 0xe927,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73d, 0xe6fc, 0xf535,
-  0xf535, 0xe6fc, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x41a8, 0xec93,
-  0xec93, 0x41a8, 0xd4f4, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xef1c, 0x41e8, 0xecd4,
-  0xebd0, 0x41e8, 0xe6fc, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xef5d, 0xf73c,
-  0xeefb, 0xdedb, 0xef3c, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffbe, 0xac4d,
-  0x72ca, 0x834a, 0x8b6b, 0xa554, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7be, 0xef5c,
-  0xe73c, 0xef5c, 0xe73c, 0xbd14, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdb6, 0xc596, 0xc535, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x0b2a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x4369, 0x91a8,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa948, 0xa968, 0xe128,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xb148, 0xd927, 0xe927,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf5, 0xf75d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xf73c,
-  0xf71b, 0xff7c, 0xf77d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xf7be, 0xb46d,
-  0xb42b, 0xd50c, 0xd52d, 0xad94, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7be, 0xef5c,
-  0xef5c, 0xf77c, 0xef5c, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xb5b6, 0xbd96, 0xc535, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf5, 0xf75d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xf73c,
-  0xf71b, 0xff7c, 0xf77d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xf7be, 0xb46d,
-  0xb42b, 0xd50c, 0xd52d, 0xad94, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7be, 0xef5c,
-  0xef5c, 0xf77c, 0xef5c, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xb5b6, 0xbd96, 0xc535, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xf556, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xff3d, 0xfd15,
-  0xfcf5, 0xff3d, 0xef7d, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xffbe, 0xfdb7, 0xfd15,
-  0xf411, 0xfd97, 0xf79e, 0xa5b5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xff9e, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xf73d, 0xf73d, 0xf73d,
-  0xf73d, 0xf73d, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xadd6, 0xadb6, 0xadb6, 0xadb6,
-  0xadb6, 0xadb6, 0xadd6, 0xa595, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x2c2a, 0x444b, 0x442b, 0x442b, 0x444b,
-  0x444b, 0x442b, 0x442b, 0x342a, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x442a, 0xdcd3, 0xed35, 0xed35, 0xecf4,
-  0xecf4, 0xed35, 0xdd14, 0x342a, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7e, 0xff3d, 0xfd15,
-  0xfd15, 0xff3d, 0xef7d, 0x448c, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xffbe, 0xfdb7, 0xfd15,
-  0xf411, 0xfd97, 0xf79e, 0xa5b5, 0x2c2a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xadb6, 0xf7df, 0xffdf, 0xff9e, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe1c9, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b2a, 0x032a, 0x032a, 0x032a, 0x034a, 0x034a, 0x034a,
-  0x034a, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b2a, 0x44ea, 0x344a, 0x344b, 0x33c9, 0x33c9, 0x33c9, 0x33c9,
-  0x33c9, 0x2409, 0x2409, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe58, 0xe6fb, 0xca29, 0xd167, 0xd967, 0xd967,
-  0xc9a8, 0x3ba9, 0x2429, 0x2429, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2c2a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3389, 0x2409, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xf556, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xff3d, 0xfd15,
-  0xfcf5, 0xff3d, 0xef7d, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xffbe, 0xfdb7, 0xfd15,
-  0xf411, 0xfd97, 0xf79e, 0xa5b5, 0x2c2a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xadb6, 0xf7df, 0xffdf, 0xff9e, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe1c9, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc5d7, 0xc5d7, 0xc5d7,
-  0xc5d7, 0xc5d7, 0xc5d7, 0xad95, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe4f4, 0xf536, 0xf556, 0xf515,
-  0xf515, 0xf556, 0xe535, 0x3c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd76, 0xff7d, 0xff3d, 0xfd15,
-  0xfcf5, 0xff3d, 0xef7d, 0x446b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xffbe, 0xfdb7, 0xfd15,
-  0xf411, 0xfd97, 0xf79e, 0xa5b5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffdf, 0xff9e, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xecd4, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc52, 0xff5d, 0xff9e, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffff, 0xf7bf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xecd4, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc52, 0xff5d, 0xff9e, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffff, 0xf7bf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xec93, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc11, 0xfd56, 0xff5d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xec93, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc11, 0xfd56, 0xff5d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xec93, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc11, 0xfd56, 0xff5d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe535, 0xf73d, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xdcd3, 0xfd15, 0xecd4, 0x5209, 0xecb4,
-  0xecb4, 0x5a09, 0xdcd3, 0x4c4b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xe4f4, 0xfd36, 0xfd35, 0xec93, 0xfcf4,
-  0xfcd4, 0xec93, 0xfd35, 0xdcf3, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b5, 0xf79e, 0xff7e, 0xfd77, 0xfd15,
-  0xfc11, 0xfd56, 0xff5d, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x3c0a, 0xb5b6, 0xf7df, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99e9, 0xbd15, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xf7df, 0xbd96, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xd927, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7de, 0xef9e, 0xc535, 0xd968, 0x9988, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xc5f7,
-  0xbdf7, 0xbd96, 0xc534, 0xe1c9, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xef1c,
-  0xcdf7, 0xe1ea, 0xe168, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xef1c,
-  0x9410, 0xd948, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28,
-  0x1a28, 0x0b4a, 0x136b, 0x138c, 0x1aea, 0x12ea, 0x12ea, 0x12ea,
-  0x12ea, 0x032a, 0x032a, 0x032a, 0x032a, 0x034a, 0x0b4a, 0x1a28,
-  0x0b29, 0x4d0b, 0xbe58, 0xdedb, 0xc20a, 0xc947, 0xd168, 0xd147,
-  0xc188, 0x3b89, 0x1c09, 0x2409, 0x23e9, 0x2429, 0x44ea, 0x0b2a,
-  0x032a, 0x344a, 0xbe37, 0xbe37, 0x538a, 0xa948, 0xe107, 0xe107,
-  0xe107, 0xa188, 0x3b89, 0x2409, 0x2409, 0x2429, 0x2429, 0x032a,
-  0x032a, 0x2409, 0x344a, 0x4c6c, 0x9a4b, 0xb1ca, 0xb1ca, 0xb9ca,
-  0xe1c9, 0xe1c9, 0xa22a, 0x3c2b, 0x2429, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x344a, 0xd71b, 0xf73d, 0xef3c, 0xef3c, 0xef3c,
-  0xf73c, 0xf73c, 0xf73d, 0xdf1b, 0x346b, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xa595, 0xc5d7, 0xc618, 0xc638, 0xc5d7,
-  0xc5d7, 0xc638, 0xc618, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x2409, 0x4c4b, 0xe514, 0xf73c, 0xe6fb, 0xf535,
-  0xf535, 0xe6fb, 0xe73c, 0x3c6b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x342a, 0xd4f3, 0xfd56, 0xed15, 0x5209, 0xecb3,
-  0xec93, 0x5a09, 0xdd14, 0x444b, 0x2409, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x342a, 0xb5b6, 0xff9e, 0xff7d, 0xed15, 0xfd15,
-  0xf411, 0xecf4, 0xf73d, 0xadb5, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x23e9, 0x2c2a, 0xadd6, 0xffdf, 0xffff, 0xffbe, 0xff9e,
-  0xff9e, 0xffbe, 0xf7be, 0xb5b6, 0x342a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x2409, 0x3bea, 0xad55, 0xf79e, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffbf, 0xb5b6, 0x3c0a, 0x2409, 0x2409, 0x032a,
-  0x032a, 0x3389, 0x99a8, 0xb1ca, 0xc555, 0xf79e, 0xf7de, 0xf7be,
-  0xf7be, 0xf7df, 0xf79e, 0xbd35, 0x99e9, 0x3ba9, 0x2409, 0x032a,
-  0x0aea, 0x9188, 0xe127, 0xe127, 0xe1c9, 0xc534, 0xbd96, 0xbdf7,
-  0xb596, 0xbd76, 0xc534, 0xe1c9, 0xe127, 0x99a8, 0x2bc9, 0x034a,
-  0x0aea, 0x9968, 0xe127, 0xe927, 0xe927, 0xe168, 0xe20a, 0xeefb,
-  0x9430, 0xd9a9, 0xe168, 0xe927, 0xe127, 0xa168, 0x33e9, 0x034a,
-  0x12ca, 0x9968, 0xe127, 0xe927, 0xe927, 0xe907, 0xe9a9, 0xf73d,
-  0xcdd7, 0xe188, 0xe907, 0xe927, 0xe127, 0xa988, 0x4caa, 0x0b4a,
-  0x2208, 0xa148, 0xe127, 0xe927, 0xe927, 0xe927, 0xe9c9, 0xef1c,
-  0x9410, 0xd968, 0xe927, 0xe927, 0xe127, 0xa168, 0x130a, 0x1a28
-};
-
-const Animation santa_eating_candyAnimation = {
-  .name = "Santa Eating Candy",
-  .frameCount = 39,
-  .width = 16,
-  .height = 16,
-  .frameDurations = santa_eating_candyDurations,
-  .animationFrames = santa_eating_candyFrames
-};
-#endif // ANIMATION_SANTA_EATING_CANDY_H
@@ -1,1014 +0,0 @@
-// shark.h - Auto-generated from shark.json
-#ifndef ANIMATION_SHARK_H
-#define ANIMATION_SHARK_H
-
-#include "animation_types.h"
-
-// Frame Durations for shark (in 100ms units)
-static const uint8_t PROGMEM sharkDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for shark
-static const uint16_t PROGMEM sharkFrames[] = {
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x0d1e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5bf2,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x0d1e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63d0,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5bf2, 0x83ef,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x5b4e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5c12, 0x73ae, 0x2924,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xd79f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d1,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x3165, 0x73ae,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefdf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x0d1e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79d, 0xf79e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c51,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xe7bf, 0xdf5e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x159f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x63d0,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71c, 0x7411,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e, 0x6baf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e,
-  0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x63d1,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x14fc,
-  0x63b0, 0x634d, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6baf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5c12,
-  0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e,
-  0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xef3c,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xdf5e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0,
-  0x634d, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6baf, 0x6baf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5c12, 0x7bae,
-  0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d,
-  0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c, 0xe77e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x25bf,
-  0xdf9f, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2ddf,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f,
-  0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c,
-  0x63d0, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d,
-  0x736d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x14fc,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x2965,
-  0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d,
-  0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c, 0xdf5e, 0xdf5e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f,
-  0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f,
-  0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0,
-  0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d,
-  0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d1,
-  0x053f, 0x055f, 0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae,
-  0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e,
-  0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd6fc, 0x7411,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf,
-  0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f,
-  0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc,
-  0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf,
-  0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x151c, 0x63d0,
-  0x053f, 0x055f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d,
-  0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x738e,
-  0x053f, 0x055f, 0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef,
-  0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738e, 0x738e,
-  0x053f, 0x055f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c,
-  0x8c30, 0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x738e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf,
-  0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151c, 0x63d1,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f,
-  0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc,
-  0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x053f, 0x0d3e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0,
-  0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x5bf2, 0x0d1d,
-  0x053f, 0x055f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e,
-  0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x14fc, 0x63d0, 0x0d1d,
-  0x053f, 0x053f, 0x14fc, 0x63b0, 0x634d, 0x736d, 0x738d, 0x738e,
-  0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x0d1d,
-  0x053f, 0x0d3e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e,
-  0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d1d,
-  0x053f, 0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30,
-  0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x63af, 0x0d1d,
-  0x053f, 0x055f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71d,
-  0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151c, 0x63d0, 0x0d1d,
-  0x053f, 0x055f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x157f,
-  0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x0d3e, 0x53f2, 0x0d1d,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x055f, 0x053e, 0x053f, 0x053f, 0x055f, 0x053f, 0x0d3e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2,
-  0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf,
-  0x14fc, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf1, 0x0d1d,
-  0x053f, 0x055f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e,
-  0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x151d, 0x63d0, 0x63d0, 0x0d1e,
-  0x053f, 0x151c, 0x63b0, 0x634d, 0x736d, 0x738d, 0x738e, 0x738e,
-  0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x14fc, 0x055f,
-  0x0d1e, 0x5c12, 0x7bae, 0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e,
-  0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d3e, 0x055f,
-  0x053f, 0x1d5e, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738d,
-  0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x6baf, 0x14fc, 0x055f,
-  0x053f, 0x055f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71d, 0x73f0,
-  0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151d, 0x63d0, 0x63d0, 0x0d1e,
-  0x053f, 0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x151c,
-  0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x055f, 0x151c, 0x5bf2, 0x0d1d,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f,
-  0x053e, 0x053f, 0x053f, 0x055f, 0x055f, 0x055f, 0x053e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e,
-  0x055f, 0x055f, 0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc,
-  0x055f, 0x055f, 0x055f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f,
-  0x053f, 0x0d3e, 0x151c, 0x63d0, 0x6baf, 0x738e, 0x738e, 0x63d0,
-  0x14fc, 0x0d3e, 0x053f, 0x14fc, 0x63d0, 0x0d1d, 0x055f, 0x055f,
-  0x14fc, 0x5bd0, 0x634d, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e,
-  0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x63f1, 0x73ae, 0x2965, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e,
-  0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x1d5d, 0xcf1d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef,
-  0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x053f, 0x25bf, 0xdf9f, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef,
-  0xcf3e, 0x2dbf, 0x157f, 0x151c, 0x63d0, 0x0d1d, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2,
-  0x1d5d, 0x053f, 0x053f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x053e,
-  0x053f, 0x053f, 0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf1, 0x0d1d, 0x055f, 0x055f,
-  0x0d1e, 0x151d, 0x63d0, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc,
-  0x0d3e, 0x053f, 0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f,
-  0x638f, 0x5b4e, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f,
-  0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f,
-  0x7bae, 0x3165, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef,
-  0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d3e, 0x055f, 0x055f, 0x055f,
-  0xdf5d, 0xef5d, 0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c,
-  0xe77e, 0xd71c, 0x73f0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f,
-  0x25bf, 0xd79f, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e,
-  0x2dbf, 0x157f, 0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f,
-  0x053f, 0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d,
-  0x053f, 0x053f, 0x055f, 0x151c, 0x5bf1, 0x0d1d, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f,
-  0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x0d3e, 0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f,
-  0x055f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x151c, 0x63d1, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e,
-  0x053f, 0x14fc, 0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x5b4e, 0x736d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0,
-  0x1cdb, 0x63d0, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x2124, 0x73ae, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef,
-  0x7c10, 0x738d, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xef3c, 0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c, 0xe77e,
-  0xd71c, 0x73f0, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xefbf, 0xefbf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf,
-  0x157f, 0x151c, 0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f,
-  0x053f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x053f,
-  0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x151c, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x14fc, 0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f,
-  0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738d, 0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb,
-  0x63d0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7bef, 0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10,
-  0x738d, 0x6baf, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xf79e, 0xef5c, 0x8c30, 0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd71c,
-  0x73f0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xe7bf, 0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f,
-  0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f,
-  0x055f, 0x151c, 0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f,
-  0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x053f,
-  0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x63d0, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x0d3e,
-  0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x14fc,
-  0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738d, 0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7bef, 0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xef3c, 0x8c50, 0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xefbf, 0xd71d, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151c,
-  0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x0d3e,
-  0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f, 0x053f,
-  0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x5bf2, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc,
-  0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x151d, 0x63d0,
-  0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf,
-  0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf,
-  0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7bef, 0x738e, 0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x6baf,
-  0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd6fc, 0x73f0, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151d, 0x63d0,
-  0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x151c, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x055f, 0x151c,
-  0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x053e, 0x053f, 0x053f, 0x055f, 0x055f, 0x055f,
-  0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x63d0, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x053f, 0x0d3e, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x14fc, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x5bf2, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x14fc, 0x63d0, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738d, 0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x6baf, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x7bef, 0xcf3e, 0x2dbf, 0x157f, 0x151c, 0x63d0, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x5bf2, 0x1d5d, 0x053f, 0x053f, 0x0d3e, 0x5bf2, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053e, 0x053f, 0x053f, 0x055f, 0x053f, 0x0d3e, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f, 0x14fc, 0x5bf1, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x63d0, 0x14fc, 0x0d3e, 0x053f, 0x151d, 0x63d0, 0x63d0, 0x0d1e,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x6b8f, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x14fc, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738e, 0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d3e, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7bef, 0xe73c, 0xe77e, 0xd71c, 0x73f0, 0x6baf, 0x14fc, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x83ef, 0xcf1d, 0x2dbf, 0x157f, 0x151d, 0x63d0, 0x63d0, 0x0d1e,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x63d0, 0x1d5d, 0x053f, 0x053f, 0x055f, 0x151c, 0x5bf1, 0x0d1d,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x053f, 0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1d, 0x0d3e, 0x053f, 0x14fc, 0x63d0, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7bef, 0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xf79d, 0xdf5e, 0xd71c, 0x73f0, 0x6baf, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd77f, 0x2dbf, 0x157f, 0x151c, 0x63d0, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x053f, 0x053f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x14fc, 0x5bf1, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x053f, 0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x5bd0, 0x1cdb, 0x63d0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x83ef, 0x7c10, 0x738d, 0x6baf, 0x0d3e, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xdf5e, 0xd71c, 0x73f0, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x157f, 0x151d, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x055f, 0x151c, 0x5bf1, 0x0d1d, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x14fc, 0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x63d0, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x7c10, 0x738d, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0xd6fc, 0x7410, 0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x157f, 0x151c, 0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x0d3e, 0x5bf2, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x14fc, 0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x738d, 0x6baf, 0x0d3e, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x6baf, 0x14fc, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x14fc, 0x63d0, 0x63d0, 0x0d1e, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x151c, 0x5bf1, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x0d3e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x6baf, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x63d0, 0x0d1d, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x0d1e, 0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f, 0x055f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f,
-  0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f, 0x053f
-};
-
-const Animation sharkAnimation = {
-  .name = "Shark",
-  .frameCount = 31,
-  .width = 16,
-  .height = 16,
-  .frameDurations = sharkDurations,
-  .animationFrames = sharkFrames
-};
-#endif // ANIMATION_SHARK_H
@@ -1,982 +0,0 @@
-// smiley.h - Auto-generated from smiley.json
-#ifndef ANIMATION_SMILEY_H
-#define ANIMATION_SMILEY_H
-
-#include "animation_types.h"
-
-// Frame Durations for smiley (in 100ms units)
-static const uint8_t PROGMEM smileyDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for smiley
-static const uint16_t PROGMEM smileyFrames[] = {
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x010e, 0x010e, 0x010e, 0x010e,
-  0x00ee, 0x00ee, 0x010e, 0x010e, 0x010e, 0x012f, 0x010e, 0x00ee,
-  0x19d0, 0x010e, 0x010e, 0x010e, 0x00eb, 0xffda, 0xffda, 0xffda,
-  0xffda, 0xffda, 0x00eb, 0x00eb, 0x094f, 0x012f, 0x010e, 0x010e,
-  0x012f, 0x012f, 0x010e, 0x3a4e, 0xffd9, 0xffd9, 0xffb3, 0xffb3,
-  0xffb3, 0xffb3, 0xffb3, 0xff31, 0x00ca, 0x012f, 0x012f, 0x012f,
-  0x012f, 0x012f, 0xce77, 0xffda, 0xff92, 0xffd9, 0xffb3, 0xffb3,
-  0xffb3, 0xee4e, 0xee4e, 0xffb3, 0xff31, 0x012f, 0x012f, 0x012f,
-  0x0130, 0x08a6, 0xffda, 0xffb2, 0xffda, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xffb3, 0xffb2, 0xffb3, 0xffb3, 0x83aa, 0x0130, 0x0130,
-  0x0151, 0x00a7, 0xffb3, 0xffd9, 0xffb3, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xff92, 0xffb2, 0xffb3, 0xffb3, 0x83aa, 0x0151, 0x0130,
-  0x010d, 0xffda, 0xffb3, 0xffb3, 0x10c7, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xffb3, 0xffb3, 0xffb3, 0xffb3, 0xf66e, 0x08a6, 0x0172,
-  0x090c, 0xffda, 0xffb3, 0x08a6, 0x42d0, 0xffb4, 0xffb3, 0xffb3,
-  0xffb3, 0x08a7, 0xde52, 0xffb3, 0xffb3, 0xf66e, 0x0087, 0x0192,
-  0x010d, 0xffda, 0xffb3, 0x00a7, 0x0087, 0xffb4, 0xffb3, 0xffb3,
-  0xffb3, 0xffb4, 0xf773, 0xffb3, 0xf6af, 0xf66e, 0x0087, 0x0192,
-  0x094e, 0xffd9, 0xffb3, 0xffb3, 0xff93, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xffb3, 0xffb3, 0xffb3, 0xf66e, 0xf66e, 0x08a6, 0x0192,
-  0x0992, 0x10c6, 0xf595, 0xedf3, 0xffb3, 0x49e4, 0xffb3, 0xffb3,
-  0x736c, 0xffb3, 0xf595, 0xf595, 0xf66e, 0x8c0b, 0x09b3, 0x09b3,
-  0x09b2, 0x08a7, 0xffb3, 0xffb3, 0xffb3, 0xffb3, 0x10c7, 0x10c7,
-  0xff93, 0xffb3, 0xffb3, 0xf6af, 0xf66e, 0x83aa, 0x0192, 0x0192,
-  0x0a35, 0x09d3, 0xbd92, 0xffb3, 0xffb3, 0xffb3, 0xffb3, 0xffb2,
-  0xffb3, 0xffb3, 0xf6f0, 0xf66e, 0xf66e, 0x0992, 0x09f3, 0x1338,
-  0x12b7, 0x12f8, 0x19d0, 0xf6f0, 0xffb3, 0xffb3, 0xffb3, 0xffb2,
-  0xffb2, 0xf66e, 0xf68e, 0xf66e, 0x090c, 0x12f7, 0x1319, 0x7d9d,
-  0x12b7, 0x12b7, 0x1297, 0x1296, 0x00a7, 0xf66e, 0xf68e, 0xf66e,
-  0xf66e, 0xf66e, 0x08a7, 0x12d7, 0x1317, 0x12f8, 0x8c92, 0xefff,
-  0x1379, 0x139a, 0x139a, 0x139a, 0x1399, 0x1358, 0x1319, 0x0a76,
-  0x12b6, 0x12b7, 0x12f7, 0xe7df, 0xefff, 0xefff, 0x23b9, 0xd7df,
-  0x00ee, 0x010e, 0x010e, 0x010e, 0x00ee, 0x00ad, 0x00ac, 0x00ac,
-  0x00ac, 0x00ac, 0x00ee, 0x010e, 0x00ee, 0x118f, 0x010e, 0x00ee,
-  0x012f, 0x012f, 0x010f, 0x00ed, 0x092c, 0x73d0, 0x8450, 0x8430,
-  0x8450, 0x7c10, 0x196c, 0x00cc, 0x094f, 0x19f1, 0x010f, 0x010e,
-  0x012f, 0x012f, 0x00ee, 0x7c32, 0xd6b5, 0xfff7, 0xfff5, 0xfff5,
-  0xfff5, 0xfff5, 0xdeb1, 0x948e, 0x092d, 0x012f, 0x012f, 0x012f,
-  0x0130, 0x00ce, 0x73f0, 0xfff8, 0xfff6, 0xffd5, 0xffb2, 0xffb2,
-  0xff92, 0xf710, 0xff51, 0xffd2, 0x8c4d, 0x00cd, 0x0130, 0x012f,
-  0x00ef, 0x3a4e, 0xf777, 0xffd4, 0xffd7, 0xffd5, 0xffb2, 0xffb3,
-  0xff51, 0xff31, 0xff11, 0xff92, 0xf772, 0x52cc, 0x00ef, 0x0130,
-  0x010e, 0x73b0, 0xfff6, 0xfff6, 0xfff4, 0xffb2, 0xffb3, 0xffb3,
-  0xffb3, 0xff51, 0xff71, 0xffb3, 0xffd2, 0x8beb, 0x010e, 0x0130,
-  0x114d, 0xdeb6, 0xfff4, 0xbdaf, 0xa4ef, 0xffd3, 0xffb3, 0xffb3,
-  0xffd3, 0xffd3, 0xf752, 0xffd3, 0xff92, 0xe60d, 0x218b, 0x0172,
-  0x116d, 0xded5, 0xffb2, 0x2988, 0x4a8d, 0xe6f4, 0xffd3, 0xffd3,
-  0xef52, 0x6b4b, 0xad0e, 0xfff3, 0xff92, 0xe62d, 0x218b, 0x0172,
-  0x116d, 0xded5, 0xffd3, 0x39e9, 0x0006, 0xb56f, 0xfff3, 0xffd3,
-  0xe6d1, 0x7bec, 0xad2e, 0xf792, 0xff51, 0xe62d, 0x21ac, 0x0172,
-  0x116d, 0xe6d5, 0xff94, 0xcdd1, 0xa4ee, 0xff93, 0xffd3, 0xffb3,
-  0xfff3, 0xfff3, 0xff53, 0xff33, 0xfed0, 0xee2d, 0x21ab, 0x0193,
-  0x0970, 0x9cd1, 0xfe95, 0xfe95, 0xfff3, 0xce30, 0xff93, 0xffd3,
-  0xce30, 0xffb3, 0xfe94, 0xfe35, 0xfed0, 0xaccc, 0x116f, 0x0193,
-  0x0152, 0x4aad, 0xffb2, 0xffd3, 0xffd3, 0xc5f0, 0x8c2d, 0x840c,
-  0xbd8f, 0xffd3, 0xffd3, 0xff10, 0xf66e, 0x6b2b, 0x0151, 0x0993,
-  0x0a35, 0x09f3, 0x9c8d, 0xfff3, 0xffd3, 0xffd3, 0xef12, 0xef12,
-  0xffd3, 0xff92, 0xff30, 0xfece, 0x9c4b, 0x0970, 0x09f4, 0x0a97,
-  0x12d8, 0x0ab8, 0x32b1, 0xb52e, 0xf711, 0xff92, 0xff92, 0xff92,
-  0xff51, 0xfecf, 0xf66d, 0xb4cb, 0x32f1, 0x0ad8, 0x0af8, 0x1b18,
-  0x1339, 0x12b7, 0x0ab7, 0x0a12, 0x4acd, 0xbd0c, 0xd58c, 0xd58c,
-  0xd5ac, 0xbd0c, 0x52cc, 0x0a12, 0x2358, 0x443a, 0x4c39, 0x9578,
-  0x1399, 0x1359, 0x1379, 0x139a, 0x0b18, 0x1a72, 0x1a2f, 0x19ef,
-  0x19ee, 0x1210, 0x0a96, 0x2358, 0xbede, 0xf7ff, 0xd79f, 0x9e7c,
-  0x00ee, 0x00ee, 0x00ee, 0x010e, 0x010e, 0x00cd, 0x00cd, 0x00cd,
-  0x00cd, 0x00cd, 0x00ee, 0x010e, 0x00ee, 0x094f, 0x094f, 0x00ee,
-  0x012f, 0x012f, 0x010f, 0x00ee, 0x00cc, 0x3a6e, 0x52cd, 0x4ace,
-  0x52ce, 0x4aae, 0x090d, 0x00cd, 0x010f, 0x19f1, 0x012f, 0x010e,
-  0x012f, 0x012f, 0x00ee, 0x4ad0, 0xa553, 0xffb7, 0xfff6, 0xfff6,
-  0xfff6, 0xfff6, 0xbdaf, 0x6b8d, 0x00ee, 0x0130, 0x012f, 0x012f,
-  0x0130, 0x00ee, 0x428e, 0xf778, 0xfff7, 0xffd5, 0xffb2, 0xffb2,
-  0xffb2, 0xff31, 0xff71, 0xffb2, 0x7bcd, 0x00ce, 0x0130, 0x012f,
-  0x0110, 0x21ad, 0xd696, 0xfff5, 0xffd7, 0xffd6, 0xffb2, 0xffb3,
-  0xff71, 0xff31, 0xff31, 0xff92, 0xef31, 0x4a8c, 0x00ef, 0x0130,
-  0x00ef, 0x4ace, 0xfff7, 0xffd5, 0xfff5, 0xffb3, 0xffb3, 0xffb3,
-  0xffb2, 0xff31, 0xff31, 0xffb3, 0xfff3, 0x940b, 0x00ee, 0x0130,
-  0x092d, 0xbdf4, 0xfff5, 0xe6d2, 0xbdaf, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xfff3, 0xffb3, 0xffd3, 0xffb2, 0xe60d, 0x29ac, 0x0152,
-  0x092d, 0xd674, 0xfff3, 0x4a69, 0x4a8d, 0xef55, 0xffd3, 0xffd3,
-  0xffb3, 0xa4ee, 0xad0e, 0xfff3, 0xffb2, 0xee6e, 0x29cb, 0x0172,
-  0x092d, 0xce74, 0xfff3, 0x3a09, 0x0006, 0x9cce, 0xfff3, 0xffd3,
-  0xe6d1, 0x5aca, 0x9cad, 0xf792, 0xff72, 0xee4e, 0x29cb, 0x0172,
-  0x092d, 0xd675, 0xffd3, 0xb54f, 0x6b4b, 0xe6f2, 0xffd3, 0xffb3,
-  0xffd3, 0xffd3, 0xef32, 0xf753, 0xfef0, 0xf64d, 0x31eb, 0x0173,
-  0x094f, 0xa532, 0xfe75, 0xfe56, 0xfff4, 0xe6f1, 0xffb3, 0xfff3,
-  0xe6d1, 0xffb3, 0xfeb5, 0xfe16, 0xfeb0, 0xcd6c, 0x21ad, 0x0193,
-  0x0172, 0x426c, 0xffb3, 0xffb3, 0xffd3, 0xbdaf, 0x9cae, 0x9cce,
-  0xa4ee, 0xffb3, 0xffb3, 0xff31, 0xfeae, 0x83ab, 0x0130, 0x0993,
-  0x0a35, 0x1232, 0xa4ee, 0xfff3, 0xffd3, 0xffb3, 0xd650, 0xce10,
-  0xf773, 0xffd3, 0xff71, 0xfeef, 0xbd0c, 0x21ef, 0x09f4, 0x0a96,
-  0x12d8, 0x0a97, 0x3ab0, 0xd60f, 0xff71, 0xffb2, 0xffd3, 0xffd3,
-  0xff92, 0xfeef, 0xfe8e, 0xddcc, 0x532e, 0x0ad7, 0x0af8, 0x12f8,
-  0x1359, 0x12b7, 0x0a97, 0x1a30, 0x6b6d, 0xd5ad, 0xee4e, 0xee4e,
-  0xee4e, 0xddcd, 0x83cb, 0x222f, 0x0a96, 0x2bb9, 0x443a, 0x9dba,
-  0x139a, 0x1359, 0x1379, 0x139a, 0x0ad7, 0x2a6f, 0x3a4c, 0x324c,
-  0x3a2c, 0x322d, 0x0a34, 0x0ad8, 0x3bd9, 0xd75e, 0xefff, 0xdfdf,
-  0x010e, 0x010e, 0x010e, 0x010e, 0x010e, 0x00ee, 0x00ee, 0x00ee,
-  0x00ee, 0x00ee, 0x010e, 0x010e, 0x010e, 0x010e, 0x096f, 0x00ee,
-  0x010f, 0x012f, 0x010f, 0x010f, 0x00ee, 0x092c, 0x196b, 0x196b,
-  0x196b, 0x196b, 0x00ee, 0x00ee, 0x010f, 0x1190, 0x1190, 0x010e,
-  0x012f, 0x012f, 0x010f, 0x116e, 0x5b0e, 0xce55, 0xef56, 0xef35,
-  0xef35, 0xef36, 0x8c8f, 0x428d, 0x094f, 0x012f, 0x012f, 0x012f,
-  0x0130, 0x010f, 0x114d, 0xbdf5, 0xfff8, 0xfff5, 0xffd3, 0xffd3,
-  0xffd3, 0xff92, 0xff92, 0xff72, 0x632c, 0x00ce, 0x0130, 0x012f,
-  0x0130, 0x092e, 0x94d2, 0xfff7, 0xffd6, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xff11, 0xff31, 0xff92, 0xef11, 0x3a2c, 0x010f, 0x0130,
-  0x0110, 0x21cd, 0xffb7, 0xffd5, 0xffd6, 0xffb4, 0xffb3, 0xffb3,
-  0xffb2, 0xff31, 0xff10, 0xff92, 0xfff3, 0xa4ac, 0x00ee, 0x0150,
-  0x010e, 0x8451, 0xffd6, 0xffb4, 0xe6f1, 0xff92, 0xffd3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffd3, 0xffb3, 0xde0e, 0x29ec, 0x0151,
-  0x010e, 0xb5b3, 0xfff4, 0x8c2c, 0x424c, 0xf775, 0xffd3, 0xffb3,
-  0xffd3, 0xdeb1, 0xb58f, 0xffb3, 0xffb3, 0xfece, 0x424a, 0x0152,
-  0x010e, 0xb593, 0xfff4, 0x52aa, 0x0047, 0x8c6e, 0xfff3, 0xffd3,
-  0xf752, 0x4a6a, 0x83ec, 0xff92, 0xffb2, 0xfeae, 0x424b, 0x0152,
-  0x010e, 0xb5b3, 0xfff4, 0xa50e, 0x2968, 0xb56f, 0xfff3, 0xffb3,
-  0xffb3, 0xef12, 0xdeb1, 0xef32, 0xff31, 0xf68e, 0x424b, 0x0152,
-  0x012f, 0xa552, 0xfed5, 0xfe55, 0xf753, 0xff93, 0xffd3, 0xfff3,
-  0xff93, 0xffd3, 0xff14, 0xfe55, 0xfed1, 0xee4d, 0x3a2b, 0x0172,
-  0x0172, 0x322d, 0xff53, 0xff54, 0xffd3, 0xbdcf, 0xbd8f, 0xce70,
-  0x9cce, 0xf772, 0xff93, 0xfef3, 0xfecf, 0xacab, 0x012f, 0x09b3,
-  0x09f5, 0x1232, 0xad4f, 0xfff3, 0xffd3, 0xff92, 0xb54f, 0x9cae,
-  0xde91, 0xffd3, 0xffb3, 0xff10, 0xddcc, 0x530e, 0x01b3, 0x0a76,
-  0x12f8, 0x0a98, 0x3a8e, 0xeef0, 0xffb2, 0xffd3, 0xfff3, 0xfff3,
-  0xffd3, 0xff31, 0xfecf, 0xfe8d, 0x942c, 0x0a95, 0x1319, 0x0ad8,
-  0x139a, 0x12f8, 0x0a76, 0x328f, 0x946d, 0xee6f, 0xfeef, 0xfeef,
-  0xfecf, 0xf66e, 0xc52c, 0x5aec, 0x1a73, 0x0af8, 0x2379, 0x6cda,
-  0x1399, 0x1379, 0x1359, 0x137a, 0x0a95, 0x4acd, 0x732a, 0x6b2a,
-  0x734a, 0x6b2b, 0x1a10, 0x0a96, 0x0ad8, 0x2b78, 0xc71e, 0xf7ff,
-  0x00ee, 0x010e, 0x010e, 0x010e, 0x010e, 0x00ee, 0x00ee, 0x00ee,
-  0x00ee, 0x00ee, 0x010e, 0x010e, 0x010e, 0x00ee, 0x094f, 0x010e,
-  0x010f, 0x012f, 0x012f, 0x010e, 0x00ee, 0x112d, 0x218b, 0x218c,
-  0x218c, 0x218c, 0x010e, 0x00ce, 0x010f, 0x012f, 0x11b0, 0x010f,
-  0x012f, 0x012f, 0x010f, 0x118e, 0x634f, 0xce55, 0xf776, 0xf756,
-  0xf756, 0xf776, 0x9cef, 0x4aac, 0x096f, 0x012f, 0x012f, 0x012f,
-  0x0130, 0x010f, 0x114d, 0xbdf5, 0xfff8, 0xfff5, 0xffd3, 0xffd3,
-  0xffd3, 0xff92, 0xff91, 0xff92, 0x738d, 0x00ce, 0x0130, 0x012f,
-  0x0130, 0x092e, 0x94b2, 0xfff7, 0xffd6, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xf711, 0xff31, 0xff71, 0xf752, 0x4a8c, 0x010f, 0x0130,
-  0x0130, 0x218c, 0xf797, 0xffd5, 0xfff6, 0xffb4, 0xffb3, 0xffb3,
-  0xffb2, 0xff31, 0xff10, 0xff92, 0xfff3, 0xb4ec, 0x00ed, 0x0151,
-  0x010f, 0x8431, 0xffd6, 0xffb4, 0xdeb1, 0xff92, 0xffd3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffd3, 0xffd3, 0xe64e, 0x3a2c, 0x0151,
-  0x010e, 0xad53, 0xfff4, 0x8c4c, 0x320b, 0xef55, 0xffd3, 0xffb3,
-  0xffd3, 0xde91, 0xad4e, 0xffb3, 0xffb3, 0xfecf, 0x528a, 0x0151,
-  0x010e, 0xa532, 0xfff4, 0x5b0b, 0x0027, 0x7c0d, 0xfff3, 0xffd3,
-  0xf772, 0x52aa, 0x7bcc, 0xf772, 0xffb3, 0xfecf, 0x4a8a, 0x0152,
-  0x010f, 0xad52, 0xfff4, 0xb56e, 0x31a8, 0xb56f, 0xfff3, 0xffb3,
-  0xffb3, 0xf752, 0xe6d1, 0xef32, 0xff51, 0xfe8e, 0x528b, 0x0152,
-  0x0130, 0x9cf2, 0xfed5, 0xfe35, 0xff53, 0xff92, 0xffb3, 0xfff3,
-  0xff92, 0xffd3, 0xff14, 0xfe36, 0xfeb2, 0xee4d, 0x426b, 0x0172,
-  0x0173, 0x29ed, 0xf732, 0xff73, 0xffd3, 0xc610, 0xad4f, 0xc610,
-  0x9cad, 0xef52, 0xff93, 0xff13, 0xfecf, 0xb4eb, 0x012e, 0x09b3,
-  0x09f4, 0x1212, 0x9cef, 0xfff3, 0xffd3, 0xffb3, 0xbdaf, 0xa4ee,
-  0xde91, 0xffd3, 0xffb2, 0xff10, 0xe5ec, 0x530e, 0x09b2, 0x0a76,
-  0x1318, 0x0ab8, 0x2a4f, 0xe690, 0xffb2, 0xffd3, 0xfff3, 0xfff3,
-  0xffd3, 0xff31, 0xfecf, 0xfe8d, 0x942c, 0x0a95, 0x1339, 0x0ad8,
-  0x13ba, 0x1339, 0x0a77, 0x2a70, 0x840d, 0xe62e, 0xfeef, 0xfecf,
-  0xfecf, 0xf66e, 0xbd0c, 0x52ec, 0x1273, 0x12f8, 0x12f8, 0x4419,
-  0x1379, 0x139a, 0x1359, 0x137a, 0x0ad6, 0x42ae, 0x62ea, 0x62ea,
-  0x62ea, 0x5aeb, 0x1a10, 0x0a96, 0x12d8, 0x0ab7, 0x5c9a, 0xe7df,
-  0x00ee, 0x00ee, 0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ee, 0x00ee,
-  0x00ee, 0x00ce, 0x00ee, 0x010e, 0x010e, 0x00ee, 0x010e, 0x092f,
-  0x010f, 0x010f, 0x012f, 0x010e, 0x00cd, 0x198d, 0x31ec, 0x31ec,
-  0x31ec, 0x29ec, 0x092d, 0x00ce, 0x010f, 0x010f, 0x1190, 0x094f,
-  0x012f, 0x012f, 0x00ef, 0x19ae, 0x73d0, 0xdeb6, 0xffb6, 0xff96,
-  0xff96, 0xffb6, 0xb570, 0x5b0c, 0x096f, 0x0130, 0x012f, 0x012f,
-  0x0130, 0x010f, 0x196d, 0xce55, 0xfff8, 0xffd5, 0xffb3, 0xffb2,
-  0xffd2, 0xff71, 0xff71, 0xffb2, 0x840d, 0x00cd, 0x0130, 0x012f,
-  0x0130, 0x092e, 0x9d12, 0xfff7, 0xffb6, 0xffd8, 0xffb3, 0xffb3,
-  0xff92, 0xf710, 0xff51, 0xff51, 0xf772, 0x52ec, 0x010f, 0x0130,
-  0x0130, 0x21ac, 0xf777, 0xffd5, 0xfff6, 0xffd3, 0xffb3, 0xffb3,
-  0xffb3, 0xff31, 0xf710, 0xff92, 0xfff3, 0xb50d, 0x00ed, 0x0151,
-  0x010f, 0x8472, 0xffd6, 0xff93, 0xce50, 0xf772, 0xffd3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffb3, 0xffb3, 0xee6e, 0x422b, 0x0151,
-  0x010f, 0xa553, 0xfff4, 0x842c, 0x29aa, 0xe715, 0xffd3, 0xffb3,
-  0xffd3, 0xce30, 0xa4ee, 0xffb3, 0xffb3, 0xfeef, 0x528a, 0x0151,
-  0x010f, 0xa512, 0xfff4, 0x634b, 0x0006, 0x73ad, 0xfff3, 0xffd3,
-  0xf772, 0x5aea, 0x7bcc, 0xf752, 0xffb2, 0xfecf, 0x528a, 0x0152,
-  0x010f, 0xa532, 0xfff4, 0xbdcf, 0x4249, 0xbdaf, 0xfff3, 0xffb3,
-  0xffd3, 0xff93, 0xef12, 0xef12, 0xff31, 0xfe8e, 0x528a, 0x0152,
-  0x0130, 0x8c91, 0xfed5, 0xfe15, 0xff94, 0xf772, 0xffb3, 0xfff3,
-  0xf752, 0xffb2, 0xff14, 0xfe16, 0xfeb2, 0xee2d, 0x424c, 0x0172,
-  0x0193, 0x21cd, 0xf732, 0xff93, 0xffd3, 0xce30, 0xa4ee, 0xb58f,
-  0x9cad, 0xef52, 0xffb3, 0xff32, 0xfecf, 0xb4cb, 0x012e, 0x0993,
-  0x09f4, 0x09f2, 0x8c6e, 0xfff3, 0xffd3, 0xffd3, 0xce10, 0xb54f,
-  0xe6d1, 0xffd3, 0xff92, 0xff10, 0xddcc, 0x4b0f, 0x09f3, 0x0a55,
-  0x1318, 0x0ad8, 0x2230, 0xd60f, 0xff91, 0xffd3, 0xffd3, 0xfff3,
-  0xffb3, 0xff10, 0xfeae, 0xf64d, 0x83ec, 0x0ab6, 0x135a, 0x12f8,
-  0x13ba, 0x1379, 0x0a97, 0x1a30, 0x738d, 0xd5ce, 0xfeaf, 0xf6af,
-  0xf6ae, 0xee4d, 0xacac, 0x42ad, 0x1274, 0x12f8, 0x12f8, 0x1318,
-  0x1379, 0x139a, 0x1359, 0x137a, 0x0af7, 0x328f, 0x528a, 0x528b,
-  0x4a8b, 0x4a8b, 0x1211, 0x0a97, 0x12d8, 0x12d7, 0x12b7, 0x857b,
-  0x010e, 0x010e, 0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ee, 0x00ee,
-  0x00ee, 0x00ee, 0x010e, 0x010e, 0x010e, 0x010e, 0x00ee, 0x012e,
-  0x010f, 0x010f, 0x012f, 0x010e, 0x00cd, 0x114d, 0x218b, 0x218c,
-  0x218c, 0x218c, 0x010d, 0x00ce, 0x010f, 0x010f, 0x094f, 0x1190,
-  0x012f, 0x012f, 0x010f, 0x118e, 0x634f, 0xce56, 0xf776, 0xf776,
-  0xf776, 0xf776, 0xa510, 0x4a8c, 0x012e, 0x0950, 0x012f, 0x012f,
-  0x0130, 0x010f, 0x114d, 0xbdf5, 0xfff8, 0xfff5, 0xffd3, 0xffd3,
-  0xffd3, 0xff72, 0xff91, 0xffb2, 0x738d, 0x00cd, 0x0130, 0x012f,
-  0x0130, 0x012e, 0x94b2, 0xfff7, 0xffd5, 0xffd8, 0xffb3, 0xffb3,
-  0xff92, 0xf711, 0xff51, 0xff71, 0xf752, 0x4a8c, 0x010f, 0x0130,
-  0x0130, 0x198c, 0xf777, 0xffd5, 0xfff6, 0xffd4, 0xffb3, 0xffb3,
-  0xffb3, 0xff31, 0xff10, 0xff92, 0xfff3, 0xb4ec, 0x00ed, 0x0150,
-  0x010f, 0x7c11, 0xffd6, 0xffb4, 0xdeb1, 0xff72, 0xffd3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffd3, 0xffd3, 0xe64e, 0x3a0b, 0x0151,
-  0x010f, 0xad52, 0xfff4, 0x946d, 0x31eb, 0xef35, 0xffd3, 0xffb3,
-  0xffd3, 0xde91, 0xad4e, 0xffb3, 0xffb3, 0xfecf, 0x528a, 0x0151,
-  0x010f, 0xa532, 0xfff4, 0x632b, 0x0027, 0x7bee, 0xfff3, 0xffd3,
-  0xf772, 0x52aa, 0x7bcc, 0xf772, 0xffb3, 0xfecf, 0x4a8a, 0x0152,
-  0x010f, 0xa532, 0xfff4, 0xb58f, 0x31c9, 0xb56f, 0xfff3, 0xffb3,
-  0xffb3, 0xf752, 0xe6f1, 0xef12, 0xff51, 0xfe8e, 0x528a, 0x0152,
-  0x0130, 0x94d2, 0xfed5, 0xfe35, 0xff73, 0xff92, 0xffb3, 0xfff3,
-  0xf772, 0xffb3, 0xff14, 0xfe36, 0xfeb2, 0xee4d, 0x426b, 0x0172,
-  0x0173, 0x29ed, 0xf732, 0xff73, 0xffd3, 0xce10, 0xad2f, 0xc610,
-  0x9cae, 0xef52, 0xffb3, 0xff13, 0xfecf, 0xb4cb, 0x012e, 0x0993,
-  0x09f4, 0x11f2, 0x9ccf, 0xfff3, 0xffd3, 0xffb3, 0xbdaf, 0xa4ee,
-  0xde91, 0xffd3, 0xffb2, 0xff10, 0xddcc, 0x532f, 0x09f3, 0x0a35,
-  0x1318, 0x0ad8, 0x2a4f, 0xde70, 0xff92, 0xffd3, 0xfff3, 0xfff3,
-  0xffd3, 0xff31, 0xfecf, 0xf66d, 0x942c, 0x0ab5, 0x137a, 0x1319,
-  0x139a, 0x139a, 0x0ab7, 0x2230, 0x83ed, 0xde2e, 0xfecf, 0xfecf,
-  0xfecf, 0xf66e, 0xbd0c, 0x52cc, 0x1274, 0x12f8, 0x12f8, 0x12f8,
-  0x1379, 0x139a, 0x1379, 0x1359, 0x0ad6, 0x3aae, 0x62ea, 0x62ea,
-  0x5aea, 0x5acb, 0x1211, 0x0a96, 0x12d8, 0x12d7, 0x0a97, 0x2b98,
-  0x010e, 0x010e, 0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ee, 0x00ee,
-  0x00ee, 0x00ee, 0x010e, 0x010e, 0x010e, 0x010e, 0x00ee, 0x010e,
-  0x010f, 0x010f, 0x010f, 0x010e, 0x00cd, 0x116d, 0x29cc, 0x29cc,
-  0x29cc, 0x29cc, 0x092d, 0x00ce, 0x010f, 0x012f, 0x010f, 0x11b0,
-  0x012f, 0x012f, 0x010f, 0x19ae, 0x6baf, 0xd696, 0xffb6, 0xff96,
-  0xff96, 0xffb6, 0xad70, 0x5aec, 0x012e, 0x0970, 0x012f, 0x012f,
-  0x0130, 0x010f, 0x114d, 0xc615, 0xfff8, 0xfff5, 0xffb3, 0xffb2,
-  0xffd3, 0xff71, 0xff71, 0xffb2, 0x83ed, 0x00cd, 0x0130, 0x012f,
-  0x0130, 0x092e, 0x94d2, 0xfff7, 0xffd6, 0xffd8, 0xffb3, 0xffb3,
-  0xff92, 0xf710, 0xff51, 0xff71, 0xf772, 0x52cc, 0x010f, 0x0130,
-  0x0130, 0x198c, 0xf777, 0xffd5, 0xfff6, 0xffd4, 0xffb3, 0xffb3,
-  0xffb3, 0xff31, 0xff10, 0xff92, 0xfff3, 0xb50d, 0x00ed, 0x0151,
-  0x010f, 0x8431, 0xffd6, 0xff94, 0xd671, 0xf772, 0xffd3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffb3, 0xffb3, 0xee6e, 0x3a2b, 0x0151,
-  0x010f, 0xa512, 0xfff4, 0x8c4d, 0x31ca, 0xe715, 0xffd3, 0xffb3,
-  0xffd3, 0xd650, 0xa50e, 0xffb3, 0xffb3, 0xfeef, 0x528a, 0x0151,
-  0x010f, 0x9cf2, 0xfff5, 0x6b6b, 0x0006, 0x73ad, 0xfff3, 0xffd3,
-  0xf792, 0x5aea, 0x7bcc, 0xf752, 0xffb2, 0xfecf, 0x528a, 0x0152,
-  0x010f, 0x9d12, 0xfff4, 0xc5cf, 0x4229, 0xb58f, 0xfff3, 0xffb3,
-  0xffd3, 0xff92, 0xef12, 0xef32, 0xff31, 0xfe8e, 0x52aa, 0x0152,
-  0x0130, 0x8c91, 0xfed5, 0xfe35, 0xff74, 0xff92, 0xff93, 0xfff3,
-  0xf752, 0xffb2, 0xff14, 0xfe16, 0xfeb2, 0xee4d, 0x424c, 0x0172,
-  0x0193, 0x21cd, 0xf712, 0xff93, 0xffd3, 0xce30, 0xa4ee, 0xb5af,
-  0x9cae, 0xef52, 0xffb3, 0xff32, 0xfecf, 0xb4cb, 0x012e, 0x0993,
-  0x09f4, 0x09d2, 0x8c4e, 0xfff3, 0xffd3, 0xffd3, 0xce10, 0xad4f,
-  0xe6d1, 0xffd3, 0xff92, 0xff10, 0xddcc, 0x4aee, 0x0a14, 0x0a35,
-  0x12f8, 0x0ad8, 0x2230, 0xd60f, 0xff91, 0xffd3, 0xffd3, 0xfff3,
-  0xffb2, 0xff10, 0xfeae, 0xf64d, 0x8c0c, 0x0ad6, 0x139a, 0x1319,
-  0x139a, 0x13ba, 0x0ad8, 0x1a10, 0x738d, 0xd5ce, 0xfeaf, 0xf6ae,
-  0xf68e, 0xf64d, 0xacac, 0x42ad, 0x1274, 0x12f8, 0x12f8, 0x12f8,
-  0x1379, 0x139a, 0x1379, 0x1339, 0x0af7, 0x328f, 0x528a, 0x52ab,
-  0x4a8b, 0x4a8b, 0x1211, 0x0a97, 0x12d8, 0x12d7, 0x12b7, 0x12d7,
-  0x010e, 0x010e, 0x00ee, 0x010e, 0x00ee, 0x00cd, 0x00ab, 0x00ab,
-  0x00ac, 0x00ac, 0x00ce, 0x010e, 0x010e, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x010f, 0x00ee, 0x092c, 0x6bb1, 0xa532, 0xa512,
-  0xa512, 0xa512, 0x4ace, 0x08eb, 0x010f, 0x012f, 0x010f, 0x012f,
-  0x012f, 0x012f, 0x00ee, 0x6370, 0xdef7, 0xffd7, 0xfff5, 0xfff4,
-  0xfff4, 0xfff4, 0xf752, 0xd630, 0x320d, 0x012f, 0x0150, 0x012f,
-  0x0130, 0x010f, 0x428e, 0xffb8, 0xfff6, 0xffd6, 0xffb3, 0xffb2,
-  0xffb2, 0xff31, 0xff10, 0xffb2, 0xd670, 0x196c, 0x0110, 0x012f,
-  0x0130, 0x092d, 0xd696, 0xfff6, 0xffd6, 0xffd6, 0xffb3, 0xffb3,
-  0xff92, 0xff10, 0xff31, 0xff51, 0xfff3, 0xa48d, 0x00ed, 0x0130,
-  0x010f, 0x428e, 0xf776, 0xfff5, 0xffd4, 0xffb2, 0xffb3, 0xffb3,
-  0xffb3, 0xff92, 0xff71, 0xffb3, 0xffd3, 0xcdad, 0x196c, 0x0130,
-  0x00ee, 0x9cd2, 0xfff5, 0xd650, 0x6b8c, 0xef33, 0xffd3, 0xffb3,
-  0xffd3, 0xffd3, 0xe6f1, 0xffb3, 0xffb3, 0xfeef, 0x5aaa, 0x0131,
-  0x010f, 0x94b1, 0xfff4, 0x73ab, 0x10c8, 0xad51, 0xffd3, 0xffd3,
-  0xffb3, 0x7bac, 0x738b, 0xff93, 0xffd3, 0xfeef, 0x5aaa, 0x0151,
-  0x010f, 0x94b1, 0xfff5, 0x948d, 0x0006, 0x738c, 0xfff3, 0xffd3,
-  0xff93, 0xb54f, 0xb54e, 0xe6f1, 0xff92, 0xfeae, 0x52aa, 0x0151,
-  0x010f, 0x9cd2, 0xff95, 0xf693, 0xc5b0, 0xf752, 0xffd3, 0xffb3,
-  0xffd3, 0xfff3, 0xff93, 0xfed4, 0xfef1, 0xfe8e, 0x5aca, 0x0151,
-  0x2253, 0x42af, 0xf6b4, 0xfe95, 0xffd4, 0xd691, 0xd671, 0xffb3,
-  0xc5d0, 0xef32, 0xff34, 0xfe54, 0xfeb1, 0xcd8c, 0x21ad, 0x0193,
-  0x1214, 0x094e, 0xce10, 0xfff3, 0xffd3, 0xef32, 0x948d, 0x7bec,
-  0xad2e, 0xf7b3, 0xffd3, 0xff51, 0xf66d, 0x940b, 0x012f, 0x0993,
-  0x09d4, 0x01b3, 0x424c, 0xff71, 0xffd3, 0xffd3, 0xffb3, 0xff93,
-  0xffd3, 0xff92, 0xff10, 0xfece, 0xc52c, 0x11f0, 0x0a55, 0x0a35,
-  0x12f8, 0x12f8, 0x1255, 0x636e, 0xcdae, 0xff51, 0xff51, 0xff51,
-  0xff51, 0xfecf, 0xf64d, 0xac8b, 0x4310, 0x1379, 0x139a, 0x1339,
-  0x1379, 0x13ba, 0x1339, 0x0235, 0x1a11, 0x738c, 0xb4cb, 0xb4ab,
-  0xb4ab, 0xacab, 0x4aac, 0x1253, 0x0ad7, 0x1318, 0x12f8, 0x12f8,
-  0x1379, 0x1399, 0x139a, 0x1339, 0x137a, 0x0ad6, 0x0a32, 0x0a32,
-  0x0a32, 0x0a12, 0x0a97, 0x12d8, 0x12d7, 0x12d7, 0x12b7, 0x12b7,
-  0x010e, 0x010e, 0x010e, 0x00ee, 0x00ce, 0x00ec, 0x090b, 0x090b,
-  0x090b, 0x090b, 0x00cd, 0x00ee, 0x010e, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x010f, 0x092e, 0x3a2d, 0xa554, 0xd6b5, 0xd695,
-  0xd695, 0xd695, 0x7bef, 0x21ab, 0x00ee, 0x010f, 0x010f, 0x010e,
-  0x012f, 0x010f, 0x090d, 0x9d13, 0xffd8, 0xfff6, 0xffd3, 0xffd3,
-  0xffd3, 0xffb3, 0xff92, 0xf731, 0x52cd, 0x010e, 0x0970, 0x010f,
-  0x0130, 0x010e, 0x73d0, 0xfff8, 0xffd6, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xf711, 0xff31, 0xff92, 0xe6f1, 0x29ec, 0x010f, 0x0130,
-  0x0130, 0x116c, 0xef57, 0xffd5, 0xffd6, 0xffb5, 0xffb3, 0xffb3,
-  0xff92, 0xff11, 0xff10, 0xff72, 0xfff3, 0xaccc, 0x00cd, 0x0130,
-  0x00ee, 0x6370, 0xffb6, 0xffd5, 0xf752, 0xff92, 0xffb3, 0xffb3,
-  0xffb3, 0xffb2, 0xffb2, 0xffd3, 0xffd3, 0xddee, 0x29cc, 0x0110,
-  0x00ee, 0xa532, 0xfff5, 0xad2e, 0x4a6b, 0xf755, 0xffd3, 0xffb3,
-  0xffd3, 0xf732, 0xc5f0, 0xffb3, 0xffb3, 0xfecf, 0x528a, 0x0131,
-  0x010f, 0x9cf2, 0xfff4, 0x632b, 0x0867, 0x8c6f, 0xfff3, 0xffd3,
-  0xf792, 0x5aca, 0x73ac, 0xff92, 0xffb3, 0xfecf, 0x4a6a, 0x0151,
-  0x010f, 0x9cf2, 0xfff4, 0xa50e, 0x18e7, 0x9cae, 0xfff3, 0xffb3,
-  0xffb3, 0xdeb1, 0xd650, 0xe711, 0xff51, 0xfe8e, 0x4a6b, 0x0152,
-  0x010f, 0x9cf2, 0xff35, 0xfe55, 0xeed2, 0xffb3, 0xffd3, 0xffd3,
-  0xffb3, 0xffd3, 0xff34, 0xfe75, 0xf6d1, 0xf66d, 0x4a6b, 0x0172,
-  0x6416, 0x322d, 0xf6f3, 0xff14, 0xffd3, 0xce10, 0xbdaf, 0xded1,
-  0xa4ee, 0xef32, 0xff73, 0xfed3, 0xfed0, 0xbd0b, 0x094e, 0x09b3,
-  0x3af4, 0x096f, 0xad2f, 0xfff3, 0xffd3, 0xff92, 0xad2e, 0x8c6d,
-  0xce30, 0xffd3, 0xffd3, 0xff30, 0xe60d, 0x630c, 0x0150, 0x0993,
-  0x01d4, 0x0193, 0x320d, 0xeef0, 0xffd2, 0xffd3, 0xfff3, 0xfff3,
-  0xffd3, 0xff51, 0xfecf, 0xfeae, 0xa46c, 0x09f2, 0x0a76, 0x0a35,
-  0x12f8, 0x12d8, 0x0a76, 0x3a8e, 0x9c8d, 0xf6af, 0xff10, 0xff10,
-  0xff0f, 0xfe8e, 0xd58c, 0x6b6c, 0x22d3, 0x139a, 0x139a, 0x1359,
-  0x1379, 0x139a, 0x1379, 0x0a77, 0x0a13, 0x4acd, 0x7b6b, 0x736b,
-  0x736b, 0x736b, 0x224f, 0x0ad7, 0x12f8, 0x1318, 0x12f8, 0x12f8,
-  0x1399, 0x1399, 0x139a, 0x1339, 0x137a, 0x0b38, 0x0ab6, 0x0ad6,
-  0x0ab6, 0x0a76, 0x0ad8, 0x12f8, 0x12d7, 0x12d7, 0x12d7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ad, 0x114c, 0x21ab, 0x218b,
-  0x21ab, 0x21ac, 0x00ed, 0x00ce, 0x010e, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x00ee, 0x198e, 0x636f, 0xd676, 0xef56, 0xef56,
-  0xef56, 0xef56, 0x94af, 0x426c, 0x00ee, 0x010f, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x196d, 0xc635, 0xfff8, 0xffd5, 0xffd3, 0xffd3,
-  0xffd3, 0xff72, 0xff92, 0xff72, 0x634c, 0x00ce, 0x0150, 0x012f,
-  0x0130, 0x092e, 0x9d12, 0xfff7, 0xffd6, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xff11, 0xff31, 0xff92, 0xef11, 0x3a4c, 0x010f, 0x0130,
-  0x0110, 0x21cd, 0xffb7, 0xffd5, 0xfff6, 0xffb4, 0xffb3, 0xffb3,
-  0xffb2, 0xff31, 0xff10, 0xff92, 0xfff3, 0x9c6c, 0x00cd, 0x0130,
-  0x00ee, 0x8c92, 0xffd6, 0xff94, 0xde91, 0xff92, 0xffb3, 0xffb3,
-  0xffb3, 0xffd3, 0xffd3, 0xffb3, 0xffb3, 0xde0e, 0x29cb, 0x0130,
-  0x010e, 0xb593, 0xfff4, 0x840c, 0x422b, 0xef55, 0xffd3, 0xffb3,
-  0xffd3, 0xd650, 0xb54f, 0xffb3, 0xffb2, 0xfeae, 0x422a, 0x0151,
-  0x010e, 0xad73, 0xfff4, 0x5aca, 0x0027, 0x8c4e, 0xfff3, 0xffd3,
-  0xf752, 0x528a, 0x840c, 0xf792, 0xffb2, 0xf68e, 0x422b, 0x0152,
-  0x010e, 0xb593, 0xfff4, 0xad4e, 0x39e9, 0xc5d0, 0xfff3, 0xffb3,
-  0xffb3, 0xf772, 0xe6d1, 0xef52, 0xff30, 0xf66e, 0x422b, 0x0172,
-  0x010f, 0x9cf2, 0xfed5, 0xfe35, 0xff93, 0xf772, 0xffb3, 0xfff3,
-  0xf772, 0xffb3, 0xfef4, 0xfe36, 0xfed1, 0xe60d, 0x320c, 0x0172,
-  0x7476, 0x530e, 0xf732, 0xff73, 0xffd3, 0xc5ef, 0xad2f, 0xbdcf,
-  0x9cce, 0xf772, 0xffb3, 0xff12, 0xfecf, 0xa46b, 0x0130, 0x09b3,
-  0x4334, 0x2210, 0x9cae, 0xfff3, 0xffd3, 0xffb3, 0xc5cf, 0xad2f,
-  0xe6f1, 0xffd3, 0xff92, 0xfeef, 0xd58c, 0x3a4d, 0x0171, 0x0992,
-  0x2295, 0x0172, 0x320d, 0xde70, 0xff92, 0xffd3, 0xfff3, 0xfff3,
-  0xffb2, 0xff10, 0xfeae, 0xf64d, 0x7bad, 0x0a75, 0x0a55, 0x0a55,
-  0x1b39, 0x12b7, 0x0a97, 0x2230, 0x7bcc, 0xe60e, 0xfecf, 0xfeaf,
-  0xfeae, 0xf64d, 0xacac, 0x42ad, 0x1316, 0x13ba, 0x139a, 0x137a,
-  0x1379, 0x139a, 0x139a, 0x0ad8, 0x0a34, 0x326e, 0x528b, 0x4aab,
-  0x4aab, 0x4a8c, 0x1233, 0x1339, 0x1319, 0x1318, 0x12f8, 0x12f8,
-  0x1399, 0x1399, 0x139a, 0x1359, 0x1359, 0x1359, 0x0af8, 0x0b18,
-  0x0b18, 0x0af8, 0x12f8, 0x12f8, 0x12d7, 0x12d7, 0x12d7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ac, 0x21cd, 0x530e, 0x4aad,
-  0x426c, 0x428d, 0x114d, 0x00ad, 0x010e, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x00ee, 0x21ee, 0x8451, 0xe6f6, 0xffb6, 0xffb6,
-  0xffb6, 0xffd6, 0xbdd0, 0x6b6d, 0x010e, 0x010f, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x21ad, 0xd6b6, 0xfff8, 0xffd5, 0xffb2, 0xffb2,
-  0xffb2, 0xff51, 0xff51, 0xffd2, 0x8c4d, 0x00cd, 0x0130, 0x012f,
-  0x0130, 0x092e, 0xad73, 0xfff7, 0xffd6, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xff10, 0xff31, 0xff51, 0xf792, 0x5b0c, 0x00ee, 0x0130,
-  0x0110, 0x21ad, 0xf777, 0xffd5, 0xfff5, 0xffb3, 0xffb3, 0xffb3,
-  0xffb3, 0xff31, 0xff11, 0xff92, 0xfff3, 0xb4ec, 0x00ed, 0x0130,
-  0x00cd, 0x8c92, 0xfff6, 0xf753, 0xbdd0, 0xf772, 0xffd3, 0xffb3,
-  0xffb3, 0xfff3, 0xffb3, 0xffb3, 0xffb3, 0xee6e, 0x3a2b, 0x0110,
-  0x00ee, 0xa532, 0xfff4, 0x7bec, 0x29aa, 0xe6f5, 0xffd3, 0xffb3,
-  0xffd3, 0xbdaf, 0x9cad, 0xffb3, 0xffb3, 0xfecf, 0x4a6a, 0x0131,
-  0x010f, 0xa512, 0xfff4, 0x6b4b, 0x0006, 0x73ac, 0xfff3, 0xffd3,
-  0xf772, 0x632b, 0x8c2d, 0xf752, 0xff92, 0xfeae, 0x424b, 0x0152,
-  0x010f, 0xa532, 0xfff4, 0xce10, 0x62eb, 0xce30, 0xfff3, 0xffb3,
-  0xffd3, 0xffd3, 0xf752, 0xf732, 0xff31, 0xfe8e, 0x4a6b, 0x0152,
-  0x0130, 0x8451, 0xfeb5, 0xfe36, 0xffb4, 0xef32, 0xff72, 0xfff3,
-  0xef12, 0xff92, 0xfef4, 0xfe16, 0xfeb1, 0xe5ed, 0x320c, 0x0172,
-  0x5395, 0x636f, 0xeef2, 0xffb3, 0xffd3, 0xd650, 0x9cae, 0x9cee,
-  0x9cad, 0xf772, 0xffd3, 0xff52, 0xfeaf, 0xa48b, 0x012f, 0x09b3,
-  0x32b4, 0x3272, 0x73ad, 0xfff3, 0xffd3, 0xffd3, 0xde91, 0xc610,
-  0xef32, 0xffd3, 0xff72, 0xfeef, 0xd58c, 0x2a0d, 0x0192, 0x0992,
-  0x3337, 0x0173, 0x19ae, 0xbd8e, 0xff31, 0xffd2, 0xffb2, 0xffd3,
-  0xff92, 0xfef0, 0xfeae, 0xe5ec, 0x6b8e, 0x0ab6, 0x0a76, 0x0a76,
-  0x1b79, 0x1297, 0x0a97, 0x1212, 0x5b0d, 0xc54d, 0xf66e, 0xee4e,
-  0xee4d, 0xe60d, 0x940b, 0x328f, 0x1317, 0x13ba, 0x13ba, 0x139a,
-  0x1379, 0x137a, 0x139a, 0x1319, 0x0a76, 0x1a30, 0x322d, 0x322d,
-  0x324d, 0x2a2d, 0x0a54, 0x1339, 0x1339, 0x1318, 0x1318, 0x12f8,
-  0x139a, 0x1399, 0x139a, 0x1379, 0x1339, 0x137a, 0x0b39, 0x1359,
-  0x137a, 0x1339, 0x12f8, 0x12f8, 0x12d7, 0x12d7, 0x12b7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ac, 0x3a4e, 0x6b8f, 0x6b8f,
-  0x6b6e, 0x6b8e, 0x29cd, 0x008c, 0x00ee, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x00ee, 0x2a0f, 0xa533, 0xef36, 0xfff6, 0xffd5,
-  0xfff5, 0xfff6, 0xdeb1, 0x94ae, 0x196d, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x218d, 0xded6, 0xfff7, 0xffd6, 0xffb3, 0xffb2,
-  0xffb2, 0xff51, 0xff31, 0xffd2, 0xbd6f, 0x090c, 0x012f, 0x012f,
-  0x0130, 0x010d, 0xad73, 0xfff7, 0xffd5, 0xffd8, 0xffb3, 0xffb3,
-  0xff92, 0xf710, 0xff51, 0xff31, 0xffd3, 0x840d, 0x00ee, 0x0130,
-  0x0110, 0x21ad, 0xef36, 0xfff5, 0xfff5, 0xffd3, 0xffb3, 0xffb3,
-  0xffb3, 0xff71, 0xff31, 0xff92, 0xfff3, 0xcd8d, 0x092c, 0x0130,
-  0x00ce, 0x8431, 0xfff6, 0xef32, 0x9cce, 0xef32, 0xffd3, 0xffb3,
-  0xffb3, 0xfff3, 0xff93, 0xffb3, 0xffb3, 0xfecf, 0x5aaa, 0x010f,
-  0x00ef, 0x8c71, 0xfff5, 0x8c4c, 0x10e8, 0xc613, 0xffd3, 0xffb3,
-  0xffd3, 0xad2e, 0x83ec, 0xff92, 0xffd3, 0xfeef, 0x5aca, 0x0130,
-  0x0110, 0x8451, 0xfff5, 0x8c4c, 0x0005, 0x52cb, 0xfff3, 0xffd3,
-  0xff92, 0x840c, 0x8c2d, 0xe6f1, 0xffb2, 0xfecf, 0x5acb, 0x0131,
-  0x0110, 0x8c71, 0xffd5, 0xe692, 0x8c2d, 0xd671, 0xfff3, 0xffb3,
-  0xffd3, 0xfff3, 0xff93, 0xf713, 0xff31, 0xfeae, 0x62eb, 0x0151,
-  0x0151, 0x5b2f, 0xf6b4, 0xfe15, 0xff94, 0xef11, 0xeef2, 0xfff3,
-  0xde91, 0xf752, 0xff34, 0xfe15, 0xfeb2, 0xdded, 0x322c, 0x0172,
-  0x2a94, 0x6391, 0xce50, 0xfff3, 0xffd3, 0xe6f1, 0x946d, 0x8c4d,
-  0x9c8d, 0xef52, 0xffd3, 0xff72, 0xf6ae, 0xacac, 0x012f, 0x09b3,
-  0x11f3, 0x3ad3, 0x4aac, 0xff92, 0xffd3, 0xffd3, 0xef32, 0xe6d1,
-  0xf772, 0xffd3, 0xff51, 0xfeef, 0xd5ac, 0x21cd, 0x0992, 0x09b3,
-  0x3357, 0x09d3, 0x0970, 0x944e, 0xe68f, 0xffb2, 0xff92, 0xffb2,
-  0xff92, 0xfeef, 0xfe8e, 0xd56c, 0x636e, 0x0af7, 0x0a76, 0x0a76,
-  0x1b99, 0x1276, 0x0ab7, 0x0a34, 0x324e, 0x9c4c, 0xddcd, 0xddad,
-  0xddac, 0xd5ac, 0x7b8b, 0x2270, 0x1338, 0x13ba, 0x13ba, 0x139a,
-  0x139a, 0x1379, 0x13ba, 0x1359, 0x0a97, 0x1233, 0x19ce, 0x19ef,
-  0x222f, 0x19ef, 0x0a75, 0x1339, 0x1359, 0x1318, 0x1318, 0x12f8,
-  0x1399, 0x1399, 0x139a, 0x139a, 0x1339, 0x1379, 0x135a, 0x1359,
-  0x139a, 0x135a, 0x12f8, 0x12f8, 0x12d8, 0x12d7, 0x12b7, 0x12b7,
-  0x010e, 0x010e, 0x010e, 0x00ee, 0x00ab, 0x428e, 0x7c10, 0x7c10,
-  0x7bef, 0x7bef, 0x3a4e, 0x00ab, 0x00ee, 0x010e, 0x010e, 0x00ee,
-  0x012f, 0x010f, 0x00ee, 0x2a2f, 0xb594, 0xef56, 0xfff6, 0xfff5,
-  0xfff5, 0xfff5, 0xe6f2, 0xad2f, 0x21cd, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x198c, 0xded6, 0xfff7, 0xffd6, 0xffb3, 0xffb2,
-  0xffb2, 0xff51, 0xff30, 0xffd2, 0xce0f, 0x112c, 0x010f, 0x012f,
-  0x0130, 0x00ed, 0xad73, 0xfff7, 0xffb5, 0xffd7, 0xffb3, 0xffb3,
-  0xffb2, 0xff10, 0xff51, 0xff31, 0xfff3, 0x9c8d, 0x00ed, 0x0130,
-  0x0110, 0x198d, 0xe6f5, 0xffd5, 0xfff5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xff92, 0xff71, 0xffb2, 0xfff3, 0xd5ee, 0x114c, 0x0130,
-  0x00ce, 0x7bf0, 0xfff6, 0xffd3, 0xc5ef, 0x9cae, 0xffb3, 0xffb3,
-  0xffd3, 0xef12, 0x8c4d, 0xe6f2, 0xffd3, 0xfeef, 0x62ea, 0x00ef,
-  0x010f, 0x7c10, 0xfff5, 0xffd3, 0x4229, 0x3a0c, 0xded3, 0xffd3,
-  0xfff3, 0x948d, 0x08a8, 0xad72, 0xffd3, 0xff0f, 0x630a, 0x0130,
-  0x0110, 0x7c10, 0xfff5, 0xffd3, 0x4aaa, 0x0006, 0xa50e, 0xfff3,
-  0xfff3, 0x9cee, 0x0006, 0x52aa, 0xffb2, 0xfecf, 0x630b, 0x0131,
-  0x0110, 0x8430, 0xfff5, 0xff53, 0xde12, 0xa50e, 0xff93, 0xffd3,
-  0xffd3, 0xff92, 0xa50e, 0xde52, 0xfef2, 0xfe8e, 0x6b0b, 0x0131,
-  0x0152, 0x42af, 0xef53, 0xfe95, 0xfe75, 0xfff4, 0xd650, 0xff92,
-  0xffb3, 0xce10, 0xfff3, 0xfef4, 0xfdf4, 0xe5ce, 0x3a2c, 0x0172,
-  0x09b3, 0x2a0f, 0xce30, 0xfff3, 0xffd3, 0xffd3, 0xce30, 0x8c2d,
-  0x840c, 0xc5cf, 0xffd3, 0xff72, 0xf6ae, 0xaccc, 0x012f, 0x09b3,
-  0x0192, 0x2a73, 0x4aad, 0xff51, 0xfff3, 0xffb3, 0xffd3, 0xf752,
-  0xef32, 0xffd3, 0xff51, 0xfeef, 0xddac, 0x21ad, 0x0192, 0x09b3,
-  0x1a75, 0x2295, 0x0150, 0x7bcd, 0xde2f, 0xff92, 0xff92, 0xff92,
-  0xff91, 0xfeef, 0xfe8e, 0xcd4c, 0x5b6e, 0x1317, 0x12b7, 0x0a76,
-  0x1b79, 0x1296, 0x0a97, 0x0a76, 0x2250, 0x8bec, 0xd58c, 0xcd6c,
-  0xcd6c, 0xcd6c, 0x736c, 0x1a71, 0x0b38, 0x13ba, 0x13ba, 0x139a,
-  0x139a, 0x1379, 0x139a, 0x139a, 0x0af8, 0x0a54, 0x11cf, 0x11d0,
-  0x1a51, 0x1210, 0x0a76, 0x1319, 0x1379, 0x1318, 0x1318, 0x12f8,
-  0x1399, 0x139a, 0x139a, 0x139a, 0x1359, 0x1379, 0x137a, 0x1339,
-  0x1bba, 0x137a, 0x1319, 0x12f8, 0x12d8, 0x12d7, 0x12b7, 0x12b7,
-  0x010e, 0x010e, 0x010e, 0x00ee, 0x00ab, 0x324e, 0x6b8f, 0x6b8f,
-  0x6b8f, 0x6b8e, 0x2a0d, 0x008c, 0x00ee, 0x010e, 0x010e, 0x00ee,
-  0x012f, 0x010f, 0x00ee, 0x2a0f, 0xa553, 0xef36, 0xfff6, 0xfff5,
-  0xfff5, 0xfff6, 0xded2, 0x9cce, 0x198d, 0x00ee, 0x010f, 0x010e,
-  0x012f, 0x010f, 0x196c, 0xdeb6, 0xfff8, 0xffd6, 0xffb3, 0xffb2,
-  0xffb2, 0xff51, 0xff31, 0xffd2, 0xc5af, 0x090c, 0x010f, 0x012f,
-  0x0130, 0x010d, 0xad53, 0xfff7, 0xffb5, 0xffd7, 0xffb3, 0xffb3,
-  0xffb2, 0xf710, 0xff51, 0xff31, 0xfff3, 0x8c4d, 0x00ee, 0x0130,
-  0x0110, 0x198d, 0xe6f6, 0xffd5, 0xfff5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xff72, 0xff71, 0xffb2, 0xfff3, 0xcdce, 0x112c, 0x0130,
-  0x00ce, 0x7bf0, 0xfff6, 0xffd3, 0xce30, 0xa4ee, 0xffb3, 0xffb3,
-  0xffd3, 0xef32, 0x94ae, 0xef12, 0xffd3, 0xfeef, 0x5aca, 0x00ef,
-  0x010f, 0x8430, 0xfff5, 0xffd2, 0x3a29, 0x424c, 0xe6f4, 0xffd3,
-  0xfff3, 0x948d, 0x10c8, 0xbdd3, 0xffd3, 0xff0f, 0x62ea, 0x0130,
-  0x0110, 0x7c10, 0xfff5, 0xffd2, 0x426a, 0x0006, 0xa50e, 0xfff3,
-  0xfff3, 0x94ad, 0x0006, 0x52ca, 0xffd2, 0xfecf, 0x62ea, 0x0131,
-  0x0110, 0x8430, 0xfff5, 0xff73, 0xcdf1, 0x9cae, 0xf772, 0xffd3,
-  0xffd3, 0xf752, 0x94ae, 0xd651, 0xff12, 0xfe8e, 0x630b, 0x0131,
-  0x0151, 0x4aef, 0xf773, 0xfe75, 0xfe75, 0xfff4, 0xd670, 0xff93,
-  0xffb3, 0xd650, 0xfff3, 0xfed4, 0xfdf4, 0xe5ce, 0x3a2c, 0x0172,
-  0x01b3, 0x116e, 0xd651, 0xfff3, 0xffd3, 0xffd3, 0xc5f0, 0x8c2d,
-  0x8c2d, 0xbdaf, 0xffd3, 0xff72, 0xf6ae, 0xb4cc, 0x012f, 0x09b3,
-  0x0193, 0x09d2, 0x5b0d, 0xff72, 0xfff3, 0xffb3, 0xffd3, 0xef12,
-  0xef12, 0xffd3, 0xff51, 0xfeef, 0xddac, 0x21cd, 0x0192, 0x0992,
-  0x09f4, 0x2ad5, 0x0970, 0x840e, 0xe66f, 0xffb2, 0xff92, 0xff92,
-  0xff92, 0xfeef, 0xfe8e, 0xd56c, 0x636e, 0x12f7, 0x12f8, 0x0a96,
-  0x1379, 0x1ab6, 0x0a96, 0x0a75, 0x2a70, 0x942c, 0xddac, 0xd5ac,
-  0xd58c, 0xd58c, 0x7b8b, 0x2270, 0x0b17, 0x13ba, 0x13ba, 0x139a,
-  0x139a, 0x137a, 0x139a, 0x13ba, 0x1339, 0x1254, 0x19ef, 0x11cf,
-  0x2230, 0x1a30, 0x0a75, 0x0af8, 0x1379, 0x1318, 0x1318, 0x12f8,
-  0x1399, 0x139a, 0x1399, 0x139a, 0x139a, 0x1379, 0x139a, 0x1339,
-  0x139a, 0x139a, 0x1359, 0x12f8, 0x12f8, 0x12d7, 0x12d7, 0x12b7,
-  0x010e, 0x010e, 0x010e, 0x00ee, 0x008c, 0x29cd, 0x52cd, 0x52cd,
-  0x634f, 0x52cd, 0x198d, 0x00ac, 0x00ee, 0x010e, 0x00ee, 0x00ee,
-  0x010f, 0x012f, 0x00ee, 0x21ce, 0x8c91, 0xded6, 0xffd6, 0xffd6,
-  0xffb5, 0xffd6, 0xce51, 0x7bed, 0x114d, 0x010e, 0x010f, 0x010e,
-  0x012f, 0x010f, 0x196d, 0xce75, 0xfff8, 0xffd5, 0xffb3, 0xffb2,
-  0xffb2, 0xff51, 0xff51, 0xffd2, 0xa4ee, 0x00ec, 0x012f, 0x012f,
-  0x0130, 0x010e, 0xa512, 0xfff7, 0xffd5, 0xffd7, 0xffb3, 0xffb3,
-  0xff92, 0xf710, 0xff51, 0xff31, 0xffd2, 0x73ac, 0x00ee, 0x0130,
-  0x0130, 0x196d, 0xef16, 0xffd5, 0xfff5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xff51, 0xff51, 0xffb2, 0xfff3, 0xc56d, 0x090c, 0x0130,
-  0x00ce, 0x7c11, 0xffd6, 0xffd3, 0xd671, 0xb58f, 0xffb3, 0xffb3,
-  0xffd3, 0xf752, 0xad2f, 0xef32, 0xffd3, 0xf6af, 0x528b, 0x010f,
-  0x010f, 0x8c71, 0xfff5, 0xffb2, 0x3a09, 0x4aad, 0xef54, 0xffd3,
-  0xfff3, 0x8c4d, 0x1909, 0xce54, 0xffd3, 0xfeef, 0x5aaa, 0x0130,
-  0x0110, 0x8451, 0xfff5, 0xffb2, 0x31e9, 0x0006, 0xad4f, 0xfff3,
-  0xfff3, 0x842d, 0x0006, 0x5aeb, 0xffd2, 0xfecf, 0x5aaa, 0x0131,
-  0x0110, 0x8c71, 0xfff5, 0xff93, 0xbd70, 0x840d, 0xf752, 0xffd3,
-  0xffd3, 0xe6f1, 0x7bcc, 0xce11, 0xff32, 0xfe8e, 0x5aca, 0x0151,
-  0x0151, 0x5b50, 0xf793, 0xfe55, 0xfe75, 0xfff4, 0xdeb1, 0xffd3,
-  0xffb3, 0xdeb1, 0xfff3, 0xfeb5, 0xfdd5, 0xe5ee, 0x3a2c, 0x0172,
-  0x0193, 0x094e, 0xde91, 0xffd3, 0xffb3, 0xffd3, 0xbd8f, 0x948d,
-  0x948d, 0xbd8f, 0xffd3, 0xff72, 0xfeae, 0xb4cc, 0x012f, 0x09b3,
-  0x0993, 0x0172, 0x5b0d, 0xffb2, 0xffd3, 0xffd3, 0xffb3, 0xdeb1,
-  0xdeb1, 0xffd3, 0xff72, 0xfeef, 0xddac, 0x29ed, 0x0192, 0x0992,
-  0x09d3, 0x1a75, 0x2210, 0x9cae, 0xeed0, 0xffb2, 0xff92, 0xffb2,
-  0xffb2, 0xfef0, 0xfeae, 0xddcc, 0x6b8d, 0x0ad6, 0x1318, 0x0a96,
-  0x1379, 0x12d7, 0x1276, 0x0a33, 0x42ae, 0xaccc, 0xee2d, 0xe60d,
-  0xe60d, 0xe5ed, 0x8beb, 0x2a4f, 0x12f7, 0x13ba, 0x13ba, 0x139a,
-  0x139a, 0x139a, 0x139a, 0x13ba, 0x1379, 0x1273, 0x220d, 0x21ed,
-  0x222e, 0x2a6f, 0x0a75, 0x0ad8, 0x1339, 0x1339, 0x1318, 0x1318,
-  0x1399, 0x139a, 0x1399, 0x139a, 0x13ba, 0x139a, 0x137a, 0x1359,
-  0x1359, 0x139a, 0x1359, 0x12f8, 0x12f8, 0x12d8, 0x12b7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x00ac, 0x198d, 0x428c, 0x426c,
-  0x52ee, 0x52ee, 0x196d, 0x008c, 0x00ee, 0x010e, 0x00ee, 0x00ee,
-  0x010e, 0x012f, 0x00ee, 0x198e, 0x7c30, 0xd696, 0xffd6, 0xffb6,
-  0xffb6, 0xffd6, 0xce31, 0x73ac, 0x094d, 0x010f, 0x010f, 0x010e,
-  0x012f, 0x010f, 0x112c, 0xc614, 0xfff8, 0xfff6, 0xffb3, 0xffb2,
-  0xffb2, 0xff71, 0xff51, 0xffd2, 0xa4ee, 0x00ec, 0x010f, 0x012f,
-  0x0130, 0x010e, 0x94b2, 0xfff7, 0xffd5, 0xffd8, 0xffb3, 0xffb3,
-  0xff92, 0xf710, 0xff51, 0xff31, 0xffd2, 0x73ad, 0x00ee, 0x0130,
-  0x0130, 0x114c, 0xe6f6, 0xfff5, 0xffd5, 0xfff4, 0xffb3, 0xffb3,
-  0xffb3, 0xff51, 0xff51, 0xff92, 0xfff3, 0xcd8d, 0x29cc, 0x0130,
-  0x00ce, 0x6bb0, 0xffd6, 0xffd3, 0xdeb1, 0xbdaf, 0xffb3, 0xffb3,
-  0xffd3, 0xf772, 0xb58f, 0xef32, 0xffd3, 0xf6af, 0x62eb, 0x010f,
-  0x010f, 0x7c30, 0xfff5, 0xffd2, 0x4a69, 0x4a8d, 0xef55, 0xffd3,
-  0xfff3, 0x9cad, 0x1109, 0xce54, 0xffd3, 0xfeef, 0x62ca, 0x0130,
-  0x0110, 0x7c11, 0xfff5, 0xffd2, 0x3a29, 0x0006, 0xa50e, 0xfff3,
-  0xfff3, 0x8c6d, 0x0006, 0x52ab, 0xffd3, 0xfecf, 0x62ea, 0x0131,
-  0x0110, 0x8431, 0xfff5, 0xffb3, 0xbd6f, 0x738c, 0xef32, 0xffd3,
-  0xffd3, 0xe6f1, 0x738c, 0xc5d0, 0xff32, 0xfeae, 0x62eb, 0x0131,
-  0x0151, 0x5b50, 0xf794, 0xfe55, 0xfe56, 0xfff4, 0xe6f1, 0xffd3,
-  0xffd3, 0xe6d1, 0xfff3, 0xfed5, 0xfdd5, 0xedef, 0x426c, 0x0172,
-  0x01b3, 0x094e, 0xd671, 0xffd3, 0xffb3, 0xffd3, 0xbdaf, 0x9cae,
-  0x9cad, 0xb54f, 0xffd3, 0xff72, 0xfeaf, 0xbd0c, 0x012e, 0x09b3,
-  0x0993, 0x0172, 0x52ed, 0xffb2, 0xffd3, 0xffb3, 0xffb3, 0xd691,
-  0xd671, 0xffb3, 0xff92, 0xfeef, 0xe5ec, 0x320d, 0x0192, 0x0993,
-  0x09f4, 0x11f4, 0x32b2, 0xa4ce, 0xf6f0, 0xffd2, 0xff92, 0xffb2,
-  0xffb2, 0xff10, 0xfeae, 0xe5ed, 0x7bad, 0x0ab5, 0x1339, 0x12b7,
-  0x139a, 0x12f7, 0x1296, 0x0a33, 0x42ce, 0xb4cc, 0xee4d, 0xee2d,
-  0xee2d, 0xe60d, 0x942b, 0x326f, 0x12d6, 0x13ba, 0x139a, 0x13ba,
-  0x139a, 0x139a, 0x139a, 0x13ba, 0x1359, 0x1a93, 0x2a2d, 0x2a0d,
-  0x2a0e, 0x328f, 0x1274, 0x0ad8, 0x1319, 0x1359, 0x12f8, 0x1318,
-  0x1399, 0x139a, 0x1399, 0x139a, 0x13ba, 0x139a, 0x137a, 0x135a,
-  0x1339, 0x139a, 0x1379, 0x1318, 0x12f8, 0x12d8, 0x12d7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x008c, 0x116d, 0x426c, 0x426c,
-  0x4a8d, 0x5b2e, 0x218d, 0x008c, 0x00ee, 0x010e, 0x00ee, 0x00ee,
-  0x010e, 0x012f, 0x010f, 0x094e, 0x73f0, 0xce55, 0xffd7, 0xffb6,
-  0xffb6, 0xffb6, 0xd672, 0x7bec, 0x196d, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x00ec, 0xad53, 0xfff8, 0xfff6, 0xffb3, 0xffb2,
-  0xffb2, 0xff71, 0xff31, 0xfff2, 0xbd8f, 0x092c, 0x010f, 0x012f,
-  0x0130, 0x00ee, 0x73f0, 0xfff8, 0xffd5, 0xffd8, 0xffb3, 0xffb3,
-  0xffb3, 0xf710, 0xff51, 0xff31, 0xfff3, 0x9c8d, 0x010e, 0x0110,
-  0x0130, 0x010d, 0xce54, 0xfff6, 0xffd5, 0xfff4, 0xffb3, 0xffb3,
-  0xffb3, 0xff71, 0xff51, 0xff92, 0xfff3, 0xde2e, 0x4aac, 0x21f0,
-  0x00ef, 0x52ef, 0xffb7, 0xffd3, 0xef12, 0xb58f, 0xff93, 0xffd3,
-  0xffd3, 0xff93, 0xbdaf, 0xe6f2, 0xffd3, 0xfef0, 0x83cb, 0x094f,
-  0x0110, 0x634f, 0xfff5, 0xfff3, 0x632b, 0x31eb, 0xe715, 0xffd3,
-  0xfff3, 0xb58f, 0x08c8, 0xbdb3, 0xffd3, 0xff30, 0x7b6a, 0x010f,
-  0x0131, 0x5b4f, 0xfff5, 0xfff3, 0x52ca, 0x0006, 0x8c4d, 0xfff3,
-  0xfff3, 0xad4e, 0x0006, 0x3a09, 0xffb2, 0xff0f, 0x7b8b, 0x0130,
-  0x0131, 0x636f, 0xfff5, 0xffb3, 0xc5f0, 0x6b4b, 0xded1, 0xffd3,
-  0xffd3, 0xf752, 0x7bac, 0xad4f, 0xff52, 0xfeae, 0x838b, 0x0130,
-  0x0152, 0x42af, 0xef74, 0xfe94, 0xfe36, 0xffd4, 0xe711, 0xff93,
-  0xfff3, 0xe6d1, 0xfff3, 0xff14, 0xfdd5, 0xf60f, 0x5aeb, 0x0151,
-  0x09b3, 0x012f, 0xbdcf, 0xfff3, 0xffb3, 0xffd3, 0xc5f0, 0x948e,
-  0x9cae, 0xa50e, 0xffb3, 0xff92, 0xf6af, 0xd58c, 0x114d, 0x01b3,
-  0x0993, 0x0172, 0x3a6d, 0xf751, 0xfff3, 0xffb3, 0xffd3, 0xde91,
-  0xd651, 0xff93, 0xff92, 0xff10, 0xee2d, 0x426c, 0x0992, 0x09b3,
-  0x09f4, 0x01b3, 0x32b3, 0x948e, 0xeed0, 0xffd2, 0xff92, 0xffb2,
-  0xffd2, 0xff10, 0xfece, 0xee0d, 0x8c0c, 0x1294, 0x1359, 0x12f8,
-  0x139a, 0x1318, 0x1ab7, 0x0a34, 0x3aaf, 0xa48c, 0xee4d, 0xee2d,
-  0xee2d, 0xee2d, 0xa46b, 0x3a8e, 0x0a95, 0x13ba, 0x139a, 0x13ba,
-  0x139a, 0x13ba, 0x139a, 0x13ba, 0x137a, 0x12d4, 0x2a2d, 0x2a0d,
-  0x2a0d, 0x326e, 0x1273, 0x0ad8, 0x1318, 0x1359, 0x12f8, 0x1318,
-  0x1379, 0x139a, 0x139a, 0x1399, 0x13ba, 0x13ba, 0x137a, 0x137a,
-  0x1339, 0x137a, 0x139a, 0x1359, 0x12f8, 0x12d8, 0x12d7, 0x12b7,
-  0x00ee, 0x00ee, 0x010e, 0x012f, 0x00ed, 0x114d, 0x52cd, 0x52cd,
-  0x52cd, 0x5b4e, 0x428e, 0x008c, 0x00ee, 0x010e, 0x00ee, 0x00ee,
-  0x010e, 0x010f, 0x010f, 0x094e, 0x7c31, 0xc635, 0xffd7, 0xffd6,
-  0xffd6, 0xffd6, 0xe713, 0x948d, 0x29ed, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x012f, 0x00cd, 0x9cf2, 0xfff9, 0xfff6, 0xffb3, 0xffb2,
-  0xffb2, 0xff72, 0xff30, 0xffd2, 0xde50, 0x218c, 0x010f, 0x012f,
-  0x0130, 0x00ee, 0x6370, 0xffb7, 0xffd5, 0xffd8, 0xffb4, 0xffb2,
-  0xffb3, 0xf710, 0xff71, 0xf710, 0xfff3, 0xbd6e, 0x3a2d, 0x00ef,
-  0x0130, 0x00ed, 0xad73, 0xfff6, 0xffd5, 0xfff4, 0xffb3, 0xffb3,
-  0xffb3, 0xff72, 0xff51, 0xff92, 0xffd3, 0xeeaf, 0x736d, 0x7c52,
-  0x010f, 0x3a4d, 0xf797, 0xffd4, 0xef32, 0xa52e, 0xf752, 0xffd3,
-  0xffb3, 0xffb3, 0xb58f, 0xd671, 0xfff3, 0xff30, 0x9c6c, 0x3a6f,
-  0x0131, 0x428e, 0xffd5, 0xfff3, 0x840c, 0x1929, 0xd674, 0xffd3,
-  0xfff3, 0xce50, 0x08a7, 0x94d2, 0xffd4, 0xff50, 0x9c2b, 0x00ce,
-  0x0152, 0x428e, 0xffd5, 0xfff3, 0x7bec, 0x0006, 0x632b, 0xfff3,
-  0xfff3, 0xce10, 0x0046, 0x1928, 0xef32, 0xff30, 0x9c2b, 0x010f,
-  0x0152, 0x428e, 0xfff6, 0xffb3, 0xde72, 0x7bcc, 0xd671, 0xfff3,
-  0xffb3, 0xffb2, 0x948d, 0xad0f, 0xff53, 0xfeaf, 0x9c4b, 0x010f,
-  0x0172, 0x2a0f, 0xdef3, 0xfed4, 0xfe16, 0xffb4, 0xe711, 0xf752,
-  0xfff3, 0xde91, 0xffd3, 0xff54, 0xfdd5, 0xf610, 0x6b4b, 0x0150,
-  0x09b3, 0x0130, 0x9cae, 0xfff3, 0xffb3, 0xffd3, 0xde91, 0x946d,
-  0x8c8d, 0xa4ce, 0xf793, 0xffb2, 0xf6cf, 0xdded, 0x198c, 0x0193,
-  0x0993, 0x0192, 0x21cd, 0xe6b0, 0xfff3, 0xffb3, 0xffd3, 0xe712,
-  0xde91, 0xff93, 0xff92, 0xff10, 0xf66d, 0x52ab, 0x0992, 0x09b3,
-  0x09f4, 0x09b3, 0x11d2, 0x842f, 0xde2f, 0xffb2, 0xff92, 0xffb2,
-  0xffb2, 0xff30, 0xfece, 0xee0d, 0x940c, 0x1232, 0x1318, 0x1338,
-  0x139a, 0x1359, 0x12b7, 0x1275, 0x2250, 0x83ec, 0xdded, 0xdded,
-  0xdded, 0xe60d, 0xa46b, 0x3aae, 0x09f2, 0x137a, 0x13ba, 0x139a,
-  0x139a, 0x13ba, 0x139a, 0x139a, 0x139a, 0x0af6, 0x222f, 0x2a2e,
-  0x21ee, 0x220e, 0x1a93, 0x0ad8, 0x12f8, 0x1339, 0x1318, 0x12f8,
-  0x1359, 0x139a, 0x139a, 0x1399, 0x139a, 0x3c5b, 0xb6be, 0xc71f,
-  0xa65d, 0x2bba, 0x139a, 0x1359, 0x12f8, 0x12f8, 0x12d7, 0x12b7,
-  0x00ee, 0x010e, 0x010e, 0x00ee, 0x00cc, 0x21cd, 0x73cf, 0x73cf,
-  0x73cf, 0x73ef, 0x6bb1, 0x00cb, 0x00ee, 0x010e, 0x010e, 0x00ee,
-  0x010f, 0x010f, 0x010e, 0x116e, 0x9d13, 0xded6, 0xfff6, 0xfff5,
-  0xfff5, 0xfff6, 0xf753, 0xb56e, 0x426d, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x012f, 0x00ec, 0xb593, 0xfff8, 0xfff6, 0xffb4, 0xffb2,
-  0xffb2, 0xff71, 0xff10, 0xffb2, 0xe6d1, 0x29cc, 0x010f, 0x010f,
-  0x0130, 0x00ce, 0x7c10, 0xfff7, 0xffd4, 0xffd8, 0xffb4, 0xffb2,
-  0xffb3, 0xf710, 0xff71, 0xff10, 0xfff3, 0xbd6e, 0x5b2e, 0x19d0,
-  0x0130, 0x090d, 0xbdb3, 0xfff6, 0xffd5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xff92, 0xff71, 0xffb2, 0xffd3, 0xe68f, 0x946f, 0xadb5,
-  0x010f, 0x426e, 0xffd7, 0xffd3, 0xdeb1, 0x8c4d, 0xf753, 0xffd3,
-  0xffd3, 0xff92, 0x94ad, 0xce51, 0xfff3, 0xff30, 0x9c2c, 0x42b0,
-  0x0130, 0x428e, 0xffd5, 0xfff3, 0x73ac, 0x1909, 0xc613, 0xffd3,
-  0xfff3, 0xc610, 0x0067, 0x8c71, 0xffb3, 0xff50, 0x940b, 0x00ce,
-  0x0152, 0x428e, 0xffd6, 0xfff3, 0x840c, 0x0006, 0x6b6b, 0xfff3,
-  0xfff3, 0xce30, 0x0066, 0x1948, 0xf752, 0xff0f, 0x940b, 0x010f,
-  0x0152, 0x42ae, 0xfff6, 0xff73, 0xee92, 0x9cae, 0xe6f2, 0xfff3,
-  0xffb3, 0xffd3, 0xb56f, 0xc5d0, 0xff13, 0xfe8f, 0x9c4b, 0x010f,
-  0x0172, 0x21ef, 0xd692, 0xfef4, 0xfe35, 0xffd4, 0xdeb1, 0xeef2,
-  0xfff3, 0xce10, 0xffd3, 0xff54, 0xfdf5, 0xf610, 0x5aeb, 0x0151,
-  0x09b3, 0x0130, 0x948e, 0xfff3, 0xffd3, 0xffd3, 0xe6d1, 0x8c4d,
-  0x840d, 0xad2e, 0xffb3, 0xffb2, 0xf6ae, 0xd5ad, 0x198d, 0x0193,
-  0x0993, 0x0193, 0x198e, 0xde70, 0xfff3, 0xffd3, 0xffd3, 0xf772,
-  0xef32, 0xffb3, 0xff72, 0xfeef, 0xf66d, 0x3a2b, 0x0192, 0x09b3,
-  0x09f4, 0x09d4, 0x0171, 0x73f0, 0xcdae, 0xff71, 0xff92, 0xff92,
-  0xff92, 0xff10, 0xfeae, 0xd5ac, 0x736b, 0x09d1, 0x12f8, 0x1359,
-  0x1399, 0x1379, 0x12d7, 0x1295, 0x1a52, 0x6b6c, 0xcd4c, 0xc54c,
-  0xc52c, 0xc54c, 0x83ab, 0x2a4f, 0x01b2, 0x1318, 0x13ba, 0x139a,
-  0x139a, 0x13ba, 0x13ba, 0x139a, 0x13ba, 0x1338, 0x1231, 0x4b32,
-  0x8474, 0x7c74, 0x3b75, 0x0ad8, 0x12f8, 0x1318, 0x1339, 0x12f8,
-  0x1338, 0x1399, 0x139a, 0x1399, 0x139a, 0x139a, 0x54fc, 0xe7df,
-  0xf7ff, 0xf7ff, 0xc73f, 0x23da, 0x12f8, 0x12f8, 0x12d7, 0x12b7,
-  0x00ee, 0x00ee, 0x010e, 0x00ee, 0x00eb, 0x4acf, 0xad53, 0xad52,
-  0xad32, 0xad52, 0x9513, 0x322e, 0x00cd, 0x010e, 0x010e, 0x00ee,
-  0x012f, 0x010f, 0x00ee, 0x2a0e, 0xc656, 0xf776, 0xfff5, 0xfff4,
-  0xfff4, 0xfff4, 0xff72, 0xd670, 0x5b0d, 0x00ee, 0x010f, 0x010f,
-  0x012f, 0x010f, 0x114d, 0xd695, 0xfff7, 0xffd7, 0xffb4, 0xffb2,
-  0xffb2, 0xff31, 0xff10, 0xff72, 0xf751, 0x3a4c, 0x010f, 0x010f,
-  0x0130, 0x00cd, 0x94b2, 0xfff7, 0xffb5, 0xffd7, 0xffb3, 0xffb3,
-  0xffb3, 0xff11, 0xff51, 0xff31, 0xfff3, 0xcdef, 0x21ac, 0x6bb1,
-  0x0110, 0x196d, 0xce55, 0xfff5, 0xffd5, 0xffd3, 0xffb2, 0xffb3,
-  0xffb3, 0xffb2, 0xff71, 0xff92, 0xffd3, 0xee8f, 0x7bad, 0xe719,
-  0x00ef, 0x4aae, 0xfff7, 0xffd3, 0xc5ef, 0x6b4c, 0xf774, 0xffd3,
-  0xffd3, 0xef32, 0x634b, 0xce32, 0xfff3, 0xff30, 0x9c4c, 0xad74,
-  0x0130, 0x4aae, 0xffd5, 0xfff3, 0x632b, 0x10c9, 0xad71, 0xfff3,
-  0xfff3, 0xbdaf, 0x0046, 0x73af, 0xffb3, 0xff50, 0x940b, 0x322f,
-  0x0151, 0x4acf, 0xffd6, 0xfff3, 0x8c6d, 0x0026, 0x840d, 0xfff3,
-  0xfff3, 0xd650, 0x08a7, 0x31e9, 0xf772, 0xfeef, 0x8beb, 0x010f,
-  0x0152, 0x4ace, 0xfff6, 0xff33, 0xf694, 0xcdf0, 0xff92, 0xffd3,
-  0xffb3, 0xffd3, 0xd671, 0xe692, 0xfeb4, 0xfe6f, 0x940b, 0x0130,
-  0x0192, 0x11af, 0xce31, 0xff34, 0xfe95, 0xffd4, 0xce30, 0xde91,
-  0xf772, 0xb54f, 0xffb3, 0xff54, 0xfe33, 0xee0f, 0x3a4c, 0x0172,
-  0x09b3, 0x0130, 0x842e, 0xffd3, 0xffd3, 0xffd3, 0xef32, 0x948d,
-  0x840c, 0xc5d0, 0xffd3, 0xff92, 0xf6ae, 0xb4ec, 0x116e, 0x0193,
-  0x1214, 0x0193, 0x114e, 0xd60f, 0xfff3, 0xffd3, 0xffd3, 0xffd3,
-  0xffd3, 0xffb3, 0xff31, 0xfecf, 0xe60d, 0x29cc, 0x0193, 0x09b3,
-  0x0a35, 0x09d3, 0x0192, 0x3a4d, 0x9c8d, 0xf6f0, 0xff51, 0xff51,
-  0xff51, 0xfeef, 0xf64d, 0xacac, 0x426b, 0x0171, 0x0a75, 0x1318,
-  0x139a, 0x1379, 0x1338, 0x0a15, 0x0a13, 0x4ace, 0xa46b, 0xa44b,
-  0x9c4b, 0x9c4b, 0x7bad, 0x4312, 0x1254, 0x0a14, 0x13ba, 0x139a,
-  0x1379, 0x13ba, 0x13ba, 0x139a, 0x13ba, 0x1379, 0x0a95, 0x0a33,
-  0x1253, 0x8d38, 0xdf5e, 0xf7ff, 0xc6fe, 0x2b78, 0x0b39, 0x1318,
-  0x12f7, 0x1379, 0x139a, 0x139a, 0x1399, 0x13ba, 0x13ba, 0x137a,
-  0x7dbd, 0xffff, 0xf7ff, 0xf7ff, 0xf7ff, 0x9e3c, 0x6cfa, 0x1af7,
-  0x092e, 0x00ee, 0x010e, 0x00ee, 0x00ec, 0x3a4e, 0xad53, 0xad73,
-  0xad73, 0xad73, 0x94b1, 0x4aef, 0x00ed, 0x00ee, 0x010e, 0x00ee,
-  0x19d0, 0x010f, 0x00ee, 0x19ad, 0xbdf5, 0xef56, 0xfff5, 0xfff4,
-  0xfff4, 0xfff4, 0xff93, 0xdeb0, 0x7bcd, 0x00ed, 0x010f, 0x010f,
-  0x2211, 0x010f, 0x090d, 0xbdd4, 0xfff7, 0xffd7, 0xffb5, 0xffb2,
-  0xffb3, 0xff51, 0xf710, 0xff51, 0xffb2, 0x5aec, 0x00ee, 0x010f,
-  0x0130, 0x00ce, 0x73d0, 0xfff7, 0xffb4, 0xffd7, 0xffb4, 0xffb2,
-  0xffb3, 0xff31, 0xff51, 0xff10, 0xffd3, 0xe6b0, 0x196b, 0x4af0,
-  0x0130, 0x092e, 0xb593, 0xfff6, 0xffd5, 0xffd3, 0xffb2, 0xffb3,
-  0xffb3, 0xffb3, 0xff71, 0xff92, 0xffd3, 0xff10, 0x6b0b, 0xbe17,
-  0x0110, 0x29ed, 0xffb7, 0xffd3, 0xd670, 0x630b, 0xe6f4, 0xffd3,
-  0xffd3, 0xf792, 0x738c, 0xb571, 0xfff4, 0xff51, 0xacab, 0x9d13,
-  0x0151, 0x29ed, 0xff95, 0xfff3, 0x8c4d, 0x0067, 0x94b0, 0xffd3,
-  0xfff3, 0xde90, 0x0067, 0x52ed, 0xef53, 0xff71, 0xac8b, 0x2a0d,
-  0x0172, 0x2a0e, 0xff96, 0xfff3, 0xad4e, 0x0046, 0x632b, 0xfff3,
-  0xffd3, 0xe6f1, 0x2148, 0x2148, 0xef11, 0xff0f, 0xacac, 0x00ee,
-  0x0172, 0x320e, 0xffb6, 0xff53, 0xfe94, 0xce11, 0xf752, 0xffd3,
-  0xffb3, 0xfff3, 0xe6d1, 0xde72, 0xfeb4, 0xfe70, 0xb4cb, 0x010e,
-  0x01b3, 0x0970, 0xad70, 0xff74, 0xfe95, 0xffb4, 0xde91, 0xce10,
-  0xf773, 0xb58f, 0xf752, 0xff94, 0xfe33, 0xf630, 0x52cb, 0x0171,
-  0x09d3, 0x0151, 0x634e, 0xf792, 0xfff3, 0xffd3, 0xf772, 0xa4ee,
-  0x83ed, 0xb58f, 0xffb3, 0xffb2, 0xf6ce, 0xc54c, 0x21ad, 0x0193,
-  0x1254, 0x09b3, 0x012f, 0xb52e, 0xfff3, 0xffd3, 0xffd3, 0xffd3,
-  0xffd3, 0xffb3, 0xff51, 0xfecf, 0xf66d, 0x3a2b, 0x0172, 0x0993,
-  0x12b6, 0x09d3, 0x0193, 0x21ee, 0x8c0c, 0xeeaf, 0xff51, 0xff51,
-  0xff51, 0xfeef, 0xf66e, 0xbcec, 0x4a6b, 0x0130, 0x09f4, 0x12d7,
-  0x139a, 0x1379, 0x1359, 0x0a35, 0x09f3, 0x3a8f, 0x9c2b, 0x9c2b,
-  0x9c2b, 0xa44b, 0x630b, 0x5b92, 0x84f9, 0x84f9, 0x2bd9, 0x139a,
-  0x1379, 0x13ba, 0x13ba, 0x139a, 0x139a, 0x139a, 0x0ab5, 0x0a74,
-  0x0a13, 0x01d2, 0x6cb8, 0xefff, 0xffff, 0xffff, 0xbefe, 0x2399,
-  0x12f7, 0x1359, 0x139a, 0x139a, 0x1399, 0x139a, 0x13ba, 0x13ba,
-  0x139a, 0x2bda, 0xdf9f, 0xf7ff, 0xefff, 0xefff, 0xefdf, 0xc6fe,
-  0x092e, 0x010e, 0x010e, 0x00ee, 0x00cc, 0x198c, 0x94b2, 0xa512,
-  0xa512, 0xa532, 0x8c91, 0x428e, 0x116e, 0x00ee, 0x00ee, 0x00ee,
-  0x3250, 0x010f, 0x010f, 0x090d, 0x94d3, 0xe6f6, 0xfff6, 0xfff4,
-  0xfff4, 0xfff4, 0xffd4, 0xdeb0, 0x8c4e, 0x010d, 0x010f, 0x010f,
-  0x2252, 0x0150, 0x00ed, 0x8c71, 0xfff8, 0xfff6, 0xffd5, 0xffb2,
-  0xffb2, 0xff72, 0xf710, 0xff51, 0xffd2, 0x7bed, 0x00ee, 0x010f,
-  0x0130, 0x00ef, 0x426e, 0xf7b8, 0xffd4, 0xffd7, 0xffb5, 0xffb2,
-  0xffb3, 0xff51, 0xff31, 0xff10, 0xffb3, 0xf751, 0x422b, 0x010f,
-  0x0130, 0x010e, 0x8431, 0xfff6, 0xffd5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xffb3, 0xff72, 0xff92, 0xffd3, 0xff92, 0x7b8b, 0x6bd1,
-  0x0130, 0x112c, 0xe6d6, 0xfff4, 0xef32, 0x6b6c, 0xce32, 0xfff3,
-  0xffb3, 0xffd3, 0x948d, 0x948f, 0xfff4, 0xff71, 0xd58d, 0x52cd,
-  0x0171, 0x114d, 0xdeb5, 0xfff3, 0xbdaf, 0x0047, 0x73ef, 0xff93,
-  0xffd3, 0xf772, 0x1927, 0x3a2c, 0xded3, 0xffb2, 0xcd8d, 0x112b,
-  0x0193, 0x114e, 0xdeb5, 0xfff3, 0xd670, 0x08a7, 0x31c9, 0xf792,
-  0xffd3, 0xff92, 0x4229, 0x0066, 0xce30, 0xff50, 0xcd8c, 0x114c,
-  0x0173, 0x116e, 0xe6f5, 0xff93, 0xfed4, 0xcdd1, 0xe6d1, 0xfff3,
-  0xffb3, 0xfff3, 0xe6f2, 0xce11, 0xfed4, 0xfe71, 0xd5ac, 0x114c,
-  0x1a34, 0x0150, 0x8c6f, 0xff94, 0xfe75, 0xff54, 0xef52, 0xc5cf,
-  0xf793, 0xce10, 0xdeb1, 0xffd4, 0xfe54, 0xfe51, 0x83ab, 0x0150,
-  0x2274, 0x0172, 0x426d, 0xef32, 0xfff3, 0xffd3, 0xff93, 0xad4f,
-  0x7bcc, 0xa4ce, 0xf772, 0xffd3, 0xfeef, 0xdded, 0x3a4c, 0x0172,
-  0x1234, 0x11f3, 0x0130, 0x8c0d, 0xfff3, 0xffd3, 0xffd3, 0xffd3,
-  0xffb3, 0xffb3, 0xff72, 0xfeef, 0xfeae, 0x6b2b, 0x0151, 0x0993,
-  0x1338, 0x09d4, 0x01b3, 0x19af, 0x83cc, 0xe66f, 0xff51, 0xff51,
-  0xff71, 0xff10, 0xfe8e, 0xddad, 0x732b, 0x118f, 0x09d3, 0x0a96,
-  0x13ba, 0x1379, 0x1379, 0x0a76, 0x01b2, 0x2a4f, 0x942c, 0xac6b,
-  0xac6b, 0xac8b, 0x83cb, 0x19cd, 0x2ab4, 0xae1c, 0xc6fd, 0xaebe,
-  0x1359, 0x139a, 0x13ba, 0x139a, 0x139a, 0x139a, 0x0ab5, 0x0a73,
-  0x0a13, 0x01f2, 0x0a33, 0x4419, 0xcf3e, 0xffff, 0xf7ff, 0xf7ff,
-  0x12d7, 0x1338, 0x139a, 0x139a, 0x139a, 0x139a, 0x13ba, 0x13ba,
-  0x23da, 0x23da, 0x1338, 0x64fb, 0xf7ff, 0xefff, 0xefff, 0xefdf,
-  0x116e, 0x010e, 0x010e, 0x010e, 0x00cd, 0x00eb, 0x634f, 0x7c0f,
-  0x7c10, 0x7c0f, 0x73ef, 0x198c, 0x2210, 0x010e, 0x00ee, 0x00ee,
-  0x5331, 0x096f, 0x010f, 0x00cd, 0x5b50, 0xc614, 0xffb7, 0xfff5,
-  0xfff5, 0xfff5, 0xfff5, 0xd650, 0x8c2d, 0x090d, 0x010f, 0x010f,
-  0x0970, 0x19f1, 0x00ce, 0x52ee, 0xffb8, 0xfff7, 0xffd5, 0xffb2,
-  0xffb2, 0xff92, 0xff10, 0xff51, 0xffd2, 0x8c2d, 0x00cd, 0x012f,
-  0x0130, 0x010f, 0x21ad, 0xe6f6, 0xffd5, 0xffd7, 0xffd6, 0xffb2,
-  0xffb3, 0xff72, 0xff31, 0xff31, 0xff92, 0xf772, 0x52ac, 0x00ce,
-  0x0130, 0x010f, 0x52ef, 0xffd7, 0xffd5, 0xfff4, 0xffd3, 0xffb3,
-  0xffb3, 0xffb3, 0xff71, 0xff91, 0xffb3, 0xffd2, 0x8beb, 0x29ed,
-  0x0130, 0x00ed, 0xbdf4, 0xfff4, 0xffb3, 0x9ccd, 0xbdb0, 0xfff3,
-  0xffb3, 0xffd3, 0xc610, 0x948e, 0xffb3, 0xff92, 0xe60d, 0x3a0a,
-  0x0171, 0x010e, 0xc614, 0xfff3, 0xdeb1, 0x08a7, 0x73af, 0xf773,
-  0xffd3, 0xffd3, 0x4229, 0x31cb, 0xd6b3, 0xffb2, 0xe62e, 0x21ab,
-  0x0193, 0x012e, 0xc5f3, 0xfff3, 0xe6f1, 0x10e7, 0x08c7, 0xe6f1,
-  0xffd3, 0xffd3, 0x52aa, 0x0006, 0xa50e, 0xff91, 0xe60d, 0x21ab,
-  0x0173, 0x012e, 0xce34, 0xffd4, 0xff34, 0xbd70, 0xbdd0, 0xffd3,
-  0xffb3, 0xffd3, 0xe6d1, 0xad2f, 0xf6f3, 0xfe91, 0xee2d, 0x29ab,
-  0x1a54, 0x0991, 0x7bf0, 0xff93, 0xfe55, 0xfef5, 0xffb3, 0xce10,
-  0xfff3, 0xe6f1, 0xd691, 0xfff4, 0xfe55, 0xfe13, 0xacac, 0x116e,
-  0x53f7, 0x09f3, 0x29ed, 0xef12, 0xffd3, 0xffd3, 0xffb3, 0xb54f,
-  0x840d, 0x8c4d, 0xe6d1, 0xfff3, 0xff30, 0xf66d, 0x632b, 0x0151,
-  0x0a55, 0x1214, 0x0171, 0x738c, 0xfff3, 0xffd3, 0xffd3, 0xffb3,
-  0xf752, 0xf773, 0xffb2, 0xff10, 0xfece, 0x9c2b, 0x0150, 0x0193,
-  0x13ba, 0x0a55, 0x01b3, 0x19af, 0x944d, 0xeeaf, 0xff71, 0xff71,
-  0xff91, 0xff51, 0xfeaf, 0xee4d, 0xa46b, 0x29ee, 0x0172, 0x09f3,
-  0x13ba, 0x1399, 0x1379, 0x1318, 0x01b2, 0x324e, 0x9c6c, 0xc52b,
-  0xc52c, 0xc54c, 0xb4cc, 0x428d, 0x0a12, 0x01d4, 0x1213, 0xa61c,
-  0x1359, 0x1379, 0x13ba, 0x13ba, 0x139a, 0x137a, 0x12b5, 0x1272,
-  0x1232, 0x11f0, 0x09f1, 0x2358, 0x1359, 0x0a97, 0x8d7b, 0xffff,
-  0x12d7, 0x12f8, 0x1379, 0x139a, 0x139a, 0x139a, 0x13ba, 0x13bb,
-  0x13ba, 0x139a, 0x23da, 0x64fb, 0x54bb, 0x1b79, 0xb6de, 0xf7ff,
-  0x116e, 0x092e, 0x00ee, 0x010e, 0x00cd, 0x00ac, 0x426e, 0x5b0d,
-  0x5b0d, 0x5b0d, 0x52ee, 0x090c, 0x19af, 0x1190, 0x00ee, 0x00ee,
-  0x5310, 0x21ef, 0x010f, 0x00ce, 0x42cf, 0xa553, 0xf797, 0xffd5,
-  0xffd5, 0xffd5, 0xffd5, 0xbdaf, 0x6b6d, 0x00ed, 0x010f, 0x010f,
-  0x010f, 0x19f1, 0x010f, 0x426d, 0xef77, 0xfff7, 0xffd5, 0xffb2,
-  0xffb2, 0xffb2, 0xff31, 0xff71, 0xffb2, 0x738d, 0x00ce, 0x012f,
-  0x0130, 0x010f, 0x198d, 0xd675, 0xfff5, 0xffd6, 0xffd6, 0xffb2,
-  0xffb3, 0xff72, 0xff31, 0xff31, 0xff92, 0xef31, 0x426c, 0x00ef,
-  0x0130, 0x010f, 0x4aae, 0xfff7, 0xffd5, 0xfff5, 0xffd3, 0xffb2,
-  0xffb3, 0xffb2, 0xff51, 0xff71, 0xffb3, 0xffd2, 0x83cb, 0x010d,
-  0x0130, 0x00ed, 0xb5b4, 0xfff5, 0xffb3, 0xb58f, 0xce10, 0xffd3,
-  0xffb3, 0xffd3, 0xd690, 0xad2f, 0xffb3, 0xff92, 0xdded, 0x218a,
-  0x0171, 0x010d, 0xc614, 0xfff4, 0xe6d1, 0x08c7, 0x8431, 0xf7b3,
-  0xffd3, 0xffd3, 0x4a69, 0x3a2c, 0xe6f4, 0xffb2, 0xe62d, 0x218a,
-  0x0193, 0x012e, 0xc5f4, 0xfff4, 0xe6d1, 0x08a7, 0x08a7, 0xe6d1,
-  0xffd3, 0xffd3, 0x4a6a, 0x0006, 0x9cce, 0xffb2, 0xe60d, 0x21ab,
-  0x0193, 0x010e, 0xce34, 0xfff4, 0xff53, 0xa4cf, 0xa50e, 0xffd3,
-  0xffb3, 0xfff3, 0xce50, 0x8c4d, 0xeef2, 0xfed0, 0xee0d, 0x29ab,
-  0x11f3, 0x11f1, 0x8c91, 0xff93, 0xfe15, 0xfef5, 0xffd3, 0xde91,
-  0xfff3, 0xef32, 0xe6d1, 0xfff4, 0xfe55, 0xfdf3, 0xbcec, 0x118d,
-  0x32f5, 0x32f6, 0x29ec, 0xf772, 0xffd3, 0xffd3, 0xff93, 0xad0e,
-  0x8c6d, 0x8c4d, 0xd671, 0xfff3, 0xff30, 0xf68e, 0x6b4b, 0x0151,
-  0x0ab7, 0x09f4, 0x09b1, 0x840d, 0xfff3, 0xffd3, 0xffd3, 0xff93,
-  0xe6d1, 0xef32, 0xffd3, 0xff31, 0xfeef, 0xa48b, 0x096f, 0x0993,
-  0x1bda, 0x12f7, 0x0193, 0x21cf, 0xad0d, 0xf710, 0xffb2, 0xff92,
-  0xffb2, 0xff71, 0xfecf, 0xf66d, 0xbd0c, 0x322d, 0x0172, 0x09b3,
-  0x13ba, 0x139a, 0x1379, 0x1359, 0x09f2, 0x4aad, 0xbd0c, 0xddcc,
-  0xddac, 0xddcc, 0xcd4c, 0x5b0c, 0x1211, 0x09f4, 0x0992, 0x0a75,
-  0x1379, 0x1379, 0x13ba, 0x13ba, 0x139a, 0x0b59, 0x1a93, 0x1a50,
-  0x1a50, 0x1a0f, 0x1210, 0x1af7, 0x2379, 0x0a97, 0x0a55, 0x1b18,
-  0x12f7, 0x12f7, 0x1359, 0x139a, 0x139a, 0x139a, 0x13ba, 0x13bb,
-  0x13bb, 0x139a, 0x137a, 0x1338, 0x549a, 0x7d9c, 0x549a, 0x1b38,
-  0x092e, 0x116e, 0x00ee, 0x010e, 0x00ce, 0x00ad, 0x196c, 0x29ab,
-  0x29ab, 0x29ab, 0x218c, 0x00cd, 0x00ee, 0x2a51, 0x010e, 0x00ee,
-  0x2a2f, 0x4af0, 0x010e, 0x00ee, 0x29ee, 0x73f0, 0xdef6, 0xf756,
-  0xf756, 0xf756, 0xef55, 0x842e, 0x3a2c, 0x00ce, 0x010f, 0x010e,
-  0x010f, 0x094f, 0x11d1, 0x29ed, 0xded7, 0xfff8, 0xffd5, 0xffd2,
-  0xffd3, 0xffd2, 0xff51, 0xffb2, 0xef11, 0x426c, 0x00ee, 0x012f,
-  0x0130, 0x010f, 0x116e, 0xbdd4, 0xfff6, 0xffd6, 0xffd7, 0xffb2,
-  0xffb3, 0xff51, 0xff31, 0xff11, 0xffb2, 0xd670, 0x29ad, 0x010f,
-  0x0130, 0x010f, 0x428d, 0xfff8, 0xffd5, 0xfff5, 0xffd3, 0xffb2,
-  0xffb3, 0xff92, 0xff31, 0xff51, 0xffb3, 0xffd2, 0x734b, 0x00ee,
-  0x0130, 0x010d, 0xad74, 0xfff5, 0xffd4, 0xde91, 0xe6d1, 0xffd3,
-  0xffb3, 0xffd3, 0xef12, 0xd650, 0xffb3, 0xff92, 0xc54d, 0x194b,
-  0x0171, 0x092d, 0xce54, 0xfff3, 0xe6d1, 0x1948, 0x9d12, 0xffd4,
-  0xffd3, 0xffd3, 0x52aa, 0x52ed, 0xf795, 0xff92, 0xe60d, 0x216b,
-  0x0193, 0x012e, 0xce34, 0xfff3, 0xd670, 0x0067, 0x1949, 0xef12,
-  0xffd3, 0xffb3, 0x31c9, 0x0027, 0xad4f, 0xffb2, 0xdded, 0x198b,
-  0x0193, 0x012e, 0xce54, 0xfff3, 0xf752, 0x6b6c, 0x7bcc, 0xffb3,
-  0xffd3, 0xffd3, 0xa4ee, 0x5aca, 0xe6d2, 0xfef0, 0xe5ed, 0x218b,
-  0x0193, 0x11d0, 0xb5d3, 0xff94, 0xfe15, 0xfed5, 0xffd3, 0xef32,
-  0xfff3, 0xff92, 0xf772, 0xffd3, 0xfe36, 0xfdf3, 0xc54d, 0x198d,
-  0x01b3, 0x3b36, 0x5b2e, 0xffb3, 0xff93, 0xffb3, 0xf772, 0x9cce,
-  0xad4f, 0x9cae, 0xce50, 0xfff3, 0xff11, 0xfeaf, 0x734b, 0x0152,
-  0x1359, 0x0a35, 0x11b0, 0xad2f, 0xfff3, 0xffd3, 0xffd3, 0xef12,
-  0xbdaf, 0xd671, 0xffd3, 0xff72, 0xfecf, 0xb4cb, 0x21cf, 0x0193,
-  0x13ba, 0x139a, 0x01d4, 0x3a4d, 0xde6f, 0xff92, 0xffb3, 0xffb3,
-  0xfff3, 0xff92, 0xfef0, 0xfe8e, 0xddcc, 0x4a8c, 0x0172, 0x0992,
-  0x13ba, 0x13ba, 0x1379, 0x1338, 0x2250, 0x7bac, 0xde0e, 0xf68e,
-  0xf66e, 0xf66e, 0xe5ed, 0x83cc, 0x224f, 0x0a55, 0x0992, 0x09d3,
-  0x1379, 0x1359, 0x139a, 0x13ba, 0x139a, 0x0af7, 0x3290, 0x3a8d,
-  0x3a8d, 0x3a6d, 0x324e, 0x0a55, 0x2bb9, 0x12d8, 0x0a55, 0x0ad7,
-  0x12f8, 0x12f7, 0x1318, 0x1399, 0x139a, 0x139a, 0x137a, 0x137a,
-  0x137a, 0x137a, 0x137a, 0x1359, 0x1b58, 0x1379, 0x2bfa, 0x85bc,
-  0x090e, 0x19ae, 0x00ee, 0x010e, 0x00ee, 0x00cd, 0x00eb, 0x090b,
-  0x090b, 0x08eb, 0x08eb, 0x00ce, 0x00ce, 0x2210, 0x118f, 0x00ee,
-  0x19af, 0x6391, 0x012f, 0x00ee, 0x116d, 0x4ace, 0xc615, 0xd694,
-  0xd694, 0xd694, 0xce54, 0x52ec, 0x196c, 0x00ee, 0x010f, 0x010e,
-  0x012f, 0x010f, 0x11d1, 0x21ce, 0xce56, 0xfff8, 0xfff5, 0xffd3,
-  0xffd3, 0xffd3, 0xff92, 0xffb2, 0xd630, 0x21ac, 0x010f, 0x012f,
-  0x0130, 0x010f, 0x092e, 0xad73, 0xfff7, 0xffd6, 0xffd6, 0xffb2,
-  0xffb3, 0xff71, 0xff31, 0xff11, 0xffd3, 0xb56f, 0x114d, 0x010f,
-  0x0130, 0x00ef, 0x428e, 0xfff8, 0xffb4, 0xffd6, 0xffd4, 0xffb2,
-  0xffb3, 0xff72, 0xff31, 0xff31, 0xffb3, 0xffb2, 0x5acb, 0x00ef,
-  0x0130, 0x010e, 0x9d13, 0xfff6, 0xffd5, 0xf752, 0xf752, 0xffb3,
-  0xffb3, 0xffd3, 0xff72, 0xeef1, 0xffd3, 0xff92, 0xa48c, 0x092c,
-  0x0171, 0x092d, 0xdeb5, 0xfff3, 0xe6f1, 0x31e9, 0xb5b3, 0xfff4,
-  0xffb3, 0xffb3, 0x632b, 0x73af, 0xffd5, 0xff92, 0xddcd, 0x194b,
-  0x0193, 0x094e, 0xd694, 0xfff3, 0xc610, 0x0047, 0x3a2b, 0xf752,
-  0xffd3, 0xff92, 0x2168, 0x10e9, 0xc5f0, 0xffb2, 0xd5ad, 0x114c,
-  0x0193, 0x094e, 0xd695, 0xfff3, 0xe711, 0x3a29, 0x5aeb, 0xff93,
-  0xffd3, 0xffd3, 0x73ac, 0x31a8, 0xde91, 0xff10, 0xddad, 0x196c,
-  0x0193, 0x096f, 0xd674, 0xff74, 0xfe35, 0xf6b4, 0xffb3, 0xffb3,
-  0xfff3, 0xffb3, 0xff92, 0xff53, 0xfe55, 0xfe12, 0xcd8c, 0x116c,
-  0x09d3, 0x11d3, 0x73ef, 0xffd3, 0xff34, 0xff94, 0xef52, 0xa4ee,
-  0xce51, 0xad2e, 0xd650, 0xfff3, 0xfed2, 0xfe90, 0x6b2b, 0x0171,
-  0x139a, 0x0a96, 0x21ef, 0xce30, 0xfff3, 0xffd3, 0xffd3, 0xd671,
-  0x9cae, 0xbdd0, 0xffd3, 0xff92, 0xfeef, 0xbd0c, 0x2a0e, 0x0192,
-  0x13ba, 0x1bba, 0x0235, 0x5b0d, 0xf751, 0xffd2, 0xffd3, 0xffd3,
-  0xfff3, 0xffb3, 0xff30, 0xfeae, 0xee4d, 0x52ac, 0x0152, 0x09b2,
-  0x13ba, 0x13ba, 0x139a, 0x1317, 0x42ce, 0xaced, 0xf6af, 0xfeef,
-  0xfeef, 0xfecf, 0xee2d, 0xac8c, 0x3a8e, 0x0a75, 0x09b3, 0x09b3,
-  0x1399, 0x1379, 0x1379, 0x13ba, 0x137a, 0x12b4, 0x530d, 0x630b,
-  0x630c, 0x630b, 0x4acd, 0x09f2, 0x2b79, 0x12f8, 0x0a76, 0x12d7,
-  0x12f8, 0x12f7, 0x12f8, 0x1379, 0x13ba, 0x13ba, 0x0b38, 0x0b18,
-  0x0b38, 0x0b18, 0x0b59, 0x1359, 0x1b59, 0x1379, 0x1379, 0x1338,
-  0x00ee, 0x21cf, 0x010e, 0x00ee, 0x00ee, 0x00ee, 0x00ac, 0x00ab,
-  0x00ab, 0x00ab, 0x00ac, 0x00ee, 0x00ee, 0x094f, 0x2231, 0x00ee,
-  0x092f, 0x73d1, 0x116f, 0x00ef, 0x090d, 0x320d, 0xa553, 0xb5b3,
-  0xb593, 0xb5b3, 0xa552, 0x29ec, 0x090d, 0x010f, 0x010e, 0x010f,
-  0x012f, 0x012f, 0x0950, 0x2a0f, 0xb5b5, 0xf797, 0xfff6, 0xfff4,
-  0xfff4, 0xfff4, 0xffb3, 0xf751, 0xad2f, 0x092d, 0x010f, 0x012f,
-  0x0130, 0x012f, 0x090d, 0xa512, 0xfff8, 0xffd6, 0xffd6, 0xffb2,
-  0xffb3, 0xff72, 0xf710, 0xff31, 0xffd2, 0x8c4d, 0x010e, 0x012f,
-  0x0130, 0x00ef, 0x4ace, 0xfff8, 0xffb4, 0xffd7, 0xffb4, 0xffb2,
-  0xffb3, 0xff51, 0xff31, 0xff31, 0xffb3, 0xff71, 0x424b, 0x00ef,
-  0x0130, 0x010e, 0x94d2, 0xfff6, 0xffd5, 0xffb3, 0xff92, 0xffb3,
-  0xffb3, 0xffd3, 0xff92, 0xff52, 0xffd3, 0xff92, 0x8bcb, 0x010d,
-  0x0151, 0x114d, 0xe716, 0xfff3, 0xe6f1, 0x4a8a, 0xce33, 0xfff3,
-  0xffb3, 0xffb3, 0x73ac, 0x8c4f, 0xfff4, 0xff71, 0xd58d, 0x112c,
-  0x0192, 0x116e, 0xded5, 0xfff3, 0xbdaf, 0x0047, 0x634e, 0xff93,
-  0xffd3, 0xf752, 0x1907, 0x29ab, 0xd692, 0xffb2, 0xcd6d, 0x114c,
-  0x0193, 0x116e, 0xe6d5, 0xfff3, 0xd690, 0x1928, 0x4a6a, 0xffb3,
-  0xffd3, 0xff92, 0x4a8a, 0x1907, 0xd691, 0xff30, 0xcd6c, 0x220e,
-  0x0193, 0x116e, 0xe6f5, 0xff73, 0xfe95, 0xe653, 0xf752, 0xffd3,
-  0xffd3, 0xffd3, 0xf752, 0xe6d2, 0xfe95, 0xfe32, 0xcd6c, 0x114d,
-  0x09f4, 0x0171, 0x7c0e, 0xffb4, 0xfed4, 0xff74, 0xef12, 0xb56f,
-  0xe712, 0xb58f, 0xdeb1, 0xffd4, 0xfe93, 0xfe70, 0x6b2b, 0x0171,
-  0x139a, 0x0af8, 0x3aaf, 0xe6f1, 0xfff3, 0xffd3, 0xffb3, 0xbdaf,
-  0x840d, 0xad4f, 0xffb3, 0xffb2, 0xfeef, 0xcd6c, 0x320d, 0x0192,
-  0x13ba, 0x1bdb, 0x0ad6, 0x7bcd, 0xffd2, 0xffd3, 0xffd3, 0xfff3,
-  0xfff3, 0xffd3, 0xff51, 0xfecf, 0xf66d, 0x52cc, 0x0152, 0x09b2,
-  0x13ba, 0x13ba, 0x13ba, 0x1b16, 0x634d, 0xcdce, 0xff10, 0xff30,
-  0xff30, 0xfeef, 0xf66d, 0xbd0c, 0x52ed, 0x1296, 0x09d3, 0x09b2,
-  0x1359, 0x1379, 0x1379, 0x13ba, 0x0b38, 0x2292, 0x738c, 0x83cb,
-  0x83ab, 0x83cb, 0x634c, 0x1211, 0x1b38, 0x1b59, 0x0a76, 0x12b7,
-  0x1b37, 0x12f8, 0x12f7, 0x1338, 0x13ba, 0x13ba, 0x0af7, 0x0ad6,
-  0x0ad6, 0x0ad6, 0x0b17, 0x137a, 0x1b39, 0x1b79, 0x1379, 0x1359,
-  0x00ee, 0x21cf, 0x116e, 0x00ee, 0x00ee, 0x00ee, 0x00ac, 0x00ac,
-  0x00ac, 0x010d, 0x00ac, 0x00ee, 0x00ee, 0x00ee, 0x19f0, 0x118f,
-  0x00ee, 0x6391, 0x3a90, 0x00ef, 0x00ed, 0x218d, 0x8c71, 0x94b1,
-  0x94b1, 0x94d1, 0x8451, 0x194c, 0x00ed, 0x010f, 0x010e, 0x010e,
-  0x012f, 0x012f, 0x010f, 0x118e, 0xa534, 0xe716, 0xfff6, 0xfff4,
-  0xfff4, 0xfff4, 0xffd4, 0xe6d1, 0x8c4e, 0x00ed, 0x010f, 0x012f,
-  0x012f, 0x012f, 0x00ed, 0x94b1, 0xfff8, 0xfff6, 0xffb5, 0xffb2,
-  0xffb2, 0xff72, 0xf710, 0xff51, 0xffd2, 0x73ad, 0x00ee, 0x012f,
-  0x0130, 0x00ef, 0x4ace, 0xffb8, 0xffd4, 0xffd7, 0xffb4, 0xffb2,
-  0xffb3, 0xff51, 0xff31, 0xff10, 0xffb3, 0xf731, 0x3a0b, 0x0110,
-  0x0130, 0x010e, 0x8c71, 0xfff6, 0xffd5, 0xfff3, 0xffb2, 0xffb3,
-  0xffb3, 0xffb3, 0xff72, 0xff92, 0xffd3, 0xff91, 0x734b, 0x010e,
-  0x0151, 0x116d, 0xe716, 0xfff3, 0xef32, 0x6b6b, 0xd672, 0xfff3,
-  0xffb3, 0xffb3, 0x8c4d, 0x9ccf, 0xfff4, 0xff71, 0xcd6c, 0x092c,
-  0x0172, 0x118e, 0xe6f5, 0xfff3, 0xb58f, 0x0047, 0x7c10, 0xffb3,
-  0xffd3, 0xf752, 0x10e7, 0x424c, 0xdef3, 0xff92, 0xcd4c, 0x092c,
-  0x0193, 0x116e, 0xe6f5, 0xfff3, 0xce50, 0x0887, 0x3a09, 0xffb3,
-  0xffd3, 0xf772, 0x39e9, 0x0887, 0xd670, 0xff50, 0xc54c, 0x2a2e,
-  0x01d4, 0x116d, 0xef15, 0xff93, 0xfed4, 0xcdf1, 0xe6f2, 0xfff3,
-  0xffd3, 0xfff3, 0xe6f1, 0xd631, 0xfed4, 0xfe71, 0xcd6c, 0x114d,
-  0x1318, 0x0991, 0x94b0, 0xff94, 0xfe75, 0xff74, 0xef32, 0xc5d0,
-  0xf793, 0xc5f0, 0xe6d1, 0xffd4, 0xfe54, 0xfe51, 0x736b, 0x0151,
-  0x13ba, 0x0b39, 0x4b2f, 0xef52, 0xfff3, 0xffd3, 0xf793, 0xad2e,
-  0x7bcc, 0xa4ee, 0xf793, 0xffb3, 0xfeef, 0xd5cd, 0x320c, 0x0172,
-  0x13ba, 0x13da, 0x0ad6, 0x946e, 0xfff3, 0xffd3, 0xffd3, 0xffd3,
-  0xffb3, 0xffb3, 0xff71, 0xfeef, 0xfeae, 0x5aeb, 0x0171, 0x0992,
-  0x139a, 0x13ba, 0x13ba, 0x2314, 0x8c0d, 0xe66f, 0xff51, 0xff51,
-  0xff51, 0xff10, 0xfe8e, 0xd58c, 0x736c, 0x12b5, 0x0a15, 0x0992,
-  0x1318, 0x1379, 0x1379, 0x137a, 0x0af7, 0x3290, 0x942c, 0xa46b,
-  0xa46b, 0xa48b, 0x83cc, 0x2250, 0x0a96, 0x2bb9, 0x12b7, 0x12b7,
-  0x85bb, 0x2358, 0x12d7, 0x12f8, 0x139a, 0x139a, 0x0ab5, 0x0a73,
-  0x0a74, 0x0a74, 0x0ad6, 0x139a, 0x1339, 0x1b38, 0x1379, 0x1379,
-  0x00ee, 0x198e, 0x21cf, 0x00ee, 0x010e, 0x00ee, 0x00ac, 0x008c,
-  0x008c, 0x010d, 0x00cd, 0x00ee, 0x00ee, 0x00ee, 0x094f, 0x2231,
-  0x00ee, 0x4ad0, 0x5b71, 0x00ee, 0x00cd, 0x116c, 0x7c11, 0x8450,
-  0x8450, 0x8c71, 0x7c10, 0x114c, 0x00cd, 0x010f, 0x010e, 0x010e,
-  0x012f, 0x012f, 0x010f, 0x092e, 0xa555, 0xded6, 0xfff7, 0xfff5,
-  0xfff5, 0xfff5, 0xfff4, 0xdeb1, 0x842e, 0x00ed, 0x010f, 0x012f,
-  0x0130, 0x012f, 0x00ed, 0x8431, 0xfff8, 0xfff6, 0xffb5, 0xffb2,
-  0xffb2, 0xff92, 0xf710, 0xff51, 0xffb2, 0x738d, 0x00ee, 0x012f,
-  0x0130, 0x00ef, 0x428e, 0xf7b8, 0xffd5, 0xffd7, 0xffb5, 0xffb2,
-  0xffb3, 0xff51, 0xff51, 0xff10, 0xffb3, 0xf731, 0x3a0b, 0x010f,
-  0x0130, 0x010e, 0x7c31, 0xfff6, 0xffd5, 0xfff4, 0xffd3, 0xffb3,
-  0xffb3, 0xffb3, 0xff72, 0xff92, 0xffd3, 0xff92, 0x734b, 0x010e,
-  0x0151, 0x114d, 0xe6f6, 0xfff4, 0xf752, 0x7bac, 0xce52, 0xfff3,
-  0xffb3, 0xffd3, 0x9cad, 0x9ccf, 0xfff4, 0xff71, 0xcd6c, 0x112c,
-  0x0192, 0x116e, 0xe6d5, 0xfff3, 0xbdcf, 0x0067, 0x8430, 0xffb3,
-  0xffd3, 0xf752, 0x1927, 0x426d, 0xe6f3, 0xffb2, 0xcd6c, 0x112c,
-  0x0173, 0x116e, 0xded5, 0xfff3, 0xce50, 0x0087, 0x31c9, 0xff92,
-  0xffd3, 0xf792, 0x39e9, 0x0066, 0xce30, 0xff50, 0xcd6c, 0x114c,
-  0x0a76, 0x116d, 0xe6f5, 0xff93, 0xfef4, 0xc5b1, 0xdeb1, 0xfff3,
-  0xffb3, 0xfff3, 0xe6d1, 0xc5f0, 0xfef4, 0xfe71, 0xd58c, 0x114c,
-  0x139a, 0x09f2, 0x9490, 0xff94, 0xfe55, 0xff54, 0xef52, 0xc5f0,
-  0xffb3, 0xce30, 0xe6d1, 0xffd4, 0xfe54, 0xfe32, 0x83ab, 0x0170,
-  0x13ba, 0x0b59, 0x4b2f, 0xf752, 0xfff3, 0xffd3, 0xf793, 0xad0e,
-  0x7bcc, 0x9cce, 0xf772, 0xffd3, 0xfeef, 0xdded, 0x3a4c, 0x0172,
-  0x13ba, 0x13ba, 0x0ad6, 0x946d, 0xfff3, 0xffd3, 0xffd3, 0xffd3,
-  0xff93, 0xffb3, 0xff72, 0xfef0, 0xfeae, 0x6b2b, 0x0192, 0x0992,
-  0x139a, 0x13ba, 0x139a, 0x2b14, 0x944d, 0xeeb0, 0xff71, 0xff71,
-  0xff71, 0xff30, 0xfeae, 0xddcd, 0x7bac, 0x1a94, 0x0a76, 0x0992,
-  0x1318, 0x1359, 0x139a, 0x1359, 0x0ad6, 0x32af, 0x9c4c, 0xb4ab,
-  0xacab, 0xb4cb, 0x8c0c, 0x2a4f, 0x0a76, 0x2b99, 0x12f8, 0x1297,
-  0xb6bd, 0x5cba, 0x12f7, 0x12f7, 0x1359, 0x139a, 0x0a94, 0x0a52,
-  0x0a53, 0x0a53, 0x0ab5, 0x139a, 0x1359, 0x1318, 0x1359, 0x1379
-};
-
-const Animation smileyAnimation = {
-  .name = "Smiley",
-  .frameCount = 30,
-  .width = 16,
-  .height = 16,
-  .frameDurations = smileyDurations,
-  .animationFrames = smileyFrames
-};
-#endif // ANIMATION_SMILEY_H
@@ -1,182 +0,0 @@
-// smiley_with_a_tongue.h - Auto-generated from smiley_with_a_tongue.json
-#ifndef ANIMATION_SMILEY_WITH_A_TONGUE_H
-#define ANIMATION_SMILEY_WITH_A_TONGUE_H
-
-#include "animation_types.h"
-
-// Frame Durations for smiley_with_a_tongue (in 100ms units)
-static const uint8_t PROGMEM smiley_with_a_tongueDurations[] = { 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for smiley_with_a_tongue
-static const uint16_t PROGMEM smiley_with_a_tongueFrames[] = {
-  0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0x07ff, 0x07ff, 0x07ff, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x07ff, 0x07ff, 0x07ff,
-  0x07ff, 0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff, 0x07ff,
-  0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff,
-  0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0xffe0,
-  0xffe0, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff,
-  0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0xffe0,
-  0xffe0, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000,
-  0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0xffe0,
-  0xffe0, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000,
-  0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000,
-  0x0000, 0xffe0, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0xffe0, 0x0000,
-  0x0000, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffe0, 0xffe0, 0x0000,
-  0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0x0000, 0xf800, 0xf800, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0x0000,
-  0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff,
-  0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff,
-  0x07ff, 0x07ff, 0x0000, 0x0000, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x07ff, 0x07ff,
-  0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0000, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0x0000, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x07ff, 0x07ff, 0x07ff, 0x07ff, 0x07ff,
-  0xfc20, 0xfc20, 0xfc20, 0xe3c0, 0xd360, 0x20e0, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x1122, 0x069a, 0x073d, 0x07ff, 0x07ff, 0x07ff,
-  0xfc20, 0xfc40, 0xd380, 0x3120, 0x3160, 0xd6a0, 0xe720, 0xe720,
-  0xe720, 0xe720, 0xd6a0, 0x21c2, 0x11a4, 0x06ba, 0x07ff, 0x07ff,
-  0xfc20, 0xd380, 0x41a0, 0xd680, 0xef40, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xef40, 0xd680, 0x2224, 0x06ba, 0x07df,
-  0xe3c0, 0x3120, 0xd680, 0xffe0, 0xffe0, 0xef40, 0xe720, 0xffc0,
-  0xffc0, 0xef40, 0xef40, 0xffe0, 0xffe0, 0xd680, 0x11a4, 0x073d,
-  0xd360, 0x3160, 0xe740, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xef40, 0x21c2, 0x069a,
-  0x20e0, 0xd6a0, 0xffc0, 0xffe0, 0xe720, 0x0860, 0x0840, 0xef40,
-  0xef40, 0x0860, 0x0840, 0xe720, 0xffe0, 0xffc0, 0xd6a0, 0x1122,
-  0x10a0, 0xe720, 0xffe0, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xffe0, 0xe720, 0x10a0,
-  0x10a0, 0xe700, 0xef40, 0xffe0, 0xffe0, 0xef60, 0xef60, 0xffe0,
-  0xffe0, 0xef60, 0xef60, 0xffe0, 0xffe0, 0xef40, 0xe700, 0x10a0,
-  0x18c0, 0xd680, 0x4a40, 0xd680, 0xe720, 0xe720, 0xe720, 0xe700,
-  0xe720, 0xe740, 0xe740, 0xef40, 0xd680, 0x4a40, 0xd680, 0x18c0,
-  0x1080, 0xe720, 0xdec0, 0x31a0, 0x2940, 0x2940, 0x2940, 0x2120,
-  0x10a0, 0x2080, 0x2080, 0x10a0, 0x31a0, 0xdec0, 0xef40, 0x10a0,
-  0x1122, 0xd6a0, 0xffe0, 0xe720, 0xe720, 0xe720, 0xe720, 0xce80,
-  0x1860, 0xd000, 0xd000, 0x1840, 0xd680, 0xffe0, 0xd6a0, 0x20e0,
-  0x069a, 0x21a2, 0xef40, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xef60,
-  0x3920, 0xd000, 0xd000, 0x3920, 0xef80, 0xef60, 0x3160, 0xd360,
-  0x073d, 0x09c5, 0xd660, 0xef20, 0xffe0, 0xffc0, 0xffc0, 0xffc0,
-  0xdec0, 0x3120, 0x3100, 0xdec0, 0xe720, 0xce80, 0x3120, 0xe3c0,
-  0x07df, 0x06db, 0x11a4, 0x2182, 0xd6a0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xef60, 0xef60, 0xd6c0, 0x3160, 0x3100, 0xdba0, 0xfc20,
-  0x07df, 0x07ff, 0x075d, 0x069a, 0x2244, 0xd680, 0xe720, 0xe700,
-  0xe720, 0xef40, 0xd6a0, 0x49a0, 0xd360, 0xebc0, 0xfc20, 0xfc20,
-  0x07df, 0x07df, 0x07ff, 0x07ff, 0x06ba, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x20e0, 0xd380, 0xfc40, 0xfc40, 0xfc20, 0xfc20,
-  0x07df, 0x07ff, 0x07ff, 0x073d, 0x069a, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x1122, 0x069a, 0x073d, 0x07ff, 0x07ff, 0x07ff,
-  0x07df, 0x07ff, 0x06bb, 0x11a5, 0x21a2, 0xd6a0, 0xe720, 0xe720,
-  0xe720, 0xe720, 0xd6a0, 0x21c2, 0x11a4, 0x06ba, 0x07ff, 0x07ff,
-  0x07df, 0x06bb, 0x2224, 0xd680, 0xef40, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xef40, 0xd680, 0x2224, 0x06ba, 0x07df,
-  0x073d, 0x09a5, 0xd680, 0xffe0, 0xffe0, 0xef40, 0xe720, 0xffc0,
-  0xffc0, 0xef40, 0xef40, 0xffe0, 0xffe0, 0xd680, 0x11a4, 0x073d,
-  0x069a, 0x21a2, 0xef20, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xef40, 0x21c2, 0x069a,
-  0x1122, 0xd6a0, 0xffc0, 0xffe0, 0xe720, 0x0860, 0x0840, 0xef40,
-  0xef40, 0x0860, 0x0840, 0xe720, 0xffe0, 0xffc0, 0xd6a0, 0x1122,
-  0x1080, 0xe720, 0xffe0, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xffe0, 0xe720, 0x10a0,
-  0x10a0, 0xe700, 0xef40, 0xffe0, 0xffe0, 0xef60, 0xef60, 0xffe0,
-  0xffe0, 0xef60, 0xef60, 0xffe0, 0xffe0, 0xef40, 0xe700, 0x10a0,
-  0x18c0, 0xd680, 0x4a40, 0xd680, 0xe720, 0xe720, 0xe720, 0xe700,
-  0xe720, 0xe740, 0xe740, 0xef40, 0xd680, 0x4a40, 0xd680, 0x18c0,
-  0x1080, 0xe720, 0xdec0, 0x31a0, 0x2940, 0x2940, 0x2940, 0x2120,
-  0x10a0, 0x2080, 0x2080, 0x10a0, 0x31a0, 0xdec0, 0xef40, 0x10a0,
-  0x1122, 0xd6a0, 0xffe0, 0xe720, 0xe720, 0xe720, 0xe720, 0xce80,
-  0x2080, 0xd000, 0xd000, 0x2060, 0xd680, 0xffe0, 0xd6a0, 0x1122,
-  0x069a, 0x21a2, 0xef40, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xe740,
-  0x2080, 0xe800, 0xe800, 0x2080, 0xef60, 0xf760, 0x21a2, 0x069a,
-  0x073d, 0x09c5, 0xd660, 0xef20, 0xffe0, 0xffc0, 0xffe0, 0xe740,
-  0x3120, 0xd000, 0xd000, 0x3920, 0xd6a0, 0xd680, 0x11a4, 0x073d,
-  0x07df, 0x06db, 0x11a4, 0x2182, 0xd6a0, 0xffe0, 0xffe0, 0xffe0,
-  0xdee0, 0x3920, 0x3920, 0xb5a0, 0x21a2, 0x11a4, 0x06db, 0x07df,
-  0x07df, 0x07ff, 0x075d, 0x069a, 0x2244, 0xd680, 0xe720, 0xe720,
-  0xe720, 0xd680, 0xbe00, 0x2244, 0x069a, 0x075d, 0x07ff, 0x07ff,
-  0x07df, 0x07df, 0x07ff, 0x07ff, 0x06ba, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x18c0, 0x1122, 0x069a, 0x07ff, 0x07ff, 0x07df, 0x07df,
-  0x07df, 0x07ff, 0x07ff, 0x073d, 0x069a, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x20e0, 0xd360, 0xe3c0, 0xfc20, 0xfc20, 0xfc20,
-  0x07df, 0x07ff, 0x06bb, 0x11a5, 0x21a2, 0xd6a0, 0xe720, 0xe720,
-  0xe720, 0xe720, 0xd6a0, 0x3960, 0x3120, 0xd380, 0xfc40, 0xfc20,
-  0x07df, 0x06bb, 0x2224, 0xd680, 0xef40, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xef40, 0xd6a0, 0x41a0, 0xd380, 0xfc20,
-  0x073d, 0x09a5, 0xd680, 0xffe0, 0xffe0, 0xef40, 0xe720, 0xffc0,
-  0xffc0, 0xef40, 0xef40, 0xffe0, 0xffe0, 0xd6a0, 0x3120, 0xe3c0,
-  0x069a, 0x21a2, 0xef20, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xef40, 0x3960, 0xd360,
-  0x1122, 0xd6a0, 0xffc0, 0xffe0, 0xe720, 0x0860, 0x0840, 0xef40,
-  0xef40, 0x0860, 0x0840, 0xe720, 0xffe0, 0xffc0, 0xd6a0, 0x20e0,
-  0x1080, 0xe720, 0xffe0, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xffe0, 0xe720, 0x10a0,
-  0x10a0, 0xe700, 0xef40, 0xffe0, 0xffe0, 0xef60, 0xef60, 0xffe0,
-  0xffe0, 0xef60, 0xef60, 0xffe0, 0xffe0, 0xef40, 0xe700, 0x10a0,
-  0x18c0, 0xd680, 0x4a40, 0xd680, 0xe720, 0xe720, 0xe720, 0xe700,
-  0xe720, 0xe740, 0xe740, 0xef40, 0xd680, 0x4a40, 0xd680, 0x18c0,
-  0x10a0, 0xe720, 0xdec0, 0x31a0, 0x2940, 0x2940, 0x2940, 0x2120,
-  0x10a0, 0x2080, 0x2080, 0x10a0, 0x31a0, 0xdec0, 0xef40, 0x10a0,
-  0x20e0, 0xd6a0, 0xffe0, 0xe720, 0xe720, 0xe720, 0xe720, 0xce80,
-  0x1860, 0xd000, 0xd000, 0x1840, 0xd680, 0xffe0, 0xd6a0, 0x1122,
-  0xd360, 0x3160, 0xef40, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xef60,
-  0x3920, 0xd000, 0xd000, 0x3920, 0xef80, 0xef60, 0x21a2, 0x069a,
-  0xe3c0, 0x3920, 0xce80, 0xe740, 0xffe0, 0xffc0, 0xffc0, 0xffc0,
-  0xdec0, 0x3120, 0x3100, 0xdec0, 0xef20, 0xd660, 0x11a4, 0x073d,
-  0xfc20, 0xdba0, 0x3100, 0x3160, 0xd6a0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xef60, 0xef40, 0xdea0, 0x21a2, 0x11a4, 0x06db, 0x07df,
-  0xfc20, 0xfc20, 0xebc0, 0xd360, 0x49a0, 0xd680, 0xe720, 0xe700,
-  0xe720, 0xef40, 0xd6a0, 0x2244, 0x069a, 0x075d, 0x07ff, 0x07ff,
-  0xfc20, 0xfc20, 0xfc40, 0xfc40, 0xd380, 0x20e0, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x1122, 0x069a, 0x07ff, 0x07ff, 0x07df, 0x07df,
-  0x07df, 0x07ff, 0x07ff, 0x073d, 0x069a, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x1122, 0x069a, 0x073d, 0x07ff, 0x07ff, 0x07ff,
-  0x07df, 0x07ff, 0x06bb, 0x11a5, 0x21a2, 0xd6a0, 0xe720, 0xe720,
-  0xe720, 0xe720, 0xd6a0, 0x21c2, 0x11a4, 0x06ba, 0x07ff, 0x07ff,
-  0x07df, 0x06bb, 0x2224, 0xd680, 0xef40, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xef40, 0xd680, 0x2224, 0x06ba, 0x07df,
-  0x073d, 0x09a5, 0xd680, 0xffe0, 0xffe0, 0xef40, 0xe720, 0xffc0,
-  0xffc0, 0xef40, 0xef40, 0xffe0, 0xffe0, 0xd680, 0x11a4, 0x073d,
-  0x069a, 0x21a2, 0xef20, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xef40, 0x21c2, 0x069a,
-  0x1122, 0xd6a0, 0xffc0, 0xffe0, 0xe720, 0x0860, 0x0840, 0xef40,
-  0xef40, 0x0860, 0x0840, 0xe720, 0xffe0, 0xffc0, 0xd6a0, 0x1122,
-  0x1080, 0xe720, 0xffe0, 0xffe0, 0xef40, 0x2120, 0x2100, 0xef40,
-  0xef60, 0x2120, 0x2100, 0xef40, 0xffe0, 0xffe0, 0xe720, 0x10a0,
-  0x10a0, 0xe700, 0xef40, 0xffe0, 0xffe0, 0xef60, 0xef60, 0xffe0,
-  0xffe0, 0xef60, 0xef60, 0xffe0, 0xffe0, 0xef40, 0xe700, 0x10a0,
-  0x18c0, 0xd680, 0x4a40, 0xd680, 0xe720, 0xe720, 0xe720, 0xe700,
-  0xe720, 0xe740, 0xe740, 0xef40, 0xd680, 0x4a40, 0xd680, 0x18c0,
-  0x1080, 0xe720, 0xdec0, 0x31a0, 0x2940, 0x2940, 0x2940, 0x2120,
-  0x1080, 0x2880, 0x2880, 0x1080, 0x31a0, 0xdec0, 0xef40, 0x10a0,
-  0x1122, 0xd6a0, 0xffe0, 0xe720, 0xe720, 0xe720, 0xe720, 0xd6a0,
-  0x3100, 0xb800, 0xb800, 0x30e0, 0xd6a0, 0xffe0, 0xd6a0, 0x1122,
-  0x069a, 0x21a2, 0xef40, 0xffe0, 0xffe0, 0xffe0, 0xffe0, 0xffe0,
-  0xdec0, 0x3920, 0x3100, 0xdec0, 0xffe0, 0xef40, 0x21a2, 0x069a,
-  0x073d, 0x09c5, 0xd660, 0xef20, 0xffe0, 0xffc0, 0xffc0, 0xffc0,
-  0xffe0, 0xe740, 0xe740, 0xffe0, 0xef20, 0xd660, 0x11a4, 0x073d,
-  0x07df, 0x06db, 0x11a4, 0x2182, 0xd6a0, 0xffe0, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0xdea0, 0x21a2, 0x11a4, 0x06db, 0x07df,
-  0x07df, 0x07ff, 0x075d, 0x069a, 0x2244, 0xd680, 0xe720, 0xe700,
-  0xe700, 0xe720, 0xd680, 0x2244, 0x069a, 0x075d, 0x07ff, 0x07ff,
-  0x07df, 0x07df, 0x07ff, 0x07ff, 0x06ba, 0x1122, 0x10a0, 0x10a0,
-  0x10a0, 0x10a0, 0x1122, 0x069a, 0x07ff, 0x07ff, 0x07df, 0x07df
-};
-
-const Animation smiley_with_a_tongueAnimation = {
-  .name = "Smiley With A Tongue",
-  .frameCount = 5,
-  .width = 16,
-  .height = 16,
-  .frameDurations = smiley_with_a_tongueDurations,
-  .animationFrames = smiley_with_a_tongueFrames
-};
-#endif // ANIMATION_SMILEY_WITH_A_TONGUE_H
@@ -1,1686 +0,0 @@
-// snake_eye.h - Auto-generated from snake_eye.json
-#ifndef ANIMATION_SNAKE_EYE_H
-#define ANIMATION_SNAKE_EYE_H
-
-#include "animation_types.h"
-
-// Frame Durations for snake_eye (in 100ms units)
-static const uint8_t PROGMEM snake_eyeDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for snake_eye
-static const uint16_t PROGMEM snake_eyeFrames[] = {
-  0x0000, 0x10a0, 0x2101, 0x2962, 0x2962, 0x2962, 0x31a4, 0x2962,
-  0x31a4, 0x31a4, 0x2962, 0x31a4, 0x2962, 0x2101, 0x10a0, 0x0000,
-  0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962, 0x2962,
-  0x2962, 0x31a4, 0x31a4, 0x2962, 0x31a4, 0x2101, 0x2101, 0x10a0,
-  0x2101, 0x2101, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2101,
-  0x2101, 0x2962, 0x31a4, 0x31a4, 0x2962, 0x31a4, 0x2962, 0x2101,
-  0x2101, 0x2101, 0x6ac2, 0xbce4, 0xfde7, 0xfde7, 0xbce4, 0x6ac2,
-  0x41a1, 0x2101, 0x2101, 0x2962, 0x2101, 0x2962, 0x31a4, 0x2962,
-  0x2101, 0x6ac2, 0xfde7, 0xfde7, 0xfeb0, 0xffff, 0xffff, 0xffff,
-  0xfeb0, 0x9300, 0x6ac2, 0x2101, 0x2101, 0x2962, 0x31a4, 0x2962,
-  0x31a4, 0xfde7, 0xfde7, 0xfde7, 0xfd40, 0xfeb0, 0xffff, 0xffff,
-  0xffff, 0xfeb0, 0xfde7, 0x8ba3, 0x2101, 0x2101, 0x2962, 0x31a4,
-  0x39e4, 0xfde7, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x4160,
-  0x0000, 0x4160, 0xfd40, 0xfde7, 0xbce4, 0x2101, 0x2101, 0x2962,
-  0x39e4, 0xdc80, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x0000,
-  0x20a0, 0x0000, 0xfd40, 0xffff, 0xfeb0, 0x8ba3, 0x2101, 0x2101,
-  0x4a66, 0xc420, 0xdc80, 0xfd40, 0xfd40, 0xfd40, 0xfd40, 0x0000,
-  0x20a0, 0x0000, 0xfd40, 0xfeb0, 0xffff, 0xfd40, 0x6ac2, 0x2101,
-  0x39e4, 0xc420, 0xdc80, 0xdc80, 0xfd40, 0xfd40, 0xfd40, 0x4160,
-  0x0000, 0x4160, 0xfd40, 0xfd40, 0xfd40, 0xdc80, 0xc420, 0x6ac2,
-  0x39e4, 0x4a66, 0xc420, 0xdc80, 0xdc80, 0xfd40, 0xfd40, 0x6a40,
-  0x0000, 0x6a40, 0xfd40, 0xdc80, 0xdc80, 0xc420, 0x6ac2, 0x4a66,
-  0x2962, 0x39e4, 0x4a66, 0xc420, 0xdc80, 0xdc80, 0xdc80, 0x9300,
-  0x0000, 0x9300, 0xdc80, 0xdc80, 0xc420, 0x6ac2, 0x4a66, 0x31a4,
-  0x2101, 0x2962, 0x39e4, 0x4a66, 0x6ac2, 0xc420, 0xc420, 0xc420,
-  0x0000, 0xc420, 0xc420, 0x6ac2, 0x4a66, 0x39e4, 0x31a4, 0x2962,
-  0x2101, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4a66, 0x4a66, 0x4a66,
-  0x4a66, 0x4a66, 0x4a66, 0x39e4, 0x2962, 0x2962, 0x2962, 0x2101,
-  0x10a0, 0x2101, 0x2101, 0x2962, 0x2962, 0x31a4, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a4, 0x2962, 0x2101, 0x2101, 0x10a0, 0x0000,
-  0x0000, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10a0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x18e0, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf79c,
-  0xde10, 0x3142, 0x6282, 0x2961, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xef3a, 0xd5ae, 0xdd26, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xed22,
-  0x51e2, 0x18a1, 0x51e1, 0xe568, 0xac85, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd40, 0xe4c0,
-  0x1880, 0x1040, 0x18a2, 0xeef9, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xe4c0,
-  0x1880, 0x1060, 0x18a1, 0xe630, 0xff78, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xece0,
-  0x4980, 0x0820, 0x4980, 0xece1, 0xfd62, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xf500,
-  0x6a40, 0x0840, 0x6a20, 0xd460, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf4e0,
-  0x8ae0, 0x1060, 0x8ae0, 0xcc40, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xa380, 0x20c0, 0x9b60, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5285,
-  0x5265, 0x4a45, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2941, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf77c,
-  0xe630, 0x9362, 0x5a41, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xff9b, 0xd58d, 0x20e1, 0x62a2, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xfd62,
-  0xed22, 0x51c1, 0x0840, 0x5a43, 0x9c24, 0x3181, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd20, 0xfd40,
-  0xe4c0, 0x1060, 0x2902, 0xce37, 0xf671, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xfd40,
-  0xe4c0, 0x1880, 0x1860, 0x2944, 0xeed7, 0xed23, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xfd40,
-  0xece0, 0x4980, 0x0820, 0x4160, 0xed02, 0xdca0, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xfd40,
-  0xf500, 0x6a40, 0x0840, 0x6a20, 0xd440, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf520,
-  0xf500, 0x8ae0, 0x1060, 0x82c0, 0xb3c0, 0x72e2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xbc00, 0xa380, 0x18a0, 0x5a62, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x5285, 0x5285, 0x4225, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x18e0, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf79c,
-  0xde10, 0x3142, 0x6282, 0x2961, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xffbd,
-  0xef3a, 0xd5ae, 0xdd26, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xfd62, 0xed22,
-  0x51e2, 0x18a1, 0x51e1, 0xe568, 0xac85, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd20, 0xfd40, 0xe4c0,
-  0x1880, 0x1040, 0x18a2, 0xeef9, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xfd40, 0xe4c0,
-  0x1880, 0x1060, 0x18a1, 0xe630, 0xff78, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xfd40, 0xece0,
-  0x4980, 0x0820, 0x4980, 0xece1, 0xfd62, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xf520, 0xfd20, 0xf500,
-  0x6a40, 0x0840, 0x6a20, 0xd460, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xdca0, 0xf4e0,
-  0x8ae0, 0x1060, 0x8ae0, 0xcc40, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xbc00,
-  0xa380, 0x20c0, 0x9b60, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5285,
-  0x5265, 0x4a45, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2942, 0x2941,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2941, 0x2120,
-  0x2101, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xe588, 0xb4a6, 0x7304,
-  0x4a02, 0x2920, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xf7bd, 0xf79c,
-  0xee50, 0x9b62, 0x6aa2, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xff9c, 0xef7d,
-  0xef1a, 0xee0e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd20, 0xfd41, 0xed22, 0x51e2,
-  0x18c2, 0x51e1, 0xed01, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xfd40, 0xe4c0, 0x1880,
-  0x1040, 0x1860, 0xe4e2, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xfd40, 0xe4c0, 0x1880,
-  0x1060, 0x1880, 0xe4e1, 0xfeb0, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xf520, 0xfd40, 0xece0, 0x4980,
-  0x0820, 0x4980, 0xece0, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x6a40,
-  0x0840, 0x6a40, 0xece0, 0xe4a0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xdc80, 0xd460, 0x8ae0,
-  0x1060, 0x8ae0, 0xd460, 0xd460, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xbc00, 0xa380,
-  0x20c0, 0xa380, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x5265,
-  0x4245, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x2940, 0x18e0, 0x2100,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xb403, 0x2922, 0x62a4,
-  0x5202, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff7b, 0xef7d, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xee50, 0xef3c, 0xef7d,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xece0, 0x51c1, 0x18c2, 0x51e2,
-  0xed22, 0xfd61, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1040, 0x1860,
-  0xe4c0, 0xfd40, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1880,
-  0xe4c0, 0xfd40, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xecc0, 0x4980, 0x0820, 0x4980,
-  0xece0, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xdc80, 0xd460, 0x6a20, 0x0840, 0x6a40,
-  0xf500, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xcc40, 0x8ae0, 0x1060, 0x9300,
-  0xf500, 0xe4a0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0x9b60, 0x20c0, 0xb3e0,
-  0xd460, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x4a45, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31c4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x2101, 0x2941, 0x2962, 0x2942,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x2920, 0x18e0, 0x2920, 0x2120,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac64, 0xabc2, 0x3142, 0xa3c3, 0x7304,
-  0x4a02, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xed66, 0xfdc7, 0xf62e, 0xef3a, 0xffbd, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xf586, 0xa3a2, 0xe610, 0xef5c, 0xffbd,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xece0, 0x4980, 0x18a1, 0x51e2, 0xed22,
-  0xfd62, 0xfd41, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1860, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xe4a0, 0xe4c0, 0x1880, 0x1060, 0x1880, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xd440, 0x4160, 0x0820, 0x4980, 0xece0,
-  0xfd40, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd440, 0x6a20, 0x0840, 0x6a40, 0xf500,
-  0xfd40, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3c1, 0x82c0, 0x1060, 0x8b00, 0xf500,
-  0xfd20, 0xdca0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5285, 0x5a62, 0x18c0, 0xbbe0, 0xd460,
-  0xcc60, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4225, 0x5285, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x2101, 0x2941, 0x2962, 0x2942,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x2920, 0x18e0, 0x2920, 0x2120,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac64, 0xabc2, 0x3142, 0xa3c3, 0x7304,
-  0x4a02, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xed66, 0xfdc7, 0xf62e, 0xef3a, 0xffbd, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xf586, 0xa3a2, 0xe610, 0xef5c, 0xffbd,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xece0, 0x4980, 0x18a1, 0x51e2, 0xed22,
-  0xfd62, 0xfd41, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1860, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xe4a0, 0xe4c0, 0x1880, 0x1060, 0x1880, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xd440, 0x4160, 0x0820, 0x4980, 0xece0,
-  0xfd40, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd440, 0x6a20, 0x0840, 0x6a40, 0xf500,
-  0xfd40, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3c1, 0x82c0, 0x1060, 0x8b00, 0xf500,
-  0xfd20, 0xdca0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5285, 0x5a62, 0x18c0, 0xbbe0, 0xd460,
-  0xcc60, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4225, 0x5285, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x2101, 0x2941, 0x2962, 0x2942,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x2920, 0x18e0, 0x2920, 0x2120,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac64, 0xabc2, 0x3142, 0xa3c3, 0x7304,
-  0x4a02, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xed66, 0xfdc7, 0xf62e, 0xef3a, 0xffbd, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xf586, 0xa3a2, 0xe610, 0xef5c, 0xffbd,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xece0, 0x4980, 0x18a1, 0x51e2, 0xed22,
-  0xfd62, 0xfd41, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1860, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xe4a0, 0xe4c0, 0x1880, 0x1060, 0x1880, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xd440, 0x4160, 0x0820, 0x4980, 0xece0,
-  0xfd40, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd440, 0x6a20, 0x0840, 0x6a40, 0xf500,
-  0xfd40, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3c1, 0x82c0, 0x1060, 0x8b00, 0xf500,
-  0xfd20, 0xdca0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5285, 0x5a62, 0x18c0, 0xbbe0, 0xd460,
-  0xcc60, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4225, 0x5285, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x2101, 0x2941, 0x2962, 0x2942,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x2920, 0x18e0, 0x2920, 0x2120,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac64, 0xabc2, 0x3142, 0xa3c3, 0x7304,
-  0x4a02, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xed66, 0xfdc7, 0xf62e, 0xef3a, 0xffbd, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xf586, 0xa3a2, 0xe610, 0xef5c, 0xffbd,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xece0, 0x4980, 0x18a1, 0x51e2, 0xed22,
-  0xfd62, 0xfd41, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1860, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xe4a0, 0xe4c0, 0x1880, 0x1060, 0x1880, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xd440, 0x4160, 0x0820, 0x4980, 0xece0,
-  0xfd40, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd440, 0x6a20, 0x0840, 0x6a40, 0xf500,
-  0xfd40, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3c1, 0x82c0, 0x1060, 0x8b00, 0xf500,
-  0xfd20, 0xdca0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5285, 0x5a62, 0x18c0, 0xbbe0, 0xd460,
-  0xcc60, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4225, 0x5285, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x2101, 0x2941, 0x2962, 0x2942,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x2920, 0x18e0, 0x2920, 0x2120,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac64, 0xabc2, 0x3142, 0xa3c3, 0x7304,
-  0x4a02, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xed66, 0xfdc7, 0xf62e, 0xef3a, 0xffbd, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xf586, 0xa3a2, 0xe610, 0xef5c, 0xffbd,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xece0, 0x4980, 0x18a1, 0x51e2, 0xed22,
-  0xfd62, 0xfd41, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1860, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xe4a0, 0xe4c0, 0x1880, 0x1060, 0x1880, 0xe4c0,
-  0xfd40, 0xfd20, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xd440, 0x4160, 0x0820, 0x4980, 0xece0,
-  0xfd40, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd440, 0x6a20, 0x0840, 0x6a40, 0xf500,
-  0xfd40, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3c1, 0x82c0, 0x1060, 0x8b00, 0xf500,
-  0xfd20, 0xdca0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5285, 0x5a62, 0x18c0, 0xbbe0, 0xd460,
-  0xcc60, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4225, 0x5285, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x2940, 0x18e0, 0x2100,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xb403, 0x2922, 0x62a4,
-  0x5202, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff7b, 0xef7d, 0xf77c,
-  0xee71, 0xe567, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xee50, 0xef3c, 0xef7d,
-  0xff9a, 0xfe8e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xece0, 0x51c1, 0x18c2, 0x51e2,
-  0xed22, 0xfd61, 0xfd41, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1040, 0x1860,
-  0xe4c0, 0xfd40, 0xfd62, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xfd20, 0xe4c0, 0x1880, 0x1060, 0x1880,
-  0xe4c0, 0xfd40, 0xfd41, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xecc0, 0x4980, 0x0820, 0x4980,
-  0xece0, 0xfd40, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xdc80, 0xd460, 0x6a20, 0x0840, 0x6a40,
-  0xf500, 0xfd20, 0xf520, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xcc40, 0x8ae0, 0x1060, 0x9300,
-  0xf500, 0xe4a0, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0x9b60, 0x20c0, 0xb3e0,
-  0xd460, 0xcc40, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x4a45, 0x5285,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31c4, 0x31a4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x8b00, 0x9320, 0xbbc0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9b20, 0x9300, 0x6200, 0x5a00,
-  0x6200, 0x9300, 0x9300, 0x9340, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9320, 0xa340, 0xece0, 0xe4a0, 0x1880, 0x1880,
-  0x1880, 0xd480, 0xa380, 0xbc01, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x9320, 0xd460, 0xece0, 0xfd40, 0xecc0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xf541, 0xf60b, 0xc421, 0x9b40, 0x6aa1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf500, 0xd460, 0xabc0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x9300, 0x9b20, 0xb3c0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6a20, 0x6220,
-  0x6a20, 0x8ae0, 0x9300, 0x9b40, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9320, 0xb3c0, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9300, 0x9b20, 0xb3c0, 0x9320, 0x6281, 0x2941,
-  0x4204, 0x82e1, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x62a2,
-  0x39e4, 0x5265, 0x82e1, 0x9300, 0x9300, 0x8ae0, 0x6220, 0x59e0,
-  0x6220, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8b00, 0x6ac2, 0x5265,
-  0x2962, 0x39e4, 0x5265, 0x82e1, 0x8b00, 0x9300, 0x8ac0, 0x6220,
-  0x8ac0, 0x9300, 0x9300, 0x8b00, 0x8ae0, 0x6aa2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x6aa2, 0x8ae0, 0x8ae0, 0x6220,
-  0x82e0, 0x8b00, 0x8ae0, 0x6aa2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4a65, 0x5265, 0x4a45,
-  0x5265, 0x5265, 0x4a65, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x8b00, 0x9320, 0xbbc0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9b20, 0x9300, 0x6200, 0x5a00,
-  0x6200, 0x9300, 0x9300, 0x9340, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9320, 0xa340, 0xece0, 0xe4a0, 0x1880, 0x1880,
-  0x1880, 0xd480, 0xa380, 0xbc01, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x9320, 0xd460, 0xece0, 0xfd40, 0xecc0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xf541, 0xf60b, 0xc421, 0x9b40, 0x6aa1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf500, 0xd460, 0xabc0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x8b00, 0x9320, 0xbbc0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9b20, 0x9300, 0x6200, 0x5a00,
-  0x6200, 0x9300, 0x9300, 0x9340, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9320, 0xa340, 0xece0, 0xe4a0, 0x1880, 0x1880,
-  0x1880, 0xd480, 0xa380, 0xbc01, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x9320, 0xd460, 0xece0, 0xfd40, 0xecc0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xf541, 0xf60b, 0xc421, 0x9b40, 0x6aa1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf500, 0xd460, 0xabc0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x9300, 0x9b20, 0xb3c0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6a20, 0x6220,
-  0x6a20, 0x8ae0, 0x9300, 0x9b40, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9320, 0xb3c0, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9300, 0x9b20, 0xb3c0, 0x9320, 0x6281, 0x2941,
-  0x4204, 0x82e1, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x6200, 0x59e0,
-  0x6200, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x9300, 0x8ae0, 0x62a2,
-  0x39e4, 0x5265, 0x82e1, 0x9300, 0x9300, 0x8ae0, 0x6220, 0x59e0,
-  0x6220, 0x8ae0, 0x9300, 0x9300, 0x9300, 0x8b00, 0x6ac2, 0x5265,
-  0x2962, 0x39e4, 0x5265, 0x82e1, 0x8b00, 0x9300, 0x8ac0, 0x6220,
-  0x8ac0, 0x9300, 0x9300, 0x8b00, 0x8ae0, 0x6aa2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x6aa2, 0x8ae0, 0x8ae0, 0x6220,
-  0x82e0, 0x8b00, 0x8ae0, 0x6aa2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x4a65, 0x5265, 0x4a45,
-  0x5265, 0x5265, 0x4a65, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x1901, 0x2101, 0x2941, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18e0, 0x20e0, 0x2921, 0x2921, 0x2921, 0x2121,
-  0x2121, 0x2962, 0x31a3, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2941, 0x6281, 0x82c0, 0x8ae0, 0x8ae0, 0x8ae0, 0x6220,
-  0x41a1, 0x2941, 0x2921, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x6281, 0x8b00, 0x9300, 0x9320, 0xbbc0, 0xc400, 0xbbe0,
-  0x9300, 0x82e0, 0x6281, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x39c3, 0x82e0, 0x9300, 0x9300, 0x8b00, 0x9320, 0xbbc0, 0xbbe0,
-  0xb3c0, 0x9300, 0x8b00, 0x7b22, 0x3181, 0x2101, 0x2962, 0x31a3,
-  0x4204, 0x8ae0, 0x9300, 0x9300, 0x9b20, 0x9300, 0x6200, 0x5a00,
-  0x6200, 0x9300, 0x9300, 0x9340, 0x9c03, 0x3181, 0x2101, 0x2962,
-  0x4204, 0x8ae0, 0x9320, 0xa340, 0xece0, 0xe4a0, 0x1880, 0x1880,
-  0x1880, 0xd480, 0xa380, 0xbc01, 0x9b60, 0x7b22, 0x2941, 0x1901,
-  0x5265, 0x9320, 0xd460, 0xece0, 0xfd40, 0xecc0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xf541, 0xf60b, 0xc421, 0x9b40, 0x6aa1, 0x2941,
-  0x4a24, 0xabc1, 0xdc80, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf500, 0xd460, 0xabc0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000,
-  0x0000, 0x10a0, 0x2101, 0x2941, 0x2961, 0x2962, 0x31a3, 0x2962,
-  0x31a3, 0x31a3, 0x2982, 0x31a3, 0x2962, 0x2101, 0x10a0, 0x0020,
-  0x10a0, 0x10a0, 0x18e1, 0x18e1, 0x1901, 0x2141, 0x2962, 0x2962,
-  0x2962, 0x31a3, 0x31a3, 0x2982, 0x3183, 0x2121, 0x1901, 0x10a0,
-  0x1901, 0x18e1, 0x18c0, 0x2100, 0x3161, 0x3161, 0x2940, 0x18e0,
-  0x2101, 0x2942, 0x3183, 0x31a3, 0x2962, 0x3183, 0x2962, 0x2101,
-  0x1901, 0x2921, 0x6ac2, 0xac84, 0xe567, 0xed88, 0xb3e3, 0x2902,
-  0x41c2, 0x3161, 0x2121, 0x2942, 0x2121, 0x2962, 0x31a3, 0x2962,
-  0x2121, 0x72e2, 0xe566, 0xfdc7, 0xfe6e, 0xff9b, 0xffbd, 0xef5c,
-  0xf671, 0xe568, 0x72e3, 0x2941, 0x1901, 0x2962, 0x31a3, 0x2962,
-  0x4204, 0xe546, 0xfdc6, 0xfda6, 0xfd62, 0xfe90, 0xef5c, 0xef5d,
-  0xf73a, 0xfe6e, 0xed66, 0x8b83, 0x3161, 0x2101, 0x2962, 0x31a3,
-  0x4a44, 0xed46, 0xfd61, 0xfd40, 0xfd40, 0xed01, 0x51e2, 0x18c2,
-  0x51e2, 0xed01, 0xfd61, 0xf5c8, 0xac65, 0x3161, 0x2101, 0x2962,
-  0x4a24, 0xcc61, 0xf520, 0xfd20, 0xfd40, 0xe4c0, 0x1880, 0x1040,
-  0x1860, 0xe4c0, 0xfd82, 0xff79, 0xf691, 0x8ba3, 0x2941, 0x1901,
-  0x5285, 0xbbe0, 0xdc80, 0xf520, 0xfd40, 0xe4c0, 0x1880, 0x1060,
-  0x1880, 0xe4c0, 0xfd61, 0xfe90, 0xff58, 0xed22, 0x72c1, 0x2941,
-  0x4a24, 0xabc1, 0xd460, 0xdca0, 0xfd20, 0xece0, 0x4980, 0x0820,
-  0x4980, 0xece0, 0xfd40, 0xfd41, 0xf542, 0xdc80, 0xb3c0, 0x6aa2,
-  0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xe4a0, 0xece0, 0x6a40, 0x0840,
-  0x6a20, 0xece0, 0xfd20, 0xdca0, 0xdc80, 0xbbe0, 0x72e2, 0x5265,
-  0x2962, 0x39e4, 0x5a85, 0xb3e1, 0xd460, 0xd460, 0x8ae0, 0x1060,
-  0x8ae0, 0xdc80, 0xdc80, 0xcc60, 0xb3e0, 0x6ac2, 0x4a45, 0x39c4,
-  0x2101, 0x2962, 0x39e4, 0x5265, 0x72e2, 0xb3e0, 0xa380, 0x20c0,
-  0xb3e0, 0xcc60, 0xb3e0, 0x72e2, 0x5265, 0x39e4, 0x31a3, 0x2962,
-  0x1901, 0x2101, 0x2962, 0x31a4, 0x39e4, 0x5265, 0x5285, 0x4245,
-  0x5285, 0x5285, 0x5265, 0x39e4, 0x2962, 0x2962, 0x2941, 0x1901,
-  0x10a0, 0x18e1, 0x2101, 0x2941, 0x2962, 0x31a3, 0x31a4, 0x31c4,
-  0x31a4, 0x31a4, 0x31a3, 0x2962, 0x2101, 0x1901, 0x10a0, 0x0020,
-  0x0020, 0x10a0, 0x10a0, 0x2101, 0x2101, 0x2101, 0x2962, 0x2962,
-  0x2101, 0x2101, 0x2101, 0x10c0, 0x10a0, 0x10a0, 0x0000, 0x0000
-};
-
-const Animation snake_eyeAnimation = {
-  .name = "Snake Eye",
-  .frameCount = 52,
-  .width = 16,
-  .height = 16,
-  .frameDurations = snake_eyeDurations,
-  .animationFrames = snake_eyeFrames
-};
-#endif // ANIMATION_SNAKE_EYE_H
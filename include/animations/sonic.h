@@ -1,790 +0,0 @@
-// sonic.h - Auto-generated from sonic.json
-#ifndef ANIMATION_SONIC_H
-#define ANIMATION_SONIC_H
-
-#include "animation_types.h"
-
-// Frame Durations for sonic (in 100ms units)
-static const uint8_t PROGMEM sonicDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for sonic
-static const uint16_t PROGMEM sonicFrames[] = {
-  0x5a60, 0x01b8, 0x01b8, 0x01b8, 0x033d, 0x033d, 0x0010, 0x9000,
-  0x033d, 0x1c3d, 0x1c3d, 0x1c3d, 0x351d, 0x0010, 0x3980, 0x3980,
-  0x5a60, 0x5a60, 0x5a60, 0x0010, 0x01b8, 0x033d, 0x0010, 0xc346,
-  0xf592, 0x033d, 0x033d, 0x1c3d, 0x1c3d, 0x351d, 0x3980, 0x3980,
-  0x5a60, 0x5a60, 0x5a60, 0x5a60, 0x0010, 0x01b8, 0x033d, 0x351d,
-  0x351d, 0x1c3d, 0x033d, 0x033d, 0x1c3d, 0x1c3d, 0x351d, 0x3980,
-  0x3980, 0x3980, 0x01b8, 0x01b8, 0x0010, 0x01b8, 0x351d, 0x9efc,
-  0xffff, 0x9efc, 0x351d, 0x033d, 0x033d, 0x351d, 0x033d, 0x3980,
-  0x3980, 0x01b8, 0x0010, 0x0010, 0x0010, 0x01b8, 0x9efc, 0xffff,
-  0xffff, 0xffff, 0x9efc, 0x351d, 0x351d, 0x9efc, 0x6e9e, 0x3980,
-  0x01b8, 0x0010, 0x0010, 0x0010, 0x0010, 0x033d, 0xffff, 0xffff,
-  0xffff, 0x6515, 0x0000, 0x9efc, 0x6515, 0x0000, 0x6e9e, 0x3140,
-  0x0010, 0x0010, 0x0010, 0x0010, 0x0010, 0x033d, 0xffff, 0xffff,
-  0xffff, 0x6515, 0x0000, 0x9efc, 0x6515, 0x0000, 0x6e9e, 0x3140,
-  0x3140, 0x3140, 0x0010, 0x0010, 0x0010, 0x033d, 0x9efc, 0xffff,
-  0xffff, 0x12ad, 0x0000, 0xffff, 0x6515, 0x0000, 0x351d, 0x3140,
-  0x0295, 0x0295, 0x0295, 0x0010, 0x0010, 0x01b8, 0x033d, 0x9efc,
-  0xffff, 0x12ad, 0x0000, 0xffff, 0x12ad, 0x12ad, 0x6515, 0x0295,
-  0x0295, 0x0295, 0x0295, 0x01b8, 0x0010, 0x0010, 0x01b8, 0xf592,
-  0xf592, 0xee98, 0xee98, 0xee98, 0x0000, 0x0000, 0x12ad, 0x0295,
-  0x0295, 0x0295, 0x01b8, 0x0010, 0x0010, 0x0010, 0x9000, 0xf46c,
-  0xf592, 0xf592, 0xf592, 0xf592, 0xf46c, 0xc346, 0x0295, 0x039d,
-  0x0295, 0x01b8, 0x0010, 0x0010, 0x0010, 0x0010, 0x4000, 0x9000,
-  0xc346, 0xf46c, 0xf46c, 0xc346, 0xc346, 0x0295, 0x0295, 0x0295,
-  0x0295, 0x0295, 0x0295, 0x0295, 0xc346, 0x9000, 0x9000, 0x0010,
-  0x4000, 0x9000, 0x4000, 0x0295, 0x0295, 0x0295, 0x0295, 0x0295,
-  0x0295, 0x0295, 0x0295, 0xc346, 0x9000, 0x4000, 0x0010, 0x0010,
-  0xc346, 0xf46c, 0xc346, 0x01b8, 0x0295, 0x0295, 0x0295, 0x0295,
-  0x0295, 0x0295, 0x0295, 0x0295, 0xc346, 0x6515, 0x9efc, 0x12ad,
-  0x9000, 0xc346, 0x9000, 0x01b8, 0x12ad, 0x0295, 0x0295, 0x0295,
-  0x0295, 0x039d, 0x0295, 0x0295, 0x6515, 0x9efc, 0x9efc, 0x6515,
-  0x4000, 0x9000, 0x4000, 0x6515, 0x9efc, 0x0295, 0x0295, 0x0295,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x02b5,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a93, 0x035b,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0275, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x035b, 0x0295, 0x0294, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x02b5,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a93, 0x035b,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0275, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x035b, 0x0295, 0x0294, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x02b5,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a93, 0x035b,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0275, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x035b, 0x0295, 0x0294, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xbcf3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x34bb,
-  0x3cfc, 0x1c1d, 0x035d, 0x033d, 0x141d, 0x1c7d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x245d, 0x143d,
-  0x141d, 0x143d, 0x249d, 0x035d, 0x0b7d, 0x249e, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0030, 0x01d7, 0x139d, 0x139d,
-  0x139d, 0x0b5c, 0x0b3b, 0x34dd, 0x2cbc, 0x137b, 0x557a, 0x4202,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xd73f, 0xef9f,
-  0xe77e, 0x5c94, 0x1105, 0x8619, 0x5cd4, 0x1106, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xd73f, 0xef9f,
-  0xdf5e, 0x5c95, 0x1105, 0x9639, 0x5c95, 0x0906, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0050, 0x02dc, 0x139d, 0x1bbd,
-  0x139d, 0x033c, 0x137b, 0xcf1e, 0x1bbd, 0x033c, 0x349a, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x0b3c, 0x7dfb,
-  0x347c, 0x243d, 0x3cbd, 0xd73e, 0x241b, 0x13da, 0x4c75, 0x0a93,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xe593, 0xde17, 0xde57, 0xddf6, 0x2924, 0x10a3, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed50, 0xf591, 0xf591, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xbcf3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x34bc,
-  0x3cfc, 0x1c1d, 0x035d, 0x033d, 0x141d, 0x1c7d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x245c, 0x1c3c,
-  0x141c, 0x1c1c, 0x247c, 0x0b7d, 0x0b7d, 0x245b, 0x1291, 0x39a1,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0030, 0x01b6, 0x0a73, 0x0273,
-  0x0273, 0x0273, 0x0ab4, 0x247b, 0x247b, 0x0a94, 0x0a0f, 0x39a1,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x002f, 0x0212, 0x02fb, 0x031c,
-  0x031c, 0x031c, 0x02fb, 0x0274, 0x0a94, 0x02fb, 0x0a30, 0x3161,
-  0x002e, 0x000e, 0x000f, 0x000f, 0x002f, 0x0212, 0x02fb, 0x02fc,
-  0x02fc, 0x02fc, 0x031c, 0x135c, 0x02fb, 0x02fb, 0x0a51, 0x3161,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x002f, 0x01f2, 0x0273, 0x0a93,
-  0x0273, 0x0253, 0x1ad4, 0xc6bd, 0x1af4, 0x0a94, 0x2c58, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0196, 0x0b3b, 0x85fa,
-  0x345b, 0x241b, 0x3c9c, 0xdf3e, 0x23fa, 0x13b9, 0x4c75, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xe593, 0xde37, 0xde58, 0xddf6, 0x2924, 0x10a3, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x000f, 0x000e, 0x7863, 0xe3ea,
-  0xed50, 0xf591, 0xf591, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xbcf3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x34bb,
-  0x3cfc, 0x1c1d, 0x035d, 0x033d, 0x141d, 0x1c7d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x245d, 0x143d,
-  0x141d, 0x143d, 0x249d, 0x035d, 0x0b7d, 0x249e, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0030, 0x01d7, 0x139d, 0x139d,
-  0x139d, 0x0b5c, 0x0b3b, 0x34dd, 0x2cbc, 0x137b, 0x557a, 0x4202,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xd73f, 0xef9f,
-  0xe77e, 0x5c94, 0x1105, 0x8619, 0x5cd4, 0x1106, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xd73f, 0xef9f,
-  0xdf5e, 0x5c95, 0x1105, 0x9639, 0x5c95, 0x0906, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0050, 0x02dc, 0x139d, 0x1bbd,
-  0x139d, 0x033c, 0x137b, 0xcf1e, 0x1bbd, 0x033c, 0x349a, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x0b3c, 0x7dfb,
-  0x347c, 0x243d, 0x3cbd, 0xd73e, 0x241b, 0x13da, 0x4c75, 0x0a93,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xe593, 0xde17, 0xde57, 0xddf6, 0x2924, 0x10a3, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed50, 0xf591, 0xf591, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x02b5,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a93, 0x035b,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0275, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x035b, 0x0295, 0x0294, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x02b5,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a93, 0x035b,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0275, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x035b, 0x0295, 0x0294, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0274, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x035b, 0x0295, 0x0275, 0x1ab3, 0x9b29, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0295, 0x0275, 0x0295, 0x0b7b, 0x64d5, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275,
-  0x5241, 0x11d3, 0x09b5, 0x01b7, 0x02fc, 0x02fc, 0x082f, 0x7863,
-  0x2339, 0x141d, 0x141d, 0x1c5d, 0x2c7c, 0x08f0, 0x3960, 0x4180,
-  0x5a60, 0x5a41, 0x5222, 0x088e, 0x01b7, 0x02bb, 0x08b1, 0xa308,
-  0xb4d3, 0x137c, 0x033d, 0x141d, 0x1c5d, 0x2c3a, 0x3a04, 0x3980,
-  0x5a40, 0x5a40, 0x5a41, 0x49e4, 0x006f, 0x01b7, 0x0b1c, 0x3cfb,
-  0x4d3c, 0x245d, 0x035d, 0x033d, 0x13fd, 0x1c5d, 0x2c38, 0x39c2,
-  0x41a0, 0x39a3, 0x09b3, 0x0974, 0x0030, 0x01b7, 0x34dc, 0x9edc,
-  0xdf9e, 0x9edc, 0x3d1d, 0x035d, 0x0b7d, 0x34fe, 0x139b, 0x39a2,
-  0x31a3, 0x0973, 0x0051, 0x0030, 0x0010, 0x0a17, 0x967c, 0xf7de,
-  0xffff, 0xe77d, 0x8e3a, 0x3d1c, 0x34fc, 0x7e1a, 0x5dba, 0x41e2,
-  0x0175, 0x0051, 0x000f, 0x000f, 0x0030, 0x131c, 0xe77f, 0xffff,
-  0xf7be, 0x6cf5, 0x1965, 0x8619, 0x5cd5, 0x1966, 0x5d78, 0x39e3,
-  0x002f, 0x000e, 0x000f, 0x000f, 0x0030, 0x133c, 0xe77f, 0xffff,
-  0xefbe, 0x5c93, 0x10c3, 0x9639, 0x5cd4, 0x08c3, 0x5558, 0x39c2,
-  0x2942, 0x2924, 0x004f, 0x000f, 0x0030, 0x0b1b, 0x967c, 0xf7df,
-  0xef9e, 0x22ed, 0x10a3, 0xd6fb, 0x64b4, 0x0905, 0x3458, 0x31c4,
-  0x0273, 0x0273, 0x0234, 0x0050, 0x0030, 0x0197, 0x137c, 0xa6bb,
-  0xe75c, 0x330d, 0x2145, 0xd6ba, 0x2b0d, 0x126b, 0x4c54, 0x0ab3,
-  0x0275, 0x0295, 0x0275, 0x0175, 0x0030, 0x0030, 0x19d5, 0xd532,
-  0xedb3, 0xde15, 0xddf5, 0xddf6, 0x2103, 0x10a2, 0x1a8d, 0x0294,
-  0x0275, 0x0255, 0x0196, 0x0030, 0x0010, 0x000e, 0x7863, 0xe3ea,
-  0xed30, 0xf591, 0xf592, 0xed30, 0xdbea, 0x92e7, 0x0a73, 0x0275,
-  0x0275, 0x01d6, 0x0071, 0x0030, 0x084f, 0x100d, 0x4800, 0x8882,
-  0xb2e6, 0xe40a, 0xdc0b, 0xb368, 0xa348, 0x1ab3, 0x0275, 0x0275,
-  0x0275, 0x0275, 0x0254, 0x1a72, 0x9a66, 0x8021, 0x7002, 0x180c,
-  0x5082, 0x90a1, 0x58c2, 0x1252, 0x0a94, 0x0275, 0x0275, 0x0295,
-  0x0275, 0x0275, 0x0a94, 0x92e8, 0x90c1, 0x4862, 0x188e, 0x086e,
-  0xa2a6, 0xdbc9, 0xa2a6, 0x09d5, 0x0254, 0x0274, 0x0275, 0x0275,
-  0x0275, 0x0295, 0x0295, 0x1a92, 0x9b28, 0x6cd3, 0x85f9, 0x2acd,
-  0x80a2, 0xbaa4, 0x80a2, 0x11f4, 0x1af0, 0x0294, 0x0275, 0x0295,
-  0x0274, 0x0295, 0x035b, 0x02b5, 0x64d4, 0x96ba, 0x9edb, 0x5c93,
-  0x4841, 0x8020, 0x4841, 0x5c74, 0x8619, 0x0ad5, 0x0274, 0x0275
-};
-
-const Animation sonicAnimation = {
-  .name = "Sonic",
-  .frameCount = 24,
-  .width = 16,
-  .height = 16,
-  .frameDurations = sonicDurations,
-  .animationFrames = sonicFrames
-};
-#endif // ANIMATION_SONIC_H
@@ -1,1942 +0,0 @@
-// spiderman.h - Auto-generated from spiderman.json
-#ifndef ANIMATION_SPIDERMAN_H
-#define ANIMATION_SPIDERMAN_H
-
-#include "animation_types.h"
-
-// Frame Durations for spiderman (in 100ms units)
-static const uint8_t PROGMEM spidermanDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for spiderman
-static const uint16_t PROGMEM spidermanFrames[] = {
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x147f, 0x02bf, 0x02bf,
-  0x037f, 0x147f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0239, 0x02bf, 0x02bf,
-  0x0239, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x037f, 0x037f, 0x02bf, 0x02bf, 0x02bf, 0x0239, 0x02bf, 0x02bf,
-  0x0239, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0239,
-  0x0239, 0x0239, 0x0239, 0x02bf, 0x0239, 0x0239, 0x0239, 0x02bf,
-  0x0239, 0x01b4, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0239,
-  0x037f, 0x037f, 0x0239, 0x02bf, 0x0239, 0x01b4, 0x0239, 0x02bf,
-  0x0239, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0239,
-  0x01b4, 0x01b4, 0x0239, 0x02bf, 0x0239, 0x037f, 0x037f, 0x147f,
-  0x6c4a, 0x0239, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x0239,
-  0x037f, 0x037f, 0x0239, 0x02bf, 0x01b4, 0x0239, 0x0239, 0x0239,
-  0x0239, 0x01b4, 0x02bf, 0x037f, 0x037f, 0x037f, 0x02bf, 0x0239,
-  0x01b4, 0x01b4, 0x0239, 0x02bf, 0x01b4, 0x0239, 0x6c4a, 0x0239,
-  0x0239, 0x0239, 0x037f, 0x0239, 0x0239, 0x0239, 0x147f, 0x0239,
-  0x037f, 0x037f, 0x037f, 0x02bf, 0x01b4, 0x0239, 0x01b4, 0x0239,
-  0x6c4a, 0x0239, 0x01b4, 0x0239, 0x0239, 0x0239, 0x037f, 0x037f,
-  0x037f, 0x0239, 0x0239, 0x147f, 0x01b4, 0x0239, 0x0239, 0x0239,
-  0x0239, 0x0239, 0x01b4, 0x0239, 0x01b4, 0x0239, 0x6c4a, 0x0239,
-  0x0239, 0x6c4a, 0x0239, 0x01b4, 0x01b4, 0x0239, 0x01b4, 0x0239,
-  0x0239, 0x0239, 0x01b4, 0x0239, 0x0239, 0x0239, 0x0239, 0x0239,
-  0x0239, 0x0239, 0x0239, 0x01b4, 0x01b4, 0x0239, 0x0239, 0x0239,
-  0x02bf, 0x02bf, 0x027d, 0x1064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025a, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2822, 0x1064, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1022, 0x1064, 0x025a, 0x027d, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c,
-  0x027c, 0x027d, 0x02bf, 0x02bf, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2064, 0x025b, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2022, 0x1064, 0x025b, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1022, 0x1064, 0x025a, 0x027d, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027d,
-  0x027d, 0x029d, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x02bf,
-  0x033f, 0x033f, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x029f, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2064, 0x027b, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2022, 0x1064, 0x027a, 0x0bdf, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1042, 0x1064, 0x025a, 0x027d, 0x029f, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x027c,
-  0x02fc, 0x02fc, 0x02bf, 0x02bf, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x025a,
-  0x027a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x3800, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1084, 0x027d, 0x02bf,
-  0x02bf, 0x02df, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2064, 0x0b7a, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2022, 0x1064, 0x023a, 0x027b, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029f, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1022, 0x1044, 0x023a, 0x027d, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0217,
-  0x0217, 0x0218, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x1000, 0x2000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0x2000, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x035e, 0x0bde, 0x027b, 0x2044, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01f6, 0x029f, 0x02bf,
-  0x0239, 0x025a, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2021, 0x1064, 0x023a, 0x025a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1042, 0x1064, 0x01d6, 0x027c, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0218,
-  0x02fb, 0x02fb, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x28a2, 0xbe18, 0x38a2, 0xe800,
-  0xe800, 0x38a2, 0xbe18, 0x28a2, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x1000, 0x3082, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x035f, 0x0bbc, 0x1084, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x0239, 0x025a, 0x025a, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01f6, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2021, 0x1044, 0x01d5, 0x0219, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1021, 0x1043, 0x01d6, 0x027c, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0217,
-  0x01d4, 0x01d4, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x28a2, 0xe75d, 0xdedb, 0x2082,
-  0x2061, 0xd6ba, 0xef7d, 0x28a2, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xc800, 0x28a2, 0xbe38, 0x4945, 0xd000,
-  0xd000, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1042, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x025a, 0x0238, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x027c, 0x02bf,
-  0x0219, 0x0239, 0x023a, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01d5, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2021, 0x1064, 0x01d5, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x027d, 0x025a, 0x1064, 0x1022,
-  0x1042, 0x1064, 0x01d6, 0x025c, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x0218,
-  0x02fb, 0x02fb, 0x025a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02df, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x1800, 0x10a2, 0x18c3, 0x0000,
-  0x0000, 0x10c3, 0x10a2, 0x1800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xc800, 0x2882, 0xd6ba, 0xc638, 0x2061,
-  0x2061, 0xc638, 0xd6ba, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1042, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x027c, 0x02bf,
-  0x0239, 0x01f7, 0x1044, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x0218, 0x029f,
-  0x0218, 0x01f6, 0x023a, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01b2, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029f, 0x025b, 0x1064, 0x2022, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2022, 0x1044, 0x01f5, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x02bf, 0x029d, 0x025a, 0x1064, 0x1022,
-  0x1021, 0x1043, 0x01d6, 0x025c, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x033f, 0x029c, 0x0217,
-  0x01b3, 0x01d4, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x033e, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1022, 0xe000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x2800, 0x2882, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x2882, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1842, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1021, 0x0218, 0x029f,
-  0x0219, 0x01b4, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x0238, 0x02df,
-  0x0a57, 0x0239, 0x023a, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x02da, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x025b, 0x1064, 0x2042, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2021, 0x1043, 0x0192, 0x0259, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x031c, 0x02da, 0x1084, 0x1022,
-  0x1042, 0x1064, 0x01f6, 0x025c, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x023a, 0x027a, 0x0b9c, 0x0258,
-  0x031c, 0x031c, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x035e,
-  0x033e, 0x0a99, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x023a, 0x2022, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2822, 0x023a, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xc800, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1842, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1001, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1021, 0x0218, 0x02df,
-  0x0a58, 0x01f7, 0x1044, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1064, 0x02fc, 0x0bff,
-  0x53cd, 0x0a58, 0x023a, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01d5, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02bf, 0x02da, 0x1064, 0x2021, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2042, 0x1043, 0x0192, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0217, 0x01d5, 0x1064, 0x1042,
-  0x1042, 0x1064, 0x02da, 0x029c, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0219, 0x0259, 0x031b, 0x031c,
-  0x02fb, 0x0236, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a79,
-  0x0a79, 0x4baf, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x025a, 0x2022, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0x2022, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2064, 0x025a, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x02bf, 0x027d, 0x1022, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1842, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1821, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1021, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1022, 0x02fc, 0x0bff,
-  0x53cd, 0x0a36, 0x1044, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x0a56, 0x0279,
-  0x0a57, 0x01f6, 0x025a, 0x2044, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x09f4, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031e, 0x01f6, 0x1043, 0x2021, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2022, 0x1063, 0x0192, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x01f7, 0x01d5, 0x1882, 0x1022,
-  0x1022, 0x1862, 0x0215, 0x0b7b, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x436d, 0x0216,
-  0x0216, 0x436c, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a58, 0x0239,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025a, 0x1022, 0x2800, 0xe800,
-  0xe800, 0x2800, 0x1022, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x025a, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x025a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2064, 0x025a, 0x02bf, 0x02bf,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x02df, 0x029d, 0x1022, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x035f, 0x0b9c, 0x1842, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1021, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1821, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x02fc, 0x0bff,
-  0x53cd, 0x0a15, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1021, 0x0a56, 0x027a,
-  0x0a58, 0x01b4, 0x1064, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1862, 0x436c, 0x0a58,
-  0x0a57, 0x0239, 0x02b9, 0x2064, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01d5, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x01d5, 0x1043, 0x2021, 0xd000, 0xe800,
-  0xe800, 0xd000, 0x2021, 0x1043, 0x0191, 0x0239, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01b4, 0x01d5, 0x1064, 0x1022,
-  0x1022, 0x1044, 0x01d5, 0x01b3, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0239, 0x0239, 0x01f7, 0x01f7,
-  0x01f7, 0x01f7, 0x0238, 0x01d4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x027d, 0x0065, 0x1043, 0xd000, 0xd000, 0x2000,
-  0x2000, 0xd000, 0xd000, 0x1042, 0x0065, 0x027d, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x029f, 0x027d, 0x0218, 0x2022, 0x3800, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x027d, 0x029f, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x025b, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x025a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2064, 0x025a, 0x02bf, 0x02bf,
-  0x02df, 0x029d, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x035f, 0x0b9c, 0x1842, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x0237, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1821, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1021, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1022, 0x02fc, 0x0bff,
-  0x53cd, 0x0a35, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f7, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x09d2, 0x0239,
-  0x53cd, 0x0a57, 0x0192, 0x2043, 0xd000, 0xe800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe800, 0xd000, 0x2043, 0x01d5, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x01d5, 0x1064, 0x2022, 0xd000, 0xe000,
-  0xe000, 0xd000, 0x2022, 0x1043, 0x0192, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0217, 0x01d5, 0x1022, 0x1000,
-  0x1000, 0x1021, 0x01d4, 0x01b3, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x027d, 0x1064, 0xd000, 0xe800, 0xf800, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xf800, 0xe800, 0xd000, 0x1064, 0x027d, 0x02bf,
-  0x02bf, 0x02bf, 0x025a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3800,
-  0x3000, 0xd000, 0xd000, 0x2022, 0x1064, 0x025a, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x029d, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x025b, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x025b, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2064, 0x0b7a, 0x02df, 0x02bf,
-  0x035f, 0x0bbc, 0x1084, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1084, 0x027d, 0x02bf,
-  0x025a, 0x0237, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1821, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1021, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1821, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1822, 0x02fc, 0x0bff,
-  0x53cd, 0x0a35, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1821, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1021, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1021, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x01f6, 0x0239,
-  0x0a58, 0x0238, 0x0192, 0x2043, 0xd000, 0xe000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe000, 0xd000, 0x2043, 0x01d5, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x01d5, 0x1022, 0x2000, 0xe000, 0xf800,
-  0xf800, 0xe800, 0x2800, 0x1021, 0x0171, 0x0239, 0x0238, 0x0239,
-  0x027d, 0x1065, 0xd000, 0xe800, 0x2862, 0x2418, 0xe862, 0xf800,
-  0xf800, 0xe862, 0x2418, 0x2862, 0xe800, 0xd800, 0x1065, 0x027d,
-  0x02bf, 0x025a, 0x2064, 0xd000, 0xd000, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd000, 0xd000, 0x2064, 0x025a, 0x02bf,
-  0x02bf, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1064, 0x025b, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x029d, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x027b, 0x0bdf, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x027a, 0x2044, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x0216, 0x02bf, 0x02bf,
-  0x025a, 0x0238, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x027c, 0x02bf,
-  0x0239, 0x01f6, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1821, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1021, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1821, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1822, 0x02fc, 0x0bff,
-  0x53cd, 0x0a35, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xe800, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe800, 0x1021, 0x01f6, 0x0239,
-  0x0a58, 0x0217, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x01b4, 0x0239,
-  0x0239, 0x0218, 0x0191, 0x2021, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0x2021, 0x01d5, 0x0218, 0x0239,
-  0x027c, 0x1022, 0xe800, 0xe862, 0x1418, 0x0148, 0x2418, 0xe862,
-  0xe862, 0x2418, 0x0148, 0x1418, 0xe862, 0xe800, 0x1022, 0x027c,
-  0x027c, 0x1065, 0xd800, 0xe800, 0x28c4, 0x23d6, 0xd0c4, 0xf800,
-  0xf800, 0xd0c4, 0x23d6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x02bf, 0x025b, 0x2064, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2064, 0x025b, 0x02bf,
-  0x029f, 0x02bf, 0x025b, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1064, 0x027b, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x029d, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x025a, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x025a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01d6, 0x029e, 0x02bf,
-  0x0239, 0x01f7, 0x1044, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x0218, 0x029f,
-  0x0219, 0x01b3, 0x1001, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1821, 0x0218, 0x02df,
-  0x0a58, 0x01f6, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1822, 0x02fc, 0x0bff,
-  0x53cd, 0x0a35, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1821, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1821, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0x1021, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0x1022, 0x01f6, 0x0239,
-  0x02bf, 0x025a, 0x2022, 0xe800, 0xd8e5, 0x1418, 0x08e5, 0xe800,
-  0xe800, 0x08e5, 0x0c18, 0xd0e5, 0xe800, 0x2822, 0x025a, 0x02bf,
-  0x027c, 0x1065, 0xd800, 0xe862, 0x23b6, 0x0189, 0x23b6, 0xe862,
-  0xe842, 0x23b6, 0x0189, 0x23b6, 0xe862, 0xd800, 0x1064, 0x027c,
-  0x027c, 0x1064, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x02bf, 0x025b, 0x2064, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2084, 0x025b, 0x02bf,
-  0x02bf, 0x02df, 0x025b, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2022, 0x1084, 0x0b7a, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x027d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x027d, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x023a, 0x023a, 0x029e, 0x02bf,
-  0x0219, 0x0239, 0x023a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01d5, 0x023a, 0x029e,
-  0x0219, 0x01b4, 0x1043, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x0238, 0x02df,
-  0x0a58, 0x01f6, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1822, 0x02fc, 0x0bff,
-  0x53cd, 0x0a35, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1821, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1021, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1021, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xe000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xe000, 0x1022, 0x01f6, 0x0239,
-  0x0042, 0x0043, 0x1000, 0xe000, 0xf800, 0xe862, 0xd000, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xe800, 0x1000, 0x0042, 0x0042,
-  0x027c, 0x0218, 0x2022, 0xe800, 0xd8c4, 0x23b6, 0x20c4, 0xd000,
-  0xd000, 0x20c4, 0x23b6, 0xd8c4, 0xe800, 0x2022, 0x0218, 0x027c,
-  0x027d, 0x1065, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x027c, 0x1064, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x02bf, 0x027b, 0x2064, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x025a, 0x02bf,
-  0x035e, 0x0bff, 0x027b, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1044, 0x01f6, 0x02bf, 0x02bf,
-  0x0239, 0x025a, 0x02bf, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x027c, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2044, 0x01f6, 0x0239, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x023a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x0192, 0x0259, 0x02df,
-  0x0a58, 0x01f7, 0x1044, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x02fc, 0x0bff,
-  0x53cd, 0x0a15, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1821, 0x0a56, 0x027a,
-  0x0a58, 0x01b3, 0x1021, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xc800, 0x1821, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xd000, 0x1000, 0x2882, 0xd000, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xd000, 0x3800, 0xd000, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xd000, 0x3800, 0xd000, 0x1821, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xe000, 0xe800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xe800, 0xe000, 0x1022, 0x01f6, 0x0239,
-  0x04bc, 0x04dc, 0x047a, 0x2062, 0xe800, 0xf800, 0xe800, 0x0800,
-  0x0800, 0xe800, 0xf800, 0xe800, 0x2862, 0x047a, 0x04dc, 0x04dc,
-  0x00a5, 0x00a5, 0x0862, 0xd000, 0xf800, 0xe862, 0xd000, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x027c, 0x0218, 0x2021, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x027c,
-  0x027d, 0x1065, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x029c, 0x1084, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x035e, 0x0b7a, 0x2084, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x025b, 0x02bf,
-  0x0239, 0x027a, 0x025a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x01f6, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029f, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x0218, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2064, 0x01d5, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x023a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x02ba, 0x033e, 0x0bfe,
-  0x53cd, 0x0a35, 0x1044, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1064, 0x0a56, 0x0279,
-  0x0a58, 0x01b3, 0x1001, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1840, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1821, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xbe38, 0x28a2, 0xd000, 0x1821, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xd000, 0x1800, 0x3082, 0xd800, 0xf800,
-  0xf800, 0xd800, 0x3082, 0x1000, 0xd000, 0x1821, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xc800, 0x2800, 0xc800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xc800, 0x2800, 0xc800, 0x1822, 0x01f6, 0x0239,
-  0x055f, 0x055f, 0x055f, 0x047a, 0x1062, 0x1000, 0x1841, 0x7bef,
-  0x7bef, 0x1841, 0x1000, 0x1062, 0x047a, 0x055f, 0x055f, 0x055f,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1861,
-  0x1861, 0xd000, 0xe800, 0xd000, 0x20c4, 0x047a, 0x04dc, 0x04dc,
-  0x00a5, 0x00a5, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x027c, 0x0218, 0x2021, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x027c,
-  0x029d, 0x1065, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x02fc, 0x1064, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x0239, 0x01d6, 0x2044, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x025a, 0x02bf,
-  0x0219, 0x0239, 0x023a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x01d5, 0x023a, 0x029f,
-  0x0218, 0x01f6, 0x029e, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0218, 0x0218, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x02bf, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2044, 0x01f6, 0x031e, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x023a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01f6, 0x0a78, 0x0259,
-  0x0a58, 0x01b4, 0x1043, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1862, 0x436c, 0x0a58,
-  0x0a58, 0x01f6, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1821, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1022, 0xc800, 0x2882, 0xd6db, 0xc659, 0x1861,
-  0x1861, 0xc638, 0xd6db, 0x20a2, 0xc800, 0x1821, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xd000, 0x28a2, 0xbe38, 0x4945, 0xd800,
-  0xd800, 0x4945, 0xc638, 0x28a2, 0xc800, 0x1821, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xd000, 0x1000, 0x1882, 0xd000, 0xf800,
-  0xf800, 0xd000, 0x2082, 0x1000, 0xd000, 0x1822, 0x01f6, 0x0239,
-  0x00e5, 0x04dc, 0x057f, 0x14fd, 0xb862, 0x1840, 0x73ef, 0x94b2,
-  0x94b2, 0x73ef, 0x1841, 0xb842, 0x14fd, 0x057f, 0x04dc, 0x00e5,
-  0x04dd, 0x055f, 0x055f, 0x047a, 0x2062, 0x1800, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x047a, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x00a5, 0x00a5, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x027c, 0x0218, 0x2021, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x027c,
-  0x02fc, 0x1065, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x0217, 0x1043, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x027c,
-  0x0239, 0x01d5, 0x2044, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x01d6, 0x029f,
-  0x0218, 0x01f6, 0x023a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x01b2, 0x025a, 0x02df,
-  0x0a57, 0x0239, 0x029f, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x0217, 0x0218, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x025b, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2043, 0x0192, 0x0259, 0x0a78, 0x0259,
-  0x0a57, 0x01f6, 0x023a, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2023, 0x09f4, 0x4b8e, 0x0a57,
-  0x0a58, 0x01f7, 0x1044, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x09d2, 0x0239,
-  0x53cd, 0x0a36, 0x1021, 0xd000, 0x2800, 0x2082, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x20a2, 0x2800, 0xd000, 0x1821, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1022, 0xc800, 0x2882, 0xceba, 0xc638, 0x2061,
-  0x2061, 0xc638, 0xd6ba, 0x20a2, 0xc800, 0x1821, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xc800, 0x28a2, 0xd6db, 0x3965, 0xd000,
-  0xd000, 0x3965, 0xd6db, 0x28c3, 0xc800, 0x1822, 0x01f6, 0x0239,
-  0x0219, 0x0107, 0x147a, 0xd0e5, 0xf800, 0xd000, 0x28c3, 0x9d56,
-  0x9d56, 0x28c3, 0xd000, 0xf800, 0xd0c5, 0x147a, 0x0107, 0x0219,
-  0x0107, 0x047a, 0x055f, 0x249a, 0xc042, 0x2840, 0x6b8e, 0x94b2,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c7a, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x00a5, 0x00c5, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x031c, 0x0b37, 0x2041, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x027c,
-  0x0238, 0x1084, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x01f7, 0x1043, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1044, 0x027c,
-  0x0219, 0x0192, 0x2043, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2064, 0x0216, 0x02df,
-  0x0a57, 0x0239, 0x023a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1063, 0x02da, 0x035e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x029d, 0x0218, 0x2022, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x01f7, 0x01b4, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x02db, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2043, 0x0192, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x02da, 0x2064, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01d5, 0x0a14, 0x0238,
-  0x53cd, 0x0a36, 0x1064, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x01f6, 0x0239,
-  0x0a58, 0x01f7, 0x1021, 0xd000, 0x2800, 0x28a2, 0x28a2, 0x1000,
-  0x1000, 0x28a2, 0x28a2, 0x2800, 0xd000, 0x1821, 0x01b3, 0x0239,
-  0x0239, 0x01f7, 0x1022, 0xc800, 0x2082, 0xceba, 0xd6ba, 0x0882,
-  0x0861, 0xd6ba, 0xd6ba, 0x2082, 0xc800, 0x1822, 0x01f6, 0x0239,
-  0x02bf, 0x023a, 0x0084, 0x2800, 0xe800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xe800, 0x2800, 0x0084, 0x023a, 0x02bf,
-  0x023a, 0x0129, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x8cf4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x01f7, 0x0193, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x027c,
-  0x0217, 0x1044, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x027d,
-  0x01f7, 0x1043, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x029c,
-  0x0a58, 0x01f5, 0x2044, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2064, 0x02da, 0x0bfe,
-  0x53cd, 0x0a58, 0x023a, 0x1064, 0x2042, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x01d5, 0x0a79, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x031d, 0x02b8, 0x2042, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x01f7, 0x01b4, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x0217, 0x2064, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2043, 0x0192, 0x0238, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x0192, 0x2043, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01d5, 0x0218, 0x0239,
-  0x0a58, 0x0217, 0x1043, 0xd000, 0xe800, 0xe000, 0xe000, 0xe000,
-  0xe000, 0xe000, 0xe000, 0xe800, 0xd000, 0x1043, 0x01b4, 0x0239,
-  0x0239, 0x01f7, 0x1021, 0xd000, 0x2800, 0x1000, 0x1000, 0x1000,
-  0x1000, 0x1000, 0x1000, 0x2800, 0xd000, 0x1821, 0x01f6, 0x0239,
-  0x02bf, 0x02bf, 0x027c, 0x023a, 0x2022, 0xe800, 0xe800, 0x1862,
-  0x9cd4, 0xf882, 0xe800, 0x2022, 0x023a, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x025b, 0x00c7, 0x2022, 0xd000, 0xf800, 0xd000, 0x28e3,
-  0x9cf4, 0xe082, 0xf800, 0xd000, 0x2022, 0x00c6, 0x025a, 0x02bf,
-  0x023a, 0x0129, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00a5,
-  0x01f7, 0x0193, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x025c,
-  0x01f7, 0x1044, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x029d,
-  0x0a35, 0x1063, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1064, 0x0bbc,
-  0x53cd, 0x0a14, 0x2044, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x0a14, 0x0259,
-  0x0a57, 0x01f6, 0x025a, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x09f4, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x0218, 0x01b3, 0x2021, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2022, 0x01f7, 0x01b4, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x01d5, 0x2043, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2043, 0x0192, 0x0239, 0x0218, 0x0239,
-  0x0a58, 0x0238, 0x0171, 0x2043, 0xd800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd800, 0x2043, 0x01d4, 0x01d6, 0x0218,
-  0x0239, 0x01f7, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x01f7, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025a, 0x2822, 0xd000, 0x2082,
-  0xa4d4, 0xe082, 0x2821, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x027c, 0x025a, 0x2064, 0xd800, 0xe800, 0x1862,
-  0x9cd4, 0xf882, 0xd000, 0x2064, 0x025a, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x025b, 0x00c6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00c6, 0x025a, 0x02bf,
-  0x023a, 0x0129, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x0085,
-  0x01d6, 0x0150, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0218, 0x029c,
-  0x0a36, 0x1043, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1085, 0x0bbc,
-  0x4b8b, 0x1862, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1882, 0x0237,
-  0x0a57, 0x0192, 0x2063, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2862, 0x4b4a, 0x0a58,
-  0x0a58, 0x0259, 0x02b9, 0x1064, 0x2022, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2822, 0x1043, 0x01d5, 0x0a15, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x01f7, 0x01b3, 0x2021, 0x3000, 0xd000,
-  0xd800, 0x3800, 0x2021, 0x01b3, 0x01b4, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x01d5, 0x2043, 0xd000, 0xe800, 0xf800,
-  0xf800, 0xe800, 0xd000, 0x2043, 0x0191, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0219, 0x01b3, 0x1043, 0xd000, 0xf800, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xf800, 0xd000, 0x1043, 0x01f7, 0x0219, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x025a, 0x1022, 0x1081,
-  0x94d4, 0x20a4, 0x023a, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2082,
-  0xa4d4, 0xd082, 0x2044, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x027c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2064, 0x025a, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x025b, 0x00c6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00c6, 0x025a, 0x02bf,
-  0x023a, 0x0129, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x00a5, 0x00c5,
-  0x0a15, 0x01b3, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2021, 0x0298, 0x0bbc,
-  0x4bab, 0x1882, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1064, 0x0238,
-  0x0236, 0x1043, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1043, 0x01f7,
-  0x0a58, 0x01d5, 0x2043, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x0192, 0x0219,
-  0x53cd, 0x0a58, 0x0192, 0x1043, 0x2021, 0xd000, 0xd800, 0x3000,
-  0x3000, 0xd000, 0xd800, 0x2821, 0x1043, 0x01d5, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x01f6, 0x0150, 0x2001, 0x3800, 0xd000,
-  0xd800, 0x3800, 0x2001, 0x014f, 0x01b3, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x01f7, 0x1043, 0xc800, 0xe000, 0xf800,
-  0xf800, 0xe000, 0xd000, 0x1043, 0x01b3, 0x0219, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x027c, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x1064, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x025a, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x02bf, 0x027c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2064, 0x025a, 0x027c, 0x02bf, 0x02bf,
-  0x02bf, 0x025b, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00c6, 0x025a, 0x02bf,
-  0x02ba, 0x0129, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x0106, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x08c3, 0x00a4, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x0084, 0x0084,
-  0x538b, 0x09d2, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2001, 0x0193, 0x01f7,
-  0x0a36, 0x1063, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1043, 0x0217,
-  0x0a36, 0x1043, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1043, 0x01f7,
-  0x53cd, 0x0a14, 0x2043, 0xd000, 0xd800, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd800, 0xd000, 0x2043, 0x01d5, 0x0239,
-  0x0a58, 0x0239, 0x0192, 0x1043, 0x2022, 0xd000, 0xd800, 0x3800,
-  0x3000, 0xd000, 0xd800, 0x2021, 0x1043, 0x01d5, 0x01f6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x01f7, 0x01d5, 0x1022, 0x2000, 0xd000,
-  0xd000, 0x2000, 0x1021, 0x0171, 0x01b3, 0x0218, 0x0238, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x12ff,
-  0x8d59, 0x12ff, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x02bf, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x025a, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x027c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2044, 0x025a, 0x0b9c, 0x02df, 0x02bf,
-  0x035f, 0x0b7a, 0x00e6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00e6, 0x025a, 0x02bf,
-  0x01d5, 0x0148, 0x1438, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x08c3, 0x0084,
-  0x01f7, 0x0193, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2820, 0x4b08, 0x0a15,
-  0x0a36, 0x1063, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1882, 0x0217,
-  0x4b8b, 0x1882, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1043, 0x01f7,
-  0x0a58, 0x01d5, 0x2043, 0xd000, 0xd000, 0xe862, 0xf800, 0xe000,
-  0xe000, 0xf800, 0xe862, 0xd000, 0xd000, 0x2043, 0x0192, 0x0219,
-  0x0239, 0x0239, 0x0191, 0x1021, 0x2800, 0xe800, 0xe800, 0x2000,
-  0x2000, 0xe800, 0xe800, 0x2800, 0x1021, 0x01d5, 0x0239, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x029f, 0x12ff,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x025a, 0x02df, 0x0bdf, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x029c, 0x023a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2064, 0x023a, 0x0238, 0x029e, 0x02bf,
-  0x025a, 0x01f6, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00a6, 0x025a, 0x02bf,
-  0x01b4, 0x0108, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0129, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x0084, 0x0084,
-  0x0a15, 0x01b3, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2000, 0x014f, 0x01f6,
-  0x4bab, 0x1882, 0xd800, 0xe862, 0x23d6, 0x01a9, 0x23d6, 0xe862,
-  0xe842, 0x23b6, 0x01a9, 0x23d6, 0xe862, 0xd800, 0x1043, 0x0217,
-  0x0a36, 0x1064, 0xd800, 0xe800, 0x20c4, 0x23b6, 0xd8c4, 0xf800,
-  0xf800, 0xd8c4, 0x23b6, 0x20c4, 0xe800, 0xd800, 0x1044, 0x01f7,
-  0x0219, 0x01d5, 0x2022, 0xe000, 0xe800, 0xe062, 0xf800, 0xf800,
-  0xf800, 0xf800, 0xe062, 0xe800, 0xe000, 0x2021, 0x01d5, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x12ff,
-  0x8d59, 0x12ff, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x025b, 0x02bf, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x027c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2064, 0x023a, 0x0218, 0x029e, 0x02bf,
-  0x0239, 0x01d5, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2022, 0x00a5, 0x01f6, 0x02bf,
-  0x01b4, 0x0108, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0128, 0x023a,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x0107,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x08c3, 0x00a4, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x0084, 0x0084,
-  0x538b, 0x09d2, 0x2001, 0xe800, 0xd8c4, 0x23d6, 0x18c5, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd8c5, 0xe800, 0x2001, 0x0193, 0x01f7,
-  0x0a36, 0x1064, 0xd800, 0xe862, 0x23b6, 0x0189, 0x23b6, 0xe862,
-  0xe842, 0x23b6, 0x0189, 0x23b6, 0xe862, 0xd800, 0x1044, 0x0217,
-  0x01f7, 0x1022, 0xe800, 0xe800, 0x08c5, 0x0c18, 0xd0e5, 0xf800,
-  0xf800, 0xd0c5, 0x1418, 0x08e5, 0xe800, 0xe800, 0x1022, 0x01f7,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x12ff,
-  0x8d59, 0x12ff, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x02bf, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x025a, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0219, 0x0239, 0x025c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x01d5, 0x01f7, 0x023a, 0x029f,
-  0x0239, 0x0192, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x01d6, 0x02df,
-  0x01b4, 0x0108, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0148, 0x0b79,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x049a, 0x0127,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x0862, 0xd000, 0xf800, 0xe862, 0xd800, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd000, 0x1062, 0x0084, 0x0084,
-  0x01f7, 0x0193, 0x2801, 0xe800, 0xd8c4, 0x23d6, 0x20c4, 0xd800,
-  0xd800, 0x20c4, 0x23d6, 0xd0c5, 0xe800, 0x2800, 0x014f, 0x01f6,
-  0x0217, 0x1064, 0xd000, 0xe862, 0x2418, 0x0147, 0x1418, 0xe862,
-  0xe862, 0x1418, 0x0147, 0x2418, 0xe862, 0xd800, 0x1043, 0x0217,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf, 0x12ff,
-  0x8d59, 0x12ff, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d38, 0x0adc, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x023a, 0x02bf, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029f, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2044, 0x023a, 0x025a, 0x0239, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x025c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x01d5, 0x01b3, 0x0259, 0x02df,
-  0x0a58, 0x01d5, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x02da, 0x13ff,
-  0x5349, 0x0147, 0x0c18, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1438, 0x0128, 0x01f5,
-  0x0905, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x00e6,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20c4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1041, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0084, 0x0084, 0x1062, 0xd000, 0xf800, 0xe862, 0xd000, 0x2000,
-  0x2000, 0xd000, 0xe862, 0xf800, 0xd800, 0x1062, 0x0084, 0x0084,
-  0x01f6, 0x01b4, 0x1001, 0xe800, 0xe862, 0x2418, 0x2062, 0xd000,
-  0xd800, 0x2062, 0x2418, 0xe862, 0xe800, 0x1001, 0x01b4, 0x01f7,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x02bf, 0x02bf, 0x12ff,
-  0x8d59, 0x131f, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x027d, 0x12bc,
-  0x8d58, 0x0b5c, 0x029f, 0x02bf, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a4,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x023a, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x025c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x01f5, 0x02db, 0x035e, 0x0bfe,
-  0x53cd, 0x0a14, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00c6, 0x01f6, 0x025a,
-  0x09f3, 0x0108, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0108, 0x01b4,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x00e6,
-  0x04fd, 0x055f, 0x055f, 0x049b, 0x2062, 0x1000, 0x20a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1000, 0x2062, 0x049b, 0x055f, 0x055f, 0x04fd,
-  0x04dc, 0x04dc, 0x047a, 0x20a4, 0xd000, 0xe800, 0xd000, 0x1841,
-  0x1841, 0xd000, 0xe800, 0xd000, 0x20a4, 0x047a, 0x04dc, 0x04dc,
-  0x0062, 0x0062, 0x1062, 0xd000, 0xf800, 0xf800, 0xe800, 0x1000,
-  0x0800, 0xe800, 0xf800, 0xf800, 0xd000, 0x1062, 0x0062, 0x0062,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1258,
-  0x8d38, 0x0a77, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20c5, 0x01d5, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029f, 0x02bf, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd082, 0x2043, 0x023a, 0x025a, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x025c, 0x025a, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0192, 0x0217, 0x0a78, 0x0259,
-  0x0a57, 0x0192, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00c4, 0x4b4b, 0x0a58,
-  0x01b4, 0x0108, 0x1418, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1438, 0x0947, 0x01b4,
-  0x00e6, 0x047a, 0x055f, 0x249b, 0xc062, 0x2840, 0x6b8e, 0x94d3,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c9b, 0x055f, 0x047a, 0x00e6,
-  0x04dc, 0x055f, 0x055f, 0x047a, 0x2062, 0x1800, 0x28a2, 0x7bef,
-  0x7bef, 0x28a2, 0x1800, 0x2062, 0x047a, 0x055f, 0x055f, 0x04dd,
-  0x055f, 0x055f, 0x04fd, 0x10c4, 0xc800, 0xe000, 0xd000, 0x1841,
-  0x1841, 0xd000, 0xe000, 0xd000, 0x10c4, 0x04dd, 0x055f, 0x055f,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d5, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x02df, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x023a, 0x01f6, 0x0239, 0x0a78, 0x0259,
-  0x0a57, 0x01f6, 0x027c, 0x02da, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x0a15, 0x4b8e, 0x0a57,
-  0x0a58, 0x01d5, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00a5, 0x09b1, 0x0239,
-  0x5349, 0x0147, 0x0c18, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0108, 0x01b4,
-  0x0925, 0x047a, 0x055f, 0x249b, 0xc042, 0x2840, 0x6b8e, 0x94b2,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c7a, 0x055f, 0x049a, 0x0107,
-  0x04dc, 0x055f, 0x055f, 0x04fd, 0x1062, 0x0000, 0x10a2, 0x8c51,
-  0x8c51, 0x10c3, 0x0000, 0x1062, 0x04dd, 0x055f, 0x055f, 0x04dc,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x1299,
-  0x9558, 0x135d, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x025c, 0x1257,
-  0x8d17, 0x0a34, 0x0219, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02df, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20c5, 0x01d5, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x02da, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd082, 0x2043, 0x0239, 0x01d6, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x02dc, 0x0216, 0x2063, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0191, 0x01f6, 0x0a14, 0x0238,
-  0x53cd, 0x0a14, 0x00a6, 0x2021, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00a5, 0x01d5, 0x0239,
-  0x09f3, 0x0128, 0x1418, 0xc0c4, 0xf800, 0xd000, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1438, 0x0128, 0x01d5,
-  0x0084, 0x047a, 0x055f, 0x2c7a, 0xd042, 0x3040, 0x73ef, 0x94d3,
-  0x94b2, 0x7bef, 0x3041, 0xd042, 0x2c7a, 0x055f, 0x047a, 0x0084,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x9558, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x02da, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x01f6, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x0239, 0x01d6, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01b4, 0x01d5, 0x2043, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x01f6, 0x0218, 0x0239,
-  0x0a58, 0x01f5, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x0192, 0x0218,
-  0x01f7, 0x00c6, 0x1417, 0xd062, 0xf800, 0xe000, 0x3061, 0x94f4,
-  0x9d56, 0x3062, 0xe000, 0xf800, 0xd062, 0x13f7, 0x00c6, 0x01f6,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x9558, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x02da, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x01f6, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x0239, 0x01d6, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01b4, 0x01d5, 0x2043, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x01f6, 0x0218, 0x0239,
-  0x0a58, 0x01f5, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x0192, 0x0218,
-  0x01f7, 0x00c6, 0x1417, 0xd062, 0xf800, 0xe000, 0x3061, 0x94f4,
-  0x9d56, 0x3062, 0xe000, 0xf800, 0xd062, 0x13f7, 0x00c6, 0x01f6,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x1299,
-  0x9558, 0x135d, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x025c, 0x1257,
-  0x8d17, 0x0a34, 0x0219, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02df, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20c5, 0x01d5, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x02da, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd082, 0x2043, 0x0239, 0x01d6, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x02dc, 0x0216, 0x2063, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0191, 0x01f6, 0x0a14, 0x0238,
-  0x53cd, 0x0a14, 0x00a6, 0x2021, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00a5, 0x01d5, 0x0239,
-  0x09f3, 0x0128, 0x1418, 0xc0c4, 0xf800, 0xd000, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1438, 0x0128, 0x01d5,
-  0x0084, 0x047a, 0x055f, 0x2c7a, 0xd042, 0x3040, 0x73ef, 0x94d3,
-  0x94b2, 0x7bef, 0x3041, 0xd042, 0x2c7a, 0x055f, 0x047a, 0x0084,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x02bf, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d5, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029f, 0x02df, 0x025b, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x023a, 0x01f6, 0x0239, 0x0a78, 0x0259,
-  0x0a57, 0x01f6, 0x027c, 0x02da, 0x2064, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x0a15, 0x4b8e, 0x0a57,
-  0x0a58, 0x01d5, 0x00a6, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00a5, 0x09b1, 0x0239,
-  0x5349, 0x0147, 0x0c18, 0xc0c4, 0xf800, 0xd800, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1418, 0x0108, 0x01b4,
-  0x0925, 0x047a, 0x055f, 0x249b, 0xc042, 0x2840, 0x6b8e, 0x94b2,
-  0x94b2, 0x6b8e, 0x2841, 0xc042, 0x2c7a, 0x055f, 0x049a, 0x0107,
-  0x04dc, 0x055f, 0x055f, 0x04fd, 0x1062, 0x0000, 0x10a2, 0x8c51,
-  0x8c51, 0x10c3, 0x0000, 0x1062, 0x04dd, 0x055f, 0x055f, 0x04dc,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x1299,
-  0x9558, 0x135d, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x025c, 0x1257,
-  0x8d17, 0x0a34, 0x0219, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02df, 0x025b, 0x1044, 0x10a3,
-  0x94d4, 0x20c5, 0x01d5, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x02da, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd082, 0x2043, 0x0239, 0x01d6, 0x0a57, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x02dc, 0x0216, 0x2063, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0191, 0x01f6, 0x0a14, 0x0238,
-  0x53cd, 0x0a14, 0x00a6, 0x2021, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2001, 0x00a5, 0x01d5, 0x0239,
-  0x09f3, 0x0128, 0x1418, 0xc0c4, 0xf800, 0xd000, 0x38c3, 0x94f4,
-  0x9d56, 0x38c3, 0xd000, 0xf800, 0xc0c4, 0x1438, 0x0128, 0x01d5,
-  0x0084, 0x047a, 0x055f, 0x2c7a, 0xd042, 0x3040, 0x73ef, 0x94d3,
-  0x94b2, 0x7bef, 0x3041, 0xd042, 0x2c7a, 0x055f, 0x047a, 0x0084,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x9558, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x02da, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x01f6, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x0239, 0x01d6, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01b4, 0x01d5, 0x2043, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x01f6, 0x0218, 0x0239,
-  0x0a58, 0x01f5, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x0192, 0x0218,
-  0x01f7, 0x00c6, 0x1417, 0xd062, 0xf800, 0xe000, 0x3061, 0x94f4,
-  0x9d56, 0x3062, 0xe000, 0xf800, 0xd062, 0x13f7, 0x00c6, 0x01f6,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x9558, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x02da, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x01f6, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x0239, 0x01d6, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01b4, 0x01d5, 0x2043, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x01f6, 0x0218, 0x0239,
-  0x0a58, 0x01f5, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x0192, 0x0218,
-  0x01f7, 0x00c6, 0x1417, 0xd062, 0xf800, 0xe000, 0x3061, 0x94f4,
-  0x9d56, 0x3062, 0xe000, 0xf800, 0xd062, 0x13f7, 0x00c6, 0x01f6,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x12fe,
-  0x8d59, 0x12fe, 0x029f, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x12de,
-  0x8d59, 0x137e, 0x029f, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9538, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x9558, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x129a,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x025c, 0x1257,
-  0x8d38, 0x0b3b, 0x023a, 0x029e, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x035f, 0x02da, 0x1044, 0x10a3,
-  0x94d4, 0x20e6, 0x01d6, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x01f6, 0x2064, 0xc000, 0x2081,
-  0xa4d4, 0xd081, 0x2043, 0x0239, 0x01d6, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01b4, 0x01d5, 0x2043, 0xd800, 0xe800, 0x2062,
-  0x9cd4, 0xf882, 0xd800, 0x2043, 0x0171, 0x01f6, 0x0218, 0x0239,
-  0x0a58, 0x01f5, 0x00a5, 0x2022, 0xd800, 0xf800, 0xd000, 0x28e4,
-  0x9cf4, 0xe082, 0xf800, 0xd800, 0x2021, 0x00a5, 0x0192, 0x0218,
-  0x01f7, 0x00c6, 0x1417, 0xd062, 0xf800, 0xe000, 0x3061, 0x94f4,
-  0x9d56, 0x3062, 0xe000, 0xf800, 0xd062, 0x13f7, 0x00c6, 0x01f6,
-  0x02bf, 0x127c, 0xd085, 0x1c1c, 0x04bf, 0x143d, 0xd042, 0x28a2,
-  0xceba, 0x28c3, 0xd000, 0x1842, 0x043c, 0x047f, 0x02df, 0x02bf,
-  0x02bf, 0x127c, 0xd085, 0x1c1c, 0x045d, 0x141c, 0xc842, 0x28a2,
-  0xce9a, 0x28c3, 0xc800, 0x1842, 0x041c, 0x041d, 0x02bf, 0x02bf,
-  0x02bf, 0x127c, 0xd0a5, 0x1bb9, 0x0127, 0x13ba, 0xc842, 0x28a2,
-  0xceba, 0x28c3, 0xc800, 0x1862, 0x03da, 0x00e7, 0x027c, 0x02bf,
-  0x02bf, 0x125c, 0xd0a5, 0x1bb9, 0x00c5, 0x13b9, 0xc842, 0x28a2,
-  0xc679, 0x28a2, 0xc800, 0x1862, 0x1377, 0x0084, 0x025c, 0x02bf,
-  0x02df, 0x1a9c, 0xd0a5, 0x1bb9, 0x10c5, 0x1bb9, 0xd042, 0x2061,
-  0x8cf4, 0x2082, 0xc800, 0x2800, 0xb842, 0x1042, 0x027c, 0x02bf,
-  0x035f, 0x239b, 0xd0a5, 0x2b57, 0xb8c5, 0x2bba, 0xc842, 0x2061,
-  0x8d15, 0x28e4, 0xd000, 0x2800, 0xd000, 0x1822, 0x027c, 0x02bf,
-  0x025a, 0x1a37, 0xd042, 0x2842, 0xc863, 0x2bda, 0xc842, 0x2881,
-  0xc6bb, 0x2c3b, 0xb884, 0x2800, 0xc800, 0x1822, 0x027c, 0x02bf,
-  0x0239, 0x19f6, 0xd021, 0x2800, 0xc862, 0x2bda, 0xb8a5, 0x20c3,
-  0x9557, 0x14bf, 0x13db, 0x18a4, 0xd000, 0x1884, 0x0218, 0x029f,
-  0x0219, 0x11b4, 0xb883, 0x2800, 0xc842, 0x1c1c, 0x143d, 0x145c,
-  0x95b9, 0x14be, 0x049f, 0x13da, 0xd0c4, 0x1c39, 0x029a, 0x02bf,
-  0x0a57, 0x0279, 0x143a, 0x1862, 0xd042, 0x1c1c, 0x049f, 0x14df,
-  0xcf1e, 0x14df, 0x047f, 0x141c, 0xd0c4, 0x1cbc, 0x037f, 0x0bfe,
-  0x53ad, 0x0a98, 0x049c, 0x1062, 0xd042, 0x1c1c, 0x049f, 0x149e,
-  0x95b9, 0x149e, 0x049f, 0x141c, 0xc127, 0x149c, 0x0ab9, 0x0259,
-  0x0a37, 0x0236, 0x049c, 0x1062, 0xd021, 0x1c1c, 0x049f, 0x149e,
-  0x9599, 0x149e, 0x047f, 0x047f, 0x145d, 0x0d1d, 0x4bce, 0x0a57,
-  0x0a57, 0x0279, 0x049c, 0x10c4, 0xc0a4, 0x143d, 0x049f, 0x0c9e,
-  0x8579, 0x149e, 0x047f, 0x047f, 0x049f, 0x04fe, 0x0a55, 0x0218,
-  0x53ad, 0x0a98, 0x045e, 0x043d, 0x143d, 0x047f, 0x047f, 0x047f,
-  0x0c9e, 0x047f, 0x047f, 0x047f, 0x049f, 0x04fe, 0x0259, 0x0219,
-  0x0a57, 0x0259, 0x045e, 0x049f, 0x049f, 0x047f, 0x047f, 0x049f,
-  0x14bf, 0x049f, 0x047f, 0x047f, 0x049f, 0x04de, 0x0216, 0x0218,
-  0x0219, 0x0259, 0x045e, 0x049f, 0x047f, 0x047f, 0x047f, 0x14df,
-  0xc71f, 0x14df, 0x047f, 0x047f, 0x049f, 0x045e, 0x0259, 0x0219,
-  0x14df, 0xaeff, 0x353f, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaeff, 0x14df,
-  0x14bf, 0xbf1f, 0xb71f, 0xcf5f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaedf, 0x14df,
-  0x14df, 0xaeff, 0x353f, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaedf, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaedf, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaedf, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x24ff, 0xaedf, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x353f, 0xaeff, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xc75f, 0xbf1f, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xd79f, 0xbf3f, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xc73f, 0xbf1f, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x3d5f, 0xaeff, 0x14df,
-  0x14df, 0xaeff, 0x24ff, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xc75f, 0xbf1f, 0x14df,
-  0x14df, 0xaeff, 0x353f, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xc75f, 0xbf1f, 0x14df,
-  0x14bf, 0xbf1f, 0xc75f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x2d3f, 0xaeff, 0x14df,
-  0x14bf, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xd77f, 0xbf3f, 0x353f, 0xaeff, 0x14df,
-  0x14bf, 0xbf3f, 0xd77f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f,
-  0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xcf7f, 0xc73f, 0xbf1f, 0x14df,
-  0x02bf, 0x127d, 0xb8a5, 0x2800, 0xc800, 0x2822, 0xc800, 0x2082,
-  0x8cd4, 0x2082, 0xc800, 0x2822, 0xd062, 0x1c9c, 0x02ff, 0x029f,
-  0x029f, 0x02df, 0x143a, 0x1862, 0xd022, 0x2a18, 0xd022, 0x2881,
-  0x8d14, 0x2081, 0xc822, 0x29f7, 0xd0a4, 0x1c9c, 0x02ff, 0x029f,
-  0x029f, 0x02ff, 0x04bd, 0x1062, 0xd022, 0x2a5b, 0xb844, 0x28a2,
-  0xc659, 0x28e4, 0xc822, 0x2a3a, 0xb8e7, 0x149c, 0x02ff, 0x029f,
-  0x029f, 0x02ff, 0x04bc, 0x1061, 0xd021, 0x1a7c, 0x125b, 0x10e6,
-  0x9537, 0x2a9a, 0xd064, 0x1a5c, 0x12bd, 0x04df, 0x02df, 0x029f,
-  0x02bf, 0x031f, 0x047d, 0x10a4, 0xc064, 0x127d, 0x02bf, 0x0abc,
-  0x8d39, 0x22bc, 0xd044, 0x1a7c, 0x02df, 0x0bfe, 0x02df, 0x029f,
-  0x035e, 0x0bde, 0x02ff, 0x027d, 0x127d, 0x029f, 0x029f, 0x12ff,
-  0x957a, 0x22dc, 0xb887, 0x127c, 0x02bf, 0x025a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029f, 0x131e,
-  0xcede, 0x1b9e, 0x127c, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x129a,
-  0x9559, 0x12ba, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1279,
-  0x8d38, 0x135c, 0x023a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x1299,
-  0x9538, 0x1276, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x1279,
-  0x84f8, 0x133c, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0a35, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031e, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x02bf, 0x02bf,
-  0x02bf, 0x02df, 0x02bf, 0x029f, 0x029f, 0x029f, 0x029f, 0x029f,
-  0x029f, 0x029f, 0x029f, 0x02bf, 0x02df, 0x0bde, 0x02df, 0x02bf,
-  0x035e, 0x0bde, 0x02df, 0x02bf, 0x029f, 0x029f, 0x02bf, 0x02bf,
-  0x02bf, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x027a, 0x029e, 0x02bf,
-  0x0239, 0x025a, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029f, 0x02be,
-  0x033e, 0x033e, 0x02be, 0x029f, 0x029e, 0x023a, 0x029e, 0x02bf,
-  0x0218, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x023a,
-  0x025a, 0x025a, 0x023a, 0x029e, 0x023a, 0x0218, 0x023a, 0x029e,
-  0x0218, 0x01f6, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x025a,
-  0x031d, 0x031d, 0x025a, 0x029e, 0x0239, 0x01f6, 0x0259, 0x02df,
-  0x0a57, 0x0239, 0x029e, 0x02bf, 0x029f, 0x02bf, 0x029e, 0x0239,
-  0x0216, 0x0216, 0x0239, 0x029e, 0x0239, 0x031d, 0x033e, 0x0bfe,
-  0x53cd, 0x0a58, 0x029e, 0x02bf, 0x02bf, 0x02bf, 0x029e, 0x025a,
-  0x02fd, 0x02fd, 0x023a, 0x029d, 0x01d6, 0x0239, 0x0a78, 0x0259,
-  0x0a37, 0x01f6, 0x02be, 0x033f, 0x033e, 0x033e, 0x02de, 0x0239,
-  0x0216, 0x0216, 0x025a, 0x029e, 0x01d5, 0x0a37, 0x4b8e, 0x0a57,
-  0x0a57, 0x0239, 0x031d, 0x025a, 0x0239, 0x027a, 0x0bde, 0x029a,
-  0x031d, 0x033e, 0x033e, 0x02de, 0x01d5, 0x0218, 0x0a14, 0x0238,
-  0x53cd, 0x0a57, 0x01f6, 0x0218, 0x0218, 0x0259, 0x0b7d, 0x033e,
-  0x033e, 0x0a79, 0x027a, 0x0bbd, 0x01f5, 0x0218, 0x0218, 0x0239,
-  0x0a58, 0x0218, 0x01d5, 0x0218, 0x01d6, 0x0a57, 0x4baf, 0x0a78,
-  0x0a58, 0x4b8e, 0x0a57, 0x01f5, 0x01d4, 0x0218, 0x01d6, 0x0218,
-  0x0239, 0x0218, 0x01d5, 0x0218, 0x0218, 0x0239, 0x0a57, 0x0238,
-  0x0239, 0x0a58, 0x0238, 0x01b4, 0x01d4, 0x0218, 0x0218, 0x0239
-};
-
-const Animation spidermanAnimation = {
-  .name = "Spiderman",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = spidermanDurations,
-  .animationFrames = spidermanFrames
-};
-#endif // ANIMATION_SPIDERMAN_H
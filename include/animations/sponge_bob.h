@@ -1,1558 +0,0 @@
-// sponge_bob.h - Auto-generated from sponge_bob.json
-#ifndef ANIMATION_SPONGE_BOB_H
-#define ANIMATION_SPONGE_BOB_H
-
-#include "animation_types.h"
-
-// Frame Durations for sponge_bob (in 100ms units)
-static const uint8_t PROGMEM sponge_bobDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for sponge_bob
-static const uint16_t PROGMEM sponge_bobFrames[] = {
-  0xff60, 0xff60, 0xff60, 0xff60, 0xa4c0, 0xff60, 0xa4c0, 0xff60,
-  0xff60, 0xa4c0, 0xff60, 0xa4c0, 0xff60, 0xff60, 0xff60, 0xff60,
-  0xff60, 0xa4c0, 0xff60, 0xff60, 0x0000, 0xff60, 0x0000, 0xff60,
-  0xff60, 0x0000, 0xff60, 0x0000, 0xff60, 0xff60, 0xa4c0, 0xff60,
-  0xff60, 0xff60, 0x0000, 0xffff, 0xffff, 0xffff, 0xffff, 0xff60,
-  0xff60, 0xffff, 0xffff, 0xffff, 0xffff, 0x0000, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xffff, 0xffff, 0xb7bf, 0x073f, 0xb7bf, 0xffff,
-  0xffff, 0xb7bf, 0x073f, 0xb7bf, 0xffff, 0xffff, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xffff, 0xffff, 0x073f, 0x0104, 0x073f, 0xffff,
-  0xffff, 0x073f, 0x0104, 0x073f, 0xffff, 0xffff, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xffff, 0xffff, 0xb7bf, 0x073f, 0xb7bf, 0xffff,
-  0xffb1, 0xffb1, 0x073f, 0xb7bf, 0xffff, 0xffff, 0xff60, 0xff60,
-  0xff60, 0xfe2c, 0xfd00, 0xffff, 0xffff, 0xffff, 0xffff, 0xffb1,
-  0xff60, 0xff60, 0xffff, 0xffff, 0xffff, 0xfd00, 0xfe2c, 0xff60,
-  0xfecc, 0xffb1, 0xffb1, 0xfe2c, 0xff60, 0xff60, 0xff60, 0xff60,
-  0xff60, 0xfd00, 0xff60, 0xff60, 0xfe2c, 0xffb1, 0xffb1, 0xfecc,
-  0xffb1, 0xff60, 0x50e4, 0xff60, 0xff60, 0xff60, 0xff60, 0xfd00,
-  0xfd00, 0xff60, 0xff60, 0xff60, 0xff60, 0x50e4, 0xff60, 0xffb1,
-  0xff60, 0xff60, 0xff60, 0x50e4, 0x50e4, 0xffff, 0xffff, 0x50e4,
-  0x50e4, 0xffff, 0xffff, 0x50e4, 0x50e4, 0xff60, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xff60, 0xff60, 0x50e4, 0x50e4, 0x50e4, 0x50e4,
-  0x50e4, 0x50e4, 0x50e4, 0x50e4, 0xff60, 0xff60, 0xff60, 0xff60,
-  0xff60, 0xe580, 0xff60, 0xff60, 0x50e4, 0x50e4, 0x50e4, 0x50e4,
-  0x50e4, 0x50e4, 0x50e4, 0x50e4, 0xff60, 0xfe85, 0xe580, 0xfe85,
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0x50e4, 0xec12, 0xec12,
-  0xe2ee, 0xec12, 0x50e4, 0xff60, 0xff60, 0xe580, 0xfe85, 0xe580,
-  0xff60, 0xfe85, 0xe580, 0xfe85, 0xff60, 0xff60, 0xec12, 0xec12,
-  0xec12, 0xec12, 0xff60, 0xff60, 0xff60, 0xfe85, 0xe580, 0xfe85,
-  0xff60, 0xe580, 0xfe85, 0xe580, 0xff60, 0xff60, 0xff60, 0xff60,
-  0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60, 0xff60,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfd86, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff7b, 0xfda7, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe8b, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe8c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xf6e0, 0x7243, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7243, 0xeec0, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfd86, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff7b, 0xfda7, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xeec0, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xeea0, 0xff60, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xeec0, 0x5964, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xeea0, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xeee0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69c3, 0xeec0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf,
-  0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffda, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefde,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefff, 0xffda, 0xff42, 0xff40,
-  0xff40, 0xff21, 0xff24, 0xf7ba, 0x9f7c, 0x2eba, 0x9f7b, 0xf7b2,
-  0xff90, 0xd751, 0x36b9, 0x9f7c, 0xf7da, 0xff24, 0xff21, 0xff40,
-  0xff22, 0xfe4a, 0xfd82, 0xff03, 0xf742, 0xef42, 0xf742, 0xff21,
-  0xfee1, 0xfd61, 0xef22, 0xf742, 0xff03, 0xfd82, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe69, 0xff40, 0xff62, 0xff22, 0xece0,
-  0xecc0, 0xfd62, 0xff42, 0xff40, 0xfe69, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff21, 0xeec2, 0xef58, 0xe6d9, 0x69a5,
-  0x6185, 0xe699, 0xef39, 0xeec2, 0xff21, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xeec0, 0x69e3, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x69e3, 0xeec0, 0xff60, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x50e4,
-  0x50e4, 0x48c4, 0x48c4, 0x5944, 0xeec0, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48e4, 0x48e4,
-  0x48e4, 0x48e4, 0x48c4, 0x5964, 0xeea0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xeec0, 0x69e3, 0x48c4, 0x5925, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xeea0, 0xe5e1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xe641, 0x7224, 0xd3ce, 0xe3ef,
-  0xdb4d, 0xd3ae, 0x7224, 0xe660, 0xff40, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xeec0, 0xff01, 0xff01,
-  0xfee1, 0xff01, 0xeec0, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xffbc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xefff, 0x2edd, 0x02cc, 0x2edd, 0xefff,
-  0xefde, 0x36dc, 0x02cc, 0x2edd, 0xefff, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xf79e, 0x9f7e, 0x2e9d, 0x9f5f, 0xf7dd,
-  0xffb2, 0xd771, 0x36bc, 0x9f7f, 0xf79e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xf677, 0xee77, 0xf677, 0xff70,
-  0xff62, 0xff02, 0xee75, 0xf677, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xe75c, 0xe7bd, 0xe73a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xf7df, 0xa79f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df,
-  0xffde, 0xb79e, 0x2ebd, 0x9f9f, 0xf7df, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xf7bf, 0xefbf, 0xf7bf, 0xffdd,
-  0xffb2, 0xe710, 0x0acb, 0x26dd, 0xef9f, 0xfe75, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff42, 0xef03, 0x36b8, 0x9f5c, 0xf657, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xef22, 0xff43, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x29c3, 0xce22, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4244, 0x8eda, 0x1e5a, 0x9f5c, 0xe73a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xd73b, 0x2ebd, 0x02ec, 0x2edd, 0xefff, 0xffdd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df, 0xffdf,
-  0xffdf, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0xefff, 0xf7df, 0xffdf, 0xffdf,
-  0xffde, 0xf7de, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7bc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xffbf, 0xffbf, 0xffbf, 0xffdd,
-  0xffb2, 0xefb2, 0x2edc, 0x02cd, 0x2ebd, 0xee76, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff42, 0xf723, 0x9f7a, 0x2edb, 0x9f3b, 0xf566, 0xfe49, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xf721, 0xef43, 0xf66c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xf6c0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xeea2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4244, 0xd73a, 0xe75c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xef3a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xf742, 0x8efa, 0x26bd, 0x9f9f, 0xf7df, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xffdf, 0xffff, 0xe7df, 0xe73a, 0xff42, 0xff40,
-  0xff40, 0xef42, 0x2edb, 0x02cc, 0x2ebd, 0xefdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xf7df, 0x9f9f, 0x2ebd, 0x9f9d, 0xf742, 0xff40,
-  0xff40, 0xf742, 0x9f7c, 0x2edd, 0x9f9f, 0xf7df, 0xffdf, 0xffdf,
-  0xffde, 0xffde, 0xefdf, 0x2edd, 0x02cd, 0x2ebb, 0xef42, 0xff40,
-  0xff40, 0xff02, 0xf655, 0xef9e, 0xf7bf, 0xffbf, 0xffbf, 0xffdd,
-  0xff92, 0xff92, 0xf7be, 0x9f5f, 0x2e9d, 0x9f3a, 0xf723, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xf677, 0xee36, 0xf566, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x41c2, 0xeea2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xef3a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xe75c, 0xd73a, 0x4244, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xe73a, 0xe7df, 0xffff, 0xffdf, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xf7df, 0xa79f, 0x26bd, 0x8efa, 0xf742, 0xff40,
-  0xff40, 0xf742, 0xa79c, 0x2ebd, 0x9f7f, 0xf7df, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x2edb, 0xef43, 0xff40,
-  0xff40, 0xef42, 0x2edb, 0x02cd, 0x2edd, 0xefdf, 0xffdf, 0xffdf,
-  0xffde, 0xffde, 0xf7df, 0x9f9f, 0x2edd, 0x9f7c, 0xf742, 0xff40,
-  0xff40, 0xf723, 0x9f3a, 0x2e9d, 0x9f5e, 0xf7bf, 0xffbf, 0xffdd,
-  0xff92, 0xff92, 0xffbe, 0xf7bf, 0xef9e, 0xf655, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xf566, 0xee36, 0xf677, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xce22, 0x29c3, 0xdea2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xe73a, 0x9f5c, 0x1e3a, 0x8eda, 0x4244, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xffdd, 0xefff, 0x2edd, 0x02ec, 0x26bd, 0xd73b, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xffdf,
-  0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xf7bc, 0x9f7f, 0x2ebd, 0x9f9f, 0xf7df, 0xffdf,
-  0xffde, 0xffde, 0xf7df, 0xefff, 0xf7df, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xee76, 0x2ebd, 0x02cd, 0x2ebd, 0xefbf, 0xffdd,
-  0xff92, 0xff92, 0xffbe, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xf566, 0x9f3b, 0x2edb, 0x9f5c, 0xf697, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe8c, 0xef43, 0xf742, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xf6c0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xbe23, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xf744, 0x8efa, 0x269a, 0x8efc, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xefdd, 0x2edd, 0x02cc, 0x2edd, 0xe7df, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf,
-  0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xffde, 0xf7de, 0xefff, 0xf7df, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe75, 0xef9e, 0x2edd, 0x02cd, 0x2ebd, 0xefdd,
-  0xffb2, 0xff92, 0xffbe, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd65, 0xf656, 0x9f5c, 0x2ebb, 0x9f7b, 0xf791,
-  0xff42, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff43, 0xef42, 0xf742, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xf6c0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x41c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xffbc, 0xef3a, 0xff44,
-  0xf744, 0xd73a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xf7df, 0xefff, 0xf7dd,
-  0x9f7c, 0x2edd, 0x9f9f, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x8f9f,
-  0x26dd, 0x02cc, 0x2ebd, 0xefdf, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x26bd,
-  0x8f9e, 0x2edc, 0x9f9f, 0xf7df, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xf7bf, 0x9f5e, 0x2ebd, 0x9f7d,
-  0xf792, 0xefb2, 0xf7be, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xf677, 0xee97, 0xf770,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x41c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xd73a, 0xf744,
-  0xff44, 0xef3a, 0xffbc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0x9f9f, 0x2edd, 0x9f7c,
-  0xf7dd, 0xefff, 0xf7df, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x26bd,
-  0x8f9f, 0x2edd, 0x9f7f, 0xf7df, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x8f9f,
-  0x2edc, 0x12cb, 0x2edd, 0xefdf, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xffbf, 0xf7bf, 0xefbf, 0xf7dd,
-  0xef72, 0xe710, 0xb77d, 0xf7bf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff03, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xe75c, 0xe7bd, 0xe73a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xf7df, 0xa79f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df,
-  0xffde, 0xb79e, 0x2ebd, 0x9f9f, 0xf7df, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xf7bf, 0xefbf, 0xf7bf, 0xffdd,
-  0xffb2, 0xe710, 0x0acb, 0x26dd, 0xef9f, 0xfe75, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff42, 0xef03, 0x36b8, 0x9f5c, 0xf657, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xef22, 0xff43, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x29c3, 0xce22, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4244, 0x8eda, 0x1e5a, 0x9f5c, 0xe73a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xd73b, 0x2ebd, 0x02ec, 0x2edd, 0xefff, 0xffdd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df, 0xffdf,
-  0xffdf, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0xefff, 0xf7df, 0xffdf, 0xffdf,
-  0xffde, 0xf7de, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7bc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xffbf, 0xffbf, 0xffbf, 0xffdd,
-  0xffb2, 0xefb2, 0x2edc, 0x02cd, 0x2ebd, 0xee76, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff42, 0xf723, 0x9f7a, 0x2edb, 0x9f3b, 0xf566, 0xfe49, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xf721, 0xef43, 0xf66c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xf6c0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xeea2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4244, 0xd73a, 0xe75c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xef3a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xf742, 0x8efa, 0x26bd, 0x9f9f, 0xf7df, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xffdf, 0xffff, 0xe7df, 0xe73a, 0xff42, 0xff40,
-  0xff40, 0xef42, 0x2edb, 0x02cc, 0x2ebd, 0xefdf, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xf7df, 0x9f9f, 0x2ebd, 0x9f9d, 0xf742, 0xff40,
-  0xff40, 0xf742, 0x9f7c, 0x2edd, 0x9f9f, 0xf7df, 0xffdf, 0xffdf,
-  0xffde, 0xffde, 0xefdf, 0x2edd, 0x02cd, 0x2ebb, 0xef42, 0xff40,
-  0xff40, 0xff02, 0xf655, 0xef9e, 0xf7bf, 0xffbf, 0xffbf, 0xffdd,
-  0xff92, 0xff92, 0xf7be, 0x9f5f, 0x2e9d, 0x9f3a, 0xf723, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xf677, 0xee36, 0xf566, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x41c2, 0xeea2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xef3a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xe75c, 0xd73a, 0x4244, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xe73a, 0xe7df, 0xffff, 0xffdf, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xf7df, 0xa79f, 0x26bd, 0x8efa, 0xf742, 0xff40,
-  0xff40, 0xf742, 0xa79c, 0x2ebd, 0x9f7f, 0xf7df, 0xffdf, 0xffdf,
-  0xffdf, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x2edb, 0xef43, 0xff40,
-  0xff40, 0xef42, 0x2edb, 0x02cd, 0x2edd, 0xefdf, 0xffdf, 0xffdf,
-  0xffde, 0xffde, 0xf7df, 0x9f9f, 0x2edd, 0x9f7c, 0xf742, 0xff40,
-  0xff40, 0xf723, 0x9f3a, 0x2e9d, 0x9f5e, 0xf7bf, 0xffbf, 0xffdd,
-  0xff92, 0xff92, 0xffbe, 0xf7bf, 0xef9e, 0xf655, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xf566, 0xee36, 0xf677, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xce22, 0x29c3, 0xdea2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xe73a, 0x9f5c, 0x1e3a, 0x8eda, 0x4244, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xffdd, 0xefff, 0x2edd, 0x02ec, 0x26bd, 0xd73b, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xffdf,
-  0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xf7bc, 0x9f7f, 0x2ebd, 0x9f9f, 0xf7df, 0xffdf,
-  0xffde, 0xffde, 0xf7df, 0xefff, 0xf7df, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xee76, 0x2ebd, 0x02cd, 0x2ebd, 0xefbf, 0xffdd,
-  0xff92, 0xff92, 0xffbe, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xf566, 0x9f3b, 0x2edb, 0x9f5c, 0xf697, 0xff70,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe8c, 0xef43, 0xf742, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xf6c0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xbe23, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xf744, 0x8efa, 0x269a, 0x8efc, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xefdd, 0x2edd, 0x02cc, 0x2edd, 0xe7df, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf,
-  0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7df, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xffde, 0xf7de, 0xefff, 0xf7df, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe75, 0xef9e, 0x2edd, 0x02cd, 0x2ebd, 0xefdd,
-  0xffb2, 0xff92, 0xffbe, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd65, 0xf656, 0x9f5c, 0x2ebb, 0x9f7b, 0xf791,
-  0xff42, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff43, 0xef42, 0xf742, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xf6c0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x41c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xffbc, 0xef3a, 0xff44,
-  0xf744, 0xd73a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xf7df, 0xefff, 0xf7dd,
-  0x9f7c, 0x2edd, 0x9f9f, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x8f9f,
-  0x26dd, 0x02cc, 0x2ebd, 0xefdf, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x26bd,
-  0x8f9e, 0x2edc, 0x9f9f, 0xf7df, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xf7bf, 0x9f5e, 0x2ebd, 0x9f7d,
-  0xf792, 0xefb2, 0xf7be, 0xffbf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xf677, 0xee97, 0xf770,
-  0xff62, 0xff02, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6b, 0xff22, 0xff21, 0xff21, 0xff01,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe6b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff42, 0xfd80,
-  0xfd80, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x61c3, 0x61c5, 0xe6d9, 0xef59, 0xee82,
-  0xee82, 0xef58, 0xe6d9, 0x69c5, 0x61c3, 0xe640, 0xff40, 0xff41,
-  0xff40, 0xeec0, 0x69e3, 0x48c4, 0x48e4, 0x5966, 0x5966, 0x5964,
-  0x5964, 0x5966, 0x5966, 0x48e4, 0x48c4, 0x69c3, 0xeec0, 0xff40,
-  0xff40, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x50e4, 0x48c4, 0x5964, 0xeea0, 0xfe84,
-  0xff60, 0xeec0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x48e4, 0x48c4,
-  0x48c4, 0x48e4, 0x50e4, 0x50e4, 0x48c4, 0x5964, 0xee80, 0xe5c0,
-  0xff20, 0xeec0, 0x69e3, 0x48c4, 0x48c4, 0x50e4, 0x5964, 0x5964,
-  0x5964, 0x5964, 0x50e4, 0x48c4, 0x48c4, 0x69e3, 0xeec0, 0xfe84,
-  0xe5a0, 0xf663, 0xe661, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xf6e0,
-  0xf6c0, 0xe660, 0x69e3, 0x5964, 0x69e3, 0xe660, 0xff40, 0xff40,
-  0xf624, 0xe5c0, 0xff20, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff60,
-  0xff60, 0xff40, 0xeec0, 0xeea0, 0xeec0, 0xff40, 0xff40, 0xff40,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x41c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xd73a, 0xf744,
-  0xff44, 0xef3a, 0xffbc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0x9f9f, 0x2edd, 0x9f7c,
-  0xf7dd, 0xefff, 0xf7df, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xfffd, 0xffdf, 0xefdf, 0x2edd, 0x02cc, 0x26bd,
-  0x8f9f, 0x2edd, 0x9f7f, 0xf7df, 0xffdf, 0xfffd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffbc, 0xffdf, 0xf7df, 0x9f9f, 0x2edd, 0x8f9f,
-  0x2edc, 0x12cb, 0x2edd, 0xefdf, 0xffdf, 0xffbc, 0xff42, 0xff40,
-  0xff40, 0xff02, 0xfe55, 0xff9e, 0xffbf, 0xf7bf, 0xefbf, 0xf7dd,
-  0xef72, 0xe710, 0xb77d, 0xf7bf, 0xff9e, 0xfe55, 0xff02, 0xff40,
-  0xff22, 0xfe4a, 0xfd66, 0xfe36, 0xfe77, 0xfe77, 0xfe97, 0xff70,
-  0xff62, 0xff03, 0xfe75, 0xfe77, 0xfe36, 0xfd66, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe4b, 0xff22, 0xff21, 0xff21, 0xff21,
-  0xfee0, 0xfd80, 0xff01, 0xff22, 0xfe4b, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeee0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xe640, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xe640, 0xff40, 0xff40, 0xff41,
-  0xff40, 0xff40, 0xeec0, 0x69c3, 0x48e4, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x48e4, 0x69c3, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x48c4, 0x48c4,
-  0x48c4, 0x48c4, 0x48c4, 0x48c4, 0x5964, 0xeea0, 0xff20, 0xff40,
-  0xff20, 0xee00, 0xeea0, 0x5964, 0x48c4, 0x50e4, 0x50e4, 0x5964,
-  0x5964, 0x50e4, 0x50e4, 0x48e4, 0x5944, 0xede4, 0xede1, 0xf644,
-  0xff40, 0xff20, 0xeea0, 0x69c4, 0x48c4, 0x48c4, 0x69c3, 0xe660,
-  0xe660, 0x69c3, 0x48c4, 0x48c4, 0x61a3, 0xdd41, 0xf623, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xe584, 0x69c4, 0x69e3, 0xe660, 0xff60,
-  0xff60, 0xe660, 0x69e3, 0x69e3, 0xe641, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xeea0, 0xeec0, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xeec0, 0xeec0, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xf700, 0xb540, 0xe680, 0xe6a2, 0x39c2, 0xd622, 0x39c2, 0xeec0,
-  0xeec0, 0x39c2, 0xd622, 0x39c2, 0xe6a2, 0xe680, 0xb540, 0xf700,
-  0xff40, 0xe680, 0x4a44, 0xe73a, 0xef5c, 0xf7bc, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xf7bc, 0xef5c, 0xe73a, 0x4a44, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xffff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xffff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf,
-  0xffdf, 0xf7df, 0xefdf, 0xf7df, 0xffdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffda, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefde,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefff, 0xffda, 0xff42, 0xff40,
-  0xff40, 0xff21, 0xff24, 0xf7ba, 0x9f7c, 0x2eba, 0x9f7b, 0xf7b2,
-  0xff90, 0xd751, 0x36b9, 0x9f7c, 0xf7da, 0xff24, 0xff21, 0xff40,
-  0xff22, 0xfe4a, 0xfd82, 0xff03, 0xf742, 0xef42, 0xf742, 0xff21,
-  0xfee1, 0xfd61, 0xef22, 0xf742, 0xff03, 0xfd82, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe69, 0xff40, 0xff62, 0xff22, 0xece0,
-  0xecc0, 0xfd62, 0xff42, 0xff40, 0xfe69, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff21, 0xeec2, 0xef58, 0xe6d9, 0x69a5,
-  0x6185, 0xe699, 0xef39, 0xeec2, 0xff21, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xeec0, 0x69e3, 0x5966, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5966, 0x69e3, 0xeec0, 0xff60, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xeec0, 0x5964, 0x48c4, 0x48c4, 0x50e4,
-  0x50e4, 0x48c4, 0x48c4, 0x5944, 0xeec0, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xeec0, 0x5964, 0x48c4, 0x48e4, 0x48e4,
-  0x48e4, 0x48e4, 0x48c4, 0x5964, 0xeea0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xeec0, 0x69e3, 0x48c4, 0x5925, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xeea0, 0xe5e1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xe641, 0x7224, 0xd3ce, 0xe3ef,
-  0xdb4d, 0xd3ae, 0x7224, 0xe660, 0xff40, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xeec0, 0xff01, 0xff01,
-  0xfee1, 0xff01, 0xeec0, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfd86, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff7b, 0xfda7, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xff20, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xff20, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xff40, 0xeec0, 0x7245, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6d9, 0x7245, 0xeea0, 0xff60, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xeec0, 0x5964, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xeea0, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xeee0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69c3, 0xeec0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfd86, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff7b, 0xfda7, 0xfe4a, 0xff22,
-  0xfecc, 0xff6f, 0xff4e, 0xfe8b, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe8c, 0xff4e, 0xff6f, 0xfeec,
-  0xff6e, 0xff42, 0xff41, 0xeea1, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xeea1, 0xff41, 0xff42, 0xff8e,
-  0xff41, 0xff40, 0xf6e0, 0x7243, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7243, 0xeec0, 0xff40, 0xff41,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff42, 0xff8d, 0xff8f, 0xff8d, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xff8d, 0xff8f, 0xff8d, 0xff42, 0xff40, 0xff40,
-  0xff40, 0xff41, 0xff8c, 0xff42, 0xff41, 0xff42, 0xff8c, 0xff41,
-  0xff41, 0xff8c, 0xff42, 0xff41, 0xff42, 0xff8c, 0xff41, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff40, 0xff40, 0xff40, 0xff41, 0xff40,
-  0xff40, 0xff41, 0xff40, 0xff40, 0xff40, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff00,
-  0xff41, 0xff41, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xff00, 0xff00, 0xff00, 0xff00, 0xfee0, 0xfda2,
-  0xff4e, 0xff8d, 0xff01, 0xff00, 0xff00, 0xff00, 0xff20, 0xff40,
-  0xff22, 0xfe4a, 0xfd62, 0xfd21, 0xfd40, 0xfd40, 0xfd61, 0xff2c,
-  0xff63, 0xfee1, 0xfd60, 0xfd40, 0xfd21, 0xfd62, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeeaf, 0xfe29, 0xff00, 0xff00, 0xff00, 0xff21,
-  0xfee0, 0xfd80, 0xfee0, 0xff00, 0xfe29, 0xeeaf, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde21, 0xeee0, 0xff62, 0xff42, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff62, 0xff8d, 0xffaf, 0xff8d, 0xff61, 0xff40,
-  0xff40, 0xff61, 0xff8d, 0xffaf, 0xff8d, 0xff62, 0xff40, 0xff40,
-  0xff40, 0xff41, 0xe6ec, 0xf722, 0xeec1, 0xff41, 0xeea0, 0xff42,
-  0xff42, 0xeea0, 0xff41, 0xeec1, 0xf722, 0xe6ec, 0xff41, 0xff40,
-  0xff40, 0xeec0, 0x4a43, 0xd622, 0x3a22, 0xbda0, 0x3a24, 0xef5b,
-  0xef5b, 0x3224, 0xbda0, 0x3a22, 0xd622, 0x4a43, 0xe6a0, 0xff60,
-  0xff40, 0xff42, 0xef5a, 0xe7bd, 0x1e3b, 0x0aaa, 0x1e3b, 0xefdf,
-  0xefdf, 0x263a, 0x0aaa, 0x1e3a, 0xe7bd, 0xef5a, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xffba, 0xf7df, 0xa79f, 0x2ede, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd792, 0x2edd, 0x9f9f, 0xf7df, 0xffbb, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff42, 0xff8d, 0xff8f, 0xff8d, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xff8d, 0xff8f, 0xff8d, 0xff42, 0xff40, 0xff40,
-  0xff40, 0xff41, 0xff8c, 0xff42, 0xff41, 0xff42, 0xff8c, 0xff41,
-  0xff41, 0xff8c, 0xff42, 0xff41, 0xff42, 0xff8c, 0xff41, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff40, 0xff40, 0xff40, 0xff41, 0xff40,
-  0xff40, 0xff41, 0xff40, 0xff40, 0xff40, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff00,
-  0xff41, 0xff41, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff20, 0xff00, 0xff00, 0xff00, 0xff00, 0xfee0, 0xfda2,
-  0xff4e, 0xff8d, 0xff01, 0xff00, 0xff00, 0xff00, 0xff20, 0xff40,
-  0xff22, 0xfe4a, 0xfd62, 0xfd21, 0xfd40, 0xfd40, 0xfd61, 0xff2c,
-  0xff63, 0xfee1, 0xfd60, 0xfd40, 0xfd21, 0xfd62, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeeaf, 0xfe29, 0xff00, 0xff00, 0xff00, 0xff21,
-  0xfee0, 0xfd80, 0xfee0, 0xff00, 0xfe29, 0xeeaf, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde21, 0xeee0, 0xff62, 0xff42, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeee0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff41, 0xff41, 0xff41, 0xff40, 0xff40, 0xff40,
-  0xff40, 0xff40, 0xff62, 0xff8d, 0xffaf, 0xff8d, 0xff61, 0xff40,
-  0xff40, 0xff61, 0xff8d, 0xffaf, 0xff8d, 0xff62, 0xff40, 0xff40,
-  0xff40, 0xff41, 0xe6ec, 0xf722, 0xeec1, 0xff41, 0xeea0, 0xff42,
-  0xff42, 0xeea0, 0xff41, 0xeec1, 0xf722, 0xe6ec, 0xff41, 0xff40,
-  0xff40, 0xeec0, 0x4a43, 0xd622, 0x3a22, 0xbda0, 0x3a24, 0xef5b,
-  0xef5b, 0x3224, 0xbda0, 0x3a22, 0xd622, 0x4a43, 0xe6a0, 0xff60,
-  0xff40, 0xff42, 0xef5a, 0xe7bd, 0x1e3b, 0x0aaa, 0x1e3b, 0xefdf,
-  0xefdf, 0x263a, 0x0aaa, 0x1e3a, 0xe7bd, 0xef5a, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xffba, 0xf7df, 0xa79f, 0x2ede, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd792, 0x2edd, 0x9f9f, 0xf7df, 0xffbb, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20,
-  0xff40, 0xf700, 0xff60, 0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700,
-  0xf700, 0xa4c0, 0xeec0, 0xa4c0, 0xf700, 0xff60, 0xf700, 0xff40,
-  0xf700, 0xbd60, 0xe680, 0xe6a2, 0x4a22, 0xd622, 0x4a22, 0xeec0,
-  0xeec0, 0x4a22, 0xd622, 0x4a22, 0xe6a2, 0xe680, 0xbd60, 0xf700,
-  0xff40, 0xe680, 0x4a24, 0xe73a, 0xef5d, 0xffbd, 0xef3a, 0xff44,
-  0xff44, 0xef3a, 0xffbd, 0xef5d, 0xe73a, 0x4a24, 0xe680, 0xff60,
-  0xff40, 0xff42, 0xef3a, 0xffdf, 0xffff, 0xefff, 0xffff, 0xffdd,
-  0xffdd, 0xffff, 0xefff, 0xffff, 0xffdf, 0xef3a, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df,
-  0xf7df, 0x9f9f, 0x2ebd, 0x9f7f, 0xf7df, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff42, 0xffdd, 0xefff, 0x2edd, 0x02cc, 0x2ebd, 0xefdf,
-  0xefde, 0x36dc, 0x02cc, 0x2ebd, 0xefdf, 0xffdd, 0xff42, 0xff40,
-  0xff40, 0xff22, 0xff9a, 0xf7df, 0x9f9f, 0x2edd, 0x9f9f, 0xf7dd,
-  0xffb2, 0xd772, 0x36dc, 0x9f9f, 0xf7df, 0xff9a, 0xff23, 0xff40,
-  0xff22, 0xfe4a, 0xfda6, 0xff7b, 0xf7dd, 0xefdd, 0xf7dc, 0xff90,
-  0xff42, 0xff23, 0xefba, 0xf7dd, 0xff9b, 0xfda7, 0xfe4a, 0xff22,
-  0xfeec, 0xff4f, 0xeece, 0xfe6c, 0xff43, 0xff42, 0xff42, 0xff21,
-  0xfee0, 0xfd80, 0xff21, 0xff43, 0xfe6c, 0xeece, 0xff4f, 0xfeec,
-  0xff8e, 0xeee3, 0x82c4, 0xde01, 0xeec0, 0xff62, 0xff22, 0xece0,
-  0xece0, 0xff02, 0xff62, 0xeec0, 0xde21, 0x82c4, 0xeec3, 0xff8e,
-  0xff41, 0xff40, 0xe660, 0x7223, 0x69c5, 0xe6d9, 0xe6d9, 0x69a5,
-  0x6185, 0xe6d9, 0xe6f9, 0x69e5, 0x7223, 0xe660, 0xff40, 0xff61,
-  0xff40, 0xff20, 0xff40, 0xe640, 0x5944, 0x5946, 0x5966, 0x48e4,
-  0x48e4, 0x5966, 0x5946, 0x5944, 0xe640, 0xff40, 0xff20, 0xff40,
-  0xff20, 0xe600, 0xff20, 0xf6e0, 0x69e3, 0x48c4, 0x5905, 0x5925,
-  0x5905, 0x5905, 0x48c4, 0x69e3, 0xf6c0, 0xfe63, 0xe5c1, 0xf644,
-  0xff40, 0xff00, 0xff20, 0xff20, 0xe660, 0x7204, 0xd370, 0xdbb1,
-  0xdaef, 0xd350, 0x7204, 0xe660, 0xff20, 0xe5c1, 0xf604, 0xe5a1,
-  0xff20, 0xf663, 0xe5c1, 0xf663, 0xff40, 0xeea1, 0xec8f, 0xec51,
-  0xec30, 0xec6f, 0xeea1, 0xff40, 0xff20, 0xf663, 0xe5c1, 0xf664,
-  0xff00, 0xe5c0, 0xf624, 0xe5c0, 0xff20, 0xff40, 0xff01, 0xff01,
-  0xff01, 0xff01, 0xff40, 0xff40, 0xff40, 0xff20, 0xff20, 0xff20
-};
-
-const Animation sponge_bobAnimation = {
-  .name = "Sponge Bob",
-  .frameCount = 48,
-  .width = 16,
-  .height = 16,
-  .frameDurations = sponge_bobDurations,
-  .animationFrames = sponge_bobFrames
-};
-#endif // ANIMATION_SPONGE_BOB_H
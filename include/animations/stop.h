@@ -1,534 +0,0 @@
-// stop.h - Auto-generated from stop.json
-#ifndef ANIMATION_STOP_H
-#define ANIMATION_STOP_H
-
-#include "animation_types.h"
-
-// Frame Durations for stop (in 100ms units)
-static const uint8_t PROGMEM stopDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for stop
-static const uint16_t PROGMEM stopFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xbdf7, 0xbdf7, 0xbdf7,
-  0xbdf7, 0xbdf7, 0xbdf7, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000, 0x0000,
-  0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000,
-  0xb596, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xb596,
-  0xac92, 0x9000, 0xffff, 0xce38, 0xffff, 0xffff, 0xffff, 0x9000,
-  0xffff, 0xffff, 0x9000, 0x9000, 0xffff, 0xffff, 0x9000, 0xac92,
-  0xac92, 0xffff, 0x9000, 0x9000, 0x9000, 0xffff, 0x9000, 0xffff,
-  0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0x9000, 0xffff, 0xac92,
-  0xac92, 0x9000, 0xffff, 0x9000, 0x9000, 0xffff, 0x9000, 0xffff,
-  0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0xffff, 0x9000, 0xac92,
-  0xac92, 0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0x9000, 0xffff,
-  0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0x9000, 0x9000, 0xac92,
-  0xac92, 0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0x9000, 0xffff,
-  0x9000, 0x9000, 0xffff, 0x9000, 0xffff, 0x9000, 0x9000, 0xac92,
-  0xac92, 0xffff, 0xffff, 0x9000, 0x9000, 0xffff, 0x9000, 0x9000,
-  0xffff, 0xffff, 0x9000, 0x9000, 0xffff, 0x9000, 0x9000, 0xac92,
-  0xb596, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xb596,
-  0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000,
-  0x0000, 0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0xbdf7, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0xbdf7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0xb596, 0xbdf7, 0xbdf7, 0xbdf7,
-  0xbdf7, 0xbdf7, 0xbdf7, 0xb596, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0xa430, 0xb0e3, 0x9882, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0xa430, 0xb8e3, 0x9800, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0xb8c3, 0x9800, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0xa492, 0xb0e3, 0xa0a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xb555,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xa882, 0x9882, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xa800, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0xb0c3, 0xa800, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0xa492, 0xb0c3, 0xb0a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xac30, 0xb986, 0xe5d7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xb082, 0xa882, 0x9882,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xb000, 0xa800, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0xb0c3, 0xa800, 0xa800, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0xa492, 0xb0c3, 0xb0a2, 0xb082, 0xa0a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xac30, 0xb986, 0xe5d7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xb082, 0xb082, 0xa882,
-  0x9882, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xa800, 0xa800, 0xa800, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0xb0c3, 0xa800, 0xa800, 0xa800, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0xa492, 0xb0c3, 0xb0a2, 0xb082, 0xb0a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xac30, 0xb986, 0xe5d7, 0xcd75, 0xee9a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xc1c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xb986, 0xe596, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0xa882, 0xb082, 0xb082,
-  0xa882, 0x9882, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0xa800, 0xa800, 0xa800, 0xa800,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0xa800, 0xa800, 0xa800, 0xa800, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0xb0a2, 0xb082, 0xb0a2, 0xb0a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xac30, 0xb186, 0xe5d7, 0xcd75, 0xee9a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xc1c7, 0xa882, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xb986, 0xe596, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0xa820, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9882, 0xa882, 0xb082,
-  0xb082, 0xa882, 0x9882, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0xa800, 0xa800, 0xa800,
-  0xa800, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0xa800, 0xa800, 0xa800, 0xa800,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0xa8a2, 0xb0a2, 0xb0a2, 0xb0a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xe5d7, 0xcd75, 0xee9a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xc1c7, 0xb082, 0xb945, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xb986, 0xe596, 0xb104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0xa820, 0xb904, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0xb104, 0xa924, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9882, 0xa882,
-  0xb082, 0xb082, 0xa882, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0xa800, 0xa800,
-  0xa800, 0xa800, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0xa800, 0xa800, 0xa800,
-  0xa800, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0xb0a2, 0xb0a2, 0xb0a2, 0xa800,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xe5d7, 0xcd75, 0xee9a, 0xf73c, 0xe638, 0xa986,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xe618, 0xc1c7, 0xb082, 0xb945, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xb986, 0xe596, 0xb904, 0xb082, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0xa820, 0xb904, 0xee38, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0xb104, 0xb924, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xb555,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9882,
-  0xa882, 0xb082, 0xb082, 0xa8e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0xa800,
-  0xa800, 0xa800, 0xa800, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0xa800, 0xa800,
-  0xa800, 0xa800, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x90a2, 0x98a2, 0xb0a2, 0xb0a2, 0xb000,
-  0xb0a2, 0xa0a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xee9a, 0xf73c, 0xee38, 0xb986,
-  0xee18, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0xa882, 0xb945, 0xf6ba, 0xc1e7, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xe596, 0xb904, 0xb082, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0xa820, 0xb904, 0xee38, 0xb965, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0xb104, 0xb924, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xee79, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0xa492, 0xb186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9882, 0xa882, 0xb082, 0xb0e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0xa800, 0xa800, 0xa800, 0xa800, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0xa800,
-  0xa800, 0xa800, 0xa800, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0xb0a2, 0xb000,
-  0xb0a2, 0xb0a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xee9a, 0xf73c, 0xee38, 0xb986,
-  0xee18, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9882, 0xb945, 0xf6ba, 0xc1e7, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xe596, 0xb104, 0xb082, 0xee79, 0xb965, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9020, 0xb904, 0xee38, 0xb965, 0xee79, 0xa965, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0xb104, 0xb924, 0xee18, 0xb965, 0xee79, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xee79, 0xee38, 0xb0e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0xa492, 0xb186, 0xb0a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9882, 0xa882, 0xb0e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0xa800, 0xa800, 0xa800, 0xb0e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0xa800, 0xa800, 0xb000, 0xa800, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0xa800,
-  0xb0a2, 0xb0a2, 0xa800, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xee38, 0xb986,
-  0xee18, 0xee38, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xc1e7, 0xee18,
-  0xb145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0xb082, 0xee79, 0xb965, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xb965, 0xee79, 0xb965, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xb124, 0xee18, 0xb965, 0xee79, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xee38, 0xb8e3, 0xb082, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0xa492, 0xb186, 0xb0a2, 0xa800, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0xb0c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0xa800, 0xb0e3, 0xa430, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0xa800, 0xb000, 0xa800, 0xb0c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0xb0a2, 0xa800, 0xb000, 0xb082, 0xa0a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xee38, 0xb904, 0xb082, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xb945, 0xb924, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xb965, 0xee9a,
-  0xb082, 0xb082, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xee79, 0xb965, 0xee9a,
-  0xb082, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xb965, 0xee9a, 0xb965, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xee38, 0xb8e3, 0xb082, 0xee18, 0xb0a2, 0xa0e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0xb0a2, 0xa800, 0xb000, 0xb082, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0xb0c3, 0xb000, 0xa800, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0xb0e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0xa800, 0xb0c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0xa800, 0xb082, 0xb0a2, 0xa8c3, 0xa492,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xee38, 0xb104, 0xb082, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xb924, 0xee18, 0xb965, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0xb082, 0xb082, 0xee9a, 0xb965, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa965, 0xee9a,
-  0xb082, 0xb082, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xb965, 0xee18,
-  0xb945, 0xb945, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0xb0a2, 0xb8e3,
-  0xee38, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0xa800, 0xb082, 0xb000, 0xa800,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9410, 0x98c3, 0xa800, 0xb000, 0xa800, 0xa800, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0xb0e3, 0xb000, 0xa800, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0xa8e3, 0x9882, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0xa4b2, 0xbd75, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0xa8c3, 0xa492,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xee38, 0xb965, 0xac30,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xca8a, 0xe5f7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xb965, 0xf71c, 0xee38, 0xb165, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xb965, 0xee9a, 0xb145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xb145, 0xee18, 0xb965, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0xa0e3,
-  0xe638, 0xee38, 0xb8e3, 0xb082, 0xe618, 0x98a2, 0x9041, 0xa430,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0xa800,
-  0xb0a2, 0xb0a2, 0xa800, 0x9000, 0x9882, 0x9000, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0xa800, 0xb000,
-  0xa800, 0xa800, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0xa800, 0xa800, 0xa800,
-  0xa800, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0xa8e3, 0xb082, 0xb082, 0xa882,
-  0x9882, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xee38, 0xb965, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xb945, 0xa841, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0xb082, 0xa841, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0xa0e3, 0xb0a2, 0xee18, 0xb0a2, 0xa841, 0xac30,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0xa800, 0xb000, 0xb082, 0xa800, 0x98e3, 0x9c92,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0xa800, 0xb000, 0xb000, 0xa800, 0x98e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0xa800, 0xa800, 0xa800, 0xa800, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9882, 0xa882,
-  0xb082, 0xb082, 0xa882, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18e3, 0xa4b2, 0xbd55, 0xbd55, 0xbd55,
-  0xbd55, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9082, 0x9082, 0x98e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x98e3, 0x9c30, 0x18e3, 0x0000,
-  0x18e3, 0x9c30, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0x9000, 0x98c3, 0x9c30, 0x18e3,
-  0x9c92, 0x98e3, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x98a2, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x98a2, 0x98a2, 0x98c3, 0x9c92,
-  0xa430, 0xa186, 0xddd7, 0xc575, 0xe69a, 0xf73c, 0xe638, 0xa186,
-  0xe618, 0xe638, 0xa104, 0x9882, 0xeeba, 0xe638, 0xa165, 0xa430,
-  0xacb2, 0xde18, 0xa9c7, 0x9082, 0xa145, 0xeeba, 0xaa08, 0xe618,
-  0xa145, 0xa124, 0xe618, 0xa165, 0xeeba, 0xb28a, 0xddf7, 0xacb2,
-  0xa410, 0xa186, 0xdd96, 0xa104, 0x98a2, 0xee79, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xf71c, 0xe638, 0xa186, 0xa410,
-  0xa410, 0x9041, 0xa104, 0xe638, 0xa165, 0xe679, 0xa165, 0xee9a,
-  0x9882, 0x9882, 0xee9a, 0xa165, 0xee9a, 0xa145, 0x9041, 0xa410,
-  0xa430, 0x9904, 0xa124, 0xe618, 0xa165, 0xee9a, 0xa165, 0xe618,
-  0xa145, 0xa145, 0xe618, 0xa165, 0xee9a, 0x98a2, 0x9041, 0xa410,
-  0xacd3, 0xe679, 0xe638, 0x98e3, 0x98a2, 0xe618, 0x98a2, 0x98e3,
-  0xe638, 0xe638, 0x98e3, 0x98a2, 0xe618, 0xa0a2, 0xa841, 0xac30,
-  0x9c92, 0xa186, 0x98a2, 0x9000, 0x9000, 0x9882, 0x9000, 0x9000,
-  0x98a2, 0x98a2, 0x9000, 0x9000, 0x9882, 0xa800, 0xb0e3, 0xa492,
-  0x18c3, 0x9c10, 0x98c3, 0x9000, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0x9000, 0xa800, 0xb0e3, 0x9c30, 0x18e3,
-  0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9000, 0x9000, 0x9000, 0x9000,
-  0x9000, 0x9000, 0x9000, 0xa800, 0xb0e3, 0xa430, 0x18e3, 0x0000,
-  0x0000, 0x0000, 0x18e3, 0x9c30, 0x98e3, 0x9082, 0x9082, 0x9082,
-  0x9082, 0x9882, 0xa882, 0xb0e3, 0x9c30, 0x18e3, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x18c3, 0x9cb2, 0xbd55, 0xbd55, 0xb555,
-  0xb555, 0xbd55, 0xbd55, 0xa4b2, 0x18e3, 0x0000, 0x0000, 0x0000
-};
-
-const Animation stopAnimation = {
-  .name = "Stop",
-  .frameCount = 16,
-  .width = 16,
-  .height = 16,
-  .frameDurations = stopDurations,
-  .animationFrames = stopFrames
-};
-#endif // ANIMATION_STOP_H
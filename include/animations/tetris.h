@@ -1,1942 +0,0 @@
-// tetris.h - Auto-generated from tetris.json
-#ifndef ANIMATION_TETRIS_H
-#define ANIMATION_TETRIS_H
-
-#include "animation_types.h"
-
-// Frame Durations for tetris (in 100ms units)
-static const uint8_t PROGMEM tetrisDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for tetris
-static const uint16_t PROGMEM tetrisFrames[] = {
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0xfddc, 0xfddc, 0xfddc, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0x020a, 0x020a, 0x020a, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0xff36, 0x020a, 0x020a, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0xff36, 0x020a, 0x020a, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0xff36, 0xff36, 0x020a, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x020a, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f, 0x4f1f,
-  0x465c, 0x00c3, 0x120a, 0xd539, 0xed9b, 0xd539, 0x1a4b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x09c9, 0x1a4b, 0x1a4b, 0x1a4b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00a3, 0x0187, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01c9,
-  0x01c9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x08c3, 0x08c3, 0x08c3, 0x08c3, 0x08c3, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x326c, 0xdd5a, 0x32ad, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1104, 0xc4b6, 0xe57b, 0xc4f8, 0x124b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x0a0a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00a3, 0x0187, 0x01c9, 0x01c9, 0x01c9, 0x01c9, 0x01c9,
-  0x01c9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x08c3, 0x08c3, 0x08c3, 0x08c3, 0x08c3, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x1905, 0xe539, 0xfdfd, 0xed7b, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xe539, 0xfe1d, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xed9a, 0xffbf, 0xedfb, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0xd659, 0xe73c, 0xd69a, 0x1a2a, 0x01a8, 0x01c9,
-  0x01c9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1925, 0x08c3, 0x08c3, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a4b, 0xd654, 0xd654, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x1a6b, 0x1a6b, 0x0a0a,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x124b, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd19, 0x32ad, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe55a, 0xc4b7, 0x120a, 0x01a8, 0x01c9,
-  0x01c9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x08c3, 0x08c3, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xde74, 0x32ec, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a4b, 0xd654, 0xc613, 0x124b,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x1a4b, 0x1a6b, 0x0a0a,
-  0x01ea, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x124b, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd19, 0x32ad, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe55a, 0xc4b7, 0x120a, 0x01a8, 0x01c9,
-  0x01c9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x08c3, 0x08c3, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeed5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a6b, 0xeeb5, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x1a6b, 0xeed6, 0xeed5, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xef5c, 0xeed6, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430f, 0xef7d, 0xeef7, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe71c, 0xd6ba, 0x1a2a,
-  0x01a8, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1945, 0x1925, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x7e97, 0x128b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x126b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11a8, 0x01c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1041, 0xcbaf, 0x2a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1041, 0xdbd0, 0xdc11, 0x1a0a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x29e9, 0xc3af, 0x19c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x10e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e7d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x1a6b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xde74, 0x32ec, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xc5b2, 0x1209,
-  0x01a9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x979a, 0x8f19,
-  0x126b, 0x01a8, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x7e98, 0x22ed,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x0020, 0x0000, 0x11a8, 0x01c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x1041, 0xcbaf, 0x2a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1041, 0xdbd0, 0xdc11, 0x1a0a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x29e9, 0xc3af, 0x19c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x10e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e7d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x1a6b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xde74, 0x32ec, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xc5b2, 0x1209,
-  0x01a9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x128b, 0x126b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x124b, 0x7e97, 0x8f19,
-  0x1aed, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x1acc, 0x8f19,
-  0x7eb8, 0x122a, 0x0000, 0x0000, 0x11a8, 0x01c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x126b,
-  0x126b, 0x09e9, 0x0000, 0x1041, 0xcbaf, 0x2a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x0000, 0x1041, 0xdbd0, 0xdc11, 0x1a0a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x29e9, 0xc3af, 0x19c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x10e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e7d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x1a6b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xde74, 0x32ec, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xc5b2, 0x1209,
-  0x01a9, 0x0187, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x08c3,
-  0x08c3, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c,
-  0x465c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x977a, 0xa7fc,
-  0x977a, 0x122a, 0x0082, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0020, 0x0082, 0x00c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0000, 0x0000, 0x11a8, 0x01c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0000, 0x1041, 0xcbaf, 0x2a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0000, 0x1041, 0xdbd0, 0xdc11, 0x1a0a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0000, 0x0000, 0x29e9, 0xc3af, 0x19c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x124a, 0x0020, 0x0082, 0x00a3, 0x10e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x122a, 0x0082, 0x45da, 0x4e7d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x122a, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x975a, 0xa7fc,
-  0x977a, 0x122a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x01ea, 0x22cc, 0x977a, 0xa7fc,
-  0x977a, 0x122a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a4a, 0xce54, 0xafdb, 0xa7fc,
-  0x977a, 0x122a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xeed6, 0xfffe, 0xf7ff,
-  0xa79b, 0x124a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xe695, 0xef1c,
-  0xceba, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x1945,
-  0x1925, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a2a, 0xc3d0, 0x1a2b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x0a0a, 0x1a2a, 0x0a0a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x2aec, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xe6d5, 0xaf9a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a9, 0x1a2a, 0xdc11, 0xec31, 0x1a2b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x2a4b, 0xc3d0, 0x1a2b, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x122a, 0x0a0a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x2aec, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xe6d5, 0xaf9a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xdc11, 0x326b, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x00c3, 0x11e9, 0xdc11, 0xdc11, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01a9, 0x2a4b, 0xcbd0, 0x1a2b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x122a, 0x0a0a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x0a0a, 0x1a4b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x1a6b, 0xc5f3, 0x2aec, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xcd18, 0x430e, 0xe6d5, 0xaf9a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xd518, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1925, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x00c3, 0x19e9, 0xec31, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x00c3, 0x19e9, 0xec72, 0xec31, 0x1a2a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00a3, 0x1a2a, 0xeefc, 0xecd3, 0x2a8b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00a3, 0x122a, 0xe75d, 0xffbe, 0xde75, 0x22cc, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4b, 0xedfc, 0xffbe, 0xff57, 0xa77a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe579, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a4c, 0xa49a, 0x1a4c, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x122b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x124b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec72, 0xd634, 0x22cc, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xa79a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a4c, 0xbcdc, 0x1a4c,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a4c, 0xac9a, 0x1a4c,
-  0x01ea, 0x01c9, 0x0021, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x0a0a, 0x122b, 0x0a0a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x124b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec72, 0xd634, 0x22cc, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xa79a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x0a0a, 0x1a4c, 0x1a4c,
-  0x1a4c, 0x09c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x122b, 0xa49a, 0xbcdc,
-  0xb4dc, 0x120b, 0x0020, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x122b, 0x2a8d,
-  0xac9b, 0x1a2b, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01e9, 0x01ea,
-  0x122b, 0x09c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x01ea, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x124b, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec72, 0xd634, 0x22cc, 0x124b,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xa79a, 0x8f39,
-  0x1aed, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f39,
-  0x7e56, 0x09e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x124c, 0xc51d, 0xdd7f,
-  0xcd1e, 0x120a, 0x0082, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd5f,
-  0xc51d, 0x1a0b, 0x0020, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x1a0b, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x1a0b, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x1a0b, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x1a0b, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x1a0b, 0x0020, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x120a, 0x00a2, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x01e9, 0x124b, 0xc51d, 0xdd7f,
-  0xc51d, 0x120a, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01e9, 0x122b, 0xc4fd, 0xdd5f,
-  0xc51d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a4b, 0x228c, 0xcd5d, 0xe59f,
-  0xcd5d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec51, 0xee95, 0xef9e, 0xf7bf,
-  0xe73d, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xb7fb, 0xb7fc,
-  0xdf9d, 0x1a4a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f18,
-  0x8eb8, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1124, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126c, 0x96bc, 0x128c, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126c, 0x863a, 0x126c, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x124b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec71, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x122b, 0x96bc, 0x128c, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x00c3, 0x122a, 0x863a, 0x126c, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x124b, 0x0a0a, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec71, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0x967b, 0x128c, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1125, 0x85f9, 0x126c, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x120a, 0x0a0a, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x09c9, 0x1a2b, 0x01ea, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x19e9, 0xc3d0, 0x2a6b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x11e9, 0xec32, 0xec71, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x2a4c, 0xed5a, 0xfcf4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xc475, 0xe539, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1905, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x463c, 0x1145, 0x965a, 0x128c, 0x01e9, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1945, 0xceba, 0x2aad, 0x01e9, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe6db, 0xdc72, 0x2a4b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe6db, 0xfcd4, 0xec51, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xeefc, 0xfdfb, 0xfcd4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xd4d7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a4b, 0xd654, 0xd654, 0x1a6b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x1a6b, 0x1a6b, 0x0a0a,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1a09, 0x1a4a, 0x09c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1060, 0xdcec, 0xdd2d, 0x1a09, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1040, 0xdcaa, 0xdceb, 0x11c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x18e3, 0x18e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01e9, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a4b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x1a6b, 0x32ec, 0xde74,
-  0x1a8b, 0x01a9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x124b, 0xc5f3, 0xd654, 0xd654,
-  0x1a6b, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x1a6b, 0x1a6b, 0x1a4b,
-  0x0a0a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x0020, 0x0020, 0x1a09, 0x1a4a, 0x09c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1060, 0xdcec, 0xdd2d, 0x1a09, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1040, 0xdcaa, 0xdceb, 0x11c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x18e3, 0x18e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01e9, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a4b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x01ea,
-  0x1a6b, 0x09c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x1a6b, 0x32cc,
-  0xc613, 0x1a4a, 0x0020, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x124b, 0xc5f3, 0xde74,
-  0xd654, 0x1a2a, 0x0000, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x1a6b, 0x1a6b,
-  0x1a4b, 0x09e9, 0x0020, 0x0020, 0x1a09, 0x1a4a, 0x09c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x0000, 0x1060, 0xdcec, 0xdd2d, 0x1a09, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1040, 0xdcaa, 0xdceb, 0x11c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x18e3, 0x18e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01e9, 0x01ea, 0x01e9, 0x01e9,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a4b, 0x1a4b, 0x1a4b, 0x1a2c,
-  0x124b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe655, 0xc57c, 0xc55d,
-  0xbcdc, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xafbd,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xeeb5, 0xff36,
-  0xeeb5, 0x1a2a, 0x0082, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a2a, 0x0020, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a4a, 0x0000, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a4a, 0x0000, 0x0020, 0x1a09, 0x1a4a, 0x09c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a4a, 0x0000, 0x1060, 0xdcec, 0xdd2d, 0x1a09, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a4a, 0x0000, 0x1040, 0xdcaa, 0xdceb, 0x11c8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a2a, 0x0020, 0x0082, 0x18e3, 0x18e3, 0x08a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeeb5, 0x1a2a, 0x0082, 0x45da, 0x467d, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x1a6b, 0xe6b5, 0xff36,
-  0xeed6, 0x1a2a, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01c9, 0x124b, 0xe6b5, 0xff57,
-  0xef5c, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a2b, 0x2acc, 0xe71d, 0xff9f,
-  0xe73d, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe675, 0xd5de, 0xd5bf,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xaf9c,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a2a, 0xd50c, 0xd50c, 0x1a4a,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a,
-  0x020a, 0x01c9, 0x0021, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x020a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01e9, 0x01ea, 0x124a, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a4b, 0x2aab, 0xd635, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe675, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xd50c, 0xd50c, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x122a, 0x020a, 0x01ea, 0x020a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x22ac, 0x01e9, 0x01ea, 0x124a, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xd452, 0x2a4b, 0x2aab, 0xd635, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcb4, 0xec51, 0xe675, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xff16, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0882, 0x1125, 0x08c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x08a2, 0x967b, 0x128c, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x0882, 0x85d8, 0x124b, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01a9, 0x1a4a, 0xed4d, 0xed4d, 0x1a4a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01a8, 0x1a4a, 0xed4c, 0xed4c, 0x1a4a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x0a0a, 0x1a4a, 0xed6e, 0xed6e, 0x1a2a, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3b0e, 0xef5c, 0xef5c, 0x2acc, 0x2acb,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa67b, 0xe4d4, 0xff5d, 0xffbe, 0xe696, 0xee96,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfcb3, 0xfed7, 0xddde, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126c, 0x863a, 0x126c, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x126b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126c, 0x863a, 0x126c,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x126b, 0x0a0a,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x126c, 0x96bc,
-  0x128c, 0x01a8, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x126c, 0x863a,
-  0x126c, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x0a0a, 0x124b,
-  0x0a0a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x126c,
-  0x969c, 0x124b, 0x0082, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01e9, 0x126c,
-  0x96bc, 0x124b, 0x0020, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x126c,
-  0x863a, 0x124b, 0x0000, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x0a0a,
-  0x124b, 0x09e9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x128c, 0x965a, 0x1125, 0x3dba, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a3, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x128c, 0x967b, 0x10a2, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x126c, 0x8619, 0x0882, 0x0000, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x0a0a, 0x122a, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x01ea, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x09c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xc613, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xeeb6,
-  0xe696, 0x1a2a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xcd3d, 0x120a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9d,
-  0xc59d, 0x1a0a, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9f38,
-  0x8e98, 0x11e9, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1144, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x128c, 0x965a, 0x1125, 0x3dba, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a3, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a2, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a2, 0x0000, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a2, 0x0000, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x08a2, 0x0821, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x126c, 0x967b, 0x10a3, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01e9,
-  0x126c, 0x965a, 0x1125, 0x3dda, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01e9,
-  0x22cd, 0x965a, 0x1125, 0x465c, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2aab,
-  0xd695, 0xaedb, 0x1125, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xe696,
-  0xff18, 0xe71b, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xd5be,
-  0xe5bf, 0xe6fc, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xa79c,
-  0xd61f, 0xe71c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9718,
-  0x9f1a, 0xce79, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x01a8, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xce13, 0x228b, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xee96,
-  0xf717, 0x9e7a, 0x1104, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xddbf, 0xa6bc, 0x1125, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9c,
-  0xce1f, 0xa6bc, 0x1125, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9718,
-  0x971a, 0x9639, 0x1104, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x1125, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a2a, 0x1a2a, 0x01e9, 0x01ea,
-  0x124b, 0x01a8, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x3b2e, 0xd52e, 0xdd4e, 0x2aac, 0x2acc,
-  0xce14, 0x2a8b, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe71c, 0xef9e, 0xffbe, 0xffbe, 0xef7d, 0xef7d,
-  0xffde, 0xd6db, 0x1924, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef3c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xef3c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef3c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0xd679, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c,
-  0xe73c, 0xd679, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1945, 0x1945, 0x1945, 0x1945,
-  0x1945, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a4a, 0x1a4a, 0x01ea, 0x01ea,
-  0x1a4b, 0x01a8, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x85f9, 0x3aed, 0xdd0c, 0xdd0c, 0x2a8b, 0x2acc,
-  0xce13, 0x228b, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xec92, 0xfd4d, 0xfdce, 0xee75, 0xee96,
-  0xf717, 0x9e7a, 0x1104, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1145, 0xa69b, 0xfcd4, 0xfc91, 0xfeb5, 0xdddd, 0xddbe,
-  0xddbf, 0xa6bc, 0x1125, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1125, 0xae9c, 0xfddb, 0xfcd4, 0xfef6, 0xb7bb, 0xaf9c,
-  0xce1f, 0xa6bc, 0x1125, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x10e4, 0xccd7, 0xe55a, 0xe538, 0xe654, 0xde94, 0x9718,
-  0x971a, 0x9639, 0x1104, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1904, 0x1905, 0x1905, 0x1924, 0x1924, 0x1145,
-  0x1145, 0x1125, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x120a, 0x020a, 0x1a2a, 0x1a2a, 0x01e9, 0x01ea,
-  0x124b, 0x01a8, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1125, 0x8df9, 0x3b2e, 0xd52e, 0xdd4e, 0x2aac, 0x2acc,
-  0xce14, 0x2a8b, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe71c, 0xef9e, 0xffbe, 0xffbe, 0xef7d, 0xef7d,
-  0xffde, 0xd6db, 0x1924, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xe71c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef3c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1945, 0xef3c, 0xffff, 0xffff, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xef3c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0xd679, 0xe73c, 0xe71c, 0xe71c, 0xe71c, 0xe71c,
-  0xe73c, 0xd679, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1945, 0x1945, 0x1945, 0x1945,
-  0x1945, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x122a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x7556, 0x226b, 0xc46b, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x08e4, 0x1904, 0x1904, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x465c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x08c3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x01a9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x01c9, 0x1a4b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x2a6c, 0xcd19, 0x2a6c, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0841, 0xc496, 0xe55a, 0xc496, 0x1061,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1904, 0x1904, 0x08a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x122a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x7556, 0x226b, 0xc46b, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x08e4, 0x1904, 0x1904, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x465c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x1a4b, 0xd539, 0xed9b, 0xd539, 0x1a4b,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c8, 0x0a0a, 0x1a4b, 0x1a4b, 0x1a4b, 0x0a0a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x122a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x7556, 0x226b, 0xc46b, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x08e4, 0x1904, 0x1904, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x465c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x00c3, 0x1a0a, 0xd539, 0x32ad, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x00c3, 0x1a0a, 0xed9b, 0xccf8, 0x122b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x00c3, 0x1a0a, 0xc4f8, 0x2a8d, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x08c3, 0x09c9, 0x122b, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x122a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x7556, 0x226b, 0xc46b, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x08e4, 0x1904, 0x1904, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x465c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4c, 0x1a4b, 0x0a0a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1104, 0xc4b6, 0xe59b, 0xc4f8, 0x124b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x00c3, 0x2a4b, 0xcd18, 0x2a8d, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x465c, 0x00c3, 0x01a8, 0x122b, 0x01ea, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c8, 0x01ea, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x020a, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x122a, 0x0a0a, 0x1a4a, 0x1a4a, 0x0a0a, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x7556, 0x226b, 0xc46b, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x08e4, 0x1904, 0x1904, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x465c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x1905, 0xe539, 0xfdfd, 0xed7b, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00c3, 0x00a3, 0x00c3, 0x00a2,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x0188, 0x122a, 0x01a8, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0020, 0x1aac, 0x86b8, 0x124a, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x8ef8, 0x8f39, 0x124a, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x0881, 0x7e36, 0x1aab, 0x0188, 0x0000,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1104, 0x00a3, 0x00a3, 0x0082,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xe539, 0xfddc, 0xed7a, 0x1a4b, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xe559, 0xfe1d, 0xedbb, 0x1a4b, 0x01ea, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1925, 0xe71c, 0xffdf, 0xef3c, 0x2acc, 0x01ea, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9e39, 0xe71b, 0xe54e, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1925, 0x1903, 0x1903, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x7e97, 0x128b, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x0a0a, 0x126b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4c, 0x1a4b, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xedbb, 0xdd58, 0x2a8b, 0x01ea, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0e, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x979a, 0x8f19,
-  0x126b, 0x01a8, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x126b, 0x7e98, 0x22ed,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x0a0a, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4c, 0x1a4b, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xedbb, 0xdd58, 0x2a8b, 0x01ea, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0e, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x128b, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x124b, 0x7e97, 0x8f19, 0x1aed,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x01ea, 0x1acc, 0x8f19, 0x7eb8,
-  0x126b, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x01ea, 0x126b, 0x126b,
-  0x0a0a, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4c, 0x1a4b, 0x01ea, 0x01ea, 0x01ea,
-  0x01ea, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xedbb, 0xdd58, 0x2a8b, 0x01ea, 0x0a0a,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0e, 0xc48b, 0x11e9, 0x1209,
-  0xb551, 0x19e8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x08c3, 0x08c3,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x465c, 0x465c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x977a, 0xa7fc, 0x977a,
-  0x128b, 0x01a8, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a9, 0x0021, 0x0082, 0x00a3, 0x00a3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01c9, 0x0020, 0x0000, 0x11c9, 0x1a0b, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0xacbb, 0x120a, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01c9, 0x0000, 0x1062, 0xbcbb, 0x2aae, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01c9, 0x0000, 0x1042, 0xa438, 0x120a, 0x0187, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a9, 0x0021, 0x0082, 0x10e4, 0x08c3, 0x00a3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a8, 0x00a3, 0x45da, 0x467c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a8, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x126b, 0x975a, 0xa7fc, 0x977a,
-  0x126b, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x22ad, 0x9f7a, 0xaffc, 0x977a,
-  0x126b, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xedba, 0xf79d, 0xf7ff, 0xa79b,
-  0x2aec, 0x01a9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xe54e, 0xe6fb, 0xe71b,
-  0xc5d3, 0x11c8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1925, 0x1945,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x01ea, 0x1a4c, 0xa49a, 0x1a4c, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x0a0a, 0x122b, 0x0a0a, 0x01ea,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x128b, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x8f19, 0x22ed,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x96f8, 0x8eb7,
-  0xbdd2, 0x11c8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a4c, 0xbcdc, 0x1a4c,
-  0x01ea, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x01ea, 0x1a4c, 0xac9a, 0x1a4c,
-  0x01ea, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x0a0a, 0x122b, 0x0a0a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x01ea, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x128b, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x8f19, 0x22ed,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x96f8, 0x8eb7,
-  0xbdd2, 0x11c8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x124c, 0xcd1d,
-  0xbcfc, 0x120a, 0x00a2, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x1a4c, 0xbcdc,
-  0x2a8e, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x1a4c, 0xac9a,
-  0x124c, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x0a0a, 0x122b,
-  0x0a0a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01ea,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x128b, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x8f19, 0x22ed,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x96f8, 0x8eb7,
-  0xbdd2, 0x11c8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x0a0a, 0x1a4c,
-  0x1a4c, 0x120b, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x122b, 0xac9a,
-  0xbcfc, 0xbcbb, 0x1062, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x0a0a, 0x122b,
-  0x2a8d, 0xac7a, 0x1042, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x01e9,
-  0x01ea, 0x120a, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01ea,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x128b, 0x126b, 0x01ea,
-  0x01ea, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x8f19, 0x22ed,
-  0x1a6b, 0x09c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x96f8, 0x8eb7,
-  0xbdd2, 0x11c8, 0x0082, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x08c3, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x465c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01ea, 0x124c, 0xc51d,
-  0xdd7f, 0xc4dc, 0x10e4, 0x3dba, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4dc, 0x1062, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4fc, 0x1062, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4fc, 0x0842, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4fc, 0x0842, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4fc, 0x0842, 0x0840, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4fc, 0x1062, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4dc, 0x10e4, 0x3dda, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4dc, 0x18e5, 0x465c, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x01e9, 0x124b, 0xc51d,
-  0xdd7f, 0xc4dc, 0x18e5, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01c9, 0x122b, 0xc4fd,
-  0xdd5f, 0xc4dc, 0x18e5, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x126b, 0x22ad, 0xcd5d,
-  0xe59f, 0xcd1c, 0x18e5, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x9f9b, 0xefbe,
-  0xffdf, 0xe71c, 0x1925, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x9f18, 0x9f39,
-  0xe6b6, 0xd679, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01e9, 0x01e9, 0x01e9, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a2a, 0x1a6c, 0x1a6b, 0x1a6b, 0x1a6b, 0x1a6b,
-  0x1a6c, 0x1a2a, 0x08a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1925, 0xd6db, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e,
-  0xef9e, 0xdedb, 0x1924, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1924, 0xd699, 0xef5c, 0xef3c, 0xef3c, 0xef3c, 0xef3c,
-  0xef5c, 0xd69a, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1945, 0x1945, 0x1945, 0x1945,
-  0x1945, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x126b, 0x126b, 0x1a4c,
-  0x1a4c, 0x120a, 0x08a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x9f5a, 0xc59d,
-  0xd55d, 0xbcbb, 0x10e4, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x9f18, 0x9ef9,
-  0xde56, 0xbc79, 0x10c4, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x1105, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01e9, 0x01e9, 0x01e9, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a2a, 0x1a6c, 0x1a6b, 0x1a6b, 0x1a6b, 0x1a6b,
-  0x1a6c, 0x1a2a, 0x08a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1925, 0xd6db, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e,
-  0xef9e, 0xdedb, 0x1924, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1924, 0xd699, 0xef5c, 0xef3c, 0xef3c, 0xef3c, 0xef3c,
-  0xef5c, 0xd69a, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1945, 0x1945, 0x1945, 0x1945,
-  0x1945, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01ea, 0x01ea, 0x01ea, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a0a, 0x1a4b, 0x1a4b, 0x126b, 0x126b, 0x1a4c,
-  0x1a4c, 0x120a, 0x08a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1905, 0xd538, 0xed9b, 0xe5b9, 0xa739, 0x9f5a, 0xc59d,
-  0xd55d, 0xbcbb, 0x10e4, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1104, 0x9df9, 0xe579, 0xed0d, 0xdd6d, 0x9f18, 0x9ef9,
-  0xde56, 0xbc79, 0x10c4, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1125, 0x1905, 0x1903, 0x1903, 0x1125, 0x1145,
-  0x1924, 0x1105, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x4e5c, 0x465c, 0x465c, 0x465c,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x00a3, 0x00c3, 0x00c3, 0x00a2,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0020, 0x0000, 0x11e9, 0x09c9, 0x0188, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xc5d2, 0x1a6b, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1081, 0xde54, 0x32ec, 0x01c9, 0x0020,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0000, 0x1061, 0xd5f2, 0xc5d2, 0x11e9, 0x0000,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x0021, 0x0082, 0x1904, 0x1924, 0x08c3, 0x0082,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x45da, 0x465c, 0x465c, 0x465c, 0x467d,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x467d, 0x4f1f, 0x4eff, 0x4eff, 0x4f1f,
-  0x465c, 0x08c3, 0x01c9, 0x020a, 0x020a, 0x020a, 0x020a, 0x020a,
-  0x020a, 0x01c9, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x01a8, 0x01ea, 0x01e9, 0x01e9, 0x01e9, 0x01e9,
-  0x01ea, 0x01a8, 0x00a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x08c3, 0x1a2a, 0x1a6c, 0x1a6b, 0x1a6b, 0x1a6b, 0x1a6b,
-  0x1a6c, 0x1a2a, 0x08a3, 0x465c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1925, 0xd6db, 0xef9e, 0xef9e, 0xef9e, 0xef9e, 0xef9e,
-  0xef9e, 0xdedb, 0x1924, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x463c, 0x1924, 0xd699, 0xef5c, 0xef3c, 0xef3c, 0xef3c, 0xef3c,
-  0xef5c, 0xd69a, 0x1904, 0x463c, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x465c, 0x0945, 0x1925, 0x1945, 0x1945, 0x1945, 0x1945, 0x1945,
-  0x1945, 0x1925, 0x0925, 0x467d, 0x4eff, 0x4eff, 0x4eff, 0x4eff,
-  0x4edf, 0x465c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c, 0x463c,
-  0x463c, 0x463c, 0x465c, 0x4edf, 0x4eff, 0x4eff, 0x4eff, 0x4eff
-};
-
-const Animation tetrisAnimation = {
-  .name = "Tetris",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = tetrisDurations,
-  .animationFrames = tetrisFrames
-};
-#endif // ANIMATION_TETRIS_H
@@ -1,1558 +0,0 @@
-// uss_enterprise.h - Auto-generated from uss_enterprise.json
-#ifndef ANIMATION_USS_ENTERPRISE_H
-#define ANIMATION_USS_ENTERPRISE_H
-
-#include "animation_types.h"
-
-// Frame Durations for uss_enterprise (in 100ms units)
-static const uint8_t PROGMEM uss_enterpriseDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for uss_enterprise
-static const uint16_t PROGMEM uss_enterpriseFrames[] = {
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0218, 0x00ea, 0x0087, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02bf, 0x0150, 0x00c9,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0218, 0x00ea, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x02bf, 0x0150, 0x00c9, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x00ea,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x02bf, 0x0150, 0x00c9, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218, 0x00ea,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x00c9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x02bf, 0x0150,
-  0x0000, 0x0000, 0x02bf, 0x0150, 0x00c9, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x00ea, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0218,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x02bf, 0x0150, 0x00c9, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0218, 0x00ea, 0x0087, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0085, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x1082, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x94b2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0x1082, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x0087, 0x0000,
-  0x023a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0042, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00ca, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x025a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x5b0d, 0x18e4, 0x0021, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0xce38, 0x9cd3, 0x0861, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x5acb, 0x18c3, 0x0000, 0x0000, 0x0022, 0x0021, 0x0043, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0022, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0001, 0x0044, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c, 0x00a7,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218,
-  0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c,
-  0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x08e8, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0042, 0x01f7, 0x014f,
-  0x9492, 0x630c, 0x10a2, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0085, 0x0042, 0x0021,
-  0xef5d, 0xce59, 0x9cd2, 0x0883, 0x01f6, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x9471, 0x62eb, 0x10a2, 0x0042, 0x0043, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0020, 0x0001, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0043, 0x0217, 0x012e, 0x00a7, 0x0000,
-  0xad55, 0x9492, 0x62eb, 0x10a3, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00ca, 0x00a8, 0x0022, 0x0000, 0x0000,
-  0xf79e, 0xef5d, 0xce58, 0x9cd3, 0x08e8, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xa534, 0x9492, 0x5b0d, 0x10c3, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0861, 0x0862, 0x01b2, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0086, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0044, 0x0218, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x94b2, 0xa534, 0x9492, 0x62eb, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0192, 0x010c, 0x0087, 0x0001, 0x0000, 0x0000, 0x0000,
-  0xef7d, 0xf79e, 0xef5d, 0xce59, 0x9cd3, 0x0861, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x94b4, 0xa556, 0x9493, 0x5aec, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x08d4, 0x09f5, 0x092a, 0x00a6, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0051, 0x0023, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x023a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0022,
-  0x0239, 0x014f, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x632c, 0x9471, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0000, 0x0022,
-  0x01b4, 0x00eb, 0x0086, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0xce59, 0xef5d, 0xf79e, 0xef7d, 0xce59, 0x9cd3, 0x0861, 0x0000,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x738e, 0x9493, 0xa535, 0x9471, 0x5aeb, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x9493, 0x1913, 0x090a, 0x0883, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x7bf1, 0x08d3, 0x01f9, 0x012e, 0x0087, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x0001, 0x0022, 0x0021, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0022, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x010c, 0x00a7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0022,
-  0x010d, 0x00a8, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0022, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0042, 0x01f7, 0x0170,
-  0x00a8, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10a2, 0x5aeb, 0x9492, 0xad34, 0x9492, 0x62eb, 0x1107, 0x01b3,
-  0x00ea, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0xbdd7, 0xce38, 0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cd3, 0x0883,
-  0x0001, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0xef7d, 0x7bef, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0001, 0x0022,
-  0xf79d, 0x9cd4, 0x18f2, 0x0863, 0x0840, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0xa534, 0x8411, 0x0890, 0x0001, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0861, 0x0841, 0x0001, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0085, 0x0043, 0x0021, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a8,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0021, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0883, 0x0a78, 0x098f, 0x00c8, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad77, 0x94b3, 0x630d, 0x116a,
-  0x0085, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0xad55, 0xce59, 0xef5d, 0xf79e, 0xef5d, 0xce59, 0x9cd4,
-  0x0861, 0x0021, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0xef7d, 0xef7d, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0021, 0x0000,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb,
-  0xad55, 0xa534, 0x8454, 0x08b2, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0218, 0x0150,
-  0x0861, 0x0883, 0x0a58, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00c9, 0x0085, 0x0043, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0042, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0043, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f6, 0x016f, 0x08e9, 0x0862, 0x0841, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x10c4, 0x630d, 0x9493, 0xad34, 0x9492, 0x62eb,
-  0x10a3, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x18e3, 0xad55, 0xce58, 0xef5d, 0xf7be, 0xef7d, 0xce59,
-  0x9cf4, 0x096d, 0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2124, 0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb,
-  0x10a2, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0xe73c, 0xffde, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0086,
-  0xad98, 0xad76, 0xa555, 0x8411, 0x0890, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0021,
-  0x0a9a, 0x0990, 0x0909, 0x0862, 0x0001, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0043,
-  0x0217, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0192, 0x010c, 0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0044, 0x0218, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0023, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x12db, 0x014e, 0x00a7, 0x0000, 0x0020, 0x0841, 0x0861, 0x0841,
-  0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbe3a, 0x10c4, 0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9492,
-  0x62eb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0x0000, 0x18e3, 0xad55, 0xce59, 0xef5d, 0xf7be, 0xef7d,
-  0xce59, 0x9cd3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xbdb6, 0x31a6, 0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492,
-  0x5aeb, 0x10a2, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0xf7be, 0xe73c, 0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841,
-  0x0020, 0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000,
-  0xad55, 0xad55, 0xad55, 0xa534, 0x8411, 0x0890, 0x0001, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00c9, 0x0022, 0x0043, 0x0021,
-  0x0908, 0x0862, 0x0861, 0x0861, 0x0841, 0x0023, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0192, 0x010c, 0x0087,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4,
-  0x00eb, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239,
-  0x014f, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x0022,
-  0x194a, 0x10a3, 0x0000, 0x0022, 0x0000, 0x0020, 0x0841, 0x0861,
-  0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f6, 0x014e,
-  0xdf1c, 0xc618, 0x10a3, 0x0171, 0x116b, 0x62ec, 0x9492, 0xad34,
-  0x9492, 0x62eb, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x632c, 0x2945, 0x0000, 0x1925, 0xad76, 0xce59, 0xef5d, 0xf7be,
-  0xef7d, 0xce59, 0x9cd3, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2965, 0xad55, 0x31a6, 0xd6ba, 0xf77d, 0x7bcf, 0x9473, 0xa534,
-  0x9471, 0x5aeb, 0x10a2, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0xe71c, 0xf79e, 0xe73c, 0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863,
-  0x0883, 0x0042, 0x0022, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0xad55, 0xad55, 0xad55, 0xad55, 0xa534, 0x8411, 0x0890, 0x0003,
-  0x01f6, 0x012e, 0x00a7, 0x0042, 0x0043, 0x0022, 0x0000, 0x0000,
-  0x0861, 0x0861, 0x0861, 0x0861, 0x0883, 0x0862, 0x0001, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0042, 0x0043, 0x0021, 0x0000,
-  0x10a2, 0x10a2, 0x0021, 0x0000, 0x0000, 0x0020, 0x0841, 0x0861,
-  0x0841, 0x0020, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0xdefb, 0xc63a, 0x1256, 0x00ca, 0x1108, 0x62ec, 0x9492, 0xad34,
-  0x9492, 0x62eb, 0x10a2, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x632c, 0x2987, 0x0219, 0x1a32, 0xad77, 0xce59, 0xef5d, 0xf7be,
-  0xef7d, 0xce59, 0x9cd2, 0x0861, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2965, 0xad55, 0x31e9, 0xdedc, 0xf79e, 0x7bcf, 0x9473, 0xa534,
-  0x9491, 0x5aeb, 0x10c4, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xe71c, 0xf79e, 0xe73c, 0xffde, 0xf79e, 0x9cd4, 0x18f2, 0x0884,
-  0x0862, 0x0042, 0x0171, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0xad55, 0xad55, 0xad55, 0xad34, 0xa534, 0x8411, 0x08b2, 0x00ed,
-  0x0087, 0x0000, 0x0064, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0861, 0x0861, 0x0861, 0x0883, 0x0862, 0x0862, 0x0001, 0x0001,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0044, 0x0193, 0x00ca, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00c9, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x18a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0841,
-  0x0861, 0x0883, 0x0237, 0x012e, 0x0087, 0x0000, 0x0000, 0x0000,
-  0xd6dd, 0xdefb, 0xc639, 0x10e7, 0x0000, 0x1082, 0x62eb, 0x9492,
-  0xad34, 0x9492, 0x632e, 0x10c4, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x1afb, 0x5b2f, 0x29eb, 0x0021, 0x18e3, 0xad55, 0xce59, 0xef5d,
-  0xf7be, 0xef5d, 0xce58, 0x9cd2, 0x0861, 0x0000, 0x0000, 0x0000,
-  0x10e5, 0x2945, 0xad55, 0x31a6, 0xdeba, 0xf79e, 0x7bcf, 0x9473,
-  0xa535, 0x94b4, 0x5b0c, 0x10c3, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd69a, 0xe71c, 0xf79e, 0xe73c, 0xffdf, 0xf79e, 0x9cd4, 0x18f2,
-  0x0884, 0x09d2, 0x010a, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0x9cf3, 0xad55, 0xad55, 0xad54, 0xa534, 0x8411, 0x0891,
-  0x0024, 0x0043, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x0883, 0x0882, 0x0862, 0x0861, 0x0841, 0x0043,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0023, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0239, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0022, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00a7, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x18a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000, 0x0020, 0x0883,
-  0x0a78, 0x098f, 0x00c8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xd6bb, 0xdefb, 0xc618, 0x1082, 0x0000, 0x1082, 0x62eb, 0x9492,
-  0xad77, 0x94b3, 0x630c, 0x10a2, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x196a, 0x5b0c, 0x2945, 0x0000, 0x18e3, 0xad55, 0xce59, 0xef5d,
-  0xf79d, 0xef5d, 0xce59, 0x9cd3, 0x0861, 0x0021, 0x01f7, 0x014f,
-  0x10a3, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e, 0x7bcf, 0x9493,
-  0xa556, 0x9493, 0x5aec, 0x10a2, 0x0000, 0x0000, 0x0022, 0x0021,
-  0xd69a, 0xe71c, 0xf7be, 0xe73c, 0xffdf, 0xf79e, 0x9cd4, 0x1914,
-  0x09f4, 0x092a, 0x00a6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x2104, 0x9cf3, 0xad55, 0xad55, 0xad55, 0xa534, 0x8454, 0x08b2,
-  0x0024, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0883, 0x0882, 0x0862, 0x0861, 0x0883, 0x0a58, 0x014f,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0171, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x010d, 0x00a7, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x0000, 0x0022, 0x01f7, 0x016f,
-  0x08e9, 0x0862, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000, 0x0022,
-  0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x1082, 0x0000, 0x10c4, 0x630d,
-  0x9493, 0xad34, 0x9492, 0x62eb, 0x10a3, 0x0021, 0x0022, 0x0192,
-  0x1082, 0x18c3, 0x630c, 0x2945, 0x0000, 0x18e3, 0xad55, 0xce58,
-  0xef5d, 0xf79e, 0xef7d, 0xce59, 0x9cf4, 0x096d, 0x0087, 0x0022,
-  0x10a2, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e, 0x7bcf,
-  0x9473, 0xa535, 0x9492, 0x5aeb, 0x10a2, 0x0021, 0x0000, 0x0000,
-  0xd6dd, 0xd6dc, 0xe71c, 0xf7be, 0xe73c, 0xffde, 0xf79e, 0x9cd4,
-  0x18f3, 0x08c8, 0x0861, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x12db, 0x2231, 0x9d14, 0xad55, 0xad97, 0xad76, 0xa555, 0x8411,
-  0x0890, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0044, 0x0022, 0x0862, 0x0883, 0x0a58, 0x0990, 0x0909, 0x0862,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x18c3, 0x10a2, 0x10e4, 0x0217, 0x012e, 0x0087, 0x0021,
-  0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000, 0x0022, 0x0001,
-  0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x10c4, 0x0001, 0x10a3, 0x62eb,
-  0x9492, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0021, 0x0191, 0x00ca,
-  0x1082, 0x18c3, 0x630c, 0x2945, 0x0000, 0x18e3, 0xad55, 0xce59,
-  0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cd3, 0x0861, 0x0021, 0x0001,
-  0x10a2, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e, 0x7bcf,
-  0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0xd6bb, 0xd6ba, 0xe71c, 0xf79e, 0xe73c, 0xffdf, 0xf79e, 0x9cd4,
-  0x18f2, 0x0863, 0x0841, 0x0020, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x1129, 0x2125, 0x9d36, 0xad76, 0xad76, 0xad55, 0xa534, 0x8411,
-  0x0890, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x0001, 0x0022, 0x0a58, 0x0990, 0x0909, 0x0862, 0x0861, 0x0841,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0043,
-  0x00a8, 0x0086, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0085, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x18e5, 0x12ba, 0x11f1, 0x00a7, 0x0000, 0x0000, 0x0020,
-  0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0022, 0x0001, 0x0000,
-  0xd69a, 0xd6ba, 0xdf1e, 0xc639, 0x1083, 0x0000, 0x1082, 0x62eb,
-  0x9492, 0xad34, 0x9492, 0x62eb, 0x10c4, 0x0192, 0x00c9, 0x0086,
-  0x1082, 0x18c3, 0x62eb, 0x2945, 0x0000, 0x18e3, 0xad55, 0xce59,
-  0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cd3, 0x0883, 0x0001, 0x0000,
-  0x10a2, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e, 0x7bcf,
-  0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0xd699, 0xd69a, 0xe71c, 0xf7be, 0xe73c, 0xffdf, 0xf79e, 0x9cd4,
-  0x18f2, 0x0863, 0x0841, 0x0020, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x10e5, 0x2125, 0x9d14, 0xad55, 0xad55, 0xad55, 0xa534, 0x8411,
-  0x0890, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x0087, 0x0000,
-  0x0219, 0x012e, 0x0909, 0x0862, 0x0861, 0x0861, 0x0861, 0x0841,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0042, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00ca, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x1adc, 0x19f1, 0x194a, 0x10a3, 0x0000, 0x0000, 0x0000, 0x0020,
-  0x0841, 0x0861, 0x0841, 0x0020, 0x0021, 0x0001, 0x0000, 0x0000,
-  0xd6dd, 0xd6dc, 0xdefc, 0xc618, 0x1082, 0x0000, 0x1082, 0x62eb,
-  0x9492, 0xad34, 0x9491, 0x630d, 0x1a34, 0x00c9, 0x0065, 0x0000,
-  0x1082, 0x18c3, 0x62eb, 0x2945, 0x0000, 0x18e3, 0xad55, 0xce59,
-  0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cf5, 0x0882, 0x0000, 0x0000,
-  0x10a2, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e, 0x7bcf,
-  0x9473, 0xa534, 0x9471, 0x5aeb, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0xd69a, 0xd6ba, 0xe71c, 0xf7be, 0xe73c, 0xffdf, 0xf79e, 0x9cd4,
-  0x18f2, 0x0863, 0x0883, 0x0042, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x10c3, 0x2104, 0x9cf3, 0xad55, 0xad55, 0xad55, 0xa534, 0x8411,
-  0x0890, 0x0003, 0x01f6, 0x012e, 0x00a7, 0x0000, 0x0022, 0x0021,
-  0x0086, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861, 0x0841,
-  0x0001, 0x0000, 0x0022, 0x0021, 0x0001, 0x0044, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c, 0x00a7,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218,
-  0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c,
-  0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x194a, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0022, 0x01f7, 0x014f,
-  0xd6bb, 0xd69a, 0xd6ba, 0xdefb, 0xc65a, 0x10a3, 0x0000, 0x1082,
-  0x62eb, 0x9492, 0xad34, 0x9492, 0x630c, 0x1128, 0x0043, 0x0021,
-  0x10a2, 0x1082, 0x18c3, 0x632e, 0x2b5c, 0x012e, 0x218b, 0xad75,
-  0xce58, 0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cd3, 0x0861, 0x0000,
-  0x0000, 0x1082, 0x10a2, 0x2965, 0xad97, 0x39c8, 0xdedb, 0xf79e,
-  0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000, 0x0000,
-  0x1082, 0xbdf7, 0xd6ba, 0xe71c, 0xf79e, 0xe73c, 0xffdf, 0xf79e,
-  0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55, 0xad55, 0xa534,
-  0x8411, 0x08b1, 0x0068, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0841, 0x0001, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0841, 0x0861, 0x0883, 0x0237, 0x012e, 0x00a7, 0x0000,
-  0xd69a, 0xd69a, 0xd6dd, 0xdefc, 0xc618, 0x1082, 0x0000, 0x1082,
-  0x62eb, 0x9492, 0xad34, 0x9492, 0x632e, 0x10c4, 0x0021, 0x0000,
-  0x10a2, 0x10c4, 0x1ab9, 0x634f, 0x29eb, 0x0000, 0x18e3, 0xad55,
-  0xce59, 0xef5d, 0xf7be, 0xef5d, 0xce58, 0x9cd2, 0x0861, 0x0000,
-  0x0000, 0x1082, 0x10e5, 0x2965, 0xad55, 0x31a6, 0xdeba, 0xf79e,
-  0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000, 0x0000,
-  0x1082, 0xbdf7, 0xd6ba, 0xe71c, 0xf79e, 0xe73c, 0xffdf, 0xf79e,
-  0x9cd4, 0x18f2, 0x0842, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55, 0xad55, 0xa534,
-  0x8411, 0x0891, 0x0023, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0861,
-  0x0841, 0x0043, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0086, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18a2, 0x18a2, 0x18a2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x0883, 0x0a78, 0x098f, 0x00c8, 0x0000, 0x0000, 0x0000,
-  0xd6dd, 0xd6bc, 0xd6bb, 0xdefb, 0xc618, 0x1082, 0x0000, 0x1082,
-  0x62eb, 0x9492, 0xad77, 0x94b3, 0x630c, 0x10a2, 0x0000, 0x0000,
-  0x12dc, 0x11d0, 0x198b, 0x630c, 0x2945, 0x0000, 0x18e3, 0xad55,
-  0xce59, 0xef5d, 0xf79e, 0xef5d, 0xce59, 0x9cd3, 0x0861, 0x0000,
-  0x0022, 0x10a3, 0x10c3, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e,
-  0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0000, 0x0000,
-  0x1081, 0xbdf7, 0xd6ba, 0xe71c, 0xf7be, 0xe73c, 0xffdf, 0xf79e,
-  0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55, 0xad55, 0xa534,
-  0x8454, 0x08b2, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861, 0x0861, 0x0883,
-  0x0a58, 0x0150, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x023a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18a2, 0x18c3, 0x18c2, 0x10a2, 0x10a2, 0x0000, 0x0000, 0x0022,
-  0x0237, 0x098f, 0x0909, 0x0862, 0x0020, 0x0000, 0x0000, 0x0000,
-  0xd6bb, 0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x1082, 0x0000, 0x10a2,
-  0x632e, 0x94b3, 0xad55, 0x9492, 0x62eb, 0x10c3, 0x0042, 0x0021,
-  0x1149, 0x10a3, 0x18c3, 0x630c, 0x2945, 0x0000, 0x18e3, 0xad55,
-  0xce38, 0xef5d, 0xf79e, 0xef7d, 0xce58, 0x9cf5, 0x0a58, 0x012e,
-  0x0022, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdedb, 0xf79e,
-  0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a3, 0x0042, 0x0021,
-  0x1234, 0xbe3a, 0xd6fd, 0xe73c, 0xf7be, 0xe73c, 0xffde, 0xf79d,
-  0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x10c4, 0x22fa, 0x9d36, 0xad54, 0xad55, 0xad77, 0xa556,
-  0x8412, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0861, 0x0861, 0x0883, 0x0a58, 0x0990,
-  0x08e9, 0x0044, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x010c, 0x00a7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0022,
-  0x010d, 0x00a8, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0022, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x18c3, 0x18a2, 0x18a2, 0x10a2, 0x10e4, 0x0217, 0x0150,
-  0x00a8, 0x0021, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000,
-  0xd69a, 0xd69a, 0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x10e6, 0x0192,
-  0x116c, 0x630c, 0x9492, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0000,
-  0x10a2, 0x10a2, 0x1082, 0x18e3, 0x630c, 0x2945, 0x0000, 0x1905,
-  0xad76, 0xce59, 0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cb2, 0x0861,
-  0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xd6ba,
-  0xf77d, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10a2, 0x0022,
-  0x00eb, 0x1129, 0xc639, 0xd6ba, 0xe71c, 0xf79e, 0xe73c, 0xffdf,
-  0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0001, 0x0192,
-  0x023a, 0x014f, 0x112a, 0x2125, 0x9d36, 0xad76, 0xad76, 0xad55,
-  0xa534, 0x8411, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0022, 0x0021, 0x0000, 0x0022, 0x0a58, 0x0990, 0x0909, 0x0862,
-  0x0883, 0x0862, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0001,
-  0x0171, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0085, 0x0043, 0x0021, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a8,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0001, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18c3, 0x18a2, 0x18a2, 0x18e5, 0x12ba, 0x11f1, 0x00e9, 0x0021,
-  0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000,
-  0xd69a, 0xd69a, 0xd69a, 0xd6ba, 0xdf1d, 0xc65b, 0x1234, 0x00a9,
-  0x1108, 0x62ec, 0x9492, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0000,
-  0x10a2, 0x10a2, 0x1082, 0x18c3, 0x62eb, 0x2945, 0x0022, 0x1904,
-  0xad76, 0xce59, 0xef5d, 0xf7be, 0xef7d, 0xce59, 0x9cb2, 0x0861,
-  0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xdeba,
-  0xf77d, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x10c4, 0x0021,
-  0x0066, 0x1082, 0xc617, 0xd6ba, 0xe71c, 0xf7be, 0xe73c, 0xffdf,
-  0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0042, 0x01b4, 0x00eb,
-  0x00a7, 0x0021, 0x10e5, 0x2125, 0x9d14, 0xad55, 0xad55, 0xad34,
-  0xa534, 0x8411, 0x0890, 0x0001, 0x0000, 0x0022, 0x0218, 0x0150,
-  0x0000, 0x0022, 0x01f6, 0x012e, 0x0909, 0x0862, 0x0861, 0x0883,
-  0x0882, 0x0862, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0001, 0x0171,
-  0x00c9, 0x0065, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0042, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x18a2, 0x18e5, 0x1aba, 0x19f1, 0x194a, 0x10c3, 0x0021, 0x0000,
-  0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000,
-  0xd69a, 0xd6ba, 0xd6dc, 0xd6dc, 0xdefc, 0xc618, 0x112a, 0x0045,
-  0x10a2, 0x62eb, 0x9492, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0000,
-  0x10a2, 0x10a2, 0x1082, 0x18c3, 0x62eb, 0x2945, 0x0021, 0x1904,
-  0xad55, 0xce59, 0xef5d, 0xf7be, 0xef5d, 0xce58, 0x9cb2, 0x0861,
-  0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6, 0xd6ba,
-  0xf79d, 0x7bcf, 0x9473, 0xa534, 0x9471, 0x5b0d, 0x10c3, 0x0000,
-  0x0000, 0x1061, 0xc618, 0xd6ba, 0xe71c, 0xf7be, 0xe73c, 0xffdf,
-  0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x08a5, 0x01d4, 0x00ca, 0x0086,
-  0x0042, 0x0021, 0x10a3, 0x2104, 0x9cf3, 0xad55, 0xad54, 0xad54,
-  0xa534, 0x8411, 0x0890, 0x0003, 0x01f7, 0x0150, 0x00a8, 0x0021,
-  0x0239, 0x012e, 0x0087, 0x0000, 0x0841, 0x0861, 0x0883, 0x0882,
-  0x0861, 0x0841, 0x0001, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0001, 0x0171, 0x00c9,
-  0x00a8, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0043,
-  0x0217, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0192, 0x010c, 0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0044, 0x0218, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0023, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x1adc, 0x19f1, 0x196a, 0x18c3, 0x10a2, 0x10a2, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000, 0x0000,
-  0xd6dd, 0xd6bb, 0xd6bb, 0xd6ba, 0xdefb, 0xc619, 0x1129, 0x0001,
-  0x1082, 0x62eb, 0x9492, 0xad34, 0x9492, 0x62eb, 0x10a2, 0x0000,
-  0x10a2, 0x10a2, 0x1082, 0x18e3, 0x62eb, 0x2987, 0x01f7, 0x1a31,
-  0xad76, 0xce58, 0xef5d, 0xf7be, 0xef5d, 0xce59, 0x9cb2, 0x0861,
-  0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31e9, 0xdefc,
-  0xf79e, 0x7bcf, 0x9473, 0xa534, 0x94b3, 0x5b0c, 0x10a3, 0x0000,
-  0x0000, 0x1082, 0xc618, 0xd6ba, 0xe71c, 0xf7be, 0xe73c, 0xffde,
-  0xf79e, 0x9cd4, 0x18f2, 0x08a6, 0x09f3, 0x010a, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55, 0xad54,
-  0xa534, 0x8411, 0x08b2, 0x00ed, 0x00c9, 0x0021, 0x0043, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0861, 0x0883, 0x0862, 0x0862,
-  0x0861, 0x0841, 0x0001, 0x0001, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0171, 0x010c, 0x0087,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4,
-  0x00eb, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239,
-  0x014f, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0022,
-  0x00a7, 0x10a3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0883, 0x0217, 0x012e,
-  0x10a3, 0xbdf8, 0xd6ba, 0xd69a, 0xd6dd, 0xdefc, 0xc618, 0x1082,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9492, 0x5b2e, 0x18e4,
-  0x0000, 0x10a2, 0x10a2, 0x10c4, 0x1ab9, 0x634f, 0x29eb, 0x0000,
-  0x18e3, 0xad55, 0xce59, 0xef5d, 0xf79e, 0xef5d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10e5, 0x2965, 0xad55, 0x31a6,
-  0xdeba, 0xf79e, 0x7bcf, 0x9473, 0xa555, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1082, 0xc618, 0xd6ba, 0xe71c, 0xf79e, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x1913, 0x08ea, 0x08c6, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x0891, 0x0024, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0862, 0x0862, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x0043, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0066, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0043, 0x0021, 0x0000,
-  0x0000, 0x10a2, 0x18a2, 0x18a2, 0x18a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0883, 0x0a78, 0x098f, 0x00c8, 0x0000,
-  0x1082, 0xbe18, 0xd6fd, 0xd6bc, 0xd6bb, 0xdefb, 0xc618, 0x1082,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad77, 0x94b3, 0x5aec, 0x18c3,
-  0x0000, 0x10c4, 0x12ba, 0x11d0, 0x198b, 0x630c, 0x2945, 0x0000,
-  0x18e3, 0xad55, 0xce59, 0xef5d, 0xf79e, 0xef5d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0022, 0x10a3, 0x10c3, 0x2945, 0xad55, 0x31a6,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa535, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1061, 0xc618, 0xd6ba, 0xe71c, 0xf7be, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x08c8, 0x0861, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8454, 0x08b2, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0862, 0x0861, 0x0861,
-  0x0861, 0x0883, 0x0a58, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00c9, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10a2, 0x18c2, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0022, 0x0237, 0x098f, 0x0909, 0x0861, 0x0020, 0x0000,
-  0x10c5, 0xbe19, 0xd6bb, 0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x1082,
-  0x0000, 0x10a2, 0x632e, 0x94b3, 0xad55, 0x9492, 0x5aeb, 0x18c3,
-  0x0239, 0x11d0, 0x114a, 0x10a2, 0x18c3, 0x630c, 0x2945, 0x0000,
-  0x18e3, 0xad55, 0xce38, 0xef5d, 0xf79e, 0xef7d, 0xce38, 0xa534,
-  0x0022, 0x0001, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1081, 0xc618, 0xd6fd, 0xe73c, 0xf7be, 0xe73c,
-  0xffde, 0xf79d, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10c4, 0x22fa, 0x9d36, 0xad54, 0xad55,
-  0xad77, 0xa556, 0x8412, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0022, 0x0861, 0x0861, 0x0883,
-  0x0a58, 0x0990, 0x08e9, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0042, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0239, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0022, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00a7, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x0042,
-  0x01f7, 0x012e, 0x00c8, 0x0861, 0x0861, 0x0841, 0x0020, 0x0000,
-  0x1235, 0xbe39, 0xd6ba, 0xd69a, 0xd6ba, 0xdefb, 0xc618, 0x1082,
-  0x0022, 0x10a3, 0x630c, 0x9492, 0xad34, 0x9492, 0x5aeb, 0x18c3,
-  0x00c9, 0x10a3, 0x10a2, 0x1082, 0x18e3, 0x630c, 0x2945, 0x0000,
-  0x18e3, 0xad55, 0xce58, 0xef5d, 0xf7be, 0xef7d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x10a4, 0xc639, 0xd6db, 0xe71c, 0xf79e, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0021, 0x0217, 0x11d0, 0x21ab, 0x9d14, 0xad97, 0xad76,
-  0xad55, 0xa534, 0x8411, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0043, 0x0001, 0x0000, 0x0883, 0x0a58, 0x0990,
-  0x0909, 0x0862, 0x0841, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x010d, 0x00a7, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x10a2, 0x18c3, 0x18c3, 0x18c3, 0x10e5, 0x12ba, 0x014e,
-  0x00a7, 0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0021,
-  0x112a, 0xbe18, 0xd6ba, 0xd69a, 0xd6ba, 0xdefb, 0xc65a, 0x10a3,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9491, 0x5b0d, 0x1a55,
-  0x0021, 0x10a2, 0x10a2, 0x1082, 0x18e3, 0x630b, 0x2945, 0x0000,
-  0x18e3, 0xad55, 0xce59, 0xef5d, 0xf7be, 0xef7d, 0xce39, 0xad76,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0042, 0x0021, 0x1082, 0xc618, 0xd6ba, 0xe71c, 0xf79e, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0219, 0x012e, 0x00a7, 0x10a3, 0x2146, 0x9d15, 0xad76, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0064, 0x0022, 0x0021, 0x0001, 0x01f7, 0x098f, 0x0909, 0x0862,
-  0x0861, 0x0861, 0x0841, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x10a2, 0x18c3, 0x18e5, 0x1aba, 0x11f1, 0x114a, 0x0020,
-  0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000,
-  0x1107, 0xbe18, 0xd6ba, 0xd6ba, 0xd6dd, 0xdf1d, 0xc618, 0x1082,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9492, 0x5aec, 0x196b,
-  0x0020, 0x10a2, 0x10a2, 0x1082, 0x18c3, 0x62eb, 0x2945, 0x0000,
-  0x18e3, 0xad55, 0xce59, 0xef5d, 0xf7be, 0xef7d, 0xce38, 0xa555,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a6,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5acb, 0x18a2,
-  0x0000, 0x0000, 0x1061, 0xc618, 0xd6ba, 0xe71c, 0xf7be, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0063, 0x0001,
-  0x0087, 0x0000, 0x0042, 0x10c4, 0x2125, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x0890, 0x0000, 0x0021, 0x01f6, 0x012e,
-  0x0021, 0x0042, 0x01f7, 0x012e, 0x0087, 0x0862, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x0001, 0x0000, 0x0000, 0x0022, 0x0043,
-  0x00a8, 0x0086, 0x0042, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0085, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x10c4, 0x1aba, 0x19f1, 0x196a, 0x10c3, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000,
-  0x1082, 0xbe18, 0xd6dd, 0xd6bb, 0xd6bb, 0xdefb, 0xc618, 0x1082,
-  0x0022, 0x10a2, 0x62eb, 0x9492, 0xad34, 0x9492, 0x5aec, 0x1948,
-  0x0000, 0x10a2, 0x10a2, 0x1082, 0x18c3, 0x630c, 0x2945, 0x0022,
-  0x1ada, 0xad97, 0xce58, 0xef5d, 0xf7be, 0xef7d, 0xce38, 0xad55,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x2945, 0xad55, 0x31a7,
-  0xdefd, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9471, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1081, 0xc618, 0xd6ba, 0xe71c, 0xf7be, 0xe73c,
-  0xffde, 0xf79e, 0x9cd4, 0x18f2, 0x0885, 0x0862, 0x0021, 0x0000,
-  0x0022, 0x0021, 0x0021, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x08d3, 0x01f8, 0x012e, 0x0087, 0x0000,
-  0x023a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x0001, 0x0022, 0x0021, 0x0042, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00ca, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0239, 0x11f1, 0x196a, 0x18c3, 0x18c3, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0841, 0x0020, 0x0000,
-  0x10c4, 0xbe19, 0xd6bb, 0xd69a, 0xd6ba, 0xdefb, 0xc65a, 0x10a3,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9492, 0x5aeb, 0x18c3,
-  0x0000, 0x10a2, 0x10a2, 0x1082, 0x18c3, 0x632e, 0x2b5c, 0x012e,
-  0x218b, 0xad75, 0xce58, 0xef5d, 0xf7be, 0xef7d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10a2, 0x2965, 0xad97, 0x39c8,
-  0xdedb, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1082, 0xc618, 0xd6ba, 0xe71c, 0xf79e, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x08b1, 0x0068, 0x0000, 0x0022, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x0001, 0x0001, 0x0064, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c, 0x00a7,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218,
-  0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192, 0x010c,
-  0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x00a7, 0x10a3, 0x18c3, 0x18c3, 0x18a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0841, 0x0861, 0x0883, 0x0217, 0x012e,
-  0x10a3, 0xbdf8, 0xd6ba, 0xd69a, 0xd6dd, 0xdefc, 0xc618, 0x1082,
-  0x0000, 0x1082, 0x62eb, 0x9492, 0xad34, 0x9492, 0x5b2e, 0x18e4,
-  0x0000, 0x10a2, 0x10a2, 0x10c4, 0x1ab9, 0x634f, 0x29eb, 0x0000,
-  0x18e3, 0xad55, 0xce59, 0xef5d, 0xf7be, 0xef5d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0000, 0x1082, 0x10e5, 0x2965, 0xad55, 0x31a6,
-  0xdeba, 0xf79e, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0000, 0x1082, 0xc618, 0xd6ba, 0xe71c, 0xf79e, 0xe73c,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0842, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x10a2, 0x2104, 0x9cf3, 0xad55, 0xad55,
-  0xad55, 0xa534, 0x8411, 0x0891, 0x0023, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x0861, 0x0861,
-  0x0861, 0x0861, 0x0841, 0x0043, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x08a1, 0x10a2, 0x18a2, 0x18a2, 0x18a2, 0x10a2, 0x10a2, 0x0000,
-  0x0000, 0x0061, 0x0020, 0x0883, 0x0a78, 0x098f, 0x00c8, 0x0000,
-  0x4d6f, 0xc679, 0xd6dd, 0xd6bc, 0xd6bb, 0xdedb, 0xc618, 0x1061,
-  0x00c2, 0x4d0e, 0x636d, 0x9472, 0xad77, 0x94b3, 0x5aec, 0x18c3,
-  0x0881, 0x10e4, 0x12b9, 0x11d0, 0x198b, 0x636e, 0x2945, 0x08c3,
-  0x5595, 0xbe58, 0xce59, 0xef5d, 0xf79e, 0xef5d, 0xce38, 0xa534,
-  0x0000, 0x0000, 0x0044, 0x10a4, 0x18e4, 0x6477, 0xbe19, 0x6cf8,
-  0xe79e, 0xef7d, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0000, 0x0001, 0x4a33, 0xce3a, 0xdefc, 0xef7e, 0xf7be, 0xef9e,
-  0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0842, 0x18c4, 0x5ad3, 0xa515, 0xad55, 0xad54,
-  0xad55, 0xa534, 0x8454, 0x08b2, 0x0002, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0861, 0x0861, 0x0861,
-  0x0861, 0x0883, 0x0a58, 0x0172, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0044, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0001, 0x0042, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0086, 0x0042, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0881, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x10a2, 0x0881,
-  0x0081, 0x00a3, 0x0238, 0x098f, 0x0909, 0x0862, 0x0020, 0x0000,
-  0x4db1, 0xc6ba, 0xdf3c, 0xdf3c, 0xdf1c, 0xdefb, 0xcefb, 0x55f1,
-  0x45cf, 0x4d8f, 0x638f, 0x9493, 0xad55, 0x9492, 0x5aeb, 0x18c3,
-  0x0aba, 0x1a31, 0x55b7, 0x5e79, 0x5e39, 0x7431, 0x6659, 0x4e58,
-  0x6679, 0xb658, 0xce38, 0xef5c, 0xf79e, 0xef7d, 0xce38, 0xa534,
-  0x0022, 0x0043, 0x10e5, 0x54b8, 0x5d19, 0x64f9, 0xbe7a, 0x755a,
-  0xe79e, 0xef7d, 0x7bcf, 0x9473, 0xa534, 0x9492, 0x5aeb, 0x18a2,
-  0x0021, 0x39d3, 0x5a97, 0xd6bd, 0xe73e, 0xef7e, 0xf7be, 0xef7e,
-  0xffbe, 0xf79d, 0x9cd4, 0x18f2, 0x0863, 0x0841, 0x0020, 0x0000,
-  0x0000, 0x0843, 0x4a32, 0x5ab4, 0x62f4, 0xa514, 0xad55, 0xad55,
-  0xad77, 0xa556, 0x8412, 0x0890, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0021, 0x0021, 0x0861, 0x0861, 0x0883,
-  0x0a58, 0x09b0, 0x092b, 0x0023, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0023, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x023a, 0x012e, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x00a8, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00ca,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x10a2, 0x10a2, 0x10a2, 0x10c4,
-  0x12ba, 0x11d1, 0x0929, 0x0081, 0x0081, 0x0020, 0x0841, 0x0861,
-  0x45d0, 0x45d0, 0x45cf, 0x55f1, 0xcf1b, 0xdf3c, 0xdf3c, 0xdf3c,
-  0xdf1e, 0xcf1c, 0x5611, 0x45cf, 0x4d8f, 0x634c, 0x9471, 0xad55,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x5e79, 0x5e79, 0x5e5a, 0x5e19,
-  0x7431, 0x6638, 0x4e58, 0x6679, 0xb658, 0xce59, 0xef5d, 0xf7be,
-  0x4c79, 0x4c99, 0x4c79, 0x4c79, 0x4c79, 0x4c99, 0x5cf9, 0x5cf9,
-  0x64f9, 0xbe7a, 0x755a, 0xe79e, 0xef7d, 0x7bcf, 0x9473, 0xad35,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5af9, 0xd6bd, 0xe73e,
-  0xef7e, 0xf7be, 0xef7e, 0xffdf, 0xf79e, 0x9cd4, 0x18f2, 0x0863,
-  0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a54, 0x5ad6, 0x6316,
-  0xa535, 0xad54, 0xad54, 0xad54, 0xa534, 0x8411, 0x0890, 0x0001,
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0063, 0x0218, 0x0150,
-  0x0909, 0x08a4, 0x0882, 0x0862, 0x0861, 0x0841, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0022, 0x0171, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x010c, 0x00a7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0022,
-  0x010d, 0x00a8, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0022, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x00a3, 0x0278, 0x01af,
-  0x0128, 0x0081, 0x0081, 0x0081, 0x10a2, 0x10a2, 0x10a2, 0x10a2,
-  0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x4612, 0x45f1,
-  0x45f0, 0x45d0, 0x45cf, 0x55f1, 0xcf1b, 0xdf3c, 0xdf3c, 0xdf3c,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e38, 0x4e58,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x5e79, 0x5e79, 0x5e59, 0x5e5a,
-  0x4c79, 0x4c99, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79,
-  0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c99, 0x5cf9, 0x5d19,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5298, 0x5298, 0x5299, 0x5299,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5af9, 0xd6dd, 0xe73e,
-  0x4a33, 0x4a33, 0x4a33, 0x4a34, 0x4a76, 0x4a55, 0x4a54, 0x4a33,
-  0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x5ab4, 0x5ab4,
-  0x0021, 0x0021, 0x0021, 0x0063, 0x0238, 0x0170, 0x00c9, 0x0042,
-  0x0063, 0x0042, 0x0042, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0021,
-  0x0171, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0001, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0085, 0x0043, 0x0021, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0042, 0x01f7, 0x012e, 0x00a8,
-  0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000,
-  0x0000, 0x0001, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0081, 0x0081, 0x0081, 0x00a3, 0x0278, 0x01af, 0x0128, 0x0081,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
-  0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x4612, 0x45f1, 0x45f0, 0x45d0,
-  0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e38, 0x4e58, 0x4e58, 0x4e58,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58,
-  0x4c79, 0x4c99, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79,
-  0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c99,
-  0x5299, 0x5299, 0x5298, 0x5298, 0x5299, 0x5299, 0x5299, 0x5299,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299,
-  0x4a33, 0x4a54, 0x4a76, 0x4a55, 0x4a54, 0x4a34, 0x4a33, 0x4a33,
-  0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33,
-  0x0021, 0x0063, 0x0238, 0x0170, 0x00c9, 0x0042, 0x0021, 0x0063,
-  0x0042, 0x0042, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0171,
-  0x00c9, 0x0065, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0042, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0191, 0x00c9, 0x00a8, 0x0022, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0043, 0x0217, 0x012e, 0x00a7, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0001, 0x0023, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0081, 0x00a3, 0x0278, 0x01af, 0x0128, 0x0081, 0x0081, 0x0081,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
-  0x45d0, 0x45d0, 0x4612, 0x45f1, 0x45f0, 0x45d0, 0x45d0, 0x45d0,
-  0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0,
-  0x4e58, 0x4e58, 0x4e38, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58,
-  0x4c79, 0x4c99, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79,
-  0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c99,
-  0x5298, 0x5298, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299,
-  0x4a76, 0x4a55, 0x4a54, 0x4a34, 0x4a33, 0x4a33, 0x4a33, 0x4a33,
-  0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33,
-  0x025a, 0x0170, 0x00c9, 0x0042, 0x0021, 0x0021, 0x0063, 0x0042,
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0021,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0021, 0x0171, 0x00c9,
-  0x00a8, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0043,
-  0x0217, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0192, 0x010c, 0x0087, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0044, 0x0218, 0x014f, 0x00a7, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0192,
-  0x0023, 0x0002, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0001,
-  0x02ba, 0x01af, 0x0128, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x0081,
-  0x4612, 0x45f1, 0x45f0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0,
-  0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0, 0x45d0,
-  0x4e38, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58,
-  0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58, 0x4e58,
-  0x4c79, 0x4c99, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79,
-  0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c79, 0x4c99,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299,
-  0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5299, 0x5298, 0x5299,
-  0x4a54, 0x4a34, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33,
-  0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a33, 0x4a34, 0x4a76, 0x4a75,
-  0x00c8, 0x0042, 0x0021, 0x0021, 0x0021, 0x0043, 0x0042, 0x0022,
-  0x0021, 0x0021, 0x0021, 0x0021, 0x0021, 0x0063, 0x0238, 0x0170,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x010c, 0x0087,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0218, 0x014f,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01b4,
-  0x00eb, 0x0086, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0239,
-  0x014f, 0x00a8, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0044, 0x0022,
-  0x00e8, 0x0061, 0x0060, 0x0061, 0x0061, 0x0081, 0x0081, 0x0081,
-  0x0081, 0x0081, 0x0081, 0x0081, 0x0081, 0x00a3, 0x0278, 0x01d0,
-  0x23ea, 0x244b, 0x2c6b, 0x3ccd, 0x454e, 0x45af, 0x45af, 0x45af,
-  0x45af, 0x45af, 0x45af, 0x45af, 0x45af, 0x45af, 0x45f2, 0x45d1,
-  0x23cf, 0x2430, 0x2c92, 0x3534, 0x3d96, 0x3e17, 0x3e18, 0x3e18,
-  0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e18, 0x3e17, 0x3e17,
-  0x2aaf, 0x2af0, 0x3352, 0x3b93, 0x3bd5, 0x4417, 0x4437, 0x4437,
-  0x4437, 0x4437, 0x4437, 0x4437, 0x4437, 0x4437, 0x4437, 0x4437,
-  0x296c, 0x318e, 0x39d0, 0x4212, 0x4233, 0x4a54, 0x4a75, 0x4a75,
-  0x4a75, 0x4a75, 0x4a75, 0x4a75, 0x4a54, 0x4a54, 0x4a74, 0x4a75,
-  0x20e9, 0x292a, 0x294d, 0x39ae, 0x39cf, 0x41f1, 0x41f1, 0x41f1,
-  0x41f1, 0x41f1, 0x41f1, 0x41f1, 0x4234, 0x4213, 0x4212, 0x41f1,
-  0x0000, 0x0000, 0x0021, 0x0021, 0x0043, 0x0042, 0x0021, 0x0021,
-  0x0021, 0x0021, 0x0021, 0x0043, 0x0238, 0x016f, 0x00c8, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x01b4, 0x00eb, 0x0086, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0239, 0x014f, 0x00a8, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0021,
-  0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0086,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0023, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0040, 0x0040,
-  0x0040, 0x0060, 0x0060, 0x00a3, 0x0278, 0x01af, 0x0128, 0x0081,
-  0x0081, 0x08e2, 0x0943, 0x11a4, 0x1205, 0x1a66, 0x1b07, 0x2369,
-  0x23ca, 0x244b, 0x2c6b, 0x3ced, 0x4571, 0x45d1, 0x45d0, 0x45af,
-  0x0000, 0x0081, 0x08e3, 0x0985, 0x1207, 0x1269, 0x1aeb, 0x1b6d,
-  0x23cf, 0x2430, 0x2c92, 0x3534, 0x3d95, 0x3e17, 0x3e17, 0x3e38,
-  0x0000, 0x0062, 0x08c4, 0x1126, 0x1168, 0x19c9, 0x220c, 0x226d,
-  0x2aaf, 0x2af1, 0x3352, 0x3b93, 0x3bd5, 0x4417, 0x4437, 0x4437,
-  0x0000, 0x0000, 0x0000, 0x0843, 0x1085, 0x10a7, 0x18e9, 0x212b,
-  0x296c, 0x318e, 0x39d0, 0x4212, 0x4233, 0x4a54, 0x4a75, 0x4a75,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0843, 0x1085,
-  0x20e8, 0x292a, 0x298f, 0x39d0, 0x39f1, 0x41f1, 0x41f1, 0x41f1,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0043, 0x0218, 0x014f, 0x00c9, 0x0022, 0x0021, 0x0021,
-  0x0000, 0x0000, 0x0064, 0x01b3, 0x00ea, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x01f7, 0x0170, 0x00a8, 0x0001, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0043, 0x0192, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00c9, 0x0021, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
-  0x0020, 0x0062, 0x0237, 0x018f, 0x00e8, 0x0061, 0x0060, 0x0061,
-  0x0064, 0x01b3, 0x00ea, 0x0085, 0x0081, 0x08e2, 0x0943, 0x11a4,
-  0x1205, 0x1a86, 0x1b2a, 0x238a, 0x23ea, 0x244b, 0x2c6b, 0x3ccd,
-  0x0239, 0x0170, 0x00a8, 0x0021, 0x0000, 0x0081, 0x08e3, 0x0985,
-  0x1207, 0x1269, 0x1aeb, 0x1b6d, 0x23ce, 0x2430, 0x2c92, 0x3534,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0062, 0x08c4, 0x1126,
-  0x1168, 0x19c9, 0x220c, 0x226d, 0x2aaf, 0x2af1, 0x3352, 0x3b93,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0021, 0x0843,
-  0x1085, 0x10a6, 0x18e8, 0x212b, 0x296c, 0x318e, 0x39d0, 0x4212,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0001,
-  0x0043, 0x0043, 0x0864, 0x1085, 0x20e8, 0x292a, 0x294d, 0x39ae,
-  0x0000, 0x0000, 0x0021, 0x0021, 0x0043, 0x0021, 0x0000, 0x0022,
-  0x01f7, 0x012e, 0x00a7, 0x0001, 0x0000, 0x0000, 0x0021, 0x0021,
-  0x0042, 0x0043, 0x0192, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0239, 0x012e, 0x00c9, 0x0021, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9,
-  0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0022, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x01f6, 0x012e, 0x00a7, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0021, 0x0001, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0217, 0x014e, 0x00c7, 0x0020, 0x0020, 0x0020, 0x0040, 0x0040,
-  0x01b4, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x00a3, 0x0903, 0x0944, 0x11a4, 0x1205, 0x1a66, 0x1b08, 0x2368,
-  0x00c9, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0061, 0x08e3, 0x0985, 0x1207, 0x1269, 0x1aeb, 0x1b6d,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0083, 0x08c4, 0x1126, 0x1168, 0x19c9, 0x220c, 0x226d,
-  0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000, 0x0000, 0x0021,
-  0x0191, 0x00ca, 0x0086, 0x0863, 0x1085, 0x10a7, 0x18e9, 0x210a,
-  0x0000, 0x0021, 0x01f7, 0x012e, 0x00a7, 0x0000, 0x0022, 0x0021,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0000, 0x0021, 0x0843, 0x1085,
-  0x0000, 0x0022, 0x0043, 0x0022, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x0087, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0022, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x00a7, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x014f,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0021, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x010d, 0x00a7, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000, 0x0022, 0x0218,
-  0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000, 0x0000, 0x0022,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0021, 0x0001, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e,
-  0x00a7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020,
-  0x00a8, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x00a3, 0x08e2, 0x0943, 0x11a4,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f6, 0x00a4, 0x08e3, 0x0965,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0022, 0x0062, 0x08c4, 0x1106,
-  0x0042, 0x0021, 0x0000, 0x0000, 0x0000, 0x0000, 0x0021, 0x0191,
-  0x00c9, 0x0065, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0843,
-  0x0219, 0x012e, 0x00a7, 0x0000, 0x0022, 0x0021, 0x0001, 0x0022,
-  0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x0064, 0x0022, 0x0021, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x01b3, 0x00c9, 0x0065, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0022, 0x0001, 0x0000, 0x0000, 0x0021, 0x0000, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0022, 0x01f7, 0x012e, 0x00a7, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0021, 0x0191, 0x00c9, 0x0065, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0021, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0022, 0x0001, 0x0000, 0x0000,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
-};
-
-const Animation uss_enterpriseAnimation = {
-  .name = "Uss Enterprise",
-  .frameCount = 48,
-  .width = 16,
-  .height = 16,
-  .frameDurations = uss_enterpriseDurations,
-  .animationFrames = uss_enterpriseFrames
-};
-#endif // ANIMATION_USS_ENTERPRISE_H
@@ -1,470 +0,0 @@
-// waves.h - Auto-generated from waves.json
-#ifndef ANIMATION_WAVES_H
-#define ANIMATION_WAVES_H
-
-#include "animation_types.h"
-
-// Frame Durations for waves (in 100ms units)
-static const uint8_t PROGMEM wavesDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for waves
-static const uint16_t PROGMEM wavesFrames[] = {
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xffff, 0xffff, 0xffff,
-  0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xffff, 0xffff, 0xffff, 0x0c59, 0x0c59,
-  0x0c59, 0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0xffff, 0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0x0c59, 0x0c59, 0xc73f, 0x0c59, 0x0c59, 0x0c59, 0xffff,
-  0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0xc73f, 0xc73f, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0xa69d,
-  0xa69d, 0xffff, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0xa69d, 0xa69d, 0xffff,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0xc73f, 0x0c59, 0x0c59, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0x0c59, 0xc73f, 0x0c59, 0x0c59, 0xa69d, 0xa69d, 0xa69d,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0x0c59, 0x0c59, 0x0c59, 0xc73f, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d, 0xa69d,
-  0xc73f, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0x0c59, 0xc73f, 0x0c59, 0x0c59, 0xc73f, 0xc73f, 0x0c59, 0x0c59,
-  0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59, 0x0c59,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xaebd, 0x9e9c,
-  0xaebd, 0xaebd, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0xaebd, 0xaebd, 0xaedd, 0xefbf, 0xdf7e, 0xb6dd,
-  0xdf7e, 0xdf7e, 0xaebd, 0xa6bd, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebd, 0xaebd, 0xdf7e, 0xdf7e, 0xe77e, 0xd75e, 0x451a, 0xbefd,
-  0x2cd9, 0x2cd9, 0xd73e, 0xdf7e, 0xaebd, 0x9e9c, 0x9e7c, 0x9e9d,
-  0xe77e, 0xcf3e, 0x2cd9, 0x2cd9, 0x34d9, 0x2cd9, 0x0c58, 0x1c99,
-  0x0438, 0x0438, 0x1479, 0x2cd9, 0xdf7e, 0xa69d, 0x9e7c, 0x9e9d,
-  0x1c99, 0x2cb9, 0x1478, 0x965d, 0xa69e, 0x965d, 0x1479, 0x0438,
-  0x1c99, 0x1c99, 0x1c79, 0x2cd9, 0xe79e, 0xb6dd, 0x9e9c, 0x9e9d,
-  0x24b9, 0x8e3d, 0x24b9, 0x1c99, 0x1c99, 0x1c99, 0x1479, 0x24b9,
-  0xd73e, 0xe79e, 0xef9e, 0xe79e, 0xf7bf, 0xe79e, 0xa69d, 0xa69d,
-  0x9e5d, 0x34fa, 0x9e7d, 0x1479, 0x0438, 0x1478, 0x7dfb, 0x967c,
-  0xa69d, 0xb6bd, 0xef9e, 0xb6bd, 0xa69d, 0xa69d, 0xa69c, 0x965c,
-  0x1478, 0x1c99, 0x9e7d, 0x2cb9, 0x0c58, 0x0c58, 0x2499, 0x8e3c,
-  0xa69c, 0xa69c, 0xa69d, 0xa69c, 0x9e9c, 0xa69c, 0x8e3c, 0x24b9,
-  0x1c79, 0x0c58, 0x24b9, 0x8e3d, 0x1479, 0x0438, 0x0c58, 0x1c99,
-  0x8e3c, 0x965c, 0x965c, 0x965c, 0x965c, 0x8e3c, 0x1c99, 0x0c58,
-  0x9e7d, 0x24b9, 0x0c58, 0x1c99, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1478, 0x1478, 0x1478, 0x1478, 0x1478, 0x1478, 0x0c58, 0x0c58,
-  0x2cb9, 0x8e3d, 0x1479, 0x1478, 0x9e7d, 0x9e7d, 0x1479, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x1c99, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0xaebd, 0xaebd, 0x9e9c, 0xa69d, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0xaebd, 0xaebd,
-  0xa69d, 0xaebd, 0xdf7e, 0xdf5e, 0xb6dd, 0xef9e, 0xaebd, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0x9e9c, 0x9e7c, 0xdf5e, 0xe77e,
-  0xf7bf, 0xe77e, 0x2cd9, 0x3d1a, 0xd75e, 0xef9e, 0xdf5e, 0xa69d,
-  0x9e7c, 0xa69c, 0x9e9c, 0x965c, 0x8e3c, 0x1c99, 0x1478, 0x2cd9,
-  0xb6be, 0xaebe, 0x24b9, 0xaebd, 0x2cd9, 0x1c79, 0x3cf9, 0x9e7c,
-  0x9e7c, 0x965c, 0x8e3c, 0x1c99, 0x1478, 0x1c99, 0x1c79, 0x0c58,
-  0x1478, 0x1479, 0x2499, 0x34d9, 0x1c99, 0x2cd9, 0xcf1d, 0x9e7c,
-  0x863c, 0x34d9, 0x1478, 0x0c58, 0x24b9, 0x9e7d, 0x9e7d, 0x1479,
-  0x1c79, 0x2cd9, 0xd73e, 0xe77e, 0xe77e, 0xdf7e, 0x965c, 0x24b9,
-  0x34fa, 0x8e3d, 0x1479, 0x1479, 0x8e3d, 0x24b9, 0x1479, 0x2cd9,
-  0xc71d, 0xd73e, 0xa69c, 0x9e7c, 0x9e7c, 0x965c, 0x1c99, 0x0c58,
-  0x9e7d, 0x34fa, 0x0c58, 0x0c58, 0x2cb9, 0x1c79, 0x1479, 0x965d,
-  0x3d1a, 0x2cd9, 0x1478, 0x1478, 0x1478, 0x1478, 0x0c58, 0x0c58,
-  0x2cb9, 0x8e3d, 0x1479, 0x1479, 0x965d, 0x9e7d, 0x1479, 0x24b9,
-  0x9e7d, 0x9e7d, 0x1479, 0x0438, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x1c99, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xa69d, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xa69d, 0xa69c, 0xa69d, 0xa6bd,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e9c, 0xa69d, 0xa69d, 0xdf7e, 0xa69d, 0xaebd, 0xf7bf,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xaebd, 0xb6dd, 0xefbf, 0xefbf,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0x9e7c,
-  0x9e7c, 0xaebd, 0xaedd, 0xaebd, 0xdf5e, 0xe77e, 0xd75e, 0x2cd9,
-  0x9e7c, 0xa69c, 0xa69c, 0xa69c, 0xa69d, 0xa69d, 0x965c, 0xa69d,
-  0xaebd, 0xdf5e, 0xdf7e, 0xcf3e, 0x2cd9, 0x2cb9, 0x2cd9, 0x0c58,
-  0x9e9c, 0x965c, 0x965c, 0x965c, 0x9e7c, 0xc71d, 0x34f9, 0xcf3e,
-  0xd75e, 0x3d1a, 0x2cd9, 0x2cd9, 0x2cb9, 0xaebe, 0x9e7d, 0x1c79,
-  0x8e3c, 0x24b9, 0x1478, 0x1478, 0x1478, 0x1c98, 0x0c58, 0x2cb9,
-  0x2cb9, 0x965d, 0xa69e, 0xa69e, 0xaebe, 0xaebe, 0x24b9, 0x0c58,
-  0x1478, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1479, 0x1c99, 0x8e3d,
-  0x2cb9, 0x2cb9, 0x1c99, 0x1c99, 0x1c99, 0x1479, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x1479, 0x9e7d, 0x9e7d, 0x1479, 0x24b9,
-  0x9e7d, 0x9e7d, 0x1479, 0x0438, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e7d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e9c, 0xa69d, 0xa69c, 0xa69d, 0xa69d, 0xaebd,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xaebd, 0xdf7e, 0xb6dd, 0xdf7e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0xa69c, 0xaebd, 0x9e9c, 0xaebd, 0xdf7e, 0x34f9,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xaebd, 0xcf3e, 0x1c99,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e9c, 0xa69d, 0xa69d, 0xaebd, 0xdf7e, 0x2cd9, 0x1479,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xaebd, 0xcf3e, 0x2cd9, 0xa69e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xaebd, 0xaedd, 0xb6dd, 0xcf3e, 0x2cb9, 0x1479, 0xaebe,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d,
-  0xaebd, 0xdf5e, 0xdf7e, 0xcf3e, 0x2cd9, 0x1479, 0x1c99, 0x1c99,
-  0x9e7c, 0x9e7c, 0xa69c, 0xa69c, 0xa69c, 0xa69c, 0x9e9c, 0x9e7c,
-  0xcf3e, 0x3d1a, 0x2cd9, 0x2cd9, 0x2cb9, 0xaebe, 0x9e7d, 0x1479,
-  0xa69c, 0x9e9c, 0x965c, 0x965c, 0x965c, 0x965c, 0x8e3c, 0x2cd9,
-  0x24b9, 0x967d, 0xa69e, 0xa69e, 0xaebe, 0xaebe, 0x24b9, 0x0c58,
-  0x965c, 0x8e3c, 0x1c99, 0x1478, 0x24b9, 0x24b9, 0x24b9, 0x8e3d,
-  0x2cb9, 0x2cb9, 0x1c99, 0x1c99, 0x1c99, 0x1479, 0x0c58, 0x0c58,
-  0x1478, 0x1478, 0x0c58, 0x1478, 0x965d, 0x9e5d, 0x1479, 0x24b9,
-  0x9e7d, 0x9e7d, 0x1479, 0x0438, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0xa69d, 0xa6bd, 0xa69d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e9c, 0xa69d, 0xa69c, 0xa69d, 0xa69d, 0xa69d, 0xe79e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69d, 0xdf7e, 0xaebd, 0xdf7e, 0xa69d, 0x9e7c, 0xb6dd,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69c, 0xaebd, 0xa69c, 0xa69d, 0x9e9c, 0xaebd, 0xdf7e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xa69c, 0xaebd, 0xdf7e, 0x34f9,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e9c, 0xa69d, 0xa69d, 0xa69d, 0xdf7e, 0xb6dd, 0xcf3e, 0x1c99,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69d, 0xdf7e, 0xa69d, 0x9e7c, 0xaebd, 0xe77e, 0x2cd9, 0x1479,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69d, 0xa69d, 0x9e7c, 0xaebd, 0xcf3e, 0x2cd9, 0xa69e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xaebd, 0xef9e, 0xb6dd, 0xcf3e, 0x2cb9, 0x1479, 0xaebe,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d,
-  0xaebd, 0xdf5e, 0xe79e, 0xcf3e, 0x2cd9, 0x1479, 0x1c99, 0x1c99,
-  0x9e7c, 0x9e7c, 0xa69c, 0xa69c, 0xa69c, 0xa69c, 0x9e9c, 0x9e7c,
-  0xcf3e, 0x3d1a, 0x2cd9, 0x2cd9, 0x2cb9, 0xaebe, 0x9e7d, 0x1479,
-  0x9e7c, 0x9e9c, 0x965c, 0x965c, 0x965c, 0x965c, 0x8e3c, 0x2cd9,
-  0x24b9, 0x967d, 0xa69e, 0xa69e, 0xaebe, 0xaebe, 0x24b9, 0x0c58,
-  0xa69c, 0x8e3c, 0x1c99, 0x1478, 0x24b9, 0x24b9, 0x24b9, 0x8e3d,
-  0x2cb9, 0x2cb9, 0x1c99, 0x1c99, 0x1c99, 0x1479, 0x0c58, 0x0c58,
-  0x863c, 0x24b9, 0x0438, 0x1478, 0x965d, 0x9e5d, 0x1479, 0x24b9,
-  0x9e7d, 0x9e7d, 0x1479, 0x0438, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x1478, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7d, 0x9e9d, 0x9e7d, 0x9e7d, 0x9e9d, 0x9e9d, 0x9e7d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69d, 0x9e7c, 0xaebd, 0xaebd, 0x9e7c, 0x9e7c, 0xa69d, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d,
-  0xe77e, 0xb6dd, 0xdf5e, 0xdf7e, 0xaebd, 0xaebd, 0xdf7e, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c,
-  0xaebd, 0xe77e, 0x3d1a, 0x2cb9, 0xd73e, 0xdf7e, 0xb6dd, 0xaebd,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69d, 0xefbf, 0xd73e, 0x2cd9, 0x1c99, 0x2cd9, 0xcf3e, 0xe79e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69c, 0xaebd, 0xb6dd, 0xd73e, 0x1478, 0x0438, 0x2cb9, 0x1c99,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69d, 0xdf7e, 0xaebd, 0xdf7e, 0x2cd9, 0x1c79, 0x9e7d, 0x2cb9,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e9c, 0xa69d, 0x9e9c, 0xaebd, 0xcf1d, 0x2cd9, 0xa69e, 0xbeff,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0x9e7c, 0x1478, 0x24b9, 0xaebe,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0xa69c, 0xa69c, 0x965c, 0x863c, 0x1478, 0x0438, 0x1479,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c,
-  0x9e9c, 0x965c, 0x863c, 0x1c99, 0x1478, 0x1c99, 0x1c99, 0x0c58,
-  0x9e7c, 0xa69c, 0xa69c, 0xa69c, 0xa69c, 0xa69c, 0x9e9c, 0x965c,
-  0x8e3c, 0x34d9, 0x24b9, 0x1c99, 0x24b9, 0xaebe, 0x9e7d, 0x1c79,
-  0x9e9c, 0x965c, 0x965c, 0x965c, 0x965c, 0x965c, 0x8e3c, 0x2cd9,
-  0x1c99, 0x967d, 0xa69e, 0xa69e, 0xaebe, 0xaebe, 0x24b9, 0x0c58,
-  0x8e3c, 0x24b9, 0x1478, 0x1478, 0x24b9, 0x24b9, 0x24b9, 0x8e3d,
-  0x2cb9, 0x2cb9, 0x1c99, 0x1c99, 0x1c99, 0x1479, 0x0c58, 0x0c58,
-  0x1478, 0x0c58, 0x0438, 0x1478, 0x965d, 0x9e5d, 0x1479, 0x24b9,
-  0x9e7d, 0x9e7d, 0x1479, 0x0438, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58,
-  0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0xa69d, 0xa6bd, 0xa69d,
-  0x9e7d, 0x9e7d, 0xa69d, 0xa6bd, 0xa69d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d,
-  0xa69d, 0xa6bd, 0xa69d, 0xdf7e, 0xa69d, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xa69d, 0xaebd,
-  0xefbf, 0xdf7e, 0xaebd, 0xaedd, 0xaebd, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xefbf,
-  0xd75e, 0x3d1a, 0xcf3e, 0xdf7e, 0xdf5e, 0xaebd, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa6bd, 0xdf7e,
-  0x3d1a, 0x0438, 0x1c99, 0x2cd9, 0x2cd9, 0xcf3e, 0xaebd, 0x9e7d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xb6dd,
-  0xcf3e, 0x2cd9, 0x1478, 0x8e3d, 0x1479, 0x24b9, 0xcf3e, 0xb6dd,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e,
-  0xb6dd, 0xcf3e, 0x1c99, 0x1479, 0x0c58, 0x1479, 0x2cd9, 0xcf3e,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xa69d,
-  0xa69c, 0x9e7c, 0x24b9, 0x0438, 0x1c99, 0x9e7d, 0x24b9, 0x1c99,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x7e1b, 0x1478, 0x1479, 0xaebe, 0xaebe, 0x1479,
-  0x9e9c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0xa69c, 0x965c, 0x24b9, 0x1c99, 0x0c58, 0x24b9, 0x9e7d, 0x1c99,
-  0x965c, 0x9e7c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c,
-  0xa69c, 0x863c, 0x24b9, 0x8e3d, 0x1c99, 0x1479, 0x1479, 0x0c58,
-  0x2499, 0x861c, 0x965c, 0x9e9c, 0xa69c, 0xa69c, 0x9e9c, 0x965c,
-  0x863c, 0x1c99, 0x0c58, 0x1479, 0x1c99, 0x9e7d, 0x1c79, 0x0458,
-  0x0c58, 0x1478, 0x2499, 0x8e3c, 0x965c, 0x965c, 0x863c, 0x24b9,
-  0x24b9, 0x0c58, 0x0438, 0x0c58, 0x2cb9, 0x9e7d, 0x1c99, 0x0458,
-  0x0c58, 0x0c58, 0x0c58, 0x1478, 0x1478, 0x24b9, 0x24b9, 0x1c99,
-  0x8e3d, 0x2cb9, 0x1479, 0x1c99, 0x8e5d, 0x24b9, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0438, 0x1478, 0x965d, 0x9e7d, 0x1479,
-  0x24b9, 0x9e7d, 0x9e7d, 0x1c79, 0x1479, 0x0c58, 0x0c58, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e7d, 0x9e9d, 0x9e9d, 0x9e7d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0x9e7c, 0x9e7c, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e9c, 0xa69d, 0xa69d, 0xdf7e, 0xaebd, 0xaebd, 0xdf7e,
-  0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xb6dd, 0xdf7e, 0xdf7e, 0xb6dd,
-  0xaebd, 0xaebd, 0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e9c, 0xa69d, 0xaebd, 0xcf1e, 0x2cd9, 0x2cd9, 0xcf3e,
-  0xe79e, 0xdf5e, 0x9e7c, 0x9e9c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0xa69d, 0xdf5e, 0x3d1a, 0x0438, 0x0c58, 0x2cd9,
-  0x2499, 0x1c99, 0x2499, 0x863c, 0x965c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e9c, 0xaebd, 0xd73e, 0x2cd9, 0x1478, 0x8e3d,
-  0x1479, 0x1478, 0x0c58, 0x1478, 0x1c99, 0x8e3c, 0xa69c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xefbf, 0xd75e, 0x34d9, 0x24b9,
-  0x1c99, 0x9e7d, 0x2cb9, 0x0c58, 0x1479, 0x1c99, 0x8e3c, 0xa69d,
-  0x9e9c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xaebd, 0xdf7e, 0xcf3e,
-  0x3d1a, 0xaebe, 0x9e7e, 0x34da, 0x8e5d, 0x24b9, 0x1c99, 0x8e3c,
-  0x965c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa6bd, 0xb6bd,
-  0xcf3e, 0x2cb9, 0x24b9, 0x9e7d, 0x34fa, 0x8e3d, 0x1c79, 0x1478,
-  0x2499, 0x8e3c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c,
-  0x965c, 0x1478, 0x1479, 0x9e7d, 0x1c99, 0x24b9, 0x0c58, 0x0c58,
-  0x0c58, 0x1c99, 0x8e3c, 0xa69c, 0xa69c, 0xa69c, 0xa69c, 0x8e3c,
-  0x1c99, 0x0c58, 0x0c58, 0x1479, 0x1c99, 0x9e7d, 0x1c99, 0x0458,
-  0x0c58, 0x0c58, 0x1c99, 0x8e3c, 0x965c, 0x965c, 0x863c, 0x2499,
-  0x1479, 0x0c58, 0x0458, 0x0c58, 0x2cb9, 0x9e7d, 0x1c79, 0x0458,
-  0x0c58, 0x0c58, 0x0c58, 0x1478, 0x1478, 0x1478, 0x24b9, 0x1c99,
-  0x8e5d, 0x2cb9, 0x1479, 0x1c99, 0x8e5d, 0x24b9, 0x1c99, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0438, 0x1479, 0x8e3d, 0x1c79,
-  0x24b9, 0x9e7d, 0x9e7d, 0x1c79, 0x1478, 0x1c79, 0x8e3d, 0x1c99,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e9c, 0xa69d, 0x9e9c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0xa69d, 0xdf7e, 0xa69d, 0xa6bd, 0xaebd,
-  0xaebd, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0xaebd, 0xaebd, 0xdf7e, 0xe77e,
-  0xdf7e, 0xaebd, 0xa69d, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0xaebd, 0xf7bf, 0xd75e, 0x2cd9, 0x1478,
-  0x2cd9, 0xcf1e, 0x9e7c, 0x965c, 0x9e9c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e9c, 0xaebd, 0xdf7e, 0xdf5e, 0x2cd9, 0x1479, 0x1479,
-  0x0c58, 0x1c99, 0x24b9, 0x1c99, 0x8e3c, 0xa69c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0xa69d, 0xd75e, 0x451a, 0x1478, 0x1478, 0x9e7d, 0x9e7d,
-  0x1478, 0x1478, 0x9e7d, 0x24b9, 0x1c99, 0x8e3c, 0xa69c, 0x9e9d,
-  0x965c, 0xa69c, 0xb6dd, 0xcf3e, 0x2cd9, 0x1c99, 0x2cd9, 0x24b9,
-  0x1478, 0x1c99, 0xaebe, 0x9e7d, 0x1478, 0x1c99, 0x8e3c, 0xa69d,
-  0x1c99, 0x8e3c, 0xe77e, 0xb6dd, 0xdf7e, 0xe77e, 0xdf5e, 0x9e7c,
-  0x8e3c, 0x1478, 0x1479, 0x1c99, 0x0c58, 0x1479, 0x2499, 0x8e3c,
-  0x0c58, 0x1c99, 0x965c, 0xa69c, 0xaebd, 0xaebd, 0xaebd, 0x9e7c,
-  0x863c, 0x1478, 0x0438, 0x0438, 0x1c79, 0x9e7d, 0x1c99, 0x1478,
-  0x0c58, 0x0c58, 0x1c99, 0x8e3c, 0x965c, 0x965c, 0x863c, 0x24b9,
-  0x24b9, 0x0c58, 0x0458, 0x0c58, 0x2cb9, 0x9e7d, 0x1c79, 0x0438,
-  0x0c58, 0x0c58, 0x0c58, 0x1478, 0x1478, 0x1478, 0x24b9, 0x1c99,
-  0x8e3d, 0x2cb9, 0x1479, 0x1c99, 0x8e5d, 0x24b9, 0x1c99, 0x0c58,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0438, 0x1479, 0x8e3d, 0x1c79,
-  0x24b9, 0x9e7d, 0x9e7d, 0x1c79, 0x1478, 0x1c79, 0x8e3d, 0x1c99,
-  0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7c, 0xa69d, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebd, 0xdf7e, 0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xdf7e, 0xb6dd, 0x9e9c, 0xa69d, 0x9e9c, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x34d9, 0xdf5e, 0xaebd, 0xdf7e, 0xa69d, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c78, 0xcf3e, 0xb6dd, 0xaedd, 0xaebd, 0xa69d, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x2cd9, 0xd73e, 0xe77e, 0xdf5e, 0x9e7c, 0x9e9c, 0xa69c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x9e7d, 0x1c79, 0x1c99, 0x1c99, 0x1c99, 0x1c99, 0x863c, 0x965c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x0c58, 0x0438, 0x0c58, 0x1479, 0x1c79, 0x1478, 0x1c99,
-  0x8e3c, 0xa69d, 0xa69d, 0xa69c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x1479, 0x0c58, 0x1479, 0x9e7d, 0xaebe, 0x2cb9, 0x1479,
-  0x2499, 0xa69e, 0x967c, 0x965c, 0x965c, 0x9e7c, 0xa69c, 0xa69d,
-  0x1c99, 0x9e7d, 0x24b9, 0x0438, 0x24b9, 0xaebe, 0xaebe, 0x9e7d,
-  0x24b9, 0x1479, 0x1478, 0x1478, 0x2cd9, 0x8e3c, 0x965c, 0x965c,
-  0x1c79, 0xaebe, 0xaebe, 0x2cb9, 0x1c79, 0x1c99, 0x2cb9, 0x2cb9,
-  0x965d, 0x24b9, 0x1479, 0x1c79, 0x8e3d, 0x24b9, 0x24b9, 0x1479,
-  0x0c58, 0x24b9, 0xae9e, 0xaebe, 0x965d, 0x24b9, 0x8e3d, 0x1479,
-  0x24b9, 0x9e7d, 0x9e7d, 0x1c79, 0x1478, 0x1c79, 0x8e3d, 0x1c99,
-  0x0c58, 0x0c58, 0x1c79, 0x1c99, 0x1c99, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0xefbf, 0xa69d, 0x9e9d, 0xa6bd, 0xa69d, 0x9e7d, 0x9e9d, 0x9e9d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0xa69d, 0xa69d, 0xaebd, 0xdf7e, 0xa69d, 0xa69d, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebd, 0xf7bf, 0xefbf, 0xaebd, 0xa69d, 0xdf7e, 0xa69d, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xdf7e, 0xef9e, 0xf7df, 0xaebd, 0x9e9c, 0xa69d, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x2cd9, 0xdf5e, 0xefbf, 0xa69d, 0xa69d, 0x9e9c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0438, 0x0438, 0x2cd9, 0xe77e, 0xaebd, 0xdf7e, 0xa69d, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x0438, 0x1c99, 0xe77e, 0xb6dd, 0xa69d, 0x9e9c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c79, 0x0c58, 0x1c98, 0xd75e, 0xf7bf, 0xa69d, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebe, 0x1c99, 0x1478, 0x2cd9, 0xd73e, 0xaebd, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xa69e, 0x2cd9, 0x9e7d, 0x24b9, 0x24b9, 0x863c, 0xa69c, 0xa69c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1478, 0x1479, 0xaebe, 0x9e7d, 0x1479, 0x2cb9, 0x863c, 0x965c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x1479, 0x1479, 0x1479, 0x1c99, 0x9e7d, 0x34fa, 0x2cd9,
-  0x8e3c, 0xa69c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0xa69d,
-  0x1c99, 0x9e7d, 0x24b9, 0x0438, 0x1478, 0xaebe, 0xae9e, 0x9e7d,
-  0x3d1a, 0x861c, 0x965c, 0x9e7c, 0xa69d, 0x9e9c, 0x965c, 0x965c,
-  0x1c79, 0xaebe, 0xaebe, 0x2cb9, 0x1c99, 0x1c99, 0x2cb9, 0x2cb9,
-  0x965d, 0x34da, 0x2cd9, 0x8e3c, 0x965c, 0x8e3c, 0x2cd9, 0x1479,
-  0x0c58, 0x24b9, 0xae9e, 0xaebe, 0x965d, 0x24b9, 0x8e3d, 0x1479,
-  0x24b9, 0x9e7d, 0x9e7d, 0x2499, 0x1478, 0x24b9, 0x8e3d, 0x1c99,
-  0x0c58, 0x0c58, 0x1c79, 0x1c99, 0x1c99, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x9e9d, 0x9e7d, 0x9e7d, 0xa6bd, 0xe79e, 0xaebd, 0xa6bd, 0xa69d,
-  0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0x9e7c, 0xa69d, 0xa69d, 0xa69c, 0xa69d, 0xa69d, 0xdf7e, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebd, 0xf7bf, 0xefbe, 0xa69d, 0x9e7c, 0x9e7c, 0xa69d, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xdf7e, 0xef9e, 0xf7df, 0xaebd, 0x9e7c, 0x9e7c, 0xa69d, 0x9e9c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x2cd9, 0xdf5e, 0xefbf, 0xa69d, 0xa69d, 0xe77e, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0438, 0x0438, 0x2cd9, 0xe77e, 0xa6bd, 0x9e7c, 0xa69d, 0x9e9c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x0438, 0x1c99, 0xe77e, 0xaebd, 0x9e7c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c79, 0x0c58, 0x1c98, 0xd75e, 0xf7bf, 0xa69d, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xaebe, 0x1c99, 0x1478, 0x2cd9, 0xd73e, 0xaebd, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xa69e, 0x2cd9, 0x9e7d, 0x24b9, 0x24b9, 0x863c, 0xa69c, 0xa69c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1478, 0x1479, 0xaebe, 0x9e7d, 0x1479, 0x2cb9, 0x863c, 0x965c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x1479, 0x1479, 0x1479, 0x1c99, 0x9e7d, 0x34fa, 0x2cd9,
-  0x8e3c, 0xa69c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0xa69c, 0xa69d,
-  0x1c99, 0x9e7d, 0x24b9, 0x0438, 0x1478, 0xaebe, 0xae9e, 0x9e7d,
-  0x3d1a, 0x861c, 0x965c, 0x9e7c, 0xa69d, 0x9e9c, 0x965c, 0x965c,
-  0x1c79, 0xaebe, 0xaebe, 0x2cb9, 0x1c99, 0x1c99, 0x2cb9, 0x2cb9,
-  0x965d, 0x34da, 0x2cd9, 0x8e3c, 0x965c, 0x8e3c, 0x2cd9, 0x1479,
-  0x0c58, 0x24b9, 0xae9e, 0xaebe, 0x965d, 0x24b9, 0x8e3d, 0x1479,
-  0x24b9, 0x9e7d, 0x9e7d, 0x2499, 0x1478, 0x24b9, 0x8e3d, 0x1c99,
-  0x0c58, 0x0c58, 0x1c79, 0x1c99, 0x1c99, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1c99, 0x0c58,
-  0x9e7d, 0x9e9d, 0x9e9d, 0xaebd, 0xaebd, 0x9e9d, 0xa69d, 0xa6bd,
-  0xa69d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d, 0x9e9d,
-  0xa69d, 0x9e9c, 0xaebd, 0xdf7e, 0xdf7e, 0xaebd, 0xa69d, 0xdf7e,
-  0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xe79e, 0xb6dd, 0xcf3e, 0x2cb9, 0x2cd9, 0xdf7e, 0xaebd, 0xa69d,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xbedd, 0xcf3e, 0x2cd9, 0x1478, 0x1c99, 0xd75e, 0xefbf, 0xa69d,
-  0xa69d, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0xcf3e, 0x2cd9, 0x24b9, 0x8e5d, 0x1479, 0x2cb9, 0xe77e, 0xaebd,
-  0xdf7e, 0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c98, 0x1479, 0x8e3d, 0x24b9, 0x0c58, 0x2cd9, 0xdf7e, 0xb6bd,
-  0xa69d, 0x9e9c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0438, 0x0c58, 0x24b9, 0x0c58, 0x1c99, 0xcf1e, 0xb6dd, 0xdf7e,
-  0xa69d, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x1c99, 0x9e7d, 0x1c79, 0x1478, 0x9e7c, 0xa69c, 0xa69d,
-  0x9e9c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x965d, 0x2cd9, 0xa69e, 0x1c99, 0x1c99, 0x965c, 0xa69c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1479, 0x1c99, 0xae9e, 0x24b9, 0x863c, 0xa69c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0438, 0x1479, 0x9e7d, 0x24b9, 0x965c, 0xa69c, 0x9e7c, 0x9e7c,
-  0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x0c58, 0x1c79, 0x1479, 0x1478, 0x8e3c, 0xa69c, 0xa69c, 0xa69c,
-  0x9e7c, 0xa69c, 0xa69c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e7c, 0x9e9d,
-  0x1c99, 0x9e7d, 0x24b9, 0x0438, 0x1c99, 0x863c, 0x965c, 0x965c,
-  0xa69d, 0x965c, 0x965c, 0x9e7c, 0xa69c, 0xa69c, 0x9e7c, 0xa69d,
-  0x1c79, 0xaebe, 0xaebe, 0x2cb9, 0x1c79, 0x1479, 0x24b9, 0x24b9,
-  0x9e7d, 0x34fa, 0x2cd9, 0x8e3c, 0x965c, 0x965c, 0xa69d, 0x965c,
-  0x0c58, 0x24b9, 0xae9e, 0xaebe, 0x965d, 0x24b9, 0x8e3d, 0x1479,
-  0x24b9, 0x9e7d, 0x9e7d, 0x2499, 0x1478, 0x24b9, 0x965d, 0x24b9,
-  0x0c58, 0x0c58, 0x1c79, 0x1c99, 0x1c99, 0x0c58, 0x1c99, 0x0c58,
-  0x0c58, 0x1c99, 0x1c99, 0x0c58, 0x0c58, 0x0c58, 0x1479, 0x0c58
-};
-
-const Animation wavesAnimation = {
-  .name = "Waves",
-  .frameCount = 14,
-  .width = 16,
-  .height = 16,
-  .frameDurations = wavesDurations,
-  .animationFrames = wavesFrames
-};
-#endif // ANIMATION_WAVES_H
@@ -1,1942 +0,0 @@
-// wow.h - Auto-generated from wow.json
-#ifndef ANIMATION_WOW_H
-#define ANIMATION_WOW_H
-
-#include "animation_types.h"
-
-// Frame Durations for wow (in 100ms units)
-static const uint8_t PROGMEM wowDurations[] = { 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 };
-
-// RGB565 Frame Data for wow
-static const uint16_t PROGMEM wowFrames[] = {
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0xbdd7, 0xffff, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x8430, 0x8430, 0xbdd7, 0xffff, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0xf50f, 0x0000, 0x0000, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xffff, 0xbdd7, 0x0000, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xbdd7, 0xffff, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xbdd7, 0xffff, 0x8430, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0xf50f, 0xffff, 0xbdd7, 0x8430, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xbdd7, 0xbdd7, 0xbdd7, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xffff, 0xffff, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xffff, 0x8430, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xffff, 0x8430, 0x8430, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0xffff, 0x4228, 0x8430, 0x8430, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x9ce7, 0x9ce7, 0xffff, 0x9ce7, 0x9ce7, 0x8430, 0x9ce7, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0xffe0, 0xffe0, 0x0000, 0xffe0, 0xffe0, 0x0000, 0xffe0, 0xffe0,
-  0xffe0, 0xffe0, 0xffe0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4a49, 0x73ae, 0x9471, 0xb575, 0xce59, 0x528a, 0x4228, 0x4228,
-  0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x5a89, 0xbc2d, 0x3165, 0x2124, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x5aca, 0xd6ba, 0xa4f3, 0x2104, 0x39e7, 0x4228,
-  0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4208, 0x528a, 0xef5d, 0xbdd7, 0x7bcf, 0x4a49, 0x4228,
-  0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x630c, 0xef5d, 0xbdd7, 0x8410, 0x4a49, 0x4228,
-  0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x528a, 0xe6db, 0xf79e, 0xbdb6, 0x8430, 0x4a49, 0x4228,
-  0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x5269, 0xd4d0, 0xcdf7, 0xbdf7, 0xa514, 0x4a69, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x5aca, 0xef5c, 0xe71c, 0x5acb, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4208, 0x52aa, 0xe73c, 0x9492, 0x4a49, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4208, 0x52aa, 0xe71c, 0x8c51, 0x4a69, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x39c7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4a48, 0x4a48, 0x5aca, 0xe73c, 0x8c71, 0x6b6d, 0x4a69, 0x4a68,
-  0x4a68, 0x4a68, 0x4a68, 0x4228, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x9ce7, 0x9ce6, 0xa509, 0xded9, 0x9ce9, 0x31a2, 0x9486, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9486, 0x0860, 0x0000, 0x0000, 0x0000,
-  0xf780, 0xf7a0, 0xdee1, 0x39c2, 0xdee0, 0xef40, 0xf780, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x10a0, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4a49, 0x73ae, 0x9471, 0xb575, 0xce59, 0x528a, 0x4228,
-  0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x5a89, 0xbc0d, 0x3145, 0x2124, 0x39e7, 0x4228,
-  0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x6b2c, 0xdedb, 0xa4f3, 0x2104, 0x39e7,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x528a, 0xdf1c, 0xf7be, 0xbdd7, 0x7bcf, 0x4a49,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x62eb, 0xef5d, 0xc618, 0xb596, 0x8410, 0x4a49,
-  0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x5249, 0xcc8f, 0xef1b, 0xbdd7, 0xb596, 0x8430, 0x4a49,
-  0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4a28, 0x5269, 0x5acb, 0xb596, 0xc5f7, 0xa514, 0x4a69,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4208, 0x528a, 0xef3c, 0xdefb, 0x5acb, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x52aa, 0xe71c, 0x630c, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4208, 0x52aa, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020, 0x0000, 0x0000,
-  0x4a48, 0x4a68, 0x4a48, 0x4a69, 0x8430, 0xdedb, 0x5aca, 0x4a48,
-  0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4228, 0x0020, 0x0000, 0x0000,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9486, 0x39c4, 0xce78, 0xa529, 0x9ce6,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9486, 0x0860, 0x0000, 0x0000,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xd680, 0x31a2, 0xdee1, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x10a0, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228,
-  0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4a49, 0x73ae, 0x9471, 0xb575, 0xce59, 0x528a,
-  0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x5a89, 0xbc0d, 0x3145, 0x2124, 0x39e7,
-  0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x6b2c, 0xdedb, 0xa4f3, 0x2104,
-  0x39e7, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x528a, 0xdf1c, 0xf7be, 0xbdd7, 0x7bcf,
-  0x4a49, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x630c, 0xef7d, 0xc618, 0xb596, 0x8410,
-  0x4a49, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x528a, 0xe6da, 0xef5d, 0xbdd7, 0xb596, 0x8430,
-  0x4a49, 0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x5269, 0xcc8e, 0x6b2c, 0xb596, 0xbdf7, 0xa514,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4a28, 0x4a48, 0x528a, 0xe71c, 0xef5d, 0x5aeb,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x9492, 0xe73c, 0x528a,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x8410, 0xd6bb, 0x630c,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020, 0x0000,
-  0x4a48, 0x4a68, 0x4a48, 0x5289, 0x73ae, 0x52a9, 0x632c, 0xd6ba,
-  0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4228, 0x0020, 0x0000,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0xa508, 0xded9,
-  0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9486, 0x0860, 0x0000,
-  0xf780, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xe700, 0xe701, 0x39c2,
-  0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x1080, 0x0000,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb, 0x630c,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000, 0x0000,
-  0x0841, 0x4208, 0x4228, 0x4a49, 0x73ae, 0x9471, 0xb575, 0xce59,
-  0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000, 0x0000,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x5a89, 0xbc2d, 0x3165, 0x2124,
-  0x39e7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca, 0xd69a, 0xa534,
-  0x2104, 0x39e7, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbdd7, 0xef5d,
-  0x7bef, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef7d,
-  0x8c51, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbd75, 0xef5d,
-  0x8c71, 0x4a49, 0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5269, 0xdd11, 0xcdf7,
-  0xa514, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xe6fb, 0xef5d,
-  0x5acb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x9492, 0xef5d,
-  0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8410, 0xe73c,
-  0xe71c, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b4c,
-  0xef5c, 0xe73c, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4228, 0x0020,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7,
-  0xad6a, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x8c66, 0x0860,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xe700,
-  0xe700, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee0, 0x10a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x73ae, 0x9471, 0xb575,
-  0xce59, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x5a89, 0xbc2d, 0x3165,
-  0x2124, 0x39e7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x0020, 0x0000,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca, 0xd6ba,
-  0xa4f3, 0x2104, 0x39e7, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xef5d,
-  0xc618, 0x7bcf, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xef5d,
-  0xf79e, 0x8430, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbdb6,
-  0xf79e, 0x8c71, 0x4a49, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbdd6,
-  0xf75d, 0xad54, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5b0c, 0xdeba,
-  0xdd11, 0x5aaa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xd6ba, 0x632c,
-  0x7bce, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xd69a, 0x6b4d,
-  0x73af, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x630b, 0xc639,
-  0x8c51, 0x4a69, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9486, 0x39c4,
-  0x738d, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xd680,
-  0x2961, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x73ae, 0x9471,
-  0xb575, 0xce59, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x5a89, 0xbc2d,
-  0x3165, 0x2124, 0x39e7, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca,
-  0xdeda, 0xa534, 0x18e3, 0x39e7, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0xe73c, 0xef5d, 0x4a69, 0x4208, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49,
-  0x94b2, 0xe75d, 0x5aeb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69,
-  0xb575, 0xf75c, 0xb575, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a6a,
-  0xbd95, 0xed93, 0xad34, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a,
-  0xef3c, 0xe71b, 0x5acb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c,
-  0xef5d, 0x9492, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a, 0xe71c,
-  0xe73c, 0x8430, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aea, 0xe73c,
-  0x6b6d, 0x7bef, 0x7bef, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xd6b8,
-  0xa508, 0x9ce7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2,
-  0xe701, 0xe700, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a,
-  0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x73ae,
-  0x9471, 0xb575, 0xce59, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x5a89,
-  0xbc2d, 0x3165, 0x2124, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x5aca, 0xd69a, 0xa514, 0x18e3, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a69, 0xbdd7, 0xef3c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x5aaa, 0xbdd6, 0xef5d, 0x8430, 0x4a49, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x5249,
-  0xcc8f, 0xef3c, 0xbdf7, 0x8430, 0x4a49, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x5aaa, 0xbdb6, 0xc5f7, 0xa514, 0x4a69, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x528a, 0xe73c, 0xe71c, 0x5acb, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x52aa, 0xe73c, 0x9492, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x52aa, 0xe71c, 0x8c51, 0x7bcf, 0x4a69, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48,
-  0x5aea, 0xe71c, 0x632c, 0x7bef, 0x7bef, 0x5289, 0x4a48, 0x4a68,
-  0x0860, 0x8c66, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6,
-  0xa509, 0xded8, 0xa529, 0x9ce7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7,
-  0x10a0, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x39c2, 0xe701, 0xe700, 0x3181, 0xdee1, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4a49,
-  0x73ae, 0x9471, 0xb575, 0xce59, 0x528a, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x5a89, 0xbc2d, 0x3165, 0x2124, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x5aca, 0xd6ba, 0xa4f3, 0x2104, 0x39e7, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x528a, 0xef5d, 0xbdd7, 0x7bcf, 0x4a49, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x630c, 0xef5d, 0xbdd7, 0x8410, 0x4a49, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x528a, 0xe6db, 0xf79e, 0xbdb6, 0x8430, 0x4a49, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x5269, 0xd4d0, 0xcdf7, 0xbdf7, 0xa514, 0x4a69, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x5aca, 0xef5c, 0xe71c, 0x5acb, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x52aa, 0xe73c, 0x9492, 0x4a49, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x52aa, 0xe71c, 0x8c51, 0x4a69, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x4a48, 0x5aca, 0xe73c, 0x8c71, 0x6b6d, 0x4a69, 0x4a68, 0x4a68,
-  0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce6, 0xa509, 0xded9, 0x9ce9, 0x31a2, 0x9486, 0x9ce7, 0x9ce7,
-  0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xdee1, 0x39c2, 0xdee0, 0xef40, 0xf780, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4a49, 0x73ae, 0x9471, 0xb575, 0xce59, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x5a89, 0xbc0d, 0x3145, 0x2124, 0x39e7, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x6b2c, 0xdedb, 0xa4f3, 0x2104, 0x39e7, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdf1c, 0xf7be, 0xbdd7, 0x7bcf, 0x4a49, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x62eb, 0xef5d, 0xc618, 0xb596, 0x8410, 0x4a49, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x5249, 0xcc8f, 0xef1b, 0xbdd7, 0xb596, 0x8430, 0x4a49, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4a28, 0x5269, 0x5acb, 0xb596, 0xc5f7, 0xa514, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x528a, 0xef3c, 0xdefb, 0x5acb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x52aa, 0xe71c, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x4a68, 0x4a48, 0x4a69, 0x8430, 0xdedb, 0x5aca, 0x4a48, 0x4a68,
-  0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9486, 0x39c4, 0xce78, 0xa529, 0x9ce6, 0x9ce7,
-  0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xf7a0, 0xd680, 0x31a2, 0xdee1, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x4a49, 0x6b6d, 0x7bef, 0xc5d6, 0xd69a, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4208, 0x0861, 0x2924, 0xd4af, 0x62cb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x2124, 0xdeba, 0xef5c, 0x5aeb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x528a, 0xdedb, 0xffdf, 0xffff, 0xe71c, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x52aa, 0xef5d, 0xce38, 0xf7be, 0xef5d, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x52aa, 0xe71c, 0xce38, 0xf79e, 0xc5f7, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4a69, 0xb575, 0xf79e, 0xf79e, 0xdedb, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x5aeb, 0xe73c, 0x9492, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xe73c, 0x9492, 0x4a49, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4208, 0x528a, 0xe73c, 0xe73c, 0x528a, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68,
-  0x4a68, 0x4a48, 0x5289, 0x9492, 0xef5d, 0x5aea, 0x4a48, 0x4a68,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9cc7, 0x840f, 0xd6b9, 0xa529, 0x9ce6, 0x9ce7,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xe700, 0x18e1, 0x2102, 0xe701, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x4a49, 0x73ae, 0x9450, 0xb575, 0xce59, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4228, 0x5aaa, 0xcc8f, 0x3145, 0x10a2, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4a49, 0x8c51, 0xef5c, 0xd6ba, 0x2104, 0x39e7, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x52aa, 0xe71c, 0xce59, 0xf79e, 0xad34, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x52aa, 0xe71c, 0xce38, 0xf79e, 0xbdd7, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x5269, 0xbdf7, 0xf7be, 0xffff, 0xef7d, 0x630c, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdedb, 0xf7be, 0xf7be, 0xef7d, 0xd69a, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x5aeb, 0xbdd7, 0xbdd7, 0x5aeb, 0x528a, 0x4a49,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x528a, 0xe71c, 0xef5d, 0x528a, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4a49, 0x9492, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68,
-  0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b6c, 0xd6ba, 0x5aca, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9cc7, 0x7bcd, 0x9ce9, 0xded9, 0xa529, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xce41, 0x39e2, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4a49, 0x73ae, 0x9471, 0xb575, 0xc638, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x5a89, 0xbc2d, 0x2924, 0x2945, 0x39e7, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x5a89, 0xad34, 0xd69a, 0x2965, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4a69, 0xb596, 0xffdf, 0xdefb, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x5aaa, 0xbdd7, 0xffdf, 0xf79e, 0x528a, 0x4208,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x5249, 0xcc8e, 0xef5c, 0xf7be, 0xf79e, 0x630c, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x5aaa, 0xbdd7, 0xce38, 0xef5d, 0xd69a, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x528a, 0xe71c, 0xef5d, 0x630c, 0x528a, 0x4a49,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4a49, 0x9492, 0xe73c, 0x528a, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4a49, 0x8430, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68,
-  0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b6c, 0xd6ba, 0x5aca, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce7, 0x9ce7, 0x9cc7, 0x7bcd, 0x9ce9, 0xded9, 0xa529, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xce41, 0x39e2, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x528a, 0xad35, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4a49, 0x73ae, 0x9450, 0xb575, 0xc638, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x5a89, 0xcc6e, 0x2104, 0x2145, 0x39e7, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x5aeb, 0xd6bb, 0x2ab4, 0xbdf8, 0x3185, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4a69, 0xb575, 0xe75f, 0x235e, 0xb5d9, 0xdeda, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4a69, 0xbdb5, 0xdf1e, 0x233e, 0xb577, 0xef5d, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x5269, 0xd4af, 0xb597, 0x337d, 0xdd53, 0xef1b, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x5aaa, 0xbdb6, 0xef7f, 0xf79d, 0xb575, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xe73c, 0xf79e, 0xef7d, 0x5acb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x52aa, 0xdedb, 0x738e, 0xdebb, 0x52aa, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68,
-  0x4a48, 0x52aa, 0xad55, 0x5aeb, 0xad55, 0x52aa, 0x4a48, 0x4a68,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce6, 0x9ce8, 0xa512, 0x9ce9, 0xa512, 0x9ce8, 0x9ce6, 0x9ce7,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xdee1, 0x31a1, 0xce41, 0x31a1, 0xdee1, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3a08,
-  0x5289, 0xdccf, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7,
-  0x52aa, 0xd679, 0x630c, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x630c, 0xd6ba, 0x630c, 0xa534, 0xdedb, 0x630c, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x528a, 0xd6ba, 0x8c71, 0x9450, 0xb575, 0xc638, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4228, 0x5acb, 0xb575, 0xc46f, 0x2924, 0x2945, 0x39e7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xd6dc, 0x3ad5, 0xa515, 0xce79, 0x1904,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xd6fd, 0x235e, 0xadb8, 0xef5c, 0x528a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x630c, 0xd6dd, 0x235f, 0xb5d9, 0xef5c, 0x5acb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdefb, 0xb5d8, 0x339e, 0xe71d, 0xe6fb, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdedb, 0xc638, 0xef3d, 0xe572, 0x5aca, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x6b6d, 0xef5d, 0xf79d, 0xef3c, 0x528a, 0x4208,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xe71c, 0xe71c, 0x738e, 0xdefb, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x5aeb, 0xdefb, 0x5aec, 0x528a, 0xdedb, 0x52aa, 0x4208,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a48,
-  0x5289, 0xad55, 0xb575, 0x5289, 0x52a9, 0xad55, 0x52aa, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce6,
-  0x9ce8, 0xad32, 0xa529, 0x9ce6, 0x9ce8, 0xa512, 0x9ce8, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x3181, 0xdee0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x3a08,
-  0x5289, 0xdccf, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7,
-  0x52aa, 0xd679, 0x630c, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x630c, 0xd6ba, 0x630c, 0xa534, 0xdedb, 0x630c, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x528a, 0xd6ba, 0x8c71, 0x9450, 0xb575, 0xc638, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4228, 0x5acb, 0xb575, 0xc46f, 0x2924, 0x2945, 0x39e7,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xd6dc, 0x3ad5, 0xa515, 0xce79, 0x1904,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x52aa, 0xd6fd, 0x235e, 0xadb8, 0xef5c, 0x528a,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x630c, 0xd6dd, 0x235f, 0xb5d9, 0xef5c, 0x5acb,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdefb, 0xb5d8, 0x339e, 0xe71d, 0xe6fb, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xdedb, 0xc638, 0xef3d, 0xe572, 0x5aca, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x6b6d, 0xef5d, 0xf79d, 0xef3c, 0x528a, 0x4208,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xe71c, 0xe71c, 0x738e, 0xdefb, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x5aeb, 0xdefb, 0x5aec, 0x528a, 0xdedb, 0x52aa, 0x4208,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a48,
-  0x5289, 0xad55, 0xb575, 0x5289, 0x52a9, 0xad55, 0x52aa, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce6,
-  0x9ce8, 0xad32, 0xa529, 0x9ce6, 0x9ce8, 0xa512, 0x9ce8, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x3181, 0xdee0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x4228, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4a49, 0x6b6d, 0x840f, 0xc5d6, 0xd69a, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x39e7, 0x18e4, 0x18c3, 0xcc8f, 0x62eb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4208, 0x2965, 0xbdf9, 0x2ab4, 0xd6bb, 0x5aeb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x528a, 0xdeda, 0xb5d9, 0x235e, 0xe75f, 0xb575, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x52aa, 0xef5d, 0xb597, 0x233e, 0xdf1e, 0xbdb6, 0x4a69, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x52aa, 0xef1b, 0xdd53, 0x337d, 0xb597, 0xd4af, 0x5269, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4a69, 0xb575, 0xf77d, 0xef7f, 0xbdb6, 0x5aaa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x5acb, 0xef7d, 0xf79e, 0xef5d, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x52aa, 0xdedb, 0x738e, 0xdedb, 0x52aa, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68,
-  0x4a48, 0x52aa, 0xad55, 0x5aeb, 0xad55, 0x52aa, 0x4a48, 0x4a68,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9ce6, 0x9ce8, 0xa512, 0x9ce9, 0xa512, 0x9ce8, 0x9ce6, 0x9ce7,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf7a0, 0xdee1, 0x31a1, 0xce41, 0x31a1, 0xdee1, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5269, 0xdccf, 0x5289, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x528a, 0x52aa, 0x4228, 0x630c, 0xd679, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7,
-  0x528a, 0xad55, 0xd6ba, 0x738e, 0xd6ba, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4228,
-  0x6b6d, 0x83ef, 0xc5d6, 0xe73c, 0xe71c, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x39e7,
-  0x1904, 0x2104, 0xcc8f, 0xc5d6, 0x5aeb, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x2104,
-  0xd679, 0xa515, 0x32d4, 0xd6bb, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x528a,
-  0xef5d, 0xb5b8, 0x233e, 0xd6fd, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39e7, 0x52aa,
-  0xef5d, 0xb5d9, 0x235e, 0xd6dd, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x528a,
-  0xe71b, 0xe71d, 0x339e, 0xb5b8, 0xe6fb, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x5aca, 0xe572, 0xef3d, 0xc638, 0xdedb, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4208,
-  0x528a, 0xef3c, 0xf79d, 0xef7d, 0x6b6d, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x52aa, 0xdefc, 0x738e, 0xe71c, 0xe71c, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4208,
-  0x52aa, 0xdedb, 0x528a, 0x5aeb, 0xdefb, 0x5aeb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a48,
-  0x52aa, 0xad55, 0x52aa, 0x5289, 0xb575, 0xad55, 0x52a9, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce6,
-  0x9ce8, 0xa512, 0x9ce8, 0x9ce6, 0xa529, 0xad32, 0x9ce8, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x3181, 0xdee1, 0xf7a0, 0xdee0, 0x3181, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5269, 0xdccf, 0x5289, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x528a, 0x52aa, 0x4228, 0x630c, 0xd679, 0x52aa, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7,
-  0x528a, 0xad55, 0xd6ba, 0x738e, 0xd6ba, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4228,
-  0x6b6d, 0x83ef, 0xc5d6, 0xe73c, 0xe71c, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x39e7,
-  0x1904, 0x2104, 0xcc8f, 0xc5d6, 0x5aeb, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x2104,
-  0xd679, 0xa515, 0x32d4, 0xd6bb, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x528a,
-  0xef5d, 0xb5b8, 0x233e, 0xd6fd, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x39e7, 0x52aa,
-  0xef5d, 0xb5d9, 0x235e, 0xd6dd, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x528a,
-  0xe71b, 0xe71d, 0x339e, 0xb5b8, 0xe6fb, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x5aca, 0xe572, 0xef3d, 0xc638, 0xdedb, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4208,
-  0x528a, 0xef3c, 0xf79d, 0xef7d, 0x6b6d, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x52aa, 0xdefc, 0x738e, 0xe71c, 0xe71c, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4208,
-  0x52aa, 0xdedb, 0x528a, 0x5aeb, 0xdefb, 0x5aeb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a48,
-  0x52aa, 0xad55, 0x52aa, 0x5289, 0xb575, 0xad55, 0x52a9, 0x4a48,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce6,
-  0x9ce8, 0xa512, 0x9ce8, 0x9ce6, 0xa529, 0xad32, 0x9ce8, 0x9ce6,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x3181, 0xdee1, 0xf7a0, 0xdee0, 0x3181, 0xdee1, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208,
-  0x4228, 0x4228, 0x4a49, 0x6b6d, 0x7bef, 0xc5d7, 0xd679, 0x52aa,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228,
-  0x4228, 0x4228, 0x39e7, 0x18c3, 0x2944, 0xc44d, 0x62eb, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4208, 0x18c3, 0xa514, 0xd69a, 0x5aca, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x528a, 0xe73c, 0xbdd7, 0x4a69, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x4a49, 0x8410, 0xef5d, 0xbdd7, 0x5aaa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x4a49, 0x8430, 0xbdf7, 0xef3c, 0xcc8f, 0x5249, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4a69, 0xa514, 0xc5f7, 0xbdd7, 0x5aaa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x5acb, 0xe71c, 0xef5d, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4a69, 0x9492, 0xe73c, 0x52aa, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4a69, 0x73af, 0x8431, 0xe71c, 0x52aa, 0x4208, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a48,
-  0x4a69, 0x7bef, 0x7bef, 0x632b, 0xe71c, 0x5aeb, 0x4a48, 0x4a68,
-  0x0000, 0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9cc7, 0x7bed, 0x9ce8, 0xa528, 0xded8, 0xa529, 0x9ce6, 0x9ce7,
-  0x0000, 0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x3181, 0xdee0, 0xe701, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228,
-  0x4228, 0x4a49, 0x6b6d, 0x7bef, 0xc5d7, 0xd69a, 0x528a, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228,
-  0x4228, 0x39e7, 0x18e3, 0x2924, 0xc44d, 0x62eb, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4208, 0x18e3, 0xa4f3, 0xdeba, 0x5aca, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4a49, 0x73ae, 0xbdd7, 0xef5d, 0x528a, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4a49, 0x8410, 0xbdd7, 0xef5d, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x4a49, 0x8430, 0xbdb6, 0xf79e, 0xe6fb, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4a69, 0xa514, 0xbdf7, 0xcdf7, 0xd4f0, 0x5269, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x5acb, 0xe71c, 0xef5d, 0x5aca, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4a49, 0x9492, 0xe73c, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4a69, 0x8c51, 0xe73c, 0x52aa, 0x4208, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x4a69, 0x6b6d, 0x8c71, 0xe73c, 0x5aea, 0x4a48, 0x4a68, 0x4a68,
-  0x0000, 0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x9486, 0x31a2, 0x9ce8, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7,
-  0x0000, 0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xf780, 0xef40, 0xdee0, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228,
-  0x4228, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228,
-  0x4a49, 0x6b6d, 0x7bef, 0xc5d7, 0xd69a, 0x528a, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228,
-  0x39e7, 0x18e3, 0x2924, 0xc42d, 0x62eb, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4208,
-  0x18e3, 0xa4f3, 0xdedb, 0x6b2c, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4a49,
-  0x73ae, 0xbdb6, 0xf7be, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49,
-  0x8410, 0xb596, 0xc618, 0xef7d, 0x62eb, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4a49,
-  0x8430, 0xb596, 0xbdd7, 0xef1b, 0xcc8f, 0x5249, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a69,
-  0xa514, 0xc5f7, 0xb596, 0x5aeb, 0x5269, 0x4a28, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x5acb, 0xdefb, 0xef5d, 0x528a, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x630c, 0xe71c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x630c, 0xdedb, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48,
-  0x5aca, 0xdedb, 0x8431, 0x4a69, 0x4a48, 0x4a68, 0x4a68, 0x4a68,
-  0x0000, 0x0860, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6,
-  0xa529, 0xce78, 0x39c4, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x0000, 0x1080, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0xdee1, 0x31a2, 0xd680, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228,
-  0x528a, 0xad55, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49,
-  0x6b6d, 0x7bef, 0xc5d7, 0xd69a, 0x528a, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x39e7,
-  0x18e3, 0x2924, 0xc42d, 0x62eb, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x18e3,
-  0xa4f3, 0xdedb, 0x6b2c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4a49, 0x73ae,
-  0xbdb6, 0xf7be, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x8410,
-  0xb596, 0xc618, 0xef7d, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8430,
-  0xb596, 0xbdd7, 0xef5d, 0xe6db, 0x528a, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xa514,
-  0xbdf7, 0xb5b6, 0x6b2c, 0xcc8e, 0x5269, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb,
-  0xef5d, 0xe71c, 0x528a, 0x4a48, 0x4a28, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a,
-  0xe73c, 0x9492, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c,
-  0xd6ba, 0x8410, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x4228, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aca, 0xd6ba,
-  0x632c, 0x52a9, 0x73ae, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68,
-  0x0860, 0x8c66, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xded9,
-  0xa508, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0x10a0, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2,
-  0xe701, 0xe700, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x528a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a,
-  0xad55, 0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0000, 0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d,
-  0x7bef, 0xc5d7, 0xd69a, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x0000, 0x0020, 0x39e7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x18c3,
-  0x2944, 0xc44d, 0x62eb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x2104, 0xa514,
-  0xd679, 0x5aca, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4a49, 0x7bef, 0xe73c,
-  0x9492, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x8c51, 0xef5d,
-  0x8431, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8c71, 0xe73c,
-  0x9450, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xa514, 0xc5f7,
-  0xdd10, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xef5d,
-  0xe71b, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x630c, 0xef5d,
-  0x9492, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xe71c, 0xe73c,
-  0x8430, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aca, 0xe73c, 0xef5c, 0x6b4c,
-  0x7bcf, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xded9, 0xb58a, 0x9cc7,
-  0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2, 0xdee0, 0xe700,
-  0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d, 0x7bef,
-  0xc5d7, 0xd69a, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x18e3, 0x2924,
-  0xc44d, 0x62eb, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x18e3, 0xa4f3, 0xdeba,
-  0x5aca, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a49, 0x73ae, 0xc5f7, 0xef7d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x8430, 0xef7d, 0xef5d,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8c71, 0xf79e, 0xbdb6,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad34, 0xf75d, 0xbdd7,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aaa, 0xdd11, 0xdeba,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x7bce, 0x632c,
-  0xd6ba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73af, 0x6b4d,
-  0xd69a, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x8430, 0xc639,
-  0x632b, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x738d, 0x39c4,
-  0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x2961, 0xce60,
-  0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d, 0x7bef,
-  0xc5d7, 0xd69a, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x18c3, 0x2924,
-  0xc44d, 0x62eb, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x18e3, 0xa534, 0xdedb,
-  0x5aca, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x4a69, 0xef5d, 0xef5d,
-  0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xe73c, 0x94b2,
-  0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad75, 0xf75c, 0xb575,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad34, 0xed92, 0xbd95,
-  0x4a8a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xe6fb, 0xef5d,
-  0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x9492, 0xef5d,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x8430, 0xe73c,
-  0xe71c, 0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x7bef, 0x7bef, 0x6b6c,
-  0xe73c, 0x5aeb, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9ce8, 0xa508,
-  0xd6b8, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee0, 0xe701,
-  0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad55, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x6b6d, 0x7bef, 0xc5d6,
-  0xd69a, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4208, 0x0861, 0x2924, 0xd4af,
-  0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x2124, 0xdeba, 0xef5c,
-  0x5aeb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xdedb, 0xffdf, 0xffff,
-  0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5d, 0xce38, 0xf7be,
-  0xef5d, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe71c, 0xce38, 0xf79e,
-  0xc5f7, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb575, 0xf79e, 0xf79e,
-  0xdedb, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xe73c, 0x9492,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xe73c, 0x9492,
-  0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a, 0xe73c, 0xe73c,
-  0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x9492, 0xef5d,
-  0x5aea, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x840f, 0xd6b9,
-  0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x18e1, 0x2102,
-  0xe701, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x73ae, 0x9450, 0xb575,
-  0xce59, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x5aaa, 0xcc8f, 0x3145,
-  0x10a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a49, 0x8c51, 0xef5c, 0xd6ba,
-  0x2104, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xe71c, 0xce59, 0xf79e,
-  0xad34, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xe71c, 0xce38, 0xf79e,
-  0xbdd7, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x5269, 0xbdf7, 0xf7be, 0xffff,
-  0xef7d, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xdedb, 0xf7be, 0xf7be,
-  0xef7d, 0xd69a, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xbdd7, 0xbdd7,
-  0x5aeb, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71c, 0xef5d,
-  0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x9492, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b6c,
-  0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bcd, 0x9ce9,
-  0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xce41,
-  0x39e2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0x52aa, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x528a, 0xad35, 0xdedb, 0x630c,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4a49, 0x73ae, 0x9471, 0xb575, 0xc638,
-  0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x5a89, 0xbc2d, 0x2924, 0x2945,
-  0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x5a89, 0xad34, 0xd69a,
-  0x2965, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xffdf,
-  0xdefb, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x5aaa, 0xbdd7, 0xffdf,
-  0xf79e, 0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x5249, 0xcc8e, 0xef5c, 0xf7be,
-  0xf79e, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aaa, 0xbdd7, 0xce38,
-  0xef5d, 0xd6ba, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71c, 0xef5d,
-  0x630c, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x9492, 0xe73c,
-  0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8430, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b6c,
-  0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bcd, 0x9ce9,
-  0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xce41,
-  0x39e2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x5a89, 0xcc6e, 0x2104,
-  0x2145, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xd6bb, 0x2ab4,
-  0xbdf8, 0x3185, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4a69, 0xb575, 0xe75f, 0x235e,
-  0xb5d9, 0xdeda, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbdb5, 0xdf1e, 0x233e,
-  0xb577, 0xef5d, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5269, 0xd4af, 0xb597, 0x337d,
-  0xdd53, 0xef1b, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aaa, 0xbdb6, 0xef7f,
-  0xf79d, 0xb575, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xe73c, 0xf79e,
-  0xef7d, 0x5acb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdedb, 0x738e,
-  0xdebb, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x52aa, 0xad55, 0x5aeb,
-  0xad55, 0x52aa, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0x9ce8, 0xa512, 0x9ce9,
-  0xa512, 0x9ce8, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x31a1, 0xce41,
-  0x31a1, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4a28, 0x5248, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x3a08, 0x5269, 0xccaf, 0x83ef, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x52aa, 0xdeda, 0x6b0b, 0xc44d, 0x20e4,
-  0x2145, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x52aa, 0xdf1c, 0x6b4d, 0xa514, 0x2a73,
-  0xbdf9, 0x3186, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x528a, 0xdedb, 0xb5b6, 0xdf1d, 0x235e,
-  0xb5b8, 0xd699, 0x5aeb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4a49, 0x528a, 0x630b, 0xd6fd, 0x235f,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdf1d, 0x3bbe,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe75d, 0xef7e,
-  0xed93, 0xde99, 0x5b0c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef7d,
-  0xef5c, 0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x73ae, 0x6b4d,
-  0xe71c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x4a49, 0x528a,
-  0xd69a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5289, 0x4a48,
-  0x632c, 0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce6,
-  0xa508, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0xdee1, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4a28, 0x5248, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x3a08, 0x5269, 0xccaf, 0x83ef, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x52aa, 0xdeda, 0x6b0b, 0xc44d, 0x20e4,
-  0x2145, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x52aa, 0xdf1c, 0x6b4d, 0xa514, 0x2a73,
-  0xbdf9, 0x3186, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x528a, 0xdedb, 0xb5b6, 0xdf1d, 0x235e,
-  0xb5b8, 0xd699, 0x5aeb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4a49, 0x528a, 0x630b, 0xd6fd, 0x235f,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdf1d, 0x3bbe,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe75d, 0xef7e,
-  0xed93, 0xde99, 0x5b0c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef7d,
-  0xef5c, 0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x73ae, 0x6b4d,
-  0xe71c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x4a49, 0x528a,
-  0xd69a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5289, 0x4a48,
-  0x632c, 0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce6,
-  0xa508, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0xdee1, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x5aeb, 0xce79, 0x18e3, 0x31a6,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4a69, 0xad55, 0xe71c, 0x2903, 0x18e3,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4a49, 0x9450, 0xb575, 0xcc90, 0xe6da,
-  0xe71c, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x5269, 0xcc6e, 0x8c51, 0x3ab3, 0x8473,
-  0xef5d, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x62ca, 0xe71b, 0xa578, 0x1afc,
-  0x94d5, 0xef5c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71c, 0xa578, 0x2b5d,
-  0xdefd, 0xe71b, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5289, 0xa557, 0x3bdd, 0xad78,
-  0xd4f0, 0x5aca, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad35, 0xe75e, 0xdefb,
-  0x5aaa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xe73c, 0x630c,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8410, 0xd6bb, 0x630c,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b4c, 0xce79,
-  0x630c, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0xb58a,
-  0xdef7, 0x9488, 0x9cc6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee0, 0xf7a0,
-  0xe722, 0x3180, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0x4208, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x5aeb, 0xce79, 0x18e3, 0x31a6,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4a69, 0xad55, 0xe71c, 0x2903, 0x18e3,
-  0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4a49, 0x9450, 0xb575, 0xcc90, 0xe6da,
-  0xe71c, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x5269, 0xcc6e, 0x8c51, 0x3ab3, 0x8473,
-  0xef5d, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x62ca, 0xe71b, 0xa578, 0x1afc,
-  0x94d5, 0xef5c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71c, 0xa578, 0x2b5d,
-  0xdefd, 0xe71b, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5289, 0xa557, 0x3bdd, 0xad78,
-  0xd4f0, 0x5aca, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad35, 0xe75e, 0xdefb,
-  0x5aaa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xe73c, 0x630c,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8410, 0xd6bb, 0x630c,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x6b4c, 0xce79,
-  0x630c, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0xb58a,
-  0xdef7, 0x9488, 0x9cc6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee0, 0xf7a0,
-  0xe722, 0x3180, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4a28, 0x5248, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x3a08, 0x5269, 0xccaf, 0x83ef, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x52aa, 0xdeda, 0x6b0b, 0xc44d, 0x20e4,
-  0x2145, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x52aa, 0xdf1c, 0x6b4d, 0xa514, 0x2a73,
-  0xbdf9, 0x3186, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x528a, 0xdedb, 0xb5b6, 0xdf1d, 0x235e,
-  0xb5b8, 0xd699, 0x5aeb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4a49, 0x528a, 0x630b, 0xd6fd, 0x235f,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdf1d, 0x3bbe,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe75d, 0xef7e,
-  0xed93, 0xde99, 0x5b0c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef7d,
-  0xef5c, 0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x73ae, 0x6b4d,
-  0xe71c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x4a49, 0x528a,
-  0xd69a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5289, 0x4a48,
-  0x632c, 0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce6,
-  0xa508, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0xdee1, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4a28, 0x5248, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x3a08, 0x5269, 0xccaf, 0x83ef, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x52aa, 0xdeda, 0x6b0b, 0xc44d, 0x20e4,
-  0x2145, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x52aa, 0xdf1c, 0x6b4d, 0xa514, 0x2a73,
-  0xbdf9, 0x3186, 0x39e7, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x528a, 0xdedb, 0xb5b6, 0xdf1d, 0x235e,
-  0xb5b8, 0xd699, 0x5aeb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4a49, 0x528a, 0x630b, 0xd6fd, 0x235f,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdf1d, 0x3bbe,
-  0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe75d, 0xef7e,
-  0xed93, 0xde99, 0x5b0c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef7d,
-  0xef5c, 0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x73ae, 0x6b4d,
-  0xe71c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x4a49, 0x528a,
-  0xd69a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5289, 0x4a48,
-  0x632c, 0xd6ba, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce6,
-  0xa508, 0xded9, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0xdee1, 0x39c2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x738e, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x62cb, 0xcc8e, 0x20e4,
-  0x2945, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a69, 0xb555, 0xe6fc, 0x2a94,
-  0xce9b, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a69, 0xbdb6, 0xe75f, 0x235e,
-  0xb5d9, 0xef7d, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xb596, 0xdf1e, 0x1b3e,
-  0xad98, 0xef1b, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4a69, 0xad34, 0xc5f7, 0xad98, 0x2b9e,
-  0xb597, 0xdd10, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x5249, 0xd4d0, 0xe6fb, 0xc618, 0xe75e,
-  0xf79e, 0xb554, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4a28, 0x5249, 0x630c, 0xe73c, 0xffff,
-  0xe71c, 0x5acb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4a69, 0xbdd7, 0xef5d,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb576, 0xef5d,
-  0x528a, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x8c71, 0xdefb,
-  0x632c, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0xad4b,
-  0xce77, 0xa508, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xc620,
-  0x39e2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xad35, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4a49, 0x738e, 0x9450, 0xb575,
-  0xc638, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x62cb, 0xcc8e, 0x20e4,
-  0x2145, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a69, 0xb555, 0xe6fc, 0x2a94,
-  0xc65a, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4a69, 0xbdb6, 0xe75e, 0x3bff,
-  0xdedc, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4a69, 0xb596, 0xf7bf, 0xef3d,
-  0xdd31, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4a69, 0xbdd7, 0xef7d, 0xc617,
-  0xc5f7, 0xdeba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xd6ba, 0xbdf7, 0xc618,
-  0xf75d, 0xdd10, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0x8c51, 0xe71c,
-  0xef7d, 0x62ca, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x6b4d,
-  0xdefb, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x5acb,
-  0xdefb, 0x52ab, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x630b,
-  0xe71c, 0x5aeb, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bcd, 0xa509,
-  0xded8, 0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xce41,
-  0x39e2, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x31a6,
-  0x18e3, 0xce79, 0x62eb, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x18e3,
-  0x2903, 0xe6fb, 0xad55, 0x4a69, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x630c, 0xe71c, 0xe6da,
-  0xcc90, 0xb575, 0x9450, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xe71c, 0xef7d, 0x8474,
-  0x3ab3, 0x8c51, 0xcc6e, 0x5269, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5c, 0x94f5, 0x1afc,
-  0xa557, 0xe71b, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71b, 0xdf1d, 0x2b7d,
-  0xa578, 0xe71c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca, 0xd4f0, 0xad78,
-  0x3bdd, 0xad57, 0x5289, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x5aaa, 0xdefb,
-  0xe75e, 0xad55, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c,
-  0xe73c, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x5aec,
-  0xd6bb, 0x8410, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x630c, 0xce79,
-  0x6b4c, 0x7bcf, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc6, 0x9488, 0xdef7, 0xb58a,
-  0x9cc7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee0, 0x3180, 0xe722, 0xf7a0,
-  0xdee0, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4208, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x31a6,
-  0x18e3, 0xce79, 0x62eb, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x18e3,
-  0x2903, 0xe6fb, 0xad55, 0x4a69, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x630c, 0xe71c, 0xe6da,
-  0xcc90, 0xb575, 0x9450, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xe71c, 0xef7d, 0x8474,
-  0x3ab3, 0x8c51, 0xcc6e, 0x5269, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5c, 0x94f5, 0x1afc,
-  0xa557, 0xe71b, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71b, 0xdf1d, 0x2b7d,
-  0xa578, 0xe71c, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca, 0xd4f0, 0xad78,
-  0x3bdd, 0xad57, 0x5289, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x5aaa, 0xdefb,
-  0xe75e, 0xad55, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c,
-  0xe73c, 0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x5aec,
-  0xd6bb, 0x8410, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x630c, 0xce79,
-  0x6b4c, 0x7bcf, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc6, 0x9488, 0xdef7, 0xb58a,
-  0x9cc7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee0, 0x3180, 0xe722, 0xf7a0,
-  0xdee0, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x5249, 0x4a28, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d, 0x840f,
-  0xc5d6, 0xdeda, 0xd4f0, 0x5269, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x18e4, 0x18c3,
-  0xc46e, 0x734d, 0xdeda, 0x52aa, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x39e7, 0x3185, 0xbe19, 0x2a94,
-  0xa514, 0x6b4c, 0xdf1c, 0x52cb, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x5aeb, 0xd699, 0xb5b8, 0x235e,
-  0xdefd, 0xbdb6, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x52aa, 0xdedb, 0x9cf3, 0xa536, 0x235f,
-  0xd6fd, 0x630b, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x52aa, 0xdedb, 0x9cd3, 0xad36, 0x3bbe,
-  0xdf1d, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xde99, 0xed93, 0xef7e,
-  0xe75d, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x630c, 0xef3c, 0xf77d,
-  0xb596, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a, 0xe71c, 0x6b4d,
-  0x73ae, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xd69a, 0x528a,
-  0x4a49, 0x73ae, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5aca, 0xd6ba, 0x632c, 0x4a48,
-  0x5289, 0x7bcf, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xded9, 0xa508, 0x9ce6,
-  0x9cc7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2, 0xdee1, 0xf7a0,
-  0xdee1, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x5249, 0x4a28, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d, 0x840f,
-  0xc5d6, 0xdeda, 0xd4f0, 0x5269, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x39e7, 0x18e4, 0x18c3,
-  0xc46e, 0x734d, 0xdeda, 0x52aa, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x39e7, 0x3185, 0xbe19, 0x2a94,
-  0xa514, 0x6b4c, 0xdf1c, 0x52cb, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x5aeb, 0xd699, 0xb5b8, 0x235e,
-  0xdefd, 0xbdb6, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x52aa, 0xdedb, 0x9cf3, 0xa536, 0x235f,
-  0xd6fd, 0x630b, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x52aa, 0xdedb, 0x9cd3, 0xad36, 0x3bbe,
-  0xdf1d, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xde99, 0xed93, 0xef7e,
-  0xe75d, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x630c, 0xef3c, 0xf77d,
-  0xb596, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a, 0xe71c, 0x6b4d,
-  0x73ae, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xd69a, 0x528a,
-  0x4a49, 0x73ae, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5aca, 0xd6ba, 0x632c, 0x4a48,
-  0x5289, 0x7bcf, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xded9, 0xa508, 0x9ce6,
-  0x9cc7, 0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2, 0xdee1, 0xf7a0,
-  0xdee1, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x6b6d, 0x840f,
-  0xc5d6, 0xd679, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4208, 0x18e4, 0x18c3,
-  0xccaf, 0x6b2c, 0x4229, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x52aa, 0xc65a, 0x2a94,
-  0xdefc, 0xad55, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdedc, 0x3bff,
-  0xe75f, 0xbdb6, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x62cb, 0xdd31, 0xe73d,
-  0xf7bf, 0xb596, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xdeba, 0xc5f7, 0xc617,
-  0xef7d, 0xbdd7, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x5269, 0xdd10, 0xf75d, 0xc618,
-  0xbdd7, 0xd6ba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aca, 0xef7d, 0xe73c,
-  0x8c51, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xdefb, 0x6b4d,
-  0x73ae, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdefb, 0x5acb,
-  0x73ae, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aea, 0xe71c, 0x630b,
-  0x7bce, 0x5289, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa509, 0xded9, 0xa509,
-  0x7bcd, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x39c2, 0xce41,
-  0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x6b6d, 0x840f,
-  0xc5d6, 0xd679, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4a49, 0x528a, 0x2104, 0x18c3,
-  0xccaf, 0x6b2c, 0x4229, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xe71b, 0xce9b, 0x2a94,
-  0xdefc, 0xad55, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef7d, 0xb5d9, 0x235e,
-  0xe75f, 0xbdb6, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef1b, 0xad98, 0x1b3e,
-  0xdf1e, 0xbdb6, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x5269, 0xdd10, 0xb597, 0x2b9e,
-  0xad98, 0xc5f7, 0xad34, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb534, 0xf79e, 0xe75e,
-  0xc618, 0xe6fb, 0xd4d0, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xe71c, 0xffff,
-  0xe73c, 0x630c, 0x5249, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x630c, 0xef5d,
-  0xbdd7, 0x4a69, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x528a, 0xef5d,
-  0xb596, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x632c, 0xdefb,
-  0x8c71, 0x4a69, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa508, 0xce77, 0xad4b,
-  0x7bed, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe701, 0x39e2, 0xc620,
-  0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x5249, 0x4228, 0x528a, 0xad55, 0xdedb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x39e7, 0x5269, 0xcc8e, 0x5289, 0x6b4d, 0x840f, 0xc5d6,
-  0xd69a, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x39e7, 0x52aa, 0xe6fb, 0x630c, 0x18e4, 0x18c3, 0xcc8f,
-  0x62eb, 0x5249, 0x4a28, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x39e7, 0x52aa, 0xdefb, 0xe71c, 0xd6bb, 0x2a94, 0xd6bb,
-  0x734c, 0xcc8e, 0x5269, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4a49, 0x528a, 0x632c, 0xd6fd, 0x237f, 0xceff,
-  0xef5d, 0xdeda, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x5269, 0xa556, 0x233e, 0x2b7e,
-  0xb5b8, 0x6b2c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad55, 0xad77, 0xb5b8,
-  0xdefb, 0xa514, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xad34, 0x9492, 0xe6fb,
-  0x630c, 0x4a69, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4208, 0x4a6a, 0xa514, 0x6b4d, 0xe71c,
-  0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x52a9, 0xa533, 0x8c71, 0xef5c,
-  0xdefb, 0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0xa508, 0x7bed, 0xa52a,
-  0xad53, 0x9ce8, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee0, 0x3181, 0xc620,
-  0x31a1, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x5269, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x62ca, 0xcc8f, 0xbd75, 0xd6ba,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x630c, 0xce59, 0x840f, 0x83ef, 0xc5d6,
-  0xce79, 0x528a, 0x528a, 0x5aaa, 0x5269, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x528a, 0xdedb, 0x6b6d, 0x18e4, 0x18c3, 0xbc2e,
-  0x6b4c, 0x630c, 0xe71c, 0xe6fb, 0xcc8e, 0x4a28, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x528a, 0xdefb, 0xe71c, 0xd6bb, 0x1213, 0x2254,
-  0xdefc, 0xe71c, 0xe71c, 0x630c, 0x5269, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4a49, 0x528a, 0x632c, 0xdf3e, 0x12ff, 0x0ade,
-  0xdf1e, 0x632c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4208, 0x630c, 0xd6dc, 0x237f, 0x237f,
-  0xd6dc, 0x630b, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x528a, 0xce59, 0x94d3, 0xe73e, 0xe73e,
-  0x9cf3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4a49, 0x528a, 0x5acb, 0xef5d, 0xf79e,
-  0x9492, 0xd6ba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4a69, 0xbdd7, 0xef5d,
-  0x5acb, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x8c71, 0xe73c,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x7bcf, 0xce7a,
-  0x5aca, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x94a6, 0x2941, 0x3182,
-  0x94a6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf780, 0xe720, 0xe700,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x5269, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x62cb, 0xcc8f, 0xbd75, 0xd6bb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x630c, 0xce59, 0x840f, 0x83ef, 0xc5d6,
-  0xce79, 0x528a, 0x528a, 0x5aaa, 0x5269, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x52aa, 0xdedb, 0x6b6d, 0x18e4, 0x18c3, 0xbc2e,
-  0x6b4c, 0x630c, 0xe71c, 0xe6fb, 0xcc8e, 0x5249, 0x39c7, 0x0020,
-  0x0020, 0x39e7, 0x52aa, 0xdefb, 0xe71c, 0xd6bb, 0x1213, 0x2254,
-  0xdefc, 0xe71c, 0xe71c, 0x630c, 0x5269, 0x4a28, 0x4208, 0x0020,
-  0x0020, 0x39e7, 0x4a49, 0x528a, 0x632c, 0xdf3e, 0x12ff, 0x0ade,
-  0xdf1e, 0x632c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4208, 0x630c, 0xd6dc, 0x237f, 0x237f,
-  0xd6dc, 0x630b, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x528a, 0xce59, 0x94d3, 0xe73e, 0xe73e,
-  0x9cf3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4a49, 0x528a, 0x5acb, 0xef5d, 0xf79e,
-  0x9492, 0xd6ba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4a69, 0xbdd7, 0xef5d,
-  0x5acb, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x8c71, 0xef5c,
-  0x5aea, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x840f, 0xd6b9,
-  0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x18e1, 0x2102,
-  0xe701, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x5269, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x62cb, 0xcc8f, 0xbd75, 0xd6bb,
-  0x630c, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x630c, 0xce59, 0x840f, 0x83ef, 0xc5d6,
-  0xce79, 0x528a, 0x528a, 0x5aaa, 0x5269, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x52aa, 0xdedb, 0x6b6d, 0x18e4, 0x18c3, 0xbc2e,
-  0x6b4c, 0x630c, 0xe71c, 0xe6fb, 0xcc8e, 0x5249, 0x39c7, 0x0020,
-  0x0020, 0x39e7, 0x52aa, 0xdefb, 0xe71c, 0xd6bb, 0x1213, 0x2254,
-  0xdefc, 0xe71c, 0xe71c, 0x630c, 0x5269, 0x4a28, 0x4208, 0x0020,
-  0x0020, 0x39e7, 0x4a49, 0x528a, 0x632c, 0xdf3e, 0x12ff, 0x0ade,
-  0xdf1e, 0x632c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4208, 0x630c, 0xd6dc, 0x237f, 0x237f,
-  0xd6dc, 0x630b, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x528a, 0xce59, 0x94d3, 0xe73e, 0xe73e,
-  0x9cf3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4a49, 0x528a, 0x5acb, 0xef5d, 0xf79e,
-  0x9492, 0xd6ba, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x4a69, 0xbdd7, 0xef5d,
-  0x5acb, 0x528a, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596, 0xef5d,
-  0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x4a69, 0x8c71, 0xef5c,
-  0x5aea, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x840f, 0xd6b9,
-  0xa529, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xe700, 0x18e1, 0x2102,
-  0xe701, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a,
-  0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4a28, 0x5248, 0x528a, 0xad55,
-  0xdedb, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x5269, 0xcc8f, 0x7bae, 0x7bef,
-  0xc5d6, 0xce79, 0x528a, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x52aa, 0xdeba, 0x2104, 0x20e3,
-  0xc44e, 0x6b4c, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xdf1c, 0x632c, 0x94b3,
-  0x3ad4, 0xc65a, 0x630c, 0x4208, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x528a, 0xdedb, 0xbdb6, 0xdf1e,
-  0x233e, 0xb5b8, 0xdeba, 0x630c, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x4a49, 0x528a, 0x630b, 0xd6fd,
-  0x235f, 0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x52aa, 0xdf1d,
-  0x3bbe, 0xa536, 0x9cd3, 0xdedb, 0x52aa, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xe73d,
-  0xef5e, 0xedb3, 0xde99, 0x5b0c, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0xb596,
-  0xffde, 0xe6fb, 0x62eb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a69, 0x8c51,
-  0xe73c, 0x630c, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x738e, 0x5aeb,
-  0xdedb, 0x5acb, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5aca,
-  0xad54, 0x73ae, 0x4a69, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc8,
-  0x9cc7, 0x31a2, 0x9486, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1,
-  0xf780, 0xe720, 0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0x4a49, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x5aeb, 0xd69a, 0x52aa, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x39e7, 0x4a69, 0xad55, 0xe73c, 0x52aa, 0x39e7,
-  0x39e8, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4a49, 0x8c30, 0xad55, 0x4228, 0x0020,
-  0x18a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x5269, 0xd4f0, 0x9451, 0x18e3, 0x18c2,
-  0xb3cc, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x528a, 0xdeda, 0xdefb, 0xad75, 0x94b4,
-  0x32d4, 0xce7a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0x6b4d, 0xa535, 0x2274,
-  0x0abc, 0xb5d9, 0xe6fb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x528a, 0xd6ba, 0x8452, 0x09d3,
-  0x0abd, 0xb597, 0xe6fb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x52aa, 0xef3c, 0x8c72, 0x1a74,
-  0x233d, 0xccd1, 0x62ca, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xdedb, 0xc618, 0xe75e,
-  0xe75e, 0xad34, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5aeb, 0xe73c, 0xf79e,
-  0xf79e, 0x6b4d, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xa514, 0x6b4d,
-  0xe71c, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0x73ae, 0x528a, 0x4208,
-  0x630c, 0xdefb, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a48, 0x5289, 0x7bcf, 0x5289, 0x4a48,
-  0x52a9, 0xad55, 0x52aa, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed, 0x9cc7, 0x9ce6,
-  0x9ce8, 0xa512, 0x9ce8, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181, 0xdee1, 0xf7a0,
-  0xdee1, 0x3181, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x528a, 0x4a49, 0x4228, 0x4208,
-  0x39e8, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x5aeb, 0xd6ba, 0x52aa, 0x39c7, 0x0841,
-  0x18a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4a69, 0xad55, 0xe73c, 0x528a, 0x0841, 0x18c2,
-  0xb3cc, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x39e7, 0x4a49, 0x8410, 0xb555, 0x4a69, 0x5269, 0x8c73,
-  0x3ad5, 0xce7a, 0x630c, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x39e7, 0x4228, 0x5a89, 0xcc8f, 0x62eb, 0x9cd3, 0x2274,
-  0x0abc, 0xb5d9, 0xe6fb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4a69, 0xad14, 0xb575, 0x8411, 0x09d3,
-  0x0abd, 0xb597, 0xe6fb, 0x52aa, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x52aa, 0xa514, 0x8431, 0x2274,
-  0x233d, 0xccd1, 0x62ca, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x52aa, 0xb5b6, 0xef5e,
-  0xe75e, 0xad34, 0x4a49, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xe71c, 0xf79e,
-  0xf79e, 0x6b4d, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0xad55, 0x6b4d,
-  0xe71c, 0xe71c, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a6a, 0x9cd3, 0x528a,
-  0x5aec, 0xdefb, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x5aca, 0x73ae,
-  0x5aca, 0xad55, 0x52aa, 0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9cc7, 0x7bed,
-  0x9cc9, 0xa512, 0x9ce8, 0x9ce6, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1, 0x3181,
-  0xce41, 0x31a1, 0xdee1, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x39e8, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0841,
-  0x18a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4208, 0x18c3, 0x1082,
-  0xbc0c, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x630b, 0xbe19, 0x2a94,
-  0xad35, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xdeda, 0x8c93, 0x1b1d,
-  0xcebc, 0x52aa, 0x4228, 0x528a, 0x52aa, 0x4228, 0x39e7, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5c, 0x8c94, 0x2b3c,
-  0xa556, 0x5289, 0x528a, 0xad55, 0xdedb, 0x630c, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xdefb, 0xef5c, 0xdd53,
-  0xb554, 0x62ca, 0x73ae, 0x8430, 0xb5b6, 0xd69a, 0x528a, 0x39e7,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xbdd7, 0xf77d,
-  0xcdf7, 0xc46e, 0x5289, 0x4a49, 0x4a69, 0x52aa, 0x4a49, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0xad55, 0xef9e,
-  0xef5d, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0x9492,
-  0xe73c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4229, 0x8410,
-  0xe73c, 0x5acb, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aeb,
-  0xe73c, 0x8431, 0x5289, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa508,
-  0xd6b9, 0x94af, 0x8427, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1,
-  0x39c2, 0xc621, 0x31a0, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x39e8, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0841,
-  0x18a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4208, 0x18c3, 0x1082,
-  0xbc0c, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x630b, 0xbe19, 0x2a94,
-  0xad35, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xdeda, 0x8c93, 0x1b1d,
-  0xcebc, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5c, 0x8c94, 0x2b3c,
-  0xa556, 0x5289, 0x4228, 0x4228, 0x4228, 0x528a, 0x73ae, 0x2104,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xdefb, 0xef5c, 0xdd53,
-  0xb554, 0x5aaa, 0x4228, 0x4228, 0x4a49, 0x73ae, 0xad55, 0xd6ba,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xbdd7, 0xf77d,
-  0xcdf7, 0xc46e, 0x5249, 0x4228, 0x4228, 0x4a69, 0x528a, 0x52aa,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0xad55, 0xef9e,
-  0xef5d, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0x9492,
-  0xe73c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4229, 0x8410,
-  0xe73c, 0x5acb, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aeb,
-  0xe73c, 0x8431, 0x5289, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa508,
-  0xd6b9, 0x94af, 0x8427, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1,
-  0x39c2, 0xc621, 0x31a0, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x39e8, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020, 0x0000,
-  0x0000, 0x0841, 0x4208, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0841,
-  0x18a2, 0x4208, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841, 0x0000,
-  0x0020, 0x39c7, 0x4228, 0x4228, 0x4228, 0x4208, 0x18c3, 0x1082,
-  0xbc0c, 0x5269, 0x4228, 0x4228, 0x4228, 0x4228, 0x39c7, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x4228, 0x630b, 0xbe19, 0x2a94,
-  0xad35, 0x528a, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0020, 0x4208, 0x4228, 0x4228, 0x52aa, 0xdeda, 0x8c93, 0x1b1d,
-  0xcebc, 0x52aa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0020,
-  0x0841, 0x4208, 0x4228, 0x4228, 0x52aa, 0xef5c, 0x8c94, 0x2b3c,
-  0xa556, 0x5289, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208, 0x0841,
-  0x4208, 0x4228, 0x4228, 0x4228, 0x528a, 0xdefb, 0xef5c, 0xdd53,
-  0xb554, 0x5aaa, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4208,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x5acb, 0xbdd7, 0xf77d,
-  0xcdf7, 0xc46e, 0x5249, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4a49, 0xad55, 0xef9e,
-  0xef5d, 0x62cb, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x528a, 0x9492,
-  0xe73c, 0x52aa, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228, 0x4229, 0x8410,
-  0xe73c, 0x5acb, 0x4208, 0x4228, 0x4228, 0x4228, 0x4228, 0x4228,
-  0x4a48, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a48, 0x5aeb,
-  0xe73c, 0x8431, 0x5289, 0x4a68, 0x4a68, 0x4a68, 0x4a68, 0x4a68,
-  0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce6, 0xa508,
-  0xd6b9, 0x94af, 0x8427, 0x9cc7, 0x9ce7, 0x9ce7, 0x9ce7, 0x9ce7,
-  0xf780, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0, 0xdee1,
-  0x39c2, 0xc621, 0x31a0, 0xdee0, 0xf7a0, 0xf7a0, 0xf7a0, 0xf7a0,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ae,
-  0xdbeb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xf50f, 0xecef,
-  0xe510, 0xe4f0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecce, 0xecce, 0xdbcb,
-  0xb2e8, 0xbb09, 0xed51, 0xccb1, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdb8a, 0xecce, 0xecef,
-  0xe531, 0xed31, 0xdcd0, 0x22fc, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xd38a, 0xecae,
-  0xecce, 0xecce, 0xbb8e, 0x0abe, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe46d, 0xbac7, 0xb287,
-  0xaa87, 0xc38c, 0x2afb, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6b, 0xecad, 0xcb6a,
-  0x298b, 0x8410, 0xa558, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f0, 0xcc4f, 0xbb4b,
-  0x218c, 0xad56, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xb576, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ce,
-  0xe3eb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xecef, 0xdc8e,
-  0xd4d0, 0xd4d0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecae, 0xd3aa, 0x28c2,
-  0x2081, 0x3103, 0xdd11, 0xccb2, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdbaa, 0xe46d, 0xa287,
-  0xa266, 0xcb6a, 0xdc8f, 0x22fd, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xd38a, 0xe48d,
-  0xe510, 0xed10, 0xbbae, 0x0abd, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe46d, 0xbac7, 0xb2a7,
-  0xaaa7, 0xc38c, 0x2afb, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6b, 0xecad, 0xcb6a,
-  0x298b, 0x8410, 0xa558, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f0, 0xcc4f, 0xbb4b,
-  0x218c, 0xad56, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xb576, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ce,
-  0xe3eb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xf4ef, 0xdc8e,
-  0xd4d0, 0xd4d0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecae, 0xd38a, 0x20a1,
-  0x1061, 0x20c2, 0xdd11, 0xccb2, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdb8a, 0xcb49, 0x1861,
-  0x0800, 0x1881, 0xccd1, 0x231d, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xcb49, 0xa286,
-  0xa266, 0xaaa7, 0xd46f, 0x12de, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe44d, 0xbae8, 0xe46d,
-  0xe510, 0xed10, 0xcbcd, 0x0abd, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6c, 0xec8d, 0xbac7,
-  0xa287, 0xd40c, 0xb556, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f1, 0xcc4f, 0xbb2b,
-  0x29ab, 0xb555, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xad76, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ae,
-  0xe3eb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xf50f, 0xecef,
-  0xd4f0, 0xd4d0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecce, 0xf4ef, 0xcb8a,
-  0x18a2, 0x18c2, 0xdd11, 0xccb2, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdbaa, 0xecae, 0xcb8a,
-  0x1840, 0x1861, 0xccd1, 0x231d, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xdbaa, 0xec8e,
-  0xaaa7, 0xaaa7, 0xd46f, 0x12de, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe44d, 0xbae8, 0xe48d,
-  0xe510, 0xed10, 0xcbcd, 0x0abd, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6c, 0xec8d, 0xbac7,
-  0xa287, 0xd40c, 0xb556, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f1, 0xcc4f, 0xbb2b,
-  0x29ab, 0xb555, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xad76, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ae,
-  0xe3eb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xf50f, 0xeccf,
-  0xd4d0, 0xd4d0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecce, 0xf4ef, 0xd3aa,
-  0x28c2, 0x28e3, 0xdd10, 0xccb2, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdb8a, 0xecce, 0xecae,
-  0xa287, 0xa286, 0xdc8f, 0x231d, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xd38a, 0xecae,
-  0xe510, 0xe510, 0xbbae, 0x0abd, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe46d, 0xbac7, 0xb287,
-  0xaaa7, 0xc3ac, 0x2afb, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6b, 0xecad, 0xcb6a,
-  0x298b, 0x8410, 0xa558, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f0, 0xcc4f, 0xbb4b,
-  0x218c, 0xad56, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xb576, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f,
-  0x02bf, 0x027d, 0x0022, 0x0000, 0x0000, 0x0000, 0x0000, 0x1040,
-  0x0000, 0x0000, 0x1040, 0x0000, 0x0022, 0x027d, 0x02bf, 0x02bf,
-  0x02bf, 0x025a, 0x0022, 0x0000, 0x0000, 0x0820, 0x1040, 0xaae8,
-  0x20a1, 0x0840, 0xaae8, 0x1861, 0x0022, 0x025a, 0x02bf, 0x02bf,
-  0x027c, 0x0065, 0x0000, 0x0000, 0x0820, 0x89e5, 0x30e3, 0xdd10,
-  0xd46d, 0x3923, 0xdc4d, 0xa266, 0x0820, 0x0044, 0x027d, 0x02bf,
-  0x027c, 0x0022, 0x0000, 0x1040, 0x0820, 0xbb09, 0xe4cf, 0xdd11,
-  0xdcf0, 0xcc4d, 0xdc6d, 0xbb29, 0x1062, 0x0022, 0x027c, 0x02bf,
-  0x027c, 0x0023, 0x2061, 0x9a87, 0x1861, 0x20e3, 0xc5f7, 0x2103,
-  0x1082, 0x1081, 0x1061, 0x1083, 0x0217, 0x0064, 0x027c, 0x02bf,
-  0x027c, 0x1083, 0xaac7, 0x30c2, 0xaac8, 0x1040, 0x0862, 0x0041,
-  0x39c7, 0x39e8, 0x0020, 0x0022, 0x023a, 0x00a7, 0x027c, 0x02bf,
-  0x023a, 0x1083, 0xaac7, 0x30c2, 0xbb09, 0x20a2, 0x1061, 0x4a08,
-  0xd46e, 0xd4b0, 0x49e7, 0x10a4, 0x027c, 0x029d, 0x029f, 0x02bf,
-  0x0022, 0x0000, 0x1861, 0xbb08, 0xdbaa, 0xdc8e, 0xdd10, 0xe4ae,
-  0xdbeb, 0xbb08, 0xd3aa, 0xcc4f, 0x12de, 0x02bf, 0x02bf, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0xa266, 0xdbaa, 0xf4ef, 0xf50f, 0xecef,
-  0xe510, 0xe4f0, 0xed51, 0xe4f0, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0820, 0x9205, 0xd38a, 0xecce, 0xecce, 0xdbcb,
-  0xb2e8, 0xbb09, 0xed51, 0xccb1, 0x12de, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0000, 0x1040, 0xa266, 0xdb8a, 0xecce, 0xecef,
-  0xe531, 0xed31, 0xdcd0, 0x22fc, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x0000, 0x0000, 0x0841, 0x1881, 0xc329, 0xbac7, 0xd38a, 0xecae,
-  0xecce, 0xecce, 0xbb8e, 0x0abe, 0x029f, 0x02bf, 0x029f, 0x02bf,
-  0x0841, 0x1082, 0x6b6d, 0x83cf, 0xcb8b, 0xe46d, 0xbac7, 0xb287,
-  0xaa87, 0xc38c, 0x2afb, 0x029f, 0x029f, 0x029f, 0x029f, 0x02bf,
-  0x7bcf, 0x7bcf, 0x8c71, 0xad55, 0x31cc, 0xbb6b, 0xecad, 0xcb6a,
-  0x298b, 0x8410, 0xa558, 0x235e, 0x12fe, 0x12ff, 0x029f, 0x02bf,
-  0xbdd7, 0xbdd7, 0xbdd7, 0xdf1c, 0x220e, 0x21f0, 0xcc4f, 0xbb4b,
-  0x218c, 0xad56, 0xf79e, 0xe75e, 0xb5d8, 0xd6fe, 0x2b7f, 0x029f,
-  0xf7be, 0xf79e, 0xc618, 0xf79e, 0xa535, 0x118d, 0x11f2, 0x11d1,
-  0x118c, 0xb576, 0xffde, 0xffbe, 0xc617, 0xffbe, 0xd71f, 0x131f
-};
-
-const Animation wowAnimation = {
-  .name = "Wow",
-  .frameCount = 60,
-  .width = 16,
-  .height = 16,
-  .frameDurations = wowDurations,
-  .animationFrames = wowFrames
-};
-#endif // ANIMATION_WOW_H
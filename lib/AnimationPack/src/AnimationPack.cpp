@@ -0,0 +1,222 @@
+#include "AnimationPack.h"
+
+#include <esp_rom_crc.h>
+
+bool AnimationPack::begin(const char* partitionLabel) {
+    if (_lock == nullptr) {
+        _lock = xSemaphoreCreateMutex();
+    }
+    State next;
+    bool loaded = open(partitionLabel, next);
+    publish(next);
+    if (loaded) {
+        Serial.println("Loaded animation pack " + String(sequence()) + " from slot " + String(activeSlot()) + " with " + String(count()) + " animations");
+    }
+    return loaded;
+}
+
+void AnimationPack::end() {
+    publish(State());
+}
+
+void AnimationPack::lock() const {
+    if (_lock != nullptr) {
+        xSemaphoreTake(_lock, portMAX_DELAY);
+    }
+}
+
+void AnimationPack::unlock() const {
+    if (_lock != nullptr) {
+        xSemaphoreGive(_lock);
+    }
+}
+
+// Maps the partition and loads its newest valid pack into state. Without a valid pack the state only
+// keeps the partition, so a pack can still be uploaded into it.
+bool AnimationPack::open(const char* partitionLabel, State& state) const {
+    state.partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ANIMATION_PACK_SUBTYPE, partitionLabel);
+    if (state.partition == nullptr) {
+        Serial.println("Animation pack partition not found");
+        return false;
+    }
+
+    const void* mapped = nullptr;
+#if ESP_IDF_VERSION_MAJOR >= 5
+    esp_err_t err = esp_partition_mmap(state.partition, 0, state.partition->size, ESP_PARTITION_MMAP_DATA, &mapped, &state.mmapHandle);
+#else
+    esp_err_t err = esp_partition_mmap(state.partition, 0, state.partition->size, SPI_FLASH_MMAP_DATA, &mapped, &state.mmapHandle);
+#endif
+    if (err != ESP_OK) {
+        Serial.println("Failed to map animation pack partition");
+        return false;
+    }
+    state.mapped = true;
+
+    // Pick the newest complete pack, an interrupted upload leaves its slot without a valid header
+    uint32_t slotSize = state.partition->size / ANIMATION_PACK_SLOTS;
+    const PackHeader* newest = nullptr;
+    for (uint8_t slot = 0; slot < ANIMATION_PACK_SLOTS; slot++) {
+        const uint8_t* data = (const uint8_t*)mapped + slot * slotSize;
+        const PackHeader* header = validate(data, slotSize);
+        if (header && (newest == nullptr || header->sequence > newest->sequence)) {
+            newest = header;
+            state.activeSlot = slot;
+        }
+    }
+    if (newest == nullptr) {
+        Serial.println("No valid animation pack found");
+        spi_flash_munmap(state.mmapHandle);
+        state.mapped = false;
+        state.activeSlot = -1;
+        return false;
+    }
+
+    state.sequence = newest->sequence;
+    load((const uint8_t*)newest, newest, state);
+    return true;
+}
+
+// Swaps in the new state while no reader holds the pack, then frees what was replaced
+void AnimationPack::publish(const State& state) {
+    lock();
+    State previous = _state;
+    _state = state;
+    unlock();
+    release(previous);
+}
+
+void AnimationPack::release(State& state) {
+    delete[] state.animations;
+    if (state.mapped) {
+        spi_flash_munmap(state.mmapHandle);
+    }
+    state = State();
+}
+
+// Whether count items of T fit at offset in size bytes, aligned for T. Nothing is added to the offset,
+// so a huge offset or count cannot wrap around and pass.
+template <typename T>
+static bool fits(uint32_t offset, uint32_t count, uint32_t size) {
+    return offset <= size && offset % alignof(T) == 0 && count <= (size - offset) / sizeof(T);
+}
+
+const PackHeader* AnimationPack::validate(const uint8_t* data, size_t size) const {
+    const PackHeader* header = (const PackHeader*)data;
+    if (size < sizeof(PackHeader) || memcmp(header->magic, ANIMATION_PACK_MAGIC, sizeof(header->magic)) != 0) {
+        return nullptr;
+    }
+    if (header->version != ANIMATION_PACK_VERSION) {
+        Serial.println("Unsupported animation pack version " + String(header->version));
+        return nullptr;
+    }
+    if (header->size > size || header->size < sizeof(PackHeader)
+        || !fits<PackAnimation>(header->indexOffset, header->animationCount, header->size)
+        || !fits<uint32_t>(header->poolOffsetsOffset, header->poolFrameCount, header->size)
+        || header->poolOffset > header->size) {
+        Serial.println("Animation pack is truncated");
+        return nullptr;
+    }
+    if (esp_rom_crc32_le(0, data + sizeof(PackHeader), header->size - sizeof(PackHeader)) != header->crc32) {
+        Serial.println("Animation pack CRC mismatch");
+        return nullptr;
+    }
+
+    // Every frame starts with at least its flag byte, so a frame may not start at the end of the pool
+    const uint32_t* poolOffsets = (const uint32_t*)(data + header->poolOffsetsOffset);
+    uint32_t poolSize = header->size - header->poolOffset;
+    for (uint32_t i = 0; i < header->poolFrameCount; i++) {
+        if (poolOffsets[i] >= poolSize) {
+            Serial.println("Animation pack frame " + String(i) + " is outside of the pool");
+            return nullptr;
+        }
+    }
+
+    for (uint16_t i = 0; i < header->animationCount; i++) {
+        if (!validateAnimation(data, header, i)) {
+            return nullptr;
+        }
+    }
+    return header;
+}
+
+bool AnimationPack::validateAnimation(const uint8_t* data, const PackHeader* header, uint16_t index) const {
+    const PackAnimation& entry = ((const PackAnimation*)(data + header->indexOffset))[index];
+    const char* error = nullptr;
+    uint32_t pixels = entry.width * entry.height;
+
+    if (memchr(entry.name, 0, sizeof(entry.name)) == nullptr) {
+        error = "has an unterminated name";
+    }
+    else if (entry.frameCount == 0) {
+        error = "has no frames";
+    }
+    else if (pixels == 0 || pixels > _maxPixels) {
+        error = "does not fit the display";
+    }
+    else if (!fits<uint16_t>(entry.durationsOffset, entry.frameCount, header->size)
+             || !fits<uint16_t>(entry.framesOffset, entry.frameCount, header->size)) {
+        error = "has out of bounds frame tables";
+    }
+    else if (entry.bpp != 1 && entry.bpp != 2 && entry.bpp != 4 && entry.bpp != 8
+             && entry.bpp != FRAME_RAW_BPP && entry.bpp != FRAME_NATIVE_BPP) {
+        error = "has an unsupported bit depth";
+    }
+    else if (entry.bpp <= 8 && (entry.paletteOffset == 0 || entry.paletteSize < (1U << entry.bpp)
+                                || !fits<uint16_t>(entry.paletteOffset, entry.paletteSize, header->size))) {
+        error = "has an out of bounds palette";
+    }
+    else if (entry.bpp > 8 && entry.paletteOffset != 0) {
+        error = "has a palette it cannot use";
+    }
+
+    const uint16_t* frames = (const uint16_t*)(data + entry.framesOffset);
+    const uint32_t* poolOffsets = (const uint32_t*)(data + header->poolOffsetsOffset);
+    uint32_t poolSize = header->size - header->poolOffset;
+    if (error == nullptr && entry.bpp == FRAME_NATIVE_BPP && pixels * 3 > poolSize) {
+        error = "has a truncated frame";
+    }
+    const uint8_t* pool = data + header->poolOffset;
+    for (uint16_t f = 0; error == nullptr && f < entry.frameCount; f++) {
+        if (frames[f] >= header->poolFrameCount) {
+            error = "refers to a frame outside of the pool";
+        }
+        // Native frames are copied as they are, all their pixels have to be in the pool
+        else if (entry.bpp == FRAME_NATIVE_BPP && poolOffsets[frames[f]] > poolSize - pixels * 3) {
+            error = "has a truncated frame";
+        }
+        // Encoded frames are read op by op until all pixels are set, the ops may not run past the pool
+        else if (entry.bpp != FRAME_NATIVE_BPP
+                 && encodedFrameSize(pool + poolOffsets[frames[f]], poolSize - poolOffsets[frames[f]], pixels, entry.bpp) == 0) {
+            error = "has a frame that runs past the pool";
+        }
+    }
+
+    if (error != nullptr) {
+        Serial.println("Animation " + String(index) + " " + error);
+        return false;
+    }
+    return true;
+}
+
+void AnimationPack::load(const uint8_t* data, const PackHeader* header, State& state) {
+    const PackAnimation* index = (const PackAnimation*)(data + header->indexOffset);
+    state.animations = new Animation[header->animationCount];
+    state.count = header->animationCount;
+    for (uint16_t i = 0; i < header->animationCount; i++) {
+        const PackAnimation& entry = index[i];
+        state.animations[i] = {
+            .name = entry.name,
+            .frameCount = entry.frameCount,
+            .width = entry.width,
+            .height = entry.height,
+            .bpp = entry.bpp,
+            .transition = entry.transition,
+            .flags = entry.flags,
+            .frameDurations = (const uint16_t*)(data + entry.durationsOffset),
+            .frames = (const uint16_t*)(data + entry.framesOffset),
+            .palette = entry.paletteOffset ? (const uint16_t*)(data + entry.paletteOffset) : nullptr,
+            .pool = data + header->poolOffset,
+            .poolOffsets = (const uint32_t*)(data + header->poolOffsetsOffset),
+        };
+    }
+}
@@ -0,0 +1,102 @@
+#ifndef ANIMATIONPACK_H
+#define ANIMATIONPACK_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "FrameCodec.h"
+
+// Binary animation pack built by scripts/convert.py and stored in its own flash data partition.
+// The partition is memory-mapped, so frames are decoded straight from flash without copying.
+// Layout (little-endian, offsets from the start of the pack, every table 4-byte aligned):
+//   PackHeader | PackAnimation index | durations, frame ids and palettes | pool offsets | pool
+// The partition is split into slots. A new pack is written into a free slot with its header last,
+// so a slot only becomes valid once complete, and the valid slot with the highest sequence wins.
+#define ANIMATION_PACK_PARTITION "anims"
+#define ANIMATION_PACK_SUBTYPE ((esp_partition_subtype_t)0x40)
+#define ANIMATION_PACK_MAGIC "NMPK"
+#define ANIMATION_PACK_VERSION 5
+#define ANIMATION_PACK_NAME_SIZE 28
+#define ANIMATION_PACK_SLOTS 2
+
+struct PackHeader {
+    char magic[4];
+    uint16_t version;
+    uint16_t animationCount;
+    uint32_t poolFrameCount;
+    uint32_t indexOffset;
+    uint32_t poolOffsetsOffset;
+    uint32_t poolOffset;
+    uint32_t size;
+    uint32_t crc32;             // CRC-32 of everything after the header
+    uint32_t sequence;          // Incremented by every upload, the highest valid slot is loaded
+};
+
+struct PackAnimation {
+    char name[ANIMATION_PACK_NAME_SIZE];
+    uint16_t frameCount;
+    uint8_t width;
+    uint8_t height;
+    uint8_t bpp;
+    uint8_t transition;         // Transition into this animation, see TRANSITION_SPEC_* in Transition.h. 0 = default
+    uint16_t paletteSize;       // At least 1 << bpp entries for palette animations, every symbol value is looked up
+    uint32_t flags;             // ANIMATION_FLAG_* from FrameCodec.h
+    uint32_t durationsOffset;   // uint16 per frame, in ms
+    uint32_t framesOffset;
+    uint32_t paletteOffset;     // 0 when the animation is stored as raw RGB565
+};
+
+static_assert(sizeof(PackHeader) == 36, "PackHeader must match the layout written by convert.py");
+static_assert(sizeof(PackAnimation) == 52, "PackAnimation must match the layout written by convert.py");
+
+class AnimationPack {
+public:
+    // Animations larger than maxPixels are rejected, the decoders only have room for that many pixels
+    explicit AnimationPack(uint16_t maxPixels) : _maxPixels(maxPixels) {}
+
+    // Maps the pack partition and loads the newest valid pack. On failure the pack is empty.
+    // The new pack is mapped and checked aside and swapped in under the lock, the old one is unmapped
+    // once no reader holds it.
+    bool begin(const char* partitionLabel = ANIMATION_PACK_PARTITION);
+    void end();
+    uint16_t count() const { return _state.count; }
+    const Animation* animation(uint16_t index) const { return index < _state.count ? &_state.animations[index] : nullptr; }
+
+    // Tasks other than the one calling begin() hold the lock while they read the pack, so it cannot be
+    // unmapped under them. The task that calls begin() and end() reads without it.
+    void lock() const;
+    void unlock() const;
+
+    // Checks the header, CRC and every offset, id and size the decoders rely on, and walks the ops of every
+    // encoded frame, of a pack stored in size bytes of memory. A pack that passes can be played without
+    // reading outside of it.
+    const PackHeader* validate(const uint8_t* data, size_t size) const;
+
+    const esp_partition_t* partition() const { return _state.partition; }
+    uint32_t slotSize() const { return _state.partition ? _state.partition->size / ANIMATION_PACK_SLOTS : 0; }
+    int8_t activeSlot() const { return _state.activeSlot; }
+    uint32_t sequence() const { return _state.sequence; }
+
+private:
+    // Everything begin() replaces at once
+    struct State {
+        const esp_partition_t* partition = nullptr;
+        spi_flash_mmap_handle_t mmapHandle = 0;
+        bool mapped = false;
+        Animation* animations = nullptr;
+        uint16_t count = 0;
+        int8_t activeSlot = -1;
+        uint32_t sequence = 0;
+    };
+
+    bool open(const char* partitionLabel, State& state) const;
+    bool validateAnimation(const uint8_t* data, const PackHeader* header, uint16_t index) const;
+    static void load(const uint8_t* data, const PackHeader* header, State& state);
+    void publish(const State& state);
+    static void release(State& state);
+
+    const uint16_t _maxPixels;
+    State _state;
+    mutable SemaphoreHandle_t _lock = nullptr;
+};
+
+#endif // ANIMATIONPACK_H
@@ -0,0 +1,138 @@
+#include "PackWriter.h"
+
+#include <esp_rom_crc.h>
+
+bool PackWriter::begin(const AnimationPack& pack) {
+    // The slot and sequence have to come from the same pack, the render task may be loading another one
+    pack.lock();
+    _partition = pack.partition();
+    _slotSize = pack.slotSize();
+    int8_t activeSlot = pack.activeSlot();
+    uint32_t activeSequence = pack.sequence();
+    pack.unlock();
+    _error = nullptr;
+    _busy = false;
+    if (_partition == nullptr) {
+        return fail("Animation pack partition not found");
+    }
+
+    // The pack in RAM lags behind flash until the render task handles CMD_RELOAD_PACK. A pack committed
+    // meanwhile holds the other slot, writing either one would erase a pack that is or will be playing.
+    uint32_t newestSequence = 0;
+    int8_t newest = newestSlot(newestSequence);
+    if (activeSlot >= 0 && newest >= 0 && newest != activeSlot) {
+        _busy = true;
+        return fail("The last uploaded pack is still being loaded, try again");
+    }
+    int8_t used = activeSlot >= 0 ? activeSlot : newest;
+    _slotOffset = ((used + 1) % ANIMATION_PACK_SLOTS) * _slotSize;
+    _sequence = max(activeSequence, newestSequence) + 1;
+
+    _received = 0;
+    _crc = 0;
+    _fill = 0;
+    _sectorOffset = 0;
+    return true;
+}
+
+// Slot of the committed header with the highest sequence, -1 if no slot has one. Only the header is
+// read: PackWriter writes it after checking the CRC, so a header in flash marks a complete upload.
+int8_t PackWriter::newestSlot(uint32_t& sequence) const {
+    int8_t newest = -1;
+    for (uint8_t slot = 0; slot < ANIMATION_PACK_SLOTS; slot++) {
+        PackHeader header;
+        if (esp_partition_read(_partition, slot * _slotSize, &header, sizeof(header)) != ESP_OK
+            || memcmp(header.magic, ANIMATION_PACK_MAGIC, sizeof(header.magic)) != 0
+            || header.version != ANIMATION_PACK_VERSION) {
+            continue;
+        }
+        if (newest < 0 || header.sequence > sequence) {
+            newest = slot;
+            sequence = header.sequence;
+        }
+    }
+    return newest;
+}
+
+bool PackWriter::write(const uint8_t* data, size_t len) {
+    if (_error) {
+        return false;
+    }
+    if (_received + len > _slotSize) {
+        return fail("Pack does not fit into the partition slot");
+    }
+
+    // Everything after the header is covered by the CRC
+    if (_received + len > sizeof(PackHeader)) {
+        size_t skip = _received < sizeof(PackHeader) ? sizeof(PackHeader) - _received : 0;
+        _crc = esp_rom_crc32_le(_crc, data + skip, len - skip);
+    }
+    _received += len;
+
+    while (len > 0) {
+        size_t chunk = min(len, (size_t)(PACK_WRITER_SECTOR_SIZE - _fill));
+        memcpy(_sector + _fill, data, chunk);
+        _fill += chunk;
+        data += chunk;
+        len -= chunk;
+        if (_fill == PACK_WRITER_SECTOR_SIZE && !flushSector()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PackWriter::finish() {
+    if (_error) {
+        return false;
+    }
+    if (_fill > 0 && !flushSector()) {
+        return false;
+    }
+
+    PackHeader* header = (PackHeader*)_firstSector;
+    if (_received < sizeof(PackHeader) || memcmp(header->magic, ANIMATION_PACK_MAGIC, sizeof(header->magic)) != 0) {
+        return fail("Not an animation pack");
+    }
+    if (header->version != ANIMATION_PACK_VERSION) {
+        return fail("Unsupported animation pack version");
+    }
+    if (header->size != _received) {
+        return fail("Pack size does not match its header");
+    }
+    if (header->crc32 != _crc) {
+        return fail("Pack CRC mismatch");
+    }
+
+    // Commit: the slot becomes valid, and newer than the active one, once its header is in flash
+    header->sequence = _sequence;
+    size_t firstSectorSize = min(_received, (size_t)PACK_WRITER_SECTOR_SIZE);
+    if (esp_partition_erase_range(_partition, _slotOffset, PACK_WRITER_SECTOR_SIZE) != ESP_OK
+        || esp_partition_write(_partition, _slotOffset, _firstSector, firstSectorSize) != ESP_OK) {
+        return fail("Flash write failed");
+    }
+    return true;
+}
+
+bool PackWriter::fail(const char* error) {
+    if (!_error) {
+        _error = error;
+    }
+    return false;
+}
+
+bool PackWriter::flushSector() {
+    if (_sectorOffset == 0) {
+        // Erase the old header right away so the slot stays invalid until finish() writes the new one
+        memcpy(_firstSector, _sector, _fill);
+        if (esp_partition_erase_range(_partition, _slotOffset, PACK_WRITER_SECTOR_SIZE) != ESP_OK) {
+            return fail("Flash erase failed");
+        }
+    } else if (esp_partition_erase_range(_partition, _slotOffset + _sectorOffset, PACK_WRITER_SECTOR_SIZE) != ESP_OK
+               || esp_partition_write(_partition, _slotOffset + _sectorOffset, _sector, _fill) != ESP_OK) {
+        return fail("Flash write failed");
+    }
+    _sectorOffset += PACK_WRITER_SECTOR_SIZE;
+    _fill = 0;
+    return true;
+}
@@ -0,0 +1,44 @@
+#ifndef PACKWRITER_H
+#define PACKWRITER_H
+
+#include <Arduino.h>
+#include <esp_partition.h>
+#include "AnimationPack.h"
+
+#define PACK_WRITER_SECTOR_SIZE 4096
+
+// Streams a pack into a free slot of the pack partition, one flash sector at a time.
+// The first sector (holding the header) is kept back and written only after the rest of the pack
+// has been written and its CRC checked, so the slot never looks valid until the upload is complete.
+class PackWriter {
+public:
+    // Prepares the slot the active pack is not using, numbered after the newest pack in flash. Fails with
+    // busy() while a committed pack waits to be loaded, as then both slots are taken.
+    bool begin(const AnimationPack& pack);
+    bool write(const uint8_t* data, size_t len);
+    // Flushes the last sector, validates the pack and commits it by writing its header
+    bool finish();
+    const char* error() const { return _error; }
+    bool busy() const { return _busy; }
+    size_t written() const { return _received; }
+
+private:
+    bool fail(const char* error);
+    bool flushSector();
+    int8_t newestSlot(uint32_t& sequence) const;
+
+    const esp_partition_t* _partition = nullptr;
+    uint32_t _slotOffset = 0;
+    uint32_t _slotSize = 0;
+    uint32_t _sequence = 0;
+    size_t _received = 0;
+    uint32_t _crc = 0;
+    uint16_t _fill = 0;           // Bytes buffered in _sector
+    uint32_t _sectorOffset = 0;   // Slot offset of the sector being buffered
+    const char* _error = nullptr;
+    bool _busy = false;
+    uint8_t _firstSector[PACK_WRITER_SECTOR_SIZE];
+    uint8_t _sector[PACK_WRITER_SECTOR_SIZE];
+};
+
+#endif // PACKWRITER_H
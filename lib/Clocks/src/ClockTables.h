@@ -0,0 +1,121 @@
+// Generated by scripts/clock_tables.py, do not edit.
+#ifndef CLOCKTABLES_H
+#define CLOCKTABLES_H
+
+#include <stdint.h>
+
+#define CLOCK_SIZE 16
+#define CLOCK_PIXEL_X(p) ((p) % CLOCK_SIZE)
+#define CLOCK_PIXEL_Y(p) ((p) / CLOCK_SIZE)
+
+// Analog clock face circle
+static constexpr uint8_t CLOCK_FACE[40] = {
+    248, 24, 143, 129, 249, 247, 25, 23, 159, 145, 127, 113, 250, 246, 26, 22, 175, 161, 111, 97,
+    235, 229, 43, 37, 190, 178, 94, 82, 236, 228, 44, 36, 206, 194, 78, 66, 221, 211, 61, 51,
+};
+
+// Hour hand (radius 3), 4 pixels for each of the 60 positions
+#define CLOCK_HOUR_HAND_LENGTH 4
+static constexpr uint8_t CLOCK_HOUR_HAND[240] = {
+    136, 120, 104, 88, 136, 120, 104, 88, 136, 120, 105, 89, 136, 120, 105, 89, 136, 120, 105, 89,
+    136, 120, 105, 89, 136, 121, 106, 136, 136, 121, 106, 136, 136, 121, 106, 136, 136, 121, 106, 136,
+    136, 121, 122, 107, 136, 137, 122, 123, 136, 137, 122, 123, 136, 137, 122, 123, 136, 137, 138, 139,
+    136, 137, 138, 139, 136, 137, 138, 139, 136, 137, 154, 155, 136, 137, 154, 155, 136, 137, 154, 155,
+    136, 137, 154, 155, 136, 153, 170, 136, 136, 153, 170, 136, 136, 153, 170, 136, 136, 153, 170, 136,
+    136, 152, 169, 185, 136, 152, 169, 185, 136, 152, 169, 185, 136, 152, 169, 185, 136, 152, 168, 184,
+    136, 152, 168, 184, 136, 152, 168, 184, 136, 152, 167, 183, 136, 152, 167, 183, 136, 152, 167, 183,
+    136, 151, 167, 182, 136, 151, 166, 136, 136, 151, 166, 136, 136, 151, 166, 136, 136, 151, 166, 136,
+    136, 151, 150, 165, 136, 135, 150, 149, 136, 135, 150, 149, 136, 135, 150, 149, 136, 135, 134, 133,
+    136, 135, 134, 133, 136, 135, 134, 133, 136, 135, 118, 117, 136, 135, 118, 117, 136, 135, 118, 117,
+    136, 119, 118, 101, 136, 119, 102, 136, 136, 119, 102, 136, 136, 119, 102, 136, 136, 119, 102, 136,
+    136, 119, 103, 86, 136, 120, 103, 87, 136, 120, 103, 87, 136, 120, 103, 87, 136, 120, 104, 88,
+};
+
+// Minute hand (radius 5), 6 pixels for each of the 60 positions
+#define CLOCK_MINUTE_HAND_LENGTH 6
+static constexpr uint8_t CLOCK_MINUTE_HAND[360] = {
+    136, 120, 104, 88, 72, 56, 136, 120, 104, 89, 73, 57, 136, 120, 104, 89, 73, 57, 136, 120,
+    105, 89, 74, 58, 136, 120, 105, 89, 74, 58, 136, 121, 105, 90, 74, 136, 136, 121, 106, 90,
+    75, 136, 136, 121, 106, 90, 75, 136, 136, 121, 122, 107, 92, 136, 136, 121, 122, 107, 92, 136,
+    136, 137, 122, 123, 108, 136, 136, 137, 122, 123, 108, 109, 136, 137, 122, 123, 108, 109, 136, 137,
+    138, 123, 124, 125, 136, 137, 138, 123, 124, 125, 136, 137, 138, 139, 140, 141, 136, 137, 138, 155,
+    156, 157, 136, 137, 138, 155, 156, 157, 136, 137, 154, 155, 172, 173, 136, 137, 154, 155, 172, 173,
+    136, 137, 154, 155, 172, 136, 136, 153, 154, 171, 188, 136, 136, 153, 154, 171, 188, 136, 136, 153,
+    169, 186, 203, 136, 136, 153, 169, 186, 203, 136, 136, 152, 169, 185, 202, 136, 136, 152, 169, 185,
+    202, 218, 136, 152, 169, 185, 202, 218, 136, 152, 168, 185, 201, 217, 136, 152, 168, 185, 201, 217,
+    136, 152, 168, 184, 200, 216, 136, 152, 168, 183, 199, 215, 136, 152, 168, 183, 199, 215, 136, 152,
+    167, 183, 198, 214, 136, 152, 167, 183, 198, 214, 136, 151, 167, 182, 197, 136, 136, 151, 167, 182,
+    197, 136, 136, 151, 167, 182, 197, 136, 136, 151, 166, 165, 180, 136, 136, 151, 166, 165, 180, 136,
+    136, 151, 166, 165, 180, 136, 136, 135, 150, 149, 164, 163, 136, 135, 150, 149, 164, 163, 136, 135,
+    134, 149, 148, 147, 136, 135, 134, 149, 148, 147, 136, 135, 134, 133, 132, 131, 136, 135, 134, 117,
+    116, 115, 136, 135, 134, 117, 116, 115, 136, 135, 118, 117, 100, 99, 136, 135, 118, 117, 100, 99,
+    136, 119, 102, 101, 84, 136, 136, 119, 102, 101, 84, 136, 136, 119, 102, 101, 84, 136, 136, 119,
+    102, 86, 69, 136, 136, 119, 102, 86, 69, 136, 136, 119, 102, 86, 69, 136, 136, 120, 103, 87,
+    70, 54, 136, 120, 103, 87, 70, 54, 136, 120, 104, 87, 71, 55, 136, 120, 104, 87, 71, 55,
+};
+
+// Second hand (radius 6), 7 pixels for each of the 60 positions
+#define CLOCK_SECOND_HAND_LENGTH 7
+static constexpr uint8_t CLOCK_SECOND_HAND[420] = {
+    136, 120, 104, 88, 72, 56, 40, 136, 120, 104, 89, 73, 57, 41, 136, 120, 104, 89, 73, 57,
+    41, 136, 120, 105, 89, 73, 58, 42, 136, 120, 105, 89, 74, 58, 136, 136, 121, 105, 90, 74,
+    59, 136, 136, 121, 106, 90, 75, 60, 136, 136, 121, 106, 91, 76, 136, 136, 136, 121, 106, 91,
+    76, 136, 136, 136, 121, 106, 107, 92, 77, 136, 136, 121, 122, 107, 108, 93, 136, 136, 137, 122,
+    123, 108, 109, 136, 136, 137, 122, 123, 124, 109, 110, 136, 137, 138, 139, 124, 125, 126, 136, 137,
+    138, 139, 124, 125, 126, 136, 137, 138, 139, 140, 141, 142, 136, 137, 138, 139, 156, 157, 158, 136,
+    137, 138, 139, 156, 157, 158, 136, 137, 154, 155, 156, 173, 174, 136, 137, 154, 155, 172, 173, 136,
+    136, 153, 154, 171, 172, 189, 136, 136, 153, 170, 171, 188, 205, 136, 136, 153, 170, 187, 204, 136,
+    136, 136, 153, 170, 187, 204, 136, 136, 136, 153, 170, 186, 203, 220, 136, 136, 153, 169, 186, 202,
+    219, 136, 136, 152, 169, 185, 202, 218, 136, 136, 152, 169, 185, 201, 218, 234, 136, 152, 168, 184,
+    201, 217, 233, 136, 152, 168, 184, 201, 217, 233, 136, 152, 168, 184, 200, 216, 232, 136, 152, 168,
+    184, 199, 215, 231, 136, 152, 168, 184, 199, 215, 231, 136, 152, 167, 183, 199, 214, 230, 136, 152,
+    167, 183, 198, 214, 136, 136, 151, 167, 182, 198, 213, 136, 136, 151, 166, 182, 197, 212, 136, 136,
+    151, 166, 181, 196, 136, 136, 136, 151, 166, 181, 196, 136, 136, 136, 151, 166, 165, 180, 195, 136,
+    136, 151, 150, 165, 164, 179, 136, 136, 135, 150, 149, 164, 163, 136, 136, 135, 150, 149, 148, 163,
+    162, 136, 135, 134, 149, 148, 147, 146, 136, 135, 134, 149, 148, 147, 146, 136, 135, 134, 133, 132,
+    131, 130, 136, 135, 134, 117, 116, 115, 114, 136, 135, 134, 117, 116, 115, 114, 136, 135, 118, 117,
+    116, 99, 98, 136, 135, 118, 117, 100, 99, 136, 136, 119, 118, 101, 100, 83, 136, 136, 119, 102,
+    101, 84, 67, 136, 136, 119, 102, 85, 68, 136, 136, 136, 119, 102, 85, 68, 136, 136, 136, 119,
+    102, 86, 69, 52, 136, 136, 119, 103, 86, 70, 53, 136, 136, 120, 103, 87, 70, 54, 136, 136,
+    120, 103, 87, 71, 54, 38, 136, 120, 104, 87, 71, 55, 39, 136, 120, 104, 87, 71, 55, 39,
+};
+
+// Ring of 16x16 pixels, 60 positions clockwise from the top center
+#define CLOCK_RING16_POSITIONS 60
+static constexpr uint8_t CLOCK_RING16[60] = {
+    8, 9, 10, 11, 12, 13, 14, 15, 31, 47, 63, 79, 95, 111, 127, 143, 159, 175, 191, 207,
+    223, 239, 255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240, 224, 208,
+    192, 176, 160, 144, 128, 112, 96, 80, 64, 48, 32, 16, 0, 1, 2, 3, 4, 5, 6, 7,
+};
+
+// Ring of 14x14 pixels, 52 positions clockwise from the top center
+#define CLOCK_RING14_POSITIONS 52
+static constexpr uint8_t CLOCK_RING14[52] = {
+    24, 25, 26, 27, 28, 29, 30, 46, 62, 78, 94, 110, 126, 142, 158, 174, 190, 206, 222, 238,
+    237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 209, 193, 177, 161, 145, 129, 113,
+    97, 81, 65, 49, 33, 17, 18, 19, 20, 21, 22, 23,
+};
+
+// Ring of 12x12 pixels, 44 positions clockwise from the top center
+#define CLOCK_RING12_POSITIONS 44
+static constexpr uint8_t CLOCK_RING12[44] = {
+    40, 41, 42, 43, 44, 45, 61, 77, 93, 109, 125, 141, 157, 173, 189, 205, 221, 220, 219, 218,
+    217, 216, 215, 214, 213, 212, 211, 210, 194, 178, 162, 146, 130, 114, 98, 82, 66, 50, 34, 35,
+    36, 37, 38, 39,
+};
+
+// Middle ring position of every minute
+static constexpr uint8_t CLOCK_RING_MINUTE[60] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 6, 7, 8, 9, 10, 11, 12, 12, 13, 14, 15, 16,
+    17, 18, 19, 19, 20, 21, 22, 23, 24, 25, 25, 26, 27, 28, 29, 30, 31, 31, 32, 33,
+    34, 35, 36, 37, 38, 38, 39, 40, 41, 42, 43, 44, 44, 45, 46, 47, 48, 49, 50, 51,
+};
+
+// Inner ring position of every quarter hour (hour % 12 * 4 + minute / 15)
+static constexpr uint8_t CLOCK_RING_QUARTER[48] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 10, 11, 12, 13, 14, 15, 16, 17,
+    18, 19, 20, 21, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43,
+};
+
+#endif // CLOCKTABLES_H
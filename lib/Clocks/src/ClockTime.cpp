@@ -0,0 +1,49 @@
+#include "ClockTime.h"
+
+#include <sys/time.h>
+
+const LocalTime &ClockTime::update(uint32_t now) {
+  _time.changed = 0;
+  if (!_started || now - _secondStart >= 1000) {
+    read(now);
+  }
+  else {
+    _time.ms = now - _secondStart;
+  }
+  return _time;
+}
+
+void ClockTime::read(uint32_t now) {
+  struct timeval wall;
+  gettimeofday(&wall, nullptr);
+  uint16_t ms = wall.tv_usec / 1000;
+
+  if (!_started || wall.tv_sec != _second) {
+    struct tm tm;
+    localtime_r(&wall.tv_sec, &tm);
+    bool valid = wall.tv_sec >= CLOCK_VALID_EPOCH;
+    if (!_started || tm.tm_sec != _time.tm.tm_sec) {
+      _time.changed |= CLOCK_CHANGED_SECOND;
+    }
+    if (!_started || tm.tm_min != _time.tm.tm_min) {
+      _time.changed |= CLOCK_CHANGED_MINUTE;
+    }
+    if (!_started || tm.tm_hour != _time.tm.tm_hour) {
+      _time.changed |= CLOCK_CHANGED_HOUR;
+    }
+    if (valid != _time.valid) {
+      _time.changed |= CLOCK_CHANGED_VALID;
+    }
+    _time.tm = tm;
+    _time.valid = valid;
+    _second = wall.tv_sec;
+    _started = true;
+  }
+  else if (ms < _time.ms) {
+    // millis() ran ahead of the wall clock, hold the count instead of going back
+    ms = _time.ms;
+  }
+
+  _time.ms = ms;
+  _secondStart = now - ms;
+}
@@ -0,0 +1,43 @@
+#ifndef CLOCKTIME_H
+#define CLOCKTIME_H
+
+#include <Arduino.h>
+#include "time.h"
+
+// 2016-01-01, an earlier wall clock was never set. getLocalTime() uses the same limit.
+#define CLOCK_VALID_EPOCH 1451606400
+
+// Bits of LocalTime::changed
+#define CLOCK_CHANGED_SECOND 0x01
+#define CLOCK_CHANGED_MINUTE 0x02
+#define CLOCK_CHANGED_HOUR   0x04
+#define CLOCK_CHANGED_VALID  0x08 // The wall clock was set
+
+// Local time as the clocks draw it
+struct LocalTime {
+  struct tm tm;     // Broken-down local time of the current second
+  uint16_t ms;      // Milliseconds into the current second
+  bool valid;       // False until the wall clock is set
+  uint8_t changed;  // CLOCK_CHANGED_* bits of what differs from the previous update
+};
+
+// Time source shared by the clocks. The wall clock is read and converted to local time once per second,
+// in between the milliseconds are counted on with millis(), so a frame costs no time zone conversion.
+// Each second starts from a new reading of the wall clock, which keeps the seconds on the real
+// boundaries and follows SNTP corrections.
+class ClockTime {
+public:
+  // Advances to now (millis()) and returns the time to draw
+  const LocalTime &update(uint32_t now);
+  const LocalTime &time() const { return _time; }
+
+private:
+  void read(uint32_t now);
+
+  LocalTime _time = {};
+  time_t _second = 0;        // Wall clock second of _time.tm
+  uint32_t _secondStart = 0; // millis() at which that second started
+  bool _started = false;
+};
+
+#endif // CLOCKTIME_H
@@ -1,142 +1,168 @@
 #include "Clocks.h"
+#include "ClockTables.h"
 
-#include <math.h>
+// Sets a pixel of the precomputed tables (y * CLOCK_SIZE + x) in the LED buffer
+static inline void setPixel(CRGB *leds, const uint16_t *ledIndex, uint8_t p, const CRGB &color) {
+  leds[ledIndex[p]] = color;
+}
 
-void drawAnalogClock(FastLED_NeoMatrix *matrix) {
-  const int width = 16;
-  const int height = 16;
+static void drawHand(CRGB *leds, const uint16_t *ledIndex, const uint8_t *hand, uint8_t length, uint8_t position, const CRGB &color) {
+  const uint8_t *pixels = hand + position * length;
+  for (uint8_t i = 0; i < length; i++) {
+    setPixel(leds, ledIndex, pixels[i], color);
+  }
+}
 
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    Serial.println("Failed to obtain time");
-    return;
+bool drawAnalogClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time) {
+  if (!time.valid) {
+    return false;
   }
+  const struct tm &timeinfo = time.tm;
 
   // Clear the matrix
-  matrix->fillScreen(0);
-
-  // Clock center
-  int cx = width / 2;
-  int cy = height / 2;
-  int radius = 7;
+  memset(leds, 0, CLOCK_SIZE * CLOCK_SIZE * sizeof(CRGB));
 
   // Draw clock face (circle)
-  matrix->drawCircle(cx, cy, radius, matrix->Color(GREY_COLOR));
-
-  // Draw hour hand
-  float hour = timeinfo.tm_hour % 12 + timeinfo.tm_min / 60.0;
-  float hour_angle = (hour / 12.0) * 2 * PI - PI / 2;
-  int hx = cx + cos(hour_angle) * (radius - 4);
-  int hy = cy + sin(hour_angle) * (radius - 4);
-  matrix->drawLine(cx, cy, hx, hy, matrix->Color(HOURS_COLOR));
-
-  // Draw minute hand
-  float minute = timeinfo.tm_min + timeinfo.tm_sec / 60.0;
-  float min_angle = (minute / 60.0) * 2 * PI - PI / 2;
-  int mx = cx + cos(min_angle) * (radius - 2);
-  int my = cy + sin(min_angle) * (radius - 2);
-  matrix->drawLine(cx, cy, mx, my, matrix->Color(MINUTE_COLOR));
-
-  // Draw second hand
-  float sec_angle = (timeinfo.tm_sec / 60.0) * 2 * PI - PI / 2;
-  int sx = cx + cos(sec_angle) * (radius - 1);
-  int sy = cy + sin(sec_angle) * (radius - 1);
-  matrix->drawLine(cx, cy, sx, sy, matrix->Color(SECONDS_COLOR));
-
-  // FastLED.show();
+  for (uint8_t i = 0; i < sizeof(CLOCK_FACE); i++) {
+    setPixel(leds, ledIndex, CLOCK_FACE[i], CRGB(GREY_COLOR));
+  }
+
+  // Hands point at one of 60 positions, the hour hand moves on every 12 minutes
+  uint8_t hour_pos = (timeinfo.tm_hour % 12) * 5 + timeinfo.tm_min / 12;
+  drawHand(leds, ledIndex, CLOCK_HOUR_HAND, CLOCK_HOUR_HAND_LENGTH, hour_pos, CRGB(HOURS_COLOR));
+  drawHand(leds, ledIndex, CLOCK_MINUTE_HAND, CLOCK_MINUTE_HAND_LENGTH, timeinfo.tm_min, CRGB(MINUTE_COLOR));
+  drawHand(leds, ledIndex, CLOCK_SECOND_HAND, CLOCK_SECOND_HAND_LENGTH, timeinfo.tm_sec % 60, CRGB(SECONDS_COLOR));
+  return true;
 }
 
-static void drawPerimeter(FastLED_NeoMatrix *matrix, int start, int end, uint16_t color) {
-  int n = end - start;
-  // Top row
-  for (int x = start; x < end; ++x)
-    matrix->drawPixel(x, start, color);
-  // Right column
-  for (int y = start + 1; y < end - 1; ++y)
-    matrix->drawPixel(end - 1, y, color);
-  // Bottom row
-  for (int x = end - 1; x >= start; --x)
-    matrix->drawPixel(x, end - 1, color);
-  // Left column
-  for (int y = end - 2; y > start; --y)
-    matrix->drawPixel(start, y, color);
+bool drawRingClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time) {
+  if (!time.valid) {
+    return false;
+  }
+  const struct tm &timeinfo = time.tm;
+
+  memset(leds, 0, CLOCK_SIZE * CLOCK_SIZE * sizeof(CRGB));
+
+  // Draw backgrounds: seconds ring and hours ring grey, minutes ring between them stays black
+  for (uint8_t i = 0; i < CLOCK_RING16_POSITIONS; i++) {
+    setPixel(leds, ledIndex, CLOCK_RING16[i], CRGB(GREY_COLOR));
+  }
+  for (uint8_t i = 0; i < CLOCK_RING12_POSITIONS; i++) {
+    setPixel(leds, ledIndex, CLOCK_RING12[i], CRGB(GREY_COLOR));
+  }
+
+  // Seconds pixel (outer ring, 60 positions - 2x16 + 2x14=60)
+  setPixel(leds, ledIndex, CLOCK_RING16[timeinfo.tm_sec % 60], CRGB(SECONDS_COLOR));
+
+  // Minutes pixel (middle ring, 52 positions - 2x14 + 2x12=52)
+  setPixel(leds, ledIndex, CLOCK_RING14[CLOCK_RING_MINUTE[timeinfo.tm_min]], CRGB(MINUTE_COLOR));
+
+  // Hours pixel (inner ring, 44 positions - 2x12 + 2x10=44), advancing every quarter hour
+  uint8_t quarter = (timeinfo.tm_hour % 12) * 4 + timeinfo.tm_min / 15;
+  setPixel(leds, ledIndex, CLOCK_RING12[CLOCK_RING_QUARTER[quarter]], CRGB(HOURS_COLOR));
+  return true;
 }
 
-// Helper to get the (x, y) for a given index along a square ring perimeter
-static void getPerimeterXY(int ringSize, int idx, int &x, int &y) {
-  // ringSize: 16, 14, 12
-  int start = (16 - ringSize) / 2;
-  int end = start + ringSize;
-  int perim = (ringSize - 1) * 4;
-
-  idx = (idx + ringSize / 2) % perim;
-
-  if (idx < ringSize - 1) { // Top
-    x = start + idx;
-    y = start;
-
-  } else if (idx < (ringSize - 1) * 2) {
-    x = end - 1;
-    y = start + (idx - (ringSize - 1));
-  } else if (idx < (ringSize - 1) * 3) {
-    x = end - 1 - (idx - (ringSize - 1) * 2);
-    y = end - 1;
-  } else if (idx < (ringSize - 1) * 4) {
-    x = start;
-    y = end - 1 - (idx - (ringSize - 1) * 3);
-  } else {
-    x = start + idx;
-    y = start;
+// Smooth analog clock geometry, in 8.8 fixed point pixel coordinates (pixel centers at whole numbers).
+// The center sits between the four middle pixels so the hands are symmetric.
+#define SMOOTH_CENTER (15 * 128)
+#define SMOOTH_HOUR_RADIUS (3 * 256 + 128)
+#define SMOOTH_MINUTE_RADIUS (5 * 256 + 128)
+#define SMOOTH_SECOND_RADIUS (6 * 256 + 128)
+#define SMOOTH_MARKER_RADIUS (7 * 256 + 128)
+
+// Adds color scaled by coverage to a pixel, so overlapping hands mix
+static inline void addPixel(CRGB *leds, const uint16_t *ledIndex, int16_t x, int16_t y, const CRGB &color, uint8_t coverage) {
+  if (x < 0 || y < 0 || x >= CLOCK_SIZE || y >= CLOCK_SIZE || coverage == 0) {
+    return;
   }
+  CRGB c = color;
+  leds[ledIndex[y * CLOCK_SIZE + x]] += c.nscale8(coverage);
 }
 
-void drawRingClock(FastLED_NeoMatrix *matrix) {
-  const int width = 16;
-  const int height = 16;
+// Xiaolin Wu's anti-aliased line in 8.8 fixed point: along the major axis every pixel column is
+// split between the two pixels the exact line passes between, weighted by distance
+static void drawWuLine(CRGB *leds, const uint16_t *ledIndex, int32_t x0, int32_t y0, int32_t x1, int32_t y1, const CRGB &color) {
+  bool steep = abs(y1 - y0) > abs(x1 - x0);
+  if (steep) {
+    int32_t t = x0; x0 = y0; y0 = t;
+    t = x1; x1 = y1; y1 = t;
+  }
+  if (x0 > x1) {
+    int32_t t = x0; x0 = x1; x1 = t;
+    t = y0; y0 = y1; y1 = t;
+  }
 
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    Serial.println("Failed to obtain time");
-    return;
+  int32_t dx = x1 - x0;
+  int32_t gradient = dx == 0 ? 256 : (y1 - y0) * 256 / dx;
+  int32_t xstart = (x0 + 128) >> 8;
+  int32_t xend = (x1 + 128) >> 8;
+  int32_t intery = y0 + gradient * ((xstart << 8) - x0) / 256;
+
+  for (int32_t x = xstart; x <= xend; x++) {
+    int32_t y = intery >> 8;
+    uint8_t frac = intery & 0xFF;
+    if (steep) {
+      addPixel(leds, ledIndex, y, x, color, 255 - frac);
+      addPixel(leds, ledIndex, y + 1, x, color, frac);
+    } else {
+      addPixel(leds, ledIndex, x, y, color, 255 - frac);
+      addPixel(leds, ledIndex, x, y + 1, color, frac);
+    }
+    intery += gradient;
   }
+}
 
-  matrix->fillScreen(0);
+// Anti-aliased dot, spread over the four pixels around its position
+static void drawWuPoint(CRGB *leds, const uint16_t *ledIndex, int32_t x, int32_t y, const CRGB &color) {
+  int16_t px = x >> 8, py = y >> 8;
+  uint8_t fx = x & 0xFF, fy = y & 0xFF;
+  addPixel(leds, ledIndex, px, py, color, scale8(255 - fx, 255 - fy));
+  addPixel(leds, ledIndex, px + 1, py, color, scale8(fx, 255 - fy));
+  addPixel(leds, ledIndex, px, py + 1, color, scale8(255 - fx, fy));
+  addPixel(leds, ledIndex, px + 1, py + 1, color, scale8(fx, fy));
+}
+
+// Hand from the center towards angle (0..65535 is one clockwise turn from 12 o'clock)
+static void drawSmoothHand(CRGB *leds, const uint16_t *ledIndex, uint16_t angle, int32_t radius, const CRGB &color) {
+  int32_t x = SMOOTH_CENTER + (int32_t)sin16(angle) * radius / 32768;
+  int32_t y = SMOOTH_CENTER - (int32_t)cos16(angle) * radius / 32768;
+  drawWuLine(leds, ledIndex, SMOOTH_CENTER, SMOOTH_CENTER, x, y, color);
+}
+
+bool drawSmoothAnalogClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time) {
+  // SNTP corrects the system clock smoothly (slewed) and ClockTime never counts the milliseconds
+  // back, so the hands do not jump backwards once synchronized
+  if (!time.valid) {
+    return false;
+  }
+  const struct tm &timeinfo = time.tm;
+
+  memset(leds, 0, CLOCK_SIZE * CLOCK_SIZE * sizeof(CRGB));
+
+  // Hour markers
+  for (uint8_t hour = 0; hour < 12; hour++) {
+    uint16_t angle = hour * 65536 / 12;
+    drawWuPoint(leds, ledIndex, SMOOTH_CENTER + (int32_t)sin16(angle) * SMOOTH_MARKER_RADIUS / 32768,
+                SMOOTH_CENTER - (int32_t)cos16(angle) * SMOOTH_MARKER_RADIUS / 32768, CRGB(GREY_COLOR));
+  }
 
-  // Draw backgrounds
-  drawPerimeter(matrix, 0, 16, matrix->Color(GREY_COLOR)); // seconds ring (grey)
-  drawPerimeter(matrix, 1, 15, matrix->Color(0, 0, 0));    // minutes ring (black)
-  drawPerimeter(matrix, 2, 14, matrix->Color(GREY_COLOR)); // hours ring (grey)
-
-  // Draw seconds pixel (outer ring, 60 positions - 2x16 + 2x14=60)
-  int sec_idx = (timeinfo.tm_sec % 60);
-  int sx, sy;
-  getPerimeterXY(16, sec_idx, sx, sy);
-  matrix->drawPixel(sx, sy, matrix->Color(SECONDS_COLOR));
-
-  // Draw minutes pixel (middle ring, 52 positions - 2x14 + 2x12=52)
-  int min_idx = map(timeinfo.tm_min, 0, 59, 0, 51);
-  int mx, my;
-  getPerimeterXY(14, min_idx, mx, my);
-  matrix->drawPixel(mx, my, matrix->Color(MINUTE_COLOR));
-
-  // Draw hours pixel (inner ring, 44 positions-  2x12 + 2x10=44)
-  // We can convert 12-hour time to 44 positions by multiplying by 4 and adding quarter hours, then map 48 possible positions to 44 pixels
-  int hour12 = timeinfo.tm_hour % 12;
-  int hour_idx = map((hour12 * 4) + (timeinfo.tm_min / 15), 0, 47, 0, 43); // 12*4=48, each 15 min advances 1
-  int hx, hy;
-  getPerimeterXY(12, hour_idx, hx, hy);
-  matrix->drawPixel(hx, hy, matrix->Color(HOURS_COLOR));
+  // Milliseconds into the current 12 hours
+  uint64_t ms = ((timeinfo.tm_hour % 12) * 3600UL + timeinfo.tm_min * 60UL + timeinfo.tm_sec) * 1000UL + time.ms;
+  drawSmoothHand(leds, ledIndex, ms * 65536 / 43200000UL, SMOOTH_HOUR_RADIUS, CRGB(HOURS_COLOR));
+  drawSmoothHand(leds, ledIndex, (ms % 3600000UL) * 65536 / 3600000UL, SMOOTH_MINUTE_RADIUS, CRGB(MINUTE_COLOR));
+  drawSmoothHand(leds, ledIndex, (ms % 60000UL) * 65536 / 60000UL, SMOOTH_SECOND_RADIUS, CRGB(SECONDS_COLOR));
+  return true;
 }
 
-void drawBarsClock(FastLED_NeoMatrix *matrix) {
+bool drawBarsClock(FastLED_NeoMatrix *matrix, const LocalTime &time) {
   const int width = 16;
   const int height = 16;
 
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    Serial.println("Failed to obtain time");
-    return;
+  if (!time.valid) {
+    return false;
   }
+  const struct tm &timeinfo = time.tm;
 
   matrix->fillScreen(0);
 
@@ -167,14 +193,14 @@ void drawBarsClock(FastLED_NeoMatrix *matrix) {
     matrix->fillRect(width - 5, height - 2 - secondsFullLines, 5, secondsFullLines, matrix->Color(SECONDS_COLOR));
   }
   matrix->fillRect(width - 5, height - 2 - secondsFullLines - 1, secondsRemainder, 1, matrix->Color(SECONDS_COLOR));
+  return true;
 }
 
-void drawDigitalClock(FastLED_NeoMatrix *matrix) {
-  struct tm timeinfo;
-  if (!getLocalTime(&timeinfo)) {
-    Serial.println("Failed to obtain time");
-    return;
+bool drawDigitalClock(FastLED_NeoMatrix *matrix, const LocalTime &time) {
+  if (!time.valid) {
+    return false;
   }
+  const struct tm &timeinfo = time.tm;
 
   matrix->fillScreen(0);
 
@@ -195,4 +221,21 @@ void drawDigitalClock(FastLED_NeoMatrix *matrix) {
   }
   matrix->setCursor(2, 8);
   matrix->print(timeStrM);
-}
\ No newline at end of file
+  return true;
+}
+
+void drawTimeUnknown(FastLED_NeoMatrix *matrix, const LocalTime &time) {
+  matrix->fillScreen(0);
+  matrix->setTextColor(matrix->Color(GREY_COLOR));
+  matrix->setTextSize(1);
+
+  // Digital clock layout with dashes for the digits, the colon keeps blinking to show the clock runs
+  matrix->setCursor(2, 0);
+  matrix->print("--");
+  if (time.tm.tm_sec % 2 == 0) {
+    matrix->setCursor(12, 0);
+    matrix->print(":");
+  }
+  matrix->setCursor(2, 8);
+  matrix->print("--");
+}
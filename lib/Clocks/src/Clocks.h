@@ -1,5 +1,6 @@
 #include "time.h"
 #include <FastLED_NeoMatrix.h>
+#include "ClockTime.h"
 
 #define HOURS_COLOR 255,0,0
 #define QUARTERS_COLOR 100,0,0
@@ -7,7 +8,15 @@
 #define SECONDS_COLOR 0,0,255
 #define GREY_COLOR 100,100,100
 
-void drawAnalogClock(FastLED_NeoMatrix *matrix);
-void drawRingClock(FastLED_NeoMatrix *matrix);
-void drawBarsClock(FastLED_NeoMatrix *matrix);
-void drawDigitalClock(FastLED_NeoMatrix *matrix);
\ No newline at end of file
+// Analog and ring clocks write straight into the LED buffer using the tables in ClockTables.h.
+// ledIndex maps y * 16 + x to the LED position. Clocks draw the time from ClockTime and return false without
+// drawing while it is unknown.
+bool drawAnalogClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time);
+bool drawRingClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time);
+// Analog clock with anti-aliased hands that sweep with millisecond resolution, meant to be redrawn every frame.
+// Timed by the clock_smooth stage of the host benchmark (src/sim/Benchmark.cpp).
+bool drawSmoothAnalogClock(CRGB *leds, const uint16_t *ledIndex, const LocalTime &time);
+bool drawBarsClock(FastLED_NeoMatrix *matrix, const LocalTime &time);
+bool drawDigitalClock(FastLED_NeoMatrix *matrix, const LocalTime &time);
+// Placeholder shown by every clock mode until the wall clock has been set
+void drawTimeUnknown(FastLED_NeoMatrix *matrix, const LocalTime &time);
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "Compositor.h"
+
+OverlayLayer::OverlayLayer(uint8_t width, uint8_t height, const uint16_t* ledIndex, CRGB* pixels, uint8_t* alpha)
+    : Adafruit_GFX(width, height), _ledIndex(ledIndex), _pixels(pixels), _alpha(alpha) {
+    setTextWrap(false);
+    clear();
+}
+
+void OverlayLayer::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    uint16_t led = _ledIndex[y * WIDTH + x];
+    // Expand RGB565, replicating the high bits so white stays white
+    uint8_t r = (color >> 11) & 0x1F, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    _pixels[led] = CRGB(r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2);
+    _alpha[led] = 255;
+    _composedOpacity = -1;
+}
+
+void OverlayLayer::clear() {
+    memset(_alpha, 0, WIDTH * HEIGHT);
+    _composedOpacity = -1;
+}
+
+void OverlayLayer::show(uint32_t until, uint16_t fade_ms) {
+    _visible = true;
+    _until = until;
+    _fade = fade_ms;
+}
+
+uint8_t OverlayLayer::opacity(uint32_t now) const {
+    if (!_visible || (int32_t)(now - _until) >= 0) {
+        return 0;
+    }
+    uint32_t remaining = _until - now;
+    return remaining >= _fade ? 255 : remaining * 255 / _fade;
+}
+
+bool Compositor::addLayer(OverlayLayer* layer) {
+    if (_layerCount == COMPOSITOR_MAX_LAYERS) {
+        return false;
+    }
+    _layers[_layerCount++] = layer;
+    return true;
+}
+
+void Compositor::compose(CRGB* leds, uint32_t now) {
+    // Only layers that show anything take part
+    OverlayLayer* visible[COMPOSITOR_MAX_LAYERS];
+    uint8_t opacity[COMPOSITOR_MAX_LAYERS];
+    uint8_t count = 0;
+    for (uint8_t l = 0; l < _layerCount; l++) {
+        _layers[l]->_composedOpacity = _layers[l]->opacity(now);
+        if (_layers[l]->_composedOpacity > 0) {
+            opacity[count] = _layers[l]->_composedOpacity;
+            visible[count++] = _layers[l];
+        }
+    }
+
+    for (uint16_t i = 0; i < _count; i++) {
+        CRGB pixel = _base[i];
+        for (uint8_t l = 0; l < count; l++) {
+            uint8_t alpha = scale8(visible[l]->_alpha[i], opacity[l]);
+            if (alpha > 0) {
+                pixel = blend(pixel, visible[l]->_pixels[i], alpha);
+            }
+        }
+        leds[i] = pixel;
+    }
+}
+
+bool Compositor::changed(uint32_t now) const {
+    for (uint8_t l = 0; l < _layerCount; l++) {
+        if (_layers[l]->_composedOpacity != _layers[l]->opacity(now)) {
+            return true;
+        }
+    }
+    return false;
+}
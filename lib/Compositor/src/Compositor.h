@@ -0,0 +1,59 @@
+#ifndef COMPOSITOR_H
+#define COMPOSITOR_H
+
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+#include <FastLED.h>
+
+#define COMPOSITOR_MAX_LAYERS 4
+
+// Overlay bitmap with per-pixel alpha, stored in LED order so it blends straight into the LED buffer.
+// It is a GFX target, so text and shapes are rasterized into it once and reused until they change.
+// The layer can fade out on its own: its opacity follows the time left until it expires.
+class OverlayLayer : public Adafruit_GFX {
+public:
+    // ledIndex maps y * width + x to the LED position; pixels and alpha hold width * height entries
+    OverlayLayer(uint8_t width, uint8_t height, const uint16_t* ledIndex, CRGB* pixels, uint8_t* alpha);
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    // Makes every pixel transparent
+    void clear();
+    // Shows the layer until the given time, fading out over the last fade_ms
+    void show(uint32_t until, uint16_t fade_ms);
+    void hide() { _visible = false; }
+    uint8_t opacity(uint32_t now) const;
+
+private:
+    friend class Compositor;
+
+    const uint16_t* _ledIndex;
+    CRGB* _pixels;
+    uint8_t* _alpha;
+    bool _visible = false;
+    uint32_t _until = 0;
+    uint16_t _fade = 0;
+    int16_t _composedOpacity = -1; // Opacity at the last compose, -1 after the content changed
+};
+
+// Combines a base layer (the animation or clock drawn into the LED buffer) with overlay layers.
+// The base is kept, so overlays can be updated and blended again without redrawing it.
+class Compositor {
+public:
+    Compositor(CRGB* base, uint16_t count) : _base(base), _count(count) {}
+    bool addLayer(OverlayLayer* layer);
+    // Keeps a copy of a freshly drawn base frame
+    void setBase(const CRGB* leds) { memcpy(_base, leds, _count * sizeof(CRGB)); }
+    // Puts the last base frame back, so a renderer that only draws part of the frame never picks up overlays
+    void restoreBase(CRGB* leds) const { memcpy(leds, _base, _count * sizeof(CRGB)); }
+    // Writes the base with all visible overlays blended on top, in one pass over the pixels
+    void compose(CRGB* leds, uint32_t now);
+    // True when an overlay appeared, changed, faded or disappeared since the last compose
+    bool changed(uint32_t now) const;
+
+private:
+    CRGB* _base;
+    uint16_t _count;
+    OverlayLayer* _layers[COMPOSITOR_MAX_LAYERS];
+    uint8_t _layerCount = 0;
+};
+
+#endif // COMPOSITOR_H
@@ -1,110 +1,132 @@
-
 #include "Encoder.h"
 
-Encoder* Encoder::_instances[6] = {nullptr};
-uint8_t Encoder::_numInstances = 0;
-
-Encoder::Encoder(uint8_t pinA, uint8_t pinB, uint8_t pinBtn, volatile int* valuePtr, ButtonCallback btnCallback, ButtonCallback btnLongCallback, unsigned long longPressDuration)
-    : _pinA(pinA), _pinB(pinB), _pinBtn(pinBtn), _valuePtr(valuePtr), _btnCallback(btnCallback), _btnLongCallback(btnLongCallback), _longPressDuration(longPressDuration),
-    _lastBtnTime(0) {
-    _lastStateA = LOW;
-    _lastStateB = LOW;
-    _lastBtnState = HIGH;
-    _index = _numInstances;
-    if (_numInstances < 6) {
-        _instances[_numInstances++] = this;
-    }
+Encoder::Encoder(EncoderHal& hal, unsigned long longPressDuration, EncoderAcceleration acceleration)
+    : _hal(hal), _longPressDuration(longPressDuration), _acceleration(acceleration), _lastBtnTime(0) {
+    _lastBtnReleased = true;
 }
 
 void Encoder::begin() {
-    pinMode(_pinA, INPUT_PULLUP);
-    pinMode(_pinB, INPUT_PULLUP);
-    pinMode(_pinBtn, INPUT_PULLUP);
-    _lastStateA = digitalRead(_pinA);
-    _lastStateB = digitalRead(_pinB);
-    _lastBtnState = digitalRead(_pinBtn);
     _old_AB = 3; // initial state for lookup
     _encval = 0;
-    currentlyPressed = false;
-
-    // Create FreeRTOS timer for long press detection
-    if (_longPressTimer == nullptr) {
-        _longPressTimer = xTimerCreate(
-            "LongPressTimer",
-            pdMS_TO_TICKS(_longPressDuration),
-            pdFALSE, // one-shot
-            this,
-            Encoder::longPressTimerCallback
-        );
+    _hal.begin(this);
+    int32_t quarterSteps;
+    if (_hal.count(quarterSteps)) {
+        _countedQuarterSteps = quarterSteps;
     }
-    _longPressFired = false;
-
-    // Attach interrupts using lambdas and static_cast to call instance methods.
-    // This allows each Encoder object to handle its own pins without global/static ISRs.
-    // 'this' is passed as the argument, and inside the lambda, it is cast back to Encoder*.
-    attachInterruptArg(digitalPinToInterrupt(_pinA), [](void* arg){ static_cast<Encoder*>(arg)->handleEncoderISR(); }, this, CHANGE);
-    attachInterruptArg(digitalPinToInterrupt(_pinB), [](void* arg){ static_cast<Encoder*>(arg)->handleEncoderISR(); }, this, CHANGE);
-    attachInterruptArg(digitalPinToInterrupt(_pinBtn), [](void* arg){ static_cast<Encoder*>(arg)->handleBtn(); }, this, CHANGE);
 }
 
-void Encoder::handleEncoderISR() {
+void IRAM_ATTR Encoder::quadratureEdge(bool a, bool b, uint32_t now) {
     // Lookup table for state transitions
     static const int8_t enc_states[] = {0, -1, 1, 0, 1, 0, 0, -1, -1,
                                         0, 0, 1, 0, 1, -1, 0};
 
     _old_AB <<= 2;
-    if (digitalRead(_pinA))
+    if (a)
         _old_AB |= 0x02;
-    if (digitalRead(_pinB))
+    if (b)
         _old_AB |= 0x01;
 
     _encval += enc_states[_old_AB & 0x0f];
 
-    // Only update value on full detent (4 steps)
+    // Only report full detents (4 steps)
     if (_encval > 3) {
         _encval = 0;
-        totalClicks++;
-        (*_valuePtr)++;
+        _ring.push({now, RAW_STEP, 1});
     } else if (_encval < -3) {
         _encval = 0;
-        totalClicks++;
-        (*_valuePtr)--;
+        _ring.push({now, RAW_STEP, -1});
     }
 }
 
-void Encoder::handleBtn() {
-    int reading = digitalRead(_pinBtn);
-    unsigned long now = millis();
-    if (reading != _lastBtnState && (now - _lastBtnTime) > _debounceDelay) {
-        currentlyPressed = (reading == LOW);
-        if (reading == LOW) {
-            // Button pressed: start long press timer
-            _longPressFired = false;
-            if (_longPressTimer) {
-                _longPressStartClicks = totalClicks; // Value to detect clicks during long press
-                xTimerStop(_longPressTimer, 0);
-                xTimerChangePeriod(_longPressTimer, pdMS_TO_TICKS(_longPressDuration), 0);
-                xTimerStart(_longPressTimer, 0);
-            }
-        } else if (_lastBtnState == LOW && reading == HIGH) {
-            // Button released
-            if (_longPressTimer) xTimerStop(_longPressTimer, 0);
-            if (!_longPressFired && _longPressStartClicks == totalClicks) {
-                // Short press detected (long press not fired)
-                if (_btnCallback) _btnCallback();
+void IRAM_ATTR Encoder::buttonEdge(bool released, uint32_t now) {
+    if (released != _lastBtnReleased && (now - _lastBtnTime) > _debounceDelay) {
+        _ring.push({now, released ? RAW_BUTTON_UP : RAW_BUTTON_DOWN, 0});
+        _lastBtnTime = now;
+    }
+    _lastBtnReleased = released;
+}
+
+bool Encoder::poll(EncoderEvent& event) {
+    RawInput input;
+    while (_ring.pop(input)) {
+        switch (input.type) {
+            case RAW_STEP:
+                if (_pressed) {
+                    // Rotating while pressed cancels the short and long press
+                    _rotatedWhilePressed = true;
+                }
+                event = step(input.time, _pressed ? ENCODER_PRESSED_STEP : ENCODER_STEP, input.detents);
+                return true;
+            case RAW_BUTTON_DOWN:
+                _pressed = true;
+                _rotatedWhilePressed = false;
+                _longPressFired = false;
+                _pressTime = input.time;
+                break;
+            case RAW_BUTTON_UP:
+                if (!_pressed) {
+                    break;
+                }
+                _pressed = false;
+                // A long press that was not reported yet (the task was busy) still counts as one
+                if (!_rotatedWhilePressed && !_longPressFired) {
+                    bool longPress = input.time - _pressTime >= _longPressDuration;
+                    event = {input.time, longPress ? ENCODER_LONG_PRESS : ENCODER_PRESS, 0, 0};
+                    return true;
+                }
+                break;
+        }
+    }
+
+    uint32_t now = _hal.millis();
+
+    // Rotation counted in hardware, reported once the button edges before it are handled
+    int32_t quarterSteps;
+    if (_hal.count(quarterSteps)) {
+        int32_t detents = (quarterSteps - _countedQuarterSteps) / 4;
+        if (detents != 0) {
+            detents = detents > 127 ? 127 : (detents < -127 ? -127 : detents);
+            _countedQuarterSteps += detents * 4;
+            if (_pressed) {
+                _rotatedWhilePressed = true;
             }
+            event = step(now, _pressed ? ENCODER_PRESSED_STEP : ENCODER_STEP, detents);
+            return true;
         }
-        _lastBtnTime = now;
     }
-    _lastBtnState = reading;
+
+    // Long press fires while the button is still held
+    if (_pressed && !_rotatedWhilePressed && !_longPressFired && now - _pressTime >= _longPressDuration) {
+        _longPressFired = true;
+        event = {now, ENCODER_LONG_PRESS, 0, 0};
+        return true;
+    }
+    return false;
 }
 
-// FreeRTOS timer callback for long press
-void Encoder::longPressTimerCallback(TimerHandle_t xTimer) {
-    Encoder* enc = static_cast<Encoder*>(pvTimerGetTimerID(xTimer));
-    if (enc && digitalRead(enc->_pinBtn) == LOW && enc->_longPressStartClicks == enc->totalClicks) {
-        // Button still pressed after timeout and no clicks detected during this period
-        enc->_longPressFired = true;
-        if (enc->_btnLongCallback) enc->_btnLongCallback();
+// Scales detents by how fast the encoder turns. The time between detents is averaged with the previous
+// ones so a single quick flick does not jump far, and starts over from slow when the direction changes.
+EncoderEvent Encoder::step(uint32_t time, EncoderEventType type, int32_t detents) {
+    const EncoderAcceleration& a = _acceleration;
+    int32_t delta = detents;
+
+    if (a.maxMultiplier > 1 && a.slowMs > a.fastMs) {
+        int8_t direction = detents > 0 ? 1 : -1;
+        uint32_t interval = (time - _lastStepTime) / (uint32_t)(detents * direction);
+        // Turning back to correct an overshoot starts slow again
+        if (interval > a.slowMs || direction != _lastDirection) {
+            interval = a.slowMs;
+            _stepInterval = a.slowMs;
+        }
+        _stepInterval = (_stepInterval + interval) / 2;
+        _lastStepTime = time;
+        _lastDirection = direction;
+
+        if (_stepInterval < a.slowMs) {
+            uint32_t speed = _stepInterval <= a.fastMs ? a.slowMs - a.fastMs : a.slowMs - _stepInterval;
+            delta = detents * (int32_t)(1 + (a.maxMultiplier - 1) * speed / (a.slowMs - a.fastMs));
+            delta = delta > INT16_MAX ? INT16_MAX : (delta < -INT16_MAX ? -INT16_MAX : delta);
+        }
     }
+    return {time, type, (int8_t)detents, (int16_t)delta};
 }
@@ -2,42 +2,84 @@
 #define ENCODER_H
 
 
-#include <Arduino.h>
+#include <stdint.h>
+#include "EncoderHal.h"
+#include "EventRing.h"
 
-// Encoder class using hardware interrupts for rotary encoder and button
-// Button callback must be a static function or a function pointer (no std::function).
-// Value pointer must point to a volatile int.
+#define ENCODER_RING_SIZE 32
+
+enum EncoderEventType : uint8_t {
+    ENCODER_STEP,          // Rotated by detents
+    ENCODER_PRESSED_STEP,  // Rotated by detents while the button is held
+    ENCODER_PRESS,         // Button released before the long press time, without rotating
+    ENCODER_LONG_PRESS,    // Button held for the long press time without rotating
+};
+
+struct EncoderEvent {
+    uint32_t time;         // millis() when it happened
+    EncoderEventType type;
+    int8_t detents;        // Detents turned, for the step events
+    int16_t delta;         // Detents scaled by the acceleration curve
+};
+
+// Turning faster multiplies each detent. The multiplier is 1 while detents are slowMs or more apart and
+// rises linearly to maxMultiplier as they get fastMs or less apart. A maxMultiplier of 1 turns it off.
+struct EncoderAcceleration {
+    uint16_t slowMs;
+    uint16_t fastMs;
+    uint8_t maxMultiplier;
+};
+
+// Rotary encoder with push button. The hardware is reached through an EncoderHal backend.
+// The backend's interrupt handlers only record raw steps and button edges with their time in a lock-free
+// ring; poll(), called from one task, turns them into events. Nothing in interrupt context allocates, logs
+// or calls back into the application, and no step is lost between reading and clearing a counter.
 class Encoder {
 public:
-    typedef void (*ButtonCallback)();
-    bool currentlyPressed;
-    unsigned long totalClicks = 0;
-    Encoder(uint8_t pinA, uint8_t pinB, uint8_t pinBtn, volatile int* valuePtr, ButtonCallback btnCallback = nullptr, ButtonCallback btnLongCallback = nullptr, unsigned long longPressDuration = 1000);
+    Encoder(EncoderHal& hal, unsigned long longPressDuration = 1000, EncoderAcceleration acceleration = {0, 0, 1});
     void begin();
+    // Returns the next event, if any. Must always be called from the same task.
+    bool poll(EncoderEvent& event);
+    bool pressed() const { return _pressed; }
+    // Raw inputs lost because the ring was full
+    uint32_t dropped() const { return _ring.dropped(); }
+
+    // Called by the backend from interrupt context
+    void IRAM_ATTR quadratureEdge(bool a, bool b, uint32_t now);
+    void IRAM_ATTR buttonEdge(bool released, uint32_t now);
 
 private:
-    void handleEncoderISR();
-    void handleBtn();
-
-    uint8_t _pinA, _pinB, _pinBtn;
-    volatile int* _valuePtr;
-    unsigned long _longPressStartClicks = 0;
-    ButtonCallback _btnCallback;
-    ButtonCallback _btnLongCallback;
-    volatile int _lastStateA;
-    volatile int _lastStateB;
-    volatile int _lastBtnState;
-    volatile unsigned long _lastBtnTime;
+    // What the interrupt handlers record
+    enum RawType : uint8_t { RAW_STEP, RAW_BUTTON_DOWN, RAW_BUTTON_UP };
+    struct RawInput {
+        uint32_t time;
+        RawType type;
+        int8_t detents;
+    };
+
+    EncoderEvent step(uint32_t time, EncoderEventType type, int32_t detents);
+
+    EncoderHal& _hal;
+    unsigned long _longPressDuration;
+    EncoderAcceleration _acceleration;
+    EventRing<RawInput, ENCODER_RING_SIZE> _ring;
+
+    // Interrupt state
     volatile uint8_t _old_AB;
     volatile int8_t _encval;
-    static Encoder* _instances[6];
-    static uint8_t _numInstances;
-    uint8_t _index;
+    volatile bool _lastBtnReleased;
+    volatile uint32_t _lastBtnTime;
     static const unsigned long _debounceDelay = 50;
-    unsigned long _longPressDuration; 
-    TimerHandle_t _longPressTimer = nullptr;
-    static void longPressTimerCallback(TimerHandle_t xTimer);
+
+    // Consumer state, only touched by poll()
+    bool _pressed = false;
+    bool _rotatedWhilePressed = false;
     bool _longPressFired = false;
+    uint32_t _pressTime = 0;
+    int32_t _countedQuarterSteps = 0; // Hardware count already reported as steps
+    uint32_t _lastStepTime = 0;
+    uint16_t _stepInterval = 0;   // Smoothed time between detents in the current direction
+    int8_t _lastDirection = 0;
 };
 
 #endif // ENCODER_H
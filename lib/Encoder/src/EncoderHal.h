@@ -0,0 +1,26 @@
+#ifndef ENCODERHAL_H
+#define ENCODERHAL_H
+
+#include <stdint.h>
+
+#if defined(ESP32)
+#include <esp_attr.h>
+#else
+#define IRAM_ATTR
+#endif
+
+class Encoder;
+
+// Hardware access for Encoder, so the decoding can also run off the device.
+// A backend reports what it sees by calling Encoder::quadratureEdge() and Encoder::buttonEdge() from its
+// interrupt handlers. A backend that decodes rotation in hardware reports a running count instead.
+class EncoderHal {
+public:
+    virtual ~EncoderHal() {}
+    virtual void begin(Encoder* encoder) = 0;
+    virtual uint32_t millis() = 0;
+    // Quarter steps counted in hardware since begin(). Returns false if the backend reports quadrature edges.
+    virtual bool count(int32_t&) { return false; }
+};
+
+#endif // ENCODERHAL_H
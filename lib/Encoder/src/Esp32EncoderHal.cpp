@@ -0,0 +1,43 @@
+#include "Esp32EncoderHal.h"
+
+#if defined(ESP32)
+
+void GpioEncoderHal::begin(Encoder* encoder) {
+    pinMode(_pinA, INPUT_PULLUP);
+    pinMode(_pinB, INPUT_PULLUP);
+    beginButton(encoder);
+
+    attachInterruptArg(digitalPinToInterrupt(_pinA), quadratureISR, this, CHANGE);
+    attachInterruptArg(digitalPinToInterrupt(_pinB), quadratureISR, this, CHANGE);
+}
+
+void GpioEncoderHal::beginButton(Encoder* encoder) {
+    _encoder = encoder;
+    pinMode(_pinBtn, INPUT_PULLUP);
+    attachInterruptArg(digitalPinToInterrupt(_pinBtn), buttonISR, this, CHANGE);
+}
+
+void IRAM_ATTR GpioEncoderHal::quadratureISR(void* arg) {
+    GpioEncoderHal* hal = static_cast<GpioEncoderHal*>(arg);
+    hal->_encoder->quadratureEdge(digitalRead(hal->_pinA), digitalRead(hal->_pinB), ::millis());
+}
+
+void IRAM_ATTR GpioEncoderHal::buttonISR(void* arg) {
+    GpioEncoderHal* hal = static_cast<GpioEncoderHal*>(arg);
+    hal->_encoder->buttonEdge(digitalRead(hal->_pinBtn), ::millis());
+}
+
+void PcntEncoderHal::begin(Encoder* encoder) {
+    ESP32Encoder::useInternalWeakPullResistors = puType::up;
+    _counter.attachFullQuad(_pinA, _pinB);
+    _counter.setFilter(_filter);
+    _counter.clearCount();
+    beginButton(encoder);
+}
+
+bool PcntEncoderHal::count(int32_t& quarterSteps) {
+    quarterSteps = (int32_t)_counter.getCount();
+    return true;
+}
+
+#endif // ESP32
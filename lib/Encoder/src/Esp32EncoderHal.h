@@ -0,0 +1,44 @@
+#ifndef ESP32ENCODERHAL_H
+#define ESP32ENCODERHAL_H
+
+#if defined(ESP32)
+
+#include <Arduino.h>
+#include <ESP32Encoder.h>
+#include "Encoder.h"
+
+// Both channels and the button on pin change interrupts, two digitalRead calls per quadrature edge
+class GpioEncoderHal : public EncoderHal {
+public:
+    GpioEncoderHal(uint8_t pinA, uint8_t pinB, uint8_t pinBtn) : _pinA(pinA), _pinB(pinB), _pinBtn(pinBtn) {}
+    void begin(Encoder* encoder) override;
+    uint32_t millis() override { return ::millis(); }
+
+protected:
+    void beginButton(Encoder* encoder);
+
+    uint8_t _pinA, _pinB, _pinBtn;
+    Encoder* _encoder = nullptr;
+
+private:
+    static void IRAM_ATTR quadratureISR(void* arg);
+    static void IRAM_ATTR buttonISR(void* arg);
+};
+
+// Rotation counted by the pulse counter peripheral, which takes no interrupts per edge and keeps counting
+// while interrupts are held off during show(). Pulses shorter than filter APB cycles (12.5 ns each, up to
+// 1023) are ignored as contact bounce. The button stays on a pin change interrupt.
+class PcntEncoderHal : public GpioEncoderHal {
+public:
+    PcntEncoderHal(uint8_t pinA, uint8_t pinB, uint8_t pinBtn, uint16_t filter = 1023)
+        : GpioEncoderHal(pinA, pinB, pinBtn), _filter(filter) {}
+    void begin(Encoder* encoder) override;
+    bool count(int32_t& quarterSteps) override;
+
+private:
+    ESP32Encoder _counter;
+    uint16_t _filter;
+};
+
+#endif // ESP32
+#endif // ESP32ENCODERHAL_H
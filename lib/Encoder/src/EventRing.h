@@ -0,0 +1,49 @@
+#ifndef EVENTRING_H
+#define EVENTRING_H
+
+#include <atomic>
+#include <stdint.h>
+
+// Fixed-size lock-free ring for exactly one producer (e.g. an interrupt handler) and one consumer task.
+// Each index is only written by one side; the release/acquire pair makes the slot contents visible
+// before the index that publishes them. Size must be a power of two; one slot is kept free.
+template <typename T, uint8_t Size>
+class EventRing {
+    static_assert(Size >= 2 && (Size & (Size - 1)) == 0, "EventRing size must be a power of two");
+
+public:
+    // Producer side. Returns false and drops the event when the ring is full.
+    inline __attribute__((always_inline)) bool push(const T& event) {
+        uint8_t head = _head.load(std::memory_order_relaxed);
+        uint8_t next = (head + 1) & (Size - 1);
+        if (next == _tail.load(std::memory_order_acquire)) {
+            _dropped.store(_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        _events[head] = event;
+        _head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& event) {
+        uint8_t tail = _tail.load(std::memory_order_relaxed);
+        if (tail == _head.load(std::memory_order_acquire)) {
+            return false;
+        }
+        event = _events[tail];
+        _tail.store((tail + 1) & (Size - 1), std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const { return _tail.load(std::memory_order_acquire) == _head.load(std::memory_order_acquire); }
+    uint32_t dropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+private:
+    T _events[Size];
+    std::atomic<uint8_t> _head{0};     // Next slot to write, owned by the producer
+    std::atomic<uint8_t> _tail{0};     // Next slot to read, owned by the consumer
+    std::atomic<uint32_t> _dropped{0}; // Written by the producer only
+};
+
+#endif // EVENTRING_H
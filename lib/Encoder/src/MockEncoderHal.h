@@ -0,0 +1,48 @@
+#ifndef MOCKENCODERHAL_H
+#define MOCKENCODERHAL_H
+
+#include "Encoder.h"
+
+// Backend driven by hand, for running Encoder on the host. Time only moves when advance() is called.
+// With hardwareCount the rotation is reported as a pulse counter would, otherwise as quadrature edges.
+class MockEncoderHal : public EncoderHal {
+public:
+    explicit MockEncoderHal(bool hardwareCount = false) : _hardwareCount(hardwareCount) {}
+
+    void begin(Encoder* encoder) override { _encoder = encoder; }
+    uint32_t millis() override { return _now; }
+    bool count(int32_t& quarterSteps) override {
+        quarterSteps = _quarterSteps;
+        return _hardwareCount;
+    }
+
+    void advance(uint32_t ms) { _now += ms; }
+
+    // Turns by detents (positive is clockwise), one quadrature edge every edgeMs
+    void turn(int detents, uint32_t edgeMs = 1) {
+        // A and B levels of the four edges of one clockwise detent, starting from the resting state (1, 1)
+        static const uint8_t clockwise[4] = {0b01, 0b00, 0b10, 0b11};
+        for (int d = 0; d < (detents < 0 ? -detents : detents); d++) {
+            for (uint8_t edge = 0; edge < 4; edge++) {
+                uint8_t ab = detents > 0 ? clockwise[edge] : clockwise[(6 - edge) % 4];
+                advance(edgeMs);
+                if (_hardwareCount) {
+                    _quarterSteps += detents > 0 ? 1 : -1;
+                } else {
+                    _encoder->quadratureEdge(ab & 0b10, ab & 0b01, _now);
+                }
+            }
+        }
+    }
+
+    void press() { _encoder->buttonEdge(false, _now); }
+    void release() { _encoder->buttonEdge(true, _now); }
+
+private:
+    Encoder* _encoder = nullptr;
+    bool _hardwareCount;
+    uint32_t _now = 0;
+    int32_t _quarterSteps = 0;
+};
+
+#endif // MOCKENCODERHAL_H
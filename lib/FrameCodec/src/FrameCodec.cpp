@@ -0,0 +1,146 @@
+#include "FrameCodec.h"
+
+void decodeFrame(const uint8_t* blob, uint16_t* plane, uint16_t pixelCount, uint8_t bpp) {
+    if (pgm_read_byte(blob++) & FRAME_KEY) {
+        memset(plane, 0, pixelCount * sizeof(uint16_t));
+    }
+
+    const uint16_t mask = (1UL << bpp) - 1;
+    uint16_t pixel = 0;
+    while (pixel < pixelCount) {
+        uint8_t op = pgm_read_byte(blob++);
+        uint16_t count = (op & 0x3F) + 1;
+        if (count > pixelCount - pixel) {
+            count = pixelCount - pixel; // Never write past the plane, even for corrupt data
+        }
+
+        switch (op >> 6) {
+            case FRAME_OP_SKIP:
+                pixel += count;
+                break;
+            case FRAME_OP_LITERAL: {
+                // Bits left over when the run ends are padding, so the bit buffer does not outlive it
+                uint32_t bits = 0;
+                uint8_t bitCount = 0;
+                while (count--) {
+                    while (bitCount < bpp) {
+                        bits |= (uint32_t)pgm_read_byte(blob++) << bitCount;
+                        bitCount += 8;
+                    }
+                    plane[pixel++] ^= bits & mask;
+                    bits >>= bpp;
+                    bitCount -= bpp;
+                }
+                break;
+            }
+            case FRAME_OP_FILL: {
+                uint16_t symbol = pgm_read_byte(blob++);
+                if (bpp > 8) {
+                    symbol |= pgm_read_byte(blob++) << 8;
+                }
+                while (count--) {
+                    plane[pixel++] ^= symbol;
+                }
+                break;
+            }
+            default:
+                return; // Unknown op, leave the rest of the frame untouched
+        }
+    }
+}
+
+uint32_t encodedFrameSize(const uint8_t* blob, uint32_t size, uint16_t pixelCount, uint8_t bpp) {
+    if (size == 0) {
+        return 0;
+    }
+    uint32_t read = 1; // Flags byte
+
+    // Walks the ops exactly like decodeFrame(), without writing anything
+    uint16_t pixel = 0;
+    while (pixel < pixelCount) {
+        if (read >= size) {
+            return 0;
+        }
+        uint8_t op = pgm_read_byte(blob + read++);
+        uint16_t count = (op & 0x3F) + 1;
+        if (count > pixelCount - pixel) {
+            count = pixelCount - pixel;
+        }
+
+        uint32_t operand;
+        switch (op >> 6) {
+            case FRAME_OP_SKIP:
+                operand = 0;
+                break;
+            case FRAME_OP_LITERAL:
+                operand = ((uint32_t)count * bpp + 7) / 8;
+                break;
+            case FRAME_OP_FILL:
+                operand = bpp > 8 ? 2 : 1;
+                break;
+            default:
+                return read; // decodeFrame() stops at an unknown op
+        }
+        if (operand > size - read) {
+            return 0;
+        }
+        read += operand;
+        pixel += count;
+    }
+    return read;
+}
+
+FrameDecoder::FrameDecoder(uint16_t* plane, uint16_t pixelCount)
+    : _plane(plane), _pixelCount(pixelCount) {
+}
+
+void FrameDecoder::begin(const Animation* anim) {
+    _anim = anim;
+    _decodedFrame = -1;
+    // A smaller animation only encodes its own pixels, decoding more would read into the next frame
+    _framePixels = anim != nullptr ? min((uint32_t)_pixelCount, (uint32_t)anim->width * anim->height) : 0;
+}
+
+void FrameDecoder::seek(uint16_t frame) {
+    if (_anim == nullptr || _anim->bpp == FRAME_NATIVE_BPP || frame >= _anim->frameCount || frame == _decodedFrame) {
+        return;
+    }
+
+    // Replay from the closest keyframe unless the requested frame directly follows the decoded one
+    uint16_t from = frame;
+    if (frame != _decodedFrame + 1) {
+        while (from > 0 && !isKeyFrame(from)) {
+            from--;
+        }
+    }
+
+    for (uint16_t f = from; f <= frame; f++) {
+        decodeFrame(frameAt(f), _plane, _framePixels, _anim->bpp);
+    }
+    _decodedFrame = frame;
+}
+
+void FrameDecoder::expand(uint16_t* out) const {
+    if (_anim == nullptr || _anim->palette == nullptr) {
+        memcpy(out, _plane, _framePixels * sizeof(uint16_t));
+        return;
+    }
+    for (uint16_t pixel = 0; pixel < _framePixels; pixel++) {
+        out[pixel] = pgm_read_word(_anim->palette + _plane[pixel]);
+    }
+}
+
+const uint8_t* FrameDecoder::nativeFrame(uint16_t frame) const {
+    if (_anim == nullptr || _anim->bpp != FRAME_NATIVE_BPP || frame >= _anim->frameCount) {
+        return nullptr;
+    }
+    return frameAt(frame);
+}
+
+bool FrameDecoder::isKeyFrame(uint16_t frame) const {
+    return pgm_read_byte(frameAt(frame)) & FRAME_KEY;
+}
+
+const uint8_t* FrameDecoder::frameAt(uint16_t frame) const {
+    return _anim->pool + pgm_read_dword(_anim->poolOffsets + pgm_read_word(_anim->frames + frame));
+}
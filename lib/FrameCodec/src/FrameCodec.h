@@ -0,0 +1,71 @@
+#ifndef FRAMECODEC_H
+#define FRAMECODEC_H
+
+#include <Arduino.h>
+
+// Decoder for the frame format produced by scripts/convert.py.
+// Pixels are stored as symbols of 1, 2, 4 or 8 bits (palette indices) or 16 bits (raw RGB565).
+// Every encoded frame starts with a flags byte followed by op bytes. The top two bits of an op
+// select SKIP, LITERAL or FILL and the low six bits hold (run length - 1). LITERAL is followed by
+// the run's symbols packed LSB first and padded to a whole byte, FILL by a single symbol stored
+// in whole little-endian bytes and applied to the whole run.
+// Symbols are XORed into the previous frame; keyframes start from an all-zero frame instead.
+// Encoded frames live in a pool shared by all animations, which refer to them by 16-bit index.
+// Native frames (24 bpp) are not encoded at all: they hold r, g, b bytes in LED chain order and are
+// copied straight into the LED buffer.
+#define FRAME_KEY 0x01
+#define FRAME_RAW_BPP 16
+#define FRAME_NATIVE_BPP 24
+#define ANIMATION_FLAG_NO_INTERPOLATION 0x01 // Never blend between frames, e.g. pixel art
+
+typedef struct {
+    const char *name;
+    uint16_t frameCount;
+    uint8_t width;
+    uint8_t height;
+    uint8_t bpp;                  // Bits per stored pixel: 1, 2, 4, 8 (palette index), 16 (RGB565) or 24 (native)
+    uint8_t transition;           // Transition into this animation (type and length), 0 for the default
+    uint32_t flags;               // ANIMATION_FLAG_*
+    const uint16_t *frameDurations; // Time on screen of every frame in ms
+    const uint16_t *frames;       // Index of every frame in pool
+    const uint16_t *palette;      // RGB565 colors indexed by the stored symbols, nullptr at 16 bpp
+    const uint8_t *pool;          // Encoded frames, shared by all animations of a pack
+    const uint32_t *poolOffsets;  // Byte offset of every encoded frame in pool
+} Animation;
+
+enum FrameOp : uint8_t {
+    FRAME_OP_SKIP = 0,
+    FRAME_OP_LITERAL = 1,
+    FRAME_OP_FILL = 2,
+};
+
+// Applies one encoded frame on top of the symbols currently held in plane
+void decodeFrame(const uint8_t* blob, uint16_t* plane, uint16_t pixelCount, uint8_t bpp);
+// Bytes decodeFrame() reads for one frame of pixelCount pixels, or 0 if it would read past size bytes
+uint32_t encodedFrameSize(const uint8_t* blob, uint32_t size, uint16_t pixelCount, uint8_t bpp);
+
+// Keeps track of which frame plane holds, so sequential playback only costs one delta per frame
+class FrameDecoder {
+public:
+    FrameDecoder(uint16_t* plane, uint16_t pixelCount);
+    void begin(const Animation* anim);
+    // Decodes the requested frame into plane, replaying from the closest keyframe when needed
+    void seek(uint16_t frame);
+    // Writes the decoded frame as RGB565, looking palette indices up in the animation's palette
+    void expand(uint16_t* out) const;
+    // Stored pixels of a native frame, nullptr when the animation is not native
+    const uint8_t* nativeFrame(uint16_t frame) const;
+    const Animation* animation() const { return _anim; }
+
+private:
+    bool isKeyFrame(uint16_t frame) const;
+    const uint8_t* frameAt(uint16_t frame) const;
+
+    uint16_t* _plane;
+    uint16_t _pixelCount;
+    uint16_t _framePixels = 0;  // Pixels of the animation's frames, at most _pixelCount
+    const Animation* _anim = nullptr;
+    int32_t _decodedFrame = -1; // -1 when plane does not hold a frame of the current animation
+};
+
+#endif // FRAMECODEC_H
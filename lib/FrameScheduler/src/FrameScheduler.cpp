@@ -0,0 +1,95 @@
+#include "FrameScheduler.h"
+
+// Wrap-safe "a is before b" for millisecond timestamps
+static inline bool before(uint32_t a, uint32_t b) {
+    return (int32_t)(a - b) < 0;
+}
+
+void FrameScheduler::start(uint32_t now) {
+    _deadline = now;
+    _started = false;
+}
+
+// Next frame in playback direction, wrapping around at both ends
+static inline uint16_t stepFrame(uint16_t frame, uint16_t frameCount, int8_t step) {
+    return step < 0 ? (frame + frameCount - 1) % frameCount : (frame + 1) % frameCount;
+}
+
+bool FrameScheduler::update(uint32_t now, uint16_t& frame, uint16_t frameCount, DurationFn duration, int8_t step) {
+    if (frameCount == 0 || before(now, _deadline)) {
+        return false;
+    }
+    uint32_t lateness = now - _deadline;
+
+    if (!_started) {
+        _started = true;
+    }
+    else if (step == 0) {
+        // Paused, keep the frame on screen and do not count the hold as lateness
+        _deadline = now + duration(frame);
+        return false;
+    }
+    else {
+        frame = stepFrame(frame, frameCount, step);
+
+        if (_policy == FRAME_DROP_SKIP) {
+            // Skip every frame whose whole slot already passed. Bounded by one loop through the animation
+            // so zero-length frames cannot spin forever; after that the timeline is restarted.
+            uint16_t skipped = 0;
+            while (!before(now, _deadline + duration(frame))) {
+                if (skipped == frameCount) {
+                    _deadline = now;
+                    break;
+                }
+                _deadline += duration(frame);
+                frame = stepFrame(frame, frameCount, step);
+                skipped++;
+            }
+            _stats.dropped += skipped;
+            lateness = now - _deadline;
+        }
+        else if (_policy == FRAME_DROP_RESYNC) {
+            _deadline = now;
+        }
+    }
+
+    record(lateness);
+    _deadline += duration(frame);
+    return true;
+}
+
+uint32_t FrameScheduler::scale(uint32_t duration, int16_t rate) {
+    uint32_t speed = rate < 0 ? -(int32_t)rate : rate;
+    if (speed == 0) {
+        speed = 1;
+    }
+    uint32_t scaled = (duration * PLAYBACK_RATE_ONE + speed / 2) / speed;
+    return scaled > 0 ? scaled : 1;
+}
+
+uint32_t FrameScheduler::untilDue(uint32_t now) const {
+    return before(now, _deadline) ? _deadline - now : 0;
+}
+
+uint16_t FrameScheduler::progress(uint32_t now, uint32_t duration) const {
+    uint32_t remaining = untilDue(now);
+    if (duration == 0 || remaining >= duration) {
+        return 0;
+    }
+    return (uint64_t)(duration - remaining) * PLAYBACK_RATE_ONE / duration;
+}
+
+void FrameScheduler::resetStats() {
+    _stats = {};
+}
+
+void FrameScheduler::record(uint32_t lateness) {
+    _stats.frames++;
+    if (lateness > 0) {
+        _stats.lateFrames++;
+        _stats.totalLateness += lateness;
+        if (lateness > _stats.maxLateness) {
+            _stats.maxLateness = lateness;
+        }
+    }
+}
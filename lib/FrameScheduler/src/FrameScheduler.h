@@ -0,0 +1,62 @@
+#ifndef FRAMESCHEDULER_H
+#define FRAMESCHEDULER_H
+
+#include <stdint.h>
+
+// Playback rates are signed 8.8 fixed point: PLAYBACK_RATE_ONE plays at the authored speed,
+// negative rates play backwards
+#define PLAYBACK_RATE_ONE 256
+
+// What to do when the renderer wakes up after one or more frames should already have ended
+enum FrameDropPolicy {
+    FRAME_DROP_SKIP,     // Jump to the frame that should be on screen now, the timeline keeps its authored timing
+    FRAME_DROP_CATCH_UP, // Show every frame, late ones back to back until the timeline has caught up
+    FRAME_DROP_RESYNC    // Show every frame and restart the timeline from now (the animation slows down)
+};
+
+struct FrameStats {
+    uint32_t frames;       // Frames presented
+    uint32_t dropped;      // Frames skipped to stay on time
+    uint32_t lateFrames;   // Frames presented after their deadline
+    uint32_t maxLateness;  // Worst lateness in ms
+    uint64_t totalLateness;
+};
+
+// Tracks absolute frame deadlines measured from the start of an animation, so time lost while
+// waking up late is not added to the following frames. Times are in ms and may wrap around.
+// Has no dependency on the Arduino core; pass millis() (or a virtual clock) as now.
+class FrameScheduler {
+public:
+    // Returns how long the given frame stays on screen in ms
+    typedef uint32_t (*DurationFn)(uint16_t frame);
+
+    explicit FrameScheduler(FrameDropPolicy policy = FRAME_DROP_SKIP) : _policy(policy) {}
+
+    void setPolicy(FrameDropPolicy policy) { _policy = policy; }
+    FrameDropPolicy policy() const { return _policy; }
+
+    // Restarts the timeline, the frame passed to the next update() is due at now
+    void start(uint32_t now);
+    // Returns true when a new frame has to be presented and moves frame to it. step is 1 to play forwards,
+    // -1 to play backwards and 0 to hold the current frame (paused playback), which never needs presenting again.
+    bool update(uint32_t now, uint16_t& frame, uint16_t frameCount, DurationFn duration, int8_t step = 1);
+    // Scales an authored duration by a playback rate, at least 1 ms so playback always moves on
+    static uint32_t scale(uint32_t duration, int16_t rate);
+    // Time in ms until the next frame is due, 0 if it is already due
+    uint32_t untilDue(uint32_t now) const;
+    // How far the frame on screen is through its duration, 0..PLAYBACK_RATE_ONE (8.8 fixed point)
+    uint16_t progress(uint32_t now, uint32_t duration) const;
+
+    const FrameStats& stats() const { return _stats; }
+    void resetStats();
+
+private:
+    void record(uint32_t lateness);
+
+    FrameDropPolicy _policy;
+    uint32_t _deadline = 0;   // End of the frame on screen, i.e. start of the next one
+    bool _started = false;    // False until the first frame of the timeline is presented
+    FrameStats _stats = {};
+};
+
+#endif // FRAMESCHEDULER_H
@@ -0,0 +1,71 @@
+#include "LedOutput.h"
+#include "Trace.h"
+
+#define LED_OUTPUT_TASK_STACK 4096
+
+LedOutput::LedOutput(CRGB* back, uint16_t count)
+    : _back(back), _count(count) {}
+
+bool LedOutput::begin(CLEDController& controller, uint8_t core, UBaseType_t priority) {
+    _front = new CRGB[_count];
+    _done = xSemaphoreCreateBinary();
+    if (_front == nullptr || _done == nullptr) {
+        return false;
+    }
+    xSemaphoreGive(_done);
+
+    // The RMT interrupt is installed on the core of the first show(), keep it away from WiFi
+    if (xTaskCreatePinnedToCore(outputTask, "ledout", LED_OUTPUT_TASK_STACK, this, priority, &_task, core) != pdPASS) {
+        _task = nullptr;
+        return false;
+    }
+    memcpy(_front, _back, _count * sizeof(CRGB));
+    controller.setLeds(_front, _count);
+    return true;
+}
+
+bool LedOutput::present() {
+    if (_task == nullptr) {
+        FastLED.show();
+        return true;
+    }
+
+    // The front buffer may only change once the previous frame is out
+    xSemaphoreTake(_done, portMAX_DELAY);
+    if (_brightness == FastLED.getBrightness() && memcmp(_front, _back, _count * sizeof(CRGB)) == 0) {
+        // The LEDs already show this frame
+        _skipped++;
+        trace.event(TRACE_LED_SKIPPED);
+        xSemaphoreGive(_done);
+        return false;
+    }
+    memcpy(_front, _back, _count * sizeof(CRGB));
+    _brightness = FastLED.getBrightness();
+    _busy = true;
+    xTaskNotifyGive(_task);
+    return true;
+}
+
+bool LedOutput::waitForCompletion(TickType_t timeout) {
+    if (_done == nullptr || xSemaphoreTake(_done, timeout) != pdTRUE) {
+        return false;
+    }
+    xSemaphoreGive(_done);
+    return true;
+}
+
+void LedOutput::outputTask(void* parameter) {
+    LedOutput* output = (LedOutput*)parameter;
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t start = micros();
+        {
+            MetricSpan span(METRIC_SHOW);
+            FastLED.show();
+        }
+        output->_showMicros = micros() - start;
+        output->_frames++;
+        output->_busy = false;
+        xSemaphoreGive(output->_done);
+    }
+}
@@ -0,0 +1,44 @@
+#ifndef LEDOUTPUT_H
+#define LEDOUTPUT_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+#include "Metrics.h"
+
+// Double-buffered LED output. Frames are composed into the back buffer (the one the matrix draws into)
+// while a dedicated task transmits the front buffer. On the ESP32 FastLED feeds the chain from the RMT
+// peripheral and sleeps until the transmission-done interrupt, so the caller only pays for a buffer copy.
+class LedOutput {
+public:
+    LedOutput(CRGB* back, uint16_t count);
+    // Points the controller at the front buffer and starts the output task
+    bool begin(CLEDController& controller, uint8_t core, UBaseType_t priority);
+    // Hands the back buffer over for transmission. Waits for the previous frame to finish first.
+    // Returns false without transmitting when neither the pixels nor the brightness changed.
+    bool present();
+    // Completion fence: returns true once the last presented frame is out on the wire
+    bool waitForCompletion(TickType_t timeout = portMAX_DELAY);
+    bool busy() const { return _busy; }
+    // True when the LEDs were last sent at another brightness than the current one
+    bool brightnessChanged() const { return _brightness != FastLED.getBrightness(); }
+    uint32_t showMicros() const { return _showMicros; }   // Duration of the last transmission
+    uint32_t frames() const { return _frames; }
+    uint32_t skipped() const { return _skipped; }         // Frames not sent because nothing changed
+    TaskHandle_t task() const { return _task; }
+
+private:
+    static void outputTask(void* parameter);
+
+    CRGB* _back;
+    CRGB* _front = nullptr;
+    uint16_t _count;
+    TaskHandle_t _task = nullptr;
+    SemaphoreHandle_t _done = nullptr;   // Given when the front buffer is free again
+    volatile bool _busy = false;
+    volatile uint32_t _showMicros = 0;
+    volatile uint32_t _frames = 0;
+    uint32_t _skipped = 0;
+    int16_t _brightness = -1;            // Brightness of the frame in the front buffer
+};
+
+#endif // LEDOUTPUT_H
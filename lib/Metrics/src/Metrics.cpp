@@ -0,0 +1,90 @@
+#include "Metrics.h"
+#include "Trace.h"
+
+// Bucket upper bounds in microseconds, from a fraction of a frame to a stall of several frames
+static const uint32_t METRIC_BUCKET_US[METRIC_BUCKETS - 1] = {10, 25, 50, 100, 250, 500, 1000, 2500, 5000, 10000, 25000};
+static const char* const stageNames[METRIC_STAGE_COUNT] = {"wifi", "decode", "draw", "overlay", "present", "show"};
+
+Metrics metrics;
+
+void Metrics::begin() {
+    _cyclesPerMicro = ESP.getCpuFreqMHz();
+    for (uint8_t b = 0; b < METRIC_BUCKETS - 1; b++) {
+        _bucketCycles[b] = METRIC_BUCKET_US[b] * _cyclesPerMicro;
+    }
+}
+
+void Metrics::record(MetricStage stage, uint32_t cycles) {
+    if (stage >= METRIC_STAGE_COUNT) {
+        return;
+    }
+    uint8_t bucket = 0;
+    while (bucket < METRIC_BUCKETS - 1 && cycles > _bucketCycles[bucket]) {
+        bucket++;
+    }
+
+    Slot& slot = _slots[stage];
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    StageHistogram& h = slot.histogram;
+    h.buckets[bucket]++;
+    h.count++;
+    h.sumCycles += cycles;
+    if (cycles > h.maxCycles) {
+        h.maxCycles = cycles;
+    }
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+
+    trace.event(TRACE_STAGE, stage, cycles / _cyclesPerMicro);
+}
+
+bool Metrics::snapshot(MetricStage stage, StageHistogram& out) const {
+    const Slot& slot = _slots[stage];
+    for (uint8_t attempt = 0; attempt < 100; attempt++) {
+        uint32_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before & 1) {
+            continue;
+        }
+        out = slot.histogram;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot.sequence.load(std::memory_order_relaxed) == before) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Metrics::writePrometheus(Print& out) const {
+    double cyclesPerSecond = _cyclesPerMicro * 1e6;
+
+    out.print("# HELP neomatrix_stage_duration_seconds Time spent per call in each stage of the render, LED output and network tasks\n"
+              "# TYPE neomatrix_stage_duration_seconds histogram\n");
+    for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+        StageHistogram h;
+        if (!snapshot((MetricStage)s, h)) {
+            continue;
+        }
+        uint32_t cumulative = 0;
+        for (uint8_t b = 0; b < METRIC_BUCKETS - 1; b++) {
+            cumulative += h.buckets[b];
+            out.printf("neomatrix_stage_duration_seconds_bucket{stage=\"%s\",le=\"%g\"} %u\n", stageNames[s], METRIC_BUCKET_US[b] / 1e6, (unsigned)cumulative);
+        }
+        out.printf("neomatrix_stage_duration_seconds_bucket{stage=\"%s\",le=\"+Inf\"} %u\n", stageNames[s], (unsigned)h.count);
+        out.printf("neomatrix_stage_duration_seconds_sum{stage=\"%s\"} %.6f\n", stageNames[s], h.sumCycles / cyclesPerSecond);
+        out.printf("neomatrix_stage_duration_seconds_count{stage=\"%s\"} %u\n", stageNames[s], (unsigned)h.count);
+    }
+
+    out.print("# HELP neomatrix_stage_max_seconds Longest single call of each stage since boot\n"
+              "# TYPE neomatrix_stage_max_seconds gauge\n");
+    for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+        StageHistogram h;
+        if (snapshot((MetricStage)s, h)) {
+            out.printf("neomatrix_stage_max_seconds{stage=\"%s\"} %.6f\n", stageNames[s], h.maxCycles / cyclesPerSecond);
+        }
+    }
+}
+
+const char* Metrics::name(MetricStage stage) {
+    return stage < METRIC_STAGE_COUNT ? stageNames[stage] : "unknown";
+}
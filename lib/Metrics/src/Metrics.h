@@ -0,0 +1,67 @@
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include <atomic>
+
+// Stages of the render, LED output and network tasks that are timed
+enum MetricStage : uint8_t {
+    METRIC_WIFI,        // WiFiManager processing
+    METRIC_DECODE,      // Frame decoding and palette expansion
+    METRIC_DRAW,        // Drawing a frame or a clock into the LED buffer
+    METRIC_OVERLAY,     // Message rasterization and composition
+    METRIC_PRESENT,     // Handing a frame to the LED output, including the wait for the previous one
+    METRIC_SHOW,        // Transmitting a frame to the LEDs
+    METRIC_STAGE_COUNT
+};
+
+#define METRIC_BUCKETS 12 // Upper bounds in METRIC_BUCKET_US plus one for anything slower
+
+// Span durations of one stage. Each stage is recorded by a single task; other tasks read it through
+// a sequence counter that is odd while an update is in progress, so nothing is locked or allocated.
+struct StageHistogram {
+    uint32_t buckets[METRIC_BUCKETS]; // Spans per bucket, not cumulative
+    uint32_t count;
+    uint32_t maxCycles;
+    uint64_t sumCycles;
+};
+
+class Metrics {
+public:
+    // Converts the bucket bounds to CPU cycles at the current clock
+    void begin();
+    static inline uint32_t cycles() { return ESP.getCycleCount(); }
+    // Adds a span to the histogram of its stage and to the trace
+    void record(MetricStage stage, uint32_t cycles);
+    // Copies a histogram while it may be written. Returns false if the writer kept it busy.
+    bool snapshot(MetricStage stage, StageHistogram& out) const;
+    // Writes all histograms in the Prometheus text format
+    void writePrometheus(Print& out) const;
+    static const char* name(MetricStage stage);
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence{0};
+        StageHistogram histogram = {};
+    };
+
+    Slot _slots[METRIC_STAGE_COUNT];
+    uint32_t _bucketCycles[METRIC_BUCKETS - 1] = {};
+    uint32_t _cyclesPerMicro = 240;
+};
+
+extern Metrics metrics;
+
+// Records the time from construction to the end of the enclosing scope. Each core has its own cycle
+// counter, so spans are only taken in tasks pinned to a core.
+class MetricSpan {
+public:
+    explicit MetricSpan(MetricStage stage) : _stage(stage), _start(Metrics::cycles()) {}
+    ~MetricSpan() { metrics.record(_stage, Metrics::cycles() - _start); }
+
+private:
+    MetricStage _stage;
+    uint32_t _start;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,106 @@
+#include "Trace.h"
+#include "Metrics.h"
+
+struct TraceEventInfo {
+    char phase;        // Chrome trace phase: 'X' spans ending at the record, 'i' instants, 'C' counters
+    const char* name;
+    const char* arg;   // Labels of the argument and the value, empty when unused
+    const char* value;
+};
+
+static const TraceEventInfo traceEvents[TRACE_EVENT_COUNT] = {
+    {'X', "stage", "stage", "us"},
+    {'i', "frame", "animation", "frame"},
+    {'i', "encoder1", "type", "delta"},
+    {'i', "encoder2", "type", "delta"},
+    {'i', "command", "type", "value"},
+    {'i', "animation", "", "index"},
+    {'i', "clock_mode", "", "mode"},
+    {'i', "clock_display", "", "enabled"},
+    {'i', "auto_advance", "", "enabled"},
+    {'i', "animation_enabled", "", "enabled"},
+    {'C', "playback_rate", "", "percent"},
+    {'C', "brightness", "", "percent"},
+    {'C', "animation_interval", "", "seconds"},
+    {'i', "time_sync", "", "epoch"},
+    {'i', "time_unknown", "clock", ""},
+    {'i', "led_skipped", "", ""},
+};
+
+Trace trace;
+
+void Trace::event(TraceEvent event, uint16_t arg, int32_t value) {
+    uint32_t index = _next.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = _slots[index & (TRACE_RECORDS - 1)];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record = {index + 1, (uint32_t)micros(), event, (uint8_t)xPortGetCoreID(), arg, value};
+    slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+// Copies a record unless it was overwritten by a later one or is still being written
+bool Trace::read(uint32_t index, TraceRecord& out) const {
+    const Slot& slot = _slots[index & (TRACE_RECORDS - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != index + 1) {
+        return false;
+    }
+    out = slot.record;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == index + 1;
+}
+
+// Produces the dump as a series of byte ranges, all values little endian
+template <typename Emit> void Trace::write(Emit emit) const {
+    uint32_t next = _next.load(std::memory_order_acquire);
+    uint32_t now = micros();
+    uint8_t header[16] = {'N', 'M', 'T', 'R', TRACE_VERSION, sizeof(TraceRecord), TRACE_EVENT_COUNT, METRIC_STAGE_COUNT};
+    memcpy(header + 8, &next, sizeof(next));
+    memcpy(header + 12, &now, sizeof(now));
+    emit(header, sizeof(header));
+
+    // Event table: phase, then the name and the two labels, each terminated by a zero byte
+    for (uint8_t e = 0; e < TRACE_EVENT_COUNT; e++) {
+        const TraceEventInfo& info = traceEvents[e];
+        emit((const uint8_t*)&info.phase, 1);
+        emit((const uint8_t*)info.name, strlen(info.name) + 1);
+        emit((const uint8_t*)info.arg, strlen(info.arg) + 1);
+        emit((const uint8_t*)info.value, strlen(info.value) + 1);
+    }
+    for (uint8_t s = 0; s < METRIC_STAGE_COUNT; s++) {
+        const char* name = Metrics::name((MetricStage)s);
+        emit((const uint8_t*)name, strlen(name) + 1);
+    }
+
+    // Records up to the end of the stream
+    uint32_t first = next > TRACE_RECORDS ? next - TRACE_RECORDS : 0;
+    for (uint32_t index = first; index != next; index++) {
+        TraceRecord record;
+        if (read(index, record)) {
+            emit((const uint8_t*)&record, sizeof(record));
+        }
+    }
+}
+
+void Trace::writeBinary(Print& out) const {
+    write([&out](const uint8_t* data, size_t length) { out.write(data, length); });
+}
+
+void Trace::writeHex(Print& out) const {
+    static const char digits[] = "0123456789abcdef";
+    uint8_t column = 0;
+    out.print("--- trace begin ---\n");
+    write([&out, &column](const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            char hex[3] = {digits[data[i] >> 4], digits[data[i] & 0x0f], 0};
+            out.print(hex);
+            if (++column == 32) {
+                out.print("\n");
+                column = 0;
+            }
+        }
+    });
+    if (column != 0) {
+        out.print("\n");
+    }
+    out.print("--- trace end ---\n");
+}
@@ -0,0 +1,72 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <Arduino.h>
+#include <atomic>
+
+#define TRACE_RECORDS 512 // Power of two, 16 bytes each
+#define TRACE_VERSION 1
+
+// Events of the binary trace. Each one carries a 16 bit argument and a 32 bit value, their meaning is
+// described next to the name in Trace.cpp. That table is written into every dump, so the converter
+// (scripts/trace2chrome.py) does not keep its own copy.
+enum TraceEvent : uint8_t {
+    TRACE_STAGE,             // A timed stage ended: MetricStage, duration in us
+    TRACE_FRAME,             // Animation frame drawn: animation index, frame
+    TRACE_ENCODER1,          // Left encoder event: EncoderEventType, delta
+    TRACE_ENCODER2,          // Right encoder event: EncoderEventType, delta
+    TRACE_COMMAND,           // Render command received: RenderCommandType, value
+    TRACE_ANIMATION,         // Animation started: -, animation index
+    TRACE_CLOCK_MODE,        // Clock mode changed: -, mode
+    TRACE_CLOCK_DISPLAY,     // Switched between animation and clock: -, 1 for the clock
+    TRACE_AUTO_ADVANCE,      // Auto advance toggled: -, enabled
+    TRACE_ANIMATION_ENABLED, // Playback paused or resumed: -, enabled
+    TRACE_PLAYBACK_RATE,     // Playback rate: -, percent
+    TRACE_BRIGHTNESS,        // Brightness: -, percent
+    TRACE_INTERVAL,          // Animation change interval: -, seconds
+    TRACE_TIME_SYNC,         // SNTP set the wall clock: -, epoch seconds
+    TRACE_TIME_UNKNOWN,      // A clock was not drawn for lack of time: clock mode, -
+    TRACE_LED_SKIPPED,       // LED output skipped a frame identical to the one shown
+    TRACE_EVENT_COUNT
+};
+
+// One entry of the ring, 16 bytes in the dump and in memory
+struct TraceRecord {
+    uint32_t sequence; // Number of the record since boot plus one
+    uint32_t time;     // micros(), wraps after 71 minutes
+    uint8_t event;     // TraceEvent
+    uint8_t core;
+    uint16_t arg;
+    int32_t value;
+};
+static_assert(sizeof(TraceRecord) == 16, "the dump format has 16 byte records");
+
+// Fixed-size ring of timestamped events that any task can append to without locking or formatting.
+// When full the oldest records are overwritten. Reading is only done to dump the ring, and skips
+// records that are overwritten while it runs.
+class Trace {
+public:
+    void event(TraceEvent event, uint16_t arg = 0, int32_t value = 0);
+    // Number of records appended since boot
+    uint32_t written() const { return _next.load(std::memory_order_relaxed); }
+    // Writes the header, the event table and the records still in the ring, oldest first
+    void writeBinary(Print& out) const;
+    // Same bytes as hex lines between "--- trace begin ---" and "--- trace end ---", for a serial terminal
+    void writeHex(Print& out) const;
+
+private:
+    struct Slot {
+        std::atomic<uint32_t> sequence{0}; // 0 while the slot is written
+        TraceRecord record = {};
+    };
+
+    bool read(uint32_t index, TraceRecord& out) const;
+    template <typename Emit> void write(Emit emit) const;
+
+    Slot _slots[TRACE_RECORDS];
+    std::atomic<uint32_t> _next{0};
+};
+
+extern Trace trace;
+
+#endif // TRACE_H
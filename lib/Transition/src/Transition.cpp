@@ -0,0 +1,85 @@
+#include "Transition.h"
+
+static const char* const transitionNames[TRANSITION_TYPE_COUNT] = {"none", "crossfade", "wipe", "dissolve"};
+
+// Spreads LED indices over 0..255 so dissolves do not switch over in chain order.
+// An odd multiplier followed by a bit reversal visits every rank once per 256 LEDs.
+static inline uint8_t dissolveRank(uint16_t index) {
+    uint8_t x = index * 167 + (index >> 8);
+    x = (x & 0xF0) >> 4 | (x & 0x0F) << 4;
+    x = (x & 0xCC) >> 2 | (x & 0x33) << 2;
+    return (x & 0xAA) >> 1 | (x & 0x55) << 1;
+}
+
+void Transition::start(TransitionType type, uint16_t length_ms, uint32_t now) {
+    _type = length_ms > 0 && type < TRANSITION_TYPE_COUNT ? type : TRANSITION_NONE;
+    _length = length_ms;
+    _start = now;
+}
+
+bool Transition::active(uint32_t now) {
+    if (_type != TRANSITION_NONE && now - _start >= _length) {
+        _type = TRANSITION_NONE;
+    }
+    return _type != TRANSITION_NONE;
+}
+
+uint16_t Transition::progress(uint32_t now) const {
+    uint32_t elapsed = now - _start;
+    return elapsed >= _length ? TRANSITION_PROGRESS_ONE : elapsed * TRANSITION_PROGRESS_ONE / _length;
+}
+
+void Transition::apply(CRGB* leds, uint32_t now) const {
+    uint16_t p = progress(now);
+
+    switch (_type) {
+        case TRANSITION_CROSSFADE:
+            blend(leds, _from, _count, p);
+            break;
+        case TRANSITION_WIPE: {
+            if (_columns == nullptr) {
+                break;
+            }
+            uint16_t edge = p * _width / TRANSITION_PROGRESS_ONE; // Columns left of the edge show the new frame
+            for (uint16_t i = 0; i < _count; i++) {
+                if (_columns[i] >= edge) {
+                    leds[i] = _from[i];
+                }
+            }
+            break;
+        }
+        case TRANSITION_DISSOLVE:
+            for (uint16_t i = 0; i < _count; i++) {
+                if (dissolveRank(i) >= p) {
+                    leds[i] = _from[i];
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+void Transition::blend(CRGB* leds, const CRGB* from, uint16_t count, uint16_t progress) {
+    // out = from + (to - from) * p, per channel in 8.8 fixed point
+    uint16_t p = progress;
+    uint16_t q = TRANSITION_PROGRESS_ONE - p;
+    for (uint16_t i = 0; i < count; i++) {
+        leds[i].r = (leds[i].r * p + from[i].r * q) >> 8;
+        leds[i].g = (leds[i].g * p + from[i].g * q) >> 8;
+        leds[i].b = (leds[i].b * p + from[i].b * q) >> 8;
+    }
+}
+
+const char* Transition::name(TransitionType type) {
+    return type < TRANSITION_TYPE_COUNT ? transitionNames[type] : transitionNames[TRANSITION_NONE];
+}
+
+TransitionType Transition::parse(const String& name) {
+    for (uint8_t i = 0; i < TRANSITION_TYPE_COUNT; i++) {
+        if (name == transitionNames[i]) {
+            return (TransitionType)i;
+        }
+    }
+    return TRANSITION_TYPE_COUNT;
+}
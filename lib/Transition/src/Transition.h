@@ -0,0 +1,56 @@
+#ifndef TRANSITION_H
+#define TRANSITION_H
+
+#include <Arduino.h>
+#include <FastLED.h>
+
+// Transition from the outgoing to the incoming animation. The numeric values are stored in animation packs.
+enum TransitionType : uint8_t {
+    TRANSITION_NONE = 0,
+    TRANSITION_CROSSFADE = 1,
+    TRANSITION_WIPE = 2,      // Left to right
+    TRANSITION_DISSOLVE = 3,  // Pixels switch over in a fixed pseudo-random order
+    TRANSITION_TYPE_COUNT
+};
+
+// Per-animation transition as stored in the pack: type + 1 in the low 3 bits, length in 100 ms units
+// in the high 5 bits. 0 means "use the global setting" for either part.
+#define TRANSITION_SPEC_HAS_TYPE(spec) (((spec) & 0x07) != 0)
+#define TRANSITION_SPEC_TYPE(spec) ((TransitionType)(((spec) & 0x07) - 1))
+#define TRANSITION_SPEC_LENGTH_MS(spec) ((uint16_t)((spec) >> 3) * 100)
+#define TRANSITION_PROGRESS_ONE 256 // Progress is 8.8 fixed point
+
+// Blends two frames while a transition runs. The outgoing frame is rendered into from() and the
+// incoming one into the LED buffer, which apply() then mixes in place. No memory is allocated.
+class Transition {
+public:
+    Transition(CRGB* from, uint16_t count) : _from(from), _count(count) {}
+    // columns holds the matrix column of every LED and is used by wipes
+    void setColumns(const uint8_t* columns, uint8_t width) { _columns = columns; _width = width; }
+    void start(TransitionType type, uint16_t length_ms, uint32_t now);
+    void stop() { _type = TRANSITION_NONE; }
+    // Ends the transition once its time is up, check before rendering the outgoing frame
+    bool active(uint32_t now);
+    CRGB* from() { return _from; }
+    // Mixes from() into leds by the progress at now
+    void apply(CRGB* leds, uint32_t now) const;
+
+    // Mixes from into leds in place: progress 0 gives from, TRANSITION_PROGRESS_ONE leaves leds unchanged
+    static void blend(CRGB* leds, const CRGB* from, uint16_t count, uint16_t progress);
+
+    static const char* name(TransitionType type);
+    static TransitionType parse(const String& name);
+
+private:
+    uint16_t progress(uint32_t now) const;
+
+    CRGB* _from;
+    uint16_t _count;
+    const uint8_t* _columns = nullptr;
+    uint8_t _width = 0;
+    TransitionType _type = TRANSITION_NONE;
+    uint16_t _length = 0;
+    uint32_t _start = 0;
+};
+
+#endif // TRANSITION_H
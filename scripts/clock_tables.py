@@ -0,0 +1,135 @@
+# Generates lib/Clocks/src/ClockTables.h, the precomputed geometry of the clock faces.
+# Run `python3 scripts/clock_tables.py` after changing the clock geometry below.
+#
+# Pixels are stored as y * 16 + x, so a clock renderer only needs a lookup into the matrix's LED index
+# table to write them straight into the LED buffer. Lines and circles are rasterized like Adafruit GFX does.
+
+import math
+import os
+
+SIZE = 16
+CENTER = SIZE // 2
+RADIUS = 7
+HANDS = [("HOUR", RADIUS - 4), ("MINUTE", RADIUS - 2), ("SECOND", RADIUS - 1)]
+RINGS = [16, 14, 12]
+OUTPUT = os.path.join("lib", "Clocks", "src", "ClockTables.h")
+
+def pixel(x, y):
+    return y * SIZE + x
+
+def line(x0, y0, x1, y1):
+    """Bresenham line, same pixels as Adafruit_GFX::writeLine."""
+    points = []
+    steep = abs(y1 - y0) > abs(x1 - x0)
+    if steep:
+        x0, y0, x1, y1 = y0, x0, y1, x1
+    if x0 > x1:
+        x0, x1, y0, y1 = x1, x0, y1, y0
+    dx, dy = x1 - x0, abs(y1 - y0)
+    err = dx // 2
+    ystep = 1 if y0 < y1 else -1
+    while x0 <= x1:
+        points.append((y0, x0) if steep else (x0, y0))
+        err -= dy
+        if err < 0:
+            y0 += ystep
+            err += dx
+        x0 += 1
+    return points
+
+def circle(x0, y0, r):
+    """Midpoint circle, same pixels as Adafruit_GFX::drawCircle."""
+    points = [(x0, y0 + r), (x0, y0 - r), (x0 + r, y0), (x0 - r, y0)]
+    f, ddf_x, ddf_y, x, y = 1 - r, 1, -2 * r, 0, r
+    while x < y:
+        if f >= 0:
+            y -= 1
+            ddf_y += 2
+            f += ddf_y
+        x += 1
+        ddf_x += 2
+        f += ddf_x
+        points += [(x0 + x, y0 + y), (x0 - x, y0 + y), (x0 + x, y0 - y), (x0 - x, y0 - y),
+                   (x0 + y, y0 + x), (x0 - y, y0 + x), (x0 + y, y0 - x), (x0 - y, y0 - x)]
+    return list(dict.fromkeys(points))
+
+def hand(position, radius):
+    """Pixels of a hand pointing at position 0..59 (0 = 12 o'clock), from the center outwards."""
+    angle = position / 60 * 2 * math.pi - math.pi / 2
+    x = CENTER + round(math.cos(angle) * radius)
+    y = CENTER + round(math.sin(angle) * radius)
+    points = line(CENTER, CENTER, x, y)
+    if points[0] != (CENTER, CENTER):
+        points.reverse()
+    return points
+
+def perimeter(ring_size, index):
+    """(x, y) of a position on a square ring, counted clockwise from the top center."""
+    start = (SIZE - ring_size) // 2
+    end = start + ring_size
+    side = ring_size - 1
+    index = (index + ring_size // 2) % (side * 4)
+    if index < side:
+        return start + index, start
+    if index < side * 2:
+        return end - 1, start + index - side
+    if index < side * 3:
+        return end - 1 - (index - side * 2), end - 1
+    return start, end - 1 - (index - side * 3)
+
+def arduino_map(x, in_min, in_max, out_min, out_max):
+    return (x - in_min) * (out_max - out_min) // (in_max - in_min) + out_min
+
+def c_array(name, values, ctype="uint8_t", per_line=20):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return f"static constexpr {ctype} {name}[{len(values)}] = {{\n" + "\n".join(lines) + "\n};\n"
+
+def generate():
+    out = ["// Generated by scripts/clock_tables.py, do not edit.",
+           "#ifndef CLOCKTABLES_H",
+           "#define CLOCKTABLES_H",
+           "",
+           "#include <stdint.h>",
+           "",
+           f"#define CLOCK_SIZE {SIZE}",
+           "#define CLOCK_PIXEL_X(p) ((p) % CLOCK_SIZE)",
+           "#define CLOCK_PIXEL_Y(p) ((p) / CLOCK_SIZE)",
+           ""]
+
+    face = [pixel(x, y) for x, y in circle(CENTER, CENTER, RADIUS)]
+    out.append("// Analog clock face circle")
+    out.append(c_array("CLOCK_FACE", face))
+
+    # Hands: for every one of the 60 positions a fixed-size slot of pixels; unused slots repeat the center
+    for name, radius in HANDS:
+        hands = [[pixel(x, y) for x, y in hand(position, radius)] for position in range(60)]
+        length = max(len(points) for points in hands)
+        flat = []
+        for points in hands:
+            flat += points + [points[0]] * (length - len(points))
+        out.append(f"// {name.capitalize()} hand (radius {radius}), {length} pixels for each of the 60 positions")
+        out.append(f"#define CLOCK_{name}_HAND_LENGTH {length}")
+        out.append(c_array(f"CLOCK_{name}_HAND", flat))
+
+    for ring_size in RINGS:
+        positions = (ring_size - 1) * 4
+        points = [pixel(*perimeter(ring_size, i)) for i in range(positions)]
+        out.append(f"// Ring of {ring_size}x{ring_size} pixels, {positions} positions clockwise from the top center")
+        out.append(f"#define CLOCK_RING{ring_size}_POSITIONS {positions}")
+        out.append(c_array(f"CLOCK_RING{ring_size}", points))
+
+    # Ring clock: minutes spread over the 52 middle ring positions, hours and quarters over the 44 inner ones
+    out.append("// Middle ring position of every minute")
+    out.append(c_array("CLOCK_RING_MINUTE", [arduino_map(m, 0, 59, 0, 51) for m in range(60)]))
+    out.append("// Inner ring position of every quarter hour (hour % 12 * 4 + minute / 15)")
+    out.append(c_array("CLOCK_RING_QUARTER", [arduino_map(q, 0, 47, 0, 43) for q in range(48)]))
+
+    out.append("#endif // CLOCKTABLES_H")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print(f"Generated {OUTPUT}")
+
+if __name__ == "__main__":
+    generate()
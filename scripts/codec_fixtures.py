@@ -0,0 +1,114 @@
+# Generates test/test_frame_codec/fixtures.h, synthetic animations encoded by encode_frames() in
+# scripts/convert.py, so the frame codec test round-trips the real encoder through the firmware's decoder.
+# Run `python3 scripts/codec_fixtures.py` after changing the encoder or the frames below.
+#
+# The frames come from the same generator as makeFrames() in the test, which rebuilds them to compare
+# against, so only the encoded pool, the frame ids and the palettes are stored.
+
+import ast
+import os
+
+CONVERTER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "convert.py")
+OUTPUT = os.path.join("test", "test_frame_codec", "fixtures.h")
+PIXELS = 256
+FRAMES = 34  # Three keyframe intervals, so seeking crosses keyframes
+SEED = 12345
+COLOR_BITS = [1, 2, 4, 8, 16]  # One animation per stored bpp
+
+def load_converter():
+    """Definitions of convert.py, without the conversion it runs when loaded."""
+    with open(CONVERTER) as f:
+        tree = ast.parse(f.read(), CONVERTER)
+    tree.body = [node for node in tree.body
+                 if isinstance(node, (ast.Import, ast.FunctionDef, ast.ClassDef))
+                 or (isinstance(node, ast.Assign)
+                     and all(isinstance(target, ast.Name) and target.id.isupper() for target in node.targets))]
+    namespace = {}
+    exec(compile(tree, CONVERTER, "exec"), namespace)
+    return namespace
+
+def make_frames(bits):
+    """Frames mixing noise, solid runs longer than one op and regions left unchanged from the previous
+    frame, with colours of the given number of bits. Must match makeFrames() in the test."""
+    seed = SEED
+
+    def next_random():
+        nonlocal seed
+        seed = (seed * 1664525 + 1013904223) & 0xFFFFFFFF
+        return seed >> 8
+
+    mask = (1 << bits) - 1
+    frames = []
+    frame = [0] * PIXELS
+    for _ in range(FRAMES):
+        start = next_random() % PIXELS
+        length = next_random() % PIXELS
+        kind = next_random() % 3
+        fill = next_random() & mask
+        for i in range(start, min(start + length, PIXELS)):
+            frame[i] = next_random() & mask if kind == 0 else (fill if kind == 1 else frame[i] ^ (i & mask))
+        frames.append(list(frame))
+    return frames
+
+def c_array(name, values, ctype="uint8_t", per_line=20):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return f"static constexpr {ctype} {name}[{len(values)}] = {{\n" + "\n".join(lines) + "\n};\n"
+
+def generate():
+    converter = load_converter()
+    pool = converter["FramePool"]()
+    fixtures = []
+    for bits in COLOR_BITS:
+        palette, bpp, frame_ids = converter["encode_frames"](make_frames(bits), pool)
+        if bpp != min(bits, converter["RAW_BPP"]):
+            raise ValueError(f"{bits} bit colours were stored at {bpp} bpp")
+        fixtures.append((bits, bpp, palette, frame_ids))
+
+    offsets = []
+    position = 0
+    for blob in pool.blobs:
+        offsets.append(position)
+        position += len(blob)
+
+    out = ["// Generated by scripts/codec_fixtures.py, do not edit.",
+           "#ifndef CODEC_FIXTURES_H",
+           "#define CODEC_FIXTURES_H",
+           "",
+           "#include <stdint.h>",
+           "",
+           f"#define CODEC_FIXTURE_PIXELS {PIXELS}",
+           f"#define CODEC_FIXTURE_FRAMES {FRAMES}",
+           f"#define CODEC_FIXTURE_SEED {SEED}",
+           f"#define CODEC_KEYFRAME_INTERVAL {converter['KEYFRAME_INTERVAL']}",
+           "",
+           f"// Encoded frames of all animations, {len(pool.blobs)} unique ones",
+           c_array("CODEC_POOL", b"".join(pool.blobs)),
+           c_array("CODEC_POOL_OFFSETS", offsets, "uint32_t", 10)]
+    for bits, bpp, palette, frame_ids in fixtures:
+        out.append(f"// {bits} bit colours, stored at {bpp} bpp")
+        out.append(c_array(f"CODEC_FRAMES_{bits}", frame_ids, "uint16_t"))
+        if palette is not None:
+            out.append(c_array(f"CODEC_PALETTE_{bits}", palette, "uint16_t"))
+
+    out.append("struct CodecFixture {")
+    out.append("    uint8_t colorBits;")
+    out.append("    uint8_t bpp;")
+    out.append("    const uint16_t* frames;")
+    out.append("    const uint16_t* palette; // nullptr for raw RGB565")
+    out.append("};")
+    out.append("")
+    entries = [f"    {{{bits}, {bpp}, CODEC_FRAMES_{bits}, {'nullptr' if palette is None else f'CODEC_PALETTE_{bits}'}}},"
+               for bits, bpp, palette, _ in fixtures]
+    out.append(f"static constexpr CodecFixture CODEC_FIXTURES[{len(fixtures)}] = {{")
+    out += entries
+    out.append("};")
+    out.append("")
+    out.append("#endif // CODEC_FIXTURES_H")
+    with open(OUTPUT, "w") as f:
+        f.write("\n".join(out) + "\n")
+    print(f"Generated {OUTPUT}")
+
+if __name__ == "__main__":
+    generate()
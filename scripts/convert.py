@@ -1,21 +1,226 @@
 # Generated by Gemini (Fast)
 #
 # This script converts WLED JSON preset backups of Pipplee (https://pipplee.com/) generated WLED config 
-# into C++ header files suitable for use in an Arduino project with a 16x16 LED matrix.
+# into a binary animation pack that the firmware reads from the "anims" flash partition of a 16x16 LED matrix.
+# The pack is flashed with `pio run -t uploadpack`, separately from the firmware.
 
 import json
 import os
+import struct
 import sys
-import shutil
+import zlib
 
 # Configuration
 ANIMATIONS_DIR = "animations_src"
-INCLUDE_DIR = "include/animations"
-MASTER_HEADER = os.path.join(INCLUDE_DIR, "animations.h")
+PACK_FILE = os.path.join(".pio", "animations.bin")
+PARTITIONS_FILE = "huge_app.csv"
+PACK_PARTITION = "anims"
 PIXEL_COUNT = 256 # Assuming 16x16 matrix
-
-def generate_animation_header(file_path, base_name, width, height):
-    """Generates a single header file for one animation."""
+KEYFRAME_INTERVAL = 16 # Force a keyframe at least every N frames to bound the cost of seeking
+DEFAULT_DURATION_MS = 200 # Frame duration when the playlist does not provide one
+MAX_DURATION_MS = 0xFFFF  # Durations are stored as uint16 milliseconds
+
+# Frame codec (must match lib/FrameCodec)
+# Pixels are stored as symbols: palette indices of 1, 2, 4 or 8 bits, or raw RGB565 (16 bits)
+# when an animation has more than 256 colours. Every frame is a flags byte followed by
+# run-length coded ops over the XOR of this frame's symbols and the previous frame's.
+# Keyframes are coded against an all-zero frame, so they decode standalone.
+FRAME_KEY = 0x01
+OP_SKIP = 0     # count pixels unchanged
+OP_LITERAL = 1  # count XOR symbols follow, packed LSB first and padded to a whole byte
+OP_FILL = 2     # one XOR symbol follows in whole bytes, applied to count pixels
+MAX_RUN = 64    # count is stored as (count - 1) in the low 6 bits of the op byte
+RAW_BPP = 16
+# Native frames are stored uncompressed as CRGB (r, g, b bytes) in the order the LEDs are wired, so the
+# firmware can copy them straight into the LED buffer. They must match the NeoMatrix layout in main.cpp:
+# NEO_MATRIX_BOTTOM + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG.
+NATIVE_BPP = 24
+# Transitions into an animation (must match lib/Transition). Stored in one byte: type + 1 in the low 3 bits,
+# length in 100 ms units in the high 5 bits; 0 in either part lets the firmware use its global setting.
+TRANSITION_TYPES = {"none": 0, "crossfade": 1, "wipe": 2, "dissolve": 3}
+MAX_TRANSITION_MS = 31 * 100
+
+def build_palette(frames):
+    """Returns the animation's colours, most frequent first, so the background becomes symbol 0."""
+    usage = {}
+    for pixels in frames:
+        for color in pixels:
+            usage[color] = usage.get(color, 0) + 1
+    return sorted(usage, key=lambda color: (-usage[color], color))
+
+def pick_bpp(color_count):
+    """Smallest supported symbol size that still holds every colour losslessly."""
+    for bpp in (1, 2, 4, 8):
+        if color_count <= (1 << bpp):
+            return bpp
+    return RAW_BPP
+
+def pack_symbols(symbols, bpp):
+    out = bytearray()
+    acc, bits = 0, 0
+    for symbol in symbols:
+        acc |= symbol << bits
+        bits += bpp
+        while bits >= 8:
+            out.append(acc & 0xFF)
+            acc >>= 8
+            bits -= 8
+    if bits:
+        out.append(acc & 0xFF)
+    return out
+
+def encode_frame(symbols, previous, bpp):
+    """Encodes one frame of symbols as an RLE XOR delta. previous=None produces a keyframe."""
+    key = previous is None
+    if key:
+        previous = [0] * len(symbols)
+    delta = [p ^ q for p, q in zip(symbols, previous)]
+
+    fill_bytes = (bpp + 7) // 8
+    # Shortest run for which a fill (op byte + symbol, and an op byte to resume literals) beats literals
+    min_fill_run = (2 + fill_bytes) * 8 // bpp + 1
+
+    out = bytearray([FRAME_KEY if key else 0])
+    literals = []
+
+    def flush_literals():
+        while literals:
+            chunk = literals[:MAX_RUN]
+            del literals[:MAX_RUN]
+            out.append((OP_LITERAL << 6) | (len(chunk) - 1))
+            out.extend(pack_symbols(chunk, bpp))
+
+    i = 0
+    while i < len(delta):
+        run = 1
+        while i + run < len(delta) and run < MAX_RUN and delta[i + run] == delta[i]:
+            run += 1
+        if delta[i] == 0:
+            flush_literals()
+            out.append((OP_SKIP << 6) | (run - 1))
+        elif run >= min_fill_run:
+            flush_literals()
+            out.append((OP_FILL << 6) | (run - 1))
+            out.extend(delta[i].to_bytes(fill_bytes, 'little'))
+        else:
+            literals.extend(delta[i:i + run])
+        i += run
+    flush_literals()
+    return bytes(out)
+
+def decode_frame(blob, previous, bpp):
+    """Reference decoder, used to verify that the encoding is lossless."""
+    symbols = [0] * len(previous) if blob[0] & FRAME_KEY else list(previous)
+    mask = (1 << bpp) - 1
+    fill_bytes = (bpp + 7) // 8
+    pos, i = 1, 0
+    while i < len(symbols):
+        op, count = blob[pos] >> 6, (blob[pos] & 0x3F) + 1
+        pos += 1
+        if op == OP_LITERAL:
+            size = (count * bpp + 7) // 8
+            acc = int.from_bytes(blob[pos:pos + size], 'little')
+            for n in range(count):
+                symbols[i + n] ^= (acc >> (n * bpp)) & mask
+            pos += size
+        elif op == OP_FILL:
+            value = int.from_bytes(blob[pos:pos + fill_bytes], 'little')
+            for n in range(count):
+                symbols[i + n] ^= value
+            pos += fill_bytes
+        i += count
+    return symbols
+
+class FramePool:
+    """Content-addressed store of encoded frames shared by all animations.
+    Identical blobs are stored once, whichever animation or frame position they come from.
+    A delta blob only XORs symbols, so it is valid wherever its bytes are referenced."""
+
+    def __init__(self):
+        self.ids = {}
+        self.blobs = []
+        self.size = 0
+
+    def cost(self, blob):
+        return 0 if blob in self.ids else len(blob)
+
+    def add(self, blob):
+        if blob not in self.ids:
+            if len(self.blobs) > 0xFFFF:
+                raise ValueError("Frame pool is full (more than 65536 unique frames)")
+            self.ids[blob] = len(self.blobs)
+            self.blobs.append(blob)
+            self.size += len(blob)
+        return self.ids[blob]
+
+def led_index(x, y, width, height):
+    """Position of pixel (x, y) on the LED chain: rows from the bottom, every other row reversed."""
+    row = height - 1 - y
+    column = width - 1 - x if row & 1 else x
+    return row * width + column
+
+def encode_native_frames(frames, width, height, pool):
+    """Stores RGB888 frames in LED order, skipping RGB565 quantization and palettes.
+    Returns (palette, bpp, frame_ids) like encode_frames."""
+    frame_ids = []
+    for pixels in frames:
+        blob = bytearray(width * height * 3)
+        for y in range(height):
+            for x in range(width):
+                led = led_index(x, y, width, height)
+                blob[led * 3:led * 3 + 3] = bytes(pixels[y * width + x])
+        frame_ids.append(pool.add(bytes(blob)))
+    return None, NATIVE_BPP, frame_ids
+
+def duration_to_ms(duration):
+    """Converts a WLED playlist duration (tenths of a second) to whole milliseconds, at least 1."""
+    return min(max(int(round(float(duration) * 100)), 1), MAX_DURATION_MS)
+
+def merge_repeated_frames(frames, durations):
+    """Folds identical consecutive frames into one frame shown for their summed duration."""
+    merged_frames, merged_durations = [], []
+    for pixels, duration in zip(frames, durations):
+        if merged_frames and pixels == merged_frames[-1] and merged_durations[-1] + duration <= MAX_DURATION_MS:
+            merged_durations[-1] += duration
+        else:
+            merged_frames.append(pixels)
+            merged_durations.append(duration)
+    return merged_frames, merged_durations
+
+def encode_frames(frames, pool):
+    """Encodes a frame sequence into the pool, choosing for every frame whichever of keyframe or
+    delta adds the fewest new bytes. A frame already in the pool is free, which is how loops that
+    revisit a frame and blank frames shared between animations are deduplicated.
+    Returns (palette, bpp, frame_ids); palette is None for raw RGB565 animations."""
+    palette = build_palette(frames)
+    bpp = pick_bpp(len(palette))
+    if bpp == RAW_BPP:
+        palette = None
+        frames_symbols = frames
+    else:
+        lookup = {color: index for index, color in enumerate(palette)}
+        frames_symbols = [[lookup[color] for color in pixels] for pixels in frames]
+
+    frame_ids = []
+    previous = None
+    for index, symbols in enumerate(frames_symbols):
+        key_blob = encode_frame(symbols, None, bpp)
+        blob = key_blob
+        if previous is not None and index % KEYFRAME_INTERVAL != 0:
+            delta_blob = encode_frame(symbols, previous, bpp)
+            if pool.cost(delta_blob) < pool.cost(key_blob):
+                blob = delta_blob
+        decoded = decode_frame(blob, previous or [0] * len(symbols), bpp)
+        pixels = decoded if palette is None else [palette[symbol] for symbol in decoded]
+        if pixels != frames[index]:
+            raise ValueError(f"Frame {index} does not survive an encode/decode round trip")
+        frame_ids.append(pool.add(blob))
+        previous = symbols
+    return palette, bpp, frame_ids
+
+def load_animation(file_path, base_name, width, height, pool, native=False):
+    """Converts one animation, adding its frames to the pool. Returns its pack metadata.
+    native=True stores the frames in LED order for the firmware's copy-only draw path."""
     
     try:
         with open(file_path, 'r') as f:
@@ -29,6 +234,7 @@ def generate_animation_header(file_path, base_name, width, height):
     # Exclude preset "0" and the last one (the playlist)
     presets_to_use = preset_keys[1:-1]
     frames_data = []
+    durations_data = []
     
     # Extract durations from the playlist preset (the last preset)
     playlist_key = preset_keys[-1]
@@ -39,13 +245,14 @@ def generate_animation_header(file_path, base_name, width, height):
     except (KeyError, TypeError):
         print(f"Warning: No durations found in {base_name}. Using default 2 (0.2s).")
 
-    frame_durations = [int(round(d)) for d in frame_durations_float]
+    # Playlist durations are in tenths of a second; fractional values are kept down to the millisecond
+    frame_durations = [duration_to_ms(d) for d in frame_durations_float]
 
-    # 2. Extract pixel data and convert to RGB565
+    # 2. Extract pixel data and convert to RGB565 (native frames keep RGB888)
     def rgb888_to_rgb565(r, g, b):
         return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
-    for key in presets_to_use:
+    for index, key in enumerate(presets_to_use):
         try:
             frame_pixels = data[key]['seg']['i']
             if len(frame_pixels) != PIXEL_COUNT:
@@ -53,138 +260,142 @@ def generate_animation_header(file_path, base_name, width, height):
                 continue
 
             # Each pixel is [R, G, B]
-            flat_pixels = [f"0x{rgb888_to_rgb565(*sublist):04x}" for sublist in frame_pixels]
-            frames_data.append(flat_pixels)
+            if native:
+                frames_data.append([tuple(int(c) for c in sublist) for sublist in frame_pixels])
+            else:
+                frames_data.append([rgb888_to_rgb565(*sublist) for sublist in frame_pixels])
+            durations_data.append(frame_durations[index] if index < len(frame_durations) else DEFAULT_DURATION_MS)
         except (KeyError, TypeError) as e:
             print(f"Warning: Skipping preset {key} in {base_name}: {e}")
 
+    source_frames = len(frames_data)
+    frames_data, durations_data = merge_repeated_frames(frames_data, durations_data)
     num_frames = len(frames_data)
     
     # If no valid frames were found, skip generation
     if num_frames == 0:
-        print(f"Warning: No valid frames extracted for {base_name}. Skipping file generation.")
+        print(f"Warning: No valid frames extracted for {base_name}. Skipping animation.")
         return None
 
-    # 3. Generate the Header Content
-    HEADER_GUARD = f"ANIMATION_{base_name.upper()}_H"
-
-    # Array names are unique using the base name
-    frames_array_name = f"{base_name}Frames"
-    durations_array_name = f"{base_name}Durations"
-    struct_name = f"{base_name}Animation"
+    # 3. Encode frames as palette symbols, keyframes and RLE XOR deltas into the shared pool
+    pool_size_before = pool.size
+    try:
+        if native:
+            palette, bpp, frame_ids = encode_native_frames(frames_data, width, height, pool)
+        else:
+            palette, bpp, frame_ids = encode_frames(frames_data, pool)
+    except ValueError as e:
+        print(f"Error encoding {base_name}: {e}. Skipping animation.")
+        return None
+    encoded_size = pool.size - pool_size_before
 
+    # 4. Collect the metadata stored in the pack index
     # Generate display name: underscores to spaces, capitalize each word
     def make_display_name(basename):
         return ' '.join(word.capitalize() for word in basename.replace('_', ' ').split())
-    animation_display_name = make_display_name(base_name)
-
-    header_content = [
-        f"// {base_name}.h - Auto-generated from {os.path.basename(file_path)}",
-        f"#ifndef {HEADER_GUARD}",
-        f"#define {HEADER_GUARD}",
-        "",
-        '#include "animation_types.h"', # Include the struct definition
-        "",
-        f"// Frame Durations for {base_name} (in 100ms units)",
-        f"static const uint8_t PROGMEM {durations_array_name}[] = {{ {', '.join(map(str, frame_durations[:num_frames]))} }};",
-        "",
-        f"// RGB565 Frame Data for {base_name}",
-        f"static const uint16_t PROGMEM {frames_array_name}[] = {{",
-    ]
-
-    # Format pixel array content (16-bit values)
-    all_pixels = [str(val) for frame in frames_data for val in frame]
-    pixel_lines = []
-    for i in range(0, len(all_pixels), 8):
-        pixel_lines.append("  " + ", ".join(all_pixels[i:i+8]))
-
-    header_content.append(",\n".join(pixel_lines))
-    header_content.append("};")
-    header_content.append("")
-
-    # Generate the Animation struct instance
-    header_content.append(f"const Animation {struct_name} = {{")
-    header_content.append(f"  .name = \"{animation_display_name}\",")
-    header_content.append(f"  .frameCount = {num_frames},")
-    header_content.append(f"  .width = {width},")
-    header_content.append(f"  .height = {height},")
-    header_content.append(f"  .frameDurations = {durations_array_name},")
-    header_content.append(f"  .animationFrames = {frames_array_name}")
-    header_content.append("};")
-
-    header_content.append(f"#endif // {HEADER_GUARD}")
-    header_content.append("")
-
-    # 4. Write the file
-    output_path = os.path.join(INCLUDE_DIR, f"{base_name}.h")
-    with open(output_path, 'w') as f:
-        f.write("\n".join(header_content))
-
-    print(f"-> Generated {output_path} with {num_frames} frames.")
-    return struct_name
-
-def generate_master_header(animation_struct_names):
-    """Generates the main animations.h file."""
-    
-    master_content = [
-        "// animations.h - Master file with all animation includes and array",
-        "#ifndef MASTER_ANIMATIONS_H",
-        "#define MASTER_ANIMATIONS_H",
-        "",
-        '#include "animation_types.h"',
-        ""
-    ]
-    
-    # Includes for all individual animation headers
-    for name in animation_struct_names:
-        master_content.append(f'#include "{name.replace("Animation", "")}.h"')
-        
-    master_content.append("")
-    
-    # Global array of all animation structs
-    struct_list = ", ".join(animation_struct_names)
-    master_content.append(f"// Global array of all available animations")
-    master_content.append(f"const Animation allAnimations[] = {{ {struct_list} }};")
-    master_content.append(f"const uint8_t TOTAL_ANIMATIONS = sizeof(allAnimations) / sizeof(Animation);")
-    
-    master_content.append("")
-    master_content.append("#endif // MASTER_ANIMATIONS_H")
-    
-    # Write the file
-    with open(MASTER_HEADER, 'w') as f:
-        f.write("\n".join(master_content))
-        
-    print(f"\n✅ Generated master header: **{MASTER_HEADER}** with {len(animation_struct_names)} animations.")
-
 
+    print(f"-> Converted {base_name} with {num_frames} frames at {bpp} bpp ({encoded_size} new pool bytes, {source_frames * PIXEL_COUNT * 2} raw).")
+    return {
+        "name": make_display_name(base_name),
+        "width": width,
+        "height": height,
+        "bpp": bpp,
+        "durations": durations_data,
+        "frame_ids": frame_ids,
+        "palette": palette or [],
+    }
+
+# Pack layout (must match lib/AnimationPack). All values are little-endian, offsets are from the
+# start of the pack and every table is 4-byte aligned so it can be read from memory-mapped flash.
+#   header | index: one PackAnimation per animation | per-animation durations, frame ids, palette
+#   | pool offsets (uint32 per unique frame) | pool (encoded frames)
+# The partition holds two slots; a pack is written to the free one and becomes active once its header,
+# written last, is in place. The firmware loads the valid slot with the highest sequence number.
+PACK_MAGIC = b"NMPK"
+PACK_VERSION = 5
+PACK_SLOTS = 2
+PACK_HEADER = struct.Struct("<4sHHIIIIIII")    # magic, version, animationCount, poolFrameCount, indexOffset,
+                                               # poolOffsetsOffset, poolOffset, size, crc32 (of everything
+                                               # after the header), sequence (set by the firmware on upload)
+PACK_ANIMATION = struct.Struct("<28sHBBBBHIIII") # name, frameCount, width, height, bpp, transition, paletteSize,
+                                                # flags, durationsOffset, framesOffset, paletteOffset
+ANIMATION_FLAG_NO_INTERPOLATION = 0x01 # Never blend between frames (pixel art)
+PACK_NAME_SIZE = 28
+
+def build_pack(animations, pool):
+    """Serializes converted animations and the shared frame pool into a pack."""
+
+    def align(data):
+        data.extend(b"\0" * (-len(data) % 4))
+
+    index_offset = PACK_HEADER.size
+    data = bytearray(index_offset + PACK_ANIMATION.size * len(animations))
+
+    records = []
+    for anim in animations:
+        durations_offset = len(data)
+        data.extend(struct.pack(f"<{len(anim['durations'])}H", *anim["durations"]))
+        align(data)
+        frames_offset = len(data)
+        data.extend(struct.pack(f"<{len(anim['frame_ids'])}H", *anim["frame_ids"]))
+        align(data)
+        # Deltas XOR symbols, so any value of bpp bits can come up and the palette is padded to 1 << bpp entries
+        palette = anim["palette"] + [0] * ((1 << anim["bpp"]) - len(anim["palette"])) if anim["palette"] else []
+        palette_offset = len(data) if palette else 0
+        data.extend(struct.pack(f"<{len(palette)}H", *palette))
+        align(data)
+
+        name = anim["name"].encode("utf-8")[:PACK_NAME_SIZE - 1]
+        records.append(PACK_ANIMATION.pack(name, len(anim["frame_ids"]), anim["width"], anim["height"], anim["bpp"], anim["transition"],
+                                           len(palette), anim["flags"], durations_offset, frames_offset, palette_offset))
+    data[index_offset:index_offset + len(b"".join(records))] = b"".join(records)
+
+    pool_offsets_offset = len(data)
+    position = 0
+    for blob in pool.blobs:
+        data.extend(struct.pack("<I", position))
+        position += len(blob)
+    pool_offset = len(data)
+    for blob in pool.blobs:
+        data.extend(blob)
+    align(data)
+
+    crc = zlib.crc32(data[PACK_HEADER.size:]) & 0xFFFFFFFF
+    data[:PACK_HEADER.size] = PACK_HEADER.pack(PACK_MAGIC, PACK_VERSION, len(animations), len(pool.blobs), index_offset,
+                                               pool_offsets_offset, pool_offset, len(data), crc, 0)
+    return bytes(data)
+
+def parse_transitions(value):
+    """Parses "name:type[:ms] ..." into {name: transition byte}. The type may be "default" to only set a length."""
+    transitions = {}
+    for entry in value.split():
+        parts = entry.split(":")
+        name, kind = parts[0], parts[1] if len(parts) > 1 else "default"
+        if kind != "default" and kind not in TRANSITION_TYPES:
+            print(f"Warning: Unknown transition '{kind}' for {name}, using the default.")
+            kind = "default"
+        length_ms = int(parts[2]) if len(parts) > 2 else 0
+        if length_ms > MAX_TRANSITION_MS:
+            print(f"Warning: Transition for {name} is limited to {MAX_TRANSITION_MS} ms.")
+        units = min((length_ms + 50) // 100, 31)
+        transitions[name] = (units << 3) | (TRANSITION_TYPES[kind] + 1 if kind in TRANSITION_TYPES else 0)
+    return transitions
+
+def find_partition(name):
+    """Returns (offset, size) of a partition in the partition table CSV, or None."""
+    with open(PARTITIONS_FILE) as f:
+        for line in f:
+            fields = [field.strip() for field in line.split("#")[0].split(",")]
+            if len(fields) >= 5 and fields[0] == name:
+                return int(fields[3], 0), int(fields[4], 0)
+    return None
 
 # Setup directories
 if not os.path.exists(ANIMATIONS_DIR):
     print(f"Error: Directory '{ANIMATIONS_DIR}' not found. Please create it and put your JSON files inside.")
     sys.exit(1)
 
-shutil.rmtree(INCLUDE_DIR, ignore_errors=True)    
-if not os.path.exists(INCLUDE_DIR):
-    os.makedirs(INCLUDE_DIR)
-    
-# Create the animation_types.h file
-with open(os.path.join(INCLUDE_DIR, "animation_types.h"), 'w') as f:
-    f.write("""#ifndef ANIMATION_TYPES_H
-#define ANIMATION_TYPES_H
-#include <stdint.h>
-#include <Arduino.h>
-
-typedef struct {
-    const char *name;
-    const uint16_t frameCount;
-    const uint8_t width; 
-    const uint8_t height; 
-    const uint8_t *frameDurations; 
-    const uint16_t *animationFrames; 
-} Animation;
-
-#endif
-""")
+os.makedirs(os.path.dirname(PACK_FILE), exist_ok=True)
 
 
 # Access PlatformIO environment variables
@@ -199,9 +410,19 @@ try:
     
     # 3. Clean and split into a list
     animation_filter = filter_val.split() if filter_val else []
+    native_val = config.get(f"env:{env['PIOENV']}", "custom_native_animations", default="")
+    native_animations = native_val.split() if native_val else []
+    transitions_val = config.get(f"env:{env['PIOENV']}", "custom_animation_transitions", default="")
+    animation_transitions = parse_transitions(transitions_val)
+    no_interpolation_val = config.get(f"env:{env['PIOENV']}", "custom_no_interpolation", default="")
+    no_interpolation = no_interpolation_val.split() if no_interpolation_val else []
 except Exception:
     # Fallback if running outside of PlatformIO context
+    env = None
     animation_filter = []
+    native_animations = []
+    animation_transitions = {}
+    no_interpolation = []
 
 if animation_filter:
     print(f"-> Filter active: processing only {animation_filter}")
@@ -212,9 +433,10 @@ print("Starting WLED animation conversion...")
 if animation_filter:
     print(f"Filtering for: {animation_filter}")
 
-animation_struct_names = []
+animations = []
+pool = FramePool()
 
-for filename in os.listdir(ANIMATIONS_DIR):
+for filename in sorted(os.listdir(ANIMATIONS_DIR)):
     if filename.endswith(".json"):
         file_path = os.path.join(ANIMATIONS_DIR, filename)
         base_name = os.path.splitext(filename)[0] # e.g., "gnome"
@@ -224,12 +446,38 @@ for filename in os.listdir(ANIMATIONS_DIR):
             continue
 
         # Assuming a fixed 16x16 matrix 
-        struct_name = generate_animation_header(file_path, base_name, 16, 16)
+        animation = load_animation(file_path, base_name, 16, 16, pool, base_name in native_animations)
         
-        if struct_name:
-            animation_struct_names.append(struct_name)
-
-if animation_struct_names:
-    generate_master_header(animation_struct_names)
+        if animation:
+            animation["transition"] = animation_transitions.get(base_name, 0)
+            animation["flags"] = ANIMATION_FLAG_NO_INTERPOLATION if base_name in no_interpolation else 0
+            animations.append(animation)
+
+if animations:
+    pack = build_pack(animations, pool)
+    with open(PACK_FILE, 'wb') as f:
+        f.write(pack)
+    print(f"\n✅ Generated animation pack: **{PACK_FILE}** with {len(animations)} animations and {len(pool.blobs)} unique frames ({len(pack)} bytes).")
+
+    partition = find_partition(PACK_PARTITION)
+    if partition is None:
+        print(f"Warning: No '{PACK_PARTITION}' partition in {PARTITIONS_FILE}, the pack cannot be flashed.")
+    elif len(pack) > partition[1] // PACK_SLOTS:
+        print(f"Warning: The pack is {len(pack)} bytes but a '{PACK_PARTITION}' partition slot only holds {partition[1] // PACK_SLOTS} bytes.")
+    elif env is not None:
+        # `pio run -t uploadpack` writes the pack into the first slot of its partition without touching the
+        # firmware. The whole partition is erased first, so a pack uploaded over HTTP cannot shadow it.
+        esptool = '"$PYTHONEXE" "$UPLOADER" --chip esp32 --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED'
+        env.AddCustomTarget(
+            name="uploadpack",
+            dependencies=None,
+            actions=[
+                env.VerboseAction(env.AutodetectUploadPort, "Looking for upload port..."),
+                f'{esptool} erase_region 0x{partition[0]:x} 0x{partition[1]:x}',
+                f'{esptool} write_flash 0x{partition[0]:x} {PACK_FILE}',
+            ],
+            title="Upload animation pack",
+            description=f"Writes {PACK_FILE} into the '{PACK_PARTITION}' partition",
+        )
 else:
-    print("No valid JSON animations were processed.")
\ No newline at end of file
+    print("No valid JSON animations were processed.")
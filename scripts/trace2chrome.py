@@ -0,0 +1,115 @@
+# Converts a trace dump of the matrix into Chrome trace JSON, viewable in chrome://tracing or ui.perfetto.dev.
+#
+#   python3 scripts/trace2chrome.py http://<ip>/trace -o trace.json
+#   python3 scripts/trace2chrome.py serial.log -o trace.json
+#
+# The input is either the binary dump served at /trace or a serial log containing the hex dump printed
+# after sending 't' to the console. The dump describes its own events (see lib/Metrics/src/Trace.cpp),
+# so this script does not have to change when events are added.
+
+import argparse
+import json
+import struct
+import sys
+import urllib.request
+
+MAGIC = b"NMTR"
+VERSION = 1
+HEX_BEGIN = "--- trace begin ---"
+HEX_END = "--- trace end ---"
+
+def load(source):
+    if source.startswith("http://") or source.startswith("https://"):
+        with urllib.request.urlopen(source, timeout=10) as response:
+            data = response.read()
+    else:
+        with open(source, "rb") as f:
+            data = f.read()
+    if data.startswith(MAGIC):
+        return data
+
+    # Serial log: use the last complete hex dump in it
+    text = data.decode("ascii", errors="replace")
+    end = text.rfind(HEX_END)
+    begin = text.rfind(HEX_BEGIN, 0, end)
+    if begin < 0 or end < 0:
+        sys.exit(f"{source}: no trace dump found")
+    lines = text[begin + len(HEX_BEGIN):end].split()
+    return bytes.fromhex("".join(lines))
+
+def read_string(data, offset):
+    end = data.index(b"\0", offset)
+    return data[offset:end].decode("ascii"), end + 1
+
+def parse(data):
+    magic, version, record_size, event_count, stage_count, written, now = struct.unpack_from("<4sBBBBII", data)
+    if magic != MAGIC or version != VERSION:
+        sys.exit(f"Unsupported trace dump (version {version})")
+    offset = 16
+
+    events = []
+    for _ in range(event_count):
+        phase = chr(data[offset])
+        name, offset = read_string(data, offset + 1)
+        arg, offset = read_string(data, offset)
+        value, offset = read_string(data, offset)
+        events.append((phase, name, arg, value))
+    stages = []
+    for _ in range(stage_count):
+        name, offset = read_string(data, offset)
+        stages.append(name)
+
+    records = []
+    while offset + record_size <= len(data):
+        records.append(struct.unpack_from("<IIBBHi", data, offset))
+        offset += record_size
+    return events, stages, records, written
+
+def convert(events, stages, records):
+    trace = [{"name": "thread_name", "ph": "M", "pid": 0, "tid": core, "args": {"name": f"core {core}"}} for core in (0, 1)]
+    if not records:
+        return trace
+
+    # micros() wraps every 71 minutes, records are in the order they were taken so the time is unwrapped
+    # by the signed difference to the previous one
+    start = records[0][1]
+    previous_raw = start
+    elapsed = 0
+    for sequence, time, event, core, arg, value in records:
+        elapsed += struct.unpack("<i", struct.pack("<I", (time - previous_raw) & 0xFFFFFFFF))[0]
+        previous_raw = time
+        if event >= len(events):
+            continue
+        phase, name, arg_label, value_label = events[event]
+        entry = {"name": name, "ph": phase, "ts": elapsed, "pid": 0, "tid": core}
+        if phase == "X":
+            # Spans are recorded when they end, with the duration as value
+            entry["name"] = stages[arg] if arg_label == "stage" and arg < len(stages) else name
+            entry["ts"] = elapsed - value
+            entry["dur"] = value
+        else:
+            args = {}
+            if arg_label:
+                args[arg_label] = arg
+            if value_label:
+                args[value_label] = value
+            entry["args"] = args
+            if phase == "i":
+                entry["s"] = "t"
+        trace.append(entry)
+    return trace
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a matrix trace dump to Chrome trace JSON")
+    parser.add_argument("source", help="dump file, serial log or http://<ip>/trace")
+    parser.add_argument("-o", "--output", default="trace.json")
+    args = parser.parse_args()
+
+    events, stages, records, written = parse(load(args.source))
+    with open(args.output, "w") as f:
+        json.dump({"traceEvents": convert(events, stages, records), "displayTimeUnit": "ms"}, f)
+    lost = written - len(records)
+    print(f"{len(records)} records written to {args.output}" + (f", {lost} older ones were overwritten" if lost else ""))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,51 @@
+#ifndef RENDERCOMMANDS_H
+#define RENDERCOMMANDS_H
+
+#include <Arduino.h>
+#include "FrameScheduler.h"
+#include "Transition.h"
+
+// Commands sent by other tasks (e.g. the web server) to the render task, which owns the display state
+enum RenderCommandType : uint8_t {
+  CMD_SET_ANIMATION,
+  CMD_SET_BRIGHTNESS,
+  CMD_SET_AUTO_ADVANCE,
+  CMD_SET_INTERVAL,
+  CMD_SET_DISPLAY_CLOCK,
+  CMD_SET_CLOCK_MODE,
+  CMD_SET_ANIMATION_ENABLED,
+  CMD_SET_PLAYBACK_RATE,     // value: 8.8 fixed point rate, negative plays backwards
+  CMD_SET_TRANSITION,        // value: TransitionType
+  CMD_SET_TRANSITION_LENGTH, // value: ms
+  CMD_SET_INTERPOLATION,
+  CMD_RELOAD_PACK,
+};
+
+struct RenderCommand {
+  RenderCommandType type;
+  int32_t value;
+};
+
+// Queues a command for the render task. Returns false if the queue is full.
+bool sendRenderCommand(RenderCommandType type, int32_t value = 0);
+
+// State of the render task as the other tasks see it, published by the render task after every loop
+struct RenderState {
+  uint16_t animation;
+  uint16_t animationCount;
+  int8_t brightness;
+  bool displayClock;
+  uint8_t clockMode;
+  bool autoAdvance;
+  int animationInterval;
+  int16_t playbackRate;
+  TransitionType transitionType;
+  uint16_t transitionLength;
+  bool interpolation;
+  FrameStats frames;
+};
+
+// Copies the last published state. Returns false if the render task kept it busy.
+bool readRenderState(RenderState &out);
+
+#endif // RENDERCOMMANDS_H
@@ -1,19 +1,47 @@
 #include "WebPage.h"
 #include "Web.h"
 
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
 extern AsyncWebServer  server;
 
-// Externs for controlling state in main.cpp
-extern uint8_t currentAnimationIndex;
-extern int8_t brightness;
-extern bool autoAdvanceEnabled;
-extern bool animationEnabled;
-extern int animation_change_interval;
-extern bool displayClock;
-extern uint8_t clockMode;
-extern const uint8_t TOTAL_ANIMATIONS;
-extern AnimationInfo animationInfoArray[];
-extern unsigned long lastAnimationChangeTime;
+// The render task owns the display state, it is read through readRenderState() and changed with commands
+extern AnimationPack animationPack;
+extern LedOutput ledOutput;
+extern TaskHandle_t renderTaskHandle;
+extern TaskHandle_t networkTaskHandle;
+
+// Free stack of a task at its deepest use so far, skipped while the task does not exist
+static void writeStackMetric(AsyncResponseStream *response, const char *task, TaskHandle_t handle) {
+    if (handle != nullptr) {
+        response->printf("neomatrix_task_stack_free_min_bytes{task=\"%s\"} %u\n", task, (unsigned)uxTaskGetStackHighWaterMark(handle));
+    }
+}
+
+// Appends text as a JSON string. Names come from uploaded packs, so quotes, backslashes and control
+// characters are escaped.
+static void appendJsonString(String &json, const char *text) {
+    json += '"';
+    for (; *text != '\0'; text++) {
+        char c = *text;
+        if (c == '"' || c == '\\') {
+            json += '\\';
+            json += c;
+        } else if ((uint8_t)c < 0x20) {
+            char escaped[7];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            json += escaped;
+        } else {
+            json += c;
+        }
+    }
+    json += '"';
+}
+
+// Upload in progress, only the request that started it may write to it
+static PackWriter *packWriter = nullptr;
+static AsyncWebServerRequest *packUploadRequest = nullptr;
 
 void setupWebServer() {
 
@@ -23,24 +51,62 @@ void setupWebServer() {
 
     // Endpoint to list all animations (with names)
     server.on("/animations", HTTP_GET, [](AsyncWebServerRequest *request){
+        // The render task may swap in a new pack meanwhile, the lock keeps the names mapped
         String json = "[";
-        for (size_t i = 0; i < TOTAL_ANIMATIONS; i++) {
+        animationPack.lock();
+        for (uint16_t i = 0; i < animationPack.count(); i++) {
             if (i > 0) json += ",";
-            json += "{\"id\":" + String(animationInfoArray[i].id) + ",\"name\":\"" + String(animationInfoArray[i].name) + "\"}";
+            json += "{\"id\":" + String(i) + ",\"name\":";
+            appendJsonString(json, animationPack.animation(i)->name);
+            json += "}";
         }
+        animationPack.unlock();
         json += "]";
         request->send(200, "application/json", json);
     });
 
+    // Endpoint to upload a new animation pack, streamed into the free slot of the pack partition.
+    // Called with each received chunk; the main loop switches to the new pack once it is committed.
+    // A pack always replaces the whole catalog, it holds every animation the matrix plays.
+    server.on("/upload", HTTP_POST, [](AsyncWebServerRequest *request){
+        if (packWriter == nullptr || request != packUploadRequest) {
+            request->send(400, "text/plain", "No animation pack received.");
+            return;
+        }
+        bool ok = packWriter->finish();
+        String msg = ok ? "Animation pack uploaded (" + String(packWriter->written()) + " bytes)." : String(packWriter->error());
+        int status = ok ? 200 : (packWriter->busy() ? 409 : 400);
+        delete packWriter;
+        packWriter = nullptr;
+        packUploadRequest = nullptr;
+        if (ok) {
+            sendRenderCommand(CMD_RELOAD_PACK);
+        }
+        request->send(status, "text/plain", msg);
+    }, [](AsyncWebServerRequest *request, const String &filename, size_t index, uint8_t *data, size_t len, bool final){
+        if (index == 0) {
+            // A new upload replaces one that was abandoned
+            delete packWriter;
+            packWriter = new PackWriter();
+            packUploadRequest = request;
+            packWriter->begin(animationPack);
+        }
+        if (packWriter != nullptr && request == packUploadRequest) {
+            packWriter->write(data, len);
+        }
+    });
+
     // Endpoint to set parameters
     server.on("/set", HTTP_GET, [](AsyncWebServerRequest *request){
         String msg = "";
+        // The render task checks the index again, the pack may change before it gets the command
+        RenderState state;
+        bool stateRead = readRenderState(state);
         if (request->hasParam("animation")) {
             String anim = request->getParam("animation")->value();
             int idx = anim.toInt();
-            if (idx >= 0 && idx < TOTAL_ANIMATIONS) {
-                currentAnimationIndex = idx;
-                lastAnimationChangeTime = millis(); // Reset timer on manual change
+            if (idx >= 0 && (!stateRead || idx < state.animationCount)) {
+                sendRenderCommand(CMD_SET_ANIMATION, idx);
                 msg += "Animation set. ";
             } else {
                 msg += "Invalid animation index. ";
@@ -49,7 +115,7 @@ void setupWebServer() {
         if (request->hasParam("brightness")) {
             int b = request->getParam("brightness")->value().toInt();
             if (b >= 0 && b <= 255) {
-                brightness = b;
+                sendRenderCommand(CMD_SET_BRIGHTNESS, b);
                 msg += "Brightness set. ";
             } else {
                 msg += "Invalid brightness. ";
@@ -57,38 +123,71 @@ void setupWebServer() {
         }
         if (request->hasParam("autoSwitch")) {
             String val = request->getParam("autoSwitch")->value();
-            autoAdvanceEnabled = (val == "1" || val == "true");
+            sendRenderCommand(CMD_SET_AUTO_ADVANCE, val == "1" || val == "true");
             msg += "Auto-switch set. ";
         }
         if (request->hasParam("duration")) {
             int dur = request->getParam("duration")->value().toInt();
             if (dur >= 1 && dur <= 60) {
-                animation_change_interval = dur;
+                sendRenderCommand(CMD_SET_INTERVAL, dur);
                 msg += "Duration set. ";
             } else {
                 msg += "Invalid duration. ";
             }
         }
+        if (request->hasParam("rate")) {
+            // Playback speed in percent of the authored speed, negative values play backwards
+            long rate = request->getParam("rate")->value().toInt();
+            if (abs(rate) * PLAYBACK_RATE_ONE >= PLAYBACK_RATE_MIN * 100 && abs(rate) * PLAYBACK_RATE_ONE <= PLAYBACK_RATE_MAX * 100) {
+                sendRenderCommand(CMD_SET_PLAYBACK_RATE, rate * PLAYBACK_RATE_ONE / 100);
+                msg += "Playback rate set. ";
+            } else {
+                msg += "Invalid playback rate. ";
+            }
+        }
+        if (request->hasParam("transition")) {
+            TransitionType type = Transition::parse(request->getParam("transition")->value());
+            if (type < TRANSITION_TYPE_COUNT) {
+                sendRenderCommand(CMD_SET_TRANSITION, type);
+                msg += "Transition set. ";
+            } else {
+                msg += "Invalid transition. ";
+            }
+        }
+        if (request->hasParam("transitionMs")) {
+            int length = request->getParam("transitionMs")->value().toInt();
+            if (length >= 0 && length <= TRANSITION_MAX_MS) {
+                sendRenderCommand(CMD_SET_TRANSITION_LENGTH, length);
+                msg += "Transition length set. ";
+            } else {
+                msg += "Invalid transition length. ";
+            }
+        }
+        if (request->hasParam("interpolate")) {
+            String val = request->getParam("interpolate")->value();
+            sendRenderCommand(CMD_SET_INTERPOLATION, val == "1" || val == "true");
+            msg += "Interpolation set. ";
+        }
         if (request->hasParam("mode")) {
             String mode = request->getParam("mode")->value();
             if (mode == "clock") {
-                displayClock = true;
+                sendRenderCommand(CMD_SET_DISPLAY_CLOCK, true);
                 msg += "Clock mode enabled. ";
             } else if (mode == "animation") {
-                displayClock = false;
+                sendRenderCommand(CMD_SET_DISPLAY_CLOCK, false);
                 msg += "Animation mode enabled. ";
             }
         }
         if (request->hasParam("clockMode")) {
             int cm = request->getParam("clockMode")->value().toInt();
-            if (cm >= 0 && cm <= 3) {
-                clockMode = cm;
+            if (cm >= 0 && cm < CLOCK_MODES) {
+                sendRenderCommand(CMD_SET_CLOCK_MODE, cm);
                 msg += "Clock mode set. ";
             }
         }
         if (request->hasParam("animationEnabled")) {
             String val = request->getParam("animationEnabled")->value();
-            animationEnabled = (val == "1" || val == "true");
+            sendRenderCommand(CMD_SET_ANIMATION_ENABLED, val == "1" || val == "true");
             msg += "Animation enabled set. ";
         }
         request->send(200, "text/plain", msg.length() ? msg : "No valid parameters set.");
@@ -96,17 +195,79 @@ void setupWebServer() {
 
     // Endpoint to get current state
     server.on("/state", HTTP_GET, [](AsyncWebServerRequest *request){
+        RenderState state;
+        if (!readRenderState(state)) {
+            request->send(503, "text/plain", "Busy, try again.");
+            return;
+        }
         String json = "{";
-        json += "\"animation\":" + String(currentAnimationIndex) + ",";
-        json += "\"brightness\":" + String(brightness) + ",";
-        json += "\"mode\":\"" + String(displayClock ? "clock" : "animation") + "\",";
-        json += "\"clockMode\":" + String(clockMode) + ",";
+        json += "\"animation\":" + String(state.animation) + ",";
+        json += "\"brightness\":" + String(state.brightness) + ",";
+        json += "\"mode\":\"" + String(state.displayClock ? "clock" : "animation") + "\",";
+        json += "\"clockMode\":" + String(state.clockMode) + ",";
         json += "\"maxBrightness\":" + String(MAX_BRIGHTNESS) + ",";
-        json += "\"autoSwitch\":" + String(autoAdvanceEnabled ? 1 : 0) + ",";
-        json += "\"duration\":" + String(animation_change_interval);
+        json += "\"autoSwitch\":" + String(state.autoAdvance ? 1 : 0) + ",";
+        json += "\"duration\":" + String(state.animationInterval) + ",";
+        json += "\"rate\":" + String(state.playbackRate * 100 / PLAYBACK_RATE_ONE) + ",";
+        json += "\"transition\":\"" + String(Transition::name(state.transitionType)) + "\",";
+        json += "\"transitionMs\":" + String(state.transitionLength) + ",";
+        json += "\"interpolate\":" + String(state.interpolation ? 1 : 0) + ",";
+        json += "\"framesShown\":" + String(state.frames.frames) + ",";
+        json += "\"framesDropped\":" + String(state.frames.dropped) + ",";
+        json += "\"maxLateness\":" + String(state.frames.maxLateness);
         json += "}";
         request->send(200, "application/json", json);
     });
 
+    // Prometheus metrics: stage timings, frame counters, heap and task stacks
+    server.on("/metrics", HTTP_GET, [](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("text/plain; version=0.0.4");
+        metrics.writePrometheus(*response);
+
+        // Frame stats as last published by the render task, left out while it keeps them busy like the histograms
+        RenderState state;
+        if (readRenderState(state)) {
+            response->print("# TYPE neomatrix_frames_total counter\n");
+            response->printf("neomatrix_frames_total %u\n", (unsigned)state.frames.frames);
+            response->print("# TYPE neomatrix_frames_dropped_total counter\n");
+            response->printf("neomatrix_frames_dropped_total %u\n", (unsigned)state.frames.dropped);
+            response->print("# TYPE neomatrix_frames_late_total counter\n");
+            response->printf("neomatrix_frames_late_total %u\n", (unsigned)state.frames.lateFrames);
+        }
+        response->print("# TYPE neomatrix_led_frames_total counter\n");
+        response->printf("neomatrix_led_frames_total %u\n", (unsigned)ledOutput.frames());
+        response->print("# TYPE neomatrix_led_frames_skipped_total counter\n");
+        response->printf("neomatrix_led_frames_skipped_total %u\n", (unsigned)ledOutput.skipped());
+
+        response->print("# TYPE neomatrix_heap_free_bytes gauge\n");
+        response->printf("neomatrix_heap_free_bytes %u\n", (unsigned)ESP.getFreeHeap());
+        response->print("# TYPE neomatrix_heap_free_min_bytes gauge\n");
+        response->printf("neomatrix_heap_free_min_bytes %u\n", (unsigned)ESP.getMinFreeHeap());
+        response->print("# TYPE neomatrix_heap_largest_free_block_bytes gauge\n");
+        response->printf("neomatrix_heap_largest_free_block_bytes %u\n", (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+
+        response->print("# HELP neomatrix_task_stack_free_min_bytes Smallest free stack seen for each task\n"
+                        "# TYPE neomatrix_task_stack_free_min_bytes gauge\n");
+        writeStackMetric(response, "render", renderTaskHandle);
+        writeStackMetric(response, "network", networkTaskHandle);
+        writeStackMetric(response, "ledout", ledOutput.task());
+        writeStackMetric(response, "async_tcp", xTaskGetHandle("async_tcp"));
+
+        response->print("# TYPE neomatrix_trace_records_total counter\n");
+        response->printf("neomatrix_trace_records_total %u\n", (unsigned)trace.written());
+
+        response->print("# TYPE neomatrix_uptime_seconds counter\n");
+        response->printf("neomatrix_uptime_seconds %llu\n", esp_timer_get_time() / 1000000ULL);
+        request->send(response);
+    });
+
+    // Endpoint to download the event trace, convert it with scripts/trace2chrome.py
+    server.on("/trace", HTTP_GET, [](AsyncWebServerRequest *request){
+        AsyncResponseStream *response = request->beginResponseStream("application/octet-stream");
+        response->addHeader("Content-Disposition", "attachment; filename=\"neomatrix.trace\"");
+        trace.writeBinary(*response);
+        request->send(response);
+    });
+
     server.begin();
 }
@@ -1,15 +1,16 @@
 #include <AsyncTCP.h>
 #include <WiFi.h>
 #include <ESPAsyncWebServer.h>
-#include <animations/animation_types.h>
-#include <animations/animations.h>
+#include <AnimationPack.h>
+#include <PackWriter.h>
+#include <FrameScheduler.h>
+#include <Transition.h>
+#include <LedOutput.h>
+#include <Metrics.h>
+#include <Trace.h>
 #include <settings.h>
+#include "RenderCommands.h"
 
 static AsyncWebServer server(80);
 
-struct AnimationInfo {
-	uint8_t id;
-	const char* name;
-};
-
 void setupWebServer();
\ No newline at end of file
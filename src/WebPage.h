@@ -30,6 +30,27 @@ static const char *index_html PROGMEM = R"(
                 <label class="form-label mb-0" for="duration">Animation Duration (s)</label>
                 <input type="number" class="form-control w-auto" id="duration" min="1" max="60" style="width: 80px;">
             </div>
+            <div class="mb-3 d-flex justify-content-between align-items-center">
+                <label class="form-label mb-0" for="rate">Playback Speed (%)</label>
+                <input type="number" class="form-control w-auto" id="rate" min="-800" max="800" step="25" style="width: 80px;">
+            </div>
+            <div class="mb-3 d-flex justify-content-between align-items-center">
+                <label class="form-label mb-0" for="transition">Transition</label>
+                <select class="form-select w-auto" id="transition">
+                    <option value="none">None</option>
+                    <option value="crossfade">Crossfade</option>
+                    <option value="wipe">Wipe</option>
+                    <option value="dissolve">Dissolve</option>
+                </select>
+            </div>
+            <div class="mb-3 d-flex justify-content-between align-items-center">
+                <label class="form-label mb-0" for="transitionMs">Transition Length (ms)</label>
+                <input type="number" class="form-control w-auto" id="transitionMs" min="0" max="5000" step="100" style="width: 80px;">
+            </div>
+            <div class="mb-3 d-flex justify-content-between align-items-center" style="gap:16px;">
+                <label class="form-label mb-0 flex-grow-1" for="interpolate">Smooth Frames</label>
+                <input type="checkbox" id="interpolate" style="margin-top:0; width:20px; height:20px; flex-shrink:0;">
+            </div>
             <div class="mb-3 d-flex justify-content-between align-items-center" style="gap:16px;">
                 <label class="form-label mb-0 flex-grow-1" for="autoSwitch">Auto Switch</label>
                 <input type="checkbox" id="autoSwitch" style="margin-top:0; width:20px; height:20px; flex-shrink:0;">
@@ -41,6 +62,14 @@ static const char *index_html PROGMEM = R"(
                 </div>
                 <span id="brightnessVal" style="min-width:40px;text-align:right;">0</span>
             </div>
+            <div class="mb-3">
+                <label class="form-label" for="pack">Animation Pack</label>
+                <div class="form-text mb-1">Replaces all animations with the ones in the pack, build it with every animation you want to keep.</div>
+                <div class="d-flex" style="gap:8px;">
+                    <input type="file" class="form-control" id="pack" accept=".bin">
+                    <button class="btn btn-primary" id="uploadPack">Upload</button>
+                </div>
+            </div>
             <div id="status" class="text-center mt-3"></div>
         </div>
         <!-- Animations List -->
@@ -58,7 +87,7 @@ static const char *index_html PROGMEM = R"(
 <script>
 let maxBrightness = 100;
 let currentState = {};
-const clockModes = ['Digital', 'Ring', 'Bars', 'Analog'];
+const clockModes = ['Digital', 'Ring', 'Bars', 'Analog', 'Smooth Analog'];
 
 function send(params) {
     $.get('/set', params, function(resp) {
@@ -70,6 +99,10 @@ function fetchState() {
     $.get('/state', function(state) {
         currentState = state;
         $('#duration').val(state.duration || 10);
+        $('#rate').val(state.rate || 100);
+        $('#transition').val(state.transition || 'crossfade');
+        $('#transitionMs').val(state.transitionMs !== undefined ? state.transitionMs : 600);
+        $('#interpolate').prop('checked', !!state.interpolate);
         $('#autoSwitch').prop('checked', state.autoSwitch !== undefined ? state.autoSwitch : true);
         $('#brightness').val(state.brightness);
         $('#brightnessVal').text(state.brightness);
@@ -139,10 +172,36 @@ $(function() {
     $('#duration').on('change', function() {
         send({ duration: $(this).val() });
     });
+    // Playback speed change, negative values play backwards
+    $('#rate').on('change', function() {
+        send({ rate: $(this).val() });
+    });
+    // Transition change
+    $('#transition').on('change', function() {
+        send({ transition: $(this).val() });
+    });
+    $('#transitionMs').on('change', function() {
+        send({ transitionMs: $(this).val() });
+    });
+    // Frame interpolation change
+    $('#interpolate').on('change', function() {
+        send({ interpolate: $(this).is(':checked') ? 1 : 0 });
+    });
     // Auto switch change
     $('#autoSwitch').on('change', function() {
         send({ autoSwitch: $(this).is(':checked') ? 1 : 0 });
     });
+    // Animation pack upload, the device switches to the new pack once it is written. The new pack replaces the old one as a whole.
+    $('#uploadPack').on('click', function() {
+        let file = $('#pack')[0].files[0];
+        if (!file) return;
+        let data = new FormData();
+        data.append('pack', file);
+        $('#status').text('Uploading...');
+        $.ajax({ url: '/upload', type: 'POST', data: data, processData: false, contentType: false })
+            .done(function(resp) { $('#status').text(resp); setTimeout(fetchAnimations, 1000); })
+            .fail(function(xhr) { $('#status').text(xhr.responseText || 'Upload failed'); });
+    });
     // Brightness change
     $('#brightness').on('input', function() {
         let val = Math.min(Math.max(0, $(this).val()), maxBrightness);
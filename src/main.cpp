@@ -1,37 +1,33 @@
 #include <stddef.h>
 
 #include "Encoder.h"
-#include "animations/animations.h"
+#include "Esp32EncoderHal.h"
+#include "MockEncoderHal.h"
+#include "FrameCodec.h"
+#include "AnimationPack.h"
+#include "LedOutput.h"
+#include "FrameScheduler.h"
+#include "Transition.h"
+#include "Compositor.h"
+#include "Metrics.h"
+#include "Trace.h"
 #include <Adafruit_GFX.h>
 #include <Arduino.h>
 #include <FastLED.h>
 #include <WiFiManager.h>
 #include "time.h"
+#include <esp_sntp.h>
 #include <FastLED_NeoMatrix.h>
 #include "settings.h"
 #include "Clocks.h"
 #include "Web.h"
-
-// Turn on debug statements to the serial output
-#define DEBUG 1
-
-#if DEBUG
-  #define PRINT(s, x)     \
-    {                     \
-      Serial.print(F(s)); \
-      Serial.print(x);    \
-    }
-  #define PRINTS(x) Serial.print(F(x))
-  #define PRINTX(x) Serial.println(x, HEX)
-#else
-  #define PRINT(s, x)
-  #define PRINTS(x)
-  #define PRINTX(x)
-#endif
+#include "RenderCommands.h"
 
 CRGB matrixleds[NUMMATRIX];
 
 FastLED_NeoMatrix *matrix = new FastLED_NeoMatrix(matrixleds, mw, mh, NEO_MATRIX_BOTTOM + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG);
+// The matrix draws into matrixleds (back buffer), ledOutput transmits a copy of it in the background
+LedOutput ledOutput(matrixleds, NUMMATRIX);
 
 // --- Encoders management ---
 // --- ENCODER 1 (Left Encoder) ---
@@ -44,160 +40,434 @@ FastLED_NeoMatrix *matrix = new FastLED_NeoMatrix(matrixleds, mw, mh, NEO_MATRIX
 #define ENC2_B 25      // GPIO 25 (B channel)
 #define ENC2_BUTTON 32 // GPIO 32
 
-volatile int enc1_counter = 0; // This counter will be modified in the ISR and controls animation switching
-volatile int enc2_counter = 0; // This counter will be modified in the ISR and controls animation change interval
-
 volatile bool autoAdvanceEnabled = true;
 volatile bool animationEnabled = true;
 
-// Forward declarations of ISR callback functions
+// Button handlers, called from the render task when the encoders report a press
 void onEncoder1_shortPress();
 void onEncoder2_shortPress();
 void onEncoder1_longPress();
 void onEncoder2_longPress();
 
-Encoder encoder1(ENC1_A, ENC1_B, ENC1_BUTTON, &enc1_counter, onEncoder1_shortPress, onEncoder1_longPress, 1500);
-Encoder encoder2(ENC2_A, ENC2_B, ENC2_BUTTON, &enc2_counter, onEncoder2_shortPress, onEncoder2_longPress, 1500);
-
-bool ignoreEncoder1Button = false;
-bool ignoreEncoder2Button = false;
+#if !defined(ESP32)
+// The host build (pio run -e native) has no encoders, the simulator and the tests turn these by hand
+MockEncoderHal encoder1Hal;
+MockEncoderHal encoder2Hal;
+#elif ENCODER_PCNT
+PcntEncoderHal encoder1Hal(ENC1_A, ENC1_B, ENC1_BUTTON, ENCODER_PCNT_FILTER);
+PcntEncoderHal encoder2Hal(ENC2_A, ENC2_B, ENC2_BUTTON, ENCODER_PCNT_FILTER);
+#else
+GpioEncoderHal encoder1Hal(ENC1_A, ENC1_B, ENC1_BUTTON);
+GpioEncoderHal encoder2Hal(ENC2_A, ENC2_B, ENC2_BUTTON);
+#endif
+Encoder encoder1(encoder1Hal, 1500, {ENCODER_ACCEL_SLOW_MS, ENCODER_ACCEL_FAST_MS, ENCODER1_ACCEL_MAX});
+Encoder encoder2(encoder2Hal, 1500, {ENCODER_ACCEL_SLOW_MS, ENCODER_ACCEL_FAST_MS, ENCODER2_ACCEL_MAX});
 
 // --- Global Animation Management ---
-// Buffer for the converted RGB565 data (e.g. 16x16 pixels * 2 bytes/pixel)
+// Buffer for the decoded RGB565 data (e.g. 16x16 pixels * 2 bytes/pixel)
 static uint16_t RGB_bmp_fixed[mw * mh];
+// Palette indices (or RGB565 values) of the current frame, kept between frames for delta decoding
+static uint16_t frameSymbols[mw * mh];
+// A second plane lets the outgoing animation keep playing during a transition
+static uint16_t outgoingSymbols[mw * mh];
+static FrameDecoder frameDecoderA(frameSymbols, mw * mh);
+static FrameDecoder frameDecoderB(outgoingSymbols, mw * mh);
+static FrameDecoder *frameDecoder = &frameDecoderA;
+static FrameDecoder *outgoingDecoder = &frameDecoderB;
 int animation_change_interval = INITIAL_ANIMATION_INTERVAL; // Time in seconds to change to the next animation. Signed so minMax works correctly on decrements
 
-
-AnimationInfo animationInfoArray[TOTAL_ANIMATIONS];
-
+// Animations are read from the memory-mapped "anims" partition, see scripts/convert.py
+AnimationPack animationPack(NUMMATRIX);
 
 // Variables to track the current state of the animation
-uint8_t currentAnimationIndex = 0;
+uint16_t currentAnimationIndex = 0;
 uint16_t currentFrame = 0;
-unsigned long lastFrameChangeTime = 0;
+// Frame deadlines are absolute from the start of the animation, late wake-ups do not shift later frames
+FrameScheduler frameScheduler(FRAME_DROP_POLICY);
+int16_t playbackRate = ANIMATION_SPEED * PLAYBACK_RATE_ONE / 100; // 8.8 fixed point, negative plays backwards
+
+// Transitions between animations: the outgoing one is rendered into outgoingLeds and blended over the new one
+static CRGB outgoingLeds[NUMMATRIX];
+static uint8_t ledColumns[NUMMATRIX]; // Matrix column of every LED, for wipes
+static uint16_t ledIndex[NUMMATRIX];  // LED position of every matrix pixel (y * mw + x)
+Transition transition(outgoingLeds, NUMMATRIX);
+TransitionType transitionType = TRANSITION_DEFAULT_TYPE; // Used unless the animation sets its own
+uint16_t transitionLength = TRANSITION_DEFAULT_MS;
+uint16_t outgoingAnimationIndex = 0;
+uint16_t outgoingFrame = 0;
+FrameScheduler outgoingScheduler(FRAME_DROP_POLICY);
+unsigned long lastTransitionFrameTime = 0;
+
+// Temporal interpolation: frames in between are blended from the frame on screen and the next one
+bool interpolationEnabled = INTERPOLATION_DEFAULT;
+unsigned long lastInterpolationFrameTime = 0;
 unsigned long lastAnimationChangeTime = millis();
 int8_t brightness = MAX_BRIGHTNESS; // This is signed so minMax works correctly on decrements
 bool displayClock = false;
-uint8_t clockMode = 0; // 0 - Digital, 1 - Ring, 2 - Bars, 3 - Analog
+uint8_t clockMode = 0; // 0 - Digital, 1 - Ring, 2 - Bars, 3 - Analog, 4 - Smooth analog
 
-// Message display management
-uint16_t messageColor = matrix->Color(0, 255, 0);
+// Message display management. Messages are rasterized once into an overlay layer that fades out on its own.
+uint16_t messageColor = matrix->Color(255, 255, 255);
 unsigned long messageClearTime = 0;
 String message = "";
+volatile bool messageChanged = false;
+
+// Frames are composed from a base layer (animation or clock) and overlays blended on top
+static CRGB baseLeds[NUMMATRIX];
+static CRGB messagePixels[NUMMATRIX];
+static uint8_t messageAlpha[NUMMATRIX];
+OverlayLayer messageLayer(mw, mh, ledIndex, messagePixels, messageAlpha);
+Compositor compositor(baseLeds, NUMMATRIX);
+unsigned long lastOverlayFrameTime = 0;
 
 // --- Wifi ---
 WiFiManager wm;
+// Set by the SNTP callback once the wall clock holds the real time, clocks show a placeholder until then.
+// Written by onTimeSync() in the lwIP task and read by the render task on the other core. It only ever
+// goes from false to true and nothing else is published with it, so volatile is enough, no lock.
+volatile bool timeSynced = false;
+ClockTime clockTime;
+
+// --- Tasks ---
+QueueHandle_t renderQueue;
+// Written only by the render task through a sequence counter that is odd while it is updated, like Metrics,
+// so the web server reads a consistent copy without locking the render task
+static RenderState renderState;
+static std::atomic<uint32_t> renderStateSequence{0};
+TaskHandle_t renderTaskHandle = nullptr;
+TaskHandle_t networkTaskHandle = nullptr;
 
 // Function Prototypes
+void renderTask(void *parameter);
+void networkTask(void *parameter);
+void renderLoop();
+void handleRenderCommand(const RenderCommand &command);
+void publishRenderState();
+void startAnimation(uint16_t index, bool withTransition = true);
+uint32_t frameDuration(uint16_t frame);
+uint32_t outgoingFrameDuration(uint16_t frame);
+void drawFrame(FrameDecoder &decoder, const Animation *anim, uint16_t frame);
+int8_t playbackStep();
+bool interpolateFrames(const Animation *anim);
 void playCurrentFrame(const Animation *anim);
-void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h);
 void showMessage(const String &msg, unsigned long duration_ms);
+void updateMessageLayer();
+void presentFrame();
+void refreshOverlays();
 int minMax(int val, int minVal, int maxVal);
+int16_t stepPlaybackRate(int16_t rate, int steps);
+String formatPlaybackRate(int16_t rate);
 void turnOnDisplay();
-void checkTimeSync();
+void startTimeSync();
+void connectWiFi();
+bool drawClockMode(uint8_t mode, const LocalTime &time);
 void drawClock();
 
 void setup() {
     
   Serial.begin(115200);
-  delay(1000);
+  metrics.begin();
 
-  // Wifi setup
-  WiFi.mode(WIFI_STA); // explicitly set mode, esp defaults to STA+AP   
-  // Uncomment to reset settings
-  // wm.resetSettings();
-  wm.setConfigPortalBlocking(false);
-
-  Serial.println("Setting portal config timout to 60 seconds and connect timeout to 30 seconds");
-  wm.setConfigPortalTimeout(60);
-  wm.setConnectTimeout(30);
-
-  Serial.println("Connecting to WiFi...");
-  if(wm.autoConnect("NEOMATRIX_AP")){
-      Serial.println("wiFi connected");
-  }
-  else {
-      Serial.println("Config portal running");
-  }
-  Serial.println("Continuing setup...");
-  FastLED.addLeds<NEOPIXEL, DATAPIN>(matrixleds, NUMMATRIX);
+  // The display comes up first, so the panel lights within a frame of power on however long WiFi takes
+  CLEDController &ledController = FastLED.addLeds<NEOPIXEL, DATAPIN>(matrixleds, NUMMATRIX);
   matrix->begin();
   matrix->setBrightness(MAX_BRIGHTNESS);
   matrix->setTextWrap(false);
-  matrix->setTextColor(messageColor);
+  if (!ledOutput.begin(ledController, LED_OUTPUT_TASK_CORE, LED_OUTPUT_TASK_PRIORITY)) {
+    Serial.println("LED output task could not be started, falling back to blocking show()");
+  }
+  for (uint8_t y = 0; y < mh; y++) {
+    for (uint8_t x = 0; x < mw; x++) {
+      ledIndex[y * mw + x] = matrix->XY(x, y);
+      ledColumns[matrix->XY(x, y)] = x;
+    }
+  }
+  transition.setColumns(ledColumns, mw);
+  messageLayer.setTextColor(messageColor);
+  compositor.addLayer(&messageLayer);
   encoder1.begin();
   encoder2.begin();
   
-  // Collect names and IDs of all animations, populate the animationInfoArray, used in web server
-  for (uint8_t i = 0; i < TOTAL_ANIMATIONS; ++i) {
-      animationInfoArray[i].id = i;
-      animationInfoArray[i].name = allAnimations[i].name;
+  if (!animationPack.begin()) {
+    Serial.println("No animations available, flash them with 'pio run -t uploadpack'");
+    showMessage("NO ANIM", 5000);
   }
-  setupWebServer();
+  startAnimation(0, false);
+
+  renderQueue = xQueueCreate(RENDER_QUEUE_LENGTH, sizeof(RenderCommand));
+
+  // Frame pacing must not depend on network load, so rendering gets its own core
+  xTaskCreatePinnedToCore(renderTask, "render", RENDER_TASK_STACK, nullptr, RENDER_TASK_PRIORITY, &renderTaskHandle, RENDER_TASK_CORE);
+
+  // Wifi setup
+  WiFi.mode(WIFI_STA); // explicitly set mode, esp defaults to STA+AP   
+  startTimeSync();
+  // Connecting and the web server are left to the network task
+  xTaskCreatePinnedToCore(networkTask, "network", NETWORK_TASK_STACK, nullptr, NETWORK_TASK_PRIORITY, &networkTaskHandle, NETWORK_TASK_CORE);
 }
 
 void loop() {
-  wm.process();
-  checkTimeSync();
-  matrix->setBrightness(brightness);
+  // All work is done by renderTask and networkTask
+  vTaskDelete(NULL);
+}
+
+void networkTask(void *parameter) {
+  (void)parameter;
+  // May wait for the connect timeout, the render task keeps running meanwhile
+  connectWiFi();
+  setupWebServer();
+
+  for (;;) {
+    {
+      MetricSpan span(METRIC_WIFI);
+      wm.process();
+    }
+    // 't' on the serial console dumps the trace, see scripts/trace2chrome.py
+    while (Serial.available() > 0) {
+      if (Serial.read() == 't') {
+        trace.writeHex(Serial);
+      }
+    }
+    vTaskDelay(pdMS_TO_TICKS(NETWORK_POLL_MS));
+  }
+}
+
+void renderTask(void *parameter) {
+  (void)parameter;
+  RenderCommand command;
+  for (;;) {
+    while (xQueueReceive(renderQueue, &command, 0) == pdTRUE) {
+      handleRenderCommand(command);
+    }
+
+    renderLoop();
+    publishRenderState();
 
-  int shadeOfGray = map(messageClearTime - millis(), 0, 1000, 0, 255);
-  matrix->setTextColor(matrix->Color(shadeOfGray, shadeOfGray, shadeOfGray));
-  static unsigned long lastAnimationChangeTime = millis();
+    // Sleep until the next frame is due, waking up for commands and to check the encoders
+    uint32_t sleep_ms = RENDER_POLL_MS;
+    if (!displayClock) {
+      sleep_ms = min(sleep_ms, frameScheduler.untilDue(millis()));
+    }
+    xQueuePeek(renderQueue, &command, pdMS_TO_TICKS(sleep_ms));
+  }
+}
+
+bool sendRenderCommand(RenderCommandType type, int32_t value) {
+  RenderCommand command = {type, value};
+  return renderQueue != nullptr && xQueueSend(renderQueue, &command, 0) == pdTRUE;
+}
+
+void publishRenderState() {
+  uint32_t sequence = renderStateSequence.load(std::memory_order_relaxed);
+  renderStateSequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  renderState.animation = currentAnimationIndex;
+  renderState.animationCount = animationPack.count();
+  renderState.brightness = brightness;
+  renderState.displayClock = displayClock;
+  renderState.clockMode = clockMode;
+  renderState.autoAdvance = autoAdvanceEnabled;
+  renderState.animationInterval = animation_change_interval;
+  renderState.playbackRate = playbackRate;
+  renderState.transitionType = transitionType;
+  renderState.transitionLength = transitionLength;
+  renderState.interpolation = interpolationEnabled;
+  renderState.frames = frameScheduler.stats();
+  renderStateSequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool readRenderState(RenderState &out) {
+  for (uint8_t attempt = 0; attempt < 100; attempt++) {
+    uint32_t before = renderStateSequence.load(std::memory_order_acquire);
+    if (before & 1) {
+      continue;
+    }
+    out = renderState;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (renderStateSequence.load(std::memory_order_relaxed) == before) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void handleRenderCommand(const RenderCommand &command) {
+  trace.event(TRACE_COMMAND, command.type, command.value);
+  switch (command.type) {
+    case CMD_SET_ANIMATION:
+      // Checked again here, a new pack may have been loaded since the sender checked the index
+      if (command.value >= 0 && command.value < animationPack.count()) {
+        startAnimation(command.value);
+        lastAnimationChangeTime = millis(); // Reset timer on manual change
+      }
+      break;
+    case CMD_SET_BRIGHTNESS:
+      brightness = minMax(command.value, 0, MAX_BRIGHTNESS);
+      break;
+    case CMD_SET_AUTO_ADVANCE:
+      autoAdvanceEnabled = command.value;
+      break;
+    case CMD_SET_INTERVAL:
+      animation_change_interval = minMax(command.value, 1, 60);
+      break;
+    case CMD_SET_DISPLAY_CLOCK:
+      displayClock = command.value;
+      break;
+    case CMD_SET_CLOCK_MODE:
+      clockMode = command.value % CLOCK_MODES;
+      break;
+    case CMD_SET_PLAYBACK_RATE:
+      playbackRate = command.value < 0 ? minMax(command.value, -PLAYBACK_RATE_MAX, -PLAYBACK_RATE_MIN)
+                                       : minMax(command.value, PLAYBACK_RATE_MIN, PLAYBACK_RATE_MAX);
+      break;
+    case CMD_SET_TRANSITION:
+      if (command.value >= 0 && command.value < TRANSITION_TYPE_COUNT) {
+        transitionType = (TransitionType)command.value;
+      }
+      break;
+    case CMD_SET_TRANSITION_LENGTH:
+      transitionLength = minMax(command.value, 0, TRANSITION_MAX_MS);
+      break;
+    case CMD_SET_INTERPOLATION:
+      interpolationEnabled = command.value;
+      break;
+    case CMD_SET_ANIMATION_ENABLED:
+      animationEnabled = command.value;
+      break;
+    case CMD_RELOAD_PACK:
+      // Swap to a freshly uploaded animation pack
+      frameDecoder->begin(nullptr);
+      outgoingDecoder->begin(nullptr);
+      animationPack.begin();
+      startAnimation(0, false);
+      showMessage(String(animationPack.count()), 2000);
+      break;
+  }
+}
+
+void renderLoop() {
+  matrix->setBrightness(brightness);
+  updateMessageLayer();
 
   // Get the current animation structure
-  const Animation *currentAnim = &allAnimations[currentAnimationIndex];
+  const Animation *currentAnim = animationPack.animation(currentAnimationIndex);
+  if (currentAnim == nullptr) {
+    displayClock = true; // Nothing to play without an animation pack
+  }
 
-  uint8_t duration_units = pgm_read_byte(currentAnim->frameDurations + currentFrame);
-  uint32_t delay_ms = (uint32_t)duration_units * 100.0f * (100.0f / (float)ANIMATION_SPEED);
+  // Frames are only drawn when the picture changes. Switching between animation and clock always redraws;
+  // LedOutput skips sending a frame that is identical to the one on the LEDs.
+  static bool clockShown = false;
+  bool modeChanged = displayClock != clockShown;
+  clockShown = displayClock;
+  uint32_t now = millis();
+  bool redrawn = false;
 
   if (displayClock) {
-    lastAnimationChangeTime = millis(); // Reset animation change timer when in clock mode
-    drawClock();
+    lastAnimationChangeTime = now; // Reset animation change timer when in clock mode
+    frameScheduler.start(now); // Resume the animation on time instead of dropping the frames missed meanwhile
+    transition.stop();
+
+    // Most clocks show whole seconds, so they are drawn when the second or the clock mode changes.
+    // The smooth analog clock moves on every frame.
+    const LocalTime &localTime = clockTime.update(now);
+    static uint32_t drawnClockKey = 0;
+    uint32_t clockKey = (clockMode == CLOCK_MODE_SMOOTH ? now / CLOCK_FRAME_MS : 0) * CLOCK_MODES + clockMode;
+    if (modeChanged || clockKey != drawnClockKey || localTime.changed != 0) {
+      drawnClockKey = clockKey;
+      drawClock();
+      redrawn = true;
+    }
   }
   else {
-    // Check if animation is Enabled and advance frame if it's time to display the next frame
-    if (millis() - lastFrameChangeTime >= delay_ms) {
-      lastFrameChangeTime = millis();
-      playCurrentFrame(currentAnim);
+    // Present the next frame once it is due, the frame is held while animation is disabled
+    int8_t step = playbackStep();
+    bool due = frameScheduler.update(now, currentFrame, currentAnim->frameCount, frameDuration, step);
+    if (interpolateFrames(currentAnim)) {
+      due |= now - lastInterpolationFrameTime >= INTERPOLATION_FRAME_MS;
+    }
 
-      // Increment frame counter, wrap around if necessary
-      if (animationEnabled) {
-        currentFrame++;
-        if (currentFrame >= currentAnim->frameCount) {
-          currentFrame = 0;
-        }
-      }
+    // During a transition both animations keep their own timing and the blend is redrawn every TRANSITION_FRAME_MS.
+    // One more frame is drawn when it ends, so the last blend does not stay on screen.
+    static bool blending = false;
+    bool active = transition.active(now);
+    if (active) {
+      const Animation *outgoingAnim = animationPack.animation(outgoingAnimationIndex);
+      due |= outgoingScheduler.update(now, outgoingFrame, outgoingAnim->frameCount, outgoingFrameDuration, step);
+      due |= now - lastTransitionFrameTime >= TRANSITION_FRAME_MS;
+    }
+    due |= blending && !active;
+    blending = active;
+
+    if (due || modeChanged) {
+      playCurrentFrame(currentAnim);
+      redrawn = true;
     }
   }
 
+  if (!redrawn && compositor.changed(now) && now - lastOverlayFrameTime >= OVERLAY_FRAME_MS) {
+    // Overlays fade independently of the base frame rate
+    refreshOverlays();
+  }
+  else if (!redrawn && ledOutput.brightnessChanged()) {
+    // Nothing to redraw, but the LEDs still have to be sent out at the new brightness
+    refreshOverlays();
+  }
+
   // Check if it's time to auto-advance to the next animation
-  if (!displayClock && millis() - lastAnimationChangeTime >= animation_change_interval * 1000) {
+  if (!displayClock && millis() - lastAnimationChangeTime >= (unsigned long)animation_change_interval * 1000) {
     lastAnimationChangeTime = millis();
 
     // Move to the next animation but only if auto-advance is enabled and animation is enabled
-    if (autoAdvanceEnabled && animationEnabled) {
-      currentAnimationIndex = (currentAnimationIndex + 1) % TOTAL_ANIMATIONS;
-      currentFrame = 0; // Reset frame counter for new animation
+    if (autoAdvanceEnabled && animationEnabled && animationPack.count() > 0) {
+      startAnimation((currentAnimationIndex + 1) % animationPack.count());
+    }
+  }
+
+  // Drain the encoder events queued by the interrupt handlers. Rotation is summed so a fast spin
+  // switches animation once per loop rather than once per detent. Counters hold accelerated steps,
+  // clock modes are few enough to step through by plain detents.
+  EncoderEvent event;
+  int enc1_counter = 0, enc1_pressedCounter = 0, enc1_detents = 0;
+  while (encoder1.poll(event)) {
+    trace.event(TRACE_ENCODER1, event.type, event.delta);
+    switch (event.type) {
+      case ENCODER_STEP: enc1_counter += event.delta; enc1_detents += event.detents; break;
+      case ENCODER_PRESSED_STEP: enc1_pressedCounter += event.delta; enc1_detents += event.detents; break;
+      case ENCODER_PRESS: onEncoder1_shortPress(); break;
+      case ENCODER_LONG_PRESS: onEncoder1_longPress(); break;
+    }
+  }
+  int enc2_counter = 0, enc2_pressedCounter = 0;
+  while (encoder2.poll(event)) {
+    trace.event(TRACE_ENCODER2, event.type, event.delta);
+    switch (event.type) {
+      case ENCODER_STEP: enc2_counter += event.delta; break;
+      case ENCODER_PRESSED_STEP: enc2_pressedCounter += event.delta; break;
+      case ENCODER_PRESS: onEncoder2_shortPress(); break;
+      case ENCODER_LONG_PRESS: onEncoder2_longPress(); break;
     }
   }
 
   // Encoder1 controls animation selection or clock mode
-  if (enc1_counter != 0) {
+  if (enc1_counter != 0 || enc1_pressedCounter != 0) {
     turnOnDisplay();
 
     if (displayClock) {
-      clockMode = clockMode + enc1_counter;
-      Serial.println("Clock mode changed to: " + String(clockMode));
+      clockMode = (clockMode + enc1_detents % CLOCK_MODES + CLOCK_MODES) % CLOCK_MODES;
+      trace.event(TRACE_CLOCK_MODE, 0, clockMode);
+    }
+    // If the encoder button is pressed, adjust playback speed and direction
+    else if (enc1_pressedCounter != 0) {
+      playbackRate = stepPlaybackRate(playbackRate, enc1_pressedCounter);
+      trace.event(TRACE_PLAYBACK_RATE, 0, playbackRate * 100 / PLAYBACK_RATE_ONE);
+      showMessage(formatPlaybackRate(playbackRate), 1000);
     }
-    else {
-      currentAnimationIndex = (currentAnimationIndex + enc1_counter + TOTAL_ANIMATIONS) % TOTAL_ANIMATIONS;
+    // Nothing to select without an animation pack
+    else if (animationPack.count() > 0) {
+      startAnimation((currentAnimationIndex + enc1_counter % animationPack.count() + animationPack.count()) % animationPack.count());
 
       lastAnimationChangeTime = millis(); // Reset animation change timer on manual change
-      
-      currentFrame = 0; // Reset frame counter for new animation
-
-      Serial.println("Switched to animation index: " + String(currentAnimationIndex + 1));
 
       // Show animation index on the display but only if auto advance is disabled
       // It gets annoying to have the index pop up every time in normal mode
@@ -205,63 +475,138 @@ void loop() {
         showMessage(String(currentAnimationIndex + 1), 1000);
       }
     }
-
-    enc1_counter = 0; // Reset encoder counter state
   }
 
   // Encoder 2 controls either brightness or animation change interval
+  // If the encoder button is pressed, adjust brightness
+  if (enc2_pressedCounter != 0) {
+    brightness += enc2_pressedCounter * 5;
+    brightness = minMax(brightness, 0, MAX_BRIGHTNESS);
+    trace.event(TRACE_BRIGHTNESS, 0, brightness);
+    showMessage(String(brightness) + "%", 1000);
+  }
+  // If the encoder button is not pressed, adjust animation change interval
   if (enc2_counter != 0) {
-    // If the encoder button is pressed, adjust brightness
-    if (encoder2.currentlyPressed) {
-      brightness += enc2_counter * 5;
-      brightness = minMax(brightness, 0, MAX_BRIGHTNESS);
-      
-      Serial.println("Brightness set to: " + String(brightness) + "%");
-      showMessage(String(brightness) + "%", 1000);
-    } 
-    // If the encoder button is not pressed, adjust animation change interval
-    else {
-      // If we are in situation where brightness is zero, and user turned the encoder - restore it
-      turnOnDisplay();
-
-      if (!displayClock) {
-        animation_change_interval += enc2_counter; // Change interval by 1 second per step
-        animation_change_interval = minMax(animation_change_interval, 1, 60);
-        
-        Serial.println("Animation change interval: " + String(animation_change_interval) + " s");
-        showMessage(String(animation_change_interval) + "s", 1000);
-      }
+    // If we are in situation where brightness is zero, and user turned the encoder - restore it
+    turnOnDisplay();
+
+    if (!displayClock) {
+      animation_change_interval += enc2_counter; // Change interval by 1 second per step
+      animation_change_interval = minMax(animation_change_interval, 1, 60);
+      trace.event(TRACE_INTERVAL, 0, animation_change_interval);
+      showMessage(String(animation_change_interval) + "s", 1000);
     }
-    enc2_counter = 0;
   }
 }
 
-// --- Frame Playback Function ---
-void playCurrentFrame(const Animation *anim) {
+// Switches to an animation and restarts its timeline. With withTransition the animation on screen keeps
+// playing on the other decoder and is blended into the new one.
+void startAnimation(uint16_t index, bool withTransition) {
+  const Animation *outgoing = animationPack.animation(currentAnimationIndex);
+  const Animation *incoming = animationPack.animation(index);
+
+  if (withTransition && !displayClock && outgoing != nullptr && incoming != nullptr && index != currentAnimationIndex) {
+    // The animation's own settings win over the global ones
+    TransitionType type = TRANSITION_SPEC_HAS_TYPE(incoming->transition) ? TRANSITION_SPEC_TYPE(incoming->transition) : transitionType;
+    uint16_t length = TRANSITION_SPEC_LENGTH_MS(incoming->transition);
+    if (length == 0) {
+      length = transitionLength;
+    }
 
-  // Calculate the start of the current frame data in PROGMEM
-  const uint32_t words_per_frame = (uint32_t)anim->width * anim->height;
-  const uint32_t start_offset = currentFrame * words_per_frame;
-  const uint16_t *current_frame_addr = anim->animationFrames + start_offset;
+    outgoingAnimationIndex = currentAnimationIndex;
+    outgoingFrame = currentFrame;
+    outgoingScheduler = frameScheduler;
+    FrameDecoder *decoder = outgoingDecoder;
+    outgoingDecoder = frameDecoder;
+    frameDecoder = decoder;
+    transition.start(type, length, millis());
+  }
+  else {
+    transition.stop();
+  }
 
-  // Draw the bitmap for the current frame
-  drawRGBBitmap(0, 0, current_frame_addr, anim->width, anim->height);
+  trace.event(TRACE_ANIMATION, 0, index);
+  currentAnimationIndex = index;
+  currentFrame = 0; // Reset frame counter for new animation
+  frameScheduler.start(millis());
+}
 
-  if (millis() < messageClearTime) {
-    matrix->setCursor(0, 0);
-    matrix->print(message);
+// How long a frame of the current animation stays on screen at the current playback rate, in ms
+uint32_t frameDuration(uint16_t frame) {
+  const Animation *anim = animationPack.animation(currentAnimationIndex);
+  return FrameScheduler::scale(anim->frameDurations[frame], playbackRate);
+}
+
+uint32_t outgoingFrameDuration(uint16_t frame) {
+  const Animation *anim = animationPack.animation(outgoingAnimationIndex);
+  return FrameScheduler::scale(anim->frameDurations[frame], playbackRate);
+}
+
+// Direction the animation moves in: 1 forwards, -1 backwards, 0 when paused
+int8_t playbackStep() {
+  return animationEnabled ? (playbackRate < 0 ? -1 : 1) : 0;
+}
+
+// Whether frames of the animation are blended over time. Not while paused, and never for animations
+// that opt out (pixel art would only get blurred).
+bool interpolateFrames(const Animation *anim) {
+  return interpolationEnabled && playbackStep() != 0 && anim->frameCount > 1 && !(anim->flags & ANIMATION_FLAG_NO_INTERPOLATION);
+}
+
+// Decodes a frame of an animation and draws it into the LED buffer
+void drawFrame(FrameDecoder &decoder, const Animation *anim, uint16_t frame) {
+
+  // Restart decoding when the animation changed
+  if (decoder.animation() != anim) {
+    decoder.begin(anim);
+  }
+
+  const uint8_t *native = decoder.nativeFrame(frame);
+  if (native != nullptr) {
+    // Native frames are already in LED order and RGB888, so they are copied as they are
+    MetricSpan span(METRIC_DRAW);
+    memcpy(matrixleds, native, min(anim->width * anim->height, NUMMATRIX) * sizeof(CRGB));
+  }
+  else {
+    // Decode the frame from flash and draw it
+    {
+      MetricSpan span(METRIC_DECODE);
+      decoder.seek(frame);
+      decoder.expand(RGB_bmp_fixed);
+    }
+    MetricSpan span(METRIC_DRAW);
+    matrix->drawRGBBitmap(0, 0, RGB_bmp_fixed, anim->width, anim->height);
   }
-  matrix->show();
 }
 
-void drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap, int16_t w, int16_t h) {
-  // Bitmap points to PROGMEM array of uint16_t RGB565 values
-  const uint16_t *bitmap16 = (const uint16_t *)bitmap;
-  for (uint16_t pixel = 0; pixel < w * h; pixel++) {
-    // Read 16-bit value from PROGMEM
-    RGB_bmp_fixed[pixel] = pgm_read_word(bitmap16 + pixel);
+// --- Frame Playback Function ---
+void playCurrentFrame(const Animation *anim) {
+  uint32_t now = millis();
+  trace.event(TRACE_FRAME, currentAnimationIndex, currentFrame);
+
+  if (transition.active(now)) {
+    // Render the outgoing frame first and keep it aside for blending
+    drawFrame(*outgoingDecoder, animationPack.animation(outgoingAnimationIndex), outgoingFrame);
+    memcpy(transition.from(), matrixleds, sizeof(matrixleds));
+    drawFrame(*frameDecoder, anim, currentFrame);
+    transition.apply(matrixleds, now);
+    lastTransitionFrameTime = now;
+  }
+  else if (interpolateFrames(anim)) {
+    // Blend towards the next frame by the time spent on this one. The next frame is decoded on the
+    // decoder transitions use for the outgoing animation, which is free in between.
+    uint16_t next = (currentFrame + (playbackStep() < 0 ? anim->frameCount - 1 : 1)) % anim->frameCount;
+    drawFrame(*frameDecoder, anim, currentFrame);
+    memcpy(outgoingLeds, matrixleds, sizeof(matrixleds));
+    drawFrame(*outgoingDecoder, anim, next);
+    Transition::blend(matrixleds, outgoingLeds, NUMMATRIX, frameScheduler.progress(now, frameDuration(currentFrame)));
+    lastInterpolationFrameTime = now;
   }
-  matrix->drawRGBBitmap(x, y, RGB_bmp_fixed, w, h);
+  else {
+    drawFrame(*frameDecoder, anim, currentFrame);
+  }
+
+  presentFrame();
 }
 
 void turnOnDisplay() {
@@ -272,13 +617,13 @@ void turnOnDisplay() {
   }
 }
 
-void IRAM_ATTR onEncoder1_shortPress() {
+void onEncoder1_shortPress() {
   if (displayClock) {
-    Serial.println("Doing nothing, clock display active");
-    return;
+    return; // Nothing to toggle while the clock is shown
   }
   
   autoAdvanceEnabled = !autoAdvanceEnabled;
+  trace.event(TRACE_AUTO_ADVANCE, 0, autoAdvanceEnabled);
   showMessage(autoAdvanceEnabled ? ">>" : String(currentAnimationIndex), 1000);
 
   // If we are in situation where brightness is zero, and user pressed a button - restore it
@@ -286,57 +631,103 @@ void IRAM_ATTR onEncoder1_shortPress() {
 }
 
 
-void IRAM_ATTR onEncoder1_longPress() {
+void onEncoder1_longPress() {
   displayClock = !displayClock;
-  Serial.println(displayClock ? "Clock display enabled" : "Animation display enabled");
+  trace.event(TRACE_CLOCK_DISPLAY, 0, displayClock);
 }
 
-void IRAM_ATTR onEncoder2_shortPress() {
-  if (ignoreEncoder2Button) {
-    ignoreEncoder2Button = false;
-    return;
-  }
-
+void onEncoder2_shortPress() {
   animationEnabled = !animationEnabled;
+  trace.event(TRACE_ANIMATION_ENABLED, 0, animationEnabled);
 
   // If we are in situation where brightness is zero, and user pressed a button - restore it
   turnOnDisplay();
 }
 
-void IRAM_ATTR onEncoder2_longPress() {
+void onEncoder2_longPress() {
   brightness = 0;
   matrix->setBrightness(brightness);
-  Serial.println("Display turned off");
+  trace.event(TRACE_BRIGHTNESS, 0, brightness);
 }
 
 void showMessage(const String &msg, unsigned long duration_ms) {
   message = msg;
   messageClearTime = millis() + duration_ms;
+  messageChanged = true;
 }
 
-void drawClock() {
-  switch (clockMode%4) {
+// Rasterizes a new message into its overlay layer, once per message rather than once per frame
+void updateMessageLayer() {
+  if (!messageChanged) {
+    return;
+  }
+  messageChanged = false;
+  MetricSpan span(METRIC_OVERLAY);
+  messageLayer.clear();
+  messageLayer.setCursor(0, 0);
+  messageLayer.print(message);
+  messageLayer.show(messageClearTime, MESSAGE_FADE_MS);
+}
+
+// Keeps the frame just drawn as the base layer, blends the overlays on top and sends it out
+void presentFrame() {
+  uint32_t now = millis();
+  {
+    MetricSpan span(METRIC_OVERLAY);
+    compositor.setBase(matrixleds);
+    compositor.compose(matrixleds, now);
+  }
+  lastOverlayFrameTime = now;
+  MetricSpan span(METRIC_PRESENT);
+  ledOutput.present();
+}
+
+// Blends the overlays again over the last base frame, without redrawing it
+void refreshOverlays() {
+  uint32_t now = millis();
+  {
+    MetricSpan span(METRIC_OVERLAY);
+    compositor.compose(matrixleds, now);
+  }
+  lastOverlayFrameTime = now;
+  MetricSpan span(METRIC_PRESENT);
+  ledOutput.present();
+}
+
+// Draws the clock of a mode, returns false when it could not read the time
+bool drawClockMode(uint8_t mode, const LocalTime &time) {
+  switch (mode % CLOCK_MODES) {
     case 0:
-      drawDigitalClock(matrix);
-      break;
+      return drawDigitalClock(matrix, time);
     case 1:
-      drawRingClock(matrix);
-      break;
+      return drawRingClock(matrixleds, ledIndex, time);
     case 2:
-      drawBarsClock(matrix);
-      break;
+      return drawBarsClock(matrix, time);
     case 3:
-      drawAnalogClock(matrix);
-      break;
+      return drawAnalogClock(matrixleds, ledIndex, time);
+    case CLOCK_MODE_SMOOTH:
+      return drawSmoothAnalogClock(matrixleds, ledIndex, time);
     default:
-      break;
+      return false;
   }
+}
 
-  if (millis() < messageClearTime) {
-    matrix->setCursor(0, 0);
-    matrix->print(message);
+void drawClock() {
+  compositor.restoreBase(matrixleds);
+  {
+    MetricSpan span(METRIC_DRAW);
+    // Until the first SNTP answer the wall clock counts from 1970, so every mode shows the placeholder
+    const LocalTime &time = clockTime.time();
+    if (!timeSynced) {
+      drawTimeUnknown(matrix, time);
+    }
+    else if (!drawClockMode(clockMode, time)) {
+      trace.event(TRACE_TIME_UNKNOWN, clockMode);
+      drawTimeUnknown(matrix, time);
+    }
   }
-  matrix->show();
+
+  presentFrame();
 }
 
 int minMax(int val, int minVal, int maxVal) {
@@ -347,27 +738,49 @@ int minMax(int val, int minVal, int maxVal) {
   return val;
 }
 
-void checkTimeSync() {
-  static bool timeSynced = false;
+// Changes the playback rate by encoder steps. Rates below PLAYBACK_RATE_MIN are skipped, so turning
+// further down from the slowest forward rate continues with the slowest reverse rate.
+int16_t stepPlaybackRate(int16_t rate, int steps) {
+  int next = rate + steps * PLAYBACK_RATE_STEP;
+  if (next > -PLAYBACK_RATE_MIN && next < PLAYBACK_RATE_MIN) {
+    next = steps > 0 ? PLAYBACK_RATE_MIN : -PLAYBACK_RATE_MIN;
+  }
+  return minMax(next, -PLAYBACK_RATE_MAX, PLAYBACK_RATE_MAX);
+}
 
-  if (!timeSynced) {
-    if (WiFi.status() == WL_CONNECTED) {
-      // Init and get the time
-      configTime(GMT_OFFSET, DAYLIGHT_OFFSET, NTP_SERVER);
-      Serial.println("Getting local time");
+// Playback rate in percent of the authored speed, negative when playing backwards
+String formatPlaybackRate(int16_t rate) {
+  return String(rate * 100 / PLAYBACK_RATE_ONE) + "%";
+}
 
-      struct tm timeinfo;
-      if(!getLocalTime(&timeinfo)){
-        Serial.println("Failed to obtain time");
-        return;
-      }
-      
-      timeSynced = true;
-      Serial.print("Local time: ");
-      Serial.println(&timeinfo, "%A, %B %d %Y %H:%M:%S");
+void connectWiFi() {
+  // Uncomment to reset settings
+  // wm.resetSettings();
+  wm.setConfigPortalBlocking(false);
 
-    }
+  Serial.println("Setting portal config timout to 60 seconds and connect timeout to 30 seconds");
+  wm.setConfigPortalTimeout(60);
+  wm.setConnectTimeout(30);
+
+  Serial.println("Connecting to WiFi...");
+  if(wm.autoConnect("NEOMATRIX_AP")){
+      Serial.println("wiFi connected");
   }
+  else {
+      Serial.println("Config portal running");
+  }
+}
 
+// Called by SNTP from the lwIP task on every synchronization
+static void onTimeSync(struct timeval *tv) {
+  timeSynced = true;
+  trace.event(TRACE_TIME_SYNC, 0, tv->tv_sec);
+}
 
-}
\ No newline at end of file
+// SNTP keeps retrying in the background until the network is up, nothing waits for it
+void startTimeSync() {
+  // Later corrections are slewed instead of stepped, so the smooth clock never jumps
+  sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
+  sntp_set_time_sync_notification_cb(onTimeSync);
+  configTime(GMT_OFFSET, DAYLIGHT_OFFSET, NTP_SERVER);
+}
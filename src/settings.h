@@ -10,8 +10,42 @@
 #define mw 16                 // Matrix width in pixels
 #define mh 16                 // Matrix height in pixels
 #define MAX_BRIGHTNESS 90     // Maximum brightness of the matrix
-#define ANIMATION_SPEED 150   // Speed in percent compared to original animation speed
+#define ANIMATION_SPEED 150   // Initial playback speed in percent compared to original animation speed
+#define PLAYBACK_RATE_MIN 32  // Slowest playback rate (8.8 fixed point, 32 = 0.125x)
+#define PLAYBACK_RATE_MAX 2048 // Fastest playback rate (8x)
+#define PLAYBACK_RATE_STEP 32 // Playback rate change per encoder step (0.125x)
 
 #define NUMMATRIX (mw * mh)
 #define INITIAL_ANIMATION_INTERVAL 10 // Initial interval for animations in seconds
+#define TRANSITION_DEFAULT_TYPE TRANSITION_CROSSFADE // Transition between animations: TRANSITION_NONE, _CROSSFADE, _WIPE or _DISSOLVE
+#define TRANSITION_DEFAULT_MS 600 // Length of transitions between animations
+#define TRANSITION_MAX_MS 5000
+#define TRANSITION_FRAME_MS 20 // Redraw interval while a transition runs (50 fps)
+#define INTERPOLATION_DEFAULT false // Blend between frames of slow animations, see custom_no_interpolation in platformio.ini
+#define INTERPOLATION_FRAME_MS 20 // Redraw interval while frames are blended (50 fps)
+#define MESSAGE_FADE_MS 1000  // Messages fade out over their last second
+#define OVERLAY_FRAME_MS 20   // Redraw interval while an overlay fades over a still frame (50 fps)
+#define CLOCK_MODES 5          // Digital, Ring, Bars, Analog, Smooth analog
+#define CLOCK_MODE_SMOOTH 4
+#define CLOCK_FRAME_MS 20      // Redraw interval of the smooth analog clock (50 fps)
+#define ENCODER_PCNT true      // Count encoder rotation in the pulse counter peripheral instead of pin interrupts
+#define ENCODER_PCNT_FILTER 1023 // Pulse counter glitch filter in APB cycles (12.5 ns each, max 1023)
+#define ENCODER_ACCEL_SLOW_MS 100 // Detents further apart than this move by one step
+#define ENCODER_ACCEL_FAST_MS 15  // Detents this close move by the encoder's maximum multiplier
+#define ENCODER1_ACCEL_MAX 10     // Animation selection and playback rate
+#define ENCODER2_ACCEL_MAX 4      // Change interval and brightness, 1 turns acceleration off
+#define FRAME_DROP_POLICY FRAME_DROP_SKIP // What to do when frames are late: FRAME_DROP_SKIP, FRAME_DROP_CATCH_UP or FRAME_DROP_RESYNC
+
+// Tasks: rendering owns core 1, networking (WiFiManager, NTP, AsyncTCP) stays on core 0
+#define RENDER_TASK_CORE 1
+#define RENDER_TASK_PRIORITY 3
+#define RENDER_TASK_STACK 8192
+#define RENDER_QUEUE_LENGTH 16
+#define RENDER_POLL_MS 10     // Longest time the render task sleeps between encoder checks
+#define LED_OUTPUT_TASK_CORE 1
+#define LED_OUTPUT_TASK_PRIORITY 4 // Above rendering, so a finished frame goes out as soon as it is presented
+#define NETWORK_TASK_CORE 0
+#define NETWORK_TASK_PRIORITY 1
+#define NETWORK_TASK_STACK 8192
+#define NETWORK_POLL_MS 10
 #endif // SETTINGS_H
\ No newline at end of file
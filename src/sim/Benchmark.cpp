@@ -0,0 +1,509 @@
+#include "Benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <math.h>
+
+#include "Clocks.h"
+#include "Compositor.h"
+#include "FrameCodec.h"
+#include "Transition.h"
+#include "../settings.h"
+
+#define BENCH_BATCHES 5   // The median batch is reported
+#define BENCH_FRAMES 16   // Frames of the synthetic animation
+#define BENCH_STEP_MS 37  // Virtual time between frames, so the clock hands move
+
+static CRGB matrixleds[NUMMATRIX];
+static uint16_t ledIndex[NUMMATRIX];
+static FastLED_NeoMatrix matrix(matrixleds, mw, mh, NEO_MATRIX_BOTTOM + NEO_MATRIX_LEFT + NEO_MATRIX_ROWS + NEO_MATRIX_ZIGZAG);
+
+static uint16_t RGB_bmp_fixed[NUMMATRIX];
+static uint16_t frameSymbols[NUMMATRIX];
+static FrameDecoder frameDecoder(frameSymbols, NUMMATRIX);
+static CRGB outgoingLeds[NUMMATRIX];
+static uint16_t nextSymbols[NUMMATRIX];
+static FrameDecoder nextDecoder(nextSymbols, NUMMATRIX);
+
+static CRGB baseLeds[NUMMATRIX];
+static CRGB messagePixels[NUMMATRIX];
+static uint8_t messageAlpha[NUMMATRIX];
+static OverlayLayer messageLayer(mw, mh, ledIndex, messagePixels, messageAlpha);
+static Compositor compositor(baseLeds, NUMMATRIX);
+static ClockTime clockTime;
+
+// Synthetic 4 bpp animation as convert.py would encode it: a keyframe of literal runs, then delta
+// frames that change a quarter of every 64 pixel block
+static uint8_t pool[BENCH_FRAMES * (1 + NUMMATRIX / 2 + NUMMATRIX / 64)];
+static uint32_t poolOffsets[BENCH_FRAMES];
+static uint16_t frames[BENCH_FRAMES];
+static uint16_t frameDurations[BENCH_FRAMES];
+static uint16_t palette[16];
+static Animation animation;
+static uint8_t nativeFrames[BENCH_FRAMES][NUMMATRIX * sizeof(CRGB)];
+static uint32_t encodedBytes = 0;
+
+static uint8_t* literal(uint8_t* out, uint8_t count, uint8_t seed) {
+    *out++ = FRAME_OP_LITERAL << 6 | (count - 1);
+    for (uint8_t i = 0; i < count; i += 2) {
+        *out++ = ((seed + i) & 0x0F) | ((seed + i * 7) & 0x0F) << 4;
+    }
+    return out;
+}
+
+static void buildAnimation() {
+    uint8_t* out = pool;
+    for (uint16_t f = 0; f < BENCH_FRAMES; f++) {
+        poolOffsets[f] = out - pool;
+        frames[f] = f;
+        frameDurations[f] = 100;
+        *out++ = f == 0 ? FRAME_KEY : 0;
+        for (uint16_t block = 0; block < NUMMATRIX / 64; block++) {
+            if (f == 0) {
+                out = literal(out, 64, block);
+            } else {
+                *out++ = FRAME_OP_SKIP << 6 | (48 - 1);
+                out = literal(out, 16, f + block);
+            }
+        }
+        for (uint16_t i = 0; i < sizeof(nativeFrames[f]); i++) {
+            nativeFrames[f][i] = f * 31 + i;
+        }
+    }
+    encodedBytes = out - pool;
+
+    for (uint8_t i = 0; i < 16; i++) {
+        palette[i] = FastLED_NeoMatrix::Color(i * 16, 255 - i * 16, i * 8);
+    }
+    animation = {"bench", BENCH_FRAMES, mw, mh, 4, 0, 0, frameDurations, frames, palette, pool, poolOffsets};
+}
+
+// --- Analog and ring clocks as drawn before ClockTables.h, kept here for the before/after comparison ---
+// They computed every pixel with sin/cos or the ring walk and drew it through drawPixel(). The lines and
+// the circle are drawn like Adafruit GFX does, which is what they called on the device.
+
+static void legacyDrawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            matrix.drawPixel(y0, x0, color);
+        } else {
+            matrix.drawPixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+static void legacyDrawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color) {
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+    matrix.drawPixel(x0, y0 + r, color);
+    matrix.drawPixel(x0, y0 - r, color);
+    matrix.drawPixel(x0 + r, y0, color);
+    matrix.drawPixel(x0 - r, y0, color);
+    while (x < y) {
+        if (f >= 0) {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+        matrix.drawPixel(x0 + x, y0 + y, color);
+        matrix.drawPixel(x0 - x, y0 + y, color);
+        matrix.drawPixel(x0 + x, y0 - y, color);
+        matrix.drawPixel(x0 - x, y0 - y, color);
+        matrix.drawPixel(x0 + y, y0 + x, color);
+        matrix.drawPixel(x0 - y, y0 + x, color);
+        matrix.drawPixel(x0 + y, y0 - x, color);
+        matrix.drawPixel(x0 - y, y0 - x, color);
+    }
+}
+
+static void legacyAnalogClock(const LocalTime& time) {
+    const struct tm& timeinfo = time.tm;
+    int cx = mw / 2;
+    int cy = mh / 2;
+    int radius = 7;
+    matrix.fillScreen(0);
+    legacyDrawCircle(cx, cy, radius, matrix.Color(GREY_COLOR));
+
+    float hour = timeinfo.tm_hour % 12 + timeinfo.tm_min / 60.0;
+    float hour_angle = (hour / 12.0) * 2 * PI - PI / 2;
+    legacyDrawLine(cx, cy, cx + cos(hour_angle) * (radius - 4), cy + sin(hour_angle) * (radius - 4), matrix.Color(HOURS_COLOR));
+
+    float minute = timeinfo.tm_min + timeinfo.tm_sec / 60.0;
+    float min_angle = (minute / 60.0) * 2 * PI - PI / 2;
+    legacyDrawLine(cx, cy, cx + cos(min_angle) * (radius - 2), cy + sin(min_angle) * (radius - 2), matrix.Color(MINUTE_COLOR));
+
+    float sec_angle = (timeinfo.tm_sec / 60.0) * 2 * PI - PI / 2;
+    legacyDrawLine(cx, cy, cx + cos(sec_angle) * (radius - 1), cy + sin(sec_angle) * (radius - 1), matrix.Color(SECONDS_COLOR));
+}
+
+static void legacyDrawPerimeter(int start, int end, uint16_t color) {
+    for (int x = start; x < end; ++x)
+        matrix.drawPixel(x, start, color);
+    for (int y = start + 1; y < end - 1; ++y)
+        matrix.drawPixel(end - 1, y, color);
+    for (int x = end - 1; x >= start; --x)
+        matrix.drawPixel(x, end - 1, color);
+    for (int y = end - 2; y > start; --y)
+        matrix.drawPixel(start, y, color);
+}
+
+static void legacyPerimeterXY(int ringSize, int idx, int& x, int& y) {
+    int start = (16 - ringSize) / 2;
+    int end = start + ringSize;
+    int perim = (ringSize - 1) * 4;
+    idx = (idx + ringSize / 2) % perim;
+    if (idx < ringSize - 1) {
+        x = start + idx;
+        y = start;
+    } else if (idx < (ringSize - 1) * 2) {
+        x = end - 1;
+        y = start + (idx - (ringSize - 1));
+    } else if (idx < (ringSize - 1) * 3) {
+        x = end - 1 - (idx - (ringSize - 1) * 2);
+        y = end - 1;
+    } else {
+        x = start;
+        y = end - 1 - (idx - (ringSize - 1) * 3);
+    }
+}
+
+static void legacyRingClock(const LocalTime& time) {
+    const struct tm& timeinfo = time.tm;
+    int x, y;
+    matrix.fillScreen(0);
+    legacyDrawPerimeter(0, 16, matrix.Color(GREY_COLOR));
+    legacyDrawPerimeter(1, 15, matrix.Color(0, 0, 0));
+    legacyDrawPerimeter(2, 14, matrix.Color(GREY_COLOR));
+
+    legacyPerimeterXY(16, timeinfo.tm_sec % 60, x, y);
+    matrix.drawPixel(x, y, matrix.Color(SECONDS_COLOR));
+    legacyPerimeterXY(14, map(timeinfo.tm_min, 0, 59, 0, 51), x, y);
+    matrix.drawPixel(x, y, matrix.Color(MINUTE_COLOR));
+    legacyPerimeterXY(12, map((timeinfo.tm_hour % 12) * 4 + timeinfo.tm_min / 15, 0, 47, 0, 43), x, y);
+    matrix.drawPixel(x, y, matrix.Color(HOURS_COLOR));
+}
+
+// The least drawRGBBitmap() does for every pixel of an RGB565 frame: remap it to its LED and expand the
+// color. FastLED_NeoMatrix adds a virtual drawPixel() call and bounds checks per pixel on top, native
+// frames skip all of it with a single memcpy (native_copy).
+static void blitRgb565() {
+    for (uint16_t i = 0; i < NUMMATRIX; i++) {
+        uint16_t color = RGB_bmp_fixed[i];
+        uint8_t r = color >> 11, g = (color >> 5) & 0x3F, b = color & 0x1F;
+        matrixleds[ledIndex[i]] = CRGB(r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2);
+    }
+}
+
+// An animation frame as playCurrentFrame() draws it, with blitRgb565() in place of drawRGBBitmap()
+static void drawBenchFrame(FrameDecoder& decoder, uint16_t frame) {
+    decoder.seek(frame);
+    decoder.expand(RGB_bmp_fixed);
+    blitRgb565();
+}
+
+// Interpolated redraws: every frame of the animation is redrawn INTERPOLATION_REDRAWS times, blending it with
+// the next frame by the time spent on it. Frames advance sequentially on both decoders, as in playback.
+#define INTERPOLATION_REDRAWS 4
+
+static void drawInterpolatedFrame(uint32_t i) {
+    uint16_t frame = (i / INTERPOLATION_REDRAWS) % BENCH_FRAMES;
+    drawBenchFrame(frameDecoder, frame);
+    memcpy(outgoingLeds, matrixleds, sizeof(matrixleds));
+    drawBenchFrame(nextDecoder, (frame + 1) % BENCH_FRAMES);
+    Transition::blend(matrixleds, outgoingLeds, NUMMATRIX, (i % INTERPOLATION_REDRAWS) * TRANSITION_PROGRESS_ONE / INTERPOLATION_REDRAWS);
+}
+
+// Frame buffer bytes read and written per frame, from the stage's inputs and outputs (not cache traffic)
+static uint32_t litLeds() {
+    uint32_t lit = 0;
+    for (uint16_t i = 0; i < NUMMATRIX; i++) {
+        lit += matrixleds[i] != CRGB(0, 0, 0);
+    }
+    return lit;
+}
+
+static uint32_t clockBytes() {
+    return NUMMATRIX * sizeof(CRGB) + litLeds() * sizeof(CRGB);
+}
+
+struct Stage {
+    const char* name;
+    void (*run)(uint32_t i);
+    uint32_t (*bytes)();
+    const void* output;
+    size_t outputSize;
+};
+
+// drawRGBBitmap, text and the digital and bars clocks draw through the GFX stand-ins in shims/, which split
+// every call into pixels like Adafruit GFX does. Those stages time the firmware's drawing down to the
+// drawPixel() calls; on the ESP32 FastLED_NeoMatrix adds its tile mapping and gamma lookup to each pixel.
+static const Stage stages[] = {
+    {"decode_keyframe",
+     [](uint32_t) { frameDecoder.begin(&animation); frameDecoder.seek(0); },
+     []() -> uint32_t { return poolOffsets[1] + sizeof(frameSymbols); },
+     frameSymbols, sizeof(frameSymbols)},
+    {"decode_sequential",
+     [](uint32_t i) { frameDecoder.seek(i % BENCH_FRAMES); },
+     []() -> uint32_t { return encodedBytes / BENCH_FRAMES + (sizeof(frameSymbols) + (BENCH_FRAMES - 1) * NUMMATRIX) / BENCH_FRAMES; },
+     frameSymbols, sizeof(frameSymbols)},
+    // Every frame that does not follow the decoded one, as in reverse playback, replays from the keyframe.
+    // The last frame is the worst case, every delta since the keyframe.
+    {"decode_seek",
+     [](uint32_t) { frameDecoder.begin(&animation); frameDecoder.seek(BENCH_FRAMES - 1); },
+     []() -> uint32_t { return encodedBytes + sizeof(frameSymbols) + (BENCH_FRAMES - 1) * NUMMATRIX; },
+     frameSymbols, sizeof(frameSymbols)},
+    {"expand_palette",
+     [](uint32_t) { frameDecoder.expand(RGB_bmp_fixed); },
+     []() -> uint32_t { return sizeof(frameSymbols) + 2 * sizeof(RGB_bmp_fixed); },
+     RGB_bmp_fixed, sizeof(RGB_bmp_fixed)},
+    {"blit_rgb565",
+     [](uint32_t) { blitRgb565(); },
+     []() -> uint32_t { return sizeof(RGB_bmp_fixed) + sizeof(ledIndex) + sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"draw_rgb_bitmap",
+     [](uint32_t) { matrix.drawRGBBitmap(0, 0, RGB_bmp_fixed, mw, mh); },
+     []() -> uint32_t { return sizeof(RGB_bmp_fixed) + sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"native_copy",
+     [](uint32_t i) { memcpy(matrixleds, nativeFrames[i % BENCH_FRAMES], sizeof(matrixleds)); },
+     []() -> uint32_t { return 2 * sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"crossfade",
+     [](uint32_t i) { Transition::blend(matrixleds, outgoingLeds, NUMMATRIX, i & 0xFF); },
+     []() -> uint32_t { return 3 * sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"frame_redraw",
+     [](uint32_t i) { drawBenchFrame(frameDecoder, (i / INTERPOLATION_REDRAWS) % BENCH_FRAMES); },
+     []() -> uint32_t { return encodedBytes / BENCH_FRAMES / INTERPOLATION_REDRAWS + sizeof(frameSymbols) + 2 * sizeof(RGB_bmp_fixed) + sizeof(ledIndex) + sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"frame_interpolated",
+     drawInterpolatedFrame,
+     []() -> uint32_t {
+         return 2 * (encodedBytes / BENCH_FRAMES / INTERPOLATION_REDRAWS + sizeof(frameSymbols) + 2 * sizeof(RGB_bmp_fixed) + sizeof(ledIndex) + sizeof(matrixleds))
+                + 2 * sizeof(matrixleds) + 3 * sizeof(matrixleds);
+     },
+     matrixleds, sizeof(matrixleds)},
+    {"message_text",
+     [](uint32_t) { messageLayer.clear(); messageLayer.setCursor(0, 0); messageLayer.print("150%"); },
+     []() -> uint32_t {
+         uint32_t lit = 0;
+         for (uint16_t i = 0; i < NUMMATRIX; i++) {
+             lit += messageAlpha[i] != 0;
+         }
+         return sizeof(messageAlpha) + lit * (sizeof(CRGB) + 1);
+     },
+     messageAlpha, sizeof(messageAlpha)},
+    {"compose_overlay",
+     [](uint32_t) { compositor.compose(matrixleds, millis()); },
+     []() -> uint32_t { return 3 * sizeof(matrixleds) + sizeof(messageAlpha) + sizeof(matrixleds); },
+     matrixleds, sizeof(matrixleds)},
+    {"clock_digital", [](uint32_t) { drawDigitalClock(&matrix, clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_bars", [](uint32_t) { drawBarsClock(&matrix, clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_ring_legacy", [](uint32_t) { legacyRingClock(clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_ring", [](uint32_t) { drawRingClock(matrixleds, ledIndex, clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_analog_legacy", [](uint32_t) { legacyAnalogClock(clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_analog", [](uint32_t) { drawAnalogClock(matrixleds, ledIndex, clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+    {"clock_smooth", [](uint32_t) { drawSmoothAnalogClock(matrixleds, ledIndex, clockTime.update(millis())); }, clockBytes, matrixleds, sizeof(matrixleds)},
+};
+
+#define STAGE_COUNT (sizeof(stages) / sizeof(stages[0]))
+
+// Stages that must finish within a frame period, checked on every run against the median batch
+struct StageBudget {
+    const char* name;
+    double maxNsPerFrame;
+};
+
+static const StageBudget budgets[] = {
+    {"clock_smooth", CLOCK_FRAME_MS * 1e6}, // Redrawn every CLOCK_FRAME_MS
+};
+
+static const StageBudget* findBudget(const char* name) {
+    for (const StageBudget& budget : budgets) {
+        if (strcmp(budget.name, name) == 0) {
+            return &budget;
+        }
+    }
+    return nullptr;
+}
+
+struct StageResult {
+    double nsPerFrame;     // Median batch
+    double minNsPerFrame;  // Fastest batch
+    uint32_t bytesPerFrame;
+    uint32_t checksum;     // FNV-1a of the stage's output after the last frame
+};
+
+static uint32_t checksum(const void* data, size_t size) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ ((const uint8_t*)data)[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static StageResult measure(const Stage& stage, uint32_t iterations) {
+    // Every stage starts from the same virtual time and buffers, so checksums are repeatable
+    simSetTime(1735725600); // 2025-01-01 10:00:00 UTC
+    frameDecoder.begin(&animation);
+    frameDecoder.seek(0);
+    frameDecoder.expand(RGB_bmp_fixed);
+    nextDecoder.begin(&animation);
+    memset(matrixleds, 0, sizeof(matrixleds));
+    for (uint16_t i = 0; i < NUMMATRIX; i++) {
+        outgoingLeds[i] = CRGB(i, 255 - i, i * 3);
+        baseLeds[i] = CRGB(i * 5, i, 255 - i);
+    }
+    messageLayer.clear();
+    messageLayer.print("150%");
+    messageLayer.show(UINT32_MAX, 0);
+
+    for (uint32_t i = 0; i < iterations / 10; i++) {
+        stage.run(i);
+    }
+
+    double batches[BENCH_BATCHES];
+    for (uint8_t b = 0; b < BENCH_BATCHES; b++) {
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            stage.run(i);
+            simAdvance(BENCH_STEP_MS);
+        }
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+        batches[b] = (double)elapsed.count() / iterations;
+    }
+    std::sort(batches, batches + BENCH_BATCHES);
+
+    return {batches[BENCH_BATCHES / 2], batches[0], stage.bytes(), checksum(stage.output, stage.outputSize)};
+}
+
+// Reads the fastest batch and the checksum of a stage from a report written by writeReport(). The fastest
+// batch is compared rather than the median, as it is the one least disturbed by other work on the machine.
+static bool readBaseline(const char* report, const char* name, double& ns, uint32_t& sum) {
+    char key[64];
+    snprintf(key, sizeof(key), "\"name\": \"%s\"", name);
+    const char* entry = strstr(report, key);
+    if (entry == nullptr) {
+        return false;
+    }
+    const char* value = strstr(entry, "\"min_ns_per_frame\":");
+    const char* checksumValue = strstr(entry, "\"checksum\":");
+    return value != nullptr && sscanf(value, "\"min_ns_per_frame\": %lf", &ns) == 1 &&
+           checksumValue != nullptr && sscanf(checksumValue, "\"checksum\": \"%x\"", &sum) == 1;
+}
+
+static char* readFile(const char* path) {
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        return nullptr;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char* text = (char*)calloc(size + 1, 1);
+    if (text != nullptr && fread(text, 1, size, file) != (size_t)size) {
+        free(text);
+        text = nullptr;
+    }
+    fclose(file);
+    return text;
+}
+
+static bool writeReport(const char* path, uint32_t iterations, const StageResult* results) {
+    FILE* file = fopen(path, "w");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "{\n  \"iterations\": %u,\n  \"batches\": %d,\n  \"stages\": [\n", iterations, BENCH_BATCHES);
+    for (size_t s = 0; s < STAGE_COUNT; s++) {
+        fprintf(file, "    {\"name\": \"%s\", \"ns_per_frame\": %.1f, \"min_ns_per_frame\": %.1f, \"bytes_per_frame\": %u, \"checksum\": \"%08x\"}%s\n",
+                stages[s].name, results[s].nsPerFrame, results[s].minNsPerFrame, results[s].bytesPerFrame, results[s].checksum,
+                s + 1 < STAGE_COUNT ? "," : "");
+    }
+    fprintf(file, "  ]\n}\n");
+    return fclose(file) == 0;
+}
+
+int runBenchmarks(const BenchmarkOptions& options) {
+    for (uint8_t y = 0; y < mh; y++) {
+        for (uint8_t x = 0; x < mw; x++) {
+            ledIndex[y * mw + x] = matrix.XY(x, y);
+        }
+    }
+    matrix.setTextWrap(false);
+    messageLayer.setTextColor(FastLED_NeoMatrix::Color(255, 255, 255));
+    buildAnimation();
+
+    char* baseline = nullptr;
+    if (options.baselinePath != nullptr && (baseline = readFile(options.baselinePath)) == nullptr) {
+        fprintf(stderr, "Could not read %s\n", options.baselinePath);
+        return 2;
+    }
+
+    uint32_t baselineIterations = 0;
+    const char* iterationsValue = baseline != nullptr ? strstr(baseline, "\"iterations\":") : nullptr;
+    if (iterationsValue != nullptr) {
+        sscanf(iterationsValue, "\"iterations\": %u", &baselineIterations);
+    }
+
+    StageResult results[STAGE_COUNT];
+    bool regressed = false;
+    bool overBudget = false;
+    printf("stage                ns/frame   min ns  bytes/frame  checksum\n");
+    for (size_t s = 0; s < STAGE_COUNT; s++) {
+        results[s] = measure(stages[s], options.iterations);
+        printf("%-19s  %8.1f  %7.1f  %11u  %08x", stages[s].name, results[s].nsPerFrame, results[s].minNsPerFrame,
+               results[s].bytesPerFrame, results[s].checksum);
+
+        const StageBudget* budget = findBudget(stages[s].name);
+        if (budget != nullptr && results[s].nsPerFrame > budget->maxNsPerFrame) {
+            overBudget = true;
+            printf("  OVER BUDGET (%.0f ns)", budget->maxNsPerFrame);
+        }
+
+        double before;
+        uint32_t beforeSum;
+        if (baseline != nullptr && readBaseline(baseline, stages[s].name, before, beforeSum) && before > 0) {
+            double change = (results[s].minNsPerFrame - before) * 100 / before;
+            bool slower = change > options.tolerancePercent;
+            regressed |= slower;
+            printf("  %+6.1f%%%s", change, slower ? "  REGRESSION" : "");
+            // Same iterations give the same frames, so a different checksum means the output changed
+            if (baselineIterations == options.iterations && beforeSum != results[s].checksum) {
+                printf("  output changed");
+            }
+        }
+        printf("\n");
+    }
+    free(baseline);
+
+    if (options.jsonPath != nullptr && !writeReport(options.jsonPath, options.iterations, results)) {
+        fprintf(stderr, "Could not write %s\n", options.jsonPath);
+        return 2;
+    }
+    return regressed || overBudget ? 1 : 0;
+}
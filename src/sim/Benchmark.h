@@ -0,0 +1,17 @@
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+struct BenchmarkOptions {
+    uint32_t iterations;        // Frames per timed batch
+    const char* jsonPath;       // Report to write, nullptr for none
+    const char* baselinePath;   // Earlier report to compare against, nullptr for none
+    uint16_t tolerancePercent;  // Slowdown against the baseline that still passes
+};
+
+// Times every rendering stage on the host and prints ns and bytes per frame. Returns the exit code:
+// 1 when a stage got slower than the baseline allows.
+int runBenchmarks(const BenchmarkOptions& options);
+
+#endif // BENCHMARK_H
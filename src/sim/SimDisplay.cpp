@@ -0,0 +1,32 @@
+#include "SimDisplay.h"
+
+bool SimDisplay::writePpm(const char* path, uint8_t scale) const {
+    FILE* file = fopen(path, "wb");
+    if (file == nullptr) {
+        return false;
+    }
+    fprintf(file, "P6\n%d %d\n255\n", _width * scale, _height * scale);
+    for (uint16_t y = 0; y < _height * scale; y++) {
+        for (uint16_t x = 0; x < _width * scale; x++) {
+            const CRGB& c = pixel(x / scale, y / scale);
+            fwrite(c.raw, 1, 3, file);
+        }
+    }
+    return fclose(file) == 0;
+}
+
+void SimDisplay::printAnsi(FILE* out, bool home) const {
+    if (home) {
+        fprintf(out, "\x1b[%dA", (_height + 1) / 2);
+    }
+    // Upper half block: foreground is the upper LED, background the lower one
+    for (uint8_t y = 0; y < _height; y += 2) {
+        for (uint8_t x = 0; x < _width; x++) {
+            const CRGB& top = pixel(x, y);
+            CRGB bottom = y + 1 < _height ? pixel(x, y + 1) : CRGB(0, 0, 0);
+            fprintf(out, "\x1b[38;2;%d;%d;%dm\x1b[48;2;%d;%d;%dm▀", top.r, top.g, top.b, bottom.r, bottom.g, bottom.b);
+        }
+        fputs("\x1b[0m\n", out);
+    }
+    fflush(out);
+}
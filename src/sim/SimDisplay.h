@@ -0,0 +1,25 @@
+#ifndef SIMDISPLAY_H
+#define SIMDISPLAY_H
+
+#include <FastLED.h>
+
+// Dumps the simulated LED buffer in matrix order. ledIndex maps y * width + x to the LED position.
+class SimDisplay {
+public:
+    SimDisplay(const CRGB* leds, const uint16_t* ledIndex, uint8_t width, uint8_t height)
+        : _leds(leds), _ledIndex(ledIndex), _width(width), _height(height) {}
+    // Binary PPM, every LED scale x scale pixels
+    bool writePpm(const char* path, uint8_t scale = 16) const;
+    // Two LEDs per character cell in 24-bit colour. With home the cursor moves back over the last frame.
+    void printAnsi(FILE* out, bool home) const;
+
+private:
+    const CRGB& pixel(uint8_t x, uint8_t y) const { return _leds[_ledIndex[y * _width + x]]; }
+
+    const CRGB* _leds;
+    const uint16_t* _ledIndex;
+    uint8_t _width;
+    uint8_t _height;
+};
+
+#endif // SIMDISPLAY_H
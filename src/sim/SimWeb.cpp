@@ -0,0 +1,6 @@
+// The host has no network stack, so the web server (Web.cpp) only runs on the device. The network task
+// still connects through the WiFiManager stand-in and keeps polling it.
+
+#include "../Web.h"
+
+void setupWebServer() {}
@@ -0,0 +1,289 @@
+// Host simulator: runs the firmware in src/main.cpp against the shims in shims/, with its tasks on a
+// virtual clock, and dumps what the LEDs show as PPM files or to the terminal. --pacing runs the frame
+// scheduler alone, --bench times the rendering stages instead (see Benchmark.cpp).
+// Build and run with: pio run -e native && .pio/build/native/program --help
+
+#include <getopt.h>
+#include <unistd.h>
+
+#include "AnimationPack.h"
+#include "Benchmark.h"
+#include "FrameScheduler.h"
+#include "MockEncoderHal.h"
+#include "SimDisplay.h"
+#include "../RenderCommands.h"
+#include "../settings.h"
+#include <FastLED_NeoMatrix.h>
+#include <esp_sntp.h>
+
+// The unit tests (pio test -e native) link the firmware and the shims with their own main()
+#ifndef PIO_UNIT_TESTING
+
+#define SIM_PACK_PARTITION_SIZE 0xE0000 // The anims partition in huge_app.csv
+
+// The firmware, from main.cpp
+void setup();
+void showMessage(const String &msg, unsigned long duration_ms);
+extern FastLED_NeoMatrix *matrix;
+extern MockEncoderHal encoder1Hal;
+extern uint8_t clockMode;
+
+static CRGB shownLeds[NUMMATRIX];
+static uint16_t ledIndex[NUMMATRIX];
+static SimDisplay display(shownLeds, ledIndex, mw, mh);
+
+struct Options {
+    uint8_t clockMode = CLOCK_MODE_SMOOTH;
+    bool clockSet = false;
+    const char* packPath = nullptr;
+    time_t start = 0;
+    uint32_t durationMs = 3000;
+    uint32_t frameMs = CLOCK_FRAME_MS;
+    uint32_t syncMs = 0;
+    const char* message = nullptr;
+    int turn = 0;
+    const char* ppmDir = nullptr;
+    bool ansi = false;
+    bool realtime = false;
+    bool pacing = false;
+    uint32_t animationFrameMs = 40;
+    uint32_t renderMs = 2;
+    uint32_t stallMs = 0;
+    bool bench = false;
+    BenchmarkOptions benchmark = {20000, nullptr, nullptr, 20};
+};
+
+static uint32_t animationFrameMs;
+
+static uint32_t animationFrameDuration(uint16_t) {
+    return animationFrameMs;
+}
+
+static void usage(const char* name) {
+    printf("Usage: %s [options]\n"
+           "  --clock N          Clock mode 0-%d: digital, ring, bars, analog, smooth (default %d)\n"
+           "  --pack FILE        Flash an animation pack (.pio/animations.bin) and play it instead of the clock\n"
+           "  --time HH:MM:SS    Virtual wall clock at the start (default 10:08:30)\n"
+           "  --seconds S        Virtual seconds to run (default 3)\n"
+           "  --frame-ms MS      Virtual time between frames (default %d)\n"
+           "  --sync-ms MS       Answer SNTP only after MS, the clocks show a placeholder until then\n"
+           "  --message TEXT     Show a fading message over the first second\n"
+           "  --turn N           Turn the left encoder by N detents at the start\n"
+           "  --ppm DIR          Write every frame as DIR/frame_NNNNN.ppm\n"
+           "  --ansi             Print every frame to the terminal in 24-bit colour\n"
+           "  --realtime         Wait for the frame time between printed frames\n"
+           "  --pacing           Play a synthetic animation with every frame drop policy and print the stats\n"
+           "  --animation-ms MS  Frame duration of the synthetic animation (default 40)\n"
+           "  --render-ms MS     Virtual time each frame takes to render (default 2)\n"
+           "  --stall-ms MS      Virtual stall once per second, like a busy network (default 0)\n"
+           "  --bench            Time every rendering stage and print ns and bytes per frame\n"
+           "  --iterations N     Frames per timed batch (default 20000)\n"
+           "  --json FILE        Write the benchmark report as JSON\n"
+           "  --baseline FILE    Compare the fastest batches with an earlier report, exit with 1 when a stage got slower\n"
+           "  --tolerance PCT    Slowdown against the baseline that still passes (default 20)\n",
+           name, CLOCK_MODES - 1, CLOCK_MODE_SMOOTH, CLOCK_FRAME_MS);
+}
+
+static bool parseTime(const char* text, time_t& result) {
+    struct tm t = {};
+    if (sscanf(text, "%d:%d:%d", &t.tm_hour, &t.tm_min, &t.tm_sec) != 3) {
+        return false;
+    }
+    t.tm_year = 125;
+    t.tm_mon = 0;
+    t.tm_mday = 1;
+    t.tm_isdst = -1;
+    result = mktime(&t);
+    return result != (time_t)-1;
+}
+
+static bool parseOptions(int argc, char** argv, Options& options) {
+    static const struct option longOptions[] = {
+        {"clock", required_argument, nullptr, 'c'},
+        {"pack", required_argument, nullptr, 'k'},
+        {"time", required_argument, nullptr, 't'},
+        {"seconds", required_argument, nullptr, 's'},
+        {"frame-ms", required_argument, nullptr, 'f'},
+        {"sync-ms", required_argument, nullptr, 'y'},
+        {"message", required_argument, nullptr, 'm'},
+        {"turn", required_argument, nullptr, 'e'},
+        {"ppm", required_argument, nullptr, 'p'},
+        {"ansi", no_argument, nullptr, 'a'},
+        {"realtime", no_argument, nullptr, 'r'},
+        {"pacing", no_argument, nullptr, 'P'},
+        {"animation-ms", required_argument, nullptr, 'A'},
+        {"render-ms", required_argument, nullptr, 'R'},
+        {"stall-ms", required_argument, nullptr, 'S'},
+        {"bench", no_argument, nullptr, 'B'},
+        {"iterations", required_argument, nullptr, 'I'},
+        {"json", required_argument, nullptr, 'J'},
+        {"baseline", required_argument, nullptr, 'L'},
+        {"tolerance", required_argument, nullptr, 'T'},
+        {"help", no_argument, nullptr, 'h'},
+        {nullptr, 0, nullptr, 0},
+    };
+
+    parseTime("10:08:30", options.start);
+    int option;
+    while ((option = getopt_long(argc, argv, "", longOptions, nullptr)) != -1) {
+        switch (option) {
+            case 'c': options.clockMode = atoi(optarg) % CLOCK_MODES; options.clockSet = true; break;
+            case 'k': options.packPath = optarg; break;
+            case 't':
+                if (!parseTime(optarg, options.start)) {
+                    fprintf(stderr, "Invalid time: %s\n", optarg);
+                    return false;
+                }
+                break;
+            case 's': options.durationMs = atof(optarg) * 1000; break;
+            case 'f': options.frameMs = atoi(optarg) > 0 ? atoi(optarg) : 1; break;
+            case 'y': options.syncMs = atoi(optarg); break;
+            case 'm': options.message = optarg; break;
+            case 'e': options.turn = atoi(optarg); break;
+            case 'p': options.ppmDir = optarg; break;
+            case 'a': options.ansi = true; break;
+            case 'r': options.realtime = true; break;
+            case 'P': options.pacing = true; break;
+            case 'A': options.animationFrameMs = atoi(optarg) > 0 ? atoi(optarg) : 1; break;
+            case 'R': options.renderMs = atoi(optarg); break;
+            case 'S': options.stallMs = atoi(optarg); break;
+            case 'B': options.bench = true; break;
+            case 'I': options.benchmark.iterations = atoi(optarg) > 0 ? atoi(optarg) : 1; break;
+            case 'J': options.benchmark.jsonPath = optarg; break;
+            case 'L': options.benchmark.baselinePath = optarg; break;
+            case 'T': options.benchmark.tolerancePercent = atoi(optarg); break;
+            default: return false;
+        }
+    }
+    return true;
+}
+
+// Writes a pack into the first slot of the emulated anims partition, as pio run -t uploadpack does
+static bool flashPack(const char* path) {
+    const esp_partition_t* partition = simAddPartition(ANIMATION_PACK_PARTITION, ANIMATION_PACK_SUBTYPE, SIM_PACK_PARTITION_SIZE);
+    if (path == nullptr) {
+        return true;
+    }
+    FILE* file = fopen(path, "rb");
+    if (file == nullptr) {
+        fprintf(stderr, "Could not read %s\n", path);
+        return false;
+    }
+    size_t size = fread(simPartitionData(partition), 1, SIM_PACK_PARTITION_SIZE / ANIMATION_PACK_SLOTS, file);
+    fclose(file);
+    printf("Flashed %zu bytes of %s\n", size, path);
+    return true;
+}
+
+// Boots the firmware and lets its tasks run in virtual time, dumping what the LEDs show every frame
+static int runFirmware(const Options& options) {
+    if (!flashPack(options.packPath)) {
+        return 1;
+    }
+    // Until SNTP answers the wall clock counts from 1970, as after a power on
+    simSetTime(0);
+    setup();
+    for (uint8_t y = 0; y < mh; y++) {
+        for (uint8_t x = 0; x < mw; x++) {
+            ledIndex[y * mw + x] = matrix->XY(x, y);
+        }
+    }
+
+    // Without a pack the firmware shows the clock anyway
+    if (options.packPath == nullptr || options.clockSet) {
+        sendRenderCommand(CMD_SET_DISPLAY_CLOCK, 1);
+    }
+    sendRenderCommand(CMD_SET_CLOCK_MODE, options.clockMode);
+    if (options.message != nullptr) {
+        showMessage(options.message, 1000);
+    }
+    encoder1Hal.turn(options.turn, 5);
+
+    bool synced = false;
+    uint8_t shownClockMode = options.clockMode;
+    uint32_t frames = 0;
+    for (uint32_t elapsed = 0; elapsed < options.durationMs; elapsed += options.frameMs, frames++) {
+        if (!synced && elapsed >= options.syncMs) {
+            simSntpAnswer(options.start);
+            synced = true;
+            printf("Time synchronized after %u ms\n", elapsed);
+        }
+
+        simRunTasks(options.frameMs);
+        encoder1Hal.advance(options.frameMs);
+        if (clockMode != shownClockMode) {
+            shownClockMode = clockMode;
+            printf("Clock mode changed to: %d\n", clockMode);
+        }
+
+        if (simShownLeds() != nullptr) {
+            memcpy(shownLeds, simShownLeds(), sizeof(shownLeds));
+        }
+        if (options.ppmDir != nullptr) {
+            char path[512];
+            snprintf(path, sizeof(path), "%s/frame_%05u.ppm", options.ppmDir, frames);
+            if (!display.writePpm(path)) {
+                fprintf(stderr, "Could not write %s\n", path);
+                return 1;
+            }
+        }
+        if (options.ansi) {
+            display.printAnsi(stdout, frames > 0);
+            if (options.realtime) {
+                usleep(options.frameMs * 1000);
+            }
+        }
+    }
+    printf("%u frames in %u ms of virtual time, %u sent to the LEDs\n", frames, options.durationMs, simShowCount());
+    return 0;
+}
+
+// Plays a synthetic animation with a fixed render cost and periodic stalls, and prints how each drop
+// policy keeps up. A demo only, test/test_frame_scheduler checks what the policies promise.
+static int runPacing(const Options& options) {
+    static const char* const policyNames[] = {"skip", "catch-up", "resync"};
+    animationFrameMs = options.animationFrameMs;
+
+    printf("policy    frames  dropped  late  max late ms  avg late ms\n");
+    for (uint8_t policy = FRAME_DROP_SKIP; policy <= FRAME_DROP_RESYNC; policy++) {
+        simSetTime(options.start);
+        FrameScheduler scheduler((FrameDropPolicy)policy);
+        uint16_t frame = 0;
+        uint32_t nextStall = 1000;
+        scheduler.start(millis());
+
+        while (millis() < options.durationMs) {
+            if (scheduler.update(millis(), frame, 50, animationFrameDuration)) {
+                simAdvance(options.renderMs);
+            }
+            if (options.stallMs > 0 && millis() >= nextStall) {
+                simAdvance(options.stallMs);
+                nextStall += 1000;
+            }
+            uint32_t wait = scheduler.untilDue(millis());
+            simAdvance(wait > RENDER_POLL_MS ? RENDER_POLL_MS : (wait > 0 ? wait : 0));
+            if (wait == 0 && options.renderMs == 0) {
+                simAdvance(1);
+            }
+        }
+
+        const FrameStats& stats = scheduler.stats();
+        printf("%-8s  %6u  %7u  %4u  %11u  %11.2f\n", policyNames[policy], stats.frames, stats.dropped,
+               stats.lateFrames, stats.maxLateness, stats.frames > 0 ? (double)stats.totalLateness / stats.frames : 0.0);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (options.bench) {
+        return runBenchmarks(options.benchmark);
+    }
+    return options.pacing ? runPacing(options) : runFirmware(options);
+}
+
+#endif // PIO_UNIT_TESTING
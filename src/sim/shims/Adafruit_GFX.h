@@ -0,0 +1,50 @@
+#ifndef ADAFRUIT_GFX_H
+#define ADAFRUIT_GFX_H
+
+// Host stand-in for the Adafruit GFX drawing calls the project uses, with the classic 6x8 text cell.
+// Calls are split into pixels the way the library does it (rectangles into columns of lines, text into
+// glyph bits), each written with one drawPixel() call, so the benchmark times the same work. The glyphs cover digits, upper case letters and the symbols shown in messages; lower case letters are
+// drawn in upper case and anything else as an empty box.
+
+#include <Arduino.h>
+
+class Adafruit_GFX {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h) {}
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { writeLine(x, y, x + w - 1, y, color); }
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { writeLine(x, y, x, y + h - 1, color); }
+    void drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h);
+
+    void setCursor(int16_t x, int16_t y) { cursor_x = x; cursor_y = y; }
+    void setTextColor(uint16_t c) { textcolor = c; }
+    void setTextSize(uint8_t s) { textsize = s > 0 ? s : 1; }
+    void setTextWrap(bool w) { wrap = w; }
+    int16_t getCursorX() const { return cursor_x; }
+    int16_t getCursorY() const { return cursor_y; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+    void drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size);
+    size_t write(uint8_t c);
+    size_t print(const char *s);
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write(c); }
+    size_t print(int value) { return print(String(value)); }
+
+protected:
+    void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+
+    const int16_t WIDTH, HEIGHT;
+    int16_t _width, _height;
+    int16_t cursor_x = 0, cursor_y = 0;
+    uint16_t textcolor = 0xFFFF;
+    uint8_t textsize = 1;
+    bool wrap = true;
+};
+
+#endif // ADAFRUIT_GFX_H
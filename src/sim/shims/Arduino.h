@@ -0,0 +1,128 @@
+#ifndef ARDUINO_H
+#define ARDUINO_H
+
+// Host stand-in for the parts of the Arduino core the firmware uses. Time is virtual: millis(),
+// gettimeofday() and getLocalTime() only move when the simulator advances the clock or every task waits.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <sys/time.h>
+#include <time.h>
+
+#include "freertos/FreeRTOS.h"
+
+#define HIGH 1
+#define LOW 0
+#define PROGMEM
+#define F(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t *)(addr))
+#define PI 3.1415926535897932384626433832795
+
+using std::max;
+using std::min;
+
+// --- Virtual clock ---
+// Sets the wall clock and restarts millis() from 0
+void simSetTime(time_t epoch);
+void simAdvance(uint32_t ms);
+void simAdvanceMicros(uint64_t us);
+// Virtual time since simSetTime(), without the wrap of micros()
+uint64_t simMicros64();
+// Sets the wall clock without touching millis(), like an SNTP answer
+void simSyncTime(time_t epoch);
+uint32_t millis();
+uint32_t micros();
+// Waits like on the device, other tasks run meanwhile
+void delay(uint32_t ms);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+// gettimeofday() itself is replaced at link time (see Shims.cpp), so the libraries read the virtual wall clock
+
+// SNTP is started by configTime() and answered by simSntpAnswer() in esp_sntp.h. The offsets are not
+// applied, the simulation runs in the time zone of the host.
+void configTime(long gmtOffset_sec, int daylightOffset_sec, const char *server1, const char *server2 = nullptr,
+                const char *server3 = nullptr);
+
+template <typename T> static inline T constrain(T value, T low, T high) {
+    return value < low ? low : (value > high ? high : value);
+}
+
+static inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+    return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+class String {
+public:
+    String(const char *s = "") : _s(s) {}
+    String(const std::string &s) : _s(s) {}
+    explicit String(char c) : _s(1, c) {}
+    explicit String(int value) : _s(std::to_string(value)) {}
+    explicit String(unsigned int value) : _s(std::to_string(value)) {}
+    explicit String(long value) : _s(std::to_string(value)) {}
+    explicit String(unsigned long value) : _s(std::to_string(value)) {}
+    const char *c_str() const { return _s.c_str(); }
+    unsigned int length() const { return _s.length(); }
+    bool operator==(const char *s) const { return _s == s; }
+    bool operator==(const String &s) const { return _s == s._s; }
+    String operator+(const String &s) const { return String(_s + s._s); }
+    String &operator+=(const String &s) { _s += s._s; return *this; }
+    String &operator+=(const char *s) { _s += s; return *this; }
+    String &operator+=(char c) { _s += c; return *this; }
+
+private:
+    std::string _s;
+};
+
+static inline String operator+(const char *lhs, const String &rhs) {
+    return String(lhs) + rhs;
+}
+
+class Print {
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size) {
+        size_t n = 0;
+        while (size--) {
+            n += write(*buffer++);
+        }
+        return n;
+    }
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(const String &s) { return print(s.c_str()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(long value) { return print(String(value)); }
+    size_t println(const char *s = "") { return print(s) + print('\n'); }
+    size_t println(const String &s) { return println(s.c_str()); }
+    size_t println(long value) { return print(value) + print('\n'); }
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+// Writes to stdout. Nothing is ever received.
+class HardwareSerial : public Print {
+public:
+    void begin(unsigned long) {}
+    size_t write(uint8_t c) override { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buffer, size_t size) override { return fwrite(buffer, 1, size, stdout); }
+    int available() { return 0; }
+    int read() { return -1; }
+};
+
+extern HardwareSerial Serial;
+
+// The cycle counter runs at the CPU clock on the virtual time
+class EspClass {
+public:
+    uint32_t getCycleCount() { return simMicros64() * getCpuFreqMHz(); }
+    uint32_t getCpuFreqMHz() { return 240; }
+};
+
+extern EspClass ESP;
+
+#endif // ARDUINO_H
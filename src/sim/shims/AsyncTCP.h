@@ -0,0 +1,6 @@
+#ifndef ASYNCTCP_H
+#define ASYNCTCP_H
+
+// Host stand-in: the web server is not simulated, see ESPAsyncWebServer.h
+
+#endif // ASYNCTCP_H
@@ -0,0 +1,15 @@
+#ifndef ESPASYNCWEBSERVER_H
+#define ESPASYNCWEBSERVER_H
+
+// Host stand-in: only the server object exists. Web.cpp is not built for the host, the simulator
+// provides an empty setupWebServer() instead.
+
+#include <Arduino.h>
+
+class AsyncWebServer {
+public:
+    explicit AsyncWebServer(uint16_t) {}
+    void begin() {}
+};
+
+#endif // ESPASYNCWEBSERVER_H
@@ -0,0 +1,119 @@
+#ifndef FASTLED_H
+#define FASTLED_H
+
+// Host stand-in for the FastLED types and math the libraries use. The 8-bit math matches FastLED;
+// sin16/cos16 are exact rather than FastLED's piecewise approximation.
+
+#include <Arduino.h>
+
+typedef uint8_t fract8;
+
+static inline uint8_t scale8(uint8_t i, fract8 scale) {
+    return ((uint16_t)i * (1 + (uint16_t)scale)) >> 8;
+}
+
+static inline uint8_t qadd8(uint8_t i, uint8_t j) {
+    uint16_t t = i + j;
+    return t > 255 ? 255 : t;
+}
+
+static inline int16_t sin16(uint16_t theta) {
+    return (int16_t)lrint(sin(theta * (2 * M_PI / 65536)) * 32767);
+}
+
+static inline int16_t cos16(uint16_t theta) {
+    return sin16(theta + 16384);
+}
+
+struct CRGB {
+    union {
+        struct {
+            uint8_t r;
+            uint8_t g;
+            uint8_t b;
+        };
+        uint8_t raw[3];
+    };
+
+    CRGB() = default;
+    CRGB(uint8_t ir, uint8_t ig, uint8_t ib) : r(ir), g(ig), b(ib) {}
+    CRGB(uint32_t colorcode) : r((colorcode >> 16) & 0xFF), g((colorcode >> 8) & 0xFF), b(colorcode & 0xFF) {}
+
+    uint8_t &operator[](uint8_t x) { return raw[x]; }
+    const uint8_t &operator[](uint8_t x) const { return raw[x]; }
+
+    CRGB &operator+=(const CRGB &rhs) {
+        r = qadd8(r, rhs.r);
+        g = qadd8(g, rhs.g);
+        b = qadd8(b, rhs.b);
+        return *this;
+    }
+
+    CRGB &nscale8(uint8_t scaledown) {
+        r = scale8(r, scaledown);
+        g = scale8(g, scaledown);
+        b = scale8(b, scaledown);
+        return *this;
+    }
+
+    enum HTMLColorCode : uint32_t { Black = 0x000000, White = 0xFFFFFF };
+};
+
+static inline bool operator==(const CRGB &lhs, const CRGB &rhs) {
+    return lhs.r == rhs.r && lhs.g == rhs.g && lhs.b == rhs.b;
+}
+
+static inline bool operator!=(const CRGB &lhs, const CRGB &rhs) {
+    return !(lhs == rhs);
+}
+
+static inline CRGB blend(const CRGB &p1, const CRGB &p2, fract8 amountOfP2) {
+    CRGB result = p1;
+    for (uint8_t i = 0; i < 3; i++) {
+        result.raw[i] = scale8(p1.raw[i], 255 - amountOfP2) + scale8(p2.raw[i], amountOfP2);
+    }
+    return result;
+}
+
+// One strip, as the chipset driver sees it
+class CLEDController {
+public:
+    void setLeds(CRGB *leds, int count) {
+        _leds = leds;
+        _count = count;
+    }
+    CRGB *leds() const { return _leds; }
+    int size() const { return _count; }
+
+private:
+    CRGB *_leds = nullptr;
+    int _count = 0;
+};
+
+template <uint8_t DATA_PIN> class NEOPIXEL {};
+
+class CFastLED {
+public:
+    template <template <uint8_t> class CHIPSET, uint8_t DATA_PIN> CLEDController &addLeds(CRGB *leds, int count) {
+        _controller.setLeds(leds, count);
+        return _controller;
+    }
+    void setBrightness(uint8_t scale) { _brightness = scale; }
+    uint8_t getBrightness() const { return _brightness; }
+    // Keeps a copy of what goes out on the wire, see simShownLeds()
+    void show();
+
+private:
+    CLEDController _controller;
+    uint8_t _brightness = 255;
+};
+
+extern CFastLED FastLED;
+
+// --- Simulation ---
+// The LEDs as sent by the last show(), before brightness scaling. nullptr before the first show().
+const CRGB *simShownLeds();
+uint32_t simShowCount();
+uint8_t simShownBrightness();
+
+#endif // FASTLED_H
@@ -0,0 +1,42 @@
+#ifndef FASTLED_NEOMATRIX_H
+#define FASTLED_NEOMATRIX_H
+
+// Host stand-in for FastLED_NeoMatrix: a single matrix (no tiles) with the same layout flags, drawing
+// RGB565 colors into a CRGB buffer without the gamma tables of the real one.
+
+#include <Adafruit_GFX.h>
+#include <FastLED.h>
+
+#define NEO_MATRIX_TOP 0x00
+#define NEO_MATRIX_BOTTOM 0x01
+#define NEO_MATRIX_LEFT 0x00
+#define NEO_MATRIX_RIGHT 0x02
+#define NEO_MATRIX_CORNER 0x03
+#define NEO_MATRIX_ROWS 0x00
+#define NEO_MATRIX_COLUMNS 0x04
+#define NEO_MATRIX_AXIS 0x04
+#define NEO_MATRIX_PROGRESSIVE 0x00
+#define NEO_MATRIX_ZIGZAG 0x08
+#define NEO_MATRIX_SEQUENCE 0x08
+
+class FastLED_NeoMatrix : public Adafruit_GFX {
+public:
+    FastLED_NeoMatrix(CRGB *leds, uint8_t w, uint8_t h, uint8_t matrixType)
+        : Adafruit_GFX(w, h), _leds(leds), _type(matrixType) {}
+
+    void begin() {}
+    void show() { FastLED.show(); }
+    void setBrightness(uint8_t b) { FastLED.setBrightness(b); }
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override;
+    uint16_t XY(int16_t x, int16_t y) const;
+
+    static uint16_t Color(uint8_t r, uint8_t g, uint8_t b) {
+        return ((uint16_t)(r & 0xF8) << 8) | ((uint16_t)(g & 0xFC) << 3) | (b >> 3);
+    }
+
+private:
+    CRGB *_leds;
+    uint8_t _type;
+};
+
+#endif // FASTLED_NEOMATRIX_H
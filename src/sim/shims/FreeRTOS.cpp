@@ -0,0 +1,214 @@
+#include <Arduino.h>
+#include <ucontext.h>
+
+#include <deque>
+#include <functional>
+#include <string>
+#include <vector>
+
+#define SIM_TASK_STACK (256 * 1024) // Host code needs more stack than the device, sizes are not simulated
+
+struct SimTask {
+    std::string name;
+    TaskFunction_t function;
+    void *parameter;
+    UBaseType_t priority;
+    BaseType_t core;
+    ucontext_t context = {};
+    std::vector<uint8_t> stack = {};
+    std::function<bool()> ready = {}; // What the task waits for, empty while it can run
+    uint64_t wakeMicros = 0;          // When the wait times out, UINT64_MAX for never
+    uint32_t notifications = 0;
+    bool deleted = false;
+};
+
+struct SimQueue {
+    UBaseType_t length;
+    UBaseType_t itemSize;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+// The Arduino core runs setup() and loop() in a task on core 1
+static SimTask loopTask = {"loopTask", nullptr, nullptr, 1, 1};
+static std::vector<SimTask *> tasks = {&loopTask};
+static SimTask *current = &loopTask;
+static size_t lastPicked = 0;
+
+static bool runnable(const SimTask *task) {
+    return !task->deleted && (!task->ready || task->ready() || simMicros64() >= task->wakeMicros);
+}
+
+// Switches to the task that goes on next and returns once the current task is picked again
+static void schedule() {
+    for (;;) {
+        // Highest priority first, tasks of the same priority take turns
+        SimTask *next = nullptr;
+        size_t nextIndex = 0;
+        for (size_t n = 1; n <= tasks.size(); n++) {
+            size_t i = (lastPicked + n) % tasks.size();
+            if (runnable(tasks[i]) && (next == nullptr || tasks[i]->priority > next->priority)) {
+                next = tasks[i];
+                nextIndex = i;
+            }
+        }
+        if (next != nullptr) {
+            lastPicked = nextIndex;
+            if (next != current) {
+                SimTask *previous = current;
+                current = next;
+                swapcontext(&previous->context, &next->context);
+            }
+            return;
+        }
+
+        uint64_t wake = UINT64_MAX;
+        for (const SimTask *task : tasks) {
+            if (!task->deleted && task->wakeMicros < wake) {
+                wake = task->wakeMicros;
+            }
+        }
+        if (wake == UINT64_MAX) {
+            fprintf(stderr, "Every task waits forever, the simulation is deadlocked\n");
+            abort();
+        }
+        simAdvanceMicros(wake - simMicros64());
+    }
+}
+
+// Blocks the current task until ready() holds or ticks have passed. Returns whether ready() holds.
+static bool block(const std::function<bool()> &ready, TickType_t ticks) {
+    if (ready()) {
+        return true;
+    }
+    if (ticks == 0) {
+        return false;
+    }
+    current->ready = ready;
+    current->wakeMicros = ticks == portMAX_DELAY ? UINT64_MAX : simMicros64() + (uint64_t)ticks * portTICK_PERIOD_MS * 1000;
+    schedule();
+    current->ready = nullptr;
+    current->wakeMicros = 0;
+    return ready();
+}
+
+static void taskEntry() {
+    current->function(current->parameter);
+    // A task function may not return on FreeRTOS, treat it as deleting itself
+    vTaskDelete(nullptr);
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core) {
+    SimTask *task = new SimTask{name, function, parameter, priority, core};
+    task->stack.resize(SIM_TASK_STACK);
+    getcontext(&task->context);
+    task->context.uc_stack.ss_sp = task->stack.data();
+    task->context.uc_stack.ss_size = task->stack.size();
+    task->context.uc_link = nullptr;
+    makecontext(&task->context, taskEntry, 0);
+    tasks.push_back(task);
+    if (handle != nullptr) {
+        *handle = task;
+    }
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task) {
+    SimTask *target = task != nullptr ? task : current;
+    target->deleted = true;
+    if (target == current) {
+        schedule(); // Never returns, nothing picks a deleted task
+    }
+}
+
+void vTaskDelay(TickType_t ticks) {
+    block([]() { return false; }, ticks);
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    task->notifications++;
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks) {
+    SimTask *self = current;
+    if (!block([self]() { return self->notifications > 0; }, ticks)) {
+        return 0;
+    }
+    uint32_t value = self->notifications;
+    self->notifications = clearOnExit ? 0 : value - 1;
+    return value;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) {
+    return SIM_TASK_STACK;
+}
+
+BaseType_t xPortGetCoreID() {
+    return current->core;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+    return new SimQueue{length, itemSize, {}};
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks) {
+    if (!block([queue]() { return queue->items.size() < queue->length; }, ticks)) {
+        return pdFAIL;
+    }
+    queue->items.emplace_back((const uint8_t *)item, (const uint8_t *)item + queue->itemSize);
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks) {
+    if (xQueuePeek(queue, item, ticks) != pdTRUE) {
+        return pdFALSE;
+    }
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks) {
+    if (!block([queue]() { return !queue->items.empty(); }, ticks)) {
+        return pdFALSE;
+    }
+    if (queue->itemSize > 0) {
+        memcpy(item, queue->items.front().data(), queue->itemSize);
+    }
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue->items.size();
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary() {
+    return xQueueCreate(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+    SemaphoreHandle_t mutex = xQueueCreate(1, 0);
+    xSemaphoreGive(mutex);
+    return mutex;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks) {
+    return xQueueReceive(semaphore, nullptr, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+    return xQueueSend(semaphore, nullptr, 0);
+}
+
+void simRunTasks(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+TaskHandle_t simFindTask(const char *name) {
+    for (SimTask *task : tasks) {
+        if (!task->deleted && task->name == name) {
+            return task;
+        }
+    }
+    return nullptr;
+}
@@ -0,0 +1,45 @@
+#include <WiFiManager.h>
+#include <esp_sntp.h>
+
+// --- WiFi ---
+
+WiFiClass WiFi;
+static uint32_t connectTime = 0;
+
+void simSetConnectTime(uint32_t ms) {
+    connectTime = ms;
+}
+
+bool WiFiManager::autoConnect(const char *) {
+    delay(connectTime);
+    WiFi.simSetStatus(WL_CONNECTED);
+    return true;
+}
+
+// --- SNTP ---
+
+static bool sntpStarted = false;
+static sntp_sync_time_cb_t syncCallback = nullptr;
+
+void configTime(long, int, const char *, const char *, const char *) {
+    sntpStarted = true;
+}
+
+void sntp_set_sync_mode(sntp_sync_mode_t) {}
+
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    syncCallback = callback;
+}
+
+bool simSntpAnswer(time_t epoch) {
+    if (!sntpStarted) {
+        return false;
+    }
+    simSyncTime(epoch);
+    if (syncCallback != nullptr) {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        syncCallback(&tv);
+    }
+    return true;
+}
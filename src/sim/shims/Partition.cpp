@@ -0,0 +1,127 @@
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <string.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// --- Partitions ---
+
+struct SimPartition {
+    esp_partition_t info;
+    std::vector<uint8_t> data;
+};
+
+static std::map<std::string, std::unique_ptr<SimPartition>> partitions;
+static uint32_t nextAddress = 0x110000;
+static uint32_t mappedCount = 0;
+static spi_flash_mmap_handle_t nextHandle = 0;
+
+static SimPartition* find(const esp_partition_t* partition) {
+    auto it = partition != nullptr ? partitions.find(partition->label) : partitions.end();
+    return it != partitions.end() && &it->second->info == partition ? it->second.get() : nullptr;
+}
+
+// Like the real API, offset and size are checked without adding them, so neither can wrap
+static bool inRange(const SimPartition* p, size_t offset, size_t size) {
+    return p != nullptr && offset <= p->data.size() && size <= p->data.size() - offset;
+}
+
+const esp_partition_t* simAddPartition(const char* label, esp_partition_subtype_t subtype, uint32_t size) {
+    std::unique_ptr<SimPartition>& p = partitions[label];
+    if (!p) {
+        p.reset(new SimPartition());
+        p->info.type = ESP_PARTITION_TYPE_DATA;
+        p->info.address = nextAddress;
+        strncpy(p->info.label, label, sizeof(p->info.label) - 1);
+        nextAddress += size;
+    }
+    p->info.subtype = subtype;
+    p->info.size = size;
+    p->data.assign(size, 0xFF);
+    return &p->info;
+}
+
+uint8_t* simPartitionData(const esp_partition_t* partition) {
+    SimPartition* p = find(partition);
+    return p != nullptr ? p->data.data() : nullptr;
+}
+
+uint32_t simMappedCount() {
+    return mappedCount;
+}
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label) {
+    for (auto& entry : partitions) {
+        const esp_partition_t& info = entry.second->info;
+        if (info.type == type && (subtype == ESP_PARTITION_SUBTYPE_ANY || info.subtype == subtype)
+            && (label == nullptr || strcmp(info.label, label) == 0)) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size) {
+    SimPartition* p = find(partition);
+    if (!inRange(p, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memcpy(dst, p->data.data() + offset, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* src, size_t size) {
+    SimPartition* p = find(partition);
+    if (!inRange(p, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    // Programming only clears bits, writing over data that was not erased corrupts it as on the chip
+    for (size_t i = 0; i < size; i++) {
+        p->data[offset + i] &= ((const uint8_t*)src)[i];
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size) {
+    SimPartition* p = find(partition);
+    if (offset % SPI_FLASH_SEC_SIZE != 0 || size % SPI_FLASH_SEC_SIZE != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!inRange(p, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    memset(p->data.data() + offset, 0xFF, size);
+    return ESP_OK;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size, esp_partition_mmap_memory_t,
+                             const void** out_ptr, spi_flash_mmap_handle_t* out_handle) {
+    SimPartition* p = find(partition);
+    if (!inRange(p, offset, size)) {
+        return ESP_ERR_INVALID_SIZE;
+    }
+    *out_ptr = p->data.data() + offset;
+    *out_handle = ++nextHandle;
+    mappedCount++;
+    return ESP_OK;
+}
+
+void spi_flash_munmap(spi_flash_mmap_handle_t) {
+    mappedCount--;
+}
+
+// --- ROM CRC ---
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len) {
+    crc = ~crc;
+    while (len--) {
+        crc ^= *buf++;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
@@ -0,0 +1,281 @@
+#include <Arduino.h>
+#include <FastLED.h>
+#include <FastLED_NeoMatrix.h>
+#include <stdarg.h>
+
+#include <utility>
+#include <vector>
+
+HardwareSerial Serial;
+EspClass ESP;
+CFastLED FastLED;
+
+// --- Virtual clock ---
+
+static time_t simEpoch = 0;   // Wall clock at millis() == 0
+static uint64_t simMicros = 0;
+
+void simSetTime(time_t epoch) {
+    simEpoch = epoch;
+    simMicros = 0;
+}
+
+void simAdvance(uint32_t ms) {
+    simMicros += (uint64_t)ms * 1000;
+}
+
+void simAdvanceMicros(uint64_t us) {
+    simMicros += us;
+}
+
+uint64_t simMicros64() {
+    return simMicros;
+}
+
+uint32_t millis() {
+    return simMicros / 1000;
+}
+
+uint32_t micros() {
+    return simMicros;
+}
+
+void delay(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+// Replaces the C library's gettimeofday() at link time, so code reading the wall clock (ClockTime, the
+// clocks) gets the virtual one without being built differently for the host
+extern "C" int gettimeofday(struct timeval *tv, void *) noexcept {
+    tv->tv_sec = simEpoch + simMicros / 1000000;
+    tv->tv_usec = simMicros % 1000000;
+    return 0;
+}
+
+void simSyncTime(time_t epoch) {
+    simEpoch = epoch - simMicros / 1000000;
+}
+
+// Like the Arduino core, a wall clock before 2016 counts as not set
+bool getLocalTime(struct tm *info, uint32_t) {
+    time_t now = simEpoch + simMicros / 1000000;
+    localtime_r(&now, info);
+    return info->tm_year > 2016 - 1900;
+}
+
+size_t Print::printf(const char *format, ...) {
+    va_list args;
+    va_start(args, format);
+    char buffer[256];
+    int length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) {
+        return 0;
+    }
+    if ((size_t)length < sizeof(buffer)) {
+        return write((const uint8_t *)buffer, length);
+    }
+    std::string text(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&text[0], text.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)text.data(), length);
+}
+
+// --- FastLED ---
+
+static std::vector<CRGB> shownLeds;
+static uint32_t showCount = 0;
+static uint8_t shownBrightness = 0;
+
+void CFastLED::show() {
+    shownLeds.assign(_controller.leds(), _controller.leds() + _controller.size());
+    shownBrightness = _brightness;
+    showCount++;
+}
+
+const CRGB *simShownLeds() {
+    return showCount > 0 ? shownLeds.data() : nullptr;
+}
+
+uint32_t simShowCount() {
+    return showCount;
+}
+
+uint8_t simShownBrightness() {
+    return shownBrightness;
+}
+
+// --- Adafruit GFX ---
+
+// 5x7 glyphs in 5 columns, least significant bit at the top
+struct Glyph {
+    char c;
+    uint8_t columns[5];
+};
+
+static const Glyph font[] = {
+    {' ', {0x00, 0x00, 0x00, 0x00, 0x00}}, {'!', {0x00, 0x00, 0x5F, 0x00, 0x00}},
+    {'%', {0x23, 0x13, 0x08, 0x64, 0x62}}, {'+', {0x08, 0x08, 0x3E, 0x08, 0x08}},
+    {'-', {0x08, 0x08, 0x08, 0x08, 0x08}}, {'.', {0x00, 0x60, 0x60, 0x00, 0x00}},
+    {'/', {0x20, 0x10, 0x08, 0x04, 0x02}}, {'0', {0x3E, 0x51, 0x49, 0x45, 0x3E}},
+    {'1', {0x00, 0x42, 0x7F, 0x40, 0x00}}, {'2', {0x42, 0x61, 0x51, 0x49, 0x46}},
+    {'3', {0x21, 0x41, 0x45, 0x4B, 0x31}}, {'4', {0x18, 0x14, 0x12, 0x7F, 0x10}},
+    {'5', {0x27, 0x45, 0x45, 0x45, 0x39}}, {'6', {0x3C, 0x4A, 0x49, 0x49, 0x30}},
+    {'7', {0x01, 0x71, 0x09, 0x05, 0x03}}, {'8', {0x36, 0x49, 0x49, 0x49, 0x36}},
+    {'9', {0x06, 0x49, 0x49, 0x29, 0x1E}}, {':', {0x00, 0x36, 0x36, 0x00, 0x00}},
+    {'<', {0x08, 0x14, 0x22, 0x41, 0x00}}, {'=', {0x14, 0x14, 0x14, 0x14, 0x14}},
+    {'>', {0x00, 0x41, 0x22, 0x14, 0x08}}, {'?', {0x02, 0x01, 0x51, 0x09, 0x06}},
+    {'A', {0x7E, 0x11, 0x11, 0x11, 0x7E}}, {'B', {0x7F, 0x49, 0x49, 0x49, 0x36}},
+    {'C', {0x3E, 0x41, 0x41, 0x41, 0x22}}, {'D', {0x7F, 0x41, 0x41, 0x22, 0x1C}},
+    {'E', {0x7F, 0x49, 0x49, 0x49, 0x41}}, {'F', {0x7F, 0x09, 0x09, 0x09, 0x01}},
+    {'G', {0x3E, 0x41, 0x49, 0x49, 0x7A}}, {'H', {0x7F, 0x08, 0x08, 0x08, 0x7F}},
+    {'I', {0x00, 0x41, 0x7F, 0x41, 0x00}}, {'J', {0x20, 0x40, 0x41, 0x3F, 0x01}},
+    {'K', {0x7F, 0x08, 0x14, 0x22, 0x41}}, {'L', {0x7F, 0x40, 0x40, 0x40, 0x40}},
+    {'M', {0x7F, 0x02, 0x0C, 0x02, 0x7F}}, {'N', {0x7F, 0x04, 0x08, 0x10, 0x7F}},
+    {'O', {0x3E, 0x41, 0x41, 0x41, 0x3E}}, {'P', {0x7F, 0x09, 0x09, 0x09, 0x06}},
+    {'Q', {0x3E, 0x41, 0x51, 0x21, 0x5E}}, {'R', {0x7F, 0x09, 0x19, 0x29, 0x46}},
+    {'S', {0x46, 0x49, 0x49, 0x49, 0x31}}, {'T', {0x01, 0x01, 0x7F, 0x01, 0x01}},
+    {'U', {0x3F, 0x40, 0x40, 0x40, 0x3F}}, {'V', {0x1F, 0x20, 0x40, 0x20, 0x1F}},
+    {'W', {0x3F, 0x40, 0x38, 0x40, 0x3F}}, {'X', {0x63, 0x14, 0x08, 0x14, 0x63}},
+    {'Y', {0x07, 0x08, 0x70, 0x08, 0x07}}, {'Z', {0x61, 0x51, 0x49, 0x45, 0x43}},
+};
+
+static const uint8_t unknownGlyph[5] = {0x7F, 0x41, 0x41, 0x41, 0x7F};
+
+// Indexed by character like the library's font table, built on first use
+static const uint8_t *glyph(unsigned char c) {
+    static const uint8_t *glyphs[256];
+    if (glyphs[0] == nullptr) {
+        for (uint16_t i = 0; i < 256; i++) {
+            glyphs[i] = unknownGlyph;
+        }
+        for (const Glyph &g : font) {
+            glyphs[(uint8_t)g.c] = g.columns;
+            if (g.c >= 'A' && g.c <= 'Z') {
+                glyphs[(uint8_t)(g.c + 'a' - 'A')] = g.columns;
+            }
+        }
+    }
+    return glyphs[c];
+}
+
+// Bresenham line, one drawPixel() per point
+void Adafruit_GFX::writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+    bool steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+        std::swap(x0, y0);
+        std::swap(x1, y1);
+    }
+    if (x0 > x1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+    }
+    int16_t dx = x1 - x0;
+    int16_t dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    for (; x0 <= x1; x0++) {
+        if (steep) {
+            drawPixel(y0, x0, color);
+        } else {
+            drawPixel(x0, y0, color);
+        }
+        err -= dy;
+        if (err < 0) {
+            y0 += ystep;
+            err += dx;
+        }
+    }
+}
+
+void Adafruit_GFX::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (h <= 0) {
+        return;
+    }
+    for (int16_t i = x; i < x + w; i++) {
+        drawFastVLine(i, y, h, color);
+    }
+}
+
+void Adafruit_GFX::drawRGBBitmap(int16_t x, int16_t y, const uint16_t bitmap[], int16_t w, int16_t h) {
+    for (int16_t j = 0; j < h; j++) {
+        for (int16_t i = 0; i < w; i++) {
+            drawPixel(x + i, y + j, pgm_read_word(&bitmap[j * w + i]));
+        }
+    }
+}
+
+void Adafruit_GFX::drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color, uint8_t size) {
+    const uint8_t *columns = glyph(c);
+    for (int8_t i = 0; i < 5; i++) {
+        uint8_t line = columns[i];
+        for (int8_t j = 0; j < 8; j++, line >>= 1) {
+            if (!(line & 1)) {
+                continue;
+            }
+            if (size == 1) {
+                drawPixel(x + i, y + j, color);
+            } else {
+                fillRect(x + i * size, y + j * size, size, size, color);
+            }
+        }
+    }
+}
+
+size_t Adafruit_GFX::write(uint8_t c) {
+    if (c == '\n') {
+        cursor_x = 0;
+        cursor_y += textsize * 8;
+    } else if (c != '\r') {
+        if (wrap && cursor_x + textsize * 6 > _width) {
+            cursor_x = 0;
+            cursor_y += textsize * 8;
+        }
+        drawChar(cursor_x, cursor_y, c, textcolor, textsize);
+        cursor_x += textsize * 6;
+    }
+    return 1;
+}
+
+size_t Adafruit_GFX::print(const char *s) {
+    size_t n = 0;
+    while (*s) {
+        n += write(*s++);
+    }
+    return n;
+}
+
+// --- FastLED_NeoMatrix ---
+
+uint16_t FastLED_NeoMatrix::XY(int16_t x, int16_t y) const {
+    if (_type & NEO_MATRIX_RIGHT) {
+        x = _width - 1 - x;
+    }
+    if (_type & NEO_MATRIX_BOTTOM) {
+        y = _height - 1 - y;
+    }
+
+    uint16_t major, minor, majorScale;
+    if (_type & NEO_MATRIX_COLUMNS) {
+        major = x;
+        minor = y;
+        majorScale = _height;
+    } else {
+        major = y;
+        minor = x;
+        majorScale = _width;
+    }
+    if ((_type & NEO_MATRIX_SEQUENCE) == NEO_MATRIX_ZIGZAG && (major & 1)) {
+        minor = majorScale - 1 - minor;
+    }
+    return major * majorScale + minor;
+}
+
+void FastLED_NeoMatrix::drawPixel(int16_t x, int16_t y, uint16_t color) {
+    if (x < 0 || y < 0 || x >= _width || y >= _height) {
+        return;
+    }
+    uint8_t r = (color >> 11) & 0x1F, g = (color >> 5) & 0x3F, b = color & 0x1F;
+    _leds[XY(x, y)] = CRGB(r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2);
+}
@@ -0,0 +1,38 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+// Host stand-in for the WiFi station. There is no network, WiFiManager only pretends to connect.
+
+#include <Arduino.h>
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3,
+} wifi_mode_t;
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_CONNECTED = 3,
+    WL_DISCONNECTED = 6,
+} wl_status_t;
+
+class WiFiClass {
+public:
+    bool mode(wifi_mode_t mode) {
+        _mode = mode;
+        return true;
+    }
+    wifi_mode_t getMode() const { return _mode; }
+    wl_status_t status() const { return _status; }
+    void simSetStatus(wl_status_t status) { _status = status; }
+
+private:
+    wifi_mode_t _mode = WIFI_OFF;
+    wl_status_t _status = WL_DISCONNECTED;
+};
+
+extern WiFiClass WiFi;
+
+#endif // WIFI_H
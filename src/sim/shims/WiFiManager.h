@@ -0,0 +1,27 @@
+#ifndef WIFIMANAGER_H
+#define WIFIMANAGER_H
+
+// Host stand-in for WiFiManager. autoConnect() takes simSetConnectTime() of virtual time and connects.
+
+#include <WiFi.h>
+
+class WiFiManager {
+public:
+    void resetSettings() {}
+    void setConfigPortalBlocking(bool blocking) { _blocking = blocking; }
+    void setConfigPortalTimeout(unsigned long seconds) { _portalTimeout = seconds; }
+    void setConnectTimeout(unsigned long seconds) { _connectTimeout = seconds; }
+    bool autoConnect(const char *apName);
+    bool process() { return WiFi.status() == WL_CONNECTED; }
+
+private:
+    bool _blocking = true;
+    unsigned long _portalTimeout = 0;
+    unsigned long _connectTimeout = 0;
+};
+
+// --- Simulation ---
+// How long autoConnect() waits before the station is connected (default 0)
+void simSetConnectTime(uint32_t ms);
+
+#endif // WIFIMANAGER_H
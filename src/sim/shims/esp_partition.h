@@ -0,0 +1,61 @@
+#ifndef ESP_PARTITION_H
+#define ESP_PARTITION_H
+
+// Host stand-in for the ESP-IDF partition API. Partitions live in RAM and behave like NOR flash: erased
+// bytes read 0xFF, writes can only clear bits and erases work on whole sectors.
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define ESP_IDF_VERSION_MAJOR 5
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_SIZE 0x104
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+typedef enum {
+    ESP_PARTITION_TYPE_APP = 0x00,
+    ESP_PARTITION_TYPE_DATA = 0x01,
+} esp_partition_type_t;
+
+typedef enum {
+    ESP_PARTITION_SUBTYPE_ANY = 0xff,
+} esp_partition_subtype_t;
+
+typedef enum {
+    ESP_PARTITION_MMAP_DATA,
+    ESP_PARTITION_MMAP_INST,
+} esp_partition_mmap_memory_t;
+
+typedef uint32_t spi_flash_mmap_handle_t;
+
+struct esp_partition_t {
+    esp_partition_type_t type;
+    esp_partition_subtype_t subtype;
+    uint32_t address;
+    uint32_t size;
+    char label[17];
+};
+
+const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label);
+esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* dst, size_t size);
+esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* src, size_t size);
+esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size);
+esp_err_t esp_partition_mmap(const esp_partition_t* partition, size_t offset, size_t size, esp_partition_mmap_memory_t memory,
+                             const void** out_ptr, spi_flash_mmap_handle_t* out_handle);
+void spi_flash_munmap(spi_flash_mmap_handle_t handle);
+
+// --- Emulated flash ---
+// Adds an erased data partition of size bytes (a multiple of SPI_FLASH_SEC_SIZE), or erases the existing
+// one with the same label
+const esp_partition_t* simAddPartition(const char* label, esp_partition_subtype_t subtype, uint32_t size);
+// Raw contents, for tests that corrupt or inspect the flash directly
+uint8_t* simPartitionData(const esp_partition_t* partition);
+// Mappings not unmapped yet
+uint32_t simMappedCount();
+
+#endif // ESP_PARTITION_H
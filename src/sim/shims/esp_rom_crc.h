@@ -0,0 +1,10 @@
+#ifndef ESP_ROM_CRC_H
+#define ESP_ROM_CRC_H
+
+// Host stand-in for the ROM CRC routines. esp_rom_crc32_le(0, ...) gives the same CRC-32 as zlib.crc32().
+
+#include <stdint.h>
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len);
+
+#endif // ESP_ROM_CRC_H
@@ -0,0 +1,24 @@
+#ifndef ESP_SNTP_H
+#define ESP_SNTP_H
+
+// Host stand-in for the SNTP client. Nothing is sent, simSntpAnswer() plays the server's answer.
+
+#include <sys/time.h>
+#include <time.h>
+
+typedef enum {
+    SNTP_SYNC_MODE_IMMED,
+    SNTP_SYNC_MODE_SMOOTH,
+} sntp_sync_mode_t;
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval *tv);
+
+void sntp_set_sync_mode(sntp_sync_mode_t mode);
+void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback);
+
+// --- Simulation ---
+// Sets the wall clock to epoch and calls the notification callback, as the lwIP task does on an answer.
+// Returns false, doing nothing, when configTime() has not started SNTP.
+bool simSntpAnswer(time_t epoch);
+
+#endif // ESP_SNTP_H
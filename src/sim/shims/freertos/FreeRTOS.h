@@ -0,0 +1,57 @@
+#ifndef FREERTOS_H
+#define FREERTOS_H
+
+// Host stand-in for the FreeRTOS tasks, queues, semaphores and notifications the firmware uses.
+// Tasks run cooperatively on the virtual clock: a task runs until it blocks, then the highest priority
+// task that can go on takes over. When every task waits, virtual time jumps to the earliest timeout.
+// The code calling setup() counts as the Arduino loop task; created tasks only run while it blocks,
+// for example in simRunTasks().
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void *);
+typedef struct SimTask *TaskHandle_t;
+typedef struct SimQueue *QueueHandle_t;
+// As in FreeRTOS, semaphores are queues of items without data
+typedef QueueHandle_t SemaphoreHandle_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define pdFAIL pdFALSE
+#define pdPASS pdTRUE
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFF)
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char *name, uint32_t stackDepth, void *parameter,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+BaseType_t xPortGetCoreID();
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+BaseType_t xQueuePeek(QueueHandle_t queue, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+SemaphoreHandle_t xSemaphoreCreateBinary();
+SemaphoreHandle_t xSemaphoreCreateMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, TickType_t ticks);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore);
+
+// --- Simulation ---
+// Lets the created tasks run for ms of virtual time while the calling loop task waits
+void simRunTasks(uint32_t ms);
+// Task created with this name and not deleted, nullptr if there is none
+TaskHandle_t simFindTask(const char *name);
+
+#endif // FREERTOS_H
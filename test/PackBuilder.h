@@ -0,0 +1,117 @@
+#ifndef TEST_PACKBUILDER_H
+#define TEST_PACKBUILDER_H
+
+// Builds animation packs in memory for the host tests, laid out like build_pack() in scripts/convert.py
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <esp_rom_crc.h>
+#include "AnimationPack.h"
+
+class PackBuilder {
+public:
+    // Adds an encoded (or native) frame to the shared pool and returns its id
+    uint16_t addFrame(const std::vector<uint8_t>& blob) {
+        _pool.push_back(blob);
+        return _pool.size() - 1;
+    }
+
+    // Palette animations get a palette of 1 << bpp entries, like convert.py pads them
+    void addAnimation(const char* name, uint8_t width, uint8_t height, uint8_t bpp, const std::vector<uint16_t>& frames,
+                      uint16_t duration = 40) {
+        _animations.push_back({name, width, height, bpp, frames, duration});
+    }
+
+    std::vector<uint8_t> build() const {
+        std::vector<uint8_t> data(sizeof(PackHeader) + sizeof(PackAnimation) * _animations.size());
+        std::vector<PackAnimation> records;
+        for (const Entry& anim : _animations) {
+            PackAnimation record = {};
+            strncpy(record.name, anim.name.c_str(), sizeof(record.name) - 1);
+            record.frameCount = anim.frames.size();
+            record.width = anim.width;
+            record.height = anim.height;
+            record.bpp = anim.bpp;
+            record.durationsOffset = data.size();
+            append(data, std::vector<uint16_t>(anim.frames.size(), anim.duration));
+            record.framesOffset = data.size();
+            append(data, anim.frames);
+            if (anim.bpp <= 8) {
+                std::vector<uint16_t> palette(1 << anim.bpp);
+                for (size_t i = 0; i < palette.size(); i++) {
+                    palette[i] = i * 0x0841;
+                }
+                record.paletteSize = palette.size();
+                record.paletteOffset = data.size();
+                append(data, palette);
+            }
+            records.push_back(record);
+        }
+        memcpy(data.data() + sizeof(PackHeader), records.data(), sizeof(PackAnimation) * records.size());
+
+        PackHeader header = {};
+        header.poolOffsetsOffset = data.size();
+        std::vector<uint32_t> offsets;
+        uint32_t position = 0;
+        for (const std::vector<uint8_t>& blob : _pool) {
+            offsets.push_back(position);
+            position += blob.size();
+        }
+        append(data, offsets);
+        header.poolOffset = data.size();
+        for (const std::vector<uint8_t>& blob : _pool) {
+            data.insert(data.end(), blob.begin(), blob.end());
+        }
+        data.resize((data.size() + 3) & ~3);
+
+        memcpy(header.magic, ANIMATION_PACK_MAGIC, sizeof(header.magic));
+        header.version = ANIMATION_PACK_VERSION;
+        header.animationCount = _animations.size();
+        header.poolFrameCount = _pool.size();
+        header.indexOffset = sizeof(PackHeader);
+        header.size = data.size();
+        memcpy(data.data(), &header, sizeof(header));
+        seal(data);
+        return data;
+    }
+
+    static PackHeader* header(std::vector<uint8_t>& pack) {
+        return (PackHeader*)pack.data();
+    }
+
+    static PackAnimation* animation(std::vector<uint8_t>& pack, uint16_t index) {
+        return (PackAnimation*)(pack.data() + header(pack)->indexOffset) + index;
+    }
+
+    static uint32_t* poolOffsets(std::vector<uint8_t>& pack) {
+        return (uint32_t*)(pack.data() + header(pack)->poolOffsetsOffset);
+    }
+
+    // Recomputes the CRC after a test changed the pack, so only the change itself can make it invalid
+    static void seal(std::vector<uint8_t>& pack) {
+        header(pack)->crc32 = esp_rom_crc32_le(0, pack.data() + sizeof(PackHeader), pack.size() - sizeof(PackHeader));
+    }
+
+private:
+    struct Entry {
+        std::string name;
+        uint8_t width;
+        uint8_t height;
+        uint8_t bpp;
+        std::vector<uint16_t> frames;
+        uint16_t duration;
+    };
+
+    template <typename T>
+    static void append(std::vector<uint8_t>& data, const std::vector<T>& values) {
+        const uint8_t* bytes = (const uint8_t*)values.data();
+        data.insert(data.end(), bytes, bytes + values.size() * sizeof(T));
+        data.resize((data.size() + 3) & ~3);
+    }
+
+    std::vector<Entry> _animations;
+    std::vector<std::vector<uint8_t>> _pool;
+};
+
+#endif // TEST_PACKBUILDER_H
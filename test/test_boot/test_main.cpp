@@ -0,0 +1,78 @@
+// Boots the firmware with a slow WiFi connection: the panel has to light up right away, show the time
+// placeholder until SNTP answers and the clock after. Run with: pio test -e native
+#include <unity.h>
+#include <WiFi.h>
+#include <WiFiManager.h>
+#include <FastLED.h>
+#include <esp_sntp.h>
+#include "../src/RenderCommands.h"
+#include "../src/settings.h"
+
+static const uint32_t CONNECT_MS = 10000;
+static const time_t SYNCED_TIME = 1700000000;
+
+// The firmware, from main.cpp
+void setup();
+extern volatile bool timeSynced;
+
+static CRGB placeholder[NUMMATRIX];
+
+static bool anyLit(const CRGB* leds) {
+    for (uint16_t i = 0; i < NUMMATRIX; i++) {
+        if (leds[i].r || leds[i].g || leds[i].b) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_setup_does_not_wait_for_wifi() {
+    simSetTime(0);
+    simSetConnectTime(CONNECT_MS);
+    uint32_t start = millis();
+    setup();
+    TEST_ASSERT_EQUAL(0, millis() - start);
+    TEST_ASSERT_NOT_NULL(simFindTask("render"));
+    TEST_ASSERT_NOT_NULL(simFindTask("network"));
+    TEST_ASSERT_NOT_EQUAL(WL_CONNECTED, WiFi.status());
+}
+
+void test_first_light_within_a_frame() {
+    // Without an animation pack the panel shows NO ANIM
+    simRunTasks(CLOCK_FRAME_MS);
+    TEST_ASSERT_GREATER_THAN(0, simShowCount());
+    TEST_ASSERT_NOT_NULL(simShownLeds());
+    TEST_ASSERT_TRUE(anyLit(simShownLeds()));
+    TEST_ASSERT_NOT_EQUAL(WL_CONNECTED, WiFi.status());
+}
+
+void test_clock_shows_placeholder_until_time_sync() {
+    sendRenderCommand(CMD_SET_DISPLAY_CLOCK, 1);
+    sendRenderCommand(CMD_SET_CLOCK_MODE, 0);
+    simRunTasks(CONNECT_MS);
+    TEST_ASSERT_EQUAL(WL_CONNECTED, WiFi.status());
+    TEST_ASSERT_FALSE(timeSynced);
+    TEST_ASSERT_TRUE(anyLit(simShownLeds()));
+    memcpy(placeholder, simShownLeds(), sizeof(placeholder));
+}
+
+void test_clock_shows_time_after_sync() {
+    uint32_t shown = simShowCount();
+    TEST_ASSERT_TRUE(simSntpAnswer(SYNCED_TIME));
+    TEST_ASSERT_TRUE(timeSynced);
+    simRunTasks(1000);
+    TEST_ASSERT_GREATER_THAN(shown, simShowCount());
+    TEST_ASSERT_TRUE(memcmp(placeholder, simShownLeds(), sizeof(placeholder)) != 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_setup_does_not_wait_for_wifi);
+    RUN_TEST(test_first_light_within_a_frame);
+    RUN_TEST(test_clock_shows_placeholder_until_time_sync);
+    RUN_TEST(test_clock_shows_time_after_sync);
+    return UNITY_END();
+}
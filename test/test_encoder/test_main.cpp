@@ -0,0 +1,200 @@
+// Drives Encoder through MockEncoderHal, with quadrature edges and with a hardware pulse count.
+// Run with: pio test -e native
+#include <unity.h>
+#include "MockEncoderHal.h"
+
+static const unsigned long LONG_PRESS_MS = 1000;
+
+// Collects the events poll() returns right now
+static int pollAll(Encoder& encoder, EncoderEvent* events, int max) {
+    int count = 0;
+    while (count < max && encoder.poll(events[count])) {
+        count++;
+    }
+    return count;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_quadrature_detents() {
+    MockEncoderHal hal;
+    Encoder encoder(hal);
+    encoder.begin();
+    EncoderEvent events[8];
+
+    hal.turn(3);
+    TEST_ASSERT_EQUAL(3, pollAll(encoder, events, 8));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL(ENCODER_STEP, events[i].type);
+        TEST_ASSERT_EQUAL(1, events[i].detents);
+        TEST_ASSERT_EQUAL(1, events[i].delta);
+    }
+
+    hal.turn(-2);
+    TEST_ASSERT_EQUAL(2, pollAll(encoder, events, 8));
+    TEST_ASSERT_EQUAL(-1, events[0].detents);
+    TEST_ASSERT_EQUAL(-1, events[1].detents);
+    TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 8));
+}
+
+void test_hardware_count_detents() {
+    MockEncoderHal hal(true);
+    Encoder encoder(hal);
+    encoder.begin();
+    EncoderEvent events[8];
+
+    // The counter is read when polled, so the detents since the last poll come as one event
+    hal.turn(5);
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 8));
+    TEST_ASSERT_EQUAL(ENCODER_STEP, events[0].type);
+    TEST_ASSERT_EQUAL(5, events[0].detents);
+
+    hal.turn(-3);
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 8));
+    TEST_ASSERT_EQUAL(-3, events[0].detents);
+}
+
+void test_short_press() {
+    MockEncoderHal hal;
+    Encoder encoder(hal, LONG_PRESS_MS);
+    encoder.begin();
+    EncoderEvent events[4];
+
+    hal.advance(100);
+    hal.press();
+    hal.advance(200);
+    hal.release();
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 4));
+    TEST_ASSERT_EQUAL(ENCODER_PRESS, events[0].type);
+    TEST_ASSERT_FALSE(encoder.pressed());
+}
+
+void test_button_bounce_is_ignored() {
+    MockEncoderHal hal;
+    Encoder encoder(hal, LONG_PRESS_MS);
+    encoder.begin();
+    EncoderEvent events[4];
+
+    hal.advance(100);
+    hal.press();
+    hal.advance(10);
+    hal.release();
+    hal.advance(10);
+    hal.press();
+    TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+    TEST_ASSERT_TRUE(encoder.pressed());
+    hal.advance(200);
+    hal.release();
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 4));
+    TEST_ASSERT_EQUAL(ENCODER_PRESS, events[0].type);
+}
+
+void test_long_press_fires_while_held() {
+    MockEncoderHal hal;
+    Encoder encoder(hal, LONG_PRESS_MS);
+    encoder.begin();
+    EncoderEvent events[4];
+
+    hal.advance(100);
+    hal.press();
+    hal.advance(LONG_PRESS_MS - 1);
+    TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+    hal.advance(1);
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 4));
+    TEST_ASSERT_EQUAL(ENCODER_LONG_PRESS, events[0].type);
+
+    // Releasing does not report the press again
+    hal.advance(500);
+    hal.release();
+    TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+}
+
+void test_long_press_missed_while_busy() {
+    MockEncoderHal hal;
+    Encoder encoder(hal, LONG_PRESS_MS);
+    encoder.begin();
+    EncoderEvent events[4];
+
+    // Press and release both happen before the next poll
+    hal.advance(100);
+    hal.press();
+    hal.advance(LONG_PRESS_MS + 100);
+    hal.release();
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 4));
+    TEST_ASSERT_EQUAL(ENCODER_LONG_PRESS, events[0].type);
+}
+
+void test_turning_while_pressed() {
+    const bool backends[] = {false, true};
+    for (bool hardwareCount : backends) {
+        MockEncoderHal hal(hardwareCount);
+        Encoder encoder(hal, LONG_PRESS_MS);
+        encoder.begin();
+        EncoderEvent events[4];
+
+        hal.advance(100);
+        hal.press();
+        TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+        hal.turn(1);
+        TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 4));
+        TEST_ASSERT_EQUAL(ENCODER_PRESSED_STEP, events[0].type);
+
+        // Neither a long nor a short press after turning
+        hal.advance(LONG_PRESS_MS);
+        TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+        hal.release();
+        TEST_ASSERT_EQUAL(0, pollAll(encoder, events, 4));
+    }
+}
+
+void test_acceleration() {
+    MockEncoderHal hal;
+    Encoder encoder(hal, LONG_PRESS_MS, {100, 20, 5});
+    encoder.begin();
+    EncoderEvent events[16];
+
+    // Slow turning is not scaled
+    for (int i = 0; i < 3; i++) {
+        hal.advance(200);
+        hal.turn(1);
+        TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 16));
+        TEST_ASSERT_EQUAL(1, events[0].delta);
+    }
+
+    // Fast turning reaches the maximum multiplier
+    hal.turn(10, 1);
+    TEST_ASSERT_EQUAL(10, pollAll(encoder, events, 16));
+    TEST_ASSERT_EQUAL(5, events[9].delta);
+
+    // Turning back starts slow again
+    hal.turn(-1, 1);
+    TEST_ASSERT_EQUAL(1, pollAll(encoder, events, 16));
+    TEST_ASSERT_EQUAL(-1, events[0].delta);
+}
+
+void test_full_ring_counts_dropped_steps() {
+    MockEncoderHal hal;
+    Encoder encoder(hal);
+    encoder.begin();
+    EncoderEvent events[64];
+
+    hal.turn(ENCODER_RING_SIZE + 8);
+    int polled = pollAll(encoder, events, 64);
+    TEST_ASSERT_LESS_THAN(ENCODER_RING_SIZE + 8, polled);
+    TEST_ASSERT_EQUAL(ENCODER_RING_SIZE + 8, polled + encoder.dropped());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_quadrature_detents);
+    RUN_TEST(test_hardware_count_detents);
+    RUN_TEST(test_short_press);
+    RUN_TEST(test_button_bounce_is_ignored);
+    RUN_TEST(test_long_press_fires_while_held);
+    RUN_TEST(test_long_press_missed_while_busy);
+    RUN_TEST(test_turning_while_pressed);
+    RUN_TEST(test_acceleration);
+    RUN_TEST(test_full_ring_counts_dropped_steps);
+    return UNITY_END();
+}
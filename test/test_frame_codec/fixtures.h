@@ -0,0 +1,694 @@
+// Generated by scripts/codec_fixtures.py, do not edit.
+#ifndef CODEC_FIXTURES_H
+#define CODEC_FIXTURES_H
+
+#include <stdint.h>
+
+#define CODEC_FIXTURE_PIXELS 256
+#define CODEC_FIXTURE_FRAMES 34
+#define CODEC_FIXTURE_SEED 12345
+#define CODEC_KEYFRAME_INTERVAL 16
+
+// Encoded frames of all animations, 167 unique ones
+static constexpr uint8_t CODEC_POOL[11689] = {
+    1, 191, 1, 191, 1, 191, 1, 191, 1, 0, 63, 63, 48, 191, 1, 72, 255, 1, 5, 0,
+    3, 179, 1, 63, 63, 63, 7, 0, 63, 63, 63, 49, 64, 1, 0, 66, 7, 0, 64, 1,
+    1, 65, 3, 1, 64, 1, 0, 63, 63, 63, 5, 64, 1, 2, 64, 1, 1, 64, 1, 1,
+    65, 3, 0, 64, 1, 3, 64, 1, 0, 64, 1, 0, 64, 1, 0, 66, 7, 1, 64, 1,
+    0, 67, 15, 0, 64, 1, 0, 65, 3, 1, 64, 1, 4, 64, 1, 1, 68, 31, 1, 1,
+    67, 15, 51, 191, 1, 191, 1, 191, 1, 71, 255, 0, 63, 63, 16, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 41,
+    0, 63, 63, 58, 65, 3, 7, 64, 1, 0, 64, 1, 0, 66, 7, 0, 64, 1, 0, 68,
+    31, 0, 64, 1, 0, 65, 3, 10, 65, 3, 0, 67, 15, 3, 64, 1, 0, 65, 3, 0,
+    65, 3, 5, 65, 3, 1, 1, 67, 15, 51, 72, 255, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 170, 1, 1, 71, 255, 0, 64, 1, 0,
+    64, 1, 2, 64, 1, 0, 64, 1, 4, 64, 1, 0, 65, 3, 1, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 1, 66, 7, 0, 64, 1, 1, 64, 1, 0, 67,
+    15, 2, 65, 3, 0, 64, 1, 0, 64, 1, 1, 65, 3, 0, 0, 63, 54, 65, 3, 0,
+    64, 1, 2, 67, 15, 0, 64, 1, 0, 65, 3, 5, 64, 1, 5, 65, 3, 1, 65, 3,
+    2, 64, 1, 1, 66, 7, 0, 65, 3, 0, 64, 1, 0, 65, 3, 1, 65, 3, 1, 67,
+    15, 0, 70, 127, 1, 66, 7, 0, 65, 3, 0, 65, 3, 0, 64, 1, 4, 65, 3, 0,
+    64, 1, 0, 65, 3, 0, 64, 1, 0, 64, 1, 2, 67, 15, 0, 65, 3, 0, 64, 1,
+    0, 64, 1, 1, 64, 1, 2, 66, 7, 1, 64, 1, 1, 65, 3, 0, 65, 3, 0, 65,
+    3, 0, 64, 1, 0, 63, 63, 63, 57, 65, 3, 0, 64, 1, 1, 0, 63, 30, 65, 3,
+    1, 64, 1, 1, 69, 63, 1, 64, 1, 0, 64, 1, 63, 63, 14, 0, 63, 12, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 63, 31, 0, 63, 63, 60, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 50, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 63, 63, 13, 1, 67, 15, 46, 64, 1, 0, 64, 1, 0,
+    65, 3, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 76, 255, 31, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    65, 3, 1, 66, 7, 1, 64, 1, 0, 64, 1, 0, 65, 3, 4, 68, 31, 1, 64, 1,
+    0, 66, 7, 3, 64, 1, 0, 64, 1, 1, 69, 63, 0, 66, 7, 0, 64, 1, 1, 65,
+    3, 1, 65, 3, 0, 66, 7, 3, 64, 1, 1, 64, 1, 0, 64, 1, 1, 65, 3, 1,
+    65, 3, 3, 64, 1, 4, 65, 3, 0, 65, 3, 0, 66, 7, 0, 64, 1, 1, 64, 1,
+    1, 67, 15, 0, 157, 1, 0, 64, 1, 7, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 0, 63, 63, 63, 59, 64, 1, 0, 64, 1, 0, 0, 63, 21, 64, 1, 0, 64,
+    1, 0, 64, 1, 63, 63, 36, 0, 63, 63, 63, 4, 64, 1, 1, 64, 1, 1, 67, 15,
+    0, 157, 1, 0, 64, 1, 7, 64, 1, 0, 64, 1, 4, 0, 63, 42, 65, 3, 4, 68,
+    31, 1, 64, 1, 0, 66, 7, 3, 64, 1, 0, 64, 1, 1, 69, 63, 0, 66, 7, 0,
+    64, 1, 1, 65, 3, 1, 65, 3, 0, 66, 7, 3, 64, 1, 1, 64, 1, 0, 64, 1,
+    1, 65, 3, 1, 65, 3, 3, 64, 1, 63, 9, 0, 63, 63, 46, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 63, 3, 1, 67, 15,
+    63, 63, 63, 59, 0, 63, 63, 63, 24, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 1, 67, 15, 63, 63, 63, 6, 65, 3, 0, 67, 15,
+    3, 64, 1, 0, 65, 3, 0, 65, 3, 5, 65, 3, 1, 64, 1, 3, 64, 1, 0, 64,
+    1, 1, 67, 15, 0, 65, 3, 0, 64, 1, 4, 64, 1, 0, 63, 63, 63, 62, 64, 1,
+    1, 67, 15, 40, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    1, 66, 7, 0, 64, 1, 1, 64, 1, 0, 67, 15, 2, 65, 3, 0, 64, 1, 0, 64,
+    1, 1, 65, 3, 2, 64, 1, 0, 68, 31, 1, 64, 1, 0, 66, 7, 3, 64, 1, 0,
+    64, 1, 0, 64, 1, 1, 67, 15, 63, 63, 12, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 1, 66, 7,
+    0, 64, 1, 1, 64, 1, 0, 67, 15, 2, 65, 3, 0, 64, 1, 0, 64, 1, 1, 65,
+    3, 2, 64, 1, 0, 68, 31, 1, 64, 1, 0, 66, 7, 3, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 36, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 63, 33, 0, 63, 63, 30, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 1, 66, 7,
+    0, 64, 1, 1, 64, 1, 0, 67, 15, 2, 65, 3, 0, 64, 1, 0, 64, 1, 1, 65,
+    3, 2, 64, 1, 0, 68, 31, 1, 64, 1, 0, 66, 7, 3, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 50, 65, 3, 0, 66, 7, 4, 65, 3, 1, 65, 3, 1, 64, 1, 0, 66,
+    7, 0, 64, 1, 63, 63, 50, 0, 63, 63, 63, 4, 66, 7, 0, 67, 15, 2, 65, 3,
+    0, 64, 1, 2, 64, 1, 0, 65, 3, 1, 65, 3, 1, 64, 1, 1, 64, 1, 0, 66,
+    7, 0, 65, 3, 0, 65, 3, 1, 64, 1, 0, 67, 15, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 2, 1, 67, 15, 32, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 1, 66, 7, 0, 65, 3, 0, 64, 1, 0, 65, 3, 1,
+    65, 3, 1, 67, 15, 0, 67, 15, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0,
+    64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1,
+    0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64, 1, 0, 64,
+    1, 0, 64, 1, 0, 64, 1, 45, 64, 1, 0, 64, 1, 1, 65, 3, 0, 64, 1, 0,
+    64, 1, 1, 65, 3, 2, 65, 3, 0, 64, 1, 0, 64, 1, 1, 67, 15, 2, 65, 3,
+    0, 64, 1, 0, 65, 3, 1, 64, 1, 0, 64, 1, 0, 64, 1, 0, 69, 63, 0, 68,
+    31, 0, 64, 1, 0, 66, 7, 0, 17, 64, 1, 63, 63, 63, 44, 1, 155, 2, 191, 1,
+    185, 1, 191, 2, 169, 2, 0, 63, 63, 48, 191, 1, 72, 85, 85, 1, 5, 0, 3, 151,
+    2, 155, 1, 63, 63, 63, 7, 1, 67, 170, 51, 191, 1, 191, 1, 191, 1, 71, 85, 85,
+    0, 63, 63, 63, 48, 65, 11, 0, 72, 234, 126, 1, 0, 65, 7, 0, 63, 63, 63, 4,
+    65, 11, 0, 67, 223, 0, 65, 14, 0, 69, 182, 15, 1, 64, 2, 0, 66, 45, 0, 67,
+    217, 0, 64, 1, 0, 72, 149, 183, 1, 0, 65, 11, 0, 68, 255, 1, 1, 68, 170, 2,
+    1, 0, 63, 63, 16, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 64, 2, 41, 0,
+    63, 63, 56, 68, 159, 3, 0, 64, 3, 1, 67, 191, 0, 68, 109, 2, 0, 70, 157, 26,
+    0, 69, 174, 15, 2, 66, 63, 0, 64, 3, 0, 71, 186, 213, 0, 64, 3, 0, 67, 158,
+    0, 68, 249, 3, 2, 66, 57, 0, 1, 67, 170, 51, 74, 85, 85, 45, 0, 66, 45, 0,
+    66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45,
+    0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66,
+    45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 66, 45, 0, 168, 1, 65, 10, 0, 74,
+    155, 165, 30, 0, 65, 14, 0, 65, 7, 0, 64, 2, 0, 66, 63, 0, 68, 157, 3, 0,
+    64, 1, 0, 70, 221, 30, 0, 67, 151, 0, 67, 126, 0, 67, 170, 2, 69, 181, 11, 1,
+    65, 5, 0, 0, 63, 53, 66, 43, 0, 64, 2, 1, 68, 107, 2, 0, 67, 174, 0, 65,
+    15, 0, 69, 223, 15, 1, 67, 231, 0, 66, 57, 1, 64, 2, 1, 69, 230, 9, 0, 64,
+    2, 0, 69, 249, 9, 1, 75, 85, 151, 149, 0, 73, 91, 235, 6, 0, 68, 253, 3, 0,
+    67, 118, 0, 65, 9, 0, 66, 29, 0, 64, 3, 0, 75, 86, 215, 238, 0, 66, 62, 0,
+    66, 22, 0, 65, 7, 0, 66, 43, 0, 68, 122, 2, 0, 64, 1, 0, 63, 63, 63, 57,
+    65, 9, 0, 64, 2, 1, 0, 63, 24, 64, 3, 2, 68, 95, 3, 0, 64, 1, 0, 71,
+    107, 234, 0, 66, 30, 63, 63, 14, 0, 63, 12, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 63, 31, 0, 63, 63, 60, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 50, 64, 1, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 64,
+    2, 63, 63, 13, 1, 67, 170, 46, 64, 1, 0, 69, 94, 11, 0, 66, 45, 0, 140, 1,
+    65, 11, 0, 66, 45, 0, 66, 45, 0, 64, 1, 0, 64, 2, 0, 64, 1, 0, 65, 5,
+    1, 66, 22, 1, 64, 2, 0, 64, 1, 0, 66, 58, 0, 64, 3, 0, 78, 87, 249, 93,
+    62, 0, 75, 183, 159, 166, 0, 69, 234, 14, 0, 65, 5, 1, 65, 5, 0, 66, 37, 0,
+    64, 3, 0, 65, 11, 0, 67, 119, 0, 66, 43, 0, 66, 23, 3, 64, 2, 1, 68, 127,
+    1, 0, 65, 5, 0, 66, 26, 0, 64, 2, 1, 64, 2, 1, 68, 89, 3, 157, 2, 66,
+    59, 6, 66, 46, 0, 66, 45, 0, 0, 63, 63, 63, 58, 65, 11, 0, 65, 13, 0, 63,
+    21, 69, 237, 13, 63, 63, 35, 0, 63, 63, 63, 4, 64, 2, 1, 64, 2, 1, 68, 89,
+    3, 157, 2, 66, 59, 6, 71, 238, 255, 1, 67, 170, 46, 64, 1, 0, 69, 94, 11, 0,
+    66, 45, 0, 140, 1, 65, 11, 0, 66, 45, 0, 72, 253, 255, 1, 0, 65, 5, 1, 66,
+    22, 1, 64, 2, 0, 64, 1, 0, 191, 3, 143, 3, 65, 5, 0, 65, 5, 0, 66, 26,
+    59, 0, 63, 63, 45, 65, 7, 0, 66, 30, 0, 66, 30, 0, 66, 30, 63, 3, 1, 67,
+    170, 63, 63, 63, 59, 0, 63, 63, 63, 24, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 1,
+    67, 170, 63, 63, 63, 5, 66, 43, 0, 67, 86, 0, 64, 3, 0, 65, 11, 0, 68, 121,
+    2, 2, 68, 127, 2, 0, 65, 7, 0, 67, 191, 0, 65, 13, 0, 70, 90, 23, 0, 65,
+    13, 2, 65, 7, 0, 63, 63, 63, 61, 65, 7, 0, 44, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 39, 69, 255, 7, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 65, 14, 63, 46, 0, 36, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 65, 14, 63, 32, 0, 63, 63, 30, 64, 1, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0,
+    66, 30, 0, 66, 30, 0, 64, 2, 0, 67, 107, 0, 67, 189, 0, 67, 85, 2, 69, 122,
+    7, 1, 65, 10, 2, 64, 1, 0, 68, 170, 2, 1, 64, 1, 0, 66, 37, 1, 64, 3,
+    0, 64, 1, 0, 66, 30, 0, 50, 65, 5, 0, 68, 234, 3, 2, 66, 58, 0, 65, 6,
+    1, 71, 109, 221, 63, 63, 49, 0, 63, 63, 63, 4, 72, 213, 149, 3, 1, 65, 6, 0,
+    64, 2, 2, 64, 1, 0, 75, 245, 246, 126, 0, 69, 214, 9, 0, 65, 9, 0, 65, 7,
+    0, 67, 165, 0, 66, 30, 0, 65, 14, 0, 64, 3, 1, 67, 170, 32, 68, 222, 1, 0,
+    66, 30, 0, 66, 30, 0, 67, 155, 0, 70, 185, 39, 1, 71, 249, 85, 0, 67, 165, 0,
+    66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30,
+    0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66, 30, 0, 66,
+    30, 0, 66, 30, 0, 66, 30, 0, 65, 14, 40, 66, 63, 0, 66, 29, 0, 66, 27, 0,
+    70, 221, 23, 0, 67, 95, 0, 66, 29, 1, 67, 102, 2, 70, 182, 43, 0, 65, 7, 0,
+    64, 2, 0, 64, 2, 0, 69, 153, 9, 0, 68, 153, 2, 0, 68, 174, 2, 1, 155, 4,
+    191, 3, 185, 3, 191, 4, 169, 4, 0, 63, 63, 48, 191, 2, 136, 2, 5, 0, 3, 151,
+    4, 155, 3, 63, 63, 63, 7, 1, 67, 68, 68, 51, 143, 3, 191, 2, 191, 2, 183, 2,
+    0, 63, 63, 63, 48, 78, 79, 161, 229, 230, 111, 34, 179, 7, 0, 63, 63, 63, 4, 65,
+    76, 0, 67, 182, 248, 0, 65, 186, 0, 70, 133, 175, 204, 9, 0, 94, 53, 199, 26, 71,
+    178, 113, 41, 119, 110, 178, 126, 201, 149, 172, 34, 5, 0, 69, 138, 155, 110, 0, 64, 15,
+    1, 67, 68, 68, 51, 191, 1, 191, 1, 191, 1, 135, 1, 0, 63, 63, 16, 78, 141, 164,
+    249, 46, 86, 49, 199, 11, 0, 78, 141, 164, 249, 46, 86, 49, 199, 11, 0, 78, 141, 164,
+    249, 46, 86, 49, 199, 11, 0, 78, 141, 164, 249, 46, 86, 49, 199, 11, 0, 68, 141, 164,
+    9, 41, 0, 63, 63, 54, 64, 15, 0, 90, 125, 227, 156, 50, 139, 41, 59, 238, 53, 148,
+    203, 217, 103, 6, 0, 88, 89, 215, 143, 50, 131, 200, 202, 122, 87, 183, 27, 40, 15, 0,
+    80, 86, 145, 186, 199, 207, 162, 18, 87, 2, 1, 67, 68, 68, 51, 136, 1, 73, 156, 181,
+    232, 63, 71, 0, 78, 98, 173, 193, 89, 139, 254, 115, 4, 0, 78, 98, 173, 193, 89, 139,
+    254, 115, 4, 0, 78, 98, 173, 193, 89, 139, 254, 115, 4, 0, 78, 98, 173, 193, 89, 139,
+    254, 115, 4, 0, 67, 98, 173, 166, 1, 91, 18, 158, 101, 185, 36, 147, 233, 54, 239, 88,
+    60, 213, 207, 136, 0, 88, 129, 66, 167, 83, 193, 98, 141, 242, 55, 66, 239, 124, 11, 0,
+    69, 237, 68, 255, 0, 74, 51, 236, 220, 245, 177, 15, 0, 63, 53, 101, 44, 251, 174, 195,
+    119, 209, 135, 178, 161, 126, 106, 139, 214, 56, 83, 100, 40, 126, 168, 0, 64, 7, 0, 72,
+    99, 107, 229, 55, 9, 0, 83, 113, 88, 219, 42, 180, 187, 69, 210, 86, 119, 0, 93, 31,
+    56, 104, 158, 219, 202, 146, 218, 100, 114, 85, 49, 195, 130, 216, 0, 83, 141, 184, 39, 222,
+    180, 155, 122, 242, 117, 41, 0, 77, 72, 223, 127, 119, 61, 222, 74, 0, 63, 63, 63, 57,
+    69, 66, 227, 147, 0, 63, 24, 64, 8, 0, 85, 53, 227, 233, 76, 134, 189, 193, 229, 109,
+    42, 18, 63, 63, 14, 0, 63, 11, 67, 115, 188, 0, 78, 141, 164, 249, 46, 82, 54, 216,
+    12, 0, 78, 244, 19, 219, 82, 42, 165, 142, 12, 0, 78, 141, 164, 105, 234, 42, 49, 99,
+    1, 0, 78, 93, 123, 53, 62, 201, 72, 254, 9, 0, 78, 244, 163, 37, 89, 173, 49, 199,
+    7, 63, 31, 0, 63, 63, 60, 66, 243, 7, 0, 78, 132, 164, 214, 210, 33, 70, 187, 15,
+    0, 78, 241, 164, 247, 81, 106, 53, 103, 9, 0, 78, 113, 164, 37, 238, 97, 166, 104, 9,
+    0, 78, 116, 164, 59, 222, 205, 61, 190, 7, 0, 50, 76, 163, 109, 34, 86, 49, 199, 11,
+    0, 78, 141, 164, 249, 46, 86, 49, 199, 11, 0, 78, 141, 164, 249, 46, 82, 54, 216, 12,
+    0, 78, 244, 19, 219, 82, 42, 165, 142, 12, 0, 64, 13, 63, 63, 13, 1, 67, 68, 68,
+    46, 71, 163, 109, 50, 71, 0, 67, 98, 173, 139, 1, 84, 98, 173, 193, 89, 139, 254, 243,
+    84, 81, 51, 15, 0, 77, 61, 83, 229, 47, 218, 196, 143, 0, 78, 28, 17, 65, 103, 130,
+    43, 201, 12, 0, 75, 188, 230, 198, 235, 41, 222, 0, 90, 228, 105, 125, 47, 171, 186, 163,
+    18, 93, 167, 71, 111, 130, 1, 0, 76, 150, 164, 188, 83, 170, 74, 5, 0, 78, 140, 44,
+    161, 43, 74, 185, 154, 5, 0, 72, 89, 53, 61, 98, 14, 155, 9, 67, 205, 110, 1, 76,
+    95, 245, 69, 230, 31, 156, 5, 0, 63, 63, 63, 58, 68, 121, 250, 3, 0, 63, 20, 70,
+    36, 243, 131, 9, 63, 63, 35, 0, 63, 63, 63, 3, 65, 207, 0, 65, 197, 1, 69, 134,
+    118, 179, 155, 12, 70, 152, 59, 85, 10, 1, 64, 10, 0, 71, 49, 59, 51, 51, 1, 67,
+    68, 68, 46, 71, 163, 109, 50, 71, 0, 67, 98, 173, 139, 1, 72, 98, 173, 193, 89, 11,
+    134, 12, 68, 81, 51, 15, 0, 72, 61, 83, 229, 47, 10, 191, 7, 142, 7, 73, 44, 161,
+    43, 74, 185, 187, 5, 0, 63, 63, 45, 65, 152, 0, 75, 116, 19, 213, 186, 198, 61, 63,
+    2, 1, 67, 68, 68, 63, 63, 63, 0, 186, 5, 0, 63, 63, 63, 24, 70, 33, 246, 56,
+    7, 0, 78, 156, 164, 219, 94, 33, 246, 56, 7, 0, 78, 156, 164, 219, 94, 33, 246, 56,
+    7, 1, 67, 68, 68, 63, 63, 63, 0, 71, 85, 85, 202, 228, 0, 69, 189, 49, 202, 0,
+    79, 76, 37, 196, 235, 90, 111, 136, 225, 0, 89, 24, 143, 136, 244, 131, 69, 190, 193, 179,
+    53, 166, 85, 40, 0, 63, 63, 63, 61, 65, 120, 0, 43, 67, 239, 184, 0, 78, 116, 163,
+    109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 109, 82, 201, 241, 142, 11, 0, 78, 116, 163,
+    109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 109, 82, 201, 241, 142, 11, 0, 78, 116, 163,
+    109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 109, 82, 201, 241, 142, 11, 0, 78, 116, 163,
+    109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 109, 82, 201, 241, 142, 11, 0, 78, 116, 163,
+    109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 219, 94, 196, 168, 206, 11, 0, 78, 196, 165,
+    103, 158, 193, 161, 51, 12, 0, 78, 115, 116, 221, 94, 42, 165, 219, 12, 0, 78, 84, 164,
+    231, 94, 159, 241, 136, 7, 0, 39, 69, 136, 136, 103, 0, 78, 131, 252, 43, 229, 218, 65,
+    121, 6, 0, 78, 131, 252, 43, 229, 218, 65, 121, 6, 0, 78, 131, 252, 43, 229, 218, 65,
+    121, 6, 0, 78, 131, 252, 43, 229, 218, 65, 121, 6, 0, 78, 131, 252, 43, 229, 218, 65,
+    121, 6, 0, 78, 131, 252, 43, 229, 218, 65, 121, 6, 0, 65, 131, 63, 46, 0, 36, 74,
+    109, 226, 42, 245, 139, 12, 0, 78, 115, 70, 217, 225, 42, 245, 139, 12, 0, 78, 115, 70,
+    217, 225, 42, 245, 139, 12, 0, 78, 115, 70, 217, 225, 42, 245, 139, 12, 0, 78, 115, 70,
+    217, 225, 42, 245, 139, 12, 0, 78, 115, 70, 217, 225, 42, 245, 139, 12, 0, 78, 115, 70,
+    217, 225, 42, 245, 139, 12, 0, 77, 116, 163, 109, 82, 201, 241, 142, 63, 32, 0, 63, 63,
+    30, 64, 11, 0, 78, 116, 163, 109, 82, 201, 241, 142, 11, 0, 78, 116, 163, 109, 82, 201,
+    241, 142, 11, 0, 70, 116, 163, 142, 11, 0, 64, 14, 0, 67, 76, 30, 0, 73, 113, 150,
+    186, 178, 91, 0, 85, 74, 105, 99, 251, 149, 93, 175, 162, 237, 228, 84, 0, 69, 251, 187,
+    93, 0, 70, 252, 171, 141, 2, 0, 50, 71, 18, 178, 211, 47, 0, 81, 139, 180, 136, 146,
+    59, 142, 212, 249, 217, 63, 63, 49, 0, 63, 63, 63, 3, 73, 181, 178, 55, 19, 201, 0,
+    68, 239, 91, 14, 0, 79, 255, 241, 59, 124, 29, 103, 205, 182, 0, 69, 25, 129, 66, 0,
+    68, 147, 111, 11, 0, 76, 178, 153, 239, 183, 213, 87, 12, 1, 67, 68, 68, 32, 72, 109,
+    98, 162, 125, 3, 0, 80, 132, 251, 220, 227, 186, 141, 205, 75, 15, 0, 76, 211, 119, 178,
+    33, 63, 226, 14, 0, 78, 132, 251, 206, 81, 105, 162, 125, 3, 0, 78, 132, 251, 206, 81,
+    105, 162, 125, 3, 0, 78, 132, 251, 206, 81, 105, 162, 125, 3, 0, 78, 132, 251, 206, 81,
+    105, 162, 125, 3, 0, 65, 132, 40, 82, 119, 172, 195, 161, 156, 251, 131, 129, 60, 3, 0,
+    78, 108, 33, 58, 54, 175, 30, 41, 15, 0, 97, 149, 203, 141, 237, 143, 83, 249, 174, 225,
+    210, 66, 26, 180, 238, 159, 232, 212, 0, 17, 64, 2, 63, 63, 63, 44, 1, 155, 5, 191,
+    4, 185, 4, 191, 5, 169, 5, 0, 63, 63, 48, 191, 12, 136, 12, 5, 0, 3, 151, 5,
+    155, 4, 63, 63, 63, 7, 1, 131, 5, 51, 143, 4, 191, 3, 191, 3, 183, 3, 0, 63,
+    63, 63, 48, 78, 76, 220, 131, 135, 11, 241, 159, 115, 224, 104, 240, 1, 212, 30, 134, 0,
+    63, 63, 63, 4, 122, 26, 175, 16, 159, 36, 12, 250, 25, 51, 206, 25, 160, 184, 21, 105,
+    254, 55, 125, 164, 229, 212, 60, 26, 72, 48, 57, 107, 3, 74, 202, 83, 95, 13, 4, 152,
+    213, 154, 137, 217, 15, 100, 23, 55, 133, 33, 206, 210, 154, 88, 129, 237, 209, 117, 92, 128,
+    193, 79, 50, 249, 1, 131, 5, 51, 191, 1, 191, 1, 191, 1, 135, 1, 0, 63, 63, 15,
+    127, 68, 101, 175, 62, 89, 74, 53, 134, 50, 135, 115, 98, 27, 63, 42, 172, 182, 213, 99,
+    132, 164, 223, 51, 75, 5, 162, 112, 96, 69, 173, 220, 165, 60, 130, 72, 87, 21, 133, 86,
+    54, 84, 148, 4, 32, 66, 35, 183, 16, 209, 176, 219, 6, 241, 190, 238, 254, 47, 153, 136,
+    139, 52, 79, 206, 125, 69, 137, 44, 28, 57, 93, 191, 41, 0, 63, 63, 54, 127, 22, 123,
+    49, 232, 116, 51, 143, 250, 123, 148, 55, 181, 150, 223, 82, 160, 214, 148, 184, 72, 19, 34,
+    114, 65, 60, 94, 117, 197, 32, 172, 151, 77, 63, 213, 76, 28, 200, 140, 37, 46, 28, 128,
+    255, 95, 239, 39, 178, 71, 160, 205, 125, 1, 208, 88, 86, 143, 253, 111, 116, 90, 163, 12,
+    35, 187, 72, 51, 187, 5, 124, 88, 199, 201, 77, 5, 1, 131, 5, 51, 136, 1, 121, 112,
+    72, 96, 162, 84, 120, 42, 24, 130, 59, 181, 32, 54, 60, 18, 111, 49, 82, 58, 83, 147,
+    25, 180, 128, 230, 110, 198, 19, 161, 129, 236, 41, 119, 39, 80, 95, 109, 81, 16, 160, 108,
+    159, 14, 3, 38, 94, 13, 93, 157, 47, 171, 66, 48, 158, 118, 203, 197, 57, 0, 83, 127,
+    179, 170, 204, 27, 175, 11, 102, 23, 184, 28, 199, 89, 21, 70, 121, 40, 101, 22, 15, 166,
+    1, 127, 251, 93, 143, 72, 245, 223, 209, 83, 70, 3, 128, 174, 218, 87, 35, 46, 74, 195,
+    184, 103, 214, 24, 102, 116, 168, 169, 84, 106, 99, 142, 132, 139, 59, 197, 144, 201, 56, 208,
+    214, 68, 202, 182, 211, 40, 235, 21, 51, 3, 5, 135, 195, 100, 152, 95, 198, 90, 143, 113,
+    137, 235, 55, 99, 24, 178, 72, 49, 143, 49, 116, 171, 74, 142, 31, 180, 0, 63, 53, 103,
+    225, 44, 159, 122, 169, 124, 126, 190, 187, 231, 250, 134, 215, 39, 10, 56, 86, 145, 216, 96,
+    201, 17, 122, 135, 78, 206, 38, 69, 140, 56, 102, 153, 204, 188, 169, 100, 46, 89, 40, 100,
+    0, 127, 69, 150, 31, 20, 77, 36, 79, 52, 90, 26, 7, 35, 46, 70, 12, 13, 30, 25,
+    62, 123, 14, 16, 58, 6, 245, 81, 29, 101, 221, 226, 204, 86, 33, 29, 161, 181, 161, 87,
+    51, 36, 89, 168, 255, 229, 209, 107, 245, 158, 202, 155, 99, 37, 3, 142, 147, 206, 81, 64,
+    212, 180, 82, 48, 94, 73, 96, 211, 124, 123, 38, 194, 4, 144, 36, 115, 43, 143, 56, 159,
+    46, 150, 225, 227, 185, 176, 42, 35, 70, 214, 159, 76, 94, 38, 118, 206, 178, 33, 4, 246,
+    0, 63, 63, 63, 57, 69, 38, 65, 220, 139, 63, 102, 0, 63, 24, 64, 106, 0, 85, 193,
+    78, 155, 27, 172, 57, 113, 125, 5, 113, 85, 199, 12, 138, 118, 144, 65, 69, 86, 78, 70,
+    124, 63, 63, 14, 0, 63, 11, 127, 33, 55, 61, 19, 110, 48, 83, 59, 82, 146, 24, 181,
+    129, 38, 111, 52, 121, 117, 4, 80, 251, 63, 64, 87, 106, 111, 221, 48, 206, 65, 5, 34,
+    136, 84, 228, 189, 171, 156, 46, 170, 67, 49, 227, 79, 119, 252, 160, 104, 126, 223, 160, 7,
+    239, 5, 203, 99, 4, 232, 227, 63, 204, 60, 149, 113, 83, 38, 195, 51, 243, 84, 103, 155,
+    128, 17, 139, 143, 175, 165, 122, 159, 200, 142, 235, 42, 132, 63, 31, 0, 63, 63, 60, 127,
+    16, 123, 116, 184, 24, 83, 100, 17, 114, 200, 112, 118, 32, 228, 206, 50, 160, 223, 68, 172,
+    102, 150, 37, 164, 38, 61, 167, 133, 116, 39, 208, 196, 66, 142, 12, 2, 39, 27, 79, 215,
+    131, 48, 51, 248, 185, 29, 157, 9, 70, 42, 112, 19, 64, 195, 62, 34, 85, 161, 69, 109,
+    164, 105, 95, 172, 66, 9, 57, 28, 0, 50, 126, 24, 18, 60, 54, 32, 65, 9, 152, 116,
+    138, 34, 64, 31, 149, 113, 73, 97, 163, 85, 121, 43, 25, 131, 58, 180, 33, 55, 61, 19,
+    110, 48, 83, 59, 82, 146, 24, 181, 129, 38, 111, 52, 121, 117, 4, 80, 251, 63, 64, 87,
+    106, 111, 221, 48, 206, 65, 5, 34, 136, 84, 228, 189, 171, 156, 63, 63, 13, 1, 131, 5,
+    46, 77, 24, 18, 60, 54, 32, 64, 8, 153, 117, 139, 35, 65, 30, 148, 138, 1, 101, 32,
+    54, 60, 18, 111, 49, 82, 58, 83, 147, 25, 180, 128, 140, 110, 7, 93, 58, 154, 64, 16,
+    6, 90, 85, 46, 56, 150, 28, 42, 26, 15, 79, 70, 112, 16, 75, 33, 157, 131, 1, 127,
+    156, 21, 35, 67, 48, 20, 127, 210, 177, 44, 14, 44, 23, 34, 25, 104, 169, 105, 77, 73,
+    26, 25, 116, 33, 107, 50, 115, 35, 22, 185, 118, 19, 66, 18, 13, 31, 176, 144, 167, 142,
+    43, 192, 151, 30, 21, 76, 37, 78, 53, 91, 27, 6, 34, 47, 71, 13, 12, 31, 24, 63,
+    122, 15, 17, 59, 90, 7, 14, 12, 146, 45, 40, 61, 13, 126, 19, 166, 57, 72, 31, 17,
+    98, 194, 99, 29, 103, 102, 201, 65, 51, 53, 38, 158, 155, 11, 82, 22, 145, 28, 219, 121,
+    2, 42, 7, 155, 140, 56, 188, 179, 77, 123, 136, 45, 29, 56, 0, 63, 63, 63, 58, 68,
+    69, 182, 19, 35, 6, 0, 63, 20, 70, 159, 21, 184, 140, 128, 98, 11, 63, 63, 35, 0,
+    63, 63, 63, 3, 76, 22, 101, 197, 100, 26, 96, 97, 206, 70, 52, 50, 33, 153, 155, 12,
+    70, 17, 150, 27, 220, 126, 5, 45, 0, 69, 156, 139, 63, 187, 180, 74, 132, 57, 1, 131,
+    5, 46, 77, 24, 18, 60, 54, 32, 64, 8, 153, 117, 139, 35, 65, 30, 148, 138, 1, 72,
+    32, 54, 60, 18, 111, 49, 82, 58, 83, 134, 12, 78, 93, 58, 154, 64, 16, 6, 90, 85,
+    46, 56, 150, 28, 42, 26, 15, 191, 8, 142, 8, 73, 45, 40, 61, 13, 126, 19, 166, 57,
+    72, 31, 187, 7, 0, 63, 63, 45, 78, 143, 60, 29, 81, 113, 78, 109, 32, 7, 30, 167,
+    19, 35, 13, 198, 63, 2, 1, 131, 5, 44, 191, 2, 191, 2, 147, 2, 186, 7, 0, 63,
+    63, 63, 24, 102, 108, 195, 181, 239, 254, 220, 138, 197, 214, 174, 255, 139, 196, 226, 122, 244,
+    64, 198, 157, 227, 228, 14, 35, 199, 240, 245, 246, 34, 229, 109, 110, 114, 158, 15, 71, 25,
+    70, 36, 140, 0, 63, 63, 63, 8, 92, 125, 150, 64, 51, 230, 228, 110, 137, 41, 227, 132,
+    102, 54, 64, 172, 224, 25, 109, 240, 103, 105, 141, 85, 225, 187, 23, 108, 79, 205, 0, 88,
+    245, 227, 42, 18, 73, 125, 59, 17, 160, 160, 177, 138, 229, 177, 83, 216, 53, 114, 43, 62,
+    79, 133, 215, 120, 6, 0, 63, 63, 63, 61, 65, 178, 234, 0, 43, 127, 180, 25, 147, 83,
+    181, 78, 187, 178, 185, 184, 202, 229, 101, 207, 46, 213, 218, 204, 8, 236, 97, 112, 132, 49,
+    175, 41, 60, 24, 61, 172, 102, 71, 133, 54, 73, 90, 123, 68, 23, 91, 13, 20, 103, 42,
+    100, 9, 173, 25, 197, 30, 186, 21, 35, 7, 151, 87, 19, 180, 32, 65, 84, 75, 129, 63,
+    127, 53, 85, 134, 22, 99, 115, 161, 6, 166, 223, 174, 70, 135, 96, 214, 181, 72, 48, 220,
+    167, 196, 108, 228, 130, 238, 131, 163, 17, 56, 80, 51, 109, 182, 27, 145, 81, 183, 57, 128,
+    26, 16, 62, 52, 34, 98, 74, 114, 150, 40, 122, 86, 160, 2, 59, 199, 201, 206, 168, 177,
+    125, 169, 45, 159, 95, 127, 116, 156, 50, 64, 12, 157, 110, 162, 15, 92, 36, 1, 82, 37,
+    117, 43, 18, 83, 111, 93, 4, 105, 198, 176, 234, 219, 149, 121, 238, 245, 27, 107, 90, 34,
+    52, 188, 94, 234, 59, 164, 173, 38, 224, 14, 142, 18, 124, 230, 6, 141, 112, 152, 75, 54,
+    155, 17, 25, 24, 226, 173, 31, 69, 117, 137, 83, 212, 68, 42, 234, 54, 70, 108, 62, 128,
+    216, 8, 158, 114, 158, 1, 77, 32, 217, 178, 234, 0, 39, 131, 10, 81, 190, 19, 153, 89,
+    191, 70, 179, 186, 177, 176, 194, 237, 109, 199, 38, 221, 210, 196, 0, 127, 228, 105, 120, 140,
+    57, 167, 33, 52, 16, 53, 164, 110, 79, 141, 62, 65, 82, 115, 76, 31, 83, 5, 28, 111,
+    34, 108, 1, 165, 17, 205, 22, 178, 29, 43, 15, 159, 95, 27, 188, 40, 73, 92, 67, 137,
+    55, 61, 93, 142, 30, 107, 123, 169, 14, 174, 215, 166, 78, 143, 104, 222, 189, 64, 56, 212,
+    81, 175, 204, 100, 236, 138, 230, 139, 171, 25, 48, 88, 59, 101, 190, 19, 153, 89, 191, 63,
+    46, 0, 36, 127, 129, 161, 19, 68, 63, 118, 197, 146, 36, 128, 131, 180, 86, 113, 71, 39,
+    130, 50, 23, 98, 211, 112, 126, 157, 183, 8, 182, 212, 175, 64, 56, 222, 189, 143, 104, 166,
+    78, 174, 215, 169, 14, 107, 123, 142, 30, 61, 93, 137, 55, 92, 67, 40, 73, 27, 188, 159,
+    95, 43, 15, 178, 29, 205, 22, 165, 121, 17, 108, 1, 111, 34, 5, 28, 31, 83, 115, 76,
+    65, 82, 141, 62, 110, 79, 53, 164, 52, 16, 167, 33, 140, 57, 105, 120, 103, 85, 26, 91,
+    125, 35, 90, 45, 44, 9, 7, 84, 102, 170, 4, 149, 58, 57, 128, 26, 16, 62, 52, 34,
+    98, 74, 114, 150, 40, 122, 86, 63, 32, 0, 63, 63, 22, 135, 4, 96, 164, 6, 63, 195,
+    205, 202, 172, 181, 121, 173, 41, 155, 91, 112, 152, 54, 68, 8, 153, 106, 166, 11, 88, 32,
+    5, 86, 33, 113, 47, 22, 87, 107, 89, 0, 126, 109, 194, 180, 238, 218, 148, 120, 239, 137,
+    140, 42, 104, 197, 209, 211, 214, 194, 217, 33, 202, 17, 161, 163, 111, 102, 211, 162, 143, 27,
+    32, 70, 110, 90, 35, 131, 220, 16, 1, 35, 9, 46, 160, 92, 75, 154, 52, 104, 80, 6,
+    18, 44, 18, 111, 188, 196, 115, 42, 49, 68, 189, 73, 93, 139, 0, 50, 90, 124, 59, 187,
+    12, 15, 59, 173, 197, 222, 243, 226, 112, 139, 191, 24, 20, 247, 65, 244, 248, 213, 33, 14,
+    111, 86, 242, 24, 63, 63, 49, 0, 63, 63, 63, 3, 123, 62, 25, 5, 163, 242, 156, 180,
+    230, 84, 113, 103, 174, 228, 17, 144, 126, 4, 252, 252, 142, 125, 232, 134, 55, 132, 172, 91,
+    165, 72, 229, 244, 204, 120, 6, 241, 105, 91, 185, 223, 3, 192, 235, 79, 35, 37, 120, 245,
+    223, 246, 84, 27, 138, 152, 132, 94, 198, 73, 191, 173, 151, 1, 131, 5, 32, 127, 129, 161,
+    19, 78, 53, 124, 207, 152, 46, 138, 137, 190, 92, 123, 49, 22, 51, 52, 18, 83, 116, 191,
+    170, 100, 95, 114, 55, 97, 189, 94, 197, 149, 67, 125, 183, 141, 74, 203, 139, 81, 28, 97,
+    113, 132, 20, 55, 87, 131, 61, 86, 73, 34, 67, 17, 182, 149, 85, 33, 5, 184, 23, 199,
+    28, 175, 107, 27, 102, 11, 101, 40, 15, 22, 21, 89, 121, 70, 75, 88, 135, 52, 100, 69,
+    63, 174, 62, 26, 173, 43, 134, 51, 99, 114, 109, 95, 16, 81, 119, 41, 80, 39, 38, 3,
+    13, 94, 108, 160, 14, 159, 48, 133, 2, 162, 6, 127, 196, 134, 214, 30, 46, 145, 27, 30,
+    45, 72, 20, 140, 4, 106, 111, 229, 100, 46, 89, 6, 145, 38, 241, 32, 17, 89, 38, 89,
+    37, 15, 28, 69, 98, 3, 74, 181, 155, 115, 165, 119, 65, 84, 43, 239, 135, 211, 176, 155,
+    29, 168, 87, 124, 27, 87, 32, 22, 19, 188, 18, 208, 59, 162, 52, 50, 69, 74, 39, 84,
+    52, 137, 43, 0, 17, 64, 231, 63, 63, 63, 44, 1, 27, 191, 18, 137, 185, 18, 137, 63,
+    41, 0, 63, 63, 48, 191, 151, 96, 136, 151, 96, 5, 0, 3, 151, 193, 105, 155, 211, 224,
+    63, 63, 63, 7, 1, 3, 179, 193, 105, 143, 18, 137, 191, 214, 213, 191, 214, 213, 183, 214,
+    213, 0, 63, 63, 63, 48, 78, 98, 180, 145, 61, 52, 151, 217, 46, 85, 94, 93, 136, 102,
+    52, 45, 20, 66, 108, 118, 156, 71, 23, 183, 26, 140, 164, 190, 126, 207, 122, 0, 63, 63,
+    63, 4, 122, 58, 224, 193, 175, 48, 41, 102, 4, 14, 251, 227, 77, 114, 146, 240, 2, 25,
+    160, 142, 215, 240, 19, 197, 58, 131, 165, 226, 173, 89, 57, 154, 130, 250, 111, 104, 47, 144,
+    42, 53, 181, 140, 188, 255, 149, 58, 35, 249, 209, 244, 71, 63, 178, 177, 113, 23, 97, 222,
+    222, 100, 59, 15, 193, 184, 160, 7, 165, 175, 55, 127, 224, 157, 249, 86, 191, 167, 131, 174,
+    109, 125, 227, 143, 248, 216, 194, 250, 226, 245, 232, 84, 33, 66, 118, 10, 213, 138, 188, 90,
+    9, 195, 27, 160, 80, 28, 209, 221, 210, 173, 137, 217, 239, 253, 84, 41, 225, 160, 111, 108,
+    0, 1, 3, 179, 193, 105, 191, 186, 54, 191, 186, 54, 191, 186, 54, 135, 186, 54, 0, 63,
+    63, 15, 127, 144, 0, 145, 0, 146, 0, 147, 0, 148, 0, 149, 0, 150, 0, 151, 0, 152,
+    0, 153, 0, 154, 0, 155, 0, 156, 0, 157, 0, 158, 0, 159, 0, 160, 0, 161, 0, 162,
+    0, 163, 0, 164, 0, 165, 0, 166, 0, 167, 0, 168, 0, 169, 0, 170, 0, 171, 0, 172,
+    0, 173, 0, 174, 0, 175, 0, 176, 0, 177, 0, 178, 0, 179, 0, 180, 0, 181, 0, 182,
+    0, 183, 0, 184, 0, 185, 0, 186, 0, 187, 0, 188, 0, 189, 0, 190, 0, 191, 0, 192,
+    0, 193, 0, 194, 0, 195, 0, 196, 0, 197, 0, 198, 0, 199, 0, 200, 0, 201, 0, 202,
+    0, 203, 0, 204, 0, 205, 0, 206, 0, 207, 0, 69, 208, 0, 209, 0, 210, 0, 211, 0,
+    212, 0, 213, 0, 41, 0, 63, 63, 54, 127, 12, 150, 112, 114, 22, 80, 66, 72, 3, 252,
+    253, 23, 34, 205, 84, 196, 138, 77, 108, 171, 88, 32, 146, 204, 194, 239, 182, 185, 61, 87,
+    200, 194, 167, 198, 38, 36, 133, 25, 227, 98, 241, 190, 72, 9, 131, 68, 222, 61, 247, 1,
+    33, 1, 69, 218, 53, 29, 155, 129, 16, 83, 181, 148, 234, 255, 157, 77, 161, 53, 214, 161,
+    210, 21, 8, 75, 28, 237, 44, 129, 114, 53, 210, 109, 94, 102, 244, 36, 110, 82, 228, 149,
+    109, 168, 125, 125, 138, 99, 93, 93, 127, 105, 207, 103, 123, 45, 34, 16, 136, 102, 182, 120,
+    16, 173, 249, 130, 90, 100, 59, 235, 245, 206, 68, 142, 111, 130, 189, 183, 238, 79, 72, 166,
+    6, 238, 135, 168, 101, 36, 152, 136, 118, 91, 3, 237, 205, 234, 226, 168, 121, 1, 3, 179,
+    193, 105, 136, 186, 54, 127, 251, 54, 248, 54, 249, 54, 254, 54, 255, 54, 252, 54, 253, 54,
+    242, 54, 243, 54, 240, 54, 241, 54, 246, 54, 247, 54, 244, 54, 245, 54, 234, 54, 235, 54,
+    232, 54, 233, 54, 238, 54, 239, 54, 236, 54, 237, 54, 226, 54, 227, 54, 224, 54, 225, 54,
+    230, 54, 231, 54, 228, 54, 229, 54, 218, 54, 219, 54, 216, 54, 217, 54, 222, 54, 223, 54,
+    220, 54, 221, 54, 210, 54, 211, 54, 208, 54, 209, 54, 214, 54, 215, 54, 212, 54, 213, 54,
+    202, 54, 203, 54, 200, 54, 201, 54, 206, 54, 207, 54, 204, 54, 205, 54, 194, 54, 195, 54,
+    192, 54, 193, 54, 198, 54, 199, 54, 196, 54, 197, 54, 58, 54, 78, 59, 54, 56, 54, 57,
+    54, 62, 54, 63, 54, 60, 54, 61, 54, 50, 54, 51, 54, 48, 54, 49, 54, 54, 54, 55,
+    54, 52, 54, 53, 54, 166, 186, 54, 127, 182, 160, 202, 68, 172, 102, 248, 126, 185, 202, 71,
+    33, 152, 251, 238, 242, 48, 123, 214, 157, 226, 22, 40, 250, 120, 217, 12, 143, 135, 97, 114,
+    244, 29, 240, 156, 18, 63, 47, 89, 84, 75, 136, 242, 63, 57, 114, 100, 11, 77, 55, 155,
+    55, 255, 236, 143, 43, 33, 183, 170, 101, 15, 162, 134, 201, 240, 123, 195, 3, 181, 151, 178,
+    35, 105, 125, 122, 219, 75, 183, 22, 3, 183, 91, 4, 80, 175, 18, 54, 100, 189, 163, 51,
+    158, 34, 75, 214, 85, 0, 107, 45, 95, 156, 81, 43, 27, 115, 38, 222, 80, 225, 78, 68,
+    155, 172, 180, 16, 82, 112, 221, 189, 248, 13, 184, 33, 180, 242, 129, 162, 121, 72, 235, 48,
+    172, 177, 235, 83, 100, 174, 201, 64, 29, 53, 170, 251, 174, 212, 237, 79, 0, 63, 53, 127,
+    10, 246, 137, 231, 61, 186, 188, 241, 117, 83, 180, 242, 124, 216, 18, 78, 193, 194, 225, 193,
+    107, 135, 225, 32, 132, 172, 189, 82, 86, 120, 221, 16, 33, 161, 52, 119, 214, 145, 178, 207,
+    156, 206, 86, 216, 222, 93, 187, 136, 26, 147, 166, 25, 98, 142, 172, 239, 28, 170, 122, 170,
+    227, 55, 201, 69, 226, 75, 216, 97, 247, 6, 141, 101, 114, 113, 148, 200, 96, 58, 141, 219,
+    0, 84, 172, 215, 217, 232, 63, 143, 137, 233, 234, 67, 55, 102, 205, 241, 204, 202, 245, 63,
+    128, 161, 27, 167, 189, 218, 114, 142, 42, 228, 111, 39, 17, 227, 20, 150, 72, 132, 147, 35,
+    223, 45, 143, 101, 191, 107, 74, 249, 127, 195, 235, 103, 43, 97, 201, 19, 215, 147, 192, 143,
+    233, 77, 223, 240, 130, 238, 21, 105, 56, 83, 154, 227, 159, 18, 176, 21, 2, 205, 8, 90,
+    24, 45, 221, 251, 163, 60, 22, 175, 223, 170, 131, 50, 10, 186, 47, 214, 194, 220, 180, 85,
+    233, 135, 218, 242, 30, 59, 143, 216, 69, 107, 20, 49, 80, 172, 224, 127, 109, 218, 46, 163,
+    92, 44, 178, 230, 38, 48, 17, 33, 50, 195, 203, 91, 158, 179, 228, 226, 127, 231, 199, 103,
+    29, 54, 98, 49, 237, 14, 48, 205, 163, 58, 39, 204, 175, 69, 159, 10, 85, 206, 125, 56,
+    77, 17, 48, 127, 59, 71, 189, 176, 138, 46, 248, 3, 28, 172, 243, 174, 195, 73, 201, 209,
+    117, 175, 52, 39, 213, 212, 5, 39, 254, 143, 135, 76, 145, 130, 148, 132, 35, 95, 0, 63,
+    63, 63, 57, 69, 247, 206, 161, 136, 12, 62, 173, 62, 172, 23, 88, 87, 0, 63, 24, 87,
+    126, 79, 0, 148, 152, 143, 44, 133, 14, 6, 118, 68, 103, 214, 7, 107, 122, 119, 156, 24,
+    219, 193, 172, 184, 182, 208, 149, 30, 225, 149, 47, 248, 245, 100, 229, 248, 101, 91, 230, 144,
+    44, 37, 9, 138, 250, 243, 203, 250, 63, 63, 14, 0, 63, 11, 127, 76, 0, 77, 0, 78,
+    0, 79, 0, 80, 0, 81, 0, 82, 0, 83, 0, 84, 0, 85, 0, 86, 0, 87, 0, 88,
+    0, 89, 0, 90, 0, 91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96, 0, 97, 0, 98,
+    0, 99, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106, 0, 107, 0, 108,
+    0, 109, 0, 110, 0, 111, 0, 112, 0, 113, 0, 114, 0, 115, 0, 116, 0, 117, 0, 118,
+    0, 119, 0, 120, 0, 121, 0, 122, 0, 123, 0, 124, 0, 125, 0, 126, 0, 127, 0, 128,
+    0, 129, 0, 130, 0, 131, 0, 132, 0, 133, 0, 134, 0, 135, 0, 136, 0, 137, 0, 138,
+    0, 139, 0, 83, 140, 0, 141, 0, 142, 0, 143, 0, 144, 0, 145, 0, 146, 0, 147, 0,
+    148, 0, 149, 0, 150, 0, 151, 0, 152, 0, 153, 0, 154, 0, 155, 0, 156, 0, 157, 0,
+    158, 0, 159, 0, 63, 31, 0, 63, 63, 60, 127, 189, 0, 190, 0, 191, 0, 192, 0, 193,
+    0, 194, 0, 195, 0, 196, 0, 197, 0, 198, 0, 199, 0, 200, 0, 201, 0, 202, 0, 203,
+    0, 204, 0, 205, 0, 206, 0, 207, 0, 208, 0, 209, 0, 210, 0, 211, 0, 212, 0, 213,
+    0, 214, 0, 215, 0, 216, 0, 217, 0, 218, 0, 219, 0, 220, 0, 221, 0, 222, 0, 223,
+    0, 224, 0, 225, 0, 226, 0, 227, 0, 228, 0, 229, 0, 230, 0, 231, 0, 232, 0, 233,
+    0, 234, 0, 235, 0, 236, 0, 237, 0, 238, 0, 239, 0, 240, 0, 241, 0, 242, 0, 243,
+    0, 244, 0, 245, 0, 246, 0, 247, 0, 248, 0, 249, 0, 250, 0, 251, 0, 252, 0, 66,
+    253, 0, 254, 0, 255, 0, 0, 50, 126, 51, 0, 52, 0, 53, 0, 54, 0, 55, 0, 56,
+    0, 57, 0, 58, 0, 59, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 65, 0, 66,
+    0, 67, 0, 68, 0, 69, 0, 70, 0, 71, 0, 72, 0, 73, 0, 74, 0, 75, 0, 76,
+    0, 77, 0, 78, 0, 79, 0, 80, 0, 81, 0, 82, 0, 83, 0, 84, 0, 85, 0, 86,
+    0, 87, 0, 88, 0, 89, 0, 90, 0, 91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96,
+    0, 97, 0, 98, 0, 99, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106,
+    0, 107, 0, 108, 0, 109, 0, 110, 0, 111, 0, 112, 0, 113, 0, 63, 63, 13, 1, 3,
+    174, 193, 105, 77, 242, 105, 245, 105, 244, 105, 247, 105, 246, 105, 130, 54, 131, 54, 128, 54,
+    129, 54, 134, 54, 135, 54, 132, 54, 133, 54, 250, 54, 138, 186, 54, 101, 246, 54, 247, 54,
+    244, 54, 245, 54, 234, 54, 235, 54, 232, 54, 233, 54, 238, 54, 239, 54, 236, 54, 237, 54,
+    226, 54, 157, 121, 224, 162, 121, 185, 202, 179, 233, 48, 146, 114, 130, 224, 221, 93, 161, 65,
+    68, 46, 2, 247, 114, 142, 105, 230, 73, 40, 60, 163, 253, 206, 38, 82, 53, 206, 180, 109,
+    48, 166, 251, 19, 221, 188, 47, 197, 1, 204, 203, 54, 131, 186, 54, 127, 176, 192, 51, 209,
+    135, 140, 6, 199, 207, 101, 14, 196, 198, 238, 168, 120, 123, 244, 91, 247, 209, 177, 91, 22,
+    62, 154, 7, 100, 236, 78, 103, 38, 155, 151, 142, 65, 108, 167, 8, 249, 38, 248, 236, 238,
+    100, 107, 1, 190, 160, 165, 28, 47, 72, 184, 135, 217, 52, 156, 83, 156, 205, 1, 230, 115,
+    206, 125, 245, 87, 213, 48, 174, 83, 82, 71, 181, 254, 70, 12, 170, 237, 36, 98, 137, 225,
+    99, 222, 133, 185, 51, 223, 80, 117, 141, 80, 119, 199, 118, 252, 79, 9, 58, 151, 161, 145,
+    7, 236, 200, 184, 144, 210, 213, 17, 171, 213, 174, 160, 242, 178, 41, 21, 101, 27, 53, 83,
+    5, 93, 240, 207, 90, 121, 221, 209, 139, 171, 141, 191, 177, 107, 190, 54, 35, 10, 254, 213,
+    121, 190, 231, 230, 67, 69, 7, 192, 137, 248, 74, 174, 219, 5, 135, 24, 121, 153, 41, 33,
+    83, 104, 4, 89, 240, 57, 215, 178, 130, 132, 16, 34, 176, 118, 191, 215, 222, 204, 237, 155,
+    56, 240, 82, 52, 3, 187, 171, 60, 143, 167, 239, 49, 87, 97, 0, 253, 164, 121, 71, 169,
+    66, 157, 168, 105, 159, 96, 150, 199, 135, 108, 71, 109, 71, 106, 71, 107, 71, 104, 71, 105,
+    71, 0, 63, 63, 63, 58, 68, 74, 157, 77, 157, 76, 157, 79, 157, 78, 157, 0, 63, 20,
+    70, 68, 122, 71, 122, 70, 122, 73, 122, 54, 53, 75, 238, 210, 245, 63, 63, 35, 0, 63,
+    63, 63, 3, 76, 124, 143, 97, 113, 224, 33, 88, 91, 17, 12, 32, 248, 64, 223, 203, 138,
+    253, 24, 91, 184, 15, 183, 174, 214, 181, 229, 155, 65, 248, 77, 77, 11, 194, 163, 69, 135,
+    222, 231, 72, 95, 24, 8, 132, 172, 0, 79, 208, 74, 228, 160, 16, 151, 25, 158, 190, 143,
+    21, 79, 132, 94, 210, 1, 3, 174, 193, 105, 77, 242, 105, 245, 105, 244, 105, 247, 105, 246,
+    105, 130, 54, 131, 54, 128, 54, 129, 54, 134, 54, 135, 54, 132, 54, 133, 54, 250, 54, 138,
+    186, 54, 72, 246, 54, 247, 54, 244, 54, 245, 54, 234, 54, 235, 54, 232, 54, 233, 54, 238,
+    54, 134, 171, 76, 78, 202, 179, 233, 48, 146, 114, 130, 224, 221, 93, 161, 65, 68, 46, 2,
+    247, 114, 142, 105, 230, 73, 40, 60, 163, 253, 206, 38, 82, 53, 206, 191, 131, 159, 142, 131,
+    159, 73, 107, 190, 54, 35, 10, 254, 213, 121, 190, 231, 230, 67, 69, 7, 192, 137, 248, 74,
+    174, 219, 187, 121, 8, 0, 63, 63, 45, 78, 174, 0, 175, 0, 176, 0, 177, 0, 178, 0,
+    179, 0, 180, 0, 181, 0, 182, 0, 183, 0, 184, 0, 185, 0, 186, 0, 187, 0, 188, 0,
+    63, 2, 1, 3, 172, 193, 105, 191, 97, 181, 191, 97, 181, 147, 97, 181, 186, 121, 8, 0,
+    63, 63, 63, 24, 102, 217, 0, 218, 0, 219, 0, 220, 0, 221, 0, 222, 0, 223, 0, 224,
+    0, 225, 0, 226, 0, 227, 0, 228, 0, 229, 0, 230, 0, 231, 0, 232, 0, 233, 0, 234,
+    0, 235, 0, 236, 0, 237, 0, 238, 0, 239, 0, 240, 0, 241, 0, 242, 0, 243, 0, 244,
+    0, 245, 0, 246, 0, 247, 0, 248, 0, 249, 0, 250, 0, 251, 0, 252, 0, 253, 0, 254,
+    0, 255, 0, 0, 63, 63, 63, 8, 118, 28, 254, 194, 197, 233, 219, 85, 167, 40, 151, 237,
+    93, 247, 35, 211, 200, 11, 215, 236, 148, 114, 20, 104, 22, 146, 33, 233, 219, 176, 159, 47,
+    59, 128, 58, 56, 230, 108, 243, 9, 89, 17, 199, 174, 49, 251, 155, 30, 107, 23, 42, 244,
+    33, 96, 83, 1, 232, 77, 254, 0, 125, 244, 1, 76, 9, 79, 96, 60, 110, 61, 65, 21,
+    61, 201, 193, 101, 100, 153, 65, 112, 218, 184, 201, 119, 251, 132, 126, 119, 6, 247, 189, 45,
+    126, 224, 141, 248, 39, 34, 99, 116, 218, 183, 190, 44, 247, 205, 229, 200, 214, 32, 93, 0,
+    63, 63, 63, 61, 65, 254, 0, 255, 0, 0, 43, 127, 44, 0, 45, 0, 46, 0, 47, 0,
+    48, 0, 49, 0, 50, 0, 51, 0, 52, 0, 53, 0, 54, 0, 55, 0, 56, 0, 57, 0,
+    58, 0, 59, 0, 60, 0, 61, 0, 62, 0, 63, 0, 64, 0, 65, 0, 66, 0, 67, 0,
+    68, 0, 69, 0, 70, 0, 71, 0, 72, 0, 73, 0, 74, 0, 75, 0, 76, 0, 77, 0,
+    78, 0, 79, 0, 80, 0, 81, 0, 82, 0, 83, 0, 84, 0, 85, 0, 86, 0, 87, 0,
+    88, 0, 89, 0, 90, 0, 91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96, 0, 97, 0,
+    98, 0, 99, 0, 100, 0, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106, 0, 107, 0,
+    127, 108, 0, 109, 0, 110, 0, 111, 0, 112, 0, 113, 0, 114, 0, 115, 0, 116, 0, 117,
+    0, 118, 0, 119, 0, 120, 0, 121, 0, 122, 0, 123, 0, 124, 0, 125, 0, 126, 0, 127,
+    0, 128, 0, 129, 0, 130, 0, 131, 0, 132, 0, 133, 0, 134, 0, 135, 0, 136, 0, 137,
+    0, 138, 0, 139, 0, 140, 0, 141, 0, 142, 0, 143, 0, 144, 0, 145, 0, 146, 0, 147,
+    0, 148, 0, 149, 0, 150, 0, 151, 0, 152, 0, 153, 0, 154, 0, 155, 0, 156, 0, 157,
+    0, 158, 0, 159, 0, 160, 0, 161, 0, 162, 0, 163, 0, 164, 0, 165, 0, 166, 0, 167,
+    0, 168, 0, 169, 0, 170, 0, 171, 0, 127, 172, 0, 173, 0, 174, 0, 175, 0, 176, 0,
+    177, 0, 178, 0, 179, 0, 180, 0, 181, 0, 182, 0, 183, 0, 184, 0, 185, 0, 186, 0,
+    187, 0, 188, 0, 189, 0, 190, 0, 191, 0, 192, 0, 193, 0, 194, 0, 195, 0, 196, 0,
+    197, 0, 198, 0, 199, 0, 200, 0, 201, 0, 202, 0, 203, 0, 204, 0, 205, 0, 206, 0,
+    207, 0, 208, 0, 209, 0, 210, 0, 211, 0, 212, 0, 213, 0, 214, 0, 215, 0, 216, 0,
+    217, 0, 218, 0, 219, 0, 220, 0, 221, 0, 222, 0, 223, 0, 224, 0, 225, 0, 226, 0,
+    227, 0, 228, 0, 229, 0, 230, 0, 231, 0, 232, 0, 233, 0, 234, 0, 235, 0, 83, 236,
+    0, 237, 0, 238, 0, 239, 0, 240, 0, 241, 0, 242, 0, 243, 0, 244, 0, 245, 0, 246,
+    0, 247, 0, 248, 0, 249, 0, 250, 0, 251, 0, 252, 0, 253, 0, 254, 0, 255, 0, 0,
+    39, 131, 158, 19, 127, 178, 19, 179, 19, 176, 19, 177, 19, 174, 19, 15, 207, 12, 207, 13,
+    207, 10, 207, 11, 207, 8, 207, 9, 207, 6, 207, 7, 207, 4, 207, 5, 207, 2, 207, 3,
+    207, 0, 207, 1, 207, 126, 207, 127, 207, 124, 207, 125, 207, 122, 207, 123, 207, 120, 207, 121,
+    207, 118, 207, 119, 207, 116, 207, 117, 207, 114, 207, 115, 207, 112, 207, 113, 207, 110, 207, 111,
+    207, 108, 207, 109, 207, 106, 207, 107, 207, 104, 207, 105, 207, 102, 207, 103, 207, 100, 207, 101,
+    207, 98, 207, 99, 207, 96, 207, 97, 207, 94, 207, 95, 207, 92, 207, 93, 207, 90, 207, 91,
+    207, 88, 207, 89, 207, 86, 207, 87, 207, 84, 207, 85, 207, 100, 82, 207, 83, 207, 80, 207,
+    81, 207, 78, 207, 79, 207, 76, 207, 77, 207, 74, 207, 75, 207, 72, 207, 73, 207, 70, 207,
+    71, 207, 68, 207, 69, 207, 66, 207, 67, 207, 64, 207, 65, 207, 190, 207, 191, 207, 188, 207,
+    189, 207, 186, 207, 187, 207, 184, 207, 185, 207, 182, 207, 183, 207, 180, 207, 181, 207, 178, 207,
+    179, 207, 176, 207, 177, 207, 174, 207, 63, 46, 0, 36, 127, 37, 0, 38, 0, 39, 0, 40,
+    0, 41, 0, 42, 0, 43, 0, 44, 0, 45, 0, 46, 0, 47, 0, 48, 0, 49, 0, 50,
+    0, 51, 0, 52, 0, 53, 0, 54, 0, 55, 0, 56, 0, 57, 0, 58, 0, 59, 0, 60,
+    0, 61, 0, 62, 0, 63, 0, 64, 0, 65, 0, 66, 0, 67, 0, 68, 0, 69, 0, 70,
+    0, 71, 0, 72, 0, 73, 0, 74, 0, 75, 0, 76, 0, 77, 0, 78, 0, 79, 0, 80,
+    0, 81, 0, 82, 0, 83, 0, 84, 0, 85, 0, 86, 0, 87, 0, 88, 0, 89, 0, 90,
+    0, 91, 0, 92, 0, 93, 0, 94, 0, 95, 0, 96, 0, 97, 0, 98, 0, 99, 0, 100,
+    0, 121, 101, 0, 102, 0, 103, 0, 104, 0, 105, 0, 106, 0, 107, 0, 108, 0, 109, 0,
+    110, 0, 111, 0, 112, 0, 113, 0, 114, 0, 115, 0, 116, 0, 117, 0, 118, 0, 119, 0,
+    120, 0, 121, 0, 122, 0, 123, 0, 124, 0, 125, 0, 126, 0, 127, 0, 128, 0, 129, 0,
+    130, 0, 131, 0, 132, 0, 133, 0, 134, 0, 135, 0, 136, 0, 137, 0, 138, 0, 139, 0,
+    140, 0, 141, 0, 142, 0, 143, 0, 144, 0, 145, 0, 146, 0, 147, 0, 148, 0, 149, 0,
+    150, 0, 151, 0, 152, 0, 153, 0, 154, 0, 155, 0, 156, 0, 157, 0, 158, 0, 63, 32,
+    0, 63, 63, 22, 135, 192, 105, 127, 95, 105, 96, 105, 97, 105, 98, 105, 99, 105, 100, 105,
+    101, 105, 102, 105, 103, 105, 104, 105, 105, 105, 106, 105, 107, 105, 108, 105, 109, 105, 110, 105,
+    111, 105, 112, 105, 113, 105, 114, 105, 115, 105, 116, 105, 117, 105, 118, 105, 119, 105, 120, 105,
+    121, 105, 122, 105, 123, 105, 124, 105, 125, 105, 126, 105, 127, 105, 0, 105, 1, 105, 2, 105,
+    3, 105, 4, 105, 29, 212, 30, 212, 31, 212, 16, 212, 13, 42, 208, 17, 250, 15, 65, 115,
+    61, 67, 251, 137, 224, 247, 219, 28, 2, 3, 230, 64, 121, 192, 100, 194, 159, 245, 231, 15,
+    191, 75, 47, 239, 88, 238, 224, 50, 180, 39, 209, 141, 201, 19, 118, 229, 96, 35, 79, 198,
+    191, 207, 254, 44, 245, 184, 135, 217, 60, 149, 42, 216, 169, 44, 213, 148, 221, 151, 180, 228,
+    186, 229, 149, 205, 233, 17, 21, 189, 176, 65, 149, 168, 14, 96, 29, 175, 47, 92, 170, 175,
+    210, 47, 105, 245, 170, 56, 89, 32, 243, 250, 183, 172, 14, 111, 106, 244, 35, 21, 49, 238,
+    2, 7, 137, 0, 50, 90, 135, 65, 95, 35, 72, 70, 69, 117, 157, 96, 137, 13, 2, 23,
+    26, 173, 160, 196, 72, 22, 188, 29, 65, 97, 109, 105, 14, 156, 124, 15, 201, 107, 223, 126,
+    24, 92, 28, 201, 135, 87, 2, 140, 177, 154, 11, 223, 215, 228, 146, 8, 207, 24, 46, 113,
+    63, 63, 49, 0, 63, 63, 63, 3, 123, 200, 13, 15, 220, 119, 94, 191, 206, 18, 18, 51,
+    23, 3, 171, 235, 146, 73, 188, 122, 103, 176, 54, 236, 65, 45, 55, 159, 171, 232, 32, 93,
+    206, 192, 52, 12, 152, 12, 92, 203, 234, 204, 247, 255, 92, 67, 1, 74, 73, 82, 186, 101,
+    147, 107, 238, 178, 71, 214, 51, 53, 73, 42, 102, 22, 66, 31, 99, 96, 249, 41, 172, 75,
+    224, 107, 96, 222, 229, 199, 40, 161, 53, 64, 229, 227, 255, 169, 114, 44, 29, 38, 96, 31,
+    158, 48, 237, 199, 120, 223, 220, 73, 228, 201, 63, 60, 94, 109, 231, 82, 135, 143, 0, 40,
+    40, 21, 126, 242, 183, 104, 208, 26, 209, 1, 3, 160, 193, 105, 127, 228, 105, 231, 105, 230,
+    105, 119, 122, 118, 122, 117, 122, 116, 122, 115, 122, 114, 122, 113, 122, 112, 122, 111, 122, 110,
+    122, 109, 122, 235, 59, 52, 89, 34, 60, 44, 15, 245, 26, 238, 119, 100, 109, 127, 215, 196,
+    190, 43, 108, 222, 103, 32, 27, 13, 19, 17, 230, 98, 117, 212, 17, 195, 4, 3, 38, 6,
+    179, 158, 45, 26, 246, 166, 224, 29, 165, 194, 158, 134, 114, 220, 98, 60, 11, 17, 122, 16,
+    122, 15, 122, 14, 122, 13, 122, 12, 122, 11, 122, 10, 122, 9, 122, 8, 122, 7, 122, 6,
+    122, 5, 122, 4, 122, 3, 122, 2, 122, 1, 122, 0, 122, 63, 122, 62, 122, 61, 122, 60,
+    122, 59, 122, 107, 58, 122, 57, 122, 56, 122, 55, 122, 54, 122, 53, 122, 52, 122, 51, 122,
+    50, 122, 49, 122, 48, 122, 47, 122, 46, 122, 45, 122, 44, 122, 43, 122, 42, 122, 41, 122,
+    40, 122, 39, 122, 38, 122, 37, 122, 36, 122, 35, 122, 34, 122, 33, 122, 32, 122, 223, 122,
+    222, 122, 221, 122, 220, 122, 219, 122, 218, 122, 217, 122, 216, 122, 215, 122, 214, 122, 213, 122,
+    212, 122, 211, 122, 210, 122, 209, 122, 208, 122, 207, 122, 133, 97, 181, 162, 161, 220, 127, 163,
+    147, 35, 83, 75, 170, 133, 164, 114, 161, 187, 140, 58, 246, 133, 165, 107, 170, 248, 156, 14,
+    64, 157, 188, 18, 86, 143, 157, 234, 141, 159, 145, 43, 162, 114, 137, 50, 214, 161, 127, 187,
+    38, 215, 176, 138, 227, 246, 40, 5, 154, 50, 109, 215, 120, 50, 75, 141, 148, 53, 21, 60,
+    181, 42, 211, 24, 149, 214, 48, 29, 184, 241, 48, 169, 68, 72, 237, 30, 133, 219, 235, 132,
+    250, 255, 208, 36, 40, 124, 118, 45, 128, 175, 175, 82, 25, 169, 66, 104, 21, 77, 222, 12,
+    225, 117, 21, 58, 180, 12, 167, 246, 251, 52, 155, 230, 148, 96, 253, 245, 254, 122, 59, 240,
+    241, 254, 113, 44, 251, 28, 45, 69, 29, 12, 216, 102, 255, 33, 44, 202, 112, 110, 36, 131,
+    0, 17, 64, 151, 14, 63, 63, 63, 44,
+};
+
+static constexpr uint32_t CODEC_POOL_OFFSETS[167] = {
+    0, 9, 19, 27, 46, 99, 111, 220, 266, 454,
+    564, 575, 595, 725, 830, 930, 1082, 1093, 1107, 1133,
+    1191, 1217, 1224, 1288, 1333, 1340, 1625, 1762, 1948, 2062,
+    2087, 2143, 2347, 2355, 2366, 2377, 2387, 2400, 2415, 2461,
+    2519, 2568, 2683, 2775, 2786, 2808, 2875, 2929, 2984, 3108,
+    3118, 3127, 3149, 3201, 3218, 3225, 3259, 3304, 3311, 3471,
+    3553, 3649, 3726, 3747, 3792, 3917, 3928, 3937, 3947, 3960,
+    3974, 4020, 4033, 4082, 4130, 4232, 4315, 4324, 4345, 4403,
+    4450, 4496, 4607, 4616, 4627, 4658, 4705, 4721, 4731, 4761,
+    4804, 4811, 4946, 5017, 5097, 5167, 5188, 5233, 5348, 5356,
+    5367, 5376, 5386, 5398, 5419, 5484, 5496, 5573, 5652, 5816,
+    5960, 5972, 6004, 6095, 6168, 6237, 6414, 6425, 6439, 6478,
+    6544, 6566, 6578, 6623, 6685, 6693, 6911, 7021, 7149, 7254,
+    7287, 7353, 7543, 7551, 7561, 7572, 7584, 7601, 7637, 7761,
+    7778, 7925, 8077, 8396, 8678, 8696, 8751, 8926, 9066, 9198,
+    9541, 9557, 9578, 9645, 9765, 9802, 9819, 9903, 10019, 10029,
+    10459, 10670, 10920, 11123, 11183, 11309, 11680,
+};
+
+// 1 bit colours, stored at 1 bpp
+static constexpr uint16_t CODEC_FRAMES_1[34] = {
+    0, 1, 2, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+};
+
+static constexpr uint16_t CODEC_PALETTE_1[2] = {
+    1, 0,
+};
+
+// 2 bit colours, stored at 2 bpp
+static constexpr uint16_t CODEC_FRAMES_2[34] = {
+    33, 34, 35, 36, 37, 38, 36, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 32,
+};
+
+static constexpr uint16_t CODEC_PALETTE_2[4] = {
+    1, 2, 0, 3,
+};
+
+// 4 bit colours, stored at 4 bpp
+static constexpr uint16_t CODEC_FRAMES_4[34] = {
+    65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98,
+};
+
+static constexpr uint16_t CODEC_PALETTE_4[16] = {
+    1, 10, 6, 2, 0, 9, 7, 3, 15, 8, 5, 14, 11, 4, 12, 13,
+};
+
+// 8 bit colours, stored at 8 bpp
+static constexpr uint16_t CODEC_FRAMES_8[34] = {
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118,
+    119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
+};
+
+static constexpr uint16_t CODEC_PALETTE_8[256] = {
+    193, 186, 97, 214, 18, 0, 161, 121, 131, 151, 95, 56, 171, 213, 209, 53, 221, 5, 245, 230,
+    14, 51, 52, 62, 242, 236, 38, 58, 60, 104, 133, 174, 246, 1, 7, 135, 150, 141, 215, 216,
+    54, 218, 253, 36, 91, 107, 114, 200, 207, 235, 28, 34, 44, 118, 247, 13, 105, 192, 233, 240,
+    244, 10, 39, 41, 130, 132, 206, 6, 22, 42, 48, 144, 248, 8, 29, 47, 80, 108, 119, 180,
+    217, 220, 232, 238, 255, 2, 9, 12, 46, 50, 68, 79, 110, 202, 212, 222, 249, 17, 24, 33,
+    43, 55, 57, 89, 103, 142, 143, 160, 211, 223, 224, 234, 251, 16, 32, 72, 100, 129, 205, 219,
+    252, 49, 101, 109, 117, 158, 190, 198, 226, 228, 243, 11, 15, 25, 35, 45, 106, 112, 113, 134,
+    157, 166, 170, 172, 181, 187, 191, 239, 250, 3, 73, 99, 115, 128, 146, 169, 176, 203, 204, 208,
+    210, 231, 254, 19, 21, 30, 69, 70, 77, 155, 196, 201, 23, 37, 40, 59, 82, 123, 162, 199,
+    237, 241, 4, 26, 63, 83, 84, 85, 96, 98, 111, 127, 137, 147, 153, 156, 163, 195, 225, 61,
+    87, 178, 183, 194, 197, 88, 92, 116, 122, 152, 168, 175, 27, 65, 75, 90, 93, 102, 120, 167,
+    188, 20, 31, 71, 74, 81, 140, 148, 149, 159, 227, 86, 165, 177, 184, 189, 229, 66, 94, 124,
+    126, 138, 139, 145, 179, 185, 64, 136, 154, 164, 173, 182, 67, 76, 78, 125,
+};
+
+// 16 bit colours, stored at 16 bpp
+static constexpr uint16_t CODEC_FRAMES_16[34] = {
+    133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152,
+    153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166,
+};
+
+struct CodecFixture {
+    uint8_t colorBits;
+    uint8_t bpp;
+    const uint16_t* frames;
+    const uint16_t* palette; // nullptr for raw RGB565
+};
+
+static constexpr CodecFixture CODEC_FIXTURES[5] = {
+    {1, 1, CODEC_FRAMES_1, CODEC_PALETTE_1},
+    {2, 2, CODEC_FRAMES_2, CODEC_PALETTE_2},
+    {4, 4, CODEC_FRAMES_4, CODEC_PALETTE_4},
+    {8, 8, CODEC_FRAMES_8, CODEC_PALETTE_8},
+    {16, 16, CODEC_FRAMES_16, nullptr},
+};
+
+#endif // CODEC_FIXTURES_H
@@ -0,0 +1,125 @@
+// Decodes animations encoded by encode_frames() in scripts/convert.py (fixtures.h, regenerate it with
+// `python3 scripts/codec_fixtures.py`) and checks that FrameDecoder gives every frame back exactly,
+// sequentially and when seeking. Run with: pio test -e native
+#include <unity.h>
+#include <vector>
+#include "FrameCodec.h"
+#include "fixtures.h"
+
+static const uint16_t PIXELS = CODEC_FIXTURE_PIXELS;
+
+typedef std::vector<uint16_t> Colors;
+
+static uint32_t seed;
+
+static uint32_t nextRandom() {
+    seed = seed * 1664525 + 1013904223;
+    return seed >> 8;
+}
+
+// Frames mixing noise, solid runs longer than one op and regions left unchanged from the previous frame.
+// Must match make_frames() in scripts/codec_fixtures.py, which encoded them.
+static std::vector<Colors> makeFrames(uint8_t bits) {
+    uint16_t mask = (1UL << bits) - 1;
+    std::vector<Colors> frames;
+    Colors frame(PIXELS, 0);
+    seed = CODEC_FIXTURE_SEED;
+    for (uint16_t f = 0; f < CODEC_FIXTURE_FRAMES; f++) {
+        uint16_t start = nextRandom() % PIXELS;
+        uint16_t length = nextRandom() % PIXELS;
+        uint8_t kind = nextRandom() % 3;
+        uint16_t fill = nextRandom() & mask;
+        for (uint16_t i = start; i < start + length && i < PIXELS; i++) {
+            frame[i] = kind == 0 ? nextRandom() & mask : (kind == 1 ? fill : frame[i] ^ (i & mask));
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+static uint16_t durations[CODEC_FIXTURE_FRAMES];
+
+static Animation animation(const CodecFixture& fixture) {
+    return {"roundtrip", CODEC_FIXTURE_FRAMES, 16, 16, fixture.bpp, 0, 0, durations, fixture.frames,
+            fixture.palette, CODEC_POOL, CODEC_POOL_OFFSETS};
+}
+
+static uint16_t plane[PIXELS];
+static FrameDecoder decoder(plane, PIXELS);
+
+static void assertFrame(const CodecFixture& fixture, const Colors& expected, uint16_t frame) {
+    Colors decoded(PIXELS);
+    for (uint16_t i = 0; i < PIXELS; i++) {
+        decoded[i] = fixture.palette ? fixture.palette[plane[i]] : plane[i];
+    }
+    char message[48];
+    snprintf(message, sizeof(message), "%u bpp, frame %u", fixture.bpp, frame);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected.data(), decoded.data(), sizeof(plane), message);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_keyframe_round_trip() {
+    for (const CodecFixture& fixture : CODEC_FIXTURES) {
+        std::vector<Colors> frames = makeFrames(fixture.colorBits);
+        for (uint16_t f = 0; f < CODEC_FIXTURE_FRAMES; f += CODEC_KEYFRAME_INTERVAL) {
+            const uint8_t* blob = CODEC_POOL + CODEC_POOL_OFFSETS[fixture.frames[f]];
+            TEST_ASSERT_EQUAL(FRAME_KEY, blob[0] & FRAME_KEY);
+            memset(plane, 0xAA, sizeof(plane));
+            decodeFrame(blob, plane, PIXELS, fixture.bpp);
+            assertFrame(fixture, frames[f], f);
+        }
+    }
+}
+
+void test_sequential_round_trip() {
+    for (const CodecFixture& fixture : CODEC_FIXTURES) {
+        std::vector<Colors> frames = makeFrames(fixture.colorBits);
+        Animation anim = animation(fixture);
+        decoder.begin(&anim);
+        for (uint16_t f = 0; f < frames.size(); f++) {
+            decoder.seek(f);
+            assertFrame(fixture, frames[f], f);
+        }
+    }
+}
+
+void test_seek_replays_from_keyframe() {
+    for (const CodecFixture& fixture : CODEC_FIXTURES) {
+        std::vector<Colors> frames = makeFrames(fixture.colorBits);
+        Animation anim = animation(fixture);
+        decoder.begin(&anim);
+        // Backwards, across keyframes, and forwards skipping frames
+        const uint16_t order[] = {33, 0, 17, 15, 16, 33, 2, 31, 32, 5};
+        for (uint16_t f : order) {
+            decoder.seek(f);
+            assertFrame(fixture, frames[f], f);
+        }
+    }
+}
+
+void test_decoder_stays_in_plane_on_corrupt_frame() {
+    // A run longer than the plane and an unknown op
+    uint16_t guarded[PIXELS + 8];
+    const uint8_t blob[] = {FRAME_KEY, FRAME_OP_FILL << 6 | 63, 1, FRAME_OP_FILL << 6 | 63, 2, FRAME_OP_FILL << 6 | 63, 3,
+                            FRAME_OP_FILL << 6 | 63, 4, FRAME_OP_FILL << 6 | 63, 5, 0xFF};
+    for (uint16_t& value : guarded) {
+        value = 0xBEEF;
+    }
+    decodeFrame(blob, guarded, PIXELS, 4);
+    TEST_ASSERT_EQUAL(4, guarded[PIXELS - 1]);
+    for (uint16_t i = PIXELS; i < PIXELS + 8; i++) {
+        TEST_ASSERT_EQUAL_HEX16(0xBEEF, guarded[i]);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_keyframe_round_trip);
+    RUN_TEST(test_sequential_round_trip);
+    RUN_TEST(test_seek_replays_from_keyframe);
+    RUN_TEST(test_decoder_stays_in_plane_on_corrupt_frame);
+    return UNITY_END();
+}
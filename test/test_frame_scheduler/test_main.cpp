@@ -0,0 +1,151 @@
+// Plays a synthetic animation through FrameScheduler on a virtual clock, with a fixed render cost and
+// periodic stalls, and checks what every drop policy promises. Run with: pio test -e native
+#include <unity.h>
+#include "FrameScheduler.h"
+
+static const uint32_t FRAME_MS = 40;
+static const uint32_t RENDER_MS = 2;
+static const uint32_t POLL_MS = 10;       // Longest sleep of the render task, like RENDER_POLL_MS
+static const uint32_t DURATION_MS = 60000;
+static const uint32_t EXPECTED_FRAMES = DURATION_MS / FRAME_MS;
+
+static uint32_t frameDuration(uint16_t) {
+    return FRAME_MS;
+}
+
+struct PacingRun {
+    FrameStats stats;
+    uint32_t stalls;
+};
+
+// The render loop of the firmware: update, render when a frame is due, sleep until the next one. A stall
+// of stallMs once per second stands in for a busy network.
+static PacingRun play(FrameDropPolicy policy, uint32_t stallMs, uint32_t start = 0) {
+    FrameScheduler scheduler(policy);
+    uint32_t now = start;
+    uint32_t nextStall = start + 1000;
+    uint16_t frame = 0;
+    PacingRun run = {};
+    scheduler.start(now);
+
+    while (now - start < DURATION_MS) {
+        if (scheduler.update(now, frame, 50, frameDuration)) {
+            now += RENDER_MS;
+        }
+        if (stallMs > 0 && (int32_t)(now - nextStall) >= 0) {
+            now += stallMs;
+            nextStall += 1000;
+            run.stalls++;
+        }
+        uint32_t wait = scheduler.untilDue(now);
+        now += wait > POLL_MS ? POLL_MS : wait;
+    }
+    run.stats = scheduler.stats();
+    return run;
+}
+
+// The last frame may still be on screen when the run ends
+static void assertOnTimeline(uint32_t frames) {
+    TEST_ASSERT_UINT32_WITHIN(1, EXPECTED_FRAMES, frames);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_no_drift_without_stalls() {
+    const FrameDropPolicy policies[] = {FRAME_DROP_SKIP, FRAME_DROP_CATCH_UP, FRAME_DROP_RESYNC};
+    for (FrameDropPolicy policy : policies) {
+        PacingRun run = play(policy, 0);
+        assertOnTimeline(run.stats.frames);
+        TEST_ASSERT_EQUAL(0, run.stats.dropped);
+        TEST_ASSERT_EQUAL(0, run.stats.lateFrames);
+    }
+}
+
+void test_no_drift_across_millis_wrap() {
+    PacingRun run = play(FRAME_DROP_SKIP, 0, 0xFFFFFFFF - DURATION_MS / 2);
+    assertOnTimeline(run.stats.frames);
+    TEST_ASSERT_EQUAL(0, run.stats.lateFrames);
+}
+
+void test_skip_keeps_timeline_under_stalls() {
+    const uint32_t stallMs = 150;
+    PacingRun run = play(FRAME_DROP_SKIP, stallMs);
+    TEST_ASSERT_GREATER_THAN(0, run.stalls);
+    assertOnTimeline(run.stats.frames + run.stats.dropped);
+    // A stall covers at most this many frames, and the frame shown after it is inside its own slot
+    TEST_ASSERT_LESS_OR_EQUAL(run.stalls * ((stallMs + FRAME_MS - 1) / FRAME_MS), run.stats.dropped);
+    TEST_ASSERT_LESS_THAN(FRAME_MS, run.stats.maxLateness);
+}
+
+void test_catch_up_shows_every_frame_under_stalls() {
+    PacingRun run = play(FRAME_DROP_CATCH_UP, 150);
+    TEST_ASSERT_EQUAL(0, run.stats.dropped);
+    assertOnTimeline(run.stats.frames);
+}
+
+void test_resync_delays_only_the_stalled_frame() {
+    const uint32_t stallMs = 150;
+    PacingRun run = play(FRAME_DROP_RESYNC, stallMs);
+    TEST_ASSERT_EQUAL(0, run.stats.dropped);
+    // The timeline restarts after the late frame, so no lateness carries over into the next ones
+    TEST_ASSERT_LESS_OR_EQUAL(run.stalls, run.stats.lateFrames);
+    TEST_ASSERT_LESS_OR_EQUAL(stallMs, run.stats.maxLateness);
+    // The animation slows down by the stalls instead
+    TEST_ASSERT_LESS_THAN(EXPECTED_FRAMES, run.stats.frames);
+}
+
+void test_pause_holds_frame() {
+    FrameScheduler scheduler;
+    uint16_t frame = 3;
+    scheduler.start(0);
+    TEST_ASSERT_TRUE(scheduler.update(0, frame, 10, frameDuration, 0));
+    for (uint32_t now = FRAME_MS; now < 10 * FRAME_MS; now += FRAME_MS) {
+        TEST_ASSERT_FALSE(scheduler.update(now, frame, 10, frameDuration, 0));
+        TEST_ASSERT_EQUAL(3, frame);
+    }
+    TEST_ASSERT_EQUAL(0, scheduler.stats().lateFrames);
+}
+
+void test_reverse_wraps_around() {
+    FrameScheduler scheduler;
+    uint16_t frame = 0;
+    scheduler.start(0);
+    TEST_ASSERT_TRUE(scheduler.update(0, frame, 10, frameDuration, -1));
+    TEST_ASSERT_TRUE(scheduler.update(FRAME_MS, frame, 10, frameDuration, -1));
+    TEST_ASSERT_EQUAL(9, frame);
+}
+
+void test_rate_scaling() {
+    TEST_ASSERT_EQUAL(FRAME_MS, FrameScheduler::scale(FRAME_MS, PLAYBACK_RATE_ONE));
+    TEST_ASSERT_EQUAL(FRAME_MS / 2, FrameScheduler::scale(FRAME_MS, 2 * PLAYBACK_RATE_ONE));
+    TEST_ASSERT_EQUAL(FRAME_MS * 2, FrameScheduler::scale(FRAME_MS, PLAYBACK_RATE_ONE / 2));
+    // Backwards plays at the same speed, and playback always moves on
+    TEST_ASSERT_EQUAL(FRAME_MS / 2, FrameScheduler::scale(FRAME_MS, -2 * PLAYBACK_RATE_ONE));
+    TEST_ASSERT_EQUAL(1, FrameScheduler::scale(1, 4 * PLAYBACK_RATE_ONE));
+    TEST_ASSERT_EQUAL(FRAME_MS * PLAYBACK_RATE_ONE, FrameScheduler::scale(FRAME_MS, 0));
+}
+
+void test_progress() {
+    FrameScheduler scheduler;
+    uint16_t frame = 0;
+    scheduler.start(0);
+    scheduler.update(0, frame, 10, frameDuration);
+    TEST_ASSERT_EQUAL(0, scheduler.progress(0, FRAME_MS));
+    TEST_ASSERT_EQUAL(PLAYBACK_RATE_ONE / 4, scheduler.progress(FRAME_MS / 4, FRAME_MS));
+    TEST_ASSERT_EQUAL(PLAYBACK_RATE_ONE, scheduler.progress(FRAME_MS, FRAME_MS));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_drift_without_stalls);
+    RUN_TEST(test_no_drift_across_millis_wrap);
+    RUN_TEST(test_skip_keeps_timeline_under_stalls);
+    RUN_TEST(test_catch_up_shows_every_frame_under_stalls);
+    RUN_TEST(test_resync_delays_only_the_stalled_frame);
+    RUN_TEST(test_pause_holds_frame);
+    RUN_TEST(test_reverse_wraps_around);
+    RUN_TEST(test_rate_scaling);
+    RUN_TEST(test_progress);
+    return UNITY_END();
+}
@@ -0,0 +1,218 @@
+// Streams packs through PackWriter into the emulated flash partition, the way /upload does, and reloads
+// them like CMD_RELOAD_PACK. Run with: pio test -e native
+#include <unity.h>
+#include "../PackBuilder.h"
+#include "PackWriter.h"
+
+static const uint16_t MAX_PIXELS = 256;
+static const uint32_t PARTITION_SIZE = 16 * PACK_WRITER_SECTOR_SIZE;
+static const size_t CHUNK_SIZE = 1000; // Not a multiple of the sector size, like the chunks of a request body
+
+static AnimationPack pack(MAX_PIXELS);
+static PackWriter writer;
+
+// Native frames are large enough for the pack to span a few sectors
+static std::vector<uint8_t> buildPack(const char* name, uint8_t frameCount) {
+    PackBuilder builder;
+    std::vector<uint16_t> frames;
+    for (uint8_t i = 0; i < frameCount; i++) {
+        frames.push_back(builder.addFrame(std::vector<uint8_t>(MAX_PIXELS * 3, i)));
+    }
+    builder.addAnimation(name, 16, 16, FRAME_NATIVE_BPP, frames);
+    return builder.build();
+}
+
+static bool upload(const std::vector<uint8_t>& data, size_t length) {
+    if (!writer.begin(pack)) {
+        return false;
+    }
+    for (size_t offset = 0; offset < length; offset += CHUNK_SIZE) {
+        if (!writer.write(data.data() + offset, min(CHUNK_SIZE, length - offset))) {
+            return false;
+        }
+    }
+    return writer.finish();
+}
+
+static bool upload(const std::vector<uint8_t>& data) {
+    return upload(data, data.size());
+}
+
+void setUp() {
+    simAddPartition(ANIMATION_PACK_PARTITION, ANIMATION_PACK_SUBTYPE, PARTITION_SIZE);
+    pack.begin();
+}
+
+void tearDown() {
+    pack.end();
+}
+
+void test_upload_into_empty_partition() {
+    TEST_ASSERT_EQUAL(0, pack.count());
+    TEST_ASSERT_EQUAL(0, simMappedCount());
+
+    std::vector<uint8_t> data = buildPack("first", 8);
+    TEST_ASSERT_TRUE_MESSAGE(upload(data), writer.error());
+    TEST_ASSERT_EQUAL(data.size(), writer.written());
+    TEST_ASSERT_TRUE(pack.begin());
+
+    TEST_ASSERT_EQUAL(1, pack.count());
+    TEST_ASSERT_EQUAL(0, pack.activeSlot());
+    TEST_ASSERT_EQUAL(1, pack.sequence());
+    TEST_ASSERT_EQUAL_STRING("first", pack.animation(0)->name);
+    TEST_ASSERT_EQUAL(8, pack.animation(0)->frameCount);
+    // Everything but the sequence stamped into the header is in flash as uploaded
+    const uint8_t* flash = simPartitionData(pack.partition());
+    TEST_ASSERT_EQUAL_MEMORY(data.data() + sizeof(PackHeader), flash + sizeof(PackHeader), data.size() - sizeof(PackHeader));
+    TEST_ASSERT_EQUAL(1, simMappedCount());
+}
+
+void test_upload_goes_to_free_slot() {
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_TRUE(upload(buildPack("second", 3)));
+    TEST_ASSERT_TRUE(pack.begin());
+
+    TEST_ASSERT_EQUAL(1, pack.activeSlot());
+    TEST_ASSERT_EQUAL(2, pack.sequence());
+    TEST_ASSERT_EQUAL_STRING("second", pack.animation(0)->name);
+    // The previous pack was unmapped when the new one was swapped in
+    TEST_ASSERT_EQUAL(1, simMappedCount());
+
+    // The third upload overwrites the older slot
+    TEST_ASSERT_TRUE(upload(buildPack("third", 5)));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(0, pack.activeSlot());
+    TEST_ASSERT_EQUAL(3, pack.sequence());
+    TEST_ASSERT_EQUAL_STRING("third", pack.animation(0)->name);
+}
+
+void test_corrupt_upload_keeps_current_pack() {
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+
+    std::vector<uint8_t> data = buildPack("second", 8);
+    data[data.size() / 2] ^= 0x10;
+    TEST_ASSERT_FALSE(upload(data));
+    TEST_ASSERT_EQUAL_STRING("Pack CRC mismatch", writer.error());
+
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(0, pack.activeSlot());
+    TEST_ASSERT_EQUAL_STRING("first", pack.animation(0)->name);
+}
+
+void test_interrupted_upload_keeps_current_pack() {
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_TRUE(upload(buildPack("second", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+
+    // Overwrites the slot of "first" and stops half way, its header is already erased
+    std::vector<uint8_t> data = buildPack("third", 8);
+    TEST_ASSERT_TRUE(writer.begin(pack));
+    TEST_ASSERT_TRUE(writer.write(data.data(), data.size() / 2));
+
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(1, pack.activeSlot());
+    TEST_ASSERT_EQUAL_STRING("second", pack.animation(0)->name);
+
+    // The next upload starts over
+    TEST_ASSERT_TRUE(upload(data));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL_STRING("third", pack.animation(0)->name);
+}
+
+void test_rejects_upload_larger_than_slot() {
+    std::vector<uint8_t> data = buildPack("huge", 45);
+    TEST_ASSERT_GREATER_THAN(PARTITION_SIZE / ANIMATION_PACK_SLOTS, data.size());
+    TEST_ASSERT_FALSE(upload(data));
+    TEST_ASSERT_EQUAL_STRING("Pack does not fit into the partition slot", writer.error());
+    TEST_ASSERT_FALSE(pack.begin());
+}
+
+void test_rejects_truncated_upload() {
+    std::vector<uint8_t> data = buildPack("first", 8);
+    TEST_ASSERT_FALSE(upload(data, data.size() - CHUNK_SIZE));
+    TEST_ASSERT_EQUAL_STRING("Pack size does not match its header", writer.error());
+    TEST_ASSERT_FALSE(pack.begin());
+}
+
+void test_upload_refused_while_reload_pending() {
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+    // Committed into slot 1, but not loaded yet: slot 0 plays and slot 1 is next
+    TEST_ASSERT_TRUE(upload(buildPack("second", 8)));
+
+    TEST_ASSERT_FALSE(upload(buildPack("third", 8)));
+    TEST_ASSERT_TRUE(writer.busy());
+    TEST_ASSERT_EQUAL_STRING("first", pack.animation(0)->name);
+
+    // Once loaded, the next upload goes into the slot of the first pack
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL_STRING("second", pack.animation(0)->name);
+    TEST_ASSERT_TRUE(upload(buildPack("third", 8)));
+    TEST_ASSERT_FALSE(writer.busy());
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(0, pack.activeSlot());
+    TEST_ASSERT_EQUAL(3, pack.sequence());
+}
+
+void test_upload_numbered_after_pack_in_flash() {
+    // Nothing loaded, as when the flashed pack could not be loaded at boot, yet a header is in slot 0
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(upload(buildPack("second", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_EQUAL(1, pack.activeSlot());
+    TEST_ASSERT_EQUAL(2, pack.sequence());
+}
+
+static const char* readName = nullptr;
+
+// Holds the pack like the /animations handler, across a reload requested meanwhile
+static void readerTask(void*) {
+    pack.lock();
+    const char* name = pack.animation(0)->name;
+    vTaskDelay(50);
+    readName = strcmp(name, "first") == 0 ? "first" : "unmapped";
+    pack.unlock();
+    vTaskDelete(nullptr);
+}
+
+static void reloadTask(void*) {
+    pack.begin();
+    vTaskDelete(nullptr);
+}
+
+void test_reload_waits_for_readers() {
+    TEST_ASSERT_TRUE(upload(buildPack("first", 8)));
+    TEST_ASSERT_TRUE(pack.begin());
+    TEST_ASSERT_TRUE(upload(buildPack("second", 8)));
+
+    xTaskCreatePinnedToCore(readerTask, "reader", 4096, nullptr, 1, nullptr, 0);
+    simRunTasks(10);
+    xTaskCreatePinnedToCore(reloadTask, "reload", 4096, nullptr, 3, nullptr, 1);
+    simRunTasks(10);
+    // The new pack is mapped and waits for the reader to let go of the old one
+    TEST_ASSERT_NOT_NULL(simFindTask("reload"));
+    TEST_ASSERT_EQUAL(2, simMappedCount());
+
+    simRunTasks(100);
+    TEST_ASSERT_EQUAL_STRING("first", readName);
+    TEST_ASSERT_NULL(simFindTask("reload"));
+    TEST_ASSERT_EQUAL_STRING("second", pack.animation(0)->name);
+    TEST_ASSERT_EQUAL(1, simMappedCount());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_upload_into_empty_partition);
+    RUN_TEST(test_upload_goes_to_free_slot);
+    RUN_TEST(test_corrupt_upload_keeps_current_pack);
+    RUN_TEST(test_interrupted_upload_keeps_current_pack);
+    RUN_TEST(test_rejects_upload_larger_than_slot);
+    RUN_TEST(test_rejects_truncated_upload);
+    RUN_TEST(test_upload_refused_while_reload_pending);
+    RUN_TEST(test_upload_numbered_after_pack_in_flash);
+    RUN_TEST(test_reload_waits_for_readers);
+    return UNITY_END();
+}
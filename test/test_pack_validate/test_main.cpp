@@ -0,0 +1,161 @@
+// Packs come from uploads and flash that may hold anything, validate() has to reject every pack the
+// decoders could read outside of. Run with: pio test -e native
+#include <unity.h>
+#include "../PackBuilder.h"
+
+static const uint16_t MAX_PIXELS = 256;
+static AnimationPack pack(MAX_PIXELS);
+
+// A 2 bpp animation with two frames and a native one with a single frame
+static std::vector<uint8_t> buildPack() {
+    PackBuilder builder;
+    std::vector<uint8_t> fill = {FRAME_KEY};
+    for (int run = 0; run < 4; run++) {
+        fill.push_back((FRAME_OP_FILL << 6) | 63);
+        fill.push_back(run);
+    }
+    uint16_t key = builder.addFrame(fill);
+    uint16_t delta = builder.addFrame({0, (FRAME_OP_SKIP << 6) | 63, (FRAME_OP_SKIP << 6) | 63, (FRAME_OP_SKIP << 6) | 63, (FRAME_OP_SKIP << 6) | 63});
+    uint16_t native = builder.addFrame(std::vector<uint8_t>(MAX_PIXELS * 3, 0x20));
+    builder.addAnimation("palette", 16, 16, 2, {key, delta});
+    builder.addAnimation("native", 16, 16, FRAME_NATIVE_BPP, {native});
+    return builder.build();
+}
+
+static bool valid(const std::vector<uint8_t>& data) {
+    return pack.validate(data.data(), data.size()) != nullptr;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_accepts_well_formed_pack() {
+    std::vector<uint8_t> data = buildPack();
+    TEST_ASSERT_TRUE(valid(data));
+}
+
+void test_rejects_crc_mismatch() {
+    std::vector<uint8_t> data = buildPack();
+    data.back() ^= 1;
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_truncated_pack() {
+    std::vector<uint8_t> data = buildPack();
+    TEST_ASSERT_FALSE(pack.validate(data.data(), data.size() - 4));
+}
+
+void test_rejects_tables_that_wrap_around() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::header(data)->indexOffset = 0xFFFFFFFC;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+
+    data = buildPack();
+    PackBuilder::animation(data, 0)->durationsOffset = 0xFFFFFFFC;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_frame_id_outside_of_pool() {
+    std::vector<uint8_t> data = buildPack();
+    uint16_t* frames = (uint16_t*)(data.data() + PackBuilder::animation(data, 0)->framesOffset);
+    frames[1] = PackBuilder::header(data)->poolFrameCount;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_pool_offset_outside_of_pool() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::poolOffsets(data)[1] = data.size() - PackBuilder::header(data)->poolOffset;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+
+    data = buildPack();
+    PackBuilder::poolOffsets(data)[1] = 0xFFFFFFFF;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_truncated_native_frame() {
+    std::vector<uint8_t> data = buildPack();
+    uint32_t poolSize = data.size() - PackBuilder::header(data)->poolOffset;
+    PackBuilder::poolOffsets(data)[2] = poolSize - MAX_PIXELS * 3 + 1;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_short_palette() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::animation(data, 0)->paletteSize = 3;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_animation_larger_than_display() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::animation(data, 0)->width = 17;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_unterminated_name() {
+    std::vector<uint8_t> data = buildPack();
+    memset(PackBuilder::animation(data, 1)->name, 'x', ANIMATION_PACK_NAME_SIZE);
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_animation_without_frames() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::animation(data, 0)->frameCount = 0;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_unsupported_bit_depth() {
+    std::vector<uint8_t> data = buildPack();
+    PackBuilder::animation(data, 0)->bpp = 3;
+    PackBuilder::seal(data);
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+void test_rejects_frame_running_past_pool() {
+    // The last frame of the pool starts a literal run of 64 2 bpp pixels and ends after the op byte
+    PackBuilder builder;
+    std::vector<uint8_t> fill = {FRAME_KEY};
+    for (int run = 0; run < 4; run++) {
+        fill.push_back((FRAME_OP_FILL << 6) | 63);
+        fill.push_back(run);
+    }
+    uint16_t key = builder.addFrame(fill);
+    uint16_t truncated = builder.addFrame({0, (FRAME_OP_LITERAL << 6) | 63});
+    builder.addAnimation("palette", 16, 16, 2, {key, truncated});
+    std::vector<uint8_t> data = builder.build();
+    TEST_ASSERT_FALSE(valid(data));
+
+    // A frame with too few pixels does not end in the pool either, decoding it reads on into the padding
+    builder = PackBuilder();
+    key = builder.addFrame({FRAME_KEY, (FRAME_OP_FILL << 6) | 63, 1});
+    builder.addAnimation("short", 16, 16, 2, {key});
+    data = builder.build();
+    TEST_ASSERT_FALSE(valid(data));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_accepts_well_formed_pack);
+    RUN_TEST(test_rejects_crc_mismatch);
+    RUN_TEST(test_rejects_truncated_pack);
+    RUN_TEST(test_rejects_tables_that_wrap_around);
+    RUN_TEST(test_rejects_frame_id_outside_of_pool);
+    RUN_TEST(test_rejects_pool_offset_outside_of_pool);
+    RUN_TEST(test_rejects_truncated_native_frame);
+    RUN_TEST(test_rejects_short_palette);
+    RUN_TEST(test_rejects_animation_larger_than_display);
+    RUN_TEST(test_rejects_unterminated_name);
+    RUN_TEST(test_rejects_animation_without_frames);
+    RUN_TEST(test_rejects_unsupported_bit_depth);
+    RUN_TEST(test_rejects_frame_running_past_pool);
+    return UNITY_END();
+}